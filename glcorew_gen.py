@@ -12,34 +12,156 @@
 # notice and this notice are preserved.  This file is offered as-is,
 # without any warranty.
 #
+import argparse
+import contextlib
+import io
 import re
 import os
 import urllib.request, urllib.error, urllib.parse
 
-# Parse function names from glcorearb.h
+# Loader profiles. A profile is a list of rules, each consisting of a
+# pattern for the feature block (core version or extension) and a
+# pattern for the name of an entry point. An entry point is generated
+# if any rule matches it. Entry points used by the hand-written parts
+# of oglp are always generated, so that the wrappers keep compiling;
+# all other entry points outside the profile are not declared at all.
+profiles = {
+    'full': [(r'', r'')],
+    'core45': [(r'VERSION_', r'')],
+    'core33+dsa': [(r'VERSION_[123]_', r''),
+                   (r'VERSION_4_5$', r''),
+                   (r'VERSION_4_1$', r'gl(ProgramUniform|\w*ProgramPipeline|UseProgramStages'
+                                     r'|ActiveShaderProgram|CreateShaderProgramv)')],
+    'minimal-compute': [(r'VERSION_', r'gl(Get\w*|Is\w*|Enable|Disable|Finish|Flush'
+                                      r'|DispatchCompute\w*|MemoryBarrier\w*|\w*Sync'
+                                      r'|\w*Shader\w*|\w*Program\w*|\w*Uniform\w*'
+                                      r'|\w*Buffer\w*|\w*Texture\w*|\w*Sampler\w*'
+                                      r'|\w*Quer\w*|ObjectLabel|\w*Debug\w*)$')]
+}
+
+parser = argparse.ArgumentParser(description='Generate the OpenGL loader of oglp.')
+parser.add_argument('--profile', choices=sorted(profiles), default='full',
+                    help='set of entry points to generate (default: full)')
+parser.add_argument('--output', default=None,
+                    help='directory to generate into (default: the source directory)')
+args = parser.parse_args()
+
+# Input files are found relative to the script, generated files are
+# written to the output directory, but only if their content changed.
+srcdir = os.path.dirname(os.path.abspath(__file__))
+outdir = args.output or srcdir
+
+@contextlib.contextmanager
+def output(filename):
+    path = os.path.join(outdir, filename)
+    f = io.StringIO()
+    yield f
+    if os.path.exists(path):
+        with open(path, 'r') as old:
+            if old.read() == f.getvalue():
+                return
+    os.makedirs(os.path.dirname(path), exist_ok = True)
+    with open(path, 'wt') as out:
+        out.write(f.getvalue())
+
+# Parse function prototypes and feature blocks (core versions
+# and extensions) from a header. Each prototype is tagged with
+# the feature block it belongs to.
 procs = []
-p = re.compile(r'GLAPI.*APIENTRY\s+(\w+)')
-with open('oglp/glcorearb.h', 'r') as f:
-    for line in f:
+extensions = []
+p = re.compile(r'GLAPI\s+(.*?)\s*APIENTRY\s+(\w+)\s*\((.*)\);')
+feature_p = re.compile(r'#ifndef\s+GL_(\w+)\s*$')
+def parse_header(filename):
+    feature = None
+    lines = open(filename, 'r').readlines()
+    for i, line in enumerate(lines):
+        m = feature_p.match(line)
+        if m and i + 1 < len(lines) \
+           and re.match(r'#define\s+GL_%s\b' % m.group(1), lines[i + 1]):
+            feature = m.group(1)
+            if not feature.startswith('VERSION_') and feature not in extensions:
+                extensions.append(feature)
+            continue
         m = p.match(line)
         if m:
-            procs.append(m.group(1))
+            procs.append(m.groups() + (feature,))
+
+# Parse function prototypes from glcorearb.h
+parse_header(os.path.join(srcdir, 'oglp/glcorearb.h'))
+
+# Parse function prototypes from glcoreext.h
+for filename in ['NV_explicit_multisample.h', 'NVX_gpu_memory_info.h', 'NV_shader_buffer_load.h', 'NV_vertex_buffer_unified_memory.h', 'EXT_abgr.h']:
+	parse_header(os.path.join(srcdir, 'oglp/ext', filename))
+
+# Collect the names of all entry points used by the hand-written
+# headers and sources of oglp.
+def used_names():
+    names = set()
+    for directory in ['oglp', 'src', 'tools']:
+        for filename in os.listdir(os.path.join(srcdir, directory)):
+            if filename.startswith('gl') or not filename.endswith(('.h', '.cpp')):
+                continue
+            with open(os.path.join(srcdir, directory, filename), 'r') as f:
+                names.update(re.findall(r'\b([A-Z]\w*)\s*\(', f.read()))
+    return names
+
+# Restrict the entry points to the selected profile.
+def in_profile(proc, used):
+    if proc[1][2:] in used:
+        return True
+    for feature, name in profiles[args.profile]:
+        if re.match(feature, proc[3] or '') and re.match(name, proc[1]):
+            return True
+    return False
+used = used_names()
+procs = [proc for proc in procs if in_profile(proc, used)]
+
+# Entry points of core versions can be linked directly
+# with OGLP_DIRECT_LINK, all others are always resolved.
+def is_core(proc):
+    return proc[3] is not None and proc[3].startswith('VERSION_')
+core_procs = [proc for proc in procs if is_core(proc)]
+ext_procs = [proc for proc in procs if not is_core(proc)]
+
+# Extension enumerators are sorted by name, so that the generated
+# name table can be searched with a binary search.
+extensions.sort()
 
-# Parse function names from glcoreext.h
-for filename in ['NV_explicit_multisample.h', 'NVX_gpu_memory_info.h', 'NV_shader_buffer_load.h', 'NV_vertex_buffer_unified_memory.h']:
-	with open(os.path.join('oglp/ext',filename), 'r') as f:
-		for line in f:
-			m = p.match (line)
-			if m:
-				procs.append(m.group(1))
+# Split a parameter list into (type, name) pairs.
+# The extension headers omit parameter names, so names are
+# synthesized where necessary.
+def parse_params(params):
+    result = []
+    if params.strip() == 'void':
+        return result
+    for i, param in enumerate(params.split(',')):
+        param = param.strip()
+        m = re.match(r'^(.*[\s\*])(\w+)$', param)
+        if m and m.group(1).strip() not in ['', 'const', 'unsigned']:
+            result.append((m.group(1).strip(), m.group(2)))
+        else:
+            result.append((param, 'a%d' % i))
+    return result
+
+def param_decl(param):
+    if param[0].endswith('*'):
+        return '%s%s' % param
+    return '%s %s' % param
 
 def proc_t(proc):
-    return { 'p': proc,
-             'p_s': proc[2:],
-             'p_t': 'PFN' + proc.upper() + 'PROC' }
+    ret, name, params, feature = proc
+    params = parse_params(params)
+    return { 'p': name,
+             'p_s': name[2:],
+             'p_t': 'PFN' + name.upper() + 'PROC',
+             'ret': ret,
+             'params': ', '.join([param_decl(param) for param in params]) or 'void',
+             'args': ', '.join([param[1] for param in params]),
+             'feature': feature,
+             'param_list': params }
 
 # Generate glcorew.h
-with open('oglp/glcorew.h', 'wt') as f:
+with output('oglp/glcorew.h') as f:
     f.write (r'''/*
  * Copyright (c) 2014 Daniel Kirchner
  *
@@ -53,20 +175,145 @@ with open('oglp/glcorew.h', 'wt') as f:
 #ifndef OGLP_GLCOREW_H
 #define OGLP_GLCOREW_H
 
+#include "config.h"
+
+#ifdef OGLP_DIRECT_LINK
+#if defined OGLP_DISPATCH_TABLE || defined OGLP_TRACE || defined OGLP_INSTRUMENT
+#error "OGLP_DIRECT_LINK cannot be combined with OGLP_DISPATCH_TABLE, OGLP_TRACE or OGLP_INSTRUMENT."
+#endif
+#ifndef GL_GLEXT_PROTOTYPES
+#define GL_GLEXT_PROTOTYPES
+#endif
+#endif
+
 #include "glcorearb.h"
 #include "glcoreext.h"
+#ifdef OGLP_DISPATCH_TABLE
+#include <memory>
+#endif
 
 namespace oglp {
 
 typedef void *(*GetProcAddressCallback) (const char*);
 
 void InitPrototypes (GetProcAddressCallback getprocaddress);
+void InitPrototypesLazy (GetProcAddressCallback getprocaddress);
 GLAPI int APIENTRY Unsupported (...);
 
+/* Extensions known to oglp, sorted by name. */
+enum class Extension : unsigned int
+{
+''')
+    for ext in extensions:
+        f.write('    %s,\n' % ext)
+    f.write(r'''};
+
+/* Number of extensions known to oglp. */
+const unsigned int NumExtensions = %d;
+
+/* Names of the extensions known to oglp, indexed by Extension. */
+extern const char *const ExtensionNames[NumExtensions];
+
+/* Number of OpenGL entry points in a DispatchTable. */
+const unsigned int NumProcs = %d;
+
+''' % (len(extensions), len(procs)))
+    f.write(r'''#ifdef OGLP_DISPATCH_TABLE
+class Capabilities;
+#endif
+
+/* Table of all OpenGL entry points.
+ * A newly constructed table points every entry to Unsupported. */
+struct DispatchTable
+{
+    DispatchTable (void);
+
+    /* Callback the table was initialized with. */
+    GetProcAddressCallback getprocaddress;
+
+#ifdef OGLP_DISPATCH_TABLE
+    /* Capabilities determined by the last Init with this table,
+     * null before Init. */
+    std::shared_ptr<const Capabilities> capabilities;
+#endif
+
+#if defined OGLP_DISPATCH_TABLE && defined OGLP_TRACE
+    /* Entry points the trace thunks installed in this table
+     * forward to, null unless the thunks are installed. */
+    std::unique_ptr<DispatchTable> tracenext;
+#endif
+#if defined OGLP_DISPATCH_TABLE && defined OGLP_INSTRUMENT
+    /* Entry points the instrumentation thunks installed
+     * in this table forward to. */
+    std::unique_ptr<DispatchTable> instrumentnext;
+#endif
+
 ''')
     for proc in procs:
+        f.write('    %(p_t)s %(p_s)s;\n' % proc_t(proc))
+    f.write(r'''};
+
+/* Copy the current entry points into a table. Entry points that are
+ * still lazy trampolines are resolved, so the table can be used to
+ * forward calls from layers installed in front of the driver. */
+void GetDispatch (DispatchTable *table);
+
+/* Install the entry points of a table as current entry points.
+ * With OGLP_DIRECT_LINK the entry points of core versions
+ * are linked directly and cannot be replaced. */
+void SetDispatch (const DispatchTable *table);
+
+#ifdef OGLP_DISPATCH_TABLE
+
+/* With OGLP_DISPATCH_TABLE all entry points are routed through the
+ * dispatch table that is current in the calling thread. Initially each
+ * thread uses a shared default table. Threads driving a different
+ * context should make their own table current before calling Init. */
+namespace internal {
+extern thread_local DispatchTable *currentdispatch;
+} /* namespace internal */
+
+inline DispatchTable *GetCurrentDispatchTable (void)
+{
+    return internal::currentdispatch;
+}
+
+void MakeCurrentDispatchTable (DispatchTable *table);
+
+''')
+    for proc in procs:
+        f.write('inline %(ret)s %(p_s)s (%(params)s)\n'
+                '{\n'
+                '    return internal::currentdispatch->%(p_s)s (%(args)s);\n'
+                '}\n' % proc_t(proc))
+    f.write(r'''
+#else /* !defined OGLP_DISPATCH_TABLE */
+
+#ifdef OGLP_DIRECT_LINK
+
+/* With OGLP_DIRECT_LINK the entry points of core versions forward to
+ * the symbols exported by the OpenGL library, so that the compiler can
+ * inline through the wrappers. Extensions are still resolved by Init. */
+''')
+    for proc in core_procs:
+        f.write('inline %(ret)s %(p_s)s (%(params)s)\n'
+                '{\n'
+                '    return ::%(p)s (%(args)s);\n'
+                '}\n' % proc_t(proc))
+    f.write(r'''
+#else /* !defined OGLP_DIRECT_LINK */
+
+''')
+    for proc in core_procs:
+        f.write('extern %(p_t)s %(p_s)s;\n' % proc_t(proc))
+    f.write(r'''
+#endif /* !defined OGLP_DIRECT_LINK */
+
+''')
+    for proc in ext_procs:
         f.write('extern %(p_t)s %(p_s)s;\n' % proc_t(proc))
     f.write(r'''
+#endif /* !defined OGLP_DISPATCH_TABLE */
 
 } /* namespace oglp */
 
@@ -74,7 +321,7 @@ GLAPI int APIENTRY Unsupported (...);
 ''')
 
 # Generate glcorew.cpp
-with open('src/glcorew.cpp', 'wt') as f:
+with output('src/glcorew.cpp') as f:
     f.write(r'''/*
  * Copyright (c) 2014 Daniel Kirchner
  *
@@ -90,28 +337,627 @@ with open('src/glcorew.cpp', 'wt') as f:
 
 namespace oglp {
 
+GLAPI int APIENTRY Unsupported (...)
+{
+    throw std::runtime_error ("An unsupported OpenGL entry point was called.");
+}
+
+const char *const ExtensionNames[NumExtensions] = {
 ''')
+    for ext in extensions:
+        f.write('    "GL_%s",\n' % ext)
+    f.write(r'''};
+
+DispatchTable::DispatchTable (void)
+    : getprocaddress (NULL)''')
     for proc in procs:
+        f.write(',\n      %(p_s)s ((%(p_t)s) Unsupported)' % proc_t(proc))
+    f.write(r'''
+{
+}
+
+#ifdef OGLP_DISPATCH_TABLE
+
+namespace internal {
+static DispatchTable defaultdispatch;
+thread_local DispatchTable *currentdispatch = &defaultdispatch;
+} /* namespace internal */
+
+void MakeCurrentDispatchTable (DispatchTable *table)
+{
+    internal::currentdispatch = table;
+}
+
+/* Entry points and the lazy callback live in the current table. */
+#define OGLP_ENTRY(name) (internal::currentdispatch->name)
+#define OGLP_GETPROCADDRESS (internal::currentdispatch->getprocaddress)
+
+#else /* !defined OGLP_DISPATCH_TABLE */
+
+#ifndef OGLP_DIRECT_LINK
+''')
+    for proc in core_procs:
+        f.write('%(p_t)s %(p_s)s =\n'
+		'    (%(p_t)s) Unsupported;\n' % proc_t(proc))
+    f.write('#endif /* !defined OGLP_DIRECT_LINK */\n')
+    for proc in ext_procs:
         f.write('%(p_t)s %(p_s)s =\n'
 		'    (%(p_t)s) Unsupported;\n' % proc_t(proc))
     f.write(r'''
+namespace internal {
+static GetProcAddressCallback getprocaddress = NULL;
+} /* namespace internal */
 
-GLAPI int APIENTRY Unsupported (...)
+/* Entry points and the lazy callback are process-wide globals. */
+#define OGLP_ENTRY(name) name
+#define OGLP_GETPROCADDRESS (internal::getprocaddress)
+
+#endif /* !defined OGLP_DISPATCH_TABLE */
+
+namespace internal {
+
+/* Resolve an entry point with the callback
+ * passed to InitPrototypesLazy. */
+static void *LazyResolve (const char *name)
 {
-    throw std::runtime_error ("An unsupported OpenGL entry point was called.");
+    void *ptr = OGLP_GETPROCADDRESS (name);
+    return ptr ? ptr : (void *) Unsupported;
 }
 
+''')
+    def write_lazy(proc):
+        f.write('static %(ret)s APIENTRY Lazy_%(p_s)s (%(params)s)\n'
+                '{\n'
+                '    OGLP_ENTRY (%(p_s)s) = (%(p_t)s) LazyResolve ("%(p)s");\n'
+                '    return OGLP_ENTRY (%(p_s)s) (%(args)s);\n'
+                '}\n\n' % proc_t(proc))
+    f.write('#ifndef OGLP_DIRECT_LINK\n\n')
+    for proc in core_procs:
+        write_lazy(proc)
+    f.write('#endif /* !defined OGLP_DIRECT_LINK */\n\n')
+    for proc in ext_procs:
+        write_lazy(proc)
+    f.write(r'''} /* namespace internal */
+
 void InitPrototypes (GetProcAddressCallback getprocaddress)
 {
     void *ptr;
 
+    OGLP_GETPROCADDRESS = getprocaddress;
 ''')
-    for proc in procs:
+    def write_init(proc):
         f.write('    ptr = getprocaddress ("%(p)s");\n'
-		'    if (ptr) %(p_s)s = (%(p_t)s) ptr;\n'
+		'    if (ptr) OGLP_ENTRY (%(p_s)s) = (%(p_t)s) ptr;\n'
                 % proc_t(proc))
+    f.write('#ifndef OGLP_DIRECT_LINK\n')
+    for proc in core_procs:
+        write_init(proc)
+    f.write('#endif /* !defined OGLP_DIRECT_LINK */\n')
+    for proc in ext_procs:
+        write_init(proc)
+    f.write(r'''
+}
+
+void InitPrototypesLazy (GetProcAddressCallback getprocaddress)
+{
+    OGLP_GETPROCADDRESS = getprocaddress;
+#ifndef OGLP_DIRECT_LINK
+''')
+    for proc in core_procs:
+        f.write('    OGLP_ENTRY (%(p_s)s) = internal::Lazy_%(p_s)s;\n' % proc_t(proc))
+    f.write('#endif /* !defined OGLP_DIRECT_LINK */\n')
+    for proc in ext_procs:
+        f.write('    OGLP_ENTRY (%(p_s)s) = internal::Lazy_%(p_s)s;\n' % proc_t(proc))
     f.write(r'''
 }
 
+void GetDispatch (DispatchTable *table)
+{
+    table->getprocaddress = OGLP_GETPROCADDRESS;
+''')
+    def write_get(proc):
+        f.write('    table->%(p_s)s = OGLP_ENTRY (%(p_s)s) == internal::Lazy_%(p_s)s\n'
+                '        ? (%(p_t)s) internal::LazyResolve ("%(p)s") : OGLP_ENTRY (%(p_s)s);\n' % proc_t(proc))
+    f.write('#ifdef OGLP_DIRECT_LINK\n')
+    for proc in core_procs:
+        f.write('    table->%(p_s)s = ::%(p)s;\n' % proc_t(proc))
+    f.write('#else /* !defined OGLP_DIRECT_LINK */\n')
+    for proc in core_procs:
+        write_get(proc)
+    f.write('#endif /* !defined OGLP_DIRECT_LINK */\n')
+    for proc in ext_procs:
+        write_get(proc)
+    f.write(r'''}
+
+void SetDispatch (const DispatchTable *table)
+{
+    OGLP_GETPROCADDRESS = table->getprocaddress;
+#ifndef OGLP_DIRECT_LINK
+''')
+    for proc in core_procs:
+        f.write('    OGLP_ENTRY (%(p_s)s) = table->%(p_s)s;\n' % proc_t(proc))
+    f.write('#endif /* !defined OGLP_DIRECT_LINK */\n')
+    for proc in ext_procs:
+        f.write('    OGLP_ENTRY (%(p_s)s) = table->%(p_s)s;\n' % proc_t(proc))
+    f.write(r'''}
+
+#undef OGLP_ENTRY
+#undef OGLP_GETPROCADDRESS
+
 } /* namespace oglp */
 ''')
+
+# Number of values read by the viewport array calls.
+viewports = { 'glViewportArrayv': 'count * 4',
+              'glViewportIndexedfv': '4',
+              'glScissorArrayv': 'count * 4',
+              'glScissorIndexedv': '4',
+              'glDepthRangeArrayv': 'count * 2' }
+
+# Determine which client memory a traced call references.
+# Returns the statements recording it before and after the call.
+def trace_captures(proc):
+    t = proc_t(proc)
+    name = t['p']
+    params = t['param_list']
+    idx = dict([(param[1], i) for i, param in enumerate(params)])
+    types = dict([(param[1], param[0]) for param in params])
+    before = []
+    after = []
+    captured = set()
+    def pointee(param):
+        return types[param].replace('const', '').replace('*', '').strip()
+    def blob(param, size, out = False):
+        stmt = 'record.Blob (%d, %s, %s%s);' % (idx[param], param, size,
+                                                ', true' if out else '')
+        (after if out else before).append(stmt)
+        captured.add(param)
+    uploads = { 'glBufferData': ('data', 'size'),
+                'glBufferSubData': ('data', 'size'),
+                'glBufferStorage': ('data', 'size'),
+                'glNamedBufferData': ('data', 'size'),
+                'glNamedBufferSubData': ('data', 'size'),
+                'glNamedBufferStorage': ('data', 'size'),
+                'glProgramBinary': ('binary', 'length') }
+    if name in uploads:
+        blob(*uploads[name])
+    elif re.match(r'glCompressed\w*Image[123]D$', name):
+        before.append('record.Pixels (%d, data, imageSize);' % idx['data'])
+        captured.add('data')
+    elif re.match(r'gl(Tex|Texture)(Sub)?Image[123]D$', name) and 'pixels' in idx:
+        before.append('record.Image (%d, pixels, format, type, width, %s, %s);'
+                      % (idx['pixels'], 'height' if 'height' in idx else '1',
+                         'depth' if 'depth' in idx else '1'))
+        captured.add('pixels')
+    elif name == 'glShaderSource':
+        before.append('record.Strings (%d, count, string, length);' % idx['string'])
+        captured.add('string')
+    elif name == 'glCreateShaderProgramv':
+        before.append('record.Strings (%d, count, strings, NULL);' % idx['strings'])
+        captured.add('strings')
+    elif name in ['glTransformFeedbackVaryings', 'glGetUniformIndices']:
+        strings = params[2][1]
+        before.append('record.Strings (%d, %s, %s, NULL);'
+                      % (idx[strings], params[1][1], strings))
+        captured.add(strings)
+    elif name in ['glDrawBuffers', 'glNamedFramebufferDrawBuffers']:
+        blob('bufs', 'n * sizeof (GLenum)')
+    elif name == 'glCompileShaderIncludeARB':
+        before.append('record.Strings (%d, count, path, length);' % idx['path'])
+        captured.add('path')
+    elif name in ['glDebugMessageControl', 'glDebugMessageControlARB']:
+        blob('ids', 'count * sizeof (GLuint)')
+    elif name == 'glShaderBinary':
+        blob('shaders', 'count * sizeof (GLuint)')
+        blob('binary', 'length')
+    elif name == 'glUniformSubroutinesuiv':
+        blob('indices', 'count * sizeof (GLuint)')
+    elif name == 'glGetActiveUniformsiv':
+        blob('uniformIndices', 'uniformCount * sizeof (GLuint)')
+    elif name == 'glGetProgramResourceiv':
+        blob('props', 'propCount * sizeof (GLenum)')
+    elif re.match(r'gl(Program)?Uniform(Handle)?ui64v(ARB|NV)$', name):
+        blob(params[-1][1], 'count * sizeof (%s)' % pointee(params[-1][1]))
+    elif re.match(r'glVertexAttribP[1-4]uiv$', name):
+        blob('value', 'sizeof (GLuint)')
+    elif re.match(r'glInvalidate\w*Framebuffer\w*$', name) and 'attachments' in idx:
+        blob('attachments', 'numAttachments * sizeof (GLenum)')
+    elif re.match(r'glClear\w*(Tex|Buffer)\w*(Image|Data)$', name) and 'format' in idx:
+        before.append('record.Pixel (%d, data, format, type);' % idx['data'])
+        captured.add('data')
+    elif re.match(r'gl(ClearBuffer|ClearNamedFramebuffer)(iv|uiv|fv)$', name):
+        blob('value', '(buffer == GL_COLOR ? 4 : 1) * sizeof (%s)' % pointee('value'))
+    elif name in viewports and 'v' in idx:
+        blob('v', '%s * sizeof (%s)' % (viewports[name], pointee('v')))
+    m = re.match(r'gl\w*Parameter(f|i|Ii|Iui)v$', name)
+    if m and not name.startswith('glGet') and 'pname' in idx \
+       and params[-1][0].startswith('const'):
+        blob(params[-1][1], 'TraceParameterCount (pname) * sizeof (%s)'
+             % pointee(params[-1][1]))
+    m = re.match(r'glVertexAttrib[IL]?([1-4])N?(b|s|i|f|d|ub|us|ui|ui64)v(ARB)?$', name)
+    if m and 'v' in idx:
+        blob('v', '%s * sizeof (%s)' % (m.group(1), pointee('v')))
+    if re.match(r'glMultiDraw\w+$', name) and 'Indirect' not in name and 'drawcount' in idx:
+        for param in params:
+            if param[0].startswith('const') and param[0].endswith('*'):
+                if param[0].count('*') > 1:
+                    blob(param[1], 'drawcount * sizeof (const void *)')
+                else:
+                    blob(param[1], 'drawcount * sizeof (%s)' % pointee(param[1]))
+    m = re.match(r'gl(Program)?Uniform(Matrix)?([234]|1)(?:x([234]))?(f|d|i|ui|i64ARB|ui64ARB|ui64NV)v$', name)
+    if m and 'value' in idx and 'count' in idx:
+        components = int(m.group(3)) * int(m.group(4) or (m.group(3) if m.group(2) else 1))
+        blob('value', 'count * %d * sizeof (%s)' % (components, pointee('value')))
+    m = re.match(r'gl(Gen|Create|Delete)\w+s$', name)
+    if m and len(params) >= 2 and params[-1][0].replace(' ', '') in ['GLuint*', 'constGLuint*']:
+        count = 'n' if 'n' in idx else 'count'
+        blob(params[-1][1], '%s * sizeof (GLuint)' % count, m.group(1) != 'Delete')
+    if re.match(r'gl(Bind\w+s(Base|Range)?|VertexArrayVertexBuffers)$', name) and 'count' in idx:
+        for param in params:
+            if param[0].startswith('const') and param[0].endswith('*'):
+                blob(param[1], 'count * sizeof (%s)' % pointee(param[1]))
+    for param in params:
+        if param[0].replace(' ', '') == 'constGLchar*' and param[1] not in captured:
+            length = 'length' if types.get('length') == 'GLsizei' else '-1'
+            before.append('record.String (%d, %s, %s);' % (idx[param[1]], param[1], length))
+            captured.add(param[1])
+    return before, after
+
+# Generate gltrace.cpp
+with output('src/gltrace.cpp') as f:
+    f.write(r"""/*
+ * Copyright (c) 2014 Daniel Kirchner
+ *
+ * Copying and distribution of this file, with or without modification,
+ * are permitted in any medium without royalty provided the copyright
+ * notice and this notice are preserved.  This file is offered as-is,
+ * without any warranty. 
+ */
+/* This file was generated by glcorew_gen.py.
+ * Don't change it directly, change glcorew_gen.py instead.*/
+#include <oglp/trace.h>
+
+#ifdef OGLP_TRACE
+
+namespace oglp {
+namespace internal {
+
+const unsigned int NumTraceProcs = %d;
+
+const char *const TraceProcNames[NumTraceProcs] = {
+""" % len(procs))
+    for proc in procs:
+        f.write('    "%(p)s",\n' % proc_t(proc))
+    f.write('};\n\n')
+    for i, proc in enumerate(procs):
+        t = proc_t(proc)
+        before, after = trace_captures(proc)
+        f.write('static %(ret)s APIENTRY Trace_%(p_s)s (%(params)s)\n'
+                '{\n' % t)
+        f.write('    TraceRecord record (%d, %d);\n' % (i, len(t['param_list'])))
+        for param in t['param_list']:
+            f.write('    record.Arg (%s);\n' % param[1])
+        for stmt in before:
+            f.write('    %s\n' % stmt)
+        if t['ret'] == 'void':
+            f.write('    TraceNext ().%(p_s)s (%(args)s);\n' % t)
+        else:
+            f.write('    %(ret)s result = TraceNext ().%(p_s)s (%(args)s);\n'
+                    '    record.Return (result);\n' % t)
+        for stmt in after:
+            f.write('    %s\n' % stmt)
+        f.write('    record.Commit ();\n')
+        if t['ret'] != 'void':
+            f.write('    return result;\n')
+        f.write('}\n\n')
+    f.write(r"""void GetTraceThunks (DispatchTable *table)
+{
+""")
+    for proc in procs:
+        f.write('    table->%(p_s)s = Trace_%(p_s)s;\n' % proc_t(proc))
+    f.write(r"""}
+
+} /* namespace internal */
+} /* namespace oglp */
+
+#endif /* defined OGLP_TRACE */
+""")
+
+# Name spaces of object name parameters, remapped during replay.
+object_params = { 'buffer': 'Buffer', 'buffers': 'Buffer',
+                  'readBuffer': 'Buffer', 'writeBuffer': 'Buffer',
+                  'texture': 'Texture', 'textures': 'Texture',
+                  'program': 'Program', 'shader': 'Shader',
+                  'shaders': 'Shader',
+                  'vaobj': 'VertexArray', 'array': 'VertexArray',
+                  'arrays': 'VertexArray',
+                  'framebuffer': 'Framebuffer', 'framebuffers': 'Framebuffer',
+                  'readFramebuffer': 'Framebuffer',
+                  'drawFramebuffer': 'Framebuffer',
+                  'renderbuffer': 'Renderbuffer',
+                  'renderbuffers': 'Renderbuffer',
+                  'sampler': 'Sampler', 'samplers': 'Sampler',
+                  'pipeline': 'Pipeline', 'pipelines': 'Pipeline',
+                  'xfb': 'TransformFeedback' }
+
+def object_type(name, param):
+    if param[0].replace('const', '').replace('*', '').strip() != 'GLuint':
+        return None
+    if param[1] in ['id', 'ids']:
+        if 'TransformFeedback' in name:
+            return 'TransformFeedback'
+        if 'Quer' in name:
+            return 'Query'
+        return None
+    return object_params.get(param[1])
+
+# Objects returned by entry points.
+object_returns = { 'glCreateProgram': 'Program',
+                   'glCreateShader': 'Shader',
+                   'glCreateShaderProgramv': 'Program' }
+
+# Determine the statements replaying a recorded call.
+# Returns None for entry points that cannot be replayed.
+def replay_call(proc):
+    t = proc_t(proc)
+    name = t['p']
+    params = t['param_list']
+    idx = dict([(param[1], i) for i, param in enumerate(params)])
+    args = []
+    after = []
+    strings = None
+    for param in params:
+        if param[0] == 'const GLchar *const*':
+            strings = param[1]
+    for i, param in enumerate(params):
+        ptype = param[0]
+        otype = object_type(name, param)
+        if ptype.startswith('struct'):
+            return None
+        elif ptype.startswith('GLDEBUGPROC'):
+            args.append('NULL')
+        elif ptype == 'GLsync':
+            args.append('call.Sync (%d)' % i)
+        elif ptype == 'const GLchar *const*':
+            args.append('call.Strings (%d)' % i)
+        elif name in ['glShaderSource', 'glCompileShaderIncludeARB'] \
+             and param[1] == 'length':
+            args.append('call.StringLengths (%d)' % idx[strings])
+        elif otype and ptype.endswith('*'):
+            if ptype.startswith('const'):
+                args.append('call.Objects (%d, Object%s)' % (i, otype))
+            else:
+                args.append('call.Output<%s> (%d)' % (ptype, i))
+                if re.match(r'gl(Gen|Create)\w+s$', name):
+                    after.append('call.MapObjects (%d, Object%s);' % (i, otype))
+        elif otype:
+            args.append('call.Object (%d, Object%s)' % (i, otype))
+        elif param[1] == 'location' and 'program' in idx:
+            args.append('call.Location (%d, %d)' % (idx['program'], i))
+        elif ptype.endswith('*'):
+            if ptype.startswith('const'):
+                args.append('call.Pointer<%s> (%d)' % (ptype, i))
+            else:
+                args.append('call.Output<%s> (%d)' % (ptype, i))
+        else:
+            args.append('call.Value<%s> (%d)' % (ptype.replace('const ', ''), i))
+    stmts = []
+    call = '%s (%s);' % (t['p_s'], ', '.join(args))
+    if name in object_returns:
+        stmts.append('GLuint result = ' + call)
+        after.append('call.MapObject (Object%s, result);' % object_returns[name])
+    elif name == 'glFenceSync':
+        stmts.append('GLsync result = ' + call)
+        after.append('call.MapSync (result);')
+    elif name in ['glGetUniformLocation', 'glGetProgramResourceLocation']:
+        stmts.append('GLint result = ' + call)
+        after.append('call.MapLocation (%d, result);' % idx['program'])
+    else:
+        stmts.append(call)
+    return stmts + after
+
+# Generate glreplay.cpp
+with output('tools/glreplay.cpp') as f:
+    f.write(r"""/*
+ * Copyright (c) 2014 Daniel Kirchner
+ *
+ * Copying and distribution of this file, with or without modification,
+ * are permitted in any medium without royalty provided the copyright
+ * notice and this notice are preserved.  This file is offered as-is,
+ * without any warranty. 
+ */
+/* This file was generated by glcorew_gen.py.
+ * Don't change it directly, change glcorew_gen.py instead.*/
+#include "replay.h"
+
+namespace oglp {
+namespace replay {
+
+""")
+    replayable = []
+    for proc in procs:
+        t = proc_t(proc)
+        stmts = replay_call(proc)
+        replayable.append(stmts is not None)
+        if stmts is None:
+            continue
+        f.write('static void Replay_%(p_s)s (Call &call)\n'
+                '{\n' % t)
+        if not t['param_list']:
+            f.write('    (void) call;\n')
+        for stmt in stmts:
+            f.write('    %s\n' % stmt)
+        f.write('}\n\n')
+    f.write(r"""const unsigned int NumReplayProcs = %d;
+
+const ReplayProc ReplayProcs[NumReplayProcs] = {
+""" % len(procs))
+    for proc, ok in zip(procs, replayable):
+        t = proc_t(proc)
+        f.write('    { "%s", %d, %s },\n' % (t['p'], len(t['param_list']),
+                                           'Replay_' + t['p_s'] if ok else 'NULL'))
+    f.write(r"""};
+
+} /* namespace replay */
+} /* namespace oglp */
+""")
+
+# Statements of null driver stubs that differ from doing nothing.
+null_special = { 'glGetString': 'return NullString (name);',
+                 'glGetStringi': 'return NullStringi (name, index);',
+                 'glCheckFramebufferStatus': 'return GL_FRAMEBUFFER_COMPLETE;',
+                 'glCheckNamedFramebufferStatus': 'return GL_FRAMEBUFFER_COMPLETE;',
+                 'glClientWaitSync': 'return GL_ALREADY_SIGNALED;',
+                 'glFenceSync': 'return NullSync ();',
+                 'glUnmapBuffer': 'return GL_TRUE;',
+                 'glUnmapNamedBuffer': 'return GL_TRUE;',
+                 'glMapBuffer': 'return NullMapTarget (target, 0, 0);',
+                 'glMapBufferRange': 'return NullMapTarget (target, offset, length);',
+                 'glMapNamedBuffer': 'return NullMapBuffer (buffer, 0, 0);',
+                 'glMapNamedBufferRange': 'return NullMapBuffer (buffer, offset, length);',
+                 'glCreateProgram': 'return NullName ();',
+                 'glCreateShader': 'return NullName ();',
+                 'glCreateShaderProgramv': 'return NullName ();' }
+
+# Determine the statements of a null driver stub.
+def null_stub(proc):
+    t = proc_t(proc)
+    name = t['p']
+    params = t['param_list']
+    idx = dict([(param[1], i) for i, param in enumerate(params)])
+    stmts = []
+    if name in null_special:
+        return [null_special[name]]
+    m = re.match(r'gl(Gen|Create)\w+s$', name)
+    if m and len(params) >= 2 and params[-1][0].replace(' ', '') == 'GLuint*':
+        count = 'n' if 'n' in idx else 'count'
+        stmts.append('NullNames (%s, %s);' % (count, params[-1][1]))
+    elif name.startswith('glGet'):
+        key = 'pname' if 'pname' in idx else 'target' if 'target' in idx else '0'
+        for param in params:
+            ptype = param[0]
+            if not ptype.endswith('*') or ptype.startswith('const') or ptype.startswith('void'):
+                continue
+            if ptype == 'GLchar *':
+                if 'bufSize' in idx:
+                    stmts.append('if (%s && bufSize > 0) %s[0] = 0;' % (param[1], param[1]))
+            elif param[1] in ['length', 'count'] and ptype == 'GLsizei *':
+                stmts.append('if (%s) *%s = 0;' % (param[1], param[1]))
+            else:
+                stmts.append('NullQuery (%s, %s);' % (key, param[1]))
+    if t['ret'] != 'void':
+        stmts.append('return 0;')
+    return stmts
+
+# Generate glnull.cpp
+with output('src/glnull.cpp') as f:
+    f.write(r"""/*
+ * Copyright (c) 2014 Daniel Kirchner
+ *
+ * Copying and distribution of this file, with or without modification,
+ * are permitted in any medium without royalty provided the copyright
+ * notice and this notice are preserved.  This file is offered as-is,
+ * without any warranty. 
+ */
+/* This file was generated by glcorew_gen.py.
+ * Don't change it directly, change glcorew_gen.py instead.*/
+#ifdef OGLP_NULL_EXPORT
+#ifndef GL_GLEXT_PROTOTYPES
+#define GL_GLEXT_PROTOTYPES
+#endif
+#endif
+#include <oglp/nulldriver.h>
+
+/* With OGLP_NULL_EXPORT the stubs of core versions are exported under
+ * their OpenGL names, so that the null driver can be linked in place of
+ * the OpenGL library by code built with OGLP_DIRECT_LINK. */
+#ifdef OGLP_NULL_EXPORT
+#define OGLP_NULL_CORE extern "C"
+#define OGLP_NULL_CORE_NAME(name) gl##name
+#else
+#define OGLP_NULL_CORE static
+#define OGLP_NULL_CORE_NAME(name) Null_##name
+#endif
+
+namespace oglp {
+namespace internal {
+
+std::atomic<unsigned long> nullcounts[%d];
+
+""" % len(procs))
+    for i, proc in enumerate(procs):
+        t = proc_t(proc)
+        stmts = null_stub(proc)
+        # leave out the names of unused parameters
+        params = [param_decl(param) if any(re.search(r'\b%s\b' % param[1], stmt)
+                                           for stmt in stmts)
+                  else param[0].rstrip() for param in t['param_list']]
+        t['params'] = ', '.join(params) or 'void'
+        if is_core(proc):
+            f.write('OGLP_NULL_CORE %(ret)s APIENTRY OGLP_NULL_CORE_NAME (%(p_s)s) (%(params)s)\n'
+                    '{\n' % t)
+        else:
+            f.write('static %(ret)s APIENTRY Null_%(p_s)s (%(params)s)\n'
+                    '{\n' % t)
+        f.write('    NullCount (%d);\n' % i)
+        for stmt in stmts:
+            f.write('    %s\n' % stmt)
+        f.write('}\n\n')
+    f.write(r"""const unsigned int NumNullProcs = %d;
+
+const NullProc NullProcs[NumNullProcs] = {
+""" % len(procs))
+    for i, proc in sorted(enumerate(procs), key = lambda x: x[1][1]):
+        t = proc_t(proc)
+        stub = ('OGLP_NULL_CORE_NAME (%s)' if is_core(proc) else 'Null_%s') % t['p_s']
+        f.write('    { "%s", reinterpret_cast<void *> (%s), %d },\n'
+                % (t['p'], stub, i))
+    f.write(r"""};
+
+} /* namespace internal */
+} /* namespace oglp */
+""")
+
+# Generate glinstrument.cpp
+with output('src/glinstrument.cpp') as f:
+    f.write(r"""/*
+ * Copyright (c) 2014 Daniel Kirchner
+ *
+ * Copying and distribution of this file, with or without modification,
+ * are permitted in any medium without royalty provided the copyright
+ * notice and this notice are preserved.  This file is offered as-is,
+ * without any warranty. 
+ */
+/* This file was generated by glcorew_gen.py.
+ * Don't change it directly, change glcorew_gen.py instead.*/
+#include <oglp/instrument.h>
+
+#ifdef OGLP_INSTRUMENT
+
+namespace oglp {
+namespace internal {
+
+const char *const InstrumentProcNames[NumProcs] = {
+""")
+    for proc in procs:
+        f.write('    "%(p)s",\n' % proc_t(proc))
+    f.write('};\n\n')
+    for i, proc in enumerate(procs):
+        t = proc_t(proc)
+        f.write('static %(ret)s APIENTRY Instrument_%(p_s)s (%(params)s)\n'
+                '{\n' % t)
+        f.write('    InstrumentScope scope (%d);\n' % i)
+        f.write('    return InstrumentNext ().%(p_s)s (%(args)s);\n' % t)
+        f.write('}\n\n')
+    f.write(r"""void GetInstrumentThunks (DispatchTable *table)
+{
+""")
+    for proc in procs:
+        f.write('    table->%(p_s)s = Instrument_%(p_s)s;\n' % proc_t(proc))
+    f.write(r"""}
+
+} /* namespace internal */
+} /* namespace oglp */
+
+#endif /* defined OGLP_INSTRUMENT */
+""")
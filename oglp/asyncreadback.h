@@ -0,0 +1,252 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OGLP_ASYNCREADBACK_H
+#define OGLP_ASYNCREADBACK_H
+
+#include "common.h"
+#include "buffer.h"
+#include "fence.h"
+#include "texture.h"
+#include <deque>
+#include <utility>
+
+namespace oglp {
+
+/** Asynchronous readback.
+ * Reads texture images and buffer ranges into persistently mapped pack
+ * buffers without waiting for the GPU. Each readback returns a Result,
+ * which completes once the fence inserted after the read is signaled
+ * and then hands out a pointer into the mapped pack buffer, so the data
+ * is not copied again. Pack buffers are pooled and reused once their
+ * Result is destroyed and the GPU is done with them.
+ */
+class AsyncReadback
+{
+private:
+    /* a pooled pack buffer */
+    struct Slot
+    {
+        Buffer buffer;
+        GLsizeiptr capacity;
+        const GLvoid *ptr;
+        Fence fence;
+        bool busy;
+    };
+
+public:
+    /** Readback result.
+     * A future-like handle of a pending readback. The result keeps its
+     * pack buffer until it is destroyed and must not outlive the
+     * AsyncReadback object it was returned by.
+     */
+    class Result
+    {
+    public:
+        /**
+           * Default constructor.
+           * Creates an empty Result object.
+           */
+        Result (void) : slot (NULL), size (0)
+        {
+        }
+
+        /**
+           * Move constuctor.
+           * Passes the pack buffer to another Result object.
+           * \param result The Result object to move.
+           */
+        Result (Result &&result) noexcept : slot (result.slot), size (result.size)
+        {
+            result.slot = NULL;
+            result.size = 0;
+        }
+
+        /**
+           * Deleted copy constructor.
+           * A Result object can't be copy constructed.
+           */
+        Result (const Result &) = delete;
+
+        /**
+           * A destructor.
+           * Returns the pack buffer to the pool.
+           */
+        ~Result (void)
+        {
+            if (slot)
+                slot->busy = false;
+        }
+
+        /**
+           * Move assignment.
+           * Passes the pack buffer to another Result object.
+           * \param result The Result object to move.
+           * \return A reference to the Result object.
+           */
+        Result &operator= (Result &&result) noexcept
+        {
+            std::swap (slot, result.slot);
+            std::swap (size, result.size);
+            return *this;
+        }
+
+        /**
+           * Deleted copy assignment.
+           * A Result object can't be copy assigned.
+           * \return
+           */
+        Result &operator= (const Result &) = delete;
+
+        /**
+           * Check whether the readback is complete.
+           * Does not block, but flushes the command stream if the
+           * readback is not complete yet, so that it eventually is.
+           * \return Whether the data is available.
+           */
+        bool IsReady (void) const
+        {
+            return slot && slot->fence.ClientWait (0);
+        }
+
+        /**
+           * Wait for the readback.
+           * \param timeout Specifies the timeout in nanoseconds.
+           * \return A pointer to the data or NULL if the readback
+           *         did not complete before the timeout expired.
+           */
+        const GLvoid *Wait (GLuint64 timeout = GL_TIMEOUT_IGNORED) const
+        {
+            if (!slot || !slot->fence.ClientWait (timeout))
+                return NULL;
+            return slot->ptr;
+        }
+
+        /**
+           * Get the data.
+           * \return A pointer to the data or NULL if the readback
+           *         is not complete.
+           */
+        const GLvoid *Get (void) const
+        {
+            return IsReady () ? slot->ptr : NULL;
+        }
+
+        /**
+           * Return the size of the data.
+           * \return The number of bytes read back.
+           */
+        GLsizeiptr GetSize (void) const
+        {
+            return size;
+        }
+
+    private:
+        friend class AsyncReadback;
+
+        Result (Slot *_slot, GLsizeiptr _size) : slot (_slot), size (_size)
+        {
+        }
+
+        /**
+           * pack buffer of the readback
+           */
+        Slot *slot;
+        /**
+           * size of the data
+           */
+        GLsizeiptr size;
+    };
+
+    /**
+       * Constructor.
+       * Creates an empty pack buffer pool.
+       * \param _maxbuffers Specifies the maximum number of pack buffers.
+       *                    Once the pool is full, a readback waits for
+       *                    an idle pack buffer instead.
+       */
+    AsyncReadback (size_t _maxbuffers = 16) : maxbuffers (_maxbuffers)
+    {
+    }
+
+    /**
+       * Deleted copy constructor.
+       * An AsyncReadback object can't be copy constructed.
+       */
+    AsyncReadback (const AsyncReadback &) = delete;
+
+    /**
+       * Deleted copy assignment.
+       * An AsyncReadback object can't be copy assigned.
+       * \return
+       */
+    AsyncReadback &operator= (const AsyncReadback &) = delete;
+
+    /**
+       * Read a texture subimage.
+       * Same as Texture::GetSubImage, except that it does not wait.
+       * The pixel pack buffer binding is restored afterwards.
+       * \param size Specifies the size of the image data in bytes
+       *             according to the pack state.
+       * \return The pending readback, which is empty if the pool is
+       *         full and all pack buffers are held by results or if
+       *         the size does not fit into a GLsizei.
+       */
+    Result ReadTexture (const Texture &texture, GLint level, GLint xoffset,
+                        GLint yoffset, GLint zoffset, GLsizei width,
+                        GLsizei height, GLsizei depth, GLenum format,
+                        GLenum type, GLsizeiptr size);
+
+    /**
+       * Read a buffer range.
+       * \param buffer Specifies the buffer object to read from.
+       * \param offset Specifies the offset of the range.
+       * \param size Specifies the size of the range.
+       * \return The pending readback, which is empty if the pool is
+       *         full and all pack buffers are held by results.
+       */
+    Result ReadBuffer (const Buffer &buffer, GLintptr offset,
+                       GLsizeiptr size);
+
+    /**
+       * Return the number of pack buffers.
+       * \return The number of pack buffers in the pool.
+       */
+    size_t GetNumBuffers (void) const
+    {
+        return slots.size ();
+    }
+
+private:
+    Slot *Acquire (GLsizeiptr size);
+    void Submit (Slot *slot);
+
+    /**
+       * pooled pack buffers, in a deque so that results can point to them
+       */
+    std::deque<Slot> slots;
+    /**
+       * maximum number of pack buffers
+       */
+    size_t maxbuffers;
+};
+
+} /* namespace oglp */
+
+#endif /* !defined OGLP_ASYNCREADBACK_H */
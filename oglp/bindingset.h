@@ -0,0 +1,221 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OGLP_BINDINGSET_H
+#define OGLP_BINDINGSET_H
+
+#include "common.h"
+#include "buffer.h"
+#include "sampler.h"
+#include "texture.h"
+#include <vector>
+
+namespace oglp {
+
+namespace internal {
+
+/* binding points handled by BindingSet */
+enum BindingKind
+{
+    BindingUniformBuffer,
+    BindingShaderStorageBuffer,
+    BindingAtomicCounterBuffer,
+    BindingTransformFeedbackBuffer,
+    BindingTexture,
+    BindingSampler,
+    BindingImage,
+    NumBindingKinds
+};
+
+/* name of units that are not specified by a set or unknown to a state */
+const GLuint UnknownBinding = ~GLuint (0);
+
+/* A binding of a single unit. A whole buffer is bound with a size of -1. */
+struct Binding
+{
+    GLuint name;
+    GLintptr offset;
+    GLsizeiptr size;
+
+    bool operator== (const Binding &b) const
+    {
+        return name == b.name && offset == b.offset && size == b.size;
+    }
+
+    bool operator!= (const Binding &b) const
+    {
+        return !(*this == b);
+    }
+};
+
+} /* namespace internal */
+
+/** Binding state.
+ * Tracks the bindings applied by BindingSet objects in a context, so
+ * that applying a set only changes the bindings that differ.
+ */
+class BindingState
+{
+public:
+    /**
+       * Default constructor.
+       * Creates a BindingState object with unknown bindings.
+       */
+    BindingState (void)
+    {
+    }
+
+    /**
+       * Invalidate the tracked state.
+       * Needs to be called after changing bindings without a BindingSet,
+       * e.g. with Buffer::BindBase or Texture::Bind.
+       */
+    void Invalidate (void)
+    {
+        unsigned int i;
+        for (i = 0; i < internal::NumBindingKinds; i++)
+            units[i].clear ();
+    }
+
+private:
+    friend class BindingSet;
+
+    /**
+       * current bindings per binding point, units named UnknownBinding
+       * and units past the end are unknown
+       */
+    std::vector<internal::Binding> units[internal::NumBindingKinds];
+};
+
+/** Binding set.
+ * Collects the buffer, texture, sampler and image bindings for a draw
+ * and applies them with the multi-bind functions, e.g. glBindBuffersRange
+ * or glBindTextures. Only units that differ from the tracked state are
+ * rebound, with one call per contiguous range of units. Units that are
+ * not specified by the set keep their current binding.
+ */
+class BindingSet
+{
+public:
+    /**
+       * Default constructor.
+       * Creates an empty BindingSet object.
+       */
+    BindingSet (void)
+    {
+    }
+
+    /**
+       * Bind a whole buffer.
+       * Same as Buffer::BindBase, except that the binding is applied later.
+       * \param target Specifies the target, i.e. GL_UNIFORM_BUFFER,
+       *               GL_SHADER_STORAGE_BUFFER, GL_ATOMIC_COUNTER_BUFFER
+       *               or GL_TRANSFORM_FEEDBACK_BUFFER.
+       * \param index Specifies the index of the binding point.
+       * \param buffer Specifies the buffer object to bind.
+       */
+    void SetBufferBase (GLenum target, GLuint index, const Buffer &buffer)
+    {
+        Set (BufferKind (target), index, buffer.get (), 0, -1);
+    }
+
+    /**
+       * Bind a buffer range.
+       * Same as Buffer::BindRange, except that the binding is applied later.
+       * \param target Specifies the target, see SetBufferBase.
+       * \param index Specifies the index of the binding point.
+       * \param buffer Specifies the buffer object to bind.
+       * \param offset Specifies the offset of the range.
+       * \param size Specifies the size of the range.
+       */
+    void SetBufferRange (GLenum target, GLuint index, const Buffer &buffer,
+                         GLintptr offset, GLsizeiptr size)
+    {
+        Set (BufferKind (target), index, buffer.get (), offset, size);
+    }
+
+    /**
+       * Bind a texture.
+       * Same as Texture::Bind, except that the binding is applied later.
+       * \param unit Specifies the texture unit.
+       * \param texture Specifies the texture object to bind.
+       */
+    void SetTexture (GLuint unit, const Texture &texture)
+    {
+        Set (internal::BindingTexture, unit, texture.get (), 0, 0);
+    }
+
+    /**
+       * Bind a sampler.
+       * Same as Sampler::Bind, except that the binding is applied later.
+       * \param unit Specifies the texture unit.
+       * \param sampler Specifies the sampler object to bind.
+       */
+    void SetSampler (GLuint unit, const Sampler &sampler)
+    {
+        Set (internal::BindingSampler, unit, sampler.get (), 0, 0);
+    }
+
+    /**
+       * Bind an image.
+       * Binds level zero of a texture for reading and writing with its
+       * internal format, layered if the texture is an array, cube map or
+       * three-dimensional texture, as glBindImageTextures does.
+       * \param unit Specifies the image unit.
+       * \param texture Specifies the texture object to bind.
+       */
+    void SetImage (GLuint unit, const Texture &texture)
+    {
+        Set (internal::BindingImage, unit, texture.get (), 0, 0);
+    }
+
+    /**
+       * Clear the set.
+       * Removes all bindings from the set.
+       */
+    void Clear (void)
+    {
+        unsigned int i;
+        for (i = 0; i < internal::NumBindingKinds; i++)
+            units[i].clear ();
+    }
+
+    /**
+       * Apply the bindings.
+       * \param state Specifies the tracked bindings of the current
+       *              context, which are updated.
+       * \return The number of binding calls issued.
+       */
+    unsigned int Apply (BindingState &state) const;
+
+private:
+    static internal::BindingKind BufferKind (GLenum target);
+    void Set (internal::BindingKind kind, GLuint index, GLuint name,
+              GLintptr offset, GLsizeiptr size);
+
+    /**
+       * bindings per binding point, units named UnknownBinding
+       * are not specified
+       */
+    std::vector<internal::Binding> units[internal::NumBindingKinds];
+};
+
+} /* namespace oglp */
+
+#endif /* !defined OGLP_BINDINGSET_H */
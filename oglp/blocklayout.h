@@ -0,0 +1,373 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OGLP_BLOCKLAYOUT_H
+#define OGLP_BLOCKLAYOUT_H
+
+#include "common.h"
+#include "mappedrange.h"
+#include "uniformblock.h"
+#include <cstddef>
+#include <cstring>
+#include <tuple>
+#include <utility>
+
+namespace oglp {
+
+/** Block packing.
+ * The memory layout rules of a uniform or shader storage block.
+ */
+enum class Packing
+{
+    /** The std140 layout of uniform blocks, which rounds the alignment
+     *  of arrays, matrix columns and structures up to 16 bytes. */
+    Std140,
+    /** The std430 layout of shader storage blocks. */
+    Std430
+};
+
+/** Block member type.
+ * Describes the shape of a type that can be a member of a block, i.e.
+ * its component size and the number of columns and rows. Specialized
+ * for the scalar types and the float, int and uint glm vectors and
+ * matrices.
+ */
+template<typename T>
+struct BlockType;
+
+/* scalars */
+template<> struct BlockType<GLfloat>
+{ static constexpr size_t component = 4, columns = 1, rows = 1; };
+template<> struct BlockType<GLint>
+{ static constexpr size_t component = 4, columns = 1, rows = 1; };
+template<> struct BlockType<GLuint>
+{ static constexpr size_t component = 4, columns = 1, rows = 1; };
+template<> struct BlockType<GLdouble>
+{ static constexpr size_t component = 8, columns = 1, rows = 1; };
+
+/* vectors */
+template<> struct BlockType<glm::vec2>
+{ static constexpr size_t component = 4, columns = 1, rows = 2; };
+template<> struct BlockType<glm::vec3>
+{ static constexpr size_t component = 4, columns = 1, rows = 3; };
+template<> struct BlockType<glm::vec4>
+{ static constexpr size_t component = 4, columns = 1, rows = 4; };
+template<> struct BlockType<glm::ivec2>
+{ static constexpr size_t component = 4, columns = 1, rows = 2; };
+template<> struct BlockType<glm::ivec3>
+{ static constexpr size_t component = 4, columns = 1, rows = 3; };
+template<> struct BlockType<glm::ivec4>
+{ static constexpr size_t component = 4, columns = 1, rows = 4; };
+template<> struct BlockType<glm::uvec2>
+{ static constexpr size_t component = 4, columns = 1, rows = 2; };
+template<> struct BlockType<glm::uvec3>
+{ static constexpr size_t component = 4, columns = 1, rows = 3; };
+template<> struct BlockType<glm::uvec4>
+{ static constexpr size_t component = 4, columns = 1, rows = 4; };
+
+/* column-major matrices with columns x rows */
+template<> struct BlockType<glm::mat2>
+{ static constexpr size_t component = 4, columns = 2, rows = 2; };
+template<> struct BlockType<glm::mat3>
+{ static constexpr size_t component = 4, columns = 3, rows = 3; };
+template<> struct BlockType<glm::mat4>
+{ static constexpr size_t component = 4, columns = 4, rows = 4; };
+template<> struct BlockType<glm::mat2x3>
+{ static constexpr size_t component = 4, columns = 2, rows = 3; };
+template<> struct BlockType<glm::mat2x4>
+{ static constexpr size_t component = 4, columns = 2, rows = 4; };
+template<> struct BlockType<glm::mat3x2>
+{ static constexpr size_t component = 4, columns = 3, rows = 2; };
+template<> struct BlockType<glm::mat3x4>
+{ static constexpr size_t component = 4, columns = 3, rows = 4; };
+template<> struct BlockType<glm::mat4x2>
+{ static constexpr size_t component = 4, columns = 4, rows = 2; };
+template<> struct BlockType<glm::mat4x3>
+{ static constexpr size_t component = 4, columns = 4, rows = 3; };
+
+/** Block member.
+ * Describes a member of a block for BlockLayout.
+ * \tparam T Specifies the C++ type of the member.
+ * \tparam N Specifies the number of array elements,
+ *           zero for a member that is not an array.
+ */
+template<typename T, size_t N = 0>
+struct BlockMember
+{
+    /** C++ type of the member. */
+    typedef T type;
+    /** Number of array elements, zero if the member is no array. */
+    static constexpr size_t count = N;
+};
+
+namespace internal {
+
+/* shape of a member as reported by uniform block reflection */
+struct BlockMemberInfo
+{
+    size_t offset;
+    size_t count;
+    size_t arraystride;
+    size_t matrixstride;
+};
+
+bool VerifyBlockLayout (const UniformBlock &block,
+                        const BlockMemberInfo *members, size_t n,
+                        size_t size);
+
+constexpr size_t BlockRoundUp (size_t x, size_t align)
+{
+    return (x + align - 1) / align * align;
+}
+
+/* layout of a single member according to the packing rules */
+template<Packing P, typename M>
+struct BlockMemberLayout
+{
+    typedef typename M::type type;
+    typedef BlockType<type> shape;
+    static_assert (sizeof (type) == shape::component * shape::columns
+                   * shape::rows, "Block member types must be tightly packed.");
+
+    static constexpr size_t vectoralign = shape::component
+        * (shape::rows == 1 ? 1 : shape::rows == 2 ? 2 : 4);
+    static constexpr size_t vectorsize = shape::component * shape::rows;
+    /* matrices are laid out like arrays of column vectors */
+    static constexpr size_t matrixstride = (shape::columns == 1) ? 0
+        : (P == Packing::Std140 ? BlockRoundUp (vectoralign, 16)
+           : vectoralign);
+    static constexpr size_t elementalign = (shape::columns == 1)
+        ? vectoralign : matrixstride;
+    static constexpr size_t elementsize = (shape::columns == 1)
+        ? vectorsize : shape::columns * matrixstride;
+    static constexpr size_t align = (M::count && P == Packing::Std140)
+        ? BlockRoundUp (elementalign, 16) : elementalign;
+    static constexpr size_t arraystride = M::count
+        ? BlockRoundUp (elementsize, align) : 0;
+    static constexpr size_t size = M::count
+        ? M::count * arraystride : elementsize;
+    static constexpr size_t elements = M::count ? M::count : 1;
+};
+
+template<Packing P, typename... Members>
+constexpr size_t BlockOffset (size_t index)
+{
+    /* the trailing entries keep the arrays non-empty */
+    const size_t aligns[] = { BlockMemberLayout<P, Members>::align..., 1 };
+    const size_t sizes[] = { BlockMemberLayout<P, Members>::size..., 0 };
+    size_t offset = 0;
+    for (size_t i = 0; i < index; i++)
+        offset = BlockRoundUp (offset, aligns[i]) + sizes[i];
+    return BlockRoundUp (offset, aligns[index]);
+}
+
+template<Packing P, typename... Members>
+constexpr size_t BlockAlignment (void)
+{
+    const size_t aligns[] = { BlockMemberLayout<P, Members>::align..., 1 };
+    size_t align = (P == Packing::Std140) ? 16 : 1;
+    for (size_t i = 0; i < sizeof... (Members); i++)
+        align = (aligns[i] > align) ? aligns[i] : align;
+    return align;
+}
+
+} /* namespace internal */
+
+/** Block layout.
+ * Describes the layout of a uniform or shader storage block at compile
+ * time from the list of its members in declaration order, e.g.
+ * BlockLayout<Packing::Std140, BlockMember<glm::mat4>,
+ * BlockMember<glm::vec3, 4>, BlockMember<float>> for
+ * layout (std140) uniform B { mat4 m; vec3 v[4]; float f; }.
+ * Members are written directly to their offsets in mapped buffer memory,
+ * so no packed copy of the block is needed. OGLP_CHECK_BLOCK_MEMBER and
+ * OGLP_CHECK_BLOCK_SIZE check that a C++ struct matches the layout at
+ * compile time, and Verify checks the layout against the reflection of
+ * a linked program.
+ * Nested structures are not supported.
+ */
+template<Packing P, typename... Members>
+class BlockLayout
+{
+public:
+    /** Type of a member.
+     * \tparam I Specifies the index of the member.
+     */
+    template<size_t I>
+    using MemberType = typename std::tuple_element<I,
+        std::tuple<Members...>>::type::type;
+
+    /** Number of members. */
+    static constexpr size_t count = sizeof... (Members);
+    /** Base alignment of the block. */
+    static constexpr size_t alignment
+        = internal::BlockAlignment<P, Members...> ();
+    /** Size of the block including trailing padding. */
+    static constexpr size_t size = internal::BlockRoundUp
+        (internal::BlockOffset<P, Members...> (count), alignment);
+
+    /**
+       * Return the offset of a member.
+       * \tparam I Specifies the index of the member.
+       * \return The offset of the member in the block in bytes.
+       */
+    template<size_t I>
+    static constexpr size_t Offset (void)
+    {
+        static_assert (I < count, "Block member index out of range.");
+        return internal::BlockOffset<P, Members...> (I);
+    }
+
+    /**
+       * Return the size of a member.
+       * \tparam I Specifies the index of the member.
+       * \return The size of the member in bytes, which includes the
+       *         padding of array elements and matrix columns.
+       */
+    template<size_t I>
+    static constexpr size_t Size (void)
+    {
+        return Layout<I>::size;
+    }
+
+    /**
+       * Return the array stride of a member.
+       * \tparam I Specifies the index of the member.
+       * \return The distance between array elements in bytes,
+       *         zero if the member is no array.
+       */
+    template<size_t I>
+    static constexpr size_t ArrayStride (void)
+    {
+        return Layout<I>::arraystride;
+    }
+
+    /**
+       * Return the matrix stride of a member.
+       * \tparam I Specifies the index of the member.
+       * \return The distance between matrix columns in bytes,
+       *         zero if the member is no matrix.
+       */
+    template<size_t I>
+    static constexpr size_t MatrixStride (void)
+    {
+        return Layout<I>::matrixstride;
+    }
+
+    /**
+       * Write a member.
+       * \tparam I Specifies the index of the member.
+       * \param block Specifies the mapped memory of the block.
+       * \param value Specifies the value to write.
+       * \param element Specifies the array element to write.
+       */
+    template<size_t I>
+    static void Write (void *block, const MemberType<I> &value,
+                       size_t element = 0)
+    {
+        typedef Layout<I> L;
+        char *dst = static_cast<char *> (block) + Offset<I> ()
+                    + element * L::arraystride;
+        const char *src = reinterpret_cast<const char *> (&value);
+        size_t column;
+        if (L::shape::columns == 1 || L::matrixstride == L::vectorsize) {
+            memcpy (dst, src, sizeof (value));
+        } else {
+            for (column = 0; column < L::shape::columns; column++)
+                memcpy (dst + column * L::matrixstride,
+                        src + column * L::vectorsize, L::vectorsize);
+        }
+    }
+
+    /**
+       * Write a member to a mapped range.
+       * Writes a member of a block at the start of the range and marks
+       * the written bytes as dirty, so that they are flushed.
+       * \tparam I Specifies the index of the member.
+       * \param range Specifies the mapping of the block.
+       * \param value Specifies the value to write.
+       * \param element Specifies the array element to write.
+       */
+    template<size_t I>
+    static void Write (MappedRange<GLubyte> &range,
+                       const MemberType<I> &value, size_t element = 0)
+    {
+        Write<I> (range.data (), value, element);
+        range.MarkDirty (Offset<I> () + element * Layout<I>::arraystride,
+                         Layout<I>::elementsize);
+    }
+
+    /**
+       * Verify the layout.
+       * Compares the layout with the reflection of a uniform block of a
+       * linked program, i.e. the offsets, array and matrix strides of
+       * the members and the size of the block. The uniform block has to
+       * declare exactly the described members.
+       * \param block Specifies the uniform block to compare with.
+       * \return Whether the layout matches the uniform block.
+       */
+    static bool Verify (const UniformBlock &block)
+    {
+        return Verify (block, std::make_index_sequence<count> ());
+    }
+
+private:
+    template<size_t I>
+    using Layout = internal::BlockMemberLayout<P,
+        typename std::tuple_element<I, std::tuple<Members...>>::type>;
+
+    template<size_t... I>
+    static bool Verify (const UniformBlock &block, std::index_sequence<I...>)
+    {
+        /* the trailing entry keeps the array non-empty */
+        const internal::BlockMemberInfo members[] = {
+            { Offset<I> (), Layout<I>::elements, Layout<I>::arraystride,
+              Layout<I>::matrixstride }...,
+            { 0, 0, 0, 0 }
+        };
+        return internal::VerifyBlockLayout (block, members, count, size);
+    }
+};
+
+} /* namespace oglp */
+
+/**
+ * Check a struct member against a block layout.
+ * Asserts at compile time that a member of a C++ struct has the offset
+ * and the size of a member of a BlockLayout, so that the struct can be
+ * copied to the block as a whole, e.g.
+ * OGLP_CHECK_BLOCK_MEMBER (Layout, Block, 1, v) for the second member v.
+ * The layout has to be a type name without commas, e.g. a typedef.
+ */
+#define OGLP_CHECK_BLOCK_MEMBER(layout, type, index, member) \
+    static_assert (offsetof (type, member) == layout::Offset<index> (), \
+                   "Offset of " #type "::" #member " does not match the block layout."); \
+    static_assert (sizeof (type::member) == layout::Size<index> (), \
+                   "Size of " #type "::" #member " does not match the block layout.")
+
+/**
+ * Check the size of a struct against a block layout.
+ * Asserts at compile time that a C++ struct has the size of a
+ * BlockLayout including its trailing padding.
+ */
+#define OGLP_CHECK_BLOCK_SIZE(layout, type) \
+    static_assert (sizeof (type) == layout::size, \
+                   "Size of " #type " does not match the block layout.")
+
+#endif /* !defined OGLP_BLOCKLAYOUT_H */
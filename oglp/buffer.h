@@ -21,6 +21,8 @@
 #define OGLP_BUFFER_H
 
 #include "common.h"
+#include <cstddef>
+#include <vector>
 
 namespace oglp {
 
@@ -40,16 +42,43 @@ public:
         CheckError ();
     }
 
+    /**
+       * Null constructor.
+       * Creates a Buffer object without an internal OpenGL buffer object.
+       * An object can be move assigned to it later.
+       */
+    Buffer (std::nullptr_t) : obj (0)
+    {
+    }
+
+    /**
+       * Create multiple Buffer objects.
+       * Creates the internal OpenGL buffer objects with a single call.
+       * \param n Specifies the number of objects to create.
+       * \return The created Buffer objects.
+       */
+    static std::vector<Buffer> CreateN (GLsizei n)
+    {
+        std::vector<GLuint> names (n);
+        std::vector<Buffer> objects;
+        CreateBuffers (n, names.data ());
+        CheckError ();
+        objects.reserve (n);
+        for (GLuint name : names) {
+            objects.emplace_back (nullptr);
+            objects.back ().obj = name;
+        }
+        return objects;
+    }
+
     /**
        * Move constuctor.
        * Passes the internal OpenGL buffer object to another Buffer object.
        * \param buffer The Buffer object to move.
        */
-    Buffer (Buffer &&buffer) noexcept
+    Buffer (Buffer &&buffer) noexcept : obj (buffer.obj)
     {
-        GLuint tmp = obj;
-        obj = buffer.obj;
-        buffer.obj = tmp;
+        buffer.obj = 0;
     }
 
     /**
@@ -64,7 +93,8 @@ public:
        */
     ~Buffer (void)
     {
-        DeleteBuffers (1, &obj);
+        if (obj)
+            DeleteBuffers (1, &obj);
     }
 
     /**
@@ -0,0 +1,218 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OGLP_BUFFERHEAP_H
+#define OGLP_BUFFERHEAP_H
+
+#include "common.h"
+#include "buffer.h"
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace oglp {
+
+/** Buffer suballocator.
+ * Manages a few large buffer objects with immutable storage, called
+ * arenas, and hands out ranges of them, so that many small meshes or
+ * uniform blocks do not need a buffer object each. Free ranges are
+ * kept in segregated lists indexed by two levels of bitmaps (TLSF), so
+ * allocating and freeing take constant time independent of the number
+ * of allocations. Neighbouring free ranges are merged immediately.
+ * A new arena is created whenever no free range is large enough.
+ */
+class BufferHeap
+{
+public:
+    /** Allocation.
+     * A range of an arena returned by Allocate.
+     */
+    struct Allocation
+    {
+        /** Arena containing the range. */
+        Buffer *buffer;
+        /** Offset of the range within the arena. */
+        GLintptr offset;
+        /** Requested size of the range. */
+        GLsizeiptr size;
+        /** Internal block index, which identifies the range in Free. */
+        unsigned int block;
+    };
+
+    /** Heap statistics. */
+    struct Stats
+    {
+        /** Number of arenas. */
+        unsigned int arenas;
+        /** Total size of all arenas. */
+        GLsizeiptr capacity;
+        /** Number of allocated ranges. */
+        unsigned int allocations;
+        /** Allocated bytes including granularity padding. */
+        GLsizeiptr used;
+        /** Number of free ranges. */
+        unsigned int freeranges;
+        /** Free bytes including alignment gaps. */
+        GLsizeiptr free;
+        /** Size of the largest free range. */
+        GLsizeiptr largestfree;
+        /** Fragmentation of the free memory, i.e. one minus the ratio
+         *  of the largest free range to all free bytes. */
+        double fragmentation;
+    };
+
+    /**
+       * Constructor.
+       * Creates an empty heap. The first arena is created on the first
+       * allocation.
+       * \param _arenasize Specifies the size of an arena. Allocations
+       *                   larger than this get an arena of their own.
+       * \param _flags Specifies the flags passed to Buffer::Storage
+       *               for the arenas.
+       * \param _alignment Specifies the default alignment of allocations.
+       *                   If zero, the larger of
+       *                   GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT and
+       *                   GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT is used,
+       *                   so that every allocation can be bound as either.
+       */
+    BufferHeap (GLsizeiptr _arenasize, GLbitfield _flags = 0,
+                GLsizeiptr _alignment = 0);
+
+    /**
+       * Deleted copy constructor.
+       * A BufferHeap object can't be copy constructed.
+       */
+    BufferHeap (const BufferHeap &) = delete;
+
+    /**
+       * Deleted copy assignment.
+       * A BufferHeap object can't be copy assigned.
+       * \return
+       */
+    BufferHeap &operator= (const BufferHeap &) = delete;
+
+    /**
+       * Allocate a range.
+       * \param size Specifies the size of the range in bytes.
+       * \param align Specifies the alignment of the offset of the range,
+       *              which has to be a power of two. If zero, the default
+       *              alignment of the heap is used.
+       * \return The allocated range.
+       */
+    Allocation Allocate (GLsizeiptr size, GLsizeiptr align = 0);
+
+    /**
+       * Free a range.
+       * The range must not be used by pending OpenGL commands anymore.
+       * \param allocation Specifies a range returned by Allocate.
+       */
+    void Free (const Allocation &allocation);
+
+    /**
+       * Get the heap statistics.
+       * Walks all ranges, so this is not meant to be called per allocation.
+       * \return The current statistics.
+       */
+    Stats GetStats (void) const;
+
+    /**
+       * Return the default alignment.
+       * \return The alignment used if Allocate is called without one.
+       */
+    GLsizeiptr GetAlignment (void) const
+    {
+        return alignment;
+    }
+
+private:
+    /* number of second level lists per first level */
+    static const unsigned int SLBits = 4;
+    static const unsigned int SLCount = 1 << SLBits;
+    /* ranges below 1 << FLShift share the first level list 0 */
+    static const unsigned int FLShift = SLBits + 4;
+    static const unsigned int FLCount = 64 - FLShift + 1;
+    static const unsigned int None = ~0u;
+
+    /* A free or allocated range. Physical neighbours within an arena are
+     * linked for merging, free ranges are linked in their size class. */
+    struct Block
+    {
+        GLintptr offset;
+        GLsizeiptr size;
+        unsigned int arena;
+        unsigned int prevphys;
+        unsigned int nextphys;
+        unsigned int prevfree;
+        unsigned int nextfree;
+        bool free;
+    };
+
+    static void Mapping (GLsizeiptr size, unsigned int &fl, unsigned int &sl);
+    unsigned int FindFree (GLsizeiptr size) const;
+    void InsertFree (unsigned int b);
+    void RemoveFree (unsigned int b);
+    unsigned int NewBlock (void);
+    void DeleteBlock (unsigned int b);
+    unsigned int AddArena (GLsizeiptr size);
+
+    /**
+       * size of a regular arena
+       */
+    GLsizeiptr arenasize;
+    /**
+       * storage flags of the arenas
+       */
+    GLbitfield flags;
+    /**
+       * default alignment
+       */
+    GLsizeiptr alignment;
+    /**
+       * arenas, in a deque so that allocations can point to them
+       */
+    std::deque<Buffer> arenas;
+    /**
+       * size of all arenas
+       */
+    GLsizeiptr capacity;
+    /**
+       * block records
+       */
+    std::vector<Block> blocks;
+    /**
+       * list of unused block records
+       */
+    unsigned int unused;
+    /**
+       * first level bitmap of non-empty free lists
+       */
+    uint64_t flbitmap;
+    /**
+       * second level bitmaps of non-empty free lists
+       */
+    uint32_t slbitmap[FLCount];
+    /**
+       * heads of the free lists
+       */
+    unsigned int heads[FLCount][SLCount];
+};
+
+} /* namespace oglp */
+
+#endif /* !defined OGLP_BUFFERHEAP_H */
@@ -0,0 +1,181 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OGLP_CAPABILITIES_H
+#define OGLP_CAPABILITIES_H
+
+#include "common.h"
+#include <bitset>
+#include <string>
+#include <vector>
+
+namespace oglp {
+
+/** OpenGL implementation capabilities.
+ * An immutable snapshot of the version, vendor, renderer and supported
+ * extensions of an OpenGL implementation. Extensions known to oglp are
+ * stored in a bitset, so checking for them is a constant time bit test.
+ * As the object is never modified after construction, it can be queried
+ * from any thread.
+ */
+class Capabilities
+{
+public:
+    /**
+       * Default constructor.
+       * Creates an empty Capabilities object that reports
+       * no supported extensions and version 0.0.
+       */
+    Capabilities (void) : major (0), minor (0)
+    {
+    }
+
+    /**
+       * Query the current context.
+       * Creates a Capabilities object describing the OpenGL
+       * implementation of the current context.
+       * \return The capabilities of the current context.
+       */
+    static Capabilities Query (void);
+
+    /**
+       * Check for an extension.
+       * Checks whether the specified extension is supported.
+       * \param ext Specifies the extension to check.
+       * \return Whether the extension is supported.
+       */
+    bool IsExtensionSupported (Extension ext) const
+    {
+        return extensions.test (static_cast<unsigned int> (ext));
+    }
+
+    /**
+       * Check for an extension.
+       * Checks whether the specified extension is supported. Names of
+       * extensions known to oglp are looked up in the generated name
+       * table, other names in the sorted list of remaining extensions.
+       * \param name Specifies the name of the extension to check.
+       * \return Whether the extension is supported.
+       */
+    bool IsExtensionSupported (const std::string &name) const;
+
+    /**
+       * Check the version.
+       * Checks whether the OpenGL version is at least the specified version.
+       * \param _major Specifies the required major version.
+       * \param _minor Specifies the required minor version.
+       * \return Whether the version is at least _major._minor.
+       */
+    bool IsVersionAtLeast (int _major, int _minor) const
+    {
+        return major > _major || (major == _major && minor >= _minor);
+    }
+
+    /**
+       * Get the major version.
+       * \return The major OpenGL version.
+       */
+    int GetMajorVersion (void) const
+    {
+        return major;
+    }
+
+    /**
+       * Get the minor version.
+       * \return The minor OpenGL version.
+       */
+    int GetMinorVersion (void) const
+    {
+        return minor;
+    }
+
+    /**
+       * Get the version string.
+       * \return The string returned for GL_VERSION.
+       */
+    const std::string &GetVersion (void) const
+    {
+        return version;
+    }
+
+    /**
+       * Get the vendor.
+       * \return The string returned for GL_VENDOR.
+       */
+    const std::string &GetVendor (void) const
+    {
+        return vendor;
+    }
+
+    /**
+       * Get the renderer.
+       * \return The string returned for GL_RENDERER.
+       */
+    const std::string &GetRenderer (void) const
+    {
+        return renderer;
+    }
+
+private:
+    /**
+       * supported extensions known to oglp, indexed by Extension
+       */
+    std::bitset<NumExtensions> extensions;
+    /**
+       * sorted names of supported extensions unknown to oglp
+       */
+    std::vector<std::string> others;
+    /**
+       * major OpenGL version
+       */
+    int major;
+    /**
+       * minor OpenGL version
+       */
+    int minor;
+    /**
+       * GL_VERSION string
+       */
+    std::string version;
+    /**
+       * GL_VENDOR string
+       */
+    std::string vendor;
+    /**
+       * GL_RENDERER string
+       */
+    std::string renderer;
+};
+
+/**
+ * Get the capabilities.
+ * Returns the capabilities of the OpenGL implementation
+ * queried during the last call of Init. With OGLP_DISPATCH_TABLE
+ * each dispatch table keeps the capabilities of its own Init, so
+ * threads driving a different context get the capabilities of
+ * their own context. Before Init an empty Capabilities object is
+ * returned. The reference remains valid until Init is called
+ * again with the same dispatch table.
+ * \return The capabilities determined by Init.
+ */
+const Capabilities &GetCapabilities (void);
+
+} /* namespace oglp */
+
+#endif /* !defined OGLP_CAPABILITIES_H */
@@ -34,7 +34,9 @@
 #include <sstream>
 
 #ifdef OGLP_THROW_EXCEPTIONS
+#include <atomic>
 #include <stdexcept>
+#include <exception>
 #include "exception.h"
 #endif
 
@@ -53,22 +55,168 @@ namespace oglp {
  */
 const char *ErrorToString (GLenum error);
 
+/** Error checking policy.
+ * Determines when OpenGL errors are checked for, if OGLP_THROW_EXCEPTIONS
+ * is defined. As glGetError may synchronize the pipeline, checking after
+ * every call can be very slow. The deferred policies check less often and
+ * report the range of wrapped calls that may have produced the error.
+ */
+enum class ErrorPolicy
+{
+    /** Check after every wrapped call. */
+    PerCall,
+    /** Check once when an ErrorScope ends. */
+    PerScope,
+    /** Check once per frame in CheckFrameErrors. */
+    PerFrame,
+    /** Never check. */
+    Off
+};
+
+#ifdef OGLP_THROW_EXCEPTIONS
+namespace internal {
+/* current error checking policy, may be changed while
+ * other threads issue calls */
+extern std::atomic<ErrorPolicy> errorpolicy;
+/* number of wrapped calls issued by the thread */
+extern thread_local unsigned long errorcalls;
+/* value of errorcalls at the last check */
+extern thread_local unsigned long errorchecked;
+} /* namespace internal */
+#endif
+
 /**
- * Check for an OpenGL error.
- * If OGLP_THROW_EXCEPTIONS is defined, this checks for an
- * OpenGL error and throws an Exception if one occurred,
+ * Set the error checking policy.
+ * The initial policy is ErrorPolicy::OGLP_ERROR_POLICY if
+ * OGLP_ERROR_POLICY is defined and ErrorPolicy::PerCall otherwise.
+ * The policy may be changed while other threads use oglp, which pick
+ * up the new policy with their next check.
+ * \param policy Specifies the new error checking policy.
+ */
+inline void SetErrorPolicy (ErrorPolicy policy)
+{
+#ifdef OGLP_THROW_EXCEPTIONS
+    internal::errorpolicy.store (policy, std::memory_order_relaxed);
+#else
+    (void) policy;
+#endif
+}
+
+/**
+ * Get the error checking policy.
+ * \return The current error checking policy. If OGLP_THROW_EXCEPTIONS
+ *         is not defined this is always ErrorPolicy::Off.
+ */
+inline ErrorPolicy GetErrorPolicy (void)
+{
+#ifdef OGLP_THROW_EXCEPTIONS
+    return internal::errorpolicy.load (std::memory_order_relaxed);
+#else
+    return ErrorPolicy::Off;
+#endif
+}
+
+/**
+ * Check for OpenGL errors now.
+ * If OGLP_THROW_EXCEPTIONS is defined, this checks for an OpenGL error
+ * regardless of the error checking policy and throws an Exception
+ * naming the range of wrapped calls issued since the last check,
  * otherwise it does nothing.
+ * \param where Optional description of the checked code,
+ *              included in the exception message.
+ */
+void CheckErrors (const char *where = NULL);
+
+/**
+ * Check for an OpenGL error.
+ * If OGLP_THROW_EXCEPTIONS is defined and the error checking policy
+ * is ErrorPolicy::PerCall, this checks for an OpenGL error and throws
+ * an Exception if one occurred, otherwise it only counts the call.
  */
 inline void CheckError (void)
 {
 #ifdef OGLP_THROW_EXCEPTIONS
-	GLenum err;
-	err = GetError ();
-	if (err != GL_NO_ERROR)
-		throw Exception (err);
+	internal::errorcalls++;
+	if (internal::errorpolicy.load (std::memory_order_relaxed)
+	    == ErrorPolicy::PerCall) {
+		GLenum err;
+		err = GetError ();
+		internal::errorchecked = internal::errorcalls;
+		if (err != GL_NO_ERROR)
+			throw Exception (err);
+	}
+#endif
+}
+
+/**
+ * Check for OpenGL errors at the end of a frame.
+ * Checks for OpenGL errors, unless the error checking policy
+ * is ErrorPolicy::Off. Call this once per frame when using
+ * ErrorPolicy::PerFrame.
+ */
+inline void CheckFrameErrors (void)
+{
+#ifdef OGLP_THROW_EXCEPTIONS
+    if (internal::errorpolicy.load (std::memory_order_relaxed)
+        != ErrorPolicy::Off)
+        CheckErrors ("frame");
 #endif
 }
 
+/**
+ * Scoped error check.
+ * If the error checking policy is ErrorPolicy::PerScope, OpenGL errors
+ * are checked for once when the ErrorScope object is destroyed.
+ * The exception names the scope and the range of wrapped calls
+ * that may have produced the error.
+ */
+class ErrorScope
+{
+public:
+    /**
+       * Constructor.
+       * Creates a new ErrorScope object.
+       * \param _name Name of the scope used in error messages. The string
+       *              has to remain valid during the lifetime of the scope.
+       */
+    ErrorScope (const char *_name = NULL) : name (_name)
+    {
+    }
+
+    /**
+       * Deleted copy constructor.
+       * An ErrorScope object can't be copy constructed.
+       */
+    ErrorScope (const ErrorScope &) = delete;
+
+    /**
+       * A destructor.
+       * Checks for OpenGL errors, if the error checking policy is
+       * ErrorPolicy::PerScope and no exception is currently in flight.
+       */
+    ~ErrorScope (void) noexcept (false)
+    {
+#ifdef OGLP_THROW_EXCEPTIONS
+        if (internal::errorpolicy.load (std::memory_order_relaxed)
+            == ErrorPolicy::PerScope
+            && !std::uncaught_exception ())
+            CheckErrors (name);
+#endif
+    }
+
+    /**
+       * Deleted copy assignment.
+       * An ErrorScope object can't be copy assigned.
+       */
+    ErrorScope &operator= (const ErrorScope &) = delete;
+
+private:
+    /**
+       * name of the scope
+       */
+    const char *name;
+};
+
 } /* namespace oglp */
 
 #endif /* !defined OGLP_COMMON_H */
@@ -22,6 +22,33 @@
 
 /*#define OGLP_THROW_EXCEPTIONS*/
 
+/* Initial error checking policy if OGLP_THROW_EXCEPTIONS is defined.
+ * One of PerCall, PerScope, PerFrame or Off, see ErrorPolicy. */
+/*#define OGLP_ERROR_POLICY PerCall*/
+
+/* Route all OpenGL entry points through a per-thread DispatchTable
+ * instead of process-wide function pointers. This allows driving
+ * contexts with different entry points from different threads.
+ * Has to match the setting the library was compiled with. */
+/*#define OGLP_DISPATCH_TABLE*/
+
+/* Build the binary call tracing layer, see StartTrace.
+ * Has to match the setting the library was compiled with. */
+/*#define OGLP_TRACE*/
+
+/* Count the calls and measure the time spent in every entry point,
+ * see GetCallStats. Has to match the setting the library was
+ * compiled with. */
+/*#define OGLP_INSTRUMENT*/
+
+/* Call the entry points of core OpenGL versions directly instead of
+ * through function pointers. Requires linking against the OpenGL
+ * library (e.g. libOpenGL from GLVND), extensions are still resolved
+ * by Init. Cannot be combined with OGLP_DISPATCH_TABLE, OGLP_TRACE
+ * or OGLP_INSTRUMENT. Has to match the setting the library was
+ * compiled with. */
+/*#define OGLP_DIRECT_LINK*/
+
 #if __cplusplus < 201103L
 #error "C++11 is required for OGLP"
 #endif
@@ -22,6 +22,7 @@
 
 #include "common.h"
 #include <exception>
+#include <string>
 
 namespace oglp {
 
@@ -42,20 +43,45 @@ public:
     {
     }
 
+    /**
+       * Constructor.
+       * \param err Specifies the OpenGL error code
+       * \param context Describes where the error was detected.
+       */
+    Exception (GLenum err, const std::string &context)
+        : error (err), message (std::string (ErrorToString (err)) + " " + context)
+    {
+    }
+
     /**
        * Format the reason for the exception.
        * \return A string describing the exception.
        */
     virtual const char *what (void) const noexcept
     {
+        if (!message.empty ())
+            return message.c_str ();
         return ErrorToString (error);
     }
 
+    /**
+       * Get the error code.
+       * \return The OpenGL error code.
+       */
+    GLenum GetError (void) const
+    {
+        return error;
+    }
+
 private:
     /**
        * stores the OpenGL error code
        */
     GLenum error;
+    /**
+       * error message including the context, if any
+       */
+    std::string message;
 };
 
 } /* namespace oglp */
@@ -0,0 +1,319 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OGLP_FENCE_H
+#define OGLP_FENCE_H
+
+#include "common.h"
+#include <cstdint>
+#include <deque>
+#include <utility>
+
+namespace oglp {
+
+/** OpenGL Fence object.
+ * A wrapper class around an OpenGL sync object created by glFenceSync.
+ * A Fence is empty until Insert is called, an empty Fence is always
+ * signaled. Once a Fence was found to be signaled, this is remembered,
+ * so that polling it again does not call into OpenGL.
+ */
+class Fence
+{
+public:
+    /**
+       * Default constructor.
+       * Creates an empty Fence object.
+       */
+    Fence (void) : obj (NULL), signaled (true)
+    {
+    }
+
+    /**
+       * Move constuctor.
+       * Passes the internal OpenGL sync object to another Fence object.
+       * \param fence The Fence object to move.
+       */
+    Fence (Fence &&fence) noexcept : obj (fence.obj), signaled (fence.signaled)
+    {
+        fence.obj = NULL;
+        fence.signaled = true;
+    }
+
+    /**
+       * Deleted copy constructor.
+       * A Fence object can't be copy constructed.
+       */
+    Fence (const Fence &) = delete;
+
+    /**
+       * A destructor.
+       * Deletes a Fence object.
+       */
+    ~Fence (void)
+    {
+        if (obj)
+            DeleteSync (obj);
+    }
+
+    /**
+       * Move assignment.
+       * Passes the internal OpenGL sync object to another Fence object.
+       * \param fence The Fence object to move.
+       * \return A reference to the Fence object.
+       */
+    Fence &operator= (Fence &&fence) noexcept
+    {
+        std::swap (obj, fence.obj);
+        std::swap (signaled, fence.signaled);
+        return *this;
+    }
+
+    /**
+       * Deleted copy assignment.
+       * A Fence object can't be copy assigned.
+       * \return
+       */
+    Fence &operator= (const Fence &) = delete;
+
+    /**
+       * Return internal object.
+       * Returns the internal OpenGL sync object. Use with caution.
+       * \return The internal OpenGL sync object or NULL if the Fence is empty.
+       */
+    GLsync get (void) const
+    {
+        return obj;
+    }
+
+    /**
+       * Label the sync object.
+       * Labels the internal OpenGL sync object.
+       * \param name Label to be used for the sync object.
+       */
+    void Label (const std::string &name)
+    {
+        ObjectPtrLabel (obj, name.length (), name.data ());
+        CheckError ();
+    }
+
+    /**
+       * Insert the fence.
+       * Creates a new sync object and inserts it into the command stream.
+       * The sync object is signaled once all preceding commands are
+       * completed. A previously inserted sync object is deleted.
+       */
+    void Insert (void)
+    {
+        Reset ();
+        obj = FenceSync (GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        CheckError ();
+        signaled = false;
+    }
+
+    /**
+       * Empty the fence.
+       * Deletes the internal OpenGL sync object.
+       */
+    void Reset (void)
+    {
+        if (obj) {
+            DeleteSync (obj);
+            CheckError ();
+            obj = NULL;
+        }
+        signaled = true;
+    }
+
+    /**
+       * Check whether the fence is empty.
+       * \return Whether no sync object was inserted.
+       */
+    bool IsEmpty (void) const
+    {
+        return obj == NULL;
+    }
+
+    /**
+       * Check whether the fence is signaled.
+       * Queries the status of the sync object without blocking and without
+       * flushing the command stream. To guarantee that a polled fence
+       * eventually becomes signaled, the commands have to be flushed,
+       * e.g. by ClientWait or glFlush.
+       * \return Whether all commands preceding the fence are completed.
+       */
+    bool IsSignaled (void) const
+    {
+        if (!signaled) {
+            GLint status = GL_UNSIGNALED;
+            GetSynciv (obj, GL_SYNC_STATUS, 1, NULL, &status);
+            CheckError ();
+            signaled = (status == GL_SIGNALED);
+        }
+        return signaled;
+    }
+
+    /**
+       * Wait for the fence on the client.
+       * Blocks until the fence is signaled or the timeout expires.
+       * \param timeout Specifies the timeout in nanoseconds. A timeout
+       *                of zero polls the fence without blocking.
+       * \param flush Specifies whether the command stream should be
+       *              flushed before waiting, which is necessary to
+       *              avoid waiting forever for unflushed commands.
+       * \return Whether the fence is signaled.
+       */
+    bool ClientWait (GLuint64 timeout, bool flush = true) const
+    {
+        if (!signaled) {
+            GLenum result;
+            result = ClientWaitSync (obj, flush ? GL_SYNC_FLUSH_COMMANDS_BIT : 0,
+                                     timeout);
+            CheckError ();
+            signaled = (result == GL_ALREADY_SIGNALED
+                        || result == GL_CONDITION_SATISFIED);
+        }
+        return signaled;
+    }
+
+    /**
+       * Wait for the fence on the server.
+       * Makes the OpenGL server wait for the fence before executing
+       * subsequent commands. Returns immediately on the client.
+       */
+    void Wait (void) const
+    {
+        if (!signaled) {
+            WaitSync (obj, 0, GL_TIMEOUT_IGNORED);
+            CheckError ();
+        }
+    }
+
+private:
+    /**
+       * internal OpenGL sync object
+       */
+    GLsync obj;
+    /**
+       * whether the sync object is known to be signaled
+       */
+    mutable bool signaled;
+};
+
+/** Fence timeline.
+ * Tags submissions with monotonically increasing IDs by inserting a
+ * Fence for each of them. As the commands of a context complete in
+ * order, all submissions up to the last signaled fence are completed,
+ * so the timeline only needs to poll the oldest pending fences.
+ */
+class FenceTimeline
+{
+public:
+    /**
+       * Default constructor.
+       * Creates a FenceTimeline object without submissions.
+       */
+    FenceTimeline (void) : next (1), completed (0)
+    {
+    }
+
+    /**
+       * Submit.
+       * Inserts a fence into the command stream.
+       * \return The ID of the submission, which is larger than the IDs
+       *         of all previous submissions. IDs start at 1.
+       */
+    uint64_t Submit (void)
+    {
+        pending.emplace_back (next, Fence ());
+        pending.back ().second.Insert ();
+        return next++;
+    }
+
+    /**
+       * Get the last submission.
+       * \return The ID of the last submission or 0 if there was none.
+       */
+    uint64_t GetSubmitted (void) const
+    {
+        return next - 1;
+    }
+
+    /**
+       * Get the last completed submission.
+       * Polls the pending fences without blocking.
+       * \return The ID of the last completed submission or 0 if
+       *         no submission was completed yet.
+       */
+    uint64_t GetCompleted (void)
+    {
+        while (!pending.empty () && pending.front ().second.IsSignaled ()) {
+            completed = pending.front ().first;
+            pending.pop_front ();
+        }
+        return completed;
+    }
+
+    /**
+       * Check whether a submission is completed.
+       * \param id Specifies the ID of the submission.
+       * \return Whether the submission is completed.
+       */
+    bool IsCompleted (uint64_t id)
+    {
+        return id <= completed || id <= GetCompleted ();
+    }
+
+    /**
+       * Wait for a submission.
+       * Blocks until the submission is completed or the timeout expires.
+       * \param id Specifies the ID of the submission.
+       * \param timeout Specifies the timeout in nanoseconds.
+       * \return Whether the submission is completed.
+       */
+    bool Wait (uint64_t id, GLuint64 timeout = GL_TIMEOUT_IGNORED)
+    {
+        if (IsCompleted (id))
+            return true;
+        while (!pending.empty () && pending.front ().first <= id) {
+            if (!pending.front ().second.ClientWait (timeout))
+                return false;
+            completed = pending.front ().first;
+            pending.pop_front ();
+        }
+        return id <= completed;
+    }
+
+private:
+    /**
+       * pending submissions in submission order
+       */
+    std::deque<std::pair<uint64_t, Fence>> pending;
+    /**
+       * ID of the next submission
+       */
+    uint64_t next;
+    /**
+       * ID of the last submission known to be completed
+       */
+    uint64_t completed;
+};
+
+} /* namespace oglp */
+
+#endif /* !defined OGLP_FENCE_H */
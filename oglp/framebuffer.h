@@ -21,6 +21,7 @@
 #define OGLP_FRAMEBUFFER_H
 
 #include "common.h"
+#include <cstddef>
 #include "texture.h"
 #include "renderbuffer.h"
 #include <vector>
@@ -42,17 +43,44 @@ public:
         CheckError ();
     }
 
+    /**
+       * Null constructor.
+       * Creates a Framebuffer object without an internal OpenGL framebuffer object.
+       * An object can be move assigned to it later.
+       */
+    Framebuffer (std::nullptr_t) : obj (0)
+    {
+    }
+
+    /**
+       * Create multiple Framebuffer objects.
+       * Creates the internal OpenGL framebuffer objects with a single call.
+       * \param n Specifies the number of objects to create.
+       * \return The created Framebuffer objects.
+       */
+    static std::vector<Framebuffer> CreateN (GLsizei n)
+    {
+        std::vector<GLuint> names (n);
+        std::vector<Framebuffer> objects;
+        CreateFramebuffers (n, names.data ());
+        CheckError ();
+        objects.reserve (n);
+        for (GLuint name : names) {
+            objects.emplace_back (nullptr);
+            objects.back ().obj = name;
+        }
+        return objects;
+    }
+
     /**
        * Move constuctor.
        * Passes the internal OpenGL Framebuffer object to
        * another framebuffer object.
        * \param framebuffer The Framebuffer object to move.
        */
-    Framebuffer (Framebuffer &&framebuffer) noexcept
+    Framebuffer (Framebuffer &&framebuffer) noexcept : obj (framebuffer.obj)
     {
-        GLuint tmp = obj;
-        obj = framebuffer.obj;
-        framebuffer.obj = tmp;
+        framebuffer.obj = 0;
     }
 
     /**
@@ -67,7 +95,8 @@ public:
        */
     ~Framebuffer (void)
     {
-        DeleteFramebuffers (1, &obj);
+        if (obj)
+            DeleteFramebuffers (1, &obj);
     }
 
     /**
@@ -11,16 +11,6503 @@
 #ifndef OGLP_GLCOREW_H
 #define OGLP_GLCOREW_H
 
+#include "config.h"
+
+#ifdef OGLP_DIRECT_LINK
+#if defined OGLP_DISPATCH_TABLE || defined OGLP_TRACE || defined OGLP_INSTRUMENT
+#error "OGLP_DIRECT_LINK cannot be combined with OGLP_DISPATCH_TABLE, OGLP_TRACE or OGLP_INSTRUMENT."
+#endif
+#ifndef GL_GLEXT_PROTOTYPES
+#define GL_GLEXT_PROTOTYPES
+#endif
+#endif
+
 #include "glcorearb.h"
 #include "glcoreext.h"
+#ifdef OGLP_DISPATCH_TABLE
+#include <memory>
+#endif
 
 namespace oglp {
 
 typedef void *(*GetProcAddressCallback) (const char*);
 
 void InitPrototypes (GetProcAddressCallback getprocaddress);
+void InitPrototypesLazy (GetProcAddressCallback getprocaddress);
 GLAPI int APIENTRY Unsupported (...);
 
+/* Extensions known to oglp, sorted by name. */
+enum class Extension : unsigned int
+{
+    ARB_ES2_compatibility,
+    ARB_ES3_1_compatibility,
+    ARB_ES3_compatibility,
+    ARB_arrays_of_arrays,
+    ARB_base_instance,
+    ARB_bindless_texture,
+    ARB_blend_func_extended,
+    ARB_buffer_storage,
+    ARB_cl_event,
+    ARB_clear_buffer_object,
+    ARB_clear_texture,
+    ARB_clip_control,
+    ARB_compressed_texture_pixel_storage,
+    ARB_compute_shader,
+    ARB_compute_variable_group_size,
+    ARB_conditional_render_inverted,
+    ARB_conservative_depth,
+    ARB_copy_buffer,
+    ARB_copy_image,
+    ARB_cull_distance,
+    ARB_debug_output,
+    ARB_depth_buffer_float,
+    ARB_depth_clamp,
+    ARB_derivative_control,
+    ARB_direct_state_access,
+    ARB_draw_buffers_blend,
+    ARB_draw_elements_base_vertex,
+    ARB_draw_indirect,
+    ARB_enhanced_layouts,
+    ARB_explicit_attrib_location,
+    ARB_explicit_uniform_location,
+    ARB_fragment_coord_conventions,
+    ARB_fragment_layer_viewport,
+    ARB_framebuffer_no_attachments,
+    ARB_framebuffer_object,
+    ARB_framebuffer_sRGB,
+    ARB_get_program_binary,
+    ARB_get_texture_sub_image,
+    ARB_gpu_shader5,
+    ARB_gpu_shader_fp64,
+    ARB_half_float_vertex,
+    ARB_imaging,
+    ARB_indirect_parameters,
+    ARB_internalformat_query,
+    ARB_internalformat_query2,
+    ARB_invalidate_subdata,
+    ARB_map_buffer_alignment,
+    ARB_map_buffer_range,
+    ARB_multi_bind,
+    ARB_multi_draw_indirect,
+    ARB_occlusion_query2,
+    ARB_pipeline_statistics_query,
+    ARB_program_interface_query,
+    ARB_provoking_vertex,
+    ARB_query_buffer_object,
+    ARB_robust_buffer_access_behavior,
+    ARB_robustness,
+    ARB_robustness_isolation,
+    ARB_sample_shading,
+    ARB_sampler_objects,
+    ARB_seamless_cube_map,
+    ARB_seamless_cubemap_per_texture,
+    ARB_separate_shader_objects,
+    ARB_shader_atomic_counters,
+    ARB_shader_bit_encoding,
+    ARB_shader_draw_parameters,
+    ARB_shader_group_vote,
+    ARB_shader_image_load_store,
+    ARB_shader_image_size,
+    ARB_shader_precision,
+    ARB_shader_stencil_export,
+    ARB_shader_storage_buffer_object,
+    ARB_shader_subroutine,
+    ARB_shader_texture_image_samples,
+    ARB_shading_language_420pack,
+    ARB_shading_language_include,
+    ARB_shading_language_packing,
+    ARB_sparse_buffer,
+    ARB_sparse_texture,
+    ARB_stencil_texturing,
+    ARB_sync,
+    ARB_tessellation_shader,
+    ARB_texture_barrier,
+    ARB_texture_buffer_object_rgb32,
+    ARB_texture_buffer_range,
+    ARB_texture_compression_bptc,
+    ARB_texture_compression_rgtc,
+    ARB_texture_cube_map_array,
+    ARB_texture_gather,
+    ARB_texture_mirror_clamp_to_edge,
+    ARB_texture_multisample,
+    ARB_texture_query_levels,
+    ARB_texture_query_lod,
+    ARB_texture_rg,
+    ARB_texture_rgb10_a2ui,
+    ARB_texture_stencil8,
+    ARB_texture_storage,
+    ARB_texture_storage_multisample,
+    ARB_texture_swizzle,
+    ARB_texture_view,
+    ARB_timer_query,
+    ARB_transform_feedback2,
+    ARB_transform_feedback3,
+    ARB_transform_feedback_instanced,
+    ARB_transform_feedback_overflow_query,
+    ARB_uniform_buffer_object,
+    ARB_vertex_array_bgra,
+    ARB_vertex_array_object,
+    ARB_vertex_attrib_64bit,
+    ARB_vertex_attrib_binding,
+    ARB_vertex_type_10f_11f_11f_rev,
+    ARB_vertex_type_2_10_10_10_rev,
+    ARB_viewport_array,
+    EXT_abgr,
+    KHR_context_flush_control,
+    KHR_debug,
+    KHR_no_error,
+    KHR_robust_buffer_access_behavior,
+    KHR_robustness,
+    KHR_texture_compression_astc_hdr,
+    KHR_texture_compression_astc_ldr,
+    KHR_texture_compression_astc_sliced_3d,
+    NVX_gpu_memory_info,
+    NV_explicit_multisample,
+    NV_shader_buffer_load,
+    NV_vertex_buffer_unified_memory,
+};
+
+/* Number of extensions known to oglp. */
+const unsigned int NumExtensions = 126;
+
+/* Names of the extensions known to oglp, indexed by Extension. */
+extern const char *const ExtensionNames[NumExtensions];
+
+/* Number of OpenGL entry points in a DispatchTable. */
+const unsigned int NumProcs = 730;
+
+#ifdef OGLP_DISPATCH_TABLE
+class Capabilities;
+#endif
+
+/* Table of all OpenGL entry points.
+ * A newly constructed table points every entry to Unsupported. */
+struct DispatchTable
+{
+    DispatchTable (void);
+
+    /* Callback the table was initialized with. */
+    GetProcAddressCallback getprocaddress;
+
+#ifdef OGLP_DISPATCH_TABLE
+    /* Capabilities determined by the last Init with this table,
+     * null before Init. */
+    std::shared_ptr<const Capabilities> capabilities;
+#endif
+
+#if defined OGLP_DISPATCH_TABLE && defined OGLP_TRACE
+    /* Entry points the trace thunks installed in this table
+     * forward to, null unless the thunks are installed. */
+    std::unique_ptr<DispatchTable> tracenext;
+#endif
+#if defined OGLP_DISPATCH_TABLE && defined OGLP_INSTRUMENT
+    /* Entry points the instrumentation thunks installed
+     * in this table forward to. */
+    std::unique_ptr<DispatchTable> instrumentnext;
+#endif
+
+    PFNGLCULLFACEPROC CullFace;
+    PFNGLFRONTFACEPROC FrontFace;
+    PFNGLHINTPROC Hint;
+    PFNGLLINEWIDTHPROC LineWidth;
+    PFNGLPOINTSIZEPROC PointSize;
+    PFNGLPOLYGONMODEPROC PolygonMode;
+    PFNGLSCISSORPROC Scissor;
+    PFNGLTEXPARAMETERFPROC TexParameterf;
+    PFNGLTEXPARAMETERFVPROC TexParameterfv;
+    PFNGLTEXPARAMETERIPROC TexParameteri;
+    PFNGLTEXPARAMETERIVPROC TexParameteriv;
+    PFNGLTEXIMAGE1DPROC TexImage1D;
+    PFNGLTEXIMAGE2DPROC TexImage2D;
+    PFNGLDRAWBUFFERPROC DrawBuffer;
+    PFNGLCLEARPROC Clear;
+    PFNGLCLEARCOLORPROC ClearColor;
+    PFNGLCLEARSTENCILPROC ClearStencil;
+    PFNGLCLEARDEPTHPROC ClearDepth;
+    PFNGLSTENCILMASKPROC StencilMask;
+    PFNGLCOLORMASKPROC ColorMask;
+    PFNGLDEPTHMASKPROC DepthMask;
+    PFNGLDISABLEPROC Disable;
+    PFNGLENABLEPROC Enable;
+    PFNGLFINISHPROC Finish;
+    PFNGLFLUSHPROC Flush;
+    PFNGLBLENDFUNCPROC BlendFunc;
+    PFNGLLOGICOPPROC LogicOp;
+    PFNGLSTENCILFUNCPROC StencilFunc;
+    PFNGLSTENCILOPPROC StencilOp;
+    PFNGLDEPTHFUNCPROC DepthFunc;
+    PFNGLPIXELSTOREFPROC PixelStoref;
+    PFNGLPIXELSTOREIPROC PixelStorei;
+    PFNGLREADBUFFERPROC ReadBuffer;
+    PFNGLREADPIXELSPROC ReadPixels;
+    PFNGLGETBOOLEANVPROC GetBooleanv;
+    PFNGLGETDOUBLEVPROC GetDoublev;
+    PFNGLGETERRORPROC GetError;
+    PFNGLGETFLOATVPROC GetFloatv;
+    PFNGLGETINTEGERVPROC GetIntegerv;
+    PFNGLGETSTRINGPROC GetString;
+    PFNGLGETTEXIMAGEPROC GetTexImage;
+    PFNGLGETTEXPARAMETERFVPROC GetTexParameterfv;
+    PFNGLGETTEXPARAMETERIVPROC GetTexParameteriv;
+    PFNGLGETTEXLEVELPARAMETERFVPROC GetTexLevelParameterfv;
+    PFNGLGETTEXLEVELPARAMETERIVPROC GetTexLevelParameteriv;
+    PFNGLISENABLEDPROC IsEnabled;
+    PFNGLDEPTHRANGEPROC DepthRange;
+    PFNGLVIEWPORTPROC Viewport;
+    PFNGLDRAWARRAYSPROC DrawArrays;
+    PFNGLDRAWELEMENTSPROC DrawElements;
+    PFNGLGETPOINTERVPROC GetPointerv;
+    PFNGLPOLYGONOFFSETPROC PolygonOffset;
+    PFNGLCOPYTEXIMAGE1DPROC CopyTexImage1D;
+    PFNGLCOPYTEXIMAGE2DPROC CopyTexImage2D;
+    PFNGLCOPYTEXSUBIMAGE1DPROC CopyTexSubImage1D;
+    PFNGLCOPYTEXSUBIMAGE2DPROC CopyTexSubImage2D;
+    PFNGLTEXSUBIMAGE1DPROC TexSubImage1D;
+    PFNGLTEXSUBIMAGE2DPROC TexSubImage2D;
+    PFNGLBINDTEXTUREPROC BindTexture;
+    PFNGLDELETETEXTURESPROC DeleteTextures;
+    PFNGLGENTEXTURESPROC GenTextures;
+    PFNGLISTEXTUREPROC IsTexture;
+    PFNGLDRAWRANGEELEMENTSPROC DrawRangeElements;
+    PFNGLTEXIMAGE3DPROC TexImage3D;
+    PFNGLTEXSUBIMAGE3DPROC TexSubImage3D;
+    PFNGLCOPYTEXSUBIMAGE3DPROC CopyTexSubImage3D;
+    PFNGLACTIVETEXTUREPROC ActiveTexture;
+    PFNGLSAMPLECOVERAGEPROC SampleCoverage;
+    PFNGLCOMPRESSEDTEXIMAGE3DPROC CompressedTexImage3D;
+    PFNGLCOMPRESSEDTEXIMAGE2DPROC CompressedTexImage2D;
+    PFNGLCOMPRESSEDTEXIMAGE1DPROC CompressedTexImage1D;
+    PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC CompressedTexSubImage3D;
+    PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC CompressedTexSubImage2D;
+    PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC CompressedTexSubImage1D;
+    PFNGLGETCOMPRESSEDTEXIMAGEPROC GetCompressedTexImage;
+    PFNGLBLENDFUNCSEPARATEPROC BlendFuncSeparate;
+    PFNGLMULTIDRAWARRAYSPROC MultiDrawArrays;
+    PFNGLMULTIDRAWELEMENTSPROC MultiDrawElements;
+    PFNGLPOINTPARAMETERFPROC PointParameterf;
+    PFNGLPOINTPARAMETERFVPROC PointParameterfv;
+    PFNGLPOINTPARAMETERIPROC PointParameteri;
+    PFNGLPOINTPARAMETERIVPROC PointParameteriv;
+    PFNGLBLENDCOLORPROC BlendColor;
+    PFNGLBLENDEQUATIONPROC BlendEquation;
+    PFNGLGENQUERIESPROC GenQueries;
+    PFNGLDELETEQUERIESPROC DeleteQueries;
+    PFNGLISQUERYPROC IsQuery;
+    PFNGLBEGINQUERYPROC BeginQuery;
+    PFNGLENDQUERYPROC EndQuery;
+    PFNGLGETQUERYIVPROC GetQueryiv;
+    PFNGLGETQUERYOBJECTIVPROC GetQueryObjectiv;
+    PFNGLGETQUERYOBJECTUIVPROC GetQueryObjectuiv;
+    PFNGLBINDBUFFERPROC BindBuffer;
+    PFNGLDELETEBUFFERSPROC DeleteBuffers;
+    PFNGLGENBUFFERSPROC GenBuffers;
+    PFNGLISBUFFERPROC IsBuffer;
+    PFNGLBUFFERDATAPROC BufferData;
+    PFNGLBUFFERSUBDATAPROC BufferSubData;
+    PFNGLGETBUFFERSUBDATAPROC GetBufferSubData;
+    PFNGLMAPBUFFERPROC MapBuffer;
+    PFNGLUNMAPBUFFERPROC UnmapBuffer;
+    PFNGLGETBUFFERPARAMETERIVPROC GetBufferParameteriv;
+    PFNGLGETBUFFERPOINTERVPROC GetBufferPointerv;
+    PFNGLBLENDEQUATIONSEPARATEPROC BlendEquationSeparate;
+    PFNGLDRAWBUFFERSPROC DrawBuffers;
+    PFNGLSTENCILOPSEPARATEPROC StencilOpSeparate;
+    PFNGLSTENCILFUNCSEPARATEPROC StencilFuncSeparate;
+    PFNGLSTENCILMASKSEPARATEPROC StencilMaskSeparate;
+    PFNGLATTACHSHADERPROC AttachShader;
+    PFNGLBINDATTRIBLOCATIONPROC BindAttribLocation;
+    PFNGLCOMPILESHADERPROC CompileShader;
+    PFNGLCREATEPROGRAMPROC CreateProgram;
+    PFNGLCREATESHADERPROC CreateShader;
+    PFNGLDELETEPROGRAMPROC DeleteProgram;
+    PFNGLDELETESHADERPROC DeleteShader;
+    PFNGLDETACHSHADERPROC DetachShader;
+    PFNGLDISABLEVERTEXATTRIBARRAYPROC DisableVertexAttribArray;
+    PFNGLENABLEVERTEXATTRIBARRAYPROC EnableVertexAttribArray;
+    PFNGLGETACTIVEATTRIBPROC GetActiveAttrib;
+    PFNGLGETACTIVEUNIFORMPROC GetActiveUniform;
+    PFNGLGETATTACHEDSHADERSPROC GetAttachedShaders;
+    PFNGLGETATTRIBLOCATIONPROC GetAttribLocation;
+    PFNGLGETPROGRAMIVPROC GetProgramiv;
+    PFNGLGETPROGRAMINFOLOGPROC GetProgramInfoLog;
+    PFNGLGETSHADERIVPROC GetShaderiv;
+    PFNGLGETSHADERINFOLOGPROC GetShaderInfoLog;
+    PFNGLGETSHADERSOURCEPROC GetShaderSource;
+    PFNGLGETUNIFORMLOCATIONPROC GetUniformLocation;
+    PFNGLGETUNIFORMFVPROC GetUniformfv;
+    PFNGLGETUNIFORMIVPROC GetUniformiv;
+    PFNGLGETVERTEXATTRIBDVPROC GetVertexAttribdv;
+    PFNGLGETVERTEXATTRIBFVPROC GetVertexAttribfv;
+    PFNGLGETVERTEXATTRIBIVPROC GetVertexAttribiv;
+    PFNGLGETVERTEXATTRIBPOINTERVPROC GetVertexAttribPointerv;
+    PFNGLISPROGRAMPROC IsProgram;
+    PFNGLISSHADERPROC IsShader;
+    PFNGLLINKPROGRAMPROC LinkProgram;
+    PFNGLSHADERSOURCEPROC ShaderSource;
+    PFNGLUSEPROGRAMPROC UseProgram;
+    PFNGLUNIFORM1FPROC Uniform1f;
+    PFNGLUNIFORM2FPROC Uniform2f;
+    PFNGLUNIFORM3FPROC Uniform3f;
+    PFNGLUNIFORM4FPROC Uniform4f;
+    PFNGLUNIFORM1IPROC Uniform1i;
+    PFNGLUNIFORM2IPROC Uniform2i;
+    PFNGLUNIFORM3IPROC Uniform3i;
+    PFNGLUNIFORM4IPROC Uniform4i;
+    PFNGLUNIFORM1FVPROC Uniform1fv;
+    PFNGLUNIFORM2FVPROC Uniform2fv;
+    PFNGLUNIFORM3FVPROC Uniform3fv;
+    PFNGLUNIFORM4FVPROC Uniform4fv;
+    PFNGLUNIFORM1IVPROC Uniform1iv;
+    PFNGLUNIFORM2IVPROC Uniform2iv;
+    PFNGLUNIFORM3IVPROC Uniform3iv;
+    PFNGLUNIFORM4IVPROC Uniform4iv;
+    PFNGLUNIFORMMATRIX2FVPROC UniformMatrix2fv;
+    PFNGLUNIFORMMATRIX3FVPROC UniformMatrix3fv;
+    PFNGLUNIFORMMATRIX4FVPROC UniformMatrix4fv;
+    PFNGLVALIDATEPROGRAMPROC ValidateProgram;
+    PFNGLVERTEXATTRIB1DPROC VertexAttrib1d;
+    PFNGLVERTEXATTRIB1DVPROC VertexAttrib1dv;
+    PFNGLVERTEXATTRIB1FPROC VertexAttrib1f;
+    PFNGLVERTEXATTRIB1FVPROC VertexAttrib1fv;
+    PFNGLVERTEXATTRIB1SPROC VertexAttrib1s;
+    PFNGLVERTEXATTRIB1SVPROC VertexAttrib1sv;
+    PFNGLVERTEXATTRIB2DPROC VertexAttrib2d;
+    PFNGLVERTEXATTRIB2DVPROC VertexAttrib2dv;
+    PFNGLVERTEXATTRIB2FPROC VertexAttrib2f;
+    PFNGLVERTEXATTRIB2FVPROC VertexAttrib2fv;
+    PFNGLVERTEXATTRIB2SPROC VertexAttrib2s;
+    PFNGLVERTEXATTRIB2SVPROC VertexAttrib2sv;
+    PFNGLVERTEXATTRIB3DPROC VertexAttrib3d;
+    PFNGLVERTEXATTRIB3DVPROC VertexAttrib3dv;
+    PFNGLVERTEXATTRIB3FPROC VertexAttrib3f;
+    PFNGLVERTEXATTRIB3FVPROC VertexAttrib3fv;
+    PFNGLVERTEXATTRIB3SPROC VertexAttrib3s;
+    PFNGLVERTEXATTRIB3SVPROC VertexAttrib3sv;
+    PFNGLVERTEXATTRIB4NBVPROC VertexAttrib4Nbv;
+    PFNGLVERTEXATTRIB4NIVPROC VertexAttrib4Niv;
+    PFNGLVERTEXATTRIB4NSVPROC VertexAttrib4Nsv;
+    PFNGLVERTEXATTRIB4NUBPROC VertexAttrib4Nub;
+    PFNGLVERTEXATTRIB4NUBVPROC VertexAttrib4Nubv;
+    PFNGLVERTEXATTRIB4NUIVPROC VertexAttrib4Nuiv;
+    PFNGLVERTEXATTRIB4NUSVPROC VertexAttrib4Nusv;
+    PFNGLVERTEXATTRIB4BVPROC VertexAttrib4bv;
+    PFNGLVERTEXATTRIB4DPROC VertexAttrib4d;
+    PFNGLVERTEXATTRIB4DVPROC VertexAttrib4dv;
+    PFNGLVERTEXATTRIB4FPROC VertexAttrib4f;
+    PFNGLVERTEXATTRIB4FVPROC VertexAttrib4fv;
+    PFNGLVERTEXATTRIB4IVPROC VertexAttrib4iv;
+    PFNGLVERTEXATTRIB4SPROC VertexAttrib4s;
+    PFNGLVERTEXATTRIB4SVPROC VertexAttrib4sv;
+    PFNGLVERTEXATTRIB4UBVPROC VertexAttrib4ubv;
+    PFNGLVERTEXATTRIB4UIVPROC VertexAttrib4uiv;
+    PFNGLVERTEXATTRIB4USVPROC VertexAttrib4usv;
+    PFNGLVERTEXATTRIBPOINTERPROC VertexAttribPointer;
+    PFNGLUNIFORMMATRIX2X3FVPROC UniformMatrix2x3fv;
+    PFNGLUNIFORMMATRIX3X2FVPROC UniformMatrix3x2fv;
+    PFNGLUNIFORMMATRIX2X4FVPROC UniformMatrix2x4fv;
+    PFNGLUNIFORMMATRIX4X2FVPROC UniformMatrix4x2fv;
+    PFNGLUNIFORMMATRIX3X4FVPROC UniformMatrix3x4fv;
+    PFNGLUNIFORMMATRIX4X3FVPROC UniformMatrix4x3fv;
+    PFNGLCOLORMASKIPROC ColorMaski;
+    PFNGLGETBOOLEANI_VPROC GetBooleani_v;
+    PFNGLGETINTEGERI_VPROC GetIntegeri_v;
+    PFNGLENABLEIPROC Enablei;
+    PFNGLDISABLEIPROC Disablei;
+    PFNGLISENABLEDIPROC IsEnabledi;
+    PFNGLBEGINTRANSFORMFEEDBACKPROC BeginTransformFeedback;
+    PFNGLENDTRANSFORMFEEDBACKPROC EndTransformFeedback;
+    PFNGLBINDBUFFERRANGEPROC BindBufferRange;
+    PFNGLBINDBUFFERBASEPROC BindBufferBase;
+    PFNGLTRANSFORMFEEDBACKVARYINGSPROC TransformFeedbackVaryings;
+    PFNGLGETTRANSFORMFEEDBACKVARYINGPROC GetTransformFeedbackVarying;
+    PFNGLCLAMPCOLORPROC ClampColor;
+    PFNGLBEGINCONDITIONALRENDERPROC BeginConditionalRender;
+    PFNGLENDCONDITIONALRENDERPROC EndConditionalRender;
+    PFNGLVERTEXATTRIBIPOINTERPROC VertexAttribIPointer;
+    PFNGLGETVERTEXATTRIBIIVPROC GetVertexAttribIiv;
+    PFNGLGETVERTEXATTRIBIUIVPROC GetVertexAttribIuiv;
+    PFNGLVERTEXATTRIBI1IPROC VertexAttribI1i;
+    PFNGLVERTEXATTRIBI2IPROC VertexAttribI2i;
+    PFNGLVERTEXATTRIBI3IPROC VertexAttribI3i;
+    PFNGLVERTEXATTRIBI4IPROC VertexAttribI4i;
+    PFNGLVERTEXATTRIBI1UIPROC VertexAttribI1ui;
+    PFNGLVERTEXATTRIBI2UIPROC VertexAttribI2ui;
+    PFNGLVERTEXATTRIBI3UIPROC VertexAttribI3ui;
+    PFNGLVERTEXATTRIBI4UIPROC VertexAttribI4ui;
+    PFNGLVERTEXATTRIBI1IVPROC VertexAttribI1iv;
+    PFNGLVERTEXATTRIBI2IVPROC VertexAttribI2iv;
+    PFNGLVERTEXATTRIBI3IVPROC VertexAttribI3iv;
+    PFNGLVERTEXATTRIBI4IVPROC VertexAttribI4iv;
+    PFNGLVERTEXATTRIBI1UIVPROC VertexAttribI1uiv;
+    PFNGLVERTEXATTRIBI2UIVPROC VertexAttribI2uiv;
+    PFNGLVERTEXATTRIBI3UIVPROC VertexAttribI3uiv;
+    PFNGLVERTEXATTRIBI4UIVPROC VertexAttribI4uiv;
+    PFNGLVERTEXATTRIBI4BVPROC VertexAttribI4bv;
+    PFNGLVERTEXATTRIBI4SVPROC VertexAttribI4sv;
+    PFNGLVERTEXATTRIBI4UBVPROC VertexAttribI4ubv;
+    PFNGLVERTEXATTRIBI4USVPROC VertexAttribI4usv;
+    PFNGLGETUNIFORMUIVPROC GetUniformuiv;
+    PFNGLBINDFRAGDATALOCATIONPROC BindFragDataLocation;
+    PFNGLGETFRAGDATALOCATIONPROC GetFragDataLocation;
+    PFNGLUNIFORM1UIPROC Uniform1ui;
+    PFNGLUNIFORM2UIPROC Uniform2ui;
+    PFNGLUNIFORM3UIPROC Uniform3ui;
+    PFNGLUNIFORM4UIPROC Uniform4ui;
+    PFNGLUNIFORM1UIVPROC Uniform1uiv;
+    PFNGLUNIFORM2UIVPROC Uniform2uiv;
+    PFNGLUNIFORM3UIVPROC Uniform3uiv;
+    PFNGLUNIFORM4UIVPROC Uniform4uiv;
+    PFNGLTEXPARAMETERIIVPROC TexParameterIiv;
+    PFNGLTEXPARAMETERIUIVPROC TexParameterIuiv;
+    PFNGLGETTEXPARAMETERIIVPROC GetTexParameterIiv;
+    PFNGLGETTEXPARAMETERIUIVPROC GetTexParameterIuiv;
+    PFNGLCLEARBUFFERIVPROC ClearBufferiv;
+    PFNGLCLEARBUFFERUIVPROC ClearBufferuiv;
+    PFNGLCLEARBUFFERFVPROC ClearBufferfv;
+    PFNGLCLEARBUFFERFIPROC ClearBufferfi;
+    PFNGLGETSTRINGIPROC GetStringi;
+    PFNGLISRENDERBUFFERPROC IsRenderbuffer;
+    PFNGLBINDRENDERBUFFERPROC BindRenderbuffer;
+    PFNGLDELETERENDERBUFFERSPROC DeleteRenderbuffers;
+    PFNGLGENRENDERBUFFERSPROC GenRenderbuffers;
+    PFNGLRENDERBUFFERSTORAGEPROC RenderbufferStorage;
+    PFNGLGETRENDERBUFFERPARAMETERIVPROC GetRenderbufferParameteriv;
+    PFNGLISFRAMEBUFFERPROC IsFramebuffer;
+    PFNGLBINDFRAMEBUFFERPROC BindFramebuffer;
+    PFNGLDELETEFRAMEBUFFERSPROC DeleteFramebuffers;
+    PFNGLGENFRAMEBUFFERSPROC GenFramebuffers;
+    PFNGLCHECKFRAMEBUFFERSTATUSPROC CheckFramebufferStatus;
+    PFNGLFRAMEBUFFERTEXTURE1DPROC FramebufferTexture1D;
+    PFNGLFRAMEBUFFERTEXTURE2DPROC FramebufferTexture2D;
+    PFNGLFRAMEBUFFERTEXTURE3DPROC FramebufferTexture3D;
+    PFNGLFRAMEBUFFERRENDERBUFFERPROC FramebufferRenderbuffer;
+    PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC GetFramebufferAttachmentParameteriv;
+    PFNGLGENERATEMIPMAPPROC GenerateMipmap;
+    PFNGLBLITFRAMEBUFFERPROC BlitFramebuffer;
+    PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC RenderbufferStorageMultisample;
+    PFNGLFRAMEBUFFERTEXTURELAYERPROC FramebufferTextureLayer;
+    PFNGLMAPBUFFERRANGEPROC MapBufferRange;
+    PFNGLFLUSHMAPPEDBUFFERRANGEPROC FlushMappedBufferRange;
+    PFNGLBINDVERTEXARRAYPROC BindVertexArray;
+    PFNGLDELETEVERTEXARRAYSPROC DeleteVertexArrays;
+    PFNGLGENVERTEXARRAYSPROC GenVertexArrays;
+    PFNGLISVERTEXARRAYPROC IsVertexArray;
+    PFNGLDRAWARRAYSINSTANCEDPROC DrawArraysInstanced;
+    PFNGLDRAWELEMENTSINSTANCEDPROC DrawElementsInstanced;
+    PFNGLTEXBUFFERPROC TexBuffer;
+    PFNGLPRIMITIVERESTARTINDEXPROC PrimitiveRestartIndex;
+    PFNGLCOPYBUFFERSUBDATAPROC CopyBufferSubData;
+    PFNGLGETUNIFORMINDICESPROC GetUniformIndices;
+    PFNGLGETACTIVEUNIFORMSIVPROC GetActiveUniformsiv;
+    PFNGLGETACTIVEUNIFORMNAMEPROC GetActiveUniformName;
+    PFNGLGETUNIFORMBLOCKINDEXPROC GetUniformBlockIndex;
+    PFNGLGETACTIVEUNIFORMBLOCKIVPROC GetActiveUniformBlockiv;
+    PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC GetActiveUniformBlockName;
+    PFNGLUNIFORMBLOCKBINDINGPROC UniformBlockBinding;
+    PFNGLDRAWELEMENTSBASEVERTEXPROC DrawElementsBaseVertex;
+    PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC DrawRangeElementsBaseVertex;
+    PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC DrawElementsInstancedBaseVertex;
+    PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC MultiDrawElementsBaseVertex;
+    PFNGLPROVOKINGVERTEXPROC ProvokingVertex;
+    PFNGLFENCESYNCPROC FenceSync;
+    PFNGLISSYNCPROC IsSync;
+    PFNGLDELETESYNCPROC DeleteSync;
+    PFNGLCLIENTWAITSYNCPROC ClientWaitSync;
+    PFNGLWAITSYNCPROC WaitSync;
+    PFNGLGETINTEGER64VPROC GetInteger64v;
+    PFNGLGETSYNCIVPROC GetSynciv;
+    PFNGLGETINTEGER64I_VPROC GetInteger64i_v;
+    PFNGLGETBUFFERPARAMETERI64VPROC GetBufferParameteri64v;
+    PFNGLFRAMEBUFFERTEXTUREPROC FramebufferTexture;
+    PFNGLTEXIMAGE2DMULTISAMPLEPROC TexImage2DMultisample;
+    PFNGLTEXIMAGE3DMULTISAMPLEPROC TexImage3DMultisample;
+    PFNGLGETMULTISAMPLEFVPROC GetMultisamplefv;
+    PFNGLSAMPLEMASKIPROC SampleMaski;
+    PFNGLBINDFRAGDATALOCATIONINDEXEDPROC BindFragDataLocationIndexed;
+    PFNGLGETFRAGDATAINDEXPROC GetFragDataIndex;
+    PFNGLGENSAMPLERSPROC GenSamplers;
+    PFNGLDELETESAMPLERSPROC DeleteSamplers;
+    PFNGLISSAMPLERPROC IsSampler;
+    PFNGLBINDSAMPLERPROC BindSampler;
+    PFNGLSAMPLERPARAMETERIPROC SamplerParameteri;
+    PFNGLSAMPLERPARAMETERIVPROC SamplerParameteriv;
+    PFNGLSAMPLERPARAMETERFPROC SamplerParameterf;
+    PFNGLSAMPLERPARAMETERFVPROC SamplerParameterfv;
+    PFNGLSAMPLERPARAMETERIIVPROC SamplerParameterIiv;
+    PFNGLSAMPLERPARAMETERIUIVPROC SamplerParameterIuiv;
+    PFNGLGETSAMPLERPARAMETERIVPROC GetSamplerParameteriv;
+    PFNGLGETSAMPLERPARAMETERIIVPROC GetSamplerParameterIiv;
+    PFNGLGETSAMPLERPARAMETERFVPROC GetSamplerParameterfv;
+    PFNGLGETSAMPLERPARAMETERIUIVPROC GetSamplerParameterIuiv;
+    PFNGLQUERYCOUNTERPROC QueryCounter;
+    PFNGLGETQUERYOBJECTI64VPROC GetQueryObjecti64v;
+    PFNGLGETQUERYOBJECTUI64VPROC GetQueryObjectui64v;
+    PFNGLVERTEXATTRIBDIVISORPROC VertexAttribDivisor;
+    PFNGLVERTEXATTRIBP1UIPROC VertexAttribP1ui;
+    PFNGLVERTEXATTRIBP1UIVPROC VertexAttribP1uiv;
+    PFNGLVERTEXATTRIBP2UIPROC VertexAttribP2ui;
+    PFNGLVERTEXATTRIBP2UIVPROC VertexAttribP2uiv;
+    PFNGLVERTEXATTRIBP3UIPROC VertexAttribP3ui;
+    PFNGLVERTEXATTRIBP3UIVPROC VertexAttribP3uiv;
+    PFNGLVERTEXATTRIBP4UIPROC VertexAttribP4ui;
+    PFNGLVERTEXATTRIBP4UIVPROC VertexAttribP4uiv;
+    PFNGLMINSAMPLESHADINGPROC MinSampleShading;
+    PFNGLBLENDEQUATIONIPROC BlendEquationi;
+    PFNGLBLENDEQUATIONSEPARATEIPROC BlendEquationSeparatei;
+    PFNGLBLENDFUNCIPROC BlendFunci;
+    PFNGLBLENDFUNCSEPARATEIPROC BlendFuncSeparatei;
+    PFNGLDRAWARRAYSINDIRECTPROC DrawArraysIndirect;
+    PFNGLDRAWELEMENTSINDIRECTPROC DrawElementsIndirect;
+    PFNGLUNIFORM1DPROC Uniform1d;
+    PFNGLUNIFORM2DPROC Uniform2d;
+    PFNGLUNIFORM3DPROC Uniform3d;
+    PFNGLUNIFORM4DPROC Uniform4d;
+    PFNGLUNIFORM1DVPROC Uniform1dv;
+    PFNGLUNIFORM2DVPROC Uniform2dv;
+    PFNGLUNIFORM3DVPROC Uniform3dv;
+    PFNGLUNIFORM4DVPROC Uniform4dv;
+    PFNGLUNIFORMMATRIX2DVPROC UniformMatrix2dv;
+    PFNGLUNIFORMMATRIX3DVPROC UniformMatrix3dv;
+    PFNGLUNIFORMMATRIX4DVPROC UniformMatrix4dv;
+    PFNGLUNIFORMMATRIX2X3DVPROC UniformMatrix2x3dv;
+    PFNGLUNIFORMMATRIX2X4DVPROC UniformMatrix2x4dv;
+    PFNGLUNIFORMMATRIX3X2DVPROC UniformMatrix3x2dv;
+    PFNGLUNIFORMMATRIX3X4DVPROC UniformMatrix3x4dv;
+    PFNGLUNIFORMMATRIX4X2DVPROC UniformMatrix4x2dv;
+    PFNGLUNIFORMMATRIX4X3DVPROC UniformMatrix4x3dv;
+    PFNGLGETUNIFORMDVPROC GetUniformdv;
+    PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC GetSubroutineUniformLocation;
+    PFNGLGETSUBROUTINEINDEXPROC GetSubroutineIndex;
+    PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC GetActiveSubroutineUniformiv;
+    PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC GetActiveSubroutineUniformName;
+    PFNGLGETACTIVESUBROUTINENAMEPROC GetActiveSubroutineName;
+    PFNGLUNIFORMSUBROUTINESUIVPROC UniformSubroutinesuiv;
+    PFNGLGETUNIFORMSUBROUTINEUIVPROC GetUniformSubroutineuiv;
+    PFNGLGETPROGRAMSTAGEIVPROC GetProgramStageiv;
+    PFNGLPATCHPARAMETERIPROC PatchParameteri;
+    PFNGLPATCHPARAMETERFVPROC PatchParameterfv;
+    PFNGLBINDTRANSFORMFEEDBACKPROC BindTransformFeedback;
+    PFNGLDELETETRANSFORMFEEDBACKSPROC DeleteTransformFeedbacks;
+    PFNGLGENTRANSFORMFEEDBACKSPROC GenTransformFeedbacks;
+    PFNGLISTRANSFORMFEEDBACKPROC IsTransformFeedback;
+    PFNGLPAUSETRANSFORMFEEDBACKPROC PauseTransformFeedback;
+    PFNGLRESUMETRANSFORMFEEDBACKPROC ResumeTransformFeedback;
+    PFNGLDRAWTRANSFORMFEEDBACKPROC DrawTransformFeedback;
+    PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC DrawTransformFeedbackStream;
+    PFNGLBEGINQUERYINDEXEDPROC BeginQueryIndexed;
+    PFNGLENDQUERYINDEXEDPROC EndQueryIndexed;
+    PFNGLGETQUERYINDEXEDIVPROC GetQueryIndexediv;
+    PFNGLRELEASESHADERCOMPILERPROC ReleaseShaderCompiler;
+    PFNGLSHADERBINARYPROC ShaderBinary;
+    PFNGLGETSHADERPRECISIONFORMATPROC GetShaderPrecisionFormat;
+    PFNGLDEPTHRANGEFPROC DepthRangef;
+    PFNGLCLEARDEPTHFPROC ClearDepthf;
+    PFNGLGETPROGRAMBINARYPROC GetProgramBinary;
+    PFNGLPROGRAMBINARYPROC ProgramBinary;
+    PFNGLPROGRAMPARAMETERIPROC ProgramParameteri;
+    PFNGLUSEPROGRAMSTAGESPROC UseProgramStages;
+    PFNGLACTIVESHADERPROGRAMPROC ActiveShaderProgram;
+    PFNGLCREATESHADERPROGRAMVPROC CreateShaderProgramv;
+    PFNGLBINDPROGRAMPIPELINEPROC BindProgramPipeline;
+    PFNGLDELETEPROGRAMPIPELINESPROC DeleteProgramPipelines;
+    PFNGLGENPROGRAMPIPELINESPROC GenProgramPipelines;
+    PFNGLISPROGRAMPIPELINEPROC IsProgramPipeline;
+    PFNGLGETPROGRAMPIPELINEIVPROC GetProgramPipelineiv;
+    PFNGLPROGRAMUNIFORM1IPROC ProgramUniform1i;
+    PFNGLPROGRAMUNIFORM1IVPROC ProgramUniform1iv;
+    PFNGLPROGRAMUNIFORM1FPROC ProgramUniform1f;
+    PFNGLPROGRAMUNIFORM1FVPROC ProgramUniform1fv;
+    PFNGLPROGRAMUNIFORM1DPROC ProgramUniform1d;
+    PFNGLPROGRAMUNIFORM1DVPROC ProgramUniform1dv;
+    PFNGLPROGRAMUNIFORM1UIPROC ProgramUniform1ui;
+    PFNGLPROGRAMUNIFORM1UIVPROC ProgramUniform1uiv;
+    PFNGLPROGRAMUNIFORM2IPROC ProgramUniform2i;
+    PFNGLPROGRAMUNIFORM2IVPROC ProgramUniform2iv;
+    PFNGLPROGRAMUNIFORM2FPROC ProgramUniform2f;
+    PFNGLPROGRAMUNIFORM2FVPROC ProgramUniform2fv;
+    PFNGLPROGRAMUNIFORM2DPROC ProgramUniform2d;
+    PFNGLPROGRAMUNIFORM2DVPROC ProgramUniform2dv;
+    PFNGLPROGRAMUNIFORM2UIPROC ProgramUniform2ui;
+    PFNGLPROGRAMUNIFORM2UIVPROC ProgramUniform2uiv;
+    PFNGLPROGRAMUNIFORM3IPROC ProgramUniform3i;
+    PFNGLPROGRAMUNIFORM3IVPROC ProgramUniform3iv;
+    PFNGLPROGRAMUNIFORM3FPROC ProgramUniform3f;
+    PFNGLPROGRAMUNIFORM3FVPROC ProgramUniform3fv;
+    PFNGLPROGRAMUNIFORM3DPROC ProgramUniform3d;
+    PFNGLPROGRAMUNIFORM3DVPROC ProgramUniform3dv;
+    PFNGLPROGRAMUNIFORM3UIPROC ProgramUniform3ui;
+    PFNGLPROGRAMUNIFORM3UIVPROC ProgramUniform3uiv;
+    PFNGLPROGRAMUNIFORM4IPROC ProgramUniform4i;
+    PFNGLPROGRAMUNIFORM4IVPROC ProgramUniform4iv;
+    PFNGLPROGRAMUNIFORM4FPROC ProgramUniform4f;
+    PFNGLPROGRAMUNIFORM4FVPROC ProgramUniform4fv;
+    PFNGLPROGRAMUNIFORM4DPROC ProgramUniform4d;
+    PFNGLPROGRAMUNIFORM4DVPROC ProgramUniform4dv;
+    PFNGLPROGRAMUNIFORM4UIPROC ProgramUniform4ui;
+    PFNGLPROGRAMUNIFORM4UIVPROC ProgramUniform4uiv;
+    PFNGLPROGRAMUNIFORMMATRIX2FVPROC ProgramUniformMatrix2fv;
+    PFNGLPROGRAMUNIFORMMATRIX3FVPROC ProgramUniformMatrix3fv;
+    PFNGLPROGRAMUNIFORMMATRIX4FVPROC ProgramUniformMatrix4fv;
+    PFNGLPROGRAMUNIFORMMATRIX2DVPROC ProgramUniformMatrix2dv;
+    PFNGLPROGRAMUNIFORMMATRIX3DVPROC ProgramUniformMatrix3dv;
+    PFNGLPROGRAMUNIFORMMATRIX4DVPROC ProgramUniformMatrix4dv;
+    PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC ProgramUniformMatrix2x3fv;
+    PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC ProgramUniformMatrix3x2fv;
+    PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC ProgramUniformMatrix2x4fv;
+    PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC ProgramUniformMatrix4x2fv;
+    PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC ProgramUniformMatrix3x4fv;
+    PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC ProgramUniformMatrix4x3fv;
+    PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC ProgramUniformMatrix2x3dv;
+    PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC ProgramUniformMatrix3x2dv;
+    PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC ProgramUniformMatrix2x4dv;
+    PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC ProgramUniformMatrix4x2dv;
+    PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC ProgramUniformMatrix3x4dv;
+    PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC ProgramUniformMatrix4x3dv;
+    PFNGLVALIDATEPROGRAMPIPELINEPROC ValidateProgramPipeline;
+    PFNGLGETPROGRAMPIPELINEINFOLOGPROC GetProgramPipelineInfoLog;
+    PFNGLVERTEXATTRIBL1DPROC VertexAttribL1d;
+    PFNGLVERTEXATTRIBL2DPROC VertexAttribL2d;
+    PFNGLVERTEXATTRIBL3DPROC VertexAttribL3d;
+    PFNGLVERTEXATTRIBL4DPROC VertexAttribL4d;
+    PFNGLVERTEXATTRIBL1DVPROC VertexAttribL1dv;
+    PFNGLVERTEXATTRIBL2DVPROC VertexAttribL2dv;
+    PFNGLVERTEXATTRIBL3DVPROC VertexAttribL3dv;
+    PFNGLVERTEXATTRIBL4DVPROC VertexAttribL4dv;
+    PFNGLVERTEXATTRIBLPOINTERPROC VertexAttribLPointer;
+    PFNGLGETVERTEXATTRIBLDVPROC GetVertexAttribLdv;
+    PFNGLVIEWPORTARRAYVPROC ViewportArrayv;
+    PFNGLVIEWPORTINDEXEDFPROC ViewportIndexedf;
+    PFNGLVIEWPORTINDEXEDFVPROC ViewportIndexedfv;
+    PFNGLSCISSORARRAYVPROC ScissorArrayv;
+    PFNGLSCISSORINDEXEDPROC ScissorIndexed;
+    PFNGLSCISSORINDEXEDVPROC ScissorIndexedv;
+    PFNGLDEPTHRANGEARRAYVPROC DepthRangeArrayv;
+    PFNGLDEPTHRANGEINDEXEDPROC DepthRangeIndexed;
+    PFNGLGETFLOATI_VPROC GetFloati_v;
+    PFNGLGETDOUBLEI_VPROC GetDoublei_v;
+    PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC DrawArraysInstancedBaseInstance;
+    PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC DrawElementsInstancedBaseInstance;
+    PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC DrawElementsInstancedBaseVertexBaseInstance;
+    PFNGLGETINTERNALFORMATIVPROC GetInternalformativ;
+    PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC GetActiveAtomicCounterBufferiv;
+    PFNGLBINDIMAGETEXTUREPROC BindImageTexture;
+    PFNGLMEMORYBARRIERPROC MemoryBarrier;
+    PFNGLTEXSTORAGE1DPROC TexStorage1D;
+    PFNGLTEXSTORAGE2DPROC TexStorage2D;
+    PFNGLTEXSTORAGE3DPROC TexStorage3D;
+    PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC DrawTransformFeedbackInstanced;
+    PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC DrawTransformFeedbackStreamInstanced;
+    PFNGLCLEARBUFFERDATAPROC ClearBufferData;
+    PFNGLCLEARBUFFERSUBDATAPROC ClearBufferSubData;
+    PFNGLDISPATCHCOMPUTEPROC DispatchCompute;
+    PFNGLDISPATCHCOMPUTEINDIRECTPROC DispatchComputeIndirect;
+    PFNGLCOPYIMAGESUBDATAPROC CopyImageSubData;
+    PFNGLFRAMEBUFFERPARAMETERIPROC FramebufferParameteri;
+    PFNGLGETFRAMEBUFFERPARAMETERIVPROC GetFramebufferParameteriv;
+    PFNGLGETINTERNALFORMATI64VPROC GetInternalformati64v;
+    PFNGLINVALIDATETEXSUBIMAGEPROC InvalidateTexSubImage;
+    PFNGLINVALIDATETEXIMAGEPROC InvalidateTexImage;
+    PFNGLINVALIDATEBUFFERSUBDATAPROC InvalidateBufferSubData;
+    PFNGLINVALIDATEBUFFERDATAPROC InvalidateBufferData;
+    PFNGLINVALIDATEFRAMEBUFFERPROC InvalidateFramebuffer;
+    PFNGLINVALIDATESUBFRAMEBUFFERPROC InvalidateSubFramebuffer;
+    PFNGLMULTIDRAWARRAYSINDIRECTPROC MultiDrawArraysIndirect;
+    PFNGLMULTIDRAWELEMENTSINDIRECTPROC MultiDrawElementsIndirect;
+    PFNGLGETPROGRAMINTERFACEIVPROC GetProgramInterfaceiv;
+    PFNGLGETPROGRAMRESOURCEINDEXPROC GetProgramResourceIndex;
+    PFNGLGETPROGRAMRESOURCENAMEPROC GetProgramResourceName;
+    PFNGLGETPROGRAMRESOURCEIVPROC GetProgramResourceiv;
+    PFNGLGETPROGRAMRESOURCELOCATIONPROC GetProgramResourceLocation;
+    PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC GetProgramResourceLocationIndex;
+    PFNGLSHADERSTORAGEBLOCKBINDINGPROC ShaderStorageBlockBinding;
+    PFNGLTEXBUFFERRANGEPROC TexBufferRange;
+    PFNGLTEXSTORAGE2DMULTISAMPLEPROC TexStorage2DMultisample;
+    PFNGLTEXSTORAGE3DMULTISAMPLEPROC TexStorage3DMultisample;
+    PFNGLTEXTUREVIEWPROC TextureView;
+    PFNGLBINDVERTEXBUFFERPROC BindVertexBuffer;
+    PFNGLVERTEXATTRIBFORMATPROC VertexAttribFormat;
+    PFNGLVERTEXATTRIBIFORMATPROC VertexAttribIFormat;
+    PFNGLVERTEXATTRIBLFORMATPROC VertexAttribLFormat;
+    PFNGLVERTEXATTRIBBINDINGPROC VertexAttribBinding;
+    PFNGLVERTEXBINDINGDIVISORPROC VertexBindingDivisor;
+    PFNGLDEBUGMESSAGECONTROLPROC DebugMessageControl;
+    PFNGLDEBUGMESSAGEINSERTPROC DebugMessageInsert;
+    PFNGLDEBUGMESSAGECALLBACKPROC DebugMessageCallback;
+    PFNGLGETDEBUGMESSAGELOGPROC GetDebugMessageLog;
+    PFNGLPUSHDEBUGGROUPPROC PushDebugGroup;
+    PFNGLPOPDEBUGGROUPPROC PopDebugGroup;
+    PFNGLOBJECTLABELPROC ObjectLabel;
+    PFNGLGETOBJECTLABELPROC GetObjectLabel;
+    PFNGLOBJECTPTRLABELPROC ObjectPtrLabel;
+    PFNGLGETOBJECTPTRLABELPROC GetObjectPtrLabel;
+    PFNGLBUFFERSTORAGEPROC BufferStorage;
+    PFNGLCLEARTEXIMAGEPROC ClearTexImage;
+    PFNGLCLEARTEXSUBIMAGEPROC ClearTexSubImage;
+    PFNGLBINDBUFFERSBASEPROC BindBuffersBase;
+    PFNGLBINDBUFFERSRANGEPROC BindBuffersRange;
+    PFNGLBINDTEXTURESPROC BindTextures;
+    PFNGLBINDSAMPLERSPROC BindSamplers;
+    PFNGLBINDIMAGETEXTURESPROC BindImageTextures;
+    PFNGLBINDVERTEXBUFFERSPROC BindVertexBuffers;
+    PFNGLCLIPCONTROLPROC ClipControl;
+    PFNGLCREATETRANSFORMFEEDBACKSPROC CreateTransformFeedbacks;
+    PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC TransformFeedbackBufferBase;
+    PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC TransformFeedbackBufferRange;
+    PFNGLGETTRANSFORMFEEDBACKIVPROC GetTransformFeedbackiv;
+    PFNGLGETTRANSFORMFEEDBACKI_VPROC GetTransformFeedbacki_v;
+    PFNGLGETTRANSFORMFEEDBACKI64_VPROC GetTransformFeedbacki64_v;
+    PFNGLCREATEBUFFERSPROC CreateBuffers;
+    PFNGLNAMEDBUFFERSTORAGEPROC NamedBufferStorage;
+    PFNGLNAMEDBUFFERDATAPROC NamedBufferData;
+    PFNGLNAMEDBUFFERSUBDATAPROC NamedBufferSubData;
+    PFNGLCOPYNAMEDBUFFERSUBDATAPROC CopyNamedBufferSubData;
+    PFNGLCLEARNAMEDBUFFERDATAPROC ClearNamedBufferData;
+    PFNGLCLEARNAMEDBUFFERSUBDATAPROC ClearNamedBufferSubData;
+    PFNGLMAPNAMEDBUFFERPROC MapNamedBuffer;
+    PFNGLMAPNAMEDBUFFERRANGEPROC MapNamedBufferRange;
+    PFNGLUNMAPNAMEDBUFFERPROC UnmapNamedBuffer;
+    PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC FlushMappedNamedBufferRange;
+    PFNGLGETNAMEDBUFFERPARAMETERIVPROC GetNamedBufferParameteriv;
+    PFNGLGETNAMEDBUFFERPARAMETERI64VPROC GetNamedBufferParameteri64v;
+    PFNGLGETNAMEDBUFFERPOINTERVPROC GetNamedBufferPointerv;
+    PFNGLGETNAMEDBUFFERSUBDATAPROC GetNamedBufferSubData;
+    PFNGLCREATEFRAMEBUFFERSPROC CreateFramebuffers;
+    PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC NamedFramebufferRenderbuffer;
+    PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC NamedFramebufferParameteri;
+    PFNGLNAMEDFRAMEBUFFERTEXTUREPROC NamedFramebufferTexture;
+    PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC NamedFramebufferTextureLayer;
+    PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC NamedFramebufferDrawBuffer;
+    PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC NamedFramebufferDrawBuffers;
+    PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC NamedFramebufferReadBuffer;
+    PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC InvalidateNamedFramebufferData;
+    PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC InvalidateNamedFramebufferSubData;
+    PFNGLCLEARNAMEDFRAMEBUFFERIVPROC ClearNamedFramebufferiv;
+    PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC ClearNamedFramebufferuiv;
+    PFNGLCLEARNAMEDFRAMEBUFFERFVPROC ClearNamedFramebufferfv;
+    PFNGLCLEARNAMEDFRAMEBUFFERFIPROC ClearNamedFramebufferfi;
+    PFNGLBLITNAMEDFRAMEBUFFERPROC BlitNamedFramebuffer;
+    PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC CheckNamedFramebufferStatus;
+    PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC GetNamedFramebufferParameteriv;
+    PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC GetNamedFramebufferAttachmentParameteriv;
+    PFNGLCREATERENDERBUFFERSPROC CreateRenderbuffers;
+    PFNGLNAMEDRENDERBUFFERSTORAGEPROC NamedRenderbufferStorage;
+    PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC NamedRenderbufferStorageMultisample;
+    PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC GetNamedRenderbufferParameteriv;
+    PFNGLCREATETEXTURESPROC CreateTextures;
+    PFNGLTEXTUREBUFFERPROC TextureBuffer;
+    PFNGLTEXTUREBUFFERRANGEPROC TextureBufferRange;
+    PFNGLTEXTURESTORAGE1DPROC TextureStorage1D;
+    PFNGLTEXTURESTORAGE2DPROC TextureStorage2D;
+    PFNGLTEXTURESTORAGE3DPROC TextureStorage3D;
+    PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC TextureStorage2DMultisample;
+    PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC TextureStorage3DMultisample;
+    PFNGLTEXTURESUBIMAGE1DPROC TextureSubImage1D;
+    PFNGLTEXTURESUBIMAGE2DPROC TextureSubImage2D;
+    PFNGLTEXTURESUBIMAGE3DPROC TextureSubImage3D;
+    PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC CompressedTextureSubImage1D;
+    PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC CompressedTextureSubImage2D;
+    PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC CompressedTextureSubImage3D;
+    PFNGLCOPYTEXTURESUBIMAGE1DPROC CopyTextureSubImage1D;
+    PFNGLCOPYTEXTURESUBIMAGE2DPROC CopyTextureSubImage2D;
+    PFNGLCOPYTEXTURESUBIMAGE3DPROC CopyTextureSubImage3D;
+    PFNGLTEXTUREPARAMETERFPROC TextureParameterf;
+    PFNGLTEXTUREPARAMETERFVPROC TextureParameterfv;
+    PFNGLTEXTUREPARAMETERIPROC TextureParameteri;
+    PFNGLTEXTUREPARAMETERIIVPROC TextureParameterIiv;
+    PFNGLTEXTUREPARAMETERIUIVPROC TextureParameterIuiv;
+    PFNGLTEXTUREPARAMETERIVPROC TextureParameteriv;
+    PFNGLGENERATETEXTUREMIPMAPPROC GenerateTextureMipmap;
+    PFNGLBINDTEXTUREUNITPROC BindTextureUnit;
+    PFNGLGETTEXTUREIMAGEPROC GetTextureImage;
+    PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC GetCompressedTextureImage;
+    PFNGLGETTEXTURELEVELPARAMETERFVPROC GetTextureLevelParameterfv;
+    PFNGLGETTEXTURELEVELPARAMETERIVPROC GetTextureLevelParameteriv;
+    PFNGLGETTEXTUREPARAMETERFVPROC GetTextureParameterfv;
+    PFNGLGETTEXTUREPARAMETERIIVPROC GetTextureParameterIiv;
+    PFNGLGETTEXTUREPARAMETERIUIVPROC GetTextureParameterIuiv;
+    PFNGLGETTEXTUREPARAMETERIVPROC GetTextureParameteriv;
+    PFNGLCREATEVERTEXARRAYSPROC CreateVertexArrays;
+    PFNGLDISABLEVERTEXARRAYATTRIBPROC DisableVertexArrayAttrib;
+    PFNGLENABLEVERTEXARRAYATTRIBPROC EnableVertexArrayAttrib;
+    PFNGLVERTEXARRAYELEMENTBUFFERPROC VertexArrayElementBuffer;
+    PFNGLVERTEXARRAYVERTEXBUFFERPROC VertexArrayVertexBuffer;
+    PFNGLVERTEXARRAYVERTEXBUFFERSPROC VertexArrayVertexBuffers;
+    PFNGLVERTEXARRAYATTRIBBINDINGPROC VertexArrayAttribBinding;
+    PFNGLVERTEXARRAYATTRIBFORMATPROC VertexArrayAttribFormat;
+    PFNGLVERTEXARRAYATTRIBIFORMATPROC VertexArrayAttribIFormat;
+    PFNGLVERTEXARRAYATTRIBLFORMATPROC VertexArrayAttribLFormat;
+    PFNGLVERTEXARRAYBINDINGDIVISORPROC VertexArrayBindingDivisor;
+    PFNGLGETVERTEXARRAYIVPROC GetVertexArrayiv;
+    PFNGLGETVERTEXARRAYINDEXEDIVPROC GetVertexArrayIndexediv;
+    PFNGLGETVERTEXARRAYINDEXED64IVPROC GetVertexArrayIndexed64iv;
+    PFNGLCREATESAMPLERSPROC CreateSamplers;
+    PFNGLCREATEPROGRAMPIPELINESPROC CreateProgramPipelines;
+    PFNGLCREATEQUERIESPROC CreateQueries;
+    PFNGLGETQUERYBUFFEROBJECTI64VPROC GetQueryBufferObjecti64v;
+    PFNGLGETQUERYBUFFEROBJECTIVPROC GetQueryBufferObjectiv;
+    PFNGLGETQUERYBUFFEROBJECTUI64VPROC GetQueryBufferObjectui64v;
+    PFNGLGETQUERYBUFFEROBJECTUIVPROC GetQueryBufferObjectuiv;
+    PFNGLMEMORYBARRIERBYREGIONPROC MemoryBarrierByRegion;
+    PFNGLGETTEXTURESUBIMAGEPROC GetTextureSubImage;
+    PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC GetCompressedTextureSubImage;
+    PFNGLGETGRAPHICSRESETSTATUSPROC GetGraphicsResetStatus;
+    PFNGLGETNCOMPRESSEDTEXIMAGEPROC GetnCompressedTexImage;
+    PFNGLGETNTEXIMAGEPROC GetnTexImage;
+    PFNGLGETNUNIFORMDVPROC GetnUniformdv;
+    PFNGLGETNUNIFORMFVPROC GetnUniformfv;
+    PFNGLGETNUNIFORMIVPROC GetnUniformiv;
+    PFNGLGETNUNIFORMUIVPROC GetnUniformuiv;
+    PFNGLREADNPIXELSPROC ReadnPixels;
+    PFNGLTEXTUREBARRIERPROC TextureBarrier;
+    PFNGLGETTEXTUREHANDLEARBPROC GetTextureHandleARB;
+    PFNGLGETTEXTURESAMPLERHANDLEARBPROC GetTextureSamplerHandleARB;
+    PFNGLMAKETEXTUREHANDLERESIDENTARBPROC MakeTextureHandleResidentARB;
+    PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC MakeTextureHandleNonResidentARB;
+    PFNGLGETIMAGEHANDLEARBPROC GetImageHandleARB;
+    PFNGLMAKEIMAGEHANDLERESIDENTARBPROC MakeImageHandleResidentARB;
+    PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC MakeImageHandleNonResidentARB;
+    PFNGLUNIFORMHANDLEUI64ARBPROC UniformHandleui64ARB;
+    PFNGLUNIFORMHANDLEUI64VARBPROC UniformHandleui64vARB;
+    PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC ProgramUniformHandleui64ARB;
+    PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC ProgramUniformHandleui64vARB;
+    PFNGLISTEXTUREHANDLERESIDENTARBPROC IsTextureHandleResidentARB;
+    PFNGLISIMAGEHANDLERESIDENTARBPROC IsImageHandleResidentARB;
+    PFNGLVERTEXATTRIBL1UI64ARBPROC VertexAttribL1ui64ARB;
+    PFNGLVERTEXATTRIBL1UI64VARBPROC VertexAttribL1ui64vARB;
+    PFNGLGETVERTEXATTRIBLUI64VARBPROC GetVertexAttribLui64vARB;
+    PFNGLCREATESYNCFROMCLEVENTARBPROC CreateSyncFromCLeventARB;
+    PFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC DispatchComputeGroupSizeARB;
+    PFNGLDEBUGMESSAGECONTROLARBPROC DebugMessageControlARB;
+    PFNGLDEBUGMESSAGEINSERTARBPROC DebugMessageInsertARB;
+    PFNGLDEBUGMESSAGECALLBACKARBPROC DebugMessageCallbackARB;
+    PFNGLGETDEBUGMESSAGELOGARBPROC GetDebugMessageLogARB;
+    PFNGLBLENDEQUATIONIARBPROC BlendEquationiARB;
+    PFNGLBLENDEQUATIONSEPARATEIARBPROC BlendEquationSeparateiARB;
+    PFNGLBLENDFUNCIARBPROC BlendFunciARB;
+    PFNGLBLENDFUNCSEPARATEIARBPROC BlendFuncSeparateiARB;
+    PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC MultiDrawArraysIndirectCountARB;
+    PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC MultiDrawElementsIndirectCountARB;
+    PFNGLGETGRAPHICSRESETSTATUSARBPROC GetGraphicsResetStatusARB;
+    PFNGLGETNTEXIMAGEARBPROC GetnTexImageARB;
+    PFNGLREADNPIXELSARBPROC ReadnPixelsARB;
+    PFNGLGETNCOMPRESSEDTEXIMAGEARBPROC GetnCompressedTexImageARB;
+    PFNGLGETNUNIFORMFVARBPROC GetnUniformfvARB;
+    PFNGLGETNUNIFORMIVARBPROC GetnUniformivARB;
+    PFNGLGETNUNIFORMUIVARBPROC GetnUniformuivARB;
+    PFNGLGETNUNIFORMDVARBPROC GetnUniformdvARB;
+    PFNGLMINSAMPLESHADINGARBPROC MinSampleShadingARB;
+    PFNGLNAMEDSTRINGARBPROC NamedStringARB;
+    PFNGLDELETENAMEDSTRINGARBPROC DeleteNamedStringARB;
+    PFNGLCOMPILESHADERINCLUDEARBPROC CompileShaderIncludeARB;
+    PFNGLISNAMEDSTRINGARBPROC IsNamedStringARB;
+    PFNGLGETNAMEDSTRINGARBPROC GetNamedStringARB;
+    PFNGLGETNAMEDSTRINGIVARBPROC GetNamedStringivARB;
+    PFNGLBUFFERPAGECOMMITMENTARBPROC BufferPageCommitmentARB;
+    PFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC NamedBufferPageCommitmentEXT;
+    PFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC NamedBufferPageCommitmentARB;
+    PFNGLTEXPAGECOMMITMENTARBPROC TexPageCommitmentARB;
+    PFNGLGETMULTISAMPLEFVNVPROC GetMultisamplefvNV;
+    PFNGLSAMPLEMASKINDEXEDNVPROC SampleMaskIndexedNV;
+    PFNGLTEXRENDERBUFFERNVPROC TexRenderbufferNV;
+    PFNGLMAKEBUFFERRESIDENTNVPROC MakeBufferResidentNV;
+    PFNGLMAKEBUFFERNONRESIDENTNVPROC MakeBufferNonResidentNV;
+    PFNGLISBUFFERRESIDENTNVPROC IsBufferResidentNV;
+    PFNGLMAKENAMEDBUFFERRESIDENTNVPROC MakeNamedBufferResidentNV;
+    PFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC MakeNamedBufferNonResidentNV;
+    PFNGLISNAMEDBUFFERRESIDENTNVPROC IsNamedBufferResidentNV;
+    PFNGLGETBUFFERPARAMETERUI64VNVPROC GetBufferParameterui64vNV;
+    PFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC GetNamedBufferParameterui64vNV;
+    PFNGLGETINTEGERUI64VNVPROC GetIntegerui64vNV;
+    PFNGLUNIFORMUI64NVPROC Uniformui64NV;
+    PFNGLUNIFORMUI64VNVPROC Uniformui64vNV;
+    PFNGLPROGRAMUNIFORMUI64NVPROC ProgramUniformui64NV;
+    PFNGLPROGRAMUNIFORMUI64VNVPROC ProgramUniformui64vNV;
+    PFNGLBUFFERADDRESSRANGENVPROC BufferAddressRangeNV;
+    PFNGLVERTEXFORMATNVPROC VertexFormatNV;
+    PFNGLNORMALFORMATNVPROC NormalFormatNV;
+    PFNGLCOLORFORMATNVPROC ColorFormatNV;
+    PFNGLINDEXFORMATNVPROC IndexFormatNV;
+    PFNGLTEXCOORDFORMATNVPROC TexCoordFormatNV;
+    PFNGLEDGEFLAGFORMATNVPROC EdgeFlagFormatNV;
+    PFNGLSECONDARYCOLORFORMATNVPROC SecondaryColorFormatNV;
+    PFNGLFOGCOORDFORMATNVPROC FogCoordFormatNV;
+    PFNGLVERTEXATTRIBFORMATNVPROC VertexAttribFormatNV;
+    PFNGLVERTEXATTRIBIFORMATNVPROC VertexAttribIFormatNV;
+    PFNGLGETINTEGERUI64I_VNVPROC GetIntegerui64i_vNV;
+    PFNGLENABLECLIENTSTATEPROC EnableClientState;
+    PFNGLDISABLECLIENTSTATEPROC DisableClientState;
+};
+
+/* Copy the current entry points into a table. Entry points that are
+ * still lazy trampolines are resolved, so the table can be used to
+ * forward calls from layers installed in front of the driver. */
+void GetDispatch (DispatchTable *table);
+
+/* Install the entry points of a table as current entry points.
+ * With OGLP_DIRECT_LINK the entry points of core versions
+ * are linked directly and cannot be replaced. */
+void SetDispatch (const DispatchTable *table);
+
+#ifdef OGLP_DISPATCH_TABLE
+
+/* With OGLP_DISPATCH_TABLE all entry points are routed through the
+ * dispatch table that is current in the calling thread. Initially each
+ * thread uses a shared default table. Threads driving a different
+ * context should make their own table current before calling Init. */
+namespace internal {
+extern thread_local DispatchTable *currentdispatch;
+} /* namespace internal */
+
+inline DispatchTable *GetCurrentDispatchTable (void)
+{
+    return internal::currentdispatch;
+}
+
+void MakeCurrentDispatchTable (DispatchTable *table);
+
+inline void CullFace (GLenum mode)
+{
+    return internal::currentdispatch->CullFace (mode);
+}
+inline void FrontFace (GLenum mode)
+{
+    return internal::currentdispatch->FrontFace (mode);
+}
+inline void Hint (GLenum target, GLenum mode)
+{
+    return internal::currentdispatch->Hint (target, mode);
+}
+inline void LineWidth (GLfloat width)
+{
+    return internal::currentdispatch->LineWidth (width);
+}
+inline void PointSize (GLfloat size)
+{
+    return internal::currentdispatch->PointSize (size);
+}
+inline void PolygonMode (GLenum face, GLenum mode)
+{
+    return internal::currentdispatch->PolygonMode (face, mode);
+}
+inline void Scissor (GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    return internal::currentdispatch->Scissor (x, y, width, height);
+}
+inline void TexParameterf (GLenum target, GLenum pname, GLfloat param)
+{
+    return internal::currentdispatch->TexParameterf (target, pname, param);
+}
+inline void TexParameterfv (GLenum target, GLenum pname, const GLfloat *params)
+{
+    return internal::currentdispatch->TexParameterfv (target, pname, params);
+}
+inline void TexParameteri (GLenum target, GLenum pname, GLint param)
+{
+    return internal::currentdispatch->TexParameteri (target, pname, param);
+}
+inline void TexParameteriv (GLenum target, GLenum pname, const GLint *params)
+{
+    return internal::currentdispatch->TexParameteriv (target, pname, params);
+}
+inline void TexImage1D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    return internal::currentdispatch->TexImage1D (target, level, internalformat, width, border, format, type, pixels);
+}
+inline void TexImage2D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    return internal::currentdispatch->TexImage2D (target, level, internalformat, width, height, border, format, type, pixels);
+}
+inline void DrawBuffer (GLenum buf)
+{
+    return internal::currentdispatch->DrawBuffer (buf);
+}
+inline void Clear (GLbitfield mask)
+{
+    return internal::currentdispatch->Clear (mask);
+}
+inline void ClearColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    return internal::currentdispatch->ClearColor (red, green, blue, alpha);
+}
+inline void ClearStencil (GLint s)
+{
+    return internal::currentdispatch->ClearStencil (s);
+}
+inline void ClearDepth (GLdouble depth)
+{
+    return internal::currentdispatch->ClearDepth (depth);
+}
+inline void StencilMask (GLuint mask)
+{
+    return internal::currentdispatch->StencilMask (mask);
+}
+inline void ColorMask (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+    return internal::currentdispatch->ColorMask (red, green, blue, alpha);
+}
+inline void DepthMask (GLboolean flag)
+{
+    return internal::currentdispatch->DepthMask (flag);
+}
+inline void Disable (GLenum cap)
+{
+    return internal::currentdispatch->Disable (cap);
+}
+inline void Enable (GLenum cap)
+{
+    return internal::currentdispatch->Enable (cap);
+}
+inline void Finish (void)
+{
+    return internal::currentdispatch->Finish ();
+}
+inline void Flush (void)
+{
+    return internal::currentdispatch->Flush ();
+}
+inline void BlendFunc (GLenum sfactor, GLenum dfactor)
+{
+    return internal::currentdispatch->BlendFunc (sfactor, dfactor);
+}
+inline void LogicOp (GLenum opcode)
+{
+    return internal::currentdispatch->LogicOp (opcode);
+}
+inline void StencilFunc (GLenum func, GLint ref, GLuint mask)
+{
+    return internal::currentdispatch->StencilFunc (func, ref, mask);
+}
+inline void StencilOp (GLenum fail, GLenum zfail, GLenum zpass)
+{
+    return internal::currentdispatch->StencilOp (fail, zfail, zpass);
+}
+inline void DepthFunc (GLenum func)
+{
+    return internal::currentdispatch->DepthFunc (func);
+}
+inline void PixelStoref (GLenum pname, GLfloat param)
+{
+    return internal::currentdispatch->PixelStoref (pname, param);
+}
+inline void PixelStorei (GLenum pname, GLint param)
+{
+    return internal::currentdispatch->PixelStorei (pname, param);
+}
+inline void ReadBuffer (GLenum src)
+{
+    return internal::currentdispatch->ReadBuffer (src);
+}
+inline void ReadPixels (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels)
+{
+    return internal::currentdispatch->ReadPixels (x, y, width, height, format, type, pixels);
+}
+inline void GetBooleanv (GLenum pname, GLboolean *data)
+{
+    return internal::currentdispatch->GetBooleanv (pname, data);
+}
+inline void GetDoublev (GLenum pname, GLdouble *data)
+{
+    return internal::currentdispatch->GetDoublev (pname, data);
+}
+inline GLenum GetError (void)
+{
+    return internal::currentdispatch->GetError ();
+}
+inline void GetFloatv (GLenum pname, GLfloat *data)
+{
+    return internal::currentdispatch->GetFloatv (pname, data);
+}
+inline void GetIntegerv (GLenum pname, GLint *data)
+{
+    return internal::currentdispatch->GetIntegerv (pname, data);
+}
+inline const GLubyte * GetString (GLenum name)
+{
+    return internal::currentdispatch->GetString (name);
+}
+inline void GetTexImage (GLenum target, GLint level, GLenum format, GLenum type, void *pixels)
+{
+    return internal::currentdispatch->GetTexImage (target, level, format, type, pixels);
+}
+inline void GetTexParameterfv (GLenum target, GLenum pname, GLfloat *params)
+{
+    return internal::currentdispatch->GetTexParameterfv (target, pname, params);
+}
+inline void GetTexParameteriv (GLenum target, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetTexParameteriv (target, pname, params);
+}
+inline void GetTexLevelParameterfv (GLenum target, GLint level, GLenum pname, GLfloat *params)
+{
+    return internal::currentdispatch->GetTexLevelParameterfv (target, level, pname, params);
+}
+inline void GetTexLevelParameteriv (GLenum target, GLint level, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetTexLevelParameteriv (target, level, pname, params);
+}
+inline GLboolean IsEnabled (GLenum cap)
+{
+    return internal::currentdispatch->IsEnabled (cap);
+}
+inline void DepthRange (GLdouble near, GLdouble far)
+{
+    return internal::currentdispatch->DepthRange (near, far);
+}
+inline void Viewport (GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    return internal::currentdispatch->Viewport (x, y, width, height);
+}
+inline void DrawArrays (GLenum mode, GLint first, GLsizei count)
+{
+    return internal::currentdispatch->DrawArrays (mode, first, count);
+}
+inline void DrawElements (GLenum mode, GLsizei count, GLenum type, const void *indices)
+{
+    return internal::currentdispatch->DrawElements (mode, count, type, indices);
+}
+inline void GetPointerv (GLenum pname, void **params)
+{
+    return internal::currentdispatch->GetPointerv (pname, params);
+}
+inline void PolygonOffset (GLfloat factor, GLfloat units)
+{
+    return internal::currentdispatch->PolygonOffset (factor, units);
+}
+inline void CopyTexImage1D (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+{
+    return internal::currentdispatch->CopyTexImage1D (target, level, internalformat, x, y, width, border);
+}
+inline void CopyTexImage2D (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+{
+    return internal::currentdispatch->CopyTexImage2D (target, level, internalformat, x, y, width, height, border);
+}
+inline void CopyTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+    return internal::currentdispatch->CopyTexSubImage1D (target, level, xoffset, x, y, width);
+}
+inline void CopyTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    return internal::currentdispatch->CopyTexSubImage2D (target, level, xoffset, yoffset, x, y, width, height);
+}
+inline void TexSubImage1D (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels)
+{
+    return internal::currentdispatch->TexSubImage1D (target, level, xoffset, width, format, type, pixels);
+}
+inline void TexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+    return internal::currentdispatch->TexSubImage2D (target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+inline void BindTexture (GLenum target, GLuint texture)
+{
+    return internal::currentdispatch->BindTexture (target, texture);
+}
+inline void DeleteTextures (GLsizei n, const GLuint *textures)
+{
+    return internal::currentdispatch->DeleteTextures (n, textures);
+}
+inline void GenTextures (GLsizei n, GLuint *textures)
+{
+    return internal::currentdispatch->GenTextures (n, textures);
+}
+inline GLboolean IsTexture (GLuint texture)
+{
+    return internal::currentdispatch->IsTexture (texture);
+}
+inline void DrawRangeElements (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices)
+{
+    return internal::currentdispatch->DrawRangeElements (mode, start, end, count, type, indices);
+}
+inline void TexImage3D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    return internal::currentdispatch->TexImage3D (target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+inline void TexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels)
+{
+    return internal::currentdispatch->TexSubImage3D (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+inline void CopyTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    return internal::currentdispatch->CopyTexSubImage3D (target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+inline void ActiveTexture (GLenum texture)
+{
+    return internal::currentdispatch->ActiveTexture (texture);
+}
+inline void SampleCoverage (GLfloat value, GLboolean invert)
+{
+    return internal::currentdispatch->SampleCoverage (value, invert);
+}
+inline void CompressedTexImage3D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data)
+{
+    return internal::currentdispatch->CompressedTexImage3D (target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+inline void CompressedTexImage2D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data)
+{
+    return internal::currentdispatch->CompressedTexImage2D (target, level, internalformat, width, height, border, imageSize, data);
+}
+inline void CompressedTexImage1D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data)
+{
+    return internal::currentdispatch->CompressedTexImage1D (target, level, internalformat, width, border, imageSize, data);
+}
+inline void CompressedTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+{
+    return internal::currentdispatch->CompressedTexSubImage3D (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+inline void CompressedTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+{
+    return internal::currentdispatch->CompressedTexSubImage2D (target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+inline void CompressedTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
+{
+    return internal::currentdispatch->CompressedTexSubImage1D (target, level, xoffset, width, format, imageSize, data);
+}
+inline void GetCompressedTexImage (GLenum target, GLint level, void *img)
+{
+    return internal::currentdispatch->GetCompressedTexImage (target, level, img);
+}
+inline void BlendFuncSeparate (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+    return internal::currentdispatch->BlendFuncSeparate (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+inline void MultiDrawArrays (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount)
+{
+    return internal::currentdispatch->MultiDrawArrays (mode, first, count, drawcount);
+}
+inline void MultiDrawElements (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount)
+{
+    return internal::currentdispatch->MultiDrawElements (mode, count, type, indices, drawcount);
+}
+inline void PointParameterf (GLenum pname, GLfloat param)
+{
+    return internal::currentdispatch->PointParameterf (pname, param);
+}
+inline void PointParameterfv (GLenum pname, const GLfloat *params)
+{
+    return internal::currentdispatch->PointParameterfv (pname, params);
+}
+inline void PointParameteri (GLenum pname, GLint param)
+{
+    return internal::currentdispatch->PointParameteri (pname, param);
+}
+inline void PointParameteriv (GLenum pname, const GLint *params)
+{
+    return internal::currentdispatch->PointParameteriv (pname, params);
+}
+inline void BlendColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    return internal::currentdispatch->BlendColor (red, green, blue, alpha);
+}
+inline void BlendEquation (GLenum mode)
+{
+    return internal::currentdispatch->BlendEquation (mode);
+}
+inline void GenQueries (GLsizei n, GLuint *ids)
+{
+    return internal::currentdispatch->GenQueries (n, ids);
+}
+inline void DeleteQueries (GLsizei n, const GLuint *ids)
+{
+    return internal::currentdispatch->DeleteQueries (n, ids);
+}
+inline GLboolean IsQuery (GLuint id)
+{
+    return internal::currentdispatch->IsQuery (id);
+}
+inline void BeginQuery (GLenum target, GLuint id)
+{
+    return internal::currentdispatch->BeginQuery (target, id);
+}
+inline void EndQuery (GLenum target)
+{
+    return internal::currentdispatch->EndQuery (target);
+}
+inline void GetQueryiv (GLenum target, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetQueryiv (target, pname, params);
+}
+inline void GetQueryObjectiv (GLuint id, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetQueryObjectiv (id, pname, params);
+}
+inline void GetQueryObjectuiv (GLuint id, GLenum pname, GLuint *params)
+{
+    return internal::currentdispatch->GetQueryObjectuiv (id, pname, params);
+}
+inline void BindBuffer (GLenum target, GLuint buffer)
+{
+    return internal::currentdispatch->BindBuffer (target, buffer);
+}
+inline void DeleteBuffers (GLsizei n, const GLuint *buffers)
+{
+    return internal::currentdispatch->DeleteBuffers (n, buffers);
+}
+inline void GenBuffers (GLsizei n, GLuint *buffers)
+{
+    return internal::currentdispatch->GenBuffers (n, buffers);
+}
+inline GLboolean IsBuffer (GLuint buffer)
+{
+    return internal::currentdispatch->IsBuffer (buffer);
+}
+inline void BufferData (GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+{
+    return internal::currentdispatch->BufferData (target, size, data, usage);
+}
+inline void BufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    return internal::currentdispatch->BufferSubData (target, offset, size, data);
+}
+inline void GetBufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, void *data)
+{
+    return internal::currentdispatch->GetBufferSubData (target, offset, size, data);
+}
+inline void * MapBuffer (GLenum target, GLenum access)
+{
+    return internal::currentdispatch->MapBuffer (target, access);
+}
+inline GLboolean UnmapBuffer (GLenum target)
+{
+    return internal::currentdispatch->UnmapBuffer (target);
+}
+inline void GetBufferParameteriv (GLenum target, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetBufferParameteriv (target, pname, params);
+}
+inline void GetBufferPointerv (GLenum target, GLenum pname, void **params)
+{
+    return internal::currentdispatch->GetBufferPointerv (target, pname, params);
+}
+inline void BlendEquationSeparate (GLenum modeRGB, GLenum modeAlpha)
+{
+    return internal::currentdispatch->BlendEquationSeparate (modeRGB, modeAlpha);
+}
+inline void DrawBuffers (GLsizei n, const GLenum *bufs)
+{
+    return internal::currentdispatch->DrawBuffers (n, bufs);
+}
+inline void StencilOpSeparate (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
+{
+    return internal::currentdispatch->StencilOpSeparate (face, sfail, dpfail, dppass);
+}
+inline void StencilFuncSeparate (GLenum face, GLenum func, GLint ref, GLuint mask)
+{
+    return internal::currentdispatch->StencilFuncSeparate (face, func, ref, mask);
+}
+inline void StencilMaskSeparate (GLenum face, GLuint mask)
+{
+    return internal::currentdispatch->StencilMaskSeparate (face, mask);
+}
+inline void AttachShader (GLuint program, GLuint shader)
+{
+    return internal::currentdispatch->AttachShader (program, shader);
+}
+inline void BindAttribLocation (GLuint program, GLuint index, const GLchar *name)
+{
+    return internal::currentdispatch->BindAttribLocation (program, index, name);
+}
+inline void CompileShader (GLuint shader)
+{
+    return internal::currentdispatch->CompileShader (shader);
+}
+inline GLuint CreateProgram (void)
+{
+    return internal::currentdispatch->CreateProgram ();
+}
+inline GLuint CreateShader (GLenum type)
+{
+    return internal::currentdispatch->CreateShader (type);
+}
+inline void DeleteProgram (GLuint program)
+{
+    return internal::currentdispatch->DeleteProgram (program);
+}
+inline void DeleteShader (GLuint shader)
+{
+    return internal::currentdispatch->DeleteShader (shader);
+}
+inline void DetachShader (GLuint program, GLuint shader)
+{
+    return internal::currentdispatch->DetachShader (program, shader);
+}
+inline void DisableVertexAttribArray (GLuint index)
+{
+    return internal::currentdispatch->DisableVertexAttribArray (index);
+}
+inline void EnableVertexAttribArray (GLuint index)
+{
+    return internal::currentdispatch->EnableVertexAttribArray (index);
+}
+inline void GetActiveAttrib (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+    return internal::currentdispatch->GetActiveAttrib (program, index, bufSize, length, size, type, name);
+}
+inline void GetActiveUniform (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+    return internal::currentdispatch->GetActiveUniform (program, index, bufSize, length, size, type, name);
+}
+inline void GetAttachedShaders (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders)
+{
+    return internal::currentdispatch->GetAttachedShaders (program, maxCount, count, shaders);
+}
+inline GLint GetAttribLocation (GLuint program, const GLchar *name)
+{
+    return internal::currentdispatch->GetAttribLocation (program, name);
+}
+inline void GetProgramiv (GLuint program, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetProgramiv (program, pname, params);
+}
+inline void GetProgramInfoLog (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    return internal::currentdispatch->GetProgramInfoLog (program, bufSize, length, infoLog);
+}
+inline void GetShaderiv (GLuint shader, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetShaderiv (shader, pname, params);
+}
+inline void GetShaderInfoLog (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    return internal::currentdispatch->GetShaderInfoLog (shader, bufSize, length, infoLog);
+}
+inline void GetShaderSource (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source)
+{
+    return internal::currentdispatch->GetShaderSource (shader, bufSize, length, source);
+}
+inline GLint GetUniformLocation (GLuint program, const GLchar *name)
+{
+    return internal::currentdispatch->GetUniformLocation (program, name);
+}
+inline void GetUniformfv (GLuint program, GLint location, GLfloat *params)
+{
+    return internal::currentdispatch->GetUniformfv (program, location, params);
+}
+inline void GetUniformiv (GLuint program, GLint location, GLint *params)
+{
+    return internal::currentdispatch->GetUniformiv (program, location, params);
+}
+inline void GetVertexAttribdv (GLuint index, GLenum pname, GLdouble *params)
+{
+    return internal::currentdispatch->GetVertexAttribdv (index, pname, params);
+}
+inline void GetVertexAttribfv (GLuint index, GLenum pname, GLfloat *params)
+{
+    return internal::currentdispatch->GetVertexAttribfv (index, pname, params);
+}
+inline void GetVertexAttribiv (GLuint index, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetVertexAttribiv (index, pname, params);
+}
+inline void GetVertexAttribPointerv (GLuint index, GLenum pname, void **pointer)
+{
+    return internal::currentdispatch->GetVertexAttribPointerv (index, pname, pointer);
+}
+inline GLboolean IsProgram (GLuint program)
+{
+    return internal::currentdispatch->IsProgram (program);
+}
+inline GLboolean IsShader (GLuint shader)
+{
+    return internal::currentdispatch->IsShader (shader);
+}
+inline void LinkProgram (GLuint program)
+{
+    return internal::currentdispatch->LinkProgram (program);
+}
+inline void ShaderSource (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length)
+{
+    return internal::currentdispatch->ShaderSource (shader, count, string, length);
+}
+inline void UseProgram (GLuint program)
+{
+    return internal::currentdispatch->UseProgram (program);
+}
+inline void Uniform1f (GLint location, GLfloat v0)
+{
+    return internal::currentdispatch->Uniform1f (location, v0);
+}
+inline void Uniform2f (GLint location, GLfloat v0, GLfloat v1)
+{
+    return internal::currentdispatch->Uniform2f (location, v0, v1);
+}
+inline void Uniform3f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    return internal::currentdispatch->Uniform3f (location, v0, v1, v2);
+}
+inline void Uniform4f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+    return internal::currentdispatch->Uniform4f (location, v0, v1, v2, v3);
+}
+inline void Uniform1i (GLint location, GLint v0)
+{
+    return internal::currentdispatch->Uniform1i (location, v0);
+}
+inline void Uniform2i (GLint location, GLint v0, GLint v1)
+{
+    return internal::currentdispatch->Uniform2i (location, v0, v1);
+}
+inline void Uniform3i (GLint location, GLint v0, GLint v1, GLint v2)
+{
+    return internal::currentdispatch->Uniform3i (location, v0, v1, v2);
+}
+inline void Uniform4i (GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    return internal::currentdispatch->Uniform4i (location, v0, v1, v2, v3);
+}
+inline void Uniform1fv (GLint location, GLsizei count, const GLfloat *value)
+{
+    return internal::currentdispatch->Uniform1fv (location, count, value);
+}
+inline void Uniform2fv (GLint location, GLsizei count, const GLfloat *value)
+{
+    return internal::currentdispatch->Uniform2fv (location, count, value);
+}
+inline void Uniform3fv (GLint location, GLsizei count, const GLfloat *value)
+{
+    return internal::currentdispatch->Uniform3fv (location, count, value);
+}
+inline void Uniform4fv (GLint location, GLsizei count, const GLfloat *value)
+{
+    return internal::currentdispatch->Uniform4fv (location, count, value);
+}
+inline void Uniform1iv (GLint location, GLsizei count, const GLint *value)
+{
+    return internal::currentdispatch->Uniform1iv (location, count, value);
+}
+inline void Uniform2iv (GLint location, GLsizei count, const GLint *value)
+{
+    return internal::currentdispatch->Uniform2iv (location, count, value);
+}
+inline void Uniform3iv (GLint location, GLsizei count, const GLint *value)
+{
+    return internal::currentdispatch->Uniform3iv (location, count, value);
+}
+inline void Uniform4iv (GLint location, GLsizei count, const GLint *value)
+{
+    return internal::currentdispatch->Uniform4iv (location, count, value);
+}
+inline void UniformMatrix2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return internal::currentdispatch->UniformMatrix2fv (location, count, transpose, value);
+}
+inline void UniformMatrix3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return internal::currentdispatch->UniformMatrix3fv (location, count, transpose, value);
+}
+inline void UniformMatrix4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return internal::currentdispatch->UniformMatrix4fv (location, count, transpose, value);
+}
+inline void ValidateProgram (GLuint program)
+{
+    return internal::currentdispatch->ValidateProgram (program);
+}
+inline void VertexAttrib1d (GLuint index, GLdouble x)
+{
+    return internal::currentdispatch->VertexAttrib1d (index, x);
+}
+inline void VertexAttrib1dv (GLuint index, const GLdouble *v)
+{
+    return internal::currentdispatch->VertexAttrib1dv (index, v);
+}
+inline void VertexAttrib1f (GLuint index, GLfloat x)
+{
+    return internal::currentdispatch->VertexAttrib1f (index, x);
+}
+inline void VertexAttrib1fv (GLuint index, const GLfloat *v)
+{
+    return internal::currentdispatch->VertexAttrib1fv (index, v);
+}
+inline void VertexAttrib1s (GLuint index, GLshort x)
+{
+    return internal::currentdispatch->VertexAttrib1s (index, x);
+}
+inline void VertexAttrib1sv (GLuint index, const GLshort *v)
+{
+    return internal::currentdispatch->VertexAttrib1sv (index, v);
+}
+inline void VertexAttrib2d (GLuint index, GLdouble x, GLdouble y)
+{
+    return internal::currentdispatch->VertexAttrib2d (index, x, y);
+}
+inline void VertexAttrib2dv (GLuint index, const GLdouble *v)
+{
+    return internal::currentdispatch->VertexAttrib2dv (index, v);
+}
+inline void VertexAttrib2f (GLuint index, GLfloat x, GLfloat y)
+{
+    return internal::currentdispatch->VertexAttrib2f (index, x, y);
+}
+inline void VertexAttrib2fv (GLuint index, const GLfloat *v)
+{
+    return internal::currentdispatch->VertexAttrib2fv (index, v);
+}
+inline void VertexAttrib2s (GLuint index, GLshort x, GLshort y)
+{
+    return internal::currentdispatch->VertexAttrib2s (index, x, y);
+}
+inline void VertexAttrib2sv (GLuint index, const GLshort *v)
+{
+    return internal::currentdispatch->VertexAttrib2sv (index, v);
+}
+inline void VertexAttrib3d (GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+    return internal::currentdispatch->VertexAttrib3d (index, x, y, z);
+}
+inline void VertexAttrib3dv (GLuint index, const GLdouble *v)
+{
+    return internal::currentdispatch->VertexAttrib3dv (index, v);
+}
+inline void VertexAttrib3f (GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+    return internal::currentdispatch->VertexAttrib3f (index, x, y, z);
+}
+inline void VertexAttrib3fv (GLuint index, const GLfloat *v)
+{
+    return internal::currentdispatch->VertexAttrib3fv (index, v);
+}
+inline void VertexAttrib3s (GLuint index, GLshort x, GLshort y, GLshort z)
+{
+    return internal::currentdispatch->VertexAttrib3s (index, x, y, z);
+}
+inline void VertexAttrib3sv (GLuint index, const GLshort *v)
+{
+    return internal::currentdispatch->VertexAttrib3sv (index, v);
+}
+inline void VertexAttrib4Nbv (GLuint index, const GLbyte *v)
+{
+    return internal::currentdispatch->VertexAttrib4Nbv (index, v);
+}
+inline void VertexAttrib4Niv (GLuint index, const GLint *v)
+{
+    return internal::currentdispatch->VertexAttrib4Niv (index, v);
+}
+inline void VertexAttrib4Nsv (GLuint index, const GLshort *v)
+{
+    return internal::currentdispatch->VertexAttrib4Nsv (index, v);
+}
+inline void VertexAttrib4Nub (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+{
+    return internal::currentdispatch->VertexAttrib4Nub (index, x, y, z, w);
+}
+inline void VertexAttrib4Nubv (GLuint index, const GLubyte *v)
+{
+    return internal::currentdispatch->VertexAttrib4Nubv (index, v);
+}
+inline void VertexAttrib4Nuiv (GLuint index, const GLuint *v)
+{
+    return internal::currentdispatch->VertexAttrib4Nuiv (index, v);
+}
+inline void VertexAttrib4Nusv (GLuint index, const GLushort *v)
+{
+    return internal::currentdispatch->VertexAttrib4Nusv (index, v);
+}
+inline void VertexAttrib4bv (GLuint index, const GLbyte *v)
+{
+    return internal::currentdispatch->VertexAttrib4bv (index, v);
+}
+inline void VertexAttrib4d (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    return internal::currentdispatch->VertexAttrib4d (index, x, y, z, w);
+}
+inline void VertexAttrib4dv (GLuint index, const GLdouble *v)
+{
+    return internal::currentdispatch->VertexAttrib4dv (index, v);
+}
+inline void VertexAttrib4f (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    return internal::currentdispatch->VertexAttrib4f (index, x, y, z, w);
+}
+inline void VertexAttrib4fv (GLuint index, const GLfloat *v)
+{
+    return internal::currentdispatch->VertexAttrib4fv (index, v);
+}
+inline void VertexAttrib4iv (GLuint index, const GLint *v)
+{
+    return internal::currentdispatch->VertexAttrib4iv (index, v);
+}
+inline void VertexAttrib4s (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+    return internal::currentdispatch->VertexAttrib4s (index, x, y, z, w);
+}
+inline void VertexAttrib4sv (GLuint index, const GLshort *v)
+{
+    return internal::currentdispatch->VertexAttrib4sv (index, v);
+}
+inline void VertexAttrib4ubv (GLuint index, const GLubyte *v)
+{
+    return internal::currentdispatch->VertexAttrib4ubv (index, v);
+}
+inline void VertexAttrib4uiv (GLuint index, const GLuint *v)
+{
+    return internal::currentdispatch->VertexAttrib4uiv (index, v);
+}
+inline void VertexAttrib4usv (GLuint index, const GLushort *v)
+{
+    return internal::currentdispatch->VertexAttrib4usv (index, v);
+}
+inline void VertexAttribPointer (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer)
+{
+    return internal::currentdispatch->VertexAttribPointer (index, size, type, normalized, stride, pointer);
+}
+inline void UniformMatrix2x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return internal::currentdispatch->UniformMatrix2x3fv (location, count, transpose, value);
+}
+inline void UniformMatrix3x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return internal::currentdispatch->UniformMatrix3x2fv (location, count, transpose, value);
+}
+inline void UniformMatrix2x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return internal::currentdispatch->UniformMatrix2x4fv (location, count, transpose, value);
+}
+inline void UniformMatrix4x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return internal::currentdispatch->UniformMatrix4x2fv (location, count, transpose, value);
+}
+inline void UniformMatrix3x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return internal::currentdispatch->UniformMatrix3x4fv (location, count, transpose, value);
+}
+inline void UniformMatrix4x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return internal::currentdispatch->UniformMatrix4x3fv (location, count, transpose, value);
+}
+inline void ColorMaski (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
+{
+    return internal::currentdispatch->ColorMaski (index, r, g, b, a);
+}
+inline void GetBooleani_v (GLenum target, GLuint index, GLboolean *data)
+{
+    return internal::currentdispatch->GetBooleani_v (target, index, data);
+}
+inline void GetIntegeri_v (GLenum target, GLuint index, GLint *data)
+{
+    return internal::currentdispatch->GetIntegeri_v (target, index, data);
+}
+inline void Enablei (GLenum target, GLuint index)
+{
+    return internal::currentdispatch->Enablei (target, index);
+}
+inline void Disablei (GLenum target, GLuint index)
+{
+    return internal::currentdispatch->Disablei (target, index);
+}
+inline GLboolean IsEnabledi (GLenum target, GLuint index)
+{
+    return internal::currentdispatch->IsEnabledi (target, index);
+}
+inline void BeginTransformFeedback (GLenum primitiveMode)
+{
+    return internal::currentdispatch->BeginTransformFeedback (primitiveMode);
+}
+inline void EndTransformFeedback (void)
+{
+    return internal::currentdispatch->EndTransformFeedback ();
+}
+inline void BindBufferRange (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    return internal::currentdispatch->BindBufferRange (target, index, buffer, offset, size);
+}
+inline void BindBufferBase (GLenum target, GLuint index, GLuint buffer)
+{
+    return internal::currentdispatch->BindBufferBase (target, index, buffer);
+}
+inline void TransformFeedbackVaryings (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode)
+{
+    return internal::currentdispatch->TransformFeedbackVaryings (program, count, varyings, bufferMode);
+}
+inline void GetTransformFeedbackVarying (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name)
+{
+    return internal::currentdispatch->GetTransformFeedbackVarying (program, index, bufSize, length, size, type, name);
+}
+inline void ClampColor (GLenum target, GLenum clamp)
+{
+    return internal::currentdispatch->ClampColor (target, clamp);
+}
+inline void BeginConditionalRender (GLuint id, GLenum mode)
+{
+    return internal::currentdispatch->BeginConditionalRender (id, mode);
+}
+inline void EndConditionalRender (void)
+{
+    return internal::currentdispatch->EndConditionalRender ();
+}
+inline void VertexAttribIPointer (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+    return internal::currentdispatch->VertexAttribIPointer (index, size, type, stride, pointer);
+}
+inline void GetVertexAttribIiv (GLuint index, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetVertexAttribIiv (index, pname, params);
+}
+inline void GetVertexAttribIuiv (GLuint index, GLenum pname, GLuint *params)
+{
+    return internal::currentdispatch->GetVertexAttribIuiv (index, pname, params);
+}
+inline void VertexAttribI1i (GLuint index, GLint x)
+{
+    return internal::currentdispatch->VertexAttribI1i (index, x);
+}
+inline void VertexAttribI2i (GLuint index, GLint x, GLint y)
+{
+    return internal::currentdispatch->VertexAttribI2i (index, x, y);
+}
+inline void VertexAttribI3i (GLuint index, GLint x, GLint y, GLint z)
+{
+    return internal::currentdispatch->VertexAttribI3i (index, x, y, z);
+}
+inline void VertexAttribI4i (GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+    return internal::currentdispatch->VertexAttribI4i (index, x, y, z, w);
+}
+inline void VertexAttribI1ui (GLuint index, GLuint x)
+{
+    return internal::currentdispatch->VertexAttribI1ui (index, x);
+}
+inline void VertexAttribI2ui (GLuint index, GLuint x, GLuint y)
+{
+    return internal::currentdispatch->VertexAttribI2ui (index, x, y);
+}
+inline void VertexAttribI3ui (GLuint index, GLuint x, GLuint y, GLuint z)
+{
+    return internal::currentdispatch->VertexAttribI3ui (index, x, y, z);
+}
+inline void VertexAttribI4ui (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+{
+    return internal::currentdispatch->VertexAttribI4ui (index, x, y, z, w);
+}
+inline void VertexAttribI1iv (GLuint index, const GLint *v)
+{
+    return internal::currentdispatch->VertexAttribI1iv (index, v);
+}
+inline void VertexAttribI2iv (GLuint index, const GLint *v)
+{
+    return internal::currentdispatch->VertexAttribI2iv (index, v);
+}
+inline void VertexAttribI3iv (GLuint index, const GLint *v)
+{
+    return internal::currentdispatch->VertexAttribI3iv (index, v);
+}
+inline void VertexAttribI4iv (GLuint index, const GLint *v)
+{
+    return internal::currentdispatch->VertexAttribI4iv (index, v);
+}
+inline void VertexAttribI1uiv (GLuint index, const GLuint *v)
+{
+    return internal::currentdispatch->VertexAttribI1uiv (index, v);
+}
+inline void VertexAttribI2uiv (GLuint index, const GLuint *v)
+{
+    return internal::currentdispatch->VertexAttribI2uiv (index, v);
+}
+inline void VertexAttribI3uiv (GLuint index, const GLuint *v)
+{
+    return internal::currentdispatch->VertexAttribI3uiv (index, v);
+}
+inline void VertexAttribI4uiv (GLuint index, const GLuint *v)
+{
+    return internal::currentdispatch->VertexAttribI4uiv (index, v);
+}
+inline void VertexAttribI4bv (GLuint index, const GLbyte *v)
+{
+    return internal::currentdispatch->VertexAttribI4bv (index, v);
+}
+inline void VertexAttribI4sv (GLuint index, const GLshort *v)
+{
+    return internal::currentdispatch->VertexAttribI4sv (index, v);
+}
+inline void VertexAttribI4ubv (GLuint index, const GLubyte *v)
+{
+    return internal::currentdispatch->VertexAttribI4ubv (index, v);
+}
+inline void VertexAttribI4usv (GLuint index, const GLushort *v)
+{
+    return internal::currentdispatch->VertexAttribI4usv (index, v);
+}
+inline void GetUniformuiv (GLuint program, GLint location, GLuint *params)
+{
+    return internal::currentdispatch->GetUniformuiv (program, location, params);
+}
+inline void BindFragDataLocation (GLuint program, GLuint color, const GLchar *name)
+{
+    return internal::currentdispatch->BindFragDataLocation (program, color, name);
+}
+inline GLint GetFragDataLocation (GLuint program, const GLchar *name)
+{
+    return internal::currentdispatch->GetFragDataLocation (program, name);
+}
+inline void Uniform1ui (GLint location, GLuint v0)
+{
+    return internal::currentdispatch->Uniform1ui (location, v0);
+}
+inline void Uniform2ui (GLint location, GLuint v0, GLuint v1)
+{
+    return internal::currentdispatch->Uniform2ui (location, v0, v1);
+}
+inline void Uniform3ui (GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+    return internal::currentdispatch->Uniform3ui (location, v0, v1, v2);
+}
+inline void Uniform4ui (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+    return internal::currentdispatch->Uniform4ui (location, v0, v1, v2, v3);
+}
+inline void Uniform1uiv (GLint location, GLsizei count, const GLuint *value)
+{
+    return internal::currentdispatch->Uniform1uiv (location, count, value);
+}
+inline void Uniform2uiv (GLint location, GLsizei count, const GLuint *value)
+{
+    return internal::currentdispatch->Uniform2uiv (location, count, value);
+}
+inline void Uniform3uiv (GLint location, GLsizei count, const GLuint *value)
+{
+    return internal::currentdispatch->Uniform3uiv (location, count, value);
+}
+inline void Uniform4uiv (GLint location, GLsizei count, const GLuint *value)
+{
+    return internal::currentdispatch->Uniform4uiv (location, count, value);
+}
+inline void TexParameterIiv (GLenum target, GLenum pname, const GLint *params)
+{
+    return internal::currentdispatch->TexParameterIiv (target, pname, params);
+}
+inline void TexParameterIuiv (GLenum target, GLenum pname, const GLuint *params)
+{
+    return internal::currentdispatch->TexParameterIuiv (target, pname, params);
+}
+inline void GetTexParameterIiv (GLenum target, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetTexParameterIiv (target, pname, params);
+}
+inline void GetTexParameterIuiv (GLenum target, GLenum pname, GLuint *params)
+{
+    return internal::currentdispatch->GetTexParameterIuiv (target, pname, params);
+}
+inline void ClearBufferiv (GLenum buffer, GLint drawbuffer, const GLint *value)
+{
+    return internal::currentdispatch->ClearBufferiv (buffer, drawbuffer, value);
+}
+inline void ClearBufferuiv (GLenum buffer, GLint drawbuffer, const GLuint *value)
+{
+    return internal::currentdispatch->ClearBufferuiv (buffer, drawbuffer, value);
+}
+inline void ClearBufferfv (GLenum buffer, GLint drawbuffer, const GLfloat *value)
+{
+    return internal::currentdispatch->ClearBufferfv (buffer, drawbuffer, value);
+}
+inline void ClearBufferfi (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
+{
+    return internal::currentdispatch->ClearBufferfi (buffer, drawbuffer, depth, stencil);
+}
+inline const GLubyte * GetStringi (GLenum name, GLuint index)
+{
+    return internal::currentdispatch->GetStringi (name, index);
+}
+inline GLboolean IsRenderbuffer (GLuint renderbuffer)
+{
+    return internal::currentdispatch->IsRenderbuffer (renderbuffer);
+}
+inline void BindRenderbuffer (GLenum target, GLuint renderbuffer)
+{
+    return internal::currentdispatch->BindRenderbuffer (target, renderbuffer);
+}
+inline void DeleteRenderbuffers (GLsizei n, const GLuint *renderbuffers)
+{
+    return internal::currentdispatch->DeleteRenderbuffers (n, renderbuffers);
+}
+inline void GenRenderbuffers (GLsizei n, GLuint *renderbuffers)
+{
+    return internal::currentdispatch->GenRenderbuffers (n, renderbuffers);
+}
+inline void RenderbufferStorage (GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    return internal::currentdispatch->RenderbufferStorage (target, internalformat, width, height);
+}
+inline void GetRenderbufferParameteriv (GLenum target, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetRenderbufferParameteriv (target, pname, params);
+}
+inline GLboolean IsFramebuffer (GLuint framebuffer)
+{
+    return internal::currentdispatch->IsFramebuffer (framebuffer);
+}
+inline void BindFramebuffer (GLenum target, GLuint framebuffer)
+{
+    return internal::currentdispatch->BindFramebuffer (target, framebuffer);
+}
+inline void DeleteFramebuffers (GLsizei n, const GLuint *framebuffers)
+{
+    return internal::currentdispatch->DeleteFramebuffers (n, framebuffers);
+}
+inline void GenFramebuffers (GLsizei n, GLuint *framebuffers)
+{
+    return internal::currentdispatch->GenFramebuffers (n, framebuffers);
+}
+inline GLenum CheckFramebufferStatus (GLenum target)
+{
+    return internal::currentdispatch->CheckFramebufferStatus (target);
+}
+inline void FramebufferTexture1D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    return internal::currentdispatch->FramebufferTexture1D (target, attachment, textarget, texture, level);
+}
+inline void FramebufferTexture2D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    return internal::currentdispatch->FramebufferTexture2D (target, attachment, textarget, texture, level);
+}
+inline void FramebufferTexture3D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
+{
+    return internal::currentdispatch->FramebufferTexture3D (target, attachment, textarget, texture, level, zoffset);
+}
+inline void FramebufferRenderbuffer (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+    return internal::currentdispatch->FramebufferRenderbuffer (target, attachment, renderbuffertarget, renderbuffer);
+}
+inline void GetFramebufferAttachmentParameteriv (GLenum target, GLenum attachment, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetFramebufferAttachmentParameteriv (target, attachment, pname, params);
+}
+inline void GenerateMipmap (GLenum target)
+{
+    return internal::currentdispatch->GenerateMipmap (target);
+}
+inline void BlitFramebuffer (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+    return internal::currentdispatch->BlitFramebuffer (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+inline void RenderbufferStorageMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    return internal::currentdispatch->RenderbufferStorageMultisample (target, samples, internalformat, width, height);
+}
+inline void FramebufferTextureLayer (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+    return internal::currentdispatch->FramebufferTextureLayer (target, attachment, texture, level, layer);
+}
+inline void * MapBufferRange (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    return internal::currentdispatch->MapBufferRange (target, offset, length, access);
+}
+inline void FlushMappedBufferRange (GLenum target, GLintptr offset, GLsizeiptr length)
+{
+    return internal::currentdispatch->FlushMappedBufferRange (target, offset, length);
+}
+inline void BindVertexArray (GLuint array)
+{
+    return internal::currentdispatch->BindVertexArray (array);
+}
+inline void DeleteVertexArrays (GLsizei n, const GLuint *arrays)
+{
+    return internal::currentdispatch->DeleteVertexArrays (n, arrays);
+}
+inline void GenVertexArrays (GLsizei n, GLuint *arrays)
+{
+    return internal::currentdispatch->GenVertexArrays (n, arrays);
+}
+inline GLboolean IsVertexArray (GLuint array)
+{
+    return internal::currentdispatch->IsVertexArray (array);
+}
+inline void DrawArraysInstanced (GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+{
+    return internal::currentdispatch->DrawArraysInstanced (mode, first, count, instancecount);
+}
+inline void DrawElementsInstanced (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount)
+{
+    return internal::currentdispatch->DrawElementsInstanced (mode, count, type, indices, instancecount);
+}
+inline void TexBuffer (GLenum target, GLenum internalformat, GLuint buffer)
+{
+    return internal::currentdispatch->TexBuffer (target, internalformat, buffer);
+}
+inline void PrimitiveRestartIndex (GLuint index)
+{
+    return internal::currentdispatch->PrimitiveRestartIndex (index);
+}
+inline void CopyBufferSubData (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+    return internal::currentdispatch->CopyBufferSubData (readTarget, writeTarget, readOffset, writeOffset, size);
+}
+inline void GetUniformIndices (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices)
+{
+    return internal::currentdispatch->GetUniformIndices (program, uniformCount, uniformNames, uniformIndices);
+}
+inline void GetActiveUniformsiv (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetActiveUniformsiv (program, uniformCount, uniformIndices, pname, params);
+}
+inline void GetActiveUniformName (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName)
+{
+    return internal::currentdispatch->GetActiveUniformName (program, uniformIndex, bufSize, length, uniformName);
+}
+inline GLuint GetUniformBlockIndex (GLuint program, const GLchar *uniformBlockName)
+{
+    return internal::currentdispatch->GetUniformBlockIndex (program, uniformBlockName);
+}
+inline void GetActiveUniformBlockiv (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetActiveUniformBlockiv (program, uniformBlockIndex, pname, params);
+}
+inline void GetActiveUniformBlockName (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName)
+{
+    return internal::currentdispatch->GetActiveUniformBlockName (program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+inline void UniformBlockBinding (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding)
+{
+    return internal::currentdispatch->UniformBlockBinding (program, uniformBlockIndex, uniformBlockBinding);
+}
+inline void DrawElementsBaseVertex (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+{
+    return internal::currentdispatch->DrawElementsBaseVertex (mode, count, type, indices, basevertex);
+}
+inline void DrawRangeElementsBaseVertex (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+{
+    return internal::currentdispatch->DrawRangeElementsBaseVertex (mode, start, end, count, type, indices, basevertex);
+}
+inline void DrawElementsInstancedBaseVertex (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex)
+{
+    return internal::currentdispatch->DrawElementsInstancedBaseVertex (mode, count, type, indices, instancecount, basevertex);
+}
+inline void MultiDrawElementsBaseVertex (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex)
+{
+    return internal::currentdispatch->MultiDrawElementsBaseVertex (mode, count, type, indices, drawcount, basevertex);
+}
+inline void ProvokingVertex (GLenum mode)
+{
+    return internal::currentdispatch->ProvokingVertex (mode);
+}
+inline GLsync FenceSync (GLenum condition, GLbitfield flags)
+{
+    return internal::currentdispatch->FenceSync (condition, flags);
+}
+inline GLboolean IsSync (GLsync sync)
+{
+    return internal::currentdispatch->IsSync (sync);
+}
+inline void DeleteSync (GLsync sync)
+{
+    return internal::currentdispatch->DeleteSync (sync);
+}
+inline GLenum ClientWaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    return internal::currentdispatch->ClientWaitSync (sync, flags, timeout);
+}
+inline void WaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    return internal::currentdispatch->WaitSync (sync, flags, timeout);
+}
+inline void GetInteger64v (GLenum pname, GLint64 *data)
+{
+    return internal::currentdispatch->GetInteger64v (pname, data);
+}
+inline void GetSynciv (GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values)
+{
+    return internal::currentdispatch->GetSynciv (sync, pname, bufSize, length, values);
+}
+inline void GetInteger64i_v (GLenum target, GLuint index, GLint64 *data)
+{
+    return internal::currentdispatch->GetInteger64i_v (target, index, data);
+}
+inline void GetBufferParameteri64v (GLenum target, GLenum pname, GLint64 *params)
+{
+    return internal::currentdispatch->GetBufferParameteri64v (target, pname, params);
+}
+inline void FramebufferTexture (GLenum target, GLenum attachment, GLuint texture, GLint level)
+{
+    return internal::currentdispatch->FramebufferTexture (target, attachment, texture, level);
+}
+inline void TexImage2DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+    return internal::currentdispatch->TexImage2DMultisample (target, samples, internalformat, width, height, fixedsamplelocations);
+}
+inline void TexImage3DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+    return internal::currentdispatch->TexImage3DMultisample (target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+inline void GetMultisamplefv (GLenum pname, GLuint index, GLfloat *val)
+{
+    return internal::currentdispatch->GetMultisamplefv (pname, index, val);
+}
+inline void SampleMaski (GLuint maskNumber, GLbitfield mask)
+{
+    return internal::currentdispatch->SampleMaski (maskNumber, mask);
+}
+inline void BindFragDataLocationIndexed (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name)
+{
+    return internal::currentdispatch->BindFragDataLocationIndexed (program, colorNumber, index, name);
+}
+inline GLint GetFragDataIndex (GLuint program, const GLchar *name)
+{
+    return internal::currentdispatch->GetFragDataIndex (program, name);
+}
+inline void GenSamplers (GLsizei count, GLuint *samplers)
+{
+    return internal::currentdispatch->GenSamplers (count, samplers);
+}
+inline void DeleteSamplers (GLsizei count, const GLuint *samplers)
+{
+    return internal::currentdispatch->DeleteSamplers (count, samplers);
+}
+inline GLboolean IsSampler (GLuint sampler)
+{
+    return internal::currentdispatch->IsSampler (sampler);
+}
+inline void BindSampler (GLuint unit, GLuint sampler)
+{
+    return internal::currentdispatch->BindSampler (unit, sampler);
+}
+inline void SamplerParameteri (GLuint sampler, GLenum pname, GLint param)
+{
+    return internal::currentdispatch->SamplerParameteri (sampler, pname, param);
+}
+inline void SamplerParameteriv (GLuint sampler, GLenum pname, const GLint *param)
+{
+    return internal::currentdispatch->SamplerParameteriv (sampler, pname, param);
+}
+inline void SamplerParameterf (GLuint sampler, GLenum pname, GLfloat param)
+{
+    return internal::currentdispatch->SamplerParameterf (sampler, pname, param);
+}
+inline void SamplerParameterfv (GLuint sampler, GLenum pname, const GLfloat *param)
+{
+    return internal::currentdispatch->SamplerParameterfv (sampler, pname, param);
+}
+inline void SamplerParameterIiv (GLuint sampler, GLenum pname, const GLint *param)
+{
+    return internal::currentdispatch->SamplerParameterIiv (sampler, pname, param);
+}
+inline void SamplerParameterIuiv (GLuint sampler, GLenum pname, const GLuint *param)
+{
+    return internal::currentdispatch->SamplerParameterIuiv (sampler, pname, param);
+}
+inline void GetSamplerParameteriv (GLuint sampler, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetSamplerParameteriv (sampler, pname, params);
+}
+inline void GetSamplerParameterIiv (GLuint sampler, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetSamplerParameterIiv (sampler, pname, params);
+}
+inline void GetSamplerParameterfv (GLuint sampler, GLenum pname, GLfloat *params)
+{
+    return internal::currentdispatch->GetSamplerParameterfv (sampler, pname, params);
+}
+inline void GetSamplerParameterIuiv (GLuint sampler, GLenum pname, GLuint *params)
+{
+    return internal::currentdispatch->GetSamplerParameterIuiv (sampler, pname, params);
+}
+inline void QueryCounter (GLuint id, GLenum target)
+{
+    return internal::currentdispatch->QueryCounter (id, target);
+}
+inline void GetQueryObjecti64v (GLuint id, GLenum pname, GLint64 *params)
+{
+    return internal::currentdispatch->GetQueryObjecti64v (id, pname, params);
+}
+inline void GetQueryObjectui64v (GLuint id, GLenum pname, GLuint64 *params)
+{
+    return internal::currentdispatch->GetQueryObjectui64v (id, pname, params);
+}
+inline void VertexAttribDivisor (GLuint index, GLuint divisor)
+{
+    return internal::currentdispatch->VertexAttribDivisor (index, divisor);
+}
+inline void VertexAttribP1ui (GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    return internal::currentdispatch->VertexAttribP1ui (index, type, normalized, value);
+}
+inline void VertexAttribP1uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    return internal::currentdispatch->VertexAttribP1uiv (index, type, normalized, value);
+}
+inline void VertexAttribP2ui (GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    return internal::currentdispatch->VertexAttribP2ui (index, type, normalized, value);
+}
+inline void VertexAttribP2uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    return internal::currentdispatch->VertexAttribP2uiv (index, type, normalized, value);
+}
+inline void VertexAttribP3ui (GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    return internal::currentdispatch->VertexAttribP3ui (index, type, normalized, value);
+}
+inline void VertexAttribP3uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    return internal::currentdispatch->VertexAttribP3uiv (index, type, normalized, value);
+}
+inline void VertexAttribP4ui (GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    return internal::currentdispatch->VertexAttribP4ui (index, type, normalized, value);
+}
+inline void VertexAttribP4uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    return internal::currentdispatch->VertexAttribP4uiv (index, type, normalized, value);
+}
+inline void MinSampleShading (GLfloat value)
+{
+    return internal::currentdispatch->MinSampleShading (value);
+}
+inline void BlendEquationi (GLuint buf, GLenum mode)
+{
+    return internal::currentdispatch->BlendEquationi (buf, mode);
+}
+inline void BlendEquationSeparatei (GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+    return internal::currentdispatch->BlendEquationSeparatei (buf, modeRGB, modeAlpha);
+}
+inline void BlendFunci (GLuint buf, GLenum src, GLenum dst)
+{
+    return internal::currentdispatch->BlendFunci (buf, src, dst);
+}
+inline void BlendFuncSeparatei (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+    return internal::currentdispatch->BlendFuncSeparatei (buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+inline void DrawArraysIndirect (GLenum mode, const void *indirect)
+{
+    return internal::currentdispatch->DrawArraysIndirect (mode, indirect);
+}
+inline void DrawElementsIndirect (GLenum mode, GLenum type, const void *indirect)
+{
+    return internal::currentdispatch->DrawElementsIndirect (mode, type, indirect);
+}
+inline void Uniform1d (GLint location, GLdouble x)
+{
+    return internal::currentdispatch->Uniform1d (location, x);
+}
+inline void Uniform2d (GLint location, GLdouble x, GLdouble y)
+{
+    return internal::currentdispatch->Uniform2d (location, x, y);
+}
+inline void Uniform3d (GLint location, GLdouble x, GLdouble y, GLdouble z)
+{
+    return internal::currentdispatch->Uniform3d (location, x, y, z);
+}
+inline void Uniform4d (GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    return internal::currentdispatch->Uniform4d (location, x, y, z, w);
+}
+inline void Uniform1dv (GLint location, GLsizei count, const GLdouble *value)
+{
+    return internal::currentdispatch->Uniform1dv (location, count, value);
+}
+inline void Uniform2dv (GLint location, GLsizei count, const GLdouble *value)
+{
+    return internal::currentdispatch->Uniform2dv (location, count, value);
+}
+inline void Uniform3dv (GLint location, GLsizei count, const GLdouble *value)
+{
+    return internal::currentdispatch->Uniform3dv (location, count, value);
+}
+inline void Uniform4dv (GLint location, GLsizei count, const GLdouble *value)
+{
+    return internal::currentdispatch->Uniform4dv (location, count, value);
+}
+inline void UniformMatrix2dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return internal::currentdispatch->UniformMatrix2dv (location, count, transpose, value);
+}
+inline void UniformMatrix3dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return internal::currentdispatch->UniformMatrix3dv (location, count, transpose, value);
+}
+inline void UniformMatrix4dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return internal::currentdispatch->UniformMatrix4dv (location, count, transpose, value);
+}
+inline void UniformMatrix2x3dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return internal::currentdispatch->UniformMatrix2x3dv (location, count, transpose, value);
+}
+inline void UniformMatrix2x4dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return internal::currentdispatch->UniformMatrix2x4dv (location, count, transpose, value);
+}
+inline void UniformMatrix3x2dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return internal::currentdispatch->UniformMatrix3x2dv (location, count, transpose, value);
+}
+inline void UniformMatrix3x4dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return internal::currentdispatch->UniformMatrix3x4dv (location, count, transpose, value);
+}
+inline void UniformMatrix4x2dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return internal::currentdispatch->UniformMatrix4x2dv (location, count, transpose, value);
+}
+inline void UniformMatrix4x3dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return internal::currentdispatch->UniformMatrix4x3dv (location, count, transpose, value);
+}
+inline void GetUniformdv (GLuint program, GLint location, GLdouble *params)
+{
+    return internal::currentdispatch->GetUniformdv (program, location, params);
+}
+inline GLint GetSubroutineUniformLocation (GLuint program, GLenum shadertype, const GLchar *name)
+{
+    return internal::currentdispatch->GetSubroutineUniformLocation (program, shadertype, name);
+}
+inline GLuint GetSubroutineIndex (GLuint program, GLenum shadertype, const GLchar *name)
+{
+    return internal::currentdispatch->GetSubroutineIndex (program, shadertype, name);
+}
+inline void GetActiveSubroutineUniformiv (GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values)
+{
+    return internal::currentdispatch->GetActiveSubroutineUniformiv (program, shadertype, index, pname, values);
+}
+inline void GetActiveSubroutineUniformName (GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name)
+{
+    return internal::currentdispatch->GetActiveSubroutineUniformName (program, shadertype, index, bufsize, length, name);
+}
+inline void GetActiveSubroutineName (GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name)
+{
+    return internal::currentdispatch->GetActiveSubroutineName (program, shadertype, index, bufsize, length, name);
+}
+inline void UniformSubroutinesuiv (GLenum shadertype, GLsizei count, const GLuint *indices)
+{
+    return internal::currentdispatch->UniformSubroutinesuiv (shadertype, count, indices);
+}
+inline void GetUniformSubroutineuiv (GLenum shadertype, GLint location, GLuint *params)
+{
+    return internal::currentdispatch->GetUniformSubroutineuiv (shadertype, location, params);
+}
+inline void GetProgramStageiv (GLuint program, GLenum shadertype, GLenum pname, GLint *values)
+{
+    return internal::currentdispatch->GetProgramStageiv (program, shadertype, pname, values);
+}
+inline void PatchParameteri (GLenum pname, GLint value)
+{
+    return internal::currentdispatch->PatchParameteri (pname, value);
+}
+inline void PatchParameterfv (GLenum pname, const GLfloat *values)
+{
+    return internal::currentdispatch->PatchParameterfv (pname, values);
+}
+inline void BindTransformFeedback (GLenum target, GLuint id)
+{
+    return internal::currentdispatch->BindTransformFeedback (target, id);
+}
+inline void DeleteTransformFeedbacks (GLsizei n, const GLuint *ids)
+{
+    return internal::currentdispatch->DeleteTransformFeedbacks (n, ids);
+}
+inline void GenTransformFeedbacks (GLsizei n, GLuint *ids)
+{
+    return internal::currentdispatch->GenTransformFeedbacks (n, ids);
+}
+inline GLboolean IsTransformFeedback (GLuint id)
+{
+    return internal::currentdispatch->IsTransformFeedback (id);
+}
+inline void PauseTransformFeedback (void)
+{
+    return internal::currentdispatch->PauseTransformFeedback ();
+}
+inline void ResumeTransformFeedback (void)
+{
+    return internal::currentdispatch->ResumeTransformFeedback ();
+}
+inline void DrawTransformFeedback (GLenum mode, GLuint id)
+{
+    return internal::currentdispatch->DrawTransformFeedback (mode, id);
+}
+inline void DrawTransformFeedbackStream (GLenum mode, GLuint id, GLuint stream)
+{
+    return internal::currentdispatch->DrawTransformFeedbackStream (mode, id, stream);
+}
+inline void BeginQueryIndexed (GLenum target, GLuint index, GLuint id)
+{
+    return internal::currentdispatch->BeginQueryIndexed (target, index, id);
+}
+inline void EndQueryIndexed (GLenum target, GLuint index)
+{
+    return internal::currentdispatch->EndQueryIndexed (target, index);
+}
+inline void GetQueryIndexediv (GLenum target, GLuint index, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetQueryIndexediv (target, index, pname, params);
+}
+inline void ReleaseShaderCompiler (void)
+{
+    return internal::currentdispatch->ReleaseShaderCompiler ();
+}
+inline void ShaderBinary (GLsizei count, const GLuint *shaders, GLenum binaryformat, const void *binary, GLsizei length)
+{
+    return internal::currentdispatch->ShaderBinary (count, shaders, binaryformat, binary, length);
+}
+inline void GetShaderPrecisionFormat (GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision)
+{
+    return internal::currentdispatch->GetShaderPrecisionFormat (shadertype, precisiontype, range, precision);
+}
+inline void DepthRangef (GLfloat n, GLfloat f)
+{
+    return internal::currentdispatch->DepthRangef (n, f);
+}
+inline void ClearDepthf (GLfloat d)
+{
+    return internal::currentdispatch->ClearDepthf (d);
+}
+inline void GetProgramBinary (GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary)
+{
+    return internal::currentdispatch->GetProgramBinary (program, bufSize, length, binaryFormat, binary);
+}
+inline void ProgramBinary (GLuint program, GLenum binaryFormat, const void *binary, GLsizei length)
+{
+    return internal::currentdispatch->ProgramBinary (program, binaryFormat, binary, length);
+}
+inline void ProgramParameteri (GLuint program, GLenum pname, GLint value)
+{
+    return internal::currentdispatch->ProgramParameteri (program, pname, value);
+}
+inline void UseProgramStages (GLuint pipeline, GLbitfield stages, GLuint program)
+{
+    return internal::currentdispatch->UseProgramStages (pipeline, stages, program);
+}
+inline void ActiveShaderProgram (GLuint pipeline, GLuint program)
+{
+    return internal::currentdispatch->ActiveShaderProgram (pipeline, program);
+}
+inline GLuint CreateShaderProgramv (GLenum type, GLsizei count, const GLchar *const*strings)
+{
+    return internal::currentdispatch->CreateShaderProgramv (type, count, strings);
+}
+inline void BindProgramPipeline (GLuint pipeline)
+{
+    return internal::currentdispatch->BindProgramPipeline (pipeline);
+}
+inline void DeleteProgramPipelines (GLsizei n, const GLuint *pipelines)
+{
+    return internal::currentdispatch->DeleteProgramPipelines (n, pipelines);
+}
+inline void GenProgramPipelines (GLsizei n, GLuint *pipelines)
+{
+    return internal::currentdispatch->GenProgramPipelines (n, pipelines);
+}
+inline GLboolean IsProgramPipeline (GLuint pipeline)
+{
+    return internal::currentdispatch->IsProgramPipeline (pipeline);
+}
+inline void GetProgramPipelineiv (GLuint pipeline, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetProgramPipelineiv (pipeline, pname, params);
+}
+inline void ProgramUniform1i (GLuint program, GLint location, GLint v0)
+{
+    return internal::currentdispatch->ProgramUniform1i (program, location, v0);
+}
+inline void ProgramUniform1iv (GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+    return internal::currentdispatch->ProgramUniform1iv (program, location, count, value);
+}
+inline void ProgramUniform1f (GLuint program, GLint location, GLfloat v0)
+{
+    return internal::currentdispatch->ProgramUniform1f (program, location, v0);
+}
+inline void ProgramUniform1fv (GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+    return internal::currentdispatch->ProgramUniform1fv (program, location, count, value);
+}
+inline void ProgramUniform1d (GLuint program, GLint location, GLdouble v0)
+{
+    return internal::currentdispatch->ProgramUniform1d (program, location, v0);
+}
+inline void ProgramUniform1dv (GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+    return internal::currentdispatch->ProgramUniform1dv (program, location, count, value);
+}
+inline void ProgramUniform1ui (GLuint program, GLint location, GLuint v0)
+{
+    return internal::currentdispatch->ProgramUniform1ui (program, location, v0);
+}
+inline void ProgramUniform1uiv (GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+    return internal::currentdispatch->ProgramUniform1uiv (program, location, count, value);
+}
+inline void ProgramUniform2i (GLuint program, GLint location, GLint v0, GLint v1)
+{
+    return internal::currentdispatch->ProgramUniform2i (program, location, v0, v1);
+}
+inline void ProgramUniform2iv (GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+    return internal::currentdispatch->ProgramUniform2iv (program, location, count, value);
+}
+inline void ProgramUniform2f (GLuint program, GLint location, GLfloat v0, GLfloat v1)
+{
+    return internal::currentdispatch->ProgramUniform2f (program, location, v0, v1);
+}
+inline void ProgramUniform2fv (GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+    return internal::currentdispatch->ProgramUniform2fv (program, location, count, value);
+}
+inline void ProgramUniform2d (GLuint program, GLint location, GLdouble v0, GLdouble v1)
+{
+    return internal::currentdispatch->ProgramUniform2d (program, location, v0, v1);
+}
+inline void ProgramUniform2dv (GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+    return internal::currentdispatch->ProgramUniform2dv (program, location, count, value);
+}
+inline void ProgramUniform2ui (GLuint program, GLint location, GLuint v0, GLuint v1)
+{
+    return internal::currentdispatch->ProgramUniform2ui (program, location, v0, v1);
+}
+inline void ProgramUniform2uiv (GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+    return internal::currentdispatch->ProgramUniform2uiv (program, location, count, value);
+}
+inline void ProgramUniform3i (GLuint program, GLint location, GLint v0, GLint v1, GLint v2)
+{
+    return internal::currentdispatch->ProgramUniform3i (program, location, v0, v1, v2);
+}
+inline void ProgramUniform3iv (GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+    return internal::currentdispatch->ProgramUniform3iv (program, location, count, value);
+}
+inline void ProgramUniform3f (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    return internal::currentdispatch->ProgramUniform3f (program, location, v0, v1, v2);
+}
+inline void ProgramUniform3fv (GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+    return internal::currentdispatch->ProgramUniform3fv (program, location, count, value);
+}
+inline void ProgramUniform3d (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2)
+{
+    return internal::currentdispatch->ProgramUniform3d (program, location, v0, v1, v2);
+}
+inline void ProgramUniform3dv (GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+    return internal::currentdispatch->ProgramUniform3dv (program, location, count, value);
+}
+inline void ProgramUniform3ui (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+    return internal::currentdispatch->ProgramUniform3ui (program, location, v0, v1, v2);
+}
+inline void ProgramUniform3uiv (GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+    return internal::currentdispatch->ProgramUniform3uiv (program, location, count, value);
+}
+inline void ProgramUniform4i (GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    return internal::currentdispatch->ProgramUniform4i (program, location, v0, v1, v2, v3);
+}
+inline void ProgramUniform4iv (GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+    return internal::currentdispatch->ProgramUniform4iv (program, location, count, value);
+}
+inline void ProgramUniform4f (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+    return internal::currentdispatch->ProgramUniform4f (program, location, v0, v1, v2, v3);
+}
+inline void ProgramUniform4fv (GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+    return internal::currentdispatch->ProgramUniform4fv (program, location, count, value);
+}
+inline void ProgramUniform4d (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3)
+{
+    return internal::currentdispatch->ProgramUniform4d (program, location, v0, v1, v2, v3);
+}
+inline void ProgramUniform4dv (GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+    return internal::currentdispatch->ProgramUniform4dv (program, location, count, value);
+}
+inline void ProgramUniform4ui (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+    return internal::currentdispatch->ProgramUniform4ui (program, location, v0, v1, v2, v3);
+}
+inline void ProgramUniform4uiv (GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+    return internal::currentdispatch->ProgramUniform4uiv (program, location, count, value);
+}
+inline void ProgramUniformMatrix2fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return internal::currentdispatch->ProgramUniformMatrix2fv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix3fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return internal::currentdispatch->ProgramUniformMatrix3fv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix4fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return internal::currentdispatch->ProgramUniformMatrix4fv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix2dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return internal::currentdispatch->ProgramUniformMatrix2dv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix3dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return internal::currentdispatch->ProgramUniformMatrix3dv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix4dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return internal::currentdispatch->ProgramUniformMatrix4dv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix2x3fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return internal::currentdispatch->ProgramUniformMatrix2x3fv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix3x2fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return internal::currentdispatch->ProgramUniformMatrix3x2fv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix2x4fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return internal::currentdispatch->ProgramUniformMatrix2x4fv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix4x2fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return internal::currentdispatch->ProgramUniformMatrix4x2fv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix3x4fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return internal::currentdispatch->ProgramUniformMatrix3x4fv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix4x3fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return internal::currentdispatch->ProgramUniformMatrix4x3fv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix2x3dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return internal::currentdispatch->ProgramUniformMatrix2x3dv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix3x2dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return internal::currentdispatch->ProgramUniformMatrix3x2dv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix2x4dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return internal::currentdispatch->ProgramUniformMatrix2x4dv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix4x2dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return internal::currentdispatch->ProgramUniformMatrix4x2dv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix3x4dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return internal::currentdispatch->ProgramUniformMatrix3x4dv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix4x3dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return internal::currentdispatch->ProgramUniformMatrix4x3dv (program, location, count, transpose, value);
+}
+inline void ValidateProgramPipeline (GLuint pipeline)
+{
+    return internal::currentdispatch->ValidateProgramPipeline (pipeline);
+}
+inline void GetProgramPipelineInfoLog (GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    return internal::currentdispatch->GetProgramPipelineInfoLog (pipeline, bufSize, length, infoLog);
+}
+inline void VertexAttribL1d (GLuint index, GLdouble x)
+{
+    return internal::currentdispatch->VertexAttribL1d (index, x);
+}
+inline void VertexAttribL2d (GLuint index, GLdouble x, GLdouble y)
+{
+    return internal::currentdispatch->VertexAttribL2d (index, x, y);
+}
+inline void VertexAttribL3d (GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+    return internal::currentdispatch->VertexAttribL3d (index, x, y, z);
+}
+inline void VertexAttribL4d (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    return internal::currentdispatch->VertexAttribL4d (index, x, y, z, w);
+}
+inline void VertexAttribL1dv (GLuint index, const GLdouble *v)
+{
+    return internal::currentdispatch->VertexAttribL1dv (index, v);
+}
+inline void VertexAttribL2dv (GLuint index, const GLdouble *v)
+{
+    return internal::currentdispatch->VertexAttribL2dv (index, v);
+}
+inline void VertexAttribL3dv (GLuint index, const GLdouble *v)
+{
+    return internal::currentdispatch->VertexAttribL3dv (index, v);
+}
+inline void VertexAttribL4dv (GLuint index, const GLdouble *v)
+{
+    return internal::currentdispatch->VertexAttribL4dv (index, v);
+}
+inline void VertexAttribLPointer (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+    return internal::currentdispatch->VertexAttribLPointer (index, size, type, stride, pointer);
+}
+inline void GetVertexAttribLdv (GLuint index, GLenum pname, GLdouble *params)
+{
+    return internal::currentdispatch->GetVertexAttribLdv (index, pname, params);
+}
+inline void ViewportArrayv (GLuint first, GLsizei count, const GLfloat *v)
+{
+    return internal::currentdispatch->ViewportArrayv (first, count, v);
+}
+inline void ViewportIndexedf (GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h)
+{
+    return internal::currentdispatch->ViewportIndexedf (index, x, y, w, h);
+}
+inline void ViewportIndexedfv (GLuint index, const GLfloat *v)
+{
+    return internal::currentdispatch->ViewportIndexedfv (index, v);
+}
+inline void ScissorArrayv (GLuint first, GLsizei count, const GLint *v)
+{
+    return internal::currentdispatch->ScissorArrayv (first, count, v);
+}
+inline void ScissorIndexed (GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height)
+{
+    return internal::currentdispatch->ScissorIndexed (index, left, bottom, width, height);
+}
+inline void ScissorIndexedv (GLuint index, const GLint *v)
+{
+    return internal::currentdispatch->ScissorIndexedv (index, v);
+}
+inline void DepthRangeArrayv (GLuint first, GLsizei count, const GLdouble *v)
+{
+    return internal::currentdispatch->DepthRangeArrayv (first, count, v);
+}
+inline void DepthRangeIndexed (GLuint index, GLdouble n, GLdouble f)
+{
+    return internal::currentdispatch->DepthRangeIndexed (index, n, f);
+}
+inline void GetFloati_v (GLenum target, GLuint index, GLfloat *data)
+{
+    return internal::currentdispatch->GetFloati_v (target, index, data);
+}
+inline void GetDoublei_v (GLenum target, GLuint index, GLdouble *data)
+{
+    return internal::currentdispatch->GetDoublei_v (target, index, data);
+}
+inline void DrawArraysInstancedBaseInstance (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance)
+{
+    return internal::currentdispatch->DrawArraysInstancedBaseInstance (mode, first, count, instancecount, baseinstance);
+}
+inline void DrawElementsInstancedBaseInstance (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance)
+{
+    return internal::currentdispatch->DrawElementsInstancedBaseInstance (mode, count, type, indices, instancecount, baseinstance);
+}
+inline void DrawElementsInstancedBaseVertexBaseInstance (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance)
+{
+    return internal::currentdispatch->DrawElementsInstancedBaseVertexBaseInstance (mode, count, type, indices, instancecount, basevertex, baseinstance);
+}
+inline void GetInternalformativ (GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint *params)
+{
+    return internal::currentdispatch->GetInternalformativ (target, internalformat, pname, bufSize, params);
+}
+inline void GetActiveAtomicCounterBufferiv (GLuint program, GLuint bufferIndex, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetActiveAtomicCounterBufferiv (program, bufferIndex, pname, params);
+}
+inline void BindImageTexture (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format)
+{
+    return internal::currentdispatch->BindImageTexture (unit, texture, level, layered, layer, access, format);
+}
+inline void MemoryBarrier (GLbitfield barriers)
+{
+    return internal::currentdispatch->MemoryBarrier (barriers);
+}
+inline void TexStorage1D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width)
+{
+    return internal::currentdispatch->TexStorage1D (target, levels, internalformat, width);
+}
+inline void TexStorage2D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    return internal::currentdispatch->TexStorage2D (target, levels, internalformat, width, height);
+}
+inline void TexStorage3D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+    return internal::currentdispatch->TexStorage3D (target, levels, internalformat, width, height, depth);
+}
+inline void DrawTransformFeedbackInstanced (GLenum mode, GLuint id, GLsizei instancecount)
+{
+    return internal::currentdispatch->DrawTransformFeedbackInstanced (mode, id, instancecount);
+}
+inline void DrawTransformFeedbackStreamInstanced (GLenum mode, GLuint id, GLuint stream, GLsizei instancecount)
+{
+    return internal::currentdispatch->DrawTransformFeedbackStreamInstanced (mode, id, stream, instancecount);
+}
+inline void ClearBufferData (GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data)
+{
+    return internal::currentdispatch->ClearBufferData (target, internalformat, format, type, data);
+}
+inline void ClearBufferSubData (GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data)
+{
+    return internal::currentdispatch->ClearBufferSubData (target, internalformat, offset, size, format, type, data);
+}
+inline void DispatchCompute (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z)
+{
+    return internal::currentdispatch->DispatchCompute (num_groups_x, num_groups_y, num_groups_z);
+}
+inline void DispatchComputeIndirect (GLintptr indirect)
+{
+    return internal::currentdispatch->DispatchComputeIndirect (indirect);
+}
+inline void CopyImageSubData (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth)
+{
+    return internal::currentdispatch->CopyImageSubData (srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+}
+inline void FramebufferParameteri (GLenum target, GLenum pname, GLint param)
+{
+    return internal::currentdispatch->FramebufferParameteri (target, pname, param);
+}
+inline void GetFramebufferParameteriv (GLenum target, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetFramebufferParameteriv (target, pname, params);
+}
+inline void GetInternalformati64v (GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint64 *params)
+{
+    return internal::currentdispatch->GetInternalformati64v (target, internalformat, pname, bufSize, params);
+}
+inline void InvalidateTexSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth)
+{
+    return internal::currentdispatch->InvalidateTexSubImage (texture, level, xoffset, yoffset, zoffset, width, height, depth);
+}
+inline void InvalidateTexImage (GLuint texture, GLint level)
+{
+    return internal::currentdispatch->InvalidateTexImage (texture, level);
+}
+inline void InvalidateBufferSubData (GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+    return internal::currentdispatch->InvalidateBufferSubData (buffer, offset, length);
+}
+inline void InvalidateBufferData (GLuint buffer)
+{
+    return internal::currentdispatch->InvalidateBufferData (buffer);
+}
+inline void InvalidateFramebuffer (GLenum target, GLsizei numAttachments, const GLenum *attachments)
+{
+    return internal::currentdispatch->InvalidateFramebuffer (target, numAttachments, attachments);
+}
+inline void InvalidateSubFramebuffer (GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    return internal::currentdispatch->InvalidateSubFramebuffer (target, numAttachments, attachments, x, y, width, height);
+}
+inline void MultiDrawArraysIndirect (GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride)
+{
+    return internal::currentdispatch->MultiDrawArraysIndirect (mode, indirect, drawcount, stride);
+}
+inline void MultiDrawElementsIndirect (GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride)
+{
+    return internal::currentdispatch->MultiDrawElementsIndirect (mode, type, indirect, drawcount, stride);
+}
+inline void GetProgramInterfaceiv (GLuint program, GLenum programInterface, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetProgramInterfaceiv (program, programInterface, pname, params);
+}
+inline GLuint GetProgramResourceIndex (GLuint program, GLenum programInterface, const GLchar *name)
+{
+    return internal::currentdispatch->GetProgramResourceIndex (program, programInterface, name);
+}
+inline void GetProgramResourceName (GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name)
+{
+    return internal::currentdispatch->GetProgramResourceName (program, programInterface, index, bufSize, length, name);
+}
+inline void GetProgramResourceiv (GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei bufSize, GLsizei *length, GLint *params)
+{
+    return internal::currentdispatch->GetProgramResourceiv (program, programInterface, index, propCount, props, bufSize, length, params);
+}
+inline GLint GetProgramResourceLocation (GLuint program, GLenum programInterface, const GLchar *name)
+{
+    return internal::currentdispatch->GetProgramResourceLocation (program, programInterface, name);
+}
+inline GLint GetProgramResourceLocationIndex (GLuint program, GLenum programInterface, const GLchar *name)
+{
+    return internal::currentdispatch->GetProgramResourceLocationIndex (program, programInterface, name);
+}
+inline void ShaderStorageBlockBinding (GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding)
+{
+    return internal::currentdispatch->ShaderStorageBlockBinding (program, storageBlockIndex, storageBlockBinding);
+}
+inline void TexBufferRange (GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    return internal::currentdispatch->TexBufferRange (target, internalformat, buffer, offset, size);
+}
+inline void TexStorage2DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+    return internal::currentdispatch->TexStorage2DMultisample (target, samples, internalformat, width, height, fixedsamplelocations);
+}
+inline void TexStorage3DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+    return internal::currentdispatch->TexStorage3DMultisample (target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+inline void TextureView (GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers)
+{
+    return internal::currentdispatch->TextureView (texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+}
+inline void BindVertexBuffer (GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+    return internal::currentdispatch->BindVertexBuffer (bindingindex, buffer, offset, stride);
+}
+inline void VertexAttribFormat (GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
+{
+    return internal::currentdispatch->VertexAttribFormat (attribindex, size, type, normalized, relativeoffset);
+}
+inline void VertexAttribIFormat (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    return internal::currentdispatch->VertexAttribIFormat (attribindex, size, type, relativeoffset);
+}
+inline void VertexAttribLFormat (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    return internal::currentdispatch->VertexAttribLFormat (attribindex, size, type, relativeoffset);
+}
+inline void VertexAttribBinding (GLuint attribindex, GLuint bindingindex)
+{
+    return internal::currentdispatch->VertexAttribBinding (attribindex, bindingindex);
+}
+inline void VertexBindingDivisor (GLuint bindingindex, GLuint divisor)
+{
+    return internal::currentdispatch->VertexBindingDivisor (bindingindex, divisor);
+}
+inline void DebugMessageControl (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled)
+{
+    return internal::currentdispatch->DebugMessageControl (source, type, severity, count, ids, enabled);
+}
+inline void DebugMessageInsert (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf)
+{
+    return internal::currentdispatch->DebugMessageInsert (source, type, id, severity, length, buf);
+}
+inline void DebugMessageCallback (GLDEBUGPROC callback, const void *userParam)
+{
+    return internal::currentdispatch->DebugMessageCallback (callback, userParam);
+}
+inline GLuint GetDebugMessageLog (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog)
+{
+    return internal::currentdispatch->GetDebugMessageLog (count, bufSize, sources, types, ids, severities, lengths, messageLog);
+}
+inline void PushDebugGroup (GLenum source, GLuint id, GLsizei length, const GLchar *message)
+{
+    return internal::currentdispatch->PushDebugGroup (source, id, length, message);
+}
+inline void PopDebugGroup (void)
+{
+    return internal::currentdispatch->PopDebugGroup ();
+}
+inline void ObjectLabel (GLenum identifier, GLuint name, GLsizei length, const GLchar *label)
+{
+    return internal::currentdispatch->ObjectLabel (identifier, name, length, label);
+}
+inline void GetObjectLabel (GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label)
+{
+    return internal::currentdispatch->GetObjectLabel (identifier, name, bufSize, length, label);
+}
+inline void ObjectPtrLabel (const void *ptr, GLsizei length, const GLchar *label)
+{
+    return internal::currentdispatch->ObjectPtrLabel (ptr, length, label);
+}
+inline void GetObjectPtrLabel (const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label)
+{
+    return internal::currentdispatch->GetObjectPtrLabel (ptr, bufSize, length, label);
+}
+inline void BufferStorage (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags)
+{
+    return internal::currentdispatch->BufferStorage (target, size, data, flags);
+}
+inline void ClearTexImage (GLuint texture, GLint level, GLenum format, GLenum type, const void *data)
+{
+    return internal::currentdispatch->ClearTexImage (texture, level, format, type, data);
+}
+inline void ClearTexSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data)
+{
+    return internal::currentdispatch->ClearTexSubImage (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+}
+inline void BindBuffersBase (GLenum target, GLuint first, GLsizei count, const GLuint *buffers)
+{
+    return internal::currentdispatch->BindBuffersBase (target, first, count, buffers);
+}
+inline void BindBuffersRange (GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes)
+{
+    return internal::currentdispatch->BindBuffersRange (target, first, count, buffers, offsets, sizes);
+}
+inline void BindTextures (GLuint first, GLsizei count, const GLuint *textures)
+{
+    return internal::currentdispatch->BindTextures (first, count, textures);
+}
+inline void BindSamplers (GLuint first, GLsizei count, const GLuint *samplers)
+{
+    return internal::currentdispatch->BindSamplers (first, count, samplers);
+}
+inline void BindImageTextures (GLuint first, GLsizei count, const GLuint *textures)
+{
+    return internal::currentdispatch->BindImageTextures (first, count, textures);
+}
+inline void BindVertexBuffers (GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides)
+{
+    return internal::currentdispatch->BindVertexBuffers (first, count, buffers, offsets, strides);
+}
+inline void ClipControl (GLenum origin, GLenum depth)
+{
+    return internal::currentdispatch->ClipControl (origin, depth);
+}
+inline void CreateTransformFeedbacks (GLsizei n, GLuint *ids)
+{
+    return internal::currentdispatch->CreateTransformFeedbacks (n, ids);
+}
+inline void TransformFeedbackBufferBase (GLuint xfb, GLuint index, GLuint buffer)
+{
+    return internal::currentdispatch->TransformFeedbackBufferBase (xfb, index, buffer);
+}
+inline void TransformFeedbackBufferRange (GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    return internal::currentdispatch->TransformFeedbackBufferRange (xfb, index, buffer, offset, size);
+}
+inline void GetTransformFeedbackiv (GLuint xfb, GLenum pname, GLint *param)
+{
+    return internal::currentdispatch->GetTransformFeedbackiv (xfb, pname, param);
+}
+inline void GetTransformFeedbacki_v (GLuint xfb, GLenum pname, GLuint index, GLint *param)
+{
+    return internal::currentdispatch->GetTransformFeedbacki_v (xfb, pname, index, param);
+}
+inline void GetTransformFeedbacki64_v (GLuint xfb, GLenum pname, GLuint index, GLint64 *param)
+{
+    return internal::currentdispatch->GetTransformFeedbacki64_v (xfb, pname, index, param);
+}
+inline void CreateBuffers (GLsizei n, GLuint *buffers)
+{
+    return internal::currentdispatch->CreateBuffers (n, buffers);
+}
+inline void NamedBufferStorage (GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags)
+{
+    return internal::currentdispatch->NamedBufferStorage (buffer, size, data, flags);
+}
+inline void NamedBufferData (GLuint buffer, GLsizeiptr size, const void *data, GLenum usage)
+{
+    return internal::currentdispatch->NamedBufferData (buffer, size, data, usage);
+}
+inline void NamedBufferSubData (GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    return internal::currentdispatch->NamedBufferSubData (buffer, offset, size, data);
+}
+inline void CopyNamedBufferSubData (GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+    return internal::currentdispatch->CopyNamedBufferSubData (readBuffer, writeBuffer, readOffset, writeOffset, size);
+}
+inline void ClearNamedBufferData (GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data)
+{
+    return internal::currentdispatch->ClearNamedBufferData (buffer, internalformat, format, type, data);
+}
+inline void ClearNamedBufferSubData (GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data)
+{
+    return internal::currentdispatch->ClearNamedBufferSubData (buffer, internalformat, offset, size, format, type, data);
+}
+inline void * MapNamedBuffer (GLuint buffer, GLenum access)
+{
+    return internal::currentdispatch->MapNamedBuffer (buffer, access);
+}
+inline void * MapNamedBufferRange (GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    return internal::currentdispatch->MapNamedBufferRange (buffer, offset, length, access);
+}
+inline GLboolean UnmapNamedBuffer (GLuint buffer)
+{
+    return internal::currentdispatch->UnmapNamedBuffer (buffer);
+}
+inline void FlushMappedNamedBufferRange (GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+    return internal::currentdispatch->FlushMappedNamedBufferRange (buffer, offset, length);
+}
+inline void GetNamedBufferParameteriv (GLuint buffer, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetNamedBufferParameteriv (buffer, pname, params);
+}
+inline void GetNamedBufferParameteri64v (GLuint buffer, GLenum pname, GLint64 *params)
+{
+    return internal::currentdispatch->GetNamedBufferParameteri64v (buffer, pname, params);
+}
+inline void GetNamedBufferPointerv (GLuint buffer, GLenum pname, void **params)
+{
+    return internal::currentdispatch->GetNamedBufferPointerv (buffer, pname, params);
+}
+inline void GetNamedBufferSubData (GLuint buffer, GLintptr offset, GLsizeiptr size, void *data)
+{
+    return internal::currentdispatch->GetNamedBufferSubData (buffer, offset, size, data);
+}
+inline void CreateFramebuffers (GLsizei n, GLuint *framebuffers)
+{
+    return internal::currentdispatch->CreateFramebuffers (n, framebuffers);
+}
+inline void NamedFramebufferRenderbuffer (GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+    return internal::currentdispatch->NamedFramebufferRenderbuffer (framebuffer, attachment, renderbuffertarget, renderbuffer);
+}
+inline void NamedFramebufferParameteri (GLuint framebuffer, GLenum pname, GLint param)
+{
+    return internal::currentdispatch->NamedFramebufferParameteri (framebuffer, pname, param);
+}
+inline void NamedFramebufferTexture (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level)
+{
+    return internal::currentdispatch->NamedFramebufferTexture (framebuffer, attachment, texture, level);
+}
+inline void NamedFramebufferTextureLayer (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+    return internal::currentdispatch->NamedFramebufferTextureLayer (framebuffer, attachment, texture, level, layer);
+}
+inline void NamedFramebufferDrawBuffer (GLuint framebuffer, GLenum buf)
+{
+    return internal::currentdispatch->NamedFramebufferDrawBuffer (framebuffer, buf);
+}
+inline void NamedFramebufferDrawBuffers (GLuint framebuffer, GLsizei n, const GLenum *bufs)
+{
+    return internal::currentdispatch->NamedFramebufferDrawBuffers (framebuffer, n, bufs);
+}
+inline void NamedFramebufferReadBuffer (GLuint framebuffer, GLenum src)
+{
+    return internal::currentdispatch->NamedFramebufferReadBuffer (framebuffer, src);
+}
+inline void InvalidateNamedFramebufferData (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments)
+{
+    return internal::currentdispatch->InvalidateNamedFramebufferData (framebuffer, numAttachments, attachments);
+}
+inline void InvalidateNamedFramebufferSubData (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    return internal::currentdispatch->InvalidateNamedFramebufferSubData (framebuffer, numAttachments, attachments, x, y, width, height);
+}
+inline void ClearNamedFramebufferiv (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value)
+{
+    return internal::currentdispatch->ClearNamedFramebufferiv (framebuffer, buffer, drawbuffer, value);
+}
+inline void ClearNamedFramebufferuiv (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value)
+{
+    return internal::currentdispatch->ClearNamedFramebufferuiv (framebuffer, buffer, drawbuffer, value);
+}
+inline void ClearNamedFramebufferfv (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value)
+{
+    return internal::currentdispatch->ClearNamedFramebufferfv (framebuffer, buffer, drawbuffer, value);
+}
+inline void ClearNamedFramebufferfi (GLuint framebuffer, GLenum buffer, const GLfloat depth, GLint stencil)
+{
+    return internal::currentdispatch->ClearNamedFramebufferfi (framebuffer, buffer, depth, stencil);
+}
+inline void BlitNamedFramebuffer (GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+    return internal::currentdispatch->BlitNamedFramebuffer (readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+inline GLenum CheckNamedFramebufferStatus (GLuint framebuffer, GLenum target)
+{
+    return internal::currentdispatch->CheckNamedFramebufferStatus (framebuffer, target);
+}
+inline void GetNamedFramebufferParameteriv (GLuint framebuffer, GLenum pname, GLint *param)
+{
+    return internal::currentdispatch->GetNamedFramebufferParameteriv (framebuffer, pname, param);
+}
+inline void GetNamedFramebufferAttachmentParameteriv (GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetNamedFramebufferAttachmentParameteriv (framebuffer, attachment, pname, params);
+}
+inline void CreateRenderbuffers (GLsizei n, GLuint *renderbuffers)
+{
+    return internal::currentdispatch->CreateRenderbuffers (n, renderbuffers);
+}
+inline void NamedRenderbufferStorage (GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    return internal::currentdispatch->NamedRenderbufferStorage (renderbuffer, internalformat, width, height);
+}
+inline void NamedRenderbufferStorageMultisample (GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    return internal::currentdispatch->NamedRenderbufferStorageMultisample (renderbuffer, samples, internalformat, width, height);
+}
+inline void GetNamedRenderbufferParameteriv (GLuint renderbuffer, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetNamedRenderbufferParameteriv (renderbuffer, pname, params);
+}
+inline void CreateTextures (GLenum target, GLsizei n, GLuint *textures)
+{
+    return internal::currentdispatch->CreateTextures (target, n, textures);
+}
+inline void TextureBuffer (GLuint texture, GLenum internalformat, GLuint buffer)
+{
+    return internal::currentdispatch->TextureBuffer (texture, internalformat, buffer);
+}
+inline void TextureBufferRange (GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    return internal::currentdispatch->TextureBufferRange (texture, internalformat, buffer, offset, size);
+}
+inline void TextureStorage1D (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width)
+{
+    return internal::currentdispatch->TextureStorage1D (texture, levels, internalformat, width);
+}
+inline void TextureStorage2D (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    return internal::currentdispatch->TextureStorage2D (texture, levels, internalformat, width, height);
+}
+inline void TextureStorage3D (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+    return internal::currentdispatch->TextureStorage3D (texture, levels, internalformat, width, height, depth);
+}
+inline void TextureStorage2DMultisample (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+    return internal::currentdispatch->TextureStorage2DMultisample (texture, samples, internalformat, width, height, fixedsamplelocations);
+}
+inline void TextureStorage3DMultisample (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+    return internal::currentdispatch->TextureStorage3DMultisample (texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+inline void TextureSubImage1D (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels)
+{
+    return internal::currentdispatch->TextureSubImage1D (texture, level, xoffset, width, format, type, pixels);
+}
+inline void TextureSubImage2D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+    return internal::currentdispatch->TextureSubImage2D (texture, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+inline void TextureSubImage3D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels)
+{
+    return internal::currentdispatch->TextureSubImage3D (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+inline void CompressedTextureSubImage1D (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
+{
+    return internal::currentdispatch->CompressedTextureSubImage1D (texture, level, xoffset, width, format, imageSize, data);
+}
+inline void CompressedTextureSubImage2D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+{
+    return internal::currentdispatch->CompressedTextureSubImage2D (texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+inline void CompressedTextureSubImage3D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+{
+    return internal::currentdispatch->CompressedTextureSubImage3D (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+inline void CopyTextureSubImage1D (GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+    return internal::currentdispatch->CopyTextureSubImage1D (texture, level, xoffset, x, y, width);
+}
+inline void CopyTextureSubImage2D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    return internal::currentdispatch->CopyTextureSubImage2D (texture, level, xoffset, yoffset, x, y, width, height);
+}
+inline void CopyTextureSubImage3D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    return internal::currentdispatch->CopyTextureSubImage3D (texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+inline void TextureParameterf (GLuint texture, GLenum pname, GLfloat param)
+{
+    return internal::currentdispatch->TextureParameterf (texture, pname, param);
+}
+inline void TextureParameterfv (GLuint texture, GLenum pname, const GLfloat *param)
+{
+    return internal::currentdispatch->TextureParameterfv (texture, pname, param);
+}
+inline void TextureParameteri (GLuint texture, GLenum pname, GLint param)
+{
+    return internal::currentdispatch->TextureParameteri (texture, pname, param);
+}
+inline void TextureParameterIiv (GLuint texture, GLenum pname, const GLint *params)
+{
+    return internal::currentdispatch->TextureParameterIiv (texture, pname, params);
+}
+inline void TextureParameterIuiv (GLuint texture, GLenum pname, const GLuint *params)
+{
+    return internal::currentdispatch->TextureParameterIuiv (texture, pname, params);
+}
+inline void TextureParameteriv (GLuint texture, GLenum pname, const GLint *param)
+{
+    return internal::currentdispatch->TextureParameteriv (texture, pname, param);
+}
+inline void GenerateTextureMipmap (GLuint texture)
+{
+    return internal::currentdispatch->GenerateTextureMipmap (texture);
+}
+inline void BindTextureUnit (GLuint unit, GLuint texture)
+{
+    return internal::currentdispatch->BindTextureUnit (unit, texture);
+}
+inline void GetTextureImage (GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+    return internal::currentdispatch->GetTextureImage (texture, level, format, type, bufSize, pixels);
+}
+inline void GetCompressedTextureImage (GLuint texture, GLint level, GLsizei bufSize, void *pixels)
+{
+    return internal::currentdispatch->GetCompressedTextureImage (texture, level, bufSize, pixels);
+}
+inline void GetTextureLevelParameterfv (GLuint texture, GLint level, GLenum pname, GLfloat *params)
+{
+    return internal::currentdispatch->GetTextureLevelParameterfv (texture, level, pname, params);
+}
+inline void GetTextureLevelParameteriv (GLuint texture, GLint level, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetTextureLevelParameteriv (texture, level, pname, params);
+}
+inline void GetTextureParameterfv (GLuint texture, GLenum pname, GLfloat *params)
+{
+    return internal::currentdispatch->GetTextureParameterfv (texture, pname, params);
+}
+inline void GetTextureParameterIiv (GLuint texture, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetTextureParameterIiv (texture, pname, params);
+}
+inline void GetTextureParameterIuiv (GLuint texture, GLenum pname, GLuint *params)
+{
+    return internal::currentdispatch->GetTextureParameterIuiv (texture, pname, params);
+}
+inline void GetTextureParameteriv (GLuint texture, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetTextureParameteriv (texture, pname, params);
+}
+inline void CreateVertexArrays (GLsizei n, GLuint *arrays)
+{
+    return internal::currentdispatch->CreateVertexArrays (n, arrays);
+}
+inline void DisableVertexArrayAttrib (GLuint vaobj, GLuint index)
+{
+    return internal::currentdispatch->DisableVertexArrayAttrib (vaobj, index);
+}
+inline void EnableVertexArrayAttrib (GLuint vaobj, GLuint index)
+{
+    return internal::currentdispatch->EnableVertexArrayAttrib (vaobj, index);
+}
+inline void VertexArrayElementBuffer (GLuint vaobj, GLuint buffer)
+{
+    return internal::currentdispatch->VertexArrayElementBuffer (vaobj, buffer);
+}
+inline void VertexArrayVertexBuffer (GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+    return internal::currentdispatch->VertexArrayVertexBuffer (vaobj, bindingindex, buffer, offset, stride);
+}
+inline void VertexArrayVertexBuffers (GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides)
+{
+    return internal::currentdispatch->VertexArrayVertexBuffers (vaobj, first, count, buffers, offsets, strides);
+}
+inline void VertexArrayAttribBinding (GLuint vaobj, GLuint attribindex, GLuint bindingindex)
+{
+    return internal::currentdispatch->VertexArrayAttribBinding (vaobj, attribindex, bindingindex);
+}
+inline void VertexArrayAttribFormat (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
+{
+    return internal::currentdispatch->VertexArrayAttribFormat (vaobj, attribindex, size, type, normalized, relativeoffset);
+}
+inline void VertexArrayAttribIFormat (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    return internal::currentdispatch->VertexArrayAttribIFormat (vaobj, attribindex, size, type, relativeoffset);
+}
+inline void VertexArrayAttribLFormat (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    return internal::currentdispatch->VertexArrayAttribLFormat (vaobj, attribindex, size, type, relativeoffset);
+}
+inline void VertexArrayBindingDivisor (GLuint vaobj, GLuint bindingindex, GLuint divisor)
+{
+    return internal::currentdispatch->VertexArrayBindingDivisor (vaobj, bindingindex, divisor);
+}
+inline void GetVertexArrayiv (GLuint vaobj, GLenum pname, GLint *param)
+{
+    return internal::currentdispatch->GetVertexArrayiv (vaobj, pname, param);
+}
+inline void GetVertexArrayIndexediv (GLuint vaobj, GLuint index, GLenum pname, GLint *param)
+{
+    return internal::currentdispatch->GetVertexArrayIndexediv (vaobj, index, pname, param);
+}
+inline void GetVertexArrayIndexed64iv (GLuint vaobj, GLuint index, GLenum pname, GLint64 *param)
+{
+    return internal::currentdispatch->GetVertexArrayIndexed64iv (vaobj, index, pname, param);
+}
+inline void CreateSamplers (GLsizei n, GLuint *samplers)
+{
+    return internal::currentdispatch->CreateSamplers (n, samplers);
+}
+inline void CreateProgramPipelines (GLsizei n, GLuint *pipelines)
+{
+    return internal::currentdispatch->CreateProgramPipelines (n, pipelines);
+}
+inline void CreateQueries (GLenum target, GLsizei n, GLuint *ids)
+{
+    return internal::currentdispatch->CreateQueries (target, n, ids);
+}
+inline void GetQueryBufferObjecti64v (GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    return internal::currentdispatch->GetQueryBufferObjecti64v (id, buffer, pname, offset);
+}
+inline void GetQueryBufferObjectiv (GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    return internal::currentdispatch->GetQueryBufferObjectiv (id, buffer, pname, offset);
+}
+inline void GetQueryBufferObjectui64v (GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    return internal::currentdispatch->GetQueryBufferObjectui64v (id, buffer, pname, offset);
+}
+inline void GetQueryBufferObjectuiv (GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    return internal::currentdispatch->GetQueryBufferObjectuiv (id, buffer, pname, offset);
+}
+inline void MemoryBarrierByRegion (GLbitfield barriers)
+{
+    return internal::currentdispatch->MemoryBarrierByRegion (barriers);
+}
+inline void GetTextureSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+    return internal::currentdispatch->GetTextureSubImage (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+}
+inline void GetCompressedTextureSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels)
+{
+    return internal::currentdispatch->GetCompressedTextureSubImage (texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+}
+inline GLenum GetGraphicsResetStatus (void)
+{
+    return internal::currentdispatch->GetGraphicsResetStatus ();
+}
+inline void GetnCompressedTexImage (GLenum target, GLint lod, GLsizei bufSize, void *pixels)
+{
+    return internal::currentdispatch->GetnCompressedTexImage (target, lod, bufSize, pixels);
+}
+inline void GetnTexImage (GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+    return internal::currentdispatch->GetnTexImage (target, level, format, type, bufSize, pixels);
+}
+inline void GetnUniformdv (GLuint program, GLint location, GLsizei bufSize, GLdouble *params)
+{
+    return internal::currentdispatch->GetnUniformdv (program, location, bufSize, params);
+}
+inline void GetnUniformfv (GLuint program, GLint location, GLsizei bufSize, GLfloat *params)
+{
+    return internal::currentdispatch->GetnUniformfv (program, location, bufSize, params);
+}
+inline void GetnUniformiv (GLuint program, GLint location, GLsizei bufSize, GLint *params)
+{
+    return internal::currentdispatch->GetnUniformiv (program, location, bufSize, params);
+}
+inline void GetnUniformuiv (GLuint program, GLint location, GLsizei bufSize, GLuint *params)
+{
+    return internal::currentdispatch->GetnUniformuiv (program, location, bufSize, params);
+}
+inline void ReadnPixels (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data)
+{
+    return internal::currentdispatch->ReadnPixels (x, y, width, height, format, type, bufSize, data);
+}
+inline void TextureBarrier (void)
+{
+    return internal::currentdispatch->TextureBarrier ();
+}
+inline GLuint64 GetTextureHandleARB (GLuint texture)
+{
+    return internal::currentdispatch->GetTextureHandleARB (texture);
+}
+inline GLuint64 GetTextureSamplerHandleARB (GLuint texture, GLuint sampler)
+{
+    return internal::currentdispatch->GetTextureSamplerHandleARB (texture, sampler);
+}
+inline void MakeTextureHandleResidentARB (GLuint64 handle)
+{
+    return internal::currentdispatch->MakeTextureHandleResidentARB (handle);
+}
+inline void MakeTextureHandleNonResidentARB (GLuint64 handle)
+{
+    return internal::currentdispatch->MakeTextureHandleNonResidentARB (handle);
+}
+inline GLuint64 GetImageHandleARB (GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format)
+{
+    return internal::currentdispatch->GetImageHandleARB (texture, level, layered, layer, format);
+}
+inline void MakeImageHandleResidentARB (GLuint64 handle, GLenum access)
+{
+    return internal::currentdispatch->MakeImageHandleResidentARB (handle, access);
+}
+inline void MakeImageHandleNonResidentARB (GLuint64 handle)
+{
+    return internal::currentdispatch->MakeImageHandleNonResidentARB (handle);
+}
+inline void UniformHandleui64ARB (GLint location, GLuint64 value)
+{
+    return internal::currentdispatch->UniformHandleui64ARB (location, value);
+}
+inline void UniformHandleui64vARB (GLint location, GLsizei count, const GLuint64 *value)
+{
+    return internal::currentdispatch->UniformHandleui64vARB (location, count, value);
+}
+inline void ProgramUniformHandleui64ARB (GLuint program, GLint location, GLuint64 value)
+{
+    return internal::currentdispatch->ProgramUniformHandleui64ARB (program, location, value);
+}
+inline void ProgramUniformHandleui64vARB (GLuint program, GLint location, GLsizei count, const GLuint64 *values)
+{
+    return internal::currentdispatch->ProgramUniformHandleui64vARB (program, location, count, values);
+}
+inline GLboolean IsTextureHandleResidentARB (GLuint64 handle)
+{
+    return internal::currentdispatch->IsTextureHandleResidentARB (handle);
+}
+inline GLboolean IsImageHandleResidentARB (GLuint64 handle)
+{
+    return internal::currentdispatch->IsImageHandleResidentARB (handle);
+}
+inline void VertexAttribL1ui64ARB (GLuint index, GLuint64EXT x)
+{
+    return internal::currentdispatch->VertexAttribL1ui64ARB (index, x);
+}
+inline void VertexAttribL1ui64vARB (GLuint index, const GLuint64EXT *v)
+{
+    return internal::currentdispatch->VertexAttribL1ui64vARB (index, v);
+}
+inline void GetVertexAttribLui64vARB (GLuint index, GLenum pname, GLuint64EXT *params)
+{
+    return internal::currentdispatch->GetVertexAttribLui64vARB (index, pname, params);
+}
+inline GLsync CreateSyncFromCLeventARB (struct _cl_context *context, struct _cl_event *event, GLbitfield flags)
+{
+    return internal::currentdispatch->CreateSyncFromCLeventARB (context, event, flags);
+}
+inline void DispatchComputeGroupSizeARB (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z, GLuint group_size_x, GLuint group_size_y, GLuint group_size_z)
+{
+    return internal::currentdispatch->DispatchComputeGroupSizeARB (num_groups_x, num_groups_y, num_groups_z, group_size_x, group_size_y, group_size_z);
+}
+inline void DebugMessageControlARB (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled)
+{
+    return internal::currentdispatch->DebugMessageControlARB (source, type, severity, count, ids, enabled);
+}
+inline void DebugMessageInsertARB (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf)
+{
+    return internal::currentdispatch->DebugMessageInsertARB (source, type, id, severity, length, buf);
+}
+inline void DebugMessageCallbackARB (GLDEBUGPROCARB callback, const void *userParam)
+{
+    return internal::currentdispatch->DebugMessageCallbackARB (callback, userParam);
+}
+inline GLuint GetDebugMessageLogARB (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog)
+{
+    return internal::currentdispatch->GetDebugMessageLogARB (count, bufSize, sources, types, ids, severities, lengths, messageLog);
+}
+inline void BlendEquationiARB (GLuint buf, GLenum mode)
+{
+    return internal::currentdispatch->BlendEquationiARB (buf, mode);
+}
+inline void BlendEquationSeparateiARB (GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+    return internal::currentdispatch->BlendEquationSeparateiARB (buf, modeRGB, modeAlpha);
+}
+inline void BlendFunciARB (GLuint buf, GLenum src, GLenum dst)
+{
+    return internal::currentdispatch->BlendFunciARB (buf, src, dst);
+}
+inline void BlendFuncSeparateiARB (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+    return internal::currentdispatch->BlendFuncSeparateiARB (buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+inline void MultiDrawArraysIndirectCountARB (GLenum mode, GLintptr indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+    return internal::currentdispatch->MultiDrawArraysIndirectCountARB (mode, indirect, drawcount, maxdrawcount, stride);
+}
+inline void MultiDrawElementsIndirectCountARB (GLenum mode, GLenum type, GLintptr indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+    return internal::currentdispatch->MultiDrawElementsIndirectCountARB (mode, type, indirect, drawcount, maxdrawcount, stride);
+}
+inline GLenum GetGraphicsResetStatusARB (void)
+{
+    return internal::currentdispatch->GetGraphicsResetStatusARB ();
+}
+inline void GetnTexImageARB (GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *img)
+{
+    return internal::currentdispatch->GetnTexImageARB (target, level, format, type, bufSize, img);
+}
+inline void ReadnPixelsARB (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data)
+{
+    return internal::currentdispatch->ReadnPixelsARB (x, y, width, height, format, type, bufSize, data);
+}
+inline void GetnCompressedTexImageARB (GLenum target, GLint lod, GLsizei bufSize, void *img)
+{
+    return internal::currentdispatch->GetnCompressedTexImageARB (target, lod, bufSize, img);
+}
+inline void GetnUniformfvARB (GLuint program, GLint location, GLsizei bufSize, GLfloat *params)
+{
+    return internal::currentdispatch->GetnUniformfvARB (program, location, bufSize, params);
+}
+inline void GetnUniformivARB (GLuint program, GLint location, GLsizei bufSize, GLint *params)
+{
+    return internal::currentdispatch->GetnUniformivARB (program, location, bufSize, params);
+}
+inline void GetnUniformuivARB (GLuint program, GLint location, GLsizei bufSize, GLuint *params)
+{
+    return internal::currentdispatch->GetnUniformuivARB (program, location, bufSize, params);
+}
+inline void GetnUniformdvARB (GLuint program, GLint location, GLsizei bufSize, GLdouble *params)
+{
+    return internal::currentdispatch->GetnUniformdvARB (program, location, bufSize, params);
+}
+inline void MinSampleShadingARB (GLfloat value)
+{
+    return internal::currentdispatch->MinSampleShadingARB (value);
+}
+inline void NamedStringARB (GLenum type, GLint namelen, const GLchar *name, GLint stringlen, const GLchar *string)
+{
+    return internal::currentdispatch->NamedStringARB (type, namelen, name, stringlen, string);
+}
+inline void DeleteNamedStringARB (GLint namelen, const GLchar *name)
+{
+    return internal::currentdispatch->DeleteNamedStringARB (namelen, name);
+}
+inline void CompileShaderIncludeARB (GLuint shader, GLsizei count, const GLchar *const*path, const GLint *length)
+{
+    return internal::currentdispatch->CompileShaderIncludeARB (shader, count, path, length);
+}
+inline GLboolean IsNamedStringARB (GLint namelen, const GLchar *name)
+{
+    return internal::currentdispatch->IsNamedStringARB (namelen, name);
+}
+inline void GetNamedStringARB (GLint namelen, const GLchar *name, GLsizei bufSize, GLint *stringlen, GLchar *string)
+{
+    return internal::currentdispatch->GetNamedStringARB (namelen, name, bufSize, stringlen, string);
+}
+inline void GetNamedStringivARB (GLint namelen, const GLchar *name, GLenum pname, GLint *params)
+{
+    return internal::currentdispatch->GetNamedStringivARB (namelen, name, pname, params);
+}
+inline void BufferPageCommitmentARB (GLenum target, GLintptr offset, GLsizeiptr size, GLboolean commit)
+{
+    return internal::currentdispatch->BufferPageCommitmentARB (target, offset, size, commit);
+}
+inline void NamedBufferPageCommitmentEXT (GLuint buffer, GLintptr offset, GLsizeiptr size, GLboolean commit)
+{
+    return internal::currentdispatch->NamedBufferPageCommitmentEXT (buffer, offset, size, commit);
+}
+inline void NamedBufferPageCommitmentARB (GLuint buffer, GLintptr offset, GLsizeiptr size, GLboolean commit)
+{
+    return internal::currentdispatch->NamedBufferPageCommitmentARB (buffer, offset, size, commit);
+}
+inline void TexPageCommitmentARB (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean commit)
+{
+    return internal::currentdispatch->TexPageCommitmentARB (target, level, xoffset, yoffset, zoffset, width, height, depth, commit);
+}
+inline void GetMultisamplefvNV (GLenum a0, GLuint a1, GLfloat *a2)
+{
+    return internal::currentdispatch->GetMultisamplefvNV (a0, a1, a2);
+}
+inline void SampleMaskIndexedNV (GLuint a0, GLbitfield a1)
+{
+    return internal::currentdispatch->SampleMaskIndexedNV (a0, a1);
+}
+inline void TexRenderbufferNV (GLenum a0, GLuint a1)
+{
+    return internal::currentdispatch->TexRenderbufferNV (a0, a1);
+}
+inline void MakeBufferResidentNV (GLenum target, GLenum access)
+{
+    return internal::currentdispatch->MakeBufferResidentNV (target, access);
+}
+inline void MakeBufferNonResidentNV (GLenum target)
+{
+    return internal::currentdispatch->MakeBufferNonResidentNV (target);
+}
+inline GLboolean IsBufferResidentNV (GLenum target)
+{
+    return internal::currentdispatch->IsBufferResidentNV (target);
+}
+inline void MakeNamedBufferResidentNV (GLuint buffer, GLenum access)
+{
+    return internal::currentdispatch->MakeNamedBufferResidentNV (buffer, access);
+}
+inline void MakeNamedBufferNonResidentNV (GLuint buffer)
+{
+    return internal::currentdispatch->MakeNamedBufferNonResidentNV (buffer);
+}
+inline GLboolean IsNamedBufferResidentNV (GLuint buffer)
+{
+    return internal::currentdispatch->IsNamedBufferResidentNV (buffer);
+}
+inline void GetBufferParameterui64vNV (GLenum target, GLenum pname, GLuint64EXT *params)
+{
+    return internal::currentdispatch->GetBufferParameterui64vNV (target, pname, params);
+}
+inline void GetNamedBufferParameterui64vNV (GLuint buffer, GLenum pname, GLuint64EXT *params)
+{
+    return internal::currentdispatch->GetNamedBufferParameterui64vNV (buffer, pname, params);
+}
+inline void GetIntegerui64vNV (GLenum value, GLuint64EXT *result)
+{
+    return internal::currentdispatch->GetIntegerui64vNV (value, result);
+}
+inline void Uniformui64NV (GLint location, GLuint64EXT value)
+{
+    return internal::currentdispatch->Uniformui64NV (location, value);
+}
+inline void Uniformui64vNV (GLint location, GLsizei count, const GLuint64EXT *value)
+{
+    return internal::currentdispatch->Uniformui64vNV (location, count, value);
+}
+inline void ProgramUniformui64NV (GLuint program, GLint location, GLuint64EXT value)
+{
+    return internal::currentdispatch->ProgramUniformui64NV (program, location, value);
+}
+inline void ProgramUniformui64vNV (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value)
+{
+    return internal::currentdispatch->ProgramUniformui64vNV (program, location, count, value);
+}
+inline void BufferAddressRangeNV (GLenum pname, GLuint index, GLuint64EXT address, GLsizeiptr length)
+{
+    return internal::currentdispatch->BufferAddressRangeNV (pname, index, address, length);
+}
+inline void VertexFormatNV (GLint size, GLenum type, GLsizei stride)
+{
+    return internal::currentdispatch->VertexFormatNV (size, type, stride);
+}
+inline void NormalFormatNV (GLenum type, GLsizei stride)
+{
+    return internal::currentdispatch->NormalFormatNV (type, stride);
+}
+inline void ColorFormatNV (GLint size, GLenum type, GLsizei stride)
+{
+    return internal::currentdispatch->ColorFormatNV (size, type, stride);
+}
+inline void IndexFormatNV (GLenum type, GLsizei stride)
+{
+    return internal::currentdispatch->IndexFormatNV (type, stride);
+}
+inline void TexCoordFormatNV (GLint size, GLenum type, GLsizei stride)
+{
+    return internal::currentdispatch->TexCoordFormatNV (size, type, stride);
+}
+inline void EdgeFlagFormatNV (GLsizei stride)
+{
+    return internal::currentdispatch->EdgeFlagFormatNV (stride);
+}
+inline void SecondaryColorFormatNV (GLint size, GLenum type, GLsizei stride)
+{
+    return internal::currentdispatch->SecondaryColorFormatNV (size, type, stride);
+}
+inline void FogCoordFormatNV (GLenum type, GLsizei stride)
+{
+    return internal::currentdispatch->FogCoordFormatNV (type, stride);
+}
+inline void VertexAttribFormatNV (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride)
+{
+    return internal::currentdispatch->VertexAttribFormatNV (index, size, type, normalized, stride);
+}
+inline void VertexAttribIFormatNV (GLuint index, GLint size, GLenum type, GLsizei stride)
+{
+    return internal::currentdispatch->VertexAttribIFormatNV (index, size, type, stride);
+}
+inline void GetIntegerui64i_vNV (GLenum value, GLuint index, GLuint64EXT *result)
+{
+    return internal::currentdispatch->GetIntegerui64i_vNV (value, index, result);
+}
+inline void EnableClientState (GLenum cap)
+{
+    return internal::currentdispatch->EnableClientState (cap);
+}
+inline void DisableClientState (GLenum cap)
+{
+    return internal::currentdispatch->DisableClientState (cap);
+}
+
+#else /* !defined OGLP_DISPATCH_TABLE */
+
+#ifdef OGLP_DIRECT_LINK
+
+/* With OGLP_DIRECT_LINK the entry points of core versions forward to
+ * the symbols exported by the OpenGL library, so that the compiler can
+ * inline through the wrappers. Extensions are still resolved by Init. */
+inline void CullFace (GLenum mode)
+{
+    return ::glCullFace (mode);
+}
+inline void FrontFace (GLenum mode)
+{
+    return ::glFrontFace (mode);
+}
+inline void Hint (GLenum target, GLenum mode)
+{
+    return ::glHint (target, mode);
+}
+inline void LineWidth (GLfloat width)
+{
+    return ::glLineWidth (width);
+}
+inline void PointSize (GLfloat size)
+{
+    return ::glPointSize (size);
+}
+inline void PolygonMode (GLenum face, GLenum mode)
+{
+    return ::glPolygonMode (face, mode);
+}
+inline void Scissor (GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    return ::glScissor (x, y, width, height);
+}
+inline void TexParameterf (GLenum target, GLenum pname, GLfloat param)
+{
+    return ::glTexParameterf (target, pname, param);
+}
+inline void TexParameterfv (GLenum target, GLenum pname, const GLfloat *params)
+{
+    return ::glTexParameterfv (target, pname, params);
+}
+inline void TexParameteri (GLenum target, GLenum pname, GLint param)
+{
+    return ::glTexParameteri (target, pname, param);
+}
+inline void TexParameteriv (GLenum target, GLenum pname, const GLint *params)
+{
+    return ::glTexParameteriv (target, pname, params);
+}
+inline void TexImage1D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    return ::glTexImage1D (target, level, internalformat, width, border, format, type, pixels);
+}
+inline void TexImage2D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    return ::glTexImage2D (target, level, internalformat, width, height, border, format, type, pixels);
+}
+inline void DrawBuffer (GLenum buf)
+{
+    return ::glDrawBuffer (buf);
+}
+inline void Clear (GLbitfield mask)
+{
+    return ::glClear (mask);
+}
+inline void ClearColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    return ::glClearColor (red, green, blue, alpha);
+}
+inline void ClearStencil (GLint s)
+{
+    return ::glClearStencil (s);
+}
+inline void ClearDepth (GLdouble depth)
+{
+    return ::glClearDepth (depth);
+}
+inline void StencilMask (GLuint mask)
+{
+    return ::glStencilMask (mask);
+}
+inline void ColorMask (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+    return ::glColorMask (red, green, blue, alpha);
+}
+inline void DepthMask (GLboolean flag)
+{
+    return ::glDepthMask (flag);
+}
+inline void Disable (GLenum cap)
+{
+    return ::glDisable (cap);
+}
+inline void Enable (GLenum cap)
+{
+    return ::glEnable (cap);
+}
+inline void Finish (void)
+{
+    return ::glFinish ();
+}
+inline void Flush (void)
+{
+    return ::glFlush ();
+}
+inline void BlendFunc (GLenum sfactor, GLenum dfactor)
+{
+    return ::glBlendFunc (sfactor, dfactor);
+}
+inline void LogicOp (GLenum opcode)
+{
+    return ::glLogicOp (opcode);
+}
+inline void StencilFunc (GLenum func, GLint ref, GLuint mask)
+{
+    return ::glStencilFunc (func, ref, mask);
+}
+inline void StencilOp (GLenum fail, GLenum zfail, GLenum zpass)
+{
+    return ::glStencilOp (fail, zfail, zpass);
+}
+inline void DepthFunc (GLenum func)
+{
+    return ::glDepthFunc (func);
+}
+inline void PixelStoref (GLenum pname, GLfloat param)
+{
+    return ::glPixelStoref (pname, param);
+}
+inline void PixelStorei (GLenum pname, GLint param)
+{
+    return ::glPixelStorei (pname, param);
+}
+inline void ReadBuffer (GLenum src)
+{
+    return ::glReadBuffer (src);
+}
+inline void ReadPixels (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels)
+{
+    return ::glReadPixels (x, y, width, height, format, type, pixels);
+}
+inline void GetBooleanv (GLenum pname, GLboolean *data)
+{
+    return ::glGetBooleanv (pname, data);
+}
+inline void GetDoublev (GLenum pname, GLdouble *data)
+{
+    return ::glGetDoublev (pname, data);
+}
+inline GLenum GetError (void)
+{
+    return ::glGetError ();
+}
+inline void GetFloatv (GLenum pname, GLfloat *data)
+{
+    return ::glGetFloatv (pname, data);
+}
+inline void GetIntegerv (GLenum pname, GLint *data)
+{
+    return ::glGetIntegerv (pname, data);
+}
+inline const GLubyte * GetString (GLenum name)
+{
+    return ::glGetString (name);
+}
+inline void GetTexImage (GLenum target, GLint level, GLenum format, GLenum type, void *pixels)
+{
+    return ::glGetTexImage (target, level, format, type, pixels);
+}
+inline void GetTexParameterfv (GLenum target, GLenum pname, GLfloat *params)
+{
+    return ::glGetTexParameterfv (target, pname, params);
+}
+inline void GetTexParameteriv (GLenum target, GLenum pname, GLint *params)
+{
+    return ::glGetTexParameteriv (target, pname, params);
+}
+inline void GetTexLevelParameterfv (GLenum target, GLint level, GLenum pname, GLfloat *params)
+{
+    return ::glGetTexLevelParameterfv (target, level, pname, params);
+}
+inline void GetTexLevelParameteriv (GLenum target, GLint level, GLenum pname, GLint *params)
+{
+    return ::glGetTexLevelParameteriv (target, level, pname, params);
+}
+inline GLboolean IsEnabled (GLenum cap)
+{
+    return ::glIsEnabled (cap);
+}
+inline void DepthRange (GLdouble near, GLdouble far)
+{
+    return ::glDepthRange (near, far);
+}
+inline void Viewport (GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    return ::glViewport (x, y, width, height);
+}
+inline void DrawArrays (GLenum mode, GLint first, GLsizei count)
+{
+    return ::glDrawArrays (mode, first, count);
+}
+inline void DrawElements (GLenum mode, GLsizei count, GLenum type, const void *indices)
+{
+    return ::glDrawElements (mode, count, type, indices);
+}
+inline void GetPointerv (GLenum pname, void **params)
+{
+    return ::glGetPointerv (pname, params);
+}
+inline void PolygonOffset (GLfloat factor, GLfloat units)
+{
+    return ::glPolygonOffset (factor, units);
+}
+inline void CopyTexImage1D (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+{
+    return ::glCopyTexImage1D (target, level, internalformat, x, y, width, border);
+}
+inline void CopyTexImage2D (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+{
+    return ::glCopyTexImage2D (target, level, internalformat, x, y, width, height, border);
+}
+inline void CopyTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+    return ::glCopyTexSubImage1D (target, level, xoffset, x, y, width);
+}
+inline void CopyTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    return ::glCopyTexSubImage2D (target, level, xoffset, yoffset, x, y, width, height);
+}
+inline void TexSubImage1D (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels)
+{
+    return ::glTexSubImage1D (target, level, xoffset, width, format, type, pixels);
+}
+inline void TexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+    return ::glTexSubImage2D (target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+inline void BindTexture (GLenum target, GLuint texture)
+{
+    return ::glBindTexture (target, texture);
+}
+inline void DeleteTextures (GLsizei n, const GLuint *textures)
+{
+    return ::glDeleteTextures (n, textures);
+}
+inline void GenTextures (GLsizei n, GLuint *textures)
+{
+    return ::glGenTextures (n, textures);
+}
+inline GLboolean IsTexture (GLuint texture)
+{
+    return ::glIsTexture (texture);
+}
+inline void DrawRangeElements (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices)
+{
+    return ::glDrawRangeElements (mode, start, end, count, type, indices);
+}
+inline void TexImage3D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    return ::glTexImage3D (target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+inline void TexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels)
+{
+    return ::glTexSubImage3D (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+inline void CopyTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    return ::glCopyTexSubImage3D (target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+inline void ActiveTexture (GLenum texture)
+{
+    return ::glActiveTexture (texture);
+}
+inline void SampleCoverage (GLfloat value, GLboolean invert)
+{
+    return ::glSampleCoverage (value, invert);
+}
+inline void CompressedTexImage3D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data)
+{
+    return ::glCompressedTexImage3D (target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+inline void CompressedTexImage2D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data)
+{
+    return ::glCompressedTexImage2D (target, level, internalformat, width, height, border, imageSize, data);
+}
+inline void CompressedTexImage1D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data)
+{
+    return ::glCompressedTexImage1D (target, level, internalformat, width, border, imageSize, data);
+}
+inline void CompressedTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+{
+    return ::glCompressedTexSubImage3D (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+inline void CompressedTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+{
+    return ::glCompressedTexSubImage2D (target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+inline void CompressedTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
+{
+    return ::glCompressedTexSubImage1D (target, level, xoffset, width, format, imageSize, data);
+}
+inline void GetCompressedTexImage (GLenum target, GLint level, void *img)
+{
+    return ::glGetCompressedTexImage (target, level, img);
+}
+inline void BlendFuncSeparate (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+    return ::glBlendFuncSeparate (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+inline void MultiDrawArrays (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount)
+{
+    return ::glMultiDrawArrays (mode, first, count, drawcount);
+}
+inline void MultiDrawElements (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount)
+{
+    return ::glMultiDrawElements (mode, count, type, indices, drawcount);
+}
+inline void PointParameterf (GLenum pname, GLfloat param)
+{
+    return ::glPointParameterf (pname, param);
+}
+inline void PointParameterfv (GLenum pname, const GLfloat *params)
+{
+    return ::glPointParameterfv (pname, params);
+}
+inline void PointParameteri (GLenum pname, GLint param)
+{
+    return ::glPointParameteri (pname, param);
+}
+inline void PointParameteriv (GLenum pname, const GLint *params)
+{
+    return ::glPointParameteriv (pname, params);
+}
+inline void BlendColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    return ::glBlendColor (red, green, blue, alpha);
+}
+inline void BlendEquation (GLenum mode)
+{
+    return ::glBlendEquation (mode);
+}
+inline void GenQueries (GLsizei n, GLuint *ids)
+{
+    return ::glGenQueries (n, ids);
+}
+inline void DeleteQueries (GLsizei n, const GLuint *ids)
+{
+    return ::glDeleteQueries (n, ids);
+}
+inline GLboolean IsQuery (GLuint id)
+{
+    return ::glIsQuery (id);
+}
+inline void BeginQuery (GLenum target, GLuint id)
+{
+    return ::glBeginQuery (target, id);
+}
+inline void EndQuery (GLenum target)
+{
+    return ::glEndQuery (target);
+}
+inline void GetQueryiv (GLenum target, GLenum pname, GLint *params)
+{
+    return ::glGetQueryiv (target, pname, params);
+}
+inline void GetQueryObjectiv (GLuint id, GLenum pname, GLint *params)
+{
+    return ::glGetQueryObjectiv (id, pname, params);
+}
+inline void GetQueryObjectuiv (GLuint id, GLenum pname, GLuint *params)
+{
+    return ::glGetQueryObjectuiv (id, pname, params);
+}
+inline void BindBuffer (GLenum target, GLuint buffer)
+{
+    return ::glBindBuffer (target, buffer);
+}
+inline void DeleteBuffers (GLsizei n, const GLuint *buffers)
+{
+    return ::glDeleteBuffers (n, buffers);
+}
+inline void GenBuffers (GLsizei n, GLuint *buffers)
+{
+    return ::glGenBuffers (n, buffers);
+}
+inline GLboolean IsBuffer (GLuint buffer)
+{
+    return ::glIsBuffer (buffer);
+}
+inline void BufferData (GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+{
+    return ::glBufferData (target, size, data, usage);
+}
+inline void BufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    return ::glBufferSubData (target, offset, size, data);
+}
+inline void GetBufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, void *data)
+{
+    return ::glGetBufferSubData (target, offset, size, data);
+}
+inline void * MapBuffer (GLenum target, GLenum access)
+{
+    return ::glMapBuffer (target, access);
+}
+inline GLboolean UnmapBuffer (GLenum target)
+{
+    return ::glUnmapBuffer (target);
+}
+inline void GetBufferParameteriv (GLenum target, GLenum pname, GLint *params)
+{
+    return ::glGetBufferParameteriv (target, pname, params);
+}
+inline void GetBufferPointerv (GLenum target, GLenum pname, void **params)
+{
+    return ::glGetBufferPointerv (target, pname, params);
+}
+inline void BlendEquationSeparate (GLenum modeRGB, GLenum modeAlpha)
+{
+    return ::glBlendEquationSeparate (modeRGB, modeAlpha);
+}
+inline void DrawBuffers (GLsizei n, const GLenum *bufs)
+{
+    return ::glDrawBuffers (n, bufs);
+}
+inline void StencilOpSeparate (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
+{
+    return ::glStencilOpSeparate (face, sfail, dpfail, dppass);
+}
+inline void StencilFuncSeparate (GLenum face, GLenum func, GLint ref, GLuint mask)
+{
+    return ::glStencilFuncSeparate (face, func, ref, mask);
+}
+inline void StencilMaskSeparate (GLenum face, GLuint mask)
+{
+    return ::glStencilMaskSeparate (face, mask);
+}
+inline void AttachShader (GLuint program, GLuint shader)
+{
+    return ::glAttachShader (program, shader);
+}
+inline void BindAttribLocation (GLuint program, GLuint index, const GLchar *name)
+{
+    return ::glBindAttribLocation (program, index, name);
+}
+inline void CompileShader (GLuint shader)
+{
+    return ::glCompileShader (shader);
+}
+inline GLuint CreateProgram (void)
+{
+    return ::glCreateProgram ();
+}
+inline GLuint CreateShader (GLenum type)
+{
+    return ::glCreateShader (type);
+}
+inline void DeleteProgram (GLuint program)
+{
+    return ::glDeleteProgram (program);
+}
+inline void DeleteShader (GLuint shader)
+{
+    return ::glDeleteShader (shader);
+}
+inline void DetachShader (GLuint program, GLuint shader)
+{
+    return ::glDetachShader (program, shader);
+}
+inline void DisableVertexAttribArray (GLuint index)
+{
+    return ::glDisableVertexAttribArray (index);
+}
+inline void EnableVertexAttribArray (GLuint index)
+{
+    return ::glEnableVertexAttribArray (index);
+}
+inline void GetActiveAttrib (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+    return ::glGetActiveAttrib (program, index, bufSize, length, size, type, name);
+}
+inline void GetActiveUniform (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+    return ::glGetActiveUniform (program, index, bufSize, length, size, type, name);
+}
+inline void GetAttachedShaders (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders)
+{
+    return ::glGetAttachedShaders (program, maxCount, count, shaders);
+}
+inline GLint GetAttribLocation (GLuint program, const GLchar *name)
+{
+    return ::glGetAttribLocation (program, name);
+}
+inline void GetProgramiv (GLuint program, GLenum pname, GLint *params)
+{
+    return ::glGetProgramiv (program, pname, params);
+}
+inline void GetProgramInfoLog (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    return ::glGetProgramInfoLog (program, bufSize, length, infoLog);
+}
+inline void GetShaderiv (GLuint shader, GLenum pname, GLint *params)
+{
+    return ::glGetShaderiv (shader, pname, params);
+}
+inline void GetShaderInfoLog (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    return ::glGetShaderInfoLog (shader, bufSize, length, infoLog);
+}
+inline void GetShaderSource (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source)
+{
+    return ::glGetShaderSource (shader, bufSize, length, source);
+}
+inline GLint GetUniformLocation (GLuint program, const GLchar *name)
+{
+    return ::glGetUniformLocation (program, name);
+}
+inline void GetUniformfv (GLuint program, GLint location, GLfloat *params)
+{
+    return ::glGetUniformfv (program, location, params);
+}
+inline void GetUniformiv (GLuint program, GLint location, GLint *params)
+{
+    return ::glGetUniformiv (program, location, params);
+}
+inline void GetVertexAttribdv (GLuint index, GLenum pname, GLdouble *params)
+{
+    return ::glGetVertexAttribdv (index, pname, params);
+}
+inline void GetVertexAttribfv (GLuint index, GLenum pname, GLfloat *params)
+{
+    return ::glGetVertexAttribfv (index, pname, params);
+}
+inline void GetVertexAttribiv (GLuint index, GLenum pname, GLint *params)
+{
+    return ::glGetVertexAttribiv (index, pname, params);
+}
+inline void GetVertexAttribPointerv (GLuint index, GLenum pname, void **pointer)
+{
+    return ::glGetVertexAttribPointerv (index, pname, pointer);
+}
+inline GLboolean IsProgram (GLuint program)
+{
+    return ::glIsProgram (program);
+}
+inline GLboolean IsShader (GLuint shader)
+{
+    return ::glIsShader (shader);
+}
+inline void LinkProgram (GLuint program)
+{
+    return ::glLinkProgram (program);
+}
+inline void ShaderSource (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length)
+{
+    return ::glShaderSource (shader, count, string, length);
+}
+inline void UseProgram (GLuint program)
+{
+    return ::glUseProgram (program);
+}
+inline void Uniform1f (GLint location, GLfloat v0)
+{
+    return ::glUniform1f (location, v0);
+}
+inline void Uniform2f (GLint location, GLfloat v0, GLfloat v1)
+{
+    return ::glUniform2f (location, v0, v1);
+}
+inline void Uniform3f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    return ::glUniform3f (location, v0, v1, v2);
+}
+inline void Uniform4f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+    return ::glUniform4f (location, v0, v1, v2, v3);
+}
+inline void Uniform1i (GLint location, GLint v0)
+{
+    return ::glUniform1i (location, v0);
+}
+inline void Uniform2i (GLint location, GLint v0, GLint v1)
+{
+    return ::glUniform2i (location, v0, v1);
+}
+inline void Uniform3i (GLint location, GLint v0, GLint v1, GLint v2)
+{
+    return ::glUniform3i (location, v0, v1, v2);
+}
+inline void Uniform4i (GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    return ::glUniform4i (location, v0, v1, v2, v3);
+}
+inline void Uniform1fv (GLint location, GLsizei count, const GLfloat *value)
+{
+    return ::glUniform1fv (location, count, value);
+}
+inline void Uniform2fv (GLint location, GLsizei count, const GLfloat *value)
+{
+    return ::glUniform2fv (location, count, value);
+}
+inline void Uniform3fv (GLint location, GLsizei count, const GLfloat *value)
+{
+    return ::glUniform3fv (location, count, value);
+}
+inline void Uniform4fv (GLint location, GLsizei count, const GLfloat *value)
+{
+    return ::glUniform4fv (location, count, value);
+}
+inline void Uniform1iv (GLint location, GLsizei count, const GLint *value)
+{
+    return ::glUniform1iv (location, count, value);
+}
+inline void Uniform2iv (GLint location, GLsizei count, const GLint *value)
+{
+    return ::glUniform2iv (location, count, value);
+}
+inline void Uniform3iv (GLint location, GLsizei count, const GLint *value)
+{
+    return ::glUniform3iv (location, count, value);
+}
+inline void Uniform4iv (GLint location, GLsizei count, const GLint *value)
+{
+    return ::glUniform4iv (location, count, value);
+}
+inline void UniformMatrix2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return ::glUniformMatrix2fv (location, count, transpose, value);
+}
+inline void UniformMatrix3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return ::glUniformMatrix3fv (location, count, transpose, value);
+}
+inline void UniformMatrix4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return ::glUniformMatrix4fv (location, count, transpose, value);
+}
+inline void ValidateProgram (GLuint program)
+{
+    return ::glValidateProgram (program);
+}
+inline void VertexAttrib1d (GLuint index, GLdouble x)
+{
+    return ::glVertexAttrib1d (index, x);
+}
+inline void VertexAttrib1dv (GLuint index, const GLdouble *v)
+{
+    return ::glVertexAttrib1dv (index, v);
+}
+inline void VertexAttrib1f (GLuint index, GLfloat x)
+{
+    return ::glVertexAttrib1f (index, x);
+}
+inline void VertexAttrib1fv (GLuint index, const GLfloat *v)
+{
+    return ::glVertexAttrib1fv (index, v);
+}
+inline void VertexAttrib1s (GLuint index, GLshort x)
+{
+    return ::glVertexAttrib1s (index, x);
+}
+inline void VertexAttrib1sv (GLuint index, const GLshort *v)
+{
+    return ::glVertexAttrib1sv (index, v);
+}
+inline void VertexAttrib2d (GLuint index, GLdouble x, GLdouble y)
+{
+    return ::glVertexAttrib2d (index, x, y);
+}
+inline void VertexAttrib2dv (GLuint index, const GLdouble *v)
+{
+    return ::glVertexAttrib2dv (index, v);
+}
+inline void VertexAttrib2f (GLuint index, GLfloat x, GLfloat y)
+{
+    return ::glVertexAttrib2f (index, x, y);
+}
+inline void VertexAttrib2fv (GLuint index, const GLfloat *v)
+{
+    return ::glVertexAttrib2fv (index, v);
+}
+inline void VertexAttrib2s (GLuint index, GLshort x, GLshort y)
+{
+    return ::glVertexAttrib2s (index, x, y);
+}
+inline void VertexAttrib2sv (GLuint index, const GLshort *v)
+{
+    return ::glVertexAttrib2sv (index, v);
+}
+inline void VertexAttrib3d (GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+    return ::glVertexAttrib3d (index, x, y, z);
+}
+inline void VertexAttrib3dv (GLuint index, const GLdouble *v)
+{
+    return ::glVertexAttrib3dv (index, v);
+}
+inline void VertexAttrib3f (GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+    return ::glVertexAttrib3f (index, x, y, z);
+}
+inline void VertexAttrib3fv (GLuint index, const GLfloat *v)
+{
+    return ::glVertexAttrib3fv (index, v);
+}
+inline void VertexAttrib3s (GLuint index, GLshort x, GLshort y, GLshort z)
+{
+    return ::glVertexAttrib3s (index, x, y, z);
+}
+inline void VertexAttrib3sv (GLuint index, const GLshort *v)
+{
+    return ::glVertexAttrib3sv (index, v);
+}
+inline void VertexAttrib4Nbv (GLuint index, const GLbyte *v)
+{
+    return ::glVertexAttrib4Nbv (index, v);
+}
+inline void VertexAttrib4Niv (GLuint index, const GLint *v)
+{
+    return ::glVertexAttrib4Niv (index, v);
+}
+inline void VertexAttrib4Nsv (GLuint index, const GLshort *v)
+{
+    return ::glVertexAttrib4Nsv (index, v);
+}
+inline void VertexAttrib4Nub (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+{
+    return ::glVertexAttrib4Nub (index, x, y, z, w);
+}
+inline void VertexAttrib4Nubv (GLuint index, const GLubyte *v)
+{
+    return ::glVertexAttrib4Nubv (index, v);
+}
+inline void VertexAttrib4Nuiv (GLuint index, const GLuint *v)
+{
+    return ::glVertexAttrib4Nuiv (index, v);
+}
+inline void VertexAttrib4Nusv (GLuint index, const GLushort *v)
+{
+    return ::glVertexAttrib4Nusv (index, v);
+}
+inline void VertexAttrib4bv (GLuint index, const GLbyte *v)
+{
+    return ::glVertexAttrib4bv (index, v);
+}
+inline void VertexAttrib4d (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    return ::glVertexAttrib4d (index, x, y, z, w);
+}
+inline void VertexAttrib4dv (GLuint index, const GLdouble *v)
+{
+    return ::glVertexAttrib4dv (index, v);
+}
+inline void VertexAttrib4f (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    return ::glVertexAttrib4f (index, x, y, z, w);
+}
+inline void VertexAttrib4fv (GLuint index, const GLfloat *v)
+{
+    return ::glVertexAttrib4fv (index, v);
+}
+inline void VertexAttrib4iv (GLuint index, const GLint *v)
+{
+    return ::glVertexAttrib4iv (index, v);
+}
+inline void VertexAttrib4s (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+    return ::glVertexAttrib4s (index, x, y, z, w);
+}
+inline void VertexAttrib4sv (GLuint index, const GLshort *v)
+{
+    return ::glVertexAttrib4sv (index, v);
+}
+inline void VertexAttrib4ubv (GLuint index, const GLubyte *v)
+{
+    return ::glVertexAttrib4ubv (index, v);
+}
+inline void VertexAttrib4uiv (GLuint index, const GLuint *v)
+{
+    return ::glVertexAttrib4uiv (index, v);
+}
+inline void VertexAttrib4usv (GLuint index, const GLushort *v)
+{
+    return ::glVertexAttrib4usv (index, v);
+}
+inline void VertexAttribPointer (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer)
+{
+    return ::glVertexAttribPointer (index, size, type, normalized, stride, pointer);
+}
+inline void UniformMatrix2x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return ::glUniformMatrix2x3fv (location, count, transpose, value);
+}
+inline void UniformMatrix3x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return ::glUniformMatrix3x2fv (location, count, transpose, value);
+}
+inline void UniformMatrix2x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return ::glUniformMatrix2x4fv (location, count, transpose, value);
+}
+inline void UniformMatrix4x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return ::glUniformMatrix4x2fv (location, count, transpose, value);
+}
+inline void UniformMatrix3x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return ::glUniformMatrix3x4fv (location, count, transpose, value);
+}
+inline void UniformMatrix4x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return ::glUniformMatrix4x3fv (location, count, transpose, value);
+}
+inline void ColorMaski (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
+{
+    return ::glColorMaski (index, r, g, b, a);
+}
+inline void GetBooleani_v (GLenum target, GLuint index, GLboolean *data)
+{
+    return ::glGetBooleani_v (target, index, data);
+}
+inline void GetIntegeri_v (GLenum target, GLuint index, GLint *data)
+{
+    return ::glGetIntegeri_v (target, index, data);
+}
+inline void Enablei (GLenum target, GLuint index)
+{
+    return ::glEnablei (target, index);
+}
+inline void Disablei (GLenum target, GLuint index)
+{
+    return ::glDisablei (target, index);
+}
+inline GLboolean IsEnabledi (GLenum target, GLuint index)
+{
+    return ::glIsEnabledi (target, index);
+}
+inline void BeginTransformFeedback (GLenum primitiveMode)
+{
+    return ::glBeginTransformFeedback (primitiveMode);
+}
+inline void EndTransformFeedback (void)
+{
+    return ::glEndTransformFeedback ();
+}
+inline void BindBufferRange (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    return ::glBindBufferRange (target, index, buffer, offset, size);
+}
+inline void BindBufferBase (GLenum target, GLuint index, GLuint buffer)
+{
+    return ::glBindBufferBase (target, index, buffer);
+}
+inline void TransformFeedbackVaryings (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode)
+{
+    return ::glTransformFeedbackVaryings (program, count, varyings, bufferMode);
+}
+inline void GetTransformFeedbackVarying (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name)
+{
+    return ::glGetTransformFeedbackVarying (program, index, bufSize, length, size, type, name);
+}
+inline void ClampColor (GLenum target, GLenum clamp)
+{
+    return ::glClampColor (target, clamp);
+}
+inline void BeginConditionalRender (GLuint id, GLenum mode)
+{
+    return ::glBeginConditionalRender (id, mode);
+}
+inline void EndConditionalRender (void)
+{
+    return ::glEndConditionalRender ();
+}
+inline void VertexAttribIPointer (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+    return ::glVertexAttribIPointer (index, size, type, stride, pointer);
+}
+inline void GetVertexAttribIiv (GLuint index, GLenum pname, GLint *params)
+{
+    return ::glGetVertexAttribIiv (index, pname, params);
+}
+inline void GetVertexAttribIuiv (GLuint index, GLenum pname, GLuint *params)
+{
+    return ::glGetVertexAttribIuiv (index, pname, params);
+}
+inline void VertexAttribI1i (GLuint index, GLint x)
+{
+    return ::glVertexAttribI1i (index, x);
+}
+inline void VertexAttribI2i (GLuint index, GLint x, GLint y)
+{
+    return ::glVertexAttribI2i (index, x, y);
+}
+inline void VertexAttribI3i (GLuint index, GLint x, GLint y, GLint z)
+{
+    return ::glVertexAttribI3i (index, x, y, z);
+}
+inline void VertexAttribI4i (GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+    return ::glVertexAttribI4i (index, x, y, z, w);
+}
+inline void VertexAttribI1ui (GLuint index, GLuint x)
+{
+    return ::glVertexAttribI1ui (index, x);
+}
+inline void VertexAttribI2ui (GLuint index, GLuint x, GLuint y)
+{
+    return ::glVertexAttribI2ui (index, x, y);
+}
+inline void VertexAttribI3ui (GLuint index, GLuint x, GLuint y, GLuint z)
+{
+    return ::glVertexAttribI3ui (index, x, y, z);
+}
+inline void VertexAttribI4ui (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+{
+    return ::glVertexAttribI4ui (index, x, y, z, w);
+}
+inline void VertexAttribI1iv (GLuint index, const GLint *v)
+{
+    return ::glVertexAttribI1iv (index, v);
+}
+inline void VertexAttribI2iv (GLuint index, const GLint *v)
+{
+    return ::glVertexAttribI2iv (index, v);
+}
+inline void VertexAttribI3iv (GLuint index, const GLint *v)
+{
+    return ::glVertexAttribI3iv (index, v);
+}
+inline void VertexAttribI4iv (GLuint index, const GLint *v)
+{
+    return ::glVertexAttribI4iv (index, v);
+}
+inline void VertexAttribI1uiv (GLuint index, const GLuint *v)
+{
+    return ::glVertexAttribI1uiv (index, v);
+}
+inline void VertexAttribI2uiv (GLuint index, const GLuint *v)
+{
+    return ::glVertexAttribI2uiv (index, v);
+}
+inline void VertexAttribI3uiv (GLuint index, const GLuint *v)
+{
+    return ::glVertexAttribI3uiv (index, v);
+}
+inline void VertexAttribI4uiv (GLuint index, const GLuint *v)
+{
+    return ::glVertexAttribI4uiv (index, v);
+}
+inline void VertexAttribI4bv (GLuint index, const GLbyte *v)
+{
+    return ::glVertexAttribI4bv (index, v);
+}
+inline void VertexAttribI4sv (GLuint index, const GLshort *v)
+{
+    return ::glVertexAttribI4sv (index, v);
+}
+inline void VertexAttribI4ubv (GLuint index, const GLubyte *v)
+{
+    return ::glVertexAttribI4ubv (index, v);
+}
+inline void VertexAttribI4usv (GLuint index, const GLushort *v)
+{
+    return ::glVertexAttribI4usv (index, v);
+}
+inline void GetUniformuiv (GLuint program, GLint location, GLuint *params)
+{
+    return ::glGetUniformuiv (program, location, params);
+}
+inline void BindFragDataLocation (GLuint program, GLuint color, const GLchar *name)
+{
+    return ::glBindFragDataLocation (program, color, name);
+}
+inline GLint GetFragDataLocation (GLuint program, const GLchar *name)
+{
+    return ::glGetFragDataLocation (program, name);
+}
+inline void Uniform1ui (GLint location, GLuint v0)
+{
+    return ::glUniform1ui (location, v0);
+}
+inline void Uniform2ui (GLint location, GLuint v0, GLuint v1)
+{
+    return ::glUniform2ui (location, v0, v1);
+}
+inline void Uniform3ui (GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+    return ::glUniform3ui (location, v0, v1, v2);
+}
+inline void Uniform4ui (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+    return ::glUniform4ui (location, v0, v1, v2, v3);
+}
+inline void Uniform1uiv (GLint location, GLsizei count, const GLuint *value)
+{
+    return ::glUniform1uiv (location, count, value);
+}
+inline void Uniform2uiv (GLint location, GLsizei count, const GLuint *value)
+{
+    return ::glUniform2uiv (location, count, value);
+}
+inline void Uniform3uiv (GLint location, GLsizei count, const GLuint *value)
+{
+    return ::glUniform3uiv (location, count, value);
+}
+inline void Uniform4uiv (GLint location, GLsizei count, const GLuint *value)
+{
+    return ::glUniform4uiv (location, count, value);
+}
+inline void TexParameterIiv (GLenum target, GLenum pname, const GLint *params)
+{
+    return ::glTexParameterIiv (target, pname, params);
+}
+inline void TexParameterIuiv (GLenum target, GLenum pname, const GLuint *params)
+{
+    return ::glTexParameterIuiv (target, pname, params);
+}
+inline void GetTexParameterIiv (GLenum target, GLenum pname, GLint *params)
+{
+    return ::glGetTexParameterIiv (target, pname, params);
+}
+inline void GetTexParameterIuiv (GLenum target, GLenum pname, GLuint *params)
+{
+    return ::glGetTexParameterIuiv (target, pname, params);
+}
+inline void ClearBufferiv (GLenum buffer, GLint drawbuffer, const GLint *value)
+{
+    return ::glClearBufferiv (buffer, drawbuffer, value);
+}
+inline void ClearBufferuiv (GLenum buffer, GLint drawbuffer, const GLuint *value)
+{
+    return ::glClearBufferuiv (buffer, drawbuffer, value);
+}
+inline void ClearBufferfv (GLenum buffer, GLint drawbuffer, const GLfloat *value)
+{
+    return ::glClearBufferfv (buffer, drawbuffer, value);
+}
+inline void ClearBufferfi (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
+{
+    return ::glClearBufferfi (buffer, drawbuffer, depth, stencil);
+}
+inline const GLubyte * GetStringi (GLenum name, GLuint index)
+{
+    return ::glGetStringi (name, index);
+}
+inline GLboolean IsRenderbuffer (GLuint renderbuffer)
+{
+    return ::glIsRenderbuffer (renderbuffer);
+}
+inline void BindRenderbuffer (GLenum target, GLuint renderbuffer)
+{
+    return ::glBindRenderbuffer (target, renderbuffer);
+}
+inline void DeleteRenderbuffers (GLsizei n, const GLuint *renderbuffers)
+{
+    return ::glDeleteRenderbuffers (n, renderbuffers);
+}
+inline void GenRenderbuffers (GLsizei n, GLuint *renderbuffers)
+{
+    return ::glGenRenderbuffers (n, renderbuffers);
+}
+inline void RenderbufferStorage (GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    return ::glRenderbufferStorage (target, internalformat, width, height);
+}
+inline void GetRenderbufferParameteriv (GLenum target, GLenum pname, GLint *params)
+{
+    return ::glGetRenderbufferParameteriv (target, pname, params);
+}
+inline GLboolean IsFramebuffer (GLuint framebuffer)
+{
+    return ::glIsFramebuffer (framebuffer);
+}
+inline void BindFramebuffer (GLenum target, GLuint framebuffer)
+{
+    return ::glBindFramebuffer (target, framebuffer);
+}
+inline void DeleteFramebuffers (GLsizei n, const GLuint *framebuffers)
+{
+    return ::glDeleteFramebuffers (n, framebuffers);
+}
+inline void GenFramebuffers (GLsizei n, GLuint *framebuffers)
+{
+    return ::glGenFramebuffers (n, framebuffers);
+}
+inline GLenum CheckFramebufferStatus (GLenum target)
+{
+    return ::glCheckFramebufferStatus (target);
+}
+inline void FramebufferTexture1D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    return ::glFramebufferTexture1D (target, attachment, textarget, texture, level);
+}
+inline void FramebufferTexture2D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    return ::glFramebufferTexture2D (target, attachment, textarget, texture, level);
+}
+inline void FramebufferTexture3D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
+{
+    return ::glFramebufferTexture3D (target, attachment, textarget, texture, level, zoffset);
+}
+inline void FramebufferRenderbuffer (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+    return ::glFramebufferRenderbuffer (target, attachment, renderbuffertarget, renderbuffer);
+}
+inline void GetFramebufferAttachmentParameteriv (GLenum target, GLenum attachment, GLenum pname, GLint *params)
+{
+    return ::glGetFramebufferAttachmentParameteriv (target, attachment, pname, params);
+}
+inline void GenerateMipmap (GLenum target)
+{
+    return ::glGenerateMipmap (target);
+}
+inline void BlitFramebuffer (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+    return ::glBlitFramebuffer (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+inline void RenderbufferStorageMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    return ::glRenderbufferStorageMultisample (target, samples, internalformat, width, height);
+}
+inline void FramebufferTextureLayer (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+    return ::glFramebufferTextureLayer (target, attachment, texture, level, layer);
+}
+inline void * MapBufferRange (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    return ::glMapBufferRange (target, offset, length, access);
+}
+inline void FlushMappedBufferRange (GLenum target, GLintptr offset, GLsizeiptr length)
+{
+    return ::glFlushMappedBufferRange (target, offset, length);
+}
+inline void BindVertexArray (GLuint array)
+{
+    return ::glBindVertexArray (array);
+}
+inline void DeleteVertexArrays (GLsizei n, const GLuint *arrays)
+{
+    return ::glDeleteVertexArrays (n, arrays);
+}
+inline void GenVertexArrays (GLsizei n, GLuint *arrays)
+{
+    return ::glGenVertexArrays (n, arrays);
+}
+inline GLboolean IsVertexArray (GLuint array)
+{
+    return ::glIsVertexArray (array);
+}
+inline void DrawArraysInstanced (GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+{
+    return ::glDrawArraysInstanced (mode, first, count, instancecount);
+}
+inline void DrawElementsInstanced (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount)
+{
+    return ::glDrawElementsInstanced (mode, count, type, indices, instancecount);
+}
+inline void TexBuffer (GLenum target, GLenum internalformat, GLuint buffer)
+{
+    return ::glTexBuffer (target, internalformat, buffer);
+}
+inline void PrimitiveRestartIndex (GLuint index)
+{
+    return ::glPrimitiveRestartIndex (index);
+}
+inline void CopyBufferSubData (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+    return ::glCopyBufferSubData (readTarget, writeTarget, readOffset, writeOffset, size);
+}
+inline void GetUniformIndices (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices)
+{
+    return ::glGetUniformIndices (program, uniformCount, uniformNames, uniformIndices);
+}
+inline void GetActiveUniformsiv (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params)
+{
+    return ::glGetActiveUniformsiv (program, uniformCount, uniformIndices, pname, params);
+}
+inline void GetActiveUniformName (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName)
+{
+    return ::glGetActiveUniformName (program, uniformIndex, bufSize, length, uniformName);
+}
+inline GLuint GetUniformBlockIndex (GLuint program, const GLchar *uniformBlockName)
+{
+    return ::glGetUniformBlockIndex (program, uniformBlockName);
+}
+inline void GetActiveUniformBlockiv (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params)
+{
+    return ::glGetActiveUniformBlockiv (program, uniformBlockIndex, pname, params);
+}
+inline void GetActiveUniformBlockName (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName)
+{
+    return ::glGetActiveUniformBlockName (program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+inline void UniformBlockBinding (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding)
+{
+    return ::glUniformBlockBinding (program, uniformBlockIndex, uniformBlockBinding);
+}
+inline void DrawElementsBaseVertex (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+{
+    return ::glDrawElementsBaseVertex (mode, count, type, indices, basevertex);
+}
+inline void DrawRangeElementsBaseVertex (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+{
+    return ::glDrawRangeElementsBaseVertex (mode, start, end, count, type, indices, basevertex);
+}
+inline void DrawElementsInstancedBaseVertex (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex)
+{
+    return ::glDrawElementsInstancedBaseVertex (mode, count, type, indices, instancecount, basevertex);
+}
+inline void MultiDrawElementsBaseVertex (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex)
+{
+    return ::glMultiDrawElementsBaseVertex (mode, count, type, indices, drawcount, basevertex);
+}
+inline void ProvokingVertex (GLenum mode)
+{
+    return ::glProvokingVertex (mode);
+}
+inline GLsync FenceSync (GLenum condition, GLbitfield flags)
+{
+    return ::glFenceSync (condition, flags);
+}
+inline GLboolean IsSync (GLsync sync)
+{
+    return ::glIsSync (sync);
+}
+inline void DeleteSync (GLsync sync)
+{
+    return ::glDeleteSync (sync);
+}
+inline GLenum ClientWaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    return ::glClientWaitSync (sync, flags, timeout);
+}
+inline void WaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    return ::glWaitSync (sync, flags, timeout);
+}
+inline void GetInteger64v (GLenum pname, GLint64 *data)
+{
+    return ::glGetInteger64v (pname, data);
+}
+inline void GetSynciv (GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values)
+{
+    return ::glGetSynciv (sync, pname, bufSize, length, values);
+}
+inline void GetInteger64i_v (GLenum target, GLuint index, GLint64 *data)
+{
+    return ::glGetInteger64i_v (target, index, data);
+}
+inline void GetBufferParameteri64v (GLenum target, GLenum pname, GLint64 *params)
+{
+    return ::glGetBufferParameteri64v (target, pname, params);
+}
+inline void FramebufferTexture (GLenum target, GLenum attachment, GLuint texture, GLint level)
+{
+    return ::glFramebufferTexture (target, attachment, texture, level);
+}
+inline void TexImage2DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+    return ::glTexImage2DMultisample (target, samples, internalformat, width, height, fixedsamplelocations);
+}
+inline void TexImage3DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+    return ::glTexImage3DMultisample (target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+inline void GetMultisamplefv (GLenum pname, GLuint index, GLfloat *val)
+{
+    return ::glGetMultisamplefv (pname, index, val);
+}
+inline void SampleMaski (GLuint maskNumber, GLbitfield mask)
+{
+    return ::glSampleMaski (maskNumber, mask);
+}
+inline void BindFragDataLocationIndexed (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name)
+{
+    return ::glBindFragDataLocationIndexed (program, colorNumber, index, name);
+}
+inline GLint GetFragDataIndex (GLuint program, const GLchar *name)
+{
+    return ::glGetFragDataIndex (program, name);
+}
+inline void GenSamplers (GLsizei count, GLuint *samplers)
+{
+    return ::glGenSamplers (count, samplers);
+}
+inline void DeleteSamplers (GLsizei count, const GLuint *samplers)
+{
+    return ::glDeleteSamplers (count, samplers);
+}
+inline GLboolean IsSampler (GLuint sampler)
+{
+    return ::glIsSampler (sampler);
+}
+inline void BindSampler (GLuint unit, GLuint sampler)
+{
+    return ::glBindSampler (unit, sampler);
+}
+inline void SamplerParameteri (GLuint sampler, GLenum pname, GLint param)
+{
+    return ::glSamplerParameteri (sampler, pname, param);
+}
+inline void SamplerParameteriv (GLuint sampler, GLenum pname, const GLint *param)
+{
+    return ::glSamplerParameteriv (sampler, pname, param);
+}
+inline void SamplerParameterf (GLuint sampler, GLenum pname, GLfloat param)
+{
+    return ::glSamplerParameterf (sampler, pname, param);
+}
+inline void SamplerParameterfv (GLuint sampler, GLenum pname, const GLfloat *param)
+{
+    return ::glSamplerParameterfv (sampler, pname, param);
+}
+inline void SamplerParameterIiv (GLuint sampler, GLenum pname, const GLint *param)
+{
+    return ::glSamplerParameterIiv (sampler, pname, param);
+}
+inline void SamplerParameterIuiv (GLuint sampler, GLenum pname, const GLuint *param)
+{
+    return ::glSamplerParameterIuiv (sampler, pname, param);
+}
+inline void GetSamplerParameteriv (GLuint sampler, GLenum pname, GLint *params)
+{
+    return ::glGetSamplerParameteriv (sampler, pname, params);
+}
+inline void GetSamplerParameterIiv (GLuint sampler, GLenum pname, GLint *params)
+{
+    return ::glGetSamplerParameterIiv (sampler, pname, params);
+}
+inline void GetSamplerParameterfv (GLuint sampler, GLenum pname, GLfloat *params)
+{
+    return ::glGetSamplerParameterfv (sampler, pname, params);
+}
+inline void GetSamplerParameterIuiv (GLuint sampler, GLenum pname, GLuint *params)
+{
+    return ::glGetSamplerParameterIuiv (sampler, pname, params);
+}
+inline void QueryCounter (GLuint id, GLenum target)
+{
+    return ::glQueryCounter (id, target);
+}
+inline void GetQueryObjecti64v (GLuint id, GLenum pname, GLint64 *params)
+{
+    return ::glGetQueryObjecti64v (id, pname, params);
+}
+inline void GetQueryObjectui64v (GLuint id, GLenum pname, GLuint64 *params)
+{
+    return ::glGetQueryObjectui64v (id, pname, params);
+}
+inline void VertexAttribDivisor (GLuint index, GLuint divisor)
+{
+    return ::glVertexAttribDivisor (index, divisor);
+}
+inline void VertexAttribP1ui (GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    return ::glVertexAttribP1ui (index, type, normalized, value);
+}
+inline void VertexAttribP1uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    return ::glVertexAttribP1uiv (index, type, normalized, value);
+}
+inline void VertexAttribP2ui (GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    return ::glVertexAttribP2ui (index, type, normalized, value);
+}
+inline void VertexAttribP2uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    return ::glVertexAttribP2uiv (index, type, normalized, value);
+}
+inline void VertexAttribP3ui (GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    return ::glVertexAttribP3ui (index, type, normalized, value);
+}
+inline void VertexAttribP3uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    return ::glVertexAttribP3uiv (index, type, normalized, value);
+}
+inline void VertexAttribP4ui (GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    return ::glVertexAttribP4ui (index, type, normalized, value);
+}
+inline void VertexAttribP4uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    return ::glVertexAttribP4uiv (index, type, normalized, value);
+}
+inline void MinSampleShading (GLfloat value)
+{
+    return ::glMinSampleShading (value);
+}
+inline void BlendEquationi (GLuint buf, GLenum mode)
+{
+    return ::glBlendEquationi (buf, mode);
+}
+inline void BlendEquationSeparatei (GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+    return ::glBlendEquationSeparatei (buf, modeRGB, modeAlpha);
+}
+inline void BlendFunci (GLuint buf, GLenum src, GLenum dst)
+{
+    return ::glBlendFunci (buf, src, dst);
+}
+inline void BlendFuncSeparatei (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+    return ::glBlendFuncSeparatei (buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+inline void DrawArraysIndirect (GLenum mode, const void *indirect)
+{
+    return ::glDrawArraysIndirect (mode, indirect);
+}
+inline void DrawElementsIndirect (GLenum mode, GLenum type, const void *indirect)
+{
+    return ::glDrawElementsIndirect (mode, type, indirect);
+}
+inline void Uniform1d (GLint location, GLdouble x)
+{
+    return ::glUniform1d (location, x);
+}
+inline void Uniform2d (GLint location, GLdouble x, GLdouble y)
+{
+    return ::glUniform2d (location, x, y);
+}
+inline void Uniform3d (GLint location, GLdouble x, GLdouble y, GLdouble z)
+{
+    return ::glUniform3d (location, x, y, z);
+}
+inline void Uniform4d (GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    return ::glUniform4d (location, x, y, z, w);
+}
+inline void Uniform1dv (GLint location, GLsizei count, const GLdouble *value)
+{
+    return ::glUniform1dv (location, count, value);
+}
+inline void Uniform2dv (GLint location, GLsizei count, const GLdouble *value)
+{
+    return ::glUniform2dv (location, count, value);
+}
+inline void Uniform3dv (GLint location, GLsizei count, const GLdouble *value)
+{
+    return ::glUniform3dv (location, count, value);
+}
+inline void Uniform4dv (GLint location, GLsizei count, const GLdouble *value)
+{
+    return ::glUniform4dv (location, count, value);
+}
+inline void UniformMatrix2dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return ::glUniformMatrix2dv (location, count, transpose, value);
+}
+inline void UniformMatrix3dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return ::glUniformMatrix3dv (location, count, transpose, value);
+}
+inline void UniformMatrix4dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return ::glUniformMatrix4dv (location, count, transpose, value);
+}
+inline void UniformMatrix2x3dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return ::glUniformMatrix2x3dv (location, count, transpose, value);
+}
+inline void UniformMatrix2x4dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return ::glUniformMatrix2x4dv (location, count, transpose, value);
+}
+inline void UniformMatrix3x2dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return ::glUniformMatrix3x2dv (location, count, transpose, value);
+}
+inline void UniformMatrix3x4dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return ::glUniformMatrix3x4dv (location, count, transpose, value);
+}
+inline void UniformMatrix4x2dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return ::glUniformMatrix4x2dv (location, count, transpose, value);
+}
+inline void UniformMatrix4x3dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return ::glUniformMatrix4x3dv (location, count, transpose, value);
+}
+inline void GetUniformdv (GLuint program, GLint location, GLdouble *params)
+{
+    return ::glGetUniformdv (program, location, params);
+}
+inline GLint GetSubroutineUniformLocation (GLuint program, GLenum shadertype, const GLchar *name)
+{
+    return ::glGetSubroutineUniformLocation (program, shadertype, name);
+}
+inline GLuint GetSubroutineIndex (GLuint program, GLenum shadertype, const GLchar *name)
+{
+    return ::glGetSubroutineIndex (program, shadertype, name);
+}
+inline void GetActiveSubroutineUniformiv (GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values)
+{
+    return ::glGetActiveSubroutineUniformiv (program, shadertype, index, pname, values);
+}
+inline void GetActiveSubroutineUniformName (GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name)
+{
+    return ::glGetActiveSubroutineUniformName (program, shadertype, index, bufsize, length, name);
+}
+inline void GetActiveSubroutineName (GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name)
+{
+    return ::glGetActiveSubroutineName (program, shadertype, index, bufsize, length, name);
+}
+inline void UniformSubroutinesuiv (GLenum shadertype, GLsizei count, const GLuint *indices)
+{
+    return ::glUniformSubroutinesuiv (shadertype, count, indices);
+}
+inline void GetUniformSubroutineuiv (GLenum shadertype, GLint location, GLuint *params)
+{
+    return ::glGetUniformSubroutineuiv (shadertype, location, params);
+}
+inline void GetProgramStageiv (GLuint program, GLenum shadertype, GLenum pname, GLint *values)
+{
+    return ::glGetProgramStageiv (program, shadertype, pname, values);
+}
+inline void PatchParameteri (GLenum pname, GLint value)
+{
+    return ::glPatchParameteri (pname, value);
+}
+inline void PatchParameterfv (GLenum pname, const GLfloat *values)
+{
+    return ::glPatchParameterfv (pname, values);
+}
+inline void BindTransformFeedback (GLenum target, GLuint id)
+{
+    return ::glBindTransformFeedback (target, id);
+}
+inline void DeleteTransformFeedbacks (GLsizei n, const GLuint *ids)
+{
+    return ::glDeleteTransformFeedbacks (n, ids);
+}
+inline void GenTransformFeedbacks (GLsizei n, GLuint *ids)
+{
+    return ::glGenTransformFeedbacks (n, ids);
+}
+inline GLboolean IsTransformFeedback (GLuint id)
+{
+    return ::glIsTransformFeedback (id);
+}
+inline void PauseTransformFeedback (void)
+{
+    return ::glPauseTransformFeedback ();
+}
+inline void ResumeTransformFeedback (void)
+{
+    return ::glResumeTransformFeedback ();
+}
+inline void DrawTransformFeedback (GLenum mode, GLuint id)
+{
+    return ::glDrawTransformFeedback (mode, id);
+}
+inline void DrawTransformFeedbackStream (GLenum mode, GLuint id, GLuint stream)
+{
+    return ::glDrawTransformFeedbackStream (mode, id, stream);
+}
+inline void BeginQueryIndexed (GLenum target, GLuint index, GLuint id)
+{
+    return ::glBeginQueryIndexed (target, index, id);
+}
+inline void EndQueryIndexed (GLenum target, GLuint index)
+{
+    return ::glEndQueryIndexed (target, index);
+}
+inline void GetQueryIndexediv (GLenum target, GLuint index, GLenum pname, GLint *params)
+{
+    return ::glGetQueryIndexediv (target, index, pname, params);
+}
+inline void ReleaseShaderCompiler (void)
+{
+    return ::glReleaseShaderCompiler ();
+}
+inline void ShaderBinary (GLsizei count, const GLuint *shaders, GLenum binaryformat, const void *binary, GLsizei length)
+{
+    return ::glShaderBinary (count, shaders, binaryformat, binary, length);
+}
+inline void GetShaderPrecisionFormat (GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision)
+{
+    return ::glGetShaderPrecisionFormat (shadertype, precisiontype, range, precision);
+}
+inline void DepthRangef (GLfloat n, GLfloat f)
+{
+    return ::glDepthRangef (n, f);
+}
+inline void ClearDepthf (GLfloat d)
+{
+    return ::glClearDepthf (d);
+}
+inline void GetProgramBinary (GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary)
+{
+    return ::glGetProgramBinary (program, bufSize, length, binaryFormat, binary);
+}
+inline void ProgramBinary (GLuint program, GLenum binaryFormat, const void *binary, GLsizei length)
+{
+    return ::glProgramBinary (program, binaryFormat, binary, length);
+}
+inline void ProgramParameteri (GLuint program, GLenum pname, GLint value)
+{
+    return ::glProgramParameteri (program, pname, value);
+}
+inline void UseProgramStages (GLuint pipeline, GLbitfield stages, GLuint program)
+{
+    return ::glUseProgramStages (pipeline, stages, program);
+}
+inline void ActiveShaderProgram (GLuint pipeline, GLuint program)
+{
+    return ::glActiveShaderProgram (pipeline, program);
+}
+inline GLuint CreateShaderProgramv (GLenum type, GLsizei count, const GLchar *const*strings)
+{
+    return ::glCreateShaderProgramv (type, count, strings);
+}
+inline void BindProgramPipeline (GLuint pipeline)
+{
+    return ::glBindProgramPipeline (pipeline);
+}
+inline void DeleteProgramPipelines (GLsizei n, const GLuint *pipelines)
+{
+    return ::glDeleteProgramPipelines (n, pipelines);
+}
+inline void GenProgramPipelines (GLsizei n, GLuint *pipelines)
+{
+    return ::glGenProgramPipelines (n, pipelines);
+}
+inline GLboolean IsProgramPipeline (GLuint pipeline)
+{
+    return ::glIsProgramPipeline (pipeline);
+}
+inline void GetProgramPipelineiv (GLuint pipeline, GLenum pname, GLint *params)
+{
+    return ::glGetProgramPipelineiv (pipeline, pname, params);
+}
+inline void ProgramUniform1i (GLuint program, GLint location, GLint v0)
+{
+    return ::glProgramUniform1i (program, location, v0);
+}
+inline void ProgramUniform1iv (GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+    return ::glProgramUniform1iv (program, location, count, value);
+}
+inline void ProgramUniform1f (GLuint program, GLint location, GLfloat v0)
+{
+    return ::glProgramUniform1f (program, location, v0);
+}
+inline void ProgramUniform1fv (GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+    return ::glProgramUniform1fv (program, location, count, value);
+}
+inline void ProgramUniform1d (GLuint program, GLint location, GLdouble v0)
+{
+    return ::glProgramUniform1d (program, location, v0);
+}
+inline void ProgramUniform1dv (GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+    return ::glProgramUniform1dv (program, location, count, value);
+}
+inline void ProgramUniform1ui (GLuint program, GLint location, GLuint v0)
+{
+    return ::glProgramUniform1ui (program, location, v0);
+}
+inline void ProgramUniform1uiv (GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+    return ::glProgramUniform1uiv (program, location, count, value);
+}
+inline void ProgramUniform2i (GLuint program, GLint location, GLint v0, GLint v1)
+{
+    return ::glProgramUniform2i (program, location, v0, v1);
+}
+inline void ProgramUniform2iv (GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+    return ::glProgramUniform2iv (program, location, count, value);
+}
+inline void ProgramUniform2f (GLuint program, GLint location, GLfloat v0, GLfloat v1)
+{
+    return ::glProgramUniform2f (program, location, v0, v1);
+}
+inline void ProgramUniform2fv (GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+    return ::glProgramUniform2fv (program, location, count, value);
+}
+inline void ProgramUniform2d (GLuint program, GLint location, GLdouble v0, GLdouble v1)
+{
+    return ::glProgramUniform2d (program, location, v0, v1);
+}
+inline void ProgramUniform2dv (GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+    return ::glProgramUniform2dv (program, location, count, value);
+}
+inline void ProgramUniform2ui (GLuint program, GLint location, GLuint v0, GLuint v1)
+{
+    return ::glProgramUniform2ui (program, location, v0, v1);
+}
+inline void ProgramUniform2uiv (GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+    return ::glProgramUniform2uiv (program, location, count, value);
+}
+inline void ProgramUniform3i (GLuint program, GLint location, GLint v0, GLint v1, GLint v2)
+{
+    return ::glProgramUniform3i (program, location, v0, v1, v2);
+}
+inline void ProgramUniform3iv (GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+    return ::glProgramUniform3iv (program, location, count, value);
+}
+inline void ProgramUniform3f (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    return ::glProgramUniform3f (program, location, v0, v1, v2);
+}
+inline void ProgramUniform3fv (GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+    return ::glProgramUniform3fv (program, location, count, value);
+}
+inline void ProgramUniform3d (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2)
+{
+    return ::glProgramUniform3d (program, location, v0, v1, v2);
+}
+inline void ProgramUniform3dv (GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+    return ::glProgramUniform3dv (program, location, count, value);
+}
+inline void ProgramUniform3ui (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+    return ::glProgramUniform3ui (program, location, v0, v1, v2);
+}
+inline void ProgramUniform3uiv (GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+    return ::glProgramUniform3uiv (program, location, count, value);
+}
+inline void ProgramUniform4i (GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    return ::glProgramUniform4i (program, location, v0, v1, v2, v3);
+}
+inline void ProgramUniform4iv (GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+    return ::glProgramUniform4iv (program, location, count, value);
+}
+inline void ProgramUniform4f (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+    return ::glProgramUniform4f (program, location, v0, v1, v2, v3);
+}
+inline void ProgramUniform4fv (GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+    return ::glProgramUniform4fv (program, location, count, value);
+}
+inline void ProgramUniform4d (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3)
+{
+    return ::glProgramUniform4d (program, location, v0, v1, v2, v3);
+}
+inline void ProgramUniform4dv (GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+    return ::glProgramUniform4dv (program, location, count, value);
+}
+inline void ProgramUniform4ui (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+    return ::glProgramUniform4ui (program, location, v0, v1, v2, v3);
+}
+inline void ProgramUniform4uiv (GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+    return ::glProgramUniform4uiv (program, location, count, value);
+}
+inline void ProgramUniformMatrix2fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return ::glProgramUniformMatrix2fv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix3fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return ::glProgramUniformMatrix3fv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix4fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return ::glProgramUniformMatrix4fv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix2dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return ::glProgramUniformMatrix2dv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix3dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return ::glProgramUniformMatrix3dv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix4dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return ::glProgramUniformMatrix4dv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix2x3fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return ::glProgramUniformMatrix2x3fv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix3x2fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return ::glProgramUniformMatrix3x2fv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix2x4fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return ::glProgramUniformMatrix2x4fv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix4x2fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return ::glProgramUniformMatrix4x2fv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix3x4fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return ::glProgramUniformMatrix3x4fv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix4x3fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    return ::glProgramUniformMatrix4x3fv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix2x3dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return ::glProgramUniformMatrix2x3dv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix3x2dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return ::glProgramUniformMatrix3x2dv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix2x4dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return ::glProgramUniformMatrix2x4dv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix4x2dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return ::glProgramUniformMatrix4x2dv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix3x4dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return ::glProgramUniformMatrix3x4dv (program, location, count, transpose, value);
+}
+inline void ProgramUniformMatrix4x3dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    return ::glProgramUniformMatrix4x3dv (program, location, count, transpose, value);
+}
+inline void ValidateProgramPipeline (GLuint pipeline)
+{
+    return ::glValidateProgramPipeline (pipeline);
+}
+inline void GetProgramPipelineInfoLog (GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    return ::glGetProgramPipelineInfoLog (pipeline, bufSize, length, infoLog);
+}
+inline void VertexAttribL1d (GLuint index, GLdouble x)
+{
+    return ::glVertexAttribL1d (index, x);
+}
+inline void VertexAttribL2d (GLuint index, GLdouble x, GLdouble y)
+{
+    return ::glVertexAttribL2d (index, x, y);
+}
+inline void VertexAttribL3d (GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+    return ::glVertexAttribL3d (index, x, y, z);
+}
+inline void VertexAttribL4d (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    return ::glVertexAttribL4d (index, x, y, z, w);
+}
+inline void VertexAttribL1dv (GLuint index, const GLdouble *v)
+{
+    return ::glVertexAttribL1dv (index, v);
+}
+inline void VertexAttribL2dv (GLuint index, const GLdouble *v)
+{
+    return ::glVertexAttribL2dv (index, v);
+}
+inline void VertexAttribL3dv (GLuint index, const GLdouble *v)
+{
+    return ::glVertexAttribL3dv (index, v);
+}
+inline void VertexAttribL4dv (GLuint index, const GLdouble *v)
+{
+    return ::glVertexAttribL4dv (index, v);
+}
+inline void VertexAttribLPointer (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+    return ::glVertexAttribLPointer (index, size, type, stride, pointer);
+}
+inline void GetVertexAttribLdv (GLuint index, GLenum pname, GLdouble *params)
+{
+    return ::glGetVertexAttribLdv (index, pname, params);
+}
+inline void ViewportArrayv (GLuint first, GLsizei count, const GLfloat *v)
+{
+    return ::glViewportArrayv (first, count, v);
+}
+inline void ViewportIndexedf (GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h)
+{
+    return ::glViewportIndexedf (index, x, y, w, h);
+}
+inline void ViewportIndexedfv (GLuint index, const GLfloat *v)
+{
+    return ::glViewportIndexedfv (index, v);
+}
+inline void ScissorArrayv (GLuint first, GLsizei count, const GLint *v)
+{
+    return ::glScissorArrayv (first, count, v);
+}
+inline void ScissorIndexed (GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height)
+{
+    return ::glScissorIndexed (index, left, bottom, width, height);
+}
+inline void ScissorIndexedv (GLuint index, const GLint *v)
+{
+    return ::glScissorIndexedv (index, v);
+}
+inline void DepthRangeArrayv (GLuint first, GLsizei count, const GLdouble *v)
+{
+    return ::glDepthRangeArrayv (first, count, v);
+}
+inline void DepthRangeIndexed (GLuint index, GLdouble n, GLdouble f)
+{
+    return ::glDepthRangeIndexed (index, n, f);
+}
+inline void GetFloati_v (GLenum target, GLuint index, GLfloat *data)
+{
+    return ::glGetFloati_v (target, index, data);
+}
+inline void GetDoublei_v (GLenum target, GLuint index, GLdouble *data)
+{
+    return ::glGetDoublei_v (target, index, data);
+}
+inline void DrawArraysInstancedBaseInstance (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance)
+{
+    return ::glDrawArraysInstancedBaseInstance (mode, first, count, instancecount, baseinstance);
+}
+inline void DrawElementsInstancedBaseInstance (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance)
+{
+    return ::glDrawElementsInstancedBaseInstance (mode, count, type, indices, instancecount, baseinstance);
+}
+inline void DrawElementsInstancedBaseVertexBaseInstance (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance)
+{
+    return ::glDrawElementsInstancedBaseVertexBaseInstance (mode, count, type, indices, instancecount, basevertex, baseinstance);
+}
+inline void GetInternalformativ (GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint *params)
+{
+    return ::glGetInternalformativ (target, internalformat, pname, bufSize, params);
+}
+inline void GetActiveAtomicCounterBufferiv (GLuint program, GLuint bufferIndex, GLenum pname, GLint *params)
+{
+    return ::glGetActiveAtomicCounterBufferiv (program, bufferIndex, pname, params);
+}
+inline void BindImageTexture (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format)
+{
+    return ::glBindImageTexture (unit, texture, level, layered, layer, access, format);
+}
+inline void MemoryBarrier (GLbitfield barriers)
+{
+    return ::glMemoryBarrier (barriers);
+}
+inline void TexStorage1D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width)
+{
+    return ::glTexStorage1D (target, levels, internalformat, width);
+}
+inline void TexStorage2D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    return ::glTexStorage2D (target, levels, internalformat, width, height);
+}
+inline void TexStorage3D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+    return ::glTexStorage3D (target, levels, internalformat, width, height, depth);
+}
+inline void DrawTransformFeedbackInstanced (GLenum mode, GLuint id, GLsizei instancecount)
+{
+    return ::glDrawTransformFeedbackInstanced (mode, id, instancecount);
+}
+inline void DrawTransformFeedbackStreamInstanced (GLenum mode, GLuint id, GLuint stream, GLsizei instancecount)
+{
+    return ::glDrawTransformFeedbackStreamInstanced (mode, id, stream, instancecount);
+}
+inline void ClearBufferData (GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data)
+{
+    return ::glClearBufferData (target, internalformat, format, type, data);
+}
+inline void ClearBufferSubData (GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data)
+{
+    return ::glClearBufferSubData (target, internalformat, offset, size, format, type, data);
+}
+inline void DispatchCompute (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z)
+{
+    return ::glDispatchCompute (num_groups_x, num_groups_y, num_groups_z);
+}
+inline void DispatchComputeIndirect (GLintptr indirect)
+{
+    return ::glDispatchComputeIndirect (indirect);
+}
+inline void CopyImageSubData (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth)
+{
+    return ::glCopyImageSubData (srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+}
+inline void FramebufferParameteri (GLenum target, GLenum pname, GLint param)
+{
+    return ::glFramebufferParameteri (target, pname, param);
+}
+inline void GetFramebufferParameteriv (GLenum target, GLenum pname, GLint *params)
+{
+    return ::glGetFramebufferParameteriv (target, pname, params);
+}
+inline void GetInternalformati64v (GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint64 *params)
+{
+    return ::glGetInternalformati64v (target, internalformat, pname, bufSize, params);
+}
+inline void InvalidateTexSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth)
+{
+    return ::glInvalidateTexSubImage (texture, level, xoffset, yoffset, zoffset, width, height, depth);
+}
+inline void InvalidateTexImage (GLuint texture, GLint level)
+{
+    return ::glInvalidateTexImage (texture, level);
+}
+inline void InvalidateBufferSubData (GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+    return ::glInvalidateBufferSubData (buffer, offset, length);
+}
+inline void InvalidateBufferData (GLuint buffer)
+{
+    return ::glInvalidateBufferData (buffer);
+}
+inline void InvalidateFramebuffer (GLenum target, GLsizei numAttachments, const GLenum *attachments)
+{
+    return ::glInvalidateFramebuffer (target, numAttachments, attachments);
+}
+inline void InvalidateSubFramebuffer (GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    return ::glInvalidateSubFramebuffer (target, numAttachments, attachments, x, y, width, height);
+}
+inline void MultiDrawArraysIndirect (GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride)
+{
+    return ::glMultiDrawArraysIndirect (mode, indirect, drawcount, stride);
+}
+inline void MultiDrawElementsIndirect (GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride)
+{
+    return ::glMultiDrawElementsIndirect (mode, type, indirect, drawcount, stride);
+}
+inline void GetProgramInterfaceiv (GLuint program, GLenum programInterface, GLenum pname, GLint *params)
+{
+    return ::glGetProgramInterfaceiv (program, programInterface, pname, params);
+}
+inline GLuint GetProgramResourceIndex (GLuint program, GLenum programInterface, const GLchar *name)
+{
+    return ::glGetProgramResourceIndex (program, programInterface, name);
+}
+inline void GetProgramResourceName (GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name)
+{
+    return ::glGetProgramResourceName (program, programInterface, index, bufSize, length, name);
+}
+inline void GetProgramResourceiv (GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei bufSize, GLsizei *length, GLint *params)
+{
+    return ::glGetProgramResourceiv (program, programInterface, index, propCount, props, bufSize, length, params);
+}
+inline GLint GetProgramResourceLocation (GLuint program, GLenum programInterface, const GLchar *name)
+{
+    return ::glGetProgramResourceLocation (program, programInterface, name);
+}
+inline GLint GetProgramResourceLocationIndex (GLuint program, GLenum programInterface, const GLchar *name)
+{
+    return ::glGetProgramResourceLocationIndex (program, programInterface, name);
+}
+inline void ShaderStorageBlockBinding (GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding)
+{
+    return ::glShaderStorageBlockBinding (program, storageBlockIndex, storageBlockBinding);
+}
+inline void TexBufferRange (GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    return ::glTexBufferRange (target, internalformat, buffer, offset, size);
+}
+inline void TexStorage2DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+    return ::glTexStorage2DMultisample (target, samples, internalformat, width, height, fixedsamplelocations);
+}
+inline void TexStorage3DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+    return ::glTexStorage3DMultisample (target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+inline void TextureView (GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers)
+{
+    return ::glTextureView (texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+}
+inline void BindVertexBuffer (GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+    return ::glBindVertexBuffer (bindingindex, buffer, offset, stride);
+}
+inline void VertexAttribFormat (GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
+{
+    return ::glVertexAttribFormat (attribindex, size, type, normalized, relativeoffset);
+}
+inline void VertexAttribIFormat (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    return ::glVertexAttribIFormat (attribindex, size, type, relativeoffset);
+}
+inline void VertexAttribLFormat (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    return ::glVertexAttribLFormat (attribindex, size, type, relativeoffset);
+}
+inline void VertexAttribBinding (GLuint attribindex, GLuint bindingindex)
+{
+    return ::glVertexAttribBinding (attribindex, bindingindex);
+}
+inline void VertexBindingDivisor (GLuint bindingindex, GLuint divisor)
+{
+    return ::glVertexBindingDivisor (bindingindex, divisor);
+}
+inline void DebugMessageControl (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled)
+{
+    return ::glDebugMessageControl (source, type, severity, count, ids, enabled);
+}
+inline void DebugMessageInsert (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf)
+{
+    return ::glDebugMessageInsert (source, type, id, severity, length, buf);
+}
+inline void DebugMessageCallback (GLDEBUGPROC callback, const void *userParam)
+{
+    return ::glDebugMessageCallback (callback, userParam);
+}
+inline GLuint GetDebugMessageLog (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog)
+{
+    return ::glGetDebugMessageLog (count, bufSize, sources, types, ids, severities, lengths, messageLog);
+}
+inline void PushDebugGroup (GLenum source, GLuint id, GLsizei length, const GLchar *message)
+{
+    return ::glPushDebugGroup (source, id, length, message);
+}
+inline void PopDebugGroup (void)
+{
+    return ::glPopDebugGroup ();
+}
+inline void ObjectLabel (GLenum identifier, GLuint name, GLsizei length, const GLchar *label)
+{
+    return ::glObjectLabel (identifier, name, length, label);
+}
+inline void GetObjectLabel (GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label)
+{
+    return ::glGetObjectLabel (identifier, name, bufSize, length, label);
+}
+inline void ObjectPtrLabel (const void *ptr, GLsizei length, const GLchar *label)
+{
+    return ::glObjectPtrLabel (ptr, length, label);
+}
+inline void GetObjectPtrLabel (const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label)
+{
+    return ::glGetObjectPtrLabel (ptr, bufSize, length, label);
+}
+inline void BufferStorage (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags)
+{
+    return ::glBufferStorage (target, size, data, flags);
+}
+inline void ClearTexImage (GLuint texture, GLint level, GLenum format, GLenum type, const void *data)
+{
+    return ::glClearTexImage (texture, level, format, type, data);
+}
+inline void ClearTexSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data)
+{
+    return ::glClearTexSubImage (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+}
+inline void BindBuffersBase (GLenum target, GLuint first, GLsizei count, const GLuint *buffers)
+{
+    return ::glBindBuffersBase (target, first, count, buffers);
+}
+inline void BindBuffersRange (GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes)
+{
+    return ::glBindBuffersRange (target, first, count, buffers, offsets, sizes);
+}
+inline void BindTextures (GLuint first, GLsizei count, const GLuint *textures)
+{
+    return ::glBindTextures (first, count, textures);
+}
+inline void BindSamplers (GLuint first, GLsizei count, const GLuint *samplers)
+{
+    return ::glBindSamplers (first, count, samplers);
+}
+inline void BindImageTextures (GLuint first, GLsizei count, const GLuint *textures)
+{
+    return ::glBindImageTextures (first, count, textures);
+}
+inline void BindVertexBuffers (GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides)
+{
+    return ::glBindVertexBuffers (first, count, buffers, offsets, strides);
+}
+inline void ClipControl (GLenum origin, GLenum depth)
+{
+    return ::glClipControl (origin, depth);
+}
+inline void CreateTransformFeedbacks (GLsizei n, GLuint *ids)
+{
+    return ::glCreateTransformFeedbacks (n, ids);
+}
+inline void TransformFeedbackBufferBase (GLuint xfb, GLuint index, GLuint buffer)
+{
+    return ::glTransformFeedbackBufferBase (xfb, index, buffer);
+}
+inline void TransformFeedbackBufferRange (GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    return ::glTransformFeedbackBufferRange (xfb, index, buffer, offset, size);
+}
+inline void GetTransformFeedbackiv (GLuint xfb, GLenum pname, GLint *param)
+{
+    return ::glGetTransformFeedbackiv (xfb, pname, param);
+}
+inline void GetTransformFeedbacki_v (GLuint xfb, GLenum pname, GLuint index, GLint *param)
+{
+    return ::glGetTransformFeedbacki_v (xfb, pname, index, param);
+}
+inline void GetTransformFeedbacki64_v (GLuint xfb, GLenum pname, GLuint index, GLint64 *param)
+{
+    return ::glGetTransformFeedbacki64_v (xfb, pname, index, param);
+}
+inline void CreateBuffers (GLsizei n, GLuint *buffers)
+{
+    return ::glCreateBuffers (n, buffers);
+}
+inline void NamedBufferStorage (GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags)
+{
+    return ::glNamedBufferStorage (buffer, size, data, flags);
+}
+inline void NamedBufferData (GLuint buffer, GLsizeiptr size, const void *data, GLenum usage)
+{
+    return ::glNamedBufferData (buffer, size, data, usage);
+}
+inline void NamedBufferSubData (GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    return ::glNamedBufferSubData (buffer, offset, size, data);
+}
+inline void CopyNamedBufferSubData (GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+    return ::glCopyNamedBufferSubData (readBuffer, writeBuffer, readOffset, writeOffset, size);
+}
+inline void ClearNamedBufferData (GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data)
+{
+    return ::glClearNamedBufferData (buffer, internalformat, format, type, data);
+}
+inline void ClearNamedBufferSubData (GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data)
+{
+    return ::glClearNamedBufferSubData (buffer, internalformat, offset, size, format, type, data);
+}
+inline void * MapNamedBuffer (GLuint buffer, GLenum access)
+{
+    return ::glMapNamedBuffer (buffer, access);
+}
+inline void * MapNamedBufferRange (GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    return ::glMapNamedBufferRange (buffer, offset, length, access);
+}
+inline GLboolean UnmapNamedBuffer (GLuint buffer)
+{
+    return ::glUnmapNamedBuffer (buffer);
+}
+inline void FlushMappedNamedBufferRange (GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+    return ::glFlushMappedNamedBufferRange (buffer, offset, length);
+}
+inline void GetNamedBufferParameteriv (GLuint buffer, GLenum pname, GLint *params)
+{
+    return ::glGetNamedBufferParameteriv (buffer, pname, params);
+}
+inline void GetNamedBufferParameteri64v (GLuint buffer, GLenum pname, GLint64 *params)
+{
+    return ::glGetNamedBufferParameteri64v (buffer, pname, params);
+}
+inline void GetNamedBufferPointerv (GLuint buffer, GLenum pname, void **params)
+{
+    return ::glGetNamedBufferPointerv (buffer, pname, params);
+}
+inline void GetNamedBufferSubData (GLuint buffer, GLintptr offset, GLsizeiptr size, void *data)
+{
+    return ::glGetNamedBufferSubData (buffer, offset, size, data);
+}
+inline void CreateFramebuffers (GLsizei n, GLuint *framebuffers)
+{
+    return ::glCreateFramebuffers (n, framebuffers);
+}
+inline void NamedFramebufferRenderbuffer (GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+    return ::glNamedFramebufferRenderbuffer (framebuffer, attachment, renderbuffertarget, renderbuffer);
+}
+inline void NamedFramebufferParameteri (GLuint framebuffer, GLenum pname, GLint param)
+{
+    return ::glNamedFramebufferParameteri (framebuffer, pname, param);
+}
+inline void NamedFramebufferTexture (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level)
+{
+    return ::glNamedFramebufferTexture (framebuffer, attachment, texture, level);
+}
+inline void NamedFramebufferTextureLayer (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+    return ::glNamedFramebufferTextureLayer (framebuffer, attachment, texture, level, layer);
+}
+inline void NamedFramebufferDrawBuffer (GLuint framebuffer, GLenum buf)
+{
+    return ::glNamedFramebufferDrawBuffer (framebuffer, buf);
+}
+inline void NamedFramebufferDrawBuffers (GLuint framebuffer, GLsizei n, const GLenum *bufs)
+{
+    return ::glNamedFramebufferDrawBuffers (framebuffer, n, bufs);
+}
+inline void NamedFramebufferReadBuffer (GLuint framebuffer, GLenum src)
+{
+    return ::glNamedFramebufferReadBuffer (framebuffer, src);
+}
+inline void InvalidateNamedFramebufferData (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments)
+{
+    return ::glInvalidateNamedFramebufferData (framebuffer, numAttachments, attachments);
+}
+inline void InvalidateNamedFramebufferSubData (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    return ::glInvalidateNamedFramebufferSubData (framebuffer, numAttachments, attachments, x, y, width, height);
+}
+inline void ClearNamedFramebufferiv (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value)
+{
+    return ::glClearNamedFramebufferiv (framebuffer, buffer, drawbuffer, value);
+}
+inline void ClearNamedFramebufferuiv (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value)
+{
+    return ::glClearNamedFramebufferuiv (framebuffer, buffer, drawbuffer, value);
+}
+inline void ClearNamedFramebufferfv (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value)
+{
+    return ::glClearNamedFramebufferfv (framebuffer, buffer, drawbuffer, value);
+}
+inline void ClearNamedFramebufferfi (GLuint framebuffer, GLenum buffer, const GLfloat depth, GLint stencil)
+{
+    return ::glClearNamedFramebufferfi (framebuffer, buffer, depth, stencil);
+}
+inline void BlitNamedFramebuffer (GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+    return ::glBlitNamedFramebuffer (readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+inline GLenum CheckNamedFramebufferStatus (GLuint framebuffer, GLenum target)
+{
+    return ::glCheckNamedFramebufferStatus (framebuffer, target);
+}
+inline void GetNamedFramebufferParameteriv (GLuint framebuffer, GLenum pname, GLint *param)
+{
+    return ::glGetNamedFramebufferParameteriv (framebuffer, pname, param);
+}
+inline void GetNamedFramebufferAttachmentParameteriv (GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params)
+{
+    return ::glGetNamedFramebufferAttachmentParameteriv (framebuffer, attachment, pname, params);
+}
+inline void CreateRenderbuffers (GLsizei n, GLuint *renderbuffers)
+{
+    return ::glCreateRenderbuffers (n, renderbuffers);
+}
+inline void NamedRenderbufferStorage (GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    return ::glNamedRenderbufferStorage (renderbuffer, internalformat, width, height);
+}
+inline void NamedRenderbufferStorageMultisample (GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    return ::glNamedRenderbufferStorageMultisample (renderbuffer, samples, internalformat, width, height);
+}
+inline void GetNamedRenderbufferParameteriv (GLuint renderbuffer, GLenum pname, GLint *params)
+{
+    return ::glGetNamedRenderbufferParameteriv (renderbuffer, pname, params);
+}
+inline void CreateTextures (GLenum target, GLsizei n, GLuint *textures)
+{
+    return ::glCreateTextures (target, n, textures);
+}
+inline void TextureBuffer (GLuint texture, GLenum internalformat, GLuint buffer)
+{
+    return ::glTextureBuffer (texture, internalformat, buffer);
+}
+inline void TextureBufferRange (GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    return ::glTextureBufferRange (texture, internalformat, buffer, offset, size);
+}
+inline void TextureStorage1D (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width)
+{
+    return ::glTextureStorage1D (texture, levels, internalformat, width);
+}
+inline void TextureStorage2D (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    return ::glTextureStorage2D (texture, levels, internalformat, width, height);
+}
+inline void TextureStorage3D (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+    return ::glTextureStorage3D (texture, levels, internalformat, width, height, depth);
+}
+inline void TextureStorage2DMultisample (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+    return ::glTextureStorage2DMultisample (texture, samples, internalformat, width, height, fixedsamplelocations);
+}
+inline void TextureStorage3DMultisample (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+    return ::glTextureStorage3DMultisample (texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+inline void TextureSubImage1D (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels)
+{
+    return ::glTextureSubImage1D (texture, level, xoffset, width, format, type, pixels);
+}
+inline void TextureSubImage2D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+    return ::glTextureSubImage2D (texture, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+inline void TextureSubImage3D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels)
+{
+    return ::glTextureSubImage3D (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+inline void CompressedTextureSubImage1D (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
+{
+    return ::glCompressedTextureSubImage1D (texture, level, xoffset, width, format, imageSize, data);
+}
+inline void CompressedTextureSubImage2D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+{
+    return ::glCompressedTextureSubImage2D (texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+inline void CompressedTextureSubImage3D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+{
+    return ::glCompressedTextureSubImage3D (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+inline void CopyTextureSubImage1D (GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+    return ::glCopyTextureSubImage1D (texture, level, xoffset, x, y, width);
+}
+inline void CopyTextureSubImage2D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    return ::glCopyTextureSubImage2D (texture, level, xoffset, yoffset, x, y, width, height);
+}
+inline void CopyTextureSubImage3D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    return ::glCopyTextureSubImage3D (texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+inline void TextureParameterf (GLuint texture, GLenum pname, GLfloat param)
+{
+    return ::glTextureParameterf (texture, pname, param);
+}
+inline void TextureParameterfv (GLuint texture, GLenum pname, const GLfloat *param)
+{
+    return ::glTextureParameterfv (texture, pname, param);
+}
+inline void TextureParameteri (GLuint texture, GLenum pname, GLint param)
+{
+    return ::glTextureParameteri (texture, pname, param);
+}
+inline void TextureParameterIiv (GLuint texture, GLenum pname, const GLint *params)
+{
+    return ::glTextureParameterIiv (texture, pname, params);
+}
+inline void TextureParameterIuiv (GLuint texture, GLenum pname, const GLuint *params)
+{
+    return ::glTextureParameterIuiv (texture, pname, params);
+}
+inline void TextureParameteriv (GLuint texture, GLenum pname, const GLint *param)
+{
+    return ::glTextureParameteriv (texture, pname, param);
+}
+inline void GenerateTextureMipmap (GLuint texture)
+{
+    return ::glGenerateTextureMipmap (texture);
+}
+inline void BindTextureUnit (GLuint unit, GLuint texture)
+{
+    return ::glBindTextureUnit (unit, texture);
+}
+inline void GetTextureImage (GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+    return ::glGetTextureImage (texture, level, format, type, bufSize, pixels);
+}
+inline void GetCompressedTextureImage (GLuint texture, GLint level, GLsizei bufSize, void *pixels)
+{
+    return ::glGetCompressedTextureImage (texture, level, bufSize, pixels);
+}
+inline void GetTextureLevelParameterfv (GLuint texture, GLint level, GLenum pname, GLfloat *params)
+{
+    return ::glGetTextureLevelParameterfv (texture, level, pname, params);
+}
+inline void GetTextureLevelParameteriv (GLuint texture, GLint level, GLenum pname, GLint *params)
+{
+    return ::glGetTextureLevelParameteriv (texture, level, pname, params);
+}
+inline void GetTextureParameterfv (GLuint texture, GLenum pname, GLfloat *params)
+{
+    return ::glGetTextureParameterfv (texture, pname, params);
+}
+inline void GetTextureParameterIiv (GLuint texture, GLenum pname, GLint *params)
+{
+    return ::glGetTextureParameterIiv (texture, pname, params);
+}
+inline void GetTextureParameterIuiv (GLuint texture, GLenum pname, GLuint *params)
+{
+    return ::glGetTextureParameterIuiv (texture, pname, params);
+}
+inline void GetTextureParameteriv (GLuint texture, GLenum pname, GLint *params)
+{
+    return ::glGetTextureParameteriv (texture, pname, params);
+}
+inline void CreateVertexArrays (GLsizei n, GLuint *arrays)
+{
+    return ::glCreateVertexArrays (n, arrays);
+}
+inline void DisableVertexArrayAttrib (GLuint vaobj, GLuint index)
+{
+    return ::glDisableVertexArrayAttrib (vaobj, index);
+}
+inline void EnableVertexArrayAttrib (GLuint vaobj, GLuint index)
+{
+    return ::glEnableVertexArrayAttrib (vaobj, index);
+}
+inline void VertexArrayElementBuffer (GLuint vaobj, GLuint buffer)
+{
+    return ::glVertexArrayElementBuffer (vaobj, buffer);
+}
+inline void VertexArrayVertexBuffer (GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+    return ::glVertexArrayVertexBuffer (vaobj, bindingindex, buffer, offset, stride);
+}
+inline void VertexArrayVertexBuffers (GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides)
+{
+    return ::glVertexArrayVertexBuffers (vaobj, first, count, buffers, offsets, strides);
+}
+inline void VertexArrayAttribBinding (GLuint vaobj, GLuint attribindex, GLuint bindingindex)
+{
+    return ::glVertexArrayAttribBinding (vaobj, attribindex, bindingindex);
+}
+inline void VertexArrayAttribFormat (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
+{
+    return ::glVertexArrayAttribFormat (vaobj, attribindex, size, type, normalized, relativeoffset);
+}
+inline void VertexArrayAttribIFormat (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    return ::glVertexArrayAttribIFormat (vaobj, attribindex, size, type, relativeoffset);
+}
+inline void VertexArrayAttribLFormat (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    return ::glVertexArrayAttribLFormat (vaobj, attribindex, size, type, relativeoffset);
+}
+inline void VertexArrayBindingDivisor (GLuint vaobj, GLuint bindingindex, GLuint divisor)
+{
+    return ::glVertexArrayBindingDivisor (vaobj, bindingindex, divisor);
+}
+inline void GetVertexArrayiv (GLuint vaobj, GLenum pname, GLint *param)
+{
+    return ::glGetVertexArrayiv (vaobj, pname, param);
+}
+inline void GetVertexArrayIndexediv (GLuint vaobj, GLuint index, GLenum pname, GLint *param)
+{
+    return ::glGetVertexArrayIndexediv (vaobj, index, pname, param);
+}
+inline void GetVertexArrayIndexed64iv (GLuint vaobj, GLuint index, GLenum pname, GLint64 *param)
+{
+    return ::glGetVertexArrayIndexed64iv (vaobj, index, pname, param);
+}
+inline void CreateSamplers (GLsizei n, GLuint *samplers)
+{
+    return ::glCreateSamplers (n, samplers);
+}
+inline void CreateProgramPipelines (GLsizei n, GLuint *pipelines)
+{
+    return ::glCreateProgramPipelines (n, pipelines);
+}
+inline void CreateQueries (GLenum target, GLsizei n, GLuint *ids)
+{
+    return ::glCreateQueries (target, n, ids);
+}
+inline void GetQueryBufferObjecti64v (GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    return ::glGetQueryBufferObjecti64v (id, buffer, pname, offset);
+}
+inline void GetQueryBufferObjectiv (GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    return ::glGetQueryBufferObjectiv (id, buffer, pname, offset);
+}
+inline void GetQueryBufferObjectui64v (GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    return ::glGetQueryBufferObjectui64v (id, buffer, pname, offset);
+}
+inline void GetQueryBufferObjectuiv (GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    return ::glGetQueryBufferObjectuiv (id, buffer, pname, offset);
+}
+inline void MemoryBarrierByRegion (GLbitfield barriers)
+{
+    return ::glMemoryBarrierByRegion (barriers);
+}
+inline void GetTextureSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+    return ::glGetTextureSubImage (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+}
+inline void GetCompressedTextureSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels)
+{
+    return ::glGetCompressedTextureSubImage (texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+}
+inline GLenum GetGraphicsResetStatus (void)
+{
+    return ::glGetGraphicsResetStatus ();
+}
+inline void GetnCompressedTexImage (GLenum target, GLint lod, GLsizei bufSize, void *pixels)
+{
+    return ::glGetnCompressedTexImage (target, lod, bufSize, pixels);
+}
+inline void GetnTexImage (GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+    return ::glGetnTexImage (target, level, format, type, bufSize, pixels);
+}
+inline void GetnUniformdv (GLuint program, GLint location, GLsizei bufSize, GLdouble *params)
+{
+    return ::glGetnUniformdv (program, location, bufSize, params);
+}
+inline void GetnUniformfv (GLuint program, GLint location, GLsizei bufSize, GLfloat *params)
+{
+    return ::glGetnUniformfv (program, location, bufSize, params);
+}
+inline void GetnUniformiv (GLuint program, GLint location, GLsizei bufSize, GLint *params)
+{
+    return ::glGetnUniformiv (program, location, bufSize, params);
+}
+inline void GetnUniformuiv (GLuint program, GLint location, GLsizei bufSize, GLuint *params)
+{
+    return ::glGetnUniformuiv (program, location, bufSize, params);
+}
+inline void ReadnPixels (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data)
+{
+    return ::glReadnPixels (x, y, width, height, format, type, bufSize, data);
+}
+inline void TextureBarrier (void)
+{
+    return ::glTextureBarrier ();
+}
+
+#else /* !defined OGLP_DIRECT_LINK */
+
 extern PFNGLCULLFACEPROC CullFace;
 extern PFNGLFRONTFACEPROC FrontFace;
 extern PFNGLHINTPROC Hint;
@@ -674,6 +7161,9 @@ extern PFNGLGETNUNIFORMIVPROC GetnUniformiv;
 extern PFNGLGETNUNIFORMUIVPROC GetnUniformuiv;
 extern PFNGLREADNPIXELSPROC ReadnPixels;
 extern PFNGLTEXTUREBARRIERPROC TextureBarrier;
+
+#endif /* !defined OGLP_DIRECT_LINK */
+
 extern PFNGLGETTEXTUREHANDLEARBPROC GetTextureHandleARB;
 extern PFNGLGETTEXTURESAMPLERHANDLEARBPROC GetTextureSamplerHandleARB;
 extern PFNGLMAKETEXTUREHANDLERESIDENTARBPROC MakeTextureHandleResidentARB;
@@ -752,6 +7242,7 @@ extern PFNGLGETINTEGERUI64I_VNVPROC GetIntegerui64i_vNV;
 extern PFNGLENABLECLIENTSTATEPROC EnableClientState;
 extern PFNGLDISABLECLIENTSTATEPROC DisableClientState;
 
+#endif /* !defined OGLP_DISPATCH_TABLE */
 
 } /* namespace oglp */
 
@@ -0,0 +1,99 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OGLP_HASHEDNAME_H
+#define OGLP_HASHEDNAME_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace oglp {
+
+/**
+ * Hash a name.
+ * Computes the 32 bit FNV-1a hash of a string. Usable in
+ * constant expressions.
+ * \param str Specifies the string to hash.
+ * \param length Specifies the length of the string.
+ * \return The hash of the string.
+ */
+constexpr uint32_t HashName (const char *str, size_t length)
+{
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++)
+        hash = (hash ^ uint8_t (str[i])) * 16777619u;
+    return hash;
+}
+
+/** Hashed name.
+ * A string together with its precomputed hash, which allows
+ * looking up names without hashing them again. Usually created
+ * from a string literal with OGLP_NAME, which hashes the literal
+ * at compile time.
+ */
+class HashedName
+{
+public:
+    /**
+       * Constructor.
+       * \param _str Specifies the string, which needs to outlive
+       *             the HashedName object.
+       * \param _length Specifies the length of the string.
+       * \param _hash Specifies the hash of the string as returned
+       *              by HashName.
+       */
+    constexpr HashedName (const char *_str, size_t _length, uint32_t _hash)
+        : str (_str), length (_length), hash (_hash)
+    {
+    }
+
+    /**
+       * Constructor.
+       * Hashes a null terminated string at runtime.
+       * \param _str Specifies the string, which needs to outlive
+       *             the HashedName object.
+       */
+    explicit HashedName (const char *_str)
+        : str (_str), length (std::char_traits<char>::length (_str)),
+          hash (HashName (_str, length))
+    {
+    }
+
+    /** The string. */
+    const char *str;
+    /** Length of the string. */
+    size_t length;
+    /** Hash of the string. */
+    uint32_t hash;
+};
+
+} /* namespace oglp */
+
+/**
+ * Hashed name literal.
+ * Creates an oglp::HashedName from a string literal, which is hashed at
+ * compile time, e.g. program[OGLP_NAME ("mvp")].
+ */
+#define OGLP_NAME(str) (::oglp::HashedName (str, sizeof (str) - 1, \
+    ::std::integral_constant< ::std::uint32_t, \
+    ::oglp::HashName (str, sizeof (str) - 1)>::value))
+
+#endif /* !defined OGLP_HASHEDNAME_H */
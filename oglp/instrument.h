@@ -0,0 +1,138 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OGLP_INSTRUMENT_H
+#define OGLP_INSTRUMENT_H
+
+#include "common.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace oglp {
+
+/** Call statistics of an OpenGL entry point. */
+struct CallStats
+{
+    /** Name of the entry point. */
+    std::string name;
+    /** Number of calls. */
+    uint64_t calls;
+    /** CPU time spent inside the entry point in nanoseconds. */
+    uint64_t time;
+};
+
+/**
+ * Get the call statistics.
+ * If OGLP_INSTRUMENT is defined, Init installs a generated thunk in front
+ * of every entry point that counts the calls and measures the time spent
+ * inside the driver. The counters are kept per thread and only merged
+ * by this function, so the thunks never synchronize. Without
+ * OGLP_INSTRUMENT the returned table is empty.
+ * \return The statistics of all called entry points, sorted by
+ *         descending time.
+ */
+std::vector<CallStats> GetCallStats (void);
+
+/**
+ * Reset the call statistics.
+ * Resets the counters of all threads. Calls that are in
+ * progress in other threads are counted after the reset.
+ */
+void ResetCallStats (void);
+
+#ifdef OGLP_INSTRUMENT
+namespace internal {
+
+/* Per-thread counters, registered for merging while the thread lives. */
+struct InstrumentCounters
+{
+    InstrumentCounters (void);
+    ~InstrumentCounters (void);
+
+    std::atomic<uint64_t> calls[NumProcs];
+    std::atomic<uint64_t> time[NumProcs];
+};
+
+extern thread_local InstrumentCounters instrumentcounters;
+
+#ifdef OGLP_DISPATCH_TABLE
+/* entry points the instrumentation thunks of the current table forward to */
+inline DispatchTable &InstrumentNext (void)
+{
+    return *currentdispatch->instrumentnext;
+}
+#else
+/* entry points the instrumentation thunks forward to */
+extern DispatchTable instrumentnext;
+
+inline DispatchTable &InstrumentNext (void)
+{
+    return instrumentnext;
+}
+#endif
+
+/* names of all instrumented entry points */
+extern const char *const InstrumentProcNames[NumProcs];
+
+/* Fill a table with the generated instrumentation thunks. */
+void GetInstrumentThunks (DispatchTable *table);
+
+/* Install the instrumentation thunks in front of the current entry points.
+ * With OGLP_DISPATCH_TABLE the entry points they forward to are kept with
+ * the current table, so every thread can instrument its own context. */
+void InstallInstrumentation (void);
+
+/* Measures a single call. The counters are only contended while
+ * ResetCallStats clears them, so the increments stay uncontended
+ * atomic additions that a concurrent reset cannot lose. */
+class InstrumentScope
+{
+public:
+    InstrumentScope (unsigned int _id)
+        : id (_id), start (std::chrono::steady_clock::now ())
+    {
+    }
+
+    InstrumentScope (const InstrumentScope &) = delete;
+
+    ~InstrumentScope (void)
+    {
+        uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>
+                (std::chrono::steady_clock::now () - start).count ();
+        InstrumentCounters &counters = instrumentcounters;
+        counters.calls[id].fetch_add (1, std::memory_order_relaxed);
+        counters.time[id].fetch_add (ns, std::memory_order_relaxed);
+    }
+
+    InstrumentScope &operator= (const InstrumentScope &) = delete;
+
+private:
+    unsigned int id;
+    std::chrono::steady_clock::time_point start;
+};
+
+} /* namespace internal */
+#endif /* defined OGLP_INSTRUMENT */
+
+} /* namespace oglp */
+
+#endif /* !defined OGLP_INSTRUMENT_H */
@@ -0,0 +1,339 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OGLP_MAPPEDRANGE_H
+#define OGLP_MAPPEDRANGE_H
+
+#include "common.h"
+#include "buffer.h"
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace oglp {
+
+/** Mapping options.
+ * Options of a MappedRange, which can be combined with operator|.
+ */
+enum class MapFlags : GLbitfield
+{
+    /** Synchronized write-only mapping. */
+    None = 0,
+    /** Allow reading from the mapping. */
+    Read = GL_MAP_READ_BIT,
+    /** Discard the previous contents of the range. */
+    InvalidateRange = GL_MAP_INVALIDATE_RANGE_BIT,
+    /** Discard the previous contents of the whole buffer. */
+    InvalidateBuffer = GL_MAP_INVALIDATE_BUFFER_BIT,
+    /** Do not wait for pending commands using the buffer. */
+    Unsynchronized = GL_MAP_UNSYNCHRONIZED_BIT
+};
+
+/**
+ * Combine mapping options.
+ * \param a First options.
+ * \param b Second options.
+ * \return The union of both options.
+ */
+inline MapFlags operator| (MapFlags a, MapFlags b)
+{
+    return static_cast<MapFlags> (static_cast<GLbitfield> (a)
+                                  | static_cast<GLbitfield> (b));
+}
+
+/** Typed buffer mapping.
+ * A move-only guard that maps a range of a buffer object as an array
+ * of T with explicit flushing and unmaps it when destroyed. Written
+ * elements are tracked as dirty ranges, which are merged, so that only
+ * the written data is flushed with as few calls as possible.
+ */
+template<typename T>
+class MappedRange
+{
+public:
+    /**
+       * Default constructor.
+       * Creates an empty MappedRange object.
+       */
+    MappedRange (void) : buffer (NULL), offset (0), ptr (NULL), count (0)
+    {
+    }
+
+    /**
+       * Constructor.
+       * Maps a range of a buffer object.
+       * \param _buffer Specifies the buffer object to map.
+       * \param _offset Specifies the offset of the range in bytes.
+       * \param _count Specifies the number of elements in the range.
+       * \param flags Specifies the mapping options.
+       */
+    MappedRange (const Buffer &_buffer, GLintptr _offset, size_t _count,
+                 MapFlags flags = MapFlags::None)
+        : buffer (&_buffer), offset (_offset), count (_count)
+    {
+        ptr = static_cast<T *> (buffer->MapRange (offset, count * sizeof (T),
+            GL_MAP_WRITE_BIT | GL_MAP_FLUSH_EXPLICIT_BIT
+            | static_cast<GLbitfield> (flags)));
+        if (!ptr)
+            count = 0;
+    }
+
+    /**
+       * Move constuctor.
+       * Passes the mapping to another MappedRange object.
+       * \param range The MappedRange object to move.
+       */
+    MappedRange (MappedRange &&range) noexcept
+        : buffer (range.buffer), offset (range.offset), ptr (range.ptr),
+          count (range.count), dirty (std::move (range.dirty))
+    {
+        range.buffer = NULL;
+        range.ptr = NULL;
+        range.count = 0;
+    }
+
+    /**
+       * Deleted copy constructor.
+       * A MappedRange object can't be copy constructed.
+       */
+    MappedRange (const MappedRange &) = delete;
+
+    /**
+       * A destructor.
+       * Flushes the dirty ranges and unmaps the buffer. Errors are not
+       * checked, so that the destructor never throws, call Unmap
+       * explicitly to have them checked.
+       */
+    ~MappedRange (void)
+    {
+        Release (false);
+    }
+
+    /**
+       * Move assignment.
+       * Passes the mapping to another MappedRange object.
+       * \param range The MappedRange object to move.
+       * \return A reference to the MappedRange object.
+       */
+    MappedRange &operator= (MappedRange &&range) noexcept
+    {
+        std::swap (buffer, range.buffer);
+        std::swap (offset, range.offset);
+        std::swap (ptr, range.ptr);
+        std::swap (count, range.count);
+        std::swap (dirty, range.dirty);
+        return *this;
+    }
+
+    /**
+       * Deleted copy assignment.
+       * A MappedRange object can't be copy assigned.
+       * \return
+       */
+    MappedRange &operator= (const MappedRange &) = delete;
+
+    /**
+       * Access an element for writing.
+       * Marks the element as dirty. Use Read for elements that are
+       * only read.
+       * \param i Specifies the index of the element.
+       * \return A reference to the element.
+       */
+    T &operator[] (size_t i)
+    {
+        MarkDirty (i, 1);
+        return ptr[i];
+    }
+
+    /**
+       * Access an element for reading.
+       * Does not mark the element as dirty.
+       * \param i Specifies the index of the element.
+       * \return A const reference to the element.
+       */
+    const T &operator[] (size_t i) const
+    {
+        return ptr[i];
+    }
+
+    /**
+       * Read an element.
+       * Does not mark the element as dirty, unlike the non-const
+       * operator[].
+       * \param i Specifies the index of the element.
+       * \return A const reference to the element.
+       */
+    const T &Read (size_t i) const
+    {
+        return ptr[i];
+    }
+
+    /**
+       * Write elements.
+       * Copies elements to the mapping and marks them as dirty.
+       * \param first Specifies the index of the first element to write.
+       * \param values Specifies the elements to write.
+       * \param n Specifies the number of elements to write.
+       */
+    void Write (size_t first, const T *values, size_t n)
+    {
+        memcpy (ptr + first, values, n * sizeof (T));
+        MarkDirty (first, n);
+    }
+
+    /**
+       * Mark elements as dirty.
+       * Necessary after writing through data().
+       * \param first Specifies the index of the first written element.
+       * \param n Specifies the number of written elements.
+       */
+    void MarkDirty (size_t first, size_t n)
+    {
+        /* sequential and repeated writes extend the last range
+         * without allocating */
+        if (!dirty.empty () && dirty.back ().first <= first
+            && first <= dirty.back ().second)
+            dirty.back ().second = std::max (dirty.back ().second, first + n);
+        else
+            dirty.emplace_back (first, first + n);
+    }
+
+    /**
+       * Return the mapped memory.
+       * Writes through the returned pointer are not tracked.
+       * \return A pointer to the first element or NULL if the
+       *         mapping failed.
+       */
+    T *data (void)
+    {
+        return ptr;
+    }
+
+    /**
+       * Return the mapped memory for reading.
+       * \return A pointer to the first element or NULL if the
+       *         mapping failed.
+       */
+    const T *data (void) const
+    {
+        return ptr;
+    }
+
+    /**
+       * Return the offset.
+       * \return The offset of the mapped range in the buffer in bytes.
+       */
+    GLintptr GetOffset (void) const
+    {
+        return offset;
+    }
+
+    /**
+       * Return the number of elements.
+       * \return The number of mapped elements.
+       */
+    size_t size (void) const
+    {
+        return count;
+    }
+
+    /**
+       * Flush the dirty ranges.
+       * Merges adjacent and overlapping dirty ranges and flushes them.
+       * \return The number of flush calls issued.
+       */
+    unsigned int Flush (void)
+    {
+        return FlushDirty (true);
+    }
+
+    /**
+       * Unmap the buffer.
+       * Flushes the dirty ranges and unmaps the buffer. Called
+       * automatically on destruction.
+       */
+    void Unmap (void)
+    {
+        Release (true);
+    }
+
+private:
+    unsigned int FlushDirty (bool check)
+    {
+        unsigned int calls = 0;
+        size_t i, first, last;
+        if (!ptr || dirty.empty ())
+            return 0;
+        std::sort (dirty.begin (), dirty.end ());
+        for (i = 0; i < dirty.size ();) {
+            first = dirty[i].first;
+            last = dirty[i].second;
+            for (i++; i < dirty.size () && dirty[i].first <= last; i++)
+                last = std::max (last, dirty[i].second);
+            if (check)
+                buffer->FlushMappedRange (first * sizeof (T),
+                                          (last - first) * sizeof (T));
+            else
+                FlushMappedNamedBufferRange (buffer->get (), first * sizeof (T),
+                                             (last - first) * sizeof (T));
+            calls++;
+        }
+        dirty.clear ();
+        return calls;
+    }
+
+    void Release (bool check)
+    {
+        if (ptr) {
+            FlushDirty (check);
+            if (check)
+                buffer->Unmap ();
+            else
+                UnmapNamedBuffer (buffer->get ());
+            ptr = NULL;
+            count = 0;
+        }
+    }
+
+    /**
+       * mapped buffer object
+       */
+    const Buffer *buffer;
+    /**
+       * offset of the mapped range in bytes
+       */
+    GLintptr offset;
+    /**
+       * mapped memory
+       */
+    T *ptr;
+    /**
+       * number of mapped elements
+       */
+    size_t count;
+    /**
+       * dirty ranges as pairs of first and past-the-end element indices
+       */
+    std::vector<std::pair<size_t, size_t>> dirty;
+};
+
+} /* namespace oglp */
+
+#endif /* !defined OGLP_MAPPEDRANGE_H */
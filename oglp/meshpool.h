@@ -0,0 +1,251 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OGLP_MESHPOOL_H
+#define OGLP_MESHPOOL_H
+
+#include "common.h"
+#include "buffer.h"
+#include "fence.h"
+#include <deque>
+#include <functional>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace oglp {
+
+/** Relocatable mesh pool.
+ * Suballocates a single buffer object for mesh data. Allocations are
+ * identified by handles instead of offsets, so that Compact can move
+ * them on the GPU to close the gaps left by freed meshes. Freed and
+ * moved-away ranges are only reused once a fence inserted after their
+ * last use is signaled, so pending draws never read overwritten data.
+ */
+class MeshPool
+{
+public:
+    /** Allocation handle. Zero is never a valid handle. */
+    typedef unsigned int Handle;
+
+    /**
+     * Relocation callback.
+     * Called for every allocation moved by Compact, so that vertex array
+     * bindings or indirect draw commands referring to it can be updated.
+     * Commands issued after the callback have to use the new offset.
+     * \param handle The moved allocation.
+     * \param from The previous offset of the allocation.
+     * \param to The new offset of the allocation.
+     */
+    typedef std::function<void (Handle handle, GLintptr from, GLintptr to)>
+        RelocationCallback;
+
+    /** Pool statistics. */
+    struct Stats
+    {
+        /** Number of allocations. */
+        unsigned int allocations;
+        /** Allocated bytes including alignment padding. */
+        GLsizeiptr used;
+        /** Bytes available for allocation. */
+        GLsizeiptr free;
+        /** Size of the largest free range. */
+        GLsizeiptr largestfree;
+        /** Bytes waiting for their fence before they become free. */
+        GLsizeiptr retired;
+    };
+
+    /**
+       * Constructor.
+       * Creates the buffer object of the pool.
+       * \param _capacity Specifies the size of the buffer object.
+       * \param _alignment Specifies the alignment of all allocations,
+       *                   which has to be a power of two.
+       * \param flags Specifies the flags passed to Buffer::Storage.
+       */
+    MeshPool (GLsizeiptr _capacity, GLsizeiptr _alignment = 16,
+              GLbitfield flags = 0);
+
+    /**
+       * Deleted copy constructor.
+       * A MeshPool object can't be copy constructed.
+       */
+    MeshPool (const MeshPool &) = delete;
+
+    /**
+       * Deleted copy assignment.
+       * A MeshPool object can't be copy assigned.
+       * \return
+       */
+    MeshPool &operator= (const MeshPool &) = delete;
+
+    /**
+       * Allocate a range.
+       * \param size Specifies the size of the range in bytes.
+       * \return A handle of the allocation or zero if the size is not
+       *         positive or no free range is large enough.
+       */
+    Handle Allocate (GLsizeiptr size);
+
+    /**
+       * Free a range.
+       * The range becomes available once the commands issued
+       * before the next call of Update are completed. Zero and
+       * handles that are not allocated are ignored.
+       * \param handle Specifies the allocation to free.
+       */
+    void Free (Handle handle);
+
+    /**
+       * Return the offset of an allocation.
+       * \param handle Specifies the allocation.
+       * \return The current offset of the allocation in the buffer object.
+       */
+    GLintptr GetOffset (Handle handle) const
+    {
+        return entries[handle - 1].offset;
+    }
+
+    /**
+       * Return the size of an allocation.
+       * \param handle Specifies the allocation.
+       * \return The size requested for the allocation.
+       */
+    GLsizeiptr GetSize (Handle handle) const
+    {
+        return entries[handle - 1].size;
+    }
+
+    /**
+       * Return the buffer object.
+       * \return The buffer object of the pool.
+       */
+    Buffer &GetBuffer (void)
+    {
+        return buffer;
+    }
+
+    /**
+       * Set the relocation callback.
+       * \param callback Specifies the function called for every moved
+       *                 allocation.
+       */
+    void SetRelocationCallback (const RelocationCallback &callback)
+    {
+        relocate = callback;
+    }
+
+    /**
+       * Compact the pool.
+       * Moves allocations from the end of the buffer object into the
+       * lowest free ranges that can hold them, copying the data with
+       * Buffer::CopySubData. The old ranges are retired like freed ones.
+       * \param budget Specifies the maximum number of bytes to copy,
+       *               which bounds the GPU time spent per call.
+       * \return The number of bytes copied.
+       */
+    GLsizeiptr Compact (GLsizeiptr budget);
+
+    /**
+       * Update the pool.
+       * Inserts a fence for the ranges retired since the last update and
+       * makes ranges whose fences are signaled available again. Should
+       * be called once per frame, after the commands using the pool.
+       */
+    void Update (void);
+
+    /**
+       * Get the pool statistics.
+       * \return The current statistics.
+       */
+    Stats GetStats (void) const;
+
+private:
+    /* an allocation, size is zero for unused handles */
+    struct Entry
+    {
+        GLintptr offset;
+        GLsizeiptr size;
+    };
+
+    /* ranges waiting for a fence */
+    struct Retired
+    {
+        Fence fence;
+        std::vector<std::pair<GLintptr, GLsizeiptr>> ranges;
+    };
+
+    GLsizeiptr Padded (GLsizeiptr size) const
+    {
+        return (size + alignment - 1) & ~(alignment - 1);
+    }
+
+    std::map<GLintptr, GLsizeiptr>::iterator FindFree (GLsizeiptr size,
+                                                       GLintptr limit);
+    void Take (std::map<GLintptr, GLsizeiptr>::iterator range,
+               GLsizeiptr size);
+    void Release (GLintptr offset, GLsizeiptr size);
+    void Retire (GLintptr offset, GLsizeiptr size);
+    void Reclaim (void);
+
+    /**
+       * internal buffer object
+       */
+    Buffer buffer;
+    /**
+       * size of the buffer object
+       */
+    GLsizeiptr capacity;
+    /**
+       * alignment of all allocations
+       */
+    GLsizeiptr alignment;
+    /**
+       * allocations indexed by handle - 1
+       */
+    std::vector<Entry> entries;
+    /**
+       * unused handles
+       */
+    std::vector<Handle> unused;
+    /**
+       * handles of the allocations by offset
+       */
+    std::map<GLintptr, Handle> live;
+    /**
+       * free ranges by offset, neighbouring ranges are always merged
+       */
+    std::map<GLintptr, GLsizeiptr> freeranges;
+    /**
+       * ranges retired since the last update
+       */
+    std::vector<std::pair<GLintptr, GLsizeiptr>> retiring;
+    /**
+       * fenced retired ranges in fence order
+       */
+    std::deque<Retired> retired;
+    /**
+       * relocation callback
+       */
+    RelocationCallback relocate;
+};
+
+} /* namespace oglp */
+
+#endif /* !defined OGLP_MESHPOOL_H */
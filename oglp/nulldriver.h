@@ -0,0 +1,120 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OGLP_NULLDRIVER_H
+#define OGLP_NULLDRIVER_H
+
+#include "common.h"
+#include <atomic>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace oglp {
+
+/**
+ * Null driver.
+ * A GetProcAddressCallback that returns generated stubs for all OpenGL
+ * entry points, so that oglp can be initialized and used without an
+ * OpenGL implementation. This allows measuring the CPU cost of the
+ * wrappers in isolation. The stubs do nothing except:
+ * - GetString, GetStringi and GetIntegerv report OpenGL 4.5 with all
+ *   extensions known to oglp, so that Init succeeds.
+ * - Gen* and Create* functions return unique non-zero names.
+ * - Queries report GL_TRUE for status queries and zero otherwise.
+ * - Mapping a buffer returns memory owned by the null driver.
+ * - Sync objects are always signaled and framebuffers always complete.
+ * \param name Specifies the name of the entry point.
+ * \return The stub implementing the entry point or NULL.
+ */
+void *NullDriverGetProcAddress (const char *name);
+
+/**
+ * Enable null driver call counters.
+ * If enabled, every stub atomically increments a per entry point
+ * counter. Counting is disabled initially.
+ * \param enable Specifies whether calls should be counted.
+ */
+void SetNullDriverCounting (bool enable);
+
+/**
+ * Reset the null driver call counters.
+ */
+void ResetNullDriverCounters (void);
+
+/**
+ * Get a null driver call counter.
+ * \param name Specifies the name of the entry point, e.g. "glUniform1f".
+ * \return The number of calls counted for the entry point.
+ */
+unsigned long GetNullDriverCallCount (const std::string &name);
+
+/**
+ * Get all null driver call counters.
+ * \return The names and call counts of all entry points that
+ *         were called since the counters were last reset,
+ *         sorted by name.
+ */
+std::vector<std::pair<std::string, unsigned long>> GetNullDriverCallCounts (void);
+
+namespace internal {
+
+/* null driver entry point table, sorted by name */
+struct NullProc
+{
+    const char *name;
+    void *proc;
+    unsigned int counter;
+};
+
+extern const unsigned int NumNullProcs;
+extern const NullProc NullProcs[];
+
+/* per entry point call counters */
+extern std::atomic<bool> nullcounting;
+extern std::atomic<unsigned long> nullcounts[];
+
+inline void NullCount (unsigned int counter)
+{
+    if (nullcounting.load (std::memory_order_relaxed))
+        nullcounts[counter].fetch_add (1, std::memory_order_relaxed);
+}
+
+/* helpers implementing the stubs */
+const GLubyte *NullString (GLenum name);
+const GLubyte *NullStringi (GLenum name, GLuint index);
+GLint64 NullQueryValue (GLenum pname);
+GLuint NullName (void);
+void NullNames (GLsizei n, GLuint *names);
+GLsync NullSync (void);
+void *NullMapBuffer (GLuint buffer, GLintptr offset, GLsizeiptr length);
+void *NullMapTarget (GLenum target, GLintptr offset, GLsizeiptr length);
+
+template<typename T>
+inline void NullQuery (GLenum pname, T *params)
+{
+    if (params)
+        *params = static_cast<T> (NullQueryValue (pname));
+}
+
+} /* namespace internal */
+
+} /* namespace oglp */
+
+#endif /* !defined OGLP_NULLDRIVER_H */
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OGLP_OBJECTPOOL_H
+#define OGLP_OBJECTPOOL_H
+
+#include "common.h"
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace oglp {
+
+/** Object pool.
+ * Hands out objects of one handle class, e.g. Buffer or Query, that are
+ * created in batches with the CreateN factory of the class. Released
+ * objects are handed out again instead of being deleted. Released objects
+ * keep their OpenGL state, so a pool should only be used for objects whose
+ * state is respecified after acquiring them, such as queries of one
+ * target, or for fresh names of objects with immutable storage that are
+ * never released.
+ */
+template<typename T>
+class ObjectPool
+{
+public:
+    /**
+       * Batch factory.
+       * \param n Number of objects to create.
+       * \return The created objects.
+       */
+    typedef std::function<std::vector<T> (GLsizei n)> Factory;
+
+    /**
+       * Constructor.
+       * \param _create Specifies the batch factory, e.g. Buffer::CreateN or
+       *                a lambda calling Query::CreateN with a target.
+       * \param _batch Specifies the number of objects created at once.
+       */
+    ObjectPool (const Factory &_create, GLsizei _batch = 64)
+        : create (_create), batch (_batch)
+    {
+    }
+
+    /**
+       * Acquire an object.
+       * Creates a new batch of objects if the pool is empty.
+       * \return An object of the pool.
+       */
+    T Acquire (void)
+    {
+        if (objects.empty ()) {
+            std::vector<T> created = create (batch);
+            for (T &object : created)
+                objects.push_back (std::move (object));
+        }
+        T object = std::move (objects.back ());
+        objects.pop_back ();
+        return object;
+    }
+
+    /**
+       * Release an object.
+       * Returns an object to the pool.
+       * \param object Specifies the object to release.
+       */
+    void Release (T &&object)
+    {
+        if (object.get ())
+            objects.push_back (std::move (object));
+    }
+
+    /**
+       * Return the number of pooled objects.
+       * \return The number of objects available without creating new ones.
+       */
+    size_t GetNumObjects (void) const
+    {
+        return objects.size ();
+    }
+
+private:
+    /**
+       * batch factory
+       */
+    Factory create;
+    /**
+       * number of objects created at once
+       */
+    GLsizei batch;
+    /**
+       * available objects
+       */
+    std::vector<T> objects;
+};
+
+} /* namespace oglp */
+
+#endif /* !defined OGLP_OBJECTPOOL_H */
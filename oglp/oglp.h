@@ -22,22 +22,39 @@
 #define OGLP_H
 
 #include "common.h"
+#include "capabilities.h"
 #include "buffer.h"
+#include "bufferheap.h"
+#include "sparsebuffer.h"
+#include "mappedrange.h"
 #include "framebuffer.h"
 #include "renderbuffer.h"
 #include "vertexarray.h"
 #include "programpipeline.h"
 #include "program.h"
 #include "programresource.h"
+#include "programreflection.h"
 #include "uniform.h"
 #include "uniformblock.h"
+#include "blocklayout.h"
 #include "smartuniform.h"
+#include "uniformstore.h"
 #include "shader.h"
 #include "sampler.h"
 #include "texture.h"
 #include "query.h"
+#include "fence.h"
+#include "objectpool.h"
+#include "bindingset.h"
+#include "streambuffer.h"
+#include "meshpool.h"
+#include "uploadqueue.h"
+#include "asyncreadback.h"
 #include "conditionalrender.h"
 #include "transformfeedback.h"
+#include "trace.h"
+#include "instrument.h"
+#include "nulldriver.h"
 
 namespace oglp {
 
@@ -84,17 +101,38 @@ namespace oglp {
 /**
  * Check for an extension.
  * Checks whether the specified OpenGL extension is supported.
+ * The check uses the capabilities determined by Init and
+ * does not call into OpenGL.
  * \param name Specifies the name of the extension to check.
  * \return Whether the extension is supported.
  */
 bool IsExtensionSupported (const std::string &name);
 
+/**
+ * Check for an extension.
+ * Checks whether the specified OpenGL extension is supported.
+ * This is a constant time bit test on the capabilities
+ * determined by Init.
+ * \param ext Specifies the extension to check.
+ * \return Whether the extension is supported.
+ */
+inline bool IsExtensionSupported (Extension ext)
+{
+    return GetCapabilities ().IsExtensionSupported (ext);
+}
+
 /** Initialize oglp.
  * Initializes oglp.
+ * If lazy is true, entry points are not resolved during
+ * initialization, but each entry point resolves itself on its
+ * first call instead. This reduces the cost of Init considerably
+ * for applications that only use a small subset of OpenGL.
+ * The callback has to remain valid as long as oglp is used.
  * \param callback Callback to obtain OpenGL entry points.
+ * \param lazy Whether to resolve entry points on first use.
  * \returns Whether oglp was initialized successfully.
  */
-bool Init (GetProcAddressCallback callback);
+bool Init (GetProcAddressCallback callback, bool lazy = false);
 
 } /* namespace oglp */
 
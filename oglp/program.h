@@ -21,17 +21,26 @@
 #define PROGRAM_H
 
 #include "common.h"
+#include <cstddef>
+#include <cstdint>
+#include "hashedname.h"
 #include "uniform.h"
 #include "uniformblock.h"
 #include "programresource.h"
 #include "shader.h"
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace oglp {
 
+class ProgramReflection;
+
 /** OpenGL shader program object.
  * A wrapper class around an OpenGL shader program.
+ * After a successful Create, Link or Binary the active uniforms are
+ * enumerated once into an open-addressed location table, so that
+ * uniform lookups do not call into OpenGL.
  */
 class Program
 {
@@ -46,6 +55,15 @@ public:
         CheckError ();
     }
 
+    /**
+       * Null constructor.
+       * Creates a Program object without an internal OpenGL shader program object.
+       * An object can be move assigned to it later.
+       */
+    Program (std::nullptr_t) : obj (0)
+    {
+    }
+
     /**
        * Move constuctor.
        * Passes the internal OpenGL shader program object to
@@ -53,10 +71,10 @@ public:
        * \param p The Program object to move.
        */
     Program (Program &&p) noexcept
+        : obj (p.obj), uniformtable (std::move (p.uniformtable)),
+          uniformnames (std::move (p.uniformnames))
     {
-        GLuint tmp = obj;
-        obj = p.obj;
-        p.obj = tmp;
+        p.obj = 0;
     }
 
     /**
@@ -65,7 +83,8 @@ public:
        */
     ~Program (void)
     {
-        DeleteProgram (obj);
+        if (obj)
+            DeleteProgram (obj);
     }
 
     /**
@@ -86,6 +105,8 @@ public:
         GLuint tmp = obj;
         obj = p.obj;
         p.obj = tmp;
+        uniformtable.swap (p.uniformtable);
+        uniformnames.swap (p.uniformnames);
         return *this;
     }
 
@@ -129,6 +150,7 @@ public:
 
         GetProgramiv (obj, GL_LINK_STATUS, &status);
         CheckError ();
+        BuildUniformTable (status);
         return status;
     }
 
@@ -179,6 +201,7 @@ public:
         GLint status;
         LinkProgram (obj);
         Get (GL_LINK_STATUS, &status);
+        BuildUniformTable (status);
         return status;
     }
 
@@ -205,9 +228,27 @@ public:
 #endif
         }
         Get (GL_LINK_STATUS, &status);
+        BuildUniformTable (status);
         return status;
     }
 
+    /**
+       * Load a Program binary with its reflection.
+       * Loads the internal OpenGL program object with a program binary
+       * like Binary, but builds the uniform location table from a
+       * reflection snapshot that was saved together with the binary
+       * instead of reflecting the program again.
+       * \param binaryFormat Specifies the format of the binary data in binary.
+       * \param binary Specifies the address an array containing the binary
+       *               to be loaded into program.
+       * \param length Specifies the number of bytes contained in binary.
+       * \param reflection Specifies the reflection of the program
+       *                   the binary was obtained from.
+       * \returns whether the program was successfully loaded
+       */
+    bool Binary (GLenum binaryFormat, const void *binary,
+                 GLsizei length, const ProgramReflection &reflection);
+
     /**
        * Obtain program binary.
        * Return a binary representation of a program object's compiled and
@@ -422,6 +463,34 @@ public:
                                                          name.c_str ()));
     }
 
+    /** Get program resource.
+       * Retrieves a ProgramResource wrapper of a program resource by
+       * its index, e.g. to enumerate all resources of an interface.
+       * \param rsrcinterface A token identifying the interface within
+       *                      program containing the resource.
+       * \param index The index of the resource within the interface.
+       * \returns The ProgramResource wrapper for the program resource.
+       */
+    ProgramResource GetResource (GLenum rsrcinterface, GLuint index) const
+    {
+        return ProgramResource (obj, rsrcinterface, index);
+    }
+
+    /** Query a property of a program interface.
+       * \param rsrcinterface A token identifying the interface within
+       *                      program to query.
+       * \param pname The name of the parameter within programInterface
+       *              to query, e.g. GL_ACTIVE_RESOURCES.
+       * \returns The value of the parameter.
+       */
+    GLint GetInterface (GLenum rsrcinterface, GLenum pname) const
+    {
+        GLint value = 0;
+        GetProgramInterfaceiv (obj, rsrcinterface, pname, &value);
+        CheckError ();
+        return value;
+    }
+
     /** Get uniform block index.
          * Retrieve the index of a named uniform block.
          * \param uniformBlockName Specifies the name of the uniform block
@@ -617,7 +686,31 @@ public:
        */
     GLint GetUniformLocation (const std::string &name) const
     {
-        GLint result = oglp::GetUniformLocation (obj, name.c_str ());
+        GLint result;
+        if (!uniformtable.empty ())
+            return LookupUniform (name.data (), name.length (),
+                                  HashName (name.data (), name.length ()));
+        result = oglp::GetUniformLocation (obj, name.c_str ());
+        CheckError ();
+        return result;
+    }
+
+    /**
+       * Obtain a uniform location.
+       * Looks up the uniform location of a uniform variable by a
+       * precomputed hash without allocating and, once the program
+       * is linked, without calling into OpenGL.
+       * \param name Hashed name of the uniform variable,
+       *             usually OGLP_NAME ("name").
+       * \return the uniform location.
+       */
+    GLint GetUniformLocation (const HashedName &name) const
+    {
+        GLint result;
+        if (!uniformtable.empty ())
+            return LookupUniform (name.str, name.length, name.hash);
+        result = oglp::GetUniformLocation (obj, std::string (name.str,
+                                           name.length).c_str ());
         CheckError ();
         return result;
     }
@@ -636,6 +729,19 @@ public:
         return Uniform (obj, location);
     }
 
+    /**
+       * Obtain a Uniform location.
+       * Obtains the Uniform location of a uniform variable
+       * within the shader program by a precomputed hash,
+       * e.g. program[OGLP_NAME ("mvp")].
+       * \param name Hashed name of the uniform variable.
+       * \return An Uniform object representing the specified uniform variable.
+       */
+    Uniform operator[] (const HashedName &name) const
+    {
+        return Uniform (obj, GetUniformLocation (name));
+    }
+
     /**
        * Return internal object.
        * Returns the internal OpenGL shader program object. Use with caution.
@@ -647,10 +753,34 @@ public:
     }
 
 private:
+    /* entry of the uniform location table */
+    struct UniformEntry
+    {
+        uint32_t hash;
+        GLint location;
+        uint32_t name;
+        uint32_t length;
+    };
+
+    void BuildUniformTable (bool linked);
+    void BuildUniformTable (const ProgramReflection &reflection);
+    void FillUniformTable (const std::vector<std::pair<std::string,
+                           GLint>> &uniforms);
+    GLint LookupUniform (const char *name, size_t length, uint32_t hash) const;
+
     /**
        * internal OpenGL shader program
        */
     GLuint obj;
+    /**
+       * open-addressed uniform location table with a power of two size,
+       * empty until the program is linked
+       */
+    std::vector<UniformEntry> uniformtable;
+    /**
+       * names of the uniforms in the location table
+       */
+    std::string uniformnames;
 };
 
 } /* namespace oglp */
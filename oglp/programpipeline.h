@@ -21,6 +21,8 @@
 #define OGLP_PROGRAMPIPELINE_H
 
 #include "common.h"
+#include <cstddef>
+#include <vector>
 #include "program.h"
 #include <string>
 
@@ -41,17 +43,44 @@ public:
         CheckError ();
     }
 
+    /**
+       * Null constructor.
+       * Creates a ProgramPipeline object without an internal OpenGL program pipeline object.
+       * An object can be move assigned to it later.
+       */
+    ProgramPipeline (std::nullptr_t) : obj (0)
+    {
+    }
+
+    /**
+       * Create multiple ProgramPipeline objects.
+       * Creates the internal OpenGL program pipeline objects with a single call.
+       * \param n Specifies the number of objects to create.
+       * \return The created ProgramPipeline objects.
+       */
+    static std::vector<ProgramPipeline> CreateN (GLsizei n)
+    {
+        std::vector<GLuint> names (n);
+        std::vector<ProgramPipeline> objects;
+        CreateProgramPipelines (n, names.data ());
+        CheckError ();
+        objects.reserve (n);
+        for (GLuint name : names) {
+            objects.emplace_back (nullptr);
+            objects.back ().obj = name;
+        }
+        return objects;
+    }
+
     /**
        * Move constuctor.
        * Passes the internal OpenGL shader pipeline object to
        * another ProgramPipeline object.
        * \param pipeline The ProgramPipeline object to move.
        */
-    ProgramPipeline (ProgramPipeline &&pipeline) noexcept
+    ProgramPipeline (ProgramPipeline &&pipeline) noexcept : obj (pipeline.obj)
     {
-        GLuint tmp = obj;
-        obj = pipeline.obj;
-        pipeline.obj = tmp;
+        pipeline.obj = 0;
     }
 
     /**
@@ -66,7 +95,8 @@ public:
        */
     ~ProgramPipeline (void)
     {
-        DeleteProgramPipelines (1, &obj);
+        if (obj)
+            DeleteProgramPipelines (1, &obj);
     }
 
     /**
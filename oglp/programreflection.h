@@ -0,0 +1,425 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OGLP_PROGRAMREFLECTION_H
+#define OGLP_PROGRAMREFLECTION_H
+
+#include "common.h"
+#include "hashedname.h"
+#include "program.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace oglp {
+
+/** Program reflection snapshot.
+ * Queries all active resources of a linked program once, i.e. the
+ * uniforms, uniform blocks, shader storage blocks and their buffer
+ * variables, the program inputs and outputs and the subroutine uniforms
+ * and subroutines of all stages, and keeps them in flat arrays with all
+ * names interned in one string arena. All queries on the snapshot are
+ * answered without calling into OpenGL.
+ * The snapshot can be serialized next to a program binary, so that a
+ * program loaded from a binary with Program::Binary does not need to
+ * be reflected again. The serialized form uses the native byte order
+ * and is only meant to be cached on the same machine.
+ */
+class ProgramReflection
+{
+public:
+    /** Variable.
+     * A uniform, buffer variable, program input or program output.
+     * Properties that do not apply to a resource are -1.
+     */
+    struct Variable
+    {
+        /** Offset of the name in the string arena. */
+        uint32_t name;
+        /** Length of the name, arrays are named "name[0]". */
+        uint32_t length;
+        /** Hash of the name as computed by HashName. */
+        uint32_t hash;
+        /** GL type of the variable, e.g. GL_FLOAT_VEC3. */
+        GLenum type;
+        /** Number of array elements, 1 if the variable is no array
+         *  and 0 for an unsized array. */
+        GLint arraysize;
+        /** Location, -1 for members of blocks. */
+        GLint location;
+        /** Index of the containing uniform or shader storage block. */
+        GLint block;
+        /** Offset in the containing block in bytes. */
+        GLint offset;
+        /** Distance between array elements in bytes. */
+        GLint arraystride;
+        /** Distance between matrix columns or rows in bytes. */
+        GLint matrixstride;
+        /** Number of elements of the top-level array of a buffer
+         *  variable. */
+        GLint toplevelarraysize;
+        /** Stride of the top-level array of a buffer variable. */
+        GLint toplevelarraystride;
+        /** First entry of the locations of the array elements after
+         *  the first one in the index pool of uniform arrays. */
+        GLint elements;
+    };
+
+    /** Block.
+     * A uniform or shader storage block.
+     */
+    struct Block
+    {
+        /** Offset of the name in the string arena. */
+        uint32_t name;
+        /** Length of the name. */
+        uint32_t length;
+        /** Hash of the name as computed by HashName. */
+        uint32_t hash;
+        /** Binding point of the block. */
+        GLint binding;
+        /** Minimum size of a buffer bound to the block in bytes. */
+        GLint datasize;
+        /** First entry of the active variables in the index pool. */
+        uint32_t members;
+        /** Number of active variables. */
+        uint32_t nummembers;
+    };
+
+    /** Subroutine.
+     * A subroutine uniform or a subroutine of a shader stage.
+     */
+    struct Subroutine
+    {
+        /** Offset of the name in the string arena. */
+        uint32_t name;
+        /** Length of the name. */
+        uint32_t length;
+        /** Hash of the name as computed by HashName. */
+        uint32_t hash;
+        /** Shader stage, e.g. GL_FRAGMENT_SHADER. */
+        GLenum stage;
+        /** Location of a subroutine uniform or index of a subroutine. */
+        GLint location;
+        /** Number of array elements of a subroutine uniform. */
+        GLint arraysize;
+        /** First entry of the indices of the compatible subroutines
+         *  of a subroutine uniform in the index pool, which refer to
+         *  the subroutines of all stages. */
+        uint32_t compatible;
+        /** Number of compatible subroutines, 0 for subroutines. */
+        uint32_t numcompatible;
+    };
+
+    /**
+       * Default constructor.
+       * Creates an empty reflection snapshot.
+       */
+    ProgramReflection (void)
+    {
+    }
+
+    /**
+       * Constructor.
+       * Reflects all active resources of a linked program.
+       * \param program Specifies the linked program.
+       */
+    ProgramReflection (const Program &program);
+
+    /**
+       * Serialize the snapshot.
+       * Appends the serialized snapshot to a byte array.
+       * \param data Specifies the byte array to append to.
+       */
+    void Serialize (std::vector<GLubyte> &data) const;
+
+    /**
+       * Deserialize the snapshot.
+       * Replaces the snapshot with one serialized by Serialize.
+       * \param data Specifies the serialized snapshot.
+       * \param size Specifies the size of the serialized snapshot.
+       * \return Whether the data contained a valid snapshot. If not,
+       *         the snapshot is empty afterwards.
+       */
+    bool Deserialize (const void *data, size_t size);
+
+    /**
+       * Return the active uniforms.
+       * \return The uniforms in the order of the GL_UNIFORM interface.
+       */
+    const std::vector<Variable> &GetUniforms (void) const
+    {
+        return uniforms;
+    }
+
+    /**
+       * Return the uniform blocks.
+       * \return The blocks in the order of the GL_UNIFORM_BLOCK interface.
+       */
+    const std::vector<Block> &GetUniformBlocks (void) const
+    {
+        return uniformblocks;
+    }
+
+    /**
+       * Return the shader storage blocks.
+       * \return The blocks in the order of the GL_SHADER_STORAGE_BLOCK
+       *         interface.
+       */
+    const std::vector<Block> &GetStorageBlocks (void) const
+    {
+        return storageblocks;
+    }
+
+    /**
+       * Return the buffer variables.
+       * \return The buffer variables in the order of the
+       *         GL_BUFFER_VARIABLE interface.
+       */
+    const std::vector<Variable> &GetBufferVariables (void) const
+    {
+        return buffervariables;
+    }
+
+    /**
+       * Return the program inputs.
+       * \return The inputs in the order of the GL_PROGRAM_INPUT interface.
+       */
+    const std::vector<Variable> &GetInputs (void) const
+    {
+        return inputs;
+    }
+
+    /**
+       * Return the program outputs.
+       * \return The outputs in the order of the GL_PROGRAM_OUTPUT
+       *         interface.
+       */
+    const std::vector<Variable> &GetOutputs (void) const
+    {
+        return outputs;
+    }
+
+    /**
+       * Return the subroutine uniforms.
+       * \return The subroutine uniforms of all stages in pipeline order.
+       */
+    const std::vector<Subroutine> &GetSubroutineUniforms (void) const
+    {
+        return subroutineuniforms;
+    }
+
+    /**
+       * Return the subroutines.
+       * \return The subroutines of all stages in pipeline order.
+       */
+    const std::vector<Subroutine> &GetSubroutines (void) const
+    {
+        return subroutines;
+    }
+
+    /**
+       * Return the name of a resource.
+       * \param resource Specifies a resource of this snapshot.
+       * \return The null terminated name of the resource, which is valid
+       *         as long as the snapshot is not modified.
+       */
+    template<typename T>
+    const char *GetName (const T &resource) const
+    {
+        return &names[resource.name];
+    }
+
+    /**
+       * Return the active variables of a block.
+       * \param block Specifies a uniform or shader storage block of
+       *              this snapshot.
+       * \return The indices of the variables of the block in the uniforms
+       *         or buffer variables respectively.
+       */
+    const GLuint *GetMembers (const Block &block) const
+    {
+        return indices.data () + block.members;
+    }
+
+    /**
+       * Return the compatible subroutines of a subroutine uniform.
+       * \param uniform Specifies a subroutine uniform of this snapshot.
+       * \return The indices of the compatible subroutines in the
+       *         subroutines of all stages. Their index within the
+       *         stage is Subroutine::location.
+       */
+    const GLuint *GetCompatibleSubroutines (const Subroutine &uniform) const
+    {
+        return indices.data () + uniform.compatible;
+    }
+
+    /**
+       * Return the location of a uniform array element.
+       * \param uniform Specifies a uniform of this snapshot.
+       * \param element Specifies the array element.
+       * \return The location of the element, -1 if the uniform has no
+       *         location or the element is out of range.
+       */
+    GLint GetLocation (const Variable &uniform, GLint element) const
+    {
+        if (uniform.location < 0 || element < 0
+            || element >= uniform.arraysize)
+            return -1;
+        if (!element)
+            return uniform.location;
+        if (uniform.elements < 0)
+            return -1;
+        return GLint (indices[uniform.elements + element - 1]);
+    }
+
+    /**
+       * Find a uniform.
+       * \param name Specifies the name of the uniform, usually
+       *             OGLP_NAME ("name"). Arrays are named "name[0]".
+       * \return The uniform or NULL if there is no such uniform.
+       */
+    const Variable *FindUniform (const HashedName &name) const
+    {
+        return Find (uniforms, name);
+    }
+
+    /**
+       * Find a uniform block.
+       * \param name Specifies the name of the block.
+       * \return The block or NULL if there is no such block.
+       */
+    const Block *FindUniformBlock (const HashedName &name) const
+    {
+        return Find (uniformblocks, name);
+    }
+
+    /**
+       * Find a shader storage block.
+       * \param name Specifies the name of the block.
+       * \return The block or NULL if there is no such block.
+       */
+    const Block *FindStorageBlock (const HashedName &name) const
+    {
+        return Find (storageblocks, name);
+    }
+
+    /**
+       * Find a buffer variable.
+       * \param name Specifies the name of the buffer variable.
+       * \return The buffer variable or NULL if there is no such variable.
+       */
+    const Variable *FindBufferVariable (const HashedName &name) const
+    {
+        return Find (buffervariables, name);
+    }
+
+    /**
+       * Find a program input.
+       * \param name Specifies the name of the input.
+       * \return The input or NULL if there is no such input.
+       */
+    const Variable *FindInput (const HashedName &name) const
+    {
+        return Find (inputs, name);
+    }
+
+    /**
+       * Find a program output.
+       * \param name Specifies the name of the output.
+       * \return The output or NULL if there is no such output.
+       */
+    const Variable *FindOutput (const HashedName &name) const
+    {
+        return Find (outputs, name);
+    }
+
+    /**
+       * Check whether the snapshot is empty.
+       * \return Whether the snapshot contains no resources.
+       */
+    bool IsEmpty (void) const
+    {
+        return names.empty ();
+    }
+
+private:
+    template<typename T>
+    const T *Find (const std::vector<T> &resources,
+                   const HashedName &name) const
+    {
+        for (const T &resource : resources) {
+            if (resource.hash == name.hash && resource.length == name.length
+                && !names.compare (resource.name, resource.length, name.str,
+                                   name.length))
+                return &resource;
+        }
+        return NULL;
+    }
+
+    uint32_t Intern (const GLchar *name, GLsizei length);
+    bool Validate (void) const;
+    void Clear (void);
+
+    /**
+       * active uniforms
+       */
+    std::vector<Variable> uniforms;
+    /**
+       * uniform blocks
+       */
+    std::vector<Block> uniformblocks;
+    /**
+       * shader storage blocks
+       */
+    std::vector<Block> storageblocks;
+    /**
+       * buffer variables
+       */
+    std::vector<Variable> buffervariables;
+    /**
+       * program inputs
+       */
+    std::vector<Variable> inputs;
+    /**
+       * program outputs
+       */
+    std::vector<Variable> outputs;
+    /**
+       * subroutine uniforms of all stages
+       */
+    std::vector<Subroutine> subroutineuniforms;
+    /**
+       * subroutines of all stages
+       */
+    std::vector<Subroutine> subroutines;
+    /**
+       * pool of block members, compatible subroutines and
+       * array element locations
+       */
+    std::vector<GLuint> indices;
+    /**
+       * null terminated names of all resources
+       */
+    std::string names;
+};
+
+} /* namespace oglp */
+
+#endif /* !defined OGLP_PROGRAMREFLECTION_H */
@@ -21,6 +21,8 @@
 #define OGLP_QUERY_H
 
 #include "common.h"
+#include <cstddef>
+#include <vector>
 
 namespace oglp {
 
@@ -41,16 +43,53 @@ public:
         CheckError ();
     }
 
+    /**
+       * Default constructor.
+       * Creates a Query object without an internal OpenGL query object,
+       * same as the null constructor.
+       */
+    Query (void) : obj (0)
+    {
+    }
+
+    /**
+       * Null constructor.
+       * Creates a Query object without an internal OpenGL query object.
+       * An object can be move assigned to it later.
+       */
+    Query (std::nullptr_t) : obj (0)
+    {
+    }
+
+    /**
+       * Create multiple Query objects.
+       * Creates the internal OpenGL query objects with a single call.
+       * \param target Specifies the target of the created objects.
+       * \param n Specifies the number of objects to create.
+       * \return The created Query objects.
+       */
+    static std::vector<Query> CreateN (GLenum target, GLsizei n)
+    {
+        std::vector<GLuint> names (n);
+        std::vector<Query> objects;
+        CreateQueries (target, n, names.data ());
+        CheckError ();
+        objects.reserve (n);
+        for (GLuint name : names) {
+            objects.emplace_back (nullptr);
+            objects.back ().obj = name;
+        }
+        return objects;
+    }
+
     /**
        * Move constuctor.
        * Passes the internal OpenGL Query object to another Query object.
        * \param query The Query object to move.
        */
-    Query (Query &&query) noexcept
+    Query (Query &&query) noexcept : obj (query.obj)
     {
-        GLuint tmp = obj;
-        obj = query.obj;
-        query.obj = tmp;
+        query.obj = 0;
     }
 
     /**
@@ -65,7 +104,8 @@ public:
        */
     ~Query (void)
     {
-        DeleteQueries (1, &obj);
+        if (obj)
+            DeleteQueries (1, &obj);
     }
 
     /**
@@ -21,6 +21,8 @@
 #define OGLP_RENDERBUFFER_H
 
 #include "common.h"
+#include <cstddef>
+#include <vector>
 
 namespace oglp {
 
@@ -39,17 +41,44 @@ public:
         CheckError ();
     }
 
+    /**
+       * Null constructor.
+       * Creates a Renderbuffer object without an internal OpenGL renderbuffer object.
+       * An object can be move assigned to it later.
+       */
+    Renderbuffer (std::nullptr_t) : obj (0)
+    {
+    }
+
+    /**
+       * Create multiple Renderbuffer objects.
+       * Creates the internal OpenGL renderbuffer objects with a single call.
+       * \param n Specifies the number of objects to create.
+       * \return The created Renderbuffer objects.
+       */
+    static std::vector<Renderbuffer> CreateN (GLsizei n)
+    {
+        std::vector<GLuint> names (n);
+        std::vector<Renderbuffer> objects;
+        CreateRenderbuffers (n, names.data ());
+        CheckError ();
+        objects.reserve (n);
+        for (GLuint name : names) {
+            objects.emplace_back (nullptr);
+            objects.back ().obj = name;
+        }
+        return objects;
+    }
+
     /**
        * Move constuctor.
        * Passes the internal OpenGL renderbuffer object to another
        * Renderbuffer object.
        * \param renderbuffer The Renderbuffer object to move.
        */
-    Renderbuffer (Renderbuffer &&renderbuffer) noexcept
+    Renderbuffer (Renderbuffer &&renderbuffer) noexcept : obj (renderbuffer.obj)
     {
-        GLuint tmp = obj;
-        obj = renderbuffer.obj;
-        renderbuffer.obj = tmp;
+        renderbuffer.obj = 0;
     }
 
     /**
@@ -64,7 +93,8 @@ public:
        */
     ~Renderbuffer (void)
     {
-        DeleteRenderbuffers (1, &obj);
+        if (obj)
+            DeleteRenderbuffers (1, &obj);
     }
 
     /**
@@ -21,6 +21,8 @@
 #define OGLP_SAMPLER_H
 
 #include "common.h"
+#include <cstddef>
+#include <vector>
 
 namespace oglp {
 
@@ -39,16 +41,43 @@ public:
         CheckError ();
     }
 
+    /**
+       * Null constructor.
+       * Creates a Sampler object without an internal OpenGL sampler object.
+       * An object can be move assigned to it later.
+       */
+    Sampler (std::nullptr_t) : obj (0)
+    {
+    }
+
+    /**
+       * Create multiple Sampler objects.
+       * Creates the internal OpenGL sampler objects with a single call.
+       * \param n Specifies the number of objects to create.
+       * \return The created Sampler objects.
+       */
+    static std::vector<Sampler> CreateN (GLsizei n)
+    {
+        std::vector<GLuint> names (n);
+        std::vector<Sampler> objects;
+        CreateSamplers (n, names.data ());
+        CheckError ();
+        objects.reserve (n);
+        for (GLuint name : names) {
+            objects.emplace_back (nullptr);
+            objects.back ().obj = name;
+        }
+        return objects;
+    }
+
     /**
        * Move constuctor.
        * Passes the internal OpenGL sampler object to another Sampler object.
        * \param sampler Sampler object to move.
        */
-    Sampler (Sampler &&sampler) noexcept
+    Sampler (Sampler &&sampler) noexcept : obj (sampler.obj)
     {
-        GLuint tmp = obj;
-        obj = sampler.obj;
-        sampler.obj = tmp;
+        sampler.obj = 0;
     }
 
     /**
@@ -63,8 +92,10 @@ public:
        */
     ~Sampler (void)
     {
-        DeleteSamplers (1, &obj);
-        CheckError ();
+        if (obj) {
+            DeleteSamplers (1, &obj);
+            CheckError ();
+        }
     }
 
     /**
@@ -61,11 +61,9 @@ public:
        * another Shader object.
        * \param s Shader object to move.
        */
-    Shader (Shader &&s) noexcept
+    Shader (Shader &&s) noexcept : obj (s.obj)
     {
-        GLuint tmp = obj;
-        obj = s.obj;
-        s.obj = tmp;
+        s.obj = 0;
     }
 
     /**
@@ -74,7 +72,8 @@ public:
        */
     ~Shader (void)
     {
-        DeleteShader (obj);
+        if (obj)
+            DeleteShader (obj);
     }
 
     /**
@@ -0,0 +1,220 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OGLP_SPARSEBUFFER_H
+#define OGLP_SPARSEBUFFER_H
+
+#include "common.h"
+#include "buffer.h"
+#include <cstdint>
+#include <vector>
+
+namespace oglp {
+
+/** Sparse buffer.
+ * Reserves a large virtual range of buffer memory, of which only the
+ * committed pages are backed by physical memory. If ARB_sparse_buffer
+ * is supported, the range is a single buffer object with sparse storage
+ * and pages are committed with glNamedBufferPageCommitmentARB.
+ * Otherwise the range is emulated with one buffer object per page,
+ * which is created on commitment, so a range of the sparse buffer can
+ * only be used as a whole if it does not cross a page boundary.
+ * Commitment is tracked in a bitmap in both cases.
+ */
+class SparseBuffer
+{
+public:
+    /** Location.
+     * The buffer object and offset containing a byte of the
+     * sparse buffer.
+     */
+    struct Location
+    {
+        /** Buffer object containing the byte, NULL if the byte is
+         *  outside the range or its page is not committed in
+         *  emulation. */
+        Buffer *buffer;
+        /** Offset of the byte within the buffer object. */
+        GLintptr offset;
+    };
+
+    /**
+       * Constructor.
+       * Reserves a virtual range without committing any pages.
+       * \param size Specifies the size of the virtual range, which
+       *             is rounded up to a multiple of the page size.
+       * \param flags Specifies the storage flags, which must not contain
+       *              GL_MAP_PERSISTENT_BIT or GL_MAP_COHERENT_BIT.
+       * \param emulatedpagesize Specifies the page size used if
+       *                         ARB_sparse_buffer is not supported
+       *                         or reports no page size. If it is
+       *                         not positive, either an exception is
+       *                         thrown or the range is empty.
+       */
+    SparseBuffer (GLsizeiptr size, GLbitfield flags = 0,
+                  GLsizeiptr emulatedpagesize = 1 << 20);
+
+    /**
+       * Deleted copy constructor.
+       * A SparseBuffer object can't be copy constructed.
+       */
+    SparseBuffer (const SparseBuffer &) = delete;
+
+    /**
+       * Deleted copy assignment.
+       * A SparseBuffer object can't be copy assigned.
+       * \return
+       */
+    SparseBuffer &operator= (const SparseBuffer &) = delete;
+
+    /**
+       * Commit pages.
+       * Backs all pages overlapping a range with physical memory.
+       * Pages that are already committed are left untouched, the
+       * contents of newly committed pages are undefined.
+       * \param offset Specifies the offset of the range.
+       * \param size Specifies the size of the range.
+       * \return The number of newly committed pages.
+       */
+    size_t Commit (GLintptr offset, GLsizeiptr size);
+
+    /**
+       * Decommit pages.
+       * Releases the physical memory of all pages overlapping a range.
+       * \param offset Specifies the offset of the range.
+       * \param size Specifies the size of the range.
+       * \return The number of decommitted pages.
+       */
+    size_t Decommit (GLintptr offset, GLsizeiptr size);
+
+    /**
+       * Check commitment.
+       * \param offset Specifies the offset of the range.
+       * \param size Specifies the size of the range.
+       * \return Whether all pages overlapping the range are committed,
+       *         false if the range exceeds the virtual range.
+       */
+    bool IsCommitted (GLintptr offset, GLsizeiptr size) const;
+
+    /**
+       * Locate a byte.
+       * \param offset Specifies the offset of the byte in the
+       *               virtual range.
+       * \return The buffer object and offset containing the byte. The
+       *         buffer object is NULL if the offset is outside the
+       *         virtual range or its page is not committed.
+       */
+    Location Locate (GLintptr offset)
+    {
+        if (offset < 0 || offset >= GetSize ())
+            return Location { NULL, 0 };
+        if (sparse)
+            return Location { &buffers[0], offset };
+        Buffer &page = buffers[offset / pagesize];
+        return Location { page.get () ? &page : NULL, offset % pagesize };
+    }
+
+    /**
+       * Check for sparse storage.
+       * \return Whether ARB_sparse_buffer is used, i.e. whether the
+       *         virtual range is a single buffer object.
+       */
+    bool IsSparse (void) const
+    {
+        return sparse;
+    }
+
+    /**
+       * Get the buffer object.
+       * Only available with sparse storage.
+       * \return The buffer object containing the virtual range.
+       */
+    const Buffer &GetBuffer (void) const
+    {
+        return buffers[0];
+    }
+
+    /**
+       * Get the page size.
+       * \return The granularity of commitment in bytes.
+       */
+    GLsizeiptr GetPageSize (void) const
+    {
+        return pagesize;
+    }
+
+    /**
+       * Get the size.
+       * \return The size of the virtual range in bytes.
+       */
+    GLsizeiptr GetSize (void) const
+    {
+        return GLsizeiptr (numpages) * pagesize;
+    }
+
+    /**
+       * Get the committed size.
+       * \return The number of bytes backed by physical memory.
+       */
+    GLsizeiptr GetCommittedSize (void) const
+    {
+        return GLsizeiptr (committed) * pagesize;
+    }
+
+private:
+    bool IsPageCommitted (size_t page) const
+    {
+        return (bitmap[page >> 6] >> (page & 63)) & 1;
+    }
+    void SetPages (size_t first, size_t last, bool commit);
+
+    /**
+       * whether ARB_sparse_buffer is used
+       */
+    bool sparse;
+    /**
+       * storage flags
+       */
+    GLbitfield flags;
+    /**
+       * page size in bytes
+       */
+    GLsizeiptr pagesize;
+    /**
+       * number of pages in the virtual range
+       */
+    size_t numpages;
+    /**
+       * number of committed pages
+       */
+    size_t committed;
+    /**
+       * the sparse buffer object or one buffer object per page
+       * in emulation, which is null unless the page is committed
+       */
+    std::vector<Buffer> buffers;
+    /**
+       * commitment bit per page
+       */
+    std::vector<uint64_t> bitmap;
+};
+
+} /* namespace oglp */
+
+#endif /* !defined OGLP_SPARSEBUFFER_H */
@@ -0,0 +1,237 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OGLP_STREAMBUFFER_H
+#define OGLP_STREAMBUFFER_H
+
+#include "common.h"
+#include "buffer.h"
+#include "fence.h"
+#include <vector>
+
+namespace oglp {
+
+/** Streaming ring buffer.
+ * A buffer object with immutable storage that stays persistently mapped
+ * for writing. The buffer is split into a number of equally sized regions,
+ * one of which is written to per frame. Reusing a region waits for
+ * the fence inserted when the region was last finished, so that data
+ * still read by the GPU is never overwritten. Dynamic data can be written
+ * directly to the mapping instead of being copied by Buffer::SubData.
+ */
+class StreamBuffer
+{
+public:
+    /** Allocation.
+     * A range of the current region returned by Allocate.
+     */
+    struct Allocation
+    {
+        /** Pointer to the mapped memory of the range or NULL. */
+        GLvoid *ptr;
+        /** Offset of the range within the buffer object. */
+        GLintptr offset;
+    };
+
+    /**
+       * Constructor.
+       * Creates the buffer object and maps it persistently.
+       * \param _regionsize Specifies the size of a region in bytes.
+       * \param _regions Specifies the number of regions, i.e. the number
+       *                 of frames that can be in flight.
+       * \param _coherent Specifies whether the mapping is coherent.
+       *                  Otherwise the written data has to be made
+       *                  visible by Flush, which happens automatically
+       *                  in NextFrame.
+       */
+    StreamBuffer (GLsizeiptr _regionsize, unsigned int _regions = 3,
+                  bool _coherent = true)
+        : regionsize (_regionsize), coherent (_coherent), fences (_regions),
+          region (0), head (0), flushed (0)
+    {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT;
+        if (coherent)
+            flags |= GL_MAP_COHERENT_BIT;
+        buffer.Storage (regionsize * _regions, NULL, flags);
+        ptr = static_cast<char *> (buffer.MapRange (0, regionsize * _regions,
+            coherent ? flags : flags | GL_MAP_FLUSH_EXPLICIT_BIT));
+    }
+
+    /**
+       * Deleted copy constructor.
+       * A StreamBuffer object can't be copy constructed.
+       */
+    StreamBuffer (const StreamBuffer &) = delete;
+
+    /**
+       * A destructor.
+       * Unmaps and deletes the buffer object.
+       */
+    ~StreamBuffer (void)
+    {
+        if (ptr)
+            UnmapNamedBuffer (buffer.get ());
+    }
+
+    /**
+       * Deleted copy assignment.
+       * A StreamBuffer object can't be copy assigned.
+       * \return
+       */
+    StreamBuffer &operator= (const StreamBuffer &) = delete;
+
+    /**
+       * Allocate a range.
+       * Allocates a range of the current region.
+       * \param size Specifies the size of the range in bytes.
+       * \param align Specifies the required alignment of the offset of
+       *              the range within the buffer object, e.g. the value
+       *              of GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT. Zero is
+       *              treated as one.
+       * \return The allocated range. If the current region has no
+       *         space left, ptr is NULL.
+       */
+    Allocation Allocate (GLsizeiptr size, GLsizeiptr align = 1)
+    {
+        Allocation allocation;
+        GLintptr base = region * regionsize;
+        GLintptr offset = base + head;
+        if (align < 1)
+            align = 1;
+        offset = ((offset + align - 1) / align) * align;
+        if (!ptr || offset + size > base + regionsize) {
+            allocation.ptr = NULL;
+            allocation.offset = 0;
+            return allocation;
+        }
+        head = offset + size - base;
+        allocation.ptr = ptr + offset;
+        allocation.offset = offset;
+        return allocation;
+    }
+
+    /**
+       * Flush written data.
+       * Makes the data written to the current region since the last
+       * flush visible to OpenGL. This is only necessary for non-coherent
+       * stream buffers and only if the data is used before NextFrame.
+       */
+    void Flush (void)
+    {
+        if (!coherent && head > flushed) {
+            buffer.FlushMappedRange (region * regionsize + flushed,
+                                     head - flushed);
+            flushed = head;
+        }
+    }
+
+    /**
+       * Advance to the next frame.
+       * Flushes the current region and fences it after all commands
+       * issued so far, i.e. after all commands that use its data. Then
+       * switches to the next region, waiting until the GPU is done
+       * with it, if necessary.
+       * \return Whether the wait succeeded. If it failed, the error
+       *         is reported according to the error checking policy and
+       *         the region stays full, so that Allocate fails until
+       *         the next call of NextFrame.
+       */
+    bool NextFrame (void)
+    {
+        Flush ();
+        fences[region].Insert ();
+        region = (region + 1) % fences.size ();
+        if (!fences[region].ClientWait (GL_TIMEOUT_IGNORED)) {
+            /* the GPU may still read the region */
+            head = flushed = regionsize;
+            return false;
+        }
+        head = flushed = 0;
+        fences[region].Reset ();
+        return true;
+    }
+
+    /**
+       * Return the buffer object.
+       * \return The internal buffer object, e.g. for binding ranges
+       *         returned by Allocate.
+       */
+    const Buffer &GetBuffer (void) const
+    {
+        return buffer;
+    }
+
+    /**
+       * Return the region size.
+       * \return The size of a region in bytes, i.e. the upper limit
+       *         for the total size allocated per frame.
+       */
+    GLsizeiptr GetRegionSize (void) const
+    {
+        return regionsize;
+    }
+
+    /**
+       * Return the used size.
+       * \return The number of bytes of the current region that are
+       *         allocated including alignment padding.
+       */
+    GLsizeiptr GetUsedSize (void) const
+    {
+        return head;
+    }
+
+private:
+    /**
+       * internal buffer object
+       */
+    Buffer buffer;
+    /**
+       * size of a region
+       */
+    GLsizeiptr regionsize;
+    /**
+       * whether the mapping is coherent
+       */
+    bool coherent;
+    /**
+       * fences guarding the reuse of the regions
+       */
+    std::vector<Fence> fences;
+    /**
+       * persistently mapped memory of the buffer object
+       */
+    char *ptr;
+    /**
+       * index of the current region
+       */
+    unsigned int region;
+    /**
+       * allocated bytes of the current region
+       */
+    GLsizeiptr head;
+    /**
+       * flushed bytes of the current region
+       */
+    GLsizeiptr flushed;
+};
+
+} /* namespace oglp */
+
+#endif /* !defined OGLP_STREAMBUFFER_H */
@@ -21,6 +21,8 @@
 #define OGLP_TEXTURE_H
 
 #include "common.h"
+#include <cstddef>
+#include <vector>
 #include "buffer.h"
 #include <iostream>
 
@@ -44,16 +46,53 @@ public:
         CheckError ();
     }
 
+    /**
+       * Default constructor.
+       * Creates a Texture object without an internal OpenGL texture object,
+       * same as the null constructor.
+       */
+    Texture (void) : obj (0)
+    {
+    }
+
+    /**
+       * Null constructor.
+       * Creates a Texture object without an internal OpenGL texture object.
+       * An object can be move assigned to it later.
+       */
+    Texture (std::nullptr_t) : obj (0)
+    {
+    }
+
+    /**
+       * Create multiple Texture objects.
+       * Creates the internal OpenGL texture objects with a single call.
+       * \param target Specifies the target of the created objects.
+       * \param n Specifies the number of objects to create.
+       * \return The created Texture objects.
+       */
+    static std::vector<Texture> CreateN (GLenum target, GLsizei n)
+    {
+        std::vector<GLuint> names (n);
+        std::vector<Texture> objects;
+        CreateTextures (target, n, names.data ());
+        CheckError ();
+        objects.reserve (n);
+        for (GLuint name : names) {
+            objects.emplace_back (nullptr);
+            objects.back ().obj = name;
+        }
+        return objects;
+    }
+
     /**
        * Move constuctor.
        * Passes the internal OpenGL texture object to another Texture object.
        * \param texture Texture object to move.
        */
-    Texture (Texture &&texture) noexcept
+    Texture (Texture &&texture) noexcept : obj (texture.obj)
     {
-        GLuint tmp = obj;
-        obj = texture.obj;
-        texture.obj = tmp;
+        texture.obj = 0;
     }
 
     /**
@@ -68,7 +107,8 @@ public:
        */
     ~Texture (void)
     {
-        DeleteTextures (1, &obj);
+        if (obj)
+            DeleteTextures (1, &obj);
     }
 
     /**
@@ -492,6 +532,36 @@ public:
         CheckError ();
     }
 
+    /**
+       * Return a texture subimage.
+       * Returns a region of a level of the internal texture object.
+       * If a buffer object is bound to GL_PIXEL_PACK_BUFFER, pixels
+       * is an offset into it and the call does not wait for the image.
+       * \param level Specifies the level-of-detail number of the desired image.
+       * \param xoffset Specifies the x offset of the region.
+       * \param yoffset Specifies the y offset of the region.
+       * \param zoffset Specifies the z offset or the first layer of the region.
+       * \param width Specifies the width of the region.
+       * \param height Specifies the height of the region.
+       * \param depth Specifies the depth or the number of layers of the region.
+       * \param format Specifies a pixel format for the returned data,
+       *               see GetTexImage.
+       * \param type Specifies a pixel type for the returned data,
+       *             see GetTexImage.
+       * \param bufSize Specifies the size of the buffer pixels.
+       * \param pixels Returns the texture subimage.
+       * \sa GetTexImage()
+       */
+    void GetSubImage (GLint level, GLint xoffset, GLint yoffset, GLint zoffset,
+                      GLsizei width, GLsizei height, GLsizei depth,
+                      GLenum format, GLenum type, GLsizei bufSize,
+                      GLvoid *pixels) const
+    {
+        GetTextureSubImage (obj, level, xoffset, yoffset, zoffset, width,
+                            height, depth, format, type, bufSize, pixels);
+        CheckError ();
+    }
+
     /**
        * Generate mipmaps.
        * Generates mipmaps for the internal texture object.
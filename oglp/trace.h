@@ -0,0 +1,363 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OGLP_TRACE_H
+#define OGLP_TRACE_H
+
+#include "common.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#ifdef OGLP_TRACE
+#include <atomic>
+#endif
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace oglp {
+
+/** \page trace Trace file format
+ * If OGLP_TRACE is defined, StartTrace installs a generated thunk in front
+ * of every entry point that records the call into an append-only binary
+ * file. All values are stored in host byte order.
+ *
+ * The file starts with the 8 byte magic "OGLPTRC1", the format version
+ * and the number of entry points as 32 bit integers, followed by the names
+ * of all entry points, each stored as a 16 bit length and the characters.
+ * The name table is zero padded to a multiple of 8 bytes. Entry points
+ * are identified by their index in this table.
+ *
+ * The name table is followed by records, each starting with a
+ * TraceRecordHeader. The header is followed by all arguments of the call,
+ * each widened to 64 bits (floating point values are stored as their bit
+ * pattern, pointers as their address). After the arguments follow the
+ * client memory blocks referenced by the call, each starting with a
+ * TraceBlobHeader and zero padded to a multiple of 8 bytes.
+ *
+ * The end of a frame is marked by a record without arguments that uses
+ * TraceFrameMarker as entry point index (see TraceFrame).
+ */
+
+/** Trace file format version. */
+const uint32_t TraceVersion = 1;
+
+/** Header of a trace record. */
+struct TraceRecordHeader
+{
+    /** Size of the record in bytes including the header. */
+    uint32_t size;
+    /** Index of the entry point in the name table. */
+    uint16_t id;
+    /** Index of the recording thread. */
+    uint16_t thread;
+    /** Time of the call in nanoseconds since StartTrace. */
+    uint64_t time;
+    /** Return value of the call. */
+    uint64_t ret;
+};
+
+/** Entry point index of frame marker records. */
+const uint16_t TraceFrameMarker = 0xFFFF;
+
+/** Blob flag: the memory was written by the call. */
+const uint16_t TraceBlobOutput = 1;
+/** Blob flag: the memory is a list of strings, each
+ * stored as a 32 bit length followed by the characters. */
+const uint16_t TraceBlobStrings = 2;
+
+/** Header of a client memory block within a trace record. */
+struct TraceBlobHeader
+{
+    /** Index of the argument referencing the memory. */
+    uint16_t index;
+    /** Combination of TraceBlobOutput and TraceBlobStrings. */
+    uint16_t flags;
+    /** Length of the memory block in bytes, excluding padding. */
+    uint32_t length;
+};
+
+/**
+ * Decode a traced value.
+ * Reverses the 64 bit encoding of an argument or return value.
+ * \param value Specifies the encoded value.
+ * \return The decoded value.
+ */
+template<typename T>
+inline T TraceDecode (uint64_t value)
+{
+    return static_cast<T> (value);
+}
+
+template<>
+inline GLfloat TraceDecode<GLfloat> (uint64_t value)
+{
+    uint32_t bits = static_cast<uint32_t> (value);
+    GLfloat v;
+    memcpy (&v, &bits, sizeof (v));
+    return v;
+}
+
+template<>
+inline GLdouble TraceDecode<GLdouble> (uint64_t value)
+{
+    GLdouble v;
+    memcpy (&v, &value, sizeof (v));
+    return v;
+}
+
+/**
+ * Start tracing.
+ * Installs the trace thunks in front of the current entry points and
+ * starts recording all calls into the specified file. Calls are staged
+ * in a per-thread buffer without locking and appended to the file in
+ * large blocks. With OGLP_DISPATCH_TABLE only the dispatch table current
+ * in the calling thread is traced, other threads have to call
+ * AttachTrace. Only available if OGLP_TRACE is defined.
+ * \param filename Specifies the file to record into.
+ * \return Whether tracing was started.
+ */
+bool StartTrace (const std::string &filename);
+
+/**
+ * Stop tracing.
+ * Restores the entry points of the calling thread, flushes the
+ * staging buffers of all threads and closes the trace file. With
+ * OGLP_DISPATCH_TABLE the tables of other threads keep the trace
+ * thunks until the threads call DetachTrace, but their calls are
+ * no longer recorded.
+ */
+void StopTrace (void);
+
+/**
+ * Trace the calling thread.
+ * With OGLP_DISPATCH_TABLE installs the trace thunks in the dispatch
+ * table current in the calling thread, so that its calls are recorded
+ * into the running trace. Without OGLP_DISPATCH_TABLE all threads share
+ * the entry points installed by StartTrace.
+ * \return Whether a trace is being recorded.
+ */
+bool AttachTrace (void);
+
+/**
+ * Stop tracing the calling thread.
+ * With OGLP_DISPATCH_TABLE restores the entry points of the dispatch
+ * table current in the calling thread. Does nothing without
+ * OGLP_DISPATCH_TABLE, use StopTrace instead.
+ */
+void DetachTrace (void);
+
+/**
+ * Flush the staging buffer.
+ * Appends all calls staged by the calling thread to the trace file.
+ * Not required before StopTrace, which flushes the buffers of all
+ * threads.
+ */
+void FlushTrace (void);
+
+/**
+ * Mark the end of a frame.
+ * Records a frame marker, so that the trace can be replayed frame
+ * by frame. Does nothing if no trace is being recorded.
+ */
+void TraceFrame (void);
+
+/**
+ * Check whether tracing is active.
+ * \return Whether a trace is currently being recorded.
+ */
+bool IsTracing (void);
+
+#ifdef OGLP_TRACE
+namespace internal {
+
+/* Per-thread buffers the trace thunks record into. A record is built in
+ * the record buffer, which only the owning thread touches, so no lock is
+ * held while the call is forwarded. Committed records are handed off to
+ * the staging buffer, which is guarded by the busy flag and only
+ * contended while another thread flushes it. All stagings are
+ * registered, so that StopTrace can flush them, and remember the trace
+ * session they were filled in, so that records of an earlier session
+ * are dropped. */
+struct TraceStaging
+{
+    TraceStaging (void);
+    ~TraceStaging (void);
+    /* Take and release the busy flag. */
+    void Acquire (void);
+    void Release (void);
+    /* Append a record of the specified session, called with busy set. */
+    void Append (uint32_t session, const char *data, size_t size);
+    void Flush (void);
+    /* Append the buffer to the trace file, called with busy set. */
+    void Write (void);
+
+    std::vector<char> record;
+    std::vector<char> buffer;
+    std::atomic<bool> busy;
+    uint32_t generation;
+    uint16_t thread;
+};
+
+extern thread_local TraceStaging tracestaging;
+
+#ifdef OGLP_DISPATCH_TABLE
+/* entry points the trace thunks of the current table forward to */
+inline DispatchTable &TraceNext (void)
+{
+    return *currentdispatch->tracenext;
+}
+#else
+/* entry points the trace thunks forward to */
+extern DispatchTable tracenext;
+
+inline DispatchTable &TraceNext (void)
+{
+    return tracenext;
+}
+#endif
+
+/* names of all traced entry points */
+extern const unsigned int NumTraceProcs;
+extern const char *const TraceProcNames[];
+
+/* Fill a table with the generated trace thunks. */
+void GetTraceThunks (DispatchTable *table);
+
+/* Nanoseconds since StartTrace. */
+uint64_t TraceTime (void);
+
+/* Current trace session, incremented by StartTrace. */
+uint32_t TraceGeneration (void);
+
+/* Number of values read for a parameter name by the *Parameter*v calls. */
+GLsizei TraceParameterCount (GLenum pname);
+
+inline uint64_t TraceEncode (GLfloat v)
+{
+    uint32_t bits;
+    memcpy (&bits, &v, sizeof (bits));
+    return bits;
+}
+
+inline uint64_t TraceEncode (GLdouble v)
+{
+    uint64_t bits;
+    memcpy (&bits, &v, sizeof (bits));
+    return bits;
+}
+
+template<typename T>
+inline uint64_t TraceEncode (T *v)
+{
+    return reinterpret_cast<uintptr_t> (v);
+}
+
+template<typename T>
+inline typename std::enable_if<std::is_integral<T>::value, uint64_t>::type
+TraceEncode (T v)
+{
+    return static_cast<uint64_t> (static_cast<int64_t> (v));
+}
+
+/* A single record being written into the record buffer of the calling
+ * thread. A record that is not committed (e.g. because the call threw)
+ * is discarded. */
+class TraceRecord
+{
+public:
+    TraceRecord (uint16_t id, unsigned int nargs)
+        : staging (tracestaging), committed (false)
+    {
+        TraceRecordHeader header;
+        generation = TraceGeneration ();
+        start = staging.record.size ();
+        header.size = 0;
+        header.id = id;
+        header.thread = staging.thread;
+        header.time = TraceTime ();
+        header.ret = 0;
+        staging.record.reserve (start + sizeof (header) + nargs * sizeof (uint64_t));
+        Append (&header, sizeof (header));
+    }
+
+    TraceRecord (const TraceRecord &) = delete;
+
+    ~TraceRecord (void)
+    {
+        if (!committed)
+            staging.record.resize (start);
+    }
+
+    TraceRecord &operator= (const TraceRecord &) = delete;
+
+    template<typename T>
+    void Arg (T value)
+    {
+        uint64_t encoded = TraceEncode (value);
+        Append (&encoded, sizeof (encoded));
+    }
+
+    template<typename T>
+    void Return (T value)
+    {
+        uint64_t encoded = TraceEncode (value);
+        memcpy (&staging.record[start + offsetof (TraceRecordHeader, ret)],
+                &encoded, sizeof (encoded));
+    }
+
+    void Blob (unsigned int index, const void *data, GLsizeiptr size,
+               bool output = false)
+    {
+        if (data && size > 0)
+            AppendBlob (index, output ? TraceBlobOutput : 0, data, size);
+    }
+
+    void String (unsigned int index, const GLchar *str, GLsizei length);
+    void Strings (unsigned int index, GLsizei count,
+                  const GLchar *const *strings, const GLint *lengths);
+    void Pixels (unsigned int index, const void *pixels, GLsizeiptr size);
+    void Pixel (unsigned int index, const void *data, GLenum format,
+                GLenum type);
+    void Image (unsigned int index, const void *pixels, GLenum format,
+                GLenum type, GLsizei width, GLsizei height, GLsizei depth);
+    void Commit (void);
+
+private:
+    void Append (const void *data, size_t size)
+    {
+        const char *ptr = static_cast<const char *> (data);
+        staging.record.insert (staging.record.end (), ptr, ptr + size);
+    }
+
+    void AppendBlob (unsigned int index, uint16_t flags,
+                     const void *data, size_t size);
+
+    TraceStaging &staging;
+    size_t start;
+    uint32_t generation;
+    bool committed;
+};
+
+} /* namespace internal */
+#endif /* defined OGLP_TRACE */
+
+} /* namespace oglp */
+
+#endif /* !defined OGLP_TRACE_H */
@@ -21,6 +21,8 @@
 #define OGLP_TRANSFORMFEEDBACK_H
 
 #include "common.h"
+#include <cstddef>
+#include <vector>
 #include "query.h"
 
 namespace oglp {
@@ -42,17 +44,44 @@ public:
         CheckError ();
     }
 
+    /**
+       * Null constructor.
+       * Creates a TransformFeedback object without an internal OpenGL transform feedback object.
+       * An object can be move assigned to it later.
+       */
+    TransformFeedback (std::nullptr_t) : obj (0)
+    {
+    }
+
+    /**
+       * Create multiple TransformFeedback objects.
+       * Creates the internal OpenGL transform feedback objects with a single call.
+       * \param n Specifies the number of objects to create.
+       * \return The created TransformFeedback objects.
+       */
+    static std::vector<TransformFeedback> CreateN (GLsizei n)
+    {
+        std::vector<GLuint> names (n);
+        std::vector<TransformFeedback> objects;
+        CreateTransformFeedbacks (n, names.data ());
+        CheckError ();
+        objects.reserve (n);
+        for (GLuint name : names) {
+            objects.emplace_back (nullptr);
+            objects.back ().obj = name;
+        }
+        return objects;
+    }
+
     /**
        * Move constuctor.
        * Passes the internal OpenGL transform feedback object to
        * another TransformFeedback object.
        * \param t The TransformFeedback object to move.
        */
-    TransformFeedback (TransformFeedback &&t) noexcept
+    TransformFeedback (TransformFeedback &&t) noexcept : obj (t.obj)
     {
-        GLuint tmp = obj;
-        obj = t.obj;
-        t.obj = tmp;
+        t.obj = 0;
     }
 
     /**
@@ -61,7 +90,8 @@ public:
        */
     ~TransformFeedback (void)
     {
-        DeleteTransformFeedbacks (1, &obj);
+        if (obj)
+            DeleteTransformFeedbacks (1, &obj);
     }
 
     /**
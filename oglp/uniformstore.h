@@ -0,0 +1,198 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OGLP_UNIFORMSTORE_H
+#define OGLP_UNIFORMSTORE_H
+
+#include "common.h"
+#include "hashedname.h"
+#include "program.h"
+#include <cstdint>
+#include <vector>
+
+namespace oglp {
+
+/** Shadow uniform store.
+ * Mirrors all active uniforms of the default uniform block of a Program
+ * in one contiguous block of memory, laid out in the order reported by
+ * the program interface query. Setting a uniform only writes to this
+ * block and marks the uniform as dirty if the value actually changed,
+ * and Flush uploads all dirty uniforms with one glProgramUniform*v call
+ * each. The store is initialized with the current values of the
+ * uniforms and has to be recreated if the program is relinked.
+ */
+class UniformStore
+{
+public:
+    /**
+       * Constructor.
+       * Creates a UniformStore object mirroring the uniforms of a program.
+       * \param program Specifies the linked program, which needs to
+       *                outlive the UniformStore object.
+       */
+    UniformStore (const Program &program);
+
+    /**
+       * Deleted copy constructor.
+       * A UniformStore object can't be copy constructed.
+       */
+    UniformStore (const UniformStore &) = delete;
+
+    /**
+       * Deleted copy assignment.
+       * A UniformStore object can't be copy assigned.
+       * \return
+       */
+    UniformStore &operator= (const UniformStore &) = delete;
+
+    /**
+       * Set uniform data.
+       * Copies raw data to a uniform, which has to match the layout
+       * of the uniform, e.g. 36 bytes for a mat3 and four bytes per
+       * bool. The data may span several elements of an array.
+       * \param location Specifies the location of the uniform or
+       *                 of the first array element to set.
+       * \param data Specifies the data to set.
+       * \param size Specifies the size of the data in bytes.
+       * \return Whether the uniform was changed. Unknown locations and
+       *         data exceeding the uniform are ignored.
+       */
+    bool SetData (GLint location, const void *data, size_t size);
+
+    /**
+       * Set a uniform.
+       * \param location Specifies the location of the uniform.
+       * \param value Specifies the value to set, e.g. a glm::vec4.
+       * \return Whether the uniform was changed.
+       */
+    template<typename T>
+    bool Set (GLint location, const T &value)
+    {
+        return SetData (location, &value, sizeof (T));
+    }
+
+    /**
+       * Set a uniform.
+       * \param name Specifies the hashed name of the uniform,
+       *             usually OGLP_NAME ("name").
+       * \param value Specifies the value to set.
+       * \return Whether the uniform was changed.
+       */
+    template<typename T>
+    bool Set (const HashedName &name, const T &value)
+    {
+        return SetData (program->GetUniformLocation (name), &value,
+                        sizeof (T));
+    }
+
+    /**
+       * Set array elements.
+       * \param location Specifies the location of the first element to set.
+       * \param values Specifies the values to set.
+       * \param n Specifies the number of values.
+       * \return Whether the uniform was changed.
+       */
+    template<typename T>
+    bool Set (GLint location, const T *values, size_t n)
+    {
+        return SetData (location, values, n * sizeof (T));
+    }
+
+    /**
+       * Get uniform data.
+       * \param location Specifies the location of the uniform.
+       * \return A pointer to the shadowed value or NULL if the
+       *         location is unknown.
+       */
+    const void *Get (GLint location) const;
+
+    /**
+       * Upload dirty uniforms.
+       * Usually called right before a draw call.
+       * \return The number of uniform calls issued.
+       */
+    unsigned int Flush (void);
+
+    /**
+       * Check for dirty uniforms.
+       * \return Whether Flush would upload any uniforms.
+       */
+    bool IsDirty (void) const
+    {
+        return numdirty != 0;
+    }
+
+    /**
+       * Get the number of uniforms.
+       * \return The number of mirrored uniforms, counting arrays once.
+       */
+    size_t GetNumUniforms (void) const
+    {
+        return slots.size ();
+    }
+
+private:
+    /* a mirrored uniform */
+    struct Slot
+    {
+        GLint location;
+        GLenum type;
+        GLsizei count;
+        GLsizei elementsize;
+        size_t offset;
+    };
+
+    /* the element of a slot at a location */
+    struct Element
+    {
+        int slot;
+        GLsizei element;
+    };
+
+    /**
+       * mirrored program
+       */
+    const Program *program;
+    /**
+       * mirrored uniforms in reflection order
+       */
+    std::vector<Slot> slots;
+    /**
+       * slot and array element per location, slot -1 for unknown
+       * locations, since array elements need not have consecutive
+       * locations
+       */
+    std::vector<Element> locations;
+    /**
+       * shadowed values, in 64 bit words to align doubles
+       */
+    std::vector<uint64_t> data;
+    /**
+       * dirty bit per slot
+       */
+    std::vector<uint64_t> dirty;
+    /**
+       * number of dirty slots
+       */
+    unsigned int numdirty;
+};
+
+} /* namespace oglp */
+
+#endif /* !defined OGLP_UNIFORMSTORE_H */
@@ -0,0 +1,170 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OGLP_UPLOADQUEUE_H
+#define OGLP_UPLOADQUEUE_H
+
+#include "common.h"
+#include "buffer.h"
+#include "streambuffer.h"
+#include "texture.h"
+#include <vector>
+
+namespace oglp {
+
+/** Batched upload queue.
+ * Collects writes to buffer and texture objects and performs them in
+ * Flush from a persistently mapped staging StreamBuffer. Buffer writes
+ * to adjacent or overlapping ranges of the same buffer object are
+ * merged into a single copy, so many small writes cost a few copies
+ * instead of a Buffer::SubData call each. Overlapping writes are
+ * applied in the order they were queued.
+ */
+class UploadQueue
+{
+public:
+    /**
+       * Constructor.
+       * \param stagingsize Specifies the size of a region of the staging
+       *                    buffer. Writes that do not fit into a region
+       *                    are uploaded directly with SubData.
+       * \param regions Specifies the number of regions of the staging buffer.
+       */
+    UploadQueue (GLsizeiptr stagingsize, unsigned int regions = 3);
+
+    /**
+       * Deleted copy constructor.
+       * An UploadQueue object can't be copy constructed.
+       */
+    UploadQueue (const UploadQueue &) = delete;
+
+    /**
+       * Deleted copy assignment.
+       * An UploadQueue object can't be copy assigned.
+       * \return
+       */
+    UploadQueue &operator= (const UploadQueue &) = delete;
+
+    /**
+       * Queue a buffer write.
+       * The data is copied, the buffer object has to stay alive until
+       * the next flush.
+       * \param buffer Specifies the buffer object to write to.
+       * \param offset Specifies the offset of the written range.
+       * \param size Specifies the size of the written range.
+       * \param data Specifies the data to write.
+       */
+    void Write (Buffer &buffer, GLintptr offset, GLsizeiptr size,
+                const GLvoid *data);
+
+    /**
+       * Queue a one-dimensional texture write.
+       * Same as Texture::SubImage1D, except that the write happens in
+       * Flush. The data is copied and has to be laid out according
+       * to the unpack state at the time of the flush.
+       * \param size Specifies the size of the image data in bytes.
+       */
+    void WriteTexture1D (Texture &texture, GLint level, GLint xoffset,
+                         GLsizei width, GLenum format, GLenum type,
+                         GLsizeiptr size, const GLvoid *data);
+
+    /**
+       * Queue a two-dimensional texture write.
+       * Same as Texture::SubImage2D, except that the write happens in
+       * Flush. The data is copied and has to be laid out according
+       * to the unpack state at the time of the flush.
+       * \param size Specifies the size of the image data in bytes.
+       */
+    void WriteTexture2D (Texture &texture, GLint level, GLint xoffset,
+                         GLint yoffset, GLsizei width, GLsizei height,
+                         GLenum format, GLenum type, GLsizeiptr size,
+                         const GLvoid *data);
+
+    /**
+       * Queue a three-dimensional texture write.
+       * Same as Texture::SubImage3D, except that the write happens in
+       * Flush. The data is copied and has to be laid out according
+       * to the unpack state at the time of the flush.
+       * \param size Specifies the size of the image data in bytes.
+       */
+    void WriteTexture3D (Texture &texture, GLint level, GLint xoffset,
+                         GLint yoffset, GLint zoffset, GLsizei width,
+                         GLsizei height, GLsizei depth, GLenum format,
+                         GLenum type, GLsizeiptr size, const GLvoid *data);
+
+    /**
+       * Flush the queue.
+       * Packs all queued writes into the staging buffer and issues the
+       * copies. Commands issued afterwards see the written data. The
+       * pixel unpack buffer binding is restored afterwards.
+       * \return The number of copy and texture upload calls issued.
+       */
+    unsigned int Flush (void);
+
+    /**
+       * Return the number of queued writes.
+       * \return The number of writes queued since the last flush.
+       */
+    size_t GetNumWrites (void) const
+    {
+        return writes.size ();
+    }
+
+private:
+    /* A queued write. Buffer writes have a buffer, texture writes a
+     * texture and the number of dimensions. */
+    struct Upload
+    {
+        Buffer *buffer;
+        Texture *texture;
+        unsigned int dimensions;
+        GLint level;
+        GLintptr offset[3];
+        GLsizei size[3];
+        GLenum format;
+        GLenum type;
+        /* offset and size of the data in the data vector */
+        size_t data;
+        GLsizeiptr length;
+    };
+
+    Upload &Queue (GLsizeiptr length, const GLvoid *ptr);
+    StreamBuffer::Allocation Stage (GLsizeiptr length);
+
+    /**
+       * staging buffer
+       */
+    StreamBuffer staging;
+    /**
+       * queued writes in queue order
+       */
+    std::vector<Upload> writes;
+    /**
+       * data of the queued writes
+       */
+    std::vector<char> data;
+    /**
+       * indices of the queued writes, reused by Flush for sorting
+       */
+    std::vector<unsigned int> order;
+};
+
+} /* namespace oglp */
+
+#endif /* !defined OGLP_UPLOADQUEUE_H */
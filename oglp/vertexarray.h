@@ -21,6 +21,8 @@
 #define OGLP_VERTEXARRAY_H
 
 #include "common.h"
+#include <cstddef>
+#include <vector>
 #include "buffer.h"
 
 namespace oglp {
@@ -41,17 +43,44 @@ public:
         CheckError ();
     }
 
+    /**
+       * Null constructor.
+       * Creates a VertexArray object without an internal OpenGL vertex array object.
+       * An object can be move assigned to it later.
+       */
+    VertexArray (std::nullptr_t) : obj (0)
+    {
+    }
+
+    /**
+       * Create multiple VertexArray objects.
+       * Creates the internal OpenGL vertex array objects with a single call.
+       * \param n Specifies the number of objects to create.
+       * \return The created VertexArray objects.
+       */
+    static std::vector<VertexArray> CreateN (GLsizei n)
+    {
+        std::vector<GLuint> names (n);
+        std::vector<VertexArray> objects;
+        CreateVertexArrays (n, names.data ());
+        CheckError ();
+        objects.reserve (n);
+        for (GLuint name : names) {
+            objects.emplace_back (nullptr);
+            objects.back ().obj = name;
+        }
+        return objects;
+    }
+
     /**
        * Move constuctor.
        * Passes the internal OpenGL vertex array object to
        * another VertexArray object.
        * \param va VertexArray object to move.
        */
-    VertexArray (VertexArray &&va) noexcept
+    VertexArray (VertexArray &&va) noexcept : obj (va.obj)
     {
-        GLuint tmp = obj;
-        obj = va.obj;
-        va.obj = tmp;
+        va.obj = 0;
     }
 
     /**
@@ -66,7 +95,8 @@ public:
        */
     ~VertexArray (void)
     {
-        DeleteVertexArrays (1, &obj);
+        if (obj)
+            DeleteVertexArrays (1, &obj);
     }
 
     /**
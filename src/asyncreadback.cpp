@@ -0,0 +1,130 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file */
+#include <oglp/asyncreadback.h>
+#include <limits>
+
+namespace oglp {
+
+/* Pack buffers are at least this large, larger ones are powers of two,
+ * so that they can be reused for readbacks of similar size. */
+static const GLsizeiptr ReadbackMinSize = 4096;
+
+AsyncReadback::Slot *AsyncReadback::Acquire (GLsizeiptr size)
+{
+    Slot *best = NULL, *fit = NULL, *idle = NULL;
+    GLbitfield flags;
+    GLsizeiptr capacity;
+
+    /* reuse the smallest idle pack buffer that is large enough */
+    for (Slot &slot : slots) {
+        if (slot.busy)
+            continue;
+        if (slot.capacity < size) {
+            idle = &slot;
+            continue;
+        }
+        if (!fit || slot.capacity < fit->capacity)
+            fit = &slot;
+        if ((!best || slot.capacity < best->capacity)
+            && slot.fence.IsSignaled ())
+            best = &slot;
+    }
+    if (best) {
+        best->busy = true;
+        return best;
+    }
+    /* once the pool is full, wait for an idle pack buffer instead
+     * of growing the pool */
+    if (slots.size () >= maxbuffers) {
+        if (fit)
+            idle = fit;
+        if (!idle)
+            return NULL;
+        idle->fence.ClientWait (GL_TIMEOUT_IGNORED);
+        idle->fence.Reset ();
+        if (idle->capacity >= size) {
+            idle->busy = true;
+            return idle;
+        }
+        best = idle;
+        best->buffer = Buffer ();
+    } else {
+        slots.emplace_back ();
+        best = &slots.back ();
+    }
+    capacity = ReadbackMinSize;
+    while (capacity < size)
+        capacity <<= 1;
+    flags = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    best->buffer.Storage (capacity, NULL, flags | GL_CLIENT_STORAGE_BIT);
+    best->capacity = capacity;
+    best->ptr = best->buffer.MapRange (0, capacity, flags);
+    best->busy = true;
+    return best;
+}
+
+void AsyncReadback::Submit (Slot *slot)
+{
+    slot->fence.Insert ();
+    /* flush once, so that the fence signals even if the
+     * fence is only polled */
+    slot->fence.ClientWait (0);
+}
+
+AsyncReadback::Result AsyncReadback::ReadTexture (const Texture &texture,
+                                                  GLint level, GLint xoffset,
+                                                  GLint yoffset, GLint zoffset,
+                                                  GLsizei width, GLsizei height,
+                                                  GLsizei depth, GLenum format,
+                                                  GLenum type, GLsizeiptr size)
+{
+    GLint packbuffer = 0;
+    Slot *slot;
+    /* GetSubImage takes the size as GLsizei */
+    if (size < 0 || size > std::numeric_limits<GLsizei>::max ())
+        return Result ();
+    slot = Acquire (size);
+    if (!slot)
+        return Result ();
+    GetIntegerv (GL_PIXEL_PACK_BUFFER_BINDING, &packbuffer);
+    CheckError ();
+    slot->buffer.Bind (GL_PIXEL_PACK_BUFFER);
+    texture.GetSubImage (level, xoffset, yoffset, zoffset, width, height,
+                         depth, format, type, size, NULL);
+    BindBuffer (GL_PIXEL_PACK_BUFFER, packbuffer);
+    CheckError ();
+    Submit (slot);
+    return Result (slot, size);
+}
+
+AsyncReadback::Result AsyncReadback::ReadBuffer (const Buffer &buffer,
+                                                 GLintptr offset,
+                                                 GLsizeiptr size)
+{
+    Slot *slot = Acquire (size);
+    if (!slot)
+        return Result ();
+    Buffer::CopySubData (buffer, slot->buffer, offset, 0, size);
+    Submit (slot);
+    return Result (slot, size);
+}
+
+} /* namespace oglp */
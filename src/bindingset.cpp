@@ -0,0 +1,147 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file */
+#include <oglp/bindingset.h>
+
+namespace oglp {
+
+using internal::Binding;
+using internal::BindingKind;
+using internal::UnknownBinding;
+
+/* buffer targets of the buffer binding kinds */
+static const GLenum BindingTargets[] = {
+    GL_UNIFORM_BUFFER, GL_SHADER_STORAGE_BUFFER, GL_ATOMIC_COUNTER_BUFFER,
+    GL_TRANSFORM_FEEDBACK_BUFFER
+};
+
+BindingKind BindingSet::BufferKind (GLenum target)
+{
+    switch (target) {
+        case GL_UNIFORM_BUFFER:
+            return internal::BindingUniformBuffer;
+        case GL_SHADER_STORAGE_BUFFER:
+            return internal::BindingShaderStorageBuffer;
+        case GL_ATOMIC_COUNTER_BUFFER:
+            return internal::BindingAtomicCounterBuffer;
+        case GL_TRANSFORM_FEEDBACK_BUFFER:
+            return internal::BindingTransformFeedbackBuffer;
+        default:
+#ifdef OGLP_THROW_EXCEPTIONS
+            throw std::runtime_error ("Invalid buffer target for a BindingSet.");
+#else
+            return internal::NumBindingKinds;
+#endif
+    }
+}
+
+void BindingSet::Set (BindingKind kind, GLuint index, GLuint name,
+                      GLintptr offset, GLsizeiptr size)
+{
+    if (kind == internal::NumBindingKinds)
+        return;
+    std::vector<Binding> &set = units[kind];
+    if (set.size () <= index)
+        set.resize (index + 1, Binding { UnknownBinding, 0, 0 });
+    set[index] = Binding { name, offset, size };
+}
+
+/* Whether a unit needs to be bound. */
+static inline bool BindingIsDirty (const std::vector<Binding> &set,
+                                   const std::vector<Binding> &current,
+                                   size_t i)
+{
+    return set[i].name != UnknownBinding
+           && (i >= current.size () || set[i] != current[i]);
+}
+
+unsigned int BindingSet::Apply (BindingState &state) const
+{
+    unsigned int calls = 0;
+    unsigned int kind;
+    size_t first, last, i;
+    std::vector<GLuint> names;
+    std::vector<GLintptr> offsets;
+    std::vector<GLsizeiptr> sizes;
+
+    for (kind = 0; kind < internal::NumBindingKinds; kind++) {
+        const std::vector<Binding> &set = units[kind];
+        std::vector<Binding> &current = state.units[kind];
+        if (current.size () < set.size ())
+            current.resize (set.size (), Binding { UnknownBinding, 0, 0 });
+
+        for (first = 0; first < set.size (); first = last) {
+            if (!BindingIsDirty (set, current, first)) {
+                last = first + 1;
+                continue;
+            }
+            /* Extend the range over dirty units and units with a known
+             * binding, which are simply rebound. Buffer ranges and whole
+             * buffers need separate calls. */
+            names.clear ();
+            offsets.clear ();
+            sizes.clear ();
+            i = last = first;
+            do {
+                const Binding &b = (set[i].name != UnknownBinding)
+                                   ? set[i] : current[i];
+                if (b.name == UnknownBinding || (b.size < 0)
+                    != (set[first].size < 0))
+                    break;
+                names.push_back (b.name);
+                offsets.push_back (b.offset);
+                sizes.push_back (b.size);
+                if (BindingIsDirty (set, current, i))
+                    last = i + 1;
+            } while (++i < set.size ());
+            names.resize (last - first);
+
+            switch (kind) {
+                case internal::BindingTexture:
+                    BindTextures (first, names.size (), &names[0]);
+                    break;
+                case internal::BindingSampler:
+                    BindSamplers (first, names.size (), &names[0]);
+                    break;
+                case internal::BindingImage:
+                    BindImageTextures (first, names.size (), &names[0]);
+                    break;
+                default:
+                    if (set[first].size < 0)
+                        BindBuffersBase (BindingTargets[kind], first,
+                                         names.size (), &names[0]);
+                    else
+                        BindBuffersRange (BindingTargets[kind], first,
+                                          names.size (), &names[0], &offsets[0],
+                                          &sizes[0]);
+                    break;
+            }
+            CheckError ();
+            calls++;
+
+            for (i = first; i < last; i++)
+                current[i] = Binding { names[i - first], offsets[i - first],
+                                       sizes[i - first] };
+        }
+    }
+    return calls;
+}
+
+} /* namespace oglp */
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file */
+#include <oglp/blocklayout.h>
+#include <algorithm>
+#include <vector>
+
+namespace oglp {
+namespace internal {
+
+bool VerifyBlockLayout (const UniformBlock &block,
+                        const BlockMemberInfo *members, size_t n,
+                        size_t size)
+{
+    std::vector<GLuint> indices = block.GetActiveUniformIndices ();
+    std::vector<GLint> offsets, counts, arraystrides, matrixstrides;
+    std::vector<size_t> order;
+    size_t i;
+
+    if (indices.size () != n || block.GetDataSize () != size)
+        return false;
+    if (!n)
+        return true;
+    offsets.resize (n);
+    counts.resize (n);
+    arraystrides.resize (n);
+    matrixstrides.resize (n);
+    GetActiveUniformsiv (block.GetProgram (), n, &indices[0],
+                         GL_UNIFORM_OFFSET, &offsets[0]);
+    GetActiveUniformsiv (block.GetProgram (), n, &indices[0],
+                         GL_UNIFORM_SIZE, &counts[0]);
+    GetActiveUniformsiv (block.GetProgram (), n, &indices[0],
+                         GL_UNIFORM_ARRAY_STRIDE, &arraystrides[0]);
+    GetActiveUniformsiv (block.GetProgram (), n, &indices[0],
+                         GL_UNIFORM_MATRIX_STRIDE, &matrixstrides[0]);
+    CheckError ();
+
+    /* the active uniforms are not reported in declaration order,
+     * but the members of a block have increasing offsets */
+    for (i = 0; i < n; i++)
+        order.push_back (i);
+    std::sort (order.begin (), order.end (), [&] (size_t a, size_t b) {
+        return offsets[a] < offsets[b];
+    });
+    for (i = 0; i < n; i++) {
+        size_t j = order[i];
+        if (size_t (offsets[j]) != members[i].offset
+            || size_t (counts[j]) != members[i].count
+            || size_t (arraystrides[j]) != members[i].arraystride
+            || size_t (matrixstrides[j]) != members[i].matrixstride)
+            return false;
+    }
+    return true;
+}
+
+} /* namespace internal */
+} /* namespace oglp */
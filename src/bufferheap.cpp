@@ -0,0 +1,298 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file */
+#include <oglp/bufferheap.h>
+#include <algorithm>
+
+namespace oglp {
+
+/* All ranges are multiples of this size. */
+static const GLsizeiptr HeapGranule = 16;
+
+/* index of the most significant set bit */
+static unsigned int HeapLog2 (uint64_t x)
+{
+#ifdef __GNUC__
+    return 63 - __builtin_clzll (x);
+#else
+    unsigned int n = 0;
+    while (x >>= 1)
+        n++;
+    return n;
+#endif
+}
+
+/* index of the least significant set bit */
+static unsigned int HeapLowestBit (uint64_t x)
+{
+#ifdef __GNUC__
+    return __builtin_ctzll (x);
+#else
+    unsigned int n = 0;
+    while (!(x & 1)) {
+        x >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+static GLsizeiptr HeapRoundUp (GLsizeiptr x, GLsizeiptr align)
+{
+    return (x + align - 1) & ~(align - 1);
+}
+
+BufferHeap::BufferHeap (GLsizeiptr _arenasize, GLbitfield _flags,
+                        GLsizeiptr _alignment)
+    : arenasize (HeapRoundUp (_arenasize, HeapGranule)), flags (_flags),
+      alignment (_alignment), capacity (0), unused (None), flbitmap (0)
+{
+    unsigned int fl, sl;
+    if (!alignment) {
+        GLint ubo = 0, ssbo = 0;
+        GetIntegerv (GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &ubo);
+        GetIntegerv (GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &ssbo);
+        CheckError ();
+        alignment = std::max (ubo, ssbo);
+    }
+    alignment = std::max (alignment, HeapGranule);
+    for (fl = 0; fl < FLCount; fl++) {
+        slbitmap[fl] = 0;
+        for (sl = 0; sl < SLCount; sl++)
+            heads[fl][sl] = None;
+    }
+}
+
+void BufferHeap::Mapping (GLsizeiptr size, unsigned int &fl, unsigned int &sl)
+{
+    if (size < (GLsizeiptr (1) << FLShift)) {
+        fl = 0;
+        sl = size >> (FLShift - SLBits);
+    } else {
+        unsigned int log2 = HeapLog2 (size);
+        fl = log2 - FLShift + 1;
+        sl = (size >> (log2 - SLBits)) - SLCount;
+    }
+}
+
+unsigned int BufferHeap::FindFree (GLsizeiptr size) const
+{
+    unsigned int fl, sl;
+    uint32_t slmap;
+    /* round up to the next size class, so that every range
+     * in the found list is large enough */
+    if (size >= (GLsizeiptr (1) << FLShift))
+        size += (GLsizeiptr (1) << (HeapLog2 (size) - SLBits)) - 1;
+    Mapping (size, fl, sl);
+    if (fl >= FLCount)
+        return None;
+    slmap = slbitmap[fl] & (~0u << sl);
+    if (!slmap) {
+        uint64_t flmap = flbitmap & (~uint64_t (0) << fl << 1);
+        if (!flmap)
+            return None;
+        fl = HeapLowestBit (flmap);
+        slmap = slbitmap[fl];
+    }
+    sl = HeapLowestBit (slmap);
+    return heads[fl][sl];
+}
+
+void BufferHeap::InsertFree (unsigned int b)
+{
+    unsigned int fl, sl;
+    Block &block = blocks[b];
+    Mapping (block.size, fl, sl);
+    block.free = true;
+    block.prevfree = None;
+    block.nextfree = heads[fl][sl];
+    if (block.nextfree != None)
+        blocks[block.nextfree].prevfree = b;
+    heads[fl][sl] = b;
+    flbitmap |= uint64_t (1) << fl;
+    slbitmap[fl] |= 1u << sl;
+}
+
+void BufferHeap::RemoveFree (unsigned int b)
+{
+    unsigned int fl, sl;
+    Block &block = blocks[b];
+    Mapping (block.size, fl, sl);
+    if (block.prevfree != None)
+        blocks[block.prevfree].nextfree = block.nextfree;
+    else
+        heads[fl][sl] = block.nextfree;
+    if (block.nextfree != None)
+        blocks[block.nextfree].prevfree = block.prevfree;
+    if (heads[fl][sl] == None) {
+        slbitmap[fl] &= ~(1u << sl);
+        if (!slbitmap[fl])
+            flbitmap &= ~(uint64_t (1) << fl);
+    }
+    block.free = false;
+}
+
+unsigned int BufferHeap::NewBlock (void)
+{
+    unsigned int b = unused;
+    if (b == None) {
+        blocks.emplace_back ();
+        return blocks.size () - 1;
+    }
+    unused = blocks[b].nextfree;
+    return b;
+}
+
+void BufferHeap::DeleteBlock (unsigned int b)
+{
+    Block &block = blocks[b];
+    if (block.prevphys != None)
+        blocks[block.prevphys].nextphys = block.nextphys;
+    if (block.nextphys != None)
+        blocks[block.nextphys].prevphys = block.prevphys;
+    block.arena = None;
+    block.nextfree = unused;
+    unused = b;
+}
+
+unsigned int BufferHeap::AddArena (GLsizeiptr size)
+{
+    unsigned int b;
+    arenas.emplace_back ();
+    arenas.back ().Storage (size, NULL, flags);
+    capacity += size;
+    b = NewBlock ();
+    blocks[b].offset = 0;
+    blocks[b].size = size;
+    blocks[b].arena = arenas.size () - 1;
+    blocks[b].prevphys = None;
+    blocks[b].nextphys = None;
+    InsertFree (b);
+    return b;
+}
+
+BufferHeap::Allocation BufferHeap::Allocate (GLsizeiptr size, GLsizeiptr align)
+{
+    Allocation allocation;
+    GLsizeiptr rsize, search, gap;
+    unsigned int b;
+
+    if (!align)
+        align = alignment;
+    align = std::max (align, HeapGranule);
+    rsize = HeapRoundUp (std::max (size, GLsizeiptr (1)), HeapGranule);
+    /* ranges start at multiples of the granule, so this much
+     * suffices for any alignment gap */
+    search = rsize + align - HeapGranule;
+
+    b = FindFree (search);
+    if (b == None)
+        b = AddArena (std::max (arenasize, search));
+    RemoveFree (b);
+
+    /* split off the alignment gap as a free range, the previous range
+     * cannot be free, as neighbouring free ranges are always merged */
+    gap = HeapRoundUp (blocks[b].offset, align) - blocks[b].offset;
+    if (gap) {
+        unsigned int g = NewBlock ();
+        blocks[g].offset = blocks[b].offset;
+        blocks[g].size = gap;
+        blocks[g].arena = blocks[b].arena;
+        blocks[g].prevphys = blocks[b].prevphys;
+        blocks[g].nextphys = b;
+        if (blocks[g].prevphys != None)
+            blocks[blocks[g].prevphys].nextphys = g;
+        blocks[b].prevphys = g;
+        InsertFree (g);
+        blocks[b].offset += gap;
+        blocks[b].size -= gap;
+    }
+
+    /* split off the remainder as a free range */
+    if (blocks[b].size > rsize) {
+        unsigned int r = NewBlock ();
+        blocks[r].offset = blocks[b].offset + rsize;
+        blocks[r].size = blocks[b].size - rsize;
+        blocks[r].arena = blocks[b].arena;
+        blocks[r].prevphys = b;
+        blocks[r].nextphys = blocks[b].nextphys;
+        if (blocks[r].nextphys != None)
+            blocks[blocks[r].nextphys].prevphys = r;
+        blocks[b].nextphys = r;
+        blocks[b].size = rsize;
+        InsertFree (r);
+    }
+
+    allocation.buffer = &arenas[blocks[b].arena];
+    allocation.offset = blocks[b].offset;
+    allocation.size = size;
+    allocation.block = b;
+    return allocation;
+}
+
+void BufferHeap::Free (const Allocation &allocation)
+{
+    unsigned int b = allocation.block, next, prev;
+    if (b == None)
+        return;
+    next = blocks[b].nextphys;
+    if (next != None && blocks[next].free) {
+        RemoveFree (next);
+        blocks[b].size += blocks[next].size;
+        DeleteBlock (next);
+    }
+    prev = blocks[b].prevphys;
+    if (prev != None && blocks[prev].free) {
+        RemoveFree (prev);
+        blocks[prev].size += blocks[b].size;
+        DeleteBlock (b);
+        b = prev;
+    }
+    InsertFree (b);
+}
+
+BufferHeap::Stats BufferHeap::GetStats (void) const
+{
+    Stats stats;
+    stats.arenas = arenas.size ();
+    stats.capacity = capacity;
+    stats.allocations = 0;
+    stats.used = 0;
+    stats.freeranges = 0;
+    stats.free = 0;
+    stats.largestfree = 0;
+    for (const Block &block : blocks) {
+        if (block.arena == None)
+            continue;
+        if (block.free) {
+            stats.freeranges++;
+            stats.free += block.size;
+            stats.largestfree = std::max (stats.largestfree, block.size);
+        } else {
+            stats.allocations++;
+            stats.used += block.size;
+        }
+    }
+    stats.fragmentation = stats.free ? 1.0 - double (stats.largestfree)
+                                           / double (stats.free) : 0.0;
+    return stats;
+}
+
+} /* namespace oglp */
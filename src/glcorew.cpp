@@ -13,6 +13,894 @@
 
 namespace oglp {
 
+GLAPI int APIENTRY Unsupported (...)
+{
+    throw std::runtime_error ("An unsupported OpenGL entry point was called.");
+}
+
+const char *const ExtensionNames[NumExtensions] = {
+    "GL_ARB_ES2_compatibility",
+    "GL_ARB_ES3_1_compatibility",
+    "GL_ARB_ES3_compatibility",
+    "GL_ARB_arrays_of_arrays",
+    "GL_ARB_base_instance",
+    "GL_ARB_bindless_texture",
+    "GL_ARB_blend_func_extended",
+    "GL_ARB_buffer_storage",
+    "GL_ARB_cl_event",
+    "GL_ARB_clear_buffer_object",
+    "GL_ARB_clear_texture",
+    "GL_ARB_clip_control",
+    "GL_ARB_compressed_texture_pixel_storage",
+    "GL_ARB_compute_shader",
+    "GL_ARB_compute_variable_group_size",
+    "GL_ARB_conditional_render_inverted",
+    "GL_ARB_conservative_depth",
+    "GL_ARB_copy_buffer",
+    "GL_ARB_copy_image",
+    "GL_ARB_cull_distance",
+    "GL_ARB_debug_output",
+    "GL_ARB_depth_buffer_float",
+    "GL_ARB_depth_clamp",
+    "GL_ARB_derivative_control",
+    "GL_ARB_direct_state_access",
+    "GL_ARB_draw_buffers_blend",
+    "GL_ARB_draw_elements_base_vertex",
+    "GL_ARB_draw_indirect",
+    "GL_ARB_enhanced_layouts",
+    "GL_ARB_explicit_attrib_location",
+    "GL_ARB_explicit_uniform_location",
+    "GL_ARB_fragment_coord_conventions",
+    "GL_ARB_fragment_layer_viewport",
+    "GL_ARB_framebuffer_no_attachments",
+    "GL_ARB_framebuffer_object",
+    "GL_ARB_framebuffer_sRGB",
+    "GL_ARB_get_program_binary",
+    "GL_ARB_get_texture_sub_image",
+    "GL_ARB_gpu_shader5",
+    "GL_ARB_gpu_shader_fp64",
+    "GL_ARB_half_float_vertex",
+    "GL_ARB_imaging",
+    "GL_ARB_indirect_parameters",
+    "GL_ARB_internalformat_query",
+    "GL_ARB_internalformat_query2",
+    "GL_ARB_invalidate_subdata",
+    "GL_ARB_map_buffer_alignment",
+    "GL_ARB_map_buffer_range",
+    "GL_ARB_multi_bind",
+    "GL_ARB_multi_draw_indirect",
+    "GL_ARB_occlusion_query2",
+    "GL_ARB_pipeline_statistics_query",
+    "GL_ARB_program_interface_query",
+    "GL_ARB_provoking_vertex",
+    "GL_ARB_query_buffer_object",
+    "GL_ARB_robust_buffer_access_behavior",
+    "GL_ARB_robustness",
+    "GL_ARB_robustness_isolation",
+    "GL_ARB_sample_shading",
+    "GL_ARB_sampler_objects",
+    "GL_ARB_seamless_cube_map",
+    "GL_ARB_seamless_cubemap_per_texture",
+    "GL_ARB_separate_shader_objects",
+    "GL_ARB_shader_atomic_counters",
+    "GL_ARB_shader_bit_encoding",
+    "GL_ARB_shader_draw_parameters",
+    "GL_ARB_shader_group_vote",
+    "GL_ARB_shader_image_load_store",
+    "GL_ARB_shader_image_size",
+    "GL_ARB_shader_precision",
+    "GL_ARB_shader_stencil_export",
+    "GL_ARB_shader_storage_buffer_object",
+    "GL_ARB_shader_subroutine",
+    "GL_ARB_shader_texture_image_samples",
+    "GL_ARB_shading_language_420pack",
+    "GL_ARB_shading_language_include",
+    "GL_ARB_shading_language_packing",
+    "GL_ARB_sparse_buffer",
+    "GL_ARB_sparse_texture",
+    "GL_ARB_stencil_texturing",
+    "GL_ARB_sync",
+    "GL_ARB_tessellation_shader",
+    "GL_ARB_texture_barrier",
+    "GL_ARB_texture_buffer_object_rgb32",
+    "GL_ARB_texture_buffer_range",
+    "GL_ARB_texture_compression_bptc",
+    "GL_ARB_texture_compression_rgtc",
+    "GL_ARB_texture_cube_map_array",
+    "GL_ARB_texture_gather",
+    "GL_ARB_texture_mirror_clamp_to_edge",
+    "GL_ARB_texture_multisample",
+    "GL_ARB_texture_query_levels",
+    "GL_ARB_texture_query_lod",
+    "GL_ARB_texture_rg",
+    "GL_ARB_texture_rgb10_a2ui",
+    "GL_ARB_texture_stencil8",
+    "GL_ARB_texture_storage",
+    "GL_ARB_texture_storage_multisample",
+    "GL_ARB_texture_swizzle",
+    "GL_ARB_texture_view",
+    "GL_ARB_timer_query",
+    "GL_ARB_transform_feedback2",
+    "GL_ARB_transform_feedback3",
+    "GL_ARB_transform_feedback_instanced",
+    "GL_ARB_transform_feedback_overflow_query",
+    "GL_ARB_uniform_buffer_object",
+    "GL_ARB_vertex_array_bgra",
+    "GL_ARB_vertex_array_object",
+    "GL_ARB_vertex_attrib_64bit",
+    "GL_ARB_vertex_attrib_binding",
+    "GL_ARB_vertex_type_10f_11f_11f_rev",
+    "GL_ARB_vertex_type_2_10_10_10_rev",
+    "GL_ARB_viewport_array",
+    "GL_EXT_abgr",
+    "GL_KHR_context_flush_control",
+    "GL_KHR_debug",
+    "GL_KHR_no_error",
+    "GL_KHR_robust_buffer_access_behavior",
+    "GL_KHR_robustness",
+    "GL_KHR_texture_compression_astc_hdr",
+    "GL_KHR_texture_compression_astc_ldr",
+    "GL_KHR_texture_compression_astc_sliced_3d",
+    "GL_NVX_gpu_memory_info",
+    "GL_NV_explicit_multisample",
+    "GL_NV_shader_buffer_load",
+    "GL_NV_vertex_buffer_unified_memory",
+};
+
+DispatchTable::DispatchTable (void)
+    : getprocaddress (NULL),
+      CullFace ((PFNGLCULLFACEPROC) Unsupported),
+      FrontFace ((PFNGLFRONTFACEPROC) Unsupported),
+      Hint ((PFNGLHINTPROC) Unsupported),
+      LineWidth ((PFNGLLINEWIDTHPROC) Unsupported),
+      PointSize ((PFNGLPOINTSIZEPROC) Unsupported),
+      PolygonMode ((PFNGLPOLYGONMODEPROC) Unsupported),
+      Scissor ((PFNGLSCISSORPROC) Unsupported),
+      TexParameterf ((PFNGLTEXPARAMETERFPROC) Unsupported),
+      TexParameterfv ((PFNGLTEXPARAMETERFVPROC) Unsupported),
+      TexParameteri ((PFNGLTEXPARAMETERIPROC) Unsupported),
+      TexParameteriv ((PFNGLTEXPARAMETERIVPROC) Unsupported),
+      TexImage1D ((PFNGLTEXIMAGE1DPROC) Unsupported),
+      TexImage2D ((PFNGLTEXIMAGE2DPROC) Unsupported),
+      DrawBuffer ((PFNGLDRAWBUFFERPROC) Unsupported),
+      Clear ((PFNGLCLEARPROC) Unsupported),
+      ClearColor ((PFNGLCLEARCOLORPROC) Unsupported),
+      ClearStencil ((PFNGLCLEARSTENCILPROC) Unsupported),
+      ClearDepth ((PFNGLCLEARDEPTHPROC) Unsupported),
+      StencilMask ((PFNGLSTENCILMASKPROC) Unsupported),
+      ColorMask ((PFNGLCOLORMASKPROC) Unsupported),
+      DepthMask ((PFNGLDEPTHMASKPROC) Unsupported),
+      Disable ((PFNGLDISABLEPROC) Unsupported),
+      Enable ((PFNGLENABLEPROC) Unsupported),
+      Finish ((PFNGLFINISHPROC) Unsupported),
+      Flush ((PFNGLFLUSHPROC) Unsupported),
+      BlendFunc ((PFNGLBLENDFUNCPROC) Unsupported),
+      LogicOp ((PFNGLLOGICOPPROC) Unsupported),
+      StencilFunc ((PFNGLSTENCILFUNCPROC) Unsupported),
+      StencilOp ((PFNGLSTENCILOPPROC) Unsupported),
+      DepthFunc ((PFNGLDEPTHFUNCPROC) Unsupported),
+      PixelStoref ((PFNGLPIXELSTOREFPROC) Unsupported),
+      PixelStorei ((PFNGLPIXELSTOREIPROC) Unsupported),
+      ReadBuffer ((PFNGLREADBUFFERPROC) Unsupported),
+      ReadPixels ((PFNGLREADPIXELSPROC) Unsupported),
+      GetBooleanv ((PFNGLGETBOOLEANVPROC) Unsupported),
+      GetDoublev ((PFNGLGETDOUBLEVPROC) Unsupported),
+      GetError ((PFNGLGETERRORPROC) Unsupported),
+      GetFloatv ((PFNGLGETFLOATVPROC) Unsupported),
+      GetIntegerv ((PFNGLGETINTEGERVPROC) Unsupported),
+      GetString ((PFNGLGETSTRINGPROC) Unsupported),
+      GetTexImage ((PFNGLGETTEXIMAGEPROC) Unsupported),
+      GetTexParameterfv ((PFNGLGETTEXPARAMETERFVPROC) Unsupported),
+      GetTexParameteriv ((PFNGLGETTEXPARAMETERIVPROC) Unsupported),
+      GetTexLevelParameterfv ((PFNGLGETTEXLEVELPARAMETERFVPROC) Unsupported),
+      GetTexLevelParameteriv ((PFNGLGETTEXLEVELPARAMETERIVPROC) Unsupported),
+      IsEnabled ((PFNGLISENABLEDPROC) Unsupported),
+      DepthRange ((PFNGLDEPTHRANGEPROC) Unsupported),
+      Viewport ((PFNGLVIEWPORTPROC) Unsupported),
+      DrawArrays ((PFNGLDRAWARRAYSPROC) Unsupported),
+      DrawElements ((PFNGLDRAWELEMENTSPROC) Unsupported),
+      GetPointerv ((PFNGLGETPOINTERVPROC) Unsupported),
+      PolygonOffset ((PFNGLPOLYGONOFFSETPROC) Unsupported),
+      CopyTexImage1D ((PFNGLCOPYTEXIMAGE1DPROC) Unsupported),
+      CopyTexImage2D ((PFNGLCOPYTEXIMAGE2DPROC) Unsupported),
+      CopyTexSubImage1D ((PFNGLCOPYTEXSUBIMAGE1DPROC) Unsupported),
+      CopyTexSubImage2D ((PFNGLCOPYTEXSUBIMAGE2DPROC) Unsupported),
+      TexSubImage1D ((PFNGLTEXSUBIMAGE1DPROC) Unsupported),
+      TexSubImage2D ((PFNGLTEXSUBIMAGE2DPROC) Unsupported),
+      BindTexture ((PFNGLBINDTEXTUREPROC) Unsupported),
+      DeleteTextures ((PFNGLDELETETEXTURESPROC) Unsupported),
+      GenTextures ((PFNGLGENTEXTURESPROC) Unsupported),
+      IsTexture ((PFNGLISTEXTUREPROC) Unsupported),
+      DrawRangeElements ((PFNGLDRAWRANGEELEMENTSPROC) Unsupported),
+      TexImage3D ((PFNGLTEXIMAGE3DPROC) Unsupported),
+      TexSubImage3D ((PFNGLTEXSUBIMAGE3DPROC) Unsupported),
+      CopyTexSubImage3D ((PFNGLCOPYTEXSUBIMAGE3DPROC) Unsupported),
+      ActiveTexture ((PFNGLACTIVETEXTUREPROC) Unsupported),
+      SampleCoverage ((PFNGLSAMPLECOVERAGEPROC) Unsupported),
+      CompressedTexImage3D ((PFNGLCOMPRESSEDTEXIMAGE3DPROC) Unsupported),
+      CompressedTexImage2D ((PFNGLCOMPRESSEDTEXIMAGE2DPROC) Unsupported),
+      CompressedTexImage1D ((PFNGLCOMPRESSEDTEXIMAGE1DPROC) Unsupported),
+      CompressedTexSubImage3D ((PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC) Unsupported),
+      CompressedTexSubImage2D ((PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC) Unsupported),
+      CompressedTexSubImage1D ((PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC) Unsupported),
+      GetCompressedTexImage ((PFNGLGETCOMPRESSEDTEXIMAGEPROC) Unsupported),
+      BlendFuncSeparate ((PFNGLBLENDFUNCSEPARATEPROC) Unsupported),
+      MultiDrawArrays ((PFNGLMULTIDRAWARRAYSPROC) Unsupported),
+      MultiDrawElements ((PFNGLMULTIDRAWELEMENTSPROC) Unsupported),
+      PointParameterf ((PFNGLPOINTPARAMETERFPROC) Unsupported),
+      PointParameterfv ((PFNGLPOINTPARAMETERFVPROC) Unsupported),
+      PointParameteri ((PFNGLPOINTPARAMETERIPROC) Unsupported),
+      PointParameteriv ((PFNGLPOINTPARAMETERIVPROC) Unsupported),
+      BlendColor ((PFNGLBLENDCOLORPROC) Unsupported),
+      BlendEquation ((PFNGLBLENDEQUATIONPROC) Unsupported),
+      GenQueries ((PFNGLGENQUERIESPROC) Unsupported),
+      DeleteQueries ((PFNGLDELETEQUERIESPROC) Unsupported),
+      IsQuery ((PFNGLISQUERYPROC) Unsupported),
+      BeginQuery ((PFNGLBEGINQUERYPROC) Unsupported),
+      EndQuery ((PFNGLENDQUERYPROC) Unsupported),
+      GetQueryiv ((PFNGLGETQUERYIVPROC) Unsupported),
+      GetQueryObjectiv ((PFNGLGETQUERYOBJECTIVPROC) Unsupported),
+      GetQueryObjectuiv ((PFNGLGETQUERYOBJECTUIVPROC) Unsupported),
+      BindBuffer ((PFNGLBINDBUFFERPROC) Unsupported),
+      DeleteBuffers ((PFNGLDELETEBUFFERSPROC) Unsupported),
+      GenBuffers ((PFNGLGENBUFFERSPROC) Unsupported),
+      IsBuffer ((PFNGLISBUFFERPROC) Unsupported),
+      BufferData ((PFNGLBUFFERDATAPROC) Unsupported),
+      BufferSubData ((PFNGLBUFFERSUBDATAPROC) Unsupported),
+      GetBufferSubData ((PFNGLGETBUFFERSUBDATAPROC) Unsupported),
+      MapBuffer ((PFNGLMAPBUFFERPROC) Unsupported),
+      UnmapBuffer ((PFNGLUNMAPBUFFERPROC) Unsupported),
+      GetBufferParameteriv ((PFNGLGETBUFFERPARAMETERIVPROC) Unsupported),
+      GetBufferPointerv ((PFNGLGETBUFFERPOINTERVPROC) Unsupported),
+      BlendEquationSeparate ((PFNGLBLENDEQUATIONSEPARATEPROC) Unsupported),
+      DrawBuffers ((PFNGLDRAWBUFFERSPROC) Unsupported),
+      StencilOpSeparate ((PFNGLSTENCILOPSEPARATEPROC) Unsupported),
+      StencilFuncSeparate ((PFNGLSTENCILFUNCSEPARATEPROC) Unsupported),
+      StencilMaskSeparate ((PFNGLSTENCILMASKSEPARATEPROC) Unsupported),
+      AttachShader ((PFNGLATTACHSHADERPROC) Unsupported),
+      BindAttribLocation ((PFNGLBINDATTRIBLOCATIONPROC) Unsupported),
+      CompileShader ((PFNGLCOMPILESHADERPROC) Unsupported),
+      CreateProgram ((PFNGLCREATEPROGRAMPROC) Unsupported),
+      CreateShader ((PFNGLCREATESHADERPROC) Unsupported),
+      DeleteProgram ((PFNGLDELETEPROGRAMPROC) Unsupported),
+      DeleteShader ((PFNGLDELETESHADERPROC) Unsupported),
+      DetachShader ((PFNGLDETACHSHADERPROC) Unsupported),
+      DisableVertexAttribArray ((PFNGLDISABLEVERTEXATTRIBARRAYPROC) Unsupported),
+      EnableVertexAttribArray ((PFNGLENABLEVERTEXATTRIBARRAYPROC) Unsupported),
+      GetActiveAttrib ((PFNGLGETACTIVEATTRIBPROC) Unsupported),
+      GetActiveUniform ((PFNGLGETACTIVEUNIFORMPROC) Unsupported),
+      GetAttachedShaders ((PFNGLGETATTACHEDSHADERSPROC) Unsupported),
+      GetAttribLocation ((PFNGLGETATTRIBLOCATIONPROC) Unsupported),
+      GetProgramiv ((PFNGLGETPROGRAMIVPROC) Unsupported),
+      GetProgramInfoLog ((PFNGLGETPROGRAMINFOLOGPROC) Unsupported),
+      GetShaderiv ((PFNGLGETSHADERIVPROC) Unsupported),
+      GetShaderInfoLog ((PFNGLGETSHADERINFOLOGPROC) Unsupported),
+      GetShaderSource ((PFNGLGETSHADERSOURCEPROC) Unsupported),
+      GetUniformLocation ((PFNGLGETUNIFORMLOCATIONPROC) Unsupported),
+      GetUniformfv ((PFNGLGETUNIFORMFVPROC) Unsupported),
+      GetUniformiv ((PFNGLGETUNIFORMIVPROC) Unsupported),
+      GetVertexAttribdv ((PFNGLGETVERTEXATTRIBDVPROC) Unsupported),
+      GetVertexAttribfv ((PFNGLGETVERTEXATTRIBFVPROC) Unsupported),
+      GetVertexAttribiv ((PFNGLGETVERTEXATTRIBIVPROC) Unsupported),
+      GetVertexAttribPointerv ((PFNGLGETVERTEXATTRIBPOINTERVPROC) Unsupported),
+      IsProgram ((PFNGLISPROGRAMPROC) Unsupported),
+      IsShader ((PFNGLISSHADERPROC) Unsupported),
+      LinkProgram ((PFNGLLINKPROGRAMPROC) Unsupported),
+      ShaderSource ((PFNGLSHADERSOURCEPROC) Unsupported),
+      UseProgram ((PFNGLUSEPROGRAMPROC) Unsupported),
+      Uniform1f ((PFNGLUNIFORM1FPROC) Unsupported),
+      Uniform2f ((PFNGLUNIFORM2FPROC) Unsupported),
+      Uniform3f ((PFNGLUNIFORM3FPROC) Unsupported),
+      Uniform4f ((PFNGLUNIFORM4FPROC) Unsupported),
+      Uniform1i ((PFNGLUNIFORM1IPROC) Unsupported),
+      Uniform2i ((PFNGLUNIFORM2IPROC) Unsupported),
+      Uniform3i ((PFNGLUNIFORM3IPROC) Unsupported),
+      Uniform4i ((PFNGLUNIFORM4IPROC) Unsupported),
+      Uniform1fv ((PFNGLUNIFORM1FVPROC) Unsupported),
+      Uniform2fv ((PFNGLUNIFORM2FVPROC) Unsupported),
+      Uniform3fv ((PFNGLUNIFORM3FVPROC) Unsupported),
+      Uniform4fv ((PFNGLUNIFORM4FVPROC) Unsupported),
+      Uniform1iv ((PFNGLUNIFORM1IVPROC) Unsupported),
+      Uniform2iv ((PFNGLUNIFORM2IVPROC) Unsupported),
+      Uniform3iv ((PFNGLUNIFORM3IVPROC) Unsupported),
+      Uniform4iv ((PFNGLUNIFORM4IVPROC) Unsupported),
+      UniformMatrix2fv ((PFNGLUNIFORMMATRIX2FVPROC) Unsupported),
+      UniformMatrix3fv ((PFNGLUNIFORMMATRIX3FVPROC) Unsupported),
+      UniformMatrix4fv ((PFNGLUNIFORMMATRIX4FVPROC) Unsupported),
+      ValidateProgram ((PFNGLVALIDATEPROGRAMPROC) Unsupported),
+      VertexAttrib1d ((PFNGLVERTEXATTRIB1DPROC) Unsupported),
+      VertexAttrib1dv ((PFNGLVERTEXATTRIB1DVPROC) Unsupported),
+      VertexAttrib1f ((PFNGLVERTEXATTRIB1FPROC) Unsupported),
+      VertexAttrib1fv ((PFNGLVERTEXATTRIB1FVPROC) Unsupported),
+      VertexAttrib1s ((PFNGLVERTEXATTRIB1SPROC) Unsupported),
+      VertexAttrib1sv ((PFNGLVERTEXATTRIB1SVPROC) Unsupported),
+      VertexAttrib2d ((PFNGLVERTEXATTRIB2DPROC) Unsupported),
+      VertexAttrib2dv ((PFNGLVERTEXATTRIB2DVPROC) Unsupported),
+      VertexAttrib2f ((PFNGLVERTEXATTRIB2FPROC) Unsupported),
+      VertexAttrib2fv ((PFNGLVERTEXATTRIB2FVPROC) Unsupported),
+      VertexAttrib2s ((PFNGLVERTEXATTRIB2SPROC) Unsupported),
+      VertexAttrib2sv ((PFNGLVERTEXATTRIB2SVPROC) Unsupported),
+      VertexAttrib3d ((PFNGLVERTEXATTRIB3DPROC) Unsupported),
+      VertexAttrib3dv ((PFNGLVERTEXATTRIB3DVPROC) Unsupported),
+      VertexAttrib3f ((PFNGLVERTEXATTRIB3FPROC) Unsupported),
+      VertexAttrib3fv ((PFNGLVERTEXATTRIB3FVPROC) Unsupported),
+      VertexAttrib3s ((PFNGLVERTEXATTRIB3SPROC) Unsupported),
+      VertexAttrib3sv ((PFNGLVERTEXATTRIB3SVPROC) Unsupported),
+      VertexAttrib4Nbv ((PFNGLVERTEXATTRIB4NBVPROC) Unsupported),
+      VertexAttrib4Niv ((PFNGLVERTEXATTRIB4NIVPROC) Unsupported),
+      VertexAttrib4Nsv ((PFNGLVERTEXATTRIB4NSVPROC) Unsupported),
+      VertexAttrib4Nub ((PFNGLVERTEXATTRIB4NUBPROC) Unsupported),
+      VertexAttrib4Nubv ((PFNGLVERTEXATTRIB4NUBVPROC) Unsupported),
+      VertexAttrib4Nuiv ((PFNGLVERTEXATTRIB4NUIVPROC) Unsupported),
+      VertexAttrib4Nusv ((PFNGLVERTEXATTRIB4NUSVPROC) Unsupported),
+      VertexAttrib4bv ((PFNGLVERTEXATTRIB4BVPROC) Unsupported),
+      VertexAttrib4d ((PFNGLVERTEXATTRIB4DPROC) Unsupported),
+      VertexAttrib4dv ((PFNGLVERTEXATTRIB4DVPROC) Unsupported),
+      VertexAttrib4f ((PFNGLVERTEXATTRIB4FPROC) Unsupported),
+      VertexAttrib4fv ((PFNGLVERTEXATTRIB4FVPROC) Unsupported),
+      VertexAttrib4iv ((PFNGLVERTEXATTRIB4IVPROC) Unsupported),
+      VertexAttrib4s ((PFNGLVERTEXATTRIB4SPROC) Unsupported),
+      VertexAttrib4sv ((PFNGLVERTEXATTRIB4SVPROC) Unsupported),
+      VertexAttrib4ubv ((PFNGLVERTEXATTRIB4UBVPROC) Unsupported),
+      VertexAttrib4uiv ((PFNGLVERTEXATTRIB4UIVPROC) Unsupported),
+      VertexAttrib4usv ((PFNGLVERTEXATTRIB4USVPROC) Unsupported),
+      VertexAttribPointer ((PFNGLVERTEXATTRIBPOINTERPROC) Unsupported),
+      UniformMatrix2x3fv ((PFNGLUNIFORMMATRIX2X3FVPROC) Unsupported),
+      UniformMatrix3x2fv ((PFNGLUNIFORMMATRIX3X2FVPROC) Unsupported),
+      UniformMatrix2x4fv ((PFNGLUNIFORMMATRIX2X4FVPROC) Unsupported),
+      UniformMatrix4x2fv ((PFNGLUNIFORMMATRIX4X2FVPROC) Unsupported),
+      UniformMatrix3x4fv ((PFNGLUNIFORMMATRIX3X4FVPROC) Unsupported),
+      UniformMatrix4x3fv ((PFNGLUNIFORMMATRIX4X3FVPROC) Unsupported),
+      ColorMaski ((PFNGLCOLORMASKIPROC) Unsupported),
+      GetBooleani_v ((PFNGLGETBOOLEANI_VPROC) Unsupported),
+      GetIntegeri_v ((PFNGLGETINTEGERI_VPROC) Unsupported),
+      Enablei ((PFNGLENABLEIPROC) Unsupported),
+      Disablei ((PFNGLDISABLEIPROC) Unsupported),
+      IsEnabledi ((PFNGLISENABLEDIPROC) Unsupported),
+      BeginTransformFeedback ((PFNGLBEGINTRANSFORMFEEDBACKPROC) Unsupported),
+      EndTransformFeedback ((PFNGLENDTRANSFORMFEEDBACKPROC) Unsupported),
+      BindBufferRange ((PFNGLBINDBUFFERRANGEPROC) Unsupported),
+      BindBufferBase ((PFNGLBINDBUFFERBASEPROC) Unsupported),
+      TransformFeedbackVaryings ((PFNGLTRANSFORMFEEDBACKVARYINGSPROC) Unsupported),
+      GetTransformFeedbackVarying ((PFNGLGETTRANSFORMFEEDBACKVARYINGPROC) Unsupported),
+      ClampColor ((PFNGLCLAMPCOLORPROC) Unsupported),
+      BeginConditionalRender ((PFNGLBEGINCONDITIONALRENDERPROC) Unsupported),
+      EndConditionalRender ((PFNGLENDCONDITIONALRENDERPROC) Unsupported),
+      VertexAttribIPointer ((PFNGLVERTEXATTRIBIPOINTERPROC) Unsupported),
+      GetVertexAttribIiv ((PFNGLGETVERTEXATTRIBIIVPROC) Unsupported),
+      GetVertexAttribIuiv ((PFNGLGETVERTEXATTRIBIUIVPROC) Unsupported),
+      VertexAttribI1i ((PFNGLVERTEXATTRIBI1IPROC) Unsupported),
+      VertexAttribI2i ((PFNGLVERTEXATTRIBI2IPROC) Unsupported),
+      VertexAttribI3i ((PFNGLVERTEXATTRIBI3IPROC) Unsupported),
+      VertexAttribI4i ((PFNGLVERTEXATTRIBI4IPROC) Unsupported),
+      VertexAttribI1ui ((PFNGLVERTEXATTRIBI1UIPROC) Unsupported),
+      VertexAttribI2ui ((PFNGLVERTEXATTRIBI2UIPROC) Unsupported),
+      VertexAttribI3ui ((PFNGLVERTEXATTRIBI3UIPROC) Unsupported),
+      VertexAttribI4ui ((PFNGLVERTEXATTRIBI4UIPROC) Unsupported),
+      VertexAttribI1iv ((PFNGLVERTEXATTRIBI1IVPROC) Unsupported),
+      VertexAttribI2iv ((PFNGLVERTEXATTRIBI2IVPROC) Unsupported),
+      VertexAttribI3iv ((PFNGLVERTEXATTRIBI3IVPROC) Unsupported),
+      VertexAttribI4iv ((PFNGLVERTEXATTRIBI4IVPROC) Unsupported),
+      VertexAttribI1uiv ((PFNGLVERTEXATTRIBI1UIVPROC) Unsupported),
+      VertexAttribI2uiv ((PFNGLVERTEXATTRIBI2UIVPROC) Unsupported),
+      VertexAttribI3uiv ((PFNGLVERTEXATTRIBI3UIVPROC) Unsupported),
+      VertexAttribI4uiv ((PFNGLVERTEXATTRIBI4UIVPROC) Unsupported),
+      VertexAttribI4bv ((PFNGLVERTEXATTRIBI4BVPROC) Unsupported),
+      VertexAttribI4sv ((PFNGLVERTEXATTRIBI4SVPROC) Unsupported),
+      VertexAttribI4ubv ((PFNGLVERTEXATTRIBI4UBVPROC) Unsupported),
+      VertexAttribI4usv ((PFNGLVERTEXATTRIBI4USVPROC) Unsupported),
+      GetUniformuiv ((PFNGLGETUNIFORMUIVPROC) Unsupported),
+      BindFragDataLocation ((PFNGLBINDFRAGDATALOCATIONPROC) Unsupported),
+      GetFragDataLocation ((PFNGLGETFRAGDATALOCATIONPROC) Unsupported),
+      Uniform1ui ((PFNGLUNIFORM1UIPROC) Unsupported),
+      Uniform2ui ((PFNGLUNIFORM2UIPROC) Unsupported),
+      Uniform3ui ((PFNGLUNIFORM3UIPROC) Unsupported),
+      Uniform4ui ((PFNGLUNIFORM4UIPROC) Unsupported),
+      Uniform1uiv ((PFNGLUNIFORM1UIVPROC) Unsupported),
+      Uniform2uiv ((PFNGLUNIFORM2UIVPROC) Unsupported),
+      Uniform3uiv ((PFNGLUNIFORM3UIVPROC) Unsupported),
+      Uniform4uiv ((PFNGLUNIFORM4UIVPROC) Unsupported),
+      TexParameterIiv ((PFNGLTEXPARAMETERIIVPROC) Unsupported),
+      TexParameterIuiv ((PFNGLTEXPARAMETERIUIVPROC) Unsupported),
+      GetTexParameterIiv ((PFNGLGETTEXPARAMETERIIVPROC) Unsupported),
+      GetTexParameterIuiv ((PFNGLGETTEXPARAMETERIUIVPROC) Unsupported),
+      ClearBufferiv ((PFNGLCLEARBUFFERIVPROC) Unsupported),
+      ClearBufferuiv ((PFNGLCLEARBUFFERUIVPROC) Unsupported),
+      ClearBufferfv ((PFNGLCLEARBUFFERFVPROC) Unsupported),
+      ClearBufferfi ((PFNGLCLEARBUFFERFIPROC) Unsupported),
+      GetStringi ((PFNGLGETSTRINGIPROC) Unsupported),
+      IsRenderbuffer ((PFNGLISRENDERBUFFERPROC) Unsupported),
+      BindRenderbuffer ((PFNGLBINDRENDERBUFFERPROC) Unsupported),
+      DeleteRenderbuffers ((PFNGLDELETERENDERBUFFERSPROC) Unsupported),
+      GenRenderbuffers ((PFNGLGENRENDERBUFFERSPROC) Unsupported),
+      RenderbufferStorage ((PFNGLRENDERBUFFERSTORAGEPROC) Unsupported),
+      GetRenderbufferParameteriv ((PFNGLGETRENDERBUFFERPARAMETERIVPROC) Unsupported),
+      IsFramebuffer ((PFNGLISFRAMEBUFFERPROC) Unsupported),
+      BindFramebuffer ((PFNGLBINDFRAMEBUFFERPROC) Unsupported),
+      DeleteFramebuffers ((PFNGLDELETEFRAMEBUFFERSPROC) Unsupported),
+      GenFramebuffers ((PFNGLGENFRAMEBUFFERSPROC) Unsupported),
+      CheckFramebufferStatus ((PFNGLCHECKFRAMEBUFFERSTATUSPROC) Unsupported),
+      FramebufferTexture1D ((PFNGLFRAMEBUFFERTEXTURE1DPROC) Unsupported),
+      FramebufferTexture2D ((PFNGLFRAMEBUFFERTEXTURE2DPROC) Unsupported),
+      FramebufferTexture3D ((PFNGLFRAMEBUFFERTEXTURE3DPROC) Unsupported),
+      FramebufferRenderbuffer ((PFNGLFRAMEBUFFERRENDERBUFFERPROC) Unsupported),
+      GetFramebufferAttachmentParameteriv ((PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC) Unsupported),
+      GenerateMipmap ((PFNGLGENERATEMIPMAPPROC) Unsupported),
+      BlitFramebuffer ((PFNGLBLITFRAMEBUFFERPROC) Unsupported),
+      RenderbufferStorageMultisample ((PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC) Unsupported),
+      FramebufferTextureLayer ((PFNGLFRAMEBUFFERTEXTURELAYERPROC) Unsupported),
+      MapBufferRange ((PFNGLMAPBUFFERRANGEPROC) Unsupported),
+      FlushMappedBufferRange ((PFNGLFLUSHMAPPEDBUFFERRANGEPROC) Unsupported),
+      BindVertexArray ((PFNGLBINDVERTEXARRAYPROC) Unsupported),
+      DeleteVertexArrays ((PFNGLDELETEVERTEXARRAYSPROC) Unsupported),
+      GenVertexArrays ((PFNGLGENVERTEXARRAYSPROC) Unsupported),
+      IsVertexArray ((PFNGLISVERTEXARRAYPROC) Unsupported),
+      DrawArraysInstanced ((PFNGLDRAWARRAYSINSTANCEDPROC) Unsupported),
+      DrawElementsInstanced ((PFNGLDRAWELEMENTSINSTANCEDPROC) Unsupported),
+      TexBuffer ((PFNGLTEXBUFFERPROC) Unsupported),
+      PrimitiveRestartIndex ((PFNGLPRIMITIVERESTARTINDEXPROC) Unsupported),
+      CopyBufferSubData ((PFNGLCOPYBUFFERSUBDATAPROC) Unsupported),
+      GetUniformIndices ((PFNGLGETUNIFORMINDICESPROC) Unsupported),
+      GetActiveUniformsiv ((PFNGLGETACTIVEUNIFORMSIVPROC) Unsupported),
+      GetActiveUniformName ((PFNGLGETACTIVEUNIFORMNAMEPROC) Unsupported),
+      GetUniformBlockIndex ((PFNGLGETUNIFORMBLOCKINDEXPROC) Unsupported),
+      GetActiveUniformBlockiv ((PFNGLGETACTIVEUNIFORMBLOCKIVPROC) Unsupported),
+      GetActiveUniformBlockName ((PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC) Unsupported),
+      UniformBlockBinding ((PFNGLUNIFORMBLOCKBINDINGPROC) Unsupported),
+      DrawElementsBaseVertex ((PFNGLDRAWELEMENTSBASEVERTEXPROC) Unsupported),
+      DrawRangeElementsBaseVertex ((PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC) Unsupported),
+      DrawElementsInstancedBaseVertex ((PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC) Unsupported),
+      MultiDrawElementsBaseVertex ((PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC) Unsupported),
+      ProvokingVertex ((PFNGLPROVOKINGVERTEXPROC) Unsupported),
+      FenceSync ((PFNGLFENCESYNCPROC) Unsupported),
+      IsSync ((PFNGLISSYNCPROC) Unsupported),
+      DeleteSync ((PFNGLDELETESYNCPROC) Unsupported),
+      ClientWaitSync ((PFNGLCLIENTWAITSYNCPROC) Unsupported),
+      WaitSync ((PFNGLWAITSYNCPROC) Unsupported),
+      GetInteger64v ((PFNGLGETINTEGER64VPROC) Unsupported),
+      GetSynciv ((PFNGLGETSYNCIVPROC) Unsupported),
+      GetInteger64i_v ((PFNGLGETINTEGER64I_VPROC) Unsupported),
+      GetBufferParameteri64v ((PFNGLGETBUFFERPARAMETERI64VPROC) Unsupported),
+      FramebufferTexture ((PFNGLFRAMEBUFFERTEXTUREPROC) Unsupported),
+      TexImage2DMultisample ((PFNGLTEXIMAGE2DMULTISAMPLEPROC) Unsupported),
+      TexImage3DMultisample ((PFNGLTEXIMAGE3DMULTISAMPLEPROC) Unsupported),
+      GetMultisamplefv ((PFNGLGETMULTISAMPLEFVPROC) Unsupported),
+      SampleMaski ((PFNGLSAMPLEMASKIPROC) Unsupported),
+      BindFragDataLocationIndexed ((PFNGLBINDFRAGDATALOCATIONINDEXEDPROC) Unsupported),
+      GetFragDataIndex ((PFNGLGETFRAGDATAINDEXPROC) Unsupported),
+      GenSamplers ((PFNGLGENSAMPLERSPROC) Unsupported),
+      DeleteSamplers ((PFNGLDELETESAMPLERSPROC) Unsupported),
+      IsSampler ((PFNGLISSAMPLERPROC) Unsupported),
+      BindSampler ((PFNGLBINDSAMPLERPROC) Unsupported),
+      SamplerParameteri ((PFNGLSAMPLERPARAMETERIPROC) Unsupported),
+      SamplerParameteriv ((PFNGLSAMPLERPARAMETERIVPROC) Unsupported),
+      SamplerParameterf ((PFNGLSAMPLERPARAMETERFPROC) Unsupported),
+      SamplerParameterfv ((PFNGLSAMPLERPARAMETERFVPROC) Unsupported),
+      SamplerParameterIiv ((PFNGLSAMPLERPARAMETERIIVPROC) Unsupported),
+      SamplerParameterIuiv ((PFNGLSAMPLERPARAMETERIUIVPROC) Unsupported),
+      GetSamplerParameteriv ((PFNGLGETSAMPLERPARAMETERIVPROC) Unsupported),
+      GetSamplerParameterIiv ((PFNGLGETSAMPLERPARAMETERIIVPROC) Unsupported),
+      GetSamplerParameterfv ((PFNGLGETSAMPLERPARAMETERFVPROC) Unsupported),
+      GetSamplerParameterIuiv ((PFNGLGETSAMPLERPARAMETERIUIVPROC) Unsupported),
+      QueryCounter ((PFNGLQUERYCOUNTERPROC) Unsupported),
+      GetQueryObjecti64v ((PFNGLGETQUERYOBJECTI64VPROC) Unsupported),
+      GetQueryObjectui64v ((PFNGLGETQUERYOBJECTUI64VPROC) Unsupported),
+      VertexAttribDivisor ((PFNGLVERTEXATTRIBDIVISORPROC) Unsupported),
+      VertexAttribP1ui ((PFNGLVERTEXATTRIBP1UIPROC) Unsupported),
+      VertexAttribP1uiv ((PFNGLVERTEXATTRIBP1UIVPROC) Unsupported),
+      VertexAttribP2ui ((PFNGLVERTEXATTRIBP2UIPROC) Unsupported),
+      VertexAttribP2uiv ((PFNGLVERTEXATTRIBP2UIVPROC) Unsupported),
+      VertexAttribP3ui ((PFNGLVERTEXATTRIBP3UIPROC) Unsupported),
+      VertexAttribP3uiv ((PFNGLVERTEXATTRIBP3UIVPROC) Unsupported),
+      VertexAttribP4ui ((PFNGLVERTEXATTRIBP4UIPROC) Unsupported),
+      VertexAttribP4uiv ((PFNGLVERTEXATTRIBP4UIVPROC) Unsupported),
+      MinSampleShading ((PFNGLMINSAMPLESHADINGPROC) Unsupported),
+      BlendEquationi ((PFNGLBLENDEQUATIONIPROC) Unsupported),
+      BlendEquationSeparatei ((PFNGLBLENDEQUATIONSEPARATEIPROC) Unsupported),
+      BlendFunci ((PFNGLBLENDFUNCIPROC) Unsupported),
+      BlendFuncSeparatei ((PFNGLBLENDFUNCSEPARATEIPROC) Unsupported),
+      DrawArraysIndirect ((PFNGLDRAWARRAYSINDIRECTPROC) Unsupported),
+      DrawElementsIndirect ((PFNGLDRAWELEMENTSINDIRECTPROC) Unsupported),
+      Uniform1d ((PFNGLUNIFORM1DPROC) Unsupported),
+      Uniform2d ((PFNGLUNIFORM2DPROC) Unsupported),
+      Uniform3d ((PFNGLUNIFORM3DPROC) Unsupported),
+      Uniform4d ((PFNGLUNIFORM4DPROC) Unsupported),
+      Uniform1dv ((PFNGLUNIFORM1DVPROC) Unsupported),
+      Uniform2dv ((PFNGLUNIFORM2DVPROC) Unsupported),
+      Uniform3dv ((PFNGLUNIFORM3DVPROC) Unsupported),
+      Uniform4dv ((PFNGLUNIFORM4DVPROC) Unsupported),
+      UniformMatrix2dv ((PFNGLUNIFORMMATRIX2DVPROC) Unsupported),
+      UniformMatrix3dv ((PFNGLUNIFORMMATRIX3DVPROC) Unsupported),
+      UniformMatrix4dv ((PFNGLUNIFORMMATRIX4DVPROC) Unsupported),
+      UniformMatrix2x3dv ((PFNGLUNIFORMMATRIX2X3DVPROC) Unsupported),
+      UniformMatrix2x4dv ((PFNGLUNIFORMMATRIX2X4DVPROC) Unsupported),
+      UniformMatrix3x2dv ((PFNGLUNIFORMMATRIX3X2DVPROC) Unsupported),
+      UniformMatrix3x4dv ((PFNGLUNIFORMMATRIX3X4DVPROC) Unsupported),
+      UniformMatrix4x2dv ((PFNGLUNIFORMMATRIX4X2DVPROC) Unsupported),
+      UniformMatrix4x3dv ((PFNGLUNIFORMMATRIX4X3DVPROC) Unsupported),
+      GetUniformdv ((PFNGLGETUNIFORMDVPROC) Unsupported),
+      GetSubroutineUniformLocation ((PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC) Unsupported),
+      GetSubroutineIndex ((PFNGLGETSUBROUTINEINDEXPROC) Unsupported),
+      GetActiveSubroutineUniformiv ((PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC) Unsupported),
+      GetActiveSubroutineUniformName ((PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC) Unsupported),
+      GetActiveSubroutineName ((PFNGLGETACTIVESUBROUTINENAMEPROC) Unsupported),
+      UniformSubroutinesuiv ((PFNGLUNIFORMSUBROUTINESUIVPROC) Unsupported),
+      GetUniformSubroutineuiv ((PFNGLGETUNIFORMSUBROUTINEUIVPROC) Unsupported),
+      GetProgramStageiv ((PFNGLGETPROGRAMSTAGEIVPROC) Unsupported),
+      PatchParameteri ((PFNGLPATCHPARAMETERIPROC) Unsupported),
+      PatchParameterfv ((PFNGLPATCHPARAMETERFVPROC) Unsupported),
+      BindTransformFeedback ((PFNGLBINDTRANSFORMFEEDBACKPROC) Unsupported),
+      DeleteTransformFeedbacks ((PFNGLDELETETRANSFORMFEEDBACKSPROC) Unsupported),
+      GenTransformFeedbacks ((PFNGLGENTRANSFORMFEEDBACKSPROC) Unsupported),
+      IsTransformFeedback ((PFNGLISTRANSFORMFEEDBACKPROC) Unsupported),
+      PauseTransformFeedback ((PFNGLPAUSETRANSFORMFEEDBACKPROC) Unsupported),
+      ResumeTransformFeedback ((PFNGLRESUMETRANSFORMFEEDBACKPROC) Unsupported),
+      DrawTransformFeedback ((PFNGLDRAWTRANSFORMFEEDBACKPROC) Unsupported),
+      DrawTransformFeedbackStream ((PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC) Unsupported),
+      BeginQueryIndexed ((PFNGLBEGINQUERYINDEXEDPROC) Unsupported),
+      EndQueryIndexed ((PFNGLENDQUERYINDEXEDPROC) Unsupported),
+      GetQueryIndexediv ((PFNGLGETQUERYINDEXEDIVPROC) Unsupported),
+      ReleaseShaderCompiler ((PFNGLRELEASESHADERCOMPILERPROC) Unsupported),
+      ShaderBinary ((PFNGLSHADERBINARYPROC) Unsupported),
+      GetShaderPrecisionFormat ((PFNGLGETSHADERPRECISIONFORMATPROC) Unsupported),
+      DepthRangef ((PFNGLDEPTHRANGEFPROC) Unsupported),
+      ClearDepthf ((PFNGLCLEARDEPTHFPROC) Unsupported),
+      GetProgramBinary ((PFNGLGETPROGRAMBINARYPROC) Unsupported),
+      ProgramBinary ((PFNGLPROGRAMBINARYPROC) Unsupported),
+      ProgramParameteri ((PFNGLPROGRAMPARAMETERIPROC) Unsupported),
+      UseProgramStages ((PFNGLUSEPROGRAMSTAGESPROC) Unsupported),
+      ActiveShaderProgram ((PFNGLACTIVESHADERPROGRAMPROC) Unsupported),
+      CreateShaderProgramv ((PFNGLCREATESHADERPROGRAMVPROC) Unsupported),
+      BindProgramPipeline ((PFNGLBINDPROGRAMPIPELINEPROC) Unsupported),
+      DeleteProgramPipelines ((PFNGLDELETEPROGRAMPIPELINESPROC) Unsupported),
+      GenProgramPipelines ((PFNGLGENPROGRAMPIPELINESPROC) Unsupported),
+      IsProgramPipeline ((PFNGLISPROGRAMPIPELINEPROC) Unsupported),
+      GetProgramPipelineiv ((PFNGLGETPROGRAMPIPELINEIVPROC) Unsupported),
+      ProgramUniform1i ((PFNGLPROGRAMUNIFORM1IPROC) Unsupported),
+      ProgramUniform1iv ((PFNGLPROGRAMUNIFORM1IVPROC) Unsupported),
+      ProgramUniform1f ((PFNGLPROGRAMUNIFORM1FPROC) Unsupported),
+      ProgramUniform1fv ((PFNGLPROGRAMUNIFORM1FVPROC) Unsupported),
+      ProgramUniform1d ((PFNGLPROGRAMUNIFORM1DPROC) Unsupported),
+      ProgramUniform1dv ((PFNGLPROGRAMUNIFORM1DVPROC) Unsupported),
+      ProgramUniform1ui ((PFNGLPROGRAMUNIFORM1UIPROC) Unsupported),
+      ProgramUniform1uiv ((PFNGLPROGRAMUNIFORM1UIVPROC) Unsupported),
+      ProgramUniform2i ((PFNGLPROGRAMUNIFORM2IPROC) Unsupported),
+      ProgramUniform2iv ((PFNGLPROGRAMUNIFORM2IVPROC) Unsupported),
+      ProgramUniform2f ((PFNGLPROGRAMUNIFORM2FPROC) Unsupported),
+      ProgramUniform2fv ((PFNGLPROGRAMUNIFORM2FVPROC) Unsupported),
+      ProgramUniform2d ((PFNGLPROGRAMUNIFORM2DPROC) Unsupported),
+      ProgramUniform2dv ((PFNGLPROGRAMUNIFORM2DVPROC) Unsupported),
+      ProgramUniform2ui ((PFNGLPROGRAMUNIFORM2UIPROC) Unsupported),
+      ProgramUniform2uiv ((PFNGLPROGRAMUNIFORM2UIVPROC) Unsupported),
+      ProgramUniform3i ((PFNGLPROGRAMUNIFORM3IPROC) Unsupported),
+      ProgramUniform3iv ((PFNGLPROGRAMUNIFORM3IVPROC) Unsupported),
+      ProgramUniform3f ((PFNGLPROGRAMUNIFORM3FPROC) Unsupported),
+      ProgramUniform3fv ((PFNGLPROGRAMUNIFORM3FVPROC) Unsupported),
+      ProgramUniform3d ((PFNGLPROGRAMUNIFORM3DPROC) Unsupported),
+      ProgramUniform3dv ((PFNGLPROGRAMUNIFORM3DVPROC) Unsupported),
+      ProgramUniform3ui ((PFNGLPROGRAMUNIFORM3UIPROC) Unsupported),
+      ProgramUniform3uiv ((PFNGLPROGRAMUNIFORM3UIVPROC) Unsupported),
+      ProgramUniform4i ((PFNGLPROGRAMUNIFORM4IPROC) Unsupported),
+      ProgramUniform4iv ((PFNGLPROGRAMUNIFORM4IVPROC) Unsupported),
+      ProgramUniform4f ((PFNGLPROGRAMUNIFORM4FPROC) Unsupported),
+      ProgramUniform4fv ((PFNGLPROGRAMUNIFORM4FVPROC) Unsupported),
+      ProgramUniform4d ((PFNGLPROGRAMUNIFORM4DPROC) Unsupported),
+      ProgramUniform4dv ((PFNGLPROGRAMUNIFORM4DVPROC) Unsupported),
+      ProgramUniform4ui ((PFNGLPROGRAMUNIFORM4UIPROC) Unsupported),
+      ProgramUniform4uiv ((PFNGLPROGRAMUNIFORM4UIVPROC) Unsupported),
+      ProgramUniformMatrix2fv ((PFNGLPROGRAMUNIFORMMATRIX2FVPROC) Unsupported),
+      ProgramUniformMatrix3fv ((PFNGLPROGRAMUNIFORMMATRIX3FVPROC) Unsupported),
+      ProgramUniformMatrix4fv ((PFNGLPROGRAMUNIFORMMATRIX4FVPROC) Unsupported),
+      ProgramUniformMatrix2dv ((PFNGLPROGRAMUNIFORMMATRIX2DVPROC) Unsupported),
+      ProgramUniformMatrix3dv ((PFNGLPROGRAMUNIFORMMATRIX3DVPROC) Unsupported),
+      ProgramUniformMatrix4dv ((PFNGLPROGRAMUNIFORMMATRIX4DVPROC) Unsupported),
+      ProgramUniformMatrix2x3fv ((PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC) Unsupported),
+      ProgramUniformMatrix3x2fv ((PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC) Unsupported),
+      ProgramUniformMatrix2x4fv ((PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC) Unsupported),
+      ProgramUniformMatrix4x2fv ((PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC) Unsupported),
+      ProgramUniformMatrix3x4fv ((PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC) Unsupported),
+      ProgramUniformMatrix4x3fv ((PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC) Unsupported),
+      ProgramUniformMatrix2x3dv ((PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC) Unsupported),
+      ProgramUniformMatrix3x2dv ((PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC) Unsupported),
+      ProgramUniformMatrix2x4dv ((PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC) Unsupported),
+      ProgramUniformMatrix4x2dv ((PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC) Unsupported),
+      ProgramUniformMatrix3x4dv ((PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC) Unsupported),
+      ProgramUniformMatrix4x3dv ((PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC) Unsupported),
+      ValidateProgramPipeline ((PFNGLVALIDATEPROGRAMPIPELINEPROC) Unsupported),
+      GetProgramPipelineInfoLog ((PFNGLGETPROGRAMPIPELINEINFOLOGPROC) Unsupported),
+      VertexAttribL1d ((PFNGLVERTEXATTRIBL1DPROC) Unsupported),
+      VertexAttribL2d ((PFNGLVERTEXATTRIBL2DPROC) Unsupported),
+      VertexAttribL3d ((PFNGLVERTEXATTRIBL3DPROC) Unsupported),
+      VertexAttribL4d ((PFNGLVERTEXATTRIBL4DPROC) Unsupported),
+      VertexAttribL1dv ((PFNGLVERTEXATTRIBL1DVPROC) Unsupported),
+      VertexAttribL2dv ((PFNGLVERTEXATTRIBL2DVPROC) Unsupported),
+      VertexAttribL3dv ((PFNGLVERTEXATTRIBL3DVPROC) Unsupported),
+      VertexAttribL4dv ((PFNGLVERTEXATTRIBL4DVPROC) Unsupported),
+      VertexAttribLPointer ((PFNGLVERTEXATTRIBLPOINTERPROC) Unsupported),
+      GetVertexAttribLdv ((PFNGLGETVERTEXATTRIBLDVPROC) Unsupported),
+      ViewportArrayv ((PFNGLVIEWPORTARRAYVPROC) Unsupported),
+      ViewportIndexedf ((PFNGLVIEWPORTINDEXEDFPROC) Unsupported),
+      ViewportIndexedfv ((PFNGLVIEWPORTINDEXEDFVPROC) Unsupported),
+      ScissorArrayv ((PFNGLSCISSORARRAYVPROC) Unsupported),
+      ScissorIndexed ((PFNGLSCISSORINDEXEDPROC) Unsupported),
+      ScissorIndexedv ((PFNGLSCISSORINDEXEDVPROC) Unsupported),
+      DepthRangeArrayv ((PFNGLDEPTHRANGEARRAYVPROC) Unsupported),
+      DepthRangeIndexed ((PFNGLDEPTHRANGEINDEXEDPROC) Unsupported),
+      GetFloati_v ((PFNGLGETFLOATI_VPROC) Unsupported),
+      GetDoublei_v ((PFNGLGETDOUBLEI_VPROC) Unsupported),
+      DrawArraysInstancedBaseInstance ((PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC) Unsupported),
+      DrawElementsInstancedBaseInstance ((PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC) Unsupported),
+      DrawElementsInstancedBaseVertexBaseInstance ((PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC) Unsupported),
+      GetInternalformativ ((PFNGLGETINTERNALFORMATIVPROC) Unsupported),
+      GetActiveAtomicCounterBufferiv ((PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC) Unsupported),
+      BindImageTexture ((PFNGLBINDIMAGETEXTUREPROC) Unsupported),
+      MemoryBarrier ((PFNGLMEMORYBARRIERPROC) Unsupported),
+      TexStorage1D ((PFNGLTEXSTORAGE1DPROC) Unsupported),
+      TexStorage2D ((PFNGLTEXSTORAGE2DPROC) Unsupported),
+      TexStorage3D ((PFNGLTEXSTORAGE3DPROC) Unsupported),
+      DrawTransformFeedbackInstanced ((PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC) Unsupported),
+      DrawTransformFeedbackStreamInstanced ((PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC) Unsupported),
+      ClearBufferData ((PFNGLCLEARBUFFERDATAPROC) Unsupported),
+      ClearBufferSubData ((PFNGLCLEARBUFFERSUBDATAPROC) Unsupported),
+      DispatchCompute ((PFNGLDISPATCHCOMPUTEPROC) Unsupported),
+      DispatchComputeIndirect ((PFNGLDISPATCHCOMPUTEINDIRECTPROC) Unsupported),
+      CopyImageSubData ((PFNGLCOPYIMAGESUBDATAPROC) Unsupported),
+      FramebufferParameteri ((PFNGLFRAMEBUFFERPARAMETERIPROC) Unsupported),
+      GetFramebufferParameteriv ((PFNGLGETFRAMEBUFFERPARAMETERIVPROC) Unsupported),
+      GetInternalformati64v ((PFNGLGETINTERNALFORMATI64VPROC) Unsupported),
+      InvalidateTexSubImage ((PFNGLINVALIDATETEXSUBIMAGEPROC) Unsupported),
+      InvalidateTexImage ((PFNGLINVALIDATETEXIMAGEPROC) Unsupported),
+      InvalidateBufferSubData ((PFNGLINVALIDATEBUFFERSUBDATAPROC) Unsupported),
+      InvalidateBufferData ((PFNGLINVALIDATEBUFFERDATAPROC) Unsupported),
+      InvalidateFramebuffer ((PFNGLINVALIDATEFRAMEBUFFERPROC) Unsupported),
+      InvalidateSubFramebuffer ((PFNGLINVALIDATESUBFRAMEBUFFERPROC) Unsupported),
+      MultiDrawArraysIndirect ((PFNGLMULTIDRAWARRAYSINDIRECTPROC) Unsupported),
+      MultiDrawElementsIndirect ((PFNGLMULTIDRAWELEMENTSINDIRECTPROC) Unsupported),
+      GetProgramInterfaceiv ((PFNGLGETPROGRAMINTERFACEIVPROC) Unsupported),
+      GetProgramResourceIndex ((PFNGLGETPROGRAMRESOURCEINDEXPROC) Unsupported),
+      GetProgramResourceName ((PFNGLGETPROGRAMRESOURCENAMEPROC) Unsupported),
+      GetProgramResourceiv ((PFNGLGETPROGRAMRESOURCEIVPROC) Unsupported),
+      GetProgramResourceLocation ((PFNGLGETPROGRAMRESOURCELOCATIONPROC) Unsupported),
+      GetProgramResourceLocationIndex ((PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC) Unsupported),
+      ShaderStorageBlockBinding ((PFNGLSHADERSTORAGEBLOCKBINDINGPROC) Unsupported),
+      TexBufferRange ((PFNGLTEXBUFFERRANGEPROC) Unsupported),
+      TexStorage2DMultisample ((PFNGLTEXSTORAGE2DMULTISAMPLEPROC) Unsupported),
+      TexStorage3DMultisample ((PFNGLTEXSTORAGE3DMULTISAMPLEPROC) Unsupported),
+      TextureView ((PFNGLTEXTUREVIEWPROC) Unsupported),
+      BindVertexBuffer ((PFNGLBINDVERTEXBUFFERPROC) Unsupported),
+      VertexAttribFormat ((PFNGLVERTEXATTRIBFORMATPROC) Unsupported),
+      VertexAttribIFormat ((PFNGLVERTEXATTRIBIFORMATPROC) Unsupported),
+      VertexAttribLFormat ((PFNGLVERTEXATTRIBLFORMATPROC) Unsupported),
+      VertexAttribBinding ((PFNGLVERTEXATTRIBBINDINGPROC) Unsupported),
+      VertexBindingDivisor ((PFNGLVERTEXBINDINGDIVISORPROC) Unsupported),
+      DebugMessageControl ((PFNGLDEBUGMESSAGECONTROLPROC) Unsupported),
+      DebugMessageInsert ((PFNGLDEBUGMESSAGEINSERTPROC) Unsupported),
+      DebugMessageCallback ((PFNGLDEBUGMESSAGECALLBACKPROC) Unsupported),
+      GetDebugMessageLog ((PFNGLGETDEBUGMESSAGELOGPROC) Unsupported),
+      PushDebugGroup ((PFNGLPUSHDEBUGGROUPPROC) Unsupported),
+      PopDebugGroup ((PFNGLPOPDEBUGGROUPPROC) Unsupported),
+      ObjectLabel ((PFNGLOBJECTLABELPROC) Unsupported),
+      GetObjectLabel ((PFNGLGETOBJECTLABELPROC) Unsupported),
+      ObjectPtrLabel ((PFNGLOBJECTPTRLABELPROC) Unsupported),
+      GetObjectPtrLabel ((PFNGLGETOBJECTPTRLABELPROC) Unsupported),
+      BufferStorage ((PFNGLBUFFERSTORAGEPROC) Unsupported),
+      ClearTexImage ((PFNGLCLEARTEXIMAGEPROC) Unsupported),
+      ClearTexSubImage ((PFNGLCLEARTEXSUBIMAGEPROC) Unsupported),
+      BindBuffersBase ((PFNGLBINDBUFFERSBASEPROC) Unsupported),
+      BindBuffersRange ((PFNGLBINDBUFFERSRANGEPROC) Unsupported),
+      BindTextures ((PFNGLBINDTEXTURESPROC) Unsupported),
+      BindSamplers ((PFNGLBINDSAMPLERSPROC) Unsupported),
+      BindImageTextures ((PFNGLBINDIMAGETEXTURESPROC) Unsupported),
+      BindVertexBuffers ((PFNGLBINDVERTEXBUFFERSPROC) Unsupported),
+      ClipControl ((PFNGLCLIPCONTROLPROC) Unsupported),
+      CreateTransformFeedbacks ((PFNGLCREATETRANSFORMFEEDBACKSPROC) Unsupported),
+      TransformFeedbackBufferBase ((PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC) Unsupported),
+      TransformFeedbackBufferRange ((PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC) Unsupported),
+      GetTransformFeedbackiv ((PFNGLGETTRANSFORMFEEDBACKIVPROC) Unsupported),
+      GetTransformFeedbacki_v ((PFNGLGETTRANSFORMFEEDBACKI_VPROC) Unsupported),
+      GetTransformFeedbacki64_v ((PFNGLGETTRANSFORMFEEDBACKI64_VPROC) Unsupported),
+      CreateBuffers ((PFNGLCREATEBUFFERSPROC) Unsupported),
+      NamedBufferStorage ((PFNGLNAMEDBUFFERSTORAGEPROC) Unsupported),
+      NamedBufferData ((PFNGLNAMEDBUFFERDATAPROC) Unsupported),
+      NamedBufferSubData ((PFNGLNAMEDBUFFERSUBDATAPROC) Unsupported),
+      CopyNamedBufferSubData ((PFNGLCOPYNAMEDBUFFERSUBDATAPROC) Unsupported),
+      ClearNamedBufferData ((PFNGLCLEARNAMEDBUFFERDATAPROC) Unsupported),
+      ClearNamedBufferSubData ((PFNGLCLEARNAMEDBUFFERSUBDATAPROC) Unsupported),
+      MapNamedBuffer ((PFNGLMAPNAMEDBUFFERPROC) Unsupported),
+      MapNamedBufferRange ((PFNGLMAPNAMEDBUFFERRANGEPROC) Unsupported),
+      UnmapNamedBuffer ((PFNGLUNMAPNAMEDBUFFERPROC) Unsupported),
+      FlushMappedNamedBufferRange ((PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC) Unsupported),
+      GetNamedBufferParameteriv ((PFNGLGETNAMEDBUFFERPARAMETERIVPROC) Unsupported),
+      GetNamedBufferParameteri64v ((PFNGLGETNAMEDBUFFERPARAMETERI64VPROC) Unsupported),
+      GetNamedBufferPointerv ((PFNGLGETNAMEDBUFFERPOINTERVPROC) Unsupported),
+      GetNamedBufferSubData ((PFNGLGETNAMEDBUFFERSUBDATAPROC) Unsupported),
+      CreateFramebuffers ((PFNGLCREATEFRAMEBUFFERSPROC) Unsupported),
+      NamedFramebufferRenderbuffer ((PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC) Unsupported),
+      NamedFramebufferParameteri ((PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC) Unsupported),
+      NamedFramebufferTexture ((PFNGLNAMEDFRAMEBUFFERTEXTUREPROC) Unsupported),
+      NamedFramebufferTextureLayer ((PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC) Unsupported),
+      NamedFramebufferDrawBuffer ((PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC) Unsupported),
+      NamedFramebufferDrawBuffers ((PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC) Unsupported),
+      NamedFramebufferReadBuffer ((PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC) Unsupported),
+      InvalidateNamedFramebufferData ((PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC) Unsupported),
+      InvalidateNamedFramebufferSubData ((PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC) Unsupported),
+      ClearNamedFramebufferiv ((PFNGLCLEARNAMEDFRAMEBUFFERIVPROC) Unsupported),
+      ClearNamedFramebufferuiv ((PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC) Unsupported),
+      ClearNamedFramebufferfv ((PFNGLCLEARNAMEDFRAMEBUFFERFVPROC) Unsupported),
+      ClearNamedFramebufferfi ((PFNGLCLEARNAMEDFRAMEBUFFERFIPROC) Unsupported),
+      BlitNamedFramebuffer ((PFNGLBLITNAMEDFRAMEBUFFERPROC) Unsupported),
+      CheckNamedFramebufferStatus ((PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC) Unsupported),
+      GetNamedFramebufferParameteriv ((PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC) Unsupported),
+      GetNamedFramebufferAttachmentParameteriv ((PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC) Unsupported),
+      CreateRenderbuffers ((PFNGLCREATERENDERBUFFERSPROC) Unsupported),
+      NamedRenderbufferStorage ((PFNGLNAMEDRENDERBUFFERSTORAGEPROC) Unsupported),
+      NamedRenderbufferStorageMultisample ((PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC) Unsupported),
+      GetNamedRenderbufferParameteriv ((PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC) Unsupported),
+      CreateTextures ((PFNGLCREATETEXTURESPROC) Unsupported),
+      TextureBuffer ((PFNGLTEXTUREBUFFERPROC) Unsupported),
+      TextureBufferRange ((PFNGLTEXTUREBUFFERRANGEPROC) Unsupported),
+      TextureStorage1D ((PFNGLTEXTURESTORAGE1DPROC) Unsupported),
+      TextureStorage2D ((PFNGLTEXTURESTORAGE2DPROC) Unsupported),
+      TextureStorage3D ((PFNGLTEXTURESTORAGE3DPROC) Unsupported),
+      TextureStorage2DMultisample ((PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC) Unsupported),
+      TextureStorage3DMultisample ((PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC) Unsupported),
+      TextureSubImage1D ((PFNGLTEXTURESUBIMAGE1DPROC) Unsupported),
+      TextureSubImage2D ((PFNGLTEXTURESUBIMAGE2DPROC) Unsupported),
+      TextureSubImage3D ((PFNGLTEXTURESUBIMAGE3DPROC) Unsupported),
+      CompressedTextureSubImage1D ((PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC) Unsupported),
+      CompressedTextureSubImage2D ((PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC) Unsupported),
+      CompressedTextureSubImage3D ((PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC) Unsupported),
+      CopyTextureSubImage1D ((PFNGLCOPYTEXTURESUBIMAGE1DPROC) Unsupported),
+      CopyTextureSubImage2D ((PFNGLCOPYTEXTURESUBIMAGE2DPROC) Unsupported),
+      CopyTextureSubImage3D ((PFNGLCOPYTEXTURESUBIMAGE3DPROC) Unsupported),
+      TextureParameterf ((PFNGLTEXTUREPARAMETERFPROC) Unsupported),
+      TextureParameterfv ((PFNGLTEXTUREPARAMETERFVPROC) Unsupported),
+      TextureParameteri ((PFNGLTEXTUREPARAMETERIPROC) Unsupported),
+      TextureParameterIiv ((PFNGLTEXTUREPARAMETERIIVPROC) Unsupported),
+      TextureParameterIuiv ((PFNGLTEXTUREPARAMETERIUIVPROC) Unsupported),
+      TextureParameteriv ((PFNGLTEXTUREPARAMETERIVPROC) Unsupported),
+      GenerateTextureMipmap ((PFNGLGENERATETEXTUREMIPMAPPROC) Unsupported),
+      BindTextureUnit ((PFNGLBINDTEXTUREUNITPROC) Unsupported),
+      GetTextureImage ((PFNGLGETTEXTUREIMAGEPROC) Unsupported),
+      GetCompressedTextureImage ((PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC) Unsupported),
+      GetTextureLevelParameterfv ((PFNGLGETTEXTURELEVELPARAMETERFVPROC) Unsupported),
+      GetTextureLevelParameteriv ((PFNGLGETTEXTURELEVELPARAMETERIVPROC) Unsupported),
+      GetTextureParameterfv ((PFNGLGETTEXTUREPARAMETERFVPROC) Unsupported),
+      GetTextureParameterIiv ((PFNGLGETTEXTUREPARAMETERIIVPROC) Unsupported),
+      GetTextureParameterIuiv ((PFNGLGETTEXTUREPARAMETERIUIVPROC) Unsupported),
+      GetTextureParameteriv ((PFNGLGETTEXTUREPARAMETERIVPROC) Unsupported),
+      CreateVertexArrays ((PFNGLCREATEVERTEXARRAYSPROC) Unsupported),
+      DisableVertexArrayAttrib ((PFNGLDISABLEVERTEXARRAYATTRIBPROC) Unsupported),
+      EnableVertexArrayAttrib ((PFNGLENABLEVERTEXARRAYATTRIBPROC) Unsupported),
+      VertexArrayElementBuffer ((PFNGLVERTEXARRAYELEMENTBUFFERPROC) Unsupported),
+      VertexArrayVertexBuffer ((PFNGLVERTEXARRAYVERTEXBUFFERPROC) Unsupported),
+      VertexArrayVertexBuffers ((PFNGLVERTEXARRAYVERTEXBUFFERSPROC) Unsupported),
+      VertexArrayAttribBinding ((PFNGLVERTEXARRAYATTRIBBINDINGPROC) Unsupported),
+      VertexArrayAttribFormat ((PFNGLVERTEXARRAYATTRIBFORMATPROC) Unsupported),
+      VertexArrayAttribIFormat ((PFNGLVERTEXARRAYATTRIBIFORMATPROC) Unsupported),
+      VertexArrayAttribLFormat ((PFNGLVERTEXARRAYATTRIBLFORMATPROC) Unsupported),
+      VertexArrayBindingDivisor ((PFNGLVERTEXARRAYBINDINGDIVISORPROC) Unsupported),
+      GetVertexArrayiv ((PFNGLGETVERTEXARRAYIVPROC) Unsupported),
+      GetVertexArrayIndexediv ((PFNGLGETVERTEXARRAYINDEXEDIVPROC) Unsupported),
+      GetVertexArrayIndexed64iv ((PFNGLGETVERTEXARRAYINDEXED64IVPROC) Unsupported),
+      CreateSamplers ((PFNGLCREATESAMPLERSPROC) Unsupported),
+      CreateProgramPipelines ((PFNGLCREATEPROGRAMPIPELINESPROC) Unsupported),
+      CreateQueries ((PFNGLCREATEQUERIESPROC) Unsupported),
+      GetQueryBufferObjecti64v ((PFNGLGETQUERYBUFFEROBJECTI64VPROC) Unsupported),
+      GetQueryBufferObjectiv ((PFNGLGETQUERYBUFFEROBJECTIVPROC) Unsupported),
+      GetQueryBufferObjectui64v ((PFNGLGETQUERYBUFFEROBJECTUI64VPROC) Unsupported),
+      GetQueryBufferObjectuiv ((PFNGLGETQUERYBUFFEROBJECTUIVPROC) Unsupported),
+      MemoryBarrierByRegion ((PFNGLMEMORYBARRIERBYREGIONPROC) Unsupported),
+      GetTextureSubImage ((PFNGLGETTEXTURESUBIMAGEPROC) Unsupported),
+      GetCompressedTextureSubImage ((PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC) Unsupported),
+      GetGraphicsResetStatus ((PFNGLGETGRAPHICSRESETSTATUSPROC) Unsupported),
+      GetnCompressedTexImage ((PFNGLGETNCOMPRESSEDTEXIMAGEPROC) Unsupported),
+      GetnTexImage ((PFNGLGETNTEXIMAGEPROC) Unsupported),
+      GetnUniformdv ((PFNGLGETNUNIFORMDVPROC) Unsupported),
+      GetnUniformfv ((PFNGLGETNUNIFORMFVPROC) Unsupported),
+      GetnUniformiv ((PFNGLGETNUNIFORMIVPROC) Unsupported),
+      GetnUniformuiv ((PFNGLGETNUNIFORMUIVPROC) Unsupported),
+      ReadnPixels ((PFNGLREADNPIXELSPROC) Unsupported),
+      TextureBarrier ((PFNGLTEXTUREBARRIERPROC) Unsupported),
+      GetTextureHandleARB ((PFNGLGETTEXTUREHANDLEARBPROC) Unsupported),
+      GetTextureSamplerHandleARB ((PFNGLGETTEXTURESAMPLERHANDLEARBPROC) Unsupported),
+      MakeTextureHandleResidentARB ((PFNGLMAKETEXTUREHANDLERESIDENTARBPROC) Unsupported),
+      MakeTextureHandleNonResidentARB ((PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC) Unsupported),
+      GetImageHandleARB ((PFNGLGETIMAGEHANDLEARBPROC) Unsupported),
+      MakeImageHandleResidentARB ((PFNGLMAKEIMAGEHANDLERESIDENTARBPROC) Unsupported),
+      MakeImageHandleNonResidentARB ((PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC) Unsupported),
+      UniformHandleui64ARB ((PFNGLUNIFORMHANDLEUI64ARBPROC) Unsupported),
+      UniformHandleui64vARB ((PFNGLUNIFORMHANDLEUI64VARBPROC) Unsupported),
+      ProgramUniformHandleui64ARB ((PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC) Unsupported),
+      ProgramUniformHandleui64vARB ((PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC) Unsupported),
+      IsTextureHandleResidentARB ((PFNGLISTEXTUREHANDLERESIDENTARBPROC) Unsupported),
+      IsImageHandleResidentARB ((PFNGLISIMAGEHANDLERESIDENTARBPROC) Unsupported),
+      VertexAttribL1ui64ARB ((PFNGLVERTEXATTRIBL1UI64ARBPROC) Unsupported),
+      VertexAttribL1ui64vARB ((PFNGLVERTEXATTRIBL1UI64VARBPROC) Unsupported),
+      GetVertexAttribLui64vARB ((PFNGLGETVERTEXATTRIBLUI64VARBPROC) Unsupported),
+      CreateSyncFromCLeventARB ((PFNGLCREATESYNCFROMCLEVENTARBPROC) Unsupported),
+      DispatchComputeGroupSizeARB ((PFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC) Unsupported),
+      DebugMessageControlARB ((PFNGLDEBUGMESSAGECONTROLARBPROC) Unsupported),
+      DebugMessageInsertARB ((PFNGLDEBUGMESSAGEINSERTARBPROC) Unsupported),
+      DebugMessageCallbackARB ((PFNGLDEBUGMESSAGECALLBACKARBPROC) Unsupported),
+      GetDebugMessageLogARB ((PFNGLGETDEBUGMESSAGELOGARBPROC) Unsupported),
+      BlendEquationiARB ((PFNGLBLENDEQUATIONIARBPROC) Unsupported),
+      BlendEquationSeparateiARB ((PFNGLBLENDEQUATIONSEPARATEIARBPROC) Unsupported),
+      BlendFunciARB ((PFNGLBLENDFUNCIARBPROC) Unsupported),
+      BlendFuncSeparateiARB ((PFNGLBLENDFUNCSEPARATEIARBPROC) Unsupported),
+      MultiDrawArraysIndirectCountARB ((PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC) Unsupported),
+      MultiDrawElementsIndirectCountARB ((PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC) Unsupported),
+      GetGraphicsResetStatusARB ((PFNGLGETGRAPHICSRESETSTATUSARBPROC) Unsupported),
+      GetnTexImageARB ((PFNGLGETNTEXIMAGEARBPROC) Unsupported),
+      ReadnPixelsARB ((PFNGLREADNPIXELSARBPROC) Unsupported),
+      GetnCompressedTexImageARB ((PFNGLGETNCOMPRESSEDTEXIMAGEARBPROC) Unsupported),
+      GetnUniformfvARB ((PFNGLGETNUNIFORMFVARBPROC) Unsupported),
+      GetnUniformivARB ((PFNGLGETNUNIFORMIVARBPROC) Unsupported),
+      GetnUniformuivARB ((PFNGLGETNUNIFORMUIVARBPROC) Unsupported),
+      GetnUniformdvARB ((PFNGLGETNUNIFORMDVARBPROC) Unsupported),
+      MinSampleShadingARB ((PFNGLMINSAMPLESHADINGARBPROC) Unsupported),
+      NamedStringARB ((PFNGLNAMEDSTRINGARBPROC) Unsupported),
+      DeleteNamedStringARB ((PFNGLDELETENAMEDSTRINGARBPROC) Unsupported),
+      CompileShaderIncludeARB ((PFNGLCOMPILESHADERINCLUDEARBPROC) Unsupported),
+      IsNamedStringARB ((PFNGLISNAMEDSTRINGARBPROC) Unsupported),
+      GetNamedStringARB ((PFNGLGETNAMEDSTRINGARBPROC) Unsupported),
+      GetNamedStringivARB ((PFNGLGETNAMEDSTRINGIVARBPROC) Unsupported),
+      BufferPageCommitmentARB ((PFNGLBUFFERPAGECOMMITMENTARBPROC) Unsupported),
+      NamedBufferPageCommitmentEXT ((PFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC) Unsupported),
+      NamedBufferPageCommitmentARB ((PFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC) Unsupported),
+      TexPageCommitmentARB ((PFNGLTEXPAGECOMMITMENTARBPROC) Unsupported),
+      GetMultisamplefvNV ((PFNGLGETMULTISAMPLEFVNVPROC) Unsupported),
+      SampleMaskIndexedNV ((PFNGLSAMPLEMASKINDEXEDNVPROC) Unsupported),
+      TexRenderbufferNV ((PFNGLTEXRENDERBUFFERNVPROC) Unsupported),
+      MakeBufferResidentNV ((PFNGLMAKEBUFFERRESIDENTNVPROC) Unsupported),
+      MakeBufferNonResidentNV ((PFNGLMAKEBUFFERNONRESIDENTNVPROC) Unsupported),
+      IsBufferResidentNV ((PFNGLISBUFFERRESIDENTNVPROC) Unsupported),
+      MakeNamedBufferResidentNV ((PFNGLMAKENAMEDBUFFERRESIDENTNVPROC) Unsupported),
+      MakeNamedBufferNonResidentNV ((PFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC) Unsupported),
+      IsNamedBufferResidentNV ((PFNGLISNAMEDBUFFERRESIDENTNVPROC) Unsupported),
+      GetBufferParameterui64vNV ((PFNGLGETBUFFERPARAMETERUI64VNVPROC) Unsupported),
+      GetNamedBufferParameterui64vNV ((PFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC) Unsupported),
+      GetIntegerui64vNV ((PFNGLGETINTEGERUI64VNVPROC) Unsupported),
+      Uniformui64NV ((PFNGLUNIFORMUI64NVPROC) Unsupported),
+      Uniformui64vNV ((PFNGLUNIFORMUI64VNVPROC) Unsupported),
+      ProgramUniformui64NV ((PFNGLPROGRAMUNIFORMUI64NVPROC) Unsupported),
+      ProgramUniformui64vNV ((PFNGLPROGRAMUNIFORMUI64VNVPROC) Unsupported),
+      BufferAddressRangeNV ((PFNGLBUFFERADDRESSRANGENVPROC) Unsupported),
+      VertexFormatNV ((PFNGLVERTEXFORMATNVPROC) Unsupported),
+      NormalFormatNV ((PFNGLNORMALFORMATNVPROC) Unsupported),
+      ColorFormatNV ((PFNGLCOLORFORMATNVPROC) Unsupported),
+      IndexFormatNV ((PFNGLINDEXFORMATNVPROC) Unsupported),
+      TexCoordFormatNV ((PFNGLTEXCOORDFORMATNVPROC) Unsupported),
+      EdgeFlagFormatNV ((PFNGLEDGEFLAGFORMATNVPROC) Unsupported),
+      SecondaryColorFormatNV ((PFNGLSECONDARYCOLORFORMATNVPROC) Unsupported),
+      FogCoordFormatNV ((PFNGLFOGCOORDFORMATNVPROC) Unsupported),
+      VertexAttribFormatNV ((PFNGLVERTEXATTRIBFORMATNVPROC) Unsupported),
+      VertexAttribIFormatNV ((PFNGLVERTEXATTRIBIFORMATNVPROC) Unsupported),
+      GetIntegerui64i_vNV ((PFNGLGETINTEGERUI64I_VNVPROC) Unsupported),
+      EnableClientState ((PFNGLENABLECLIENTSTATEPROC) Unsupported),
+      DisableClientState ((PFNGLDISABLECLIENTSTATEPROC) Unsupported)
+{
+}
+
+#ifdef OGLP_DISPATCH_TABLE
+
+namespace internal {
+static DispatchTable defaultdispatch;
+thread_local DispatchTable *currentdispatch = &defaultdispatch;
+} /* namespace internal */
+
+void MakeCurrentDispatchTable (DispatchTable *table)
+{
+    internal::currentdispatch = table;
+}
+
+/* Entry points and the lazy callback live in the current table. */
+#define OGLP_ENTRY(name) (internal::currentdispatch->name)
+#define OGLP_GETPROCADDRESS (internal::currentdispatch->getprocaddress)
+
+#else /* !defined OGLP_DISPATCH_TABLE */
+
+#ifndef OGLP_DIRECT_LINK
 PFNGLCULLFACEPROC CullFace =
     (PFNGLCULLFACEPROC) Unsupported;
 PFNGLFRONTFACEPROC FrontFace =
@@ -1319,6 +2207,7 @@ PFNGLREADNPIXELSPROC ReadnPixels =
     (PFNGLREADNPIXELSPROC) Unsupported;
 PFNGLTEXTUREBARRIERPROC TextureBarrier =
     (PFNGLTEXTUREBARRIERPROC) Unsupported;
+#endif /* !defined OGLP_DIRECT_LINK */
 PFNGLGETTEXTUREHANDLEARBPROC GetTextureHandleARB =
     (PFNGLGETTEXTUREHANDLEARBPROC) Unsupported;
 PFNGLGETTEXTURESAMPLERHANDLEARBPROC GetTextureSamplerHandleARB =
@@ -1474,1477 +2363,9479 @@ PFNGLENABLECLIENTSTATEPROC EnableClientState =
 PFNGLDISABLECLIENTSTATEPROC DisableClientState =
     (PFNGLDISABLECLIENTSTATEPROC) Unsupported;
 
+namespace internal {
+static GetProcAddressCallback getprocaddress = NULL;
+} /* namespace internal */
 
-GLAPI int APIENTRY Unsupported (...)
+/* Entry points and the lazy callback are process-wide globals. */
+#define OGLP_ENTRY(name) name
+#define OGLP_GETPROCADDRESS (internal::getprocaddress)
+
+#endif /* !defined OGLP_DISPATCH_TABLE */
+
+namespace internal {
+
+/* Resolve an entry point with the callback
+ * passed to InitPrototypesLazy. */
+static void *LazyResolve (const char *name)
 {
-    throw std::runtime_error ("An unsupported OpenGL entry point was called.");
+    void *ptr = OGLP_GETPROCADDRESS (name);
+    return ptr ? ptr : (void *) Unsupported;
 }
 
-void InitPrototypes (GetProcAddressCallback getprocaddress)
+#ifndef OGLP_DIRECT_LINK
+
+static void APIENTRY Lazy_CullFace (GLenum mode)
 {
-    void *ptr;
+    OGLP_ENTRY (CullFace) = (PFNGLCULLFACEPROC) LazyResolve ("glCullFace");
+    return OGLP_ENTRY (CullFace) (mode);
+}
 
-    ptr = getprocaddress ("glCullFace");
-    if (ptr) CullFace = (PFNGLCULLFACEPROC) ptr;
-    ptr = getprocaddress ("glFrontFace");
-    if (ptr) FrontFace = (PFNGLFRONTFACEPROC) ptr;
-    ptr = getprocaddress ("glHint");
-    if (ptr) Hint = (PFNGLHINTPROC) ptr;
-    ptr = getprocaddress ("glLineWidth");
-    if (ptr) LineWidth = (PFNGLLINEWIDTHPROC) ptr;
-    ptr = getprocaddress ("glPointSize");
-    if (ptr) PointSize = (PFNGLPOINTSIZEPROC) ptr;
-    ptr = getprocaddress ("glPolygonMode");
-    if (ptr) PolygonMode = (PFNGLPOLYGONMODEPROC) ptr;
-    ptr = getprocaddress ("glScissor");
-    if (ptr) Scissor = (PFNGLSCISSORPROC) ptr;
-    ptr = getprocaddress ("glTexParameterf");
-    if (ptr) TexParameterf = (PFNGLTEXPARAMETERFPROC) ptr;
-    ptr = getprocaddress ("glTexParameterfv");
-    if (ptr) TexParameterfv = (PFNGLTEXPARAMETERFVPROC) ptr;
-    ptr = getprocaddress ("glTexParameteri");
-    if (ptr) TexParameteri = (PFNGLTEXPARAMETERIPROC) ptr;
-    ptr = getprocaddress ("glTexParameteriv");
-    if (ptr) TexParameteriv = (PFNGLTEXPARAMETERIVPROC) ptr;
-    ptr = getprocaddress ("glTexImage1D");
-    if (ptr) TexImage1D = (PFNGLTEXIMAGE1DPROC) ptr;
-    ptr = getprocaddress ("glTexImage2D");
-    if (ptr) TexImage2D = (PFNGLTEXIMAGE2DPROC) ptr;
-    ptr = getprocaddress ("glDrawBuffer");
-    if (ptr) DrawBuffer = (PFNGLDRAWBUFFERPROC) ptr;
-    ptr = getprocaddress ("glClear");
-    if (ptr) Clear = (PFNGLCLEARPROC) ptr;
-    ptr = getprocaddress ("glClearColor");
-    if (ptr) ClearColor = (PFNGLCLEARCOLORPROC) ptr;
-    ptr = getprocaddress ("glClearStencil");
-    if (ptr) ClearStencil = (PFNGLCLEARSTENCILPROC) ptr;
-    ptr = getprocaddress ("glClearDepth");
-    if (ptr) ClearDepth = (PFNGLCLEARDEPTHPROC) ptr;
-    ptr = getprocaddress ("glStencilMask");
-    if (ptr) StencilMask = (PFNGLSTENCILMASKPROC) ptr;
-    ptr = getprocaddress ("glColorMask");
-    if (ptr) ColorMask = (PFNGLCOLORMASKPROC) ptr;
-    ptr = getprocaddress ("glDepthMask");
-    if (ptr) DepthMask = (PFNGLDEPTHMASKPROC) ptr;
-    ptr = getprocaddress ("glDisable");
-    if (ptr) Disable = (PFNGLDISABLEPROC) ptr;
-    ptr = getprocaddress ("glEnable");
-    if (ptr) Enable = (PFNGLENABLEPROC) ptr;
-    ptr = getprocaddress ("glFinish");
-    if (ptr) Finish = (PFNGLFINISHPROC) ptr;
-    ptr = getprocaddress ("glFlush");
-    if (ptr) Flush = (PFNGLFLUSHPROC) ptr;
-    ptr = getprocaddress ("glBlendFunc");
-    if (ptr) BlendFunc = (PFNGLBLENDFUNCPROC) ptr;
-    ptr = getprocaddress ("glLogicOp");
-    if (ptr) LogicOp = (PFNGLLOGICOPPROC) ptr;
-    ptr = getprocaddress ("glStencilFunc");
-    if (ptr) StencilFunc = (PFNGLSTENCILFUNCPROC) ptr;
-    ptr = getprocaddress ("glStencilOp");
-    if (ptr) StencilOp = (PFNGLSTENCILOPPROC) ptr;
-    ptr = getprocaddress ("glDepthFunc");
-    if (ptr) DepthFunc = (PFNGLDEPTHFUNCPROC) ptr;
-    ptr = getprocaddress ("glPixelStoref");
-    if (ptr) PixelStoref = (PFNGLPIXELSTOREFPROC) ptr;
-    ptr = getprocaddress ("glPixelStorei");
-    if (ptr) PixelStorei = (PFNGLPIXELSTOREIPROC) ptr;
-    ptr = getprocaddress ("glReadBuffer");
-    if (ptr) ReadBuffer = (PFNGLREADBUFFERPROC) ptr;
-    ptr = getprocaddress ("glReadPixels");
-    if (ptr) ReadPixels = (PFNGLREADPIXELSPROC) ptr;
-    ptr = getprocaddress ("glGetBooleanv");
-    if (ptr) GetBooleanv = (PFNGLGETBOOLEANVPROC) ptr;
-    ptr = getprocaddress ("glGetDoublev");
-    if (ptr) GetDoublev = (PFNGLGETDOUBLEVPROC) ptr;
-    ptr = getprocaddress ("glGetError");
-    if (ptr) GetError = (PFNGLGETERRORPROC) ptr;
-    ptr = getprocaddress ("glGetFloatv");
-    if (ptr) GetFloatv = (PFNGLGETFLOATVPROC) ptr;
-    ptr = getprocaddress ("glGetIntegerv");
-    if (ptr) GetIntegerv = (PFNGLGETINTEGERVPROC) ptr;
-    ptr = getprocaddress ("glGetString");
-    if (ptr) GetString = (PFNGLGETSTRINGPROC) ptr;
-    ptr = getprocaddress ("glGetTexImage");
-    if (ptr) GetTexImage = (PFNGLGETTEXIMAGEPROC) ptr;
-    ptr = getprocaddress ("glGetTexParameterfv");
-    if (ptr) GetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC) ptr;
-    ptr = getprocaddress ("glGetTexParameteriv");
-    if (ptr) GetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC) ptr;
-    ptr = getprocaddress ("glGetTexLevelParameterfv");
-    if (ptr) GetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC) ptr;
-    ptr = getprocaddress ("glGetTexLevelParameteriv");
-    if (ptr) GetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC) ptr;
-    ptr = getprocaddress ("glIsEnabled");
-    if (ptr) IsEnabled = (PFNGLISENABLEDPROC) ptr;
-    ptr = getprocaddress ("glDepthRange");
-    if (ptr) DepthRange = (PFNGLDEPTHRANGEPROC) ptr;
-    ptr = getprocaddress ("glViewport");
-    if (ptr) Viewport = (PFNGLVIEWPORTPROC) ptr;
-    ptr = getprocaddress ("glDrawArrays");
-    if (ptr) DrawArrays = (PFNGLDRAWARRAYSPROC) ptr;
-    ptr = getprocaddress ("glDrawElements");
-    if (ptr) DrawElements = (PFNGLDRAWELEMENTSPROC) ptr;
-    ptr = getprocaddress ("glGetPointerv");
-    if (ptr) GetPointerv = (PFNGLGETPOINTERVPROC) ptr;
-    ptr = getprocaddress ("glPolygonOffset");
-    if (ptr) PolygonOffset = (PFNGLPOLYGONOFFSETPROC) ptr;
-    ptr = getprocaddress ("glCopyTexImage1D");
-    if (ptr) CopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC) ptr;
-    ptr = getprocaddress ("glCopyTexImage2D");
-    if (ptr) CopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC) ptr;
-    ptr = getprocaddress ("glCopyTexSubImage1D");
-    if (ptr) CopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC) ptr;
-    ptr = getprocaddress ("glCopyTexSubImage2D");
-    if (ptr) CopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC) ptr;
-    ptr = getprocaddress ("glTexSubImage1D");
-    if (ptr) TexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC) ptr;
-    ptr = getprocaddress ("glTexSubImage2D");
-    if (ptr) TexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC) ptr;
-    ptr = getprocaddress ("glBindTexture");
-    if (ptr) BindTexture = (PFNGLBINDTEXTUREPROC) ptr;
-    ptr = getprocaddress ("glDeleteTextures");
-    if (ptr) DeleteTextures = (PFNGLDELETETEXTURESPROC) ptr;
-    ptr = getprocaddress ("glGenTextures");
-    if (ptr) GenTextures = (PFNGLGENTEXTURESPROC) ptr;
-    ptr = getprocaddress ("glIsTexture");
-    if (ptr) IsTexture = (PFNGLISTEXTUREPROC) ptr;
-    ptr = getprocaddress ("glDrawRangeElements");
-    if (ptr) DrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC) ptr;
-    ptr = getprocaddress ("glTexImage3D");
-    if (ptr) TexImage3D = (PFNGLTEXIMAGE3DPROC) ptr;
-    ptr = getprocaddress ("glTexSubImage3D");
-    if (ptr) TexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC) ptr;
-    ptr = getprocaddress ("glCopyTexSubImage3D");
-    if (ptr) CopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC) ptr;
-    ptr = getprocaddress ("glActiveTexture");
-    if (ptr) ActiveTexture = (PFNGLACTIVETEXTUREPROC) ptr;
-    ptr = getprocaddress ("glSampleCoverage");
-    if (ptr) SampleCoverage = (PFNGLSAMPLECOVERAGEPROC) ptr;
-    ptr = getprocaddress ("glCompressedTexImage3D");
-    if (ptr) CompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC) ptr;
-    ptr = getprocaddress ("glCompressedTexImage2D");
-    if (ptr) CompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC) ptr;
-    ptr = getprocaddress ("glCompressedTexImage1D");
-    if (ptr) CompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC) ptr;
-    ptr = getprocaddress ("glCompressedTexSubImage3D");
-    if (ptr) CompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC) ptr;
-    ptr = getprocaddress ("glCompressedTexSubImage2D");
-    if (ptr) CompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC) ptr;
-    ptr = getprocaddress ("glCompressedTexSubImage1D");
-    if (ptr) CompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC) ptr;
-    ptr = getprocaddress ("glGetCompressedTexImage");
-    if (ptr) GetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC) ptr;
-    ptr = getprocaddress ("glBlendFuncSeparate");
-    if (ptr) BlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC) ptr;
-    ptr = getprocaddress ("glMultiDrawArrays");
-    if (ptr) MultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC) ptr;
-    ptr = getprocaddress ("glMultiDrawElements");
-    if (ptr) MultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC) ptr;
-    ptr = getprocaddress ("glPointParameterf");
-    if (ptr) PointParameterf = (PFNGLPOINTPARAMETERFPROC) ptr;
-    ptr = getprocaddress ("glPointParameterfv");
-    if (ptr) PointParameterfv = (PFNGLPOINTPARAMETERFVPROC) ptr;
-    ptr = getprocaddress ("glPointParameteri");
-    if (ptr) PointParameteri = (PFNGLPOINTPARAMETERIPROC) ptr;
-    ptr = getprocaddress ("glPointParameteriv");
-    if (ptr) PointParameteriv = (PFNGLPOINTPARAMETERIVPROC) ptr;
-    ptr = getprocaddress ("glBlendColor");
-    if (ptr) BlendColor = (PFNGLBLENDCOLORPROC) ptr;
-    ptr = getprocaddress ("glBlendEquation");
-    if (ptr) BlendEquation = (PFNGLBLENDEQUATIONPROC) ptr;
-    ptr = getprocaddress ("glGenQueries");
-    if (ptr) GenQueries = (PFNGLGENQUERIESPROC) ptr;
-    ptr = getprocaddress ("glDeleteQueries");
-    if (ptr) DeleteQueries = (PFNGLDELETEQUERIESPROC) ptr;
-    ptr = getprocaddress ("glIsQuery");
-    if (ptr) IsQuery = (PFNGLISQUERYPROC) ptr;
-    ptr = getprocaddress ("glBeginQuery");
-    if (ptr) BeginQuery = (PFNGLBEGINQUERYPROC) ptr;
-    ptr = getprocaddress ("glEndQuery");
-    if (ptr) EndQuery = (PFNGLENDQUERYPROC) ptr;
-    ptr = getprocaddress ("glGetQueryiv");
-    if (ptr) GetQueryiv = (PFNGLGETQUERYIVPROC) ptr;
-    ptr = getprocaddress ("glGetQueryObjectiv");
-    if (ptr) GetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC) ptr;
-    ptr = getprocaddress ("glGetQueryObjectuiv");
-    if (ptr) GetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC) ptr;
-    ptr = getprocaddress ("glBindBuffer");
-    if (ptr) BindBuffer = (PFNGLBINDBUFFERPROC) ptr;
-    ptr = getprocaddress ("glDeleteBuffers");
-    if (ptr) DeleteBuffers = (PFNGLDELETEBUFFERSPROC) ptr;
-    ptr = getprocaddress ("glGenBuffers");
-    if (ptr) GenBuffers = (PFNGLGENBUFFERSPROC) ptr;
-    ptr = getprocaddress ("glIsBuffer");
-    if (ptr) IsBuffer = (PFNGLISBUFFERPROC) ptr;
-    ptr = getprocaddress ("glBufferData");
-    if (ptr) BufferData = (PFNGLBUFFERDATAPROC) ptr;
-    ptr = getprocaddress ("glBufferSubData");
-    if (ptr) BufferSubData = (PFNGLBUFFERSUBDATAPROC) ptr;
-    ptr = getprocaddress ("glGetBufferSubData");
-    if (ptr) GetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC) ptr;
-    ptr = getprocaddress ("glMapBuffer");
-    if (ptr) MapBuffer = (PFNGLMAPBUFFERPROC) ptr;
-    ptr = getprocaddress ("glUnmapBuffer");
-    if (ptr) UnmapBuffer = (PFNGLUNMAPBUFFERPROC) ptr;
-    ptr = getprocaddress ("glGetBufferParameteriv");
-    if (ptr) GetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC) ptr;
-    ptr = getprocaddress ("glGetBufferPointerv");
-    if (ptr) GetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC) ptr;
-    ptr = getprocaddress ("glBlendEquationSeparate");
-    if (ptr) BlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC) ptr;
-    ptr = getprocaddress ("glDrawBuffers");
-    if (ptr) DrawBuffers = (PFNGLDRAWBUFFERSPROC) ptr;
-    ptr = getprocaddress ("glStencilOpSeparate");
-    if (ptr) StencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC) ptr;
-    ptr = getprocaddress ("glStencilFuncSeparate");
-    if (ptr) StencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC) ptr;
-    ptr = getprocaddress ("glStencilMaskSeparate");
-    if (ptr) StencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC) ptr;
-    ptr = getprocaddress ("glAttachShader");
-    if (ptr) AttachShader = (PFNGLATTACHSHADERPROC) ptr;
-    ptr = getprocaddress ("glBindAttribLocation");
-    if (ptr) BindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC) ptr;
-    ptr = getprocaddress ("glCompileShader");
-    if (ptr) CompileShader = (PFNGLCOMPILESHADERPROC) ptr;
-    ptr = getprocaddress ("glCreateProgram");
-    if (ptr) CreateProgram = (PFNGLCREATEPROGRAMPROC) ptr;
-    ptr = getprocaddress ("glCreateShader");
-    if (ptr) CreateShader = (PFNGLCREATESHADERPROC) ptr;
-    ptr = getprocaddress ("glDeleteProgram");
-    if (ptr) DeleteProgram = (PFNGLDELETEPROGRAMPROC) ptr;
-    ptr = getprocaddress ("glDeleteShader");
-    if (ptr) DeleteShader = (PFNGLDELETESHADERPROC) ptr;
-    ptr = getprocaddress ("glDetachShader");
-    if (ptr) DetachShader = (PFNGLDETACHSHADERPROC) ptr;
-    ptr = getprocaddress ("glDisableVertexAttribArray");
-    if (ptr) DisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC) ptr;
-    ptr = getprocaddress ("glEnableVertexAttribArray");
-    if (ptr) EnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC) ptr;
-    ptr = getprocaddress ("glGetActiveAttrib");
-    if (ptr) GetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC) ptr;
-    ptr = getprocaddress ("glGetActiveUniform");
-    if (ptr) GetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC) ptr;
-    ptr = getprocaddress ("glGetAttachedShaders");
-    if (ptr) GetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC) ptr;
-    ptr = getprocaddress ("glGetAttribLocation");
-    if (ptr) GetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC) ptr;
-    ptr = getprocaddress ("glGetProgramiv");
-    if (ptr) GetProgramiv = (PFNGLGETPROGRAMIVPROC) ptr;
-    ptr = getprocaddress ("glGetProgramInfoLog");
-    if (ptr) GetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC) ptr;
-    ptr = getprocaddress ("glGetShaderiv");
-    if (ptr) GetShaderiv = (PFNGLGETSHADERIVPROC) ptr;
-    ptr = getprocaddress ("glGetShaderInfoLog");
-    if (ptr) GetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC) ptr;
-    ptr = getprocaddress ("glGetShaderSource");
-    if (ptr) GetShaderSource = (PFNGLGETSHADERSOURCEPROC) ptr;
-    ptr = getprocaddress ("glGetUniformLocation");
-    if (ptr) GetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC) ptr;
-    ptr = getprocaddress ("glGetUniformfv");
-    if (ptr) GetUniformfv = (PFNGLGETUNIFORMFVPROC) ptr;
-    ptr = getprocaddress ("glGetUniformiv");
-    if (ptr) GetUniformiv = (PFNGLGETUNIFORMIVPROC) ptr;
-    ptr = getprocaddress ("glGetVertexAttribdv");
-    if (ptr) GetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC) ptr;
-    ptr = getprocaddress ("glGetVertexAttribfv");
-    if (ptr) GetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC) ptr;
-    ptr = getprocaddress ("glGetVertexAttribiv");
-    if (ptr) GetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC) ptr;
-    ptr = getprocaddress ("glGetVertexAttribPointerv");
-    if (ptr) GetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC) ptr;
-    ptr = getprocaddress ("glIsProgram");
-    if (ptr) IsProgram = (PFNGLISPROGRAMPROC) ptr;
-    ptr = getprocaddress ("glIsShader");
-    if (ptr) IsShader = (PFNGLISSHADERPROC) ptr;
-    ptr = getprocaddress ("glLinkProgram");
-    if (ptr) LinkProgram = (PFNGLLINKPROGRAMPROC) ptr;
-    ptr = getprocaddress ("glShaderSource");
-    if (ptr) ShaderSource = (PFNGLSHADERSOURCEPROC) ptr;
-    ptr = getprocaddress ("glUseProgram");
-    if (ptr) UseProgram = (PFNGLUSEPROGRAMPROC) ptr;
-    ptr = getprocaddress ("glUniform1f");
-    if (ptr) Uniform1f = (PFNGLUNIFORM1FPROC) ptr;
-    ptr = getprocaddress ("glUniform2f");
-    if (ptr) Uniform2f = (PFNGLUNIFORM2FPROC) ptr;
-    ptr = getprocaddress ("glUniform3f");
-    if (ptr) Uniform3f = (PFNGLUNIFORM3FPROC) ptr;
-    ptr = getprocaddress ("glUniform4f");
-    if (ptr) Uniform4f = (PFNGLUNIFORM4FPROC) ptr;
-    ptr = getprocaddress ("glUniform1i");
-    if (ptr) Uniform1i = (PFNGLUNIFORM1IPROC) ptr;
-    ptr = getprocaddress ("glUniform2i");
-    if (ptr) Uniform2i = (PFNGLUNIFORM2IPROC) ptr;
-    ptr = getprocaddress ("glUniform3i");
-    if (ptr) Uniform3i = (PFNGLUNIFORM3IPROC) ptr;
-    ptr = getprocaddress ("glUniform4i");
-    if (ptr) Uniform4i = (PFNGLUNIFORM4IPROC) ptr;
-    ptr = getprocaddress ("glUniform1fv");
-    if (ptr) Uniform1fv = (PFNGLUNIFORM1FVPROC) ptr;
-    ptr = getprocaddress ("glUniform2fv");
-    if (ptr) Uniform2fv = (PFNGLUNIFORM2FVPROC) ptr;
-    ptr = getprocaddress ("glUniform3fv");
-    if (ptr) Uniform3fv = (PFNGLUNIFORM3FVPROC) ptr;
-    ptr = getprocaddress ("glUniform4fv");
-    if (ptr) Uniform4fv = (PFNGLUNIFORM4FVPROC) ptr;
-    ptr = getprocaddress ("glUniform1iv");
-    if (ptr) Uniform1iv = (PFNGLUNIFORM1IVPROC) ptr;
-    ptr = getprocaddress ("glUniform2iv");
-    if (ptr) Uniform2iv = (PFNGLUNIFORM2IVPROC) ptr;
-    ptr = getprocaddress ("glUniform3iv");
-    if (ptr) Uniform3iv = (PFNGLUNIFORM3IVPROC) ptr;
-    ptr = getprocaddress ("glUniform4iv");
-    if (ptr) Uniform4iv = (PFNGLUNIFORM4IVPROC) ptr;
-    ptr = getprocaddress ("glUniformMatrix2fv");
-    if (ptr) UniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC) ptr;
-    ptr = getprocaddress ("glUniformMatrix3fv");
-    if (ptr) UniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC) ptr;
-    ptr = getprocaddress ("glUniformMatrix4fv");
-    if (ptr) UniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC) ptr;
-    ptr = getprocaddress ("glValidateProgram");
-    if (ptr) ValidateProgram = (PFNGLVALIDATEPROGRAMPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib1d");
-    if (ptr) VertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib1dv");
-    if (ptr) VertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib1f");
-    if (ptr) VertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib1fv");
-    if (ptr) VertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib1s");
-    if (ptr) VertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib1sv");
-    if (ptr) VertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib2d");
-    if (ptr) VertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib2dv");
-    if (ptr) VertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib2f");
-    if (ptr) VertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib2fv");
-    if (ptr) VertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib2s");
-    if (ptr) VertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib2sv");
-    if (ptr) VertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib3d");
-    if (ptr) VertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib3dv");
-    if (ptr) VertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib3f");
-    if (ptr) VertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib3fv");
-    if (ptr) VertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib3s");
-    if (ptr) VertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib3sv");
-    if (ptr) VertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib4Nbv");
-    if (ptr) VertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib4Niv");
-    if (ptr) VertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib4Nsv");
-    if (ptr) VertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib4Nub");
-    if (ptr) VertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib4Nubv");
-    if (ptr) VertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib4Nuiv");
-    if (ptr) VertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib4Nusv");
-    if (ptr) VertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib4bv");
-    if (ptr) VertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib4d");
-    if (ptr) VertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib4dv");
-    if (ptr) VertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib4f");
-    if (ptr) VertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib4fv");
-    if (ptr) VertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib4iv");
-    if (ptr) VertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib4s");
-    if (ptr) VertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib4sv");
-    if (ptr) VertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib4ubv");
-    if (ptr) VertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib4uiv");
-    if (ptr) VertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC) ptr;
-    ptr = getprocaddress ("glVertexAttrib4usv");
-    if (ptr) VertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC) ptr;
-    ptr = getprocaddress ("glVertexAttribPointer");
-    if (ptr) VertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC) ptr;
-    ptr = getprocaddress ("glUniformMatrix2x3fv");
-    if (ptr) UniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC) ptr;
-    ptr = getprocaddress ("glUniformMatrix3x2fv");
-    if (ptr) UniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC) ptr;
-    ptr = getprocaddress ("glUniformMatrix2x4fv");
-    if (ptr) UniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC) ptr;
-    ptr = getprocaddress ("glUniformMatrix4x2fv");
-    if (ptr) UniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC) ptr;
-    ptr = getprocaddress ("glUniformMatrix3x4fv");
-    if (ptr) UniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC) ptr;
-    ptr = getprocaddress ("glUniformMatrix4x3fv");
-    if (ptr) UniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC) ptr;
-    ptr = getprocaddress ("glColorMaski");
-    if (ptr) ColorMaski = (PFNGLCOLORMASKIPROC) ptr;
-    ptr = getprocaddress ("glGetBooleani_v");
-    if (ptr) GetBooleani_v = (PFNGLGETBOOLEANI_VPROC) ptr;
-    ptr = getprocaddress ("glGetIntegeri_v");
-    if (ptr) GetIntegeri_v = (PFNGLGETINTEGERI_VPROC) ptr;
-    ptr = getprocaddress ("glEnablei");
-    if (ptr) Enablei = (PFNGLENABLEIPROC) ptr;
-    ptr = getprocaddress ("glDisablei");
-    if (ptr) Disablei = (PFNGLDISABLEIPROC) ptr;
-    ptr = getprocaddress ("glIsEnabledi");
-    if (ptr) IsEnabledi = (PFNGLISENABLEDIPROC) ptr;
-    ptr = getprocaddress ("glBeginTransformFeedback");
-    if (ptr) BeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC) ptr;
-    ptr = getprocaddress ("glEndTransformFeedback");
-    if (ptr) EndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC) ptr;
-    ptr = getprocaddress ("glBindBufferRange");
-    if (ptr) BindBufferRange = (PFNGLBINDBUFFERRANGEPROC) ptr;
-    ptr = getprocaddress ("glBindBufferBase");
-    if (ptr) BindBufferBase = (PFNGLBINDBUFFERBASEPROC) ptr;
-    ptr = getprocaddress ("glTransformFeedbackVaryings");
-    if (ptr) TransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC) ptr;
-    ptr = getprocaddress ("glGetTransformFeedbackVarying");
-    if (ptr) GetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC) ptr;
-    ptr = getprocaddress ("glClampColor");
-    if (ptr) ClampColor = (PFNGLCLAMPCOLORPROC) ptr;
-    ptr = getprocaddress ("glBeginConditionalRender");
-    if (ptr) BeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC) ptr;
-    ptr = getprocaddress ("glEndConditionalRender");
-    if (ptr) EndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC) ptr;
-    ptr = getprocaddress ("glVertexAttribIPointer");
-    if (ptr) VertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC) ptr;
-    ptr = getprocaddress ("glGetVertexAttribIiv");
-    if (ptr) GetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC) ptr;
-    ptr = getprocaddress ("glGetVertexAttribIuiv");
-    if (ptr) GetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC) ptr;
-    ptr = getprocaddress ("glVertexAttribI1i");
-    if (ptr) VertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC) ptr;
-    ptr = getprocaddress ("glVertexAttribI2i");
-    if (ptr) VertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC) ptr;
-    ptr = getprocaddress ("glVertexAttribI3i");
-    if (ptr) VertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC) ptr;
-    ptr = getprocaddress ("glVertexAttribI4i");
-    if (ptr) VertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC) ptr;
-    ptr = getprocaddress ("glVertexAttribI1ui");
-    if (ptr) VertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC) ptr;
-    ptr = getprocaddress ("glVertexAttribI2ui");
-    if (ptr) VertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC) ptr;
-    ptr = getprocaddress ("glVertexAttribI3ui");
-    if (ptr) VertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC) ptr;
-    ptr = getprocaddress ("glVertexAttribI4ui");
-    if (ptr) VertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC) ptr;
-    ptr = getprocaddress ("glVertexAttribI1iv");
-    if (ptr) VertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC) ptr;
-    ptr = getprocaddress ("glVertexAttribI2iv");
-    if (ptr) VertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC) ptr;
-    ptr = getprocaddress ("glVertexAttribI3iv");
-    if (ptr) VertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC) ptr;
+static void APIENTRY Lazy_FrontFace (GLenum mode)
+{
+    OGLP_ENTRY (FrontFace) = (PFNGLFRONTFACEPROC) LazyResolve ("glFrontFace");
+    return OGLP_ENTRY (FrontFace) (mode);
+}
+
+static void APIENTRY Lazy_Hint (GLenum target, GLenum mode)
+{
+    OGLP_ENTRY (Hint) = (PFNGLHINTPROC) LazyResolve ("glHint");
+    return OGLP_ENTRY (Hint) (target, mode);
+}
+
+static void APIENTRY Lazy_LineWidth (GLfloat width)
+{
+    OGLP_ENTRY (LineWidth) = (PFNGLLINEWIDTHPROC) LazyResolve ("glLineWidth");
+    return OGLP_ENTRY (LineWidth) (width);
+}
+
+static void APIENTRY Lazy_PointSize (GLfloat size)
+{
+    OGLP_ENTRY (PointSize) = (PFNGLPOINTSIZEPROC) LazyResolve ("glPointSize");
+    return OGLP_ENTRY (PointSize) (size);
+}
+
+static void APIENTRY Lazy_PolygonMode (GLenum face, GLenum mode)
+{
+    OGLP_ENTRY (PolygonMode) = (PFNGLPOLYGONMODEPROC) LazyResolve ("glPolygonMode");
+    return OGLP_ENTRY (PolygonMode) (face, mode);
+}
+
+static void APIENTRY Lazy_Scissor (GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    OGLP_ENTRY (Scissor) = (PFNGLSCISSORPROC) LazyResolve ("glScissor");
+    return OGLP_ENTRY (Scissor) (x, y, width, height);
+}
+
+static void APIENTRY Lazy_TexParameterf (GLenum target, GLenum pname, GLfloat param)
+{
+    OGLP_ENTRY (TexParameterf) = (PFNGLTEXPARAMETERFPROC) LazyResolve ("glTexParameterf");
+    return OGLP_ENTRY (TexParameterf) (target, pname, param);
+}
+
+static void APIENTRY Lazy_TexParameterfv (GLenum target, GLenum pname, const GLfloat *params)
+{
+    OGLP_ENTRY (TexParameterfv) = (PFNGLTEXPARAMETERFVPROC) LazyResolve ("glTexParameterfv");
+    return OGLP_ENTRY (TexParameterfv) (target, pname, params);
+}
+
+static void APIENTRY Lazy_TexParameteri (GLenum target, GLenum pname, GLint param)
+{
+    OGLP_ENTRY (TexParameteri) = (PFNGLTEXPARAMETERIPROC) LazyResolve ("glTexParameteri");
+    return OGLP_ENTRY (TexParameteri) (target, pname, param);
+}
+
+static void APIENTRY Lazy_TexParameteriv (GLenum target, GLenum pname, const GLint *params)
+{
+    OGLP_ENTRY (TexParameteriv) = (PFNGLTEXPARAMETERIVPROC) LazyResolve ("glTexParameteriv");
+    return OGLP_ENTRY (TexParameteriv) (target, pname, params);
+}
+
+static void APIENTRY Lazy_TexImage1D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    OGLP_ENTRY (TexImage1D) = (PFNGLTEXIMAGE1DPROC) LazyResolve ("glTexImage1D");
+    return OGLP_ENTRY (TexImage1D) (target, level, internalformat, width, border, format, type, pixels);
+}
+
+static void APIENTRY Lazy_TexImage2D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    OGLP_ENTRY (TexImage2D) = (PFNGLTEXIMAGE2DPROC) LazyResolve ("glTexImage2D");
+    return OGLP_ENTRY (TexImage2D) (target, level, internalformat, width, height, border, format, type, pixels);
+}
+
+static void APIENTRY Lazy_DrawBuffer (GLenum buf)
+{
+    OGLP_ENTRY (DrawBuffer) = (PFNGLDRAWBUFFERPROC) LazyResolve ("glDrawBuffer");
+    return OGLP_ENTRY (DrawBuffer) (buf);
+}
+
+static void APIENTRY Lazy_Clear (GLbitfield mask)
+{
+    OGLP_ENTRY (Clear) = (PFNGLCLEARPROC) LazyResolve ("glClear");
+    return OGLP_ENTRY (Clear) (mask);
+}
+
+static void APIENTRY Lazy_ClearColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    OGLP_ENTRY (ClearColor) = (PFNGLCLEARCOLORPROC) LazyResolve ("glClearColor");
+    return OGLP_ENTRY (ClearColor) (red, green, blue, alpha);
+}
+
+static void APIENTRY Lazy_ClearStencil (GLint s)
+{
+    OGLP_ENTRY (ClearStencil) = (PFNGLCLEARSTENCILPROC) LazyResolve ("glClearStencil");
+    return OGLP_ENTRY (ClearStencil) (s);
+}
+
+static void APIENTRY Lazy_ClearDepth (GLdouble depth)
+{
+    OGLP_ENTRY (ClearDepth) = (PFNGLCLEARDEPTHPROC) LazyResolve ("glClearDepth");
+    return OGLP_ENTRY (ClearDepth) (depth);
+}
+
+static void APIENTRY Lazy_StencilMask (GLuint mask)
+{
+    OGLP_ENTRY (StencilMask) = (PFNGLSTENCILMASKPROC) LazyResolve ("glStencilMask");
+    return OGLP_ENTRY (StencilMask) (mask);
+}
+
+static void APIENTRY Lazy_ColorMask (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+    OGLP_ENTRY (ColorMask) = (PFNGLCOLORMASKPROC) LazyResolve ("glColorMask");
+    return OGLP_ENTRY (ColorMask) (red, green, blue, alpha);
+}
+
+static void APIENTRY Lazy_DepthMask (GLboolean flag)
+{
+    OGLP_ENTRY (DepthMask) = (PFNGLDEPTHMASKPROC) LazyResolve ("glDepthMask");
+    return OGLP_ENTRY (DepthMask) (flag);
+}
+
+static void APIENTRY Lazy_Disable (GLenum cap)
+{
+    OGLP_ENTRY (Disable) = (PFNGLDISABLEPROC) LazyResolve ("glDisable");
+    return OGLP_ENTRY (Disable) (cap);
+}
+
+static void APIENTRY Lazy_Enable (GLenum cap)
+{
+    OGLP_ENTRY (Enable) = (PFNGLENABLEPROC) LazyResolve ("glEnable");
+    return OGLP_ENTRY (Enable) (cap);
+}
+
+static void APIENTRY Lazy_Finish (void)
+{
+    OGLP_ENTRY (Finish) = (PFNGLFINISHPROC) LazyResolve ("glFinish");
+    return OGLP_ENTRY (Finish) ();
+}
+
+static void APIENTRY Lazy_Flush (void)
+{
+    OGLP_ENTRY (Flush) = (PFNGLFLUSHPROC) LazyResolve ("glFlush");
+    return OGLP_ENTRY (Flush) ();
+}
+
+static void APIENTRY Lazy_BlendFunc (GLenum sfactor, GLenum dfactor)
+{
+    OGLP_ENTRY (BlendFunc) = (PFNGLBLENDFUNCPROC) LazyResolve ("glBlendFunc");
+    return OGLP_ENTRY (BlendFunc) (sfactor, dfactor);
+}
+
+static void APIENTRY Lazy_LogicOp (GLenum opcode)
+{
+    OGLP_ENTRY (LogicOp) = (PFNGLLOGICOPPROC) LazyResolve ("glLogicOp");
+    return OGLP_ENTRY (LogicOp) (opcode);
+}
+
+static void APIENTRY Lazy_StencilFunc (GLenum func, GLint ref, GLuint mask)
+{
+    OGLP_ENTRY (StencilFunc) = (PFNGLSTENCILFUNCPROC) LazyResolve ("glStencilFunc");
+    return OGLP_ENTRY (StencilFunc) (func, ref, mask);
+}
+
+static void APIENTRY Lazy_StencilOp (GLenum fail, GLenum zfail, GLenum zpass)
+{
+    OGLP_ENTRY (StencilOp) = (PFNGLSTENCILOPPROC) LazyResolve ("glStencilOp");
+    return OGLP_ENTRY (StencilOp) (fail, zfail, zpass);
+}
+
+static void APIENTRY Lazy_DepthFunc (GLenum func)
+{
+    OGLP_ENTRY (DepthFunc) = (PFNGLDEPTHFUNCPROC) LazyResolve ("glDepthFunc");
+    return OGLP_ENTRY (DepthFunc) (func);
+}
+
+static void APIENTRY Lazy_PixelStoref (GLenum pname, GLfloat param)
+{
+    OGLP_ENTRY (PixelStoref) = (PFNGLPIXELSTOREFPROC) LazyResolve ("glPixelStoref");
+    return OGLP_ENTRY (PixelStoref) (pname, param);
+}
+
+static void APIENTRY Lazy_PixelStorei (GLenum pname, GLint param)
+{
+    OGLP_ENTRY (PixelStorei) = (PFNGLPIXELSTOREIPROC) LazyResolve ("glPixelStorei");
+    return OGLP_ENTRY (PixelStorei) (pname, param);
+}
+
+static void APIENTRY Lazy_ReadBuffer (GLenum src)
+{
+    OGLP_ENTRY (ReadBuffer) = (PFNGLREADBUFFERPROC) LazyResolve ("glReadBuffer");
+    return OGLP_ENTRY (ReadBuffer) (src);
+}
+
+static void APIENTRY Lazy_ReadPixels (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels)
+{
+    OGLP_ENTRY (ReadPixels) = (PFNGLREADPIXELSPROC) LazyResolve ("glReadPixels");
+    return OGLP_ENTRY (ReadPixels) (x, y, width, height, format, type, pixels);
+}
+
+static void APIENTRY Lazy_GetBooleanv (GLenum pname, GLboolean *data)
+{
+    OGLP_ENTRY (GetBooleanv) = (PFNGLGETBOOLEANVPROC) LazyResolve ("glGetBooleanv");
+    return OGLP_ENTRY (GetBooleanv) (pname, data);
+}
+
+static void APIENTRY Lazy_GetDoublev (GLenum pname, GLdouble *data)
+{
+    OGLP_ENTRY (GetDoublev) = (PFNGLGETDOUBLEVPROC) LazyResolve ("glGetDoublev");
+    return OGLP_ENTRY (GetDoublev) (pname, data);
+}
+
+static GLenum APIENTRY Lazy_GetError (void)
+{
+    OGLP_ENTRY (GetError) = (PFNGLGETERRORPROC) LazyResolve ("glGetError");
+    return OGLP_ENTRY (GetError) ();
+}
+
+static void APIENTRY Lazy_GetFloatv (GLenum pname, GLfloat *data)
+{
+    OGLP_ENTRY (GetFloatv) = (PFNGLGETFLOATVPROC) LazyResolve ("glGetFloatv");
+    return OGLP_ENTRY (GetFloatv) (pname, data);
+}
+
+static void APIENTRY Lazy_GetIntegerv (GLenum pname, GLint *data)
+{
+    OGLP_ENTRY (GetIntegerv) = (PFNGLGETINTEGERVPROC) LazyResolve ("glGetIntegerv");
+    return OGLP_ENTRY (GetIntegerv) (pname, data);
+}
+
+static const GLubyte * APIENTRY Lazy_GetString (GLenum name)
+{
+    OGLP_ENTRY (GetString) = (PFNGLGETSTRINGPROC) LazyResolve ("glGetString");
+    return OGLP_ENTRY (GetString) (name);
+}
+
+static void APIENTRY Lazy_GetTexImage (GLenum target, GLint level, GLenum format, GLenum type, void *pixels)
+{
+    OGLP_ENTRY (GetTexImage) = (PFNGLGETTEXIMAGEPROC) LazyResolve ("glGetTexImage");
+    return OGLP_ENTRY (GetTexImage) (target, level, format, type, pixels);
+}
+
+static void APIENTRY Lazy_GetTexParameterfv (GLenum target, GLenum pname, GLfloat *params)
+{
+    OGLP_ENTRY (GetTexParameterfv) = (PFNGLGETTEXPARAMETERFVPROC) LazyResolve ("glGetTexParameterfv");
+    return OGLP_ENTRY (GetTexParameterfv) (target, pname, params);
+}
+
+static void APIENTRY Lazy_GetTexParameteriv (GLenum target, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetTexParameteriv) = (PFNGLGETTEXPARAMETERIVPROC) LazyResolve ("glGetTexParameteriv");
+    return OGLP_ENTRY (GetTexParameteriv) (target, pname, params);
+}
+
+static void APIENTRY Lazy_GetTexLevelParameterfv (GLenum target, GLint level, GLenum pname, GLfloat *params)
+{
+    OGLP_ENTRY (GetTexLevelParameterfv) = (PFNGLGETTEXLEVELPARAMETERFVPROC) LazyResolve ("glGetTexLevelParameterfv");
+    return OGLP_ENTRY (GetTexLevelParameterfv) (target, level, pname, params);
+}
+
+static void APIENTRY Lazy_GetTexLevelParameteriv (GLenum target, GLint level, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetTexLevelParameteriv) = (PFNGLGETTEXLEVELPARAMETERIVPROC) LazyResolve ("glGetTexLevelParameteriv");
+    return OGLP_ENTRY (GetTexLevelParameteriv) (target, level, pname, params);
+}
+
+static GLboolean APIENTRY Lazy_IsEnabled (GLenum cap)
+{
+    OGLP_ENTRY (IsEnabled) = (PFNGLISENABLEDPROC) LazyResolve ("glIsEnabled");
+    return OGLP_ENTRY (IsEnabled) (cap);
+}
+
+static void APIENTRY Lazy_DepthRange (GLdouble near, GLdouble far)
+{
+    OGLP_ENTRY (DepthRange) = (PFNGLDEPTHRANGEPROC) LazyResolve ("glDepthRange");
+    return OGLP_ENTRY (DepthRange) (near, far);
+}
+
+static void APIENTRY Lazy_Viewport (GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    OGLP_ENTRY (Viewport) = (PFNGLVIEWPORTPROC) LazyResolve ("glViewport");
+    return OGLP_ENTRY (Viewport) (x, y, width, height);
+}
+
+static void APIENTRY Lazy_DrawArrays (GLenum mode, GLint first, GLsizei count)
+{
+    OGLP_ENTRY (DrawArrays) = (PFNGLDRAWARRAYSPROC) LazyResolve ("glDrawArrays");
+    return OGLP_ENTRY (DrawArrays) (mode, first, count);
+}
+
+static void APIENTRY Lazy_DrawElements (GLenum mode, GLsizei count, GLenum type, const void *indices)
+{
+    OGLP_ENTRY (DrawElements) = (PFNGLDRAWELEMENTSPROC) LazyResolve ("glDrawElements");
+    return OGLP_ENTRY (DrawElements) (mode, count, type, indices);
+}
+
+static void APIENTRY Lazy_GetPointerv (GLenum pname, void **params)
+{
+    OGLP_ENTRY (GetPointerv) = (PFNGLGETPOINTERVPROC) LazyResolve ("glGetPointerv");
+    return OGLP_ENTRY (GetPointerv) (pname, params);
+}
+
+static void APIENTRY Lazy_PolygonOffset (GLfloat factor, GLfloat units)
+{
+    OGLP_ENTRY (PolygonOffset) = (PFNGLPOLYGONOFFSETPROC) LazyResolve ("glPolygonOffset");
+    return OGLP_ENTRY (PolygonOffset) (factor, units);
+}
+
+static void APIENTRY Lazy_CopyTexImage1D (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+{
+    OGLP_ENTRY (CopyTexImage1D) = (PFNGLCOPYTEXIMAGE1DPROC) LazyResolve ("glCopyTexImage1D");
+    return OGLP_ENTRY (CopyTexImage1D) (target, level, internalformat, x, y, width, border);
+}
+
+static void APIENTRY Lazy_CopyTexImage2D (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+{
+    OGLP_ENTRY (CopyTexImage2D) = (PFNGLCOPYTEXIMAGE2DPROC) LazyResolve ("glCopyTexImage2D");
+    return OGLP_ENTRY (CopyTexImage2D) (target, level, internalformat, x, y, width, height, border);
+}
+
+static void APIENTRY Lazy_CopyTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+    OGLP_ENTRY (CopyTexSubImage1D) = (PFNGLCOPYTEXSUBIMAGE1DPROC) LazyResolve ("glCopyTexSubImage1D");
+    return OGLP_ENTRY (CopyTexSubImage1D) (target, level, xoffset, x, y, width);
+}
+
+static void APIENTRY Lazy_CopyTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    OGLP_ENTRY (CopyTexSubImage2D) = (PFNGLCOPYTEXSUBIMAGE2DPROC) LazyResolve ("glCopyTexSubImage2D");
+    return OGLP_ENTRY (CopyTexSubImage2D) (target, level, xoffset, yoffset, x, y, width, height);
+}
+
+static void APIENTRY Lazy_TexSubImage1D (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels)
+{
+    OGLP_ENTRY (TexSubImage1D) = (PFNGLTEXSUBIMAGE1DPROC) LazyResolve ("glTexSubImage1D");
+    return OGLP_ENTRY (TexSubImage1D) (target, level, xoffset, width, format, type, pixels);
+}
+
+static void APIENTRY Lazy_TexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+    OGLP_ENTRY (TexSubImage2D) = (PFNGLTEXSUBIMAGE2DPROC) LazyResolve ("glTexSubImage2D");
+    return OGLP_ENTRY (TexSubImage2D) (target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+static void APIENTRY Lazy_BindTexture (GLenum target, GLuint texture)
+{
+    OGLP_ENTRY (BindTexture) = (PFNGLBINDTEXTUREPROC) LazyResolve ("glBindTexture");
+    return OGLP_ENTRY (BindTexture) (target, texture);
+}
+
+static void APIENTRY Lazy_DeleteTextures (GLsizei n, const GLuint *textures)
+{
+    OGLP_ENTRY (DeleteTextures) = (PFNGLDELETETEXTURESPROC) LazyResolve ("glDeleteTextures");
+    return OGLP_ENTRY (DeleteTextures) (n, textures);
+}
+
+static void APIENTRY Lazy_GenTextures (GLsizei n, GLuint *textures)
+{
+    OGLP_ENTRY (GenTextures) = (PFNGLGENTEXTURESPROC) LazyResolve ("glGenTextures");
+    return OGLP_ENTRY (GenTextures) (n, textures);
+}
+
+static GLboolean APIENTRY Lazy_IsTexture (GLuint texture)
+{
+    OGLP_ENTRY (IsTexture) = (PFNGLISTEXTUREPROC) LazyResolve ("glIsTexture");
+    return OGLP_ENTRY (IsTexture) (texture);
+}
+
+static void APIENTRY Lazy_DrawRangeElements (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices)
+{
+    OGLP_ENTRY (DrawRangeElements) = (PFNGLDRAWRANGEELEMENTSPROC) LazyResolve ("glDrawRangeElements");
+    return OGLP_ENTRY (DrawRangeElements) (mode, start, end, count, type, indices);
+}
+
+static void APIENTRY Lazy_TexImage3D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    OGLP_ENTRY (TexImage3D) = (PFNGLTEXIMAGE3DPROC) LazyResolve ("glTexImage3D");
+    return OGLP_ENTRY (TexImage3D) (target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+
+static void APIENTRY Lazy_TexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels)
+{
+    OGLP_ENTRY (TexSubImage3D) = (PFNGLTEXSUBIMAGE3DPROC) LazyResolve ("glTexSubImage3D");
+    return OGLP_ENTRY (TexSubImage3D) (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
+static void APIENTRY Lazy_CopyTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    OGLP_ENTRY (CopyTexSubImage3D) = (PFNGLCOPYTEXSUBIMAGE3DPROC) LazyResolve ("glCopyTexSubImage3D");
+    return OGLP_ENTRY (CopyTexSubImage3D) (target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+static void APIENTRY Lazy_ActiveTexture (GLenum texture)
+{
+    OGLP_ENTRY (ActiveTexture) = (PFNGLACTIVETEXTUREPROC) LazyResolve ("glActiveTexture");
+    return OGLP_ENTRY (ActiveTexture) (texture);
+}
+
+static void APIENTRY Lazy_SampleCoverage (GLfloat value, GLboolean invert)
+{
+    OGLP_ENTRY (SampleCoverage) = (PFNGLSAMPLECOVERAGEPROC) LazyResolve ("glSampleCoverage");
+    return OGLP_ENTRY (SampleCoverage) (value, invert);
+}
+
+static void APIENTRY Lazy_CompressedTexImage3D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data)
+{
+    OGLP_ENTRY (CompressedTexImage3D) = (PFNGLCOMPRESSEDTEXIMAGE3DPROC) LazyResolve ("glCompressedTexImage3D");
+    return OGLP_ENTRY (CompressedTexImage3D) (target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+
+static void APIENTRY Lazy_CompressedTexImage2D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data)
+{
+    OGLP_ENTRY (CompressedTexImage2D) = (PFNGLCOMPRESSEDTEXIMAGE2DPROC) LazyResolve ("glCompressedTexImage2D");
+    return OGLP_ENTRY (CompressedTexImage2D) (target, level, internalformat, width, height, border, imageSize, data);
+}
+
+static void APIENTRY Lazy_CompressedTexImage1D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data)
+{
+    OGLP_ENTRY (CompressedTexImage1D) = (PFNGLCOMPRESSEDTEXIMAGE1DPROC) LazyResolve ("glCompressedTexImage1D");
+    return OGLP_ENTRY (CompressedTexImage1D) (target, level, internalformat, width, border, imageSize, data);
+}
+
+static void APIENTRY Lazy_CompressedTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+{
+    OGLP_ENTRY (CompressedTexSubImage3D) = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC) LazyResolve ("glCompressedTexSubImage3D");
+    return OGLP_ENTRY (CompressedTexSubImage3D) (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+
+static void APIENTRY Lazy_CompressedTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+{
+    OGLP_ENTRY (CompressedTexSubImage2D) = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC) LazyResolve ("glCompressedTexSubImage2D");
+    return OGLP_ENTRY (CompressedTexSubImage2D) (target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+
+static void APIENTRY Lazy_CompressedTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
+{
+    OGLP_ENTRY (CompressedTexSubImage1D) = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC) LazyResolve ("glCompressedTexSubImage1D");
+    return OGLP_ENTRY (CompressedTexSubImage1D) (target, level, xoffset, width, format, imageSize, data);
+}
+
+static void APIENTRY Lazy_GetCompressedTexImage (GLenum target, GLint level, void *img)
+{
+    OGLP_ENTRY (GetCompressedTexImage) = (PFNGLGETCOMPRESSEDTEXIMAGEPROC) LazyResolve ("glGetCompressedTexImage");
+    return OGLP_ENTRY (GetCompressedTexImage) (target, level, img);
+}
+
+static void APIENTRY Lazy_BlendFuncSeparate (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+    OGLP_ENTRY (BlendFuncSeparate) = (PFNGLBLENDFUNCSEPARATEPROC) LazyResolve ("glBlendFuncSeparate");
+    return OGLP_ENTRY (BlendFuncSeparate) (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+
+static void APIENTRY Lazy_MultiDrawArrays (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount)
+{
+    OGLP_ENTRY (MultiDrawArrays) = (PFNGLMULTIDRAWARRAYSPROC) LazyResolve ("glMultiDrawArrays");
+    return OGLP_ENTRY (MultiDrawArrays) (mode, first, count, drawcount);
+}
+
+static void APIENTRY Lazy_MultiDrawElements (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount)
+{
+    OGLP_ENTRY (MultiDrawElements) = (PFNGLMULTIDRAWELEMENTSPROC) LazyResolve ("glMultiDrawElements");
+    return OGLP_ENTRY (MultiDrawElements) (mode, count, type, indices, drawcount);
+}
+
+static void APIENTRY Lazy_PointParameterf (GLenum pname, GLfloat param)
+{
+    OGLP_ENTRY (PointParameterf) = (PFNGLPOINTPARAMETERFPROC) LazyResolve ("glPointParameterf");
+    return OGLP_ENTRY (PointParameterf) (pname, param);
+}
+
+static void APIENTRY Lazy_PointParameterfv (GLenum pname, const GLfloat *params)
+{
+    OGLP_ENTRY (PointParameterfv) = (PFNGLPOINTPARAMETERFVPROC) LazyResolve ("glPointParameterfv");
+    return OGLP_ENTRY (PointParameterfv) (pname, params);
+}
+
+static void APIENTRY Lazy_PointParameteri (GLenum pname, GLint param)
+{
+    OGLP_ENTRY (PointParameteri) = (PFNGLPOINTPARAMETERIPROC) LazyResolve ("glPointParameteri");
+    return OGLP_ENTRY (PointParameteri) (pname, param);
+}
+
+static void APIENTRY Lazy_PointParameteriv (GLenum pname, const GLint *params)
+{
+    OGLP_ENTRY (PointParameteriv) = (PFNGLPOINTPARAMETERIVPROC) LazyResolve ("glPointParameteriv");
+    return OGLP_ENTRY (PointParameteriv) (pname, params);
+}
+
+static void APIENTRY Lazy_BlendColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    OGLP_ENTRY (BlendColor) = (PFNGLBLENDCOLORPROC) LazyResolve ("glBlendColor");
+    return OGLP_ENTRY (BlendColor) (red, green, blue, alpha);
+}
+
+static void APIENTRY Lazy_BlendEquation (GLenum mode)
+{
+    OGLP_ENTRY (BlendEquation) = (PFNGLBLENDEQUATIONPROC) LazyResolve ("glBlendEquation");
+    return OGLP_ENTRY (BlendEquation) (mode);
+}
+
+static void APIENTRY Lazy_GenQueries (GLsizei n, GLuint *ids)
+{
+    OGLP_ENTRY (GenQueries) = (PFNGLGENQUERIESPROC) LazyResolve ("glGenQueries");
+    return OGLP_ENTRY (GenQueries) (n, ids);
+}
+
+static void APIENTRY Lazy_DeleteQueries (GLsizei n, const GLuint *ids)
+{
+    OGLP_ENTRY (DeleteQueries) = (PFNGLDELETEQUERIESPROC) LazyResolve ("glDeleteQueries");
+    return OGLP_ENTRY (DeleteQueries) (n, ids);
+}
+
+static GLboolean APIENTRY Lazy_IsQuery (GLuint id)
+{
+    OGLP_ENTRY (IsQuery) = (PFNGLISQUERYPROC) LazyResolve ("glIsQuery");
+    return OGLP_ENTRY (IsQuery) (id);
+}
+
+static void APIENTRY Lazy_BeginQuery (GLenum target, GLuint id)
+{
+    OGLP_ENTRY (BeginQuery) = (PFNGLBEGINQUERYPROC) LazyResolve ("glBeginQuery");
+    return OGLP_ENTRY (BeginQuery) (target, id);
+}
+
+static void APIENTRY Lazy_EndQuery (GLenum target)
+{
+    OGLP_ENTRY (EndQuery) = (PFNGLENDQUERYPROC) LazyResolve ("glEndQuery");
+    return OGLP_ENTRY (EndQuery) (target);
+}
+
+static void APIENTRY Lazy_GetQueryiv (GLenum target, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetQueryiv) = (PFNGLGETQUERYIVPROC) LazyResolve ("glGetQueryiv");
+    return OGLP_ENTRY (GetQueryiv) (target, pname, params);
+}
+
+static void APIENTRY Lazy_GetQueryObjectiv (GLuint id, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetQueryObjectiv) = (PFNGLGETQUERYOBJECTIVPROC) LazyResolve ("glGetQueryObjectiv");
+    return OGLP_ENTRY (GetQueryObjectiv) (id, pname, params);
+}
+
+static void APIENTRY Lazy_GetQueryObjectuiv (GLuint id, GLenum pname, GLuint *params)
+{
+    OGLP_ENTRY (GetQueryObjectuiv) = (PFNGLGETQUERYOBJECTUIVPROC) LazyResolve ("glGetQueryObjectuiv");
+    return OGLP_ENTRY (GetQueryObjectuiv) (id, pname, params);
+}
+
+static void APIENTRY Lazy_BindBuffer (GLenum target, GLuint buffer)
+{
+    OGLP_ENTRY (BindBuffer) = (PFNGLBINDBUFFERPROC) LazyResolve ("glBindBuffer");
+    return OGLP_ENTRY (BindBuffer) (target, buffer);
+}
+
+static void APIENTRY Lazy_DeleteBuffers (GLsizei n, const GLuint *buffers)
+{
+    OGLP_ENTRY (DeleteBuffers) = (PFNGLDELETEBUFFERSPROC) LazyResolve ("glDeleteBuffers");
+    return OGLP_ENTRY (DeleteBuffers) (n, buffers);
+}
+
+static void APIENTRY Lazy_GenBuffers (GLsizei n, GLuint *buffers)
+{
+    OGLP_ENTRY (GenBuffers) = (PFNGLGENBUFFERSPROC) LazyResolve ("glGenBuffers");
+    return OGLP_ENTRY (GenBuffers) (n, buffers);
+}
+
+static GLboolean APIENTRY Lazy_IsBuffer (GLuint buffer)
+{
+    OGLP_ENTRY (IsBuffer) = (PFNGLISBUFFERPROC) LazyResolve ("glIsBuffer");
+    return OGLP_ENTRY (IsBuffer) (buffer);
+}
+
+static void APIENTRY Lazy_BufferData (GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+{
+    OGLP_ENTRY (BufferData) = (PFNGLBUFFERDATAPROC) LazyResolve ("glBufferData");
+    return OGLP_ENTRY (BufferData) (target, size, data, usage);
+}
+
+static void APIENTRY Lazy_BufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    OGLP_ENTRY (BufferSubData) = (PFNGLBUFFERSUBDATAPROC) LazyResolve ("glBufferSubData");
+    return OGLP_ENTRY (BufferSubData) (target, offset, size, data);
+}
+
+static void APIENTRY Lazy_GetBufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, void *data)
+{
+    OGLP_ENTRY (GetBufferSubData) = (PFNGLGETBUFFERSUBDATAPROC) LazyResolve ("glGetBufferSubData");
+    return OGLP_ENTRY (GetBufferSubData) (target, offset, size, data);
+}
+
+static void * APIENTRY Lazy_MapBuffer (GLenum target, GLenum access)
+{
+    OGLP_ENTRY (MapBuffer) = (PFNGLMAPBUFFERPROC) LazyResolve ("glMapBuffer");
+    return OGLP_ENTRY (MapBuffer) (target, access);
+}
+
+static GLboolean APIENTRY Lazy_UnmapBuffer (GLenum target)
+{
+    OGLP_ENTRY (UnmapBuffer) = (PFNGLUNMAPBUFFERPROC) LazyResolve ("glUnmapBuffer");
+    return OGLP_ENTRY (UnmapBuffer) (target);
+}
+
+static void APIENTRY Lazy_GetBufferParameteriv (GLenum target, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetBufferParameteriv) = (PFNGLGETBUFFERPARAMETERIVPROC) LazyResolve ("glGetBufferParameteriv");
+    return OGLP_ENTRY (GetBufferParameteriv) (target, pname, params);
+}
+
+static void APIENTRY Lazy_GetBufferPointerv (GLenum target, GLenum pname, void **params)
+{
+    OGLP_ENTRY (GetBufferPointerv) = (PFNGLGETBUFFERPOINTERVPROC) LazyResolve ("glGetBufferPointerv");
+    return OGLP_ENTRY (GetBufferPointerv) (target, pname, params);
+}
+
+static void APIENTRY Lazy_BlendEquationSeparate (GLenum modeRGB, GLenum modeAlpha)
+{
+    OGLP_ENTRY (BlendEquationSeparate) = (PFNGLBLENDEQUATIONSEPARATEPROC) LazyResolve ("glBlendEquationSeparate");
+    return OGLP_ENTRY (BlendEquationSeparate) (modeRGB, modeAlpha);
+}
+
+static void APIENTRY Lazy_DrawBuffers (GLsizei n, const GLenum *bufs)
+{
+    OGLP_ENTRY (DrawBuffers) = (PFNGLDRAWBUFFERSPROC) LazyResolve ("glDrawBuffers");
+    return OGLP_ENTRY (DrawBuffers) (n, bufs);
+}
+
+static void APIENTRY Lazy_StencilOpSeparate (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
+{
+    OGLP_ENTRY (StencilOpSeparate) = (PFNGLSTENCILOPSEPARATEPROC) LazyResolve ("glStencilOpSeparate");
+    return OGLP_ENTRY (StencilOpSeparate) (face, sfail, dpfail, dppass);
+}
+
+static void APIENTRY Lazy_StencilFuncSeparate (GLenum face, GLenum func, GLint ref, GLuint mask)
+{
+    OGLP_ENTRY (StencilFuncSeparate) = (PFNGLSTENCILFUNCSEPARATEPROC) LazyResolve ("glStencilFuncSeparate");
+    return OGLP_ENTRY (StencilFuncSeparate) (face, func, ref, mask);
+}
+
+static void APIENTRY Lazy_StencilMaskSeparate (GLenum face, GLuint mask)
+{
+    OGLP_ENTRY (StencilMaskSeparate) = (PFNGLSTENCILMASKSEPARATEPROC) LazyResolve ("glStencilMaskSeparate");
+    return OGLP_ENTRY (StencilMaskSeparate) (face, mask);
+}
+
+static void APIENTRY Lazy_AttachShader (GLuint program, GLuint shader)
+{
+    OGLP_ENTRY (AttachShader) = (PFNGLATTACHSHADERPROC) LazyResolve ("glAttachShader");
+    return OGLP_ENTRY (AttachShader) (program, shader);
+}
+
+static void APIENTRY Lazy_BindAttribLocation (GLuint program, GLuint index, const GLchar *name)
+{
+    OGLP_ENTRY (BindAttribLocation) = (PFNGLBINDATTRIBLOCATIONPROC) LazyResolve ("glBindAttribLocation");
+    return OGLP_ENTRY (BindAttribLocation) (program, index, name);
+}
+
+static void APIENTRY Lazy_CompileShader (GLuint shader)
+{
+    OGLP_ENTRY (CompileShader) = (PFNGLCOMPILESHADERPROC) LazyResolve ("glCompileShader");
+    return OGLP_ENTRY (CompileShader) (shader);
+}
+
+static GLuint APIENTRY Lazy_CreateProgram (void)
+{
+    OGLP_ENTRY (CreateProgram) = (PFNGLCREATEPROGRAMPROC) LazyResolve ("glCreateProgram");
+    return OGLP_ENTRY (CreateProgram) ();
+}
+
+static GLuint APIENTRY Lazy_CreateShader (GLenum type)
+{
+    OGLP_ENTRY (CreateShader) = (PFNGLCREATESHADERPROC) LazyResolve ("glCreateShader");
+    return OGLP_ENTRY (CreateShader) (type);
+}
+
+static void APIENTRY Lazy_DeleteProgram (GLuint program)
+{
+    OGLP_ENTRY (DeleteProgram) = (PFNGLDELETEPROGRAMPROC) LazyResolve ("glDeleteProgram");
+    return OGLP_ENTRY (DeleteProgram) (program);
+}
+
+static void APIENTRY Lazy_DeleteShader (GLuint shader)
+{
+    OGLP_ENTRY (DeleteShader) = (PFNGLDELETESHADERPROC) LazyResolve ("glDeleteShader");
+    return OGLP_ENTRY (DeleteShader) (shader);
+}
+
+static void APIENTRY Lazy_DetachShader (GLuint program, GLuint shader)
+{
+    OGLP_ENTRY (DetachShader) = (PFNGLDETACHSHADERPROC) LazyResolve ("glDetachShader");
+    return OGLP_ENTRY (DetachShader) (program, shader);
+}
+
+static void APIENTRY Lazy_DisableVertexAttribArray (GLuint index)
+{
+    OGLP_ENTRY (DisableVertexAttribArray) = (PFNGLDISABLEVERTEXATTRIBARRAYPROC) LazyResolve ("glDisableVertexAttribArray");
+    return OGLP_ENTRY (DisableVertexAttribArray) (index);
+}
+
+static void APIENTRY Lazy_EnableVertexAttribArray (GLuint index)
+{
+    OGLP_ENTRY (EnableVertexAttribArray) = (PFNGLENABLEVERTEXATTRIBARRAYPROC) LazyResolve ("glEnableVertexAttribArray");
+    return OGLP_ENTRY (EnableVertexAttribArray) (index);
+}
+
+static void APIENTRY Lazy_GetActiveAttrib (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+    OGLP_ENTRY (GetActiveAttrib) = (PFNGLGETACTIVEATTRIBPROC) LazyResolve ("glGetActiveAttrib");
+    return OGLP_ENTRY (GetActiveAttrib) (program, index, bufSize, length, size, type, name);
+}
+
+static void APIENTRY Lazy_GetActiveUniform (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+    OGLP_ENTRY (GetActiveUniform) = (PFNGLGETACTIVEUNIFORMPROC) LazyResolve ("glGetActiveUniform");
+    return OGLP_ENTRY (GetActiveUniform) (program, index, bufSize, length, size, type, name);
+}
+
+static void APIENTRY Lazy_GetAttachedShaders (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders)
+{
+    OGLP_ENTRY (GetAttachedShaders) = (PFNGLGETATTACHEDSHADERSPROC) LazyResolve ("glGetAttachedShaders");
+    return OGLP_ENTRY (GetAttachedShaders) (program, maxCount, count, shaders);
+}
+
+static GLint APIENTRY Lazy_GetAttribLocation (GLuint program, const GLchar *name)
+{
+    OGLP_ENTRY (GetAttribLocation) = (PFNGLGETATTRIBLOCATIONPROC) LazyResolve ("glGetAttribLocation");
+    return OGLP_ENTRY (GetAttribLocation) (program, name);
+}
+
+static void APIENTRY Lazy_GetProgramiv (GLuint program, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetProgramiv) = (PFNGLGETPROGRAMIVPROC) LazyResolve ("glGetProgramiv");
+    return OGLP_ENTRY (GetProgramiv) (program, pname, params);
+}
+
+static void APIENTRY Lazy_GetProgramInfoLog (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    OGLP_ENTRY (GetProgramInfoLog) = (PFNGLGETPROGRAMINFOLOGPROC) LazyResolve ("glGetProgramInfoLog");
+    return OGLP_ENTRY (GetProgramInfoLog) (program, bufSize, length, infoLog);
+}
+
+static void APIENTRY Lazy_GetShaderiv (GLuint shader, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetShaderiv) = (PFNGLGETSHADERIVPROC) LazyResolve ("glGetShaderiv");
+    return OGLP_ENTRY (GetShaderiv) (shader, pname, params);
+}
+
+static void APIENTRY Lazy_GetShaderInfoLog (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    OGLP_ENTRY (GetShaderInfoLog) = (PFNGLGETSHADERINFOLOGPROC) LazyResolve ("glGetShaderInfoLog");
+    return OGLP_ENTRY (GetShaderInfoLog) (shader, bufSize, length, infoLog);
+}
+
+static void APIENTRY Lazy_GetShaderSource (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source)
+{
+    OGLP_ENTRY (GetShaderSource) = (PFNGLGETSHADERSOURCEPROC) LazyResolve ("glGetShaderSource");
+    return OGLP_ENTRY (GetShaderSource) (shader, bufSize, length, source);
+}
+
+static GLint APIENTRY Lazy_GetUniformLocation (GLuint program, const GLchar *name)
+{
+    OGLP_ENTRY (GetUniformLocation) = (PFNGLGETUNIFORMLOCATIONPROC) LazyResolve ("glGetUniformLocation");
+    return OGLP_ENTRY (GetUniformLocation) (program, name);
+}
+
+static void APIENTRY Lazy_GetUniformfv (GLuint program, GLint location, GLfloat *params)
+{
+    OGLP_ENTRY (GetUniformfv) = (PFNGLGETUNIFORMFVPROC) LazyResolve ("glGetUniformfv");
+    return OGLP_ENTRY (GetUniformfv) (program, location, params);
+}
+
+static void APIENTRY Lazy_GetUniformiv (GLuint program, GLint location, GLint *params)
+{
+    OGLP_ENTRY (GetUniformiv) = (PFNGLGETUNIFORMIVPROC) LazyResolve ("glGetUniformiv");
+    return OGLP_ENTRY (GetUniformiv) (program, location, params);
+}
+
+static void APIENTRY Lazy_GetVertexAttribdv (GLuint index, GLenum pname, GLdouble *params)
+{
+    OGLP_ENTRY (GetVertexAttribdv) = (PFNGLGETVERTEXATTRIBDVPROC) LazyResolve ("glGetVertexAttribdv");
+    return OGLP_ENTRY (GetVertexAttribdv) (index, pname, params);
+}
+
+static void APIENTRY Lazy_GetVertexAttribfv (GLuint index, GLenum pname, GLfloat *params)
+{
+    OGLP_ENTRY (GetVertexAttribfv) = (PFNGLGETVERTEXATTRIBFVPROC) LazyResolve ("glGetVertexAttribfv");
+    return OGLP_ENTRY (GetVertexAttribfv) (index, pname, params);
+}
+
+static void APIENTRY Lazy_GetVertexAttribiv (GLuint index, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetVertexAttribiv) = (PFNGLGETVERTEXATTRIBIVPROC) LazyResolve ("glGetVertexAttribiv");
+    return OGLP_ENTRY (GetVertexAttribiv) (index, pname, params);
+}
+
+static void APIENTRY Lazy_GetVertexAttribPointerv (GLuint index, GLenum pname, void **pointer)
+{
+    OGLP_ENTRY (GetVertexAttribPointerv) = (PFNGLGETVERTEXATTRIBPOINTERVPROC) LazyResolve ("glGetVertexAttribPointerv");
+    return OGLP_ENTRY (GetVertexAttribPointerv) (index, pname, pointer);
+}
+
+static GLboolean APIENTRY Lazy_IsProgram (GLuint program)
+{
+    OGLP_ENTRY (IsProgram) = (PFNGLISPROGRAMPROC) LazyResolve ("glIsProgram");
+    return OGLP_ENTRY (IsProgram) (program);
+}
+
+static GLboolean APIENTRY Lazy_IsShader (GLuint shader)
+{
+    OGLP_ENTRY (IsShader) = (PFNGLISSHADERPROC) LazyResolve ("glIsShader");
+    return OGLP_ENTRY (IsShader) (shader);
+}
+
+static void APIENTRY Lazy_LinkProgram (GLuint program)
+{
+    OGLP_ENTRY (LinkProgram) = (PFNGLLINKPROGRAMPROC) LazyResolve ("glLinkProgram");
+    return OGLP_ENTRY (LinkProgram) (program);
+}
+
+static void APIENTRY Lazy_ShaderSource (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length)
+{
+    OGLP_ENTRY (ShaderSource) = (PFNGLSHADERSOURCEPROC) LazyResolve ("glShaderSource");
+    return OGLP_ENTRY (ShaderSource) (shader, count, string, length);
+}
+
+static void APIENTRY Lazy_UseProgram (GLuint program)
+{
+    OGLP_ENTRY (UseProgram) = (PFNGLUSEPROGRAMPROC) LazyResolve ("glUseProgram");
+    return OGLP_ENTRY (UseProgram) (program);
+}
+
+static void APIENTRY Lazy_Uniform1f (GLint location, GLfloat v0)
+{
+    OGLP_ENTRY (Uniform1f) = (PFNGLUNIFORM1FPROC) LazyResolve ("glUniform1f");
+    return OGLP_ENTRY (Uniform1f) (location, v0);
+}
+
+static void APIENTRY Lazy_Uniform2f (GLint location, GLfloat v0, GLfloat v1)
+{
+    OGLP_ENTRY (Uniform2f) = (PFNGLUNIFORM2FPROC) LazyResolve ("glUniform2f");
+    return OGLP_ENTRY (Uniform2f) (location, v0, v1);
+}
+
+static void APIENTRY Lazy_Uniform3f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    OGLP_ENTRY (Uniform3f) = (PFNGLUNIFORM3FPROC) LazyResolve ("glUniform3f");
+    return OGLP_ENTRY (Uniform3f) (location, v0, v1, v2);
+}
+
+static void APIENTRY Lazy_Uniform4f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+    OGLP_ENTRY (Uniform4f) = (PFNGLUNIFORM4FPROC) LazyResolve ("glUniform4f");
+    return OGLP_ENTRY (Uniform4f) (location, v0, v1, v2, v3);
+}
+
+static void APIENTRY Lazy_Uniform1i (GLint location, GLint v0)
+{
+    OGLP_ENTRY (Uniform1i) = (PFNGLUNIFORM1IPROC) LazyResolve ("glUniform1i");
+    return OGLP_ENTRY (Uniform1i) (location, v0);
+}
+
+static void APIENTRY Lazy_Uniform2i (GLint location, GLint v0, GLint v1)
+{
+    OGLP_ENTRY (Uniform2i) = (PFNGLUNIFORM2IPROC) LazyResolve ("glUniform2i");
+    return OGLP_ENTRY (Uniform2i) (location, v0, v1);
+}
+
+static void APIENTRY Lazy_Uniform3i (GLint location, GLint v0, GLint v1, GLint v2)
+{
+    OGLP_ENTRY (Uniform3i) = (PFNGLUNIFORM3IPROC) LazyResolve ("glUniform3i");
+    return OGLP_ENTRY (Uniform3i) (location, v0, v1, v2);
+}
+
+static void APIENTRY Lazy_Uniform4i (GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    OGLP_ENTRY (Uniform4i) = (PFNGLUNIFORM4IPROC) LazyResolve ("glUniform4i");
+    return OGLP_ENTRY (Uniform4i) (location, v0, v1, v2, v3);
+}
+
+static void APIENTRY Lazy_Uniform1fv (GLint location, GLsizei count, const GLfloat *value)
+{
+    OGLP_ENTRY (Uniform1fv) = (PFNGLUNIFORM1FVPROC) LazyResolve ("glUniform1fv");
+    return OGLP_ENTRY (Uniform1fv) (location, count, value);
+}
+
+static void APIENTRY Lazy_Uniform2fv (GLint location, GLsizei count, const GLfloat *value)
+{
+    OGLP_ENTRY (Uniform2fv) = (PFNGLUNIFORM2FVPROC) LazyResolve ("glUniform2fv");
+    return OGLP_ENTRY (Uniform2fv) (location, count, value);
+}
+
+static void APIENTRY Lazy_Uniform3fv (GLint location, GLsizei count, const GLfloat *value)
+{
+    OGLP_ENTRY (Uniform3fv) = (PFNGLUNIFORM3FVPROC) LazyResolve ("glUniform3fv");
+    return OGLP_ENTRY (Uniform3fv) (location, count, value);
+}
+
+static void APIENTRY Lazy_Uniform4fv (GLint location, GLsizei count, const GLfloat *value)
+{
+    OGLP_ENTRY (Uniform4fv) = (PFNGLUNIFORM4FVPROC) LazyResolve ("glUniform4fv");
+    return OGLP_ENTRY (Uniform4fv) (location, count, value);
+}
+
+static void APIENTRY Lazy_Uniform1iv (GLint location, GLsizei count, const GLint *value)
+{
+    OGLP_ENTRY (Uniform1iv) = (PFNGLUNIFORM1IVPROC) LazyResolve ("glUniform1iv");
+    return OGLP_ENTRY (Uniform1iv) (location, count, value);
+}
+
+static void APIENTRY Lazy_Uniform2iv (GLint location, GLsizei count, const GLint *value)
+{
+    OGLP_ENTRY (Uniform2iv) = (PFNGLUNIFORM2IVPROC) LazyResolve ("glUniform2iv");
+    return OGLP_ENTRY (Uniform2iv) (location, count, value);
+}
+
+static void APIENTRY Lazy_Uniform3iv (GLint location, GLsizei count, const GLint *value)
+{
+    OGLP_ENTRY (Uniform3iv) = (PFNGLUNIFORM3IVPROC) LazyResolve ("glUniform3iv");
+    return OGLP_ENTRY (Uniform3iv) (location, count, value);
+}
+
+static void APIENTRY Lazy_Uniform4iv (GLint location, GLsizei count, const GLint *value)
+{
+    OGLP_ENTRY (Uniform4iv) = (PFNGLUNIFORM4IVPROC) LazyResolve ("glUniform4iv");
+    return OGLP_ENTRY (Uniform4iv) (location, count, value);
+}
+
+static void APIENTRY Lazy_UniformMatrix2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    OGLP_ENTRY (UniformMatrix2fv) = (PFNGLUNIFORMMATRIX2FVPROC) LazyResolve ("glUniformMatrix2fv");
+    return OGLP_ENTRY (UniformMatrix2fv) (location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_UniformMatrix3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    OGLP_ENTRY (UniformMatrix3fv) = (PFNGLUNIFORMMATRIX3FVPROC) LazyResolve ("glUniformMatrix3fv");
+    return OGLP_ENTRY (UniformMatrix3fv) (location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_UniformMatrix4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    OGLP_ENTRY (UniformMatrix4fv) = (PFNGLUNIFORMMATRIX4FVPROC) LazyResolve ("glUniformMatrix4fv");
+    return OGLP_ENTRY (UniformMatrix4fv) (location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_ValidateProgram (GLuint program)
+{
+    OGLP_ENTRY (ValidateProgram) = (PFNGLVALIDATEPROGRAMPROC) LazyResolve ("glValidateProgram");
+    return OGLP_ENTRY (ValidateProgram) (program);
+}
+
+static void APIENTRY Lazy_VertexAttrib1d (GLuint index, GLdouble x)
+{
+    OGLP_ENTRY (VertexAttrib1d) = (PFNGLVERTEXATTRIB1DPROC) LazyResolve ("glVertexAttrib1d");
+    return OGLP_ENTRY (VertexAttrib1d) (index, x);
+}
+
+static void APIENTRY Lazy_VertexAttrib1dv (GLuint index, const GLdouble *v)
+{
+    OGLP_ENTRY (VertexAttrib1dv) = (PFNGLVERTEXATTRIB1DVPROC) LazyResolve ("glVertexAttrib1dv");
+    return OGLP_ENTRY (VertexAttrib1dv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttrib1f (GLuint index, GLfloat x)
+{
+    OGLP_ENTRY (VertexAttrib1f) = (PFNGLVERTEXATTRIB1FPROC) LazyResolve ("glVertexAttrib1f");
+    return OGLP_ENTRY (VertexAttrib1f) (index, x);
+}
+
+static void APIENTRY Lazy_VertexAttrib1fv (GLuint index, const GLfloat *v)
+{
+    OGLP_ENTRY (VertexAttrib1fv) = (PFNGLVERTEXATTRIB1FVPROC) LazyResolve ("glVertexAttrib1fv");
+    return OGLP_ENTRY (VertexAttrib1fv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttrib1s (GLuint index, GLshort x)
+{
+    OGLP_ENTRY (VertexAttrib1s) = (PFNGLVERTEXATTRIB1SPROC) LazyResolve ("glVertexAttrib1s");
+    return OGLP_ENTRY (VertexAttrib1s) (index, x);
+}
+
+static void APIENTRY Lazy_VertexAttrib1sv (GLuint index, const GLshort *v)
+{
+    OGLP_ENTRY (VertexAttrib1sv) = (PFNGLVERTEXATTRIB1SVPROC) LazyResolve ("glVertexAttrib1sv");
+    return OGLP_ENTRY (VertexAttrib1sv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttrib2d (GLuint index, GLdouble x, GLdouble y)
+{
+    OGLP_ENTRY (VertexAttrib2d) = (PFNGLVERTEXATTRIB2DPROC) LazyResolve ("glVertexAttrib2d");
+    return OGLP_ENTRY (VertexAttrib2d) (index, x, y);
+}
+
+static void APIENTRY Lazy_VertexAttrib2dv (GLuint index, const GLdouble *v)
+{
+    OGLP_ENTRY (VertexAttrib2dv) = (PFNGLVERTEXATTRIB2DVPROC) LazyResolve ("glVertexAttrib2dv");
+    return OGLP_ENTRY (VertexAttrib2dv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttrib2f (GLuint index, GLfloat x, GLfloat y)
+{
+    OGLP_ENTRY (VertexAttrib2f) = (PFNGLVERTEXATTRIB2FPROC) LazyResolve ("glVertexAttrib2f");
+    return OGLP_ENTRY (VertexAttrib2f) (index, x, y);
+}
+
+static void APIENTRY Lazy_VertexAttrib2fv (GLuint index, const GLfloat *v)
+{
+    OGLP_ENTRY (VertexAttrib2fv) = (PFNGLVERTEXATTRIB2FVPROC) LazyResolve ("glVertexAttrib2fv");
+    return OGLP_ENTRY (VertexAttrib2fv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttrib2s (GLuint index, GLshort x, GLshort y)
+{
+    OGLP_ENTRY (VertexAttrib2s) = (PFNGLVERTEXATTRIB2SPROC) LazyResolve ("glVertexAttrib2s");
+    return OGLP_ENTRY (VertexAttrib2s) (index, x, y);
+}
+
+static void APIENTRY Lazy_VertexAttrib2sv (GLuint index, const GLshort *v)
+{
+    OGLP_ENTRY (VertexAttrib2sv) = (PFNGLVERTEXATTRIB2SVPROC) LazyResolve ("glVertexAttrib2sv");
+    return OGLP_ENTRY (VertexAttrib2sv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttrib3d (GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+    OGLP_ENTRY (VertexAttrib3d) = (PFNGLVERTEXATTRIB3DPROC) LazyResolve ("glVertexAttrib3d");
+    return OGLP_ENTRY (VertexAttrib3d) (index, x, y, z);
+}
+
+static void APIENTRY Lazy_VertexAttrib3dv (GLuint index, const GLdouble *v)
+{
+    OGLP_ENTRY (VertexAttrib3dv) = (PFNGLVERTEXATTRIB3DVPROC) LazyResolve ("glVertexAttrib3dv");
+    return OGLP_ENTRY (VertexAttrib3dv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttrib3f (GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+    OGLP_ENTRY (VertexAttrib3f) = (PFNGLVERTEXATTRIB3FPROC) LazyResolve ("glVertexAttrib3f");
+    return OGLP_ENTRY (VertexAttrib3f) (index, x, y, z);
+}
+
+static void APIENTRY Lazy_VertexAttrib3fv (GLuint index, const GLfloat *v)
+{
+    OGLP_ENTRY (VertexAttrib3fv) = (PFNGLVERTEXATTRIB3FVPROC) LazyResolve ("glVertexAttrib3fv");
+    return OGLP_ENTRY (VertexAttrib3fv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttrib3s (GLuint index, GLshort x, GLshort y, GLshort z)
+{
+    OGLP_ENTRY (VertexAttrib3s) = (PFNGLVERTEXATTRIB3SPROC) LazyResolve ("glVertexAttrib3s");
+    return OGLP_ENTRY (VertexAttrib3s) (index, x, y, z);
+}
+
+static void APIENTRY Lazy_VertexAttrib3sv (GLuint index, const GLshort *v)
+{
+    OGLP_ENTRY (VertexAttrib3sv) = (PFNGLVERTEXATTRIB3SVPROC) LazyResolve ("glVertexAttrib3sv");
+    return OGLP_ENTRY (VertexAttrib3sv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttrib4Nbv (GLuint index, const GLbyte *v)
+{
+    OGLP_ENTRY (VertexAttrib4Nbv) = (PFNGLVERTEXATTRIB4NBVPROC) LazyResolve ("glVertexAttrib4Nbv");
+    return OGLP_ENTRY (VertexAttrib4Nbv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttrib4Niv (GLuint index, const GLint *v)
+{
+    OGLP_ENTRY (VertexAttrib4Niv) = (PFNGLVERTEXATTRIB4NIVPROC) LazyResolve ("glVertexAttrib4Niv");
+    return OGLP_ENTRY (VertexAttrib4Niv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttrib4Nsv (GLuint index, const GLshort *v)
+{
+    OGLP_ENTRY (VertexAttrib4Nsv) = (PFNGLVERTEXATTRIB4NSVPROC) LazyResolve ("glVertexAttrib4Nsv");
+    return OGLP_ENTRY (VertexAttrib4Nsv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttrib4Nub (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+{
+    OGLP_ENTRY (VertexAttrib4Nub) = (PFNGLVERTEXATTRIB4NUBPROC) LazyResolve ("glVertexAttrib4Nub");
+    return OGLP_ENTRY (VertexAttrib4Nub) (index, x, y, z, w);
+}
+
+static void APIENTRY Lazy_VertexAttrib4Nubv (GLuint index, const GLubyte *v)
+{
+    OGLP_ENTRY (VertexAttrib4Nubv) = (PFNGLVERTEXATTRIB4NUBVPROC) LazyResolve ("glVertexAttrib4Nubv");
+    return OGLP_ENTRY (VertexAttrib4Nubv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttrib4Nuiv (GLuint index, const GLuint *v)
+{
+    OGLP_ENTRY (VertexAttrib4Nuiv) = (PFNGLVERTEXATTRIB4NUIVPROC) LazyResolve ("glVertexAttrib4Nuiv");
+    return OGLP_ENTRY (VertexAttrib4Nuiv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttrib4Nusv (GLuint index, const GLushort *v)
+{
+    OGLP_ENTRY (VertexAttrib4Nusv) = (PFNGLVERTEXATTRIB4NUSVPROC) LazyResolve ("glVertexAttrib4Nusv");
+    return OGLP_ENTRY (VertexAttrib4Nusv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttrib4bv (GLuint index, const GLbyte *v)
+{
+    OGLP_ENTRY (VertexAttrib4bv) = (PFNGLVERTEXATTRIB4BVPROC) LazyResolve ("glVertexAttrib4bv");
+    return OGLP_ENTRY (VertexAttrib4bv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttrib4d (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    OGLP_ENTRY (VertexAttrib4d) = (PFNGLVERTEXATTRIB4DPROC) LazyResolve ("glVertexAttrib4d");
+    return OGLP_ENTRY (VertexAttrib4d) (index, x, y, z, w);
+}
+
+static void APIENTRY Lazy_VertexAttrib4dv (GLuint index, const GLdouble *v)
+{
+    OGLP_ENTRY (VertexAttrib4dv) = (PFNGLVERTEXATTRIB4DVPROC) LazyResolve ("glVertexAttrib4dv");
+    return OGLP_ENTRY (VertexAttrib4dv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttrib4f (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    OGLP_ENTRY (VertexAttrib4f) = (PFNGLVERTEXATTRIB4FPROC) LazyResolve ("glVertexAttrib4f");
+    return OGLP_ENTRY (VertexAttrib4f) (index, x, y, z, w);
+}
+
+static void APIENTRY Lazy_VertexAttrib4fv (GLuint index, const GLfloat *v)
+{
+    OGLP_ENTRY (VertexAttrib4fv) = (PFNGLVERTEXATTRIB4FVPROC) LazyResolve ("glVertexAttrib4fv");
+    return OGLP_ENTRY (VertexAttrib4fv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttrib4iv (GLuint index, const GLint *v)
+{
+    OGLP_ENTRY (VertexAttrib4iv) = (PFNGLVERTEXATTRIB4IVPROC) LazyResolve ("glVertexAttrib4iv");
+    return OGLP_ENTRY (VertexAttrib4iv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttrib4s (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+    OGLP_ENTRY (VertexAttrib4s) = (PFNGLVERTEXATTRIB4SPROC) LazyResolve ("glVertexAttrib4s");
+    return OGLP_ENTRY (VertexAttrib4s) (index, x, y, z, w);
+}
+
+static void APIENTRY Lazy_VertexAttrib4sv (GLuint index, const GLshort *v)
+{
+    OGLP_ENTRY (VertexAttrib4sv) = (PFNGLVERTEXATTRIB4SVPROC) LazyResolve ("glVertexAttrib4sv");
+    return OGLP_ENTRY (VertexAttrib4sv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttrib4ubv (GLuint index, const GLubyte *v)
+{
+    OGLP_ENTRY (VertexAttrib4ubv) = (PFNGLVERTEXATTRIB4UBVPROC) LazyResolve ("glVertexAttrib4ubv");
+    return OGLP_ENTRY (VertexAttrib4ubv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttrib4uiv (GLuint index, const GLuint *v)
+{
+    OGLP_ENTRY (VertexAttrib4uiv) = (PFNGLVERTEXATTRIB4UIVPROC) LazyResolve ("glVertexAttrib4uiv");
+    return OGLP_ENTRY (VertexAttrib4uiv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttrib4usv (GLuint index, const GLushort *v)
+{
+    OGLP_ENTRY (VertexAttrib4usv) = (PFNGLVERTEXATTRIB4USVPROC) LazyResolve ("glVertexAttrib4usv");
+    return OGLP_ENTRY (VertexAttrib4usv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttribPointer (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer)
+{
+    OGLP_ENTRY (VertexAttribPointer) = (PFNGLVERTEXATTRIBPOINTERPROC) LazyResolve ("glVertexAttribPointer");
+    return OGLP_ENTRY (VertexAttribPointer) (index, size, type, normalized, stride, pointer);
+}
+
+static void APIENTRY Lazy_UniformMatrix2x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    OGLP_ENTRY (UniformMatrix2x3fv) = (PFNGLUNIFORMMATRIX2X3FVPROC) LazyResolve ("glUniformMatrix2x3fv");
+    return OGLP_ENTRY (UniformMatrix2x3fv) (location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_UniformMatrix3x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    OGLP_ENTRY (UniformMatrix3x2fv) = (PFNGLUNIFORMMATRIX3X2FVPROC) LazyResolve ("glUniformMatrix3x2fv");
+    return OGLP_ENTRY (UniformMatrix3x2fv) (location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_UniformMatrix2x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    OGLP_ENTRY (UniformMatrix2x4fv) = (PFNGLUNIFORMMATRIX2X4FVPROC) LazyResolve ("glUniformMatrix2x4fv");
+    return OGLP_ENTRY (UniformMatrix2x4fv) (location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_UniformMatrix4x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    OGLP_ENTRY (UniformMatrix4x2fv) = (PFNGLUNIFORMMATRIX4X2FVPROC) LazyResolve ("glUniformMatrix4x2fv");
+    return OGLP_ENTRY (UniformMatrix4x2fv) (location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_UniformMatrix3x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    OGLP_ENTRY (UniformMatrix3x4fv) = (PFNGLUNIFORMMATRIX3X4FVPROC) LazyResolve ("glUniformMatrix3x4fv");
+    return OGLP_ENTRY (UniformMatrix3x4fv) (location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_UniformMatrix4x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    OGLP_ENTRY (UniformMatrix4x3fv) = (PFNGLUNIFORMMATRIX4X3FVPROC) LazyResolve ("glUniformMatrix4x3fv");
+    return OGLP_ENTRY (UniformMatrix4x3fv) (location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_ColorMaski (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
+{
+    OGLP_ENTRY (ColorMaski) = (PFNGLCOLORMASKIPROC) LazyResolve ("glColorMaski");
+    return OGLP_ENTRY (ColorMaski) (index, r, g, b, a);
+}
+
+static void APIENTRY Lazy_GetBooleani_v (GLenum target, GLuint index, GLboolean *data)
+{
+    OGLP_ENTRY (GetBooleani_v) = (PFNGLGETBOOLEANI_VPROC) LazyResolve ("glGetBooleani_v");
+    return OGLP_ENTRY (GetBooleani_v) (target, index, data);
+}
+
+static void APIENTRY Lazy_GetIntegeri_v (GLenum target, GLuint index, GLint *data)
+{
+    OGLP_ENTRY (GetIntegeri_v) = (PFNGLGETINTEGERI_VPROC) LazyResolve ("glGetIntegeri_v");
+    return OGLP_ENTRY (GetIntegeri_v) (target, index, data);
+}
+
+static void APIENTRY Lazy_Enablei (GLenum target, GLuint index)
+{
+    OGLP_ENTRY (Enablei) = (PFNGLENABLEIPROC) LazyResolve ("glEnablei");
+    return OGLP_ENTRY (Enablei) (target, index);
+}
+
+static void APIENTRY Lazy_Disablei (GLenum target, GLuint index)
+{
+    OGLP_ENTRY (Disablei) = (PFNGLDISABLEIPROC) LazyResolve ("glDisablei");
+    return OGLP_ENTRY (Disablei) (target, index);
+}
+
+static GLboolean APIENTRY Lazy_IsEnabledi (GLenum target, GLuint index)
+{
+    OGLP_ENTRY (IsEnabledi) = (PFNGLISENABLEDIPROC) LazyResolve ("glIsEnabledi");
+    return OGLP_ENTRY (IsEnabledi) (target, index);
+}
+
+static void APIENTRY Lazy_BeginTransformFeedback (GLenum primitiveMode)
+{
+    OGLP_ENTRY (BeginTransformFeedback) = (PFNGLBEGINTRANSFORMFEEDBACKPROC) LazyResolve ("glBeginTransformFeedback");
+    return OGLP_ENTRY (BeginTransformFeedback) (primitiveMode);
+}
+
+static void APIENTRY Lazy_EndTransformFeedback (void)
+{
+    OGLP_ENTRY (EndTransformFeedback) = (PFNGLENDTRANSFORMFEEDBACKPROC) LazyResolve ("glEndTransformFeedback");
+    return OGLP_ENTRY (EndTransformFeedback) ();
+}
+
+static void APIENTRY Lazy_BindBufferRange (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    OGLP_ENTRY (BindBufferRange) = (PFNGLBINDBUFFERRANGEPROC) LazyResolve ("glBindBufferRange");
+    return OGLP_ENTRY (BindBufferRange) (target, index, buffer, offset, size);
+}
+
+static void APIENTRY Lazy_BindBufferBase (GLenum target, GLuint index, GLuint buffer)
+{
+    OGLP_ENTRY (BindBufferBase) = (PFNGLBINDBUFFERBASEPROC) LazyResolve ("glBindBufferBase");
+    return OGLP_ENTRY (BindBufferBase) (target, index, buffer);
+}
+
+static void APIENTRY Lazy_TransformFeedbackVaryings (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode)
+{
+    OGLP_ENTRY (TransformFeedbackVaryings) = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC) LazyResolve ("glTransformFeedbackVaryings");
+    return OGLP_ENTRY (TransformFeedbackVaryings) (program, count, varyings, bufferMode);
+}
+
+static void APIENTRY Lazy_GetTransformFeedbackVarying (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name)
+{
+    OGLP_ENTRY (GetTransformFeedbackVarying) = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC) LazyResolve ("glGetTransformFeedbackVarying");
+    return OGLP_ENTRY (GetTransformFeedbackVarying) (program, index, bufSize, length, size, type, name);
+}
+
+static void APIENTRY Lazy_ClampColor (GLenum target, GLenum clamp)
+{
+    OGLP_ENTRY (ClampColor) = (PFNGLCLAMPCOLORPROC) LazyResolve ("glClampColor");
+    return OGLP_ENTRY (ClampColor) (target, clamp);
+}
+
+static void APIENTRY Lazy_BeginConditionalRender (GLuint id, GLenum mode)
+{
+    OGLP_ENTRY (BeginConditionalRender) = (PFNGLBEGINCONDITIONALRENDERPROC) LazyResolve ("glBeginConditionalRender");
+    return OGLP_ENTRY (BeginConditionalRender) (id, mode);
+}
+
+static void APIENTRY Lazy_EndConditionalRender (void)
+{
+    OGLP_ENTRY (EndConditionalRender) = (PFNGLENDCONDITIONALRENDERPROC) LazyResolve ("glEndConditionalRender");
+    return OGLP_ENTRY (EndConditionalRender) ();
+}
+
+static void APIENTRY Lazy_VertexAttribIPointer (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+    OGLP_ENTRY (VertexAttribIPointer) = (PFNGLVERTEXATTRIBIPOINTERPROC) LazyResolve ("glVertexAttribIPointer");
+    return OGLP_ENTRY (VertexAttribIPointer) (index, size, type, stride, pointer);
+}
+
+static void APIENTRY Lazy_GetVertexAttribIiv (GLuint index, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetVertexAttribIiv) = (PFNGLGETVERTEXATTRIBIIVPROC) LazyResolve ("glGetVertexAttribIiv");
+    return OGLP_ENTRY (GetVertexAttribIiv) (index, pname, params);
+}
+
+static void APIENTRY Lazy_GetVertexAttribIuiv (GLuint index, GLenum pname, GLuint *params)
+{
+    OGLP_ENTRY (GetVertexAttribIuiv) = (PFNGLGETVERTEXATTRIBIUIVPROC) LazyResolve ("glGetVertexAttribIuiv");
+    return OGLP_ENTRY (GetVertexAttribIuiv) (index, pname, params);
+}
+
+static void APIENTRY Lazy_VertexAttribI1i (GLuint index, GLint x)
+{
+    OGLP_ENTRY (VertexAttribI1i) = (PFNGLVERTEXATTRIBI1IPROC) LazyResolve ("glVertexAttribI1i");
+    return OGLP_ENTRY (VertexAttribI1i) (index, x);
+}
+
+static void APIENTRY Lazy_VertexAttribI2i (GLuint index, GLint x, GLint y)
+{
+    OGLP_ENTRY (VertexAttribI2i) = (PFNGLVERTEXATTRIBI2IPROC) LazyResolve ("glVertexAttribI2i");
+    return OGLP_ENTRY (VertexAttribI2i) (index, x, y);
+}
+
+static void APIENTRY Lazy_VertexAttribI3i (GLuint index, GLint x, GLint y, GLint z)
+{
+    OGLP_ENTRY (VertexAttribI3i) = (PFNGLVERTEXATTRIBI3IPROC) LazyResolve ("glVertexAttribI3i");
+    return OGLP_ENTRY (VertexAttribI3i) (index, x, y, z);
+}
+
+static void APIENTRY Lazy_VertexAttribI4i (GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+    OGLP_ENTRY (VertexAttribI4i) = (PFNGLVERTEXATTRIBI4IPROC) LazyResolve ("glVertexAttribI4i");
+    return OGLP_ENTRY (VertexAttribI4i) (index, x, y, z, w);
+}
+
+static void APIENTRY Lazy_VertexAttribI1ui (GLuint index, GLuint x)
+{
+    OGLP_ENTRY (VertexAttribI1ui) = (PFNGLVERTEXATTRIBI1UIPROC) LazyResolve ("glVertexAttribI1ui");
+    return OGLP_ENTRY (VertexAttribI1ui) (index, x);
+}
+
+static void APIENTRY Lazy_VertexAttribI2ui (GLuint index, GLuint x, GLuint y)
+{
+    OGLP_ENTRY (VertexAttribI2ui) = (PFNGLVERTEXATTRIBI2UIPROC) LazyResolve ("glVertexAttribI2ui");
+    return OGLP_ENTRY (VertexAttribI2ui) (index, x, y);
+}
+
+static void APIENTRY Lazy_VertexAttribI3ui (GLuint index, GLuint x, GLuint y, GLuint z)
+{
+    OGLP_ENTRY (VertexAttribI3ui) = (PFNGLVERTEXATTRIBI3UIPROC) LazyResolve ("glVertexAttribI3ui");
+    return OGLP_ENTRY (VertexAttribI3ui) (index, x, y, z);
+}
+
+static void APIENTRY Lazy_VertexAttribI4ui (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+{
+    OGLP_ENTRY (VertexAttribI4ui) = (PFNGLVERTEXATTRIBI4UIPROC) LazyResolve ("glVertexAttribI4ui");
+    return OGLP_ENTRY (VertexAttribI4ui) (index, x, y, z, w);
+}
+
+static void APIENTRY Lazy_VertexAttribI1iv (GLuint index, const GLint *v)
+{
+    OGLP_ENTRY (VertexAttribI1iv) = (PFNGLVERTEXATTRIBI1IVPROC) LazyResolve ("glVertexAttribI1iv");
+    return OGLP_ENTRY (VertexAttribI1iv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttribI2iv (GLuint index, const GLint *v)
+{
+    OGLP_ENTRY (VertexAttribI2iv) = (PFNGLVERTEXATTRIBI2IVPROC) LazyResolve ("glVertexAttribI2iv");
+    return OGLP_ENTRY (VertexAttribI2iv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttribI3iv (GLuint index, const GLint *v)
+{
+    OGLP_ENTRY (VertexAttribI3iv) = (PFNGLVERTEXATTRIBI3IVPROC) LazyResolve ("glVertexAttribI3iv");
+    return OGLP_ENTRY (VertexAttribI3iv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttribI4iv (GLuint index, const GLint *v)
+{
+    OGLP_ENTRY (VertexAttribI4iv) = (PFNGLVERTEXATTRIBI4IVPROC) LazyResolve ("glVertexAttribI4iv");
+    return OGLP_ENTRY (VertexAttribI4iv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttribI1uiv (GLuint index, const GLuint *v)
+{
+    OGLP_ENTRY (VertexAttribI1uiv) = (PFNGLVERTEXATTRIBI1UIVPROC) LazyResolve ("glVertexAttribI1uiv");
+    return OGLP_ENTRY (VertexAttribI1uiv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttribI2uiv (GLuint index, const GLuint *v)
+{
+    OGLP_ENTRY (VertexAttribI2uiv) = (PFNGLVERTEXATTRIBI2UIVPROC) LazyResolve ("glVertexAttribI2uiv");
+    return OGLP_ENTRY (VertexAttribI2uiv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttribI3uiv (GLuint index, const GLuint *v)
+{
+    OGLP_ENTRY (VertexAttribI3uiv) = (PFNGLVERTEXATTRIBI3UIVPROC) LazyResolve ("glVertexAttribI3uiv");
+    return OGLP_ENTRY (VertexAttribI3uiv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttribI4uiv (GLuint index, const GLuint *v)
+{
+    OGLP_ENTRY (VertexAttribI4uiv) = (PFNGLVERTEXATTRIBI4UIVPROC) LazyResolve ("glVertexAttribI4uiv");
+    return OGLP_ENTRY (VertexAttribI4uiv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttribI4bv (GLuint index, const GLbyte *v)
+{
+    OGLP_ENTRY (VertexAttribI4bv) = (PFNGLVERTEXATTRIBI4BVPROC) LazyResolve ("glVertexAttribI4bv");
+    return OGLP_ENTRY (VertexAttribI4bv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttribI4sv (GLuint index, const GLshort *v)
+{
+    OGLP_ENTRY (VertexAttribI4sv) = (PFNGLVERTEXATTRIBI4SVPROC) LazyResolve ("glVertexAttribI4sv");
+    return OGLP_ENTRY (VertexAttribI4sv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttribI4ubv (GLuint index, const GLubyte *v)
+{
+    OGLP_ENTRY (VertexAttribI4ubv) = (PFNGLVERTEXATTRIBI4UBVPROC) LazyResolve ("glVertexAttribI4ubv");
+    return OGLP_ENTRY (VertexAttribI4ubv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttribI4usv (GLuint index, const GLushort *v)
+{
+    OGLP_ENTRY (VertexAttribI4usv) = (PFNGLVERTEXATTRIBI4USVPROC) LazyResolve ("glVertexAttribI4usv");
+    return OGLP_ENTRY (VertexAttribI4usv) (index, v);
+}
+
+static void APIENTRY Lazy_GetUniformuiv (GLuint program, GLint location, GLuint *params)
+{
+    OGLP_ENTRY (GetUniformuiv) = (PFNGLGETUNIFORMUIVPROC) LazyResolve ("glGetUniformuiv");
+    return OGLP_ENTRY (GetUniformuiv) (program, location, params);
+}
+
+static void APIENTRY Lazy_BindFragDataLocation (GLuint program, GLuint color, const GLchar *name)
+{
+    OGLP_ENTRY (BindFragDataLocation) = (PFNGLBINDFRAGDATALOCATIONPROC) LazyResolve ("glBindFragDataLocation");
+    return OGLP_ENTRY (BindFragDataLocation) (program, color, name);
+}
+
+static GLint APIENTRY Lazy_GetFragDataLocation (GLuint program, const GLchar *name)
+{
+    OGLP_ENTRY (GetFragDataLocation) = (PFNGLGETFRAGDATALOCATIONPROC) LazyResolve ("glGetFragDataLocation");
+    return OGLP_ENTRY (GetFragDataLocation) (program, name);
+}
+
+static void APIENTRY Lazy_Uniform1ui (GLint location, GLuint v0)
+{
+    OGLP_ENTRY (Uniform1ui) = (PFNGLUNIFORM1UIPROC) LazyResolve ("glUniform1ui");
+    return OGLP_ENTRY (Uniform1ui) (location, v0);
+}
+
+static void APIENTRY Lazy_Uniform2ui (GLint location, GLuint v0, GLuint v1)
+{
+    OGLP_ENTRY (Uniform2ui) = (PFNGLUNIFORM2UIPROC) LazyResolve ("glUniform2ui");
+    return OGLP_ENTRY (Uniform2ui) (location, v0, v1);
+}
+
+static void APIENTRY Lazy_Uniform3ui (GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+    OGLP_ENTRY (Uniform3ui) = (PFNGLUNIFORM3UIPROC) LazyResolve ("glUniform3ui");
+    return OGLP_ENTRY (Uniform3ui) (location, v0, v1, v2);
+}
+
+static void APIENTRY Lazy_Uniform4ui (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+    OGLP_ENTRY (Uniform4ui) = (PFNGLUNIFORM4UIPROC) LazyResolve ("glUniform4ui");
+    return OGLP_ENTRY (Uniform4ui) (location, v0, v1, v2, v3);
+}
+
+static void APIENTRY Lazy_Uniform1uiv (GLint location, GLsizei count, const GLuint *value)
+{
+    OGLP_ENTRY (Uniform1uiv) = (PFNGLUNIFORM1UIVPROC) LazyResolve ("glUniform1uiv");
+    return OGLP_ENTRY (Uniform1uiv) (location, count, value);
+}
+
+static void APIENTRY Lazy_Uniform2uiv (GLint location, GLsizei count, const GLuint *value)
+{
+    OGLP_ENTRY (Uniform2uiv) = (PFNGLUNIFORM2UIVPROC) LazyResolve ("glUniform2uiv");
+    return OGLP_ENTRY (Uniform2uiv) (location, count, value);
+}
+
+static void APIENTRY Lazy_Uniform3uiv (GLint location, GLsizei count, const GLuint *value)
+{
+    OGLP_ENTRY (Uniform3uiv) = (PFNGLUNIFORM3UIVPROC) LazyResolve ("glUniform3uiv");
+    return OGLP_ENTRY (Uniform3uiv) (location, count, value);
+}
+
+static void APIENTRY Lazy_Uniform4uiv (GLint location, GLsizei count, const GLuint *value)
+{
+    OGLP_ENTRY (Uniform4uiv) = (PFNGLUNIFORM4UIVPROC) LazyResolve ("glUniform4uiv");
+    return OGLP_ENTRY (Uniform4uiv) (location, count, value);
+}
+
+static void APIENTRY Lazy_TexParameterIiv (GLenum target, GLenum pname, const GLint *params)
+{
+    OGLP_ENTRY (TexParameterIiv) = (PFNGLTEXPARAMETERIIVPROC) LazyResolve ("glTexParameterIiv");
+    return OGLP_ENTRY (TexParameterIiv) (target, pname, params);
+}
+
+static void APIENTRY Lazy_TexParameterIuiv (GLenum target, GLenum pname, const GLuint *params)
+{
+    OGLP_ENTRY (TexParameterIuiv) = (PFNGLTEXPARAMETERIUIVPROC) LazyResolve ("glTexParameterIuiv");
+    return OGLP_ENTRY (TexParameterIuiv) (target, pname, params);
+}
+
+static void APIENTRY Lazy_GetTexParameterIiv (GLenum target, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetTexParameterIiv) = (PFNGLGETTEXPARAMETERIIVPROC) LazyResolve ("glGetTexParameterIiv");
+    return OGLP_ENTRY (GetTexParameterIiv) (target, pname, params);
+}
+
+static void APIENTRY Lazy_GetTexParameterIuiv (GLenum target, GLenum pname, GLuint *params)
+{
+    OGLP_ENTRY (GetTexParameterIuiv) = (PFNGLGETTEXPARAMETERIUIVPROC) LazyResolve ("glGetTexParameterIuiv");
+    return OGLP_ENTRY (GetTexParameterIuiv) (target, pname, params);
+}
+
+static void APIENTRY Lazy_ClearBufferiv (GLenum buffer, GLint drawbuffer, const GLint *value)
+{
+    OGLP_ENTRY (ClearBufferiv) = (PFNGLCLEARBUFFERIVPROC) LazyResolve ("glClearBufferiv");
+    return OGLP_ENTRY (ClearBufferiv) (buffer, drawbuffer, value);
+}
+
+static void APIENTRY Lazy_ClearBufferuiv (GLenum buffer, GLint drawbuffer, const GLuint *value)
+{
+    OGLP_ENTRY (ClearBufferuiv) = (PFNGLCLEARBUFFERUIVPROC) LazyResolve ("glClearBufferuiv");
+    return OGLP_ENTRY (ClearBufferuiv) (buffer, drawbuffer, value);
+}
+
+static void APIENTRY Lazy_ClearBufferfv (GLenum buffer, GLint drawbuffer, const GLfloat *value)
+{
+    OGLP_ENTRY (ClearBufferfv) = (PFNGLCLEARBUFFERFVPROC) LazyResolve ("glClearBufferfv");
+    return OGLP_ENTRY (ClearBufferfv) (buffer, drawbuffer, value);
+}
+
+static void APIENTRY Lazy_ClearBufferfi (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
+{
+    OGLP_ENTRY (ClearBufferfi) = (PFNGLCLEARBUFFERFIPROC) LazyResolve ("glClearBufferfi");
+    return OGLP_ENTRY (ClearBufferfi) (buffer, drawbuffer, depth, stencil);
+}
+
+static const GLubyte * APIENTRY Lazy_GetStringi (GLenum name, GLuint index)
+{
+    OGLP_ENTRY (GetStringi) = (PFNGLGETSTRINGIPROC) LazyResolve ("glGetStringi");
+    return OGLP_ENTRY (GetStringi) (name, index);
+}
+
+static GLboolean APIENTRY Lazy_IsRenderbuffer (GLuint renderbuffer)
+{
+    OGLP_ENTRY (IsRenderbuffer) = (PFNGLISRENDERBUFFERPROC) LazyResolve ("glIsRenderbuffer");
+    return OGLP_ENTRY (IsRenderbuffer) (renderbuffer);
+}
+
+static void APIENTRY Lazy_BindRenderbuffer (GLenum target, GLuint renderbuffer)
+{
+    OGLP_ENTRY (BindRenderbuffer) = (PFNGLBINDRENDERBUFFERPROC) LazyResolve ("glBindRenderbuffer");
+    return OGLP_ENTRY (BindRenderbuffer) (target, renderbuffer);
+}
+
+static void APIENTRY Lazy_DeleteRenderbuffers (GLsizei n, const GLuint *renderbuffers)
+{
+    OGLP_ENTRY (DeleteRenderbuffers) = (PFNGLDELETERENDERBUFFERSPROC) LazyResolve ("glDeleteRenderbuffers");
+    return OGLP_ENTRY (DeleteRenderbuffers) (n, renderbuffers);
+}
+
+static void APIENTRY Lazy_GenRenderbuffers (GLsizei n, GLuint *renderbuffers)
+{
+    OGLP_ENTRY (GenRenderbuffers) = (PFNGLGENRENDERBUFFERSPROC) LazyResolve ("glGenRenderbuffers");
+    return OGLP_ENTRY (GenRenderbuffers) (n, renderbuffers);
+}
+
+static void APIENTRY Lazy_RenderbufferStorage (GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    OGLP_ENTRY (RenderbufferStorage) = (PFNGLRENDERBUFFERSTORAGEPROC) LazyResolve ("glRenderbufferStorage");
+    return OGLP_ENTRY (RenderbufferStorage) (target, internalformat, width, height);
+}
+
+static void APIENTRY Lazy_GetRenderbufferParameteriv (GLenum target, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetRenderbufferParameteriv) = (PFNGLGETRENDERBUFFERPARAMETERIVPROC) LazyResolve ("glGetRenderbufferParameteriv");
+    return OGLP_ENTRY (GetRenderbufferParameteriv) (target, pname, params);
+}
+
+static GLboolean APIENTRY Lazy_IsFramebuffer (GLuint framebuffer)
+{
+    OGLP_ENTRY (IsFramebuffer) = (PFNGLISFRAMEBUFFERPROC) LazyResolve ("glIsFramebuffer");
+    return OGLP_ENTRY (IsFramebuffer) (framebuffer);
+}
+
+static void APIENTRY Lazy_BindFramebuffer (GLenum target, GLuint framebuffer)
+{
+    OGLP_ENTRY (BindFramebuffer) = (PFNGLBINDFRAMEBUFFERPROC) LazyResolve ("glBindFramebuffer");
+    return OGLP_ENTRY (BindFramebuffer) (target, framebuffer);
+}
+
+static void APIENTRY Lazy_DeleteFramebuffers (GLsizei n, const GLuint *framebuffers)
+{
+    OGLP_ENTRY (DeleteFramebuffers) = (PFNGLDELETEFRAMEBUFFERSPROC) LazyResolve ("glDeleteFramebuffers");
+    return OGLP_ENTRY (DeleteFramebuffers) (n, framebuffers);
+}
+
+static void APIENTRY Lazy_GenFramebuffers (GLsizei n, GLuint *framebuffers)
+{
+    OGLP_ENTRY (GenFramebuffers) = (PFNGLGENFRAMEBUFFERSPROC) LazyResolve ("glGenFramebuffers");
+    return OGLP_ENTRY (GenFramebuffers) (n, framebuffers);
+}
+
+static GLenum APIENTRY Lazy_CheckFramebufferStatus (GLenum target)
+{
+    OGLP_ENTRY (CheckFramebufferStatus) = (PFNGLCHECKFRAMEBUFFERSTATUSPROC) LazyResolve ("glCheckFramebufferStatus");
+    return OGLP_ENTRY (CheckFramebufferStatus) (target);
+}
+
+static void APIENTRY Lazy_FramebufferTexture1D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    OGLP_ENTRY (FramebufferTexture1D) = (PFNGLFRAMEBUFFERTEXTURE1DPROC) LazyResolve ("glFramebufferTexture1D");
+    return OGLP_ENTRY (FramebufferTexture1D) (target, attachment, textarget, texture, level);
+}
+
+static void APIENTRY Lazy_FramebufferTexture2D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    OGLP_ENTRY (FramebufferTexture2D) = (PFNGLFRAMEBUFFERTEXTURE2DPROC) LazyResolve ("glFramebufferTexture2D");
+    return OGLP_ENTRY (FramebufferTexture2D) (target, attachment, textarget, texture, level);
+}
+
+static void APIENTRY Lazy_FramebufferTexture3D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
+{
+    OGLP_ENTRY (FramebufferTexture3D) = (PFNGLFRAMEBUFFERTEXTURE3DPROC) LazyResolve ("glFramebufferTexture3D");
+    return OGLP_ENTRY (FramebufferTexture3D) (target, attachment, textarget, texture, level, zoffset);
+}
+
+static void APIENTRY Lazy_FramebufferRenderbuffer (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+    OGLP_ENTRY (FramebufferRenderbuffer) = (PFNGLFRAMEBUFFERRENDERBUFFERPROC) LazyResolve ("glFramebufferRenderbuffer");
+    return OGLP_ENTRY (FramebufferRenderbuffer) (target, attachment, renderbuffertarget, renderbuffer);
+}
+
+static void APIENTRY Lazy_GetFramebufferAttachmentParameteriv (GLenum target, GLenum attachment, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetFramebufferAttachmentParameteriv) = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC) LazyResolve ("glGetFramebufferAttachmentParameteriv");
+    return OGLP_ENTRY (GetFramebufferAttachmentParameteriv) (target, attachment, pname, params);
+}
+
+static void APIENTRY Lazy_GenerateMipmap (GLenum target)
+{
+    OGLP_ENTRY (GenerateMipmap) = (PFNGLGENERATEMIPMAPPROC) LazyResolve ("glGenerateMipmap");
+    return OGLP_ENTRY (GenerateMipmap) (target);
+}
+
+static void APIENTRY Lazy_BlitFramebuffer (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+    OGLP_ENTRY (BlitFramebuffer) = (PFNGLBLITFRAMEBUFFERPROC) LazyResolve ("glBlitFramebuffer");
+    return OGLP_ENTRY (BlitFramebuffer) (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+static void APIENTRY Lazy_RenderbufferStorageMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    OGLP_ENTRY (RenderbufferStorageMultisample) = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC) LazyResolve ("glRenderbufferStorageMultisample");
+    return OGLP_ENTRY (RenderbufferStorageMultisample) (target, samples, internalformat, width, height);
+}
+
+static void APIENTRY Lazy_FramebufferTextureLayer (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+    OGLP_ENTRY (FramebufferTextureLayer) = (PFNGLFRAMEBUFFERTEXTURELAYERPROC) LazyResolve ("glFramebufferTextureLayer");
+    return OGLP_ENTRY (FramebufferTextureLayer) (target, attachment, texture, level, layer);
+}
+
+static void * APIENTRY Lazy_MapBufferRange (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    OGLP_ENTRY (MapBufferRange) = (PFNGLMAPBUFFERRANGEPROC) LazyResolve ("glMapBufferRange");
+    return OGLP_ENTRY (MapBufferRange) (target, offset, length, access);
+}
+
+static void APIENTRY Lazy_FlushMappedBufferRange (GLenum target, GLintptr offset, GLsizeiptr length)
+{
+    OGLP_ENTRY (FlushMappedBufferRange) = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC) LazyResolve ("glFlushMappedBufferRange");
+    return OGLP_ENTRY (FlushMappedBufferRange) (target, offset, length);
+}
+
+static void APIENTRY Lazy_BindVertexArray (GLuint array)
+{
+    OGLP_ENTRY (BindVertexArray) = (PFNGLBINDVERTEXARRAYPROC) LazyResolve ("glBindVertexArray");
+    return OGLP_ENTRY (BindVertexArray) (array);
+}
+
+static void APIENTRY Lazy_DeleteVertexArrays (GLsizei n, const GLuint *arrays)
+{
+    OGLP_ENTRY (DeleteVertexArrays) = (PFNGLDELETEVERTEXARRAYSPROC) LazyResolve ("glDeleteVertexArrays");
+    return OGLP_ENTRY (DeleteVertexArrays) (n, arrays);
+}
+
+static void APIENTRY Lazy_GenVertexArrays (GLsizei n, GLuint *arrays)
+{
+    OGLP_ENTRY (GenVertexArrays) = (PFNGLGENVERTEXARRAYSPROC) LazyResolve ("glGenVertexArrays");
+    return OGLP_ENTRY (GenVertexArrays) (n, arrays);
+}
+
+static GLboolean APIENTRY Lazy_IsVertexArray (GLuint array)
+{
+    OGLP_ENTRY (IsVertexArray) = (PFNGLISVERTEXARRAYPROC) LazyResolve ("glIsVertexArray");
+    return OGLP_ENTRY (IsVertexArray) (array);
+}
+
+static void APIENTRY Lazy_DrawArraysInstanced (GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+{
+    OGLP_ENTRY (DrawArraysInstanced) = (PFNGLDRAWARRAYSINSTANCEDPROC) LazyResolve ("glDrawArraysInstanced");
+    return OGLP_ENTRY (DrawArraysInstanced) (mode, first, count, instancecount);
+}
+
+static void APIENTRY Lazy_DrawElementsInstanced (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount)
+{
+    OGLP_ENTRY (DrawElementsInstanced) = (PFNGLDRAWELEMENTSINSTANCEDPROC) LazyResolve ("glDrawElementsInstanced");
+    return OGLP_ENTRY (DrawElementsInstanced) (mode, count, type, indices, instancecount);
+}
+
+static void APIENTRY Lazy_TexBuffer (GLenum target, GLenum internalformat, GLuint buffer)
+{
+    OGLP_ENTRY (TexBuffer) = (PFNGLTEXBUFFERPROC) LazyResolve ("glTexBuffer");
+    return OGLP_ENTRY (TexBuffer) (target, internalformat, buffer);
+}
+
+static void APIENTRY Lazy_PrimitiveRestartIndex (GLuint index)
+{
+    OGLP_ENTRY (PrimitiveRestartIndex) = (PFNGLPRIMITIVERESTARTINDEXPROC) LazyResolve ("glPrimitiveRestartIndex");
+    return OGLP_ENTRY (PrimitiveRestartIndex) (index);
+}
+
+static void APIENTRY Lazy_CopyBufferSubData (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+    OGLP_ENTRY (CopyBufferSubData) = (PFNGLCOPYBUFFERSUBDATAPROC) LazyResolve ("glCopyBufferSubData");
+    return OGLP_ENTRY (CopyBufferSubData) (readTarget, writeTarget, readOffset, writeOffset, size);
+}
+
+static void APIENTRY Lazy_GetUniformIndices (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices)
+{
+    OGLP_ENTRY (GetUniformIndices) = (PFNGLGETUNIFORMINDICESPROC) LazyResolve ("glGetUniformIndices");
+    return OGLP_ENTRY (GetUniformIndices) (program, uniformCount, uniformNames, uniformIndices);
+}
+
+static void APIENTRY Lazy_GetActiveUniformsiv (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetActiveUniformsiv) = (PFNGLGETACTIVEUNIFORMSIVPROC) LazyResolve ("glGetActiveUniformsiv");
+    return OGLP_ENTRY (GetActiveUniformsiv) (program, uniformCount, uniformIndices, pname, params);
+}
+
+static void APIENTRY Lazy_GetActiveUniformName (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName)
+{
+    OGLP_ENTRY (GetActiveUniformName) = (PFNGLGETACTIVEUNIFORMNAMEPROC) LazyResolve ("glGetActiveUniformName");
+    return OGLP_ENTRY (GetActiveUniformName) (program, uniformIndex, bufSize, length, uniformName);
+}
+
+static GLuint APIENTRY Lazy_GetUniformBlockIndex (GLuint program, const GLchar *uniformBlockName)
+{
+    OGLP_ENTRY (GetUniformBlockIndex) = (PFNGLGETUNIFORMBLOCKINDEXPROC) LazyResolve ("glGetUniformBlockIndex");
+    return OGLP_ENTRY (GetUniformBlockIndex) (program, uniformBlockName);
+}
+
+static void APIENTRY Lazy_GetActiveUniformBlockiv (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetActiveUniformBlockiv) = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC) LazyResolve ("glGetActiveUniformBlockiv");
+    return OGLP_ENTRY (GetActiveUniformBlockiv) (program, uniformBlockIndex, pname, params);
+}
+
+static void APIENTRY Lazy_GetActiveUniformBlockName (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName)
+{
+    OGLP_ENTRY (GetActiveUniformBlockName) = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC) LazyResolve ("glGetActiveUniformBlockName");
+    return OGLP_ENTRY (GetActiveUniformBlockName) (program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+
+static void APIENTRY Lazy_UniformBlockBinding (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding)
+{
+    OGLP_ENTRY (UniformBlockBinding) = (PFNGLUNIFORMBLOCKBINDINGPROC) LazyResolve ("glUniformBlockBinding");
+    return OGLP_ENTRY (UniformBlockBinding) (program, uniformBlockIndex, uniformBlockBinding);
+}
+
+static void APIENTRY Lazy_DrawElementsBaseVertex (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+{
+    OGLP_ENTRY (DrawElementsBaseVertex) = (PFNGLDRAWELEMENTSBASEVERTEXPROC) LazyResolve ("glDrawElementsBaseVertex");
+    return OGLP_ENTRY (DrawElementsBaseVertex) (mode, count, type, indices, basevertex);
+}
+
+static void APIENTRY Lazy_DrawRangeElementsBaseVertex (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+{
+    OGLP_ENTRY (DrawRangeElementsBaseVertex) = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC) LazyResolve ("glDrawRangeElementsBaseVertex");
+    return OGLP_ENTRY (DrawRangeElementsBaseVertex) (mode, start, end, count, type, indices, basevertex);
+}
+
+static void APIENTRY Lazy_DrawElementsInstancedBaseVertex (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex)
+{
+    OGLP_ENTRY (DrawElementsInstancedBaseVertex) = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC) LazyResolve ("glDrawElementsInstancedBaseVertex");
+    return OGLP_ENTRY (DrawElementsInstancedBaseVertex) (mode, count, type, indices, instancecount, basevertex);
+}
+
+static void APIENTRY Lazy_MultiDrawElementsBaseVertex (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex)
+{
+    OGLP_ENTRY (MultiDrawElementsBaseVertex) = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC) LazyResolve ("glMultiDrawElementsBaseVertex");
+    return OGLP_ENTRY (MultiDrawElementsBaseVertex) (mode, count, type, indices, drawcount, basevertex);
+}
+
+static void APIENTRY Lazy_ProvokingVertex (GLenum mode)
+{
+    OGLP_ENTRY (ProvokingVertex) = (PFNGLPROVOKINGVERTEXPROC) LazyResolve ("glProvokingVertex");
+    return OGLP_ENTRY (ProvokingVertex) (mode);
+}
+
+static GLsync APIENTRY Lazy_FenceSync (GLenum condition, GLbitfield flags)
+{
+    OGLP_ENTRY (FenceSync) = (PFNGLFENCESYNCPROC) LazyResolve ("glFenceSync");
+    return OGLP_ENTRY (FenceSync) (condition, flags);
+}
+
+static GLboolean APIENTRY Lazy_IsSync (GLsync sync)
+{
+    OGLP_ENTRY (IsSync) = (PFNGLISSYNCPROC) LazyResolve ("glIsSync");
+    return OGLP_ENTRY (IsSync) (sync);
+}
+
+static void APIENTRY Lazy_DeleteSync (GLsync sync)
+{
+    OGLP_ENTRY (DeleteSync) = (PFNGLDELETESYNCPROC) LazyResolve ("glDeleteSync");
+    return OGLP_ENTRY (DeleteSync) (sync);
+}
+
+static GLenum APIENTRY Lazy_ClientWaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    OGLP_ENTRY (ClientWaitSync) = (PFNGLCLIENTWAITSYNCPROC) LazyResolve ("glClientWaitSync");
+    return OGLP_ENTRY (ClientWaitSync) (sync, flags, timeout);
+}
+
+static void APIENTRY Lazy_WaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    OGLP_ENTRY (WaitSync) = (PFNGLWAITSYNCPROC) LazyResolve ("glWaitSync");
+    return OGLP_ENTRY (WaitSync) (sync, flags, timeout);
+}
+
+static void APIENTRY Lazy_GetInteger64v (GLenum pname, GLint64 *data)
+{
+    OGLP_ENTRY (GetInteger64v) = (PFNGLGETINTEGER64VPROC) LazyResolve ("glGetInteger64v");
+    return OGLP_ENTRY (GetInteger64v) (pname, data);
+}
+
+static void APIENTRY Lazy_GetSynciv (GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values)
+{
+    OGLP_ENTRY (GetSynciv) = (PFNGLGETSYNCIVPROC) LazyResolve ("glGetSynciv");
+    return OGLP_ENTRY (GetSynciv) (sync, pname, bufSize, length, values);
+}
+
+static void APIENTRY Lazy_GetInteger64i_v (GLenum target, GLuint index, GLint64 *data)
+{
+    OGLP_ENTRY (GetInteger64i_v) = (PFNGLGETINTEGER64I_VPROC) LazyResolve ("glGetInteger64i_v");
+    return OGLP_ENTRY (GetInteger64i_v) (target, index, data);
+}
+
+static void APIENTRY Lazy_GetBufferParameteri64v (GLenum target, GLenum pname, GLint64 *params)
+{
+    OGLP_ENTRY (GetBufferParameteri64v) = (PFNGLGETBUFFERPARAMETERI64VPROC) LazyResolve ("glGetBufferParameteri64v");
+    return OGLP_ENTRY (GetBufferParameteri64v) (target, pname, params);
+}
+
+static void APIENTRY Lazy_FramebufferTexture (GLenum target, GLenum attachment, GLuint texture, GLint level)
+{
+    OGLP_ENTRY (FramebufferTexture) = (PFNGLFRAMEBUFFERTEXTUREPROC) LazyResolve ("glFramebufferTexture");
+    return OGLP_ENTRY (FramebufferTexture) (target, attachment, texture, level);
+}
+
+static void APIENTRY Lazy_TexImage2DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+    OGLP_ENTRY (TexImage2DMultisample) = (PFNGLTEXIMAGE2DMULTISAMPLEPROC) LazyResolve ("glTexImage2DMultisample");
+    return OGLP_ENTRY (TexImage2DMultisample) (target, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static void APIENTRY Lazy_TexImage3DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+    OGLP_ENTRY (TexImage3DMultisample) = (PFNGLTEXIMAGE3DMULTISAMPLEPROC) LazyResolve ("glTexImage3DMultisample");
+    return OGLP_ENTRY (TexImage3DMultisample) (target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+static void APIENTRY Lazy_GetMultisamplefv (GLenum pname, GLuint index, GLfloat *val)
+{
+    OGLP_ENTRY (GetMultisamplefv) = (PFNGLGETMULTISAMPLEFVPROC) LazyResolve ("glGetMultisamplefv");
+    return OGLP_ENTRY (GetMultisamplefv) (pname, index, val);
+}
+
+static void APIENTRY Lazy_SampleMaski (GLuint maskNumber, GLbitfield mask)
+{
+    OGLP_ENTRY (SampleMaski) = (PFNGLSAMPLEMASKIPROC) LazyResolve ("glSampleMaski");
+    return OGLP_ENTRY (SampleMaski) (maskNumber, mask);
+}
+
+static void APIENTRY Lazy_BindFragDataLocationIndexed (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name)
+{
+    OGLP_ENTRY (BindFragDataLocationIndexed) = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC) LazyResolve ("glBindFragDataLocationIndexed");
+    return OGLP_ENTRY (BindFragDataLocationIndexed) (program, colorNumber, index, name);
+}
+
+static GLint APIENTRY Lazy_GetFragDataIndex (GLuint program, const GLchar *name)
+{
+    OGLP_ENTRY (GetFragDataIndex) = (PFNGLGETFRAGDATAINDEXPROC) LazyResolve ("glGetFragDataIndex");
+    return OGLP_ENTRY (GetFragDataIndex) (program, name);
+}
+
+static void APIENTRY Lazy_GenSamplers (GLsizei count, GLuint *samplers)
+{
+    OGLP_ENTRY (GenSamplers) = (PFNGLGENSAMPLERSPROC) LazyResolve ("glGenSamplers");
+    return OGLP_ENTRY (GenSamplers) (count, samplers);
+}
+
+static void APIENTRY Lazy_DeleteSamplers (GLsizei count, const GLuint *samplers)
+{
+    OGLP_ENTRY (DeleteSamplers) = (PFNGLDELETESAMPLERSPROC) LazyResolve ("glDeleteSamplers");
+    return OGLP_ENTRY (DeleteSamplers) (count, samplers);
+}
+
+static GLboolean APIENTRY Lazy_IsSampler (GLuint sampler)
+{
+    OGLP_ENTRY (IsSampler) = (PFNGLISSAMPLERPROC) LazyResolve ("glIsSampler");
+    return OGLP_ENTRY (IsSampler) (sampler);
+}
+
+static void APIENTRY Lazy_BindSampler (GLuint unit, GLuint sampler)
+{
+    OGLP_ENTRY (BindSampler) = (PFNGLBINDSAMPLERPROC) LazyResolve ("glBindSampler");
+    return OGLP_ENTRY (BindSampler) (unit, sampler);
+}
+
+static void APIENTRY Lazy_SamplerParameteri (GLuint sampler, GLenum pname, GLint param)
+{
+    OGLP_ENTRY (SamplerParameteri) = (PFNGLSAMPLERPARAMETERIPROC) LazyResolve ("glSamplerParameteri");
+    return OGLP_ENTRY (SamplerParameteri) (sampler, pname, param);
+}
+
+static void APIENTRY Lazy_SamplerParameteriv (GLuint sampler, GLenum pname, const GLint *param)
+{
+    OGLP_ENTRY (SamplerParameteriv) = (PFNGLSAMPLERPARAMETERIVPROC) LazyResolve ("glSamplerParameteriv");
+    return OGLP_ENTRY (SamplerParameteriv) (sampler, pname, param);
+}
+
+static void APIENTRY Lazy_SamplerParameterf (GLuint sampler, GLenum pname, GLfloat param)
+{
+    OGLP_ENTRY (SamplerParameterf) = (PFNGLSAMPLERPARAMETERFPROC) LazyResolve ("glSamplerParameterf");
+    return OGLP_ENTRY (SamplerParameterf) (sampler, pname, param);
+}
+
+static void APIENTRY Lazy_SamplerParameterfv (GLuint sampler, GLenum pname, const GLfloat *param)
+{
+    OGLP_ENTRY (SamplerParameterfv) = (PFNGLSAMPLERPARAMETERFVPROC) LazyResolve ("glSamplerParameterfv");
+    return OGLP_ENTRY (SamplerParameterfv) (sampler, pname, param);
+}
+
+static void APIENTRY Lazy_SamplerParameterIiv (GLuint sampler, GLenum pname, const GLint *param)
+{
+    OGLP_ENTRY (SamplerParameterIiv) = (PFNGLSAMPLERPARAMETERIIVPROC) LazyResolve ("glSamplerParameterIiv");
+    return OGLP_ENTRY (SamplerParameterIiv) (sampler, pname, param);
+}
+
+static void APIENTRY Lazy_SamplerParameterIuiv (GLuint sampler, GLenum pname, const GLuint *param)
+{
+    OGLP_ENTRY (SamplerParameterIuiv) = (PFNGLSAMPLERPARAMETERIUIVPROC) LazyResolve ("glSamplerParameterIuiv");
+    return OGLP_ENTRY (SamplerParameterIuiv) (sampler, pname, param);
+}
+
+static void APIENTRY Lazy_GetSamplerParameteriv (GLuint sampler, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetSamplerParameteriv) = (PFNGLGETSAMPLERPARAMETERIVPROC) LazyResolve ("glGetSamplerParameteriv");
+    return OGLP_ENTRY (GetSamplerParameteriv) (sampler, pname, params);
+}
+
+static void APIENTRY Lazy_GetSamplerParameterIiv (GLuint sampler, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetSamplerParameterIiv) = (PFNGLGETSAMPLERPARAMETERIIVPROC) LazyResolve ("glGetSamplerParameterIiv");
+    return OGLP_ENTRY (GetSamplerParameterIiv) (sampler, pname, params);
+}
+
+static void APIENTRY Lazy_GetSamplerParameterfv (GLuint sampler, GLenum pname, GLfloat *params)
+{
+    OGLP_ENTRY (GetSamplerParameterfv) = (PFNGLGETSAMPLERPARAMETERFVPROC) LazyResolve ("glGetSamplerParameterfv");
+    return OGLP_ENTRY (GetSamplerParameterfv) (sampler, pname, params);
+}
+
+static void APIENTRY Lazy_GetSamplerParameterIuiv (GLuint sampler, GLenum pname, GLuint *params)
+{
+    OGLP_ENTRY (GetSamplerParameterIuiv) = (PFNGLGETSAMPLERPARAMETERIUIVPROC) LazyResolve ("glGetSamplerParameterIuiv");
+    return OGLP_ENTRY (GetSamplerParameterIuiv) (sampler, pname, params);
+}
+
+static void APIENTRY Lazy_QueryCounter (GLuint id, GLenum target)
+{
+    OGLP_ENTRY (QueryCounter) = (PFNGLQUERYCOUNTERPROC) LazyResolve ("glQueryCounter");
+    return OGLP_ENTRY (QueryCounter) (id, target);
+}
+
+static void APIENTRY Lazy_GetQueryObjecti64v (GLuint id, GLenum pname, GLint64 *params)
+{
+    OGLP_ENTRY (GetQueryObjecti64v) = (PFNGLGETQUERYOBJECTI64VPROC) LazyResolve ("glGetQueryObjecti64v");
+    return OGLP_ENTRY (GetQueryObjecti64v) (id, pname, params);
+}
+
+static void APIENTRY Lazy_GetQueryObjectui64v (GLuint id, GLenum pname, GLuint64 *params)
+{
+    OGLP_ENTRY (GetQueryObjectui64v) = (PFNGLGETQUERYOBJECTUI64VPROC) LazyResolve ("glGetQueryObjectui64v");
+    return OGLP_ENTRY (GetQueryObjectui64v) (id, pname, params);
+}
+
+static void APIENTRY Lazy_VertexAttribDivisor (GLuint index, GLuint divisor)
+{
+    OGLP_ENTRY (VertexAttribDivisor) = (PFNGLVERTEXATTRIBDIVISORPROC) LazyResolve ("glVertexAttribDivisor");
+    return OGLP_ENTRY (VertexAttribDivisor) (index, divisor);
+}
+
+static void APIENTRY Lazy_VertexAttribP1ui (GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    OGLP_ENTRY (VertexAttribP1ui) = (PFNGLVERTEXATTRIBP1UIPROC) LazyResolve ("glVertexAttribP1ui");
+    return OGLP_ENTRY (VertexAttribP1ui) (index, type, normalized, value);
+}
+
+static void APIENTRY Lazy_VertexAttribP1uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    OGLP_ENTRY (VertexAttribP1uiv) = (PFNGLVERTEXATTRIBP1UIVPROC) LazyResolve ("glVertexAttribP1uiv");
+    return OGLP_ENTRY (VertexAttribP1uiv) (index, type, normalized, value);
+}
+
+static void APIENTRY Lazy_VertexAttribP2ui (GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    OGLP_ENTRY (VertexAttribP2ui) = (PFNGLVERTEXATTRIBP2UIPROC) LazyResolve ("glVertexAttribP2ui");
+    return OGLP_ENTRY (VertexAttribP2ui) (index, type, normalized, value);
+}
+
+static void APIENTRY Lazy_VertexAttribP2uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    OGLP_ENTRY (VertexAttribP2uiv) = (PFNGLVERTEXATTRIBP2UIVPROC) LazyResolve ("glVertexAttribP2uiv");
+    return OGLP_ENTRY (VertexAttribP2uiv) (index, type, normalized, value);
+}
+
+static void APIENTRY Lazy_VertexAttribP3ui (GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    OGLP_ENTRY (VertexAttribP3ui) = (PFNGLVERTEXATTRIBP3UIPROC) LazyResolve ("glVertexAttribP3ui");
+    return OGLP_ENTRY (VertexAttribP3ui) (index, type, normalized, value);
+}
+
+static void APIENTRY Lazy_VertexAttribP3uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    OGLP_ENTRY (VertexAttribP3uiv) = (PFNGLVERTEXATTRIBP3UIVPROC) LazyResolve ("glVertexAttribP3uiv");
+    return OGLP_ENTRY (VertexAttribP3uiv) (index, type, normalized, value);
+}
+
+static void APIENTRY Lazy_VertexAttribP4ui (GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    OGLP_ENTRY (VertexAttribP4ui) = (PFNGLVERTEXATTRIBP4UIPROC) LazyResolve ("glVertexAttribP4ui");
+    return OGLP_ENTRY (VertexAttribP4ui) (index, type, normalized, value);
+}
+
+static void APIENTRY Lazy_VertexAttribP4uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    OGLP_ENTRY (VertexAttribP4uiv) = (PFNGLVERTEXATTRIBP4UIVPROC) LazyResolve ("glVertexAttribP4uiv");
+    return OGLP_ENTRY (VertexAttribP4uiv) (index, type, normalized, value);
+}
+
+static void APIENTRY Lazy_MinSampleShading (GLfloat value)
+{
+    OGLP_ENTRY (MinSampleShading) = (PFNGLMINSAMPLESHADINGPROC) LazyResolve ("glMinSampleShading");
+    return OGLP_ENTRY (MinSampleShading) (value);
+}
+
+static void APIENTRY Lazy_BlendEquationi (GLuint buf, GLenum mode)
+{
+    OGLP_ENTRY (BlendEquationi) = (PFNGLBLENDEQUATIONIPROC) LazyResolve ("glBlendEquationi");
+    return OGLP_ENTRY (BlendEquationi) (buf, mode);
+}
+
+static void APIENTRY Lazy_BlendEquationSeparatei (GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+    OGLP_ENTRY (BlendEquationSeparatei) = (PFNGLBLENDEQUATIONSEPARATEIPROC) LazyResolve ("glBlendEquationSeparatei");
+    return OGLP_ENTRY (BlendEquationSeparatei) (buf, modeRGB, modeAlpha);
+}
+
+static void APIENTRY Lazy_BlendFunci (GLuint buf, GLenum src, GLenum dst)
+{
+    OGLP_ENTRY (BlendFunci) = (PFNGLBLENDFUNCIPROC) LazyResolve ("glBlendFunci");
+    return OGLP_ENTRY (BlendFunci) (buf, src, dst);
+}
+
+static void APIENTRY Lazy_BlendFuncSeparatei (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+    OGLP_ENTRY (BlendFuncSeparatei) = (PFNGLBLENDFUNCSEPARATEIPROC) LazyResolve ("glBlendFuncSeparatei");
+    return OGLP_ENTRY (BlendFuncSeparatei) (buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+
+static void APIENTRY Lazy_DrawArraysIndirect (GLenum mode, const void *indirect)
+{
+    OGLP_ENTRY (DrawArraysIndirect) = (PFNGLDRAWARRAYSINDIRECTPROC) LazyResolve ("glDrawArraysIndirect");
+    return OGLP_ENTRY (DrawArraysIndirect) (mode, indirect);
+}
+
+static void APIENTRY Lazy_DrawElementsIndirect (GLenum mode, GLenum type, const void *indirect)
+{
+    OGLP_ENTRY (DrawElementsIndirect) = (PFNGLDRAWELEMENTSINDIRECTPROC) LazyResolve ("glDrawElementsIndirect");
+    return OGLP_ENTRY (DrawElementsIndirect) (mode, type, indirect);
+}
+
+static void APIENTRY Lazy_Uniform1d (GLint location, GLdouble x)
+{
+    OGLP_ENTRY (Uniform1d) = (PFNGLUNIFORM1DPROC) LazyResolve ("glUniform1d");
+    return OGLP_ENTRY (Uniform1d) (location, x);
+}
+
+static void APIENTRY Lazy_Uniform2d (GLint location, GLdouble x, GLdouble y)
+{
+    OGLP_ENTRY (Uniform2d) = (PFNGLUNIFORM2DPROC) LazyResolve ("glUniform2d");
+    return OGLP_ENTRY (Uniform2d) (location, x, y);
+}
+
+static void APIENTRY Lazy_Uniform3d (GLint location, GLdouble x, GLdouble y, GLdouble z)
+{
+    OGLP_ENTRY (Uniform3d) = (PFNGLUNIFORM3DPROC) LazyResolve ("glUniform3d");
+    return OGLP_ENTRY (Uniform3d) (location, x, y, z);
+}
+
+static void APIENTRY Lazy_Uniform4d (GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    OGLP_ENTRY (Uniform4d) = (PFNGLUNIFORM4DPROC) LazyResolve ("glUniform4d");
+    return OGLP_ENTRY (Uniform4d) (location, x, y, z, w);
+}
+
+static void APIENTRY Lazy_Uniform1dv (GLint location, GLsizei count, const GLdouble *value)
+{
+    OGLP_ENTRY (Uniform1dv) = (PFNGLUNIFORM1DVPROC) LazyResolve ("glUniform1dv");
+    return OGLP_ENTRY (Uniform1dv) (location, count, value);
+}
+
+static void APIENTRY Lazy_Uniform2dv (GLint location, GLsizei count, const GLdouble *value)
+{
+    OGLP_ENTRY (Uniform2dv) = (PFNGLUNIFORM2DVPROC) LazyResolve ("glUniform2dv");
+    return OGLP_ENTRY (Uniform2dv) (location, count, value);
+}
+
+static void APIENTRY Lazy_Uniform3dv (GLint location, GLsizei count, const GLdouble *value)
+{
+    OGLP_ENTRY (Uniform3dv) = (PFNGLUNIFORM3DVPROC) LazyResolve ("glUniform3dv");
+    return OGLP_ENTRY (Uniform3dv) (location, count, value);
+}
+
+static void APIENTRY Lazy_Uniform4dv (GLint location, GLsizei count, const GLdouble *value)
+{
+    OGLP_ENTRY (Uniform4dv) = (PFNGLUNIFORM4DVPROC) LazyResolve ("glUniform4dv");
+    return OGLP_ENTRY (Uniform4dv) (location, count, value);
+}
+
+static void APIENTRY Lazy_UniformMatrix2dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    OGLP_ENTRY (UniformMatrix2dv) = (PFNGLUNIFORMMATRIX2DVPROC) LazyResolve ("glUniformMatrix2dv");
+    return OGLP_ENTRY (UniformMatrix2dv) (location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_UniformMatrix3dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    OGLP_ENTRY (UniformMatrix3dv) = (PFNGLUNIFORMMATRIX3DVPROC) LazyResolve ("glUniformMatrix3dv");
+    return OGLP_ENTRY (UniformMatrix3dv) (location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_UniformMatrix4dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    OGLP_ENTRY (UniformMatrix4dv) = (PFNGLUNIFORMMATRIX4DVPROC) LazyResolve ("glUniformMatrix4dv");
+    return OGLP_ENTRY (UniformMatrix4dv) (location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_UniformMatrix2x3dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    OGLP_ENTRY (UniformMatrix2x3dv) = (PFNGLUNIFORMMATRIX2X3DVPROC) LazyResolve ("glUniformMatrix2x3dv");
+    return OGLP_ENTRY (UniformMatrix2x3dv) (location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_UniformMatrix2x4dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    OGLP_ENTRY (UniformMatrix2x4dv) = (PFNGLUNIFORMMATRIX2X4DVPROC) LazyResolve ("glUniformMatrix2x4dv");
+    return OGLP_ENTRY (UniformMatrix2x4dv) (location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_UniformMatrix3x2dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    OGLP_ENTRY (UniformMatrix3x2dv) = (PFNGLUNIFORMMATRIX3X2DVPROC) LazyResolve ("glUniformMatrix3x2dv");
+    return OGLP_ENTRY (UniformMatrix3x2dv) (location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_UniformMatrix3x4dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    OGLP_ENTRY (UniformMatrix3x4dv) = (PFNGLUNIFORMMATRIX3X4DVPROC) LazyResolve ("glUniformMatrix3x4dv");
+    return OGLP_ENTRY (UniformMatrix3x4dv) (location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_UniformMatrix4x2dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    OGLP_ENTRY (UniformMatrix4x2dv) = (PFNGLUNIFORMMATRIX4X2DVPROC) LazyResolve ("glUniformMatrix4x2dv");
+    return OGLP_ENTRY (UniformMatrix4x2dv) (location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_UniformMatrix4x3dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    OGLP_ENTRY (UniformMatrix4x3dv) = (PFNGLUNIFORMMATRIX4X3DVPROC) LazyResolve ("glUniformMatrix4x3dv");
+    return OGLP_ENTRY (UniformMatrix4x3dv) (location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_GetUniformdv (GLuint program, GLint location, GLdouble *params)
+{
+    OGLP_ENTRY (GetUniformdv) = (PFNGLGETUNIFORMDVPROC) LazyResolve ("glGetUniformdv");
+    return OGLP_ENTRY (GetUniformdv) (program, location, params);
+}
+
+static GLint APIENTRY Lazy_GetSubroutineUniformLocation (GLuint program, GLenum shadertype, const GLchar *name)
+{
+    OGLP_ENTRY (GetSubroutineUniformLocation) = (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC) LazyResolve ("glGetSubroutineUniformLocation");
+    return OGLP_ENTRY (GetSubroutineUniformLocation) (program, shadertype, name);
+}
+
+static GLuint APIENTRY Lazy_GetSubroutineIndex (GLuint program, GLenum shadertype, const GLchar *name)
+{
+    OGLP_ENTRY (GetSubroutineIndex) = (PFNGLGETSUBROUTINEINDEXPROC) LazyResolve ("glGetSubroutineIndex");
+    return OGLP_ENTRY (GetSubroutineIndex) (program, shadertype, name);
+}
+
+static void APIENTRY Lazy_GetActiveSubroutineUniformiv (GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values)
+{
+    OGLP_ENTRY (GetActiveSubroutineUniformiv) = (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC) LazyResolve ("glGetActiveSubroutineUniformiv");
+    return OGLP_ENTRY (GetActiveSubroutineUniformiv) (program, shadertype, index, pname, values);
+}
+
+static void APIENTRY Lazy_GetActiveSubroutineUniformName (GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name)
+{
+    OGLP_ENTRY (GetActiveSubroutineUniformName) = (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC) LazyResolve ("glGetActiveSubroutineUniformName");
+    return OGLP_ENTRY (GetActiveSubroutineUniformName) (program, shadertype, index, bufsize, length, name);
+}
+
+static void APIENTRY Lazy_GetActiveSubroutineName (GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name)
+{
+    OGLP_ENTRY (GetActiveSubroutineName) = (PFNGLGETACTIVESUBROUTINENAMEPROC) LazyResolve ("glGetActiveSubroutineName");
+    return OGLP_ENTRY (GetActiveSubroutineName) (program, shadertype, index, bufsize, length, name);
+}
+
+static void APIENTRY Lazy_UniformSubroutinesuiv (GLenum shadertype, GLsizei count, const GLuint *indices)
+{
+    OGLP_ENTRY (UniformSubroutinesuiv) = (PFNGLUNIFORMSUBROUTINESUIVPROC) LazyResolve ("glUniformSubroutinesuiv");
+    return OGLP_ENTRY (UniformSubroutinesuiv) (shadertype, count, indices);
+}
+
+static void APIENTRY Lazy_GetUniformSubroutineuiv (GLenum shadertype, GLint location, GLuint *params)
+{
+    OGLP_ENTRY (GetUniformSubroutineuiv) = (PFNGLGETUNIFORMSUBROUTINEUIVPROC) LazyResolve ("glGetUniformSubroutineuiv");
+    return OGLP_ENTRY (GetUniformSubroutineuiv) (shadertype, location, params);
+}
+
+static void APIENTRY Lazy_GetProgramStageiv (GLuint program, GLenum shadertype, GLenum pname, GLint *values)
+{
+    OGLP_ENTRY (GetProgramStageiv) = (PFNGLGETPROGRAMSTAGEIVPROC) LazyResolve ("glGetProgramStageiv");
+    return OGLP_ENTRY (GetProgramStageiv) (program, shadertype, pname, values);
+}
+
+static void APIENTRY Lazy_PatchParameteri (GLenum pname, GLint value)
+{
+    OGLP_ENTRY (PatchParameteri) = (PFNGLPATCHPARAMETERIPROC) LazyResolve ("glPatchParameteri");
+    return OGLP_ENTRY (PatchParameteri) (pname, value);
+}
+
+static void APIENTRY Lazy_PatchParameterfv (GLenum pname, const GLfloat *values)
+{
+    OGLP_ENTRY (PatchParameterfv) = (PFNGLPATCHPARAMETERFVPROC) LazyResolve ("glPatchParameterfv");
+    return OGLP_ENTRY (PatchParameterfv) (pname, values);
+}
+
+static void APIENTRY Lazy_BindTransformFeedback (GLenum target, GLuint id)
+{
+    OGLP_ENTRY (BindTransformFeedback) = (PFNGLBINDTRANSFORMFEEDBACKPROC) LazyResolve ("glBindTransformFeedback");
+    return OGLP_ENTRY (BindTransformFeedback) (target, id);
+}
+
+static void APIENTRY Lazy_DeleteTransformFeedbacks (GLsizei n, const GLuint *ids)
+{
+    OGLP_ENTRY (DeleteTransformFeedbacks) = (PFNGLDELETETRANSFORMFEEDBACKSPROC) LazyResolve ("glDeleteTransformFeedbacks");
+    return OGLP_ENTRY (DeleteTransformFeedbacks) (n, ids);
+}
+
+static void APIENTRY Lazy_GenTransformFeedbacks (GLsizei n, GLuint *ids)
+{
+    OGLP_ENTRY (GenTransformFeedbacks) = (PFNGLGENTRANSFORMFEEDBACKSPROC) LazyResolve ("glGenTransformFeedbacks");
+    return OGLP_ENTRY (GenTransformFeedbacks) (n, ids);
+}
+
+static GLboolean APIENTRY Lazy_IsTransformFeedback (GLuint id)
+{
+    OGLP_ENTRY (IsTransformFeedback) = (PFNGLISTRANSFORMFEEDBACKPROC) LazyResolve ("glIsTransformFeedback");
+    return OGLP_ENTRY (IsTransformFeedback) (id);
+}
+
+static void APIENTRY Lazy_PauseTransformFeedback (void)
+{
+    OGLP_ENTRY (PauseTransformFeedback) = (PFNGLPAUSETRANSFORMFEEDBACKPROC) LazyResolve ("glPauseTransformFeedback");
+    return OGLP_ENTRY (PauseTransformFeedback) ();
+}
+
+static void APIENTRY Lazy_ResumeTransformFeedback (void)
+{
+    OGLP_ENTRY (ResumeTransformFeedback) = (PFNGLRESUMETRANSFORMFEEDBACKPROC) LazyResolve ("glResumeTransformFeedback");
+    return OGLP_ENTRY (ResumeTransformFeedback) ();
+}
+
+static void APIENTRY Lazy_DrawTransformFeedback (GLenum mode, GLuint id)
+{
+    OGLP_ENTRY (DrawTransformFeedback) = (PFNGLDRAWTRANSFORMFEEDBACKPROC) LazyResolve ("glDrawTransformFeedback");
+    return OGLP_ENTRY (DrawTransformFeedback) (mode, id);
+}
+
+static void APIENTRY Lazy_DrawTransformFeedbackStream (GLenum mode, GLuint id, GLuint stream)
+{
+    OGLP_ENTRY (DrawTransformFeedbackStream) = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC) LazyResolve ("glDrawTransformFeedbackStream");
+    return OGLP_ENTRY (DrawTransformFeedbackStream) (mode, id, stream);
+}
+
+static void APIENTRY Lazy_BeginQueryIndexed (GLenum target, GLuint index, GLuint id)
+{
+    OGLP_ENTRY (BeginQueryIndexed) = (PFNGLBEGINQUERYINDEXEDPROC) LazyResolve ("glBeginQueryIndexed");
+    return OGLP_ENTRY (BeginQueryIndexed) (target, index, id);
+}
+
+static void APIENTRY Lazy_EndQueryIndexed (GLenum target, GLuint index)
+{
+    OGLP_ENTRY (EndQueryIndexed) = (PFNGLENDQUERYINDEXEDPROC) LazyResolve ("glEndQueryIndexed");
+    return OGLP_ENTRY (EndQueryIndexed) (target, index);
+}
+
+static void APIENTRY Lazy_GetQueryIndexediv (GLenum target, GLuint index, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetQueryIndexediv) = (PFNGLGETQUERYINDEXEDIVPROC) LazyResolve ("glGetQueryIndexediv");
+    return OGLP_ENTRY (GetQueryIndexediv) (target, index, pname, params);
+}
+
+static void APIENTRY Lazy_ReleaseShaderCompiler (void)
+{
+    OGLP_ENTRY (ReleaseShaderCompiler) = (PFNGLRELEASESHADERCOMPILERPROC) LazyResolve ("glReleaseShaderCompiler");
+    return OGLP_ENTRY (ReleaseShaderCompiler) ();
+}
+
+static void APIENTRY Lazy_ShaderBinary (GLsizei count, const GLuint *shaders, GLenum binaryformat, const void *binary, GLsizei length)
+{
+    OGLP_ENTRY (ShaderBinary) = (PFNGLSHADERBINARYPROC) LazyResolve ("glShaderBinary");
+    return OGLP_ENTRY (ShaderBinary) (count, shaders, binaryformat, binary, length);
+}
+
+static void APIENTRY Lazy_GetShaderPrecisionFormat (GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision)
+{
+    OGLP_ENTRY (GetShaderPrecisionFormat) = (PFNGLGETSHADERPRECISIONFORMATPROC) LazyResolve ("glGetShaderPrecisionFormat");
+    return OGLP_ENTRY (GetShaderPrecisionFormat) (shadertype, precisiontype, range, precision);
+}
+
+static void APIENTRY Lazy_DepthRangef (GLfloat n, GLfloat f)
+{
+    OGLP_ENTRY (DepthRangef) = (PFNGLDEPTHRANGEFPROC) LazyResolve ("glDepthRangef");
+    return OGLP_ENTRY (DepthRangef) (n, f);
+}
+
+static void APIENTRY Lazy_ClearDepthf (GLfloat d)
+{
+    OGLP_ENTRY (ClearDepthf) = (PFNGLCLEARDEPTHFPROC) LazyResolve ("glClearDepthf");
+    return OGLP_ENTRY (ClearDepthf) (d);
+}
+
+static void APIENTRY Lazy_GetProgramBinary (GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary)
+{
+    OGLP_ENTRY (GetProgramBinary) = (PFNGLGETPROGRAMBINARYPROC) LazyResolve ("glGetProgramBinary");
+    return OGLP_ENTRY (GetProgramBinary) (program, bufSize, length, binaryFormat, binary);
+}
+
+static void APIENTRY Lazy_ProgramBinary (GLuint program, GLenum binaryFormat, const void *binary, GLsizei length)
+{
+    OGLP_ENTRY (ProgramBinary) = (PFNGLPROGRAMBINARYPROC) LazyResolve ("glProgramBinary");
+    return OGLP_ENTRY (ProgramBinary) (program, binaryFormat, binary, length);
+}
+
+static void APIENTRY Lazy_ProgramParameteri (GLuint program, GLenum pname, GLint value)
+{
+    OGLP_ENTRY (ProgramParameteri) = (PFNGLPROGRAMPARAMETERIPROC) LazyResolve ("glProgramParameteri");
+    return OGLP_ENTRY (ProgramParameteri) (program, pname, value);
+}
+
+static void APIENTRY Lazy_UseProgramStages (GLuint pipeline, GLbitfield stages, GLuint program)
+{
+    OGLP_ENTRY (UseProgramStages) = (PFNGLUSEPROGRAMSTAGESPROC) LazyResolve ("glUseProgramStages");
+    return OGLP_ENTRY (UseProgramStages) (pipeline, stages, program);
+}
+
+static void APIENTRY Lazy_ActiveShaderProgram (GLuint pipeline, GLuint program)
+{
+    OGLP_ENTRY (ActiveShaderProgram) = (PFNGLACTIVESHADERPROGRAMPROC) LazyResolve ("glActiveShaderProgram");
+    return OGLP_ENTRY (ActiveShaderProgram) (pipeline, program);
+}
+
+static GLuint APIENTRY Lazy_CreateShaderProgramv (GLenum type, GLsizei count, const GLchar *const*strings)
+{
+    OGLP_ENTRY (CreateShaderProgramv) = (PFNGLCREATESHADERPROGRAMVPROC) LazyResolve ("glCreateShaderProgramv");
+    return OGLP_ENTRY (CreateShaderProgramv) (type, count, strings);
+}
+
+static void APIENTRY Lazy_BindProgramPipeline (GLuint pipeline)
+{
+    OGLP_ENTRY (BindProgramPipeline) = (PFNGLBINDPROGRAMPIPELINEPROC) LazyResolve ("glBindProgramPipeline");
+    return OGLP_ENTRY (BindProgramPipeline) (pipeline);
+}
+
+static void APIENTRY Lazy_DeleteProgramPipelines (GLsizei n, const GLuint *pipelines)
+{
+    OGLP_ENTRY (DeleteProgramPipelines) = (PFNGLDELETEPROGRAMPIPELINESPROC) LazyResolve ("glDeleteProgramPipelines");
+    return OGLP_ENTRY (DeleteProgramPipelines) (n, pipelines);
+}
+
+static void APIENTRY Lazy_GenProgramPipelines (GLsizei n, GLuint *pipelines)
+{
+    OGLP_ENTRY (GenProgramPipelines) = (PFNGLGENPROGRAMPIPELINESPROC) LazyResolve ("glGenProgramPipelines");
+    return OGLP_ENTRY (GenProgramPipelines) (n, pipelines);
+}
+
+static GLboolean APIENTRY Lazy_IsProgramPipeline (GLuint pipeline)
+{
+    OGLP_ENTRY (IsProgramPipeline) = (PFNGLISPROGRAMPIPELINEPROC) LazyResolve ("glIsProgramPipeline");
+    return OGLP_ENTRY (IsProgramPipeline) (pipeline);
+}
+
+static void APIENTRY Lazy_GetProgramPipelineiv (GLuint pipeline, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetProgramPipelineiv) = (PFNGLGETPROGRAMPIPELINEIVPROC) LazyResolve ("glGetProgramPipelineiv");
+    return OGLP_ENTRY (GetProgramPipelineiv) (pipeline, pname, params);
+}
+
+static void APIENTRY Lazy_ProgramUniform1i (GLuint program, GLint location, GLint v0)
+{
+    OGLP_ENTRY (ProgramUniform1i) = (PFNGLPROGRAMUNIFORM1IPROC) LazyResolve ("glProgramUniform1i");
+    return OGLP_ENTRY (ProgramUniform1i) (program, location, v0);
+}
+
+static void APIENTRY Lazy_ProgramUniform1iv (GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+    OGLP_ENTRY (ProgramUniform1iv) = (PFNGLPROGRAMUNIFORM1IVPROC) LazyResolve ("glProgramUniform1iv");
+    return OGLP_ENTRY (ProgramUniform1iv) (program, location, count, value);
+}
+
+static void APIENTRY Lazy_ProgramUniform1f (GLuint program, GLint location, GLfloat v0)
+{
+    OGLP_ENTRY (ProgramUniform1f) = (PFNGLPROGRAMUNIFORM1FPROC) LazyResolve ("glProgramUniform1f");
+    return OGLP_ENTRY (ProgramUniform1f) (program, location, v0);
+}
+
+static void APIENTRY Lazy_ProgramUniform1fv (GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+    OGLP_ENTRY (ProgramUniform1fv) = (PFNGLPROGRAMUNIFORM1FVPROC) LazyResolve ("glProgramUniform1fv");
+    return OGLP_ENTRY (ProgramUniform1fv) (program, location, count, value);
+}
+
+static void APIENTRY Lazy_ProgramUniform1d (GLuint program, GLint location, GLdouble v0)
+{
+    OGLP_ENTRY (ProgramUniform1d) = (PFNGLPROGRAMUNIFORM1DPROC) LazyResolve ("glProgramUniform1d");
+    return OGLP_ENTRY (ProgramUniform1d) (program, location, v0);
+}
+
+static void APIENTRY Lazy_ProgramUniform1dv (GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+    OGLP_ENTRY (ProgramUniform1dv) = (PFNGLPROGRAMUNIFORM1DVPROC) LazyResolve ("glProgramUniform1dv");
+    return OGLP_ENTRY (ProgramUniform1dv) (program, location, count, value);
+}
+
+static void APIENTRY Lazy_ProgramUniform1ui (GLuint program, GLint location, GLuint v0)
+{
+    OGLP_ENTRY (ProgramUniform1ui) = (PFNGLPROGRAMUNIFORM1UIPROC) LazyResolve ("glProgramUniform1ui");
+    return OGLP_ENTRY (ProgramUniform1ui) (program, location, v0);
+}
+
+static void APIENTRY Lazy_ProgramUniform1uiv (GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+    OGLP_ENTRY (ProgramUniform1uiv) = (PFNGLPROGRAMUNIFORM1UIVPROC) LazyResolve ("glProgramUniform1uiv");
+    return OGLP_ENTRY (ProgramUniform1uiv) (program, location, count, value);
+}
+
+static void APIENTRY Lazy_ProgramUniform2i (GLuint program, GLint location, GLint v0, GLint v1)
+{
+    OGLP_ENTRY (ProgramUniform2i) = (PFNGLPROGRAMUNIFORM2IPROC) LazyResolve ("glProgramUniform2i");
+    return OGLP_ENTRY (ProgramUniform2i) (program, location, v0, v1);
+}
+
+static void APIENTRY Lazy_ProgramUniform2iv (GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+    OGLP_ENTRY (ProgramUniform2iv) = (PFNGLPROGRAMUNIFORM2IVPROC) LazyResolve ("glProgramUniform2iv");
+    return OGLP_ENTRY (ProgramUniform2iv) (program, location, count, value);
+}
+
+static void APIENTRY Lazy_ProgramUniform2f (GLuint program, GLint location, GLfloat v0, GLfloat v1)
+{
+    OGLP_ENTRY (ProgramUniform2f) = (PFNGLPROGRAMUNIFORM2FPROC) LazyResolve ("glProgramUniform2f");
+    return OGLP_ENTRY (ProgramUniform2f) (program, location, v0, v1);
+}
+
+static void APIENTRY Lazy_ProgramUniform2fv (GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+    OGLP_ENTRY (ProgramUniform2fv) = (PFNGLPROGRAMUNIFORM2FVPROC) LazyResolve ("glProgramUniform2fv");
+    return OGLP_ENTRY (ProgramUniform2fv) (program, location, count, value);
+}
+
+static void APIENTRY Lazy_ProgramUniform2d (GLuint program, GLint location, GLdouble v0, GLdouble v1)
+{
+    OGLP_ENTRY (ProgramUniform2d) = (PFNGLPROGRAMUNIFORM2DPROC) LazyResolve ("glProgramUniform2d");
+    return OGLP_ENTRY (ProgramUniform2d) (program, location, v0, v1);
+}
+
+static void APIENTRY Lazy_ProgramUniform2dv (GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+    OGLP_ENTRY (ProgramUniform2dv) = (PFNGLPROGRAMUNIFORM2DVPROC) LazyResolve ("glProgramUniform2dv");
+    return OGLP_ENTRY (ProgramUniform2dv) (program, location, count, value);
+}
+
+static void APIENTRY Lazy_ProgramUniform2ui (GLuint program, GLint location, GLuint v0, GLuint v1)
+{
+    OGLP_ENTRY (ProgramUniform2ui) = (PFNGLPROGRAMUNIFORM2UIPROC) LazyResolve ("glProgramUniform2ui");
+    return OGLP_ENTRY (ProgramUniform2ui) (program, location, v0, v1);
+}
+
+static void APIENTRY Lazy_ProgramUniform2uiv (GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+    OGLP_ENTRY (ProgramUniform2uiv) = (PFNGLPROGRAMUNIFORM2UIVPROC) LazyResolve ("glProgramUniform2uiv");
+    return OGLP_ENTRY (ProgramUniform2uiv) (program, location, count, value);
+}
+
+static void APIENTRY Lazy_ProgramUniform3i (GLuint program, GLint location, GLint v0, GLint v1, GLint v2)
+{
+    OGLP_ENTRY (ProgramUniform3i) = (PFNGLPROGRAMUNIFORM3IPROC) LazyResolve ("glProgramUniform3i");
+    return OGLP_ENTRY (ProgramUniform3i) (program, location, v0, v1, v2);
+}
+
+static void APIENTRY Lazy_ProgramUniform3iv (GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+    OGLP_ENTRY (ProgramUniform3iv) = (PFNGLPROGRAMUNIFORM3IVPROC) LazyResolve ("glProgramUniform3iv");
+    return OGLP_ENTRY (ProgramUniform3iv) (program, location, count, value);
+}
+
+static void APIENTRY Lazy_ProgramUniform3f (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    OGLP_ENTRY (ProgramUniform3f) = (PFNGLPROGRAMUNIFORM3FPROC) LazyResolve ("glProgramUniform3f");
+    return OGLP_ENTRY (ProgramUniform3f) (program, location, v0, v1, v2);
+}
+
+static void APIENTRY Lazy_ProgramUniform3fv (GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+    OGLP_ENTRY (ProgramUniform3fv) = (PFNGLPROGRAMUNIFORM3FVPROC) LazyResolve ("glProgramUniform3fv");
+    return OGLP_ENTRY (ProgramUniform3fv) (program, location, count, value);
+}
+
+static void APIENTRY Lazy_ProgramUniform3d (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2)
+{
+    OGLP_ENTRY (ProgramUniform3d) = (PFNGLPROGRAMUNIFORM3DPROC) LazyResolve ("glProgramUniform3d");
+    return OGLP_ENTRY (ProgramUniform3d) (program, location, v0, v1, v2);
+}
+
+static void APIENTRY Lazy_ProgramUniform3dv (GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+    OGLP_ENTRY (ProgramUniform3dv) = (PFNGLPROGRAMUNIFORM3DVPROC) LazyResolve ("glProgramUniform3dv");
+    return OGLP_ENTRY (ProgramUniform3dv) (program, location, count, value);
+}
+
+static void APIENTRY Lazy_ProgramUniform3ui (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+    OGLP_ENTRY (ProgramUniform3ui) = (PFNGLPROGRAMUNIFORM3UIPROC) LazyResolve ("glProgramUniform3ui");
+    return OGLP_ENTRY (ProgramUniform3ui) (program, location, v0, v1, v2);
+}
+
+static void APIENTRY Lazy_ProgramUniform3uiv (GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+    OGLP_ENTRY (ProgramUniform3uiv) = (PFNGLPROGRAMUNIFORM3UIVPROC) LazyResolve ("glProgramUniform3uiv");
+    return OGLP_ENTRY (ProgramUniform3uiv) (program, location, count, value);
+}
+
+static void APIENTRY Lazy_ProgramUniform4i (GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    OGLP_ENTRY (ProgramUniform4i) = (PFNGLPROGRAMUNIFORM4IPROC) LazyResolve ("glProgramUniform4i");
+    return OGLP_ENTRY (ProgramUniform4i) (program, location, v0, v1, v2, v3);
+}
+
+static void APIENTRY Lazy_ProgramUniform4iv (GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+    OGLP_ENTRY (ProgramUniform4iv) = (PFNGLPROGRAMUNIFORM4IVPROC) LazyResolve ("glProgramUniform4iv");
+    return OGLP_ENTRY (ProgramUniform4iv) (program, location, count, value);
+}
+
+static void APIENTRY Lazy_ProgramUniform4f (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+    OGLP_ENTRY (ProgramUniform4f) = (PFNGLPROGRAMUNIFORM4FPROC) LazyResolve ("glProgramUniform4f");
+    return OGLP_ENTRY (ProgramUniform4f) (program, location, v0, v1, v2, v3);
+}
+
+static void APIENTRY Lazy_ProgramUniform4fv (GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+    OGLP_ENTRY (ProgramUniform4fv) = (PFNGLPROGRAMUNIFORM4FVPROC) LazyResolve ("glProgramUniform4fv");
+    return OGLP_ENTRY (ProgramUniform4fv) (program, location, count, value);
+}
+
+static void APIENTRY Lazy_ProgramUniform4d (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3)
+{
+    OGLP_ENTRY (ProgramUniform4d) = (PFNGLPROGRAMUNIFORM4DPROC) LazyResolve ("glProgramUniform4d");
+    return OGLP_ENTRY (ProgramUniform4d) (program, location, v0, v1, v2, v3);
+}
+
+static void APIENTRY Lazy_ProgramUniform4dv (GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+    OGLP_ENTRY (ProgramUniform4dv) = (PFNGLPROGRAMUNIFORM4DVPROC) LazyResolve ("glProgramUniform4dv");
+    return OGLP_ENTRY (ProgramUniform4dv) (program, location, count, value);
+}
+
+static void APIENTRY Lazy_ProgramUniform4ui (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+    OGLP_ENTRY (ProgramUniform4ui) = (PFNGLPROGRAMUNIFORM4UIPROC) LazyResolve ("glProgramUniform4ui");
+    return OGLP_ENTRY (ProgramUniform4ui) (program, location, v0, v1, v2, v3);
+}
+
+static void APIENTRY Lazy_ProgramUniform4uiv (GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+    OGLP_ENTRY (ProgramUniform4uiv) = (PFNGLPROGRAMUNIFORM4UIVPROC) LazyResolve ("glProgramUniform4uiv");
+    return OGLP_ENTRY (ProgramUniform4uiv) (program, location, count, value);
+}
+
+static void APIENTRY Lazy_ProgramUniformMatrix2fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    OGLP_ENTRY (ProgramUniformMatrix2fv) = (PFNGLPROGRAMUNIFORMMATRIX2FVPROC) LazyResolve ("glProgramUniformMatrix2fv");
+    return OGLP_ENTRY (ProgramUniformMatrix2fv) (program, location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_ProgramUniformMatrix3fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    OGLP_ENTRY (ProgramUniformMatrix3fv) = (PFNGLPROGRAMUNIFORMMATRIX3FVPROC) LazyResolve ("glProgramUniformMatrix3fv");
+    return OGLP_ENTRY (ProgramUniformMatrix3fv) (program, location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_ProgramUniformMatrix4fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    OGLP_ENTRY (ProgramUniformMatrix4fv) = (PFNGLPROGRAMUNIFORMMATRIX4FVPROC) LazyResolve ("glProgramUniformMatrix4fv");
+    return OGLP_ENTRY (ProgramUniformMatrix4fv) (program, location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_ProgramUniformMatrix2dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    OGLP_ENTRY (ProgramUniformMatrix2dv) = (PFNGLPROGRAMUNIFORMMATRIX2DVPROC) LazyResolve ("glProgramUniformMatrix2dv");
+    return OGLP_ENTRY (ProgramUniformMatrix2dv) (program, location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_ProgramUniformMatrix3dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    OGLP_ENTRY (ProgramUniformMatrix3dv) = (PFNGLPROGRAMUNIFORMMATRIX3DVPROC) LazyResolve ("glProgramUniformMatrix3dv");
+    return OGLP_ENTRY (ProgramUniformMatrix3dv) (program, location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_ProgramUniformMatrix4dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    OGLP_ENTRY (ProgramUniformMatrix4dv) = (PFNGLPROGRAMUNIFORMMATRIX4DVPROC) LazyResolve ("glProgramUniformMatrix4dv");
+    return OGLP_ENTRY (ProgramUniformMatrix4dv) (program, location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_ProgramUniformMatrix2x3fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    OGLP_ENTRY (ProgramUniformMatrix2x3fv) = (PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC) LazyResolve ("glProgramUniformMatrix2x3fv");
+    return OGLP_ENTRY (ProgramUniformMatrix2x3fv) (program, location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_ProgramUniformMatrix3x2fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    OGLP_ENTRY (ProgramUniformMatrix3x2fv) = (PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC) LazyResolve ("glProgramUniformMatrix3x2fv");
+    return OGLP_ENTRY (ProgramUniformMatrix3x2fv) (program, location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_ProgramUniformMatrix2x4fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    OGLP_ENTRY (ProgramUniformMatrix2x4fv) = (PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC) LazyResolve ("glProgramUniformMatrix2x4fv");
+    return OGLP_ENTRY (ProgramUniformMatrix2x4fv) (program, location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_ProgramUniformMatrix4x2fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    OGLP_ENTRY (ProgramUniformMatrix4x2fv) = (PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC) LazyResolve ("glProgramUniformMatrix4x2fv");
+    return OGLP_ENTRY (ProgramUniformMatrix4x2fv) (program, location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_ProgramUniformMatrix3x4fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    OGLP_ENTRY (ProgramUniformMatrix3x4fv) = (PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC) LazyResolve ("glProgramUniformMatrix3x4fv");
+    return OGLP_ENTRY (ProgramUniformMatrix3x4fv) (program, location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_ProgramUniformMatrix4x3fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    OGLP_ENTRY (ProgramUniformMatrix4x3fv) = (PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC) LazyResolve ("glProgramUniformMatrix4x3fv");
+    return OGLP_ENTRY (ProgramUniformMatrix4x3fv) (program, location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_ProgramUniformMatrix2x3dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    OGLP_ENTRY (ProgramUniformMatrix2x3dv) = (PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC) LazyResolve ("glProgramUniformMatrix2x3dv");
+    return OGLP_ENTRY (ProgramUniformMatrix2x3dv) (program, location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_ProgramUniformMatrix3x2dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    OGLP_ENTRY (ProgramUniformMatrix3x2dv) = (PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC) LazyResolve ("glProgramUniformMatrix3x2dv");
+    return OGLP_ENTRY (ProgramUniformMatrix3x2dv) (program, location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_ProgramUniformMatrix2x4dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    OGLP_ENTRY (ProgramUniformMatrix2x4dv) = (PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC) LazyResolve ("glProgramUniformMatrix2x4dv");
+    return OGLP_ENTRY (ProgramUniformMatrix2x4dv) (program, location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_ProgramUniformMatrix4x2dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    OGLP_ENTRY (ProgramUniformMatrix4x2dv) = (PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC) LazyResolve ("glProgramUniformMatrix4x2dv");
+    return OGLP_ENTRY (ProgramUniformMatrix4x2dv) (program, location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_ProgramUniformMatrix3x4dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    OGLP_ENTRY (ProgramUniformMatrix3x4dv) = (PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC) LazyResolve ("glProgramUniformMatrix3x4dv");
+    return OGLP_ENTRY (ProgramUniformMatrix3x4dv) (program, location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_ProgramUniformMatrix4x3dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    OGLP_ENTRY (ProgramUniformMatrix4x3dv) = (PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC) LazyResolve ("glProgramUniformMatrix4x3dv");
+    return OGLP_ENTRY (ProgramUniformMatrix4x3dv) (program, location, count, transpose, value);
+}
+
+static void APIENTRY Lazy_ValidateProgramPipeline (GLuint pipeline)
+{
+    OGLP_ENTRY (ValidateProgramPipeline) = (PFNGLVALIDATEPROGRAMPIPELINEPROC) LazyResolve ("glValidateProgramPipeline");
+    return OGLP_ENTRY (ValidateProgramPipeline) (pipeline);
+}
+
+static void APIENTRY Lazy_GetProgramPipelineInfoLog (GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    OGLP_ENTRY (GetProgramPipelineInfoLog) = (PFNGLGETPROGRAMPIPELINEINFOLOGPROC) LazyResolve ("glGetProgramPipelineInfoLog");
+    return OGLP_ENTRY (GetProgramPipelineInfoLog) (pipeline, bufSize, length, infoLog);
+}
+
+static void APIENTRY Lazy_VertexAttribL1d (GLuint index, GLdouble x)
+{
+    OGLP_ENTRY (VertexAttribL1d) = (PFNGLVERTEXATTRIBL1DPROC) LazyResolve ("glVertexAttribL1d");
+    return OGLP_ENTRY (VertexAttribL1d) (index, x);
+}
+
+static void APIENTRY Lazy_VertexAttribL2d (GLuint index, GLdouble x, GLdouble y)
+{
+    OGLP_ENTRY (VertexAttribL2d) = (PFNGLVERTEXATTRIBL2DPROC) LazyResolve ("glVertexAttribL2d");
+    return OGLP_ENTRY (VertexAttribL2d) (index, x, y);
+}
+
+static void APIENTRY Lazy_VertexAttribL3d (GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+    OGLP_ENTRY (VertexAttribL3d) = (PFNGLVERTEXATTRIBL3DPROC) LazyResolve ("glVertexAttribL3d");
+    return OGLP_ENTRY (VertexAttribL3d) (index, x, y, z);
+}
+
+static void APIENTRY Lazy_VertexAttribL4d (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    OGLP_ENTRY (VertexAttribL4d) = (PFNGLVERTEXATTRIBL4DPROC) LazyResolve ("glVertexAttribL4d");
+    return OGLP_ENTRY (VertexAttribL4d) (index, x, y, z, w);
+}
+
+static void APIENTRY Lazy_VertexAttribL1dv (GLuint index, const GLdouble *v)
+{
+    OGLP_ENTRY (VertexAttribL1dv) = (PFNGLVERTEXATTRIBL1DVPROC) LazyResolve ("glVertexAttribL1dv");
+    return OGLP_ENTRY (VertexAttribL1dv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttribL2dv (GLuint index, const GLdouble *v)
+{
+    OGLP_ENTRY (VertexAttribL2dv) = (PFNGLVERTEXATTRIBL2DVPROC) LazyResolve ("glVertexAttribL2dv");
+    return OGLP_ENTRY (VertexAttribL2dv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttribL3dv (GLuint index, const GLdouble *v)
+{
+    OGLP_ENTRY (VertexAttribL3dv) = (PFNGLVERTEXATTRIBL3DVPROC) LazyResolve ("glVertexAttribL3dv");
+    return OGLP_ENTRY (VertexAttribL3dv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttribL4dv (GLuint index, const GLdouble *v)
+{
+    OGLP_ENTRY (VertexAttribL4dv) = (PFNGLVERTEXATTRIBL4DVPROC) LazyResolve ("glVertexAttribL4dv");
+    return OGLP_ENTRY (VertexAttribL4dv) (index, v);
+}
+
+static void APIENTRY Lazy_VertexAttribLPointer (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+    OGLP_ENTRY (VertexAttribLPointer) = (PFNGLVERTEXATTRIBLPOINTERPROC) LazyResolve ("glVertexAttribLPointer");
+    return OGLP_ENTRY (VertexAttribLPointer) (index, size, type, stride, pointer);
+}
+
+static void APIENTRY Lazy_GetVertexAttribLdv (GLuint index, GLenum pname, GLdouble *params)
+{
+    OGLP_ENTRY (GetVertexAttribLdv) = (PFNGLGETVERTEXATTRIBLDVPROC) LazyResolve ("glGetVertexAttribLdv");
+    return OGLP_ENTRY (GetVertexAttribLdv) (index, pname, params);
+}
+
+static void APIENTRY Lazy_ViewportArrayv (GLuint first, GLsizei count, const GLfloat *v)
+{
+    OGLP_ENTRY (ViewportArrayv) = (PFNGLVIEWPORTARRAYVPROC) LazyResolve ("glViewportArrayv");
+    return OGLP_ENTRY (ViewportArrayv) (first, count, v);
+}
+
+static void APIENTRY Lazy_ViewportIndexedf (GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h)
+{
+    OGLP_ENTRY (ViewportIndexedf) = (PFNGLVIEWPORTINDEXEDFPROC) LazyResolve ("glViewportIndexedf");
+    return OGLP_ENTRY (ViewportIndexedf) (index, x, y, w, h);
+}
+
+static void APIENTRY Lazy_ViewportIndexedfv (GLuint index, const GLfloat *v)
+{
+    OGLP_ENTRY (ViewportIndexedfv) = (PFNGLVIEWPORTINDEXEDFVPROC) LazyResolve ("glViewportIndexedfv");
+    return OGLP_ENTRY (ViewportIndexedfv) (index, v);
+}
+
+static void APIENTRY Lazy_ScissorArrayv (GLuint first, GLsizei count, const GLint *v)
+{
+    OGLP_ENTRY (ScissorArrayv) = (PFNGLSCISSORARRAYVPROC) LazyResolve ("glScissorArrayv");
+    return OGLP_ENTRY (ScissorArrayv) (first, count, v);
+}
+
+static void APIENTRY Lazy_ScissorIndexed (GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height)
+{
+    OGLP_ENTRY (ScissorIndexed) = (PFNGLSCISSORINDEXEDPROC) LazyResolve ("glScissorIndexed");
+    return OGLP_ENTRY (ScissorIndexed) (index, left, bottom, width, height);
+}
+
+static void APIENTRY Lazy_ScissorIndexedv (GLuint index, const GLint *v)
+{
+    OGLP_ENTRY (ScissorIndexedv) = (PFNGLSCISSORINDEXEDVPROC) LazyResolve ("glScissorIndexedv");
+    return OGLP_ENTRY (ScissorIndexedv) (index, v);
+}
+
+static void APIENTRY Lazy_DepthRangeArrayv (GLuint first, GLsizei count, const GLdouble *v)
+{
+    OGLP_ENTRY (DepthRangeArrayv) = (PFNGLDEPTHRANGEARRAYVPROC) LazyResolve ("glDepthRangeArrayv");
+    return OGLP_ENTRY (DepthRangeArrayv) (first, count, v);
+}
+
+static void APIENTRY Lazy_DepthRangeIndexed (GLuint index, GLdouble n, GLdouble f)
+{
+    OGLP_ENTRY (DepthRangeIndexed) = (PFNGLDEPTHRANGEINDEXEDPROC) LazyResolve ("glDepthRangeIndexed");
+    return OGLP_ENTRY (DepthRangeIndexed) (index, n, f);
+}
+
+static void APIENTRY Lazy_GetFloati_v (GLenum target, GLuint index, GLfloat *data)
+{
+    OGLP_ENTRY (GetFloati_v) = (PFNGLGETFLOATI_VPROC) LazyResolve ("glGetFloati_v");
+    return OGLP_ENTRY (GetFloati_v) (target, index, data);
+}
+
+static void APIENTRY Lazy_GetDoublei_v (GLenum target, GLuint index, GLdouble *data)
+{
+    OGLP_ENTRY (GetDoublei_v) = (PFNGLGETDOUBLEI_VPROC) LazyResolve ("glGetDoublei_v");
+    return OGLP_ENTRY (GetDoublei_v) (target, index, data);
+}
+
+static void APIENTRY Lazy_DrawArraysInstancedBaseInstance (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance)
+{
+    OGLP_ENTRY (DrawArraysInstancedBaseInstance) = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC) LazyResolve ("glDrawArraysInstancedBaseInstance");
+    return OGLP_ENTRY (DrawArraysInstancedBaseInstance) (mode, first, count, instancecount, baseinstance);
+}
+
+static void APIENTRY Lazy_DrawElementsInstancedBaseInstance (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance)
+{
+    OGLP_ENTRY (DrawElementsInstancedBaseInstance) = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC) LazyResolve ("glDrawElementsInstancedBaseInstance");
+    return OGLP_ENTRY (DrawElementsInstancedBaseInstance) (mode, count, type, indices, instancecount, baseinstance);
+}
+
+static void APIENTRY Lazy_DrawElementsInstancedBaseVertexBaseInstance (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance)
+{
+    OGLP_ENTRY (DrawElementsInstancedBaseVertexBaseInstance) = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC) LazyResolve ("glDrawElementsInstancedBaseVertexBaseInstance");
+    return OGLP_ENTRY (DrawElementsInstancedBaseVertexBaseInstance) (mode, count, type, indices, instancecount, basevertex, baseinstance);
+}
+
+static void APIENTRY Lazy_GetInternalformativ (GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint *params)
+{
+    OGLP_ENTRY (GetInternalformativ) = (PFNGLGETINTERNALFORMATIVPROC) LazyResolve ("glGetInternalformativ");
+    return OGLP_ENTRY (GetInternalformativ) (target, internalformat, pname, bufSize, params);
+}
+
+static void APIENTRY Lazy_GetActiveAtomicCounterBufferiv (GLuint program, GLuint bufferIndex, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetActiveAtomicCounterBufferiv) = (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC) LazyResolve ("glGetActiveAtomicCounterBufferiv");
+    return OGLP_ENTRY (GetActiveAtomicCounterBufferiv) (program, bufferIndex, pname, params);
+}
+
+static void APIENTRY Lazy_BindImageTexture (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format)
+{
+    OGLP_ENTRY (BindImageTexture) = (PFNGLBINDIMAGETEXTUREPROC) LazyResolve ("glBindImageTexture");
+    return OGLP_ENTRY (BindImageTexture) (unit, texture, level, layered, layer, access, format);
+}
+
+static void APIENTRY Lazy_MemoryBarrier (GLbitfield barriers)
+{
+    OGLP_ENTRY (MemoryBarrier) = (PFNGLMEMORYBARRIERPROC) LazyResolve ("glMemoryBarrier");
+    return OGLP_ENTRY (MemoryBarrier) (barriers);
+}
+
+static void APIENTRY Lazy_TexStorage1D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width)
+{
+    OGLP_ENTRY (TexStorage1D) = (PFNGLTEXSTORAGE1DPROC) LazyResolve ("glTexStorage1D");
+    return OGLP_ENTRY (TexStorage1D) (target, levels, internalformat, width);
+}
+
+static void APIENTRY Lazy_TexStorage2D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    OGLP_ENTRY (TexStorage2D) = (PFNGLTEXSTORAGE2DPROC) LazyResolve ("glTexStorage2D");
+    return OGLP_ENTRY (TexStorage2D) (target, levels, internalformat, width, height);
+}
+
+static void APIENTRY Lazy_TexStorage3D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+    OGLP_ENTRY (TexStorage3D) = (PFNGLTEXSTORAGE3DPROC) LazyResolve ("glTexStorage3D");
+    return OGLP_ENTRY (TexStorage3D) (target, levels, internalformat, width, height, depth);
+}
+
+static void APIENTRY Lazy_DrawTransformFeedbackInstanced (GLenum mode, GLuint id, GLsizei instancecount)
+{
+    OGLP_ENTRY (DrawTransformFeedbackInstanced) = (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC) LazyResolve ("glDrawTransformFeedbackInstanced");
+    return OGLP_ENTRY (DrawTransformFeedbackInstanced) (mode, id, instancecount);
+}
+
+static void APIENTRY Lazy_DrawTransformFeedbackStreamInstanced (GLenum mode, GLuint id, GLuint stream, GLsizei instancecount)
+{
+    OGLP_ENTRY (DrawTransformFeedbackStreamInstanced) = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC) LazyResolve ("glDrawTransformFeedbackStreamInstanced");
+    return OGLP_ENTRY (DrawTransformFeedbackStreamInstanced) (mode, id, stream, instancecount);
+}
+
+static void APIENTRY Lazy_ClearBufferData (GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data)
+{
+    OGLP_ENTRY (ClearBufferData) = (PFNGLCLEARBUFFERDATAPROC) LazyResolve ("glClearBufferData");
+    return OGLP_ENTRY (ClearBufferData) (target, internalformat, format, type, data);
+}
+
+static void APIENTRY Lazy_ClearBufferSubData (GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data)
+{
+    OGLP_ENTRY (ClearBufferSubData) = (PFNGLCLEARBUFFERSUBDATAPROC) LazyResolve ("glClearBufferSubData");
+    return OGLP_ENTRY (ClearBufferSubData) (target, internalformat, offset, size, format, type, data);
+}
+
+static void APIENTRY Lazy_DispatchCompute (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z)
+{
+    OGLP_ENTRY (DispatchCompute) = (PFNGLDISPATCHCOMPUTEPROC) LazyResolve ("glDispatchCompute");
+    return OGLP_ENTRY (DispatchCompute) (num_groups_x, num_groups_y, num_groups_z);
+}
+
+static void APIENTRY Lazy_DispatchComputeIndirect (GLintptr indirect)
+{
+    OGLP_ENTRY (DispatchComputeIndirect) = (PFNGLDISPATCHCOMPUTEINDIRECTPROC) LazyResolve ("glDispatchComputeIndirect");
+    return OGLP_ENTRY (DispatchComputeIndirect) (indirect);
+}
+
+static void APIENTRY Lazy_CopyImageSubData (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth)
+{
+    OGLP_ENTRY (CopyImageSubData) = (PFNGLCOPYIMAGESUBDATAPROC) LazyResolve ("glCopyImageSubData");
+    return OGLP_ENTRY (CopyImageSubData) (srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+}
+
+static void APIENTRY Lazy_FramebufferParameteri (GLenum target, GLenum pname, GLint param)
+{
+    OGLP_ENTRY (FramebufferParameteri) = (PFNGLFRAMEBUFFERPARAMETERIPROC) LazyResolve ("glFramebufferParameteri");
+    return OGLP_ENTRY (FramebufferParameteri) (target, pname, param);
+}
+
+static void APIENTRY Lazy_GetFramebufferParameteriv (GLenum target, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetFramebufferParameteriv) = (PFNGLGETFRAMEBUFFERPARAMETERIVPROC) LazyResolve ("glGetFramebufferParameteriv");
+    return OGLP_ENTRY (GetFramebufferParameteriv) (target, pname, params);
+}
+
+static void APIENTRY Lazy_GetInternalformati64v (GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint64 *params)
+{
+    OGLP_ENTRY (GetInternalformati64v) = (PFNGLGETINTERNALFORMATI64VPROC) LazyResolve ("glGetInternalformati64v");
+    return OGLP_ENTRY (GetInternalformati64v) (target, internalformat, pname, bufSize, params);
+}
+
+static void APIENTRY Lazy_InvalidateTexSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth)
+{
+    OGLP_ENTRY (InvalidateTexSubImage) = (PFNGLINVALIDATETEXSUBIMAGEPROC) LazyResolve ("glInvalidateTexSubImage");
+    return OGLP_ENTRY (InvalidateTexSubImage) (texture, level, xoffset, yoffset, zoffset, width, height, depth);
+}
+
+static void APIENTRY Lazy_InvalidateTexImage (GLuint texture, GLint level)
+{
+    OGLP_ENTRY (InvalidateTexImage) = (PFNGLINVALIDATETEXIMAGEPROC) LazyResolve ("glInvalidateTexImage");
+    return OGLP_ENTRY (InvalidateTexImage) (texture, level);
+}
+
+static void APIENTRY Lazy_InvalidateBufferSubData (GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+    OGLP_ENTRY (InvalidateBufferSubData) = (PFNGLINVALIDATEBUFFERSUBDATAPROC) LazyResolve ("glInvalidateBufferSubData");
+    return OGLP_ENTRY (InvalidateBufferSubData) (buffer, offset, length);
+}
+
+static void APIENTRY Lazy_InvalidateBufferData (GLuint buffer)
+{
+    OGLP_ENTRY (InvalidateBufferData) = (PFNGLINVALIDATEBUFFERDATAPROC) LazyResolve ("glInvalidateBufferData");
+    return OGLP_ENTRY (InvalidateBufferData) (buffer);
+}
+
+static void APIENTRY Lazy_InvalidateFramebuffer (GLenum target, GLsizei numAttachments, const GLenum *attachments)
+{
+    OGLP_ENTRY (InvalidateFramebuffer) = (PFNGLINVALIDATEFRAMEBUFFERPROC) LazyResolve ("glInvalidateFramebuffer");
+    return OGLP_ENTRY (InvalidateFramebuffer) (target, numAttachments, attachments);
+}
+
+static void APIENTRY Lazy_InvalidateSubFramebuffer (GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    OGLP_ENTRY (InvalidateSubFramebuffer) = (PFNGLINVALIDATESUBFRAMEBUFFERPROC) LazyResolve ("glInvalidateSubFramebuffer");
+    return OGLP_ENTRY (InvalidateSubFramebuffer) (target, numAttachments, attachments, x, y, width, height);
+}
+
+static void APIENTRY Lazy_MultiDrawArraysIndirect (GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride)
+{
+    OGLP_ENTRY (MultiDrawArraysIndirect) = (PFNGLMULTIDRAWARRAYSINDIRECTPROC) LazyResolve ("glMultiDrawArraysIndirect");
+    return OGLP_ENTRY (MultiDrawArraysIndirect) (mode, indirect, drawcount, stride);
+}
+
+static void APIENTRY Lazy_MultiDrawElementsIndirect (GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride)
+{
+    OGLP_ENTRY (MultiDrawElementsIndirect) = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC) LazyResolve ("glMultiDrawElementsIndirect");
+    return OGLP_ENTRY (MultiDrawElementsIndirect) (mode, type, indirect, drawcount, stride);
+}
+
+static void APIENTRY Lazy_GetProgramInterfaceiv (GLuint program, GLenum programInterface, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetProgramInterfaceiv) = (PFNGLGETPROGRAMINTERFACEIVPROC) LazyResolve ("glGetProgramInterfaceiv");
+    return OGLP_ENTRY (GetProgramInterfaceiv) (program, programInterface, pname, params);
+}
+
+static GLuint APIENTRY Lazy_GetProgramResourceIndex (GLuint program, GLenum programInterface, const GLchar *name)
+{
+    OGLP_ENTRY (GetProgramResourceIndex) = (PFNGLGETPROGRAMRESOURCEINDEXPROC) LazyResolve ("glGetProgramResourceIndex");
+    return OGLP_ENTRY (GetProgramResourceIndex) (program, programInterface, name);
+}
+
+static void APIENTRY Lazy_GetProgramResourceName (GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name)
+{
+    OGLP_ENTRY (GetProgramResourceName) = (PFNGLGETPROGRAMRESOURCENAMEPROC) LazyResolve ("glGetProgramResourceName");
+    return OGLP_ENTRY (GetProgramResourceName) (program, programInterface, index, bufSize, length, name);
+}
+
+static void APIENTRY Lazy_GetProgramResourceiv (GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei bufSize, GLsizei *length, GLint *params)
+{
+    OGLP_ENTRY (GetProgramResourceiv) = (PFNGLGETPROGRAMRESOURCEIVPROC) LazyResolve ("glGetProgramResourceiv");
+    return OGLP_ENTRY (GetProgramResourceiv) (program, programInterface, index, propCount, props, bufSize, length, params);
+}
+
+static GLint APIENTRY Lazy_GetProgramResourceLocation (GLuint program, GLenum programInterface, const GLchar *name)
+{
+    OGLP_ENTRY (GetProgramResourceLocation) = (PFNGLGETPROGRAMRESOURCELOCATIONPROC) LazyResolve ("glGetProgramResourceLocation");
+    return OGLP_ENTRY (GetProgramResourceLocation) (program, programInterface, name);
+}
+
+static GLint APIENTRY Lazy_GetProgramResourceLocationIndex (GLuint program, GLenum programInterface, const GLchar *name)
+{
+    OGLP_ENTRY (GetProgramResourceLocationIndex) = (PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC) LazyResolve ("glGetProgramResourceLocationIndex");
+    return OGLP_ENTRY (GetProgramResourceLocationIndex) (program, programInterface, name);
+}
+
+static void APIENTRY Lazy_ShaderStorageBlockBinding (GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding)
+{
+    OGLP_ENTRY (ShaderStorageBlockBinding) = (PFNGLSHADERSTORAGEBLOCKBINDINGPROC) LazyResolve ("glShaderStorageBlockBinding");
+    return OGLP_ENTRY (ShaderStorageBlockBinding) (program, storageBlockIndex, storageBlockBinding);
+}
+
+static void APIENTRY Lazy_TexBufferRange (GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    OGLP_ENTRY (TexBufferRange) = (PFNGLTEXBUFFERRANGEPROC) LazyResolve ("glTexBufferRange");
+    return OGLP_ENTRY (TexBufferRange) (target, internalformat, buffer, offset, size);
+}
+
+static void APIENTRY Lazy_TexStorage2DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+    OGLP_ENTRY (TexStorage2DMultisample) = (PFNGLTEXSTORAGE2DMULTISAMPLEPROC) LazyResolve ("glTexStorage2DMultisample");
+    return OGLP_ENTRY (TexStorage2DMultisample) (target, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static void APIENTRY Lazy_TexStorage3DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+    OGLP_ENTRY (TexStorage3DMultisample) = (PFNGLTEXSTORAGE3DMULTISAMPLEPROC) LazyResolve ("glTexStorage3DMultisample");
+    return OGLP_ENTRY (TexStorage3DMultisample) (target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+static void APIENTRY Lazy_TextureView (GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers)
+{
+    OGLP_ENTRY (TextureView) = (PFNGLTEXTUREVIEWPROC) LazyResolve ("glTextureView");
+    return OGLP_ENTRY (TextureView) (texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+}
+
+static void APIENTRY Lazy_BindVertexBuffer (GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+    OGLP_ENTRY (BindVertexBuffer) = (PFNGLBINDVERTEXBUFFERPROC) LazyResolve ("glBindVertexBuffer");
+    return OGLP_ENTRY (BindVertexBuffer) (bindingindex, buffer, offset, stride);
+}
+
+static void APIENTRY Lazy_VertexAttribFormat (GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
+{
+    OGLP_ENTRY (VertexAttribFormat) = (PFNGLVERTEXATTRIBFORMATPROC) LazyResolve ("glVertexAttribFormat");
+    return OGLP_ENTRY (VertexAttribFormat) (attribindex, size, type, normalized, relativeoffset);
+}
+
+static void APIENTRY Lazy_VertexAttribIFormat (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    OGLP_ENTRY (VertexAttribIFormat) = (PFNGLVERTEXATTRIBIFORMATPROC) LazyResolve ("glVertexAttribIFormat");
+    return OGLP_ENTRY (VertexAttribIFormat) (attribindex, size, type, relativeoffset);
+}
+
+static void APIENTRY Lazy_VertexAttribLFormat (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    OGLP_ENTRY (VertexAttribLFormat) = (PFNGLVERTEXATTRIBLFORMATPROC) LazyResolve ("glVertexAttribLFormat");
+    return OGLP_ENTRY (VertexAttribLFormat) (attribindex, size, type, relativeoffset);
+}
+
+static void APIENTRY Lazy_VertexAttribBinding (GLuint attribindex, GLuint bindingindex)
+{
+    OGLP_ENTRY (VertexAttribBinding) = (PFNGLVERTEXATTRIBBINDINGPROC) LazyResolve ("glVertexAttribBinding");
+    return OGLP_ENTRY (VertexAttribBinding) (attribindex, bindingindex);
+}
+
+static void APIENTRY Lazy_VertexBindingDivisor (GLuint bindingindex, GLuint divisor)
+{
+    OGLP_ENTRY (VertexBindingDivisor) = (PFNGLVERTEXBINDINGDIVISORPROC) LazyResolve ("glVertexBindingDivisor");
+    return OGLP_ENTRY (VertexBindingDivisor) (bindingindex, divisor);
+}
+
+static void APIENTRY Lazy_DebugMessageControl (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled)
+{
+    OGLP_ENTRY (DebugMessageControl) = (PFNGLDEBUGMESSAGECONTROLPROC) LazyResolve ("glDebugMessageControl");
+    return OGLP_ENTRY (DebugMessageControl) (source, type, severity, count, ids, enabled);
+}
+
+static void APIENTRY Lazy_DebugMessageInsert (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf)
+{
+    OGLP_ENTRY (DebugMessageInsert) = (PFNGLDEBUGMESSAGEINSERTPROC) LazyResolve ("glDebugMessageInsert");
+    return OGLP_ENTRY (DebugMessageInsert) (source, type, id, severity, length, buf);
+}
+
+static void APIENTRY Lazy_DebugMessageCallback (GLDEBUGPROC callback, const void *userParam)
+{
+    OGLP_ENTRY (DebugMessageCallback) = (PFNGLDEBUGMESSAGECALLBACKPROC) LazyResolve ("glDebugMessageCallback");
+    return OGLP_ENTRY (DebugMessageCallback) (callback, userParam);
+}
+
+static GLuint APIENTRY Lazy_GetDebugMessageLog (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog)
+{
+    OGLP_ENTRY (GetDebugMessageLog) = (PFNGLGETDEBUGMESSAGELOGPROC) LazyResolve ("glGetDebugMessageLog");
+    return OGLP_ENTRY (GetDebugMessageLog) (count, bufSize, sources, types, ids, severities, lengths, messageLog);
+}
+
+static void APIENTRY Lazy_PushDebugGroup (GLenum source, GLuint id, GLsizei length, const GLchar *message)
+{
+    OGLP_ENTRY (PushDebugGroup) = (PFNGLPUSHDEBUGGROUPPROC) LazyResolve ("glPushDebugGroup");
+    return OGLP_ENTRY (PushDebugGroup) (source, id, length, message);
+}
+
+static void APIENTRY Lazy_PopDebugGroup (void)
+{
+    OGLP_ENTRY (PopDebugGroup) = (PFNGLPOPDEBUGGROUPPROC) LazyResolve ("glPopDebugGroup");
+    return OGLP_ENTRY (PopDebugGroup) ();
+}
+
+static void APIENTRY Lazy_ObjectLabel (GLenum identifier, GLuint name, GLsizei length, const GLchar *label)
+{
+    OGLP_ENTRY (ObjectLabel) = (PFNGLOBJECTLABELPROC) LazyResolve ("glObjectLabel");
+    return OGLP_ENTRY (ObjectLabel) (identifier, name, length, label);
+}
+
+static void APIENTRY Lazy_GetObjectLabel (GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label)
+{
+    OGLP_ENTRY (GetObjectLabel) = (PFNGLGETOBJECTLABELPROC) LazyResolve ("glGetObjectLabel");
+    return OGLP_ENTRY (GetObjectLabel) (identifier, name, bufSize, length, label);
+}
+
+static void APIENTRY Lazy_ObjectPtrLabel (const void *ptr, GLsizei length, const GLchar *label)
+{
+    OGLP_ENTRY (ObjectPtrLabel) = (PFNGLOBJECTPTRLABELPROC) LazyResolve ("glObjectPtrLabel");
+    return OGLP_ENTRY (ObjectPtrLabel) (ptr, length, label);
+}
+
+static void APIENTRY Lazy_GetObjectPtrLabel (const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label)
+{
+    OGLP_ENTRY (GetObjectPtrLabel) = (PFNGLGETOBJECTPTRLABELPROC) LazyResolve ("glGetObjectPtrLabel");
+    return OGLP_ENTRY (GetObjectPtrLabel) (ptr, bufSize, length, label);
+}
+
+static void APIENTRY Lazy_BufferStorage (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags)
+{
+    OGLP_ENTRY (BufferStorage) = (PFNGLBUFFERSTORAGEPROC) LazyResolve ("glBufferStorage");
+    return OGLP_ENTRY (BufferStorage) (target, size, data, flags);
+}
+
+static void APIENTRY Lazy_ClearTexImage (GLuint texture, GLint level, GLenum format, GLenum type, const void *data)
+{
+    OGLP_ENTRY (ClearTexImage) = (PFNGLCLEARTEXIMAGEPROC) LazyResolve ("glClearTexImage");
+    return OGLP_ENTRY (ClearTexImage) (texture, level, format, type, data);
+}
+
+static void APIENTRY Lazy_ClearTexSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data)
+{
+    OGLP_ENTRY (ClearTexSubImage) = (PFNGLCLEARTEXSUBIMAGEPROC) LazyResolve ("glClearTexSubImage");
+    return OGLP_ENTRY (ClearTexSubImage) (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+}
+
+static void APIENTRY Lazy_BindBuffersBase (GLenum target, GLuint first, GLsizei count, const GLuint *buffers)
+{
+    OGLP_ENTRY (BindBuffersBase) = (PFNGLBINDBUFFERSBASEPROC) LazyResolve ("glBindBuffersBase");
+    return OGLP_ENTRY (BindBuffersBase) (target, first, count, buffers);
+}
+
+static void APIENTRY Lazy_BindBuffersRange (GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes)
+{
+    OGLP_ENTRY (BindBuffersRange) = (PFNGLBINDBUFFERSRANGEPROC) LazyResolve ("glBindBuffersRange");
+    return OGLP_ENTRY (BindBuffersRange) (target, first, count, buffers, offsets, sizes);
+}
+
+static void APIENTRY Lazy_BindTextures (GLuint first, GLsizei count, const GLuint *textures)
+{
+    OGLP_ENTRY (BindTextures) = (PFNGLBINDTEXTURESPROC) LazyResolve ("glBindTextures");
+    return OGLP_ENTRY (BindTextures) (first, count, textures);
+}
+
+static void APIENTRY Lazy_BindSamplers (GLuint first, GLsizei count, const GLuint *samplers)
+{
+    OGLP_ENTRY (BindSamplers) = (PFNGLBINDSAMPLERSPROC) LazyResolve ("glBindSamplers");
+    return OGLP_ENTRY (BindSamplers) (first, count, samplers);
+}
+
+static void APIENTRY Lazy_BindImageTextures (GLuint first, GLsizei count, const GLuint *textures)
+{
+    OGLP_ENTRY (BindImageTextures) = (PFNGLBINDIMAGETEXTURESPROC) LazyResolve ("glBindImageTextures");
+    return OGLP_ENTRY (BindImageTextures) (first, count, textures);
+}
+
+static void APIENTRY Lazy_BindVertexBuffers (GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides)
+{
+    OGLP_ENTRY (BindVertexBuffers) = (PFNGLBINDVERTEXBUFFERSPROC) LazyResolve ("glBindVertexBuffers");
+    return OGLP_ENTRY (BindVertexBuffers) (first, count, buffers, offsets, strides);
+}
+
+static void APIENTRY Lazy_ClipControl (GLenum origin, GLenum depth)
+{
+    OGLP_ENTRY (ClipControl) = (PFNGLCLIPCONTROLPROC) LazyResolve ("glClipControl");
+    return OGLP_ENTRY (ClipControl) (origin, depth);
+}
+
+static void APIENTRY Lazy_CreateTransformFeedbacks (GLsizei n, GLuint *ids)
+{
+    OGLP_ENTRY (CreateTransformFeedbacks) = (PFNGLCREATETRANSFORMFEEDBACKSPROC) LazyResolve ("glCreateTransformFeedbacks");
+    return OGLP_ENTRY (CreateTransformFeedbacks) (n, ids);
+}
+
+static void APIENTRY Lazy_TransformFeedbackBufferBase (GLuint xfb, GLuint index, GLuint buffer)
+{
+    OGLP_ENTRY (TransformFeedbackBufferBase) = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC) LazyResolve ("glTransformFeedbackBufferBase");
+    return OGLP_ENTRY (TransformFeedbackBufferBase) (xfb, index, buffer);
+}
+
+static void APIENTRY Lazy_TransformFeedbackBufferRange (GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    OGLP_ENTRY (TransformFeedbackBufferRange) = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC) LazyResolve ("glTransformFeedbackBufferRange");
+    return OGLP_ENTRY (TransformFeedbackBufferRange) (xfb, index, buffer, offset, size);
+}
+
+static void APIENTRY Lazy_GetTransformFeedbackiv (GLuint xfb, GLenum pname, GLint *param)
+{
+    OGLP_ENTRY (GetTransformFeedbackiv) = (PFNGLGETTRANSFORMFEEDBACKIVPROC) LazyResolve ("glGetTransformFeedbackiv");
+    return OGLP_ENTRY (GetTransformFeedbackiv) (xfb, pname, param);
+}
+
+static void APIENTRY Lazy_GetTransformFeedbacki_v (GLuint xfb, GLenum pname, GLuint index, GLint *param)
+{
+    OGLP_ENTRY (GetTransformFeedbacki_v) = (PFNGLGETTRANSFORMFEEDBACKI_VPROC) LazyResolve ("glGetTransformFeedbacki_v");
+    return OGLP_ENTRY (GetTransformFeedbacki_v) (xfb, pname, index, param);
+}
+
+static void APIENTRY Lazy_GetTransformFeedbacki64_v (GLuint xfb, GLenum pname, GLuint index, GLint64 *param)
+{
+    OGLP_ENTRY (GetTransformFeedbacki64_v) = (PFNGLGETTRANSFORMFEEDBACKI64_VPROC) LazyResolve ("glGetTransformFeedbacki64_v");
+    return OGLP_ENTRY (GetTransformFeedbacki64_v) (xfb, pname, index, param);
+}
+
+static void APIENTRY Lazy_CreateBuffers (GLsizei n, GLuint *buffers)
+{
+    OGLP_ENTRY (CreateBuffers) = (PFNGLCREATEBUFFERSPROC) LazyResolve ("glCreateBuffers");
+    return OGLP_ENTRY (CreateBuffers) (n, buffers);
+}
+
+static void APIENTRY Lazy_NamedBufferStorage (GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags)
+{
+    OGLP_ENTRY (NamedBufferStorage) = (PFNGLNAMEDBUFFERSTORAGEPROC) LazyResolve ("glNamedBufferStorage");
+    return OGLP_ENTRY (NamedBufferStorage) (buffer, size, data, flags);
+}
+
+static void APIENTRY Lazy_NamedBufferData (GLuint buffer, GLsizeiptr size, const void *data, GLenum usage)
+{
+    OGLP_ENTRY (NamedBufferData) = (PFNGLNAMEDBUFFERDATAPROC) LazyResolve ("glNamedBufferData");
+    return OGLP_ENTRY (NamedBufferData) (buffer, size, data, usage);
+}
+
+static void APIENTRY Lazy_NamedBufferSubData (GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    OGLP_ENTRY (NamedBufferSubData) = (PFNGLNAMEDBUFFERSUBDATAPROC) LazyResolve ("glNamedBufferSubData");
+    return OGLP_ENTRY (NamedBufferSubData) (buffer, offset, size, data);
+}
+
+static void APIENTRY Lazy_CopyNamedBufferSubData (GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+    OGLP_ENTRY (CopyNamedBufferSubData) = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC) LazyResolve ("glCopyNamedBufferSubData");
+    return OGLP_ENTRY (CopyNamedBufferSubData) (readBuffer, writeBuffer, readOffset, writeOffset, size);
+}
+
+static void APIENTRY Lazy_ClearNamedBufferData (GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data)
+{
+    OGLP_ENTRY (ClearNamedBufferData) = (PFNGLCLEARNAMEDBUFFERDATAPROC) LazyResolve ("glClearNamedBufferData");
+    return OGLP_ENTRY (ClearNamedBufferData) (buffer, internalformat, format, type, data);
+}
+
+static void APIENTRY Lazy_ClearNamedBufferSubData (GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data)
+{
+    OGLP_ENTRY (ClearNamedBufferSubData) = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC) LazyResolve ("glClearNamedBufferSubData");
+    return OGLP_ENTRY (ClearNamedBufferSubData) (buffer, internalformat, offset, size, format, type, data);
+}
+
+static void * APIENTRY Lazy_MapNamedBuffer (GLuint buffer, GLenum access)
+{
+    OGLP_ENTRY (MapNamedBuffer) = (PFNGLMAPNAMEDBUFFERPROC) LazyResolve ("glMapNamedBuffer");
+    return OGLP_ENTRY (MapNamedBuffer) (buffer, access);
+}
+
+static void * APIENTRY Lazy_MapNamedBufferRange (GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    OGLP_ENTRY (MapNamedBufferRange) = (PFNGLMAPNAMEDBUFFERRANGEPROC) LazyResolve ("glMapNamedBufferRange");
+    return OGLP_ENTRY (MapNamedBufferRange) (buffer, offset, length, access);
+}
+
+static GLboolean APIENTRY Lazy_UnmapNamedBuffer (GLuint buffer)
+{
+    OGLP_ENTRY (UnmapNamedBuffer) = (PFNGLUNMAPNAMEDBUFFERPROC) LazyResolve ("glUnmapNamedBuffer");
+    return OGLP_ENTRY (UnmapNamedBuffer) (buffer);
+}
+
+static void APIENTRY Lazy_FlushMappedNamedBufferRange (GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+    OGLP_ENTRY (FlushMappedNamedBufferRange) = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC) LazyResolve ("glFlushMappedNamedBufferRange");
+    return OGLP_ENTRY (FlushMappedNamedBufferRange) (buffer, offset, length);
+}
+
+static void APIENTRY Lazy_GetNamedBufferParameteriv (GLuint buffer, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetNamedBufferParameteriv) = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC) LazyResolve ("glGetNamedBufferParameteriv");
+    return OGLP_ENTRY (GetNamedBufferParameteriv) (buffer, pname, params);
+}
+
+static void APIENTRY Lazy_GetNamedBufferParameteri64v (GLuint buffer, GLenum pname, GLint64 *params)
+{
+    OGLP_ENTRY (GetNamedBufferParameteri64v) = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC) LazyResolve ("glGetNamedBufferParameteri64v");
+    return OGLP_ENTRY (GetNamedBufferParameteri64v) (buffer, pname, params);
+}
+
+static void APIENTRY Lazy_GetNamedBufferPointerv (GLuint buffer, GLenum pname, void **params)
+{
+    OGLP_ENTRY (GetNamedBufferPointerv) = (PFNGLGETNAMEDBUFFERPOINTERVPROC) LazyResolve ("glGetNamedBufferPointerv");
+    return OGLP_ENTRY (GetNamedBufferPointerv) (buffer, pname, params);
+}
+
+static void APIENTRY Lazy_GetNamedBufferSubData (GLuint buffer, GLintptr offset, GLsizeiptr size, void *data)
+{
+    OGLP_ENTRY (GetNamedBufferSubData) = (PFNGLGETNAMEDBUFFERSUBDATAPROC) LazyResolve ("glGetNamedBufferSubData");
+    return OGLP_ENTRY (GetNamedBufferSubData) (buffer, offset, size, data);
+}
+
+static void APIENTRY Lazy_CreateFramebuffers (GLsizei n, GLuint *framebuffers)
+{
+    OGLP_ENTRY (CreateFramebuffers) = (PFNGLCREATEFRAMEBUFFERSPROC) LazyResolve ("glCreateFramebuffers");
+    return OGLP_ENTRY (CreateFramebuffers) (n, framebuffers);
+}
+
+static void APIENTRY Lazy_NamedFramebufferRenderbuffer (GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+    OGLP_ENTRY (NamedFramebufferRenderbuffer) = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC) LazyResolve ("glNamedFramebufferRenderbuffer");
+    return OGLP_ENTRY (NamedFramebufferRenderbuffer) (framebuffer, attachment, renderbuffertarget, renderbuffer);
+}
+
+static void APIENTRY Lazy_NamedFramebufferParameteri (GLuint framebuffer, GLenum pname, GLint param)
+{
+    OGLP_ENTRY (NamedFramebufferParameteri) = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC) LazyResolve ("glNamedFramebufferParameteri");
+    return OGLP_ENTRY (NamedFramebufferParameteri) (framebuffer, pname, param);
+}
+
+static void APIENTRY Lazy_NamedFramebufferTexture (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level)
+{
+    OGLP_ENTRY (NamedFramebufferTexture) = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC) LazyResolve ("glNamedFramebufferTexture");
+    return OGLP_ENTRY (NamedFramebufferTexture) (framebuffer, attachment, texture, level);
+}
+
+static void APIENTRY Lazy_NamedFramebufferTextureLayer (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+    OGLP_ENTRY (NamedFramebufferTextureLayer) = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC) LazyResolve ("glNamedFramebufferTextureLayer");
+    return OGLP_ENTRY (NamedFramebufferTextureLayer) (framebuffer, attachment, texture, level, layer);
+}
+
+static void APIENTRY Lazy_NamedFramebufferDrawBuffer (GLuint framebuffer, GLenum buf)
+{
+    OGLP_ENTRY (NamedFramebufferDrawBuffer) = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC) LazyResolve ("glNamedFramebufferDrawBuffer");
+    return OGLP_ENTRY (NamedFramebufferDrawBuffer) (framebuffer, buf);
+}
+
+static void APIENTRY Lazy_NamedFramebufferDrawBuffers (GLuint framebuffer, GLsizei n, const GLenum *bufs)
+{
+    OGLP_ENTRY (NamedFramebufferDrawBuffers) = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC) LazyResolve ("glNamedFramebufferDrawBuffers");
+    return OGLP_ENTRY (NamedFramebufferDrawBuffers) (framebuffer, n, bufs);
+}
+
+static void APIENTRY Lazy_NamedFramebufferReadBuffer (GLuint framebuffer, GLenum src)
+{
+    OGLP_ENTRY (NamedFramebufferReadBuffer) = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC) LazyResolve ("glNamedFramebufferReadBuffer");
+    return OGLP_ENTRY (NamedFramebufferReadBuffer) (framebuffer, src);
+}
+
+static void APIENTRY Lazy_InvalidateNamedFramebufferData (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments)
+{
+    OGLP_ENTRY (InvalidateNamedFramebufferData) = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC) LazyResolve ("glInvalidateNamedFramebufferData");
+    return OGLP_ENTRY (InvalidateNamedFramebufferData) (framebuffer, numAttachments, attachments);
+}
+
+static void APIENTRY Lazy_InvalidateNamedFramebufferSubData (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    OGLP_ENTRY (InvalidateNamedFramebufferSubData) = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC) LazyResolve ("glInvalidateNamedFramebufferSubData");
+    return OGLP_ENTRY (InvalidateNamedFramebufferSubData) (framebuffer, numAttachments, attachments, x, y, width, height);
+}
+
+static void APIENTRY Lazy_ClearNamedFramebufferiv (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value)
+{
+    OGLP_ENTRY (ClearNamedFramebufferiv) = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC) LazyResolve ("glClearNamedFramebufferiv");
+    return OGLP_ENTRY (ClearNamedFramebufferiv) (framebuffer, buffer, drawbuffer, value);
+}
+
+static void APIENTRY Lazy_ClearNamedFramebufferuiv (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value)
+{
+    OGLP_ENTRY (ClearNamedFramebufferuiv) = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC) LazyResolve ("glClearNamedFramebufferuiv");
+    return OGLP_ENTRY (ClearNamedFramebufferuiv) (framebuffer, buffer, drawbuffer, value);
+}
+
+static void APIENTRY Lazy_ClearNamedFramebufferfv (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value)
+{
+    OGLP_ENTRY (ClearNamedFramebufferfv) = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC) LazyResolve ("glClearNamedFramebufferfv");
+    return OGLP_ENTRY (ClearNamedFramebufferfv) (framebuffer, buffer, drawbuffer, value);
+}
+
+static void APIENTRY Lazy_ClearNamedFramebufferfi (GLuint framebuffer, GLenum buffer, const GLfloat depth, GLint stencil)
+{
+    OGLP_ENTRY (ClearNamedFramebufferfi) = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC) LazyResolve ("glClearNamedFramebufferfi");
+    return OGLP_ENTRY (ClearNamedFramebufferfi) (framebuffer, buffer, depth, stencil);
+}
+
+static void APIENTRY Lazy_BlitNamedFramebuffer (GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+    OGLP_ENTRY (BlitNamedFramebuffer) = (PFNGLBLITNAMEDFRAMEBUFFERPROC) LazyResolve ("glBlitNamedFramebuffer");
+    return OGLP_ENTRY (BlitNamedFramebuffer) (readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+static GLenum APIENTRY Lazy_CheckNamedFramebufferStatus (GLuint framebuffer, GLenum target)
+{
+    OGLP_ENTRY (CheckNamedFramebufferStatus) = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC) LazyResolve ("glCheckNamedFramebufferStatus");
+    return OGLP_ENTRY (CheckNamedFramebufferStatus) (framebuffer, target);
+}
+
+static void APIENTRY Lazy_GetNamedFramebufferParameteriv (GLuint framebuffer, GLenum pname, GLint *param)
+{
+    OGLP_ENTRY (GetNamedFramebufferParameteriv) = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC) LazyResolve ("glGetNamedFramebufferParameteriv");
+    return OGLP_ENTRY (GetNamedFramebufferParameteriv) (framebuffer, pname, param);
+}
+
+static void APIENTRY Lazy_GetNamedFramebufferAttachmentParameteriv (GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetNamedFramebufferAttachmentParameteriv) = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC) LazyResolve ("glGetNamedFramebufferAttachmentParameteriv");
+    return OGLP_ENTRY (GetNamedFramebufferAttachmentParameteriv) (framebuffer, attachment, pname, params);
+}
+
+static void APIENTRY Lazy_CreateRenderbuffers (GLsizei n, GLuint *renderbuffers)
+{
+    OGLP_ENTRY (CreateRenderbuffers) = (PFNGLCREATERENDERBUFFERSPROC) LazyResolve ("glCreateRenderbuffers");
+    return OGLP_ENTRY (CreateRenderbuffers) (n, renderbuffers);
+}
+
+static void APIENTRY Lazy_NamedRenderbufferStorage (GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    OGLP_ENTRY (NamedRenderbufferStorage) = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC) LazyResolve ("glNamedRenderbufferStorage");
+    return OGLP_ENTRY (NamedRenderbufferStorage) (renderbuffer, internalformat, width, height);
+}
+
+static void APIENTRY Lazy_NamedRenderbufferStorageMultisample (GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    OGLP_ENTRY (NamedRenderbufferStorageMultisample) = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC) LazyResolve ("glNamedRenderbufferStorageMultisample");
+    return OGLP_ENTRY (NamedRenderbufferStorageMultisample) (renderbuffer, samples, internalformat, width, height);
+}
+
+static void APIENTRY Lazy_GetNamedRenderbufferParameteriv (GLuint renderbuffer, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetNamedRenderbufferParameteriv) = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC) LazyResolve ("glGetNamedRenderbufferParameteriv");
+    return OGLP_ENTRY (GetNamedRenderbufferParameteriv) (renderbuffer, pname, params);
+}
+
+static void APIENTRY Lazy_CreateTextures (GLenum target, GLsizei n, GLuint *textures)
+{
+    OGLP_ENTRY (CreateTextures) = (PFNGLCREATETEXTURESPROC) LazyResolve ("glCreateTextures");
+    return OGLP_ENTRY (CreateTextures) (target, n, textures);
+}
+
+static void APIENTRY Lazy_TextureBuffer (GLuint texture, GLenum internalformat, GLuint buffer)
+{
+    OGLP_ENTRY (TextureBuffer) = (PFNGLTEXTUREBUFFERPROC) LazyResolve ("glTextureBuffer");
+    return OGLP_ENTRY (TextureBuffer) (texture, internalformat, buffer);
+}
+
+static void APIENTRY Lazy_TextureBufferRange (GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    OGLP_ENTRY (TextureBufferRange) = (PFNGLTEXTUREBUFFERRANGEPROC) LazyResolve ("glTextureBufferRange");
+    return OGLP_ENTRY (TextureBufferRange) (texture, internalformat, buffer, offset, size);
+}
+
+static void APIENTRY Lazy_TextureStorage1D (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width)
+{
+    OGLP_ENTRY (TextureStorage1D) = (PFNGLTEXTURESTORAGE1DPROC) LazyResolve ("glTextureStorage1D");
+    return OGLP_ENTRY (TextureStorage1D) (texture, levels, internalformat, width);
+}
+
+static void APIENTRY Lazy_TextureStorage2D (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    OGLP_ENTRY (TextureStorage2D) = (PFNGLTEXTURESTORAGE2DPROC) LazyResolve ("glTextureStorage2D");
+    return OGLP_ENTRY (TextureStorage2D) (texture, levels, internalformat, width, height);
+}
+
+static void APIENTRY Lazy_TextureStorage3D (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+    OGLP_ENTRY (TextureStorage3D) = (PFNGLTEXTURESTORAGE3DPROC) LazyResolve ("glTextureStorage3D");
+    return OGLP_ENTRY (TextureStorage3D) (texture, levels, internalformat, width, height, depth);
+}
+
+static void APIENTRY Lazy_TextureStorage2DMultisample (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+    OGLP_ENTRY (TextureStorage2DMultisample) = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC) LazyResolve ("glTextureStorage2DMultisample");
+    return OGLP_ENTRY (TextureStorage2DMultisample) (texture, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static void APIENTRY Lazy_TextureStorage3DMultisample (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+    OGLP_ENTRY (TextureStorage3DMultisample) = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC) LazyResolve ("glTextureStorage3DMultisample");
+    return OGLP_ENTRY (TextureStorage3DMultisample) (texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+static void APIENTRY Lazy_TextureSubImage1D (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels)
+{
+    OGLP_ENTRY (TextureSubImage1D) = (PFNGLTEXTURESUBIMAGE1DPROC) LazyResolve ("glTextureSubImage1D");
+    return OGLP_ENTRY (TextureSubImage1D) (texture, level, xoffset, width, format, type, pixels);
+}
+
+static void APIENTRY Lazy_TextureSubImage2D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+    OGLP_ENTRY (TextureSubImage2D) = (PFNGLTEXTURESUBIMAGE2DPROC) LazyResolve ("glTextureSubImage2D");
+    return OGLP_ENTRY (TextureSubImage2D) (texture, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+static void APIENTRY Lazy_TextureSubImage3D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels)
+{
+    OGLP_ENTRY (TextureSubImage3D) = (PFNGLTEXTURESUBIMAGE3DPROC) LazyResolve ("glTextureSubImage3D");
+    return OGLP_ENTRY (TextureSubImage3D) (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
+static void APIENTRY Lazy_CompressedTextureSubImage1D (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
+{
+    OGLP_ENTRY (CompressedTextureSubImage1D) = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC) LazyResolve ("glCompressedTextureSubImage1D");
+    return OGLP_ENTRY (CompressedTextureSubImage1D) (texture, level, xoffset, width, format, imageSize, data);
+}
+
+static void APIENTRY Lazy_CompressedTextureSubImage2D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+{
+    OGLP_ENTRY (CompressedTextureSubImage2D) = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC) LazyResolve ("glCompressedTextureSubImage2D");
+    return OGLP_ENTRY (CompressedTextureSubImage2D) (texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+
+static void APIENTRY Lazy_CompressedTextureSubImage3D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+{
+    OGLP_ENTRY (CompressedTextureSubImage3D) = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC) LazyResolve ("glCompressedTextureSubImage3D");
+    return OGLP_ENTRY (CompressedTextureSubImage3D) (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+
+static void APIENTRY Lazy_CopyTextureSubImage1D (GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+    OGLP_ENTRY (CopyTextureSubImage1D) = (PFNGLCOPYTEXTURESUBIMAGE1DPROC) LazyResolve ("glCopyTextureSubImage1D");
+    return OGLP_ENTRY (CopyTextureSubImage1D) (texture, level, xoffset, x, y, width);
+}
+
+static void APIENTRY Lazy_CopyTextureSubImage2D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    OGLP_ENTRY (CopyTextureSubImage2D) = (PFNGLCOPYTEXTURESUBIMAGE2DPROC) LazyResolve ("glCopyTextureSubImage2D");
+    return OGLP_ENTRY (CopyTextureSubImage2D) (texture, level, xoffset, yoffset, x, y, width, height);
+}
+
+static void APIENTRY Lazy_CopyTextureSubImage3D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    OGLP_ENTRY (CopyTextureSubImage3D) = (PFNGLCOPYTEXTURESUBIMAGE3DPROC) LazyResolve ("glCopyTextureSubImage3D");
+    return OGLP_ENTRY (CopyTextureSubImage3D) (texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+static void APIENTRY Lazy_TextureParameterf (GLuint texture, GLenum pname, GLfloat param)
+{
+    OGLP_ENTRY (TextureParameterf) = (PFNGLTEXTUREPARAMETERFPROC) LazyResolve ("glTextureParameterf");
+    return OGLP_ENTRY (TextureParameterf) (texture, pname, param);
+}
+
+static void APIENTRY Lazy_TextureParameterfv (GLuint texture, GLenum pname, const GLfloat *param)
+{
+    OGLP_ENTRY (TextureParameterfv) = (PFNGLTEXTUREPARAMETERFVPROC) LazyResolve ("glTextureParameterfv");
+    return OGLP_ENTRY (TextureParameterfv) (texture, pname, param);
+}
+
+static void APIENTRY Lazy_TextureParameteri (GLuint texture, GLenum pname, GLint param)
+{
+    OGLP_ENTRY (TextureParameteri) = (PFNGLTEXTUREPARAMETERIPROC) LazyResolve ("glTextureParameteri");
+    return OGLP_ENTRY (TextureParameteri) (texture, pname, param);
+}
+
+static void APIENTRY Lazy_TextureParameterIiv (GLuint texture, GLenum pname, const GLint *params)
+{
+    OGLP_ENTRY (TextureParameterIiv) = (PFNGLTEXTUREPARAMETERIIVPROC) LazyResolve ("glTextureParameterIiv");
+    return OGLP_ENTRY (TextureParameterIiv) (texture, pname, params);
+}
+
+static void APIENTRY Lazy_TextureParameterIuiv (GLuint texture, GLenum pname, const GLuint *params)
+{
+    OGLP_ENTRY (TextureParameterIuiv) = (PFNGLTEXTUREPARAMETERIUIVPROC) LazyResolve ("glTextureParameterIuiv");
+    return OGLP_ENTRY (TextureParameterIuiv) (texture, pname, params);
+}
+
+static void APIENTRY Lazy_TextureParameteriv (GLuint texture, GLenum pname, const GLint *param)
+{
+    OGLP_ENTRY (TextureParameteriv) = (PFNGLTEXTUREPARAMETERIVPROC) LazyResolve ("glTextureParameteriv");
+    return OGLP_ENTRY (TextureParameteriv) (texture, pname, param);
+}
+
+static void APIENTRY Lazy_GenerateTextureMipmap (GLuint texture)
+{
+    OGLP_ENTRY (GenerateTextureMipmap) = (PFNGLGENERATETEXTUREMIPMAPPROC) LazyResolve ("glGenerateTextureMipmap");
+    return OGLP_ENTRY (GenerateTextureMipmap) (texture);
+}
+
+static void APIENTRY Lazy_BindTextureUnit (GLuint unit, GLuint texture)
+{
+    OGLP_ENTRY (BindTextureUnit) = (PFNGLBINDTEXTUREUNITPROC) LazyResolve ("glBindTextureUnit");
+    return OGLP_ENTRY (BindTextureUnit) (unit, texture);
+}
+
+static void APIENTRY Lazy_GetTextureImage (GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+    OGLP_ENTRY (GetTextureImage) = (PFNGLGETTEXTUREIMAGEPROC) LazyResolve ("glGetTextureImage");
+    return OGLP_ENTRY (GetTextureImage) (texture, level, format, type, bufSize, pixels);
+}
+
+static void APIENTRY Lazy_GetCompressedTextureImage (GLuint texture, GLint level, GLsizei bufSize, void *pixels)
+{
+    OGLP_ENTRY (GetCompressedTextureImage) = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC) LazyResolve ("glGetCompressedTextureImage");
+    return OGLP_ENTRY (GetCompressedTextureImage) (texture, level, bufSize, pixels);
+}
+
+static void APIENTRY Lazy_GetTextureLevelParameterfv (GLuint texture, GLint level, GLenum pname, GLfloat *params)
+{
+    OGLP_ENTRY (GetTextureLevelParameterfv) = (PFNGLGETTEXTURELEVELPARAMETERFVPROC) LazyResolve ("glGetTextureLevelParameterfv");
+    return OGLP_ENTRY (GetTextureLevelParameterfv) (texture, level, pname, params);
+}
+
+static void APIENTRY Lazy_GetTextureLevelParameteriv (GLuint texture, GLint level, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetTextureLevelParameteriv) = (PFNGLGETTEXTURELEVELPARAMETERIVPROC) LazyResolve ("glGetTextureLevelParameteriv");
+    return OGLP_ENTRY (GetTextureLevelParameteriv) (texture, level, pname, params);
+}
+
+static void APIENTRY Lazy_GetTextureParameterfv (GLuint texture, GLenum pname, GLfloat *params)
+{
+    OGLP_ENTRY (GetTextureParameterfv) = (PFNGLGETTEXTUREPARAMETERFVPROC) LazyResolve ("glGetTextureParameterfv");
+    return OGLP_ENTRY (GetTextureParameterfv) (texture, pname, params);
+}
+
+static void APIENTRY Lazy_GetTextureParameterIiv (GLuint texture, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetTextureParameterIiv) = (PFNGLGETTEXTUREPARAMETERIIVPROC) LazyResolve ("glGetTextureParameterIiv");
+    return OGLP_ENTRY (GetTextureParameterIiv) (texture, pname, params);
+}
+
+static void APIENTRY Lazy_GetTextureParameterIuiv (GLuint texture, GLenum pname, GLuint *params)
+{
+    OGLP_ENTRY (GetTextureParameterIuiv) = (PFNGLGETTEXTUREPARAMETERIUIVPROC) LazyResolve ("glGetTextureParameterIuiv");
+    return OGLP_ENTRY (GetTextureParameterIuiv) (texture, pname, params);
+}
+
+static void APIENTRY Lazy_GetTextureParameteriv (GLuint texture, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetTextureParameteriv) = (PFNGLGETTEXTUREPARAMETERIVPROC) LazyResolve ("glGetTextureParameteriv");
+    return OGLP_ENTRY (GetTextureParameteriv) (texture, pname, params);
+}
+
+static void APIENTRY Lazy_CreateVertexArrays (GLsizei n, GLuint *arrays)
+{
+    OGLP_ENTRY (CreateVertexArrays) = (PFNGLCREATEVERTEXARRAYSPROC) LazyResolve ("glCreateVertexArrays");
+    return OGLP_ENTRY (CreateVertexArrays) (n, arrays);
+}
+
+static void APIENTRY Lazy_DisableVertexArrayAttrib (GLuint vaobj, GLuint index)
+{
+    OGLP_ENTRY (DisableVertexArrayAttrib) = (PFNGLDISABLEVERTEXARRAYATTRIBPROC) LazyResolve ("glDisableVertexArrayAttrib");
+    return OGLP_ENTRY (DisableVertexArrayAttrib) (vaobj, index);
+}
+
+static void APIENTRY Lazy_EnableVertexArrayAttrib (GLuint vaobj, GLuint index)
+{
+    OGLP_ENTRY (EnableVertexArrayAttrib) = (PFNGLENABLEVERTEXARRAYATTRIBPROC) LazyResolve ("glEnableVertexArrayAttrib");
+    return OGLP_ENTRY (EnableVertexArrayAttrib) (vaobj, index);
+}
+
+static void APIENTRY Lazy_VertexArrayElementBuffer (GLuint vaobj, GLuint buffer)
+{
+    OGLP_ENTRY (VertexArrayElementBuffer) = (PFNGLVERTEXARRAYELEMENTBUFFERPROC) LazyResolve ("glVertexArrayElementBuffer");
+    return OGLP_ENTRY (VertexArrayElementBuffer) (vaobj, buffer);
+}
+
+static void APIENTRY Lazy_VertexArrayVertexBuffer (GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+    OGLP_ENTRY (VertexArrayVertexBuffer) = (PFNGLVERTEXARRAYVERTEXBUFFERPROC) LazyResolve ("glVertexArrayVertexBuffer");
+    return OGLP_ENTRY (VertexArrayVertexBuffer) (vaobj, bindingindex, buffer, offset, stride);
+}
+
+static void APIENTRY Lazy_VertexArrayVertexBuffers (GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides)
+{
+    OGLP_ENTRY (VertexArrayVertexBuffers) = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC) LazyResolve ("glVertexArrayVertexBuffers");
+    return OGLP_ENTRY (VertexArrayVertexBuffers) (vaobj, first, count, buffers, offsets, strides);
+}
+
+static void APIENTRY Lazy_VertexArrayAttribBinding (GLuint vaobj, GLuint attribindex, GLuint bindingindex)
+{
+    OGLP_ENTRY (VertexArrayAttribBinding) = (PFNGLVERTEXARRAYATTRIBBINDINGPROC) LazyResolve ("glVertexArrayAttribBinding");
+    return OGLP_ENTRY (VertexArrayAttribBinding) (vaobj, attribindex, bindingindex);
+}
+
+static void APIENTRY Lazy_VertexArrayAttribFormat (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
+{
+    OGLP_ENTRY (VertexArrayAttribFormat) = (PFNGLVERTEXARRAYATTRIBFORMATPROC) LazyResolve ("glVertexArrayAttribFormat");
+    return OGLP_ENTRY (VertexArrayAttribFormat) (vaobj, attribindex, size, type, normalized, relativeoffset);
+}
+
+static void APIENTRY Lazy_VertexArrayAttribIFormat (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    OGLP_ENTRY (VertexArrayAttribIFormat) = (PFNGLVERTEXARRAYATTRIBIFORMATPROC) LazyResolve ("glVertexArrayAttribIFormat");
+    return OGLP_ENTRY (VertexArrayAttribIFormat) (vaobj, attribindex, size, type, relativeoffset);
+}
+
+static void APIENTRY Lazy_VertexArrayAttribLFormat (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    OGLP_ENTRY (VertexArrayAttribLFormat) = (PFNGLVERTEXARRAYATTRIBLFORMATPROC) LazyResolve ("glVertexArrayAttribLFormat");
+    return OGLP_ENTRY (VertexArrayAttribLFormat) (vaobj, attribindex, size, type, relativeoffset);
+}
+
+static void APIENTRY Lazy_VertexArrayBindingDivisor (GLuint vaobj, GLuint bindingindex, GLuint divisor)
+{
+    OGLP_ENTRY (VertexArrayBindingDivisor) = (PFNGLVERTEXARRAYBINDINGDIVISORPROC) LazyResolve ("glVertexArrayBindingDivisor");
+    return OGLP_ENTRY (VertexArrayBindingDivisor) (vaobj, bindingindex, divisor);
+}
+
+static void APIENTRY Lazy_GetVertexArrayiv (GLuint vaobj, GLenum pname, GLint *param)
+{
+    OGLP_ENTRY (GetVertexArrayiv) = (PFNGLGETVERTEXARRAYIVPROC) LazyResolve ("glGetVertexArrayiv");
+    return OGLP_ENTRY (GetVertexArrayiv) (vaobj, pname, param);
+}
+
+static void APIENTRY Lazy_GetVertexArrayIndexediv (GLuint vaobj, GLuint index, GLenum pname, GLint *param)
+{
+    OGLP_ENTRY (GetVertexArrayIndexediv) = (PFNGLGETVERTEXARRAYINDEXEDIVPROC) LazyResolve ("glGetVertexArrayIndexediv");
+    return OGLP_ENTRY (GetVertexArrayIndexediv) (vaobj, index, pname, param);
+}
+
+static void APIENTRY Lazy_GetVertexArrayIndexed64iv (GLuint vaobj, GLuint index, GLenum pname, GLint64 *param)
+{
+    OGLP_ENTRY (GetVertexArrayIndexed64iv) = (PFNGLGETVERTEXARRAYINDEXED64IVPROC) LazyResolve ("glGetVertexArrayIndexed64iv");
+    return OGLP_ENTRY (GetVertexArrayIndexed64iv) (vaobj, index, pname, param);
+}
+
+static void APIENTRY Lazy_CreateSamplers (GLsizei n, GLuint *samplers)
+{
+    OGLP_ENTRY (CreateSamplers) = (PFNGLCREATESAMPLERSPROC) LazyResolve ("glCreateSamplers");
+    return OGLP_ENTRY (CreateSamplers) (n, samplers);
+}
+
+static void APIENTRY Lazy_CreateProgramPipelines (GLsizei n, GLuint *pipelines)
+{
+    OGLP_ENTRY (CreateProgramPipelines) = (PFNGLCREATEPROGRAMPIPELINESPROC) LazyResolve ("glCreateProgramPipelines");
+    return OGLP_ENTRY (CreateProgramPipelines) (n, pipelines);
+}
+
+static void APIENTRY Lazy_CreateQueries (GLenum target, GLsizei n, GLuint *ids)
+{
+    OGLP_ENTRY (CreateQueries) = (PFNGLCREATEQUERIESPROC) LazyResolve ("glCreateQueries");
+    return OGLP_ENTRY (CreateQueries) (target, n, ids);
+}
+
+static void APIENTRY Lazy_GetQueryBufferObjecti64v (GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    OGLP_ENTRY (GetQueryBufferObjecti64v) = (PFNGLGETQUERYBUFFEROBJECTI64VPROC) LazyResolve ("glGetQueryBufferObjecti64v");
+    return OGLP_ENTRY (GetQueryBufferObjecti64v) (id, buffer, pname, offset);
+}
+
+static void APIENTRY Lazy_GetQueryBufferObjectiv (GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    OGLP_ENTRY (GetQueryBufferObjectiv) = (PFNGLGETQUERYBUFFEROBJECTIVPROC) LazyResolve ("glGetQueryBufferObjectiv");
+    return OGLP_ENTRY (GetQueryBufferObjectiv) (id, buffer, pname, offset);
+}
+
+static void APIENTRY Lazy_GetQueryBufferObjectui64v (GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    OGLP_ENTRY (GetQueryBufferObjectui64v) = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC) LazyResolve ("glGetQueryBufferObjectui64v");
+    return OGLP_ENTRY (GetQueryBufferObjectui64v) (id, buffer, pname, offset);
+}
+
+static void APIENTRY Lazy_GetQueryBufferObjectuiv (GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    OGLP_ENTRY (GetQueryBufferObjectuiv) = (PFNGLGETQUERYBUFFEROBJECTUIVPROC) LazyResolve ("glGetQueryBufferObjectuiv");
+    return OGLP_ENTRY (GetQueryBufferObjectuiv) (id, buffer, pname, offset);
+}
+
+static void APIENTRY Lazy_MemoryBarrierByRegion (GLbitfield barriers)
+{
+    OGLP_ENTRY (MemoryBarrierByRegion) = (PFNGLMEMORYBARRIERBYREGIONPROC) LazyResolve ("glMemoryBarrierByRegion");
+    return OGLP_ENTRY (MemoryBarrierByRegion) (barriers);
+}
+
+static void APIENTRY Lazy_GetTextureSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+    OGLP_ENTRY (GetTextureSubImage) = (PFNGLGETTEXTURESUBIMAGEPROC) LazyResolve ("glGetTextureSubImage");
+    return OGLP_ENTRY (GetTextureSubImage) (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+}
+
+static void APIENTRY Lazy_GetCompressedTextureSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels)
+{
+    OGLP_ENTRY (GetCompressedTextureSubImage) = (PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC) LazyResolve ("glGetCompressedTextureSubImage");
+    return OGLP_ENTRY (GetCompressedTextureSubImage) (texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+}
+
+static GLenum APIENTRY Lazy_GetGraphicsResetStatus (void)
+{
+    OGLP_ENTRY (GetGraphicsResetStatus) = (PFNGLGETGRAPHICSRESETSTATUSPROC) LazyResolve ("glGetGraphicsResetStatus");
+    return OGLP_ENTRY (GetGraphicsResetStatus) ();
+}
+
+static void APIENTRY Lazy_GetnCompressedTexImage (GLenum target, GLint lod, GLsizei bufSize, void *pixels)
+{
+    OGLP_ENTRY (GetnCompressedTexImage) = (PFNGLGETNCOMPRESSEDTEXIMAGEPROC) LazyResolve ("glGetnCompressedTexImage");
+    return OGLP_ENTRY (GetnCompressedTexImage) (target, lod, bufSize, pixels);
+}
+
+static void APIENTRY Lazy_GetnTexImage (GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+    OGLP_ENTRY (GetnTexImage) = (PFNGLGETNTEXIMAGEPROC) LazyResolve ("glGetnTexImage");
+    return OGLP_ENTRY (GetnTexImage) (target, level, format, type, bufSize, pixels);
+}
+
+static void APIENTRY Lazy_GetnUniformdv (GLuint program, GLint location, GLsizei bufSize, GLdouble *params)
+{
+    OGLP_ENTRY (GetnUniformdv) = (PFNGLGETNUNIFORMDVPROC) LazyResolve ("glGetnUniformdv");
+    return OGLP_ENTRY (GetnUniformdv) (program, location, bufSize, params);
+}
+
+static void APIENTRY Lazy_GetnUniformfv (GLuint program, GLint location, GLsizei bufSize, GLfloat *params)
+{
+    OGLP_ENTRY (GetnUniformfv) = (PFNGLGETNUNIFORMFVPROC) LazyResolve ("glGetnUniformfv");
+    return OGLP_ENTRY (GetnUniformfv) (program, location, bufSize, params);
+}
+
+static void APIENTRY Lazy_GetnUniformiv (GLuint program, GLint location, GLsizei bufSize, GLint *params)
+{
+    OGLP_ENTRY (GetnUniformiv) = (PFNGLGETNUNIFORMIVPROC) LazyResolve ("glGetnUniformiv");
+    return OGLP_ENTRY (GetnUniformiv) (program, location, bufSize, params);
+}
+
+static void APIENTRY Lazy_GetnUniformuiv (GLuint program, GLint location, GLsizei bufSize, GLuint *params)
+{
+    OGLP_ENTRY (GetnUniformuiv) = (PFNGLGETNUNIFORMUIVPROC) LazyResolve ("glGetnUniformuiv");
+    return OGLP_ENTRY (GetnUniformuiv) (program, location, bufSize, params);
+}
+
+static void APIENTRY Lazy_ReadnPixels (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data)
+{
+    OGLP_ENTRY (ReadnPixels) = (PFNGLREADNPIXELSPROC) LazyResolve ("glReadnPixels");
+    return OGLP_ENTRY (ReadnPixels) (x, y, width, height, format, type, bufSize, data);
+}
+
+static void APIENTRY Lazy_TextureBarrier (void)
+{
+    OGLP_ENTRY (TextureBarrier) = (PFNGLTEXTUREBARRIERPROC) LazyResolve ("glTextureBarrier");
+    return OGLP_ENTRY (TextureBarrier) ();
+}
+
+#endif /* !defined OGLP_DIRECT_LINK */
+
+static GLuint64 APIENTRY Lazy_GetTextureHandleARB (GLuint texture)
+{
+    OGLP_ENTRY (GetTextureHandleARB) = (PFNGLGETTEXTUREHANDLEARBPROC) LazyResolve ("glGetTextureHandleARB");
+    return OGLP_ENTRY (GetTextureHandleARB) (texture);
+}
+
+static GLuint64 APIENTRY Lazy_GetTextureSamplerHandleARB (GLuint texture, GLuint sampler)
+{
+    OGLP_ENTRY (GetTextureSamplerHandleARB) = (PFNGLGETTEXTURESAMPLERHANDLEARBPROC) LazyResolve ("glGetTextureSamplerHandleARB");
+    return OGLP_ENTRY (GetTextureSamplerHandleARB) (texture, sampler);
+}
+
+static void APIENTRY Lazy_MakeTextureHandleResidentARB (GLuint64 handle)
+{
+    OGLP_ENTRY (MakeTextureHandleResidentARB) = (PFNGLMAKETEXTUREHANDLERESIDENTARBPROC) LazyResolve ("glMakeTextureHandleResidentARB");
+    return OGLP_ENTRY (MakeTextureHandleResidentARB) (handle);
+}
+
+static void APIENTRY Lazy_MakeTextureHandleNonResidentARB (GLuint64 handle)
+{
+    OGLP_ENTRY (MakeTextureHandleNonResidentARB) = (PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC) LazyResolve ("glMakeTextureHandleNonResidentARB");
+    return OGLP_ENTRY (MakeTextureHandleNonResidentARB) (handle);
+}
+
+static GLuint64 APIENTRY Lazy_GetImageHandleARB (GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format)
+{
+    OGLP_ENTRY (GetImageHandleARB) = (PFNGLGETIMAGEHANDLEARBPROC) LazyResolve ("glGetImageHandleARB");
+    return OGLP_ENTRY (GetImageHandleARB) (texture, level, layered, layer, format);
+}
+
+static void APIENTRY Lazy_MakeImageHandleResidentARB (GLuint64 handle, GLenum access)
+{
+    OGLP_ENTRY (MakeImageHandleResidentARB) = (PFNGLMAKEIMAGEHANDLERESIDENTARBPROC) LazyResolve ("glMakeImageHandleResidentARB");
+    return OGLP_ENTRY (MakeImageHandleResidentARB) (handle, access);
+}
+
+static void APIENTRY Lazy_MakeImageHandleNonResidentARB (GLuint64 handle)
+{
+    OGLP_ENTRY (MakeImageHandleNonResidentARB) = (PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC) LazyResolve ("glMakeImageHandleNonResidentARB");
+    return OGLP_ENTRY (MakeImageHandleNonResidentARB) (handle);
+}
+
+static void APIENTRY Lazy_UniformHandleui64ARB (GLint location, GLuint64 value)
+{
+    OGLP_ENTRY (UniformHandleui64ARB) = (PFNGLUNIFORMHANDLEUI64ARBPROC) LazyResolve ("glUniformHandleui64ARB");
+    return OGLP_ENTRY (UniformHandleui64ARB) (location, value);
+}
+
+static void APIENTRY Lazy_UniformHandleui64vARB (GLint location, GLsizei count, const GLuint64 *value)
+{
+    OGLP_ENTRY (UniformHandleui64vARB) = (PFNGLUNIFORMHANDLEUI64VARBPROC) LazyResolve ("glUniformHandleui64vARB");
+    return OGLP_ENTRY (UniformHandleui64vARB) (location, count, value);
+}
+
+static void APIENTRY Lazy_ProgramUniformHandleui64ARB (GLuint program, GLint location, GLuint64 value)
+{
+    OGLP_ENTRY (ProgramUniformHandleui64ARB) = (PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC) LazyResolve ("glProgramUniformHandleui64ARB");
+    return OGLP_ENTRY (ProgramUniformHandleui64ARB) (program, location, value);
+}
+
+static void APIENTRY Lazy_ProgramUniformHandleui64vARB (GLuint program, GLint location, GLsizei count, const GLuint64 *values)
+{
+    OGLP_ENTRY (ProgramUniformHandleui64vARB) = (PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC) LazyResolve ("glProgramUniformHandleui64vARB");
+    return OGLP_ENTRY (ProgramUniformHandleui64vARB) (program, location, count, values);
+}
+
+static GLboolean APIENTRY Lazy_IsTextureHandleResidentARB (GLuint64 handle)
+{
+    OGLP_ENTRY (IsTextureHandleResidentARB) = (PFNGLISTEXTUREHANDLERESIDENTARBPROC) LazyResolve ("glIsTextureHandleResidentARB");
+    return OGLP_ENTRY (IsTextureHandleResidentARB) (handle);
+}
+
+static GLboolean APIENTRY Lazy_IsImageHandleResidentARB (GLuint64 handle)
+{
+    OGLP_ENTRY (IsImageHandleResidentARB) = (PFNGLISIMAGEHANDLERESIDENTARBPROC) LazyResolve ("glIsImageHandleResidentARB");
+    return OGLP_ENTRY (IsImageHandleResidentARB) (handle);
+}
+
+static void APIENTRY Lazy_VertexAttribL1ui64ARB (GLuint index, GLuint64EXT x)
+{
+    OGLP_ENTRY (VertexAttribL1ui64ARB) = (PFNGLVERTEXATTRIBL1UI64ARBPROC) LazyResolve ("glVertexAttribL1ui64ARB");
+    return OGLP_ENTRY (VertexAttribL1ui64ARB) (index, x);
+}
+
+static void APIENTRY Lazy_VertexAttribL1ui64vARB (GLuint index, const GLuint64EXT *v)
+{
+    OGLP_ENTRY (VertexAttribL1ui64vARB) = (PFNGLVERTEXATTRIBL1UI64VARBPROC) LazyResolve ("glVertexAttribL1ui64vARB");
+    return OGLP_ENTRY (VertexAttribL1ui64vARB) (index, v);
+}
+
+static void APIENTRY Lazy_GetVertexAttribLui64vARB (GLuint index, GLenum pname, GLuint64EXT *params)
+{
+    OGLP_ENTRY (GetVertexAttribLui64vARB) = (PFNGLGETVERTEXATTRIBLUI64VARBPROC) LazyResolve ("glGetVertexAttribLui64vARB");
+    return OGLP_ENTRY (GetVertexAttribLui64vARB) (index, pname, params);
+}
+
+static GLsync APIENTRY Lazy_CreateSyncFromCLeventARB (struct _cl_context *context, struct _cl_event *event, GLbitfield flags)
+{
+    OGLP_ENTRY (CreateSyncFromCLeventARB) = (PFNGLCREATESYNCFROMCLEVENTARBPROC) LazyResolve ("glCreateSyncFromCLeventARB");
+    return OGLP_ENTRY (CreateSyncFromCLeventARB) (context, event, flags);
+}
+
+static void APIENTRY Lazy_DispatchComputeGroupSizeARB (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z, GLuint group_size_x, GLuint group_size_y, GLuint group_size_z)
+{
+    OGLP_ENTRY (DispatchComputeGroupSizeARB) = (PFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC) LazyResolve ("glDispatchComputeGroupSizeARB");
+    return OGLP_ENTRY (DispatchComputeGroupSizeARB) (num_groups_x, num_groups_y, num_groups_z, group_size_x, group_size_y, group_size_z);
+}
+
+static void APIENTRY Lazy_DebugMessageControlARB (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled)
+{
+    OGLP_ENTRY (DebugMessageControlARB) = (PFNGLDEBUGMESSAGECONTROLARBPROC) LazyResolve ("glDebugMessageControlARB");
+    return OGLP_ENTRY (DebugMessageControlARB) (source, type, severity, count, ids, enabled);
+}
+
+static void APIENTRY Lazy_DebugMessageInsertARB (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf)
+{
+    OGLP_ENTRY (DebugMessageInsertARB) = (PFNGLDEBUGMESSAGEINSERTARBPROC) LazyResolve ("glDebugMessageInsertARB");
+    return OGLP_ENTRY (DebugMessageInsertARB) (source, type, id, severity, length, buf);
+}
+
+static void APIENTRY Lazy_DebugMessageCallbackARB (GLDEBUGPROCARB callback, const void *userParam)
+{
+    OGLP_ENTRY (DebugMessageCallbackARB) = (PFNGLDEBUGMESSAGECALLBACKARBPROC) LazyResolve ("glDebugMessageCallbackARB");
+    return OGLP_ENTRY (DebugMessageCallbackARB) (callback, userParam);
+}
+
+static GLuint APIENTRY Lazy_GetDebugMessageLogARB (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog)
+{
+    OGLP_ENTRY (GetDebugMessageLogARB) = (PFNGLGETDEBUGMESSAGELOGARBPROC) LazyResolve ("glGetDebugMessageLogARB");
+    return OGLP_ENTRY (GetDebugMessageLogARB) (count, bufSize, sources, types, ids, severities, lengths, messageLog);
+}
+
+static void APIENTRY Lazy_BlendEquationiARB (GLuint buf, GLenum mode)
+{
+    OGLP_ENTRY (BlendEquationiARB) = (PFNGLBLENDEQUATIONIARBPROC) LazyResolve ("glBlendEquationiARB");
+    return OGLP_ENTRY (BlendEquationiARB) (buf, mode);
+}
+
+static void APIENTRY Lazy_BlendEquationSeparateiARB (GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+    OGLP_ENTRY (BlendEquationSeparateiARB) = (PFNGLBLENDEQUATIONSEPARATEIARBPROC) LazyResolve ("glBlendEquationSeparateiARB");
+    return OGLP_ENTRY (BlendEquationSeparateiARB) (buf, modeRGB, modeAlpha);
+}
+
+static void APIENTRY Lazy_BlendFunciARB (GLuint buf, GLenum src, GLenum dst)
+{
+    OGLP_ENTRY (BlendFunciARB) = (PFNGLBLENDFUNCIARBPROC) LazyResolve ("glBlendFunciARB");
+    return OGLP_ENTRY (BlendFunciARB) (buf, src, dst);
+}
+
+static void APIENTRY Lazy_BlendFuncSeparateiARB (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+    OGLP_ENTRY (BlendFuncSeparateiARB) = (PFNGLBLENDFUNCSEPARATEIARBPROC) LazyResolve ("glBlendFuncSeparateiARB");
+    return OGLP_ENTRY (BlendFuncSeparateiARB) (buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+
+static void APIENTRY Lazy_MultiDrawArraysIndirectCountARB (GLenum mode, GLintptr indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+    OGLP_ENTRY (MultiDrawArraysIndirectCountARB) = (PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC) LazyResolve ("glMultiDrawArraysIndirectCountARB");
+    return OGLP_ENTRY (MultiDrawArraysIndirectCountARB) (mode, indirect, drawcount, maxdrawcount, stride);
+}
+
+static void APIENTRY Lazy_MultiDrawElementsIndirectCountARB (GLenum mode, GLenum type, GLintptr indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+    OGLP_ENTRY (MultiDrawElementsIndirectCountARB) = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC) LazyResolve ("glMultiDrawElementsIndirectCountARB");
+    return OGLP_ENTRY (MultiDrawElementsIndirectCountARB) (mode, type, indirect, drawcount, maxdrawcount, stride);
+}
+
+static GLenum APIENTRY Lazy_GetGraphicsResetStatusARB (void)
+{
+    OGLP_ENTRY (GetGraphicsResetStatusARB) = (PFNGLGETGRAPHICSRESETSTATUSARBPROC) LazyResolve ("glGetGraphicsResetStatusARB");
+    return OGLP_ENTRY (GetGraphicsResetStatusARB) ();
+}
+
+static void APIENTRY Lazy_GetnTexImageARB (GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *img)
+{
+    OGLP_ENTRY (GetnTexImageARB) = (PFNGLGETNTEXIMAGEARBPROC) LazyResolve ("glGetnTexImageARB");
+    return OGLP_ENTRY (GetnTexImageARB) (target, level, format, type, bufSize, img);
+}
+
+static void APIENTRY Lazy_ReadnPixelsARB (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data)
+{
+    OGLP_ENTRY (ReadnPixelsARB) = (PFNGLREADNPIXELSARBPROC) LazyResolve ("glReadnPixelsARB");
+    return OGLP_ENTRY (ReadnPixelsARB) (x, y, width, height, format, type, bufSize, data);
+}
+
+static void APIENTRY Lazy_GetnCompressedTexImageARB (GLenum target, GLint lod, GLsizei bufSize, void *img)
+{
+    OGLP_ENTRY (GetnCompressedTexImageARB) = (PFNGLGETNCOMPRESSEDTEXIMAGEARBPROC) LazyResolve ("glGetnCompressedTexImageARB");
+    return OGLP_ENTRY (GetnCompressedTexImageARB) (target, lod, bufSize, img);
+}
+
+static void APIENTRY Lazy_GetnUniformfvARB (GLuint program, GLint location, GLsizei bufSize, GLfloat *params)
+{
+    OGLP_ENTRY (GetnUniformfvARB) = (PFNGLGETNUNIFORMFVARBPROC) LazyResolve ("glGetnUniformfvARB");
+    return OGLP_ENTRY (GetnUniformfvARB) (program, location, bufSize, params);
+}
+
+static void APIENTRY Lazy_GetnUniformivARB (GLuint program, GLint location, GLsizei bufSize, GLint *params)
+{
+    OGLP_ENTRY (GetnUniformivARB) = (PFNGLGETNUNIFORMIVARBPROC) LazyResolve ("glGetnUniformivARB");
+    return OGLP_ENTRY (GetnUniformivARB) (program, location, bufSize, params);
+}
+
+static void APIENTRY Lazy_GetnUniformuivARB (GLuint program, GLint location, GLsizei bufSize, GLuint *params)
+{
+    OGLP_ENTRY (GetnUniformuivARB) = (PFNGLGETNUNIFORMUIVARBPROC) LazyResolve ("glGetnUniformuivARB");
+    return OGLP_ENTRY (GetnUniformuivARB) (program, location, bufSize, params);
+}
+
+static void APIENTRY Lazy_GetnUniformdvARB (GLuint program, GLint location, GLsizei bufSize, GLdouble *params)
+{
+    OGLP_ENTRY (GetnUniformdvARB) = (PFNGLGETNUNIFORMDVARBPROC) LazyResolve ("glGetnUniformdvARB");
+    return OGLP_ENTRY (GetnUniformdvARB) (program, location, bufSize, params);
+}
+
+static void APIENTRY Lazy_MinSampleShadingARB (GLfloat value)
+{
+    OGLP_ENTRY (MinSampleShadingARB) = (PFNGLMINSAMPLESHADINGARBPROC) LazyResolve ("glMinSampleShadingARB");
+    return OGLP_ENTRY (MinSampleShadingARB) (value);
+}
+
+static void APIENTRY Lazy_NamedStringARB (GLenum type, GLint namelen, const GLchar *name, GLint stringlen, const GLchar *string)
+{
+    OGLP_ENTRY (NamedStringARB) = (PFNGLNAMEDSTRINGARBPROC) LazyResolve ("glNamedStringARB");
+    return OGLP_ENTRY (NamedStringARB) (type, namelen, name, stringlen, string);
+}
+
+static void APIENTRY Lazy_DeleteNamedStringARB (GLint namelen, const GLchar *name)
+{
+    OGLP_ENTRY (DeleteNamedStringARB) = (PFNGLDELETENAMEDSTRINGARBPROC) LazyResolve ("glDeleteNamedStringARB");
+    return OGLP_ENTRY (DeleteNamedStringARB) (namelen, name);
+}
+
+static void APIENTRY Lazy_CompileShaderIncludeARB (GLuint shader, GLsizei count, const GLchar *const*path, const GLint *length)
+{
+    OGLP_ENTRY (CompileShaderIncludeARB) = (PFNGLCOMPILESHADERINCLUDEARBPROC) LazyResolve ("glCompileShaderIncludeARB");
+    return OGLP_ENTRY (CompileShaderIncludeARB) (shader, count, path, length);
+}
+
+static GLboolean APIENTRY Lazy_IsNamedStringARB (GLint namelen, const GLchar *name)
+{
+    OGLP_ENTRY (IsNamedStringARB) = (PFNGLISNAMEDSTRINGARBPROC) LazyResolve ("glIsNamedStringARB");
+    return OGLP_ENTRY (IsNamedStringARB) (namelen, name);
+}
+
+static void APIENTRY Lazy_GetNamedStringARB (GLint namelen, const GLchar *name, GLsizei bufSize, GLint *stringlen, GLchar *string)
+{
+    OGLP_ENTRY (GetNamedStringARB) = (PFNGLGETNAMEDSTRINGARBPROC) LazyResolve ("glGetNamedStringARB");
+    return OGLP_ENTRY (GetNamedStringARB) (namelen, name, bufSize, stringlen, string);
+}
+
+static void APIENTRY Lazy_GetNamedStringivARB (GLint namelen, const GLchar *name, GLenum pname, GLint *params)
+{
+    OGLP_ENTRY (GetNamedStringivARB) = (PFNGLGETNAMEDSTRINGIVARBPROC) LazyResolve ("glGetNamedStringivARB");
+    return OGLP_ENTRY (GetNamedStringivARB) (namelen, name, pname, params);
+}
+
+static void APIENTRY Lazy_BufferPageCommitmentARB (GLenum target, GLintptr offset, GLsizeiptr size, GLboolean commit)
+{
+    OGLP_ENTRY (BufferPageCommitmentARB) = (PFNGLBUFFERPAGECOMMITMENTARBPROC) LazyResolve ("glBufferPageCommitmentARB");
+    return OGLP_ENTRY (BufferPageCommitmentARB) (target, offset, size, commit);
+}
+
+static void APIENTRY Lazy_NamedBufferPageCommitmentEXT (GLuint buffer, GLintptr offset, GLsizeiptr size, GLboolean commit)
+{
+    OGLP_ENTRY (NamedBufferPageCommitmentEXT) = (PFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC) LazyResolve ("glNamedBufferPageCommitmentEXT");
+    return OGLP_ENTRY (NamedBufferPageCommitmentEXT) (buffer, offset, size, commit);
+}
+
+static void APIENTRY Lazy_NamedBufferPageCommitmentARB (GLuint buffer, GLintptr offset, GLsizeiptr size, GLboolean commit)
+{
+    OGLP_ENTRY (NamedBufferPageCommitmentARB) = (PFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC) LazyResolve ("glNamedBufferPageCommitmentARB");
+    return OGLP_ENTRY (NamedBufferPageCommitmentARB) (buffer, offset, size, commit);
+}
+
+static void APIENTRY Lazy_TexPageCommitmentARB (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean commit)
+{
+    OGLP_ENTRY (TexPageCommitmentARB) = (PFNGLTEXPAGECOMMITMENTARBPROC) LazyResolve ("glTexPageCommitmentARB");
+    return OGLP_ENTRY (TexPageCommitmentARB) (target, level, xoffset, yoffset, zoffset, width, height, depth, commit);
+}
+
+static void APIENTRY Lazy_GetMultisamplefvNV (GLenum a0, GLuint a1, GLfloat *a2)
+{
+    OGLP_ENTRY (GetMultisamplefvNV) = (PFNGLGETMULTISAMPLEFVNVPROC) LazyResolve ("glGetMultisamplefvNV");
+    return OGLP_ENTRY (GetMultisamplefvNV) (a0, a1, a2);
+}
+
+static void APIENTRY Lazy_SampleMaskIndexedNV (GLuint a0, GLbitfield a1)
+{
+    OGLP_ENTRY (SampleMaskIndexedNV) = (PFNGLSAMPLEMASKINDEXEDNVPROC) LazyResolve ("glSampleMaskIndexedNV");
+    return OGLP_ENTRY (SampleMaskIndexedNV) (a0, a1);
+}
+
+static void APIENTRY Lazy_TexRenderbufferNV (GLenum a0, GLuint a1)
+{
+    OGLP_ENTRY (TexRenderbufferNV) = (PFNGLTEXRENDERBUFFERNVPROC) LazyResolve ("glTexRenderbufferNV");
+    return OGLP_ENTRY (TexRenderbufferNV) (a0, a1);
+}
+
+static void APIENTRY Lazy_MakeBufferResidentNV (GLenum target, GLenum access)
+{
+    OGLP_ENTRY (MakeBufferResidentNV) = (PFNGLMAKEBUFFERRESIDENTNVPROC) LazyResolve ("glMakeBufferResidentNV");
+    return OGLP_ENTRY (MakeBufferResidentNV) (target, access);
+}
+
+static void APIENTRY Lazy_MakeBufferNonResidentNV (GLenum target)
+{
+    OGLP_ENTRY (MakeBufferNonResidentNV) = (PFNGLMAKEBUFFERNONRESIDENTNVPROC) LazyResolve ("glMakeBufferNonResidentNV");
+    return OGLP_ENTRY (MakeBufferNonResidentNV) (target);
+}
+
+static GLboolean APIENTRY Lazy_IsBufferResidentNV (GLenum target)
+{
+    OGLP_ENTRY (IsBufferResidentNV) = (PFNGLISBUFFERRESIDENTNVPROC) LazyResolve ("glIsBufferResidentNV");
+    return OGLP_ENTRY (IsBufferResidentNV) (target);
+}
+
+static void APIENTRY Lazy_MakeNamedBufferResidentNV (GLuint buffer, GLenum access)
+{
+    OGLP_ENTRY (MakeNamedBufferResidentNV) = (PFNGLMAKENAMEDBUFFERRESIDENTNVPROC) LazyResolve ("glMakeNamedBufferResidentNV");
+    return OGLP_ENTRY (MakeNamedBufferResidentNV) (buffer, access);
+}
+
+static void APIENTRY Lazy_MakeNamedBufferNonResidentNV (GLuint buffer)
+{
+    OGLP_ENTRY (MakeNamedBufferNonResidentNV) = (PFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC) LazyResolve ("glMakeNamedBufferNonResidentNV");
+    return OGLP_ENTRY (MakeNamedBufferNonResidentNV) (buffer);
+}
+
+static GLboolean APIENTRY Lazy_IsNamedBufferResidentNV (GLuint buffer)
+{
+    OGLP_ENTRY (IsNamedBufferResidentNV) = (PFNGLISNAMEDBUFFERRESIDENTNVPROC) LazyResolve ("glIsNamedBufferResidentNV");
+    return OGLP_ENTRY (IsNamedBufferResidentNV) (buffer);
+}
+
+static void APIENTRY Lazy_GetBufferParameterui64vNV (GLenum target, GLenum pname, GLuint64EXT *params)
+{
+    OGLP_ENTRY (GetBufferParameterui64vNV) = (PFNGLGETBUFFERPARAMETERUI64VNVPROC) LazyResolve ("glGetBufferParameterui64vNV");
+    return OGLP_ENTRY (GetBufferParameterui64vNV) (target, pname, params);
+}
+
+static void APIENTRY Lazy_GetNamedBufferParameterui64vNV (GLuint buffer, GLenum pname, GLuint64EXT *params)
+{
+    OGLP_ENTRY (GetNamedBufferParameterui64vNV) = (PFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC) LazyResolve ("glGetNamedBufferParameterui64vNV");
+    return OGLP_ENTRY (GetNamedBufferParameterui64vNV) (buffer, pname, params);
+}
+
+static void APIENTRY Lazy_GetIntegerui64vNV (GLenum value, GLuint64EXT *result)
+{
+    OGLP_ENTRY (GetIntegerui64vNV) = (PFNGLGETINTEGERUI64VNVPROC) LazyResolve ("glGetIntegerui64vNV");
+    return OGLP_ENTRY (GetIntegerui64vNV) (value, result);
+}
+
+static void APIENTRY Lazy_Uniformui64NV (GLint location, GLuint64EXT value)
+{
+    OGLP_ENTRY (Uniformui64NV) = (PFNGLUNIFORMUI64NVPROC) LazyResolve ("glUniformui64NV");
+    return OGLP_ENTRY (Uniformui64NV) (location, value);
+}
+
+static void APIENTRY Lazy_Uniformui64vNV (GLint location, GLsizei count, const GLuint64EXT *value)
+{
+    OGLP_ENTRY (Uniformui64vNV) = (PFNGLUNIFORMUI64VNVPROC) LazyResolve ("glUniformui64vNV");
+    return OGLP_ENTRY (Uniformui64vNV) (location, count, value);
+}
+
+static void APIENTRY Lazy_ProgramUniformui64NV (GLuint program, GLint location, GLuint64EXT value)
+{
+    OGLP_ENTRY (ProgramUniformui64NV) = (PFNGLPROGRAMUNIFORMUI64NVPROC) LazyResolve ("glProgramUniformui64NV");
+    return OGLP_ENTRY (ProgramUniformui64NV) (program, location, value);
+}
+
+static void APIENTRY Lazy_ProgramUniformui64vNV (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value)
+{
+    OGLP_ENTRY (ProgramUniformui64vNV) = (PFNGLPROGRAMUNIFORMUI64VNVPROC) LazyResolve ("glProgramUniformui64vNV");
+    return OGLP_ENTRY (ProgramUniformui64vNV) (program, location, count, value);
+}
+
+static void APIENTRY Lazy_BufferAddressRangeNV (GLenum pname, GLuint index, GLuint64EXT address, GLsizeiptr length)
+{
+    OGLP_ENTRY (BufferAddressRangeNV) = (PFNGLBUFFERADDRESSRANGENVPROC) LazyResolve ("glBufferAddressRangeNV");
+    return OGLP_ENTRY (BufferAddressRangeNV) (pname, index, address, length);
+}
+
+static void APIENTRY Lazy_VertexFormatNV (GLint size, GLenum type, GLsizei stride)
+{
+    OGLP_ENTRY (VertexFormatNV) = (PFNGLVERTEXFORMATNVPROC) LazyResolve ("glVertexFormatNV");
+    return OGLP_ENTRY (VertexFormatNV) (size, type, stride);
+}
+
+static void APIENTRY Lazy_NormalFormatNV (GLenum type, GLsizei stride)
+{
+    OGLP_ENTRY (NormalFormatNV) = (PFNGLNORMALFORMATNVPROC) LazyResolve ("glNormalFormatNV");
+    return OGLP_ENTRY (NormalFormatNV) (type, stride);
+}
+
+static void APIENTRY Lazy_ColorFormatNV (GLint size, GLenum type, GLsizei stride)
+{
+    OGLP_ENTRY (ColorFormatNV) = (PFNGLCOLORFORMATNVPROC) LazyResolve ("glColorFormatNV");
+    return OGLP_ENTRY (ColorFormatNV) (size, type, stride);
+}
+
+static void APIENTRY Lazy_IndexFormatNV (GLenum type, GLsizei stride)
+{
+    OGLP_ENTRY (IndexFormatNV) = (PFNGLINDEXFORMATNVPROC) LazyResolve ("glIndexFormatNV");
+    return OGLP_ENTRY (IndexFormatNV) (type, stride);
+}
+
+static void APIENTRY Lazy_TexCoordFormatNV (GLint size, GLenum type, GLsizei stride)
+{
+    OGLP_ENTRY (TexCoordFormatNV) = (PFNGLTEXCOORDFORMATNVPROC) LazyResolve ("glTexCoordFormatNV");
+    return OGLP_ENTRY (TexCoordFormatNV) (size, type, stride);
+}
+
+static void APIENTRY Lazy_EdgeFlagFormatNV (GLsizei stride)
+{
+    OGLP_ENTRY (EdgeFlagFormatNV) = (PFNGLEDGEFLAGFORMATNVPROC) LazyResolve ("glEdgeFlagFormatNV");
+    return OGLP_ENTRY (EdgeFlagFormatNV) (stride);
+}
+
+static void APIENTRY Lazy_SecondaryColorFormatNV (GLint size, GLenum type, GLsizei stride)
+{
+    OGLP_ENTRY (SecondaryColorFormatNV) = (PFNGLSECONDARYCOLORFORMATNVPROC) LazyResolve ("glSecondaryColorFormatNV");
+    return OGLP_ENTRY (SecondaryColorFormatNV) (size, type, stride);
+}
+
+static void APIENTRY Lazy_FogCoordFormatNV (GLenum type, GLsizei stride)
+{
+    OGLP_ENTRY (FogCoordFormatNV) = (PFNGLFOGCOORDFORMATNVPROC) LazyResolve ("glFogCoordFormatNV");
+    return OGLP_ENTRY (FogCoordFormatNV) (type, stride);
+}
+
+static void APIENTRY Lazy_VertexAttribFormatNV (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride)
+{
+    OGLP_ENTRY (VertexAttribFormatNV) = (PFNGLVERTEXATTRIBFORMATNVPROC) LazyResolve ("glVertexAttribFormatNV");
+    return OGLP_ENTRY (VertexAttribFormatNV) (index, size, type, normalized, stride);
+}
+
+static void APIENTRY Lazy_VertexAttribIFormatNV (GLuint index, GLint size, GLenum type, GLsizei stride)
+{
+    OGLP_ENTRY (VertexAttribIFormatNV) = (PFNGLVERTEXATTRIBIFORMATNVPROC) LazyResolve ("glVertexAttribIFormatNV");
+    return OGLP_ENTRY (VertexAttribIFormatNV) (index, size, type, stride);
+}
+
+static void APIENTRY Lazy_GetIntegerui64i_vNV (GLenum value, GLuint index, GLuint64EXT *result)
+{
+    OGLP_ENTRY (GetIntegerui64i_vNV) = (PFNGLGETINTEGERUI64I_VNVPROC) LazyResolve ("glGetIntegerui64i_vNV");
+    return OGLP_ENTRY (GetIntegerui64i_vNV) (value, index, result);
+}
+
+static void APIENTRY Lazy_EnableClientState (GLenum cap)
+{
+    OGLP_ENTRY (EnableClientState) = (PFNGLENABLECLIENTSTATEPROC) LazyResolve ("glEnableClientState");
+    return OGLP_ENTRY (EnableClientState) (cap);
+}
+
+static void APIENTRY Lazy_DisableClientState (GLenum cap)
+{
+    OGLP_ENTRY (DisableClientState) = (PFNGLDISABLECLIENTSTATEPROC) LazyResolve ("glDisableClientState");
+    return OGLP_ENTRY (DisableClientState) (cap);
+}
+
+} /* namespace internal */
+
+void InitPrototypes (GetProcAddressCallback getprocaddress)
+{
+    void *ptr;
+
+    OGLP_GETPROCADDRESS = getprocaddress;
+#ifndef OGLP_DIRECT_LINK
+    ptr = getprocaddress ("glCullFace");
+    if (ptr) OGLP_ENTRY (CullFace) = (PFNGLCULLFACEPROC) ptr;
+    ptr = getprocaddress ("glFrontFace");
+    if (ptr) OGLP_ENTRY (FrontFace) = (PFNGLFRONTFACEPROC) ptr;
+    ptr = getprocaddress ("glHint");
+    if (ptr) OGLP_ENTRY (Hint) = (PFNGLHINTPROC) ptr;
+    ptr = getprocaddress ("glLineWidth");
+    if (ptr) OGLP_ENTRY (LineWidth) = (PFNGLLINEWIDTHPROC) ptr;
+    ptr = getprocaddress ("glPointSize");
+    if (ptr) OGLP_ENTRY (PointSize) = (PFNGLPOINTSIZEPROC) ptr;
+    ptr = getprocaddress ("glPolygonMode");
+    if (ptr) OGLP_ENTRY (PolygonMode) = (PFNGLPOLYGONMODEPROC) ptr;
+    ptr = getprocaddress ("glScissor");
+    if (ptr) OGLP_ENTRY (Scissor) = (PFNGLSCISSORPROC) ptr;
+    ptr = getprocaddress ("glTexParameterf");
+    if (ptr) OGLP_ENTRY (TexParameterf) = (PFNGLTEXPARAMETERFPROC) ptr;
+    ptr = getprocaddress ("glTexParameterfv");
+    if (ptr) OGLP_ENTRY (TexParameterfv) = (PFNGLTEXPARAMETERFVPROC) ptr;
+    ptr = getprocaddress ("glTexParameteri");
+    if (ptr) OGLP_ENTRY (TexParameteri) = (PFNGLTEXPARAMETERIPROC) ptr;
+    ptr = getprocaddress ("glTexParameteriv");
+    if (ptr) OGLP_ENTRY (TexParameteriv) = (PFNGLTEXPARAMETERIVPROC) ptr;
+    ptr = getprocaddress ("glTexImage1D");
+    if (ptr) OGLP_ENTRY (TexImage1D) = (PFNGLTEXIMAGE1DPROC) ptr;
+    ptr = getprocaddress ("glTexImage2D");
+    if (ptr) OGLP_ENTRY (TexImage2D) = (PFNGLTEXIMAGE2DPROC) ptr;
+    ptr = getprocaddress ("glDrawBuffer");
+    if (ptr) OGLP_ENTRY (DrawBuffer) = (PFNGLDRAWBUFFERPROC) ptr;
+    ptr = getprocaddress ("glClear");
+    if (ptr) OGLP_ENTRY (Clear) = (PFNGLCLEARPROC) ptr;
+    ptr = getprocaddress ("glClearColor");
+    if (ptr) OGLP_ENTRY (ClearColor) = (PFNGLCLEARCOLORPROC) ptr;
+    ptr = getprocaddress ("glClearStencil");
+    if (ptr) OGLP_ENTRY (ClearStencil) = (PFNGLCLEARSTENCILPROC) ptr;
+    ptr = getprocaddress ("glClearDepth");
+    if (ptr) OGLP_ENTRY (ClearDepth) = (PFNGLCLEARDEPTHPROC) ptr;
+    ptr = getprocaddress ("glStencilMask");
+    if (ptr) OGLP_ENTRY (StencilMask) = (PFNGLSTENCILMASKPROC) ptr;
+    ptr = getprocaddress ("glColorMask");
+    if (ptr) OGLP_ENTRY (ColorMask) = (PFNGLCOLORMASKPROC) ptr;
+    ptr = getprocaddress ("glDepthMask");
+    if (ptr) OGLP_ENTRY (DepthMask) = (PFNGLDEPTHMASKPROC) ptr;
+    ptr = getprocaddress ("glDisable");
+    if (ptr) OGLP_ENTRY (Disable) = (PFNGLDISABLEPROC) ptr;
+    ptr = getprocaddress ("glEnable");
+    if (ptr) OGLP_ENTRY (Enable) = (PFNGLENABLEPROC) ptr;
+    ptr = getprocaddress ("glFinish");
+    if (ptr) OGLP_ENTRY (Finish) = (PFNGLFINISHPROC) ptr;
+    ptr = getprocaddress ("glFlush");
+    if (ptr) OGLP_ENTRY (Flush) = (PFNGLFLUSHPROC) ptr;
+    ptr = getprocaddress ("glBlendFunc");
+    if (ptr) OGLP_ENTRY (BlendFunc) = (PFNGLBLENDFUNCPROC) ptr;
+    ptr = getprocaddress ("glLogicOp");
+    if (ptr) OGLP_ENTRY (LogicOp) = (PFNGLLOGICOPPROC) ptr;
+    ptr = getprocaddress ("glStencilFunc");
+    if (ptr) OGLP_ENTRY (StencilFunc) = (PFNGLSTENCILFUNCPROC) ptr;
+    ptr = getprocaddress ("glStencilOp");
+    if (ptr) OGLP_ENTRY (StencilOp) = (PFNGLSTENCILOPPROC) ptr;
+    ptr = getprocaddress ("glDepthFunc");
+    if (ptr) OGLP_ENTRY (DepthFunc) = (PFNGLDEPTHFUNCPROC) ptr;
+    ptr = getprocaddress ("glPixelStoref");
+    if (ptr) OGLP_ENTRY (PixelStoref) = (PFNGLPIXELSTOREFPROC) ptr;
+    ptr = getprocaddress ("glPixelStorei");
+    if (ptr) OGLP_ENTRY (PixelStorei) = (PFNGLPIXELSTOREIPROC) ptr;
+    ptr = getprocaddress ("glReadBuffer");
+    if (ptr) OGLP_ENTRY (ReadBuffer) = (PFNGLREADBUFFERPROC) ptr;
+    ptr = getprocaddress ("glReadPixels");
+    if (ptr) OGLP_ENTRY (ReadPixels) = (PFNGLREADPIXELSPROC) ptr;
+    ptr = getprocaddress ("glGetBooleanv");
+    if (ptr) OGLP_ENTRY (GetBooleanv) = (PFNGLGETBOOLEANVPROC) ptr;
+    ptr = getprocaddress ("glGetDoublev");
+    if (ptr) OGLP_ENTRY (GetDoublev) = (PFNGLGETDOUBLEVPROC) ptr;
+    ptr = getprocaddress ("glGetError");
+    if (ptr) OGLP_ENTRY (GetError) = (PFNGLGETERRORPROC) ptr;
+    ptr = getprocaddress ("glGetFloatv");
+    if (ptr) OGLP_ENTRY (GetFloatv) = (PFNGLGETFLOATVPROC) ptr;
+    ptr = getprocaddress ("glGetIntegerv");
+    if (ptr) OGLP_ENTRY (GetIntegerv) = (PFNGLGETINTEGERVPROC) ptr;
+    ptr = getprocaddress ("glGetString");
+    if (ptr) OGLP_ENTRY (GetString) = (PFNGLGETSTRINGPROC) ptr;
+    ptr = getprocaddress ("glGetTexImage");
+    if (ptr) OGLP_ENTRY (GetTexImage) = (PFNGLGETTEXIMAGEPROC) ptr;
+    ptr = getprocaddress ("glGetTexParameterfv");
+    if (ptr) OGLP_ENTRY (GetTexParameterfv) = (PFNGLGETTEXPARAMETERFVPROC) ptr;
+    ptr = getprocaddress ("glGetTexParameteriv");
+    if (ptr) OGLP_ENTRY (GetTexParameteriv) = (PFNGLGETTEXPARAMETERIVPROC) ptr;
+    ptr = getprocaddress ("glGetTexLevelParameterfv");
+    if (ptr) OGLP_ENTRY (GetTexLevelParameterfv) = (PFNGLGETTEXLEVELPARAMETERFVPROC) ptr;
+    ptr = getprocaddress ("glGetTexLevelParameteriv");
+    if (ptr) OGLP_ENTRY (GetTexLevelParameteriv) = (PFNGLGETTEXLEVELPARAMETERIVPROC) ptr;
+    ptr = getprocaddress ("glIsEnabled");
+    if (ptr) OGLP_ENTRY (IsEnabled) = (PFNGLISENABLEDPROC) ptr;
+    ptr = getprocaddress ("glDepthRange");
+    if (ptr) OGLP_ENTRY (DepthRange) = (PFNGLDEPTHRANGEPROC) ptr;
+    ptr = getprocaddress ("glViewport");
+    if (ptr) OGLP_ENTRY (Viewport) = (PFNGLVIEWPORTPROC) ptr;
+    ptr = getprocaddress ("glDrawArrays");
+    if (ptr) OGLP_ENTRY (DrawArrays) = (PFNGLDRAWARRAYSPROC) ptr;
+    ptr = getprocaddress ("glDrawElements");
+    if (ptr) OGLP_ENTRY (DrawElements) = (PFNGLDRAWELEMENTSPROC) ptr;
+    ptr = getprocaddress ("glGetPointerv");
+    if (ptr) OGLP_ENTRY (GetPointerv) = (PFNGLGETPOINTERVPROC) ptr;
+    ptr = getprocaddress ("glPolygonOffset");
+    if (ptr) OGLP_ENTRY (PolygonOffset) = (PFNGLPOLYGONOFFSETPROC) ptr;
+    ptr = getprocaddress ("glCopyTexImage1D");
+    if (ptr) OGLP_ENTRY (CopyTexImage1D) = (PFNGLCOPYTEXIMAGE1DPROC) ptr;
+    ptr = getprocaddress ("glCopyTexImage2D");
+    if (ptr) OGLP_ENTRY (CopyTexImage2D) = (PFNGLCOPYTEXIMAGE2DPROC) ptr;
+    ptr = getprocaddress ("glCopyTexSubImage1D");
+    if (ptr) OGLP_ENTRY (CopyTexSubImage1D) = (PFNGLCOPYTEXSUBIMAGE1DPROC) ptr;
+    ptr = getprocaddress ("glCopyTexSubImage2D");
+    if (ptr) OGLP_ENTRY (CopyTexSubImage2D) = (PFNGLCOPYTEXSUBIMAGE2DPROC) ptr;
+    ptr = getprocaddress ("glTexSubImage1D");
+    if (ptr) OGLP_ENTRY (TexSubImage1D) = (PFNGLTEXSUBIMAGE1DPROC) ptr;
+    ptr = getprocaddress ("glTexSubImage2D");
+    if (ptr) OGLP_ENTRY (TexSubImage2D) = (PFNGLTEXSUBIMAGE2DPROC) ptr;
+    ptr = getprocaddress ("glBindTexture");
+    if (ptr) OGLP_ENTRY (BindTexture) = (PFNGLBINDTEXTUREPROC) ptr;
+    ptr = getprocaddress ("glDeleteTextures");
+    if (ptr) OGLP_ENTRY (DeleteTextures) = (PFNGLDELETETEXTURESPROC) ptr;
+    ptr = getprocaddress ("glGenTextures");
+    if (ptr) OGLP_ENTRY (GenTextures) = (PFNGLGENTEXTURESPROC) ptr;
+    ptr = getprocaddress ("glIsTexture");
+    if (ptr) OGLP_ENTRY (IsTexture) = (PFNGLISTEXTUREPROC) ptr;
+    ptr = getprocaddress ("glDrawRangeElements");
+    if (ptr) OGLP_ENTRY (DrawRangeElements) = (PFNGLDRAWRANGEELEMENTSPROC) ptr;
+    ptr = getprocaddress ("glTexImage3D");
+    if (ptr) OGLP_ENTRY (TexImage3D) = (PFNGLTEXIMAGE3DPROC) ptr;
+    ptr = getprocaddress ("glTexSubImage3D");
+    if (ptr) OGLP_ENTRY (TexSubImage3D) = (PFNGLTEXSUBIMAGE3DPROC) ptr;
+    ptr = getprocaddress ("glCopyTexSubImage3D");
+    if (ptr) OGLP_ENTRY (CopyTexSubImage3D) = (PFNGLCOPYTEXSUBIMAGE3DPROC) ptr;
+    ptr = getprocaddress ("glActiveTexture");
+    if (ptr) OGLP_ENTRY (ActiveTexture) = (PFNGLACTIVETEXTUREPROC) ptr;
+    ptr = getprocaddress ("glSampleCoverage");
+    if (ptr) OGLP_ENTRY (SampleCoverage) = (PFNGLSAMPLECOVERAGEPROC) ptr;
+    ptr = getprocaddress ("glCompressedTexImage3D");
+    if (ptr) OGLP_ENTRY (CompressedTexImage3D) = (PFNGLCOMPRESSEDTEXIMAGE3DPROC) ptr;
+    ptr = getprocaddress ("glCompressedTexImage2D");
+    if (ptr) OGLP_ENTRY (CompressedTexImage2D) = (PFNGLCOMPRESSEDTEXIMAGE2DPROC) ptr;
+    ptr = getprocaddress ("glCompressedTexImage1D");
+    if (ptr) OGLP_ENTRY (CompressedTexImage1D) = (PFNGLCOMPRESSEDTEXIMAGE1DPROC) ptr;
+    ptr = getprocaddress ("glCompressedTexSubImage3D");
+    if (ptr) OGLP_ENTRY (CompressedTexSubImage3D) = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC) ptr;
+    ptr = getprocaddress ("glCompressedTexSubImage2D");
+    if (ptr) OGLP_ENTRY (CompressedTexSubImage2D) = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC) ptr;
+    ptr = getprocaddress ("glCompressedTexSubImage1D");
+    if (ptr) OGLP_ENTRY (CompressedTexSubImage1D) = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC) ptr;
+    ptr = getprocaddress ("glGetCompressedTexImage");
+    if (ptr) OGLP_ENTRY (GetCompressedTexImage) = (PFNGLGETCOMPRESSEDTEXIMAGEPROC) ptr;
+    ptr = getprocaddress ("glBlendFuncSeparate");
+    if (ptr) OGLP_ENTRY (BlendFuncSeparate) = (PFNGLBLENDFUNCSEPARATEPROC) ptr;
+    ptr = getprocaddress ("glMultiDrawArrays");
+    if (ptr) OGLP_ENTRY (MultiDrawArrays) = (PFNGLMULTIDRAWARRAYSPROC) ptr;
+    ptr = getprocaddress ("glMultiDrawElements");
+    if (ptr) OGLP_ENTRY (MultiDrawElements) = (PFNGLMULTIDRAWELEMENTSPROC) ptr;
+    ptr = getprocaddress ("glPointParameterf");
+    if (ptr) OGLP_ENTRY (PointParameterf) = (PFNGLPOINTPARAMETERFPROC) ptr;
+    ptr = getprocaddress ("glPointParameterfv");
+    if (ptr) OGLP_ENTRY (PointParameterfv) = (PFNGLPOINTPARAMETERFVPROC) ptr;
+    ptr = getprocaddress ("glPointParameteri");
+    if (ptr) OGLP_ENTRY (PointParameteri) = (PFNGLPOINTPARAMETERIPROC) ptr;
+    ptr = getprocaddress ("glPointParameteriv");
+    if (ptr) OGLP_ENTRY (PointParameteriv) = (PFNGLPOINTPARAMETERIVPROC) ptr;
+    ptr = getprocaddress ("glBlendColor");
+    if (ptr) OGLP_ENTRY (BlendColor) = (PFNGLBLENDCOLORPROC) ptr;
+    ptr = getprocaddress ("glBlendEquation");
+    if (ptr) OGLP_ENTRY (BlendEquation) = (PFNGLBLENDEQUATIONPROC) ptr;
+    ptr = getprocaddress ("glGenQueries");
+    if (ptr) OGLP_ENTRY (GenQueries) = (PFNGLGENQUERIESPROC) ptr;
+    ptr = getprocaddress ("glDeleteQueries");
+    if (ptr) OGLP_ENTRY (DeleteQueries) = (PFNGLDELETEQUERIESPROC) ptr;
+    ptr = getprocaddress ("glIsQuery");
+    if (ptr) OGLP_ENTRY (IsQuery) = (PFNGLISQUERYPROC) ptr;
+    ptr = getprocaddress ("glBeginQuery");
+    if (ptr) OGLP_ENTRY (BeginQuery) = (PFNGLBEGINQUERYPROC) ptr;
+    ptr = getprocaddress ("glEndQuery");
+    if (ptr) OGLP_ENTRY (EndQuery) = (PFNGLENDQUERYPROC) ptr;
+    ptr = getprocaddress ("glGetQueryiv");
+    if (ptr) OGLP_ENTRY (GetQueryiv) = (PFNGLGETQUERYIVPROC) ptr;
+    ptr = getprocaddress ("glGetQueryObjectiv");
+    if (ptr) OGLP_ENTRY (GetQueryObjectiv) = (PFNGLGETQUERYOBJECTIVPROC) ptr;
+    ptr = getprocaddress ("glGetQueryObjectuiv");
+    if (ptr) OGLP_ENTRY (GetQueryObjectuiv) = (PFNGLGETQUERYOBJECTUIVPROC) ptr;
+    ptr = getprocaddress ("glBindBuffer");
+    if (ptr) OGLP_ENTRY (BindBuffer) = (PFNGLBINDBUFFERPROC) ptr;
+    ptr = getprocaddress ("glDeleteBuffers");
+    if (ptr) OGLP_ENTRY (DeleteBuffers) = (PFNGLDELETEBUFFERSPROC) ptr;
+    ptr = getprocaddress ("glGenBuffers");
+    if (ptr) OGLP_ENTRY (GenBuffers) = (PFNGLGENBUFFERSPROC) ptr;
+    ptr = getprocaddress ("glIsBuffer");
+    if (ptr) OGLP_ENTRY (IsBuffer) = (PFNGLISBUFFERPROC) ptr;
+    ptr = getprocaddress ("glBufferData");
+    if (ptr) OGLP_ENTRY (BufferData) = (PFNGLBUFFERDATAPROC) ptr;
+    ptr = getprocaddress ("glBufferSubData");
+    if (ptr) OGLP_ENTRY (BufferSubData) = (PFNGLBUFFERSUBDATAPROC) ptr;
+    ptr = getprocaddress ("glGetBufferSubData");
+    if (ptr) OGLP_ENTRY (GetBufferSubData) = (PFNGLGETBUFFERSUBDATAPROC) ptr;
+    ptr = getprocaddress ("glMapBuffer");
+    if (ptr) OGLP_ENTRY (MapBuffer) = (PFNGLMAPBUFFERPROC) ptr;
+    ptr = getprocaddress ("glUnmapBuffer");
+    if (ptr) OGLP_ENTRY (UnmapBuffer) = (PFNGLUNMAPBUFFERPROC) ptr;
+    ptr = getprocaddress ("glGetBufferParameteriv");
+    if (ptr) OGLP_ENTRY (GetBufferParameteriv) = (PFNGLGETBUFFERPARAMETERIVPROC) ptr;
+    ptr = getprocaddress ("glGetBufferPointerv");
+    if (ptr) OGLP_ENTRY (GetBufferPointerv) = (PFNGLGETBUFFERPOINTERVPROC) ptr;
+    ptr = getprocaddress ("glBlendEquationSeparate");
+    if (ptr) OGLP_ENTRY (BlendEquationSeparate) = (PFNGLBLENDEQUATIONSEPARATEPROC) ptr;
+    ptr = getprocaddress ("glDrawBuffers");
+    if (ptr) OGLP_ENTRY (DrawBuffers) = (PFNGLDRAWBUFFERSPROC) ptr;
+    ptr = getprocaddress ("glStencilOpSeparate");
+    if (ptr) OGLP_ENTRY (StencilOpSeparate) = (PFNGLSTENCILOPSEPARATEPROC) ptr;
+    ptr = getprocaddress ("glStencilFuncSeparate");
+    if (ptr) OGLP_ENTRY (StencilFuncSeparate) = (PFNGLSTENCILFUNCSEPARATEPROC) ptr;
+    ptr = getprocaddress ("glStencilMaskSeparate");
+    if (ptr) OGLP_ENTRY (StencilMaskSeparate) = (PFNGLSTENCILMASKSEPARATEPROC) ptr;
+    ptr = getprocaddress ("glAttachShader");
+    if (ptr) OGLP_ENTRY (AttachShader) = (PFNGLATTACHSHADERPROC) ptr;
+    ptr = getprocaddress ("glBindAttribLocation");
+    if (ptr) OGLP_ENTRY (BindAttribLocation) = (PFNGLBINDATTRIBLOCATIONPROC) ptr;
+    ptr = getprocaddress ("glCompileShader");
+    if (ptr) OGLP_ENTRY (CompileShader) = (PFNGLCOMPILESHADERPROC) ptr;
+    ptr = getprocaddress ("glCreateProgram");
+    if (ptr) OGLP_ENTRY (CreateProgram) = (PFNGLCREATEPROGRAMPROC) ptr;
+    ptr = getprocaddress ("glCreateShader");
+    if (ptr) OGLP_ENTRY (CreateShader) = (PFNGLCREATESHADERPROC) ptr;
+    ptr = getprocaddress ("glDeleteProgram");
+    if (ptr) OGLP_ENTRY (DeleteProgram) = (PFNGLDELETEPROGRAMPROC) ptr;
+    ptr = getprocaddress ("glDeleteShader");
+    if (ptr) OGLP_ENTRY (DeleteShader) = (PFNGLDELETESHADERPROC) ptr;
+    ptr = getprocaddress ("glDetachShader");
+    if (ptr) OGLP_ENTRY (DetachShader) = (PFNGLDETACHSHADERPROC) ptr;
+    ptr = getprocaddress ("glDisableVertexAttribArray");
+    if (ptr) OGLP_ENTRY (DisableVertexAttribArray) = (PFNGLDISABLEVERTEXATTRIBARRAYPROC) ptr;
+    ptr = getprocaddress ("glEnableVertexAttribArray");
+    if (ptr) OGLP_ENTRY (EnableVertexAttribArray) = (PFNGLENABLEVERTEXATTRIBARRAYPROC) ptr;
+    ptr = getprocaddress ("glGetActiveAttrib");
+    if (ptr) OGLP_ENTRY (GetActiveAttrib) = (PFNGLGETACTIVEATTRIBPROC) ptr;
+    ptr = getprocaddress ("glGetActiveUniform");
+    if (ptr) OGLP_ENTRY (GetActiveUniform) = (PFNGLGETACTIVEUNIFORMPROC) ptr;
+    ptr = getprocaddress ("glGetAttachedShaders");
+    if (ptr) OGLP_ENTRY (GetAttachedShaders) = (PFNGLGETATTACHEDSHADERSPROC) ptr;
+    ptr = getprocaddress ("glGetAttribLocation");
+    if (ptr) OGLP_ENTRY (GetAttribLocation) = (PFNGLGETATTRIBLOCATIONPROC) ptr;
+    ptr = getprocaddress ("glGetProgramiv");
+    if (ptr) OGLP_ENTRY (GetProgramiv) = (PFNGLGETPROGRAMIVPROC) ptr;
+    ptr = getprocaddress ("glGetProgramInfoLog");
+    if (ptr) OGLP_ENTRY (GetProgramInfoLog) = (PFNGLGETPROGRAMINFOLOGPROC) ptr;
+    ptr = getprocaddress ("glGetShaderiv");
+    if (ptr) OGLP_ENTRY (GetShaderiv) = (PFNGLGETSHADERIVPROC) ptr;
+    ptr = getprocaddress ("glGetShaderInfoLog");
+    if (ptr) OGLP_ENTRY (GetShaderInfoLog) = (PFNGLGETSHADERINFOLOGPROC) ptr;
+    ptr = getprocaddress ("glGetShaderSource");
+    if (ptr) OGLP_ENTRY (GetShaderSource) = (PFNGLGETSHADERSOURCEPROC) ptr;
+    ptr = getprocaddress ("glGetUniformLocation");
+    if (ptr) OGLP_ENTRY (GetUniformLocation) = (PFNGLGETUNIFORMLOCATIONPROC) ptr;
+    ptr = getprocaddress ("glGetUniformfv");
+    if (ptr) OGLP_ENTRY (GetUniformfv) = (PFNGLGETUNIFORMFVPROC) ptr;
+    ptr = getprocaddress ("glGetUniformiv");
+    if (ptr) OGLP_ENTRY (GetUniformiv) = (PFNGLGETUNIFORMIVPROC) ptr;
+    ptr = getprocaddress ("glGetVertexAttribdv");
+    if (ptr) OGLP_ENTRY (GetVertexAttribdv) = (PFNGLGETVERTEXATTRIBDVPROC) ptr;
+    ptr = getprocaddress ("glGetVertexAttribfv");
+    if (ptr) OGLP_ENTRY (GetVertexAttribfv) = (PFNGLGETVERTEXATTRIBFVPROC) ptr;
+    ptr = getprocaddress ("glGetVertexAttribiv");
+    if (ptr) OGLP_ENTRY (GetVertexAttribiv) = (PFNGLGETVERTEXATTRIBIVPROC) ptr;
+    ptr = getprocaddress ("glGetVertexAttribPointerv");
+    if (ptr) OGLP_ENTRY (GetVertexAttribPointerv) = (PFNGLGETVERTEXATTRIBPOINTERVPROC) ptr;
+    ptr = getprocaddress ("glIsProgram");
+    if (ptr) OGLP_ENTRY (IsProgram) = (PFNGLISPROGRAMPROC) ptr;
+    ptr = getprocaddress ("glIsShader");
+    if (ptr) OGLP_ENTRY (IsShader) = (PFNGLISSHADERPROC) ptr;
+    ptr = getprocaddress ("glLinkProgram");
+    if (ptr) OGLP_ENTRY (LinkProgram) = (PFNGLLINKPROGRAMPROC) ptr;
+    ptr = getprocaddress ("glShaderSource");
+    if (ptr) OGLP_ENTRY (ShaderSource) = (PFNGLSHADERSOURCEPROC) ptr;
+    ptr = getprocaddress ("glUseProgram");
+    if (ptr) OGLP_ENTRY (UseProgram) = (PFNGLUSEPROGRAMPROC) ptr;
+    ptr = getprocaddress ("glUniform1f");
+    if (ptr) OGLP_ENTRY (Uniform1f) = (PFNGLUNIFORM1FPROC) ptr;
+    ptr = getprocaddress ("glUniform2f");
+    if (ptr) OGLP_ENTRY (Uniform2f) = (PFNGLUNIFORM2FPROC) ptr;
+    ptr = getprocaddress ("glUniform3f");
+    if (ptr) OGLP_ENTRY (Uniform3f) = (PFNGLUNIFORM3FPROC) ptr;
+    ptr = getprocaddress ("glUniform4f");
+    if (ptr) OGLP_ENTRY (Uniform4f) = (PFNGLUNIFORM4FPROC) ptr;
+    ptr = getprocaddress ("glUniform1i");
+    if (ptr) OGLP_ENTRY (Uniform1i) = (PFNGLUNIFORM1IPROC) ptr;
+    ptr = getprocaddress ("glUniform2i");
+    if (ptr) OGLP_ENTRY (Uniform2i) = (PFNGLUNIFORM2IPROC) ptr;
+    ptr = getprocaddress ("glUniform3i");
+    if (ptr) OGLP_ENTRY (Uniform3i) = (PFNGLUNIFORM3IPROC) ptr;
+    ptr = getprocaddress ("glUniform4i");
+    if (ptr) OGLP_ENTRY (Uniform4i) = (PFNGLUNIFORM4IPROC) ptr;
+    ptr = getprocaddress ("glUniform1fv");
+    if (ptr) OGLP_ENTRY (Uniform1fv) = (PFNGLUNIFORM1FVPROC) ptr;
+    ptr = getprocaddress ("glUniform2fv");
+    if (ptr) OGLP_ENTRY (Uniform2fv) = (PFNGLUNIFORM2FVPROC) ptr;
+    ptr = getprocaddress ("glUniform3fv");
+    if (ptr) OGLP_ENTRY (Uniform3fv) = (PFNGLUNIFORM3FVPROC) ptr;
+    ptr = getprocaddress ("glUniform4fv");
+    if (ptr) OGLP_ENTRY (Uniform4fv) = (PFNGLUNIFORM4FVPROC) ptr;
+    ptr = getprocaddress ("glUniform1iv");
+    if (ptr) OGLP_ENTRY (Uniform1iv) = (PFNGLUNIFORM1IVPROC) ptr;
+    ptr = getprocaddress ("glUniform2iv");
+    if (ptr) OGLP_ENTRY (Uniform2iv) = (PFNGLUNIFORM2IVPROC) ptr;
+    ptr = getprocaddress ("glUniform3iv");
+    if (ptr) OGLP_ENTRY (Uniform3iv) = (PFNGLUNIFORM3IVPROC) ptr;
+    ptr = getprocaddress ("glUniform4iv");
+    if (ptr) OGLP_ENTRY (Uniform4iv) = (PFNGLUNIFORM4IVPROC) ptr;
+    ptr = getprocaddress ("glUniformMatrix2fv");
+    if (ptr) OGLP_ENTRY (UniformMatrix2fv) = (PFNGLUNIFORMMATRIX2FVPROC) ptr;
+    ptr = getprocaddress ("glUniformMatrix3fv");
+    if (ptr) OGLP_ENTRY (UniformMatrix3fv) = (PFNGLUNIFORMMATRIX3FVPROC) ptr;
+    ptr = getprocaddress ("glUniformMatrix4fv");
+    if (ptr) OGLP_ENTRY (UniformMatrix4fv) = (PFNGLUNIFORMMATRIX4FVPROC) ptr;
+    ptr = getprocaddress ("glValidateProgram");
+    if (ptr) OGLP_ENTRY (ValidateProgram) = (PFNGLVALIDATEPROGRAMPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib1d");
+    if (ptr) OGLP_ENTRY (VertexAttrib1d) = (PFNGLVERTEXATTRIB1DPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib1dv");
+    if (ptr) OGLP_ENTRY (VertexAttrib1dv) = (PFNGLVERTEXATTRIB1DVPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib1f");
+    if (ptr) OGLP_ENTRY (VertexAttrib1f) = (PFNGLVERTEXATTRIB1FPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib1fv");
+    if (ptr) OGLP_ENTRY (VertexAttrib1fv) = (PFNGLVERTEXATTRIB1FVPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib1s");
+    if (ptr) OGLP_ENTRY (VertexAttrib1s) = (PFNGLVERTEXATTRIB1SPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib1sv");
+    if (ptr) OGLP_ENTRY (VertexAttrib1sv) = (PFNGLVERTEXATTRIB1SVPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib2d");
+    if (ptr) OGLP_ENTRY (VertexAttrib2d) = (PFNGLVERTEXATTRIB2DPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib2dv");
+    if (ptr) OGLP_ENTRY (VertexAttrib2dv) = (PFNGLVERTEXATTRIB2DVPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib2f");
+    if (ptr) OGLP_ENTRY (VertexAttrib2f) = (PFNGLVERTEXATTRIB2FPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib2fv");
+    if (ptr) OGLP_ENTRY (VertexAttrib2fv) = (PFNGLVERTEXATTRIB2FVPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib2s");
+    if (ptr) OGLP_ENTRY (VertexAttrib2s) = (PFNGLVERTEXATTRIB2SPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib2sv");
+    if (ptr) OGLP_ENTRY (VertexAttrib2sv) = (PFNGLVERTEXATTRIB2SVPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib3d");
+    if (ptr) OGLP_ENTRY (VertexAttrib3d) = (PFNGLVERTEXATTRIB3DPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib3dv");
+    if (ptr) OGLP_ENTRY (VertexAttrib3dv) = (PFNGLVERTEXATTRIB3DVPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib3f");
+    if (ptr) OGLP_ENTRY (VertexAttrib3f) = (PFNGLVERTEXATTRIB3FPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib3fv");
+    if (ptr) OGLP_ENTRY (VertexAttrib3fv) = (PFNGLVERTEXATTRIB3FVPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib3s");
+    if (ptr) OGLP_ENTRY (VertexAttrib3s) = (PFNGLVERTEXATTRIB3SPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib3sv");
+    if (ptr) OGLP_ENTRY (VertexAttrib3sv) = (PFNGLVERTEXATTRIB3SVPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib4Nbv");
+    if (ptr) OGLP_ENTRY (VertexAttrib4Nbv) = (PFNGLVERTEXATTRIB4NBVPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib4Niv");
+    if (ptr) OGLP_ENTRY (VertexAttrib4Niv) = (PFNGLVERTEXATTRIB4NIVPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib4Nsv");
+    if (ptr) OGLP_ENTRY (VertexAttrib4Nsv) = (PFNGLVERTEXATTRIB4NSVPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib4Nub");
+    if (ptr) OGLP_ENTRY (VertexAttrib4Nub) = (PFNGLVERTEXATTRIB4NUBPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib4Nubv");
+    if (ptr) OGLP_ENTRY (VertexAttrib4Nubv) = (PFNGLVERTEXATTRIB4NUBVPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib4Nuiv");
+    if (ptr) OGLP_ENTRY (VertexAttrib4Nuiv) = (PFNGLVERTEXATTRIB4NUIVPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib4Nusv");
+    if (ptr) OGLP_ENTRY (VertexAttrib4Nusv) = (PFNGLVERTEXATTRIB4NUSVPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib4bv");
+    if (ptr) OGLP_ENTRY (VertexAttrib4bv) = (PFNGLVERTEXATTRIB4BVPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib4d");
+    if (ptr) OGLP_ENTRY (VertexAttrib4d) = (PFNGLVERTEXATTRIB4DPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib4dv");
+    if (ptr) OGLP_ENTRY (VertexAttrib4dv) = (PFNGLVERTEXATTRIB4DVPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib4f");
+    if (ptr) OGLP_ENTRY (VertexAttrib4f) = (PFNGLVERTEXATTRIB4FPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib4fv");
+    if (ptr) OGLP_ENTRY (VertexAttrib4fv) = (PFNGLVERTEXATTRIB4FVPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib4iv");
+    if (ptr) OGLP_ENTRY (VertexAttrib4iv) = (PFNGLVERTEXATTRIB4IVPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib4s");
+    if (ptr) OGLP_ENTRY (VertexAttrib4s) = (PFNGLVERTEXATTRIB4SPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib4sv");
+    if (ptr) OGLP_ENTRY (VertexAttrib4sv) = (PFNGLVERTEXATTRIB4SVPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib4ubv");
+    if (ptr) OGLP_ENTRY (VertexAttrib4ubv) = (PFNGLVERTEXATTRIB4UBVPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib4uiv");
+    if (ptr) OGLP_ENTRY (VertexAttrib4uiv) = (PFNGLVERTEXATTRIB4UIVPROC) ptr;
+    ptr = getprocaddress ("glVertexAttrib4usv");
+    if (ptr) OGLP_ENTRY (VertexAttrib4usv) = (PFNGLVERTEXATTRIB4USVPROC) ptr;
+    ptr = getprocaddress ("glVertexAttribPointer");
+    if (ptr) OGLP_ENTRY (VertexAttribPointer) = (PFNGLVERTEXATTRIBPOINTERPROC) ptr;
+    ptr = getprocaddress ("glUniformMatrix2x3fv");
+    if (ptr) OGLP_ENTRY (UniformMatrix2x3fv) = (PFNGLUNIFORMMATRIX2X3FVPROC) ptr;
+    ptr = getprocaddress ("glUniformMatrix3x2fv");
+    if (ptr) OGLP_ENTRY (UniformMatrix3x2fv) = (PFNGLUNIFORMMATRIX3X2FVPROC) ptr;
+    ptr = getprocaddress ("glUniformMatrix2x4fv");
+    if (ptr) OGLP_ENTRY (UniformMatrix2x4fv) = (PFNGLUNIFORMMATRIX2X4FVPROC) ptr;
+    ptr = getprocaddress ("glUniformMatrix4x2fv");
+    if (ptr) OGLP_ENTRY (UniformMatrix4x2fv) = (PFNGLUNIFORMMATRIX4X2FVPROC) ptr;
+    ptr = getprocaddress ("glUniformMatrix3x4fv");
+    if (ptr) OGLP_ENTRY (UniformMatrix3x4fv) = (PFNGLUNIFORMMATRIX3X4FVPROC) ptr;
+    ptr = getprocaddress ("glUniformMatrix4x3fv");
+    if (ptr) OGLP_ENTRY (UniformMatrix4x3fv) = (PFNGLUNIFORMMATRIX4X3FVPROC) ptr;
+    ptr = getprocaddress ("glColorMaski");
+    if (ptr) OGLP_ENTRY (ColorMaski) = (PFNGLCOLORMASKIPROC) ptr;
+    ptr = getprocaddress ("glGetBooleani_v");
+    if (ptr) OGLP_ENTRY (GetBooleani_v) = (PFNGLGETBOOLEANI_VPROC) ptr;
+    ptr = getprocaddress ("glGetIntegeri_v");
+    if (ptr) OGLP_ENTRY (GetIntegeri_v) = (PFNGLGETINTEGERI_VPROC) ptr;
+    ptr = getprocaddress ("glEnablei");
+    if (ptr) OGLP_ENTRY (Enablei) = (PFNGLENABLEIPROC) ptr;
+    ptr = getprocaddress ("glDisablei");
+    if (ptr) OGLP_ENTRY (Disablei) = (PFNGLDISABLEIPROC) ptr;
+    ptr = getprocaddress ("glIsEnabledi");
+    if (ptr) OGLP_ENTRY (IsEnabledi) = (PFNGLISENABLEDIPROC) ptr;
+    ptr = getprocaddress ("glBeginTransformFeedback");
+    if (ptr) OGLP_ENTRY (BeginTransformFeedback) = (PFNGLBEGINTRANSFORMFEEDBACKPROC) ptr;
+    ptr = getprocaddress ("glEndTransformFeedback");
+    if (ptr) OGLP_ENTRY (EndTransformFeedback) = (PFNGLENDTRANSFORMFEEDBACKPROC) ptr;
+    ptr = getprocaddress ("glBindBufferRange");
+    if (ptr) OGLP_ENTRY (BindBufferRange) = (PFNGLBINDBUFFERRANGEPROC) ptr;
+    ptr = getprocaddress ("glBindBufferBase");
+    if (ptr) OGLP_ENTRY (BindBufferBase) = (PFNGLBINDBUFFERBASEPROC) ptr;
+    ptr = getprocaddress ("glTransformFeedbackVaryings");
+    if (ptr) OGLP_ENTRY (TransformFeedbackVaryings) = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC) ptr;
+    ptr = getprocaddress ("glGetTransformFeedbackVarying");
+    if (ptr) OGLP_ENTRY (GetTransformFeedbackVarying) = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC) ptr;
+    ptr = getprocaddress ("glClampColor");
+    if (ptr) OGLP_ENTRY (ClampColor) = (PFNGLCLAMPCOLORPROC) ptr;
+    ptr = getprocaddress ("glBeginConditionalRender");
+    if (ptr) OGLP_ENTRY (BeginConditionalRender) = (PFNGLBEGINCONDITIONALRENDERPROC) ptr;
+    ptr = getprocaddress ("glEndConditionalRender");
+    if (ptr) OGLP_ENTRY (EndConditionalRender) = (PFNGLENDCONDITIONALRENDERPROC) ptr;
+    ptr = getprocaddress ("glVertexAttribIPointer");
+    if (ptr) OGLP_ENTRY (VertexAttribIPointer) = (PFNGLVERTEXATTRIBIPOINTERPROC) ptr;
+    ptr = getprocaddress ("glGetVertexAttribIiv");
+    if (ptr) OGLP_ENTRY (GetVertexAttribIiv) = (PFNGLGETVERTEXATTRIBIIVPROC) ptr;
+    ptr = getprocaddress ("glGetVertexAttribIuiv");
+    if (ptr) OGLP_ENTRY (GetVertexAttribIuiv) = (PFNGLGETVERTEXATTRIBIUIVPROC) ptr;
+    ptr = getprocaddress ("glVertexAttribI1i");
+    if (ptr) OGLP_ENTRY (VertexAttribI1i) = (PFNGLVERTEXATTRIBI1IPROC) ptr;
+    ptr = getprocaddress ("glVertexAttribI2i");
+    if (ptr) OGLP_ENTRY (VertexAttribI2i) = (PFNGLVERTEXATTRIBI2IPROC) ptr;
+    ptr = getprocaddress ("glVertexAttribI3i");
+    if (ptr) OGLP_ENTRY (VertexAttribI3i) = (PFNGLVERTEXATTRIBI3IPROC) ptr;
+    ptr = getprocaddress ("glVertexAttribI4i");
+    if (ptr) OGLP_ENTRY (VertexAttribI4i) = (PFNGLVERTEXATTRIBI4IPROC) ptr;
+    ptr = getprocaddress ("glVertexAttribI1ui");
+    if (ptr) OGLP_ENTRY (VertexAttribI1ui) = (PFNGLVERTEXATTRIBI1UIPROC) ptr;
+    ptr = getprocaddress ("glVertexAttribI2ui");
+    if (ptr) OGLP_ENTRY (VertexAttribI2ui) = (PFNGLVERTEXATTRIBI2UIPROC) ptr;
+    ptr = getprocaddress ("glVertexAttribI3ui");
+    if (ptr) OGLP_ENTRY (VertexAttribI3ui) = (PFNGLVERTEXATTRIBI3UIPROC) ptr;
+    ptr = getprocaddress ("glVertexAttribI4ui");
+    if (ptr) OGLP_ENTRY (VertexAttribI4ui) = (PFNGLVERTEXATTRIBI4UIPROC) ptr;
+    ptr = getprocaddress ("glVertexAttribI1iv");
+    if (ptr) OGLP_ENTRY (VertexAttribI1iv) = (PFNGLVERTEXATTRIBI1IVPROC) ptr;
+    ptr = getprocaddress ("glVertexAttribI2iv");
+    if (ptr) OGLP_ENTRY (VertexAttribI2iv) = (PFNGLVERTEXATTRIBI2IVPROC) ptr;
+    ptr = getprocaddress ("glVertexAttribI3iv");
+    if (ptr) OGLP_ENTRY (VertexAttribI3iv) = (PFNGLVERTEXATTRIBI3IVPROC) ptr;
     ptr = getprocaddress ("glVertexAttribI4iv");
-    if (ptr) VertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribI4iv) = (PFNGLVERTEXATTRIBI4IVPROC) ptr;
     ptr = getprocaddress ("glVertexAttribI1uiv");
-    if (ptr) VertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribI1uiv) = (PFNGLVERTEXATTRIBI1UIVPROC) ptr;
     ptr = getprocaddress ("glVertexAttribI2uiv");
-    if (ptr) VertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribI2uiv) = (PFNGLVERTEXATTRIBI2UIVPROC) ptr;
     ptr = getprocaddress ("glVertexAttribI3uiv");
-    if (ptr) VertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribI3uiv) = (PFNGLVERTEXATTRIBI3UIVPROC) ptr;
     ptr = getprocaddress ("glVertexAttribI4uiv");
-    if (ptr) VertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribI4uiv) = (PFNGLVERTEXATTRIBI4UIVPROC) ptr;
     ptr = getprocaddress ("glVertexAttribI4bv");
-    if (ptr) VertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribI4bv) = (PFNGLVERTEXATTRIBI4BVPROC) ptr;
     ptr = getprocaddress ("glVertexAttribI4sv");
-    if (ptr) VertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribI4sv) = (PFNGLVERTEXATTRIBI4SVPROC) ptr;
     ptr = getprocaddress ("glVertexAttribI4ubv");
-    if (ptr) VertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribI4ubv) = (PFNGLVERTEXATTRIBI4UBVPROC) ptr;
     ptr = getprocaddress ("glVertexAttribI4usv");
-    if (ptr) VertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribI4usv) = (PFNGLVERTEXATTRIBI4USVPROC) ptr;
     ptr = getprocaddress ("glGetUniformuiv");
-    if (ptr) GetUniformuiv = (PFNGLGETUNIFORMUIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetUniformuiv) = (PFNGLGETUNIFORMUIVPROC) ptr;
     ptr = getprocaddress ("glBindFragDataLocation");
-    if (ptr) BindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC) ptr;
+    if (ptr) OGLP_ENTRY (BindFragDataLocation) = (PFNGLBINDFRAGDATALOCATIONPROC) ptr;
     ptr = getprocaddress ("glGetFragDataLocation");
-    if (ptr) GetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetFragDataLocation) = (PFNGLGETFRAGDATALOCATIONPROC) ptr;
     ptr = getprocaddress ("glUniform1ui");
-    if (ptr) Uniform1ui = (PFNGLUNIFORM1UIPROC) ptr;
+    if (ptr) OGLP_ENTRY (Uniform1ui) = (PFNGLUNIFORM1UIPROC) ptr;
     ptr = getprocaddress ("glUniform2ui");
-    if (ptr) Uniform2ui = (PFNGLUNIFORM2UIPROC) ptr;
+    if (ptr) OGLP_ENTRY (Uniform2ui) = (PFNGLUNIFORM2UIPROC) ptr;
     ptr = getprocaddress ("glUniform3ui");
-    if (ptr) Uniform3ui = (PFNGLUNIFORM3UIPROC) ptr;
+    if (ptr) OGLP_ENTRY (Uniform3ui) = (PFNGLUNIFORM3UIPROC) ptr;
     ptr = getprocaddress ("glUniform4ui");
-    if (ptr) Uniform4ui = (PFNGLUNIFORM4UIPROC) ptr;
+    if (ptr) OGLP_ENTRY (Uniform4ui) = (PFNGLUNIFORM4UIPROC) ptr;
     ptr = getprocaddress ("glUniform1uiv");
-    if (ptr) Uniform1uiv = (PFNGLUNIFORM1UIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (Uniform1uiv) = (PFNGLUNIFORM1UIVPROC) ptr;
     ptr = getprocaddress ("glUniform2uiv");
-    if (ptr) Uniform2uiv = (PFNGLUNIFORM2UIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (Uniform2uiv) = (PFNGLUNIFORM2UIVPROC) ptr;
     ptr = getprocaddress ("glUniform3uiv");
-    if (ptr) Uniform3uiv = (PFNGLUNIFORM3UIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (Uniform3uiv) = (PFNGLUNIFORM3UIVPROC) ptr;
     ptr = getprocaddress ("glUniform4uiv");
-    if (ptr) Uniform4uiv = (PFNGLUNIFORM4UIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (Uniform4uiv) = (PFNGLUNIFORM4UIVPROC) ptr;
     ptr = getprocaddress ("glTexParameterIiv");
-    if (ptr) TexParameterIiv = (PFNGLTEXPARAMETERIIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (TexParameterIiv) = (PFNGLTEXPARAMETERIIVPROC) ptr;
     ptr = getprocaddress ("glTexParameterIuiv");
-    if (ptr) TexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (TexParameterIuiv) = (PFNGLTEXPARAMETERIUIVPROC) ptr;
     ptr = getprocaddress ("glGetTexParameterIiv");
-    if (ptr) GetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetTexParameterIiv) = (PFNGLGETTEXPARAMETERIIVPROC) ptr;
     ptr = getprocaddress ("glGetTexParameterIuiv");
-    if (ptr) GetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetTexParameterIuiv) = (PFNGLGETTEXPARAMETERIUIVPROC) ptr;
     ptr = getprocaddress ("glClearBufferiv");
-    if (ptr) ClearBufferiv = (PFNGLCLEARBUFFERIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ClearBufferiv) = (PFNGLCLEARBUFFERIVPROC) ptr;
     ptr = getprocaddress ("glClearBufferuiv");
-    if (ptr) ClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ClearBufferuiv) = (PFNGLCLEARBUFFERUIVPROC) ptr;
     ptr = getprocaddress ("glClearBufferfv");
-    if (ptr) ClearBufferfv = (PFNGLCLEARBUFFERFVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ClearBufferfv) = (PFNGLCLEARBUFFERFVPROC) ptr;
     ptr = getprocaddress ("glClearBufferfi");
-    if (ptr) ClearBufferfi = (PFNGLCLEARBUFFERFIPROC) ptr;
+    if (ptr) OGLP_ENTRY (ClearBufferfi) = (PFNGLCLEARBUFFERFIPROC) ptr;
     ptr = getprocaddress ("glGetStringi");
-    if (ptr) GetStringi = (PFNGLGETSTRINGIPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetStringi) = (PFNGLGETSTRINGIPROC) ptr;
     ptr = getprocaddress ("glIsRenderbuffer");
-    if (ptr) IsRenderbuffer = (PFNGLISRENDERBUFFERPROC) ptr;
+    if (ptr) OGLP_ENTRY (IsRenderbuffer) = (PFNGLISRENDERBUFFERPROC) ptr;
     ptr = getprocaddress ("glBindRenderbuffer");
-    if (ptr) BindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC) ptr;
+    if (ptr) OGLP_ENTRY (BindRenderbuffer) = (PFNGLBINDRENDERBUFFERPROC) ptr;
     ptr = getprocaddress ("glDeleteRenderbuffers");
-    if (ptr) DeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC) ptr;
+    if (ptr) OGLP_ENTRY (DeleteRenderbuffers) = (PFNGLDELETERENDERBUFFERSPROC) ptr;
     ptr = getprocaddress ("glGenRenderbuffers");
-    if (ptr) GenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC) ptr;
+    if (ptr) OGLP_ENTRY (GenRenderbuffers) = (PFNGLGENRENDERBUFFERSPROC) ptr;
     ptr = getprocaddress ("glRenderbufferStorage");
-    if (ptr) RenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC) ptr;
+    if (ptr) OGLP_ENTRY (RenderbufferStorage) = (PFNGLRENDERBUFFERSTORAGEPROC) ptr;
     ptr = getprocaddress ("glGetRenderbufferParameteriv");
-    if (ptr) GetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetRenderbufferParameteriv) = (PFNGLGETRENDERBUFFERPARAMETERIVPROC) ptr;
     ptr = getprocaddress ("glIsFramebuffer");
-    if (ptr) IsFramebuffer = (PFNGLISFRAMEBUFFERPROC) ptr;
+    if (ptr) OGLP_ENTRY (IsFramebuffer) = (PFNGLISFRAMEBUFFERPROC) ptr;
     ptr = getprocaddress ("glBindFramebuffer");
-    if (ptr) BindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC) ptr;
+    if (ptr) OGLP_ENTRY (BindFramebuffer) = (PFNGLBINDFRAMEBUFFERPROC) ptr;
     ptr = getprocaddress ("glDeleteFramebuffers");
-    if (ptr) DeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC) ptr;
+    if (ptr) OGLP_ENTRY (DeleteFramebuffers) = (PFNGLDELETEFRAMEBUFFERSPROC) ptr;
     ptr = getprocaddress ("glGenFramebuffers");
-    if (ptr) GenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC) ptr;
+    if (ptr) OGLP_ENTRY (GenFramebuffers) = (PFNGLGENFRAMEBUFFERSPROC) ptr;
     ptr = getprocaddress ("glCheckFramebufferStatus");
-    if (ptr) CheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC) ptr;
+    if (ptr) OGLP_ENTRY (CheckFramebufferStatus) = (PFNGLCHECKFRAMEBUFFERSTATUSPROC) ptr;
     ptr = getprocaddress ("glFramebufferTexture1D");
-    if (ptr) FramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC) ptr;
+    if (ptr) OGLP_ENTRY (FramebufferTexture1D) = (PFNGLFRAMEBUFFERTEXTURE1DPROC) ptr;
     ptr = getprocaddress ("glFramebufferTexture2D");
-    if (ptr) FramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC) ptr;
+    if (ptr) OGLP_ENTRY (FramebufferTexture2D) = (PFNGLFRAMEBUFFERTEXTURE2DPROC) ptr;
     ptr = getprocaddress ("glFramebufferTexture3D");
-    if (ptr) FramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC) ptr;
+    if (ptr) OGLP_ENTRY (FramebufferTexture3D) = (PFNGLFRAMEBUFFERTEXTURE3DPROC) ptr;
     ptr = getprocaddress ("glFramebufferRenderbuffer");
-    if (ptr) FramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC) ptr;
+    if (ptr) OGLP_ENTRY (FramebufferRenderbuffer) = (PFNGLFRAMEBUFFERRENDERBUFFERPROC) ptr;
     ptr = getprocaddress ("glGetFramebufferAttachmentParameteriv");
-    if (ptr) GetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetFramebufferAttachmentParameteriv) = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC) ptr;
     ptr = getprocaddress ("glGenerateMipmap");
-    if (ptr) GenerateMipmap = (PFNGLGENERATEMIPMAPPROC) ptr;
+    if (ptr) OGLP_ENTRY (GenerateMipmap) = (PFNGLGENERATEMIPMAPPROC) ptr;
     ptr = getprocaddress ("glBlitFramebuffer");
-    if (ptr) BlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC) ptr;
+    if (ptr) OGLP_ENTRY (BlitFramebuffer) = (PFNGLBLITFRAMEBUFFERPROC) ptr;
     ptr = getprocaddress ("glRenderbufferStorageMultisample");
-    if (ptr) RenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC) ptr;
+    if (ptr) OGLP_ENTRY (RenderbufferStorageMultisample) = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC) ptr;
     ptr = getprocaddress ("glFramebufferTextureLayer");
-    if (ptr) FramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC) ptr;
+    if (ptr) OGLP_ENTRY (FramebufferTextureLayer) = (PFNGLFRAMEBUFFERTEXTURELAYERPROC) ptr;
     ptr = getprocaddress ("glMapBufferRange");
-    if (ptr) MapBufferRange = (PFNGLMAPBUFFERRANGEPROC) ptr;
+    if (ptr) OGLP_ENTRY (MapBufferRange) = (PFNGLMAPBUFFERRANGEPROC) ptr;
     ptr = getprocaddress ("glFlushMappedBufferRange");
-    if (ptr) FlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC) ptr;
+    if (ptr) OGLP_ENTRY (FlushMappedBufferRange) = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC) ptr;
     ptr = getprocaddress ("glBindVertexArray");
-    if (ptr) BindVertexArray = (PFNGLBINDVERTEXARRAYPROC) ptr;
+    if (ptr) OGLP_ENTRY (BindVertexArray) = (PFNGLBINDVERTEXARRAYPROC) ptr;
     ptr = getprocaddress ("glDeleteVertexArrays");
-    if (ptr) DeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC) ptr;
+    if (ptr) OGLP_ENTRY (DeleteVertexArrays) = (PFNGLDELETEVERTEXARRAYSPROC) ptr;
     ptr = getprocaddress ("glGenVertexArrays");
-    if (ptr) GenVertexArrays = (PFNGLGENVERTEXARRAYSPROC) ptr;
+    if (ptr) OGLP_ENTRY (GenVertexArrays) = (PFNGLGENVERTEXARRAYSPROC) ptr;
     ptr = getprocaddress ("glIsVertexArray");
-    if (ptr) IsVertexArray = (PFNGLISVERTEXARRAYPROC) ptr;
+    if (ptr) OGLP_ENTRY (IsVertexArray) = (PFNGLISVERTEXARRAYPROC) ptr;
     ptr = getprocaddress ("glDrawArraysInstanced");
-    if (ptr) DrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC) ptr;
+    if (ptr) OGLP_ENTRY (DrawArraysInstanced) = (PFNGLDRAWARRAYSINSTANCEDPROC) ptr;
     ptr = getprocaddress ("glDrawElementsInstanced");
-    if (ptr) DrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC) ptr;
+    if (ptr) OGLP_ENTRY (DrawElementsInstanced) = (PFNGLDRAWELEMENTSINSTANCEDPROC) ptr;
     ptr = getprocaddress ("glTexBuffer");
-    if (ptr) TexBuffer = (PFNGLTEXBUFFERPROC) ptr;
+    if (ptr) OGLP_ENTRY (TexBuffer) = (PFNGLTEXBUFFERPROC) ptr;
     ptr = getprocaddress ("glPrimitiveRestartIndex");
-    if (ptr) PrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC) ptr;
+    if (ptr) OGLP_ENTRY (PrimitiveRestartIndex) = (PFNGLPRIMITIVERESTARTINDEXPROC) ptr;
     ptr = getprocaddress ("glCopyBufferSubData");
-    if (ptr) CopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC) ptr;
+    if (ptr) OGLP_ENTRY (CopyBufferSubData) = (PFNGLCOPYBUFFERSUBDATAPROC) ptr;
     ptr = getprocaddress ("glGetUniformIndices");
-    if (ptr) GetUniformIndices = (PFNGLGETUNIFORMINDICESPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetUniformIndices) = (PFNGLGETUNIFORMINDICESPROC) ptr;
     ptr = getprocaddress ("glGetActiveUniformsiv");
-    if (ptr) GetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetActiveUniformsiv) = (PFNGLGETACTIVEUNIFORMSIVPROC) ptr;
     ptr = getprocaddress ("glGetActiveUniformName");
-    if (ptr) GetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetActiveUniformName) = (PFNGLGETACTIVEUNIFORMNAMEPROC) ptr;
     ptr = getprocaddress ("glGetUniformBlockIndex");
-    if (ptr) GetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetUniformBlockIndex) = (PFNGLGETUNIFORMBLOCKINDEXPROC) ptr;
     ptr = getprocaddress ("glGetActiveUniformBlockiv");
-    if (ptr) GetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetActiveUniformBlockiv) = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC) ptr;
     ptr = getprocaddress ("glGetActiveUniformBlockName");
-    if (ptr) GetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetActiveUniformBlockName) = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC) ptr;
     ptr = getprocaddress ("glUniformBlockBinding");
-    if (ptr) UniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC) ptr;
+    if (ptr) OGLP_ENTRY (UniformBlockBinding) = (PFNGLUNIFORMBLOCKBINDINGPROC) ptr;
     ptr = getprocaddress ("glDrawElementsBaseVertex");
-    if (ptr) DrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC) ptr;
+    if (ptr) OGLP_ENTRY (DrawElementsBaseVertex) = (PFNGLDRAWELEMENTSBASEVERTEXPROC) ptr;
     ptr = getprocaddress ("glDrawRangeElementsBaseVertex");
-    if (ptr) DrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC) ptr;
+    if (ptr) OGLP_ENTRY (DrawRangeElementsBaseVertex) = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC) ptr;
     ptr = getprocaddress ("glDrawElementsInstancedBaseVertex");
-    if (ptr) DrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC) ptr;
+    if (ptr) OGLP_ENTRY (DrawElementsInstancedBaseVertex) = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC) ptr;
     ptr = getprocaddress ("glMultiDrawElementsBaseVertex");
-    if (ptr) MultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC) ptr;
+    if (ptr) OGLP_ENTRY (MultiDrawElementsBaseVertex) = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC) ptr;
     ptr = getprocaddress ("glProvokingVertex");
-    if (ptr) ProvokingVertex = (PFNGLPROVOKINGVERTEXPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProvokingVertex) = (PFNGLPROVOKINGVERTEXPROC) ptr;
     ptr = getprocaddress ("glFenceSync");
-    if (ptr) FenceSync = (PFNGLFENCESYNCPROC) ptr;
+    if (ptr) OGLP_ENTRY (FenceSync) = (PFNGLFENCESYNCPROC) ptr;
     ptr = getprocaddress ("glIsSync");
-    if (ptr) IsSync = (PFNGLISSYNCPROC) ptr;
+    if (ptr) OGLP_ENTRY (IsSync) = (PFNGLISSYNCPROC) ptr;
     ptr = getprocaddress ("glDeleteSync");
-    if (ptr) DeleteSync = (PFNGLDELETESYNCPROC) ptr;
+    if (ptr) OGLP_ENTRY (DeleteSync) = (PFNGLDELETESYNCPROC) ptr;
     ptr = getprocaddress ("glClientWaitSync");
-    if (ptr) ClientWaitSync = (PFNGLCLIENTWAITSYNCPROC) ptr;
+    if (ptr) OGLP_ENTRY (ClientWaitSync) = (PFNGLCLIENTWAITSYNCPROC) ptr;
     ptr = getprocaddress ("glWaitSync");
-    if (ptr) WaitSync = (PFNGLWAITSYNCPROC) ptr;
+    if (ptr) OGLP_ENTRY (WaitSync) = (PFNGLWAITSYNCPROC) ptr;
     ptr = getprocaddress ("glGetInteger64v");
-    if (ptr) GetInteger64v = (PFNGLGETINTEGER64VPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetInteger64v) = (PFNGLGETINTEGER64VPROC) ptr;
     ptr = getprocaddress ("glGetSynciv");
-    if (ptr) GetSynciv = (PFNGLGETSYNCIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetSynciv) = (PFNGLGETSYNCIVPROC) ptr;
     ptr = getprocaddress ("glGetInteger64i_v");
-    if (ptr) GetInteger64i_v = (PFNGLGETINTEGER64I_VPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetInteger64i_v) = (PFNGLGETINTEGER64I_VPROC) ptr;
     ptr = getprocaddress ("glGetBufferParameteri64v");
-    if (ptr) GetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetBufferParameteri64v) = (PFNGLGETBUFFERPARAMETERI64VPROC) ptr;
     ptr = getprocaddress ("glFramebufferTexture");
-    if (ptr) FramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC) ptr;
+    if (ptr) OGLP_ENTRY (FramebufferTexture) = (PFNGLFRAMEBUFFERTEXTUREPROC) ptr;
     ptr = getprocaddress ("glTexImage2DMultisample");
-    if (ptr) TexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC) ptr;
+    if (ptr) OGLP_ENTRY (TexImage2DMultisample) = (PFNGLTEXIMAGE2DMULTISAMPLEPROC) ptr;
     ptr = getprocaddress ("glTexImage3DMultisample");
-    if (ptr) TexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC) ptr;
+    if (ptr) OGLP_ENTRY (TexImage3DMultisample) = (PFNGLTEXIMAGE3DMULTISAMPLEPROC) ptr;
     ptr = getprocaddress ("glGetMultisamplefv");
-    if (ptr) GetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetMultisamplefv) = (PFNGLGETMULTISAMPLEFVPROC) ptr;
     ptr = getprocaddress ("glSampleMaski");
-    if (ptr) SampleMaski = (PFNGLSAMPLEMASKIPROC) ptr;
+    if (ptr) OGLP_ENTRY (SampleMaski) = (PFNGLSAMPLEMASKIPROC) ptr;
     ptr = getprocaddress ("glBindFragDataLocationIndexed");
-    if (ptr) BindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC) ptr;
+    if (ptr) OGLP_ENTRY (BindFragDataLocationIndexed) = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC) ptr;
     ptr = getprocaddress ("glGetFragDataIndex");
-    if (ptr) GetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetFragDataIndex) = (PFNGLGETFRAGDATAINDEXPROC) ptr;
     ptr = getprocaddress ("glGenSamplers");
-    if (ptr) GenSamplers = (PFNGLGENSAMPLERSPROC) ptr;
+    if (ptr) OGLP_ENTRY (GenSamplers) = (PFNGLGENSAMPLERSPROC) ptr;
     ptr = getprocaddress ("glDeleteSamplers");
-    if (ptr) DeleteSamplers = (PFNGLDELETESAMPLERSPROC) ptr;
+    if (ptr) OGLP_ENTRY (DeleteSamplers) = (PFNGLDELETESAMPLERSPROC) ptr;
     ptr = getprocaddress ("glIsSampler");
-    if (ptr) IsSampler = (PFNGLISSAMPLERPROC) ptr;
+    if (ptr) OGLP_ENTRY (IsSampler) = (PFNGLISSAMPLERPROC) ptr;
     ptr = getprocaddress ("glBindSampler");
-    if (ptr) BindSampler = (PFNGLBINDSAMPLERPROC) ptr;
+    if (ptr) OGLP_ENTRY (BindSampler) = (PFNGLBINDSAMPLERPROC) ptr;
     ptr = getprocaddress ("glSamplerParameteri");
-    if (ptr) SamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC) ptr;
+    if (ptr) OGLP_ENTRY (SamplerParameteri) = (PFNGLSAMPLERPARAMETERIPROC) ptr;
     ptr = getprocaddress ("glSamplerParameteriv");
-    if (ptr) SamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (SamplerParameteriv) = (PFNGLSAMPLERPARAMETERIVPROC) ptr;
     ptr = getprocaddress ("glSamplerParameterf");
-    if (ptr) SamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC) ptr;
+    if (ptr) OGLP_ENTRY (SamplerParameterf) = (PFNGLSAMPLERPARAMETERFPROC) ptr;
     ptr = getprocaddress ("glSamplerParameterfv");
-    if (ptr) SamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC) ptr;
+    if (ptr) OGLP_ENTRY (SamplerParameterfv) = (PFNGLSAMPLERPARAMETERFVPROC) ptr;
     ptr = getprocaddress ("glSamplerParameterIiv");
-    if (ptr) SamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (SamplerParameterIiv) = (PFNGLSAMPLERPARAMETERIIVPROC) ptr;
     ptr = getprocaddress ("glSamplerParameterIuiv");
-    if (ptr) SamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (SamplerParameterIuiv) = (PFNGLSAMPLERPARAMETERIUIVPROC) ptr;
     ptr = getprocaddress ("glGetSamplerParameteriv");
-    if (ptr) GetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetSamplerParameteriv) = (PFNGLGETSAMPLERPARAMETERIVPROC) ptr;
     ptr = getprocaddress ("glGetSamplerParameterIiv");
-    if (ptr) GetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetSamplerParameterIiv) = (PFNGLGETSAMPLERPARAMETERIIVPROC) ptr;
     ptr = getprocaddress ("glGetSamplerParameterfv");
-    if (ptr) GetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetSamplerParameterfv) = (PFNGLGETSAMPLERPARAMETERFVPROC) ptr;
     ptr = getprocaddress ("glGetSamplerParameterIuiv");
-    if (ptr) GetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetSamplerParameterIuiv) = (PFNGLGETSAMPLERPARAMETERIUIVPROC) ptr;
     ptr = getprocaddress ("glQueryCounter");
-    if (ptr) QueryCounter = (PFNGLQUERYCOUNTERPROC) ptr;
+    if (ptr) OGLP_ENTRY (QueryCounter) = (PFNGLQUERYCOUNTERPROC) ptr;
     ptr = getprocaddress ("glGetQueryObjecti64v");
-    if (ptr) GetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetQueryObjecti64v) = (PFNGLGETQUERYOBJECTI64VPROC) ptr;
     ptr = getprocaddress ("glGetQueryObjectui64v");
-    if (ptr) GetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetQueryObjectui64v) = (PFNGLGETQUERYOBJECTUI64VPROC) ptr;
     ptr = getprocaddress ("glVertexAttribDivisor");
-    if (ptr) VertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribDivisor) = (PFNGLVERTEXATTRIBDIVISORPROC) ptr;
     ptr = getprocaddress ("glVertexAttribP1ui");
-    if (ptr) VertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribP1ui) = (PFNGLVERTEXATTRIBP1UIPROC) ptr;
     ptr = getprocaddress ("glVertexAttribP1uiv");
-    if (ptr) VertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribP1uiv) = (PFNGLVERTEXATTRIBP1UIVPROC) ptr;
     ptr = getprocaddress ("glVertexAttribP2ui");
-    if (ptr) VertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribP2ui) = (PFNGLVERTEXATTRIBP2UIPROC) ptr;
     ptr = getprocaddress ("glVertexAttribP2uiv");
-    if (ptr) VertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribP2uiv) = (PFNGLVERTEXATTRIBP2UIVPROC) ptr;
     ptr = getprocaddress ("glVertexAttribP3ui");
-    if (ptr) VertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribP3ui) = (PFNGLVERTEXATTRIBP3UIPROC) ptr;
     ptr = getprocaddress ("glVertexAttribP3uiv");
-    if (ptr) VertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribP3uiv) = (PFNGLVERTEXATTRIBP3UIVPROC) ptr;
     ptr = getprocaddress ("glVertexAttribP4ui");
-    if (ptr) VertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribP4ui) = (PFNGLVERTEXATTRIBP4UIPROC) ptr;
     ptr = getprocaddress ("glVertexAttribP4uiv");
-    if (ptr) VertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribP4uiv) = (PFNGLVERTEXATTRIBP4UIVPROC) ptr;
     ptr = getprocaddress ("glMinSampleShading");
-    if (ptr) MinSampleShading = (PFNGLMINSAMPLESHADINGPROC) ptr;
+    if (ptr) OGLP_ENTRY (MinSampleShading) = (PFNGLMINSAMPLESHADINGPROC) ptr;
     ptr = getprocaddress ("glBlendEquationi");
-    if (ptr) BlendEquationi = (PFNGLBLENDEQUATIONIPROC) ptr;
+    if (ptr) OGLP_ENTRY (BlendEquationi) = (PFNGLBLENDEQUATIONIPROC) ptr;
     ptr = getprocaddress ("glBlendEquationSeparatei");
-    if (ptr) BlendEquationSeparatei = (PFNGLBLENDEQUATIONSEPARATEIPROC) ptr;
+    if (ptr) OGLP_ENTRY (BlendEquationSeparatei) = (PFNGLBLENDEQUATIONSEPARATEIPROC) ptr;
     ptr = getprocaddress ("glBlendFunci");
-    if (ptr) BlendFunci = (PFNGLBLENDFUNCIPROC) ptr;
+    if (ptr) OGLP_ENTRY (BlendFunci) = (PFNGLBLENDFUNCIPROC) ptr;
     ptr = getprocaddress ("glBlendFuncSeparatei");
-    if (ptr) BlendFuncSeparatei = (PFNGLBLENDFUNCSEPARATEIPROC) ptr;
+    if (ptr) OGLP_ENTRY (BlendFuncSeparatei) = (PFNGLBLENDFUNCSEPARATEIPROC) ptr;
     ptr = getprocaddress ("glDrawArraysIndirect");
-    if (ptr) DrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC) ptr;
+    if (ptr) OGLP_ENTRY (DrawArraysIndirect) = (PFNGLDRAWARRAYSINDIRECTPROC) ptr;
     ptr = getprocaddress ("glDrawElementsIndirect");
-    if (ptr) DrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC) ptr;
+    if (ptr) OGLP_ENTRY (DrawElementsIndirect) = (PFNGLDRAWELEMENTSINDIRECTPROC) ptr;
     ptr = getprocaddress ("glUniform1d");
-    if (ptr) Uniform1d = (PFNGLUNIFORM1DPROC) ptr;
+    if (ptr) OGLP_ENTRY (Uniform1d) = (PFNGLUNIFORM1DPROC) ptr;
     ptr = getprocaddress ("glUniform2d");
-    if (ptr) Uniform2d = (PFNGLUNIFORM2DPROC) ptr;
+    if (ptr) OGLP_ENTRY (Uniform2d) = (PFNGLUNIFORM2DPROC) ptr;
     ptr = getprocaddress ("glUniform3d");
-    if (ptr) Uniform3d = (PFNGLUNIFORM3DPROC) ptr;
+    if (ptr) OGLP_ENTRY (Uniform3d) = (PFNGLUNIFORM3DPROC) ptr;
     ptr = getprocaddress ("glUniform4d");
-    if (ptr) Uniform4d = (PFNGLUNIFORM4DPROC) ptr;
+    if (ptr) OGLP_ENTRY (Uniform4d) = (PFNGLUNIFORM4DPROC) ptr;
     ptr = getprocaddress ("glUniform1dv");
-    if (ptr) Uniform1dv = (PFNGLUNIFORM1DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (Uniform1dv) = (PFNGLUNIFORM1DVPROC) ptr;
     ptr = getprocaddress ("glUniform2dv");
-    if (ptr) Uniform2dv = (PFNGLUNIFORM2DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (Uniform2dv) = (PFNGLUNIFORM2DVPROC) ptr;
     ptr = getprocaddress ("glUniform3dv");
-    if (ptr) Uniform3dv = (PFNGLUNIFORM3DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (Uniform3dv) = (PFNGLUNIFORM3DVPROC) ptr;
     ptr = getprocaddress ("glUniform4dv");
-    if (ptr) Uniform4dv = (PFNGLUNIFORM4DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (Uniform4dv) = (PFNGLUNIFORM4DVPROC) ptr;
     ptr = getprocaddress ("glUniformMatrix2dv");
-    if (ptr) UniformMatrix2dv = (PFNGLUNIFORMMATRIX2DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (UniformMatrix2dv) = (PFNGLUNIFORMMATRIX2DVPROC) ptr;
     ptr = getprocaddress ("glUniformMatrix3dv");
-    if (ptr) UniformMatrix3dv = (PFNGLUNIFORMMATRIX3DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (UniformMatrix3dv) = (PFNGLUNIFORMMATRIX3DVPROC) ptr;
     ptr = getprocaddress ("glUniformMatrix4dv");
-    if (ptr) UniformMatrix4dv = (PFNGLUNIFORMMATRIX4DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (UniformMatrix4dv) = (PFNGLUNIFORMMATRIX4DVPROC) ptr;
     ptr = getprocaddress ("glUniformMatrix2x3dv");
-    if (ptr) UniformMatrix2x3dv = (PFNGLUNIFORMMATRIX2X3DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (UniformMatrix2x3dv) = (PFNGLUNIFORMMATRIX2X3DVPROC) ptr;
     ptr = getprocaddress ("glUniformMatrix2x4dv");
-    if (ptr) UniformMatrix2x4dv = (PFNGLUNIFORMMATRIX2X4DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (UniformMatrix2x4dv) = (PFNGLUNIFORMMATRIX2X4DVPROC) ptr;
     ptr = getprocaddress ("glUniformMatrix3x2dv");
-    if (ptr) UniformMatrix3x2dv = (PFNGLUNIFORMMATRIX3X2DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (UniformMatrix3x2dv) = (PFNGLUNIFORMMATRIX3X2DVPROC) ptr;
     ptr = getprocaddress ("glUniformMatrix3x4dv");
-    if (ptr) UniformMatrix3x4dv = (PFNGLUNIFORMMATRIX3X4DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (UniformMatrix3x4dv) = (PFNGLUNIFORMMATRIX3X4DVPROC) ptr;
     ptr = getprocaddress ("glUniformMatrix4x2dv");
-    if (ptr) UniformMatrix4x2dv = (PFNGLUNIFORMMATRIX4X2DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (UniformMatrix4x2dv) = (PFNGLUNIFORMMATRIX4X2DVPROC) ptr;
     ptr = getprocaddress ("glUniformMatrix4x3dv");
-    if (ptr) UniformMatrix4x3dv = (PFNGLUNIFORMMATRIX4X3DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (UniformMatrix4x3dv) = (PFNGLUNIFORMMATRIX4X3DVPROC) ptr;
     ptr = getprocaddress ("glGetUniformdv");
-    if (ptr) GetUniformdv = (PFNGLGETUNIFORMDVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetUniformdv) = (PFNGLGETUNIFORMDVPROC) ptr;
     ptr = getprocaddress ("glGetSubroutineUniformLocation");
-    if (ptr) GetSubroutineUniformLocation = (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetSubroutineUniformLocation) = (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC) ptr;
     ptr = getprocaddress ("glGetSubroutineIndex");
-    if (ptr) GetSubroutineIndex = (PFNGLGETSUBROUTINEINDEXPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetSubroutineIndex) = (PFNGLGETSUBROUTINEINDEXPROC) ptr;
     ptr = getprocaddress ("glGetActiveSubroutineUniformiv");
-    if (ptr) GetActiveSubroutineUniformiv = (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetActiveSubroutineUniformiv) = (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC) ptr;
     ptr = getprocaddress ("glGetActiveSubroutineUniformName");
-    if (ptr) GetActiveSubroutineUniformName = (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetActiveSubroutineUniformName) = (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC) ptr;
     ptr = getprocaddress ("glGetActiveSubroutineName");
-    if (ptr) GetActiveSubroutineName = (PFNGLGETACTIVESUBROUTINENAMEPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetActiveSubroutineName) = (PFNGLGETACTIVESUBROUTINENAMEPROC) ptr;
     ptr = getprocaddress ("glUniformSubroutinesuiv");
-    if (ptr) UniformSubroutinesuiv = (PFNGLUNIFORMSUBROUTINESUIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (UniformSubroutinesuiv) = (PFNGLUNIFORMSUBROUTINESUIVPROC) ptr;
     ptr = getprocaddress ("glGetUniformSubroutineuiv");
-    if (ptr) GetUniformSubroutineuiv = (PFNGLGETUNIFORMSUBROUTINEUIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetUniformSubroutineuiv) = (PFNGLGETUNIFORMSUBROUTINEUIVPROC) ptr;
     ptr = getprocaddress ("glGetProgramStageiv");
-    if (ptr) GetProgramStageiv = (PFNGLGETPROGRAMSTAGEIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetProgramStageiv) = (PFNGLGETPROGRAMSTAGEIVPROC) ptr;
     ptr = getprocaddress ("glPatchParameteri");
-    if (ptr) PatchParameteri = (PFNGLPATCHPARAMETERIPROC) ptr;
+    if (ptr) OGLP_ENTRY (PatchParameteri) = (PFNGLPATCHPARAMETERIPROC) ptr;
     ptr = getprocaddress ("glPatchParameterfv");
-    if (ptr) PatchParameterfv = (PFNGLPATCHPARAMETERFVPROC) ptr;
+    if (ptr) OGLP_ENTRY (PatchParameterfv) = (PFNGLPATCHPARAMETERFVPROC) ptr;
     ptr = getprocaddress ("glBindTransformFeedback");
-    if (ptr) BindTransformFeedback = (PFNGLBINDTRANSFORMFEEDBACKPROC) ptr;
+    if (ptr) OGLP_ENTRY (BindTransformFeedback) = (PFNGLBINDTRANSFORMFEEDBACKPROC) ptr;
     ptr = getprocaddress ("glDeleteTransformFeedbacks");
-    if (ptr) DeleteTransformFeedbacks = (PFNGLDELETETRANSFORMFEEDBACKSPROC) ptr;
+    if (ptr) OGLP_ENTRY (DeleteTransformFeedbacks) = (PFNGLDELETETRANSFORMFEEDBACKSPROC) ptr;
     ptr = getprocaddress ("glGenTransformFeedbacks");
-    if (ptr) GenTransformFeedbacks = (PFNGLGENTRANSFORMFEEDBACKSPROC) ptr;
+    if (ptr) OGLP_ENTRY (GenTransformFeedbacks) = (PFNGLGENTRANSFORMFEEDBACKSPROC) ptr;
     ptr = getprocaddress ("glIsTransformFeedback");
-    if (ptr) IsTransformFeedback = (PFNGLISTRANSFORMFEEDBACKPROC) ptr;
+    if (ptr) OGLP_ENTRY (IsTransformFeedback) = (PFNGLISTRANSFORMFEEDBACKPROC) ptr;
     ptr = getprocaddress ("glPauseTransformFeedback");
-    if (ptr) PauseTransformFeedback = (PFNGLPAUSETRANSFORMFEEDBACKPROC) ptr;
+    if (ptr) OGLP_ENTRY (PauseTransformFeedback) = (PFNGLPAUSETRANSFORMFEEDBACKPROC) ptr;
     ptr = getprocaddress ("glResumeTransformFeedback");
-    if (ptr) ResumeTransformFeedback = (PFNGLRESUMETRANSFORMFEEDBACKPROC) ptr;
+    if (ptr) OGLP_ENTRY (ResumeTransformFeedback) = (PFNGLRESUMETRANSFORMFEEDBACKPROC) ptr;
     ptr = getprocaddress ("glDrawTransformFeedback");
-    if (ptr) DrawTransformFeedback = (PFNGLDRAWTRANSFORMFEEDBACKPROC) ptr;
+    if (ptr) OGLP_ENTRY (DrawTransformFeedback) = (PFNGLDRAWTRANSFORMFEEDBACKPROC) ptr;
     ptr = getprocaddress ("glDrawTransformFeedbackStream");
-    if (ptr) DrawTransformFeedbackStream = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC) ptr;
+    if (ptr) OGLP_ENTRY (DrawTransformFeedbackStream) = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC) ptr;
     ptr = getprocaddress ("glBeginQueryIndexed");
-    if (ptr) BeginQueryIndexed = (PFNGLBEGINQUERYINDEXEDPROC) ptr;
+    if (ptr) OGLP_ENTRY (BeginQueryIndexed) = (PFNGLBEGINQUERYINDEXEDPROC) ptr;
     ptr = getprocaddress ("glEndQueryIndexed");
-    if (ptr) EndQueryIndexed = (PFNGLENDQUERYINDEXEDPROC) ptr;
+    if (ptr) OGLP_ENTRY (EndQueryIndexed) = (PFNGLENDQUERYINDEXEDPROC) ptr;
     ptr = getprocaddress ("glGetQueryIndexediv");
-    if (ptr) GetQueryIndexediv = (PFNGLGETQUERYINDEXEDIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetQueryIndexediv) = (PFNGLGETQUERYINDEXEDIVPROC) ptr;
     ptr = getprocaddress ("glReleaseShaderCompiler");
-    if (ptr) ReleaseShaderCompiler = (PFNGLRELEASESHADERCOMPILERPROC) ptr;
+    if (ptr) OGLP_ENTRY (ReleaseShaderCompiler) = (PFNGLRELEASESHADERCOMPILERPROC) ptr;
     ptr = getprocaddress ("glShaderBinary");
-    if (ptr) ShaderBinary = (PFNGLSHADERBINARYPROC) ptr;
+    if (ptr) OGLP_ENTRY (ShaderBinary) = (PFNGLSHADERBINARYPROC) ptr;
     ptr = getprocaddress ("glGetShaderPrecisionFormat");
-    if (ptr) GetShaderPrecisionFormat = (PFNGLGETSHADERPRECISIONFORMATPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetShaderPrecisionFormat) = (PFNGLGETSHADERPRECISIONFORMATPROC) ptr;
     ptr = getprocaddress ("glDepthRangef");
-    if (ptr) DepthRangef = (PFNGLDEPTHRANGEFPROC) ptr;
+    if (ptr) OGLP_ENTRY (DepthRangef) = (PFNGLDEPTHRANGEFPROC) ptr;
     ptr = getprocaddress ("glClearDepthf");
-    if (ptr) ClearDepthf = (PFNGLCLEARDEPTHFPROC) ptr;
+    if (ptr) OGLP_ENTRY (ClearDepthf) = (PFNGLCLEARDEPTHFPROC) ptr;
     ptr = getprocaddress ("glGetProgramBinary");
-    if (ptr) GetProgramBinary = (PFNGLGETPROGRAMBINARYPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetProgramBinary) = (PFNGLGETPROGRAMBINARYPROC) ptr;
     ptr = getprocaddress ("glProgramBinary");
-    if (ptr) ProgramBinary = (PFNGLPROGRAMBINARYPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramBinary) = (PFNGLPROGRAMBINARYPROC) ptr;
     ptr = getprocaddress ("glProgramParameteri");
-    if (ptr) ProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramParameteri) = (PFNGLPROGRAMPARAMETERIPROC) ptr;
     ptr = getprocaddress ("glUseProgramStages");
-    if (ptr) UseProgramStages = (PFNGLUSEPROGRAMSTAGESPROC) ptr;
+    if (ptr) OGLP_ENTRY (UseProgramStages) = (PFNGLUSEPROGRAMSTAGESPROC) ptr;
     ptr = getprocaddress ("glActiveShaderProgram");
-    if (ptr) ActiveShaderProgram = (PFNGLACTIVESHADERPROGRAMPROC) ptr;
+    if (ptr) OGLP_ENTRY (ActiveShaderProgram) = (PFNGLACTIVESHADERPROGRAMPROC) ptr;
     ptr = getprocaddress ("glCreateShaderProgramv");
-    if (ptr) CreateShaderProgramv = (PFNGLCREATESHADERPROGRAMVPROC) ptr;
+    if (ptr) OGLP_ENTRY (CreateShaderProgramv) = (PFNGLCREATESHADERPROGRAMVPROC) ptr;
     ptr = getprocaddress ("glBindProgramPipeline");
-    if (ptr) BindProgramPipeline = (PFNGLBINDPROGRAMPIPELINEPROC) ptr;
+    if (ptr) OGLP_ENTRY (BindProgramPipeline) = (PFNGLBINDPROGRAMPIPELINEPROC) ptr;
     ptr = getprocaddress ("glDeleteProgramPipelines");
-    if (ptr) DeleteProgramPipelines = (PFNGLDELETEPROGRAMPIPELINESPROC) ptr;
+    if (ptr) OGLP_ENTRY (DeleteProgramPipelines) = (PFNGLDELETEPROGRAMPIPELINESPROC) ptr;
     ptr = getprocaddress ("glGenProgramPipelines");
-    if (ptr) GenProgramPipelines = (PFNGLGENPROGRAMPIPELINESPROC) ptr;
+    if (ptr) OGLP_ENTRY (GenProgramPipelines) = (PFNGLGENPROGRAMPIPELINESPROC) ptr;
     ptr = getprocaddress ("glIsProgramPipeline");
-    if (ptr) IsProgramPipeline = (PFNGLISPROGRAMPIPELINEPROC) ptr;
+    if (ptr) OGLP_ENTRY (IsProgramPipeline) = (PFNGLISPROGRAMPIPELINEPROC) ptr;
     ptr = getprocaddress ("glGetProgramPipelineiv");
-    if (ptr) GetProgramPipelineiv = (PFNGLGETPROGRAMPIPELINEIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetProgramPipelineiv) = (PFNGLGETPROGRAMPIPELINEIVPROC) ptr;
     ptr = getprocaddress ("glProgramUniform1i");
-    if (ptr) ProgramUniform1i = (PFNGLPROGRAMUNIFORM1IPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform1i) = (PFNGLPROGRAMUNIFORM1IPROC) ptr;
     ptr = getprocaddress ("glProgramUniform1iv");
-    if (ptr) ProgramUniform1iv = (PFNGLPROGRAMUNIFORM1IVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform1iv) = (PFNGLPROGRAMUNIFORM1IVPROC) ptr;
     ptr = getprocaddress ("glProgramUniform1f");
-    if (ptr) ProgramUniform1f = (PFNGLPROGRAMUNIFORM1FPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform1f) = (PFNGLPROGRAMUNIFORM1FPROC) ptr;
     ptr = getprocaddress ("glProgramUniform1fv");
-    if (ptr) ProgramUniform1fv = (PFNGLPROGRAMUNIFORM1FVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform1fv) = (PFNGLPROGRAMUNIFORM1FVPROC) ptr;
     ptr = getprocaddress ("glProgramUniform1d");
-    if (ptr) ProgramUniform1d = (PFNGLPROGRAMUNIFORM1DPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform1d) = (PFNGLPROGRAMUNIFORM1DPROC) ptr;
     ptr = getprocaddress ("glProgramUniform1dv");
-    if (ptr) ProgramUniform1dv = (PFNGLPROGRAMUNIFORM1DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform1dv) = (PFNGLPROGRAMUNIFORM1DVPROC) ptr;
     ptr = getprocaddress ("glProgramUniform1ui");
-    if (ptr) ProgramUniform1ui = (PFNGLPROGRAMUNIFORM1UIPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform1ui) = (PFNGLPROGRAMUNIFORM1UIPROC) ptr;
     ptr = getprocaddress ("glProgramUniform1uiv");
-    if (ptr) ProgramUniform1uiv = (PFNGLPROGRAMUNIFORM1UIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform1uiv) = (PFNGLPROGRAMUNIFORM1UIVPROC) ptr;
     ptr = getprocaddress ("glProgramUniform2i");
-    if (ptr) ProgramUniform2i = (PFNGLPROGRAMUNIFORM2IPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform2i) = (PFNGLPROGRAMUNIFORM2IPROC) ptr;
     ptr = getprocaddress ("glProgramUniform2iv");
-    if (ptr) ProgramUniform2iv = (PFNGLPROGRAMUNIFORM2IVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform2iv) = (PFNGLPROGRAMUNIFORM2IVPROC) ptr;
     ptr = getprocaddress ("glProgramUniform2f");
-    if (ptr) ProgramUniform2f = (PFNGLPROGRAMUNIFORM2FPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform2f) = (PFNGLPROGRAMUNIFORM2FPROC) ptr;
     ptr = getprocaddress ("glProgramUniform2fv");
-    if (ptr) ProgramUniform2fv = (PFNGLPROGRAMUNIFORM2FVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform2fv) = (PFNGLPROGRAMUNIFORM2FVPROC) ptr;
     ptr = getprocaddress ("glProgramUniform2d");
-    if (ptr) ProgramUniform2d = (PFNGLPROGRAMUNIFORM2DPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform2d) = (PFNGLPROGRAMUNIFORM2DPROC) ptr;
     ptr = getprocaddress ("glProgramUniform2dv");
-    if (ptr) ProgramUniform2dv = (PFNGLPROGRAMUNIFORM2DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform2dv) = (PFNGLPROGRAMUNIFORM2DVPROC) ptr;
     ptr = getprocaddress ("glProgramUniform2ui");
-    if (ptr) ProgramUniform2ui = (PFNGLPROGRAMUNIFORM2UIPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform2ui) = (PFNGLPROGRAMUNIFORM2UIPROC) ptr;
     ptr = getprocaddress ("glProgramUniform2uiv");
-    if (ptr) ProgramUniform2uiv = (PFNGLPROGRAMUNIFORM2UIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform2uiv) = (PFNGLPROGRAMUNIFORM2UIVPROC) ptr;
     ptr = getprocaddress ("glProgramUniform3i");
-    if (ptr) ProgramUniform3i = (PFNGLPROGRAMUNIFORM3IPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform3i) = (PFNGLPROGRAMUNIFORM3IPROC) ptr;
     ptr = getprocaddress ("glProgramUniform3iv");
-    if (ptr) ProgramUniform3iv = (PFNGLPROGRAMUNIFORM3IVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform3iv) = (PFNGLPROGRAMUNIFORM3IVPROC) ptr;
     ptr = getprocaddress ("glProgramUniform3f");
-    if (ptr) ProgramUniform3f = (PFNGLPROGRAMUNIFORM3FPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform3f) = (PFNGLPROGRAMUNIFORM3FPROC) ptr;
     ptr = getprocaddress ("glProgramUniform3fv");
-    if (ptr) ProgramUniform3fv = (PFNGLPROGRAMUNIFORM3FVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform3fv) = (PFNGLPROGRAMUNIFORM3FVPROC) ptr;
     ptr = getprocaddress ("glProgramUniform3d");
-    if (ptr) ProgramUniform3d = (PFNGLPROGRAMUNIFORM3DPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform3d) = (PFNGLPROGRAMUNIFORM3DPROC) ptr;
     ptr = getprocaddress ("glProgramUniform3dv");
-    if (ptr) ProgramUniform3dv = (PFNGLPROGRAMUNIFORM3DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform3dv) = (PFNGLPROGRAMUNIFORM3DVPROC) ptr;
     ptr = getprocaddress ("glProgramUniform3ui");
-    if (ptr) ProgramUniform3ui = (PFNGLPROGRAMUNIFORM3UIPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform3ui) = (PFNGLPROGRAMUNIFORM3UIPROC) ptr;
     ptr = getprocaddress ("glProgramUniform3uiv");
-    if (ptr) ProgramUniform3uiv = (PFNGLPROGRAMUNIFORM3UIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform3uiv) = (PFNGLPROGRAMUNIFORM3UIVPROC) ptr;
     ptr = getprocaddress ("glProgramUniform4i");
-    if (ptr) ProgramUniform4i = (PFNGLPROGRAMUNIFORM4IPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform4i) = (PFNGLPROGRAMUNIFORM4IPROC) ptr;
     ptr = getprocaddress ("glProgramUniform4iv");
-    if (ptr) ProgramUniform4iv = (PFNGLPROGRAMUNIFORM4IVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform4iv) = (PFNGLPROGRAMUNIFORM4IVPROC) ptr;
     ptr = getprocaddress ("glProgramUniform4f");
-    if (ptr) ProgramUniform4f = (PFNGLPROGRAMUNIFORM4FPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform4f) = (PFNGLPROGRAMUNIFORM4FPROC) ptr;
     ptr = getprocaddress ("glProgramUniform4fv");
-    if (ptr) ProgramUniform4fv = (PFNGLPROGRAMUNIFORM4FVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform4fv) = (PFNGLPROGRAMUNIFORM4FVPROC) ptr;
     ptr = getprocaddress ("glProgramUniform4d");
-    if (ptr) ProgramUniform4d = (PFNGLPROGRAMUNIFORM4DPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform4d) = (PFNGLPROGRAMUNIFORM4DPROC) ptr;
     ptr = getprocaddress ("glProgramUniform4dv");
-    if (ptr) ProgramUniform4dv = (PFNGLPROGRAMUNIFORM4DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform4dv) = (PFNGLPROGRAMUNIFORM4DVPROC) ptr;
     ptr = getprocaddress ("glProgramUniform4ui");
-    if (ptr) ProgramUniform4ui = (PFNGLPROGRAMUNIFORM4UIPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform4ui) = (PFNGLPROGRAMUNIFORM4UIPROC) ptr;
     ptr = getprocaddress ("glProgramUniform4uiv");
-    if (ptr) ProgramUniform4uiv = (PFNGLPROGRAMUNIFORM4UIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniform4uiv) = (PFNGLPROGRAMUNIFORM4UIVPROC) ptr;
     ptr = getprocaddress ("glProgramUniformMatrix2fv");
-    if (ptr) ProgramUniformMatrix2fv = (PFNGLPROGRAMUNIFORMMATRIX2FVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniformMatrix2fv) = (PFNGLPROGRAMUNIFORMMATRIX2FVPROC) ptr;
     ptr = getprocaddress ("glProgramUniformMatrix3fv");
-    if (ptr) ProgramUniformMatrix3fv = (PFNGLPROGRAMUNIFORMMATRIX3FVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniformMatrix3fv) = (PFNGLPROGRAMUNIFORMMATRIX3FVPROC) ptr;
     ptr = getprocaddress ("glProgramUniformMatrix4fv");
-    if (ptr) ProgramUniformMatrix4fv = (PFNGLPROGRAMUNIFORMMATRIX4FVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniformMatrix4fv) = (PFNGLPROGRAMUNIFORMMATRIX4FVPROC) ptr;
     ptr = getprocaddress ("glProgramUniformMatrix2dv");
-    if (ptr) ProgramUniformMatrix2dv = (PFNGLPROGRAMUNIFORMMATRIX2DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniformMatrix2dv) = (PFNGLPROGRAMUNIFORMMATRIX2DVPROC) ptr;
     ptr = getprocaddress ("glProgramUniformMatrix3dv");
-    if (ptr) ProgramUniformMatrix3dv = (PFNGLPROGRAMUNIFORMMATRIX3DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniformMatrix3dv) = (PFNGLPROGRAMUNIFORMMATRIX3DVPROC) ptr;
     ptr = getprocaddress ("glProgramUniformMatrix4dv");
-    if (ptr) ProgramUniformMatrix4dv = (PFNGLPROGRAMUNIFORMMATRIX4DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniformMatrix4dv) = (PFNGLPROGRAMUNIFORMMATRIX4DVPROC) ptr;
     ptr = getprocaddress ("glProgramUniformMatrix2x3fv");
-    if (ptr) ProgramUniformMatrix2x3fv = (PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniformMatrix2x3fv) = (PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC) ptr;
     ptr = getprocaddress ("glProgramUniformMatrix3x2fv");
-    if (ptr) ProgramUniformMatrix3x2fv = (PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniformMatrix3x2fv) = (PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC) ptr;
     ptr = getprocaddress ("glProgramUniformMatrix2x4fv");
-    if (ptr) ProgramUniformMatrix2x4fv = (PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniformMatrix2x4fv) = (PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC) ptr;
     ptr = getprocaddress ("glProgramUniformMatrix4x2fv");
-    if (ptr) ProgramUniformMatrix4x2fv = (PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniformMatrix4x2fv) = (PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC) ptr;
     ptr = getprocaddress ("glProgramUniformMatrix3x4fv");
-    if (ptr) ProgramUniformMatrix3x4fv = (PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniformMatrix3x4fv) = (PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC) ptr;
     ptr = getprocaddress ("glProgramUniformMatrix4x3fv");
-    if (ptr) ProgramUniformMatrix4x3fv = (PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniformMatrix4x3fv) = (PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC) ptr;
     ptr = getprocaddress ("glProgramUniformMatrix2x3dv");
-    if (ptr) ProgramUniformMatrix2x3dv = (PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniformMatrix2x3dv) = (PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC) ptr;
     ptr = getprocaddress ("glProgramUniformMatrix3x2dv");
-    if (ptr) ProgramUniformMatrix3x2dv = (PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniformMatrix3x2dv) = (PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC) ptr;
     ptr = getprocaddress ("glProgramUniformMatrix2x4dv");
-    if (ptr) ProgramUniformMatrix2x4dv = (PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniformMatrix2x4dv) = (PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC) ptr;
     ptr = getprocaddress ("glProgramUniformMatrix4x2dv");
-    if (ptr) ProgramUniformMatrix4x2dv = (PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniformMatrix4x2dv) = (PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC) ptr;
     ptr = getprocaddress ("glProgramUniformMatrix3x4dv");
-    if (ptr) ProgramUniformMatrix3x4dv = (PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniformMatrix3x4dv) = (PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC) ptr;
     ptr = getprocaddress ("glProgramUniformMatrix4x3dv");
-    if (ptr) ProgramUniformMatrix4x3dv = (PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniformMatrix4x3dv) = (PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC) ptr;
     ptr = getprocaddress ("glValidateProgramPipeline");
-    if (ptr) ValidateProgramPipeline = (PFNGLVALIDATEPROGRAMPIPELINEPROC) ptr;
+    if (ptr) OGLP_ENTRY (ValidateProgramPipeline) = (PFNGLVALIDATEPROGRAMPIPELINEPROC) ptr;
     ptr = getprocaddress ("glGetProgramPipelineInfoLog");
-    if (ptr) GetProgramPipelineInfoLog = (PFNGLGETPROGRAMPIPELINEINFOLOGPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetProgramPipelineInfoLog) = (PFNGLGETPROGRAMPIPELINEINFOLOGPROC) ptr;
     ptr = getprocaddress ("glVertexAttribL1d");
-    if (ptr) VertexAttribL1d = (PFNGLVERTEXATTRIBL1DPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribL1d) = (PFNGLVERTEXATTRIBL1DPROC) ptr;
     ptr = getprocaddress ("glVertexAttribL2d");
-    if (ptr) VertexAttribL2d = (PFNGLVERTEXATTRIBL2DPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribL2d) = (PFNGLVERTEXATTRIBL2DPROC) ptr;
     ptr = getprocaddress ("glVertexAttribL3d");
-    if (ptr) VertexAttribL3d = (PFNGLVERTEXATTRIBL3DPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribL3d) = (PFNGLVERTEXATTRIBL3DPROC) ptr;
     ptr = getprocaddress ("glVertexAttribL4d");
-    if (ptr) VertexAttribL4d = (PFNGLVERTEXATTRIBL4DPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribL4d) = (PFNGLVERTEXATTRIBL4DPROC) ptr;
     ptr = getprocaddress ("glVertexAttribL1dv");
-    if (ptr) VertexAttribL1dv = (PFNGLVERTEXATTRIBL1DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribL1dv) = (PFNGLVERTEXATTRIBL1DVPROC) ptr;
     ptr = getprocaddress ("glVertexAttribL2dv");
-    if (ptr) VertexAttribL2dv = (PFNGLVERTEXATTRIBL2DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribL2dv) = (PFNGLVERTEXATTRIBL2DVPROC) ptr;
     ptr = getprocaddress ("glVertexAttribL3dv");
-    if (ptr) VertexAttribL3dv = (PFNGLVERTEXATTRIBL3DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribL3dv) = (PFNGLVERTEXATTRIBL3DVPROC) ptr;
     ptr = getprocaddress ("glVertexAttribL4dv");
-    if (ptr) VertexAttribL4dv = (PFNGLVERTEXATTRIBL4DVPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribL4dv) = (PFNGLVERTEXATTRIBL4DVPROC) ptr;
     ptr = getprocaddress ("glVertexAttribLPointer");
-    if (ptr) VertexAttribLPointer = (PFNGLVERTEXATTRIBLPOINTERPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribLPointer) = (PFNGLVERTEXATTRIBLPOINTERPROC) ptr;
     ptr = getprocaddress ("glGetVertexAttribLdv");
-    if (ptr) GetVertexAttribLdv = (PFNGLGETVERTEXATTRIBLDVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetVertexAttribLdv) = (PFNGLGETVERTEXATTRIBLDVPROC) ptr;
     ptr = getprocaddress ("glViewportArrayv");
-    if (ptr) ViewportArrayv = (PFNGLVIEWPORTARRAYVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ViewportArrayv) = (PFNGLVIEWPORTARRAYVPROC) ptr;
     ptr = getprocaddress ("glViewportIndexedf");
-    if (ptr) ViewportIndexedf = (PFNGLVIEWPORTINDEXEDFPROC) ptr;
+    if (ptr) OGLP_ENTRY (ViewportIndexedf) = (PFNGLVIEWPORTINDEXEDFPROC) ptr;
     ptr = getprocaddress ("glViewportIndexedfv");
-    if (ptr) ViewportIndexedfv = (PFNGLVIEWPORTINDEXEDFVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ViewportIndexedfv) = (PFNGLVIEWPORTINDEXEDFVPROC) ptr;
     ptr = getprocaddress ("glScissorArrayv");
-    if (ptr) ScissorArrayv = (PFNGLSCISSORARRAYVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ScissorArrayv) = (PFNGLSCISSORARRAYVPROC) ptr;
     ptr = getprocaddress ("glScissorIndexed");
-    if (ptr) ScissorIndexed = (PFNGLSCISSORINDEXEDPROC) ptr;
+    if (ptr) OGLP_ENTRY (ScissorIndexed) = (PFNGLSCISSORINDEXEDPROC) ptr;
     ptr = getprocaddress ("glScissorIndexedv");
-    if (ptr) ScissorIndexedv = (PFNGLSCISSORINDEXEDVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ScissorIndexedv) = (PFNGLSCISSORINDEXEDVPROC) ptr;
     ptr = getprocaddress ("glDepthRangeArrayv");
-    if (ptr) DepthRangeArrayv = (PFNGLDEPTHRANGEARRAYVPROC) ptr;
+    if (ptr) OGLP_ENTRY (DepthRangeArrayv) = (PFNGLDEPTHRANGEARRAYVPROC) ptr;
     ptr = getprocaddress ("glDepthRangeIndexed");
-    if (ptr) DepthRangeIndexed = (PFNGLDEPTHRANGEINDEXEDPROC) ptr;
+    if (ptr) OGLP_ENTRY (DepthRangeIndexed) = (PFNGLDEPTHRANGEINDEXEDPROC) ptr;
     ptr = getprocaddress ("glGetFloati_v");
-    if (ptr) GetFloati_v = (PFNGLGETFLOATI_VPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetFloati_v) = (PFNGLGETFLOATI_VPROC) ptr;
     ptr = getprocaddress ("glGetDoublei_v");
-    if (ptr) GetDoublei_v = (PFNGLGETDOUBLEI_VPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetDoublei_v) = (PFNGLGETDOUBLEI_VPROC) ptr;
     ptr = getprocaddress ("glDrawArraysInstancedBaseInstance");
-    if (ptr) DrawArraysInstancedBaseInstance = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC) ptr;
+    if (ptr) OGLP_ENTRY (DrawArraysInstancedBaseInstance) = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC) ptr;
     ptr = getprocaddress ("glDrawElementsInstancedBaseInstance");
-    if (ptr) DrawElementsInstancedBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC) ptr;
+    if (ptr) OGLP_ENTRY (DrawElementsInstancedBaseInstance) = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC) ptr;
     ptr = getprocaddress ("glDrawElementsInstancedBaseVertexBaseInstance");
-    if (ptr) DrawElementsInstancedBaseVertexBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC) ptr;
+    if (ptr) OGLP_ENTRY (DrawElementsInstancedBaseVertexBaseInstance) = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC) ptr;
     ptr = getprocaddress ("glGetInternalformativ");
-    if (ptr) GetInternalformativ = (PFNGLGETINTERNALFORMATIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetInternalformativ) = (PFNGLGETINTERNALFORMATIVPROC) ptr;
     ptr = getprocaddress ("glGetActiveAtomicCounterBufferiv");
-    if (ptr) GetActiveAtomicCounterBufferiv = (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetActiveAtomicCounterBufferiv) = (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC) ptr;
     ptr = getprocaddress ("glBindImageTexture");
-    if (ptr) BindImageTexture = (PFNGLBINDIMAGETEXTUREPROC) ptr;
+    if (ptr) OGLP_ENTRY (BindImageTexture) = (PFNGLBINDIMAGETEXTUREPROC) ptr;
     ptr = getprocaddress ("glMemoryBarrier");
-    if (ptr) MemoryBarrier = (PFNGLMEMORYBARRIERPROC) ptr;
+    if (ptr) OGLP_ENTRY (MemoryBarrier) = (PFNGLMEMORYBARRIERPROC) ptr;
     ptr = getprocaddress ("glTexStorage1D");
-    if (ptr) TexStorage1D = (PFNGLTEXSTORAGE1DPROC) ptr;
+    if (ptr) OGLP_ENTRY (TexStorage1D) = (PFNGLTEXSTORAGE1DPROC) ptr;
     ptr = getprocaddress ("glTexStorage2D");
-    if (ptr) TexStorage2D = (PFNGLTEXSTORAGE2DPROC) ptr;
+    if (ptr) OGLP_ENTRY (TexStorage2D) = (PFNGLTEXSTORAGE2DPROC) ptr;
     ptr = getprocaddress ("glTexStorage3D");
-    if (ptr) TexStorage3D = (PFNGLTEXSTORAGE3DPROC) ptr;
+    if (ptr) OGLP_ENTRY (TexStorage3D) = (PFNGLTEXSTORAGE3DPROC) ptr;
     ptr = getprocaddress ("glDrawTransformFeedbackInstanced");
-    if (ptr) DrawTransformFeedbackInstanced = (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC) ptr;
+    if (ptr) OGLP_ENTRY (DrawTransformFeedbackInstanced) = (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC) ptr;
     ptr = getprocaddress ("glDrawTransformFeedbackStreamInstanced");
-    if (ptr) DrawTransformFeedbackStreamInstanced = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC) ptr;
+    if (ptr) OGLP_ENTRY (DrawTransformFeedbackStreamInstanced) = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC) ptr;
     ptr = getprocaddress ("glClearBufferData");
-    if (ptr) ClearBufferData = (PFNGLCLEARBUFFERDATAPROC) ptr;
+    if (ptr) OGLP_ENTRY (ClearBufferData) = (PFNGLCLEARBUFFERDATAPROC) ptr;
     ptr = getprocaddress ("glClearBufferSubData");
-    if (ptr) ClearBufferSubData = (PFNGLCLEARBUFFERSUBDATAPROC) ptr;
+    if (ptr) OGLP_ENTRY (ClearBufferSubData) = (PFNGLCLEARBUFFERSUBDATAPROC) ptr;
     ptr = getprocaddress ("glDispatchCompute");
-    if (ptr) DispatchCompute = (PFNGLDISPATCHCOMPUTEPROC) ptr;
+    if (ptr) OGLP_ENTRY (DispatchCompute) = (PFNGLDISPATCHCOMPUTEPROC) ptr;
     ptr = getprocaddress ("glDispatchComputeIndirect");
-    if (ptr) DispatchComputeIndirect = (PFNGLDISPATCHCOMPUTEINDIRECTPROC) ptr;
+    if (ptr) OGLP_ENTRY (DispatchComputeIndirect) = (PFNGLDISPATCHCOMPUTEINDIRECTPROC) ptr;
     ptr = getprocaddress ("glCopyImageSubData");
-    if (ptr) CopyImageSubData = (PFNGLCOPYIMAGESUBDATAPROC) ptr;
+    if (ptr) OGLP_ENTRY (CopyImageSubData) = (PFNGLCOPYIMAGESUBDATAPROC) ptr;
     ptr = getprocaddress ("glFramebufferParameteri");
-    if (ptr) FramebufferParameteri = (PFNGLFRAMEBUFFERPARAMETERIPROC) ptr;
+    if (ptr) OGLP_ENTRY (FramebufferParameteri) = (PFNGLFRAMEBUFFERPARAMETERIPROC) ptr;
     ptr = getprocaddress ("glGetFramebufferParameteriv");
-    if (ptr) GetFramebufferParameteriv = (PFNGLGETFRAMEBUFFERPARAMETERIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetFramebufferParameteriv) = (PFNGLGETFRAMEBUFFERPARAMETERIVPROC) ptr;
     ptr = getprocaddress ("glGetInternalformati64v");
-    if (ptr) GetInternalformati64v = (PFNGLGETINTERNALFORMATI64VPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetInternalformati64v) = (PFNGLGETINTERNALFORMATI64VPROC) ptr;
     ptr = getprocaddress ("glInvalidateTexSubImage");
-    if (ptr) InvalidateTexSubImage = (PFNGLINVALIDATETEXSUBIMAGEPROC) ptr;
+    if (ptr) OGLP_ENTRY (InvalidateTexSubImage) = (PFNGLINVALIDATETEXSUBIMAGEPROC) ptr;
     ptr = getprocaddress ("glInvalidateTexImage");
-    if (ptr) InvalidateTexImage = (PFNGLINVALIDATETEXIMAGEPROC) ptr;
+    if (ptr) OGLP_ENTRY (InvalidateTexImage) = (PFNGLINVALIDATETEXIMAGEPROC) ptr;
     ptr = getprocaddress ("glInvalidateBufferSubData");
-    if (ptr) InvalidateBufferSubData = (PFNGLINVALIDATEBUFFERSUBDATAPROC) ptr;
+    if (ptr) OGLP_ENTRY (InvalidateBufferSubData) = (PFNGLINVALIDATEBUFFERSUBDATAPROC) ptr;
     ptr = getprocaddress ("glInvalidateBufferData");
-    if (ptr) InvalidateBufferData = (PFNGLINVALIDATEBUFFERDATAPROC) ptr;
+    if (ptr) OGLP_ENTRY (InvalidateBufferData) = (PFNGLINVALIDATEBUFFERDATAPROC) ptr;
     ptr = getprocaddress ("glInvalidateFramebuffer");
-    if (ptr) InvalidateFramebuffer = (PFNGLINVALIDATEFRAMEBUFFERPROC) ptr;
+    if (ptr) OGLP_ENTRY (InvalidateFramebuffer) = (PFNGLINVALIDATEFRAMEBUFFERPROC) ptr;
     ptr = getprocaddress ("glInvalidateSubFramebuffer");
-    if (ptr) InvalidateSubFramebuffer = (PFNGLINVALIDATESUBFRAMEBUFFERPROC) ptr;
+    if (ptr) OGLP_ENTRY (InvalidateSubFramebuffer) = (PFNGLINVALIDATESUBFRAMEBUFFERPROC) ptr;
     ptr = getprocaddress ("glMultiDrawArraysIndirect");
-    if (ptr) MultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC) ptr;
+    if (ptr) OGLP_ENTRY (MultiDrawArraysIndirect) = (PFNGLMULTIDRAWARRAYSINDIRECTPROC) ptr;
     ptr = getprocaddress ("glMultiDrawElementsIndirect");
-    if (ptr) MultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC) ptr;
+    if (ptr) OGLP_ENTRY (MultiDrawElementsIndirect) = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC) ptr;
     ptr = getprocaddress ("glGetProgramInterfaceiv");
-    if (ptr) GetProgramInterfaceiv = (PFNGLGETPROGRAMINTERFACEIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetProgramInterfaceiv) = (PFNGLGETPROGRAMINTERFACEIVPROC) ptr;
     ptr = getprocaddress ("glGetProgramResourceIndex");
-    if (ptr) GetProgramResourceIndex = (PFNGLGETPROGRAMRESOURCEINDEXPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetProgramResourceIndex) = (PFNGLGETPROGRAMRESOURCEINDEXPROC) ptr;
     ptr = getprocaddress ("glGetProgramResourceName");
-    if (ptr) GetProgramResourceName = (PFNGLGETPROGRAMRESOURCENAMEPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetProgramResourceName) = (PFNGLGETPROGRAMRESOURCENAMEPROC) ptr;
     ptr = getprocaddress ("glGetProgramResourceiv");
-    if (ptr) GetProgramResourceiv = (PFNGLGETPROGRAMRESOURCEIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetProgramResourceiv) = (PFNGLGETPROGRAMRESOURCEIVPROC) ptr;
     ptr = getprocaddress ("glGetProgramResourceLocation");
-    if (ptr) GetProgramResourceLocation = (PFNGLGETPROGRAMRESOURCELOCATIONPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetProgramResourceLocation) = (PFNGLGETPROGRAMRESOURCELOCATIONPROC) ptr;
     ptr = getprocaddress ("glGetProgramResourceLocationIndex");
-    if (ptr) GetProgramResourceLocationIndex = (PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetProgramResourceLocationIndex) = (PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC) ptr;
     ptr = getprocaddress ("glShaderStorageBlockBinding");
-    if (ptr) ShaderStorageBlockBinding = (PFNGLSHADERSTORAGEBLOCKBINDINGPROC) ptr;
+    if (ptr) OGLP_ENTRY (ShaderStorageBlockBinding) = (PFNGLSHADERSTORAGEBLOCKBINDINGPROC) ptr;
     ptr = getprocaddress ("glTexBufferRange");
-    if (ptr) TexBufferRange = (PFNGLTEXBUFFERRANGEPROC) ptr;
+    if (ptr) OGLP_ENTRY (TexBufferRange) = (PFNGLTEXBUFFERRANGEPROC) ptr;
     ptr = getprocaddress ("glTexStorage2DMultisample");
-    if (ptr) TexStorage2DMultisample = (PFNGLTEXSTORAGE2DMULTISAMPLEPROC) ptr;
+    if (ptr) OGLP_ENTRY (TexStorage2DMultisample) = (PFNGLTEXSTORAGE2DMULTISAMPLEPROC) ptr;
     ptr = getprocaddress ("glTexStorage3DMultisample");
-    if (ptr) TexStorage3DMultisample = (PFNGLTEXSTORAGE3DMULTISAMPLEPROC) ptr;
+    if (ptr) OGLP_ENTRY (TexStorage3DMultisample) = (PFNGLTEXSTORAGE3DMULTISAMPLEPROC) ptr;
     ptr = getprocaddress ("glTextureView");
-    if (ptr) TextureView = (PFNGLTEXTUREVIEWPROC) ptr;
+    if (ptr) OGLP_ENTRY (TextureView) = (PFNGLTEXTUREVIEWPROC) ptr;
     ptr = getprocaddress ("glBindVertexBuffer");
-    if (ptr) BindVertexBuffer = (PFNGLBINDVERTEXBUFFERPROC) ptr;
+    if (ptr) OGLP_ENTRY (BindVertexBuffer) = (PFNGLBINDVERTEXBUFFERPROC) ptr;
     ptr = getprocaddress ("glVertexAttribFormat");
-    if (ptr) VertexAttribFormat = (PFNGLVERTEXATTRIBFORMATPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribFormat) = (PFNGLVERTEXATTRIBFORMATPROC) ptr;
     ptr = getprocaddress ("glVertexAttribIFormat");
-    if (ptr) VertexAttribIFormat = (PFNGLVERTEXATTRIBIFORMATPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribIFormat) = (PFNGLVERTEXATTRIBIFORMATPROC) ptr;
     ptr = getprocaddress ("glVertexAttribLFormat");
-    if (ptr) VertexAttribLFormat = (PFNGLVERTEXATTRIBLFORMATPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribLFormat) = (PFNGLVERTEXATTRIBLFORMATPROC) ptr;
     ptr = getprocaddress ("glVertexAttribBinding");
-    if (ptr) VertexAttribBinding = (PFNGLVERTEXATTRIBBINDINGPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribBinding) = (PFNGLVERTEXATTRIBBINDINGPROC) ptr;
     ptr = getprocaddress ("glVertexBindingDivisor");
-    if (ptr) VertexBindingDivisor = (PFNGLVERTEXBINDINGDIVISORPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexBindingDivisor) = (PFNGLVERTEXBINDINGDIVISORPROC) ptr;
     ptr = getprocaddress ("glDebugMessageControl");
-    if (ptr) DebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC) ptr;
+    if (ptr) OGLP_ENTRY (DebugMessageControl) = (PFNGLDEBUGMESSAGECONTROLPROC) ptr;
     ptr = getprocaddress ("glDebugMessageInsert");
-    if (ptr) DebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC) ptr;
+    if (ptr) OGLP_ENTRY (DebugMessageInsert) = (PFNGLDEBUGMESSAGEINSERTPROC) ptr;
     ptr = getprocaddress ("glDebugMessageCallback");
-    if (ptr) DebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC) ptr;
+    if (ptr) OGLP_ENTRY (DebugMessageCallback) = (PFNGLDEBUGMESSAGECALLBACKPROC) ptr;
     ptr = getprocaddress ("glGetDebugMessageLog");
-    if (ptr) GetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetDebugMessageLog) = (PFNGLGETDEBUGMESSAGELOGPROC) ptr;
     ptr = getprocaddress ("glPushDebugGroup");
-    if (ptr) PushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC) ptr;
+    if (ptr) OGLP_ENTRY (PushDebugGroup) = (PFNGLPUSHDEBUGGROUPPROC) ptr;
     ptr = getprocaddress ("glPopDebugGroup");
-    if (ptr) PopDebugGroup = (PFNGLPOPDEBUGGROUPPROC) ptr;
+    if (ptr) OGLP_ENTRY (PopDebugGroup) = (PFNGLPOPDEBUGGROUPPROC) ptr;
     ptr = getprocaddress ("glObjectLabel");
-    if (ptr) ObjectLabel = (PFNGLOBJECTLABELPROC) ptr;
+    if (ptr) OGLP_ENTRY (ObjectLabel) = (PFNGLOBJECTLABELPROC) ptr;
     ptr = getprocaddress ("glGetObjectLabel");
-    if (ptr) GetObjectLabel = (PFNGLGETOBJECTLABELPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetObjectLabel) = (PFNGLGETOBJECTLABELPROC) ptr;
     ptr = getprocaddress ("glObjectPtrLabel");
-    if (ptr) ObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC) ptr;
+    if (ptr) OGLP_ENTRY (ObjectPtrLabel) = (PFNGLOBJECTPTRLABELPROC) ptr;
     ptr = getprocaddress ("glGetObjectPtrLabel");
-    if (ptr) GetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetObjectPtrLabel) = (PFNGLGETOBJECTPTRLABELPROC) ptr;
     ptr = getprocaddress ("glBufferStorage");
-    if (ptr) BufferStorage = (PFNGLBUFFERSTORAGEPROC) ptr;
+    if (ptr) OGLP_ENTRY (BufferStorage) = (PFNGLBUFFERSTORAGEPROC) ptr;
     ptr = getprocaddress ("glClearTexImage");
-    if (ptr) ClearTexImage = (PFNGLCLEARTEXIMAGEPROC) ptr;
+    if (ptr) OGLP_ENTRY (ClearTexImage) = (PFNGLCLEARTEXIMAGEPROC) ptr;
     ptr = getprocaddress ("glClearTexSubImage");
-    if (ptr) ClearTexSubImage = (PFNGLCLEARTEXSUBIMAGEPROC) ptr;
+    if (ptr) OGLP_ENTRY (ClearTexSubImage) = (PFNGLCLEARTEXSUBIMAGEPROC) ptr;
     ptr = getprocaddress ("glBindBuffersBase");
-    if (ptr) BindBuffersBase = (PFNGLBINDBUFFERSBASEPROC) ptr;
+    if (ptr) OGLP_ENTRY (BindBuffersBase) = (PFNGLBINDBUFFERSBASEPROC) ptr;
     ptr = getprocaddress ("glBindBuffersRange");
-    if (ptr) BindBuffersRange = (PFNGLBINDBUFFERSRANGEPROC) ptr;
+    if (ptr) OGLP_ENTRY (BindBuffersRange) = (PFNGLBINDBUFFERSRANGEPROC) ptr;
     ptr = getprocaddress ("glBindTextures");
-    if (ptr) BindTextures = (PFNGLBINDTEXTURESPROC) ptr;
+    if (ptr) OGLP_ENTRY (BindTextures) = (PFNGLBINDTEXTURESPROC) ptr;
     ptr = getprocaddress ("glBindSamplers");
-    if (ptr) BindSamplers = (PFNGLBINDSAMPLERSPROC) ptr;
+    if (ptr) OGLP_ENTRY (BindSamplers) = (PFNGLBINDSAMPLERSPROC) ptr;
     ptr = getprocaddress ("glBindImageTextures");
-    if (ptr) BindImageTextures = (PFNGLBINDIMAGETEXTURESPROC) ptr;
+    if (ptr) OGLP_ENTRY (BindImageTextures) = (PFNGLBINDIMAGETEXTURESPROC) ptr;
     ptr = getprocaddress ("glBindVertexBuffers");
-    if (ptr) BindVertexBuffers = (PFNGLBINDVERTEXBUFFERSPROC) ptr;
+    if (ptr) OGLP_ENTRY (BindVertexBuffers) = (PFNGLBINDVERTEXBUFFERSPROC) ptr;
     ptr = getprocaddress ("glClipControl");
-    if (ptr) ClipControl = (PFNGLCLIPCONTROLPROC) ptr;
+    if (ptr) OGLP_ENTRY (ClipControl) = (PFNGLCLIPCONTROLPROC) ptr;
     ptr = getprocaddress ("glCreateTransformFeedbacks");
-    if (ptr) CreateTransformFeedbacks = (PFNGLCREATETRANSFORMFEEDBACKSPROC) ptr;
+    if (ptr) OGLP_ENTRY (CreateTransformFeedbacks) = (PFNGLCREATETRANSFORMFEEDBACKSPROC) ptr;
     ptr = getprocaddress ("glTransformFeedbackBufferBase");
-    if (ptr) TransformFeedbackBufferBase = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC) ptr;
+    if (ptr) OGLP_ENTRY (TransformFeedbackBufferBase) = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC) ptr;
     ptr = getprocaddress ("glTransformFeedbackBufferRange");
-    if (ptr) TransformFeedbackBufferRange = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC) ptr;
+    if (ptr) OGLP_ENTRY (TransformFeedbackBufferRange) = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC) ptr;
     ptr = getprocaddress ("glGetTransformFeedbackiv");
-    if (ptr) GetTransformFeedbackiv = (PFNGLGETTRANSFORMFEEDBACKIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetTransformFeedbackiv) = (PFNGLGETTRANSFORMFEEDBACKIVPROC) ptr;
     ptr = getprocaddress ("glGetTransformFeedbacki_v");
-    if (ptr) GetTransformFeedbacki_v = (PFNGLGETTRANSFORMFEEDBACKI_VPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetTransformFeedbacki_v) = (PFNGLGETTRANSFORMFEEDBACKI_VPROC) ptr;
     ptr = getprocaddress ("glGetTransformFeedbacki64_v");
-    if (ptr) GetTransformFeedbacki64_v = (PFNGLGETTRANSFORMFEEDBACKI64_VPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetTransformFeedbacki64_v) = (PFNGLGETTRANSFORMFEEDBACKI64_VPROC) ptr;
     ptr = getprocaddress ("glCreateBuffers");
-    if (ptr) CreateBuffers = (PFNGLCREATEBUFFERSPROC) ptr;
+    if (ptr) OGLP_ENTRY (CreateBuffers) = (PFNGLCREATEBUFFERSPROC) ptr;
     ptr = getprocaddress ("glNamedBufferStorage");
-    if (ptr) NamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC) ptr;
+    if (ptr) OGLP_ENTRY (NamedBufferStorage) = (PFNGLNAMEDBUFFERSTORAGEPROC) ptr;
     ptr = getprocaddress ("glNamedBufferData");
-    if (ptr) NamedBufferData = (PFNGLNAMEDBUFFERDATAPROC) ptr;
+    if (ptr) OGLP_ENTRY (NamedBufferData) = (PFNGLNAMEDBUFFERDATAPROC) ptr;
     ptr = getprocaddress ("glNamedBufferSubData");
-    if (ptr) NamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC) ptr;
+    if (ptr) OGLP_ENTRY (NamedBufferSubData) = (PFNGLNAMEDBUFFERSUBDATAPROC) ptr;
     ptr = getprocaddress ("glCopyNamedBufferSubData");
-    if (ptr) CopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC) ptr;
+    if (ptr) OGLP_ENTRY (CopyNamedBufferSubData) = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC) ptr;
     ptr = getprocaddress ("glClearNamedBufferData");
-    if (ptr) ClearNamedBufferData = (PFNGLCLEARNAMEDBUFFERDATAPROC) ptr;
+    if (ptr) OGLP_ENTRY (ClearNamedBufferData) = (PFNGLCLEARNAMEDBUFFERDATAPROC) ptr;
     ptr = getprocaddress ("glClearNamedBufferSubData");
-    if (ptr) ClearNamedBufferSubData = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC) ptr;
+    if (ptr) OGLP_ENTRY (ClearNamedBufferSubData) = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC) ptr;
     ptr = getprocaddress ("glMapNamedBuffer");
-    if (ptr) MapNamedBuffer = (PFNGLMAPNAMEDBUFFERPROC) ptr;
+    if (ptr) OGLP_ENTRY (MapNamedBuffer) = (PFNGLMAPNAMEDBUFFERPROC) ptr;
     ptr = getprocaddress ("glMapNamedBufferRange");
-    if (ptr) MapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC) ptr;
+    if (ptr) OGLP_ENTRY (MapNamedBufferRange) = (PFNGLMAPNAMEDBUFFERRANGEPROC) ptr;
     ptr = getprocaddress ("glUnmapNamedBuffer");
-    if (ptr) UnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC) ptr;
+    if (ptr) OGLP_ENTRY (UnmapNamedBuffer) = (PFNGLUNMAPNAMEDBUFFERPROC) ptr;
     ptr = getprocaddress ("glFlushMappedNamedBufferRange");
-    if (ptr) FlushMappedNamedBufferRange = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC) ptr;
+    if (ptr) OGLP_ENTRY (FlushMappedNamedBufferRange) = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC) ptr;
     ptr = getprocaddress ("glGetNamedBufferParameteriv");
-    if (ptr) GetNamedBufferParameteriv = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetNamedBufferParameteriv) = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC) ptr;
     ptr = getprocaddress ("glGetNamedBufferParameteri64v");
-    if (ptr) GetNamedBufferParameteri64v = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetNamedBufferParameteri64v) = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC) ptr;
     ptr = getprocaddress ("glGetNamedBufferPointerv");
-    if (ptr) GetNamedBufferPointerv = (PFNGLGETNAMEDBUFFERPOINTERVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetNamedBufferPointerv) = (PFNGLGETNAMEDBUFFERPOINTERVPROC) ptr;
     ptr = getprocaddress ("glGetNamedBufferSubData");
-    if (ptr) GetNamedBufferSubData = (PFNGLGETNAMEDBUFFERSUBDATAPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetNamedBufferSubData) = (PFNGLGETNAMEDBUFFERSUBDATAPROC) ptr;
     ptr = getprocaddress ("glCreateFramebuffers");
-    if (ptr) CreateFramebuffers = (PFNGLCREATEFRAMEBUFFERSPROC) ptr;
+    if (ptr) OGLP_ENTRY (CreateFramebuffers) = (PFNGLCREATEFRAMEBUFFERSPROC) ptr;
     ptr = getprocaddress ("glNamedFramebufferRenderbuffer");
-    if (ptr) NamedFramebufferRenderbuffer = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC) ptr;
+    if (ptr) OGLP_ENTRY (NamedFramebufferRenderbuffer) = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC) ptr;
     ptr = getprocaddress ("glNamedFramebufferParameteri");
-    if (ptr) NamedFramebufferParameteri = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC) ptr;
+    if (ptr) OGLP_ENTRY (NamedFramebufferParameteri) = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC) ptr;
     ptr = getprocaddress ("glNamedFramebufferTexture");
-    if (ptr) NamedFramebufferTexture = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC) ptr;
+    if (ptr) OGLP_ENTRY (NamedFramebufferTexture) = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC) ptr;
     ptr = getprocaddress ("glNamedFramebufferTextureLayer");
-    if (ptr) NamedFramebufferTextureLayer = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC) ptr;
+    if (ptr) OGLP_ENTRY (NamedFramebufferTextureLayer) = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC) ptr;
     ptr = getprocaddress ("glNamedFramebufferDrawBuffer");
-    if (ptr) NamedFramebufferDrawBuffer = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC) ptr;
+    if (ptr) OGLP_ENTRY (NamedFramebufferDrawBuffer) = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC) ptr;
     ptr = getprocaddress ("glNamedFramebufferDrawBuffers");
-    if (ptr) NamedFramebufferDrawBuffers = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC) ptr;
+    if (ptr) OGLP_ENTRY (NamedFramebufferDrawBuffers) = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC) ptr;
     ptr = getprocaddress ("glNamedFramebufferReadBuffer");
-    if (ptr) NamedFramebufferReadBuffer = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC) ptr;
+    if (ptr) OGLP_ENTRY (NamedFramebufferReadBuffer) = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC) ptr;
     ptr = getprocaddress ("glInvalidateNamedFramebufferData");
-    if (ptr) InvalidateNamedFramebufferData = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC) ptr;
+    if (ptr) OGLP_ENTRY (InvalidateNamedFramebufferData) = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC) ptr;
     ptr = getprocaddress ("glInvalidateNamedFramebufferSubData");
-    if (ptr) InvalidateNamedFramebufferSubData = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC) ptr;
+    if (ptr) OGLP_ENTRY (InvalidateNamedFramebufferSubData) = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC) ptr;
     ptr = getprocaddress ("glClearNamedFramebufferiv");
-    if (ptr) ClearNamedFramebufferiv = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ClearNamedFramebufferiv) = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC) ptr;
     ptr = getprocaddress ("glClearNamedFramebufferuiv");
-    if (ptr) ClearNamedFramebufferuiv = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ClearNamedFramebufferuiv) = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC) ptr;
     ptr = getprocaddress ("glClearNamedFramebufferfv");
-    if (ptr) ClearNamedFramebufferfv = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ClearNamedFramebufferfv) = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC) ptr;
     ptr = getprocaddress ("glClearNamedFramebufferfi");
-    if (ptr) ClearNamedFramebufferfi = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC) ptr;
+    if (ptr) OGLP_ENTRY (ClearNamedFramebufferfi) = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC) ptr;
     ptr = getprocaddress ("glBlitNamedFramebuffer");
-    if (ptr) BlitNamedFramebuffer = (PFNGLBLITNAMEDFRAMEBUFFERPROC) ptr;
+    if (ptr) OGLP_ENTRY (BlitNamedFramebuffer) = (PFNGLBLITNAMEDFRAMEBUFFERPROC) ptr;
     ptr = getprocaddress ("glCheckNamedFramebufferStatus");
-    if (ptr) CheckNamedFramebufferStatus = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC) ptr;
+    if (ptr) OGLP_ENTRY (CheckNamedFramebufferStatus) = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC) ptr;
     ptr = getprocaddress ("glGetNamedFramebufferParameteriv");
-    if (ptr) GetNamedFramebufferParameteriv = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetNamedFramebufferParameteriv) = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC) ptr;
     ptr = getprocaddress ("glGetNamedFramebufferAttachmentParameteriv");
-    if (ptr) GetNamedFramebufferAttachmentParameteriv = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetNamedFramebufferAttachmentParameteriv) = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC) ptr;
     ptr = getprocaddress ("glCreateRenderbuffers");
-    if (ptr) CreateRenderbuffers = (PFNGLCREATERENDERBUFFERSPROC) ptr;
+    if (ptr) OGLP_ENTRY (CreateRenderbuffers) = (PFNGLCREATERENDERBUFFERSPROC) ptr;
     ptr = getprocaddress ("glNamedRenderbufferStorage");
-    if (ptr) NamedRenderbufferStorage = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC) ptr;
+    if (ptr) OGLP_ENTRY (NamedRenderbufferStorage) = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC) ptr;
     ptr = getprocaddress ("glNamedRenderbufferStorageMultisample");
-    if (ptr) NamedRenderbufferStorageMultisample = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC) ptr;
+    if (ptr) OGLP_ENTRY (NamedRenderbufferStorageMultisample) = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC) ptr;
     ptr = getprocaddress ("glGetNamedRenderbufferParameteriv");
-    if (ptr) GetNamedRenderbufferParameteriv = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetNamedRenderbufferParameteriv) = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC) ptr;
     ptr = getprocaddress ("glCreateTextures");
-    if (ptr) CreateTextures = (PFNGLCREATETEXTURESPROC) ptr;
+    if (ptr) OGLP_ENTRY (CreateTextures) = (PFNGLCREATETEXTURESPROC) ptr;
     ptr = getprocaddress ("glTextureBuffer");
-    if (ptr) TextureBuffer = (PFNGLTEXTUREBUFFERPROC) ptr;
+    if (ptr) OGLP_ENTRY (TextureBuffer) = (PFNGLTEXTUREBUFFERPROC) ptr;
     ptr = getprocaddress ("glTextureBufferRange");
-    if (ptr) TextureBufferRange = (PFNGLTEXTUREBUFFERRANGEPROC) ptr;
+    if (ptr) OGLP_ENTRY (TextureBufferRange) = (PFNGLTEXTUREBUFFERRANGEPROC) ptr;
     ptr = getprocaddress ("glTextureStorage1D");
-    if (ptr) TextureStorage1D = (PFNGLTEXTURESTORAGE1DPROC) ptr;
+    if (ptr) OGLP_ENTRY (TextureStorage1D) = (PFNGLTEXTURESTORAGE1DPROC) ptr;
     ptr = getprocaddress ("glTextureStorage2D");
-    if (ptr) TextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC) ptr;
+    if (ptr) OGLP_ENTRY (TextureStorage2D) = (PFNGLTEXTURESTORAGE2DPROC) ptr;
     ptr = getprocaddress ("glTextureStorage3D");
-    if (ptr) TextureStorage3D = (PFNGLTEXTURESTORAGE3DPROC) ptr;
+    if (ptr) OGLP_ENTRY (TextureStorage3D) = (PFNGLTEXTURESTORAGE3DPROC) ptr;
     ptr = getprocaddress ("glTextureStorage2DMultisample");
-    if (ptr) TextureStorage2DMultisample = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC) ptr;
+    if (ptr) OGLP_ENTRY (TextureStorage2DMultisample) = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC) ptr;
     ptr = getprocaddress ("glTextureStorage3DMultisample");
-    if (ptr) TextureStorage3DMultisample = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC) ptr;
+    if (ptr) OGLP_ENTRY (TextureStorage3DMultisample) = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC) ptr;
     ptr = getprocaddress ("glTextureSubImage1D");
-    if (ptr) TextureSubImage1D = (PFNGLTEXTURESUBIMAGE1DPROC) ptr;
+    if (ptr) OGLP_ENTRY (TextureSubImage1D) = (PFNGLTEXTURESUBIMAGE1DPROC) ptr;
     ptr = getprocaddress ("glTextureSubImage2D");
-    if (ptr) TextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC) ptr;
+    if (ptr) OGLP_ENTRY (TextureSubImage2D) = (PFNGLTEXTURESUBIMAGE2DPROC) ptr;
     ptr = getprocaddress ("glTextureSubImage3D");
-    if (ptr) TextureSubImage3D = (PFNGLTEXTURESUBIMAGE3DPROC) ptr;
+    if (ptr) OGLP_ENTRY (TextureSubImage3D) = (PFNGLTEXTURESUBIMAGE3DPROC) ptr;
     ptr = getprocaddress ("glCompressedTextureSubImage1D");
-    if (ptr) CompressedTextureSubImage1D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC) ptr;
+    if (ptr) OGLP_ENTRY (CompressedTextureSubImage1D) = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC) ptr;
     ptr = getprocaddress ("glCompressedTextureSubImage2D");
-    if (ptr) CompressedTextureSubImage2D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC) ptr;
+    if (ptr) OGLP_ENTRY (CompressedTextureSubImage2D) = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC) ptr;
     ptr = getprocaddress ("glCompressedTextureSubImage3D");
-    if (ptr) CompressedTextureSubImage3D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC) ptr;
+    if (ptr) OGLP_ENTRY (CompressedTextureSubImage3D) = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC) ptr;
     ptr = getprocaddress ("glCopyTextureSubImage1D");
-    if (ptr) CopyTextureSubImage1D = (PFNGLCOPYTEXTURESUBIMAGE1DPROC) ptr;
+    if (ptr) OGLP_ENTRY (CopyTextureSubImage1D) = (PFNGLCOPYTEXTURESUBIMAGE1DPROC) ptr;
     ptr = getprocaddress ("glCopyTextureSubImage2D");
-    if (ptr) CopyTextureSubImage2D = (PFNGLCOPYTEXTURESUBIMAGE2DPROC) ptr;
+    if (ptr) OGLP_ENTRY (CopyTextureSubImage2D) = (PFNGLCOPYTEXTURESUBIMAGE2DPROC) ptr;
     ptr = getprocaddress ("glCopyTextureSubImage3D");
-    if (ptr) CopyTextureSubImage3D = (PFNGLCOPYTEXTURESUBIMAGE3DPROC) ptr;
+    if (ptr) OGLP_ENTRY (CopyTextureSubImage3D) = (PFNGLCOPYTEXTURESUBIMAGE3DPROC) ptr;
     ptr = getprocaddress ("glTextureParameterf");
-    if (ptr) TextureParameterf = (PFNGLTEXTUREPARAMETERFPROC) ptr;
+    if (ptr) OGLP_ENTRY (TextureParameterf) = (PFNGLTEXTUREPARAMETERFPROC) ptr;
     ptr = getprocaddress ("glTextureParameterfv");
-    if (ptr) TextureParameterfv = (PFNGLTEXTUREPARAMETERFVPROC) ptr;
+    if (ptr) OGLP_ENTRY (TextureParameterfv) = (PFNGLTEXTUREPARAMETERFVPROC) ptr;
     ptr = getprocaddress ("glTextureParameteri");
-    if (ptr) TextureParameteri = (PFNGLTEXTUREPARAMETERIPROC) ptr;
+    if (ptr) OGLP_ENTRY (TextureParameteri) = (PFNGLTEXTUREPARAMETERIPROC) ptr;
     ptr = getprocaddress ("glTextureParameterIiv");
-    if (ptr) TextureParameterIiv = (PFNGLTEXTUREPARAMETERIIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (TextureParameterIiv) = (PFNGLTEXTUREPARAMETERIIVPROC) ptr;
     ptr = getprocaddress ("glTextureParameterIuiv");
-    if (ptr) TextureParameterIuiv = (PFNGLTEXTUREPARAMETERIUIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (TextureParameterIuiv) = (PFNGLTEXTUREPARAMETERIUIVPROC) ptr;
     ptr = getprocaddress ("glTextureParameteriv");
-    if (ptr) TextureParameteriv = (PFNGLTEXTUREPARAMETERIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (TextureParameteriv) = (PFNGLTEXTUREPARAMETERIVPROC) ptr;
     ptr = getprocaddress ("glGenerateTextureMipmap");
-    if (ptr) GenerateTextureMipmap = (PFNGLGENERATETEXTUREMIPMAPPROC) ptr;
+    if (ptr) OGLP_ENTRY (GenerateTextureMipmap) = (PFNGLGENERATETEXTUREMIPMAPPROC) ptr;
     ptr = getprocaddress ("glBindTextureUnit");
-    if (ptr) BindTextureUnit = (PFNGLBINDTEXTUREUNITPROC) ptr;
+    if (ptr) OGLP_ENTRY (BindTextureUnit) = (PFNGLBINDTEXTUREUNITPROC) ptr;
     ptr = getprocaddress ("glGetTextureImage");
-    if (ptr) GetTextureImage = (PFNGLGETTEXTUREIMAGEPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetTextureImage) = (PFNGLGETTEXTUREIMAGEPROC) ptr;
     ptr = getprocaddress ("glGetCompressedTextureImage");
-    if (ptr) GetCompressedTextureImage = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetCompressedTextureImage) = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC) ptr;
     ptr = getprocaddress ("glGetTextureLevelParameterfv");
-    if (ptr) GetTextureLevelParameterfv = (PFNGLGETTEXTURELEVELPARAMETERFVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetTextureLevelParameterfv) = (PFNGLGETTEXTURELEVELPARAMETERFVPROC) ptr;
     ptr = getprocaddress ("glGetTextureLevelParameteriv");
-    if (ptr) GetTextureLevelParameteriv = (PFNGLGETTEXTURELEVELPARAMETERIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetTextureLevelParameteriv) = (PFNGLGETTEXTURELEVELPARAMETERIVPROC) ptr;
     ptr = getprocaddress ("glGetTextureParameterfv");
-    if (ptr) GetTextureParameterfv = (PFNGLGETTEXTUREPARAMETERFVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetTextureParameterfv) = (PFNGLGETTEXTUREPARAMETERFVPROC) ptr;
     ptr = getprocaddress ("glGetTextureParameterIiv");
-    if (ptr) GetTextureParameterIiv = (PFNGLGETTEXTUREPARAMETERIIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetTextureParameterIiv) = (PFNGLGETTEXTUREPARAMETERIIVPROC) ptr;
     ptr = getprocaddress ("glGetTextureParameterIuiv");
-    if (ptr) GetTextureParameterIuiv = (PFNGLGETTEXTUREPARAMETERIUIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetTextureParameterIuiv) = (PFNGLGETTEXTUREPARAMETERIUIVPROC) ptr;
     ptr = getprocaddress ("glGetTextureParameteriv");
-    if (ptr) GetTextureParameteriv = (PFNGLGETTEXTUREPARAMETERIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetTextureParameteriv) = (PFNGLGETTEXTUREPARAMETERIVPROC) ptr;
     ptr = getprocaddress ("glCreateVertexArrays");
-    if (ptr) CreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC) ptr;
+    if (ptr) OGLP_ENTRY (CreateVertexArrays) = (PFNGLCREATEVERTEXARRAYSPROC) ptr;
     ptr = getprocaddress ("glDisableVertexArrayAttrib");
-    if (ptr) DisableVertexArrayAttrib = (PFNGLDISABLEVERTEXARRAYATTRIBPROC) ptr;
+    if (ptr) OGLP_ENTRY (DisableVertexArrayAttrib) = (PFNGLDISABLEVERTEXARRAYATTRIBPROC) ptr;
     ptr = getprocaddress ("glEnableVertexArrayAttrib");
-    if (ptr) EnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC) ptr;
+    if (ptr) OGLP_ENTRY (EnableVertexArrayAttrib) = (PFNGLENABLEVERTEXARRAYATTRIBPROC) ptr;
     ptr = getprocaddress ("glVertexArrayElementBuffer");
-    if (ptr) VertexArrayElementBuffer = (PFNGLVERTEXARRAYELEMENTBUFFERPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexArrayElementBuffer) = (PFNGLVERTEXARRAYELEMENTBUFFERPROC) ptr;
     ptr = getprocaddress ("glVertexArrayVertexBuffer");
-    if (ptr) VertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexArrayVertexBuffer) = (PFNGLVERTEXARRAYVERTEXBUFFERPROC) ptr;
     ptr = getprocaddress ("glVertexArrayVertexBuffers");
-    if (ptr) VertexArrayVertexBuffers = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexArrayVertexBuffers) = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC) ptr;
     ptr = getprocaddress ("glVertexArrayAttribBinding");
-    if (ptr) VertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexArrayAttribBinding) = (PFNGLVERTEXARRAYATTRIBBINDINGPROC) ptr;
     ptr = getprocaddress ("glVertexArrayAttribFormat");
-    if (ptr) VertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexArrayAttribFormat) = (PFNGLVERTEXARRAYATTRIBFORMATPROC) ptr;
     ptr = getprocaddress ("glVertexArrayAttribIFormat");
-    if (ptr) VertexArrayAttribIFormat = (PFNGLVERTEXARRAYATTRIBIFORMATPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexArrayAttribIFormat) = (PFNGLVERTEXARRAYATTRIBIFORMATPROC) ptr;
     ptr = getprocaddress ("glVertexArrayAttribLFormat");
-    if (ptr) VertexArrayAttribLFormat = (PFNGLVERTEXARRAYATTRIBLFORMATPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexArrayAttribLFormat) = (PFNGLVERTEXARRAYATTRIBLFORMATPROC) ptr;
     ptr = getprocaddress ("glVertexArrayBindingDivisor");
-    if (ptr) VertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexArrayBindingDivisor) = (PFNGLVERTEXARRAYBINDINGDIVISORPROC) ptr;
     ptr = getprocaddress ("glGetVertexArrayiv");
-    if (ptr) GetVertexArrayiv = (PFNGLGETVERTEXARRAYIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetVertexArrayiv) = (PFNGLGETVERTEXARRAYIVPROC) ptr;
     ptr = getprocaddress ("glGetVertexArrayIndexediv");
-    if (ptr) GetVertexArrayIndexediv = (PFNGLGETVERTEXARRAYINDEXEDIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetVertexArrayIndexediv) = (PFNGLGETVERTEXARRAYINDEXEDIVPROC) ptr;
     ptr = getprocaddress ("glGetVertexArrayIndexed64iv");
-    if (ptr) GetVertexArrayIndexed64iv = (PFNGLGETVERTEXARRAYINDEXED64IVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetVertexArrayIndexed64iv) = (PFNGLGETVERTEXARRAYINDEXED64IVPROC) ptr;
     ptr = getprocaddress ("glCreateSamplers");
-    if (ptr) CreateSamplers = (PFNGLCREATESAMPLERSPROC) ptr;
+    if (ptr) OGLP_ENTRY (CreateSamplers) = (PFNGLCREATESAMPLERSPROC) ptr;
     ptr = getprocaddress ("glCreateProgramPipelines");
-    if (ptr) CreateProgramPipelines = (PFNGLCREATEPROGRAMPIPELINESPROC) ptr;
+    if (ptr) OGLP_ENTRY (CreateProgramPipelines) = (PFNGLCREATEPROGRAMPIPELINESPROC) ptr;
     ptr = getprocaddress ("glCreateQueries");
-    if (ptr) CreateQueries = (PFNGLCREATEQUERIESPROC) ptr;
+    if (ptr) OGLP_ENTRY (CreateQueries) = (PFNGLCREATEQUERIESPROC) ptr;
     ptr = getprocaddress ("glGetQueryBufferObjecti64v");
-    if (ptr) GetQueryBufferObjecti64v = (PFNGLGETQUERYBUFFEROBJECTI64VPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetQueryBufferObjecti64v) = (PFNGLGETQUERYBUFFEROBJECTI64VPROC) ptr;
     ptr = getprocaddress ("glGetQueryBufferObjectiv");
-    if (ptr) GetQueryBufferObjectiv = (PFNGLGETQUERYBUFFEROBJECTIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetQueryBufferObjectiv) = (PFNGLGETQUERYBUFFEROBJECTIVPROC) ptr;
     ptr = getprocaddress ("glGetQueryBufferObjectui64v");
-    if (ptr) GetQueryBufferObjectui64v = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetQueryBufferObjectui64v) = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC) ptr;
     ptr = getprocaddress ("glGetQueryBufferObjectuiv");
-    if (ptr) GetQueryBufferObjectuiv = (PFNGLGETQUERYBUFFEROBJECTUIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetQueryBufferObjectuiv) = (PFNGLGETQUERYBUFFEROBJECTUIVPROC) ptr;
     ptr = getprocaddress ("glMemoryBarrierByRegion");
-    if (ptr) MemoryBarrierByRegion = (PFNGLMEMORYBARRIERBYREGIONPROC) ptr;
+    if (ptr) OGLP_ENTRY (MemoryBarrierByRegion) = (PFNGLMEMORYBARRIERBYREGIONPROC) ptr;
     ptr = getprocaddress ("glGetTextureSubImage");
-    if (ptr) GetTextureSubImage = (PFNGLGETTEXTURESUBIMAGEPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetTextureSubImage) = (PFNGLGETTEXTURESUBIMAGEPROC) ptr;
     ptr = getprocaddress ("glGetCompressedTextureSubImage");
-    if (ptr) GetCompressedTextureSubImage = (PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetCompressedTextureSubImage) = (PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC) ptr;
     ptr = getprocaddress ("glGetGraphicsResetStatus");
-    if (ptr) GetGraphicsResetStatus = (PFNGLGETGRAPHICSRESETSTATUSPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetGraphicsResetStatus) = (PFNGLGETGRAPHICSRESETSTATUSPROC) ptr;
     ptr = getprocaddress ("glGetnCompressedTexImage");
-    if (ptr) GetnCompressedTexImage = (PFNGLGETNCOMPRESSEDTEXIMAGEPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetnCompressedTexImage) = (PFNGLGETNCOMPRESSEDTEXIMAGEPROC) ptr;
     ptr = getprocaddress ("glGetnTexImage");
-    if (ptr) GetnTexImage = (PFNGLGETNTEXIMAGEPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetnTexImage) = (PFNGLGETNTEXIMAGEPROC) ptr;
     ptr = getprocaddress ("glGetnUniformdv");
-    if (ptr) GetnUniformdv = (PFNGLGETNUNIFORMDVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetnUniformdv) = (PFNGLGETNUNIFORMDVPROC) ptr;
     ptr = getprocaddress ("glGetnUniformfv");
-    if (ptr) GetnUniformfv = (PFNGLGETNUNIFORMFVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetnUniformfv) = (PFNGLGETNUNIFORMFVPROC) ptr;
     ptr = getprocaddress ("glGetnUniformiv");
-    if (ptr) GetnUniformiv = (PFNGLGETNUNIFORMIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetnUniformiv) = (PFNGLGETNUNIFORMIVPROC) ptr;
     ptr = getprocaddress ("glGetnUniformuiv");
-    if (ptr) GetnUniformuiv = (PFNGLGETNUNIFORMUIVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetnUniformuiv) = (PFNGLGETNUNIFORMUIVPROC) ptr;
     ptr = getprocaddress ("glReadnPixels");
-    if (ptr) ReadnPixels = (PFNGLREADNPIXELSPROC) ptr;
+    if (ptr) OGLP_ENTRY (ReadnPixels) = (PFNGLREADNPIXELSPROC) ptr;
     ptr = getprocaddress ("glTextureBarrier");
-    if (ptr) TextureBarrier = (PFNGLTEXTUREBARRIERPROC) ptr;
+    if (ptr) OGLP_ENTRY (TextureBarrier) = (PFNGLTEXTUREBARRIERPROC) ptr;
+#endif /* !defined OGLP_DIRECT_LINK */
     ptr = getprocaddress ("glGetTextureHandleARB");
-    if (ptr) GetTextureHandleARB = (PFNGLGETTEXTUREHANDLEARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetTextureHandleARB) = (PFNGLGETTEXTUREHANDLEARBPROC) ptr;
     ptr = getprocaddress ("glGetTextureSamplerHandleARB");
-    if (ptr) GetTextureSamplerHandleARB = (PFNGLGETTEXTURESAMPLERHANDLEARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetTextureSamplerHandleARB) = (PFNGLGETTEXTURESAMPLERHANDLEARBPROC) ptr;
     ptr = getprocaddress ("glMakeTextureHandleResidentARB");
-    if (ptr) MakeTextureHandleResidentARB = (PFNGLMAKETEXTUREHANDLERESIDENTARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (MakeTextureHandleResidentARB) = (PFNGLMAKETEXTUREHANDLERESIDENTARBPROC) ptr;
     ptr = getprocaddress ("glMakeTextureHandleNonResidentARB");
-    if (ptr) MakeTextureHandleNonResidentARB = (PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (MakeTextureHandleNonResidentARB) = (PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC) ptr;
     ptr = getprocaddress ("glGetImageHandleARB");
-    if (ptr) GetImageHandleARB = (PFNGLGETIMAGEHANDLEARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetImageHandleARB) = (PFNGLGETIMAGEHANDLEARBPROC) ptr;
     ptr = getprocaddress ("glMakeImageHandleResidentARB");
-    if (ptr) MakeImageHandleResidentARB = (PFNGLMAKEIMAGEHANDLERESIDENTARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (MakeImageHandleResidentARB) = (PFNGLMAKEIMAGEHANDLERESIDENTARBPROC) ptr;
     ptr = getprocaddress ("glMakeImageHandleNonResidentARB");
-    if (ptr) MakeImageHandleNonResidentARB = (PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (MakeImageHandleNonResidentARB) = (PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC) ptr;
     ptr = getprocaddress ("glUniformHandleui64ARB");
-    if (ptr) UniformHandleui64ARB = (PFNGLUNIFORMHANDLEUI64ARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (UniformHandleui64ARB) = (PFNGLUNIFORMHANDLEUI64ARBPROC) ptr;
     ptr = getprocaddress ("glUniformHandleui64vARB");
-    if (ptr) UniformHandleui64vARB = (PFNGLUNIFORMHANDLEUI64VARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (UniformHandleui64vARB) = (PFNGLUNIFORMHANDLEUI64VARBPROC) ptr;
     ptr = getprocaddress ("glProgramUniformHandleui64ARB");
-    if (ptr) ProgramUniformHandleui64ARB = (PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniformHandleui64ARB) = (PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC) ptr;
     ptr = getprocaddress ("glProgramUniformHandleui64vARB");
-    if (ptr) ProgramUniformHandleui64vARB = (PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniformHandleui64vARB) = (PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC) ptr;
     ptr = getprocaddress ("glIsTextureHandleResidentARB");
-    if (ptr) IsTextureHandleResidentARB = (PFNGLISTEXTUREHANDLERESIDENTARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (IsTextureHandleResidentARB) = (PFNGLISTEXTUREHANDLERESIDENTARBPROC) ptr;
     ptr = getprocaddress ("glIsImageHandleResidentARB");
-    if (ptr) IsImageHandleResidentARB = (PFNGLISIMAGEHANDLERESIDENTARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (IsImageHandleResidentARB) = (PFNGLISIMAGEHANDLERESIDENTARBPROC) ptr;
     ptr = getprocaddress ("glVertexAttribL1ui64ARB");
-    if (ptr) VertexAttribL1ui64ARB = (PFNGLVERTEXATTRIBL1UI64ARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribL1ui64ARB) = (PFNGLVERTEXATTRIBL1UI64ARBPROC) ptr;
     ptr = getprocaddress ("glVertexAttribL1ui64vARB");
-    if (ptr) VertexAttribL1ui64vARB = (PFNGLVERTEXATTRIBL1UI64VARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribL1ui64vARB) = (PFNGLVERTEXATTRIBL1UI64VARBPROC) ptr;
     ptr = getprocaddress ("glGetVertexAttribLui64vARB");
-    if (ptr) GetVertexAttribLui64vARB = (PFNGLGETVERTEXATTRIBLUI64VARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetVertexAttribLui64vARB) = (PFNGLGETVERTEXATTRIBLUI64VARBPROC) ptr;
     ptr = getprocaddress ("glCreateSyncFromCLeventARB");
-    if (ptr) CreateSyncFromCLeventARB = (PFNGLCREATESYNCFROMCLEVENTARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (CreateSyncFromCLeventARB) = (PFNGLCREATESYNCFROMCLEVENTARBPROC) ptr;
     ptr = getprocaddress ("glDispatchComputeGroupSizeARB");
-    if (ptr) DispatchComputeGroupSizeARB = (PFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (DispatchComputeGroupSizeARB) = (PFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC) ptr;
     ptr = getprocaddress ("glDebugMessageControlARB");
-    if (ptr) DebugMessageControlARB = (PFNGLDEBUGMESSAGECONTROLARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (DebugMessageControlARB) = (PFNGLDEBUGMESSAGECONTROLARBPROC) ptr;
     ptr = getprocaddress ("glDebugMessageInsertARB");
-    if (ptr) DebugMessageInsertARB = (PFNGLDEBUGMESSAGEINSERTARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (DebugMessageInsertARB) = (PFNGLDEBUGMESSAGEINSERTARBPROC) ptr;
     ptr = getprocaddress ("glDebugMessageCallbackARB");
-    if (ptr) DebugMessageCallbackARB = (PFNGLDEBUGMESSAGECALLBACKARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (DebugMessageCallbackARB) = (PFNGLDEBUGMESSAGECALLBACKARBPROC) ptr;
     ptr = getprocaddress ("glGetDebugMessageLogARB");
-    if (ptr) GetDebugMessageLogARB = (PFNGLGETDEBUGMESSAGELOGARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetDebugMessageLogARB) = (PFNGLGETDEBUGMESSAGELOGARBPROC) ptr;
     ptr = getprocaddress ("glBlendEquationiARB");
-    if (ptr) BlendEquationiARB = (PFNGLBLENDEQUATIONIARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (BlendEquationiARB) = (PFNGLBLENDEQUATIONIARBPROC) ptr;
     ptr = getprocaddress ("glBlendEquationSeparateiARB");
-    if (ptr) BlendEquationSeparateiARB = (PFNGLBLENDEQUATIONSEPARATEIARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (BlendEquationSeparateiARB) = (PFNGLBLENDEQUATIONSEPARATEIARBPROC) ptr;
     ptr = getprocaddress ("glBlendFunciARB");
-    if (ptr) BlendFunciARB = (PFNGLBLENDFUNCIARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (BlendFunciARB) = (PFNGLBLENDFUNCIARBPROC) ptr;
     ptr = getprocaddress ("glBlendFuncSeparateiARB");
-    if (ptr) BlendFuncSeparateiARB = (PFNGLBLENDFUNCSEPARATEIARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (BlendFuncSeparateiARB) = (PFNGLBLENDFUNCSEPARATEIARBPROC) ptr;
     ptr = getprocaddress ("glMultiDrawArraysIndirectCountARB");
-    if (ptr) MultiDrawArraysIndirectCountARB = (PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (MultiDrawArraysIndirectCountARB) = (PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC) ptr;
     ptr = getprocaddress ("glMultiDrawElementsIndirectCountARB");
-    if (ptr) MultiDrawElementsIndirectCountARB = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (MultiDrawElementsIndirectCountARB) = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC) ptr;
     ptr = getprocaddress ("glGetGraphicsResetStatusARB");
-    if (ptr) GetGraphicsResetStatusARB = (PFNGLGETGRAPHICSRESETSTATUSARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetGraphicsResetStatusARB) = (PFNGLGETGRAPHICSRESETSTATUSARBPROC) ptr;
     ptr = getprocaddress ("glGetnTexImageARB");
-    if (ptr) GetnTexImageARB = (PFNGLGETNTEXIMAGEARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetnTexImageARB) = (PFNGLGETNTEXIMAGEARBPROC) ptr;
     ptr = getprocaddress ("glReadnPixelsARB");
-    if (ptr) ReadnPixelsARB = (PFNGLREADNPIXELSARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (ReadnPixelsARB) = (PFNGLREADNPIXELSARBPROC) ptr;
     ptr = getprocaddress ("glGetnCompressedTexImageARB");
-    if (ptr) GetnCompressedTexImageARB = (PFNGLGETNCOMPRESSEDTEXIMAGEARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetnCompressedTexImageARB) = (PFNGLGETNCOMPRESSEDTEXIMAGEARBPROC) ptr;
     ptr = getprocaddress ("glGetnUniformfvARB");
-    if (ptr) GetnUniformfvARB = (PFNGLGETNUNIFORMFVARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetnUniformfvARB) = (PFNGLGETNUNIFORMFVARBPROC) ptr;
     ptr = getprocaddress ("glGetnUniformivARB");
-    if (ptr) GetnUniformivARB = (PFNGLGETNUNIFORMIVARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetnUniformivARB) = (PFNGLGETNUNIFORMIVARBPROC) ptr;
     ptr = getprocaddress ("glGetnUniformuivARB");
-    if (ptr) GetnUniformuivARB = (PFNGLGETNUNIFORMUIVARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetnUniformuivARB) = (PFNGLGETNUNIFORMUIVARBPROC) ptr;
     ptr = getprocaddress ("glGetnUniformdvARB");
-    if (ptr) GetnUniformdvARB = (PFNGLGETNUNIFORMDVARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetnUniformdvARB) = (PFNGLGETNUNIFORMDVARBPROC) ptr;
     ptr = getprocaddress ("glMinSampleShadingARB");
-    if (ptr) MinSampleShadingARB = (PFNGLMINSAMPLESHADINGARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (MinSampleShadingARB) = (PFNGLMINSAMPLESHADINGARBPROC) ptr;
     ptr = getprocaddress ("glNamedStringARB");
-    if (ptr) NamedStringARB = (PFNGLNAMEDSTRINGARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (NamedStringARB) = (PFNGLNAMEDSTRINGARBPROC) ptr;
     ptr = getprocaddress ("glDeleteNamedStringARB");
-    if (ptr) DeleteNamedStringARB = (PFNGLDELETENAMEDSTRINGARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (DeleteNamedStringARB) = (PFNGLDELETENAMEDSTRINGARBPROC) ptr;
     ptr = getprocaddress ("glCompileShaderIncludeARB");
-    if (ptr) CompileShaderIncludeARB = (PFNGLCOMPILESHADERINCLUDEARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (CompileShaderIncludeARB) = (PFNGLCOMPILESHADERINCLUDEARBPROC) ptr;
     ptr = getprocaddress ("glIsNamedStringARB");
-    if (ptr) IsNamedStringARB = (PFNGLISNAMEDSTRINGARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (IsNamedStringARB) = (PFNGLISNAMEDSTRINGARBPROC) ptr;
     ptr = getprocaddress ("glGetNamedStringARB");
-    if (ptr) GetNamedStringARB = (PFNGLGETNAMEDSTRINGARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetNamedStringARB) = (PFNGLGETNAMEDSTRINGARBPROC) ptr;
     ptr = getprocaddress ("glGetNamedStringivARB");
-    if (ptr) GetNamedStringivARB = (PFNGLGETNAMEDSTRINGIVARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetNamedStringivARB) = (PFNGLGETNAMEDSTRINGIVARBPROC) ptr;
     ptr = getprocaddress ("glBufferPageCommitmentARB");
-    if (ptr) BufferPageCommitmentARB = (PFNGLBUFFERPAGECOMMITMENTARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (BufferPageCommitmentARB) = (PFNGLBUFFERPAGECOMMITMENTARBPROC) ptr;
     ptr = getprocaddress ("glNamedBufferPageCommitmentEXT");
-    if (ptr) NamedBufferPageCommitmentEXT = (PFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC) ptr;
+    if (ptr) OGLP_ENTRY (NamedBufferPageCommitmentEXT) = (PFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC) ptr;
     ptr = getprocaddress ("glNamedBufferPageCommitmentARB");
-    if (ptr) NamedBufferPageCommitmentARB = (PFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (NamedBufferPageCommitmentARB) = (PFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC) ptr;
     ptr = getprocaddress ("glTexPageCommitmentARB");
-    if (ptr) TexPageCommitmentARB = (PFNGLTEXPAGECOMMITMENTARBPROC) ptr;
+    if (ptr) OGLP_ENTRY (TexPageCommitmentARB) = (PFNGLTEXPAGECOMMITMENTARBPROC) ptr;
     ptr = getprocaddress ("glGetMultisamplefvNV");
-    if (ptr) GetMultisamplefvNV = (PFNGLGETMULTISAMPLEFVNVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetMultisamplefvNV) = (PFNGLGETMULTISAMPLEFVNVPROC) ptr;
     ptr = getprocaddress ("glSampleMaskIndexedNV");
-    if (ptr) SampleMaskIndexedNV = (PFNGLSAMPLEMASKINDEXEDNVPROC) ptr;
+    if (ptr) OGLP_ENTRY (SampleMaskIndexedNV) = (PFNGLSAMPLEMASKINDEXEDNVPROC) ptr;
     ptr = getprocaddress ("glTexRenderbufferNV");
-    if (ptr) TexRenderbufferNV = (PFNGLTEXRENDERBUFFERNVPROC) ptr;
+    if (ptr) OGLP_ENTRY (TexRenderbufferNV) = (PFNGLTEXRENDERBUFFERNVPROC) ptr;
     ptr = getprocaddress ("glMakeBufferResidentNV");
-    if (ptr) MakeBufferResidentNV = (PFNGLMAKEBUFFERRESIDENTNVPROC) ptr;
+    if (ptr) OGLP_ENTRY (MakeBufferResidentNV) = (PFNGLMAKEBUFFERRESIDENTNVPROC) ptr;
     ptr = getprocaddress ("glMakeBufferNonResidentNV");
-    if (ptr) MakeBufferNonResidentNV = (PFNGLMAKEBUFFERNONRESIDENTNVPROC) ptr;
+    if (ptr) OGLP_ENTRY (MakeBufferNonResidentNV) = (PFNGLMAKEBUFFERNONRESIDENTNVPROC) ptr;
     ptr = getprocaddress ("glIsBufferResidentNV");
-    if (ptr) IsBufferResidentNV = (PFNGLISBUFFERRESIDENTNVPROC) ptr;
+    if (ptr) OGLP_ENTRY (IsBufferResidentNV) = (PFNGLISBUFFERRESIDENTNVPROC) ptr;
     ptr = getprocaddress ("glMakeNamedBufferResidentNV");
-    if (ptr) MakeNamedBufferResidentNV = (PFNGLMAKENAMEDBUFFERRESIDENTNVPROC) ptr;
+    if (ptr) OGLP_ENTRY (MakeNamedBufferResidentNV) = (PFNGLMAKENAMEDBUFFERRESIDENTNVPROC) ptr;
     ptr = getprocaddress ("glMakeNamedBufferNonResidentNV");
-    if (ptr) MakeNamedBufferNonResidentNV = (PFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC) ptr;
+    if (ptr) OGLP_ENTRY (MakeNamedBufferNonResidentNV) = (PFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC) ptr;
     ptr = getprocaddress ("glIsNamedBufferResidentNV");
-    if (ptr) IsNamedBufferResidentNV = (PFNGLISNAMEDBUFFERRESIDENTNVPROC) ptr;
+    if (ptr) OGLP_ENTRY (IsNamedBufferResidentNV) = (PFNGLISNAMEDBUFFERRESIDENTNVPROC) ptr;
     ptr = getprocaddress ("glGetBufferParameterui64vNV");
-    if (ptr) GetBufferParameterui64vNV = (PFNGLGETBUFFERPARAMETERUI64VNVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetBufferParameterui64vNV) = (PFNGLGETBUFFERPARAMETERUI64VNVPROC) ptr;
     ptr = getprocaddress ("glGetNamedBufferParameterui64vNV");
-    if (ptr) GetNamedBufferParameterui64vNV = (PFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetNamedBufferParameterui64vNV) = (PFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC) ptr;
     ptr = getprocaddress ("glGetIntegerui64vNV");
-    if (ptr) GetIntegerui64vNV = (PFNGLGETINTEGERUI64VNVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetIntegerui64vNV) = (PFNGLGETINTEGERUI64VNVPROC) ptr;
     ptr = getprocaddress ("glUniformui64NV");
-    if (ptr) Uniformui64NV = (PFNGLUNIFORMUI64NVPROC) ptr;
+    if (ptr) OGLP_ENTRY (Uniformui64NV) = (PFNGLUNIFORMUI64NVPROC) ptr;
     ptr = getprocaddress ("glUniformui64vNV");
-    if (ptr) Uniformui64vNV = (PFNGLUNIFORMUI64VNVPROC) ptr;
+    if (ptr) OGLP_ENTRY (Uniformui64vNV) = (PFNGLUNIFORMUI64VNVPROC) ptr;
     ptr = getprocaddress ("glProgramUniformui64NV");
-    if (ptr) ProgramUniformui64NV = (PFNGLPROGRAMUNIFORMUI64NVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniformui64NV) = (PFNGLPROGRAMUNIFORMUI64NVPROC) ptr;
     ptr = getprocaddress ("glProgramUniformui64vNV");
-    if (ptr) ProgramUniformui64vNV = (PFNGLPROGRAMUNIFORMUI64VNVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ProgramUniformui64vNV) = (PFNGLPROGRAMUNIFORMUI64VNVPROC) ptr;
     ptr = getprocaddress ("glBufferAddressRangeNV");
-    if (ptr) BufferAddressRangeNV = (PFNGLBUFFERADDRESSRANGENVPROC) ptr;
+    if (ptr) OGLP_ENTRY (BufferAddressRangeNV) = (PFNGLBUFFERADDRESSRANGENVPROC) ptr;
     ptr = getprocaddress ("glVertexFormatNV");
-    if (ptr) VertexFormatNV = (PFNGLVERTEXFORMATNVPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexFormatNV) = (PFNGLVERTEXFORMATNVPROC) ptr;
     ptr = getprocaddress ("glNormalFormatNV");
-    if (ptr) NormalFormatNV = (PFNGLNORMALFORMATNVPROC) ptr;
+    if (ptr) OGLP_ENTRY (NormalFormatNV) = (PFNGLNORMALFORMATNVPROC) ptr;
     ptr = getprocaddress ("glColorFormatNV");
-    if (ptr) ColorFormatNV = (PFNGLCOLORFORMATNVPROC) ptr;
+    if (ptr) OGLP_ENTRY (ColorFormatNV) = (PFNGLCOLORFORMATNVPROC) ptr;
     ptr = getprocaddress ("glIndexFormatNV");
-    if (ptr) IndexFormatNV = (PFNGLINDEXFORMATNVPROC) ptr;
+    if (ptr) OGLP_ENTRY (IndexFormatNV) = (PFNGLINDEXFORMATNVPROC) ptr;
     ptr = getprocaddress ("glTexCoordFormatNV");
-    if (ptr) TexCoordFormatNV = (PFNGLTEXCOORDFORMATNVPROC) ptr;
+    if (ptr) OGLP_ENTRY (TexCoordFormatNV) = (PFNGLTEXCOORDFORMATNVPROC) ptr;
     ptr = getprocaddress ("glEdgeFlagFormatNV");
-    if (ptr) EdgeFlagFormatNV = (PFNGLEDGEFLAGFORMATNVPROC) ptr;
+    if (ptr) OGLP_ENTRY (EdgeFlagFormatNV) = (PFNGLEDGEFLAGFORMATNVPROC) ptr;
     ptr = getprocaddress ("glSecondaryColorFormatNV");
-    if (ptr) SecondaryColorFormatNV = (PFNGLSECONDARYCOLORFORMATNVPROC) ptr;
+    if (ptr) OGLP_ENTRY (SecondaryColorFormatNV) = (PFNGLSECONDARYCOLORFORMATNVPROC) ptr;
     ptr = getprocaddress ("glFogCoordFormatNV");
-    if (ptr) FogCoordFormatNV = (PFNGLFOGCOORDFORMATNVPROC) ptr;
+    if (ptr) OGLP_ENTRY (FogCoordFormatNV) = (PFNGLFOGCOORDFORMATNVPROC) ptr;
     ptr = getprocaddress ("glVertexAttribFormatNV");
-    if (ptr) VertexAttribFormatNV = (PFNGLVERTEXATTRIBFORMATNVPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribFormatNV) = (PFNGLVERTEXATTRIBFORMATNVPROC) ptr;
     ptr = getprocaddress ("glVertexAttribIFormatNV");
-    if (ptr) VertexAttribIFormatNV = (PFNGLVERTEXATTRIBIFORMATNVPROC) ptr;
+    if (ptr) OGLP_ENTRY (VertexAttribIFormatNV) = (PFNGLVERTEXATTRIBIFORMATNVPROC) ptr;
     ptr = getprocaddress ("glGetIntegerui64i_vNV");
-    if (ptr) GetIntegerui64i_vNV = (PFNGLGETINTEGERUI64I_VNVPROC) ptr;
+    if (ptr) OGLP_ENTRY (GetIntegerui64i_vNV) = (PFNGLGETINTEGERUI64I_VNVPROC) ptr;
     ptr = getprocaddress ("glEnableClientState");
-    if (ptr) EnableClientState = (PFNGLENABLECLIENTSTATEPROC) ptr;
+    if (ptr) OGLP_ENTRY (EnableClientState) = (PFNGLENABLECLIENTSTATEPROC) ptr;
     ptr = getprocaddress ("glDisableClientState");
-    if (ptr) DisableClientState = (PFNGLDISABLECLIENTSTATEPROC) ptr;
+    if (ptr) OGLP_ENTRY (DisableClientState) = (PFNGLDISABLECLIENTSTATEPROC) ptr;
+
+}
+
+void InitPrototypesLazy (GetProcAddressCallback getprocaddress)
+{
+    OGLP_GETPROCADDRESS = getprocaddress;
+#ifndef OGLP_DIRECT_LINK
+    OGLP_ENTRY (CullFace) = internal::Lazy_CullFace;
+    OGLP_ENTRY (FrontFace) = internal::Lazy_FrontFace;
+    OGLP_ENTRY (Hint) = internal::Lazy_Hint;
+    OGLP_ENTRY (LineWidth) = internal::Lazy_LineWidth;
+    OGLP_ENTRY (PointSize) = internal::Lazy_PointSize;
+    OGLP_ENTRY (PolygonMode) = internal::Lazy_PolygonMode;
+    OGLP_ENTRY (Scissor) = internal::Lazy_Scissor;
+    OGLP_ENTRY (TexParameterf) = internal::Lazy_TexParameterf;
+    OGLP_ENTRY (TexParameterfv) = internal::Lazy_TexParameterfv;
+    OGLP_ENTRY (TexParameteri) = internal::Lazy_TexParameteri;
+    OGLP_ENTRY (TexParameteriv) = internal::Lazy_TexParameteriv;
+    OGLP_ENTRY (TexImage1D) = internal::Lazy_TexImage1D;
+    OGLP_ENTRY (TexImage2D) = internal::Lazy_TexImage2D;
+    OGLP_ENTRY (DrawBuffer) = internal::Lazy_DrawBuffer;
+    OGLP_ENTRY (Clear) = internal::Lazy_Clear;
+    OGLP_ENTRY (ClearColor) = internal::Lazy_ClearColor;
+    OGLP_ENTRY (ClearStencil) = internal::Lazy_ClearStencil;
+    OGLP_ENTRY (ClearDepth) = internal::Lazy_ClearDepth;
+    OGLP_ENTRY (StencilMask) = internal::Lazy_StencilMask;
+    OGLP_ENTRY (ColorMask) = internal::Lazy_ColorMask;
+    OGLP_ENTRY (DepthMask) = internal::Lazy_DepthMask;
+    OGLP_ENTRY (Disable) = internal::Lazy_Disable;
+    OGLP_ENTRY (Enable) = internal::Lazy_Enable;
+    OGLP_ENTRY (Finish) = internal::Lazy_Finish;
+    OGLP_ENTRY (Flush) = internal::Lazy_Flush;
+    OGLP_ENTRY (BlendFunc) = internal::Lazy_BlendFunc;
+    OGLP_ENTRY (LogicOp) = internal::Lazy_LogicOp;
+    OGLP_ENTRY (StencilFunc) = internal::Lazy_StencilFunc;
+    OGLP_ENTRY (StencilOp) = internal::Lazy_StencilOp;
+    OGLP_ENTRY (DepthFunc) = internal::Lazy_DepthFunc;
+    OGLP_ENTRY (PixelStoref) = internal::Lazy_PixelStoref;
+    OGLP_ENTRY (PixelStorei) = internal::Lazy_PixelStorei;
+    OGLP_ENTRY (ReadBuffer) = internal::Lazy_ReadBuffer;
+    OGLP_ENTRY (ReadPixels) = internal::Lazy_ReadPixels;
+    OGLP_ENTRY (GetBooleanv) = internal::Lazy_GetBooleanv;
+    OGLP_ENTRY (GetDoublev) = internal::Lazy_GetDoublev;
+    OGLP_ENTRY (GetError) = internal::Lazy_GetError;
+    OGLP_ENTRY (GetFloatv) = internal::Lazy_GetFloatv;
+    OGLP_ENTRY (GetIntegerv) = internal::Lazy_GetIntegerv;
+    OGLP_ENTRY (GetString) = internal::Lazy_GetString;
+    OGLP_ENTRY (GetTexImage) = internal::Lazy_GetTexImage;
+    OGLP_ENTRY (GetTexParameterfv) = internal::Lazy_GetTexParameterfv;
+    OGLP_ENTRY (GetTexParameteriv) = internal::Lazy_GetTexParameteriv;
+    OGLP_ENTRY (GetTexLevelParameterfv) = internal::Lazy_GetTexLevelParameterfv;
+    OGLP_ENTRY (GetTexLevelParameteriv) = internal::Lazy_GetTexLevelParameteriv;
+    OGLP_ENTRY (IsEnabled) = internal::Lazy_IsEnabled;
+    OGLP_ENTRY (DepthRange) = internal::Lazy_DepthRange;
+    OGLP_ENTRY (Viewport) = internal::Lazy_Viewport;
+    OGLP_ENTRY (DrawArrays) = internal::Lazy_DrawArrays;
+    OGLP_ENTRY (DrawElements) = internal::Lazy_DrawElements;
+    OGLP_ENTRY (GetPointerv) = internal::Lazy_GetPointerv;
+    OGLP_ENTRY (PolygonOffset) = internal::Lazy_PolygonOffset;
+    OGLP_ENTRY (CopyTexImage1D) = internal::Lazy_CopyTexImage1D;
+    OGLP_ENTRY (CopyTexImage2D) = internal::Lazy_CopyTexImage2D;
+    OGLP_ENTRY (CopyTexSubImage1D) = internal::Lazy_CopyTexSubImage1D;
+    OGLP_ENTRY (CopyTexSubImage2D) = internal::Lazy_CopyTexSubImage2D;
+    OGLP_ENTRY (TexSubImage1D) = internal::Lazy_TexSubImage1D;
+    OGLP_ENTRY (TexSubImage2D) = internal::Lazy_TexSubImage2D;
+    OGLP_ENTRY (BindTexture) = internal::Lazy_BindTexture;
+    OGLP_ENTRY (DeleteTextures) = internal::Lazy_DeleteTextures;
+    OGLP_ENTRY (GenTextures) = internal::Lazy_GenTextures;
+    OGLP_ENTRY (IsTexture) = internal::Lazy_IsTexture;
+    OGLP_ENTRY (DrawRangeElements) = internal::Lazy_DrawRangeElements;
+    OGLP_ENTRY (TexImage3D) = internal::Lazy_TexImage3D;
+    OGLP_ENTRY (TexSubImage3D) = internal::Lazy_TexSubImage3D;
+    OGLP_ENTRY (CopyTexSubImage3D) = internal::Lazy_CopyTexSubImage3D;
+    OGLP_ENTRY (ActiveTexture) = internal::Lazy_ActiveTexture;
+    OGLP_ENTRY (SampleCoverage) = internal::Lazy_SampleCoverage;
+    OGLP_ENTRY (CompressedTexImage3D) = internal::Lazy_CompressedTexImage3D;
+    OGLP_ENTRY (CompressedTexImage2D) = internal::Lazy_CompressedTexImage2D;
+    OGLP_ENTRY (CompressedTexImage1D) = internal::Lazy_CompressedTexImage1D;
+    OGLP_ENTRY (CompressedTexSubImage3D) = internal::Lazy_CompressedTexSubImage3D;
+    OGLP_ENTRY (CompressedTexSubImage2D) = internal::Lazy_CompressedTexSubImage2D;
+    OGLP_ENTRY (CompressedTexSubImage1D) = internal::Lazy_CompressedTexSubImage1D;
+    OGLP_ENTRY (GetCompressedTexImage) = internal::Lazy_GetCompressedTexImage;
+    OGLP_ENTRY (BlendFuncSeparate) = internal::Lazy_BlendFuncSeparate;
+    OGLP_ENTRY (MultiDrawArrays) = internal::Lazy_MultiDrawArrays;
+    OGLP_ENTRY (MultiDrawElements) = internal::Lazy_MultiDrawElements;
+    OGLP_ENTRY (PointParameterf) = internal::Lazy_PointParameterf;
+    OGLP_ENTRY (PointParameterfv) = internal::Lazy_PointParameterfv;
+    OGLP_ENTRY (PointParameteri) = internal::Lazy_PointParameteri;
+    OGLP_ENTRY (PointParameteriv) = internal::Lazy_PointParameteriv;
+    OGLP_ENTRY (BlendColor) = internal::Lazy_BlendColor;
+    OGLP_ENTRY (BlendEquation) = internal::Lazy_BlendEquation;
+    OGLP_ENTRY (GenQueries) = internal::Lazy_GenQueries;
+    OGLP_ENTRY (DeleteQueries) = internal::Lazy_DeleteQueries;
+    OGLP_ENTRY (IsQuery) = internal::Lazy_IsQuery;
+    OGLP_ENTRY (BeginQuery) = internal::Lazy_BeginQuery;
+    OGLP_ENTRY (EndQuery) = internal::Lazy_EndQuery;
+    OGLP_ENTRY (GetQueryiv) = internal::Lazy_GetQueryiv;
+    OGLP_ENTRY (GetQueryObjectiv) = internal::Lazy_GetQueryObjectiv;
+    OGLP_ENTRY (GetQueryObjectuiv) = internal::Lazy_GetQueryObjectuiv;
+    OGLP_ENTRY (BindBuffer) = internal::Lazy_BindBuffer;
+    OGLP_ENTRY (DeleteBuffers) = internal::Lazy_DeleteBuffers;
+    OGLP_ENTRY (GenBuffers) = internal::Lazy_GenBuffers;
+    OGLP_ENTRY (IsBuffer) = internal::Lazy_IsBuffer;
+    OGLP_ENTRY (BufferData) = internal::Lazy_BufferData;
+    OGLP_ENTRY (BufferSubData) = internal::Lazy_BufferSubData;
+    OGLP_ENTRY (GetBufferSubData) = internal::Lazy_GetBufferSubData;
+    OGLP_ENTRY (MapBuffer) = internal::Lazy_MapBuffer;
+    OGLP_ENTRY (UnmapBuffer) = internal::Lazy_UnmapBuffer;
+    OGLP_ENTRY (GetBufferParameteriv) = internal::Lazy_GetBufferParameteriv;
+    OGLP_ENTRY (GetBufferPointerv) = internal::Lazy_GetBufferPointerv;
+    OGLP_ENTRY (BlendEquationSeparate) = internal::Lazy_BlendEquationSeparate;
+    OGLP_ENTRY (DrawBuffers) = internal::Lazy_DrawBuffers;
+    OGLP_ENTRY (StencilOpSeparate) = internal::Lazy_StencilOpSeparate;
+    OGLP_ENTRY (StencilFuncSeparate) = internal::Lazy_StencilFuncSeparate;
+    OGLP_ENTRY (StencilMaskSeparate) = internal::Lazy_StencilMaskSeparate;
+    OGLP_ENTRY (AttachShader) = internal::Lazy_AttachShader;
+    OGLP_ENTRY (BindAttribLocation) = internal::Lazy_BindAttribLocation;
+    OGLP_ENTRY (CompileShader) = internal::Lazy_CompileShader;
+    OGLP_ENTRY (CreateProgram) = internal::Lazy_CreateProgram;
+    OGLP_ENTRY (CreateShader) = internal::Lazy_CreateShader;
+    OGLP_ENTRY (DeleteProgram) = internal::Lazy_DeleteProgram;
+    OGLP_ENTRY (DeleteShader) = internal::Lazy_DeleteShader;
+    OGLP_ENTRY (DetachShader) = internal::Lazy_DetachShader;
+    OGLP_ENTRY (DisableVertexAttribArray) = internal::Lazy_DisableVertexAttribArray;
+    OGLP_ENTRY (EnableVertexAttribArray) = internal::Lazy_EnableVertexAttribArray;
+    OGLP_ENTRY (GetActiveAttrib) = internal::Lazy_GetActiveAttrib;
+    OGLP_ENTRY (GetActiveUniform) = internal::Lazy_GetActiveUniform;
+    OGLP_ENTRY (GetAttachedShaders) = internal::Lazy_GetAttachedShaders;
+    OGLP_ENTRY (GetAttribLocation) = internal::Lazy_GetAttribLocation;
+    OGLP_ENTRY (GetProgramiv) = internal::Lazy_GetProgramiv;
+    OGLP_ENTRY (GetProgramInfoLog) = internal::Lazy_GetProgramInfoLog;
+    OGLP_ENTRY (GetShaderiv) = internal::Lazy_GetShaderiv;
+    OGLP_ENTRY (GetShaderInfoLog) = internal::Lazy_GetShaderInfoLog;
+    OGLP_ENTRY (GetShaderSource) = internal::Lazy_GetShaderSource;
+    OGLP_ENTRY (GetUniformLocation) = internal::Lazy_GetUniformLocation;
+    OGLP_ENTRY (GetUniformfv) = internal::Lazy_GetUniformfv;
+    OGLP_ENTRY (GetUniformiv) = internal::Lazy_GetUniformiv;
+    OGLP_ENTRY (GetVertexAttribdv) = internal::Lazy_GetVertexAttribdv;
+    OGLP_ENTRY (GetVertexAttribfv) = internal::Lazy_GetVertexAttribfv;
+    OGLP_ENTRY (GetVertexAttribiv) = internal::Lazy_GetVertexAttribiv;
+    OGLP_ENTRY (GetVertexAttribPointerv) = internal::Lazy_GetVertexAttribPointerv;
+    OGLP_ENTRY (IsProgram) = internal::Lazy_IsProgram;
+    OGLP_ENTRY (IsShader) = internal::Lazy_IsShader;
+    OGLP_ENTRY (LinkProgram) = internal::Lazy_LinkProgram;
+    OGLP_ENTRY (ShaderSource) = internal::Lazy_ShaderSource;
+    OGLP_ENTRY (UseProgram) = internal::Lazy_UseProgram;
+    OGLP_ENTRY (Uniform1f) = internal::Lazy_Uniform1f;
+    OGLP_ENTRY (Uniform2f) = internal::Lazy_Uniform2f;
+    OGLP_ENTRY (Uniform3f) = internal::Lazy_Uniform3f;
+    OGLP_ENTRY (Uniform4f) = internal::Lazy_Uniform4f;
+    OGLP_ENTRY (Uniform1i) = internal::Lazy_Uniform1i;
+    OGLP_ENTRY (Uniform2i) = internal::Lazy_Uniform2i;
+    OGLP_ENTRY (Uniform3i) = internal::Lazy_Uniform3i;
+    OGLP_ENTRY (Uniform4i) = internal::Lazy_Uniform4i;
+    OGLP_ENTRY (Uniform1fv) = internal::Lazy_Uniform1fv;
+    OGLP_ENTRY (Uniform2fv) = internal::Lazy_Uniform2fv;
+    OGLP_ENTRY (Uniform3fv) = internal::Lazy_Uniform3fv;
+    OGLP_ENTRY (Uniform4fv) = internal::Lazy_Uniform4fv;
+    OGLP_ENTRY (Uniform1iv) = internal::Lazy_Uniform1iv;
+    OGLP_ENTRY (Uniform2iv) = internal::Lazy_Uniform2iv;
+    OGLP_ENTRY (Uniform3iv) = internal::Lazy_Uniform3iv;
+    OGLP_ENTRY (Uniform4iv) = internal::Lazy_Uniform4iv;
+    OGLP_ENTRY (UniformMatrix2fv) = internal::Lazy_UniformMatrix2fv;
+    OGLP_ENTRY (UniformMatrix3fv) = internal::Lazy_UniformMatrix3fv;
+    OGLP_ENTRY (UniformMatrix4fv) = internal::Lazy_UniformMatrix4fv;
+    OGLP_ENTRY (ValidateProgram) = internal::Lazy_ValidateProgram;
+    OGLP_ENTRY (VertexAttrib1d) = internal::Lazy_VertexAttrib1d;
+    OGLP_ENTRY (VertexAttrib1dv) = internal::Lazy_VertexAttrib1dv;
+    OGLP_ENTRY (VertexAttrib1f) = internal::Lazy_VertexAttrib1f;
+    OGLP_ENTRY (VertexAttrib1fv) = internal::Lazy_VertexAttrib1fv;
+    OGLP_ENTRY (VertexAttrib1s) = internal::Lazy_VertexAttrib1s;
+    OGLP_ENTRY (VertexAttrib1sv) = internal::Lazy_VertexAttrib1sv;
+    OGLP_ENTRY (VertexAttrib2d) = internal::Lazy_VertexAttrib2d;
+    OGLP_ENTRY (VertexAttrib2dv) = internal::Lazy_VertexAttrib2dv;
+    OGLP_ENTRY (VertexAttrib2f) = internal::Lazy_VertexAttrib2f;
+    OGLP_ENTRY (VertexAttrib2fv) = internal::Lazy_VertexAttrib2fv;
+    OGLP_ENTRY (VertexAttrib2s) = internal::Lazy_VertexAttrib2s;
+    OGLP_ENTRY (VertexAttrib2sv) = internal::Lazy_VertexAttrib2sv;
+    OGLP_ENTRY (VertexAttrib3d) = internal::Lazy_VertexAttrib3d;
+    OGLP_ENTRY (VertexAttrib3dv) = internal::Lazy_VertexAttrib3dv;
+    OGLP_ENTRY (VertexAttrib3f) = internal::Lazy_VertexAttrib3f;
+    OGLP_ENTRY (VertexAttrib3fv) = internal::Lazy_VertexAttrib3fv;
+    OGLP_ENTRY (VertexAttrib3s) = internal::Lazy_VertexAttrib3s;
+    OGLP_ENTRY (VertexAttrib3sv) = internal::Lazy_VertexAttrib3sv;
+    OGLP_ENTRY (VertexAttrib4Nbv) = internal::Lazy_VertexAttrib4Nbv;
+    OGLP_ENTRY (VertexAttrib4Niv) = internal::Lazy_VertexAttrib4Niv;
+    OGLP_ENTRY (VertexAttrib4Nsv) = internal::Lazy_VertexAttrib4Nsv;
+    OGLP_ENTRY (VertexAttrib4Nub) = internal::Lazy_VertexAttrib4Nub;
+    OGLP_ENTRY (VertexAttrib4Nubv) = internal::Lazy_VertexAttrib4Nubv;
+    OGLP_ENTRY (VertexAttrib4Nuiv) = internal::Lazy_VertexAttrib4Nuiv;
+    OGLP_ENTRY (VertexAttrib4Nusv) = internal::Lazy_VertexAttrib4Nusv;
+    OGLP_ENTRY (VertexAttrib4bv) = internal::Lazy_VertexAttrib4bv;
+    OGLP_ENTRY (VertexAttrib4d) = internal::Lazy_VertexAttrib4d;
+    OGLP_ENTRY (VertexAttrib4dv) = internal::Lazy_VertexAttrib4dv;
+    OGLP_ENTRY (VertexAttrib4f) = internal::Lazy_VertexAttrib4f;
+    OGLP_ENTRY (VertexAttrib4fv) = internal::Lazy_VertexAttrib4fv;
+    OGLP_ENTRY (VertexAttrib4iv) = internal::Lazy_VertexAttrib4iv;
+    OGLP_ENTRY (VertexAttrib4s) = internal::Lazy_VertexAttrib4s;
+    OGLP_ENTRY (VertexAttrib4sv) = internal::Lazy_VertexAttrib4sv;
+    OGLP_ENTRY (VertexAttrib4ubv) = internal::Lazy_VertexAttrib4ubv;
+    OGLP_ENTRY (VertexAttrib4uiv) = internal::Lazy_VertexAttrib4uiv;
+    OGLP_ENTRY (VertexAttrib4usv) = internal::Lazy_VertexAttrib4usv;
+    OGLP_ENTRY (VertexAttribPointer) = internal::Lazy_VertexAttribPointer;
+    OGLP_ENTRY (UniformMatrix2x3fv) = internal::Lazy_UniformMatrix2x3fv;
+    OGLP_ENTRY (UniformMatrix3x2fv) = internal::Lazy_UniformMatrix3x2fv;
+    OGLP_ENTRY (UniformMatrix2x4fv) = internal::Lazy_UniformMatrix2x4fv;
+    OGLP_ENTRY (UniformMatrix4x2fv) = internal::Lazy_UniformMatrix4x2fv;
+    OGLP_ENTRY (UniformMatrix3x4fv) = internal::Lazy_UniformMatrix3x4fv;
+    OGLP_ENTRY (UniformMatrix4x3fv) = internal::Lazy_UniformMatrix4x3fv;
+    OGLP_ENTRY (ColorMaski) = internal::Lazy_ColorMaski;
+    OGLP_ENTRY (GetBooleani_v) = internal::Lazy_GetBooleani_v;
+    OGLP_ENTRY (GetIntegeri_v) = internal::Lazy_GetIntegeri_v;
+    OGLP_ENTRY (Enablei) = internal::Lazy_Enablei;
+    OGLP_ENTRY (Disablei) = internal::Lazy_Disablei;
+    OGLP_ENTRY (IsEnabledi) = internal::Lazy_IsEnabledi;
+    OGLP_ENTRY (BeginTransformFeedback) = internal::Lazy_BeginTransformFeedback;
+    OGLP_ENTRY (EndTransformFeedback) = internal::Lazy_EndTransformFeedback;
+    OGLP_ENTRY (BindBufferRange) = internal::Lazy_BindBufferRange;
+    OGLP_ENTRY (BindBufferBase) = internal::Lazy_BindBufferBase;
+    OGLP_ENTRY (TransformFeedbackVaryings) = internal::Lazy_TransformFeedbackVaryings;
+    OGLP_ENTRY (GetTransformFeedbackVarying) = internal::Lazy_GetTransformFeedbackVarying;
+    OGLP_ENTRY (ClampColor) = internal::Lazy_ClampColor;
+    OGLP_ENTRY (BeginConditionalRender) = internal::Lazy_BeginConditionalRender;
+    OGLP_ENTRY (EndConditionalRender) = internal::Lazy_EndConditionalRender;
+    OGLP_ENTRY (VertexAttribIPointer) = internal::Lazy_VertexAttribIPointer;
+    OGLP_ENTRY (GetVertexAttribIiv) = internal::Lazy_GetVertexAttribIiv;
+    OGLP_ENTRY (GetVertexAttribIuiv) = internal::Lazy_GetVertexAttribIuiv;
+    OGLP_ENTRY (VertexAttribI1i) = internal::Lazy_VertexAttribI1i;
+    OGLP_ENTRY (VertexAttribI2i) = internal::Lazy_VertexAttribI2i;
+    OGLP_ENTRY (VertexAttribI3i) = internal::Lazy_VertexAttribI3i;
+    OGLP_ENTRY (VertexAttribI4i) = internal::Lazy_VertexAttribI4i;
+    OGLP_ENTRY (VertexAttribI1ui) = internal::Lazy_VertexAttribI1ui;
+    OGLP_ENTRY (VertexAttribI2ui) = internal::Lazy_VertexAttribI2ui;
+    OGLP_ENTRY (VertexAttribI3ui) = internal::Lazy_VertexAttribI3ui;
+    OGLP_ENTRY (VertexAttribI4ui) = internal::Lazy_VertexAttribI4ui;
+    OGLP_ENTRY (VertexAttribI1iv) = internal::Lazy_VertexAttribI1iv;
+    OGLP_ENTRY (VertexAttribI2iv) = internal::Lazy_VertexAttribI2iv;
+    OGLP_ENTRY (VertexAttribI3iv) = internal::Lazy_VertexAttribI3iv;
+    OGLP_ENTRY (VertexAttribI4iv) = internal::Lazy_VertexAttribI4iv;
+    OGLP_ENTRY (VertexAttribI1uiv) = internal::Lazy_VertexAttribI1uiv;
+    OGLP_ENTRY (VertexAttribI2uiv) = internal::Lazy_VertexAttribI2uiv;
+    OGLP_ENTRY (VertexAttribI3uiv) = internal::Lazy_VertexAttribI3uiv;
+    OGLP_ENTRY (VertexAttribI4uiv) = internal::Lazy_VertexAttribI4uiv;
+    OGLP_ENTRY (VertexAttribI4bv) = internal::Lazy_VertexAttribI4bv;
+    OGLP_ENTRY (VertexAttribI4sv) = internal::Lazy_VertexAttribI4sv;
+    OGLP_ENTRY (VertexAttribI4ubv) = internal::Lazy_VertexAttribI4ubv;
+    OGLP_ENTRY (VertexAttribI4usv) = internal::Lazy_VertexAttribI4usv;
+    OGLP_ENTRY (GetUniformuiv) = internal::Lazy_GetUniformuiv;
+    OGLP_ENTRY (BindFragDataLocation) = internal::Lazy_BindFragDataLocation;
+    OGLP_ENTRY (GetFragDataLocation) = internal::Lazy_GetFragDataLocation;
+    OGLP_ENTRY (Uniform1ui) = internal::Lazy_Uniform1ui;
+    OGLP_ENTRY (Uniform2ui) = internal::Lazy_Uniform2ui;
+    OGLP_ENTRY (Uniform3ui) = internal::Lazy_Uniform3ui;
+    OGLP_ENTRY (Uniform4ui) = internal::Lazy_Uniform4ui;
+    OGLP_ENTRY (Uniform1uiv) = internal::Lazy_Uniform1uiv;
+    OGLP_ENTRY (Uniform2uiv) = internal::Lazy_Uniform2uiv;
+    OGLP_ENTRY (Uniform3uiv) = internal::Lazy_Uniform3uiv;
+    OGLP_ENTRY (Uniform4uiv) = internal::Lazy_Uniform4uiv;
+    OGLP_ENTRY (TexParameterIiv) = internal::Lazy_TexParameterIiv;
+    OGLP_ENTRY (TexParameterIuiv) = internal::Lazy_TexParameterIuiv;
+    OGLP_ENTRY (GetTexParameterIiv) = internal::Lazy_GetTexParameterIiv;
+    OGLP_ENTRY (GetTexParameterIuiv) = internal::Lazy_GetTexParameterIuiv;
+    OGLP_ENTRY (ClearBufferiv) = internal::Lazy_ClearBufferiv;
+    OGLP_ENTRY (ClearBufferuiv) = internal::Lazy_ClearBufferuiv;
+    OGLP_ENTRY (ClearBufferfv) = internal::Lazy_ClearBufferfv;
+    OGLP_ENTRY (ClearBufferfi) = internal::Lazy_ClearBufferfi;
+    OGLP_ENTRY (GetStringi) = internal::Lazy_GetStringi;
+    OGLP_ENTRY (IsRenderbuffer) = internal::Lazy_IsRenderbuffer;
+    OGLP_ENTRY (BindRenderbuffer) = internal::Lazy_BindRenderbuffer;
+    OGLP_ENTRY (DeleteRenderbuffers) = internal::Lazy_DeleteRenderbuffers;
+    OGLP_ENTRY (GenRenderbuffers) = internal::Lazy_GenRenderbuffers;
+    OGLP_ENTRY (RenderbufferStorage) = internal::Lazy_RenderbufferStorage;
+    OGLP_ENTRY (GetRenderbufferParameteriv) = internal::Lazy_GetRenderbufferParameteriv;
+    OGLP_ENTRY (IsFramebuffer) = internal::Lazy_IsFramebuffer;
+    OGLP_ENTRY (BindFramebuffer) = internal::Lazy_BindFramebuffer;
+    OGLP_ENTRY (DeleteFramebuffers) = internal::Lazy_DeleteFramebuffers;
+    OGLP_ENTRY (GenFramebuffers) = internal::Lazy_GenFramebuffers;
+    OGLP_ENTRY (CheckFramebufferStatus) = internal::Lazy_CheckFramebufferStatus;
+    OGLP_ENTRY (FramebufferTexture1D) = internal::Lazy_FramebufferTexture1D;
+    OGLP_ENTRY (FramebufferTexture2D) = internal::Lazy_FramebufferTexture2D;
+    OGLP_ENTRY (FramebufferTexture3D) = internal::Lazy_FramebufferTexture3D;
+    OGLP_ENTRY (FramebufferRenderbuffer) = internal::Lazy_FramebufferRenderbuffer;
+    OGLP_ENTRY (GetFramebufferAttachmentParameteriv) = internal::Lazy_GetFramebufferAttachmentParameteriv;
+    OGLP_ENTRY (GenerateMipmap) = internal::Lazy_GenerateMipmap;
+    OGLP_ENTRY (BlitFramebuffer) = internal::Lazy_BlitFramebuffer;
+    OGLP_ENTRY (RenderbufferStorageMultisample) = internal::Lazy_RenderbufferStorageMultisample;
+    OGLP_ENTRY (FramebufferTextureLayer) = internal::Lazy_FramebufferTextureLayer;
+    OGLP_ENTRY (MapBufferRange) = internal::Lazy_MapBufferRange;
+    OGLP_ENTRY (FlushMappedBufferRange) = internal::Lazy_FlushMappedBufferRange;
+    OGLP_ENTRY (BindVertexArray) = internal::Lazy_BindVertexArray;
+    OGLP_ENTRY (DeleteVertexArrays) = internal::Lazy_DeleteVertexArrays;
+    OGLP_ENTRY (GenVertexArrays) = internal::Lazy_GenVertexArrays;
+    OGLP_ENTRY (IsVertexArray) = internal::Lazy_IsVertexArray;
+    OGLP_ENTRY (DrawArraysInstanced) = internal::Lazy_DrawArraysInstanced;
+    OGLP_ENTRY (DrawElementsInstanced) = internal::Lazy_DrawElementsInstanced;
+    OGLP_ENTRY (TexBuffer) = internal::Lazy_TexBuffer;
+    OGLP_ENTRY (PrimitiveRestartIndex) = internal::Lazy_PrimitiveRestartIndex;
+    OGLP_ENTRY (CopyBufferSubData) = internal::Lazy_CopyBufferSubData;
+    OGLP_ENTRY (GetUniformIndices) = internal::Lazy_GetUniformIndices;
+    OGLP_ENTRY (GetActiveUniformsiv) = internal::Lazy_GetActiveUniformsiv;
+    OGLP_ENTRY (GetActiveUniformName) = internal::Lazy_GetActiveUniformName;
+    OGLP_ENTRY (GetUniformBlockIndex) = internal::Lazy_GetUniformBlockIndex;
+    OGLP_ENTRY (GetActiveUniformBlockiv) = internal::Lazy_GetActiveUniformBlockiv;
+    OGLP_ENTRY (GetActiveUniformBlockName) = internal::Lazy_GetActiveUniformBlockName;
+    OGLP_ENTRY (UniformBlockBinding) = internal::Lazy_UniformBlockBinding;
+    OGLP_ENTRY (DrawElementsBaseVertex) = internal::Lazy_DrawElementsBaseVertex;
+    OGLP_ENTRY (DrawRangeElementsBaseVertex) = internal::Lazy_DrawRangeElementsBaseVertex;
+    OGLP_ENTRY (DrawElementsInstancedBaseVertex) = internal::Lazy_DrawElementsInstancedBaseVertex;
+    OGLP_ENTRY (MultiDrawElementsBaseVertex) = internal::Lazy_MultiDrawElementsBaseVertex;
+    OGLP_ENTRY (ProvokingVertex) = internal::Lazy_ProvokingVertex;
+    OGLP_ENTRY (FenceSync) = internal::Lazy_FenceSync;
+    OGLP_ENTRY (IsSync) = internal::Lazy_IsSync;
+    OGLP_ENTRY (DeleteSync) = internal::Lazy_DeleteSync;
+    OGLP_ENTRY (ClientWaitSync) = internal::Lazy_ClientWaitSync;
+    OGLP_ENTRY (WaitSync) = internal::Lazy_WaitSync;
+    OGLP_ENTRY (GetInteger64v) = internal::Lazy_GetInteger64v;
+    OGLP_ENTRY (GetSynciv) = internal::Lazy_GetSynciv;
+    OGLP_ENTRY (GetInteger64i_v) = internal::Lazy_GetInteger64i_v;
+    OGLP_ENTRY (GetBufferParameteri64v) = internal::Lazy_GetBufferParameteri64v;
+    OGLP_ENTRY (FramebufferTexture) = internal::Lazy_FramebufferTexture;
+    OGLP_ENTRY (TexImage2DMultisample) = internal::Lazy_TexImage2DMultisample;
+    OGLP_ENTRY (TexImage3DMultisample) = internal::Lazy_TexImage3DMultisample;
+    OGLP_ENTRY (GetMultisamplefv) = internal::Lazy_GetMultisamplefv;
+    OGLP_ENTRY (SampleMaski) = internal::Lazy_SampleMaski;
+    OGLP_ENTRY (BindFragDataLocationIndexed) = internal::Lazy_BindFragDataLocationIndexed;
+    OGLP_ENTRY (GetFragDataIndex) = internal::Lazy_GetFragDataIndex;
+    OGLP_ENTRY (GenSamplers) = internal::Lazy_GenSamplers;
+    OGLP_ENTRY (DeleteSamplers) = internal::Lazy_DeleteSamplers;
+    OGLP_ENTRY (IsSampler) = internal::Lazy_IsSampler;
+    OGLP_ENTRY (BindSampler) = internal::Lazy_BindSampler;
+    OGLP_ENTRY (SamplerParameteri) = internal::Lazy_SamplerParameteri;
+    OGLP_ENTRY (SamplerParameteriv) = internal::Lazy_SamplerParameteriv;
+    OGLP_ENTRY (SamplerParameterf) = internal::Lazy_SamplerParameterf;
+    OGLP_ENTRY (SamplerParameterfv) = internal::Lazy_SamplerParameterfv;
+    OGLP_ENTRY (SamplerParameterIiv) = internal::Lazy_SamplerParameterIiv;
+    OGLP_ENTRY (SamplerParameterIuiv) = internal::Lazy_SamplerParameterIuiv;
+    OGLP_ENTRY (GetSamplerParameteriv) = internal::Lazy_GetSamplerParameteriv;
+    OGLP_ENTRY (GetSamplerParameterIiv) = internal::Lazy_GetSamplerParameterIiv;
+    OGLP_ENTRY (GetSamplerParameterfv) = internal::Lazy_GetSamplerParameterfv;
+    OGLP_ENTRY (GetSamplerParameterIuiv) = internal::Lazy_GetSamplerParameterIuiv;
+    OGLP_ENTRY (QueryCounter) = internal::Lazy_QueryCounter;
+    OGLP_ENTRY (GetQueryObjecti64v) = internal::Lazy_GetQueryObjecti64v;
+    OGLP_ENTRY (GetQueryObjectui64v) = internal::Lazy_GetQueryObjectui64v;
+    OGLP_ENTRY (VertexAttribDivisor) = internal::Lazy_VertexAttribDivisor;
+    OGLP_ENTRY (VertexAttribP1ui) = internal::Lazy_VertexAttribP1ui;
+    OGLP_ENTRY (VertexAttribP1uiv) = internal::Lazy_VertexAttribP1uiv;
+    OGLP_ENTRY (VertexAttribP2ui) = internal::Lazy_VertexAttribP2ui;
+    OGLP_ENTRY (VertexAttribP2uiv) = internal::Lazy_VertexAttribP2uiv;
+    OGLP_ENTRY (VertexAttribP3ui) = internal::Lazy_VertexAttribP3ui;
+    OGLP_ENTRY (VertexAttribP3uiv) = internal::Lazy_VertexAttribP3uiv;
+    OGLP_ENTRY (VertexAttribP4ui) = internal::Lazy_VertexAttribP4ui;
+    OGLP_ENTRY (VertexAttribP4uiv) = internal::Lazy_VertexAttribP4uiv;
+    OGLP_ENTRY (MinSampleShading) = internal::Lazy_MinSampleShading;
+    OGLP_ENTRY (BlendEquationi) = internal::Lazy_BlendEquationi;
+    OGLP_ENTRY (BlendEquationSeparatei) = internal::Lazy_BlendEquationSeparatei;
+    OGLP_ENTRY (BlendFunci) = internal::Lazy_BlendFunci;
+    OGLP_ENTRY (BlendFuncSeparatei) = internal::Lazy_BlendFuncSeparatei;
+    OGLP_ENTRY (DrawArraysIndirect) = internal::Lazy_DrawArraysIndirect;
+    OGLP_ENTRY (DrawElementsIndirect) = internal::Lazy_DrawElementsIndirect;
+    OGLP_ENTRY (Uniform1d) = internal::Lazy_Uniform1d;
+    OGLP_ENTRY (Uniform2d) = internal::Lazy_Uniform2d;
+    OGLP_ENTRY (Uniform3d) = internal::Lazy_Uniform3d;
+    OGLP_ENTRY (Uniform4d) = internal::Lazy_Uniform4d;
+    OGLP_ENTRY (Uniform1dv) = internal::Lazy_Uniform1dv;
+    OGLP_ENTRY (Uniform2dv) = internal::Lazy_Uniform2dv;
+    OGLP_ENTRY (Uniform3dv) = internal::Lazy_Uniform3dv;
+    OGLP_ENTRY (Uniform4dv) = internal::Lazy_Uniform4dv;
+    OGLP_ENTRY (UniformMatrix2dv) = internal::Lazy_UniformMatrix2dv;
+    OGLP_ENTRY (UniformMatrix3dv) = internal::Lazy_UniformMatrix3dv;
+    OGLP_ENTRY (UniformMatrix4dv) = internal::Lazy_UniformMatrix4dv;
+    OGLP_ENTRY (UniformMatrix2x3dv) = internal::Lazy_UniformMatrix2x3dv;
+    OGLP_ENTRY (UniformMatrix2x4dv) = internal::Lazy_UniformMatrix2x4dv;
+    OGLP_ENTRY (UniformMatrix3x2dv) = internal::Lazy_UniformMatrix3x2dv;
+    OGLP_ENTRY (UniformMatrix3x4dv) = internal::Lazy_UniformMatrix3x4dv;
+    OGLP_ENTRY (UniformMatrix4x2dv) = internal::Lazy_UniformMatrix4x2dv;
+    OGLP_ENTRY (UniformMatrix4x3dv) = internal::Lazy_UniformMatrix4x3dv;
+    OGLP_ENTRY (GetUniformdv) = internal::Lazy_GetUniformdv;
+    OGLP_ENTRY (GetSubroutineUniformLocation) = internal::Lazy_GetSubroutineUniformLocation;
+    OGLP_ENTRY (GetSubroutineIndex) = internal::Lazy_GetSubroutineIndex;
+    OGLP_ENTRY (GetActiveSubroutineUniformiv) = internal::Lazy_GetActiveSubroutineUniformiv;
+    OGLP_ENTRY (GetActiveSubroutineUniformName) = internal::Lazy_GetActiveSubroutineUniformName;
+    OGLP_ENTRY (GetActiveSubroutineName) = internal::Lazy_GetActiveSubroutineName;
+    OGLP_ENTRY (UniformSubroutinesuiv) = internal::Lazy_UniformSubroutinesuiv;
+    OGLP_ENTRY (GetUniformSubroutineuiv) = internal::Lazy_GetUniformSubroutineuiv;
+    OGLP_ENTRY (GetProgramStageiv) = internal::Lazy_GetProgramStageiv;
+    OGLP_ENTRY (PatchParameteri) = internal::Lazy_PatchParameteri;
+    OGLP_ENTRY (PatchParameterfv) = internal::Lazy_PatchParameterfv;
+    OGLP_ENTRY (BindTransformFeedback) = internal::Lazy_BindTransformFeedback;
+    OGLP_ENTRY (DeleteTransformFeedbacks) = internal::Lazy_DeleteTransformFeedbacks;
+    OGLP_ENTRY (GenTransformFeedbacks) = internal::Lazy_GenTransformFeedbacks;
+    OGLP_ENTRY (IsTransformFeedback) = internal::Lazy_IsTransformFeedback;
+    OGLP_ENTRY (PauseTransformFeedback) = internal::Lazy_PauseTransformFeedback;
+    OGLP_ENTRY (ResumeTransformFeedback) = internal::Lazy_ResumeTransformFeedback;
+    OGLP_ENTRY (DrawTransformFeedback) = internal::Lazy_DrawTransformFeedback;
+    OGLP_ENTRY (DrawTransformFeedbackStream) = internal::Lazy_DrawTransformFeedbackStream;
+    OGLP_ENTRY (BeginQueryIndexed) = internal::Lazy_BeginQueryIndexed;
+    OGLP_ENTRY (EndQueryIndexed) = internal::Lazy_EndQueryIndexed;
+    OGLP_ENTRY (GetQueryIndexediv) = internal::Lazy_GetQueryIndexediv;
+    OGLP_ENTRY (ReleaseShaderCompiler) = internal::Lazy_ReleaseShaderCompiler;
+    OGLP_ENTRY (ShaderBinary) = internal::Lazy_ShaderBinary;
+    OGLP_ENTRY (GetShaderPrecisionFormat) = internal::Lazy_GetShaderPrecisionFormat;
+    OGLP_ENTRY (DepthRangef) = internal::Lazy_DepthRangef;
+    OGLP_ENTRY (ClearDepthf) = internal::Lazy_ClearDepthf;
+    OGLP_ENTRY (GetProgramBinary) = internal::Lazy_GetProgramBinary;
+    OGLP_ENTRY (ProgramBinary) = internal::Lazy_ProgramBinary;
+    OGLP_ENTRY (ProgramParameteri) = internal::Lazy_ProgramParameteri;
+    OGLP_ENTRY (UseProgramStages) = internal::Lazy_UseProgramStages;
+    OGLP_ENTRY (ActiveShaderProgram) = internal::Lazy_ActiveShaderProgram;
+    OGLP_ENTRY (CreateShaderProgramv) = internal::Lazy_CreateShaderProgramv;
+    OGLP_ENTRY (BindProgramPipeline) = internal::Lazy_BindProgramPipeline;
+    OGLP_ENTRY (DeleteProgramPipelines) = internal::Lazy_DeleteProgramPipelines;
+    OGLP_ENTRY (GenProgramPipelines) = internal::Lazy_GenProgramPipelines;
+    OGLP_ENTRY (IsProgramPipeline) = internal::Lazy_IsProgramPipeline;
+    OGLP_ENTRY (GetProgramPipelineiv) = internal::Lazy_GetProgramPipelineiv;
+    OGLP_ENTRY (ProgramUniform1i) = internal::Lazy_ProgramUniform1i;
+    OGLP_ENTRY (ProgramUniform1iv) = internal::Lazy_ProgramUniform1iv;
+    OGLP_ENTRY (ProgramUniform1f) = internal::Lazy_ProgramUniform1f;
+    OGLP_ENTRY (ProgramUniform1fv) = internal::Lazy_ProgramUniform1fv;
+    OGLP_ENTRY (ProgramUniform1d) = internal::Lazy_ProgramUniform1d;
+    OGLP_ENTRY (ProgramUniform1dv) = internal::Lazy_ProgramUniform1dv;
+    OGLP_ENTRY (ProgramUniform1ui) = internal::Lazy_ProgramUniform1ui;
+    OGLP_ENTRY (ProgramUniform1uiv) = internal::Lazy_ProgramUniform1uiv;
+    OGLP_ENTRY (ProgramUniform2i) = internal::Lazy_ProgramUniform2i;
+    OGLP_ENTRY (ProgramUniform2iv) = internal::Lazy_ProgramUniform2iv;
+    OGLP_ENTRY (ProgramUniform2f) = internal::Lazy_ProgramUniform2f;
+    OGLP_ENTRY (ProgramUniform2fv) = internal::Lazy_ProgramUniform2fv;
+    OGLP_ENTRY (ProgramUniform2d) = internal::Lazy_ProgramUniform2d;
+    OGLP_ENTRY (ProgramUniform2dv) = internal::Lazy_ProgramUniform2dv;
+    OGLP_ENTRY (ProgramUniform2ui) = internal::Lazy_ProgramUniform2ui;
+    OGLP_ENTRY (ProgramUniform2uiv) = internal::Lazy_ProgramUniform2uiv;
+    OGLP_ENTRY (ProgramUniform3i) = internal::Lazy_ProgramUniform3i;
+    OGLP_ENTRY (ProgramUniform3iv) = internal::Lazy_ProgramUniform3iv;
+    OGLP_ENTRY (ProgramUniform3f) = internal::Lazy_ProgramUniform3f;
+    OGLP_ENTRY (ProgramUniform3fv) = internal::Lazy_ProgramUniform3fv;
+    OGLP_ENTRY (ProgramUniform3d) = internal::Lazy_ProgramUniform3d;
+    OGLP_ENTRY (ProgramUniform3dv) = internal::Lazy_ProgramUniform3dv;
+    OGLP_ENTRY (ProgramUniform3ui) = internal::Lazy_ProgramUniform3ui;
+    OGLP_ENTRY (ProgramUniform3uiv) = internal::Lazy_ProgramUniform3uiv;
+    OGLP_ENTRY (ProgramUniform4i) = internal::Lazy_ProgramUniform4i;
+    OGLP_ENTRY (ProgramUniform4iv) = internal::Lazy_ProgramUniform4iv;
+    OGLP_ENTRY (ProgramUniform4f) = internal::Lazy_ProgramUniform4f;
+    OGLP_ENTRY (ProgramUniform4fv) = internal::Lazy_ProgramUniform4fv;
+    OGLP_ENTRY (ProgramUniform4d) = internal::Lazy_ProgramUniform4d;
+    OGLP_ENTRY (ProgramUniform4dv) = internal::Lazy_ProgramUniform4dv;
+    OGLP_ENTRY (ProgramUniform4ui) = internal::Lazy_ProgramUniform4ui;
+    OGLP_ENTRY (ProgramUniform4uiv) = internal::Lazy_ProgramUniform4uiv;
+    OGLP_ENTRY (ProgramUniformMatrix2fv) = internal::Lazy_ProgramUniformMatrix2fv;
+    OGLP_ENTRY (ProgramUniformMatrix3fv) = internal::Lazy_ProgramUniformMatrix3fv;
+    OGLP_ENTRY (ProgramUniformMatrix4fv) = internal::Lazy_ProgramUniformMatrix4fv;
+    OGLP_ENTRY (ProgramUniformMatrix2dv) = internal::Lazy_ProgramUniformMatrix2dv;
+    OGLP_ENTRY (ProgramUniformMatrix3dv) = internal::Lazy_ProgramUniformMatrix3dv;
+    OGLP_ENTRY (ProgramUniformMatrix4dv) = internal::Lazy_ProgramUniformMatrix4dv;
+    OGLP_ENTRY (ProgramUniformMatrix2x3fv) = internal::Lazy_ProgramUniformMatrix2x3fv;
+    OGLP_ENTRY (ProgramUniformMatrix3x2fv) = internal::Lazy_ProgramUniformMatrix3x2fv;
+    OGLP_ENTRY (ProgramUniformMatrix2x4fv) = internal::Lazy_ProgramUniformMatrix2x4fv;
+    OGLP_ENTRY (ProgramUniformMatrix4x2fv) = internal::Lazy_ProgramUniformMatrix4x2fv;
+    OGLP_ENTRY (ProgramUniformMatrix3x4fv) = internal::Lazy_ProgramUniformMatrix3x4fv;
+    OGLP_ENTRY (ProgramUniformMatrix4x3fv) = internal::Lazy_ProgramUniformMatrix4x3fv;
+    OGLP_ENTRY (ProgramUniformMatrix2x3dv) = internal::Lazy_ProgramUniformMatrix2x3dv;
+    OGLP_ENTRY (ProgramUniformMatrix3x2dv) = internal::Lazy_ProgramUniformMatrix3x2dv;
+    OGLP_ENTRY (ProgramUniformMatrix2x4dv) = internal::Lazy_ProgramUniformMatrix2x4dv;
+    OGLP_ENTRY (ProgramUniformMatrix4x2dv) = internal::Lazy_ProgramUniformMatrix4x2dv;
+    OGLP_ENTRY (ProgramUniformMatrix3x4dv) = internal::Lazy_ProgramUniformMatrix3x4dv;
+    OGLP_ENTRY (ProgramUniformMatrix4x3dv) = internal::Lazy_ProgramUniformMatrix4x3dv;
+    OGLP_ENTRY (ValidateProgramPipeline) = internal::Lazy_ValidateProgramPipeline;
+    OGLP_ENTRY (GetProgramPipelineInfoLog) = internal::Lazy_GetProgramPipelineInfoLog;
+    OGLP_ENTRY (VertexAttribL1d) = internal::Lazy_VertexAttribL1d;
+    OGLP_ENTRY (VertexAttribL2d) = internal::Lazy_VertexAttribL2d;
+    OGLP_ENTRY (VertexAttribL3d) = internal::Lazy_VertexAttribL3d;
+    OGLP_ENTRY (VertexAttribL4d) = internal::Lazy_VertexAttribL4d;
+    OGLP_ENTRY (VertexAttribL1dv) = internal::Lazy_VertexAttribL1dv;
+    OGLP_ENTRY (VertexAttribL2dv) = internal::Lazy_VertexAttribL2dv;
+    OGLP_ENTRY (VertexAttribL3dv) = internal::Lazy_VertexAttribL3dv;
+    OGLP_ENTRY (VertexAttribL4dv) = internal::Lazy_VertexAttribL4dv;
+    OGLP_ENTRY (VertexAttribLPointer) = internal::Lazy_VertexAttribLPointer;
+    OGLP_ENTRY (GetVertexAttribLdv) = internal::Lazy_GetVertexAttribLdv;
+    OGLP_ENTRY (ViewportArrayv) = internal::Lazy_ViewportArrayv;
+    OGLP_ENTRY (ViewportIndexedf) = internal::Lazy_ViewportIndexedf;
+    OGLP_ENTRY (ViewportIndexedfv) = internal::Lazy_ViewportIndexedfv;
+    OGLP_ENTRY (ScissorArrayv) = internal::Lazy_ScissorArrayv;
+    OGLP_ENTRY (ScissorIndexed) = internal::Lazy_ScissorIndexed;
+    OGLP_ENTRY (ScissorIndexedv) = internal::Lazy_ScissorIndexedv;
+    OGLP_ENTRY (DepthRangeArrayv) = internal::Lazy_DepthRangeArrayv;
+    OGLP_ENTRY (DepthRangeIndexed) = internal::Lazy_DepthRangeIndexed;
+    OGLP_ENTRY (GetFloati_v) = internal::Lazy_GetFloati_v;
+    OGLP_ENTRY (GetDoublei_v) = internal::Lazy_GetDoublei_v;
+    OGLP_ENTRY (DrawArraysInstancedBaseInstance) = internal::Lazy_DrawArraysInstancedBaseInstance;
+    OGLP_ENTRY (DrawElementsInstancedBaseInstance) = internal::Lazy_DrawElementsInstancedBaseInstance;
+    OGLP_ENTRY (DrawElementsInstancedBaseVertexBaseInstance) = internal::Lazy_DrawElementsInstancedBaseVertexBaseInstance;
+    OGLP_ENTRY (GetInternalformativ) = internal::Lazy_GetInternalformativ;
+    OGLP_ENTRY (GetActiveAtomicCounterBufferiv) = internal::Lazy_GetActiveAtomicCounterBufferiv;
+    OGLP_ENTRY (BindImageTexture) = internal::Lazy_BindImageTexture;
+    OGLP_ENTRY (MemoryBarrier) = internal::Lazy_MemoryBarrier;
+    OGLP_ENTRY (TexStorage1D) = internal::Lazy_TexStorage1D;
+    OGLP_ENTRY (TexStorage2D) = internal::Lazy_TexStorage2D;
+    OGLP_ENTRY (TexStorage3D) = internal::Lazy_TexStorage3D;
+    OGLP_ENTRY (DrawTransformFeedbackInstanced) = internal::Lazy_DrawTransformFeedbackInstanced;
+    OGLP_ENTRY (DrawTransformFeedbackStreamInstanced) = internal::Lazy_DrawTransformFeedbackStreamInstanced;
+    OGLP_ENTRY (ClearBufferData) = internal::Lazy_ClearBufferData;
+    OGLP_ENTRY (ClearBufferSubData) = internal::Lazy_ClearBufferSubData;
+    OGLP_ENTRY (DispatchCompute) = internal::Lazy_DispatchCompute;
+    OGLP_ENTRY (DispatchComputeIndirect) = internal::Lazy_DispatchComputeIndirect;
+    OGLP_ENTRY (CopyImageSubData) = internal::Lazy_CopyImageSubData;
+    OGLP_ENTRY (FramebufferParameteri) = internal::Lazy_FramebufferParameteri;
+    OGLP_ENTRY (GetFramebufferParameteriv) = internal::Lazy_GetFramebufferParameteriv;
+    OGLP_ENTRY (GetInternalformati64v) = internal::Lazy_GetInternalformati64v;
+    OGLP_ENTRY (InvalidateTexSubImage) = internal::Lazy_InvalidateTexSubImage;
+    OGLP_ENTRY (InvalidateTexImage) = internal::Lazy_InvalidateTexImage;
+    OGLP_ENTRY (InvalidateBufferSubData) = internal::Lazy_InvalidateBufferSubData;
+    OGLP_ENTRY (InvalidateBufferData) = internal::Lazy_InvalidateBufferData;
+    OGLP_ENTRY (InvalidateFramebuffer) = internal::Lazy_InvalidateFramebuffer;
+    OGLP_ENTRY (InvalidateSubFramebuffer) = internal::Lazy_InvalidateSubFramebuffer;
+    OGLP_ENTRY (MultiDrawArraysIndirect) = internal::Lazy_MultiDrawArraysIndirect;
+    OGLP_ENTRY (MultiDrawElementsIndirect) = internal::Lazy_MultiDrawElementsIndirect;
+    OGLP_ENTRY (GetProgramInterfaceiv) = internal::Lazy_GetProgramInterfaceiv;
+    OGLP_ENTRY (GetProgramResourceIndex) = internal::Lazy_GetProgramResourceIndex;
+    OGLP_ENTRY (GetProgramResourceName) = internal::Lazy_GetProgramResourceName;
+    OGLP_ENTRY (GetProgramResourceiv) = internal::Lazy_GetProgramResourceiv;
+    OGLP_ENTRY (GetProgramResourceLocation) = internal::Lazy_GetProgramResourceLocation;
+    OGLP_ENTRY (GetProgramResourceLocationIndex) = internal::Lazy_GetProgramResourceLocationIndex;
+    OGLP_ENTRY (ShaderStorageBlockBinding) = internal::Lazy_ShaderStorageBlockBinding;
+    OGLP_ENTRY (TexBufferRange) = internal::Lazy_TexBufferRange;
+    OGLP_ENTRY (TexStorage2DMultisample) = internal::Lazy_TexStorage2DMultisample;
+    OGLP_ENTRY (TexStorage3DMultisample) = internal::Lazy_TexStorage3DMultisample;
+    OGLP_ENTRY (TextureView) = internal::Lazy_TextureView;
+    OGLP_ENTRY (BindVertexBuffer) = internal::Lazy_BindVertexBuffer;
+    OGLP_ENTRY (VertexAttribFormat) = internal::Lazy_VertexAttribFormat;
+    OGLP_ENTRY (VertexAttribIFormat) = internal::Lazy_VertexAttribIFormat;
+    OGLP_ENTRY (VertexAttribLFormat) = internal::Lazy_VertexAttribLFormat;
+    OGLP_ENTRY (VertexAttribBinding) = internal::Lazy_VertexAttribBinding;
+    OGLP_ENTRY (VertexBindingDivisor) = internal::Lazy_VertexBindingDivisor;
+    OGLP_ENTRY (DebugMessageControl) = internal::Lazy_DebugMessageControl;
+    OGLP_ENTRY (DebugMessageInsert) = internal::Lazy_DebugMessageInsert;
+    OGLP_ENTRY (DebugMessageCallback) = internal::Lazy_DebugMessageCallback;
+    OGLP_ENTRY (GetDebugMessageLog) = internal::Lazy_GetDebugMessageLog;
+    OGLP_ENTRY (PushDebugGroup) = internal::Lazy_PushDebugGroup;
+    OGLP_ENTRY (PopDebugGroup) = internal::Lazy_PopDebugGroup;
+    OGLP_ENTRY (ObjectLabel) = internal::Lazy_ObjectLabel;
+    OGLP_ENTRY (GetObjectLabel) = internal::Lazy_GetObjectLabel;
+    OGLP_ENTRY (ObjectPtrLabel) = internal::Lazy_ObjectPtrLabel;
+    OGLP_ENTRY (GetObjectPtrLabel) = internal::Lazy_GetObjectPtrLabel;
+    OGLP_ENTRY (BufferStorage) = internal::Lazy_BufferStorage;
+    OGLP_ENTRY (ClearTexImage) = internal::Lazy_ClearTexImage;
+    OGLP_ENTRY (ClearTexSubImage) = internal::Lazy_ClearTexSubImage;
+    OGLP_ENTRY (BindBuffersBase) = internal::Lazy_BindBuffersBase;
+    OGLP_ENTRY (BindBuffersRange) = internal::Lazy_BindBuffersRange;
+    OGLP_ENTRY (BindTextures) = internal::Lazy_BindTextures;
+    OGLP_ENTRY (BindSamplers) = internal::Lazy_BindSamplers;
+    OGLP_ENTRY (BindImageTextures) = internal::Lazy_BindImageTextures;
+    OGLP_ENTRY (BindVertexBuffers) = internal::Lazy_BindVertexBuffers;
+    OGLP_ENTRY (ClipControl) = internal::Lazy_ClipControl;
+    OGLP_ENTRY (CreateTransformFeedbacks) = internal::Lazy_CreateTransformFeedbacks;
+    OGLP_ENTRY (TransformFeedbackBufferBase) = internal::Lazy_TransformFeedbackBufferBase;
+    OGLP_ENTRY (TransformFeedbackBufferRange) = internal::Lazy_TransformFeedbackBufferRange;
+    OGLP_ENTRY (GetTransformFeedbackiv) = internal::Lazy_GetTransformFeedbackiv;
+    OGLP_ENTRY (GetTransformFeedbacki_v) = internal::Lazy_GetTransformFeedbacki_v;
+    OGLP_ENTRY (GetTransformFeedbacki64_v) = internal::Lazy_GetTransformFeedbacki64_v;
+    OGLP_ENTRY (CreateBuffers) = internal::Lazy_CreateBuffers;
+    OGLP_ENTRY (NamedBufferStorage) = internal::Lazy_NamedBufferStorage;
+    OGLP_ENTRY (NamedBufferData) = internal::Lazy_NamedBufferData;
+    OGLP_ENTRY (NamedBufferSubData) = internal::Lazy_NamedBufferSubData;
+    OGLP_ENTRY (CopyNamedBufferSubData) = internal::Lazy_CopyNamedBufferSubData;
+    OGLP_ENTRY (ClearNamedBufferData) = internal::Lazy_ClearNamedBufferData;
+    OGLP_ENTRY (ClearNamedBufferSubData) = internal::Lazy_ClearNamedBufferSubData;
+    OGLP_ENTRY (MapNamedBuffer) = internal::Lazy_MapNamedBuffer;
+    OGLP_ENTRY (MapNamedBufferRange) = internal::Lazy_MapNamedBufferRange;
+    OGLP_ENTRY (UnmapNamedBuffer) = internal::Lazy_UnmapNamedBuffer;
+    OGLP_ENTRY (FlushMappedNamedBufferRange) = internal::Lazy_FlushMappedNamedBufferRange;
+    OGLP_ENTRY (GetNamedBufferParameteriv) = internal::Lazy_GetNamedBufferParameteriv;
+    OGLP_ENTRY (GetNamedBufferParameteri64v) = internal::Lazy_GetNamedBufferParameteri64v;
+    OGLP_ENTRY (GetNamedBufferPointerv) = internal::Lazy_GetNamedBufferPointerv;
+    OGLP_ENTRY (GetNamedBufferSubData) = internal::Lazy_GetNamedBufferSubData;
+    OGLP_ENTRY (CreateFramebuffers) = internal::Lazy_CreateFramebuffers;
+    OGLP_ENTRY (NamedFramebufferRenderbuffer) = internal::Lazy_NamedFramebufferRenderbuffer;
+    OGLP_ENTRY (NamedFramebufferParameteri) = internal::Lazy_NamedFramebufferParameteri;
+    OGLP_ENTRY (NamedFramebufferTexture) = internal::Lazy_NamedFramebufferTexture;
+    OGLP_ENTRY (NamedFramebufferTextureLayer) = internal::Lazy_NamedFramebufferTextureLayer;
+    OGLP_ENTRY (NamedFramebufferDrawBuffer) = internal::Lazy_NamedFramebufferDrawBuffer;
+    OGLP_ENTRY (NamedFramebufferDrawBuffers) = internal::Lazy_NamedFramebufferDrawBuffers;
+    OGLP_ENTRY (NamedFramebufferReadBuffer) = internal::Lazy_NamedFramebufferReadBuffer;
+    OGLP_ENTRY (InvalidateNamedFramebufferData) = internal::Lazy_InvalidateNamedFramebufferData;
+    OGLP_ENTRY (InvalidateNamedFramebufferSubData) = internal::Lazy_InvalidateNamedFramebufferSubData;
+    OGLP_ENTRY (ClearNamedFramebufferiv) = internal::Lazy_ClearNamedFramebufferiv;
+    OGLP_ENTRY (ClearNamedFramebufferuiv) = internal::Lazy_ClearNamedFramebufferuiv;
+    OGLP_ENTRY (ClearNamedFramebufferfv) = internal::Lazy_ClearNamedFramebufferfv;
+    OGLP_ENTRY (ClearNamedFramebufferfi) = internal::Lazy_ClearNamedFramebufferfi;
+    OGLP_ENTRY (BlitNamedFramebuffer) = internal::Lazy_BlitNamedFramebuffer;
+    OGLP_ENTRY (CheckNamedFramebufferStatus) = internal::Lazy_CheckNamedFramebufferStatus;
+    OGLP_ENTRY (GetNamedFramebufferParameteriv) = internal::Lazy_GetNamedFramebufferParameteriv;
+    OGLP_ENTRY (GetNamedFramebufferAttachmentParameteriv) = internal::Lazy_GetNamedFramebufferAttachmentParameteriv;
+    OGLP_ENTRY (CreateRenderbuffers) = internal::Lazy_CreateRenderbuffers;
+    OGLP_ENTRY (NamedRenderbufferStorage) = internal::Lazy_NamedRenderbufferStorage;
+    OGLP_ENTRY (NamedRenderbufferStorageMultisample) = internal::Lazy_NamedRenderbufferStorageMultisample;
+    OGLP_ENTRY (GetNamedRenderbufferParameteriv) = internal::Lazy_GetNamedRenderbufferParameteriv;
+    OGLP_ENTRY (CreateTextures) = internal::Lazy_CreateTextures;
+    OGLP_ENTRY (TextureBuffer) = internal::Lazy_TextureBuffer;
+    OGLP_ENTRY (TextureBufferRange) = internal::Lazy_TextureBufferRange;
+    OGLP_ENTRY (TextureStorage1D) = internal::Lazy_TextureStorage1D;
+    OGLP_ENTRY (TextureStorage2D) = internal::Lazy_TextureStorage2D;
+    OGLP_ENTRY (TextureStorage3D) = internal::Lazy_TextureStorage3D;
+    OGLP_ENTRY (TextureStorage2DMultisample) = internal::Lazy_TextureStorage2DMultisample;
+    OGLP_ENTRY (TextureStorage3DMultisample) = internal::Lazy_TextureStorage3DMultisample;
+    OGLP_ENTRY (TextureSubImage1D) = internal::Lazy_TextureSubImage1D;
+    OGLP_ENTRY (TextureSubImage2D) = internal::Lazy_TextureSubImage2D;
+    OGLP_ENTRY (TextureSubImage3D) = internal::Lazy_TextureSubImage3D;
+    OGLP_ENTRY (CompressedTextureSubImage1D) = internal::Lazy_CompressedTextureSubImage1D;
+    OGLP_ENTRY (CompressedTextureSubImage2D) = internal::Lazy_CompressedTextureSubImage2D;
+    OGLP_ENTRY (CompressedTextureSubImage3D) = internal::Lazy_CompressedTextureSubImage3D;
+    OGLP_ENTRY (CopyTextureSubImage1D) = internal::Lazy_CopyTextureSubImage1D;
+    OGLP_ENTRY (CopyTextureSubImage2D) = internal::Lazy_CopyTextureSubImage2D;
+    OGLP_ENTRY (CopyTextureSubImage3D) = internal::Lazy_CopyTextureSubImage3D;
+    OGLP_ENTRY (TextureParameterf) = internal::Lazy_TextureParameterf;
+    OGLP_ENTRY (TextureParameterfv) = internal::Lazy_TextureParameterfv;
+    OGLP_ENTRY (TextureParameteri) = internal::Lazy_TextureParameteri;
+    OGLP_ENTRY (TextureParameterIiv) = internal::Lazy_TextureParameterIiv;
+    OGLP_ENTRY (TextureParameterIuiv) = internal::Lazy_TextureParameterIuiv;
+    OGLP_ENTRY (TextureParameteriv) = internal::Lazy_TextureParameteriv;
+    OGLP_ENTRY (GenerateTextureMipmap) = internal::Lazy_GenerateTextureMipmap;
+    OGLP_ENTRY (BindTextureUnit) = internal::Lazy_BindTextureUnit;
+    OGLP_ENTRY (GetTextureImage) = internal::Lazy_GetTextureImage;
+    OGLP_ENTRY (GetCompressedTextureImage) = internal::Lazy_GetCompressedTextureImage;
+    OGLP_ENTRY (GetTextureLevelParameterfv) = internal::Lazy_GetTextureLevelParameterfv;
+    OGLP_ENTRY (GetTextureLevelParameteriv) = internal::Lazy_GetTextureLevelParameteriv;
+    OGLP_ENTRY (GetTextureParameterfv) = internal::Lazy_GetTextureParameterfv;
+    OGLP_ENTRY (GetTextureParameterIiv) = internal::Lazy_GetTextureParameterIiv;
+    OGLP_ENTRY (GetTextureParameterIuiv) = internal::Lazy_GetTextureParameterIuiv;
+    OGLP_ENTRY (GetTextureParameteriv) = internal::Lazy_GetTextureParameteriv;
+    OGLP_ENTRY (CreateVertexArrays) = internal::Lazy_CreateVertexArrays;
+    OGLP_ENTRY (DisableVertexArrayAttrib) = internal::Lazy_DisableVertexArrayAttrib;
+    OGLP_ENTRY (EnableVertexArrayAttrib) = internal::Lazy_EnableVertexArrayAttrib;
+    OGLP_ENTRY (VertexArrayElementBuffer) = internal::Lazy_VertexArrayElementBuffer;
+    OGLP_ENTRY (VertexArrayVertexBuffer) = internal::Lazy_VertexArrayVertexBuffer;
+    OGLP_ENTRY (VertexArrayVertexBuffers) = internal::Lazy_VertexArrayVertexBuffers;
+    OGLP_ENTRY (VertexArrayAttribBinding) = internal::Lazy_VertexArrayAttribBinding;
+    OGLP_ENTRY (VertexArrayAttribFormat) = internal::Lazy_VertexArrayAttribFormat;
+    OGLP_ENTRY (VertexArrayAttribIFormat) = internal::Lazy_VertexArrayAttribIFormat;
+    OGLP_ENTRY (VertexArrayAttribLFormat) = internal::Lazy_VertexArrayAttribLFormat;
+    OGLP_ENTRY (VertexArrayBindingDivisor) = internal::Lazy_VertexArrayBindingDivisor;
+    OGLP_ENTRY (GetVertexArrayiv) = internal::Lazy_GetVertexArrayiv;
+    OGLP_ENTRY (GetVertexArrayIndexediv) = internal::Lazy_GetVertexArrayIndexediv;
+    OGLP_ENTRY (GetVertexArrayIndexed64iv) = internal::Lazy_GetVertexArrayIndexed64iv;
+    OGLP_ENTRY (CreateSamplers) = internal::Lazy_CreateSamplers;
+    OGLP_ENTRY (CreateProgramPipelines) = internal::Lazy_CreateProgramPipelines;
+    OGLP_ENTRY (CreateQueries) = internal::Lazy_CreateQueries;
+    OGLP_ENTRY (GetQueryBufferObjecti64v) = internal::Lazy_GetQueryBufferObjecti64v;
+    OGLP_ENTRY (GetQueryBufferObjectiv) = internal::Lazy_GetQueryBufferObjectiv;
+    OGLP_ENTRY (GetQueryBufferObjectui64v) = internal::Lazy_GetQueryBufferObjectui64v;
+    OGLP_ENTRY (GetQueryBufferObjectuiv) = internal::Lazy_GetQueryBufferObjectuiv;
+    OGLP_ENTRY (MemoryBarrierByRegion) = internal::Lazy_MemoryBarrierByRegion;
+    OGLP_ENTRY (GetTextureSubImage) = internal::Lazy_GetTextureSubImage;
+    OGLP_ENTRY (GetCompressedTextureSubImage) = internal::Lazy_GetCompressedTextureSubImage;
+    OGLP_ENTRY (GetGraphicsResetStatus) = internal::Lazy_GetGraphicsResetStatus;
+    OGLP_ENTRY (GetnCompressedTexImage) = internal::Lazy_GetnCompressedTexImage;
+    OGLP_ENTRY (GetnTexImage) = internal::Lazy_GetnTexImage;
+    OGLP_ENTRY (GetnUniformdv) = internal::Lazy_GetnUniformdv;
+    OGLP_ENTRY (GetnUniformfv) = internal::Lazy_GetnUniformfv;
+    OGLP_ENTRY (GetnUniformiv) = internal::Lazy_GetnUniformiv;
+    OGLP_ENTRY (GetnUniformuiv) = internal::Lazy_GetnUniformuiv;
+    OGLP_ENTRY (ReadnPixels) = internal::Lazy_ReadnPixels;
+    OGLP_ENTRY (TextureBarrier) = internal::Lazy_TextureBarrier;
+#endif /* !defined OGLP_DIRECT_LINK */
+    OGLP_ENTRY (GetTextureHandleARB) = internal::Lazy_GetTextureHandleARB;
+    OGLP_ENTRY (GetTextureSamplerHandleARB) = internal::Lazy_GetTextureSamplerHandleARB;
+    OGLP_ENTRY (MakeTextureHandleResidentARB) = internal::Lazy_MakeTextureHandleResidentARB;
+    OGLP_ENTRY (MakeTextureHandleNonResidentARB) = internal::Lazy_MakeTextureHandleNonResidentARB;
+    OGLP_ENTRY (GetImageHandleARB) = internal::Lazy_GetImageHandleARB;
+    OGLP_ENTRY (MakeImageHandleResidentARB) = internal::Lazy_MakeImageHandleResidentARB;
+    OGLP_ENTRY (MakeImageHandleNonResidentARB) = internal::Lazy_MakeImageHandleNonResidentARB;
+    OGLP_ENTRY (UniformHandleui64ARB) = internal::Lazy_UniformHandleui64ARB;
+    OGLP_ENTRY (UniformHandleui64vARB) = internal::Lazy_UniformHandleui64vARB;
+    OGLP_ENTRY (ProgramUniformHandleui64ARB) = internal::Lazy_ProgramUniformHandleui64ARB;
+    OGLP_ENTRY (ProgramUniformHandleui64vARB) = internal::Lazy_ProgramUniformHandleui64vARB;
+    OGLP_ENTRY (IsTextureHandleResidentARB) = internal::Lazy_IsTextureHandleResidentARB;
+    OGLP_ENTRY (IsImageHandleResidentARB) = internal::Lazy_IsImageHandleResidentARB;
+    OGLP_ENTRY (VertexAttribL1ui64ARB) = internal::Lazy_VertexAttribL1ui64ARB;
+    OGLP_ENTRY (VertexAttribL1ui64vARB) = internal::Lazy_VertexAttribL1ui64vARB;
+    OGLP_ENTRY (GetVertexAttribLui64vARB) = internal::Lazy_GetVertexAttribLui64vARB;
+    OGLP_ENTRY (CreateSyncFromCLeventARB) = internal::Lazy_CreateSyncFromCLeventARB;
+    OGLP_ENTRY (DispatchComputeGroupSizeARB) = internal::Lazy_DispatchComputeGroupSizeARB;
+    OGLP_ENTRY (DebugMessageControlARB) = internal::Lazy_DebugMessageControlARB;
+    OGLP_ENTRY (DebugMessageInsertARB) = internal::Lazy_DebugMessageInsertARB;
+    OGLP_ENTRY (DebugMessageCallbackARB) = internal::Lazy_DebugMessageCallbackARB;
+    OGLP_ENTRY (GetDebugMessageLogARB) = internal::Lazy_GetDebugMessageLogARB;
+    OGLP_ENTRY (BlendEquationiARB) = internal::Lazy_BlendEquationiARB;
+    OGLP_ENTRY (BlendEquationSeparateiARB) = internal::Lazy_BlendEquationSeparateiARB;
+    OGLP_ENTRY (BlendFunciARB) = internal::Lazy_BlendFunciARB;
+    OGLP_ENTRY (BlendFuncSeparateiARB) = internal::Lazy_BlendFuncSeparateiARB;
+    OGLP_ENTRY (MultiDrawArraysIndirectCountARB) = internal::Lazy_MultiDrawArraysIndirectCountARB;
+    OGLP_ENTRY (MultiDrawElementsIndirectCountARB) = internal::Lazy_MultiDrawElementsIndirectCountARB;
+    OGLP_ENTRY (GetGraphicsResetStatusARB) = internal::Lazy_GetGraphicsResetStatusARB;
+    OGLP_ENTRY (GetnTexImageARB) = internal::Lazy_GetnTexImageARB;
+    OGLP_ENTRY (ReadnPixelsARB) = internal::Lazy_ReadnPixelsARB;
+    OGLP_ENTRY (GetnCompressedTexImageARB) = internal::Lazy_GetnCompressedTexImageARB;
+    OGLP_ENTRY (GetnUniformfvARB) = internal::Lazy_GetnUniformfvARB;
+    OGLP_ENTRY (GetnUniformivARB) = internal::Lazy_GetnUniformivARB;
+    OGLP_ENTRY (GetnUniformuivARB) = internal::Lazy_GetnUniformuivARB;
+    OGLP_ENTRY (GetnUniformdvARB) = internal::Lazy_GetnUniformdvARB;
+    OGLP_ENTRY (MinSampleShadingARB) = internal::Lazy_MinSampleShadingARB;
+    OGLP_ENTRY (NamedStringARB) = internal::Lazy_NamedStringARB;
+    OGLP_ENTRY (DeleteNamedStringARB) = internal::Lazy_DeleteNamedStringARB;
+    OGLP_ENTRY (CompileShaderIncludeARB) = internal::Lazy_CompileShaderIncludeARB;
+    OGLP_ENTRY (IsNamedStringARB) = internal::Lazy_IsNamedStringARB;
+    OGLP_ENTRY (GetNamedStringARB) = internal::Lazy_GetNamedStringARB;
+    OGLP_ENTRY (GetNamedStringivARB) = internal::Lazy_GetNamedStringivARB;
+    OGLP_ENTRY (BufferPageCommitmentARB) = internal::Lazy_BufferPageCommitmentARB;
+    OGLP_ENTRY (NamedBufferPageCommitmentEXT) = internal::Lazy_NamedBufferPageCommitmentEXT;
+    OGLP_ENTRY (NamedBufferPageCommitmentARB) = internal::Lazy_NamedBufferPageCommitmentARB;
+    OGLP_ENTRY (TexPageCommitmentARB) = internal::Lazy_TexPageCommitmentARB;
+    OGLP_ENTRY (GetMultisamplefvNV) = internal::Lazy_GetMultisamplefvNV;
+    OGLP_ENTRY (SampleMaskIndexedNV) = internal::Lazy_SampleMaskIndexedNV;
+    OGLP_ENTRY (TexRenderbufferNV) = internal::Lazy_TexRenderbufferNV;
+    OGLP_ENTRY (MakeBufferResidentNV) = internal::Lazy_MakeBufferResidentNV;
+    OGLP_ENTRY (MakeBufferNonResidentNV) = internal::Lazy_MakeBufferNonResidentNV;
+    OGLP_ENTRY (IsBufferResidentNV) = internal::Lazy_IsBufferResidentNV;
+    OGLP_ENTRY (MakeNamedBufferResidentNV) = internal::Lazy_MakeNamedBufferResidentNV;
+    OGLP_ENTRY (MakeNamedBufferNonResidentNV) = internal::Lazy_MakeNamedBufferNonResidentNV;
+    OGLP_ENTRY (IsNamedBufferResidentNV) = internal::Lazy_IsNamedBufferResidentNV;
+    OGLP_ENTRY (GetBufferParameterui64vNV) = internal::Lazy_GetBufferParameterui64vNV;
+    OGLP_ENTRY (GetNamedBufferParameterui64vNV) = internal::Lazy_GetNamedBufferParameterui64vNV;
+    OGLP_ENTRY (GetIntegerui64vNV) = internal::Lazy_GetIntegerui64vNV;
+    OGLP_ENTRY (Uniformui64NV) = internal::Lazy_Uniformui64NV;
+    OGLP_ENTRY (Uniformui64vNV) = internal::Lazy_Uniformui64vNV;
+    OGLP_ENTRY (ProgramUniformui64NV) = internal::Lazy_ProgramUniformui64NV;
+    OGLP_ENTRY (ProgramUniformui64vNV) = internal::Lazy_ProgramUniformui64vNV;
+    OGLP_ENTRY (BufferAddressRangeNV) = internal::Lazy_BufferAddressRangeNV;
+    OGLP_ENTRY (VertexFormatNV) = internal::Lazy_VertexFormatNV;
+    OGLP_ENTRY (NormalFormatNV) = internal::Lazy_NormalFormatNV;
+    OGLP_ENTRY (ColorFormatNV) = internal::Lazy_ColorFormatNV;
+    OGLP_ENTRY (IndexFormatNV) = internal::Lazy_IndexFormatNV;
+    OGLP_ENTRY (TexCoordFormatNV) = internal::Lazy_TexCoordFormatNV;
+    OGLP_ENTRY (EdgeFlagFormatNV) = internal::Lazy_EdgeFlagFormatNV;
+    OGLP_ENTRY (SecondaryColorFormatNV) = internal::Lazy_SecondaryColorFormatNV;
+    OGLP_ENTRY (FogCoordFormatNV) = internal::Lazy_FogCoordFormatNV;
+    OGLP_ENTRY (VertexAttribFormatNV) = internal::Lazy_VertexAttribFormatNV;
+    OGLP_ENTRY (VertexAttribIFormatNV) = internal::Lazy_VertexAttribIFormatNV;
+    OGLP_ENTRY (GetIntegerui64i_vNV) = internal::Lazy_GetIntegerui64i_vNV;
+    OGLP_ENTRY (EnableClientState) = internal::Lazy_EnableClientState;
+    OGLP_ENTRY (DisableClientState) = internal::Lazy_DisableClientState;
+
+}
+
+void GetDispatch (DispatchTable *table)
+{
+    table->getprocaddress = OGLP_GETPROCADDRESS;
+#ifdef OGLP_DIRECT_LINK
+    table->CullFace = ::glCullFace;
+    table->FrontFace = ::glFrontFace;
+    table->Hint = ::glHint;
+    table->LineWidth = ::glLineWidth;
+    table->PointSize = ::glPointSize;
+    table->PolygonMode = ::glPolygonMode;
+    table->Scissor = ::glScissor;
+    table->TexParameterf = ::glTexParameterf;
+    table->TexParameterfv = ::glTexParameterfv;
+    table->TexParameteri = ::glTexParameteri;
+    table->TexParameteriv = ::glTexParameteriv;
+    table->TexImage1D = ::glTexImage1D;
+    table->TexImage2D = ::glTexImage2D;
+    table->DrawBuffer = ::glDrawBuffer;
+    table->Clear = ::glClear;
+    table->ClearColor = ::glClearColor;
+    table->ClearStencil = ::glClearStencil;
+    table->ClearDepth = ::glClearDepth;
+    table->StencilMask = ::glStencilMask;
+    table->ColorMask = ::glColorMask;
+    table->DepthMask = ::glDepthMask;
+    table->Disable = ::glDisable;
+    table->Enable = ::glEnable;
+    table->Finish = ::glFinish;
+    table->Flush = ::glFlush;
+    table->BlendFunc = ::glBlendFunc;
+    table->LogicOp = ::glLogicOp;
+    table->StencilFunc = ::glStencilFunc;
+    table->StencilOp = ::glStencilOp;
+    table->DepthFunc = ::glDepthFunc;
+    table->PixelStoref = ::glPixelStoref;
+    table->PixelStorei = ::glPixelStorei;
+    table->ReadBuffer = ::glReadBuffer;
+    table->ReadPixels = ::glReadPixels;
+    table->GetBooleanv = ::glGetBooleanv;
+    table->GetDoublev = ::glGetDoublev;
+    table->GetError = ::glGetError;
+    table->GetFloatv = ::glGetFloatv;
+    table->GetIntegerv = ::glGetIntegerv;
+    table->GetString = ::glGetString;
+    table->GetTexImage = ::glGetTexImage;
+    table->GetTexParameterfv = ::glGetTexParameterfv;
+    table->GetTexParameteriv = ::glGetTexParameteriv;
+    table->GetTexLevelParameterfv = ::glGetTexLevelParameterfv;
+    table->GetTexLevelParameteriv = ::glGetTexLevelParameteriv;
+    table->IsEnabled = ::glIsEnabled;
+    table->DepthRange = ::glDepthRange;
+    table->Viewport = ::glViewport;
+    table->DrawArrays = ::glDrawArrays;
+    table->DrawElements = ::glDrawElements;
+    table->GetPointerv = ::glGetPointerv;
+    table->PolygonOffset = ::glPolygonOffset;
+    table->CopyTexImage1D = ::glCopyTexImage1D;
+    table->CopyTexImage2D = ::glCopyTexImage2D;
+    table->CopyTexSubImage1D = ::glCopyTexSubImage1D;
+    table->CopyTexSubImage2D = ::glCopyTexSubImage2D;
+    table->TexSubImage1D = ::glTexSubImage1D;
+    table->TexSubImage2D = ::glTexSubImage2D;
+    table->BindTexture = ::glBindTexture;
+    table->DeleteTextures = ::glDeleteTextures;
+    table->GenTextures = ::glGenTextures;
+    table->IsTexture = ::glIsTexture;
+    table->DrawRangeElements = ::glDrawRangeElements;
+    table->TexImage3D = ::glTexImage3D;
+    table->TexSubImage3D = ::glTexSubImage3D;
+    table->CopyTexSubImage3D = ::glCopyTexSubImage3D;
+    table->ActiveTexture = ::glActiveTexture;
+    table->SampleCoverage = ::glSampleCoverage;
+    table->CompressedTexImage3D = ::glCompressedTexImage3D;
+    table->CompressedTexImage2D = ::glCompressedTexImage2D;
+    table->CompressedTexImage1D = ::glCompressedTexImage1D;
+    table->CompressedTexSubImage3D = ::glCompressedTexSubImage3D;
+    table->CompressedTexSubImage2D = ::glCompressedTexSubImage2D;
+    table->CompressedTexSubImage1D = ::glCompressedTexSubImage1D;
+    table->GetCompressedTexImage = ::glGetCompressedTexImage;
+    table->BlendFuncSeparate = ::glBlendFuncSeparate;
+    table->MultiDrawArrays = ::glMultiDrawArrays;
+    table->MultiDrawElements = ::glMultiDrawElements;
+    table->PointParameterf = ::glPointParameterf;
+    table->PointParameterfv = ::glPointParameterfv;
+    table->PointParameteri = ::glPointParameteri;
+    table->PointParameteriv = ::glPointParameteriv;
+    table->BlendColor = ::glBlendColor;
+    table->BlendEquation = ::glBlendEquation;
+    table->GenQueries = ::glGenQueries;
+    table->DeleteQueries = ::glDeleteQueries;
+    table->IsQuery = ::glIsQuery;
+    table->BeginQuery = ::glBeginQuery;
+    table->EndQuery = ::glEndQuery;
+    table->GetQueryiv = ::glGetQueryiv;
+    table->GetQueryObjectiv = ::glGetQueryObjectiv;
+    table->GetQueryObjectuiv = ::glGetQueryObjectuiv;
+    table->BindBuffer = ::glBindBuffer;
+    table->DeleteBuffers = ::glDeleteBuffers;
+    table->GenBuffers = ::glGenBuffers;
+    table->IsBuffer = ::glIsBuffer;
+    table->BufferData = ::glBufferData;
+    table->BufferSubData = ::glBufferSubData;
+    table->GetBufferSubData = ::glGetBufferSubData;
+    table->MapBuffer = ::glMapBuffer;
+    table->UnmapBuffer = ::glUnmapBuffer;
+    table->GetBufferParameteriv = ::glGetBufferParameteriv;
+    table->GetBufferPointerv = ::glGetBufferPointerv;
+    table->BlendEquationSeparate = ::glBlendEquationSeparate;
+    table->DrawBuffers = ::glDrawBuffers;
+    table->StencilOpSeparate = ::glStencilOpSeparate;
+    table->StencilFuncSeparate = ::glStencilFuncSeparate;
+    table->StencilMaskSeparate = ::glStencilMaskSeparate;
+    table->AttachShader = ::glAttachShader;
+    table->BindAttribLocation = ::glBindAttribLocation;
+    table->CompileShader = ::glCompileShader;
+    table->CreateProgram = ::glCreateProgram;
+    table->CreateShader = ::glCreateShader;
+    table->DeleteProgram = ::glDeleteProgram;
+    table->DeleteShader = ::glDeleteShader;
+    table->DetachShader = ::glDetachShader;
+    table->DisableVertexAttribArray = ::glDisableVertexAttribArray;
+    table->EnableVertexAttribArray = ::glEnableVertexAttribArray;
+    table->GetActiveAttrib = ::glGetActiveAttrib;
+    table->GetActiveUniform = ::glGetActiveUniform;
+    table->GetAttachedShaders = ::glGetAttachedShaders;
+    table->GetAttribLocation = ::glGetAttribLocation;
+    table->GetProgramiv = ::glGetProgramiv;
+    table->GetProgramInfoLog = ::glGetProgramInfoLog;
+    table->GetShaderiv = ::glGetShaderiv;
+    table->GetShaderInfoLog = ::glGetShaderInfoLog;
+    table->GetShaderSource = ::glGetShaderSource;
+    table->GetUniformLocation = ::glGetUniformLocation;
+    table->GetUniformfv = ::glGetUniformfv;
+    table->GetUniformiv = ::glGetUniformiv;
+    table->GetVertexAttribdv = ::glGetVertexAttribdv;
+    table->GetVertexAttribfv = ::glGetVertexAttribfv;
+    table->GetVertexAttribiv = ::glGetVertexAttribiv;
+    table->GetVertexAttribPointerv = ::glGetVertexAttribPointerv;
+    table->IsProgram = ::glIsProgram;
+    table->IsShader = ::glIsShader;
+    table->LinkProgram = ::glLinkProgram;
+    table->ShaderSource = ::glShaderSource;
+    table->UseProgram = ::glUseProgram;
+    table->Uniform1f = ::glUniform1f;
+    table->Uniform2f = ::glUniform2f;
+    table->Uniform3f = ::glUniform3f;
+    table->Uniform4f = ::glUniform4f;
+    table->Uniform1i = ::glUniform1i;
+    table->Uniform2i = ::glUniform2i;
+    table->Uniform3i = ::glUniform3i;
+    table->Uniform4i = ::glUniform4i;
+    table->Uniform1fv = ::glUniform1fv;
+    table->Uniform2fv = ::glUniform2fv;
+    table->Uniform3fv = ::glUniform3fv;
+    table->Uniform4fv = ::glUniform4fv;
+    table->Uniform1iv = ::glUniform1iv;
+    table->Uniform2iv = ::glUniform2iv;
+    table->Uniform3iv = ::glUniform3iv;
+    table->Uniform4iv = ::glUniform4iv;
+    table->UniformMatrix2fv = ::glUniformMatrix2fv;
+    table->UniformMatrix3fv = ::glUniformMatrix3fv;
+    table->UniformMatrix4fv = ::glUniformMatrix4fv;
+    table->ValidateProgram = ::glValidateProgram;
+    table->VertexAttrib1d = ::glVertexAttrib1d;
+    table->VertexAttrib1dv = ::glVertexAttrib1dv;
+    table->VertexAttrib1f = ::glVertexAttrib1f;
+    table->VertexAttrib1fv = ::glVertexAttrib1fv;
+    table->VertexAttrib1s = ::glVertexAttrib1s;
+    table->VertexAttrib1sv = ::glVertexAttrib1sv;
+    table->VertexAttrib2d = ::glVertexAttrib2d;
+    table->VertexAttrib2dv = ::glVertexAttrib2dv;
+    table->VertexAttrib2f = ::glVertexAttrib2f;
+    table->VertexAttrib2fv = ::glVertexAttrib2fv;
+    table->VertexAttrib2s = ::glVertexAttrib2s;
+    table->VertexAttrib2sv = ::glVertexAttrib2sv;
+    table->VertexAttrib3d = ::glVertexAttrib3d;
+    table->VertexAttrib3dv = ::glVertexAttrib3dv;
+    table->VertexAttrib3f = ::glVertexAttrib3f;
+    table->VertexAttrib3fv = ::glVertexAttrib3fv;
+    table->VertexAttrib3s = ::glVertexAttrib3s;
+    table->VertexAttrib3sv = ::glVertexAttrib3sv;
+    table->VertexAttrib4Nbv = ::glVertexAttrib4Nbv;
+    table->VertexAttrib4Niv = ::glVertexAttrib4Niv;
+    table->VertexAttrib4Nsv = ::glVertexAttrib4Nsv;
+    table->VertexAttrib4Nub = ::glVertexAttrib4Nub;
+    table->VertexAttrib4Nubv = ::glVertexAttrib4Nubv;
+    table->VertexAttrib4Nuiv = ::glVertexAttrib4Nuiv;
+    table->VertexAttrib4Nusv = ::glVertexAttrib4Nusv;
+    table->VertexAttrib4bv = ::glVertexAttrib4bv;
+    table->VertexAttrib4d = ::glVertexAttrib4d;
+    table->VertexAttrib4dv = ::glVertexAttrib4dv;
+    table->VertexAttrib4f = ::glVertexAttrib4f;
+    table->VertexAttrib4fv = ::glVertexAttrib4fv;
+    table->VertexAttrib4iv = ::glVertexAttrib4iv;
+    table->VertexAttrib4s = ::glVertexAttrib4s;
+    table->VertexAttrib4sv = ::glVertexAttrib4sv;
+    table->VertexAttrib4ubv = ::glVertexAttrib4ubv;
+    table->VertexAttrib4uiv = ::glVertexAttrib4uiv;
+    table->VertexAttrib4usv = ::glVertexAttrib4usv;
+    table->VertexAttribPointer = ::glVertexAttribPointer;
+    table->UniformMatrix2x3fv = ::glUniformMatrix2x3fv;
+    table->UniformMatrix3x2fv = ::glUniformMatrix3x2fv;
+    table->UniformMatrix2x4fv = ::glUniformMatrix2x4fv;
+    table->UniformMatrix4x2fv = ::glUniformMatrix4x2fv;
+    table->UniformMatrix3x4fv = ::glUniformMatrix3x4fv;
+    table->UniformMatrix4x3fv = ::glUniformMatrix4x3fv;
+    table->ColorMaski = ::glColorMaski;
+    table->GetBooleani_v = ::glGetBooleani_v;
+    table->GetIntegeri_v = ::glGetIntegeri_v;
+    table->Enablei = ::glEnablei;
+    table->Disablei = ::glDisablei;
+    table->IsEnabledi = ::glIsEnabledi;
+    table->BeginTransformFeedback = ::glBeginTransformFeedback;
+    table->EndTransformFeedback = ::glEndTransformFeedback;
+    table->BindBufferRange = ::glBindBufferRange;
+    table->BindBufferBase = ::glBindBufferBase;
+    table->TransformFeedbackVaryings = ::glTransformFeedbackVaryings;
+    table->GetTransformFeedbackVarying = ::glGetTransformFeedbackVarying;
+    table->ClampColor = ::glClampColor;
+    table->BeginConditionalRender = ::glBeginConditionalRender;
+    table->EndConditionalRender = ::glEndConditionalRender;
+    table->VertexAttribIPointer = ::glVertexAttribIPointer;
+    table->GetVertexAttribIiv = ::glGetVertexAttribIiv;
+    table->GetVertexAttribIuiv = ::glGetVertexAttribIuiv;
+    table->VertexAttribI1i = ::glVertexAttribI1i;
+    table->VertexAttribI2i = ::glVertexAttribI2i;
+    table->VertexAttribI3i = ::glVertexAttribI3i;
+    table->VertexAttribI4i = ::glVertexAttribI4i;
+    table->VertexAttribI1ui = ::glVertexAttribI1ui;
+    table->VertexAttribI2ui = ::glVertexAttribI2ui;
+    table->VertexAttribI3ui = ::glVertexAttribI3ui;
+    table->VertexAttribI4ui = ::glVertexAttribI4ui;
+    table->VertexAttribI1iv = ::glVertexAttribI1iv;
+    table->VertexAttribI2iv = ::glVertexAttribI2iv;
+    table->VertexAttribI3iv = ::glVertexAttribI3iv;
+    table->VertexAttribI4iv = ::glVertexAttribI4iv;
+    table->VertexAttribI1uiv = ::glVertexAttribI1uiv;
+    table->VertexAttribI2uiv = ::glVertexAttribI2uiv;
+    table->VertexAttribI3uiv = ::glVertexAttribI3uiv;
+    table->VertexAttribI4uiv = ::glVertexAttribI4uiv;
+    table->VertexAttribI4bv = ::glVertexAttribI4bv;
+    table->VertexAttribI4sv = ::glVertexAttribI4sv;
+    table->VertexAttribI4ubv = ::glVertexAttribI4ubv;
+    table->VertexAttribI4usv = ::glVertexAttribI4usv;
+    table->GetUniformuiv = ::glGetUniformuiv;
+    table->BindFragDataLocation = ::glBindFragDataLocation;
+    table->GetFragDataLocation = ::glGetFragDataLocation;
+    table->Uniform1ui = ::glUniform1ui;
+    table->Uniform2ui = ::glUniform2ui;
+    table->Uniform3ui = ::glUniform3ui;
+    table->Uniform4ui = ::glUniform4ui;
+    table->Uniform1uiv = ::glUniform1uiv;
+    table->Uniform2uiv = ::glUniform2uiv;
+    table->Uniform3uiv = ::glUniform3uiv;
+    table->Uniform4uiv = ::glUniform4uiv;
+    table->TexParameterIiv = ::glTexParameterIiv;
+    table->TexParameterIuiv = ::glTexParameterIuiv;
+    table->GetTexParameterIiv = ::glGetTexParameterIiv;
+    table->GetTexParameterIuiv = ::glGetTexParameterIuiv;
+    table->ClearBufferiv = ::glClearBufferiv;
+    table->ClearBufferuiv = ::glClearBufferuiv;
+    table->ClearBufferfv = ::glClearBufferfv;
+    table->ClearBufferfi = ::glClearBufferfi;
+    table->GetStringi = ::glGetStringi;
+    table->IsRenderbuffer = ::glIsRenderbuffer;
+    table->BindRenderbuffer = ::glBindRenderbuffer;
+    table->DeleteRenderbuffers = ::glDeleteRenderbuffers;
+    table->GenRenderbuffers = ::glGenRenderbuffers;
+    table->RenderbufferStorage = ::glRenderbufferStorage;
+    table->GetRenderbufferParameteriv = ::glGetRenderbufferParameteriv;
+    table->IsFramebuffer = ::glIsFramebuffer;
+    table->BindFramebuffer = ::glBindFramebuffer;
+    table->DeleteFramebuffers = ::glDeleteFramebuffers;
+    table->GenFramebuffers = ::glGenFramebuffers;
+    table->CheckFramebufferStatus = ::glCheckFramebufferStatus;
+    table->FramebufferTexture1D = ::glFramebufferTexture1D;
+    table->FramebufferTexture2D = ::glFramebufferTexture2D;
+    table->FramebufferTexture3D = ::glFramebufferTexture3D;
+    table->FramebufferRenderbuffer = ::glFramebufferRenderbuffer;
+    table->GetFramebufferAttachmentParameteriv = ::glGetFramebufferAttachmentParameteriv;
+    table->GenerateMipmap = ::glGenerateMipmap;
+    table->BlitFramebuffer = ::glBlitFramebuffer;
+    table->RenderbufferStorageMultisample = ::glRenderbufferStorageMultisample;
+    table->FramebufferTextureLayer = ::glFramebufferTextureLayer;
+    table->MapBufferRange = ::glMapBufferRange;
+    table->FlushMappedBufferRange = ::glFlushMappedBufferRange;
+    table->BindVertexArray = ::glBindVertexArray;
+    table->DeleteVertexArrays = ::glDeleteVertexArrays;
+    table->GenVertexArrays = ::glGenVertexArrays;
+    table->IsVertexArray = ::glIsVertexArray;
+    table->DrawArraysInstanced = ::glDrawArraysInstanced;
+    table->DrawElementsInstanced = ::glDrawElementsInstanced;
+    table->TexBuffer = ::glTexBuffer;
+    table->PrimitiveRestartIndex = ::glPrimitiveRestartIndex;
+    table->CopyBufferSubData = ::glCopyBufferSubData;
+    table->GetUniformIndices = ::glGetUniformIndices;
+    table->GetActiveUniformsiv = ::glGetActiveUniformsiv;
+    table->GetActiveUniformName = ::glGetActiveUniformName;
+    table->GetUniformBlockIndex = ::glGetUniformBlockIndex;
+    table->GetActiveUniformBlockiv = ::glGetActiveUniformBlockiv;
+    table->GetActiveUniformBlockName = ::glGetActiveUniformBlockName;
+    table->UniformBlockBinding = ::glUniformBlockBinding;
+    table->DrawElementsBaseVertex = ::glDrawElementsBaseVertex;
+    table->DrawRangeElementsBaseVertex = ::glDrawRangeElementsBaseVertex;
+    table->DrawElementsInstancedBaseVertex = ::glDrawElementsInstancedBaseVertex;
+    table->MultiDrawElementsBaseVertex = ::glMultiDrawElementsBaseVertex;
+    table->ProvokingVertex = ::glProvokingVertex;
+    table->FenceSync = ::glFenceSync;
+    table->IsSync = ::glIsSync;
+    table->DeleteSync = ::glDeleteSync;
+    table->ClientWaitSync = ::glClientWaitSync;
+    table->WaitSync = ::glWaitSync;
+    table->GetInteger64v = ::glGetInteger64v;
+    table->GetSynciv = ::glGetSynciv;
+    table->GetInteger64i_v = ::glGetInteger64i_v;
+    table->GetBufferParameteri64v = ::glGetBufferParameteri64v;
+    table->FramebufferTexture = ::glFramebufferTexture;
+    table->TexImage2DMultisample = ::glTexImage2DMultisample;
+    table->TexImage3DMultisample = ::glTexImage3DMultisample;
+    table->GetMultisamplefv = ::glGetMultisamplefv;
+    table->SampleMaski = ::glSampleMaski;
+    table->BindFragDataLocationIndexed = ::glBindFragDataLocationIndexed;
+    table->GetFragDataIndex = ::glGetFragDataIndex;
+    table->GenSamplers = ::glGenSamplers;
+    table->DeleteSamplers = ::glDeleteSamplers;
+    table->IsSampler = ::glIsSampler;
+    table->BindSampler = ::glBindSampler;
+    table->SamplerParameteri = ::glSamplerParameteri;
+    table->SamplerParameteriv = ::glSamplerParameteriv;
+    table->SamplerParameterf = ::glSamplerParameterf;
+    table->SamplerParameterfv = ::glSamplerParameterfv;
+    table->SamplerParameterIiv = ::glSamplerParameterIiv;
+    table->SamplerParameterIuiv = ::glSamplerParameterIuiv;
+    table->GetSamplerParameteriv = ::glGetSamplerParameteriv;
+    table->GetSamplerParameterIiv = ::glGetSamplerParameterIiv;
+    table->GetSamplerParameterfv = ::glGetSamplerParameterfv;
+    table->GetSamplerParameterIuiv = ::glGetSamplerParameterIuiv;
+    table->QueryCounter = ::glQueryCounter;
+    table->GetQueryObjecti64v = ::glGetQueryObjecti64v;
+    table->GetQueryObjectui64v = ::glGetQueryObjectui64v;
+    table->VertexAttribDivisor = ::glVertexAttribDivisor;
+    table->VertexAttribP1ui = ::glVertexAttribP1ui;
+    table->VertexAttribP1uiv = ::glVertexAttribP1uiv;
+    table->VertexAttribP2ui = ::glVertexAttribP2ui;
+    table->VertexAttribP2uiv = ::glVertexAttribP2uiv;
+    table->VertexAttribP3ui = ::glVertexAttribP3ui;
+    table->VertexAttribP3uiv = ::glVertexAttribP3uiv;
+    table->VertexAttribP4ui = ::glVertexAttribP4ui;
+    table->VertexAttribP4uiv = ::glVertexAttribP4uiv;
+    table->MinSampleShading = ::glMinSampleShading;
+    table->BlendEquationi = ::glBlendEquationi;
+    table->BlendEquationSeparatei = ::glBlendEquationSeparatei;
+    table->BlendFunci = ::glBlendFunci;
+    table->BlendFuncSeparatei = ::glBlendFuncSeparatei;
+    table->DrawArraysIndirect = ::glDrawArraysIndirect;
+    table->DrawElementsIndirect = ::glDrawElementsIndirect;
+    table->Uniform1d = ::glUniform1d;
+    table->Uniform2d = ::glUniform2d;
+    table->Uniform3d = ::glUniform3d;
+    table->Uniform4d = ::glUniform4d;
+    table->Uniform1dv = ::glUniform1dv;
+    table->Uniform2dv = ::glUniform2dv;
+    table->Uniform3dv = ::glUniform3dv;
+    table->Uniform4dv = ::glUniform4dv;
+    table->UniformMatrix2dv = ::glUniformMatrix2dv;
+    table->UniformMatrix3dv = ::glUniformMatrix3dv;
+    table->UniformMatrix4dv = ::glUniformMatrix4dv;
+    table->UniformMatrix2x3dv = ::glUniformMatrix2x3dv;
+    table->UniformMatrix2x4dv = ::glUniformMatrix2x4dv;
+    table->UniformMatrix3x2dv = ::glUniformMatrix3x2dv;
+    table->UniformMatrix3x4dv = ::glUniformMatrix3x4dv;
+    table->UniformMatrix4x2dv = ::glUniformMatrix4x2dv;
+    table->UniformMatrix4x3dv = ::glUniformMatrix4x3dv;
+    table->GetUniformdv = ::glGetUniformdv;
+    table->GetSubroutineUniformLocation = ::glGetSubroutineUniformLocation;
+    table->GetSubroutineIndex = ::glGetSubroutineIndex;
+    table->GetActiveSubroutineUniformiv = ::glGetActiveSubroutineUniformiv;
+    table->GetActiveSubroutineUniformName = ::glGetActiveSubroutineUniformName;
+    table->GetActiveSubroutineName = ::glGetActiveSubroutineName;
+    table->UniformSubroutinesuiv = ::glUniformSubroutinesuiv;
+    table->GetUniformSubroutineuiv = ::glGetUniformSubroutineuiv;
+    table->GetProgramStageiv = ::glGetProgramStageiv;
+    table->PatchParameteri = ::glPatchParameteri;
+    table->PatchParameterfv = ::glPatchParameterfv;
+    table->BindTransformFeedback = ::glBindTransformFeedback;
+    table->DeleteTransformFeedbacks = ::glDeleteTransformFeedbacks;
+    table->GenTransformFeedbacks = ::glGenTransformFeedbacks;
+    table->IsTransformFeedback = ::glIsTransformFeedback;
+    table->PauseTransformFeedback = ::glPauseTransformFeedback;
+    table->ResumeTransformFeedback = ::glResumeTransformFeedback;
+    table->DrawTransformFeedback = ::glDrawTransformFeedback;
+    table->DrawTransformFeedbackStream = ::glDrawTransformFeedbackStream;
+    table->BeginQueryIndexed = ::glBeginQueryIndexed;
+    table->EndQueryIndexed = ::glEndQueryIndexed;
+    table->GetQueryIndexediv = ::glGetQueryIndexediv;
+    table->ReleaseShaderCompiler = ::glReleaseShaderCompiler;
+    table->ShaderBinary = ::glShaderBinary;
+    table->GetShaderPrecisionFormat = ::glGetShaderPrecisionFormat;
+    table->DepthRangef = ::glDepthRangef;
+    table->ClearDepthf = ::glClearDepthf;
+    table->GetProgramBinary = ::glGetProgramBinary;
+    table->ProgramBinary = ::glProgramBinary;
+    table->ProgramParameteri = ::glProgramParameteri;
+    table->UseProgramStages = ::glUseProgramStages;
+    table->ActiveShaderProgram = ::glActiveShaderProgram;
+    table->CreateShaderProgramv = ::glCreateShaderProgramv;
+    table->BindProgramPipeline = ::glBindProgramPipeline;
+    table->DeleteProgramPipelines = ::glDeleteProgramPipelines;
+    table->GenProgramPipelines = ::glGenProgramPipelines;
+    table->IsProgramPipeline = ::glIsProgramPipeline;
+    table->GetProgramPipelineiv = ::glGetProgramPipelineiv;
+    table->ProgramUniform1i = ::glProgramUniform1i;
+    table->ProgramUniform1iv = ::glProgramUniform1iv;
+    table->ProgramUniform1f = ::glProgramUniform1f;
+    table->ProgramUniform1fv = ::glProgramUniform1fv;
+    table->ProgramUniform1d = ::glProgramUniform1d;
+    table->ProgramUniform1dv = ::glProgramUniform1dv;
+    table->ProgramUniform1ui = ::glProgramUniform1ui;
+    table->ProgramUniform1uiv = ::glProgramUniform1uiv;
+    table->ProgramUniform2i = ::glProgramUniform2i;
+    table->ProgramUniform2iv = ::glProgramUniform2iv;
+    table->ProgramUniform2f = ::glProgramUniform2f;
+    table->ProgramUniform2fv = ::glProgramUniform2fv;
+    table->ProgramUniform2d = ::glProgramUniform2d;
+    table->ProgramUniform2dv = ::glProgramUniform2dv;
+    table->ProgramUniform2ui = ::glProgramUniform2ui;
+    table->ProgramUniform2uiv = ::glProgramUniform2uiv;
+    table->ProgramUniform3i = ::glProgramUniform3i;
+    table->ProgramUniform3iv = ::glProgramUniform3iv;
+    table->ProgramUniform3f = ::glProgramUniform3f;
+    table->ProgramUniform3fv = ::glProgramUniform3fv;
+    table->ProgramUniform3d = ::glProgramUniform3d;
+    table->ProgramUniform3dv = ::glProgramUniform3dv;
+    table->ProgramUniform3ui = ::glProgramUniform3ui;
+    table->ProgramUniform3uiv = ::glProgramUniform3uiv;
+    table->ProgramUniform4i = ::glProgramUniform4i;
+    table->ProgramUniform4iv = ::glProgramUniform4iv;
+    table->ProgramUniform4f = ::glProgramUniform4f;
+    table->ProgramUniform4fv = ::glProgramUniform4fv;
+    table->ProgramUniform4d = ::glProgramUniform4d;
+    table->ProgramUniform4dv = ::glProgramUniform4dv;
+    table->ProgramUniform4ui = ::glProgramUniform4ui;
+    table->ProgramUniform4uiv = ::glProgramUniform4uiv;
+    table->ProgramUniformMatrix2fv = ::glProgramUniformMatrix2fv;
+    table->ProgramUniformMatrix3fv = ::glProgramUniformMatrix3fv;
+    table->ProgramUniformMatrix4fv = ::glProgramUniformMatrix4fv;
+    table->ProgramUniformMatrix2dv = ::glProgramUniformMatrix2dv;
+    table->ProgramUniformMatrix3dv = ::glProgramUniformMatrix3dv;
+    table->ProgramUniformMatrix4dv = ::glProgramUniformMatrix4dv;
+    table->ProgramUniformMatrix2x3fv = ::glProgramUniformMatrix2x3fv;
+    table->ProgramUniformMatrix3x2fv = ::glProgramUniformMatrix3x2fv;
+    table->ProgramUniformMatrix2x4fv = ::glProgramUniformMatrix2x4fv;
+    table->ProgramUniformMatrix4x2fv = ::glProgramUniformMatrix4x2fv;
+    table->ProgramUniformMatrix3x4fv = ::glProgramUniformMatrix3x4fv;
+    table->ProgramUniformMatrix4x3fv = ::glProgramUniformMatrix4x3fv;
+    table->ProgramUniformMatrix2x3dv = ::glProgramUniformMatrix2x3dv;
+    table->ProgramUniformMatrix3x2dv = ::glProgramUniformMatrix3x2dv;
+    table->ProgramUniformMatrix2x4dv = ::glProgramUniformMatrix2x4dv;
+    table->ProgramUniformMatrix4x2dv = ::glProgramUniformMatrix4x2dv;
+    table->ProgramUniformMatrix3x4dv = ::glProgramUniformMatrix3x4dv;
+    table->ProgramUniformMatrix4x3dv = ::glProgramUniformMatrix4x3dv;
+    table->ValidateProgramPipeline = ::glValidateProgramPipeline;
+    table->GetProgramPipelineInfoLog = ::glGetProgramPipelineInfoLog;
+    table->VertexAttribL1d = ::glVertexAttribL1d;
+    table->VertexAttribL2d = ::glVertexAttribL2d;
+    table->VertexAttribL3d = ::glVertexAttribL3d;
+    table->VertexAttribL4d = ::glVertexAttribL4d;
+    table->VertexAttribL1dv = ::glVertexAttribL1dv;
+    table->VertexAttribL2dv = ::glVertexAttribL2dv;
+    table->VertexAttribL3dv = ::glVertexAttribL3dv;
+    table->VertexAttribL4dv = ::glVertexAttribL4dv;
+    table->VertexAttribLPointer = ::glVertexAttribLPointer;
+    table->GetVertexAttribLdv = ::glGetVertexAttribLdv;
+    table->ViewportArrayv = ::glViewportArrayv;
+    table->ViewportIndexedf = ::glViewportIndexedf;
+    table->ViewportIndexedfv = ::glViewportIndexedfv;
+    table->ScissorArrayv = ::glScissorArrayv;
+    table->ScissorIndexed = ::glScissorIndexed;
+    table->ScissorIndexedv = ::glScissorIndexedv;
+    table->DepthRangeArrayv = ::glDepthRangeArrayv;
+    table->DepthRangeIndexed = ::glDepthRangeIndexed;
+    table->GetFloati_v = ::glGetFloati_v;
+    table->GetDoublei_v = ::glGetDoublei_v;
+    table->DrawArraysInstancedBaseInstance = ::glDrawArraysInstancedBaseInstance;
+    table->DrawElementsInstancedBaseInstance = ::glDrawElementsInstancedBaseInstance;
+    table->DrawElementsInstancedBaseVertexBaseInstance = ::glDrawElementsInstancedBaseVertexBaseInstance;
+    table->GetInternalformativ = ::glGetInternalformativ;
+    table->GetActiveAtomicCounterBufferiv = ::glGetActiveAtomicCounterBufferiv;
+    table->BindImageTexture = ::glBindImageTexture;
+    table->MemoryBarrier = ::glMemoryBarrier;
+    table->TexStorage1D = ::glTexStorage1D;
+    table->TexStorage2D = ::glTexStorage2D;
+    table->TexStorage3D = ::glTexStorage3D;
+    table->DrawTransformFeedbackInstanced = ::glDrawTransformFeedbackInstanced;
+    table->DrawTransformFeedbackStreamInstanced = ::glDrawTransformFeedbackStreamInstanced;
+    table->ClearBufferData = ::glClearBufferData;
+    table->ClearBufferSubData = ::glClearBufferSubData;
+    table->DispatchCompute = ::glDispatchCompute;
+    table->DispatchComputeIndirect = ::glDispatchComputeIndirect;
+    table->CopyImageSubData = ::glCopyImageSubData;
+    table->FramebufferParameteri = ::glFramebufferParameteri;
+    table->GetFramebufferParameteriv = ::glGetFramebufferParameteriv;
+    table->GetInternalformati64v = ::glGetInternalformati64v;
+    table->InvalidateTexSubImage = ::glInvalidateTexSubImage;
+    table->InvalidateTexImage = ::glInvalidateTexImage;
+    table->InvalidateBufferSubData = ::glInvalidateBufferSubData;
+    table->InvalidateBufferData = ::glInvalidateBufferData;
+    table->InvalidateFramebuffer = ::glInvalidateFramebuffer;
+    table->InvalidateSubFramebuffer = ::glInvalidateSubFramebuffer;
+    table->MultiDrawArraysIndirect = ::glMultiDrawArraysIndirect;
+    table->MultiDrawElementsIndirect = ::glMultiDrawElementsIndirect;
+    table->GetProgramInterfaceiv = ::glGetProgramInterfaceiv;
+    table->GetProgramResourceIndex = ::glGetProgramResourceIndex;
+    table->GetProgramResourceName = ::glGetProgramResourceName;
+    table->GetProgramResourceiv = ::glGetProgramResourceiv;
+    table->GetProgramResourceLocation = ::glGetProgramResourceLocation;
+    table->GetProgramResourceLocationIndex = ::glGetProgramResourceLocationIndex;
+    table->ShaderStorageBlockBinding = ::glShaderStorageBlockBinding;
+    table->TexBufferRange = ::glTexBufferRange;
+    table->TexStorage2DMultisample = ::glTexStorage2DMultisample;
+    table->TexStorage3DMultisample = ::glTexStorage3DMultisample;
+    table->TextureView = ::glTextureView;
+    table->BindVertexBuffer = ::glBindVertexBuffer;
+    table->VertexAttribFormat = ::glVertexAttribFormat;
+    table->VertexAttribIFormat = ::glVertexAttribIFormat;
+    table->VertexAttribLFormat = ::glVertexAttribLFormat;
+    table->VertexAttribBinding = ::glVertexAttribBinding;
+    table->VertexBindingDivisor = ::glVertexBindingDivisor;
+    table->DebugMessageControl = ::glDebugMessageControl;
+    table->DebugMessageInsert = ::glDebugMessageInsert;
+    table->DebugMessageCallback = ::glDebugMessageCallback;
+    table->GetDebugMessageLog = ::glGetDebugMessageLog;
+    table->PushDebugGroup = ::glPushDebugGroup;
+    table->PopDebugGroup = ::glPopDebugGroup;
+    table->ObjectLabel = ::glObjectLabel;
+    table->GetObjectLabel = ::glGetObjectLabel;
+    table->ObjectPtrLabel = ::glObjectPtrLabel;
+    table->GetObjectPtrLabel = ::glGetObjectPtrLabel;
+    table->BufferStorage = ::glBufferStorage;
+    table->ClearTexImage = ::glClearTexImage;
+    table->ClearTexSubImage = ::glClearTexSubImage;
+    table->BindBuffersBase = ::glBindBuffersBase;
+    table->BindBuffersRange = ::glBindBuffersRange;
+    table->BindTextures = ::glBindTextures;
+    table->BindSamplers = ::glBindSamplers;
+    table->BindImageTextures = ::glBindImageTextures;
+    table->BindVertexBuffers = ::glBindVertexBuffers;
+    table->ClipControl = ::glClipControl;
+    table->CreateTransformFeedbacks = ::glCreateTransformFeedbacks;
+    table->TransformFeedbackBufferBase = ::glTransformFeedbackBufferBase;
+    table->TransformFeedbackBufferRange = ::glTransformFeedbackBufferRange;
+    table->GetTransformFeedbackiv = ::glGetTransformFeedbackiv;
+    table->GetTransformFeedbacki_v = ::glGetTransformFeedbacki_v;
+    table->GetTransformFeedbacki64_v = ::glGetTransformFeedbacki64_v;
+    table->CreateBuffers = ::glCreateBuffers;
+    table->NamedBufferStorage = ::glNamedBufferStorage;
+    table->NamedBufferData = ::glNamedBufferData;
+    table->NamedBufferSubData = ::glNamedBufferSubData;
+    table->CopyNamedBufferSubData = ::glCopyNamedBufferSubData;
+    table->ClearNamedBufferData = ::glClearNamedBufferData;
+    table->ClearNamedBufferSubData = ::glClearNamedBufferSubData;
+    table->MapNamedBuffer = ::glMapNamedBuffer;
+    table->MapNamedBufferRange = ::glMapNamedBufferRange;
+    table->UnmapNamedBuffer = ::glUnmapNamedBuffer;
+    table->FlushMappedNamedBufferRange = ::glFlushMappedNamedBufferRange;
+    table->GetNamedBufferParameteriv = ::glGetNamedBufferParameteriv;
+    table->GetNamedBufferParameteri64v = ::glGetNamedBufferParameteri64v;
+    table->GetNamedBufferPointerv = ::glGetNamedBufferPointerv;
+    table->GetNamedBufferSubData = ::glGetNamedBufferSubData;
+    table->CreateFramebuffers = ::glCreateFramebuffers;
+    table->NamedFramebufferRenderbuffer = ::glNamedFramebufferRenderbuffer;
+    table->NamedFramebufferParameteri = ::glNamedFramebufferParameteri;
+    table->NamedFramebufferTexture = ::glNamedFramebufferTexture;
+    table->NamedFramebufferTextureLayer = ::glNamedFramebufferTextureLayer;
+    table->NamedFramebufferDrawBuffer = ::glNamedFramebufferDrawBuffer;
+    table->NamedFramebufferDrawBuffers = ::glNamedFramebufferDrawBuffers;
+    table->NamedFramebufferReadBuffer = ::glNamedFramebufferReadBuffer;
+    table->InvalidateNamedFramebufferData = ::glInvalidateNamedFramebufferData;
+    table->InvalidateNamedFramebufferSubData = ::glInvalidateNamedFramebufferSubData;
+    table->ClearNamedFramebufferiv = ::glClearNamedFramebufferiv;
+    table->ClearNamedFramebufferuiv = ::glClearNamedFramebufferuiv;
+    table->ClearNamedFramebufferfv = ::glClearNamedFramebufferfv;
+    table->ClearNamedFramebufferfi = ::glClearNamedFramebufferfi;
+    table->BlitNamedFramebuffer = ::glBlitNamedFramebuffer;
+    table->CheckNamedFramebufferStatus = ::glCheckNamedFramebufferStatus;
+    table->GetNamedFramebufferParameteriv = ::glGetNamedFramebufferParameteriv;
+    table->GetNamedFramebufferAttachmentParameteriv = ::glGetNamedFramebufferAttachmentParameteriv;
+    table->CreateRenderbuffers = ::glCreateRenderbuffers;
+    table->NamedRenderbufferStorage = ::glNamedRenderbufferStorage;
+    table->NamedRenderbufferStorageMultisample = ::glNamedRenderbufferStorageMultisample;
+    table->GetNamedRenderbufferParameteriv = ::glGetNamedRenderbufferParameteriv;
+    table->CreateTextures = ::glCreateTextures;
+    table->TextureBuffer = ::glTextureBuffer;
+    table->TextureBufferRange = ::glTextureBufferRange;
+    table->TextureStorage1D = ::glTextureStorage1D;
+    table->TextureStorage2D = ::glTextureStorage2D;
+    table->TextureStorage3D = ::glTextureStorage3D;
+    table->TextureStorage2DMultisample = ::glTextureStorage2DMultisample;
+    table->TextureStorage3DMultisample = ::glTextureStorage3DMultisample;
+    table->TextureSubImage1D = ::glTextureSubImage1D;
+    table->TextureSubImage2D = ::glTextureSubImage2D;
+    table->TextureSubImage3D = ::glTextureSubImage3D;
+    table->CompressedTextureSubImage1D = ::glCompressedTextureSubImage1D;
+    table->CompressedTextureSubImage2D = ::glCompressedTextureSubImage2D;
+    table->CompressedTextureSubImage3D = ::glCompressedTextureSubImage3D;
+    table->CopyTextureSubImage1D = ::glCopyTextureSubImage1D;
+    table->CopyTextureSubImage2D = ::glCopyTextureSubImage2D;
+    table->CopyTextureSubImage3D = ::glCopyTextureSubImage3D;
+    table->TextureParameterf = ::glTextureParameterf;
+    table->TextureParameterfv = ::glTextureParameterfv;
+    table->TextureParameteri = ::glTextureParameteri;
+    table->TextureParameterIiv = ::glTextureParameterIiv;
+    table->TextureParameterIuiv = ::glTextureParameterIuiv;
+    table->TextureParameteriv = ::glTextureParameteriv;
+    table->GenerateTextureMipmap = ::glGenerateTextureMipmap;
+    table->BindTextureUnit = ::glBindTextureUnit;
+    table->GetTextureImage = ::glGetTextureImage;
+    table->GetCompressedTextureImage = ::glGetCompressedTextureImage;
+    table->GetTextureLevelParameterfv = ::glGetTextureLevelParameterfv;
+    table->GetTextureLevelParameteriv = ::glGetTextureLevelParameteriv;
+    table->GetTextureParameterfv = ::glGetTextureParameterfv;
+    table->GetTextureParameterIiv = ::glGetTextureParameterIiv;
+    table->GetTextureParameterIuiv = ::glGetTextureParameterIuiv;
+    table->GetTextureParameteriv = ::glGetTextureParameteriv;
+    table->CreateVertexArrays = ::glCreateVertexArrays;
+    table->DisableVertexArrayAttrib = ::glDisableVertexArrayAttrib;
+    table->EnableVertexArrayAttrib = ::glEnableVertexArrayAttrib;
+    table->VertexArrayElementBuffer = ::glVertexArrayElementBuffer;
+    table->VertexArrayVertexBuffer = ::glVertexArrayVertexBuffer;
+    table->VertexArrayVertexBuffers = ::glVertexArrayVertexBuffers;
+    table->VertexArrayAttribBinding = ::glVertexArrayAttribBinding;
+    table->VertexArrayAttribFormat = ::glVertexArrayAttribFormat;
+    table->VertexArrayAttribIFormat = ::glVertexArrayAttribIFormat;
+    table->VertexArrayAttribLFormat = ::glVertexArrayAttribLFormat;
+    table->VertexArrayBindingDivisor = ::glVertexArrayBindingDivisor;
+    table->GetVertexArrayiv = ::glGetVertexArrayiv;
+    table->GetVertexArrayIndexediv = ::glGetVertexArrayIndexediv;
+    table->GetVertexArrayIndexed64iv = ::glGetVertexArrayIndexed64iv;
+    table->CreateSamplers = ::glCreateSamplers;
+    table->CreateProgramPipelines = ::glCreateProgramPipelines;
+    table->CreateQueries = ::glCreateQueries;
+    table->GetQueryBufferObjecti64v = ::glGetQueryBufferObjecti64v;
+    table->GetQueryBufferObjectiv = ::glGetQueryBufferObjectiv;
+    table->GetQueryBufferObjectui64v = ::glGetQueryBufferObjectui64v;
+    table->GetQueryBufferObjectuiv = ::glGetQueryBufferObjectuiv;
+    table->MemoryBarrierByRegion = ::glMemoryBarrierByRegion;
+    table->GetTextureSubImage = ::glGetTextureSubImage;
+    table->GetCompressedTextureSubImage = ::glGetCompressedTextureSubImage;
+    table->GetGraphicsResetStatus = ::glGetGraphicsResetStatus;
+    table->GetnCompressedTexImage = ::glGetnCompressedTexImage;
+    table->GetnTexImage = ::glGetnTexImage;
+    table->GetnUniformdv = ::glGetnUniformdv;
+    table->GetnUniformfv = ::glGetnUniformfv;
+    table->GetnUniformiv = ::glGetnUniformiv;
+    table->GetnUniformuiv = ::glGetnUniformuiv;
+    table->ReadnPixels = ::glReadnPixels;
+    table->TextureBarrier = ::glTextureBarrier;
+#else /* !defined OGLP_DIRECT_LINK */
+    table->CullFace = OGLP_ENTRY (CullFace) == internal::Lazy_CullFace
+        ? (PFNGLCULLFACEPROC) internal::LazyResolve ("glCullFace") : OGLP_ENTRY (CullFace);
+    table->FrontFace = OGLP_ENTRY (FrontFace) == internal::Lazy_FrontFace
+        ? (PFNGLFRONTFACEPROC) internal::LazyResolve ("glFrontFace") : OGLP_ENTRY (FrontFace);
+    table->Hint = OGLP_ENTRY (Hint) == internal::Lazy_Hint
+        ? (PFNGLHINTPROC) internal::LazyResolve ("glHint") : OGLP_ENTRY (Hint);
+    table->LineWidth = OGLP_ENTRY (LineWidth) == internal::Lazy_LineWidth
+        ? (PFNGLLINEWIDTHPROC) internal::LazyResolve ("glLineWidth") : OGLP_ENTRY (LineWidth);
+    table->PointSize = OGLP_ENTRY (PointSize) == internal::Lazy_PointSize
+        ? (PFNGLPOINTSIZEPROC) internal::LazyResolve ("glPointSize") : OGLP_ENTRY (PointSize);
+    table->PolygonMode = OGLP_ENTRY (PolygonMode) == internal::Lazy_PolygonMode
+        ? (PFNGLPOLYGONMODEPROC) internal::LazyResolve ("glPolygonMode") : OGLP_ENTRY (PolygonMode);
+    table->Scissor = OGLP_ENTRY (Scissor) == internal::Lazy_Scissor
+        ? (PFNGLSCISSORPROC) internal::LazyResolve ("glScissor") : OGLP_ENTRY (Scissor);
+    table->TexParameterf = OGLP_ENTRY (TexParameterf) == internal::Lazy_TexParameterf
+        ? (PFNGLTEXPARAMETERFPROC) internal::LazyResolve ("glTexParameterf") : OGLP_ENTRY (TexParameterf);
+    table->TexParameterfv = OGLP_ENTRY (TexParameterfv) == internal::Lazy_TexParameterfv
+        ? (PFNGLTEXPARAMETERFVPROC) internal::LazyResolve ("glTexParameterfv") : OGLP_ENTRY (TexParameterfv);
+    table->TexParameteri = OGLP_ENTRY (TexParameteri) == internal::Lazy_TexParameteri
+        ? (PFNGLTEXPARAMETERIPROC) internal::LazyResolve ("glTexParameteri") : OGLP_ENTRY (TexParameteri);
+    table->TexParameteriv = OGLP_ENTRY (TexParameteriv) == internal::Lazy_TexParameteriv
+        ? (PFNGLTEXPARAMETERIVPROC) internal::LazyResolve ("glTexParameteriv") : OGLP_ENTRY (TexParameteriv);
+    table->TexImage1D = OGLP_ENTRY (TexImage1D) == internal::Lazy_TexImage1D
+        ? (PFNGLTEXIMAGE1DPROC) internal::LazyResolve ("glTexImage1D") : OGLP_ENTRY (TexImage1D);
+    table->TexImage2D = OGLP_ENTRY (TexImage2D) == internal::Lazy_TexImage2D
+        ? (PFNGLTEXIMAGE2DPROC) internal::LazyResolve ("glTexImage2D") : OGLP_ENTRY (TexImage2D);
+    table->DrawBuffer = OGLP_ENTRY (DrawBuffer) == internal::Lazy_DrawBuffer
+        ? (PFNGLDRAWBUFFERPROC) internal::LazyResolve ("glDrawBuffer") : OGLP_ENTRY (DrawBuffer);
+    table->Clear = OGLP_ENTRY (Clear) == internal::Lazy_Clear
+        ? (PFNGLCLEARPROC) internal::LazyResolve ("glClear") : OGLP_ENTRY (Clear);
+    table->ClearColor = OGLP_ENTRY (ClearColor) == internal::Lazy_ClearColor
+        ? (PFNGLCLEARCOLORPROC) internal::LazyResolve ("glClearColor") : OGLP_ENTRY (ClearColor);
+    table->ClearStencil = OGLP_ENTRY (ClearStencil) == internal::Lazy_ClearStencil
+        ? (PFNGLCLEARSTENCILPROC) internal::LazyResolve ("glClearStencil") : OGLP_ENTRY (ClearStencil);
+    table->ClearDepth = OGLP_ENTRY (ClearDepth) == internal::Lazy_ClearDepth
+        ? (PFNGLCLEARDEPTHPROC) internal::LazyResolve ("glClearDepth") : OGLP_ENTRY (ClearDepth);
+    table->StencilMask = OGLP_ENTRY (StencilMask) == internal::Lazy_StencilMask
+        ? (PFNGLSTENCILMASKPROC) internal::LazyResolve ("glStencilMask") : OGLP_ENTRY (StencilMask);
+    table->ColorMask = OGLP_ENTRY (ColorMask) == internal::Lazy_ColorMask
+        ? (PFNGLCOLORMASKPROC) internal::LazyResolve ("glColorMask") : OGLP_ENTRY (ColorMask);
+    table->DepthMask = OGLP_ENTRY (DepthMask) == internal::Lazy_DepthMask
+        ? (PFNGLDEPTHMASKPROC) internal::LazyResolve ("glDepthMask") : OGLP_ENTRY (DepthMask);
+    table->Disable = OGLP_ENTRY (Disable) == internal::Lazy_Disable
+        ? (PFNGLDISABLEPROC) internal::LazyResolve ("glDisable") : OGLP_ENTRY (Disable);
+    table->Enable = OGLP_ENTRY (Enable) == internal::Lazy_Enable
+        ? (PFNGLENABLEPROC) internal::LazyResolve ("glEnable") : OGLP_ENTRY (Enable);
+    table->Finish = OGLP_ENTRY (Finish) == internal::Lazy_Finish
+        ? (PFNGLFINISHPROC) internal::LazyResolve ("glFinish") : OGLP_ENTRY (Finish);
+    table->Flush = OGLP_ENTRY (Flush) == internal::Lazy_Flush
+        ? (PFNGLFLUSHPROC) internal::LazyResolve ("glFlush") : OGLP_ENTRY (Flush);
+    table->BlendFunc = OGLP_ENTRY (BlendFunc) == internal::Lazy_BlendFunc
+        ? (PFNGLBLENDFUNCPROC) internal::LazyResolve ("glBlendFunc") : OGLP_ENTRY (BlendFunc);
+    table->LogicOp = OGLP_ENTRY (LogicOp) == internal::Lazy_LogicOp
+        ? (PFNGLLOGICOPPROC) internal::LazyResolve ("glLogicOp") : OGLP_ENTRY (LogicOp);
+    table->StencilFunc = OGLP_ENTRY (StencilFunc) == internal::Lazy_StencilFunc
+        ? (PFNGLSTENCILFUNCPROC) internal::LazyResolve ("glStencilFunc") : OGLP_ENTRY (StencilFunc);
+    table->StencilOp = OGLP_ENTRY (StencilOp) == internal::Lazy_StencilOp
+        ? (PFNGLSTENCILOPPROC) internal::LazyResolve ("glStencilOp") : OGLP_ENTRY (StencilOp);
+    table->DepthFunc = OGLP_ENTRY (DepthFunc) == internal::Lazy_DepthFunc
+        ? (PFNGLDEPTHFUNCPROC) internal::LazyResolve ("glDepthFunc") : OGLP_ENTRY (DepthFunc);
+    table->PixelStoref = OGLP_ENTRY (PixelStoref) == internal::Lazy_PixelStoref
+        ? (PFNGLPIXELSTOREFPROC) internal::LazyResolve ("glPixelStoref") : OGLP_ENTRY (PixelStoref);
+    table->PixelStorei = OGLP_ENTRY (PixelStorei) == internal::Lazy_PixelStorei
+        ? (PFNGLPIXELSTOREIPROC) internal::LazyResolve ("glPixelStorei") : OGLP_ENTRY (PixelStorei);
+    table->ReadBuffer = OGLP_ENTRY (ReadBuffer) == internal::Lazy_ReadBuffer
+        ? (PFNGLREADBUFFERPROC) internal::LazyResolve ("glReadBuffer") : OGLP_ENTRY (ReadBuffer);
+    table->ReadPixels = OGLP_ENTRY (ReadPixels) == internal::Lazy_ReadPixels
+        ? (PFNGLREADPIXELSPROC) internal::LazyResolve ("glReadPixels") : OGLP_ENTRY (ReadPixels);
+    table->GetBooleanv = OGLP_ENTRY (GetBooleanv) == internal::Lazy_GetBooleanv
+        ? (PFNGLGETBOOLEANVPROC) internal::LazyResolve ("glGetBooleanv") : OGLP_ENTRY (GetBooleanv);
+    table->GetDoublev = OGLP_ENTRY (GetDoublev) == internal::Lazy_GetDoublev
+        ? (PFNGLGETDOUBLEVPROC) internal::LazyResolve ("glGetDoublev") : OGLP_ENTRY (GetDoublev);
+    table->GetError = OGLP_ENTRY (GetError) == internal::Lazy_GetError
+        ? (PFNGLGETERRORPROC) internal::LazyResolve ("glGetError") : OGLP_ENTRY (GetError);
+    table->GetFloatv = OGLP_ENTRY (GetFloatv) == internal::Lazy_GetFloatv
+        ? (PFNGLGETFLOATVPROC) internal::LazyResolve ("glGetFloatv") : OGLP_ENTRY (GetFloatv);
+    table->GetIntegerv = OGLP_ENTRY (GetIntegerv) == internal::Lazy_GetIntegerv
+        ? (PFNGLGETINTEGERVPROC) internal::LazyResolve ("glGetIntegerv") : OGLP_ENTRY (GetIntegerv);
+    table->GetString = OGLP_ENTRY (GetString) == internal::Lazy_GetString
+        ? (PFNGLGETSTRINGPROC) internal::LazyResolve ("glGetString") : OGLP_ENTRY (GetString);
+    table->GetTexImage = OGLP_ENTRY (GetTexImage) == internal::Lazy_GetTexImage
+        ? (PFNGLGETTEXIMAGEPROC) internal::LazyResolve ("glGetTexImage") : OGLP_ENTRY (GetTexImage);
+    table->GetTexParameterfv = OGLP_ENTRY (GetTexParameterfv) == internal::Lazy_GetTexParameterfv
+        ? (PFNGLGETTEXPARAMETERFVPROC) internal::LazyResolve ("glGetTexParameterfv") : OGLP_ENTRY (GetTexParameterfv);
+    table->GetTexParameteriv = OGLP_ENTRY (GetTexParameteriv) == internal::Lazy_GetTexParameteriv
+        ? (PFNGLGETTEXPARAMETERIVPROC) internal::LazyResolve ("glGetTexParameteriv") : OGLP_ENTRY (GetTexParameteriv);
+    table->GetTexLevelParameterfv = OGLP_ENTRY (GetTexLevelParameterfv) == internal::Lazy_GetTexLevelParameterfv
+        ? (PFNGLGETTEXLEVELPARAMETERFVPROC) internal::LazyResolve ("glGetTexLevelParameterfv") : OGLP_ENTRY (GetTexLevelParameterfv);
+    table->GetTexLevelParameteriv = OGLP_ENTRY (GetTexLevelParameteriv) == internal::Lazy_GetTexLevelParameteriv
+        ? (PFNGLGETTEXLEVELPARAMETERIVPROC) internal::LazyResolve ("glGetTexLevelParameteriv") : OGLP_ENTRY (GetTexLevelParameteriv);
+    table->IsEnabled = OGLP_ENTRY (IsEnabled) == internal::Lazy_IsEnabled
+        ? (PFNGLISENABLEDPROC) internal::LazyResolve ("glIsEnabled") : OGLP_ENTRY (IsEnabled);
+    table->DepthRange = OGLP_ENTRY (DepthRange) == internal::Lazy_DepthRange
+        ? (PFNGLDEPTHRANGEPROC) internal::LazyResolve ("glDepthRange") : OGLP_ENTRY (DepthRange);
+    table->Viewport = OGLP_ENTRY (Viewport) == internal::Lazy_Viewport
+        ? (PFNGLVIEWPORTPROC) internal::LazyResolve ("glViewport") : OGLP_ENTRY (Viewport);
+    table->DrawArrays = OGLP_ENTRY (DrawArrays) == internal::Lazy_DrawArrays
+        ? (PFNGLDRAWARRAYSPROC) internal::LazyResolve ("glDrawArrays") : OGLP_ENTRY (DrawArrays);
+    table->DrawElements = OGLP_ENTRY (DrawElements) == internal::Lazy_DrawElements
+        ? (PFNGLDRAWELEMENTSPROC) internal::LazyResolve ("glDrawElements") : OGLP_ENTRY (DrawElements);
+    table->GetPointerv = OGLP_ENTRY (GetPointerv) == internal::Lazy_GetPointerv
+        ? (PFNGLGETPOINTERVPROC) internal::LazyResolve ("glGetPointerv") : OGLP_ENTRY (GetPointerv);
+    table->PolygonOffset = OGLP_ENTRY (PolygonOffset) == internal::Lazy_PolygonOffset
+        ? (PFNGLPOLYGONOFFSETPROC) internal::LazyResolve ("glPolygonOffset") : OGLP_ENTRY (PolygonOffset);
+    table->CopyTexImage1D = OGLP_ENTRY (CopyTexImage1D) == internal::Lazy_CopyTexImage1D
+        ? (PFNGLCOPYTEXIMAGE1DPROC) internal::LazyResolve ("glCopyTexImage1D") : OGLP_ENTRY (CopyTexImage1D);
+    table->CopyTexImage2D = OGLP_ENTRY (CopyTexImage2D) == internal::Lazy_CopyTexImage2D
+        ? (PFNGLCOPYTEXIMAGE2DPROC) internal::LazyResolve ("glCopyTexImage2D") : OGLP_ENTRY (CopyTexImage2D);
+    table->CopyTexSubImage1D = OGLP_ENTRY (CopyTexSubImage1D) == internal::Lazy_CopyTexSubImage1D
+        ? (PFNGLCOPYTEXSUBIMAGE1DPROC) internal::LazyResolve ("glCopyTexSubImage1D") : OGLP_ENTRY (CopyTexSubImage1D);
+    table->CopyTexSubImage2D = OGLP_ENTRY (CopyTexSubImage2D) == internal::Lazy_CopyTexSubImage2D
+        ? (PFNGLCOPYTEXSUBIMAGE2DPROC) internal::LazyResolve ("glCopyTexSubImage2D") : OGLP_ENTRY (CopyTexSubImage2D);
+    table->TexSubImage1D = OGLP_ENTRY (TexSubImage1D) == internal::Lazy_TexSubImage1D
+        ? (PFNGLTEXSUBIMAGE1DPROC) internal::LazyResolve ("glTexSubImage1D") : OGLP_ENTRY (TexSubImage1D);
+    table->TexSubImage2D = OGLP_ENTRY (TexSubImage2D) == internal::Lazy_TexSubImage2D
+        ? (PFNGLTEXSUBIMAGE2DPROC) internal::LazyResolve ("glTexSubImage2D") : OGLP_ENTRY (TexSubImage2D);
+    table->BindTexture = OGLP_ENTRY (BindTexture) == internal::Lazy_BindTexture
+        ? (PFNGLBINDTEXTUREPROC) internal::LazyResolve ("glBindTexture") : OGLP_ENTRY (BindTexture);
+    table->DeleteTextures = OGLP_ENTRY (DeleteTextures) == internal::Lazy_DeleteTextures
+        ? (PFNGLDELETETEXTURESPROC) internal::LazyResolve ("glDeleteTextures") : OGLP_ENTRY (DeleteTextures);
+    table->GenTextures = OGLP_ENTRY (GenTextures) == internal::Lazy_GenTextures
+        ? (PFNGLGENTEXTURESPROC) internal::LazyResolve ("glGenTextures") : OGLP_ENTRY (GenTextures);
+    table->IsTexture = OGLP_ENTRY (IsTexture) == internal::Lazy_IsTexture
+        ? (PFNGLISTEXTUREPROC) internal::LazyResolve ("glIsTexture") : OGLP_ENTRY (IsTexture);
+    table->DrawRangeElements = OGLP_ENTRY (DrawRangeElements) == internal::Lazy_DrawRangeElements
+        ? (PFNGLDRAWRANGEELEMENTSPROC) internal::LazyResolve ("glDrawRangeElements") : OGLP_ENTRY (DrawRangeElements);
+    table->TexImage3D = OGLP_ENTRY (TexImage3D) == internal::Lazy_TexImage3D
+        ? (PFNGLTEXIMAGE3DPROC) internal::LazyResolve ("glTexImage3D") : OGLP_ENTRY (TexImage3D);
+    table->TexSubImage3D = OGLP_ENTRY (TexSubImage3D) == internal::Lazy_TexSubImage3D
+        ? (PFNGLTEXSUBIMAGE3DPROC) internal::LazyResolve ("glTexSubImage3D") : OGLP_ENTRY (TexSubImage3D);
+    table->CopyTexSubImage3D = OGLP_ENTRY (CopyTexSubImage3D) == internal::Lazy_CopyTexSubImage3D
+        ? (PFNGLCOPYTEXSUBIMAGE3DPROC) internal::LazyResolve ("glCopyTexSubImage3D") : OGLP_ENTRY (CopyTexSubImage3D);
+    table->ActiveTexture = OGLP_ENTRY (ActiveTexture) == internal::Lazy_ActiveTexture
+        ? (PFNGLACTIVETEXTUREPROC) internal::LazyResolve ("glActiveTexture") : OGLP_ENTRY (ActiveTexture);
+    table->SampleCoverage = OGLP_ENTRY (SampleCoverage) == internal::Lazy_SampleCoverage
+        ? (PFNGLSAMPLECOVERAGEPROC) internal::LazyResolve ("glSampleCoverage") : OGLP_ENTRY (SampleCoverage);
+    table->CompressedTexImage3D = OGLP_ENTRY (CompressedTexImage3D) == internal::Lazy_CompressedTexImage3D
+        ? (PFNGLCOMPRESSEDTEXIMAGE3DPROC) internal::LazyResolve ("glCompressedTexImage3D") : OGLP_ENTRY (CompressedTexImage3D);
+    table->CompressedTexImage2D = OGLP_ENTRY (CompressedTexImage2D) == internal::Lazy_CompressedTexImage2D
+        ? (PFNGLCOMPRESSEDTEXIMAGE2DPROC) internal::LazyResolve ("glCompressedTexImage2D") : OGLP_ENTRY (CompressedTexImage2D);
+    table->CompressedTexImage1D = OGLP_ENTRY (CompressedTexImage1D) == internal::Lazy_CompressedTexImage1D
+        ? (PFNGLCOMPRESSEDTEXIMAGE1DPROC) internal::LazyResolve ("glCompressedTexImage1D") : OGLP_ENTRY (CompressedTexImage1D);
+    table->CompressedTexSubImage3D = OGLP_ENTRY (CompressedTexSubImage3D) == internal::Lazy_CompressedTexSubImage3D
+        ? (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC) internal::LazyResolve ("glCompressedTexSubImage3D") : OGLP_ENTRY (CompressedTexSubImage3D);
+    table->CompressedTexSubImage2D = OGLP_ENTRY (CompressedTexSubImage2D) == internal::Lazy_CompressedTexSubImage2D
+        ? (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC) internal::LazyResolve ("glCompressedTexSubImage2D") : OGLP_ENTRY (CompressedTexSubImage2D);
+    table->CompressedTexSubImage1D = OGLP_ENTRY (CompressedTexSubImage1D) == internal::Lazy_CompressedTexSubImage1D
+        ? (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC) internal::LazyResolve ("glCompressedTexSubImage1D") : OGLP_ENTRY (CompressedTexSubImage1D);
+    table->GetCompressedTexImage = OGLP_ENTRY (GetCompressedTexImage) == internal::Lazy_GetCompressedTexImage
+        ? (PFNGLGETCOMPRESSEDTEXIMAGEPROC) internal::LazyResolve ("glGetCompressedTexImage") : OGLP_ENTRY (GetCompressedTexImage);
+    table->BlendFuncSeparate = OGLP_ENTRY (BlendFuncSeparate) == internal::Lazy_BlendFuncSeparate
+        ? (PFNGLBLENDFUNCSEPARATEPROC) internal::LazyResolve ("glBlendFuncSeparate") : OGLP_ENTRY (BlendFuncSeparate);
+    table->MultiDrawArrays = OGLP_ENTRY (MultiDrawArrays) == internal::Lazy_MultiDrawArrays
+        ? (PFNGLMULTIDRAWARRAYSPROC) internal::LazyResolve ("glMultiDrawArrays") : OGLP_ENTRY (MultiDrawArrays);
+    table->MultiDrawElements = OGLP_ENTRY (MultiDrawElements) == internal::Lazy_MultiDrawElements
+        ? (PFNGLMULTIDRAWELEMENTSPROC) internal::LazyResolve ("glMultiDrawElements") : OGLP_ENTRY (MultiDrawElements);
+    table->PointParameterf = OGLP_ENTRY (PointParameterf) == internal::Lazy_PointParameterf
+        ? (PFNGLPOINTPARAMETERFPROC) internal::LazyResolve ("glPointParameterf") : OGLP_ENTRY (PointParameterf);
+    table->PointParameterfv = OGLP_ENTRY (PointParameterfv) == internal::Lazy_PointParameterfv
+        ? (PFNGLPOINTPARAMETERFVPROC) internal::LazyResolve ("glPointParameterfv") : OGLP_ENTRY (PointParameterfv);
+    table->PointParameteri = OGLP_ENTRY (PointParameteri) == internal::Lazy_PointParameteri
+        ? (PFNGLPOINTPARAMETERIPROC) internal::LazyResolve ("glPointParameteri") : OGLP_ENTRY (PointParameteri);
+    table->PointParameteriv = OGLP_ENTRY (PointParameteriv) == internal::Lazy_PointParameteriv
+        ? (PFNGLPOINTPARAMETERIVPROC) internal::LazyResolve ("glPointParameteriv") : OGLP_ENTRY (PointParameteriv);
+    table->BlendColor = OGLP_ENTRY (BlendColor) == internal::Lazy_BlendColor
+        ? (PFNGLBLENDCOLORPROC) internal::LazyResolve ("glBlendColor") : OGLP_ENTRY (BlendColor);
+    table->BlendEquation = OGLP_ENTRY (BlendEquation) == internal::Lazy_BlendEquation
+        ? (PFNGLBLENDEQUATIONPROC) internal::LazyResolve ("glBlendEquation") : OGLP_ENTRY (BlendEquation);
+    table->GenQueries = OGLP_ENTRY (GenQueries) == internal::Lazy_GenQueries
+        ? (PFNGLGENQUERIESPROC) internal::LazyResolve ("glGenQueries") : OGLP_ENTRY (GenQueries);
+    table->DeleteQueries = OGLP_ENTRY (DeleteQueries) == internal::Lazy_DeleteQueries
+        ? (PFNGLDELETEQUERIESPROC) internal::LazyResolve ("glDeleteQueries") : OGLP_ENTRY (DeleteQueries);
+    table->IsQuery = OGLP_ENTRY (IsQuery) == internal::Lazy_IsQuery
+        ? (PFNGLISQUERYPROC) internal::LazyResolve ("glIsQuery") : OGLP_ENTRY (IsQuery);
+    table->BeginQuery = OGLP_ENTRY (BeginQuery) == internal::Lazy_BeginQuery
+        ? (PFNGLBEGINQUERYPROC) internal::LazyResolve ("glBeginQuery") : OGLP_ENTRY (BeginQuery);
+    table->EndQuery = OGLP_ENTRY (EndQuery) == internal::Lazy_EndQuery
+        ? (PFNGLENDQUERYPROC) internal::LazyResolve ("glEndQuery") : OGLP_ENTRY (EndQuery);
+    table->GetQueryiv = OGLP_ENTRY (GetQueryiv) == internal::Lazy_GetQueryiv
+        ? (PFNGLGETQUERYIVPROC) internal::LazyResolve ("glGetQueryiv") : OGLP_ENTRY (GetQueryiv);
+    table->GetQueryObjectiv = OGLP_ENTRY (GetQueryObjectiv) == internal::Lazy_GetQueryObjectiv
+        ? (PFNGLGETQUERYOBJECTIVPROC) internal::LazyResolve ("glGetQueryObjectiv") : OGLP_ENTRY (GetQueryObjectiv);
+    table->GetQueryObjectuiv = OGLP_ENTRY (GetQueryObjectuiv) == internal::Lazy_GetQueryObjectuiv
+        ? (PFNGLGETQUERYOBJECTUIVPROC) internal::LazyResolve ("glGetQueryObjectuiv") : OGLP_ENTRY (GetQueryObjectuiv);
+    table->BindBuffer = OGLP_ENTRY (BindBuffer) == internal::Lazy_BindBuffer
+        ? (PFNGLBINDBUFFERPROC) internal::LazyResolve ("glBindBuffer") : OGLP_ENTRY (BindBuffer);
+    table->DeleteBuffers = OGLP_ENTRY (DeleteBuffers) == internal::Lazy_DeleteBuffers
+        ? (PFNGLDELETEBUFFERSPROC) internal::LazyResolve ("glDeleteBuffers") : OGLP_ENTRY (DeleteBuffers);
+    table->GenBuffers = OGLP_ENTRY (GenBuffers) == internal::Lazy_GenBuffers
+        ? (PFNGLGENBUFFERSPROC) internal::LazyResolve ("glGenBuffers") : OGLP_ENTRY (GenBuffers);
+    table->IsBuffer = OGLP_ENTRY (IsBuffer) == internal::Lazy_IsBuffer
+        ? (PFNGLISBUFFERPROC) internal::LazyResolve ("glIsBuffer") : OGLP_ENTRY (IsBuffer);
+    table->BufferData = OGLP_ENTRY (BufferData) == internal::Lazy_BufferData
+        ? (PFNGLBUFFERDATAPROC) internal::LazyResolve ("glBufferData") : OGLP_ENTRY (BufferData);
+    table->BufferSubData = OGLP_ENTRY (BufferSubData) == internal::Lazy_BufferSubData
+        ? (PFNGLBUFFERSUBDATAPROC) internal::LazyResolve ("glBufferSubData") : OGLP_ENTRY (BufferSubData);
+    table->GetBufferSubData = OGLP_ENTRY (GetBufferSubData) == internal::Lazy_GetBufferSubData
+        ? (PFNGLGETBUFFERSUBDATAPROC) internal::LazyResolve ("glGetBufferSubData") : OGLP_ENTRY (GetBufferSubData);
+    table->MapBuffer = OGLP_ENTRY (MapBuffer) == internal::Lazy_MapBuffer
+        ? (PFNGLMAPBUFFERPROC) internal::LazyResolve ("glMapBuffer") : OGLP_ENTRY (MapBuffer);
+    table->UnmapBuffer = OGLP_ENTRY (UnmapBuffer) == internal::Lazy_UnmapBuffer
+        ? (PFNGLUNMAPBUFFERPROC) internal::LazyResolve ("glUnmapBuffer") : OGLP_ENTRY (UnmapBuffer);
+    table->GetBufferParameteriv = OGLP_ENTRY (GetBufferParameteriv) == internal::Lazy_GetBufferParameteriv
+        ? (PFNGLGETBUFFERPARAMETERIVPROC) internal::LazyResolve ("glGetBufferParameteriv") : OGLP_ENTRY (GetBufferParameteriv);
+    table->GetBufferPointerv = OGLP_ENTRY (GetBufferPointerv) == internal::Lazy_GetBufferPointerv
+        ? (PFNGLGETBUFFERPOINTERVPROC) internal::LazyResolve ("glGetBufferPointerv") : OGLP_ENTRY (GetBufferPointerv);
+    table->BlendEquationSeparate = OGLP_ENTRY (BlendEquationSeparate) == internal::Lazy_BlendEquationSeparate
+        ? (PFNGLBLENDEQUATIONSEPARATEPROC) internal::LazyResolve ("glBlendEquationSeparate") : OGLP_ENTRY (BlendEquationSeparate);
+    table->DrawBuffers = OGLP_ENTRY (DrawBuffers) == internal::Lazy_DrawBuffers
+        ? (PFNGLDRAWBUFFERSPROC) internal::LazyResolve ("glDrawBuffers") : OGLP_ENTRY (DrawBuffers);
+    table->StencilOpSeparate = OGLP_ENTRY (StencilOpSeparate) == internal::Lazy_StencilOpSeparate
+        ? (PFNGLSTENCILOPSEPARATEPROC) internal::LazyResolve ("glStencilOpSeparate") : OGLP_ENTRY (StencilOpSeparate);
+    table->StencilFuncSeparate = OGLP_ENTRY (StencilFuncSeparate) == internal::Lazy_StencilFuncSeparate
+        ? (PFNGLSTENCILFUNCSEPARATEPROC) internal::LazyResolve ("glStencilFuncSeparate") : OGLP_ENTRY (StencilFuncSeparate);
+    table->StencilMaskSeparate = OGLP_ENTRY (StencilMaskSeparate) == internal::Lazy_StencilMaskSeparate
+        ? (PFNGLSTENCILMASKSEPARATEPROC) internal::LazyResolve ("glStencilMaskSeparate") : OGLP_ENTRY (StencilMaskSeparate);
+    table->AttachShader = OGLP_ENTRY (AttachShader) == internal::Lazy_AttachShader
+        ? (PFNGLATTACHSHADERPROC) internal::LazyResolve ("glAttachShader") : OGLP_ENTRY (AttachShader);
+    table->BindAttribLocation = OGLP_ENTRY (BindAttribLocation) == internal::Lazy_BindAttribLocation
+        ? (PFNGLBINDATTRIBLOCATIONPROC) internal::LazyResolve ("glBindAttribLocation") : OGLP_ENTRY (BindAttribLocation);
+    table->CompileShader = OGLP_ENTRY (CompileShader) == internal::Lazy_CompileShader
+        ? (PFNGLCOMPILESHADERPROC) internal::LazyResolve ("glCompileShader") : OGLP_ENTRY (CompileShader);
+    table->CreateProgram = OGLP_ENTRY (CreateProgram) == internal::Lazy_CreateProgram
+        ? (PFNGLCREATEPROGRAMPROC) internal::LazyResolve ("glCreateProgram") : OGLP_ENTRY (CreateProgram);
+    table->CreateShader = OGLP_ENTRY (CreateShader) == internal::Lazy_CreateShader
+        ? (PFNGLCREATESHADERPROC) internal::LazyResolve ("glCreateShader") : OGLP_ENTRY (CreateShader);
+    table->DeleteProgram = OGLP_ENTRY (DeleteProgram) == internal::Lazy_DeleteProgram
+        ? (PFNGLDELETEPROGRAMPROC) internal::LazyResolve ("glDeleteProgram") : OGLP_ENTRY (DeleteProgram);
+    table->DeleteShader = OGLP_ENTRY (DeleteShader) == internal::Lazy_DeleteShader
+        ? (PFNGLDELETESHADERPROC) internal::LazyResolve ("glDeleteShader") : OGLP_ENTRY (DeleteShader);
+    table->DetachShader = OGLP_ENTRY (DetachShader) == internal::Lazy_DetachShader
+        ? (PFNGLDETACHSHADERPROC) internal::LazyResolve ("glDetachShader") : OGLP_ENTRY (DetachShader);
+    table->DisableVertexAttribArray = OGLP_ENTRY (DisableVertexAttribArray) == internal::Lazy_DisableVertexAttribArray
+        ? (PFNGLDISABLEVERTEXATTRIBARRAYPROC) internal::LazyResolve ("glDisableVertexAttribArray") : OGLP_ENTRY (DisableVertexAttribArray);
+    table->EnableVertexAttribArray = OGLP_ENTRY (EnableVertexAttribArray) == internal::Lazy_EnableVertexAttribArray
+        ? (PFNGLENABLEVERTEXATTRIBARRAYPROC) internal::LazyResolve ("glEnableVertexAttribArray") : OGLP_ENTRY (EnableVertexAttribArray);
+    table->GetActiveAttrib = OGLP_ENTRY (GetActiveAttrib) == internal::Lazy_GetActiveAttrib
+        ? (PFNGLGETACTIVEATTRIBPROC) internal::LazyResolve ("glGetActiveAttrib") : OGLP_ENTRY (GetActiveAttrib);
+    table->GetActiveUniform = OGLP_ENTRY (GetActiveUniform) == internal::Lazy_GetActiveUniform
+        ? (PFNGLGETACTIVEUNIFORMPROC) internal::LazyResolve ("glGetActiveUniform") : OGLP_ENTRY (GetActiveUniform);
+    table->GetAttachedShaders = OGLP_ENTRY (GetAttachedShaders) == internal::Lazy_GetAttachedShaders
+        ? (PFNGLGETATTACHEDSHADERSPROC) internal::LazyResolve ("glGetAttachedShaders") : OGLP_ENTRY (GetAttachedShaders);
+    table->GetAttribLocation = OGLP_ENTRY (GetAttribLocation) == internal::Lazy_GetAttribLocation
+        ? (PFNGLGETATTRIBLOCATIONPROC) internal::LazyResolve ("glGetAttribLocation") : OGLP_ENTRY (GetAttribLocation);
+    table->GetProgramiv = OGLP_ENTRY (GetProgramiv) == internal::Lazy_GetProgramiv
+        ? (PFNGLGETPROGRAMIVPROC) internal::LazyResolve ("glGetProgramiv") : OGLP_ENTRY (GetProgramiv);
+    table->GetProgramInfoLog = OGLP_ENTRY (GetProgramInfoLog) == internal::Lazy_GetProgramInfoLog
+        ? (PFNGLGETPROGRAMINFOLOGPROC) internal::LazyResolve ("glGetProgramInfoLog") : OGLP_ENTRY (GetProgramInfoLog);
+    table->GetShaderiv = OGLP_ENTRY (GetShaderiv) == internal::Lazy_GetShaderiv
+        ? (PFNGLGETSHADERIVPROC) internal::LazyResolve ("glGetShaderiv") : OGLP_ENTRY (GetShaderiv);
+    table->GetShaderInfoLog = OGLP_ENTRY (GetShaderInfoLog) == internal::Lazy_GetShaderInfoLog
+        ? (PFNGLGETSHADERINFOLOGPROC) internal::LazyResolve ("glGetShaderInfoLog") : OGLP_ENTRY (GetShaderInfoLog);
+    table->GetShaderSource = OGLP_ENTRY (GetShaderSource) == internal::Lazy_GetShaderSource
+        ? (PFNGLGETSHADERSOURCEPROC) internal::LazyResolve ("glGetShaderSource") : OGLP_ENTRY (GetShaderSource);
+    table->GetUniformLocation = OGLP_ENTRY (GetUniformLocation) == internal::Lazy_GetUniformLocation
+        ? (PFNGLGETUNIFORMLOCATIONPROC) internal::LazyResolve ("glGetUniformLocation") : OGLP_ENTRY (GetUniformLocation);
+    table->GetUniformfv = OGLP_ENTRY (GetUniformfv) == internal::Lazy_GetUniformfv
+        ? (PFNGLGETUNIFORMFVPROC) internal::LazyResolve ("glGetUniformfv") : OGLP_ENTRY (GetUniformfv);
+    table->GetUniformiv = OGLP_ENTRY (GetUniformiv) == internal::Lazy_GetUniformiv
+        ? (PFNGLGETUNIFORMIVPROC) internal::LazyResolve ("glGetUniformiv") : OGLP_ENTRY (GetUniformiv);
+    table->GetVertexAttribdv = OGLP_ENTRY (GetVertexAttribdv) == internal::Lazy_GetVertexAttribdv
+        ? (PFNGLGETVERTEXATTRIBDVPROC) internal::LazyResolve ("glGetVertexAttribdv") : OGLP_ENTRY (GetVertexAttribdv);
+    table->GetVertexAttribfv = OGLP_ENTRY (GetVertexAttribfv) == internal::Lazy_GetVertexAttribfv
+        ? (PFNGLGETVERTEXATTRIBFVPROC) internal::LazyResolve ("glGetVertexAttribfv") : OGLP_ENTRY (GetVertexAttribfv);
+    table->GetVertexAttribiv = OGLP_ENTRY (GetVertexAttribiv) == internal::Lazy_GetVertexAttribiv
+        ? (PFNGLGETVERTEXATTRIBIVPROC) internal::LazyResolve ("glGetVertexAttribiv") : OGLP_ENTRY (GetVertexAttribiv);
+    table->GetVertexAttribPointerv = OGLP_ENTRY (GetVertexAttribPointerv) == internal::Lazy_GetVertexAttribPointerv
+        ? (PFNGLGETVERTEXATTRIBPOINTERVPROC) internal::LazyResolve ("glGetVertexAttribPointerv") : OGLP_ENTRY (GetVertexAttribPointerv);
+    table->IsProgram = OGLP_ENTRY (IsProgram) == internal::Lazy_IsProgram
+        ? (PFNGLISPROGRAMPROC) internal::LazyResolve ("glIsProgram") : OGLP_ENTRY (IsProgram);
+    table->IsShader = OGLP_ENTRY (IsShader) == internal::Lazy_IsShader
+        ? (PFNGLISSHADERPROC) internal::LazyResolve ("glIsShader") : OGLP_ENTRY (IsShader);
+    table->LinkProgram = OGLP_ENTRY (LinkProgram) == internal::Lazy_LinkProgram
+        ? (PFNGLLINKPROGRAMPROC) internal::LazyResolve ("glLinkProgram") : OGLP_ENTRY (LinkProgram);
+    table->ShaderSource = OGLP_ENTRY (ShaderSource) == internal::Lazy_ShaderSource
+        ? (PFNGLSHADERSOURCEPROC) internal::LazyResolve ("glShaderSource") : OGLP_ENTRY (ShaderSource);
+    table->UseProgram = OGLP_ENTRY (UseProgram) == internal::Lazy_UseProgram
+        ? (PFNGLUSEPROGRAMPROC) internal::LazyResolve ("glUseProgram") : OGLP_ENTRY (UseProgram);
+    table->Uniform1f = OGLP_ENTRY (Uniform1f) == internal::Lazy_Uniform1f
+        ? (PFNGLUNIFORM1FPROC) internal::LazyResolve ("glUniform1f") : OGLP_ENTRY (Uniform1f);
+    table->Uniform2f = OGLP_ENTRY (Uniform2f) == internal::Lazy_Uniform2f
+        ? (PFNGLUNIFORM2FPROC) internal::LazyResolve ("glUniform2f") : OGLP_ENTRY (Uniform2f);
+    table->Uniform3f = OGLP_ENTRY (Uniform3f) == internal::Lazy_Uniform3f
+        ? (PFNGLUNIFORM3FPROC) internal::LazyResolve ("glUniform3f") : OGLP_ENTRY (Uniform3f);
+    table->Uniform4f = OGLP_ENTRY (Uniform4f) == internal::Lazy_Uniform4f
+        ? (PFNGLUNIFORM4FPROC) internal::LazyResolve ("glUniform4f") : OGLP_ENTRY (Uniform4f);
+    table->Uniform1i = OGLP_ENTRY (Uniform1i) == internal::Lazy_Uniform1i
+        ? (PFNGLUNIFORM1IPROC) internal::LazyResolve ("glUniform1i") : OGLP_ENTRY (Uniform1i);
+    table->Uniform2i = OGLP_ENTRY (Uniform2i) == internal::Lazy_Uniform2i
+        ? (PFNGLUNIFORM2IPROC) internal::LazyResolve ("glUniform2i") : OGLP_ENTRY (Uniform2i);
+    table->Uniform3i = OGLP_ENTRY (Uniform3i) == internal::Lazy_Uniform3i
+        ? (PFNGLUNIFORM3IPROC) internal::LazyResolve ("glUniform3i") : OGLP_ENTRY (Uniform3i);
+    table->Uniform4i = OGLP_ENTRY (Uniform4i) == internal::Lazy_Uniform4i
+        ? (PFNGLUNIFORM4IPROC) internal::LazyResolve ("glUniform4i") : OGLP_ENTRY (Uniform4i);
+    table->Uniform1fv = OGLP_ENTRY (Uniform1fv) == internal::Lazy_Uniform1fv
+        ? (PFNGLUNIFORM1FVPROC) internal::LazyResolve ("glUniform1fv") : OGLP_ENTRY (Uniform1fv);
+    table->Uniform2fv = OGLP_ENTRY (Uniform2fv) == internal::Lazy_Uniform2fv
+        ? (PFNGLUNIFORM2FVPROC) internal::LazyResolve ("glUniform2fv") : OGLP_ENTRY (Uniform2fv);
+    table->Uniform3fv = OGLP_ENTRY (Uniform3fv) == internal::Lazy_Uniform3fv
+        ? (PFNGLUNIFORM3FVPROC) internal::LazyResolve ("glUniform3fv") : OGLP_ENTRY (Uniform3fv);
+    table->Uniform4fv = OGLP_ENTRY (Uniform4fv) == internal::Lazy_Uniform4fv
+        ? (PFNGLUNIFORM4FVPROC) internal::LazyResolve ("glUniform4fv") : OGLP_ENTRY (Uniform4fv);
+    table->Uniform1iv = OGLP_ENTRY (Uniform1iv) == internal::Lazy_Uniform1iv
+        ? (PFNGLUNIFORM1IVPROC) internal::LazyResolve ("glUniform1iv") : OGLP_ENTRY (Uniform1iv);
+    table->Uniform2iv = OGLP_ENTRY (Uniform2iv) == internal::Lazy_Uniform2iv
+        ? (PFNGLUNIFORM2IVPROC) internal::LazyResolve ("glUniform2iv") : OGLP_ENTRY (Uniform2iv);
+    table->Uniform3iv = OGLP_ENTRY (Uniform3iv) == internal::Lazy_Uniform3iv
+        ? (PFNGLUNIFORM3IVPROC) internal::LazyResolve ("glUniform3iv") : OGLP_ENTRY (Uniform3iv);
+    table->Uniform4iv = OGLP_ENTRY (Uniform4iv) == internal::Lazy_Uniform4iv
+        ? (PFNGLUNIFORM4IVPROC) internal::LazyResolve ("glUniform4iv") : OGLP_ENTRY (Uniform4iv);
+    table->UniformMatrix2fv = OGLP_ENTRY (UniformMatrix2fv) == internal::Lazy_UniformMatrix2fv
+        ? (PFNGLUNIFORMMATRIX2FVPROC) internal::LazyResolve ("glUniformMatrix2fv") : OGLP_ENTRY (UniformMatrix2fv);
+    table->UniformMatrix3fv = OGLP_ENTRY (UniformMatrix3fv) == internal::Lazy_UniformMatrix3fv
+        ? (PFNGLUNIFORMMATRIX3FVPROC) internal::LazyResolve ("glUniformMatrix3fv") : OGLP_ENTRY (UniformMatrix3fv);
+    table->UniformMatrix4fv = OGLP_ENTRY (UniformMatrix4fv) == internal::Lazy_UniformMatrix4fv
+        ? (PFNGLUNIFORMMATRIX4FVPROC) internal::LazyResolve ("glUniformMatrix4fv") : OGLP_ENTRY (UniformMatrix4fv);
+    table->ValidateProgram = OGLP_ENTRY (ValidateProgram) == internal::Lazy_ValidateProgram
+        ? (PFNGLVALIDATEPROGRAMPROC) internal::LazyResolve ("glValidateProgram") : OGLP_ENTRY (ValidateProgram);
+    table->VertexAttrib1d = OGLP_ENTRY (VertexAttrib1d) == internal::Lazy_VertexAttrib1d
+        ? (PFNGLVERTEXATTRIB1DPROC) internal::LazyResolve ("glVertexAttrib1d") : OGLP_ENTRY (VertexAttrib1d);
+    table->VertexAttrib1dv = OGLP_ENTRY (VertexAttrib1dv) == internal::Lazy_VertexAttrib1dv
+        ? (PFNGLVERTEXATTRIB1DVPROC) internal::LazyResolve ("glVertexAttrib1dv") : OGLP_ENTRY (VertexAttrib1dv);
+    table->VertexAttrib1f = OGLP_ENTRY (VertexAttrib1f) == internal::Lazy_VertexAttrib1f
+        ? (PFNGLVERTEXATTRIB1FPROC) internal::LazyResolve ("glVertexAttrib1f") : OGLP_ENTRY (VertexAttrib1f);
+    table->VertexAttrib1fv = OGLP_ENTRY (VertexAttrib1fv) == internal::Lazy_VertexAttrib1fv
+        ? (PFNGLVERTEXATTRIB1FVPROC) internal::LazyResolve ("glVertexAttrib1fv") : OGLP_ENTRY (VertexAttrib1fv);
+    table->VertexAttrib1s = OGLP_ENTRY (VertexAttrib1s) == internal::Lazy_VertexAttrib1s
+        ? (PFNGLVERTEXATTRIB1SPROC) internal::LazyResolve ("glVertexAttrib1s") : OGLP_ENTRY (VertexAttrib1s);
+    table->VertexAttrib1sv = OGLP_ENTRY (VertexAttrib1sv) == internal::Lazy_VertexAttrib1sv
+        ? (PFNGLVERTEXATTRIB1SVPROC) internal::LazyResolve ("glVertexAttrib1sv") : OGLP_ENTRY (VertexAttrib1sv);
+    table->VertexAttrib2d = OGLP_ENTRY (VertexAttrib2d) == internal::Lazy_VertexAttrib2d
+        ? (PFNGLVERTEXATTRIB2DPROC) internal::LazyResolve ("glVertexAttrib2d") : OGLP_ENTRY (VertexAttrib2d);
+    table->VertexAttrib2dv = OGLP_ENTRY (VertexAttrib2dv) == internal::Lazy_VertexAttrib2dv
+        ? (PFNGLVERTEXATTRIB2DVPROC) internal::LazyResolve ("glVertexAttrib2dv") : OGLP_ENTRY (VertexAttrib2dv);
+    table->VertexAttrib2f = OGLP_ENTRY (VertexAttrib2f) == internal::Lazy_VertexAttrib2f
+        ? (PFNGLVERTEXATTRIB2FPROC) internal::LazyResolve ("glVertexAttrib2f") : OGLP_ENTRY (VertexAttrib2f);
+    table->VertexAttrib2fv = OGLP_ENTRY (VertexAttrib2fv) == internal::Lazy_VertexAttrib2fv
+        ? (PFNGLVERTEXATTRIB2FVPROC) internal::LazyResolve ("glVertexAttrib2fv") : OGLP_ENTRY (VertexAttrib2fv);
+    table->VertexAttrib2s = OGLP_ENTRY (VertexAttrib2s) == internal::Lazy_VertexAttrib2s
+        ? (PFNGLVERTEXATTRIB2SPROC) internal::LazyResolve ("glVertexAttrib2s") : OGLP_ENTRY (VertexAttrib2s);
+    table->VertexAttrib2sv = OGLP_ENTRY (VertexAttrib2sv) == internal::Lazy_VertexAttrib2sv
+        ? (PFNGLVERTEXATTRIB2SVPROC) internal::LazyResolve ("glVertexAttrib2sv") : OGLP_ENTRY (VertexAttrib2sv);
+    table->VertexAttrib3d = OGLP_ENTRY (VertexAttrib3d) == internal::Lazy_VertexAttrib3d
+        ? (PFNGLVERTEXATTRIB3DPROC) internal::LazyResolve ("glVertexAttrib3d") : OGLP_ENTRY (VertexAttrib3d);
+    table->VertexAttrib3dv = OGLP_ENTRY (VertexAttrib3dv) == internal::Lazy_VertexAttrib3dv
+        ? (PFNGLVERTEXATTRIB3DVPROC) internal::LazyResolve ("glVertexAttrib3dv") : OGLP_ENTRY (VertexAttrib3dv);
+    table->VertexAttrib3f = OGLP_ENTRY (VertexAttrib3f) == internal::Lazy_VertexAttrib3f
+        ? (PFNGLVERTEXATTRIB3FPROC) internal::LazyResolve ("glVertexAttrib3f") : OGLP_ENTRY (VertexAttrib3f);
+    table->VertexAttrib3fv = OGLP_ENTRY (VertexAttrib3fv) == internal::Lazy_VertexAttrib3fv
+        ? (PFNGLVERTEXATTRIB3FVPROC) internal::LazyResolve ("glVertexAttrib3fv") : OGLP_ENTRY (VertexAttrib3fv);
+    table->VertexAttrib3s = OGLP_ENTRY (VertexAttrib3s) == internal::Lazy_VertexAttrib3s
+        ? (PFNGLVERTEXATTRIB3SPROC) internal::LazyResolve ("glVertexAttrib3s") : OGLP_ENTRY (VertexAttrib3s);
+    table->VertexAttrib3sv = OGLP_ENTRY (VertexAttrib3sv) == internal::Lazy_VertexAttrib3sv
+        ? (PFNGLVERTEXATTRIB3SVPROC) internal::LazyResolve ("glVertexAttrib3sv") : OGLP_ENTRY (VertexAttrib3sv);
+    table->VertexAttrib4Nbv = OGLP_ENTRY (VertexAttrib4Nbv) == internal::Lazy_VertexAttrib4Nbv
+        ? (PFNGLVERTEXATTRIB4NBVPROC) internal::LazyResolve ("glVertexAttrib4Nbv") : OGLP_ENTRY (VertexAttrib4Nbv);
+    table->VertexAttrib4Niv = OGLP_ENTRY (VertexAttrib4Niv) == internal::Lazy_VertexAttrib4Niv
+        ? (PFNGLVERTEXATTRIB4NIVPROC) internal::LazyResolve ("glVertexAttrib4Niv") : OGLP_ENTRY (VertexAttrib4Niv);
+    table->VertexAttrib4Nsv = OGLP_ENTRY (VertexAttrib4Nsv) == internal::Lazy_VertexAttrib4Nsv
+        ? (PFNGLVERTEXATTRIB4NSVPROC) internal::LazyResolve ("glVertexAttrib4Nsv") : OGLP_ENTRY (VertexAttrib4Nsv);
+    table->VertexAttrib4Nub = OGLP_ENTRY (VertexAttrib4Nub) == internal::Lazy_VertexAttrib4Nub
+        ? (PFNGLVERTEXATTRIB4NUBPROC) internal::LazyResolve ("glVertexAttrib4Nub") : OGLP_ENTRY (VertexAttrib4Nub);
+    table->VertexAttrib4Nubv = OGLP_ENTRY (VertexAttrib4Nubv) == internal::Lazy_VertexAttrib4Nubv
+        ? (PFNGLVERTEXATTRIB4NUBVPROC) internal::LazyResolve ("glVertexAttrib4Nubv") : OGLP_ENTRY (VertexAttrib4Nubv);
+    table->VertexAttrib4Nuiv = OGLP_ENTRY (VertexAttrib4Nuiv) == internal::Lazy_VertexAttrib4Nuiv
+        ? (PFNGLVERTEXATTRIB4NUIVPROC) internal::LazyResolve ("glVertexAttrib4Nuiv") : OGLP_ENTRY (VertexAttrib4Nuiv);
+    table->VertexAttrib4Nusv = OGLP_ENTRY (VertexAttrib4Nusv) == internal::Lazy_VertexAttrib4Nusv
+        ? (PFNGLVERTEXATTRIB4NUSVPROC) internal::LazyResolve ("glVertexAttrib4Nusv") : OGLP_ENTRY (VertexAttrib4Nusv);
+    table->VertexAttrib4bv = OGLP_ENTRY (VertexAttrib4bv) == internal::Lazy_VertexAttrib4bv
+        ? (PFNGLVERTEXATTRIB4BVPROC) internal::LazyResolve ("glVertexAttrib4bv") : OGLP_ENTRY (VertexAttrib4bv);
+    table->VertexAttrib4d = OGLP_ENTRY (VertexAttrib4d) == internal::Lazy_VertexAttrib4d
+        ? (PFNGLVERTEXATTRIB4DPROC) internal::LazyResolve ("glVertexAttrib4d") : OGLP_ENTRY (VertexAttrib4d);
+    table->VertexAttrib4dv = OGLP_ENTRY (VertexAttrib4dv) == internal::Lazy_VertexAttrib4dv
+        ? (PFNGLVERTEXATTRIB4DVPROC) internal::LazyResolve ("glVertexAttrib4dv") : OGLP_ENTRY (VertexAttrib4dv);
+    table->VertexAttrib4f = OGLP_ENTRY (VertexAttrib4f) == internal::Lazy_VertexAttrib4f
+        ? (PFNGLVERTEXATTRIB4FPROC) internal::LazyResolve ("glVertexAttrib4f") : OGLP_ENTRY (VertexAttrib4f);
+    table->VertexAttrib4fv = OGLP_ENTRY (VertexAttrib4fv) == internal::Lazy_VertexAttrib4fv
+        ? (PFNGLVERTEXATTRIB4FVPROC) internal::LazyResolve ("glVertexAttrib4fv") : OGLP_ENTRY (VertexAttrib4fv);
+    table->VertexAttrib4iv = OGLP_ENTRY (VertexAttrib4iv) == internal::Lazy_VertexAttrib4iv
+        ? (PFNGLVERTEXATTRIB4IVPROC) internal::LazyResolve ("glVertexAttrib4iv") : OGLP_ENTRY (VertexAttrib4iv);
+    table->VertexAttrib4s = OGLP_ENTRY (VertexAttrib4s) == internal::Lazy_VertexAttrib4s
+        ? (PFNGLVERTEXATTRIB4SPROC) internal::LazyResolve ("glVertexAttrib4s") : OGLP_ENTRY (VertexAttrib4s);
+    table->VertexAttrib4sv = OGLP_ENTRY (VertexAttrib4sv) == internal::Lazy_VertexAttrib4sv
+        ? (PFNGLVERTEXATTRIB4SVPROC) internal::LazyResolve ("glVertexAttrib4sv") : OGLP_ENTRY (VertexAttrib4sv);
+    table->VertexAttrib4ubv = OGLP_ENTRY (VertexAttrib4ubv) == internal::Lazy_VertexAttrib4ubv
+        ? (PFNGLVERTEXATTRIB4UBVPROC) internal::LazyResolve ("glVertexAttrib4ubv") : OGLP_ENTRY (VertexAttrib4ubv);
+    table->VertexAttrib4uiv = OGLP_ENTRY (VertexAttrib4uiv) == internal::Lazy_VertexAttrib4uiv
+        ? (PFNGLVERTEXATTRIB4UIVPROC) internal::LazyResolve ("glVertexAttrib4uiv") : OGLP_ENTRY (VertexAttrib4uiv);
+    table->VertexAttrib4usv = OGLP_ENTRY (VertexAttrib4usv) == internal::Lazy_VertexAttrib4usv
+        ? (PFNGLVERTEXATTRIB4USVPROC) internal::LazyResolve ("glVertexAttrib4usv") : OGLP_ENTRY (VertexAttrib4usv);
+    table->VertexAttribPointer = OGLP_ENTRY (VertexAttribPointer) == internal::Lazy_VertexAttribPointer
+        ? (PFNGLVERTEXATTRIBPOINTERPROC) internal::LazyResolve ("glVertexAttribPointer") : OGLP_ENTRY (VertexAttribPointer);
+    table->UniformMatrix2x3fv = OGLP_ENTRY (UniformMatrix2x3fv) == internal::Lazy_UniformMatrix2x3fv
+        ? (PFNGLUNIFORMMATRIX2X3FVPROC) internal::LazyResolve ("glUniformMatrix2x3fv") : OGLP_ENTRY (UniformMatrix2x3fv);
+    table->UniformMatrix3x2fv = OGLP_ENTRY (UniformMatrix3x2fv) == internal::Lazy_UniformMatrix3x2fv
+        ? (PFNGLUNIFORMMATRIX3X2FVPROC) internal::LazyResolve ("glUniformMatrix3x2fv") : OGLP_ENTRY (UniformMatrix3x2fv);
+    table->UniformMatrix2x4fv = OGLP_ENTRY (UniformMatrix2x4fv) == internal::Lazy_UniformMatrix2x4fv
+        ? (PFNGLUNIFORMMATRIX2X4FVPROC) internal::LazyResolve ("glUniformMatrix2x4fv") : OGLP_ENTRY (UniformMatrix2x4fv);
+    table->UniformMatrix4x2fv = OGLP_ENTRY (UniformMatrix4x2fv) == internal::Lazy_UniformMatrix4x2fv
+        ? (PFNGLUNIFORMMATRIX4X2FVPROC) internal::LazyResolve ("glUniformMatrix4x2fv") : OGLP_ENTRY (UniformMatrix4x2fv);
+    table->UniformMatrix3x4fv = OGLP_ENTRY (UniformMatrix3x4fv) == internal::Lazy_UniformMatrix3x4fv
+        ? (PFNGLUNIFORMMATRIX3X4FVPROC) internal::LazyResolve ("glUniformMatrix3x4fv") : OGLP_ENTRY (UniformMatrix3x4fv);
+    table->UniformMatrix4x3fv = OGLP_ENTRY (UniformMatrix4x3fv) == internal::Lazy_UniformMatrix4x3fv
+        ? (PFNGLUNIFORMMATRIX4X3FVPROC) internal::LazyResolve ("glUniformMatrix4x3fv") : OGLP_ENTRY (UniformMatrix4x3fv);
+    table->ColorMaski = OGLP_ENTRY (ColorMaski) == internal::Lazy_ColorMaski
+        ? (PFNGLCOLORMASKIPROC) internal::LazyResolve ("glColorMaski") : OGLP_ENTRY (ColorMaski);
+    table->GetBooleani_v = OGLP_ENTRY (GetBooleani_v) == internal::Lazy_GetBooleani_v
+        ? (PFNGLGETBOOLEANI_VPROC) internal::LazyResolve ("glGetBooleani_v") : OGLP_ENTRY (GetBooleani_v);
+    table->GetIntegeri_v = OGLP_ENTRY (GetIntegeri_v) == internal::Lazy_GetIntegeri_v
+        ? (PFNGLGETINTEGERI_VPROC) internal::LazyResolve ("glGetIntegeri_v") : OGLP_ENTRY (GetIntegeri_v);
+    table->Enablei = OGLP_ENTRY (Enablei) == internal::Lazy_Enablei
+        ? (PFNGLENABLEIPROC) internal::LazyResolve ("glEnablei") : OGLP_ENTRY (Enablei);
+    table->Disablei = OGLP_ENTRY (Disablei) == internal::Lazy_Disablei
+        ? (PFNGLDISABLEIPROC) internal::LazyResolve ("glDisablei") : OGLP_ENTRY (Disablei);
+    table->IsEnabledi = OGLP_ENTRY (IsEnabledi) == internal::Lazy_IsEnabledi
+        ? (PFNGLISENABLEDIPROC) internal::LazyResolve ("glIsEnabledi") : OGLP_ENTRY (IsEnabledi);
+    table->BeginTransformFeedback = OGLP_ENTRY (BeginTransformFeedback) == internal::Lazy_BeginTransformFeedback
+        ? (PFNGLBEGINTRANSFORMFEEDBACKPROC) internal::LazyResolve ("glBeginTransformFeedback") : OGLP_ENTRY (BeginTransformFeedback);
+    table->EndTransformFeedback = OGLP_ENTRY (EndTransformFeedback) == internal::Lazy_EndTransformFeedback
+        ? (PFNGLENDTRANSFORMFEEDBACKPROC) internal::LazyResolve ("glEndTransformFeedback") : OGLP_ENTRY (EndTransformFeedback);
+    table->BindBufferRange = OGLP_ENTRY (BindBufferRange) == internal::Lazy_BindBufferRange
+        ? (PFNGLBINDBUFFERRANGEPROC) internal::LazyResolve ("glBindBufferRange") : OGLP_ENTRY (BindBufferRange);
+    table->BindBufferBase = OGLP_ENTRY (BindBufferBase) == internal::Lazy_BindBufferBase
+        ? (PFNGLBINDBUFFERBASEPROC) internal::LazyResolve ("glBindBufferBase") : OGLP_ENTRY (BindBufferBase);
+    table->TransformFeedbackVaryings = OGLP_ENTRY (TransformFeedbackVaryings) == internal::Lazy_TransformFeedbackVaryings
+        ? (PFNGLTRANSFORMFEEDBACKVARYINGSPROC) internal::LazyResolve ("glTransformFeedbackVaryings") : OGLP_ENTRY (TransformFeedbackVaryings);
+    table->GetTransformFeedbackVarying = OGLP_ENTRY (GetTransformFeedbackVarying) == internal::Lazy_GetTransformFeedbackVarying
+        ? (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC) internal::LazyResolve ("glGetTransformFeedbackVarying") : OGLP_ENTRY (GetTransformFeedbackVarying);
+    table->ClampColor = OGLP_ENTRY (ClampColor) == internal::Lazy_ClampColor
+        ? (PFNGLCLAMPCOLORPROC) internal::LazyResolve ("glClampColor") : OGLP_ENTRY (ClampColor);
+    table->BeginConditionalRender = OGLP_ENTRY (BeginConditionalRender) == internal::Lazy_BeginConditionalRender
+        ? (PFNGLBEGINCONDITIONALRENDERPROC) internal::LazyResolve ("glBeginConditionalRender") : OGLP_ENTRY (BeginConditionalRender);
+    table->EndConditionalRender = OGLP_ENTRY (EndConditionalRender) == internal::Lazy_EndConditionalRender
+        ? (PFNGLENDCONDITIONALRENDERPROC) internal::LazyResolve ("glEndConditionalRender") : OGLP_ENTRY (EndConditionalRender);
+    table->VertexAttribIPointer = OGLP_ENTRY (VertexAttribIPointer) == internal::Lazy_VertexAttribIPointer
+        ? (PFNGLVERTEXATTRIBIPOINTERPROC) internal::LazyResolve ("glVertexAttribIPointer") : OGLP_ENTRY (VertexAttribIPointer);
+    table->GetVertexAttribIiv = OGLP_ENTRY (GetVertexAttribIiv) == internal::Lazy_GetVertexAttribIiv
+        ? (PFNGLGETVERTEXATTRIBIIVPROC) internal::LazyResolve ("glGetVertexAttribIiv") : OGLP_ENTRY (GetVertexAttribIiv);
+    table->GetVertexAttribIuiv = OGLP_ENTRY (GetVertexAttribIuiv) == internal::Lazy_GetVertexAttribIuiv
+        ? (PFNGLGETVERTEXATTRIBIUIVPROC) internal::LazyResolve ("glGetVertexAttribIuiv") : OGLP_ENTRY (GetVertexAttribIuiv);
+    table->VertexAttribI1i = OGLP_ENTRY (VertexAttribI1i) == internal::Lazy_VertexAttribI1i
+        ? (PFNGLVERTEXATTRIBI1IPROC) internal::LazyResolve ("glVertexAttribI1i") : OGLP_ENTRY (VertexAttribI1i);
+    table->VertexAttribI2i = OGLP_ENTRY (VertexAttribI2i) == internal::Lazy_VertexAttribI2i
+        ? (PFNGLVERTEXATTRIBI2IPROC) internal::LazyResolve ("glVertexAttribI2i") : OGLP_ENTRY (VertexAttribI2i);
+    table->VertexAttribI3i = OGLP_ENTRY (VertexAttribI3i) == internal::Lazy_VertexAttribI3i
+        ? (PFNGLVERTEXATTRIBI3IPROC) internal::LazyResolve ("glVertexAttribI3i") : OGLP_ENTRY (VertexAttribI3i);
+    table->VertexAttribI4i = OGLP_ENTRY (VertexAttribI4i) == internal::Lazy_VertexAttribI4i
+        ? (PFNGLVERTEXATTRIBI4IPROC) internal::LazyResolve ("glVertexAttribI4i") : OGLP_ENTRY (VertexAttribI4i);
+    table->VertexAttribI1ui = OGLP_ENTRY (VertexAttribI1ui) == internal::Lazy_VertexAttribI1ui
+        ? (PFNGLVERTEXATTRIBI1UIPROC) internal::LazyResolve ("glVertexAttribI1ui") : OGLP_ENTRY (VertexAttribI1ui);
+    table->VertexAttribI2ui = OGLP_ENTRY (VertexAttribI2ui) == internal::Lazy_VertexAttribI2ui
+        ? (PFNGLVERTEXATTRIBI2UIPROC) internal::LazyResolve ("glVertexAttribI2ui") : OGLP_ENTRY (VertexAttribI2ui);
+    table->VertexAttribI3ui = OGLP_ENTRY (VertexAttribI3ui) == internal::Lazy_VertexAttribI3ui
+        ? (PFNGLVERTEXATTRIBI3UIPROC) internal::LazyResolve ("glVertexAttribI3ui") : OGLP_ENTRY (VertexAttribI3ui);
+    table->VertexAttribI4ui = OGLP_ENTRY (VertexAttribI4ui) == internal::Lazy_VertexAttribI4ui
+        ? (PFNGLVERTEXATTRIBI4UIPROC) internal::LazyResolve ("glVertexAttribI4ui") : OGLP_ENTRY (VertexAttribI4ui);
+    table->VertexAttribI1iv = OGLP_ENTRY (VertexAttribI1iv) == internal::Lazy_VertexAttribI1iv
+        ? (PFNGLVERTEXATTRIBI1IVPROC) internal::LazyResolve ("glVertexAttribI1iv") : OGLP_ENTRY (VertexAttribI1iv);
+    table->VertexAttribI2iv = OGLP_ENTRY (VertexAttribI2iv) == internal::Lazy_VertexAttribI2iv
+        ? (PFNGLVERTEXATTRIBI2IVPROC) internal::LazyResolve ("glVertexAttribI2iv") : OGLP_ENTRY (VertexAttribI2iv);
+    table->VertexAttribI3iv = OGLP_ENTRY (VertexAttribI3iv) == internal::Lazy_VertexAttribI3iv
+        ? (PFNGLVERTEXATTRIBI3IVPROC) internal::LazyResolve ("glVertexAttribI3iv") : OGLP_ENTRY (VertexAttribI3iv);
+    table->VertexAttribI4iv = OGLP_ENTRY (VertexAttribI4iv) == internal::Lazy_VertexAttribI4iv
+        ? (PFNGLVERTEXATTRIBI4IVPROC) internal::LazyResolve ("glVertexAttribI4iv") : OGLP_ENTRY (VertexAttribI4iv);
+    table->VertexAttribI1uiv = OGLP_ENTRY (VertexAttribI1uiv) == internal::Lazy_VertexAttribI1uiv
+        ? (PFNGLVERTEXATTRIBI1UIVPROC) internal::LazyResolve ("glVertexAttribI1uiv") : OGLP_ENTRY (VertexAttribI1uiv);
+    table->VertexAttribI2uiv = OGLP_ENTRY (VertexAttribI2uiv) == internal::Lazy_VertexAttribI2uiv
+        ? (PFNGLVERTEXATTRIBI2UIVPROC) internal::LazyResolve ("glVertexAttribI2uiv") : OGLP_ENTRY (VertexAttribI2uiv);
+    table->VertexAttribI3uiv = OGLP_ENTRY (VertexAttribI3uiv) == internal::Lazy_VertexAttribI3uiv
+        ? (PFNGLVERTEXATTRIBI3UIVPROC) internal::LazyResolve ("glVertexAttribI3uiv") : OGLP_ENTRY (VertexAttribI3uiv);
+    table->VertexAttribI4uiv = OGLP_ENTRY (VertexAttribI4uiv) == internal::Lazy_VertexAttribI4uiv
+        ? (PFNGLVERTEXATTRIBI4UIVPROC) internal::LazyResolve ("glVertexAttribI4uiv") : OGLP_ENTRY (VertexAttribI4uiv);
+    table->VertexAttribI4bv = OGLP_ENTRY (VertexAttribI4bv) == internal::Lazy_VertexAttribI4bv
+        ? (PFNGLVERTEXATTRIBI4BVPROC) internal::LazyResolve ("glVertexAttribI4bv") : OGLP_ENTRY (VertexAttribI4bv);
+    table->VertexAttribI4sv = OGLP_ENTRY (VertexAttribI4sv) == internal::Lazy_VertexAttribI4sv
+        ? (PFNGLVERTEXATTRIBI4SVPROC) internal::LazyResolve ("glVertexAttribI4sv") : OGLP_ENTRY (VertexAttribI4sv);
+    table->VertexAttribI4ubv = OGLP_ENTRY (VertexAttribI4ubv) == internal::Lazy_VertexAttribI4ubv
+        ? (PFNGLVERTEXATTRIBI4UBVPROC) internal::LazyResolve ("glVertexAttribI4ubv") : OGLP_ENTRY (VertexAttribI4ubv);
+    table->VertexAttribI4usv = OGLP_ENTRY (VertexAttribI4usv) == internal::Lazy_VertexAttribI4usv
+        ? (PFNGLVERTEXATTRIBI4USVPROC) internal::LazyResolve ("glVertexAttribI4usv") : OGLP_ENTRY (VertexAttribI4usv);
+    table->GetUniformuiv = OGLP_ENTRY (GetUniformuiv) == internal::Lazy_GetUniformuiv
+        ? (PFNGLGETUNIFORMUIVPROC) internal::LazyResolve ("glGetUniformuiv") : OGLP_ENTRY (GetUniformuiv);
+    table->BindFragDataLocation = OGLP_ENTRY (BindFragDataLocation) == internal::Lazy_BindFragDataLocation
+        ? (PFNGLBINDFRAGDATALOCATIONPROC) internal::LazyResolve ("glBindFragDataLocation") : OGLP_ENTRY (BindFragDataLocation);
+    table->GetFragDataLocation = OGLP_ENTRY (GetFragDataLocation) == internal::Lazy_GetFragDataLocation
+        ? (PFNGLGETFRAGDATALOCATIONPROC) internal::LazyResolve ("glGetFragDataLocation") : OGLP_ENTRY (GetFragDataLocation);
+    table->Uniform1ui = OGLP_ENTRY (Uniform1ui) == internal::Lazy_Uniform1ui
+        ? (PFNGLUNIFORM1UIPROC) internal::LazyResolve ("glUniform1ui") : OGLP_ENTRY (Uniform1ui);
+    table->Uniform2ui = OGLP_ENTRY (Uniform2ui) == internal::Lazy_Uniform2ui
+        ? (PFNGLUNIFORM2UIPROC) internal::LazyResolve ("glUniform2ui") : OGLP_ENTRY (Uniform2ui);
+    table->Uniform3ui = OGLP_ENTRY (Uniform3ui) == internal::Lazy_Uniform3ui
+        ? (PFNGLUNIFORM3UIPROC) internal::LazyResolve ("glUniform3ui") : OGLP_ENTRY (Uniform3ui);
+    table->Uniform4ui = OGLP_ENTRY (Uniform4ui) == internal::Lazy_Uniform4ui
+        ? (PFNGLUNIFORM4UIPROC) internal::LazyResolve ("glUniform4ui") : OGLP_ENTRY (Uniform4ui);
+    table->Uniform1uiv = OGLP_ENTRY (Uniform1uiv) == internal::Lazy_Uniform1uiv
+        ? (PFNGLUNIFORM1UIVPROC) internal::LazyResolve ("glUniform1uiv") : OGLP_ENTRY (Uniform1uiv);
+    table->Uniform2uiv = OGLP_ENTRY (Uniform2uiv) == internal::Lazy_Uniform2uiv
+        ? (PFNGLUNIFORM2UIVPROC) internal::LazyResolve ("glUniform2uiv") : OGLP_ENTRY (Uniform2uiv);
+    table->Uniform3uiv = OGLP_ENTRY (Uniform3uiv) == internal::Lazy_Uniform3uiv
+        ? (PFNGLUNIFORM3UIVPROC) internal::LazyResolve ("glUniform3uiv") : OGLP_ENTRY (Uniform3uiv);
+    table->Uniform4uiv = OGLP_ENTRY (Uniform4uiv) == internal::Lazy_Uniform4uiv
+        ? (PFNGLUNIFORM4UIVPROC) internal::LazyResolve ("glUniform4uiv") : OGLP_ENTRY (Uniform4uiv);
+    table->TexParameterIiv = OGLP_ENTRY (TexParameterIiv) == internal::Lazy_TexParameterIiv
+        ? (PFNGLTEXPARAMETERIIVPROC) internal::LazyResolve ("glTexParameterIiv") : OGLP_ENTRY (TexParameterIiv);
+    table->TexParameterIuiv = OGLP_ENTRY (TexParameterIuiv) == internal::Lazy_TexParameterIuiv
+        ? (PFNGLTEXPARAMETERIUIVPROC) internal::LazyResolve ("glTexParameterIuiv") : OGLP_ENTRY (TexParameterIuiv);
+    table->GetTexParameterIiv = OGLP_ENTRY (GetTexParameterIiv) == internal::Lazy_GetTexParameterIiv
+        ? (PFNGLGETTEXPARAMETERIIVPROC) internal::LazyResolve ("glGetTexParameterIiv") : OGLP_ENTRY (GetTexParameterIiv);
+    table->GetTexParameterIuiv = OGLP_ENTRY (GetTexParameterIuiv) == internal::Lazy_GetTexParameterIuiv
+        ? (PFNGLGETTEXPARAMETERIUIVPROC) internal::LazyResolve ("glGetTexParameterIuiv") : OGLP_ENTRY (GetTexParameterIuiv);
+    table->ClearBufferiv = OGLP_ENTRY (ClearBufferiv) == internal::Lazy_ClearBufferiv
+        ? (PFNGLCLEARBUFFERIVPROC) internal::LazyResolve ("glClearBufferiv") : OGLP_ENTRY (ClearBufferiv);
+    table->ClearBufferuiv = OGLP_ENTRY (ClearBufferuiv) == internal::Lazy_ClearBufferuiv
+        ? (PFNGLCLEARBUFFERUIVPROC) internal::LazyResolve ("glClearBufferuiv") : OGLP_ENTRY (ClearBufferuiv);
+    table->ClearBufferfv = OGLP_ENTRY (ClearBufferfv) == internal::Lazy_ClearBufferfv
+        ? (PFNGLCLEARBUFFERFVPROC) internal::LazyResolve ("glClearBufferfv") : OGLP_ENTRY (ClearBufferfv);
+    table->ClearBufferfi = OGLP_ENTRY (ClearBufferfi) == internal::Lazy_ClearBufferfi
+        ? (PFNGLCLEARBUFFERFIPROC) internal::LazyResolve ("glClearBufferfi") : OGLP_ENTRY (ClearBufferfi);
+    table->GetStringi = OGLP_ENTRY (GetStringi) == internal::Lazy_GetStringi
+        ? (PFNGLGETSTRINGIPROC) internal::LazyResolve ("glGetStringi") : OGLP_ENTRY (GetStringi);
+    table->IsRenderbuffer = OGLP_ENTRY (IsRenderbuffer) == internal::Lazy_IsRenderbuffer
+        ? (PFNGLISRENDERBUFFERPROC) internal::LazyResolve ("glIsRenderbuffer") : OGLP_ENTRY (IsRenderbuffer);
+    table->BindRenderbuffer = OGLP_ENTRY (BindRenderbuffer) == internal::Lazy_BindRenderbuffer
+        ? (PFNGLBINDRENDERBUFFERPROC) internal::LazyResolve ("glBindRenderbuffer") : OGLP_ENTRY (BindRenderbuffer);
+    table->DeleteRenderbuffers = OGLP_ENTRY (DeleteRenderbuffers) == internal::Lazy_DeleteRenderbuffers
+        ? (PFNGLDELETERENDERBUFFERSPROC) internal::LazyResolve ("glDeleteRenderbuffers") : OGLP_ENTRY (DeleteRenderbuffers);
+    table->GenRenderbuffers = OGLP_ENTRY (GenRenderbuffers) == internal::Lazy_GenRenderbuffers
+        ? (PFNGLGENRENDERBUFFERSPROC) internal::LazyResolve ("glGenRenderbuffers") : OGLP_ENTRY (GenRenderbuffers);
+    table->RenderbufferStorage = OGLP_ENTRY (RenderbufferStorage) == internal::Lazy_RenderbufferStorage
+        ? (PFNGLRENDERBUFFERSTORAGEPROC) internal::LazyResolve ("glRenderbufferStorage") : OGLP_ENTRY (RenderbufferStorage);
+    table->GetRenderbufferParameteriv = OGLP_ENTRY (GetRenderbufferParameteriv) == internal::Lazy_GetRenderbufferParameteriv
+        ? (PFNGLGETRENDERBUFFERPARAMETERIVPROC) internal::LazyResolve ("glGetRenderbufferParameteriv") : OGLP_ENTRY (GetRenderbufferParameteriv);
+    table->IsFramebuffer = OGLP_ENTRY (IsFramebuffer) == internal::Lazy_IsFramebuffer
+        ? (PFNGLISFRAMEBUFFERPROC) internal::LazyResolve ("glIsFramebuffer") : OGLP_ENTRY (IsFramebuffer);
+    table->BindFramebuffer = OGLP_ENTRY (BindFramebuffer) == internal::Lazy_BindFramebuffer
+        ? (PFNGLBINDFRAMEBUFFERPROC) internal::LazyResolve ("glBindFramebuffer") : OGLP_ENTRY (BindFramebuffer);
+    table->DeleteFramebuffers = OGLP_ENTRY (DeleteFramebuffers) == internal::Lazy_DeleteFramebuffers
+        ? (PFNGLDELETEFRAMEBUFFERSPROC) internal::LazyResolve ("glDeleteFramebuffers") : OGLP_ENTRY (DeleteFramebuffers);
+    table->GenFramebuffers = OGLP_ENTRY (GenFramebuffers) == internal::Lazy_GenFramebuffers
+        ? (PFNGLGENFRAMEBUFFERSPROC) internal::LazyResolve ("glGenFramebuffers") : OGLP_ENTRY (GenFramebuffers);
+    table->CheckFramebufferStatus = OGLP_ENTRY (CheckFramebufferStatus) == internal::Lazy_CheckFramebufferStatus
+        ? (PFNGLCHECKFRAMEBUFFERSTATUSPROC) internal::LazyResolve ("glCheckFramebufferStatus") : OGLP_ENTRY (CheckFramebufferStatus);
+    table->FramebufferTexture1D = OGLP_ENTRY (FramebufferTexture1D) == internal::Lazy_FramebufferTexture1D
+        ? (PFNGLFRAMEBUFFERTEXTURE1DPROC) internal::LazyResolve ("glFramebufferTexture1D") : OGLP_ENTRY (FramebufferTexture1D);
+    table->FramebufferTexture2D = OGLP_ENTRY (FramebufferTexture2D) == internal::Lazy_FramebufferTexture2D
+        ? (PFNGLFRAMEBUFFERTEXTURE2DPROC) internal::LazyResolve ("glFramebufferTexture2D") : OGLP_ENTRY (FramebufferTexture2D);
+    table->FramebufferTexture3D = OGLP_ENTRY (FramebufferTexture3D) == internal::Lazy_FramebufferTexture3D
+        ? (PFNGLFRAMEBUFFERTEXTURE3DPROC) internal::LazyResolve ("glFramebufferTexture3D") : OGLP_ENTRY (FramebufferTexture3D);
+    table->FramebufferRenderbuffer = OGLP_ENTRY (FramebufferRenderbuffer) == internal::Lazy_FramebufferRenderbuffer
+        ? (PFNGLFRAMEBUFFERRENDERBUFFERPROC) internal::LazyResolve ("glFramebufferRenderbuffer") : OGLP_ENTRY (FramebufferRenderbuffer);
+    table->GetFramebufferAttachmentParameteriv = OGLP_ENTRY (GetFramebufferAttachmentParameteriv) == internal::Lazy_GetFramebufferAttachmentParameteriv
+        ? (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC) internal::LazyResolve ("glGetFramebufferAttachmentParameteriv") : OGLP_ENTRY (GetFramebufferAttachmentParameteriv);
+    table->GenerateMipmap = OGLP_ENTRY (GenerateMipmap) == internal::Lazy_GenerateMipmap
+        ? (PFNGLGENERATEMIPMAPPROC) internal::LazyResolve ("glGenerateMipmap") : OGLP_ENTRY (GenerateMipmap);
+    table->BlitFramebuffer = OGLP_ENTRY (BlitFramebuffer) == internal::Lazy_BlitFramebuffer
+        ? (PFNGLBLITFRAMEBUFFERPROC) internal::LazyResolve ("glBlitFramebuffer") : OGLP_ENTRY (BlitFramebuffer);
+    table->RenderbufferStorageMultisample = OGLP_ENTRY (RenderbufferStorageMultisample) == internal::Lazy_RenderbufferStorageMultisample
+        ? (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC) internal::LazyResolve ("glRenderbufferStorageMultisample") : OGLP_ENTRY (RenderbufferStorageMultisample);
+    table->FramebufferTextureLayer = OGLP_ENTRY (FramebufferTextureLayer) == internal::Lazy_FramebufferTextureLayer
+        ? (PFNGLFRAMEBUFFERTEXTURELAYERPROC) internal::LazyResolve ("glFramebufferTextureLayer") : OGLP_ENTRY (FramebufferTextureLayer);
+    table->MapBufferRange = OGLP_ENTRY (MapBufferRange) == internal::Lazy_MapBufferRange
+        ? (PFNGLMAPBUFFERRANGEPROC) internal::LazyResolve ("glMapBufferRange") : OGLP_ENTRY (MapBufferRange);
+    table->FlushMappedBufferRange = OGLP_ENTRY (FlushMappedBufferRange) == internal::Lazy_FlushMappedBufferRange
+        ? (PFNGLFLUSHMAPPEDBUFFERRANGEPROC) internal::LazyResolve ("glFlushMappedBufferRange") : OGLP_ENTRY (FlushMappedBufferRange);
+    table->BindVertexArray = OGLP_ENTRY (BindVertexArray) == internal::Lazy_BindVertexArray
+        ? (PFNGLBINDVERTEXARRAYPROC) internal::LazyResolve ("glBindVertexArray") : OGLP_ENTRY (BindVertexArray);
+    table->DeleteVertexArrays = OGLP_ENTRY (DeleteVertexArrays) == internal::Lazy_DeleteVertexArrays
+        ? (PFNGLDELETEVERTEXARRAYSPROC) internal::LazyResolve ("glDeleteVertexArrays") : OGLP_ENTRY (DeleteVertexArrays);
+    table->GenVertexArrays = OGLP_ENTRY (GenVertexArrays) == internal::Lazy_GenVertexArrays
+        ? (PFNGLGENVERTEXARRAYSPROC) internal::LazyResolve ("glGenVertexArrays") : OGLP_ENTRY (GenVertexArrays);
+    table->IsVertexArray = OGLP_ENTRY (IsVertexArray) == internal::Lazy_IsVertexArray
+        ? (PFNGLISVERTEXARRAYPROC) internal::LazyResolve ("glIsVertexArray") : OGLP_ENTRY (IsVertexArray);
+    table->DrawArraysInstanced = OGLP_ENTRY (DrawArraysInstanced) == internal::Lazy_DrawArraysInstanced
+        ? (PFNGLDRAWARRAYSINSTANCEDPROC) internal::LazyResolve ("glDrawArraysInstanced") : OGLP_ENTRY (DrawArraysInstanced);
+    table->DrawElementsInstanced = OGLP_ENTRY (DrawElementsInstanced) == internal::Lazy_DrawElementsInstanced
+        ? (PFNGLDRAWELEMENTSINSTANCEDPROC) internal::LazyResolve ("glDrawElementsInstanced") : OGLP_ENTRY (DrawElementsInstanced);
+    table->TexBuffer = OGLP_ENTRY (TexBuffer) == internal::Lazy_TexBuffer
+        ? (PFNGLTEXBUFFERPROC) internal::LazyResolve ("glTexBuffer") : OGLP_ENTRY (TexBuffer);
+    table->PrimitiveRestartIndex = OGLP_ENTRY (PrimitiveRestartIndex) == internal::Lazy_PrimitiveRestartIndex
+        ? (PFNGLPRIMITIVERESTARTINDEXPROC) internal::LazyResolve ("glPrimitiveRestartIndex") : OGLP_ENTRY (PrimitiveRestartIndex);
+    table->CopyBufferSubData = OGLP_ENTRY (CopyBufferSubData) == internal::Lazy_CopyBufferSubData
+        ? (PFNGLCOPYBUFFERSUBDATAPROC) internal::LazyResolve ("glCopyBufferSubData") : OGLP_ENTRY (CopyBufferSubData);
+    table->GetUniformIndices = OGLP_ENTRY (GetUniformIndices) == internal::Lazy_GetUniformIndices
+        ? (PFNGLGETUNIFORMINDICESPROC) internal::LazyResolve ("glGetUniformIndices") : OGLP_ENTRY (GetUniformIndices);
+    table->GetActiveUniformsiv = OGLP_ENTRY (GetActiveUniformsiv) == internal::Lazy_GetActiveUniformsiv
+        ? (PFNGLGETACTIVEUNIFORMSIVPROC) internal::LazyResolve ("glGetActiveUniformsiv") : OGLP_ENTRY (GetActiveUniformsiv);
+    table->GetActiveUniformName = OGLP_ENTRY (GetActiveUniformName) == internal::Lazy_GetActiveUniformName
+        ? (PFNGLGETACTIVEUNIFORMNAMEPROC) internal::LazyResolve ("glGetActiveUniformName") : OGLP_ENTRY (GetActiveUniformName);
+    table->GetUniformBlockIndex = OGLP_ENTRY (GetUniformBlockIndex) == internal::Lazy_GetUniformBlockIndex
+        ? (PFNGLGETUNIFORMBLOCKINDEXPROC) internal::LazyResolve ("glGetUniformBlockIndex") : OGLP_ENTRY (GetUniformBlockIndex);
+    table->GetActiveUniformBlockiv = OGLP_ENTRY (GetActiveUniformBlockiv) == internal::Lazy_GetActiveUniformBlockiv
+        ? (PFNGLGETACTIVEUNIFORMBLOCKIVPROC) internal::LazyResolve ("glGetActiveUniformBlockiv") : OGLP_ENTRY (GetActiveUniformBlockiv);
+    table->GetActiveUniformBlockName = OGLP_ENTRY (GetActiveUniformBlockName) == internal::Lazy_GetActiveUniformBlockName
+        ? (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC) internal::LazyResolve ("glGetActiveUniformBlockName") : OGLP_ENTRY (GetActiveUniformBlockName);
+    table->UniformBlockBinding = OGLP_ENTRY (UniformBlockBinding) == internal::Lazy_UniformBlockBinding
+        ? (PFNGLUNIFORMBLOCKBINDINGPROC) internal::LazyResolve ("glUniformBlockBinding") : OGLP_ENTRY (UniformBlockBinding);
+    table->DrawElementsBaseVertex = OGLP_ENTRY (DrawElementsBaseVertex) == internal::Lazy_DrawElementsBaseVertex
+        ? (PFNGLDRAWELEMENTSBASEVERTEXPROC) internal::LazyResolve ("glDrawElementsBaseVertex") : OGLP_ENTRY (DrawElementsBaseVertex);
+    table->DrawRangeElementsBaseVertex = OGLP_ENTRY (DrawRangeElementsBaseVertex) == internal::Lazy_DrawRangeElementsBaseVertex
+        ? (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC) internal::LazyResolve ("glDrawRangeElementsBaseVertex") : OGLP_ENTRY (DrawRangeElementsBaseVertex);
+    table->DrawElementsInstancedBaseVertex = OGLP_ENTRY (DrawElementsInstancedBaseVertex) == internal::Lazy_DrawElementsInstancedBaseVertex
+        ? (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC) internal::LazyResolve ("glDrawElementsInstancedBaseVertex") : OGLP_ENTRY (DrawElementsInstancedBaseVertex);
+    table->MultiDrawElementsBaseVertex = OGLP_ENTRY (MultiDrawElementsBaseVertex) == internal::Lazy_MultiDrawElementsBaseVertex
+        ? (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC) internal::LazyResolve ("glMultiDrawElementsBaseVertex") : OGLP_ENTRY (MultiDrawElementsBaseVertex);
+    table->ProvokingVertex = OGLP_ENTRY (ProvokingVertex) == internal::Lazy_ProvokingVertex
+        ? (PFNGLPROVOKINGVERTEXPROC) internal::LazyResolve ("glProvokingVertex") : OGLP_ENTRY (ProvokingVertex);
+    table->FenceSync = OGLP_ENTRY (FenceSync) == internal::Lazy_FenceSync
+        ? (PFNGLFENCESYNCPROC) internal::LazyResolve ("glFenceSync") : OGLP_ENTRY (FenceSync);
+    table->IsSync = OGLP_ENTRY (IsSync) == internal::Lazy_IsSync
+        ? (PFNGLISSYNCPROC) internal::LazyResolve ("glIsSync") : OGLP_ENTRY (IsSync);
+    table->DeleteSync = OGLP_ENTRY (DeleteSync) == internal::Lazy_DeleteSync
+        ? (PFNGLDELETESYNCPROC) internal::LazyResolve ("glDeleteSync") : OGLP_ENTRY (DeleteSync);
+    table->ClientWaitSync = OGLP_ENTRY (ClientWaitSync) == internal::Lazy_ClientWaitSync
+        ? (PFNGLCLIENTWAITSYNCPROC) internal::LazyResolve ("glClientWaitSync") : OGLP_ENTRY (ClientWaitSync);
+    table->WaitSync = OGLP_ENTRY (WaitSync) == internal::Lazy_WaitSync
+        ? (PFNGLWAITSYNCPROC) internal::LazyResolve ("glWaitSync") : OGLP_ENTRY (WaitSync);
+    table->GetInteger64v = OGLP_ENTRY (GetInteger64v) == internal::Lazy_GetInteger64v
+        ? (PFNGLGETINTEGER64VPROC) internal::LazyResolve ("glGetInteger64v") : OGLP_ENTRY (GetInteger64v);
+    table->GetSynciv = OGLP_ENTRY (GetSynciv) == internal::Lazy_GetSynciv
+        ? (PFNGLGETSYNCIVPROC) internal::LazyResolve ("glGetSynciv") : OGLP_ENTRY (GetSynciv);
+    table->GetInteger64i_v = OGLP_ENTRY (GetInteger64i_v) == internal::Lazy_GetInteger64i_v
+        ? (PFNGLGETINTEGER64I_VPROC) internal::LazyResolve ("glGetInteger64i_v") : OGLP_ENTRY (GetInteger64i_v);
+    table->GetBufferParameteri64v = OGLP_ENTRY (GetBufferParameteri64v) == internal::Lazy_GetBufferParameteri64v
+        ? (PFNGLGETBUFFERPARAMETERI64VPROC) internal::LazyResolve ("glGetBufferParameteri64v") : OGLP_ENTRY (GetBufferParameteri64v);
+    table->FramebufferTexture = OGLP_ENTRY (FramebufferTexture) == internal::Lazy_FramebufferTexture
+        ? (PFNGLFRAMEBUFFERTEXTUREPROC) internal::LazyResolve ("glFramebufferTexture") : OGLP_ENTRY (FramebufferTexture);
+    table->TexImage2DMultisample = OGLP_ENTRY (TexImage2DMultisample) == internal::Lazy_TexImage2DMultisample
+        ? (PFNGLTEXIMAGE2DMULTISAMPLEPROC) internal::LazyResolve ("glTexImage2DMultisample") : OGLP_ENTRY (TexImage2DMultisample);
+    table->TexImage3DMultisample = OGLP_ENTRY (TexImage3DMultisample) == internal::Lazy_TexImage3DMultisample
+        ? (PFNGLTEXIMAGE3DMULTISAMPLEPROC) internal::LazyResolve ("glTexImage3DMultisample") : OGLP_ENTRY (TexImage3DMultisample);
+    table->GetMultisamplefv = OGLP_ENTRY (GetMultisamplefv) == internal::Lazy_GetMultisamplefv
+        ? (PFNGLGETMULTISAMPLEFVPROC) internal::LazyResolve ("glGetMultisamplefv") : OGLP_ENTRY (GetMultisamplefv);
+    table->SampleMaski = OGLP_ENTRY (SampleMaski) == internal::Lazy_SampleMaski
+        ? (PFNGLSAMPLEMASKIPROC) internal::LazyResolve ("glSampleMaski") : OGLP_ENTRY (SampleMaski);
+    table->BindFragDataLocationIndexed = OGLP_ENTRY (BindFragDataLocationIndexed) == internal::Lazy_BindFragDataLocationIndexed
+        ? (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC) internal::LazyResolve ("glBindFragDataLocationIndexed") : OGLP_ENTRY (BindFragDataLocationIndexed);
+    table->GetFragDataIndex = OGLP_ENTRY (GetFragDataIndex) == internal::Lazy_GetFragDataIndex
+        ? (PFNGLGETFRAGDATAINDEXPROC) internal::LazyResolve ("glGetFragDataIndex") : OGLP_ENTRY (GetFragDataIndex);
+    table->GenSamplers = OGLP_ENTRY (GenSamplers) == internal::Lazy_GenSamplers
+        ? (PFNGLGENSAMPLERSPROC) internal::LazyResolve ("glGenSamplers") : OGLP_ENTRY (GenSamplers);
+    table->DeleteSamplers = OGLP_ENTRY (DeleteSamplers) == internal::Lazy_DeleteSamplers
+        ? (PFNGLDELETESAMPLERSPROC) internal::LazyResolve ("glDeleteSamplers") : OGLP_ENTRY (DeleteSamplers);
+    table->IsSampler = OGLP_ENTRY (IsSampler) == internal::Lazy_IsSampler
+        ? (PFNGLISSAMPLERPROC) internal::LazyResolve ("glIsSampler") : OGLP_ENTRY (IsSampler);
+    table->BindSampler = OGLP_ENTRY (BindSampler) == internal::Lazy_BindSampler
+        ? (PFNGLBINDSAMPLERPROC) internal::LazyResolve ("glBindSampler") : OGLP_ENTRY (BindSampler);
+    table->SamplerParameteri = OGLP_ENTRY (SamplerParameteri) == internal::Lazy_SamplerParameteri
+        ? (PFNGLSAMPLERPARAMETERIPROC) internal::LazyResolve ("glSamplerParameteri") : OGLP_ENTRY (SamplerParameteri);
+    table->SamplerParameteriv = OGLP_ENTRY (SamplerParameteriv) == internal::Lazy_SamplerParameteriv
+        ? (PFNGLSAMPLERPARAMETERIVPROC) internal::LazyResolve ("glSamplerParameteriv") : OGLP_ENTRY (SamplerParameteriv);
+    table->SamplerParameterf = OGLP_ENTRY (SamplerParameterf) == internal::Lazy_SamplerParameterf
+        ? (PFNGLSAMPLERPARAMETERFPROC) internal::LazyResolve ("glSamplerParameterf") : OGLP_ENTRY (SamplerParameterf);
+    table->SamplerParameterfv = OGLP_ENTRY (SamplerParameterfv) == internal::Lazy_SamplerParameterfv
+        ? (PFNGLSAMPLERPARAMETERFVPROC) internal::LazyResolve ("glSamplerParameterfv") : OGLP_ENTRY (SamplerParameterfv);
+    table->SamplerParameterIiv = OGLP_ENTRY (SamplerParameterIiv) == internal::Lazy_SamplerParameterIiv
+        ? (PFNGLSAMPLERPARAMETERIIVPROC) internal::LazyResolve ("glSamplerParameterIiv") : OGLP_ENTRY (SamplerParameterIiv);
+    table->SamplerParameterIuiv = OGLP_ENTRY (SamplerParameterIuiv) == internal::Lazy_SamplerParameterIuiv
+        ? (PFNGLSAMPLERPARAMETERIUIVPROC) internal::LazyResolve ("glSamplerParameterIuiv") : OGLP_ENTRY (SamplerParameterIuiv);
+    table->GetSamplerParameteriv = OGLP_ENTRY (GetSamplerParameteriv) == internal::Lazy_GetSamplerParameteriv
+        ? (PFNGLGETSAMPLERPARAMETERIVPROC) internal::LazyResolve ("glGetSamplerParameteriv") : OGLP_ENTRY (GetSamplerParameteriv);
+    table->GetSamplerParameterIiv = OGLP_ENTRY (GetSamplerParameterIiv) == internal::Lazy_GetSamplerParameterIiv
+        ? (PFNGLGETSAMPLERPARAMETERIIVPROC) internal::LazyResolve ("glGetSamplerParameterIiv") : OGLP_ENTRY (GetSamplerParameterIiv);
+    table->GetSamplerParameterfv = OGLP_ENTRY (GetSamplerParameterfv) == internal::Lazy_GetSamplerParameterfv
+        ? (PFNGLGETSAMPLERPARAMETERFVPROC) internal::LazyResolve ("glGetSamplerParameterfv") : OGLP_ENTRY (GetSamplerParameterfv);
+    table->GetSamplerParameterIuiv = OGLP_ENTRY (GetSamplerParameterIuiv) == internal::Lazy_GetSamplerParameterIuiv
+        ? (PFNGLGETSAMPLERPARAMETERIUIVPROC) internal::LazyResolve ("glGetSamplerParameterIuiv") : OGLP_ENTRY (GetSamplerParameterIuiv);
+    table->QueryCounter = OGLP_ENTRY (QueryCounter) == internal::Lazy_QueryCounter
+        ? (PFNGLQUERYCOUNTERPROC) internal::LazyResolve ("glQueryCounter") : OGLP_ENTRY (QueryCounter);
+    table->GetQueryObjecti64v = OGLP_ENTRY (GetQueryObjecti64v) == internal::Lazy_GetQueryObjecti64v
+        ? (PFNGLGETQUERYOBJECTI64VPROC) internal::LazyResolve ("glGetQueryObjecti64v") : OGLP_ENTRY (GetQueryObjecti64v);
+    table->GetQueryObjectui64v = OGLP_ENTRY (GetQueryObjectui64v) == internal::Lazy_GetQueryObjectui64v
+        ? (PFNGLGETQUERYOBJECTUI64VPROC) internal::LazyResolve ("glGetQueryObjectui64v") : OGLP_ENTRY (GetQueryObjectui64v);
+    table->VertexAttribDivisor = OGLP_ENTRY (VertexAttribDivisor) == internal::Lazy_VertexAttribDivisor
+        ? (PFNGLVERTEXATTRIBDIVISORPROC) internal::LazyResolve ("glVertexAttribDivisor") : OGLP_ENTRY (VertexAttribDivisor);
+    table->VertexAttribP1ui = OGLP_ENTRY (VertexAttribP1ui) == internal::Lazy_VertexAttribP1ui
+        ? (PFNGLVERTEXATTRIBP1UIPROC) internal::LazyResolve ("glVertexAttribP1ui") : OGLP_ENTRY (VertexAttribP1ui);
+    table->VertexAttribP1uiv = OGLP_ENTRY (VertexAttribP1uiv) == internal::Lazy_VertexAttribP1uiv
+        ? (PFNGLVERTEXATTRIBP1UIVPROC) internal::LazyResolve ("glVertexAttribP1uiv") : OGLP_ENTRY (VertexAttribP1uiv);
+    table->VertexAttribP2ui = OGLP_ENTRY (VertexAttribP2ui) == internal::Lazy_VertexAttribP2ui
+        ? (PFNGLVERTEXATTRIBP2UIPROC) internal::LazyResolve ("glVertexAttribP2ui") : OGLP_ENTRY (VertexAttribP2ui);
+    table->VertexAttribP2uiv = OGLP_ENTRY (VertexAttribP2uiv) == internal::Lazy_VertexAttribP2uiv
+        ? (PFNGLVERTEXATTRIBP2UIVPROC) internal::LazyResolve ("glVertexAttribP2uiv") : OGLP_ENTRY (VertexAttribP2uiv);
+    table->VertexAttribP3ui = OGLP_ENTRY (VertexAttribP3ui) == internal::Lazy_VertexAttribP3ui
+        ? (PFNGLVERTEXATTRIBP3UIPROC) internal::LazyResolve ("glVertexAttribP3ui") : OGLP_ENTRY (VertexAttribP3ui);
+    table->VertexAttribP3uiv = OGLP_ENTRY (VertexAttribP3uiv) == internal::Lazy_VertexAttribP3uiv
+        ? (PFNGLVERTEXATTRIBP3UIVPROC) internal::LazyResolve ("glVertexAttribP3uiv") : OGLP_ENTRY (VertexAttribP3uiv);
+    table->VertexAttribP4ui = OGLP_ENTRY (VertexAttribP4ui) == internal::Lazy_VertexAttribP4ui
+        ? (PFNGLVERTEXATTRIBP4UIPROC) internal::LazyResolve ("glVertexAttribP4ui") : OGLP_ENTRY (VertexAttribP4ui);
+    table->VertexAttribP4uiv = OGLP_ENTRY (VertexAttribP4uiv) == internal::Lazy_VertexAttribP4uiv
+        ? (PFNGLVERTEXATTRIBP4UIVPROC) internal::LazyResolve ("glVertexAttribP4uiv") : OGLP_ENTRY (VertexAttribP4uiv);
+    table->MinSampleShading = OGLP_ENTRY (MinSampleShading) == internal::Lazy_MinSampleShading
+        ? (PFNGLMINSAMPLESHADINGPROC) internal::LazyResolve ("glMinSampleShading") : OGLP_ENTRY (MinSampleShading);
+    table->BlendEquationi = OGLP_ENTRY (BlendEquationi) == internal::Lazy_BlendEquationi
+        ? (PFNGLBLENDEQUATIONIPROC) internal::LazyResolve ("glBlendEquationi") : OGLP_ENTRY (BlendEquationi);
+    table->BlendEquationSeparatei = OGLP_ENTRY (BlendEquationSeparatei) == internal::Lazy_BlendEquationSeparatei
+        ? (PFNGLBLENDEQUATIONSEPARATEIPROC) internal::LazyResolve ("glBlendEquationSeparatei") : OGLP_ENTRY (BlendEquationSeparatei);
+    table->BlendFunci = OGLP_ENTRY (BlendFunci) == internal::Lazy_BlendFunci
+        ? (PFNGLBLENDFUNCIPROC) internal::LazyResolve ("glBlendFunci") : OGLP_ENTRY (BlendFunci);
+    table->BlendFuncSeparatei = OGLP_ENTRY (BlendFuncSeparatei) == internal::Lazy_BlendFuncSeparatei
+        ? (PFNGLBLENDFUNCSEPARATEIPROC) internal::LazyResolve ("glBlendFuncSeparatei") : OGLP_ENTRY (BlendFuncSeparatei);
+    table->DrawArraysIndirect = OGLP_ENTRY (DrawArraysIndirect) == internal::Lazy_DrawArraysIndirect
+        ? (PFNGLDRAWARRAYSINDIRECTPROC) internal::LazyResolve ("glDrawArraysIndirect") : OGLP_ENTRY (DrawArraysIndirect);
+    table->DrawElementsIndirect = OGLP_ENTRY (DrawElementsIndirect) == internal::Lazy_DrawElementsIndirect
+        ? (PFNGLDRAWELEMENTSINDIRECTPROC) internal::LazyResolve ("glDrawElementsIndirect") : OGLP_ENTRY (DrawElementsIndirect);
+    table->Uniform1d = OGLP_ENTRY (Uniform1d) == internal::Lazy_Uniform1d
+        ? (PFNGLUNIFORM1DPROC) internal::LazyResolve ("glUniform1d") : OGLP_ENTRY (Uniform1d);
+    table->Uniform2d = OGLP_ENTRY (Uniform2d) == internal::Lazy_Uniform2d
+        ? (PFNGLUNIFORM2DPROC) internal::LazyResolve ("glUniform2d") : OGLP_ENTRY (Uniform2d);
+    table->Uniform3d = OGLP_ENTRY (Uniform3d) == internal::Lazy_Uniform3d
+        ? (PFNGLUNIFORM3DPROC) internal::LazyResolve ("glUniform3d") : OGLP_ENTRY (Uniform3d);
+    table->Uniform4d = OGLP_ENTRY (Uniform4d) == internal::Lazy_Uniform4d
+        ? (PFNGLUNIFORM4DPROC) internal::LazyResolve ("glUniform4d") : OGLP_ENTRY (Uniform4d);
+    table->Uniform1dv = OGLP_ENTRY (Uniform1dv) == internal::Lazy_Uniform1dv
+        ? (PFNGLUNIFORM1DVPROC) internal::LazyResolve ("glUniform1dv") : OGLP_ENTRY (Uniform1dv);
+    table->Uniform2dv = OGLP_ENTRY (Uniform2dv) == internal::Lazy_Uniform2dv
+        ? (PFNGLUNIFORM2DVPROC) internal::LazyResolve ("glUniform2dv") : OGLP_ENTRY (Uniform2dv);
+    table->Uniform3dv = OGLP_ENTRY (Uniform3dv) == internal::Lazy_Uniform3dv
+        ? (PFNGLUNIFORM3DVPROC) internal::LazyResolve ("glUniform3dv") : OGLP_ENTRY (Uniform3dv);
+    table->Uniform4dv = OGLP_ENTRY (Uniform4dv) == internal::Lazy_Uniform4dv
+        ? (PFNGLUNIFORM4DVPROC) internal::LazyResolve ("glUniform4dv") : OGLP_ENTRY (Uniform4dv);
+    table->UniformMatrix2dv = OGLP_ENTRY (UniformMatrix2dv) == internal::Lazy_UniformMatrix2dv
+        ? (PFNGLUNIFORMMATRIX2DVPROC) internal::LazyResolve ("glUniformMatrix2dv") : OGLP_ENTRY (UniformMatrix2dv);
+    table->UniformMatrix3dv = OGLP_ENTRY (UniformMatrix3dv) == internal::Lazy_UniformMatrix3dv
+        ? (PFNGLUNIFORMMATRIX3DVPROC) internal::LazyResolve ("glUniformMatrix3dv") : OGLP_ENTRY (UniformMatrix3dv);
+    table->UniformMatrix4dv = OGLP_ENTRY (UniformMatrix4dv) == internal::Lazy_UniformMatrix4dv
+        ? (PFNGLUNIFORMMATRIX4DVPROC) internal::LazyResolve ("glUniformMatrix4dv") : OGLP_ENTRY (UniformMatrix4dv);
+    table->UniformMatrix2x3dv = OGLP_ENTRY (UniformMatrix2x3dv) == internal::Lazy_UniformMatrix2x3dv
+        ? (PFNGLUNIFORMMATRIX2X3DVPROC) internal::LazyResolve ("glUniformMatrix2x3dv") : OGLP_ENTRY (UniformMatrix2x3dv);
+    table->UniformMatrix2x4dv = OGLP_ENTRY (UniformMatrix2x4dv) == internal::Lazy_UniformMatrix2x4dv
+        ? (PFNGLUNIFORMMATRIX2X4DVPROC) internal::LazyResolve ("glUniformMatrix2x4dv") : OGLP_ENTRY (UniformMatrix2x4dv);
+    table->UniformMatrix3x2dv = OGLP_ENTRY (UniformMatrix3x2dv) == internal::Lazy_UniformMatrix3x2dv
+        ? (PFNGLUNIFORMMATRIX3X2DVPROC) internal::LazyResolve ("glUniformMatrix3x2dv") : OGLP_ENTRY (UniformMatrix3x2dv);
+    table->UniformMatrix3x4dv = OGLP_ENTRY (UniformMatrix3x4dv) == internal::Lazy_UniformMatrix3x4dv
+        ? (PFNGLUNIFORMMATRIX3X4DVPROC) internal::LazyResolve ("glUniformMatrix3x4dv") : OGLP_ENTRY (UniformMatrix3x4dv);
+    table->UniformMatrix4x2dv = OGLP_ENTRY (UniformMatrix4x2dv) == internal::Lazy_UniformMatrix4x2dv
+        ? (PFNGLUNIFORMMATRIX4X2DVPROC) internal::LazyResolve ("glUniformMatrix4x2dv") : OGLP_ENTRY (UniformMatrix4x2dv);
+    table->UniformMatrix4x3dv = OGLP_ENTRY (UniformMatrix4x3dv) == internal::Lazy_UniformMatrix4x3dv
+        ? (PFNGLUNIFORMMATRIX4X3DVPROC) internal::LazyResolve ("glUniformMatrix4x3dv") : OGLP_ENTRY (UniformMatrix4x3dv);
+    table->GetUniformdv = OGLP_ENTRY (GetUniformdv) == internal::Lazy_GetUniformdv
+        ? (PFNGLGETUNIFORMDVPROC) internal::LazyResolve ("glGetUniformdv") : OGLP_ENTRY (GetUniformdv);
+    table->GetSubroutineUniformLocation = OGLP_ENTRY (GetSubroutineUniformLocation) == internal::Lazy_GetSubroutineUniformLocation
+        ? (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC) internal::LazyResolve ("glGetSubroutineUniformLocation") : OGLP_ENTRY (GetSubroutineUniformLocation);
+    table->GetSubroutineIndex = OGLP_ENTRY (GetSubroutineIndex) == internal::Lazy_GetSubroutineIndex
+        ? (PFNGLGETSUBROUTINEINDEXPROC) internal::LazyResolve ("glGetSubroutineIndex") : OGLP_ENTRY (GetSubroutineIndex);
+    table->GetActiveSubroutineUniformiv = OGLP_ENTRY (GetActiveSubroutineUniformiv) == internal::Lazy_GetActiveSubroutineUniformiv
+        ? (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC) internal::LazyResolve ("glGetActiveSubroutineUniformiv") : OGLP_ENTRY (GetActiveSubroutineUniformiv);
+    table->GetActiveSubroutineUniformName = OGLP_ENTRY (GetActiveSubroutineUniformName) == internal::Lazy_GetActiveSubroutineUniformName
+        ? (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC) internal::LazyResolve ("glGetActiveSubroutineUniformName") : OGLP_ENTRY (GetActiveSubroutineUniformName);
+    table->GetActiveSubroutineName = OGLP_ENTRY (GetActiveSubroutineName) == internal::Lazy_GetActiveSubroutineName
+        ? (PFNGLGETACTIVESUBROUTINENAMEPROC) internal::LazyResolve ("glGetActiveSubroutineName") : OGLP_ENTRY (GetActiveSubroutineName);
+    table->UniformSubroutinesuiv = OGLP_ENTRY (UniformSubroutinesuiv) == internal::Lazy_UniformSubroutinesuiv
+        ? (PFNGLUNIFORMSUBROUTINESUIVPROC) internal::LazyResolve ("glUniformSubroutinesuiv") : OGLP_ENTRY (UniformSubroutinesuiv);
+    table->GetUniformSubroutineuiv = OGLP_ENTRY (GetUniformSubroutineuiv) == internal::Lazy_GetUniformSubroutineuiv
+        ? (PFNGLGETUNIFORMSUBROUTINEUIVPROC) internal::LazyResolve ("glGetUniformSubroutineuiv") : OGLP_ENTRY (GetUniformSubroutineuiv);
+    table->GetProgramStageiv = OGLP_ENTRY (GetProgramStageiv) == internal::Lazy_GetProgramStageiv
+        ? (PFNGLGETPROGRAMSTAGEIVPROC) internal::LazyResolve ("glGetProgramStageiv") : OGLP_ENTRY (GetProgramStageiv);
+    table->PatchParameteri = OGLP_ENTRY (PatchParameteri) == internal::Lazy_PatchParameteri
+        ? (PFNGLPATCHPARAMETERIPROC) internal::LazyResolve ("glPatchParameteri") : OGLP_ENTRY (PatchParameteri);
+    table->PatchParameterfv = OGLP_ENTRY (PatchParameterfv) == internal::Lazy_PatchParameterfv
+        ? (PFNGLPATCHPARAMETERFVPROC) internal::LazyResolve ("glPatchParameterfv") : OGLP_ENTRY (PatchParameterfv);
+    table->BindTransformFeedback = OGLP_ENTRY (BindTransformFeedback) == internal::Lazy_BindTransformFeedback
+        ? (PFNGLBINDTRANSFORMFEEDBACKPROC) internal::LazyResolve ("glBindTransformFeedback") : OGLP_ENTRY (BindTransformFeedback);
+    table->DeleteTransformFeedbacks = OGLP_ENTRY (DeleteTransformFeedbacks) == internal::Lazy_DeleteTransformFeedbacks
+        ? (PFNGLDELETETRANSFORMFEEDBACKSPROC) internal::LazyResolve ("glDeleteTransformFeedbacks") : OGLP_ENTRY (DeleteTransformFeedbacks);
+    table->GenTransformFeedbacks = OGLP_ENTRY (GenTransformFeedbacks) == internal::Lazy_GenTransformFeedbacks
+        ? (PFNGLGENTRANSFORMFEEDBACKSPROC) internal::LazyResolve ("glGenTransformFeedbacks") : OGLP_ENTRY (GenTransformFeedbacks);
+    table->IsTransformFeedback = OGLP_ENTRY (IsTransformFeedback) == internal::Lazy_IsTransformFeedback
+        ? (PFNGLISTRANSFORMFEEDBACKPROC) internal::LazyResolve ("glIsTransformFeedback") : OGLP_ENTRY (IsTransformFeedback);
+    table->PauseTransformFeedback = OGLP_ENTRY (PauseTransformFeedback) == internal::Lazy_PauseTransformFeedback
+        ? (PFNGLPAUSETRANSFORMFEEDBACKPROC) internal::LazyResolve ("glPauseTransformFeedback") : OGLP_ENTRY (PauseTransformFeedback);
+    table->ResumeTransformFeedback = OGLP_ENTRY (ResumeTransformFeedback) == internal::Lazy_ResumeTransformFeedback
+        ? (PFNGLRESUMETRANSFORMFEEDBACKPROC) internal::LazyResolve ("glResumeTransformFeedback") : OGLP_ENTRY (ResumeTransformFeedback);
+    table->DrawTransformFeedback = OGLP_ENTRY (DrawTransformFeedback) == internal::Lazy_DrawTransformFeedback
+        ? (PFNGLDRAWTRANSFORMFEEDBACKPROC) internal::LazyResolve ("glDrawTransformFeedback") : OGLP_ENTRY (DrawTransformFeedback);
+    table->DrawTransformFeedbackStream = OGLP_ENTRY (DrawTransformFeedbackStream) == internal::Lazy_DrawTransformFeedbackStream
+        ? (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC) internal::LazyResolve ("glDrawTransformFeedbackStream") : OGLP_ENTRY (DrawTransformFeedbackStream);
+    table->BeginQueryIndexed = OGLP_ENTRY (BeginQueryIndexed) == internal::Lazy_BeginQueryIndexed
+        ? (PFNGLBEGINQUERYINDEXEDPROC) internal::LazyResolve ("glBeginQueryIndexed") : OGLP_ENTRY (BeginQueryIndexed);
+    table->EndQueryIndexed = OGLP_ENTRY (EndQueryIndexed) == internal::Lazy_EndQueryIndexed
+        ? (PFNGLENDQUERYINDEXEDPROC) internal::LazyResolve ("glEndQueryIndexed") : OGLP_ENTRY (EndQueryIndexed);
+    table->GetQueryIndexediv = OGLP_ENTRY (GetQueryIndexediv) == internal::Lazy_GetQueryIndexediv
+        ? (PFNGLGETQUERYINDEXEDIVPROC) internal::LazyResolve ("glGetQueryIndexediv") : OGLP_ENTRY (GetQueryIndexediv);
+    table->ReleaseShaderCompiler = OGLP_ENTRY (ReleaseShaderCompiler) == internal::Lazy_ReleaseShaderCompiler
+        ? (PFNGLRELEASESHADERCOMPILERPROC) internal::LazyResolve ("glReleaseShaderCompiler") : OGLP_ENTRY (ReleaseShaderCompiler);
+    table->ShaderBinary = OGLP_ENTRY (ShaderBinary) == internal::Lazy_ShaderBinary
+        ? (PFNGLSHADERBINARYPROC) internal::LazyResolve ("glShaderBinary") : OGLP_ENTRY (ShaderBinary);
+    table->GetShaderPrecisionFormat = OGLP_ENTRY (GetShaderPrecisionFormat) == internal::Lazy_GetShaderPrecisionFormat
+        ? (PFNGLGETSHADERPRECISIONFORMATPROC) internal::LazyResolve ("glGetShaderPrecisionFormat") : OGLP_ENTRY (GetShaderPrecisionFormat);
+    table->DepthRangef = OGLP_ENTRY (DepthRangef) == internal::Lazy_DepthRangef
+        ? (PFNGLDEPTHRANGEFPROC) internal::LazyResolve ("glDepthRangef") : OGLP_ENTRY (DepthRangef);
+    table->ClearDepthf = OGLP_ENTRY (ClearDepthf) == internal::Lazy_ClearDepthf
+        ? (PFNGLCLEARDEPTHFPROC) internal::LazyResolve ("glClearDepthf") : OGLP_ENTRY (ClearDepthf);
+    table->GetProgramBinary = OGLP_ENTRY (GetProgramBinary) == internal::Lazy_GetProgramBinary
+        ? (PFNGLGETPROGRAMBINARYPROC) internal::LazyResolve ("glGetProgramBinary") : OGLP_ENTRY (GetProgramBinary);
+    table->ProgramBinary = OGLP_ENTRY (ProgramBinary) == internal::Lazy_ProgramBinary
+        ? (PFNGLPROGRAMBINARYPROC) internal::LazyResolve ("glProgramBinary") : OGLP_ENTRY (ProgramBinary);
+    table->ProgramParameteri = OGLP_ENTRY (ProgramParameteri) == internal::Lazy_ProgramParameteri
+        ? (PFNGLPROGRAMPARAMETERIPROC) internal::LazyResolve ("glProgramParameteri") : OGLP_ENTRY (ProgramParameteri);
+    table->UseProgramStages = OGLP_ENTRY (UseProgramStages) == internal::Lazy_UseProgramStages
+        ? (PFNGLUSEPROGRAMSTAGESPROC) internal::LazyResolve ("glUseProgramStages") : OGLP_ENTRY (UseProgramStages);
+    table->ActiveShaderProgram = OGLP_ENTRY (ActiveShaderProgram) == internal::Lazy_ActiveShaderProgram
+        ? (PFNGLACTIVESHADERPROGRAMPROC) internal::LazyResolve ("glActiveShaderProgram") : OGLP_ENTRY (ActiveShaderProgram);
+    table->CreateShaderProgramv = OGLP_ENTRY (CreateShaderProgramv) == internal::Lazy_CreateShaderProgramv
+        ? (PFNGLCREATESHADERPROGRAMVPROC) internal::LazyResolve ("glCreateShaderProgramv") : OGLP_ENTRY (CreateShaderProgramv);
+    table->BindProgramPipeline = OGLP_ENTRY (BindProgramPipeline) == internal::Lazy_BindProgramPipeline
+        ? (PFNGLBINDPROGRAMPIPELINEPROC) internal::LazyResolve ("glBindProgramPipeline") : OGLP_ENTRY (BindProgramPipeline);
+    table->DeleteProgramPipelines = OGLP_ENTRY (DeleteProgramPipelines) == internal::Lazy_DeleteProgramPipelines
+        ? (PFNGLDELETEPROGRAMPIPELINESPROC) internal::LazyResolve ("glDeleteProgramPipelines") : OGLP_ENTRY (DeleteProgramPipelines);
+    table->GenProgramPipelines = OGLP_ENTRY (GenProgramPipelines) == internal::Lazy_GenProgramPipelines
+        ? (PFNGLGENPROGRAMPIPELINESPROC) internal::LazyResolve ("glGenProgramPipelines") : OGLP_ENTRY (GenProgramPipelines);
+    table->IsProgramPipeline = OGLP_ENTRY (IsProgramPipeline) == internal::Lazy_IsProgramPipeline
+        ? (PFNGLISPROGRAMPIPELINEPROC) internal::LazyResolve ("glIsProgramPipeline") : OGLP_ENTRY (IsProgramPipeline);
+    table->GetProgramPipelineiv = OGLP_ENTRY (GetProgramPipelineiv) == internal::Lazy_GetProgramPipelineiv
+        ? (PFNGLGETPROGRAMPIPELINEIVPROC) internal::LazyResolve ("glGetProgramPipelineiv") : OGLP_ENTRY (GetProgramPipelineiv);
+    table->ProgramUniform1i = OGLP_ENTRY (ProgramUniform1i) == internal::Lazy_ProgramUniform1i
+        ? (PFNGLPROGRAMUNIFORM1IPROC) internal::LazyResolve ("glProgramUniform1i") : OGLP_ENTRY (ProgramUniform1i);
+    table->ProgramUniform1iv = OGLP_ENTRY (ProgramUniform1iv) == internal::Lazy_ProgramUniform1iv
+        ? (PFNGLPROGRAMUNIFORM1IVPROC) internal::LazyResolve ("glProgramUniform1iv") : OGLP_ENTRY (ProgramUniform1iv);
+    table->ProgramUniform1f = OGLP_ENTRY (ProgramUniform1f) == internal::Lazy_ProgramUniform1f
+        ? (PFNGLPROGRAMUNIFORM1FPROC) internal::LazyResolve ("glProgramUniform1f") : OGLP_ENTRY (ProgramUniform1f);
+    table->ProgramUniform1fv = OGLP_ENTRY (ProgramUniform1fv) == internal::Lazy_ProgramUniform1fv
+        ? (PFNGLPROGRAMUNIFORM1FVPROC) internal::LazyResolve ("glProgramUniform1fv") : OGLP_ENTRY (ProgramUniform1fv);
+    table->ProgramUniform1d = OGLP_ENTRY (ProgramUniform1d) == internal::Lazy_ProgramUniform1d
+        ? (PFNGLPROGRAMUNIFORM1DPROC) internal::LazyResolve ("glProgramUniform1d") : OGLP_ENTRY (ProgramUniform1d);
+    table->ProgramUniform1dv = OGLP_ENTRY (ProgramUniform1dv) == internal::Lazy_ProgramUniform1dv
+        ? (PFNGLPROGRAMUNIFORM1DVPROC) internal::LazyResolve ("glProgramUniform1dv") : OGLP_ENTRY (ProgramUniform1dv);
+    table->ProgramUniform1ui = OGLP_ENTRY (ProgramUniform1ui) == internal::Lazy_ProgramUniform1ui
+        ? (PFNGLPROGRAMUNIFORM1UIPROC) internal::LazyResolve ("glProgramUniform1ui") : OGLP_ENTRY (ProgramUniform1ui);
+    table->ProgramUniform1uiv = OGLP_ENTRY (ProgramUniform1uiv) == internal::Lazy_ProgramUniform1uiv
+        ? (PFNGLPROGRAMUNIFORM1UIVPROC) internal::LazyResolve ("glProgramUniform1uiv") : OGLP_ENTRY (ProgramUniform1uiv);
+    table->ProgramUniform2i = OGLP_ENTRY (ProgramUniform2i) == internal::Lazy_ProgramUniform2i
+        ? (PFNGLPROGRAMUNIFORM2IPROC) internal::LazyResolve ("glProgramUniform2i") : OGLP_ENTRY (ProgramUniform2i);
+    table->ProgramUniform2iv = OGLP_ENTRY (ProgramUniform2iv) == internal::Lazy_ProgramUniform2iv
+        ? (PFNGLPROGRAMUNIFORM2IVPROC) internal::LazyResolve ("glProgramUniform2iv") : OGLP_ENTRY (ProgramUniform2iv);
+    table->ProgramUniform2f = OGLP_ENTRY (ProgramUniform2f) == internal::Lazy_ProgramUniform2f
+        ? (PFNGLPROGRAMUNIFORM2FPROC) internal::LazyResolve ("glProgramUniform2f") : OGLP_ENTRY (ProgramUniform2f);
+    table->ProgramUniform2fv = OGLP_ENTRY (ProgramUniform2fv) == internal::Lazy_ProgramUniform2fv
+        ? (PFNGLPROGRAMUNIFORM2FVPROC) internal::LazyResolve ("glProgramUniform2fv") : OGLP_ENTRY (ProgramUniform2fv);
+    table->ProgramUniform2d = OGLP_ENTRY (ProgramUniform2d) == internal::Lazy_ProgramUniform2d
+        ? (PFNGLPROGRAMUNIFORM2DPROC) internal::LazyResolve ("glProgramUniform2d") : OGLP_ENTRY (ProgramUniform2d);
+    table->ProgramUniform2dv = OGLP_ENTRY (ProgramUniform2dv) == internal::Lazy_ProgramUniform2dv
+        ? (PFNGLPROGRAMUNIFORM2DVPROC) internal::LazyResolve ("glProgramUniform2dv") : OGLP_ENTRY (ProgramUniform2dv);
+    table->ProgramUniform2ui = OGLP_ENTRY (ProgramUniform2ui) == internal::Lazy_ProgramUniform2ui
+        ? (PFNGLPROGRAMUNIFORM2UIPROC) internal::LazyResolve ("glProgramUniform2ui") : OGLP_ENTRY (ProgramUniform2ui);
+    table->ProgramUniform2uiv = OGLP_ENTRY (ProgramUniform2uiv) == internal::Lazy_ProgramUniform2uiv
+        ? (PFNGLPROGRAMUNIFORM2UIVPROC) internal::LazyResolve ("glProgramUniform2uiv") : OGLP_ENTRY (ProgramUniform2uiv);
+    table->ProgramUniform3i = OGLP_ENTRY (ProgramUniform3i) == internal::Lazy_ProgramUniform3i
+        ? (PFNGLPROGRAMUNIFORM3IPROC) internal::LazyResolve ("glProgramUniform3i") : OGLP_ENTRY (ProgramUniform3i);
+    table->ProgramUniform3iv = OGLP_ENTRY (ProgramUniform3iv) == internal::Lazy_ProgramUniform3iv
+        ? (PFNGLPROGRAMUNIFORM3IVPROC) internal::LazyResolve ("glProgramUniform3iv") : OGLP_ENTRY (ProgramUniform3iv);
+    table->ProgramUniform3f = OGLP_ENTRY (ProgramUniform3f) == internal::Lazy_ProgramUniform3f
+        ? (PFNGLPROGRAMUNIFORM3FPROC) internal::LazyResolve ("glProgramUniform3f") : OGLP_ENTRY (ProgramUniform3f);
+    table->ProgramUniform3fv = OGLP_ENTRY (ProgramUniform3fv) == internal::Lazy_ProgramUniform3fv
+        ? (PFNGLPROGRAMUNIFORM3FVPROC) internal::LazyResolve ("glProgramUniform3fv") : OGLP_ENTRY (ProgramUniform3fv);
+    table->ProgramUniform3d = OGLP_ENTRY (ProgramUniform3d) == internal::Lazy_ProgramUniform3d
+        ? (PFNGLPROGRAMUNIFORM3DPROC) internal::LazyResolve ("glProgramUniform3d") : OGLP_ENTRY (ProgramUniform3d);
+    table->ProgramUniform3dv = OGLP_ENTRY (ProgramUniform3dv) == internal::Lazy_ProgramUniform3dv
+        ? (PFNGLPROGRAMUNIFORM3DVPROC) internal::LazyResolve ("glProgramUniform3dv") : OGLP_ENTRY (ProgramUniform3dv);
+    table->ProgramUniform3ui = OGLP_ENTRY (ProgramUniform3ui) == internal::Lazy_ProgramUniform3ui
+        ? (PFNGLPROGRAMUNIFORM3UIPROC) internal::LazyResolve ("glProgramUniform3ui") : OGLP_ENTRY (ProgramUniform3ui);
+    table->ProgramUniform3uiv = OGLP_ENTRY (ProgramUniform3uiv) == internal::Lazy_ProgramUniform3uiv
+        ? (PFNGLPROGRAMUNIFORM3UIVPROC) internal::LazyResolve ("glProgramUniform3uiv") : OGLP_ENTRY (ProgramUniform3uiv);
+    table->ProgramUniform4i = OGLP_ENTRY (ProgramUniform4i) == internal::Lazy_ProgramUniform4i
+        ? (PFNGLPROGRAMUNIFORM4IPROC) internal::LazyResolve ("glProgramUniform4i") : OGLP_ENTRY (ProgramUniform4i);
+    table->ProgramUniform4iv = OGLP_ENTRY (ProgramUniform4iv) == internal::Lazy_ProgramUniform4iv
+        ? (PFNGLPROGRAMUNIFORM4IVPROC) internal::LazyResolve ("glProgramUniform4iv") : OGLP_ENTRY (ProgramUniform4iv);
+    table->ProgramUniform4f = OGLP_ENTRY (ProgramUniform4f) == internal::Lazy_ProgramUniform4f
+        ? (PFNGLPROGRAMUNIFORM4FPROC) internal::LazyResolve ("glProgramUniform4f") : OGLP_ENTRY (ProgramUniform4f);
+    table->ProgramUniform4fv = OGLP_ENTRY (ProgramUniform4fv) == internal::Lazy_ProgramUniform4fv
+        ? (PFNGLPROGRAMUNIFORM4FVPROC) internal::LazyResolve ("glProgramUniform4fv") : OGLP_ENTRY (ProgramUniform4fv);
+    table->ProgramUniform4d = OGLP_ENTRY (ProgramUniform4d) == internal::Lazy_ProgramUniform4d
+        ? (PFNGLPROGRAMUNIFORM4DPROC) internal::LazyResolve ("glProgramUniform4d") : OGLP_ENTRY (ProgramUniform4d);
+    table->ProgramUniform4dv = OGLP_ENTRY (ProgramUniform4dv) == internal::Lazy_ProgramUniform4dv
+        ? (PFNGLPROGRAMUNIFORM4DVPROC) internal::LazyResolve ("glProgramUniform4dv") : OGLP_ENTRY (ProgramUniform4dv);
+    table->ProgramUniform4ui = OGLP_ENTRY (ProgramUniform4ui) == internal::Lazy_ProgramUniform4ui
+        ? (PFNGLPROGRAMUNIFORM4UIPROC) internal::LazyResolve ("glProgramUniform4ui") : OGLP_ENTRY (ProgramUniform4ui);
+    table->ProgramUniform4uiv = OGLP_ENTRY (ProgramUniform4uiv) == internal::Lazy_ProgramUniform4uiv
+        ? (PFNGLPROGRAMUNIFORM4UIVPROC) internal::LazyResolve ("glProgramUniform4uiv") : OGLP_ENTRY (ProgramUniform4uiv);
+    table->ProgramUniformMatrix2fv = OGLP_ENTRY (ProgramUniformMatrix2fv) == internal::Lazy_ProgramUniformMatrix2fv
+        ? (PFNGLPROGRAMUNIFORMMATRIX2FVPROC) internal::LazyResolve ("glProgramUniformMatrix2fv") : OGLP_ENTRY (ProgramUniformMatrix2fv);
+    table->ProgramUniformMatrix3fv = OGLP_ENTRY (ProgramUniformMatrix3fv) == internal::Lazy_ProgramUniformMatrix3fv
+        ? (PFNGLPROGRAMUNIFORMMATRIX3FVPROC) internal::LazyResolve ("glProgramUniformMatrix3fv") : OGLP_ENTRY (ProgramUniformMatrix3fv);
+    table->ProgramUniformMatrix4fv = OGLP_ENTRY (ProgramUniformMatrix4fv) == internal::Lazy_ProgramUniformMatrix4fv
+        ? (PFNGLPROGRAMUNIFORMMATRIX4FVPROC) internal::LazyResolve ("glProgramUniformMatrix4fv") : OGLP_ENTRY (ProgramUniformMatrix4fv);
+    table->ProgramUniformMatrix2dv = OGLP_ENTRY (ProgramUniformMatrix2dv) == internal::Lazy_ProgramUniformMatrix2dv
+        ? (PFNGLPROGRAMUNIFORMMATRIX2DVPROC) internal::LazyResolve ("glProgramUniformMatrix2dv") : OGLP_ENTRY (ProgramUniformMatrix2dv);
+    table->ProgramUniformMatrix3dv = OGLP_ENTRY (ProgramUniformMatrix3dv) == internal::Lazy_ProgramUniformMatrix3dv
+        ? (PFNGLPROGRAMUNIFORMMATRIX3DVPROC) internal::LazyResolve ("glProgramUniformMatrix3dv") : OGLP_ENTRY (ProgramUniformMatrix3dv);
+    table->ProgramUniformMatrix4dv = OGLP_ENTRY (ProgramUniformMatrix4dv) == internal::Lazy_ProgramUniformMatrix4dv
+        ? (PFNGLPROGRAMUNIFORMMATRIX4DVPROC) internal::LazyResolve ("glProgramUniformMatrix4dv") : OGLP_ENTRY (ProgramUniformMatrix4dv);
+    table->ProgramUniformMatrix2x3fv = OGLP_ENTRY (ProgramUniformMatrix2x3fv) == internal::Lazy_ProgramUniformMatrix2x3fv
+        ? (PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC) internal::LazyResolve ("glProgramUniformMatrix2x3fv") : OGLP_ENTRY (ProgramUniformMatrix2x3fv);
+    table->ProgramUniformMatrix3x2fv = OGLP_ENTRY (ProgramUniformMatrix3x2fv) == internal::Lazy_ProgramUniformMatrix3x2fv
+        ? (PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC) internal::LazyResolve ("glProgramUniformMatrix3x2fv") : OGLP_ENTRY (ProgramUniformMatrix3x2fv);
+    table->ProgramUniformMatrix2x4fv = OGLP_ENTRY (ProgramUniformMatrix2x4fv) == internal::Lazy_ProgramUniformMatrix2x4fv
+        ? (PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC) internal::LazyResolve ("glProgramUniformMatrix2x4fv") : OGLP_ENTRY (ProgramUniformMatrix2x4fv);
+    table->ProgramUniformMatrix4x2fv = OGLP_ENTRY (ProgramUniformMatrix4x2fv) == internal::Lazy_ProgramUniformMatrix4x2fv
+        ? (PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC) internal::LazyResolve ("glProgramUniformMatrix4x2fv") : OGLP_ENTRY (ProgramUniformMatrix4x2fv);
+    table->ProgramUniformMatrix3x4fv = OGLP_ENTRY (ProgramUniformMatrix3x4fv) == internal::Lazy_ProgramUniformMatrix3x4fv
+        ? (PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC) internal::LazyResolve ("glProgramUniformMatrix3x4fv") : OGLP_ENTRY (ProgramUniformMatrix3x4fv);
+    table->ProgramUniformMatrix4x3fv = OGLP_ENTRY (ProgramUniformMatrix4x3fv) == internal::Lazy_ProgramUniformMatrix4x3fv
+        ? (PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC) internal::LazyResolve ("glProgramUniformMatrix4x3fv") : OGLP_ENTRY (ProgramUniformMatrix4x3fv);
+    table->ProgramUniformMatrix2x3dv = OGLP_ENTRY (ProgramUniformMatrix2x3dv) == internal::Lazy_ProgramUniformMatrix2x3dv
+        ? (PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC) internal::LazyResolve ("glProgramUniformMatrix2x3dv") : OGLP_ENTRY (ProgramUniformMatrix2x3dv);
+    table->ProgramUniformMatrix3x2dv = OGLP_ENTRY (ProgramUniformMatrix3x2dv) == internal::Lazy_ProgramUniformMatrix3x2dv
+        ? (PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC) internal::LazyResolve ("glProgramUniformMatrix3x2dv") : OGLP_ENTRY (ProgramUniformMatrix3x2dv);
+    table->ProgramUniformMatrix2x4dv = OGLP_ENTRY (ProgramUniformMatrix2x4dv) == internal::Lazy_ProgramUniformMatrix2x4dv
+        ? (PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC) internal::LazyResolve ("glProgramUniformMatrix2x4dv") : OGLP_ENTRY (ProgramUniformMatrix2x4dv);
+    table->ProgramUniformMatrix4x2dv = OGLP_ENTRY (ProgramUniformMatrix4x2dv) == internal::Lazy_ProgramUniformMatrix4x2dv
+        ? (PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC) internal::LazyResolve ("glProgramUniformMatrix4x2dv") : OGLP_ENTRY (ProgramUniformMatrix4x2dv);
+    table->ProgramUniformMatrix3x4dv = OGLP_ENTRY (ProgramUniformMatrix3x4dv) == internal::Lazy_ProgramUniformMatrix3x4dv
+        ? (PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC) internal::LazyResolve ("glProgramUniformMatrix3x4dv") : OGLP_ENTRY (ProgramUniformMatrix3x4dv);
+    table->ProgramUniformMatrix4x3dv = OGLP_ENTRY (ProgramUniformMatrix4x3dv) == internal::Lazy_ProgramUniformMatrix4x3dv
+        ? (PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC) internal::LazyResolve ("glProgramUniformMatrix4x3dv") : OGLP_ENTRY (ProgramUniformMatrix4x3dv);
+    table->ValidateProgramPipeline = OGLP_ENTRY (ValidateProgramPipeline) == internal::Lazy_ValidateProgramPipeline
+        ? (PFNGLVALIDATEPROGRAMPIPELINEPROC) internal::LazyResolve ("glValidateProgramPipeline") : OGLP_ENTRY (ValidateProgramPipeline);
+    table->GetProgramPipelineInfoLog = OGLP_ENTRY (GetProgramPipelineInfoLog) == internal::Lazy_GetProgramPipelineInfoLog
+        ? (PFNGLGETPROGRAMPIPELINEINFOLOGPROC) internal::LazyResolve ("glGetProgramPipelineInfoLog") : OGLP_ENTRY (GetProgramPipelineInfoLog);
+    table->VertexAttribL1d = OGLP_ENTRY (VertexAttribL1d) == internal::Lazy_VertexAttribL1d
+        ? (PFNGLVERTEXATTRIBL1DPROC) internal::LazyResolve ("glVertexAttribL1d") : OGLP_ENTRY (VertexAttribL1d);
+    table->VertexAttribL2d = OGLP_ENTRY (VertexAttribL2d) == internal::Lazy_VertexAttribL2d
+        ? (PFNGLVERTEXATTRIBL2DPROC) internal::LazyResolve ("glVertexAttribL2d") : OGLP_ENTRY (VertexAttribL2d);
+    table->VertexAttribL3d = OGLP_ENTRY (VertexAttribL3d) == internal::Lazy_VertexAttribL3d
+        ? (PFNGLVERTEXATTRIBL3DPROC) internal::LazyResolve ("glVertexAttribL3d") : OGLP_ENTRY (VertexAttribL3d);
+    table->VertexAttribL4d = OGLP_ENTRY (VertexAttribL4d) == internal::Lazy_VertexAttribL4d
+        ? (PFNGLVERTEXATTRIBL4DPROC) internal::LazyResolve ("glVertexAttribL4d") : OGLP_ENTRY (VertexAttribL4d);
+    table->VertexAttribL1dv = OGLP_ENTRY (VertexAttribL1dv) == internal::Lazy_VertexAttribL1dv
+        ? (PFNGLVERTEXATTRIBL1DVPROC) internal::LazyResolve ("glVertexAttribL1dv") : OGLP_ENTRY (VertexAttribL1dv);
+    table->VertexAttribL2dv = OGLP_ENTRY (VertexAttribL2dv) == internal::Lazy_VertexAttribL2dv
+        ? (PFNGLVERTEXATTRIBL2DVPROC) internal::LazyResolve ("glVertexAttribL2dv") : OGLP_ENTRY (VertexAttribL2dv);
+    table->VertexAttribL3dv = OGLP_ENTRY (VertexAttribL3dv) == internal::Lazy_VertexAttribL3dv
+        ? (PFNGLVERTEXATTRIBL3DVPROC) internal::LazyResolve ("glVertexAttribL3dv") : OGLP_ENTRY (VertexAttribL3dv);
+    table->VertexAttribL4dv = OGLP_ENTRY (VertexAttribL4dv) == internal::Lazy_VertexAttribL4dv
+        ? (PFNGLVERTEXATTRIBL4DVPROC) internal::LazyResolve ("glVertexAttribL4dv") : OGLP_ENTRY (VertexAttribL4dv);
+    table->VertexAttribLPointer = OGLP_ENTRY (VertexAttribLPointer) == internal::Lazy_VertexAttribLPointer
+        ? (PFNGLVERTEXATTRIBLPOINTERPROC) internal::LazyResolve ("glVertexAttribLPointer") : OGLP_ENTRY (VertexAttribLPointer);
+    table->GetVertexAttribLdv = OGLP_ENTRY (GetVertexAttribLdv) == internal::Lazy_GetVertexAttribLdv
+        ? (PFNGLGETVERTEXATTRIBLDVPROC) internal::LazyResolve ("glGetVertexAttribLdv") : OGLP_ENTRY (GetVertexAttribLdv);
+    table->ViewportArrayv = OGLP_ENTRY (ViewportArrayv) == internal::Lazy_ViewportArrayv
+        ? (PFNGLVIEWPORTARRAYVPROC) internal::LazyResolve ("glViewportArrayv") : OGLP_ENTRY (ViewportArrayv);
+    table->ViewportIndexedf = OGLP_ENTRY (ViewportIndexedf) == internal::Lazy_ViewportIndexedf
+        ? (PFNGLVIEWPORTINDEXEDFPROC) internal::LazyResolve ("glViewportIndexedf") : OGLP_ENTRY (ViewportIndexedf);
+    table->ViewportIndexedfv = OGLP_ENTRY (ViewportIndexedfv) == internal::Lazy_ViewportIndexedfv
+        ? (PFNGLVIEWPORTINDEXEDFVPROC) internal::LazyResolve ("glViewportIndexedfv") : OGLP_ENTRY (ViewportIndexedfv);
+    table->ScissorArrayv = OGLP_ENTRY (ScissorArrayv) == internal::Lazy_ScissorArrayv
+        ? (PFNGLSCISSORARRAYVPROC) internal::LazyResolve ("glScissorArrayv") : OGLP_ENTRY (ScissorArrayv);
+    table->ScissorIndexed = OGLP_ENTRY (ScissorIndexed) == internal::Lazy_ScissorIndexed
+        ? (PFNGLSCISSORINDEXEDPROC) internal::LazyResolve ("glScissorIndexed") : OGLP_ENTRY (ScissorIndexed);
+    table->ScissorIndexedv = OGLP_ENTRY (ScissorIndexedv) == internal::Lazy_ScissorIndexedv
+        ? (PFNGLSCISSORINDEXEDVPROC) internal::LazyResolve ("glScissorIndexedv") : OGLP_ENTRY (ScissorIndexedv);
+    table->DepthRangeArrayv = OGLP_ENTRY (DepthRangeArrayv) == internal::Lazy_DepthRangeArrayv
+        ? (PFNGLDEPTHRANGEARRAYVPROC) internal::LazyResolve ("glDepthRangeArrayv") : OGLP_ENTRY (DepthRangeArrayv);
+    table->DepthRangeIndexed = OGLP_ENTRY (DepthRangeIndexed) == internal::Lazy_DepthRangeIndexed
+        ? (PFNGLDEPTHRANGEINDEXEDPROC) internal::LazyResolve ("glDepthRangeIndexed") : OGLP_ENTRY (DepthRangeIndexed);
+    table->GetFloati_v = OGLP_ENTRY (GetFloati_v) == internal::Lazy_GetFloati_v
+        ? (PFNGLGETFLOATI_VPROC) internal::LazyResolve ("glGetFloati_v") : OGLP_ENTRY (GetFloati_v);
+    table->GetDoublei_v = OGLP_ENTRY (GetDoublei_v) == internal::Lazy_GetDoublei_v
+        ? (PFNGLGETDOUBLEI_VPROC) internal::LazyResolve ("glGetDoublei_v") : OGLP_ENTRY (GetDoublei_v);
+    table->DrawArraysInstancedBaseInstance = OGLP_ENTRY (DrawArraysInstancedBaseInstance) == internal::Lazy_DrawArraysInstancedBaseInstance
+        ? (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC) internal::LazyResolve ("glDrawArraysInstancedBaseInstance") : OGLP_ENTRY (DrawArraysInstancedBaseInstance);
+    table->DrawElementsInstancedBaseInstance = OGLP_ENTRY (DrawElementsInstancedBaseInstance) == internal::Lazy_DrawElementsInstancedBaseInstance
+        ? (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC) internal::LazyResolve ("glDrawElementsInstancedBaseInstance") : OGLP_ENTRY (DrawElementsInstancedBaseInstance);
+    table->DrawElementsInstancedBaseVertexBaseInstance = OGLP_ENTRY (DrawElementsInstancedBaseVertexBaseInstance) == internal::Lazy_DrawElementsInstancedBaseVertexBaseInstance
+        ? (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC) internal::LazyResolve ("glDrawElementsInstancedBaseVertexBaseInstance") : OGLP_ENTRY (DrawElementsInstancedBaseVertexBaseInstance);
+    table->GetInternalformativ = OGLP_ENTRY (GetInternalformativ) == internal::Lazy_GetInternalformativ
+        ? (PFNGLGETINTERNALFORMATIVPROC) internal::LazyResolve ("glGetInternalformativ") : OGLP_ENTRY (GetInternalformativ);
+    table->GetActiveAtomicCounterBufferiv = OGLP_ENTRY (GetActiveAtomicCounterBufferiv) == internal::Lazy_GetActiveAtomicCounterBufferiv
+        ? (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC) internal::LazyResolve ("glGetActiveAtomicCounterBufferiv") : OGLP_ENTRY (GetActiveAtomicCounterBufferiv);
+    table->BindImageTexture = OGLP_ENTRY (BindImageTexture) == internal::Lazy_BindImageTexture
+        ? (PFNGLBINDIMAGETEXTUREPROC) internal::LazyResolve ("glBindImageTexture") : OGLP_ENTRY (BindImageTexture);
+    table->MemoryBarrier = OGLP_ENTRY (MemoryBarrier) == internal::Lazy_MemoryBarrier
+        ? (PFNGLMEMORYBARRIERPROC) internal::LazyResolve ("glMemoryBarrier") : OGLP_ENTRY (MemoryBarrier);
+    table->TexStorage1D = OGLP_ENTRY (TexStorage1D) == internal::Lazy_TexStorage1D
+        ? (PFNGLTEXSTORAGE1DPROC) internal::LazyResolve ("glTexStorage1D") : OGLP_ENTRY (TexStorage1D);
+    table->TexStorage2D = OGLP_ENTRY (TexStorage2D) == internal::Lazy_TexStorage2D
+        ? (PFNGLTEXSTORAGE2DPROC) internal::LazyResolve ("glTexStorage2D") : OGLP_ENTRY (TexStorage2D);
+    table->TexStorage3D = OGLP_ENTRY (TexStorage3D) == internal::Lazy_TexStorage3D
+        ? (PFNGLTEXSTORAGE3DPROC) internal::LazyResolve ("glTexStorage3D") : OGLP_ENTRY (TexStorage3D);
+    table->DrawTransformFeedbackInstanced = OGLP_ENTRY (DrawTransformFeedbackInstanced) == internal::Lazy_DrawTransformFeedbackInstanced
+        ? (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC) internal::LazyResolve ("glDrawTransformFeedbackInstanced") : OGLP_ENTRY (DrawTransformFeedbackInstanced);
+    table->DrawTransformFeedbackStreamInstanced = OGLP_ENTRY (DrawTransformFeedbackStreamInstanced) == internal::Lazy_DrawTransformFeedbackStreamInstanced
+        ? (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC) internal::LazyResolve ("glDrawTransformFeedbackStreamInstanced") : OGLP_ENTRY (DrawTransformFeedbackStreamInstanced);
+    table->ClearBufferData = OGLP_ENTRY (ClearBufferData) == internal::Lazy_ClearBufferData
+        ? (PFNGLCLEARBUFFERDATAPROC) internal::LazyResolve ("glClearBufferData") : OGLP_ENTRY (ClearBufferData);
+    table->ClearBufferSubData = OGLP_ENTRY (ClearBufferSubData) == internal::Lazy_ClearBufferSubData
+        ? (PFNGLCLEARBUFFERSUBDATAPROC) internal::LazyResolve ("glClearBufferSubData") : OGLP_ENTRY (ClearBufferSubData);
+    table->DispatchCompute = OGLP_ENTRY (DispatchCompute) == internal::Lazy_DispatchCompute
+        ? (PFNGLDISPATCHCOMPUTEPROC) internal::LazyResolve ("glDispatchCompute") : OGLP_ENTRY (DispatchCompute);
+    table->DispatchComputeIndirect = OGLP_ENTRY (DispatchComputeIndirect) == internal::Lazy_DispatchComputeIndirect
+        ? (PFNGLDISPATCHCOMPUTEINDIRECTPROC) internal::LazyResolve ("glDispatchComputeIndirect") : OGLP_ENTRY (DispatchComputeIndirect);
+    table->CopyImageSubData = OGLP_ENTRY (CopyImageSubData) == internal::Lazy_CopyImageSubData
+        ? (PFNGLCOPYIMAGESUBDATAPROC) internal::LazyResolve ("glCopyImageSubData") : OGLP_ENTRY (CopyImageSubData);
+    table->FramebufferParameteri = OGLP_ENTRY (FramebufferParameteri) == internal::Lazy_FramebufferParameteri
+        ? (PFNGLFRAMEBUFFERPARAMETERIPROC) internal::LazyResolve ("glFramebufferParameteri") : OGLP_ENTRY (FramebufferParameteri);
+    table->GetFramebufferParameteriv = OGLP_ENTRY (GetFramebufferParameteriv) == internal::Lazy_GetFramebufferParameteriv
+        ? (PFNGLGETFRAMEBUFFERPARAMETERIVPROC) internal::LazyResolve ("glGetFramebufferParameteriv") : OGLP_ENTRY (GetFramebufferParameteriv);
+    table->GetInternalformati64v = OGLP_ENTRY (GetInternalformati64v) == internal::Lazy_GetInternalformati64v
+        ? (PFNGLGETINTERNALFORMATI64VPROC) internal::LazyResolve ("glGetInternalformati64v") : OGLP_ENTRY (GetInternalformati64v);
+    table->InvalidateTexSubImage = OGLP_ENTRY (InvalidateTexSubImage) == internal::Lazy_InvalidateTexSubImage
+        ? (PFNGLINVALIDATETEXSUBIMAGEPROC) internal::LazyResolve ("glInvalidateTexSubImage") : OGLP_ENTRY (InvalidateTexSubImage);
+    table->InvalidateTexImage = OGLP_ENTRY (InvalidateTexImage) == internal::Lazy_InvalidateTexImage
+        ? (PFNGLINVALIDATETEXIMAGEPROC) internal::LazyResolve ("glInvalidateTexImage") : OGLP_ENTRY (InvalidateTexImage);
+    table->InvalidateBufferSubData = OGLP_ENTRY (InvalidateBufferSubData) == internal::Lazy_InvalidateBufferSubData
+        ? (PFNGLINVALIDATEBUFFERSUBDATAPROC) internal::LazyResolve ("glInvalidateBufferSubData") : OGLP_ENTRY (InvalidateBufferSubData);
+    table->InvalidateBufferData = OGLP_ENTRY (InvalidateBufferData) == internal::Lazy_InvalidateBufferData
+        ? (PFNGLINVALIDATEBUFFERDATAPROC) internal::LazyResolve ("glInvalidateBufferData") : OGLP_ENTRY (InvalidateBufferData);
+    table->InvalidateFramebuffer = OGLP_ENTRY (InvalidateFramebuffer) == internal::Lazy_InvalidateFramebuffer
+        ? (PFNGLINVALIDATEFRAMEBUFFERPROC) internal::LazyResolve ("glInvalidateFramebuffer") : OGLP_ENTRY (InvalidateFramebuffer);
+    table->InvalidateSubFramebuffer = OGLP_ENTRY (InvalidateSubFramebuffer) == internal::Lazy_InvalidateSubFramebuffer
+        ? (PFNGLINVALIDATESUBFRAMEBUFFERPROC) internal::LazyResolve ("glInvalidateSubFramebuffer") : OGLP_ENTRY (InvalidateSubFramebuffer);
+    table->MultiDrawArraysIndirect = OGLP_ENTRY (MultiDrawArraysIndirect) == internal::Lazy_MultiDrawArraysIndirect
+        ? (PFNGLMULTIDRAWARRAYSINDIRECTPROC) internal::LazyResolve ("glMultiDrawArraysIndirect") : OGLP_ENTRY (MultiDrawArraysIndirect);
+    table->MultiDrawElementsIndirect = OGLP_ENTRY (MultiDrawElementsIndirect) == internal::Lazy_MultiDrawElementsIndirect
+        ? (PFNGLMULTIDRAWELEMENTSINDIRECTPROC) internal::LazyResolve ("glMultiDrawElementsIndirect") : OGLP_ENTRY (MultiDrawElementsIndirect);
+    table->GetProgramInterfaceiv = OGLP_ENTRY (GetProgramInterfaceiv) == internal::Lazy_GetProgramInterfaceiv
+        ? (PFNGLGETPROGRAMINTERFACEIVPROC) internal::LazyResolve ("glGetProgramInterfaceiv") : OGLP_ENTRY (GetProgramInterfaceiv);
+    table->GetProgramResourceIndex = OGLP_ENTRY (GetProgramResourceIndex) == internal::Lazy_GetProgramResourceIndex
+        ? (PFNGLGETPROGRAMRESOURCEINDEXPROC) internal::LazyResolve ("glGetProgramResourceIndex") : OGLP_ENTRY (GetProgramResourceIndex);
+    table->GetProgramResourceName = OGLP_ENTRY (GetProgramResourceName) == internal::Lazy_GetProgramResourceName
+        ? (PFNGLGETPROGRAMRESOURCENAMEPROC) internal::LazyResolve ("glGetProgramResourceName") : OGLP_ENTRY (GetProgramResourceName);
+    table->GetProgramResourceiv = OGLP_ENTRY (GetProgramResourceiv) == internal::Lazy_GetProgramResourceiv
+        ? (PFNGLGETPROGRAMRESOURCEIVPROC) internal::LazyResolve ("glGetProgramResourceiv") : OGLP_ENTRY (GetProgramResourceiv);
+    table->GetProgramResourceLocation = OGLP_ENTRY (GetProgramResourceLocation) == internal::Lazy_GetProgramResourceLocation
+        ? (PFNGLGETPROGRAMRESOURCELOCATIONPROC) internal::LazyResolve ("glGetProgramResourceLocation") : OGLP_ENTRY (GetProgramResourceLocation);
+    table->GetProgramResourceLocationIndex = OGLP_ENTRY (GetProgramResourceLocationIndex) == internal::Lazy_GetProgramResourceLocationIndex
+        ? (PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC) internal::LazyResolve ("glGetProgramResourceLocationIndex") : OGLP_ENTRY (GetProgramResourceLocationIndex);
+    table->ShaderStorageBlockBinding = OGLP_ENTRY (ShaderStorageBlockBinding) == internal::Lazy_ShaderStorageBlockBinding
+        ? (PFNGLSHADERSTORAGEBLOCKBINDINGPROC) internal::LazyResolve ("glShaderStorageBlockBinding") : OGLP_ENTRY (ShaderStorageBlockBinding);
+    table->TexBufferRange = OGLP_ENTRY (TexBufferRange) == internal::Lazy_TexBufferRange
+        ? (PFNGLTEXBUFFERRANGEPROC) internal::LazyResolve ("glTexBufferRange") : OGLP_ENTRY (TexBufferRange);
+    table->TexStorage2DMultisample = OGLP_ENTRY (TexStorage2DMultisample) == internal::Lazy_TexStorage2DMultisample
+        ? (PFNGLTEXSTORAGE2DMULTISAMPLEPROC) internal::LazyResolve ("glTexStorage2DMultisample") : OGLP_ENTRY (TexStorage2DMultisample);
+    table->TexStorage3DMultisample = OGLP_ENTRY (TexStorage3DMultisample) == internal::Lazy_TexStorage3DMultisample
+        ? (PFNGLTEXSTORAGE3DMULTISAMPLEPROC) internal::LazyResolve ("glTexStorage3DMultisample") : OGLP_ENTRY (TexStorage3DMultisample);
+    table->TextureView = OGLP_ENTRY (TextureView) == internal::Lazy_TextureView
+        ? (PFNGLTEXTUREVIEWPROC) internal::LazyResolve ("glTextureView") : OGLP_ENTRY (TextureView);
+    table->BindVertexBuffer = OGLP_ENTRY (BindVertexBuffer) == internal::Lazy_BindVertexBuffer
+        ? (PFNGLBINDVERTEXBUFFERPROC) internal::LazyResolve ("glBindVertexBuffer") : OGLP_ENTRY (BindVertexBuffer);
+    table->VertexAttribFormat = OGLP_ENTRY (VertexAttribFormat) == internal::Lazy_VertexAttribFormat
+        ? (PFNGLVERTEXATTRIBFORMATPROC) internal::LazyResolve ("glVertexAttribFormat") : OGLP_ENTRY (VertexAttribFormat);
+    table->VertexAttribIFormat = OGLP_ENTRY (VertexAttribIFormat) == internal::Lazy_VertexAttribIFormat
+        ? (PFNGLVERTEXATTRIBIFORMATPROC) internal::LazyResolve ("glVertexAttribIFormat") : OGLP_ENTRY (VertexAttribIFormat);
+    table->VertexAttribLFormat = OGLP_ENTRY (VertexAttribLFormat) == internal::Lazy_VertexAttribLFormat
+        ? (PFNGLVERTEXATTRIBLFORMATPROC) internal::LazyResolve ("glVertexAttribLFormat") : OGLP_ENTRY (VertexAttribLFormat);
+    table->VertexAttribBinding = OGLP_ENTRY (VertexAttribBinding) == internal::Lazy_VertexAttribBinding
+        ? (PFNGLVERTEXATTRIBBINDINGPROC) internal::LazyResolve ("glVertexAttribBinding") : OGLP_ENTRY (VertexAttribBinding);
+    table->VertexBindingDivisor = OGLP_ENTRY (VertexBindingDivisor) == internal::Lazy_VertexBindingDivisor
+        ? (PFNGLVERTEXBINDINGDIVISORPROC) internal::LazyResolve ("glVertexBindingDivisor") : OGLP_ENTRY (VertexBindingDivisor);
+    table->DebugMessageControl = OGLP_ENTRY (DebugMessageControl) == internal::Lazy_DebugMessageControl
+        ? (PFNGLDEBUGMESSAGECONTROLPROC) internal::LazyResolve ("glDebugMessageControl") : OGLP_ENTRY (DebugMessageControl);
+    table->DebugMessageInsert = OGLP_ENTRY (DebugMessageInsert) == internal::Lazy_DebugMessageInsert
+        ? (PFNGLDEBUGMESSAGEINSERTPROC) internal::LazyResolve ("glDebugMessageInsert") : OGLP_ENTRY (DebugMessageInsert);
+    table->DebugMessageCallback = OGLP_ENTRY (DebugMessageCallback) == internal::Lazy_DebugMessageCallback
+        ? (PFNGLDEBUGMESSAGECALLBACKPROC) internal::LazyResolve ("glDebugMessageCallback") : OGLP_ENTRY (DebugMessageCallback);
+    table->GetDebugMessageLog = OGLP_ENTRY (GetDebugMessageLog) == internal::Lazy_GetDebugMessageLog
+        ? (PFNGLGETDEBUGMESSAGELOGPROC) internal::LazyResolve ("glGetDebugMessageLog") : OGLP_ENTRY (GetDebugMessageLog);
+    table->PushDebugGroup = OGLP_ENTRY (PushDebugGroup) == internal::Lazy_PushDebugGroup
+        ? (PFNGLPUSHDEBUGGROUPPROC) internal::LazyResolve ("glPushDebugGroup") : OGLP_ENTRY (PushDebugGroup);
+    table->PopDebugGroup = OGLP_ENTRY (PopDebugGroup) == internal::Lazy_PopDebugGroup
+        ? (PFNGLPOPDEBUGGROUPPROC) internal::LazyResolve ("glPopDebugGroup") : OGLP_ENTRY (PopDebugGroup);
+    table->ObjectLabel = OGLP_ENTRY (ObjectLabel) == internal::Lazy_ObjectLabel
+        ? (PFNGLOBJECTLABELPROC) internal::LazyResolve ("glObjectLabel") : OGLP_ENTRY (ObjectLabel);
+    table->GetObjectLabel = OGLP_ENTRY (GetObjectLabel) == internal::Lazy_GetObjectLabel
+        ? (PFNGLGETOBJECTLABELPROC) internal::LazyResolve ("glGetObjectLabel") : OGLP_ENTRY (GetObjectLabel);
+    table->ObjectPtrLabel = OGLP_ENTRY (ObjectPtrLabel) == internal::Lazy_ObjectPtrLabel
+        ? (PFNGLOBJECTPTRLABELPROC) internal::LazyResolve ("glObjectPtrLabel") : OGLP_ENTRY (ObjectPtrLabel);
+    table->GetObjectPtrLabel = OGLP_ENTRY (GetObjectPtrLabel) == internal::Lazy_GetObjectPtrLabel
+        ? (PFNGLGETOBJECTPTRLABELPROC) internal::LazyResolve ("glGetObjectPtrLabel") : OGLP_ENTRY (GetObjectPtrLabel);
+    table->BufferStorage = OGLP_ENTRY (BufferStorage) == internal::Lazy_BufferStorage
+        ? (PFNGLBUFFERSTORAGEPROC) internal::LazyResolve ("glBufferStorage") : OGLP_ENTRY (BufferStorage);
+    table->ClearTexImage = OGLP_ENTRY (ClearTexImage) == internal::Lazy_ClearTexImage
+        ? (PFNGLCLEARTEXIMAGEPROC) internal::LazyResolve ("glClearTexImage") : OGLP_ENTRY (ClearTexImage);
+    table->ClearTexSubImage = OGLP_ENTRY (ClearTexSubImage) == internal::Lazy_ClearTexSubImage
+        ? (PFNGLCLEARTEXSUBIMAGEPROC) internal::LazyResolve ("glClearTexSubImage") : OGLP_ENTRY (ClearTexSubImage);
+    table->BindBuffersBase = OGLP_ENTRY (BindBuffersBase) == internal::Lazy_BindBuffersBase
+        ? (PFNGLBINDBUFFERSBASEPROC) internal::LazyResolve ("glBindBuffersBase") : OGLP_ENTRY (BindBuffersBase);
+    table->BindBuffersRange = OGLP_ENTRY (BindBuffersRange) == internal::Lazy_BindBuffersRange
+        ? (PFNGLBINDBUFFERSRANGEPROC) internal::LazyResolve ("glBindBuffersRange") : OGLP_ENTRY (BindBuffersRange);
+    table->BindTextures = OGLP_ENTRY (BindTextures) == internal::Lazy_BindTextures
+        ? (PFNGLBINDTEXTURESPROC) internal::LazyResolve ("glBindTextures") : OGLP_ENTRY (BindTextures);
+    table->BindSamplers = OGLP_ENTRY (BindSamplers) == internal::Lazy_BindSamplers
+        ? (PFNGLBINDSAMPLERSPROC) internal::LazyResolve ("glBindSamplers") : OGLP_ENTRY (BindSamplers);
+    table->BindImageTextures = OGLP_ENTRY (BindImageTextures) == internal::Lazy_BindImageTextures
+        ? (PFNGLBINDIMAGETEXTURESPROC) internal::LazyResolve ("glBindImageTextures") : OGLP_ENTRY (BindImageTextures);
+    table->BindVertexBuffers = OGLP_ENTRY (BindVertexBuffers) == internal::Lazy_BindVertexBuffers
+        ? (PFNGLBINDVERTEXBUFFERSPROC) internal::LazyResolve ("glBindVertexBuffers") : OGLP_ENTRY (BindVertexBuffers);
+    table->ClipControl = OGLP_ENTRY (ClipControl) == internal::Lazy_ClipControl
+        ? (PFNGLCLIPCONTROLPROC) internal::LazyResolve ("glClipControl") : OGLP_ENTRY (ClipControl);
+    table->CreateTransformFeedbacks = OGLP_ENTRY (CreateTransformFeedbacks) == internal::Lazy_CreateTransformFeedbacks
+        ? (PFNGLCREATETRANSFORMFEEDBACKSPROC) internal::LazyResolve ("glCreateTransformFeedbacks") : OGLP_ENTRY (CreateTransformFeedbacks);
+    table->TransformFeedbackBufferBase = OGLP_ENTRY (TransformFeedbackBufferBase) == internal::Lazy_TransformFeedbackBufferBase
+        ? (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC) internal::LazyResolve ("glTransformFeedbackBufferBase") : OGLP_ENTRY (TransformFeedbackBufferBase);
+    table->TransformFeedbackBufferRange = OGLP_ENTRY (TransformFeedbackBufferRange) == internal::Lazy_TransformFeedbackBufferRange
+        ? (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC) internal::LazyResolve ("glTransformFeedbackBufferRange") : OGLP_ENTRY (TransformFeedbackBufferRange);
+    table->GetTransformFeedbackiv = OGLP_ENTRY (GetTransformFeedbackiv) == internal::Lazy_GetTransformFeedbackiv
+        ? (PFNGLGETTRANSFORMFEEDBACKIVPROC) internal::LazyResolve ("glGetTransformFeedbackiv") : OGLP_ENTRY (GetTransformFeedbackiv);
+    table->GetTransformFeedbacki_v = OGLP_ENTRY (GetTransformFeedbacki_v) == internal::Lazy_GetTransformFeedbacki_v
+        ? (PFNGLGETTRANSFORMFEEDBACKI_VPROC) internal::LazyResolve ("glGetTransformFeedbacki_v") : OGLP_ENTRY (GetTransformFeedbacki_v);
+    table->GetTransformFeedbacki64_v = OGLP_ENTRY (GetTransformFeedbacki64_v) == internal::Lazy_GetTransformFeedbacki64_v
+        ? (PFNGLGETTRANSFORMFEEDBACKI64_VPROC) internal::LazyResolve ("glGetTransformFeedbacki64_v") : OGLP_ENTRY (GetTransformFeedbacki64_v);
+    table->CreateBuffers = OGLP_ENTRY (CreateBuffers) == internal::Lazy_CreateBuffers
+        ? (PFNGLCREATEBUFFERSPROC) internal::LazyResolve ("glCreateBuffers") : OGLP_ENTRY (CreateBuffers);
+    table->NamedBufferStorage = OGLP_ENTRY (NamedBufferStorage) == internal::Lazy_NamedBufferStorage
+        ? (PFNGLNAMEDBUFFERSTORAGEPROC) internal::LazyResolve ("glNamedBufferStorage") : OGLP_ENTRY (NamedBufferStorage);
+    table->NamedBufferData = OGLP_ENTRY (NamedBufferData) == internal::Lazy_NamedBufferData
+        ? (PFNGLNAMEDBUFFERDATAPROC) internal::LazyResolve ("glNamedBufferData") : OGLP_ENTRY (NamedBufferData);
+    table->NamedBufferSubData = OGLP_ENTRY (NamedBufferSubData) == internal::Lazy_NamedBufferSubData
+        ? (PFNGLNAMEDBUFFERSUBDATAPROC) internal::LazyResolve ("glNamedBufferSubData") : OGLP_ENTRY (NamedBufferSubData);
+    table->CopyNamedBufferSubData = OGLP_ENTRY (CopyNamedBufferSubData) == internal::Lazy_CopyNamedBufferSubData
+        ? (PFNGLCOPYNAMEDBUFFERSUBDATAPROC) internal::LazyResolve ("glCopyNamedBufferSubData") : OGLP_ENTRY (CopyNamedBufferSubData);
+    table->ClearNamedBufferData = OGLP_ENTRY (ClearNamedBufferData) == internal::Lazy_ClearNamedBufferData
+        ? (PFNGLCLEARNAMEDBUFFERDATAPROC) internal::LazyResolve ("glClearNamedBufferData") : OGLP_ENTRY (ClearNamedBufferData);
+    table->ClearNamedBufferSubData = OGLP_ENTRY (ClearNamedBufferSubData) == internal::Lazy_ClearNamedBufferSubData
+        ? (PFNGLCLEARNAMEDBUFFERSUBDATAPROC) internal::LazyResolve ("glClearNamedBufferSubData") : OGLP_ENTRY (ClearNamedBufferSubData);
+    table->MapNamedBuffer = OGLP_ENTRY (MapNamedBuffer) == internal::Lazy_MapNamedBuffer
+        ? (PFNGLMAPNAMEDBUFFERPROC) internal::LazyResolve ("glMapNamedBuffer") : OGLP_ENTRY (MapNamedBuffer);
+    table->MapNamedBufferRange = OGLP_ENTRY (MapNamedBufferRange) == internal::Lazy_MapNamedBufferRange
+        ? (PFNGLMAPNAMEDBUFFERRANGEPROC) internal::LazyResolve ("glMapNamedBufferRange") : OGLP_ENTRY (MapNamedBufferRange);
+    table->UnmapNamedBuffer = OGLP_ENTRY (UnmapNamedBuffer) == internal::Lazy_UnmapNamedBuffer
+        ? (PFNGLUNMAPNAMEDBUFFERPROC) internal::LazyResolve ("glUnmapNamedBuffer") : OGLP_ENTRY (UnmapNamedBuffer);
+    table->FlushMappedNamedBufferRange = OGLP_ENTRY (FlushMappedNamedBufferRange) == internal::Lazy_FlushMappedNamedBufferRange
+        ? (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC) internal::LazyResolve ("glFlushMappedNamedBufferRange") : OGLP_ENTRY (FlushMappedNamedBufferRange);
+    table->GetNamedBufferParameteriv = OGLP_ENTRY (GetNamedBufferParameteriv) == internal::Lazy_GetNamedBufferParameteriv
+        ? (PFNGLGETNAMEDBUFFERPARAMETERIVPROC) internal::LazyResolve ("glGetNamedBufferParameteriv") : OGLP_ENTRY (GetNamedBufferParameteriv);
+    table->GetNamedBufferParameteri64v = OGLP_ENTRY (GetNamedBufferParameteri64v) == internal::Lazy_GetNamedBufferParameteri64v
+        ? (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC) internal::LazyResolve ("glGetNamedBufferParameteri64v") : OGLP_ENTRY (GetNamedBufferParameteri64v);
+    table->GetNamedBufferPointerv = OGLP_ENTRY (GetNamedBufferPointerv) == internal::Lazy_GetNamedBufferPointerv
+        ? (PFNGLGETNAMEDBUFFERPOINTERVPROC) internal::LazyResolve ("glGetNamedBufferPointerv") : OGLP_ENTRY (GetNamedBufferPointerv);
+    table->GetNamedBufferSubData = OGLP_ENTRY (GetNamedBufferSubData) == internal::Lazy_GetNamedBufferSubData
+        ? (PFNGLGETNAMEDBUFFERSUBDATAPROC) internal::LazyResolve ("glGetNamedBufferSubData") : OGLP_ENTRY (GetNamedBufferSubData);
+    table->CreateFramebuffers = OGLP_ENTRY (CreateFramebuffers) == internal::Lazy_CreateFramebuffers
+        ? (PFNGLCREATEFRAMEBUFFERSPROC) internal::LazyResolve ("glCreateFramebuffers") : OGLP_ENTRY (CreateFramebuffers);
+    table->NamedFramebufferRenderbuffer = OGLP_ENTRY (NamedFramebufferRenderbuffer) == internal::Lazy_NamedFramebufferRenderbuffer
+        ? (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC) internal::LazyResolve ("glNamedFramebufferRenderbuffer") : OGLP_ENTRY (NamedFramebufferRenderbuffer);
+    table->NamedFramebufferParameteri = OGLP_ENTRY (NamedFramebufferParameteri) == internal::Lazy_NamedFramebufferParameteri
+        ? (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC) internal::LazyResolve ("glNamedFramebufferParameteri") : OGLP_ENTRY (NamedFramebufferParameteri);
+    table->NamedFramebufferTexture = OGLP_ENTRY (NamedFramebufferTexture) == internal::Lazy_NamedFramebufferTexture
+        ? (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC) internal::LazyResolve ("glNamedFramebufferTexture") : OGLP_ENTRY (NamedFramebufferTexture);
+    table->NamedFramebufferTextureLayer = OGLP_ENTRY (NamedFramebufferTextureLayer) == internal::Lazy_NamedFramebufferTextureLayer
+        ? (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC) internal::LazyResolve ("glNamedFramebufferTextureLayer") : OGLP_ENTRY (NamedFramebufferTextureLayer);
+    table->NamedFramebufferDrawBuffer = OGLP_ENTRY (NamedFramebufferDrawBuffer) == internal::Lazy_NamedFramebufferDrawBuffer
+        ? (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC) internal::LazyResolve ("glNamedFramebufferDrawBuffer") : OGLP_ENTRY (NamedFramebufferDrawBuffer);
+    table->NamedFramebufferDrawBuffers = OGLP_ENTRY (NamedFramebufferDrawBuffers) == internal::Lazy_NamedFramebufferDrawBuffers
+        ? (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC) internal::LazyResolve ("glNamedFramebufferDrawBuffers") : OGLP_ENTRY (NamedFramebufferDrawBuffers);
+    table->NamedFramebufferReadBuffer = OGLP_ENTRY (NamedFramebufferReadBuffer) == internal::Lazy_NamedFramebufferReadBuffer
+        ? (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC) internal::LazyResolve ("glNamedFramebufferReadBuffer") : OGLP_ENTRY (NamedFramebufferReadBuffer);
+    table->InvalidateNamedFramebufferData = OGLP_ENTRY (InvalidateNamedFramebufferData) == internal::Lazy_InvalidateNamedFramebufferData
+        ? (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC) internal::LazyResolve ("glInvalidateNamedFramebufferData") : OGLP_ENTRY (InvalidateNamedFramebufferData);
+    table->InvalidateNamedFramebufferSubData = OGLP_ENTRY (InvalidateNamedFramebufferSubData) == internal::Lazy_InvalidateNamedFramebufferSubData
+        ? (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC) internal::LazyResolve ("glInvalidateNamedFramebufferSubData") : OGLP_ENTRY (InvalidateNamedFramebufferSubData);
+    table->ClearNamedFramebufferiv = OGLP_ENTRY (ClearNamedFramebufferiv) == internal::Lazy_ClearNamedFramebufferiv
+        ? (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC) internal::LazyResolve ("glClearNamedFramebufferiv") : OGLP_ENTRY (ClearNamedFramebufferiv);
+    table->ClearNamedFramebufferuiv = OGLP_ENTRY (ClearNamedFramebufferuiv) == internal::Lazy_ClearNamedFramebufferuiv
+        ? (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC) internal::LazyResolve ("glClearNamedFramebufferuiv") : OGLP_ENTRY (ClearNamedFramebufferuiv);
+    table->ClearNamedFramebufferfv = OGLP_ENTRY (ClearNamedFramebufferfv) == internal::Lazy_ClearNamedFramebufferfv
+        ? (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC) internal::LazyResolve ("glClearNamedFramebufferfv") : OGLP_ENTRY (ClearNamedFramebufferfv);
+    table->ClearNamedFramebufferfi = OGLP_ENTRY (ClearNamedFramebufferfi) == internal::Lazy_ClearNamedFramebufferfi
+        ? (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC) internal::LazyResolve ("glClearNamedFramebufferfi") : OGLP_ENTRY (ClearNamedFramebufferfi);
+    table->BlitNamedFramebuffer = OGLP_ENTRY (BlitNamedFramebuffer) == internal::Lazy_BlitNamedFramebuffer
+        ? (PFNGLBLITNAMEDFRAMEBUFFERPROC) internal::LazyResolve ("glBlitNamedFramebuffer") : OGLP_ENTRY (BlitNamedFramebuffer);
+    table->CheckNamedFramebufferStatus = OGLP_ENTRY (CheckNamedFramebufferStatus) == internal::Lazy_CheckNamedFramebufferStatus
+        ? (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC) internal::LazyResolve ("glCheckNamedFramebufferStatus") : OGLP_ENTRY (CheckNamedFramebufferStatus);
+    table->GetNamedFramebufferParameteriv = OGLP_ENTRY (GetNamedFramebufferParameteriv) == internal::Lazy_GetNamedFramebufferParameteriv
+        ? (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC) internal::LazyResolve ("glGetNamedFramebufferParameteriv") : OGLP_ENTRY (GetNamedFramebufferParameteriv);
+    table->GetNamedFramebufferAttachmentParameteriv = OGLP_ENTRY (GetNamedFramebufferAttachmentParameteriv) == internal::Lazy_GetNamedFramebufferAttachmentParameteriv
+        ? (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC) internal::LazyResolve ("glGetNamedFramebufferAttachmentParameteriv") : OGLP_ENTRY (GetNamedFramebufferAttachmentParameteriv);
+    table->CreateRenderbuffers = OGLP_ENTRY (CreateRenderbuffers) == internal::Lazy_CreateRenderbuffers
+        ? (PFNGLCREATERENDERBUFFERSPROC) internal::LazyResolve ("glCreateRenderbuffers") : OGLP_ENTRY (CreateRenderbuffers);
+    table->NamedRenderbufferStorage = OGLP_ENTRY (NamedRenderbufferStorage) == internal::Lazy_NamedRenderbufferStorage
+        ? (PFNGLNAMEDRENDERBUFFERSTORAGEPROC) internal::LazyResolve ("glNamedRenderbufferStorage") : OGLP_ENTRY (NamedRenderbufferStorage);
+    table->NamedRenderbufferStorageMultisample = OGLP_ENTRY (NamedRenderbufferStorageMultisample) == internal::Lazy_NamedRenderbufferStorageMultisample
+        ? (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC) internal::LazyResolve ("glNamedRenderbufferStorageMultisample") : OGLP_ENTRY (NamedRenderbufferStorageMultisample);
+    table->GetNamedRenderbufferParameteriv = OGLP_ENTRY (GetNamedRenderbufferParameteriv) == internal::Lazy_GetNamedRenderbufferParameteriv
+        ? (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC) internal::LazyResolve ("glGetNamedRenderbufferParameteriv") : OGLP_ENTRY (GetNamedRenderbufferParameteriv);
+    table->CreateTextures = OGLP_ENTRY (CreateTextures) == internal::Lazy_CreateTextures
+        ? (PFNGLCREATETEXTURESPROC) internal::LazyResolve ("glCreateTextures") : OGLP_ENTRY (CreateTextures);
+    table->TextureBuffer = OGLP_ENTRY (TextureBuffer) == internal::Lazy_TextureBuffer
+        ? (PFNGLTEXTUREBUFFERPROC) internal::LazyResolve ("glTextureBuffer") : OGLP_ENTRY (TextureBuffer);
+    table->TextureBufferRange = OGLP_ENTRY (TextureBufferRange) == internal::Lazy_TextureBufferRange
+        ? (PFNGLTEXTUREBUFFERRANGEPROC) internal::LazyResolve ("glTextureBufferRange") : OGLP_ENTRY (TextureBufferRange);
+    table->TextureStorage1D = OGLP_ENTRY (TextureStorage1D) == internal::Lazy_TextureStorage1D
+        ? (PFNGLTEXTURESTORAGE1DPROC) internal::LazyResolve ("glTextureStorage1D") : OGLP_ENTRY (TextureStorage1D);
+    table->TextureStorage2D = OGLP_ENTRY (TextureStorage2D) == internal::Lazy_TextureStorage2D
+        ? (PFNGLTEXTURESTORAGE2DPROC) internal::LazyResolve ("glTextureStorage2D") : OGLP_ENTRY (TextureStorage2D);
+    table->TextureStorage3D = OGLP_ENTRY (TextureStorage3D) == internal::Lazy_TextureStorage3D
+        ? (PFNGLTEXTURESTORAGE3DPROC) internal::LazyResolve ("glTextureStorage3D") : OGLP_ENTRY (TextureStorage3D);
+    table->TextureStorage2DMultisample = OGLP_ENTRY (TextureStorage2DMultisample) == internal::Lazy_TextureStorage2DMultisample
+        ? (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC) internal::LazyResolve ("glTextureStorage2DMultisample") : OGLP_ENTRY (TextureStorage2DMultisample);
+    table->TextureStorage3DMultisample = OGLP_ENTRY (TextureStorage3DMultisample) == internal::Lazy_TextureStorage3DMultisample
+        ? (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC) internal::LazyResolve ("glTextureStorage3DMultisample") : OGLP_ENTRY (TextureStorage3DMultisample);
+    table->TextureSubImage1D = OGLP_ENTRY (TextureSubImage1D) == internal::Lazy_TextureSubImage1D
+        ? (PFNGLTEXTURESUBIMAGE1DPROC) internal::LazyResolve ("glTextureSubImage1D") : OGLP_ENTRY (TextureSubImage1D);
+    table->TextureSubImage2D = OGLP_ENTRY (TextureSubImage2D) == internal::Lazy_TextureSubImage2D
+        ? (PFNGLTEXTURESUBIMAGE2DPROC) internal::LazyResolve ("glTextureSubImage2D") : OGLP_ENTRY (TextureSubImage2D);
+    table->TextureSubImage3D = OGLP_ENTRY (TextureSubImage3D) == internal::Lazy_TextureSubImage3D
+        ? (PFNGLTEXTURESUBIMAGE3DPROC) internal::LazyResolve ("glTextureSubImage3D") : OGLP_ENTRY (TextureSubImage3D);
+    table->CompressedTextureSubImage1D = OGLP_ENTRY (CompressedTextureSubImage1D) == internal::Lazy_CompressedTextureSubImage1D
+        ? (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC) internal::LazyResolve ("glCompressedTextureSubImage1D") : OGLP_ENTRY (CompressedTextureSubImage1D);
+    table->CompressedTextureSubImage2D = OGLP_ENTRY (CompressedTextureSubImage2D) == internal::Lazy_CompressedTextureSubImage2D
+        ? (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC) internal::LazyResolve ("glCompressedTextureSubImage2D") : OGLP_ENTRY (CompressedTextureSubImage2D);
+    table->CompressedTextureSubImage3D = OGLP_ENTRY (CompressedTextureSubImage3D) == internal::Lazy_CompressedTextureSubImage3D
+        ? (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC) internal::LazyResolve ("glCompressedTextureSubImage3D") : OGLP_ENTRY (CompressedTextureSubImage3D);
+    table->CopyTextureSubImage1D = OGLP_ENTRY (CopyTextureSubImage1D) == internal::Lazy_CopyTextureSubImage1D
+        ? (PFNGLCOPYTEXTURESUBIMAGE1DPROC) internal::LazyResolve ("glCopyTextureSubImage1D") : OGLP_ENTRY (CopyTextureSubImage1D);
+    table->CopyTextureSubImage2D = OGLP_ENTRY (CopyTextureSubImage2D) == internal::Lazy_CopyTextureSubImage2D
+        ? (PFNGLCOPYTEXTURESUBIMAGE2DPROC) internal::LazyResolve ("glCopyTextureSubImage2D") : OGLP_ENTRY (CopyTextureSubImage2D);
+    table->CopyTextureSubImage3D = OGLP_ENTRY (CopyTextureSubImage3D) == internal::Lazy_CopyTextureSubImage3D
+        ? (PFNGLCOPYTEXTURESUBIMAGE3DPROC) internal::LazyResolve ("glCopyTextureSubImage3D") : OGLP_ENTRY (CopyTextureSubImage3D);
+    table->TextureParameterf = OGLP_ENTRY (TextureParameterf) == internal::Lazy_TextureParameterf
+        ? (PFNGLTEXTUREPARAMETERFPROC) internal::LazyResolve ("glTextureParameterf") : OGLP_ENTRY (TextureParameterf);
+    table->TextureParameterfv = OGLP_ENTRY (TextureParameterfv) == internal::Lazy_TextureParameterfv
+        ? (PFNGLTEXTUREPARAMETERFVPROC) internal::LazyResolve ("glTextureParameterfv") : OGLP_ENTRY (TextureParameterfv);
+    table->TextureParameteri = OGLP_ENTRY (TextureParameteri) == internal::Lazy_TextureParameteri
+        ? (PFNGLTEXTUREPARAMETERIPROC) internal::LazyResolve ("glTextureParameteri") : OGLP_ENTRY (TextureParameteri);
+    table->TextureParameterIiv = OGLP_ENTRY (TextureParameterIiv) == internal::Lazy_TextureParameterIiv
+        ? (PFNGLTEXTUREPARAMETERIIVPROC) internal::LazyResolve ("glTextureParameterIiv") : OGLP_ENTRY (TextureParameterIiv);
+    table->TextureParameterIuiv = OGLP_ENTRY (TextureParameterIuiv) == internal::Lazy_TextureParameterIuiv
+        ? (PFNGLTEXTUREPARAMETERIUIVPROC) internal::LazyResolve ("glTextureParameterIuiv") : OGLP_ENTRY (TextureParameterIuiv);
+    table->TextureParameteriv = OGLP_ENTRY (TextureParameteriv) == internal::Lazy_TextureParameteriv
+        ? (PFNGLTEXTUREPARAMETERIVPROC) internal::LazyResolve ("glTextureParameteriv") : OGLP_ENTRY (TextureParameteriv);
+    table->GenerateTextureMipmap = OGLP_ENTRY (GenerateTextureMipmap) == internal::Lazy_GenerateTextureMipmap
+        ? (PFNGLGENERATETEXTUREMIPMAPPROC) internal::LazyResolve ("glGenerateTextureMipmap") : OGLP_ENTRY (GenerateTextureMipmap);
+    table->BindTextureUnit = OGLP_ENTRY (BindTextureUnit) == internal::Lazy_BindTextureUnit
+        ? (PFNGLBINDTEXTUREUNITPROC) internal::LazyResolve ("glBindTextureUnit") : OGLP_ENTRY (BindTextureUnit);
+    table->GetTextureImage = OGLP_ENTRY (GetTextureImage) == internal::Lazy_GetTextureImage
+        ? (PFNGLGETTEXTUREIMAGEPROC) internal::LazyResolve ("glGetTextureImage") : OGLP_ENTRY (GetTextureImage);
+    table->GetCompressedTextureImage = OGLP_ENTRY (GetCompressedTextureImage) == internal::Lazy_GetCompressedTextureImage
+        ? (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC) internal::LazyResolve ("glGetCompressedTextureImage") : OGLP_ENTRY (GetCompressedTextureImage);
+    table->GetTextureLevelParameterfv = OGLP_ENTRY (GetTextureLevelParameterfv) == internal::Lazy_GetTextureLevelParameterfv
+        ? (PFNGLGETTEXTURELEVELPARAMETERFVPROC) internal::LazyResolve ("glGetTextureLevelParameterfv") : OGLP_ENTRY (GetTextureLevelParameterfv);
+    table->GetTextureLevelParameteriv = OGLP_ENTRY (GetTextureLevelParameteriv) == internal::Lazy_GetTextureLevelParameteriv
+        ? (PFNGLGETTEXTURELEVELPARAMETERIVPROC) internal::LazyResolve ("glGetTextureLevelParameteriv") : OGLP_ENTRY (GetTextureLevelParameteriv);
+    table->GetTextureParameterfv = OGLP_ENTRY (GetTextureParameterfv) == internal::Lazy_GetTextureParameterfv
+        ? (PFNGLGETTEXTUREPARAMETERFVPROC) internal::LazyResolve ("glGetTextureParameterfv") : OGLP_ENTRY (GetTextureParameterfv);
+    table->GetTextureParameterIiv = OGLP_ENTRY (GetTextureParameterIiv) == internal::Lazy_GetTextureParameterIiv
+        ? (PFNGLGETTEXTUREPARAMETERIIVPROC) internal::LazyResolve ("glGetTextureParameterIiv") : OGLP_ENTRY (GetTextureParameterIiv);
+    table->GetTextureParameterIuiv = OGLP_ENTRY (GetTextureParameterIuiv) == internal::Lazy_GetTextureParameterIuiv
+        ? (PFNGLGETTEXTUREPARAMETERIUIVPROC) internal::LazyResolve ("glGetTextureParameterIuiv") : OGLP_ENTRY (GetTextureParameterIuiv);
+    table->GetTextureParameteriv = OGLP_ENTRY (GetTextureParameteriv) == internal::Lazy_GetTextureParameteriv
+        ? (PFNGLGETTEXTUREPARAMETERIVPROC) internal::LazyResolve ("glGetTextureParameteriv") : OGLP_ENTRY (GetTextureParameteriv);
+    table->CreateVertexArrays = OGLP_ENTRY (CreateVertexArrays) == internal::Lazy_CreateVertexArrays
+        ? (PFNGLCREATEVERTEXARRAYSPROC) internal::LazyResolve ("glCreateVertexArrays") : OGLP_ENTRY (CreateVertexArrays);
+    table->DisableVertexArrayAttrib = OGLP_ENTRY (DisableVertexArrayAttrib) == internal::Lazy_DisableVertexArrayAttrib
+        ? (PFNGLDISABLEVERTEXARRAYATTRIBPROC) internal::LazyResolve ("glDisableVertexArrayAttrib") : OGLP_ENTRY (DisableVertexArrayAttrib);
+    table->EnableVertexArrayAttrib = OGLP_ENTRY (EnableVertexArrayAttrib) == internal::Lazy_EnableVertexArrayAttrib
+        ? (PFNGLENABLEVERTEXARRAYATTRIBPROC) internal::LazyResolve ("glEnableVertexArrayAttrib") : OGLP_ENTRY (EnableVertexArrayAttrib);
+    table->VertexArrayElementBuffer = OGLP_ENTRY (VertexArrayElementBuffer) == internal::Lazy_VertexArrayElementBuffer
+        ? (PFNGLVERTEXARRAYELEMENTBUFFERPROC) internal::LazyResolve ("glVertexArrayElementBuffer") : OGLP_ENTRY (VertexArrayElementBuffer);
+    table->VertexArrayVertexBuffer = OGLP_ENTRY (VertexArrayVertexBuffer) == internal::Lazy_VertexArrayVertexBuffer
+        ? (PFNGLVERTEXARRAYVERTEXBUFFERPROC) internal::LazyResolve ("glVertexArrayVertexBuffer") : OGLP_ENTRY (VertexArrayVertexBuffer);
+    table->VertexArrayVertexBuffers = OGLP_ENTRY (VertexArrayVertexBuffers) == internal::Lazy_VertexArrayVertexBuffers
+        ? (PFNGLVERTEXARRAYVERTEXBUFFERSPROC) internal::LazyResolve ("glVertexArrayVertexBuffers") : OGLP_ENTRY (VertexArrayVertexBuffers);
+    table->VertexArrayAttribBinding = OGLP_ENTRY (VertexArrayAttribBinding) == internal::Lazy_VertexArrayAttribBinding
+        ? (PFNGLVERTEXARRAYATTRIBBINDINGPROC) internal::LazyResolve ("glVertexArrayAttribBinding") : OGLP_ENTRY (VertexArrayAttribBinding);
+    table->VertexArrayAttribFormat = OGLP_ENTRY (VertexArrayAttribFormat) == internal::Lazy_VertexArrayAttribFormat
+        ? (PFNGLVERTEXARRAYATTRIBFORMATPROC) internal::LazyResolve ("glVertexArrayAttribFormat") : OGLP_ENTRY (VertexArrayAttribFormat);
+    table->VertexArrayAttribIFormat = OGLP_ENTRY (VertexArrayAttribIFormat) == internal::Lazy_VertexArrayAttribIFormat
+        ? (PFNGLVERTEXARRAYATTRIBIFORMATPROC) internal::LazyResolve ("glVertexArrayAttribIFormat") : OGLP_ENTRY (VertexArrayAttribIFormat);
+    table->VertexArrayAttribLFormat = OGLP_ENTRY (VertexArrayAttribLFormat) == internal::Lazy_VertexArrayAttribLFormat
+        ? (PFNGLVERTEXARRAYATTRIBLFORMATPROC) internal::LazyResolve ("glVertexArrayAttribLFormat") : OGLP_ENTRY (VertexArrayAttribLFormat);
+    table->VertexArrayBindingDivisor = OGLP_ENTRY (VertexArrayBindingDivisor) == internal::Lazy_VertexArrayBindingDivisor
+        ? (PFNGLVERTEXARRAYBINDINGDIVISORPROC) internal::LazyResolve ("glVertexArrayBindingDivisor") : OGLP_ENTRY (VertexArrayBindingDivisor);
+    table->GetVertexArrayiv = OGLP_ENTRY (GetVertexArrayiv) == internal::Lazy_GetVertexArrayiv
+        ? (PFNGLGETVERTEXARRAYIVPROC) internal::LazyResolve ("glGetVertexArrayiv") : OGLP_ENTRY (GetVertexArrayiv);
+    table->GetVertexArrayIndexediv = OGLP_ENTRY (GetVertexArrayIndexediv) == internal::Lazy_GetVertexArrayIndexediv
+        ? (PFNGLGETVERTEXARRAYINDEXEDIVPROC) internal::LazyResolve ("glGetVertexArrayIndexediv") : OGLP_ENTRY (GetVertexArrayIndexediv);
+    table->GetVertexArrayIndexed64iv = OGLP_ENTRY (GetVertexArrayIndexed64iv) == internal::Lazy_GetVertexArrayIndexed64iv
+        ? (PFNGLGETVERTEXARRAYINDEXED64IVPROC) internal::LazyResolve ("glGetVertexArrayIndexed64iv") : OGLP_ENTRY (GetVertexArrayIndexed64iv);
+    table->CreateSamplers = OGLP_ENTRY (CreateSamplers) == internal::Lazy_CreateSamplers
+        ? (PFNGLCREATESAMPLERSPROC) internal::LazyResolve ("glCreateSamplers") : OGLP_ENTRY (CreateSamplers);
+    table->CreateProgramPipelines = OGLP_ENTRY (CreateProgramPipelines) == internal::Lazy_CreateProgramPipelines
+        ? (PFNGLCREATEPROGRAMPIPELINESPROC) internal::LazyResolve ("glCreateProgramPipelines") : OGLP_ENTRY (CreateProgramPipelines);
+    table->CreateQueries = OGLP_ENTRY (CreateQueries) == internal::Lazy_CreateQueries
+        ? (PFNGLCREATEQUERIESPROC) internal::LazyResolve ("glCreateQueries") : OGLP_ENTRY (CreateQueries);
+    table->GetQueryBufferObjecti64v = OGLP_ENTRY (GetQueryBufferObjecti64v) == internal::Lazy_GetQueryBufferObjecti64v
+        ? (PFNGLGETQUERYBUFFEROBJECTI64VPROC) internal::LazyResolve ("glGetQueryBufferObjecti64v") : OGLP_ENTRY (GetQueryBufferObjecti64v);
+    table->GetQueryBufferObjectiv = OGLP_ENTRY (GetQueryBufferObjectiv) == internal::Lazy_GetQueryBufferObjectiv
+        ? (PFNGLGETQUERYBUFFEROBJECTIVPROC) internal::LazyResolve ("glGetQueryBufferObjectiv") : OGLP_ENTRY (GetQueryBufferObjectiv);
+    table->GetQueryBufferObjectui64v = OGLP_ENTRY (GetQueryBufferObjectui64v) == internal::Lazy_GetQueryBufferObjectui64v
+        ? (PFNGLGETQUERYBUFFEROBJECTUI64VPROC) internal::LazyResolve ("glGetQueryBufferObjectui64v") : OGLP_ENTRY (GetQueryBufferObjectui64v);
+    table->GetQueryBufferObjectuiv = OGLP_ENTRY (GetQueryBufferObjectuiv) == internal::Lazy_GetQueryBufferObjectuiv
+        ? (PFNGLGETQUERYBUFFEROBJECTUIVPROC) internal::LazyResolve ("glGetQueryBufferObjectuiv") : OGLP_ENTRY (GetQueryBufferObjectuiv);
+    table->MemoryBarrierByRegion = OGLP_ENTRY (MemoryBarrierByRegion) == internal::Lazy_MemoryBarrierByRegion
+        ? (PFNGLMEMORYBARRIERBYREGIONPROC) internal::LazyResolve ("glMemoryBarrierByRegion") : OGLP_ENTRY (MemoryBarrierByRegion);
+    table->GetTextureSubImage = OGLP_ENTRY (GetTextureSubImage) == internal::Lazy_GetTextureSubImage
+        ? (PFNGLGETTEXTURESUBIMAGEPROC) internal::LazyResolve ("glGetTextureSubImage") : OGLP_ENTRY (GetTextureSubImage);
+    table->GetCompressedTextureSubImage = OGLP_ENTRY (GetCompressedTextureSubImage) == internal::Lazy_GetCompressedTextureSubImage
+        ? (PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC) internal::LazyResolve ("glGetCompressedTextureSubImage") : OGLP_ENTRY (GetCompressedTextureSubImage);
+    table->GetGraphicsResetStatus = OGLP_ENTRY (GetGraphicsResetStatus) == internal::Lazy_GetGraphicsResetStatus
+        ? (PFNGLGETGRAPHICSRESETSTATUSPROC) internal::LazyResolve ("glGetGraphicsResetStatus") : OGLP_ENTRY (GetGraphicsResetStatus);
+    table->GetnCompressedTexImage = OGLP_ENTRY (GetnCompressedTexImage) == internal::Lazy_GetnCompressedTexImage
+        ? (PFNGLGETNCOMPRESSEDTEXIMAGEPROC) internal::LazyResolve ("glGetnCompressedTexImage") : OGLP_ENTRY (GetnCompressedTexImage);
+    table->GetnTexImage = OGLP_ENTRY (GetnTexImage) == internal::Lazy_GetnTexImage
+        ? (PFNGLGETNTEXIMAGEPROC) internal::LazyResolve ("glGetnTexImage") : OGLP_ENTRY (GetnTexImage);
+    table->GetnUniformdv = OGLP_ENTRY (GetnUniformdv) == internal::Lazy_GetnUniformdv
+        ? (PFNGLGETNUNIFORMDVPROC) internal::LazyResolve ("glGetnUniformdv") : OGLP_ENTRY (GetnUniformdv);
+    table->GetnUniformfv = OGLP_ENTRY (GetnUniformfv) == internal::Lazy_GetnUniformfv
+        ? (PFNGLGETNUNIFORMFVPROC) internal::LazyResolve ("glGetnUniformfv") : OGLP_ENTRY (GetnUniformfv);
+    table->GetnUniformiv = OGLP_ENTRY (GetnUniformiv) == internal::Lazy_GetnUniformiv
+        ? (PFNGLGETNUNIFORMIVPROC) internal::LazyResolve ("glGetnUniformiv") : OGLP_ENTRY (GetnUniformiv);
+    table->GetnUniformuiv = OGLP_ENTRY (GetnUniformuiv) == internal::Lazy_GetnUniformuiv
+        ? (PFNGLGETNUNIFORMUIVPROC) internal::LazyResolve ("glGetnUniformuiv") : OGLP_ENTRY (GetnUniformuiv);
+    table->ReadnPixels = OGLP_ENTRY (ReadnPixels) == internal::Lazy_ReadnPixels
+        ? (PFNGLREADNPIXELSPROC) internal::LazyResolve ("glReadnPixels") : OGLP_ENTRY (ReadnPixels);
+    table->TextureBarrier = OGLP_ENTRY (TextureBarrier) == internal::Lazy_TextureBarrier
+        ? (PFNGLTEXTUREBARRIERPROC) internal::LazyResolve ("glTextureBarrier") : OGLP_ENTRY (TextureBarrier);
+#endif /* !defined OGLP_DIRECT_LINK */
+    table->GetTextureHandleARB = OGLP_ENTRY (GetTextureHandleARB) == internal::Lazy_GetTextureHandleARB
+        ? (PFNGLGETTEXTUREHANDLEARBPROC) internal::LazyResolve ("glGetTextureHandleARB") : OGLP_ENTRY (GetTextureHandleARB);
+    table->GetTextureSamplerHandleARB = OGLP_ENTRY (GetTextureSamplerHandleARB) == internal::Lazy_GetTextureSamplerHandleARB
+        ? (PFNGLGETTEXTURESAMPLERHANDLEARBPROC) internal::LazyResolve ("glGetTextureSamplerHandleARB") : OGLP_ENTRY (GetTextureSamplerHandleARB);
+    table->MakeTextureHandleResidentARB = OGLP_ENTRY (MakeTextureHandleResidentARB) == internal::Lazy_MakeTextureHandleResidentARB
+        ? (PFNGLMAKETEXTUREHANDLERESIDENTARBPROC) internal::LazyResolve ("glMakeTextureHandleResidentARB") : OGLP_ENTRY (MakeTextureHandleResidentARB);
+    table->MakeTextureHandleNonResidentARB = OGLP_ENTRY (MakeTextureHandleNonResidentARB) == internal::Lazy_MakeTextureHandleNonResidentARB
+        ? (PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC) internal::LazyResolve ("glMakeTextureHandleNonResidentARB") : OGLP_ENTRY (MakeTextureHandleNonResidentARB);
+    table->GetImageHandleARB = OGLP_ENTRY (GetImageHandleARB) == internal::Lazy_GetImageHandleARB
+        ? (PFNGLGETIMAGEHANDLEARBPROC) internal::LazyResolve ("glGetImageHandleARB") : OGLP_ENTRY (GetImageHandleARB);
+    table->MakeImageHandleResidentARB = OGLP_ENTRY (MakeImageHandleResidentARB) == internal::Lazy_MakeImageHandleResidentARB
+        ? (PFNGLMAKEIMAGEHANDLERESIDENTARBPROC) internal::LazyResolve ("glMakeImageHandleResidentARB") : OGLP_ENTRY (MakeImageHandleResidentARB);
+    table->MakeImageHandleNonResidentARB = OGLP_ENTRY (MakeImageHandleNonResidentARB) == internal::Lazy_MakeImageHandleNonResidentARB
+        ? (PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC) internal::LazyResolve ("glMakeImageHandleNonResidentARB") : OGLP_ENTRY (MakeImageHandleNonResidentARB);
+    table->UniformHandleui64ARB = OGLP_ENTRY (UniformHandleui64ARB) == internal::Lazy_UniformHandleui64ARB
+        ? (PFNGLUNIFORMHANDLEUI64ARBPROC) internal::LazyResolve ("glUniformHandleui64ARB") : OGLP_ENTRY (UniformHandleui64ARB);
+    table->UniformHandleui64vARB = OGLP_ENTRY (UniformHandleui64vARB) == internal::Lazy_UniformHandleui64vARB
+        ? (PFNGLUNIFORMHANDLEUI64VARBPROC) internal::LazyResolve ("glUniformHandleui64vARB") : OGLP_ENTRY (UniformHandleui64vARB);
+    table->ProgramUniformHandleui64ARB = OGLP_ENTRY (ProgramUniformHandleui64ARB) == internal::Lazy_ProgramUniformHandleui64ARB
+        ? (PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC) internal::LazyResolve ("glProgramUniformHandleui64ARB") : OGLP_ENTRY (ProgramUniformHandleui64ARB);
+    table->ProgramUniformHandleui64vARB = OGLP_ENTRY (ProgramUniformHandleui64vARB) == internal::Lazy_ProgramUniformHandleui64vARB
+        ? (PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC) internal::LazyResolve ("glProgramUniformHandleui64vARB") : OGLP_ENTRY (ProgramUniformHandleui64vARB);
+    table->IsTextureHandleResidentARB = OGLP_ENTRY (IsTextureHandleResidentARB) == internal::Lazy_IsTextureHandleResidentARB
+        ? (PFNGLISTEXTUREHANDLERESIDENTARBPROC) internal::LazyResolve ("glIsTextureHandleResidentARB") : OGLP_ENTRY (IsTextureHandleResidentARB);
+    table->IsImageHandleResidentARB = OGLP_ENTRY (IsImageHandleResidentARB) == internal::Lazy_IsImageHandleResidentARB
+        ? (PFNGLISIMAGEHANDLERESIDENTARBPROC) internal::LazyResolve ("glIsImageHandleResidentARB") : OGLP_ENTRY (IsImageHandleResidentARB);
+    table->VertexAttribL1ui64ARB = OGLP_ENTRY (VertexAttribL1ui64ARB) == internal::Lazy_VertexAttribL1ui64ARB
+        ? (PFNGLVERTEXATTRIBL1UI64ARBPROC) internal::LazyResolve ("glVertexAttribL1ui64ARB") : OGLP_ENTRY (VertexAttribL1ui64ARB);
+    table->VertexAttribL1ui64vARB = OGLP_ENTRY (VertexAttribL1ui64vARB) == internal::Lazy_VertexAttribL1ui64vARB
+        ? (PFNGLVERTEXATTRIBL1UI64VARBPROC) internal::LazyResolve ("glVertexAttribL1ui64vARB") : OGLP_ENTRY (VertexAttribL1ui64vARB);
+    table->GetVertexAttribLui64vARB = OGLP_ENTRY (GetVertexAttribLui64vARB) == internal::Lazy_GetVertexAttribLui64vARB
+        ? (PFNGLGETVERTEXATTRIBLUI64VARBPROC) internal::LazyResolve ("glGetVertexAttribLui64vARB") : OGLP_ENTRY (GetVertexAttribLui64vARB);
+    table->CreateSyncFromCLeventARB = OGLP_ENTRY (CreateSyncFromCLeventARB) == internal::Lazy_CreateSyncFromCLeventARB
+        ? (PFNGLCREATESYNCFROMCLEVENTARBPROC) internal::LazyResolve ("glCreateSyncFromCLeventARB") : OGLP_ENTRY (CreateSyncFromCLeventARB);
+    table->DispatchComputeGroupSizeARB = OGLP_ENTRY (DispatchComputeGroupSizeARB) == internal::Lazy_DispatchComputeGroupSizeARB
+        ? (PFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC) internal::LazyResolve ("glDispatchComputeGroupSizeARB") : OGLP_ENTRY (DispatchComputeGroupSizeARB);
+    table->DebugMessageControlARB = OGLP_ENTRY (DebugMessageControlARB) == internal::Lazy_DebugMessageControlARB
+        ? (PFNGLDEBUGMESSAGECONTROLARBPROC) internal::LazyResolve ("glDebugMessageControlARB") : OGLP_ENTRY (DebugMessageControlARB);
+    table->DebugMessageInsertARB = OGLP_ENTRY (DebugMessageInsertARB) == internal::Lazy_DebugMessageInsertARB
+        ? (PFNGLDEBUGMESSAGEINSERTARBPROC) internal::LazyResolve ("glDebugMessageInsertARB") : OGLP_ENTRY (DebugMessageInsertARB);
+    table->DebugMessageCallbackARB = OGLP_ENTRY (DebugMessageCallbackARB) == internal::Lazy_DebugMessageCallbackARB
+        ? (PFNGLDEBUGMESSAGECALLBACKARBPROC) internal::LazyResolve ("glDebugMessageCallbackARB") : OGLP_ENTRY (DebugMessageCallbackARB);
+    table->GetDebugMessageLogARB = OGLP_ENTRY (GetDebugMessageLogARB) == internal::Lazy_GetDebugMessageLogARB
+        ? (PFNGLGETDEBUGMESSAGELOGARBPROC) internal::LazyResolve ("glGetDebugMessageLogARB") : OGLP_ENTRY (GetDebugMessageLogARB);
+    table->BlendEquationiARB = OGLP_ENTRY (BlendEquationiARB) == internal::Lazy_BlendEquationiARB
+        ? (PFNGLBLENDEQUATIONIARBPROC) internal::LazyResolve ("glBlendEquationiARB") : OGLP_ENTRY (BlendEquationiARB);
+    table->BlendEquationSeparateiARB = OGLP_ENTRY (BlendEquationSeparateiARB) == internal::Lazy_BlendEquationSeparateiARB
+        ? (PFNGLBLENDEQUATIONSEPARATEIARBPROC) internal::LazyResolve ("glBlendEquationSeparateiARB") : OGLP_ENTRY (BlendEquationSeparateiARB);
+    table->BlendFunciARB = OGLP_ENTRY (BlendFunciARB) == internal::Lazy_BlendFunciARB
+        ? (PFNGLBLENDFUNCIARBPROC) internal::LazyResolve ("glBlendFunciARB") : OGLP_ENTRY (BlendFunciARB);
+    table->BlendFuncSeparateiARB = OGLP_ENTRY (BlendFuncSeparateiARB) == internal::Lazy_BlendFuncSeparateiARB
+        ? (PFNGLBLENDFUNCSEPARATEIARBPROC) internal::LazyResolve ("glBlendFuncSeparateiARB") : OGLP_ENTRY (BlendFuncSeparateiARB);
+    table->MultiDrawArraysIndirectCountARB = OGLP_ENTRY (MultiDrawArraysIndirectCountARB) == internal::Lazy_MultiDrawArraysIndirectCountARB
+        ? (PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC) internal::LazyResolve ("glMultiDrawArraysIndirectCountARB") : OGLP_ENTRY (MultiDrawArraysIndirectCountARB);
+    table->MultiDrawElementsIndirectCountARB = OGLP_ENTRY (MultiDrawElementsIndirectCountARB) == internal::Lazy_MultiDrawElementsIndirectCountARB
+        ? (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC) internal::LazyResolve ("glMultiDrawElementsIndirectCountARB") : OGLP_ENTRY (MultiDrawElementsIndirectCountARB);
+    table->GetGraphicsResetStatusARB = OGLP_ENTRY (GetGraphicsResetStatusARB) == internal::Lazy_GetGraphicsResetStatusARB
+        ? (PFNGLGETGRAPHICSRESETSTATUSARBPROC) internal::LazyResolve ("glGetGraphicsResetStatusARB") : OGLP_ENTRY (GetGraphicsResetStatusARB);
+    table->GetnTexImageARB = OGLP_ENTRY (GetnTexImageARB) == internal::Lazy_GetnTexImageARB
+        ? (PFNGLGETNTEXIMAGEARBPROC) internal::LazyResolve ("glGetnTexImageARB") : OGLP_ENTRY (GetnTexImageARB);
+    table->ReadnPixelsARB = OGLP_ENTRY (ReadnPixelsARB) == internal::Lazy_ReadnPixelsARB
+        ? (PFNGLREADNPIXELSARBPROC) internal::LazyResolve ("glReadnPixelsARB") : OGLP_ENTRY (ReadnPixelsARB);
+    table->GetnCompressedTexImageARB = OGLP_ENTRY (GetnCompressedTexImageARB) == internal::Lazy_GetnCompressedTexImageARB
+        ? (PFNGLGETNCOMPRESSEDTEXIMAGEARBPROC) internal::LazyResolve ("glGetnCompressedTexImageARB") : OGLP_ENTRY (GetnCompressedTexImageARB);
+    table->GetnUniformfvARB = OGLP_ENTRY (GetnUniformfvARB) == internal::Lazy_GetnUniformfvARB
+        ? (PFNGLGETNUNIFORMFVARBPROC) internal::LazyResolve ("glGetnUniformfvARB") : OGLP_ENTRY (GetnUniformfvARB);
+    table->GetnUniformivARB = OGLP_ENTRY (GetnUniformivARB) == internal::Lazy_GetnUniformivARB
+        ? (PFNGLGETNUNIFORMIVARBPROC) internal::LazyResolve ("glGetnUniformivARB") : OGLP_ENTRY (GetnUniformivARB);
+    table->GetnUniformuivARB = OGLP_ENTRY (GetnUniformuivARB) == internal::Lazy_GetnUniformuivARB
+        ? (PFNGLGETNUNIFORMUIVARBPROC) internal::LazyResolve ("glGetnUniformuivARB") : OGLP_ENTRY (GetnUniformuivARB);
+    table->GetnUniformdvARB = OGLP_ENTRY (GetnUniformdvARB) == internal::Lazy_GetnUniformdvARB
+        ? (PFNGLGETNUNIFORMDVARBPROC) internal::LazyResolve ("glGetnUniformdvARB") : OGLP_ENTRY (GetnUniformdvARB);
+    table->MinSampleShadingARB = OGLP_ENTRY (MinSampleShadingARB) == internal::Lazy_MinSampleShadingARB
+        ? (PFNGLMINSAMPLESHADINGARBPROC) internal::LazyResolve ("glMinSampleShadingARB") : OGLP_ENTRY (MinSampleShadingARB);
+    table->NamedStringARB = OGLP_ENTRY (NamedStringARB) == internal::Lazy_NamedStringARB
+        ? (PFNGLNAMEDSTRINGARBPROC) internal::LazyResolve ("glNamedStringARB") : OGLP_ENTRY (NamedStringARB);
+    table->DeleteNamedStringARB = OGLP_ENTRY (DeleteNamedStringARB) == internal::Lazy_DeleteNamedStringARB
+        ? (PFNGLDELETENAMEDSTRINGARBPROC) internal::LazyResolve ("glDeleteNamedStringARB") : OGLP_ENTRY (DeleteNamedStringARB);
+    table->CompileShaderIncludeARB = OGLP_ENTRY (CompileShaderIncludeARB) == internal::Lazy_CompileShaderIncludeARB
+        ? (PFNGLCOMPILESHADERINCLUDEARBPROC) internal::LazyResolve ("glCompileShaderIncludeARB") : OGLP_ENTRY (CompileShaderIncludeARB);
+    table->IsNamedStringARB = OGLP_ENTRY (IsNamedStringARB) == internal::Lazy_IsNamedStringARB
+        ? (PFNGLISNAMEDSTRINGARBPROC) internal::LazyResolve ("glIsNamedStringARB") : OGLP_ENTRY (IsNamedStringARB);
+    table->GetNamedStringARB = OGLP_ENTRY (GetNamedStringARB) == internal::Lazy_GetNamedStringARB
+        ? (PFNGLGETNAMEDSTRINGARBPROC) internal::LazyResolve ("glGetNamedStringARB") : OGLP_ENTRY (GetNamedStringARB);
+    table->GetNamedStringivARB = OGLP_ENTRY (GetNamedStringivARB) == internal::Lazy_GetNamedStringivARB
+        ? (PFNGLGETNAMEDSTRINGIVARBPROC) internal::LazyResolve ("glGetNamedStringivARB") : OGLP_ENTRY (GetNamedStringivARB);
+    table->BufferPageCommitmentARB = OGLP_ENTRY (BufferPageCommitmentARB) == internal::Lazy_BufferPageCommitmentARB
+        ? (PFNGLBUFFERPAGECOMMITMENTARBPROC) internal::LazyResolve ("glBufferPageCommitmentARB") : OGLP_ENTRY (BufferPageCommitmentARB);
+    table->NamedBufferPageCommitmentEXT = OGLP_ENTRY (NamedBufferPageCommitmentEXT) == internal::Lazy_NamedBufferPageCommitmentEXT
+        ? (PFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC) internal::LazyResolve ("glNamedBufferPageCommitmentEXT") : OGLP_ENTRY (NamedBufferPageCommitmentEXT);
+    table->NamedBufferPageCommitmentARB = OGLP_ENTRY (NamedBufferPageCommitmentARB) == internal::Lazy_NamedBufferPageCommitmentARB
+        ? (PFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC) internal::LazyResolve ("glNamedBufferPageCommitmentARB") : OGLP_ENTRY (NamedBufferPageCommitmentARB);
+    table->TexPageCommitmentARB = OGLP_ENTRY (TexPageCommitmentARB) == internal::Lazy_TexPageCommitmentARB
+        ? (PFNGLTEXPAGECOMMITMENTARBPROC) internal::LazyResolve ("glTexPageCommitmentARB") : OGLP_ENTRY (TexPageCommitmentARB);
+    table->GetMultisamplefvNV = OGLP_ENTRY (GetMultisamplefvNV) == internal::Lazy_GetMultisamplefvNV
+        ? (PFNGLGETMULTISAMPLEFVNVPROC) internal::LazyResolve ("glGetMultisamplefvNV") : OGLP_ENTRY (GetMultisamplefvNV);
+    table->SampleMaskIndexedNV = OGLP_ENTRY (SampleMaskIndexedNV) == internal::Lazy_SampleMaskIndexedNV
+        ? (PFNGLSAMPLEMASKINDEXEDNVPROC) internal::LazyResolve ("glSampleMaskIndexedNV") : OGLP_ENTRY (SampleMaskIndexedNV);
+    table->TexRenderbufferNV = OGLP_ENTRY (TexRenderbufferNV) == internal::Lazy_TexRenderbufferNV
+        ? (PFNGLTEXRENDERBUFFERNVPROC) internal::LazyResolve ("glTexRenderbufferNV") : OGLP_ENTRY (TexRenderbufferNV);
+    table->MakeBufferResidentNV = OGLP_ENTRY (MakeBufferResidentNV) == internal::Lazy_MakeBufferResidentNV
+        ? (PFNGLMAKEBUFFERRESIDENTNVPROC) internal::LazyResolve ("glMakeBufferResidentNV") : OGLP_ENTRY (MakeBufferResidentNV);
+    table->MakeBufferNonResidentNV = OGLP_ENTRY (MakeBufferNonResidentNV) == internal::Lazy_MakeBufferNonResidentNV
+        ? (PFNGLMAKEBUFFERNONRESIDENTNVPROC) internal::LazyResolve ("glMakeBufferNonResidentNV") : OGLP_ENTRY (MakeBufferNonResidentNV);
+    table->IsBufferResidentNV = OGLP_ENTRY (IsBufferResidentNV) == internal::Lazy_IsBufferResidentNV
+        ? (PFNGLISBUFFERRESIDENTNVPROC) internal::LazyResolve ("glIsBufferResidentNV") : OGLP_ENTRY (IsBufferResidentNV);
+    table->MakeNamedBufferResidentNV = OGLP_ENTRY (MakeNamedBufferResidentNV) == internal::Lazy_MakeNamedBufferResidentNV
+        ? (PFNGLMAKENAMEDBUFFERRESIDENTNVPROC) internal::LazyResolve ("glMakeNamedBufferResidentNV") : OGLP_ENTRY (MakeNamedBufferResidentNV);
+    table->MakeNamedBufferNonResidentNV = OGLP_ENTRY (MakeNamedBufferNonResidentNV) == internal::Lazy_MakeNamedBufferNonResidentNV
+        ? (PFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC) internal::LazyResolve ("glMakeNamedBufferNonResidentNV") : OGLP_ENTRY (MakeNamedBufferNonResidentNV);
+    table->IsNamedBufferResidentNV = OGLP_ENTRY (IsNamedBufferResidentNV) == internal::Lazy_IsNamedBufferResidentNV
+        ? (PFNGLISNAMEDBUFFERRESIDENTNVPROC) internal::LazyResolve ("glIsNamedBufferResidentNV") : OGLP_ENTRY (IsNamedBufferResidentNV);
+    table->GetBufferParameterui64vNV = OGLP_ENTRY (GetBufferParameterui64vNV) == internal::Lazy_GetBufferParameterui64vNV
+        ? (PFNGLGETBUFFERPARAMETERUI64VNVPROC) internal::LazyResolve ("glGetBufferParameterui64vNV") : OGLP_ENTRY (GetBufferParameterui64vNV);
+    table->GetNamedBufferParameterui64vNV = OGLP_ENTRY (GetNamedBufferParameterui64vNV) == internal::Lazy_GetNamedBufferParameterui64vNV
+        ? (PFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC) internal::LazyResolve ("glGetNamedBufferParameterui64vNV") : OGLP_ENTRY (GetNamedBufferParameterui64vNV);
+    table->GetIntegerui64vNV = OGLP_ENTRY (GetIntegerui64vNV) == internal::Lazy_GetIntegerui64vNV
+        ? (PFNGLGETINTEGERUI64VNVPROC) internal::LazyResolve ("glGetIntegerui64vNV") : OGLP_ENTRY (GetIntegerui64vNV);
+    table->Uniformui64NV = OGLP_ENTRY (Uniformui64NV) == internal::Lazy_Uniformui64NV
+        ? (PFNGLUNIFORMUI64NVPROC) internal::LazyResolve ("glUniformui64NV") : OGLP_ENTRY (Uniformui64NV);
+    table->Uniformui64vNV = OGLP_ENTRY (Uniformui64vNV) == internal::Lazy_Uniformui64vNV
+        ? (PFNGLUNIFORMUI64VNVPROC) internal::LazyResolve ("glUniformui64vNV") : OGLP_ENTRY (Uniformui64vNV);
+    table->ProgramUniformui64NV = OGLP_ENTRY (ProgramUniformui64NV) == internal::Lazy_ProgramUniformui64NV
+        ? (PFNGLPROGRAMUNIFORMUI64NVPROC) internal::LazyResolve ("glProgramUniformui64NV") : OGLP_ENTRY (ProgramUniformui64NV);
+    table->ProgramUniformui64vNV = OGLP_ENTRY (ProgramUniformui64vNV) == internal::Lazy_ProgramUniformui64vNV
+        ? (PFNGLPROGRAMUNIFORMUI64VNVPROC) internal::LazyResolve ("glProgramUniformui64vNV") : OGLP_ENTRY (ProgramUniformui64vNV);
+    table->BufferAddressRangeNV = OGLP_ENTRY (BufferAddressRangeNV) == internal::Lazy_BufferAddressRangeNV
+        ? (PFNGLBUFFERADDRESSRANGENVPROC) internal::LazyResolve ("glBufferAddressRangeNV") : OGLP_ENTRY (BufferAddressRangeNV);
+    table->VertexFormatNV = OGLP_ENTRY (VertexFormatNV) == internal::Lazy_VertexFormatNV
+        ? (PFNGLVERTEXFORMATNVPROC) internal::LazyResolve ("glVertexFormatNV") : OGLP_ENTRY (VertexFormatNV);
+    table->NormalFormatNV = OGLP_ENTRY (NormalFormatNV) == internal::Lazy_NormalFormatNV
+        ? (PFNGLNORMALFORMATNVPROC) internal::LazyResolve ("glNormalFormatNV") : OGLP_ENTRY (NormalFormatNV);
+    table->ColorFormatNV = OGLP_ENTRY (ColorFormatNV) == internal::Lazy_ColorFormatNV
+        ? (PFNGLCOLORFORMATNVPROC) internal::LazyResolve ("glColorFormatNV") : OGLP_ENTRY (ColorFormatNV);
+    table->IndexFormatNV = OGLP_ENTRY (IndexFormatNV) == internal::Lazy_IndexFormatNV
+        ? (PFNGLINDEXFORMATNVPROC) internal::LazyResolve ("glIndexFormatNV") : OGLP_ENTRY (IndexFormatNV);
+    table->TexCoordFormatNV = OGLP_ENTRY (TexCoordFormatNV) == internal::Lazy_TexCoordFormatNV
+        ? (PFNGLTEXCOORDFORMATNVPROC) internal::LazyResolve ("glTexCoordFormatNV") : OGLP_ENTRY (TexCoordFormatNV);
+    table->EdgeFlagFormatNV = OGLP_ENTRY (EdgeFlagFormatNV) == internal::Lazy_EdgeFlagFormatNV
+        ? (PFNGLEDGEFLAGFORMATNVPROC) internal::LazyResolve ("glEdgeFlagFormatNV") : OGLP_ENTRY (EdgeFlagFormatNV);
+    table->SecondaryColorFormatNV = OGLP_ENTRY (SecondaryColorFormatNV) == internal::Lazy_SecondaryColorFormatNV
+        ? (PFNGLSECONDARYCOLORFORMATNVPROC) internal::LazyResolve ("glSecondaryColorFormatNV") : OGLP_ENTRY (SecondaryColorFormatNV);
+    table->FogCoordFormatNV = OGLP_ENTRY (FogCoordFormatNV) == internal::Lazy_FogCoordFormatNV
+        ? (PFNGLFOGCOORDFORMATNVPROC) internal::LazyResolve ("glFogCoordFormatNV") : OGLP_ENTRY (FogCoordFormatNV);
+    table->VertexAttribFormatNV = OGLP_ENTRY (VertexAttribFormatNV) == internal::Lazy_VertexAttribFormatNV
+        ? (PFNGLVERTEXATTRIBFORMATNVPROC) internal::LazyResolve ("glVertexAttribFormatNV") : OGLP_ENTRY (VertexAttribFormatNV);
+    table->VertexAttribIFormatNV = OGLP_ENTRY (VertexAttribIFormatNV) == internal::Lazy_VertexAttribIFormatNV
+        ? (PFNGLVERTEXATTRIBIFORMATNVPROC) internal::LazyResolve ("glVertexAttribIFormatNV") : OGLP_ENTRY (VertexAttribIFormatNV);
+    table->GetIntegerui64i_vNV = OGLP_ENTRY (GetIntegerui64i_vNV) == internal::Lazy_GetIntegerui64i_vNV
+        ? (PFNGLGETINTEGERUI64I_VNVPROC) internal::LazyResolve ("glGetIntegerui64i_vNV") : OGLP_ENTRY (GetIntegerui64i_vNV);
+    table->EnableClientState = OGLP_ENTRY (EnableClientState) == internal::Lazy_EnableClientState
+        ? (PFNGLENABLECLIENTSTATEPROC) internal::LazyResolve ("glEnableClientState") : OGLP_ENTRY (EnableClientState);
+    table->DisableClientState = OGLP_ENTRY (DisableClientState) == internal::Lazy_DisableClientState
+        ? (PFNGLDISABLECLIENTSTATEPROC) internal::LazyResolve ("glDisableClientState") : OGLP_ENTRY (DisableClientState);
+}
 
+void SetDispatch (const DispatchTable *table)
+{
+    OGLP_GETPROCADDRESS = table->getprocaddress;
+#ifndef OGLP_DIRECT_LINK
+    OGLP_ENTRY (CullFace) = table->CullFace;
+    OGLP_ENTRY (FrontFace) = table->FrontFace;
+    OGLP_ENTRY (Hint) = table->Hint;
+    OGLP_ENTRY (LineWidth) = table->LineWidth;
+    OGLP_ENTRY (PointSize) = table->PointSize;
+    OGLP_ENTRY (PolygonMode) = table->PolygonMode;
+    OGLP_ENTRY (Scissor) = table->Scissor;
+    OGLP_ENTRY (TexParameterf) = table->TexParameterf;
+    OGLP_ENTRY (TexParameterfv) = table->TexParameterfv;
+    OGLP_ENTRY (TexParameteri) = table->TexParameteri;
+    OGLP_ENTRY (TexParameteriv) = table->TexParameteriv;
+    OGLP_ENTRY (TexImage1D) = table->TexImage1D;
+    OGLP_ENTRY (TexImage2D) = table->TexImage2D;
+    OGLP_ENTRY (DrawBuffer) = table->DrawBuffer;
+    OGLP_ENTRY (Clear) = table->Clear;
+    OGLP_ENTRY (ClearColor) = table->ClearColor;
+    OGLP_ENTRY (ClearStencil) = table->ClearStencil;
+    OGLP_ENTRY (ClearDepth) = table->ClearDepth;
+    OGLP_ENTRY (StencilMask) = table->StencilMask;
+    OGLP_ENTRY (ColorMask) = table->ColorMask;
+    OGLP_ENTRY (DepthMask) = table->DepthMask;
+    OGLP_ENTRY (Disable) = table->Disable;
+    OGLP_ENTRY (Enable) = table->Enable;
+    OGLP_ENTRY (Finish) = table->Finish;
+    OGLP_ENTRY (Flush) = table->Flush;
+    OGLP_ENTRY (BlendFunc) = table->BlendFunc;
+    OGLP_ENTRY (LogicOp) = table->LogicOp;
+    OGLP_ENTRY (StencilFunc) = table->StencilFunc;
+    OGLP_ENTRY (StencilOp) = table->StencilOp;
+    OGLP_ENTRY (DepthFunc) = table->DepthFunc;
+    OGLP_ENTRY (PixelStoref) = table->PixelStoref;
+    OGLP_ENTRY (PixelStorei) = table->PixelStorei;
+    OGLP_ENTRY (ReadBuffer) = table->ReadBuffer;
+    OGLP_ENTRY (ReadPixels) = table->ReadPixels;
+    OGLP_ENTRY (GetBooleanv) = table->GetBooleanv;
+    OGLP_ENTRY (GetDoublev) = table->GetDoublev;
+    OGLP_ENTRY (GetError) = table->GetError;
+    OGLP_ENTRY (GetFloatv) = table->GetFloatv;
+    OGLP_ENTRY (GetIntegerv) = table->GetIntegerv;
+    OGLP_ENTRY (GetString) = table->GetString;
+    OGLP_ENTRY (GetTexImage) = table->GetTexImage;
+    OGLP_ENTRY (GetTexParameterfv) = table->GetTexParameterfv;
+    OGLP_ENTRY (GetTexParameteriv) = table->GetTexParameteriv;
+    OGLP_ENTRY (GetTexLevelParameterfv) = table->GetTexLevelParameterfv;
+    OGLP_ENTRY (GetTexLevelParameteriv) = table->GetTexLevelParameteriv;
+    OGLP_ENTRY (IsEnabled) = table->IsEnabled;
+    OGLP_ENTRY (DepthRange) = table->DepthRange;
+    OGLP_ENTRY (Viewport) = table->Viewport;
+    OGLP_ENTRY (DrawArrays) = table->DrawArrays;
+    OGLP_ENTRY (DrawElements) = table->DrawElements;
+    OGLP_ENTRY (GetPointerv) = table->GetPointerv;
+    OGLP_ENTRY (PolygonOffset) = table->PolygonOffset;
+    OGLP_ENTRY (CopyTexImage1D) = table->CopyTexImage1D;
+    OGLP_ENTRY (CopyTexImage2D) = table->CopyTexImage2D;
+    OGLP_ENTRY (CopyTexSubImage1D) = table->CopyTexSubImage1D;
+    OGLP_ENTRY (CopyTexSubImage2D) = table->CopyTexSubImage2D;
+    OGLP_ENTRY (TexSubImage1D) = table->TexSubImage1D;
+    OGLP_ENTRY (TexSubImage2D) = table->TexSubImage2D;
+    OGLP_ENTRY (BindTexture) = table->BindTexture;
+    OGLP_ENTRY (DeleteTextures) = table->DeleteTextures;
+    OGLP_ENTRY (GenTextures) = table->GenTextures;
+    OGLP_ENTRY (IsTexture) = table->IsTexture;
+    OGLP_ENTRY (DrawRangeElements) = table->DrawRangeElements;
+    OGLP_ENTRY (TexImage3D) = table->TexImage3D;
+    OGLP_ENTRY (TexSubImage3D) = table->TexSubImage3D;
+    OGLP_ENTRY (CopyTexSubImage3D) = table->CopyTexSubImage3D;
+    OGLP_ENTRY (ActiveTexture) = table->ActiveTexture;
+    OGLP_ENTRY (SampleCoverage) = table->SampleCoverage;
+    OGLP_ENTRY (CompressedTexImage3D) = table->CompressedTexImage3D;
+    OGLP_ENTRY (CompressedTexImage2D) = table->CompressedTexImage2D;
+    OGLP_ENTRY (CompressedTexImage1D) = table->CompressedTexImage1D;
+    OGLP_ENTRY (CompressedTexSubImage3D) = table->CompressedTexSubImage3D;
+    OGLP_ENTRY (CompressedTexSubImage2D) = table->CompressedTexSubImage2D;
+    OGLP_ENTRY (CompressedTexSubImage1D) = table->CompressedTexSubImage1D;
+    OGLP_ENTRY (GetCompressedTexImage) = table->GetCompressedTexImage;
+    OGLP_ENTRY (BlendFuncSeparate) = table->BlendFuncSeparate;
+    OGLP_ENTRY (MultiDrawArrays) = table->MultiDrawArrays;
+    OGLP_ENTRY (MultiDrawElements) = table->MultiDrawElements;
+    OGLP_ENTRY (PointParameterf) = table->PointParameterf;
+    OGLP_ENTRY (PointParameterfv) = table->PointParameterfv;
+    OGLP_ENTRY (PointParameteri) = table->PointParameteri;
+    OGLP_ENTRY (PointParameteriv) = table->PointParameteriv;
+    OGLP_ENTRY (BlendColor) = table->BlendColor;
+    OGLP_ENTRY (BlendEquation) = table->BlendEquation;
+    OGLP_ENTRY (GenQueries) = table->GenQueries;
+    OGLP_ENTRY (DeleteQueries) = table->DeleteQueries;
+    OGLP_ENTRY (IsQuery) = table->IsQuery;
+    OGLP_ENTRY (BeginQuery) = table->BeginQuery;
+    OGLP_ENTRY (EndQuery) = table->EndQuery;
+    OGLP_ENTRY (GetQueryiv) = table->GetQueryiv;
+    OGLP_ENTRY (GetQueryObjectiv) = table->GetQueryObjectiv;
+    OGLP_ENTRY (GetQueryObjectuiv) = table->GetQueryObjectuiv;
+    OGLP_ENTRY (BindBuffer) = table->BindBuffer;
+    OGLP_ENTRY (DeleteBuffers) = table->DeleteBuffers;
+    OGLP_ENTRY (GenBuffers) = table->GenBuffers;
+    OGLP_ENTRY (IsBuffer) = table->IsBuffer;
+    OGLP_ENTRY (BufferData) = table->BufferData;
+    OGLP_ENTRY (BufferSubData) = table->BufferSubData;
+    OGLP_ENTRY (GetBufferSubData) = table->GetBufferSubData;
+    OGLP_ENTRY (MapBuffer) = table->MapBuffer;
+    OGLP_ENTRY (UnmapBuffer) = table->UnmapBuffer;
+    OGLP_ENTRY (GetBufferParameteriv) = table->GetBufferParameteriv;
+    OGLP_ENTRY (GetBufferPointerv) = table->GetBufferPointerv;
+    OGLP_ENTRY (BlendEquationSeparate) = table->BlendEquationSeparate;
+    OGLP_ENTRY (DrawBuffers) = table->DrawBuffers;
+    OGLP_ENTRY (StencilOpSeparate) = table->StencilOpSeparate;
+    OGLP_ENTRY (StencilFuncSeparate) = table->StencilFuncSeparate;
+    OGLP_ENTRY (StencilMaskSeparate) = table->StencilMaskSeparate;
+    OGLP_ENTRY (AttachShader) = table->AttachShader;
+    OGLP_ENTRY (BindAttribLocation) = table->BindAttribLocation;
+    OGLP_ENTRY (CompileShader) = table->CompileShader;
+    OGLP_ENTRY (CreateProgram) = table->CreateProgram;
+    OGLP_ENTRY (CreateShader) = table->CreateShader;
+    OGLP_ENTRY (DeleteProgram) = table->DeleteProgram;
+    OGLP_ENTRY (DeleteShader) = table->DeleteShader;
+    OGLP_ENTRY (DetachShader) = table->DetachShader;
+    OGLP_ENTRY (DisableVertexAttribArray) = table->DisableVertexAttribArray;
+    OGLP_ENTRY (EnableVertexAttribArray) = table->EnableVertexAttribArray;
+    OGLP_ENTRY (GetActiveAttrib) = table->GetActiveAttrib;
+    OGLP_ENTRY (GetActiveUniform) = table->GetActiveUniform;
+    OGLP_ENTRY (GetAttachedShaders) = table->GetAttachedShaders;
+    OGLP_ENTRY (GetAttribLocation) = table->GetAttribLocation;
+    OGLP_ENTRY (GetProgramiv) = table->GetProgramiv;
+    OGLP_ENTRY (GetProgramInfoLog) = table->GetProgramInfoLog;
+    OGLP_ENTRY (GetShaderiv) = table->GetShaderiv;
+    OGLP_ENTRY (GetShaderInfoLog) = table->GetShaderInfoLog;
+    OGLP_ENTRY (GetShaderSource) = table->GetShaderSource;
+    OGLP_ENTRY (GetUniformLocation) = table->GetUniformLocation;
+    OGLP_ENTRY (GetUniformfv) = table->GetUniformfv;
+    OGLP_ENTRY (GetUniformiv) = table->GetUniformiv;
+    OGLP_ENTRY (GetVertexAttribdv) = table->GetVertexAttribdv;
+    OGLP_ENTRY (GetVertexAttribfv) = table->GetVertexAttribfv;
+    OGLP_ENTRY (GetVertexAttribiv) = table->GetVertexAttribiv;
+    OGLP_ENTRY (GetVertexAttribPointerv) = table->GetVertexAttribPointerv;
+    OGLP_ENTRY (IsProgram) = table->IsProgram;
+    OGLP_ENTRY (IsShader) = table->IsShader;
+    OGLP_ENTRY (LinkProgram) = table->LinkProgram;
+    OGLP_ENTRY (ShaderSource) = table->ShaderSource;
+    OGLP_ENTRY (UseProgram) = table->UseProgram;
+    OGLP_ENTRY (Uniform1f) = table->Uniform1f;
+    OGLP_ENTRY (Uniform2f) = table->Uniform2f;
+    OGLP_ENTRY (Uniform3f) = table->Uniform3f;
+    OGLP_ENTRY (Uniform4f) = table->Uniform4f;
+    OGLP_ENTRY (Uniform1i) = table->Uniform1i;
+    OGLP_ENTRY (Uniform2i) = table->Uniform2i;
+    OGLP_ENTRY (Uniform3i) = table->Uniform3i;
+    OGLP_ENTRY (Uniform4i) = table->Uniform4i;
+    OGLP_ENTRY (Uniform1fv) = table->Uniform1fv;
+    OGLP_ENTRY (Uniform2fv) = table->Uniform2fv;
+    OGLP_ENTRY (Uniform3fv) = table->Uniform3fv;
+    OGLP_ENTRY (Uniform4fv) = table->Uniform4fv;
+    OGLP_ENTRY (Uniform1iv) = table->Uniform1iv;
+    OGLP_ENTRY (Uniform2iv) = table->Uniform2iv;
+    OGLP_ENTRY (Uniform3iv) = table->Uniform3iv;
+    OGLP_ENTRY (Uniform4iv) = table->Uniform4iv;
+    OGLP_ENTRY (UniformMatrix2fv) = table->UniformMatrix2fv;
+    OGLP_ENTRY (UniformMatrix3fv) = table->UniformMatrix3fv;
+    OGLP_ENTRY (UniformMatrix4fv) = table->UniformMatrix4fv;
+    OGLP_ENTRY (ValidateProgram) = table->ValidateProgram;
+    OGLP_ENTRY (VertexAttrib1d) = table->VertexAttrib1d;
+    OGLP_ENTRY (VertexAttrib1dv) = table->VertexAttrib1dv;
+    OGLP_ENTRY (VertexAttrib1f) = table->VertexAttrib1f;
+    OGLP_ENTRY (VertexAttrib1fv) = table->VertexAttrib1fv;
+    OGLP_ENTRY (VertexAttrib1s) = table->VertexAttrib1s;
+    OGLP_ENTRY (VertexAttrib1sv) = table->VertexAttrib1sv;
+    OGLP_ENTRY (VertexAttrib2d) = table->VertexAttrib2d;
+    OGLP_ENTRY (VertexAttrib2dv) = table->VertexAttrib2dv;
+    OGLP_ENTRY (VertexAttrib2f) = table->VertexAttrib2f;
+    OGLP_ENTRY (VertexAttrib2fv) = table->VertexAttrib2fv;
+    OGLP_ENTRY (VertexAttrib2s) = table->VertexAttrib2s;
+    OGLP_ENTRY (VertexAttrib2sv) = table->VertexAttrib2sv;
+    OGLP_ENTRY (VertexAttrib3d) = table->VertexAttrib3d;
+    OGLP_ENTRY (VertexAttrib3dv) = table->VertexAttrib3dv;
+    OGLP_ENTRY (VertexAttrib3f) = table->VertexAttrib3f;
+    OGLP_ENTRY (VertexAttrib3fv) = table->VertexAttrib3fv;
+    OGLP_ENTRY (VertexAttrib3s) = table->VertexAttrib3s;
+    OGLP_ENTRY (VertexAttrib3sv) = table->VertexAttrib3sv;
+    OGLP_ENTRY (VertexAttrib4Nbv) = table->VertexAttrib4Nbv;
+    OGLP_ENTRY (VertexAttrib4Niv) = table->VertexAttrib4Niv;
+    OGLP_ENTRY (VertexAttrib4Nsv) = table->VertexAttrib4Nsv;
+    OGLP_ENTRY (VertexAttrib4Nub) = table->VertexAttrib4Nub;
+    OGLP_ENTRY (VertexAttrib4Nubv) = table->VertexAttrib4Nubv;
+    OGLP_ENTRY (VertexAttrib4Nuiv) = table->VertexAttrib4Nuiv;
+    OGLP_ENTRY (VertexAttrib4Nusv) = table->VertexAttrib4Nusv;
+    OGLP_ENTRY (VertexAttrib4bv) = table->VertexAttrib4bv;
+    OGLP_ENTRY (VertexAttrib4d) = table->VertexAttrib4d;
+    OGLP_ENTRY (VertexAttrib4dv) = table->VertexAttrib4dv;
+    OGLP_ENTRY (VertexAttrib4f) = table->VertexAttrib4f;
+    OGLP_ENTRY (VertexAttrib4fv) = table->VertexAttrib4fv;
+    OGLP_ENTRY (VertexAttrib4iv) = table->VertexAttrib4iv;
+    OGLP_ENTRY (VertexAttrib4s) = table->VertexAttrib4s;
+    OGLP_ENTRY (VertexAttrib4sv) = table->VertexAttrib4sv;
+    OGLP_ENTRY (VertexAttrib4ubv) = table->VertexAttrib4ubv;
+    OGLP_ENTRY (VertexAttrib4uiv) = table->VertexAttrib4uiv;
+    OGLP_ENTRY (VertexAttrib4usv) = table->VertexAttrib4usv;
+    OGLP_ENTRY (VertexAttribPointer) = table->VertexAttribPointer;
+    OGLP_ENTRY (UniformMatrix2x3fv) = table->UniformMatrix2x3fv;
+    OGLP_ENTRY (UniformMatrix3x2fv) = table->UniformMatrix3x2fv;
+    OGLP_ENTRY (UniformMatrix2x4fv) = table->UniformMatrix2x4fv;
+    OGLP_ENTRY (UniformMatrix4x2fv) = table->UniformMatrix4x2fv;
+    OGLP_ENTRY (UniformMatrix3x4fv) = table->UniformMatrix3x4fv;
+    OGLP_ENTRY (UniformMatrix4x3fv) = table->UniformMatrix4x3fv;
+    OGLP_ENTRY (ColorMaski) = table->ColorMaski;
+    OGLP_ENTRY (GetBooleani_v) = table->GetBooleani_v;
+    OGLP_ENTRY (GetIntegeri_v) = table->GetIntegeri_v;
+    OGLP_ENTRY (Enablei) = table->Enablei;
+    OGLP_ENTRY (Disablei) = table->Disablei;
+    OGLP_ENTRY (IsEnabledi) = table->IsEnabledi;
+    OGLP_ENTRY (BeginTransformFeedback) = table->BeginTransformFeedback;
+    OGLP_ENTRY (EndTransformFeedback) = table->EndTransformFeedback;
+    OGLP_ENTRY (BindBufferRange) = table->BindBufferRange;
+    OGLP_ENTRY (BindBufferBase) = table->BindBufferBase;
+    OGLP_ENTRY (TransformFeedbackVaryings) = table->TransformFeedbackVaryings;
+    OGLP_ENTRY (GetTransformFeedbackVarying) = table->GetTransformFeedbackVarying;
+    OGLP_ENTRY (ClampColor) = table->ClampColor;
+    OGLP_ENTRY (BeginConditionalRender) = table->BeginConditionalRender;
+    OGLP_ENTRY (EndConditionalRender) = table->EndConditionalRender;
+    OGLP_ENTRY (VertexAttribIPointer) = table->VertexAttribIPointer;
+    OGLP_ENTRY (GetVertexAttribIiv) = table->GetVertexAttribIiv;
+    OGLP_ENTRY (GetVertexAttribIuiv) = table->GetVertexAttribIuiv;
+    OGLP_ENTRY (VertexAttribI1i) = table->VertexAttribI1i;
+    OGLP_ENTRY (VertexAttribI2i) = table->VertexAttribI2i;
+    OGLP_ENTRY (VertexAttribI3i) = table->VertexAttribI3i;
+    OGLP_ENTRY (VertexAttribI4i) = table->VertexAttribI4i;
+    OGLP_ENTRY (VertexAttribI1ui) = table->VertexAttribI1ui;
+    OGLP_ENTRY (VertexAttribI2ui) = table->VertexAttribI2ui;
+    OGLP_ENTRY (VertexAttribI3ui) = table->VertexAttribI3ui;
+    OGLP_ENTRY (VertexAttribI4ui) = table->VertexAttribI4ui;
+    OGLP_ENTRY (VertexAttribI1iv) = table->VertexAttribI1iv;
+    OGLP_ENTRY (VertexAttribI2iv) = table->VertexAttribI2iv;
+    OGLP_ENTRY (VertexAttribI3iv) = table->VertexAttribI3iv;
+    OGLP_ENTRY (VertexAttribI4iv) = table->VertexAttribI4iv;
+    OGLP_ENTRY (VertexAttribI1uiv) = table->VertexAttribI1uiv;
+    OGLP_ENTRY (VertexAttribI2uiv) = table->VertexAttribI2uiv;
+    OGLP_ENTRY (VertexAttribI3uiv) = table->VertexAttribI3uiv;
+    OGLP_ENTRY (VertexAttribI4uiv) = table->VertexAttribI4uiv;
+    OGLP_ENTRY (VertexAttribI4bv) = table->VertexAttribI4bv;
+    OGLP_ENTRY (VertexAttribI4sv) = table->VertexAttribI4sv;
+    OGLP_ENTRY (VertexAttribI4ubv) = table->VertexAttribI4ubv;
+    OGLP_ENTRY (VertexAttribI4usv) = table->VertexAttribI4usv;
+    OGLP_ENTRY (GetUniformuiv) = table->GetUniformuiv;
+    OGLP_ENTRY (BindFragDataLocation) = table->BindFragDataLocation;
+    OGLP_ENTRY (GetFragDataLocation) = table->GetFragDataLocation;
+    OGLP_ENTRY (Uniform1ui) = table->Uniform1ui;
+    OGLP_ENTRY (Uniform2ui) = table->Uniform2ui;
+    OGLP_ENTRY (Uniform3ui) = table->Uniform3ui;
+    OGLP_ENTRY (Uniform4ui) = table->Uniform4ui;
+    OGLP_ENTRY (Uniform1uiv) = table->Uniform1uiv;
+    OGLP_ENTRY (Uniform2uiv) = table->Uniform2uiv;
+    OGLP_ENTRY (Uniform3uiv) = table->Uniform3uiv;
+    OGLP_ENTRY (Uniform4uiv) = table->Uniform4uiv;
+    OGLP_ENTRY (TexParameterIiv) = table->TexParameterIiv;
+    OGLP_ENTRY (TexParameterIuiv) = table->TexParameterIuiv;
+    OGLP_ENTRY (GetTexParameterIiv) = table->GetTexParameterIiv;
+    OGLP_ENTRY (GetTexParameterIuiv) = table->GetTexParameterIuiv;
+    OGLP_ENTRY (ClearBufferiv) = table->ClearBufferiv;
+    OGLP_ENTRY (ClearBufferuiv) = table->ClearBufferuiv;
+    OGLP_ENTRY (ClearBufferfv) = table->ClearBufferfv;
+    OGLP_ENTRY (ClearBufferfi) = table->ClearBufferfi;
+    OGLP_ENTRY (GetStringi) = table->GetStringi;
+    OGLP_ENTRY (IsRenderbuffer) = table->IsRenderbuffer;
+    OGLP_ENTRY (BindRenderbuffer) = table->BindRenderbuffer;
+    OGLP_ENTRY (DeleteRenderbuffers) = table->DeleteRenderbuffers;
+    OGLP_ENTRY (GenRenderbuffers) = table->GenRenderbuffers;
+    OGLP_ENTRY (RenderbufferStorage) = table->RenderbufferStorage;
+    OGLP_ENTRY (GetRenderbufferParameteriv) = table->GetRenderbufferParameteriv;
+    OGLP_ENTRY (IsFramebuffer) = table->IsFramebuffer;
+    OGLP_ENTRY (BindFramebuffer) = table->BindFramebuffer;
+    OGLP_ENTRY (DeleteFramebuffers) = table->DeleteFramebuffers;
+    OGLP_ENTRY (GenFramebuffers) = table->GenFramebuffers;
+    OGLP_ENTRY (CheckFramebufferStatus) = table->CheckFramebufferStatus;
+    OGLP_ENTRY (FramebufferTexture1D) = table->FramebufferTexture1D;
+    OGLP_ENTRY (FramebufferTexture2D) = table->FramebufferTexture2D;
+    OGLP_ENTRY (FramebufferTexture3D) = table->FramebufferTexture3D;
+    OGLP_ENTRY (FramebufferRenderbuffer) = table->FramebufferRenderbuffer;
+    OGLP_ENTRY (GetFramebufferAttachmentParameteriv) = table->GetFramebufferAttachmentParameteriv;
+    OGLP_ENTRY (GenerateMipmap) = table->GenerateMipmap;
+    OGLP_ENTRY (BlitFramebuffer) = table->BlitFramebuffer;
+    OGLP_ENTRY (RenderbufferStorageMultisample) = table->RenderbufferStorageMultisample;
+    OGLP_ENTRY (FramebufferTextureLayer) = table->FramebufferTextureLayer;
+    OGLP_ENTRY (MapBufferRange) = table->MapBufferRange;
+    OGLP_ENTRY (FlushMappedBufferRange) = table->FlushMappedBufferRange;
+    OGLP_ENTRY (BindVertexArray) = table->BindVertexArray;
+    OGLP_ENTRY (DeleteVertexArrays) = table->DeleteVertexArrays;
+    OGLP_ENTRY (GenVertexArrays) = table->GenVertexArrays;
+    OGLP_ENTRY (IsVertexArray) = table->IsVertexArray;
+    OGLP_ENTRY (DrawArraysInstanced) = table->DrawArraysInstanced;
+    OGLP_ENTRY (DrawElementsInstanced) = table->DrawElementsInstanced;
+    OGLP_ENTRY (TexBuffer) = table->TexBuffer;
+    OGLP_ENTRY (PrimitiveRestartIndex) = table->PrimitiveRestartIndex;
+    OGLP_ENTRY (CopyBufferSubData) = table->CopyBufferSubData;
+    OGLP_ENTRY (GetUniformIndices) = table->GetUniformIndices;
+    OGLP_ENTRY (GetActiveUniformsiv) = table->GetActiveUniformsiv;
+    OGLP_ENTRY (GetActiveUniformName) = table->GetActiveUniformName;
+    OGLP_ENTRY (GetUniformBlockIndex) = table->GetUniformBlockIndex;
+    OGLP_ENTRY (GetActiveUniformBlockiv) = table->GetActiveUniformBlockiv;
+    OGLP_ENTRY (GetActiveUniformBlockName) = table->GetActiveUniformBlockName;
+    OGLP_ENTRY (UniformBlockBinding) = table->UniformBlockBinding;
+    OGLP_ENTRY (DrawElementsBaseVertex) = table->DrawElementsBaseVertex;
+    OGLP_ENTRY (DrawRangeElementsBaseVertex) = table->DrawRangeElementsBaseVertex;
+    OGLP_ENTRY (DrawElementsInstancedBaseVertex) = table->DrawElementsInstancedBaseVertex;
+    OGLP_ENTRY (MultiDrawElementsBaseVertex) = table->MultiDrawElementsBaseVertex;
+    OGLP_ENTRY (ProvokingVertex) = table->ProvokingVertex;
+    OGLP_ENTRY (FenceSync) = table->FenceSync;
+    OGLP_ENTRY (IsSync) = table->IsSync;
+    OGLP_ENTRY (DeleteSync) = table->DeleteSync;
+    OGLP_ENTRY (ClientWaitSync) = table->ClientWaitSync;
+    OGLP_ENTRY (WaitSync) = table->WaitSync;
+    OGLP_ENTRY (GetInteger64v) = table->GetInteger64v;
+    OGLP_ENTRY (GetSynciv) = table->GetSynciv;
+    OGLP_ENTRY (GetInteger64i_v) = table->GetInteger64i_v;
+    OGLP_ENTRY (GetBufferParameteri64v) = table->GetBufferParameteri64v;
+    OGLP_ENTRY (FramebufferTexture) = table->FramebufferTexture;
+    OGLP_ENTRY (TexImage2DMultisample) = table->TexImage2DMultisample;
+    OGLP_ENTRY (TexImage3DMultisample) = table->TexImage3DMultisample;
+    OGLP_ENTRY (GetMultisamplefv) = table->GetMultisamplefv;
+    OGLP_ENTRY (SampleMaski) = table->SampleMaski;
+    OGLP_ENTRY (BindFragDataLocationIndexed) = table->BindFragDataLocationIndexed;
+    OGLP_ENTRY (GetFragDataIndex) = table->GetFragDataIndex;
+    OGLP_ENTRY (GenSamplers) = table->GenSamplers;
+    OGLP_ENTRY (DeleteSamplers) = table->DeleteSamplers;
+    OGLP_ENTRY (IsSampler) = table->IsSampler;
+    OGLP_ENTRY (BindSampler) = table->BindSampler;
+    OGLP_ENTRY (SamplerParameteri) = table->SamplerParameteri;
+    OGLP_ENTRY (SamplerParameteriv) = table->SamplerParameteriv;
+    OGLP_ENTRY (SamplerParameterf) = table->SamplerParameterf;
+    OGLP_ENTRY (SamplerParameterfv) = table->SamplerParameterfv;
+    OGLP_ENTRY (SamplerParameterIiv) = table->SamplerParameterIiv;
+    OGLP_ENTRY (SamplerParameterIuiv) = table->SamplerParameterIuiv;
+    OGLP_ENTRY (GetSamplerParameteriv) = table->GetSamplerParameteriv;
+    OGLP_ENTRY (GetSamplerParameterIiv) = table->GetSamplerParameterIiv;
+    OGLP_ENTRY (GetSamplerParameterfv) = table->GetSamplerParameterfv;
+    OGLP_ENTRY (GetSamplerParameterIuiv) = table->GetSamplerParameterIuiv;
+    OGLP_ENTRY (QueryCounter) = table->QueryCounter;
+    OGLP_ENTRY (GetQueryObjecti64v) = table->GetQueryObjecti64v;
+    OGLP_ENTRY (GetQueryObjectui64v) = table->GetQueryObjectui64v;
+    OGLP_ENTRY (VertexAttribDivisor) = table->VertexAttribDivisor;
+    OGLP_ENTRY (VertexAttribP1ui) = table->VertexAttribP1ui;
+    OGLP_ENTRY (VertexAttribP1uiv) = table->VertexAttribP1uiv;
+    OGLP_ENTRY (VertexAttribP2ui) = table->VertexAttribP2ui;
+    OGLP_ENTRY (VertexAttribP2uiv) = table->VertexAttribP2uiv;
+    OGLP_ENTRY (VertexAttribP3ui) = table->VertexAttribP3ui;
+    OGLP_ENTRY (VertexAttribP3uiv) = table->VertexAttribP3uiv;
+    OGLP_ENTRY (VertexAttribP4ui) = table->VertexAttribP4ui;
+    OGLP_ENTRY (VertexAttribP4uiv) = table->VertexAttribP4uiv;
+    OGLP_ENTRY (MinSampleShading) = table->MinSampleShading;
+    OGLP_ENTRY (BlendEquationi) = table->BlendEquationi;
+    OGLP_ENTRY (BlendEquationSeparatei) = table->BlendEquationSeparatei;
+    OGLP_ENTRY (BlendFunci) = table->BlendFunci;
+    OGLP_ENTRY (BlendFuncSeparatei) = table->BlendFuncSeparatei;
+    OGLP_ENTRY (DrawArraysIndirect) = table->DrawArraysIndirect;
+    OGLP_ENTRY (DrawElementsIndirect) = table->DrawElementsIndirect;
+    OGLP_ENTRY (Uniform1d) = table->Uniform1d;
+    OGLP_ENTRY (Uniform2d) = table->Uniform2d;
+    OGLP_ENTRY (Uniform3d) = table->Uniform3d;
+    OGLP_ENTRY (Uniform4d) = table->Uniform4d;
+    OGLP_ENTRY (Uniform1dv) = table->Uniform1dv;
+    OGLP_ENTRY (Uniform2dv) = table->Uniform2dv;
+    OGLP_ENTRY (Uniform3dv) = table->Uniform3dv;
+    OGLP_ENTRY (Uniform4dv) = table->Uniform4dv;
+    OGLP_ENTRY (UniformMatrix2dv) = table->UniformMatrix2dv;
+    OGLP_ENTRY (UniformMatrix3dv) = table->UniformMatrix3dv;
+    OGLP_ENTRY (UniformMatrix4dv) = table->UniformMatrix4dv;
+    OGLP_ENTRY (UniformMatrix2x3dv) = table->UniformMatrix2x3dv;
+    OGLP_ENTRY (UniformMatrix2x4dv) = table->UniformMatrix2x4dv;
+    OGLP_ENTRY (UniformMatrix3x2dv) = table->UniformMatrix3x2dv;
+    OGLP_ENTRY (UniformMatrix3x4dv) = table->UniformMatrix3x4dv;
+    OGLP_ENTRY (UniformMatrix4x2dv) = table->UniformMatrix4x2dv;
+    OGLP_ENTRY (UniformMatrix4x3dv) = table->UniformMatrix4x3dv;
+    OGLP_ENTRY (GetUniformdv) = table->GetUniformdv;
+    OGLP_ENTRY (GetSubroutineUniformLocation) = table->GetSubroutineUniformLocation;
+    OGLP_ENTRY (GetSubroutineIndex) = table->GetSubroutineIndex;
+    OGLP_ENTRY (GetActiveSubroutineUniformiv) = table->GetActiveSubroutineUniformiv;
+    OGLP_ENTRY (GetActiveSubroutineUniformName) = table->GetActiveSubroutineUniformName;
+    OGLP_ENTRY (GetActiveSubroutineName) = table->GetActiveSubroutineName;
+    OGLP_ENTRY (UniformSubroutinesuiv) = table->UniformSubroutinesuiv;
+    OGLP_ENTRY (GetUniformSubroutineuiv) = table->GetUniformSubroutineuiv;
+    OGLP_ENTRY (GetProgramStageiv) = table->GetProgramStageiv;
+    OGLP_ENTRY (PatchParameteri) = table->PatchParameteri;
+    OGLP_ENTRY (PatchParameterfv) = table->PatchParameterfv;
+    OGLP_ENTRY (BindTransformFeedback) = table->BindTransformFeedback;
+    OGLP_ENTRY (DeleteTransformFeedbacks) = table->DeleteTransformFeedbacks;
+    OGLP_ENTRY (GenTransformFeedbacks) = table->GenTransformFeedbacks;
+    OGLP_ENTRY (IsTransformFeedback) = table->IsTransformFeedback;
+    OGLP_ENTRY (PauseTransformFeedback) = table->PauseTransformFeedback;
+    OGLP_ENTRY (ResumeTransformFeedback) = table->ResumeTransformFeedback;
+    OGLP_ENTRY (DrawTransformFeedback) = table->DrawTransformFeedback;
+    OGLP_ENTRY (DrawTransformFeedbackStream) = table->DrawTransformFeedbackStream;
+    OGLP_ENTRY (BeginQueryIndexed) = table->BeginQueryIndexed;
+    OGLP_ENTRY (EndQueryIndexed) = table->EndQueryIndexed;
+    OGLP_ENTRY (GetQueryIndexediv) = table->GetQueryIndexediv;
+    OGLP_ENTRY (ReleaseShaderCompiler) = table->ReleaseShaderCompiler;
+    OGLP_ENTRY (ShaderBinary) = table->ShaderBinary;
+    OGLP_ENTRY (GetShaderPrecisionFormat) = table->GetShaderPrecisionFormat;
+    OGLP_ENTRY (DepthRangef) = table->DepthRangef;
+    OGLP_ENTRY (ClearDepthf) = table->ClearDepthf;
+    OGLP_ENTRY (GetProgramBinary) = table->GetProgramBinary;
+    OGLP_ENTRY (ProgramBinary) = table->ProgramBinary;
+    OGLP_ENTRY (ProgramParameteri) = table->ProgramParameteri;
+    OGLP_ENTRY (UseProgramStages) = table->UseProgramStages;
+    OGLP_ENTRY (ActiveShaderProgram) = table->ActiveShaderProgram;
+    OGLP_ENTRY (CreateShaderProgramv) = table->CreateShaderProgramv;
+    OGLP_ENTRY (BindProgramPipeline) = table->BindProgramPipeline;
+    OGLP_ENTRY (DeleteProgramPipelines) = table->DeleteProgramPipelines;
+    OGLP_ENTRY (GenProgramPipelines) = table->GenProgramPipelines;
+    OGLP_ENTRY (IsProgramPipeline) = table->IsProgramPipeline;
+    OGLP_ENTRY (GetProgramPipelineiv) = table->GetProgramPipelineiv;
+    OGLP_ENTRY (ProgramUniform1i) = table->ProgramUniform1i;
+    OGLP_ENTRY (ProgramUniform1iv) = table->ProgramUniform1iv;
+    OGLP_ENTRY (ProgramUniform1f) = table->ProgramUniform1f;
+    OGLP_ENTRY (ProgramUniform1fv) = table->ProgramUniform1fv;
+    OGLP_ENTRY (ProgramUniform1d) = table->ProgramUniform1d;
+    OGLP_ENTRY (ProgramUniform1dv) = table->ProgramUniform1dv;
+    OGLP_ENTRY (ProgramUniform1ui) = table->ProgramUniform1ui;
+    OGLP_ENTRY (ProgramUniform1uiv) = table->ProgramUniform1uiv;
+    OGLP_ENTRY (ProgramUniform2i) = table->ProgramUniform2i;
+    OGLP_ENTRY (ProgramUniform2iv) = table->ProgramUniform2iv;
+    OGLP_ENTRY (ProgramUniform2f) = table->ProgramUniform2f;
+    OGLP_ENTRY (ProgramUniform2fv) = table->ProgramUniform2fv;
+    OGLP_ENTRY (ProgramUniform2d) = table->ProgramUniform2d;
+    OGLP_ENTRY (ProgramUniform2dv) = table->ProgramUniform2dv;
+    OGLP_ENTRY (ProgramUniform2ui) = table->ProgramUniform2ui;
+    OGLP_ENTRY (ProgramUniform2uiv) = table->ProgramUniform2uiv;
+    OGLP_ENTRY (ProgramUniform3i) = table->ProgramUniform3i;
+    OGLP_ENTRY (ProgramUniform3iv) = table->ProgramUniform3iv;
+    OGLP_ENTRY (ProgramUniform3f) = table->ProgramUniform3f;
+    OGLP_ENTRY (ProgramUniform3fv) = table->ProgramUniform3fv;
+    OGLP_ENTRY (ProgramUniform3d) = table->ProgramUniform3d;
+    OGLP_ENTRY (ProgramUniform3dv) = table->ProgramUniform3dv;
+    OGLP_ENTRY (ProgramUniform3ui) = table->ProgramUniform3ui;
+    OGLP_ENTRY (ProgramUniform3uiv) = table->ProgramUniform3uiv;
+    OGLP_ENTRY (ProgramUniform4i) = table->ProgramUniform4i;
+    OGLP_ENTRY (ProgramUniform4iv) = table->ProgramUniform4iv;
+    OGLP_ENTRY (ProgramUniform4f) = table->ProgramUniform4f;
+    OGLP_ENTRY (ProgramUniform4fv) = table->ProgramUniform4fv;
+    OGLP_ENTRY (ProgramUniform4d) = table->ProgramUniform4d;
+    OGLP_ENTRY (ProgramUniform4dv) = table->ProgramUniform4dv;
+    OGLP_ENTRY (ProgramUniform4ui) = table->ProgramUniform4ui;
+    OGLP_ENTRY (ProgramUniform4uiv) = table->ProgramUniform4uiv;
+    OGLP_ENTRY (ProgramUniformMatrix2fv) = table->ProgramUniformMatrix2fv;
+    OGLP_ENTRY (ProgramUniformMatrix3fv) = table->ProgramUniformMatrix3fv;
+    OGLP_ENTRY (ProgramUniformMatrix4fv) = table->ProgramUniformMatrix4fv;
+    OGLP_ENTRY (ProgramUniformMatrix2dv) = table->ProgramUniformMatrix2dv;
+    OGLP_ENTRY (ProgramUniformMatrix3dv) = table->ProgramUniformMatrix3dv;
+    OGLP_ENTRY (ProgramUniformMatrix4dv) = table->ProgramUniformMatrix4dv;
+    OGLP_ENTRY (ProgramUniformMatrix2x3fv) = table->ProgramUniformMatrix2x3fv;
+    OGLP_ENTRY (ProgramUniformMatrix3x2fv) = table->ProgramUniformMatrix3x2fv;
+    OGLP_ENTRY (ProgramUniformMatrix2x4fv) = table->ProgramUniformMatrix2x4fv;
+    OGLP_ENTRY (ProgramUniformMatrix4x2fv) = table->ProgramUniformMatrix4x2fv;
+    OGLP_ENTRY (ProgramUniformMatrix3x4fv) = table->ProgramUniformMatrix3x4fv;
+    OGLP_ENTRY (ProgramUniformMatrix4x3fv) = table->ProgramUniformMatrix4x3fv;
+    OGLP_ENTRY (ProgramUniformMatrix2x3dv) = table->ProgramUniformMatrix2x3dv;
+    OGLP_ENTRY (ProgramUniformMatrix3x2dv) = table->ProgramUniformMatrix3x2dv;
+    OGLP_ENTRY (ProgramUniformMatrix2x4dv) = table->ProgramUniformMatrix2x4dv;
+    OGLP_ENTRY (ProgramUniformMatrix4x2dv) = table->ProgramUniformMatrix4x2dv;
+    OGLP_ENTRY (ProgramUniformMatrix3x4dv) = table->ProgramUniformMatrix3x4dv;
+    OGLP_ENTRY (ProgramUniformMatrix4x3dv) = table->ProgramUniformMatrix4x3dv;
+    OGLP_ENTRY (ValidateProgramPipeline) = table->ValidateProgramPipeline;
+    OGLP_ENTRY (GetProgramPipelineInfoLog) = table->GetProgramPipelineInfoLog;
+    OGLP_ENTRY (VertexAttribL1d) = table->VertexAttribL1d;
+    OGLP_ENTRY (VertexAttribL2d) = table->VertexAttribL2d;
+    OGLP_ENTRY (VertexAttribL3d) = table->VertexAttribL3d;
+    OGLP_ENTRY (VertexAttribL4d) = table->VertexAttribL4d;
+    OGLP_ENTRY (VertexAttribL1dv) = table->VertexAttribL1dv;
+    OGLP_ENTRY (VertexAttribL2dv) = table->VertexAttribL2dv;
+    OGLP_ENTRY (VertexAttribL3dv) = table->VertexAttribL3dv;
+    OGLP_ENTRY (VertexAttribL4dv) = table->VertexAttribL4dv;
+    OGLP_ENTRY (VertexAttribLPointer) = table->VertexAttribLPointer;
+    OGLP_ENTRY (GetVertexAttribLdv) = table->GetVertexAttribLdv;
+    OGLP_ENTRY (ViewportArrayv) = table->ViewportArrayv;
+    OGLP_ENTRY (ViewportIndexedf) = table->ViewportIndexedf;
+    OGLP_ENTRY (ViewportIndexedfv) = table->ViewportIndexedfv;
+    OGLP_ENTRY (ScissorArrayv) = table->ScissorArrayv;
+    OGLP_ENTRY (ScissorIndexed) = table->ScissorIndexed;
+    OGLP_ENTRY (ScissorIndexedv) = table->ScissorIndexedv;
+    OGLP_ENTRY (DepthRangeArrayv) = table->DepthRangeArrayv;
+    OGLP_ENTRY (DepthRangeIndexed) = table->DepthRangeIndexed;
+    OGLP_ENTRY (GetFloati_v) = table->GetFloati_v;
+    OGLP_ENTRY (GetDoublei_v) = table->GetDoublei_v;
+    OGLP_ENTRY (DrawArraysInstancedBaseInstance) = table->DrawArraysInstancedBaseInstance;
+    OGLP_ENTRY (DrawElementsInstancedBaseInstance) = table->DrawElementsInstancedBaseInstance;
+    OGLP_ENTRY (DrawElementsInstancedBaseVertexBaseInstance) = table->DrawElementsInstancedBaseVertexBaseInstance;
+    OGLP_ENTRY (GetInternalformativ) = table->GetInternalformativ;
+    OGLP_ENTRY (GetActiveAtomicCounterBufferiv) = table->GetActiveAtomicCounterBufferiv;
+    OGLP_ENTRY (BindImageTexture) = table->BindImageTexture;
+    OGLP_ENTRY (MemoryBarrier) = table->MemoryBarrier;
+    OGLP_ENTRY (TexStorage1D) = table->TexStorage1D;
+    OGLP_ENTRY (TexStorage2D) = table->TexStorage2D;
+    OGLP_ENTRY (TexStorage3D) = table->TexStorage3D;
+    OGLP_ENTRY (DrawTransformFeedbackInstanced) = table->DrawTransformFeedbackInstanced;
+    OGLP_ENTRY (DrawTransformFeedbackStreamInstanced) = table->DrawTransformFeedbackStreamInstanced;
+    OGLP_ENTRY (ClearBufferData) = table->ClearBufferData;
+    OGLP_ENTRY (ClearBufferSubData) = table->ClearBufferSubData;
+    OGLP_ENTRY (DispatchCompute) = table->DispatchCompute;
+    OGLP_ENTRY (DispatchComputeIndirect) = table->DispatchComputeIndirect;
+    OGLP_ENTRY (CopyImageSubData) = table->CopyImageSubData;
+    OGLP_ENTRY (FramebufferParameteri) = table->FramebufferParameteri;
+    OGLP_ENTRY (GetFramebufferParameteriv) = table->GetFramebufferParameteriv;
+    OGLP_ENTRY (GetInternalformati64v) = table->GetInternalformati64v;
+    OGLP_ENTRY (InvalidateTexSubImage) = table->InvalidateTexSubImage;
+    OGLP_ENTRY (InvalidateTexImage) = table->InvalidateTexImage;
+    OGLP_ENTRY (InvalidateBufferSubData) = table->InvalidateBufferSubData;
+    OGLP_ENTRY (InvalidateBufferData) = table->InvalidateBufferData;
+    OGLP_ENTRY (InvalidateFramebuffer) = table->InvalidateFramebuffer;
+    OGLP_ENTRY (InvalidateSubFramebuffer) = table->InvalidateSubFramebuffer;
+    OGLP_ENTRY (MultiDrawArraysIndirect) = table->MultiDrawArraysIndirect;
+    OGLP_ENTRY (MultiDrawElementsIndirect) = table->MultiDrawElementsIndirect;
+    OGLP_ENTRY (GetProgramInterfaceiv) = table->GetProgramInterfaceiv;
+    OGLP_ENTRY (GetProgramResourceIndex) = table->GetProgramResourceIndex;
+    OGLP_ENTRY (GetProgramResourceName) = table->GetProgramResourceName;
+    OGLP_ENTRY (GetProgramResourceiv) = table->GetProgramResourceiv;
+    OGLP_ENTRY (GetProgramResourceLocation) = table->GetProgramResourceLocation;
+    OGLP_ENTRY (GetProgramResourceLocationIndex) = table->GetProgramResourceLocationIndex;
+    OGLP_ENTRY (ShaderStorageBlockBinding) = table->ShaderStorageBlockBinding;
+    OGLP_ENTRY (TexBufferRange) = table->TexBufferRange;
+    OGLP_ENTRY (TexStorage2DMultisample) = table->TexStorage2DMultisample;
+    OGLP_ENTRY (TexStorage3DMultisample) = table->TexStorage3DMultisample;
+    OGLP_ENTRY (TextureView) = table->TextureView;
+    OGLP_ENTRY (BindVertexBuffer) = table->BindVertexBuffer;
+    OGLP_ENTRY (VertexAttribFormat) = table->VertexAttribFormat;
+    OGLP_ENTRY (VertexAttribIFormat) = table->VertexAttribIFormat;
+    OGLP_ENTRY (VertexAttribLFormat) = table->VertexAttribLFormat;
+    OGLP_ENTRY (VertexAttribBinding) = table->VertexAttribBinding;
+    OGLP_ENTRY (VertexBindingDivisor) = table->VertexBindingDivisor;
+    OGLP_ENTRY (DebugMessageControl) = table->DebugMessageControl;
+    OGLP_ENTRY (DebugMessageInsert) = table->DebugMessageInsert;
+    OGLP_ENTRY (DebugMessageCallback) = table->DebugMessageCallback;
+    OGLP_ENTRY (GetDebugMessageLog) = table->GetDebugMessageLog;
+    OGLP_ENTRY (PushDebugGroup) = table->PushDebugGroup;
+    OGLP_ENTRY (PopDebugGroup) = table->PopDebugGroup;
+    OGLP_ENTRY (ObjectLabel) = table->ObjectLabel;
+    OGLP_ENTRY (GetObjectLabel) = table->GetObjectLabel;
+    OGLP_ENTRY (ObjectPtrLabel) = table->ObjectPtrLabel;
+    OGLP_ENTRY (GetObjectPtrLabel) = table->GetObjectPtrLabel;
+    OGLP_ENTRY (BufferStorage) = table->BufferStorage;
+    OGLP_ENTRY (ClearTexImage) = table->ClearTexImage;
+    OGLP_ENTRY (ClearTexSubImage) = table->ClearTexSubImage;
+    OGLP_ENTRY (BindBuffersBase) = table->BindBuffersBase;
+    OGLP_ENTRY (BindBuffersRange) = table->BindBuffersRange;
+    OGLP_ENTRY (BindTextures) = table->BindTextures;
+    OGLP_ENTRY (BindSamplers) = table->BindSamplers;
+    OGLP_ENTRY (BindImageTextures) = table->BindImageTextures;
+    OGLP_ENTRY (BindVertexBuffers) = table->BindVertexBuffers;
+    OGLP_ENTRY (ClipControl) = table->ClipControl;
+    OGLP_ENTRY (CreateTransformFeedbacks) = table->CreateTransformFeedbacks;
+    OGLP_ENTRY (TransformFeedbackBufferBase) = table->TransformFeedbackBufferBase;
+    OGLP_ENTRY (TransformFeedbackBufferRange) = table->TransformFeedbackBufferRange;
+    OGLP_ENTRY (GetTransformFeedbackiv) = table->GetTransformFeedbackiv;
+    OGLP_ENTRY (GetTransformFeedbacki_v) = table->GetTransformFeedbacki_v;
+    OGLP_ENTRY (GetTransformFeedbacki64_v) = table->GetTransformFeedbacki64_v;
+    OGLP_ENTRY (CreateBuffers) = table->CreateBuffers;
+    OGLP_ENTRY (NamedBufferStorage) = table->NamedBufferStorage;
+    OGLP_ENTRY (NamedBufferData) = table->NamedBufferData;
+    OGLP_ENTRY (NamedBufferSubData) = table->NamedBufferSubData;
+    OGLP_ENTRY (CopyNamedBufferSubData) = table->CopyNamedBufferSubData;
+    OGLP_ENTRY (ClearNamedBufferData) = table->ClearNamedBufferData;
+    OGLP_ENTRY (ClearNamedBufferSubData) = table->ClearNamedBufferSubData;
+    OGLP_ENTRY (MapNamedBuffer) = table->MapNamedBuffer;
+    OGLP_ENTRY (MapNamedBufferRange) = table->MapNamedBufferRange;
+    OGLP_ENTRY (UnmapNamedBuffer) = table->UnmapNamedBuffer;
+    OGLP_ENTRY (FlushMappedNamedBufferRange) = table->FlushMappedNamedBufferRange;
+    OGLP_ENTRY (GetNamedBufferParameteriv) = table->GetNamedBufferParameteriv;
+    OGLP_ENTRY (GetNamedBufferParameteri64v) = table->GetNamedBufferParameteri64v;
+    OGLP_ENTRY (GetNamedBufferPointerv) = table->GetNamedBufferPointerv;
+    OGLP_ENTRY (GetNamedBufferSubData) = table->GetNamedBufferSubData;
+    OGLP_ENTRY (CreateFramebuffers) = table->CreateFramebuffers;
+    OGLP_ENTRY (NamedFramebufferRenderbuffer) = table->NamedFramebufferRenderbuffer;
+    OGLP_ENTRY (NamedFramebufferParameteri) = table->NamedFramebufferParameteri;
+    OGLP_ENTRY (NamedFramebufferTexture) = table->NamedFramebufferTexture;
+    OGLP_ENTRY (NamedFramebufferTextureLayer) = table->NamedFramebufferTextureLayer;
+    OGLP_ENTRY (NamedFramebufferDrawBuffer) = table->NamedFramebufferDrawBuffer;
+    OGLP_ENTRY (NamedFramebufferDrawBuffers) = table->NamedFramebufferDrawBuffers;
+    OGLP_ENTRY (NamedFramebufferReadBuffer) = table->NamedFramebufferReadBuffer;
+    OGLP_ENTRY (InvalidateNamedFramebufferData) = table->InvalidateNamedFramebufferData;
+    OGLP_ENTRY (InvalidateNamedFramebufferSubData) = table->InvalidateNamedFramebufferSubData;
+    OGLP_ENTRY (ClearNamedFramebufferiv) = table->ClearNamedFramebufferiv;
+    OGLP_ENTRY (ClearNamedFramebufferuiv) = table->ClearNamedFramebufferuiv;
+    OGLP_ENTRY (ClearNamedFramebufferfv) = table->ClearNamedFramebufferfv;
+    OGLP_ENTRY (ClearNamedFramebufferfi) = table->ClearNamedFramebufferfi;
+    OGLP_ENTRY (BlitNamedFramebuffer) = table->BlitNamedFramebuffer;
+    OGLP_ENTRY (CheckNamedFramebufferStatus) = table->CheckNamedFramebufferStatus;
+    OGLP_ENTRY (GetNamedFramebufferParameteriv) = table->GetNamedFramebufferParameteriv;
+    OGLP_ENTRY (GetNamedFramebufferAttachmentParameteriv) = table->GetNamedFramebufferAttachmentParameteriv;
+    OGLP_ENTRY (CreateRenderbuffers) = table->CreateRenderbuffers;
+    OGLP_ENTRY (NamedRenderbufferStorage) = table->NamedRenderbufferStorage;
+    OGLP_ENTRY (NamedRenderbufferStorageMultisample) = table->NamedRenderbufferStorageMultisample;
+    OGLP_ENTRY (GetNamedRenderbufferParameteriv) = table->GetNamedRenderbufferParameteriv;
+    OGLP_ENTRY (CreateTextures) = table->CreateTextures;
+    OGLP_ENTRY (TextureBuffer) = table->TextureBuffer;
+    OGLP_ENTRY (TextureBufferRange) = table->TextureBufferRange;
+    OGLP_ENTRY (TextureStorage1D) = table->TextureStorage1D;
+    OGLP_ENTRY (TextureStorage2D) = table->TextureStorage2D;
+    OGLP_ENTRY (TextureStorage3D) = table->TextureStorage3D;
+    OGLP_ENTRY (TextureStorage2DMultisample) = table->TextureStorage2DMultisample;
+    OGLP_ENTRY (TextureStorage3DMultisample) = table->TextureStorage3DMultisample;
+    OGLP_ENTRY (TextureSubImage1D) = table->TextureSubImage1D;
+    OGLP_ENTRY (TextureSubImage2D) = table->TextureSubImage2D;
+    OGLP_ENTRY (TextureSubImage3D) = table->TextureSubImage3D;
+    OGLP_ENTRY (CompressedTextureSubImage1D) = table->CompressedTextureSubImage1D;
+    OGLP_ENTRY (CompressedTextureSubImage2D) = table->CompressedTextureSubImage2D;
+    OGLP_ENTRY (CompressedTextureSubImage3D) = table->CompressedTextureSubImage3D;
+    OGLP_ENTRY (CopyTextureSubImage1D) = table->CopyTextureSubImage1D;
+    OGLP_ENTRY (CopyTextureSubImage2D) = table->CopyTextureSubImage2D;
+    OGLP_ENTRY (CopyTextureSubImage3D) = table->CopyTextureSubImage3D;
+    OGLP_ENTRY (TextureParameterf) = table->TextureParameterf;
+    OGLP_ENTRY (TextureParameterfv) = table->TextureParameterfv;
+    OGLP_ENTRY (TextureParameteri) = table->TextureParameteri;
+    OGLP_ENTRY (TextureParameterIiv) = table->TextureParameterIiv;
+    OGLP_ENTRY (TextureParameterIuiv) = table->TextureParameterIuiv;
+    OGLP_ENTRY (TextureParameteriv) = table->TextureParameteriv;
+    OGLP_ENTRY (GenerateTextureMipmap) = table->GenerateTextureMipmap;
+    OGLP_ENTRY (BindTextureUnit) = table->BindTextureUnit;
+    OGLP_ENTRY (GetTextureImage) = table->GetTextureImage;
+    OGLP_ENTRY (GetCompressedTextureImage) = table->GetCompressedTextureImage;
+    OGLP_ENTRY (GetTextureLevelParameterfv) = table->GetTextureLevelParameterfv;
+    OGLP_ENTRY (GetTextureLevelParameteriv) = table->GetTextureLevelParameteriv;
+    OGLP_ENTRY (GetTextureParameterfv) = table->GetTextureParameterfv;
+    OGLP_ENTRY (GetTextureParameterIiv) = table->GetTextureParameterIiv;
+    OGLP_ENTRY (GetTextureParameterIuiv) = table->GetTextureParameterIuiv;
+    OGLP_ENTRY (GetTextureParameteriv) = table->GetTextureParameteriv;
+    OGLP_ENTRY (CreateVertexArrays) = table->CreateVertexArrays;
+    OGLP_ENTRY (DisableVertexArrayAttrib) = table->DisableVertexArrayAttrib;
+    OGLP_ENTRY (EnableVertexArrayAttrib) = table->EnableVertexArrayAttrib;
+    OGLP_ENTRY (VertexArrayElementBuffer) = table->VertexArrayElementBuffer;
+    OGLP_ENTRY (VertexArrayVertexBuffer) = table->VertexArrayVertexBuffer;
+    OGLP_ENTRY (VertexArrayVertexBuffers) = table->VertexArrayVertexBuffers;
+    OGLP_ENTRY (VertexArrayAttribBinding) = table->VertexArrayAttribBinding;
+    OGLP_ENTRY (VertexArrayAttribFormat) = table->VertexArrayAttribFormat;
+    OGLP_ENTRY (VertexArrayAttribIFormat) = table->VertexArrayAttribIFormat;
+    OGLP_ENTRY (VertexArrayAttribLFormat) = table->VertexArrayAttribLFormat;
+    OGLP_ENTRY (VertexArrayBindingDivisor) = table->VertexArrayBindingDivisor;
+    OGLP_ENTRY (GetVertexArrayiv) = table->GetVertexArrayiv;
+    OGLP_ENTRY (GetVertexArrayIndexediv) = table->GetVertexArrayIndexediv;
+    OGLP_ENTRY (GetVertexArrayIndexed64iv) = table->GetVertexArrayIndexed64iv;
+    OGLP_ENTRY (CreateSamplers) = table->CreateSamplers;
+    OGLP_ENTRY (CreateProgramPipelines) = table->CreateProgramPipelines;
+    OGLP_ENTRY (CreateQueries) = table->CreateQueries;
+    OGLP_ENTRY (GetQueryBufferObjecti64v) = table->GetQueryBufferObjecti64v;
+    OGLP_ENTRY (GetQueryBufferObjectiv) = table->GetQueryBufferObjectiv;
+    OGLP_ENTRY (GetQueryBufferObjectui64v) = table->GetQueryBufferObjectui64v;
+    OGLP_ENTRY (GetQueryBufferObjectuiv) = table->GetQueryBufferObjectuiv;
+    OGLP_ENTRY (MemoryBarrierByRegion) = table->MemoryBarrierByRegion;
+    OGLP_ENTRY (GetTextureSubImage) = table->GetTextureSubImage;
+    OGLP_ENTRY (GetCompressedTextureSubImage) = table->GetCompressedTextureSubImage;
+    OGLP_ENTRY (GetGraphicsResetStatus) = table->GetGraphicsResetStatus;
+    OGLP_ENTRY (GetnCompressedTexImage) = table->GetnCompressedTexImage;
+    OGLP_ENTRY (GetnTexImage) = table->GetnTexImage;
+    OGLP_ENTRY (GetnUniformdv) = table->GetnUniformdv;
+    OGLP_ENTRY (GetnUniformfv) = table->GetnUniformfv;
+    OGLP_ENTRY (GetnUniformiv) = table->GetnUniformiv;
+    OGLP_ENTRY (GetnUniformuiv) = table->GetnUniformuiv;
+    OGLP_ENTRY (ReadnPixels) = table->ReadnPixels;
+    OGLP_ENTRY (TextureBarrier) = table->TextureBarrier;
+#endif /* !defined OGLP_DIRECT_LINK */
+    OGLP_ENTRY (GetTextureHandleARB) = table->GetTextureHandleARB;
+    OGLP_ENTRY (GetTextureSamplerHandleARB) = table->GetTextureSamplerHandleARB;
+    OGLP_ENTRY (MakeTextureHandleResidentARB) = table->MakeTextureHandleResidentARB;
+    OGLP_ENTRY (MakeTextureHandleNonResidentARB) = table->MakeTextureHandleNonResidentARB;
+    OGLP_ENTRY (GetImageHandleARB) = table->GetImageHandleARB;
+    OGLP_ENTRY (MakeImageHandleResidentARB) = table->MakeImageHandleResidentARB;
+    OGLP_ENTRY (MakeImageHandleNonResidentARB) = table->MakeImageHandleNonResidentARB;
+    OGLP_ENTRY (UniformHandleui64ARB) = table->UniformHandleui64ARB;
+    OGLP_ENTRY (UniformHandleui64vARB) = table->UniformHandleui64vARB;
+    OGLP_ENTRY (ProgramUniformHandleui64ARB) = table->ProgramUniformHandleui64ARB;
+    OGLP_ENTRY (ProgramUniformHandleui64vARB) = table->ProgramUniformHandleui64vARB;
+    OGLP_ENTRY (IsTextureHandleResidentARB) = table->IsTextureHandleResidentARB;
+    OGLP_ENTRY (IsImageHandleResidentARB) = table->IsImageHandleResidentARB;
+    OGLP_ENTRY (VertexAttribL1ui64ARB) = table->VertexAttribL1ui64ARB;
+    OGLP_ENTRY (VertexAttribL1ui64vARB) = table->VertexAttribL1ui64vARB;
+    OGLP_ENTRY (GetVertexAttribLui64vARB) = table->GetVertexAttribLui64vARB;
+    OGLP_ENTRY (CreateSyncFromCLeventARB) = table->CreateSyncFromCLeventARB;
+    OGLP_ENTRY (DispatchComputeGroupSizeARB) = table->DispatchComputeGroupSizeARB;
+    OGLP_ENTRY (DebugMessageControlARB) = table->DebugMessageControlARB;
+    OGLP_ENTRY (DebugMessageInsertARB) = table->DebugMessageInsertARB;
+    OGLP_ENTRY (DebugMessageCallbackARB) = table->DebugMessageCallbackARB;
+    OGLP_ENTRY (GetDebugMessageLogARB) = table->GetDebugMessageLogARB;
+    OGLP_ENTRY (BlendEquationiARB) = table->BlendEquationiARB;
+    OGLP_ENTRY (BlendEquationSeparateiARB) = table->BlendEquationSeparateiARB;
+    OGLP_ENTRY (BlendFunciARB) = table->BlendFunciARB;
+    OGLP_ENTRY (BlendFuncSeparateiARB) = table->BlendFuncSeparateiARB;
+    OGLP_ENTRY (MultiDrawArraysIndirectCountARB) = table->MultiDrawArraysIndirectCountARB;
+    OGLP_ENTRY (MultiDrawElementsIndirectCountARB) = table->MultiDrawElementsIndirectCountARB;
+    OGLP_ENTRY (GetGraphicsResetStatusARB) = table->GetGraphicsResetStatusARB;
+    OGLP_ENTRY (GetnTexImageARB) = table->GetnTexImageARB;
+    OGLP_ENTRY (ReadnPixelsARB) = table->ReadnPixelsARB;
+    OGLP_ENTRY (GetnCompressedTexImageARB) = table->GetnCompressedTexImageARB;
+    OGLP_ENTRY (GetnUniformfvARB) = table->GetnUniformfvARB;
+    OGLP_ENTRY (GetnUniformivARB) = table->GetnUniformivARB;
+    OGLP_ENTRY (GetnUniformuivARB) = table->GetnUniformuivARB;
+    OGLP_ENTRY (GetnUniformdvARB) = table->GetnUniformdvARB;
+    OGLP_ENTRY (MinSampleShadingARB) = table->MinSampleShadingARB;
+    OGLP_ENTRY (NamedStringARB) = table->NamedStringARB;
+    OGLP_ENTRY (DeleteNamedStringARB) = table->DeleteNamedStringARB;
+    OGLP_ENTRY (CompileShaderIncludeARB) = table->CompileShaderIncludeARB;
+    OGLP_ENTRY (IsNamedStringARB) = table->IsNamedStringARB;
+    OGLP_ENTRY (GetNamedStringARB) = table->GetNamedStringARB;
+    OGLP_ENTRY (GetNamedStringivARB) = table->GetNamedStringivARB;
+    OGLP_ENTRY (BufferPageCommitmentARB) = table->BufferPageCommitmentARB;
+    OGLP_ENTRY (NamedBufferPageCommitmentEXT) = table->NamedBufferPageCommitmentEXT;
+    OGLP_ENTRY (NamedBufferPageCommitmentARB) = table->NamedBufferPageCommitmentARB;
+    OGLP_ENTRY (TexPageCommitmentARB) = table->TexPageCommitmentARB;
+    OGLP_ENTRY (GetMultisamplefvNV) = table->GetMultisamplefvNV;
+    OGLP_ENTRY (SampleMaskIndexedNV) = table->SampleMaskIndexedNV;
+    OGLP_ENTRY (TexRenderbufferNV) = table->TexRenderbufferNV;
+    OGLP_ENTRY (MakeBufferResidentNV) = table->MakeBufferResidentNV;
+    OGLP_ENTRY (MakeBufferNonResidentNV) = table->MakeBufferNonResidentNV;
+    OGLP_ENTRY (IsBufferResidentNV) = table->IsBufferResidentNV;
+    OGLP_ENTRY (MakeNamedBufferResidentNV) = table->MakeNamedBufferResidentNV;
+    OGLP_ENTRY (MakeNamedBufferNonResidentNV) = table->MakeNamedBufferNonResidentNV;
+    OGLP_ENTRY (IsNamedBufferResidentNV) = table->IsNamedBufferResidentNV;
+    OGLP_ENTRY (GetBufferParameterui64vNV) = table->GetBufferParameterui64vNV;
+    OGLP_ENTRY (GetNamedBufferParameterui64vNV) = table->GetNamedBufferParameterui64vNV;
+    OGLP_ENTRY (GetIntegerui64vNV) = table->GetIntegerui64vNV;
+    OGLP_ENTRY (Uniformui64NV) = table->Uniformui64NV;
+    OGLP_ENTRY (Uniformui64vNV) = table->Uniformui64vNV;
+    OGLP_ENTRY (ProgramUniformui64NV) = table->ProgramUniformui64NV;
+    OGLP_ENTRY (ProgramUniformui64vNV) = table->ProgramUniformui64vNV;
+    OGLP_ENTRY (BufferAddressRangeNV) = table->BufferAddressRangeNV;
+    OGLP_ENTRY (VertexFormatNV) = table->VertexFormatNV;
+    OGLP_ENTRY (NormalFormatNV) = table->NormalFormatNV;
+    OGLP_ENTRY (ColorFormatNV) = table->ColorFormatNV;
+    OGLP_ENTRY (IndexFormatNV) = table->IndexFormatNV;
+    OGLP_ENTRY (TexCoordFormatNV) = table->TexCoordFormatNV;
+    OGLP_ENTRY (EdgeFlagFormatNV) = table->EdgeFlagFormatNV;
+    OGLP_ENTRY (SecondaryColorFormatNV) = table->SecondaryColorFormatNV;
+    OGLP_ENTRY (FogCoordFormatNV) = table->FogCoordFormatNV;
+    OGLP_ENTRY (VertexAttribFormatNV) = table->VertexAttribFormatNV;
+    OGLP_ENTRY (VertexAttribIFormatNV) = table->VertexAttribIFormatNV;
+    OGLP_ENTRY (GetIntegerui64i_vNV) = table->GetIntegerui64i_vNV;
+    OGLP_ENTRY (EnableClientState) = table->EnableClientState;
+    OGLP_ENTRY (DisableClientState) = table->DisableClientState;
 }
 
+#undef OGLP_ENTRY
+#undef OGLP_GETPROCADDRESS
+
 } /* namespace oglp */
@@ -0,0 +1,5868 @@
+/*
+ * Copyright (c) 2014 Daniel Kirchner
+ *
+ * Copying and distribution of this file, with or without modification,
+ * are permitted in any medium without royalty provided the copyright
+ * notice and this notice are preserved.  This file is offered as-is,
+ * without any warranty. 
+ */
+/* This file was generated by glcorew_gen.py.
+ * Don't change it directly, change glcorew_gen.py instead.*/
+#include <oglp/instrument.h>
+
+#ifdef OGLP_INSTRUMENT
+
+namespace oglp {
+namespace internal {
+
+const char *const InstrumentProcNames[NumProcs] = {
+    "glCullFace",
+    "glFrontFace",
+    "glHint",
+    "glLineWidth",
+    "glPointSize",
+    "glPolygonMode",
+    "glScissor",
+    "glTexParameterf",
+    "glTexParameterfv",
+    "glTexParameteri",
+    "glTexParameteriv",
+    "glTexImage1D",
+    "glTexImage2D",
+    "glDrawBuffer",
+    "glClear",
+    "glClearColor",
+    "glClearStencil",
+    "glClearDepth",
+    "glStencilMask",
+    "glColorMask",
+    "glDepthMask",
+    "glDisable",
+    "glEnable",
+    "glFinish",
+    "glFlush",
+    "glBlendFunc",
+    "glLogicOp",
+    "glStencilFunc",
+    "glStencilOp",
+    "glDepthFunc",
+    "glPixelStoref",
+    "glPixelStorei",
+    "glReadBuffer",
+    "glReadPixels",
+    "glGetBooleanv",
+    "glGetDoublev",
+    "glGetError",
+    "glGetFloatv",
+    "glGetIntegerv",
+    "glGetString",
+    "glGetTexImage",
+    "glGetTexParameterfv",
+    "glGetTexParameteriv",
+    "glGetTexLevelParameterfv",
+    "glGetTexLevelParameteriv",
+    "glIsEnabled",
+    "glDepthRange",
+    "glViewport",
+    "glDrawArrays",
+    "glDrawElements",
+    "glGetPointerv",
+    "glPolygonOffset",
+    "glCopyTexImage1D",
+    "glCopyTexImage2D",
+    "glCopyTexSubImage1D",
+    "glCopyTexSubImage2D",
+    "glTexSubImage1D",
+    "glTexSubImage2D",
+    "glBindTexture",
+    "glDeleteTextures",
+    "glGenTextures",
+    "glIsTexture",
+    "glDrawRangeElements",
+    "glTexImage3D",
+    "glTexSubImage3D",
+    "glCopyTexSubImage3D",
+    "glActiveTexture",
+    "glSampleCoverage",
+    "glCompressedTexImage3D",
+    "glCompressedTexImage2D",
+    "glCompressedTexImage1D",
+    "glCompressedTexSubImage3D",
+    "glCompressedTexSubImage2D",
+    "glCompressedTexSubImage1D",
+    "glGetCompressedTexImage",
+    "glBlendFuncSeparate",
+    "glMultiDrawArrays",
+    "glMultiDrawElements",
+    "glPointParameterf",
+    "glPointParameterfv",
+    "glPointParameteri",
+    "glPointParameteriv",
+    "glBlendColor",
+    "glBlendEquation",
+    "glGenQueries",
+    "glDeleteQueries",
+    "glIsQuery",
+    "glBeginQuery",
+    "glEndQuery",
+    "glGetQueryiv",
+    "glGetQueryObjectiv",
+    "glGetQueryObjectuiv",
+    "glBindBuffer",
+    "glDeleteBuffers",
+    "glGenBuffers",
+    "glIsBuffer",
+    "glBufferData",
+    "glBufferSubData",
+    "glGetBufferSubData",
+    "glMapBuffer",
+    "glUnmapBuffer",
+    "glGetBufferParameteriv",
+    "glGetBufferPointerv",
+    "glBlendEquationSeparate",
+    "glDrawBuffers",
+    "glStencilOpSeparate",
+    "glStencilFuncSeparate",
+    "glStencilMaskSeparate",
+    "glAttachShader",
+    "glBindAttribLocation",
+    "glCompileShader",
+    "glCreateProgram",
+    "glCreateShader",
+    "glDeleteProgram",
+    "glDeleteShader",
+    "glDetachShader",
+    "glDisableVertexAttribArray",
+    "glEnableVertexAttribArray",
+    "glGetActiveAttrib",
+    "glGetActiveUniform",
+    "glGetAttachedShaders",
+    "glGetAttribLocation",
+    "glGetProgramiv",
+    "glGetProgramInfoLog",
+    "glGetShaderiv",
+    "glGetShaderInfoLog",
+    "glGetShaderSource",
+    "glGetUniformLocation",
+    "glGetUniformfv",
+    "glGetUniformiv",
+    "glGetVertexAttribdv",
+    "glGetVertexAttribfv",
+    "glGetVertexAttribiv",
+    "glGetVertexAttribPointerv",
+    "glIsProgram",
+    "glIsShader",
+    "glLinkProgram",
+    "glShaderSource",
+    "glUseProgram",
+    "glUniform1f",
+    "glUniform2f",
+    "glUniform3f",
+    "glUniform4f",
+    "glUniform1i",
+    "glUniform2i",
+    "glUniform3i",
+    "glUniform4i",
+    "glUniform1fv",
+    "glUniform2fv",
+    "glUniform3fv",
+    "glUniform4fv",
+    "glUniform1iv",
+    "glUniform2iv",
+    "glUniform3iv",
+    "glUniform4iv",
+    "glUniformMatrix2fv",
+    "glUniformMatrix3fv",
+    "glUniformMatrix4fv",
+    "glValidateProgram",
+    "glVertexAttrib1d",
+    "glVertexAttrib1dv",
+    "glVertexAttrib1f",
+    "glVertexAttrib1fv",
+    "glVertexAttrib1s",
+    "glVertexAttrib1sv",
+    "glVertexAttrib2d",
+    "glVertexAttrib2dv",
+    "glVertexAttrib2f",
+    "glVertexAttrib2fv",
+    "glVertexAttrib2s",
+    "glVertexAttrib2sv",
+    "glVertexAttrib3d",
+    "glVertexAttrib3dv",
+    "glVertexAttrib3f",
+    "glVertexAttrib3fv",
+    "glVertexAttrib3s",
+    "glVertexAttrib3sv",
+    "glVertexAttrib4Nbv",
+    "glVertexAttrib4Niv",
+    "glVertexAttrib4Nsv",
+    "glVertexAttrib4Nub",
+    "glVertexAttrib4Nubv",
+    "glVertexAttrib4Nuiv",
+    "glVertexAttrib4Nusv",
+    "glVertexAttrib4bv",
+    "glVertexAttrib4d",
+    "glVertexAttrib4dv",
+    "glVertexAttrib4f",
+    "glVertexAttrib4fv",
+    "glVertexAttrib4iv",
+    "glVertexAttrib4s",
+    "glVertexAttrib4sv",
+    "glVertexAttrib4ubv",
+    "glVertexAttrib4uiv",
+    "glVertexAttrib4usv",
+    "glVertexAttribPointer",
+    "glUniformMatrix2x3fv",
+    "glUniformMatrix3x2fv",
+    "glUniformMatrix2x4fv",
+    "glUniformMatrix4x2fv",
+    "glUniformMatrix3x4fv",
+    "glUniformMatrix4x3fv",
+    "glColorMaski",
+    "glGetBooleani_v",
+    "glGetIntegeri_v",
+    "glEnablei",
+    "glDisablei",
+    "glIsEnabledi",
+    "glBeginTransformFeedback",
+    "glEndTransformFeedback",
+    "glBindBufferRange",
+    "glBindBufferBase",
+    "glTransformFeedbackVaryings",
+    "glGetTransformFeedbackVarying",
+    "glClampColor",
+    "glBeginConditionalRender",
+    "glEndConditionalRender",
+    "glVertexAttribIPointer",
+    "glGetVertexAttribIiv",
+    "glGetVertexAttribIuiv",
+    "glVertexAttribI1i",
+    "glVertexAttribI2i",
+    "glVertexAttribI3i",
+    "glVertexAttribI4i",
+    "glVertexAttribI1ui",
+    "glVertexAttribI2ui",
+    "glVertexAttribI3ui",
+    "glVertexAttribI4ui",
+    "glVertexAttribI1iv",
+    "glVertexAttribI2iv",
+    "glVertexAttribI3iv",
+    "glVertexAttribI4iv",
+    "glVertexAttribI1uiv",
+    "glVertexAttribI2uiv",
+    "glVertexAttribI3uiv",
+    "glVertexAttribI4uiv",
+    "glVertexAttribI4bv",
+    "glVertexAttribI4sv",
+    "glVertexAttribI4ubv",
+    "glVertexAttribI4usv",
+    "glGetUniformuiv",
+    "glBindFragDataLocation",
+    "glGetFragDataLocation",
+    "glUniform1ui",
+    "glUniform2ui",
+    "glUniform3ui",
+    "glUniform4ui",
+    "glUniform1uiv",
+    "glUniform2uiv",
+    "glUniform3uiv",
+    "glUniform4uiv",
+    "glTexParameterIiv",
+    "glTexParameterIuiv",
+    "glGetTexParameterIiv",
+    "glGetTexParameterIuiv",
+    "glClearBufferiv",
+    "glClearBufferuiv",
+    "glClearBufferfv",
+    "glClearBufferfi",
+    "glGetStringi",
+    "glIsRenderbuffer",
+    "glBindRenderbuffer",
+    "glDeleteRenderbuffers",
+    "glGenRenderbuffers",
+    "glRenderbufferStorage",
+    "glGetRenderbufferParameteriv",
+    "glIsFramebuffer",
+    "glBindFramebuffer",
+    "glDeleteFramebuffers",
+    "glGenFramebuffers",
+    "glCheckFramebufferStatus",
+    "glFramebufferTexture1D",
+    "glFramebufferTexture2D",
+    "glFramebufferTexture3D",
+    "glFramebufferRenderbuffer",
+    "glGetFramebufferAttachmentParameteriv",
+    "glGenerateMipmap",
+    "glBlitFramebuffer",
+    "glRenderbufferStorageMultisample",
+    "glFramebufferTextureLayer",
+    "glMapBufferRange",
+    "glFlushMappedBufferRange",
+    "glBindVertexArray",
+    "glDeleteVertexArrays",
+    "glGenVertexArrays",
+    "glIsVertexArray",
+    "glDrawArraysInstanced",
+    "glDrawElementsInstanced",
+    "glTexBuffer",
+    "glPrimitiveRestartIndex",
+    "glCopyBufferSubData",
+    "glGetUniformIndices",
+    "glGetActiveUniformsiv",
+    "glGetActiveUniformName",
+    "glGetUniformBlockIndex",
+    "glGetActiveUniformBlockiv",
+    "glGetActiveUniformBlockName",
+    "glUniformBlockBinding",
+    "glDrawElementsBaseVertex",
+    "glDrawRangeElementsBaseVertex",
+    "glDrawElementsInstancedBaseVertex",
+    "glMultiDrawElementsBaseVertex",
+    "glProvokingVertex",
+    "glFenceSync",
+    "glIsSync",
+    "glDeleteSync",
+    "glClientWaitSync",
+    "glWaitSync",
+    "glGetInteger64v",
+    "glGetSynciv",
+    "glGetInteger64i_v",
+    "glGetBufferParameteri64v",
+    "glFramebufferTexture",
+    "glTexImage2DMultisample",
+    "glTexImage3DMultisample",
+    "glGetMultisamplefv",
+    "glSampleMaski",
+    "glBindFragDataLocationIndexed",
+    "glGetFragDataIndex",
+    "glGenSamplers",
+    "glDeleteSamplers",
+    "glIsSampler",
+    "glBindSampler",
+    "glSamplerParameteri",
+    "glSamplerParameteriv",
+    "glSamplerParameterf",
+    "glSamplerParameterfv",
+    "glSamplerParameterIiv",
+    "glSamplerParameterIuiv",
+    "glGetSamplerParameteriv",
+    "glGetSamplerParameterIiv",
+    "glGetSamplerParameterfv",
+    "glGetSamplerParameterIuiv",
+    "glQueryCounter",
+    "glGetQueryObjecti64v",
+    "glGetQueryObjectui64v",
+    "glVertexAttribDivisor",
+    "glVertexAttribP1ui",
+    "glVertexAttribP1uiv",
+    "glVertexAttribP2ui",
+    "glVertexAttribP2uiv",
+    "glVertexAttribP3ui",
+    "glVertexAttribP3uiv",
+    "glVertexAttribP4ui",
+    "glVertexAttribP4uiv",
+    "glMinSampleShading",
+    "glBlendEquationi",
+    "glBlendEquationSeparatei",
+    "glBlendFunci",
+    "glBlendFuncSeparatei",
+    "glDrawArraysIndirect",
+    "glDrawElementsIndirect",
+    "glUniform1d",
+    "glUniform2d",
+    "glUniform3d",
+    "glUniform4d",
+    "glUniform1dv",
+    "glUniform2dv",
+    "glUniform3dv",
+    "glUniform4dv",
+    "glUniformMatrix2dv",
+    "glUniformMatrix3dv",
+    "glUniformMatrix4dv",
+    "glUniformMatrix2x3dv",
+    "glUniformMatrix2x4dv",
+    "glUniformMatrix3x2dv",
+    "glUniformMatrix3x4dv",
+    "glUniformMatrix4x2dv",
+    "glUniformMatrix4x3dv",
+    "glGetUniformdv",
+    "glGetSubroutineUniformLocation",
+    "glGetSubroutineIndex",
+    "glGetActiveSubroutineUniformiv",
+    "glGetActiveSubroutineUniformName",
+    "glGetActiveSubroutineName",
+    "glUniformSubroutinesuiv",
+    "glGetUniformSubroutineuiv",
+    "glGetProgramStageiv",
+    "glPatchParameteri",
+    "glPatchParameterfv",
+    "glBindTransformFeedback",
+    "glDeleteTransformFeedbacks",
+    "glGenTransformFeedbacks",
+    "glIsTransformFeedback",
+    "glPauseTransformFeedback",
+    "glResumeTransformFeedback",
+    "glDrawTransformFeedback",
+    "glDrawTransformFeedbackStream",
+    "glBeginQueryIndexed",
+    "glEndQueryIndexed",
+    "glGetQueryIndexediv",
+    "glReleaseShaderCompiler",
+    "glShaderBinary",
+    "glGetShaderPrecisionFormat",
+    "glDepthRangef",
+    "glClearDepthf",
+    "glGetProgramBinary",
+    "glProgramBinary",
+    "glProgramParameteri",
+    "glUseProgramStages",
+    "glActiveShaderProgram",
+    "glCreateShaderProgramv",
+    "glBindProgramPipeline",
+    "glDeleteProgramPipelines",
+    "glGenProgramPipelines",
+    "glIsProgramPipeline",
+    "glGetProgramPipelineiv",
+    "glProgramUniform1i",
+    "glProgramUniform1iv",
+    "glProgramUniform1f",
+    "glProgramUniform1fv",
+    "glProgramUniform1d",
+    "glProgramUniform1dv",
+    "glProgramUniform1ui",
+    "glProgramUniform1uiv",
+    "glProgramUniform2i",
+    "glProgramUniform2iv",
+    "glProgramUniform2f",
+    "glProgramUniform2fv",
+    "glProgramUniform2d",
+    "glProgramUniform2dv",
+    "glProgramUniform2ui",
+    "glProgramUniform2uiv",
+    "glProgramUniform3i",
+    "glProgramUniform3iv",
+    "glProgramUniform3f",
+    "glProgramUniform3fv",
+    "glProgramUniform3d",
+    "glProgramUniform3dv",
+    "glProgramUniform3ui",
+    "glProgramUniform3uiv",
+    "glProgramUniform4i",
+    "glProgramUniform4iv",
+    "glProgramUniform4f",
+    "glProgramUniform4fv",
+    "glProgramUniform4d",
+    "glProgramUniform4dv",
+    "glProgramUniform4ui",
+    "glProgramUniform4uiv",
+    "glProgramUniformMatrix2fv",
+    "glProgramUniformMatrix3fv",
+    "glProgramUniformMatrix4fv",
+    "glProgramUniformMatrix2dv",
+    "glProgramUniformMatrix3dv",
+    "glProgramUniformMatrix4dv",
+    "glProgramUniformMatrix2x3fv",
+    "glProgramUniformMatrix3x2fv",
+    "glProgramUniformMatrix2x4fv",
+    "glProgramUniformMatrix4x2fv",
+    "glProgramUniformMatrix3x4fv",
+    "glProgramUniformMatrix4x3fv",
+    "glProgramUniformMatrix2x3dv",
+    "glProgramUniformMatrix3x2dv",
+    "glProgramUniformMatrix2x4dv",
+    "glProgramUniformMatrix4x2dv",
+    "glProgramUniformMatrix3x4dv",
+    "glProgramUniformMatrix4x3dv",
+    "glValidateProgramPipeline",
+    "glGetProgramPipelineInfoLog",
+    "glVertexAttribL1d",
+    "glVertexAttribL2d",
+    "glVertexAttribL3d",
+    "glVertexAttribL4d",
+    "glVertexAttribL1dv",
+    "glVertexAttribL2dv",
+    "glVertexAttribL3dv",
+    "glVertexAttribL4dv",
+    "glVertexAttribLPointer",
+    "glGetVertexAttribLdv",
+    "glViewportArrayv",
+    "glViewportIndexedf",
+    "glViewportIndexedfv",
+    "glScissorArrayv",
+    "glScissorIndexed",
+    "glScissorIndexedv",
+    "glDepthRangeArrayv",
+    "glDepthRangeIndexed",
+    "glGetFloati_v",
+    "glGetDoublei_v",
+    "glDrawArraysInstancedBaseInstance",
+    "glDrawElementsInstancedBaseInstance",
+    "glDrawElementsInstancedBaseVertexBaseInstance",
+    "glGetInternalformativ",
+    "glGetActiveAtomicCounterBufferiv",
+    "glBindImageTexture",
+    "glMemoryBarrier",
+    "glTexStorage1D",
+    "glTexStorage2D",
+    "glTexStorage3D",
+    "glDrawTransformFeedbackInstanced",
+    "glDrawTransformFeedbackStreamInstanced",
+    "glClearBufferData",
+    "glClearBufferSubData",
+    "glDispatchCompute",
+    "glDispatchComputeIndirect",
+    "glCopyImageSubData",
+    "glFramebufferParameteri",
+    "glGetFramebufferParameteriv",
+    "glGetInternalformati64v",
+    "glInvalidateTexSubImage",
+    "glInvalidateTexImage",
+    "glInvalidateBufferSubData",
+    "glInvalidateBufferData",
+    "glInvalidateFramebuffer",
+    "glInvalidateSubFramebuffer",
+    "glMultiDrawArraysIndirect",
+    "glMultiDrawElementsIndirect",
+    "glGetProgramInterfaceiv",
+    "glGetProgramResourceIndex",
+    "glGetProgramResourceName",
+    "glGetProgramResourceiv",
+    "glGetProgramResourceLocation",
+    "glGetProgramResourceLocationIndex",
+    "glShaderStorageBlockBinding",
+    "glTexBufferRange",
+    "glTexStorage2DMultisample",
+    "glTexStorage3DMultisample",
+    "glTextureView",
+    "glBindVertexBuffer",
+    "glVertexAttribFormat",
+    "glVertexAttribIFormat",
+    "glVertexAttribLFormat",
+    "glVertexAttribBinding",
+    "glVertexBindingDivisor",
+    "glDebugMessageControl",
+    "glDebugMessageInsert",
+    "glDebugMessageCallback",
+    "glGetDebugMessageLog",
+    "glPushDebugGroup",
+    "glPopDebugGroup",
+    "glObjectLabel",
+    "glGetObjectLabel",
+    "glObjectPtrLabel",
+    "glGetObjectPtrLabel",
+    "glBufferStorage",
+    "glClearTexImage",
+    "glClearTexSubImage",
+    "glBindBuffersBase",
+    "glBindBuffersRange",
+    "glBindTextures",
+    "glBindSamplers",
+    "glBindImageTextures",
+    "glBindVertexBuffers",
+    "glClipControl",
+    "glCreateTransformFeedbacks",
+    "glTransformFeedbackBufferBase",
+    "glTransformFeedbackBufferRange",
+    "glGetTransformFeedbackiv",
+    "glGetTransformFeedbacki_v",
+    "glGetTransformFeedbacki64_v",
+    "glCreateBuffers",
+    "glNamedBufferStorage",
+    "glNamedBufferData",
+    "glNamedBufferSubData",
+    "glCopyNamedBufferSubData",
+    "glClearNamedBufferData",
+    "glClearNamedBufferSubData",
+    "glMapNamedBuffer",
+    "glMapNamedBufferRange",
+    "glUnmapNamedBuffer",
+    "glFlushMappedNamedBufferRange",
+    "glGetNamedBufferParameteriv",
+    "glGetNamedBufferParameteri64v",
+    "glGetNamedBufferPointerv",
+    "glGetNamedBufferSubData",
+    "glCreateFramebuffers",
+    "glNamedFramebufferRenderbuffer",
+    "glNamedFramebufferParameteri",
+    "glNamedFramebufferTexture",
+    "glNamedFramebufferTextureLayer",
+    "glNamedFramebufferDrawBuffer",
+    "glNamedFramebufferDrawBuffers",
+    "glNamedFramebufferReadBuffer",
+    "glInvalidateNamedFramebufferData",
+    "glInvalidateNamedFramebufferSubData",
+    "glClearNamedFramebufferiv",
+    "glClearNamedFramebufferuiv",
+    "glClearNamedFramebufferfv",
+    "glClearNamedFramebufferfi",
+    "glBlitNamedFramebuffer",
+    "glCheckNamedFramebufferStatus",
+    "glGetNamedFramebufferParameteriv",
+    "glGetNamedFramebufferAttachmentParameteriv",
+    "glCreateRenderbuffers",
+    "glNamedRenderbufferStorage",
+    "glNamedRenderbufferStorageMultisample",
+    "glGetNamedRenderbufferParameteriv",
+    "glCreateTextures",
+    "glTextureBuffer",
+    "glTextureBufferRange",
+    "glTextureStorage1D",
+    "glTextureStorage2D",
+    "glTextureStorage3D",
+    "glTextureStorage2DMultisample",
+    "glTextureStorage3DMultisample",
+    "glTextureSubImage1D",
+    "glTextureSubImage2D",
+    "glTextureSubImage3D",
+    "glCompressedTextureSubImage1D",
+    "glCompressedTextureSubImage2D",
+    "glCompressedTextureSubImage3D",
+    "glCopyTextureSubImage1D",
+    "glCopyTextureSubImage2D",
+    "glCopyTextureSubImage3D",
+    "glTextureParameterf",
+    "glTextureParameterfv",
+    "glTextureParameteri",
+    "glTextureParameterIiv",
+    "glTextureParameterIuiv",
+    "glTextureParameteriv",
+    "glGenerateTextureMipmap",
+    "glBindTextureUnit",
+    "glGetTextureImage",
+    "glGetCompressedTextureImage",
+    "glGetTextureLevelParameterfv",
+    "glGetTextureLevelParameteriv",
+    "glGetTextureParameterfv",
+    "glGetTextureParameterIiv",
+    "glGetTextureParameterIuiv",
+    "glGetTextureParameteriv",
+    "glCreateVertexArrays",
+    "glDisableVertexArrayAttrib",
+    "glEnableVertexArrayAttrib",
+    "glVertexArrayElementBuffer",
+    "glVertexArrayVertexBuffer",
+    "glVertexArrayVertexBuffers",
+    "glVertexArrayAttribBinding",
+    "glVertexArrayAttribFormat",
+    "glVertexArrayAttribIFormat",
+    "glVertexArrayAttribLFormat",
+    "glVertexArrayBindingDivisor",
+    "glGetVertexArrayiv",
+    "glGetVertexArrayIndexediv",
+    "glGetVertexArrayIndexed64iv",
+    "glCreateSamplers",
+    "glCreateProgramPipelines",
+    "glCreateQueries",
+    "glGetQueryBufferObjecti64v",
+    "glGetQueryBufferObjectiv",
+    "glGetQueryBufferObjectui64v",
+    "glGetQueryBufferObjectuiv",
+    "glMemoryBarrierByRegion",
+    "glGetTextureSubImage",
+    "glGetCompressedTextureSubImage",
+    "glGetGraphicsResetStatus",
+    "glGetnCompressedTexImage",
+    "glGetnTexImage",
+    "glGetnUniformdv",
+    "glGetnUniformfv",
+    "glGetnUniformiv",
+    "glGetnUniformuiv",
+    "glReadnPixels",
+    "glTextureBarrier",
+    "glGetTextureHandleARB",
+    "glGetTextureSamplerHandleARB",
+    "glMakeTextureHandleResidentARB",
+    "glMakeTextureHandleNonResidentARB",
+    "glGetImageHandleARB",
+    "glMakeImageHandleResidentARB",
+    "glMakeImageHandleNonResidentARB",
+    "glUniformHandleui64ARB",
+    "glUniformHandleui64vARB",
+    "glProgramUniformHandleui64ARB",
+    "glProgramUniformHandleui64vARB",
+    "glIsTextureHandleResidentARB",
+    "glIsImageHandleResidentARB",
+    "glVertexAttribL1ui64ARB",
+    "glVertexAttribL1ui64vARB",
+    "glGetVertexAttribLui64vARB",
+    "glCreateSyncFromCLeventARB",
+    "glDispatchComputeGroupSizeARB",
+    "glDebugMessageControlARB",
+    "glDebugMessageInsertARB",
+    "glDebugMessageCallbackARB",
+    "glGetDebugMessageLogARB",
+    "glBlendEquationiARB",
+    "glBlendEquationSeparateiARB",
+    "glBlendFunciARB",
+    "glBlendFuncSeparateiARB",
+    "glMultiDrawArraysIndirectCountARB",
+    "glMultiDrawElementsIndirectCountARB",
+    "glGetGraphicsResetStatusARB",
+    "glGetnTexImageARB",
+    "glReadnPixelsARB",
+    "glGetnCompressedTexImageARB",
+    "glGetnUniformfvARB",
+    "glGetnUniformivARB",
+    "glGetnUniformuivARB",
+    "glGetnUniformdvARB",
+    "glMinSampleShadingARB",
+    "glNamedStringARB",
+    "glDeleteNamedStringARB",
+    "glCompileShaderIncludeARB",
+    "glIsNamedStringARB",
+    "glGetNamedStringARB",
+    "glGetNamedStringivARB",
+    "glBufferPageCommitmentARB",
+    "glNamedBufferPageCommitmentEXT",
+    "glNamedBufferPageCommitmentARB",
+    "glTexPageCommitmentARB",
+    "glGetMultisamplefvNV",
+    "glSampleMaskIndexedNV",
+    "glTexRenderbufferNV",
+    "glMakeBufferResidentNV",
+    "glMakeBufferNonResidentNV",
+    "glIsBufferResidentNV",
+    "glMakeNamedBufferResidentNV",
+    "glMakeNamedBufferNonResidentNV",
+    "glIsNamedBufferResidentNV",
+    "glGetBufferParameterui64vNV",
+    "glGetNamedBufferParameterui64vNV",
+    "glGetIntegerui64vNV",
+    "glUniformui64NV",
+    "glUniformui64vNV",
+    "glProgramUniformui64NV",
+    "glProgramUniformui64vNV",
+    "glBufferAddressRangeNV",
+    "glVertexFormatNV",
+    "glNormalFormatNV",
+    "glColorFormatNV",
+    "glIndexFormatNV",
+    "glTexCoordFormatNV",
+    "glEdgeFlagFormatNV",
+    "glSecondaryColorFormatNV",
+    "glFogCoordFormatNV",
+    "glVertexAttribFormatNV",
+    "glVertexAttribIFormatNV",
+    "glGetIntegerui64i_vNV",
+    "glEnableClientState",
+    "glDisableClientState",
+};
+
+static void APIENTRY Instrument_CullFace (GLenum mode)
+{
+    InstrumentScope scope (0);
+    return InstrumentNext ().CullFace (mode);
+}
+
+static void APIENTRY Instrument_FrontFace (GLenum mode)
+{
+    InstrumentScope scope (1);
+    return InstrumentNext ().FrontFace (mode);
+}
+
+static void APIENTRY Instrument_Hint (GLenum target, GLenum mode)
+{
+    InstrumentScope scope (2);
+    return InstrumentNext ().Hint (target, mode);
+}
+
+static void APIENTRY Instrument_LineWidth (GLfloat width)
+{
+    InstrumentScope scope (3);
+    return InstrumentNext ().LineWidth (width);
+}
+
+static void APIENTRY Instrument_PointSize (GLfloat size)
+{
+    InstrumentScope scope (4);
+    return InstrumentNext ().PointSize (size);
+}
+
+static void APIENTRY Instrument_PolygonMode (GLenum face, GLenum mode)
+{
+    InstrumentScope scope (5);
+    return InstrumentNext ().PolygonMode (face, mode);
+}
+
+static void APIENTRY Instrument_Scissor (GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    InstrumentScope scope (6);
+    return InstrumentNext ().Scissor (x, y, width, height);
+}
+
+static void APIENTRY Instrument_TexParameterf (GLenum target, GLenum pname, GLfloat param)
+{
+    InstrumentScope scope (7);
+    return InstrumentNext ().TexParameterf (target, pname, param);
+}
+
+static void APIENTRY Instrument_TexParameterfv (GLenum target, GLenum pname, const GLfloat *params)
+{
+    InstrumentScope scope (8);
+    return InstrumentNext ().TexParameterfv (target, pname, params);
+}
+
+static void APIENTRY Instrument_TexParameteri (GLenum target, GLenum pname, GLint param)
+{
+    InstrumentScope scope (9);
+    return InstrumentNext ().TexParameteri (target, pname, param);
+}
+
+static void APIENTRY Instrument_TexParameteriv (GLenum target, GLenum pname, const GLint *params)
+{
+    InstrumentScope scope (10);
+    return InstrumentNext ().TexParameteriv (target, pname, params);
+}
+
+static void APIENTRY Instrument_TexImage1D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    InstrumentScope scope (11);
+    return InstrumentNext ().TexImage1D (target, level, internalformat, width, border, format, type, pixels);
+}
+
+static void APIENTRY Instrument_TexImage2D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    InstrumentScope scope (12);
+    return InstrumentNext ().TexImage2D (target, level, internalformat, width, height, border, format, type, pixels);
+}
+
+static void APIENTRY Instrument_DrawBuffer (GLenum buf)
+{
+    InstrumentScope scope (13);
+    return InstrumentNext ().DrawBuffer (buf);
+}
+
+static void APIENTRY Instrument_Clear (GLbitfield mask)
+{
+    InstrumentScope scope (14);
+    return InstrumentNext ().Clear (mask);
+}
+
+static void APIENTRY Instrument_ClearColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    InstrumentScope scope (15);
+    return InstrumentNext ().ClearColor (red, green, blue, alpha);
+}
+
+static void APIENTRY Instrument_ClearStencil (GLint s)
+{
+    InstrumentScope scope (16);
+    return InstrumentNext ().ClearStencil (s);
+}
+
+static void APIENTRY Instrument_ClearDepth (GLdouble depth)
+{
+    InstrumentScope scope (17);
+    return InstrumentNext ().ClearDepth (depth);
+}
+
+static void APIENTRY Instrument_StencilMask (GLuint mask)
+{
+    InstrumentScope scope (18);
+    return InstrumentNext ().StencilMask (mask);
+}
+
+static void APIENTRY Instrument_ColorMask (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+    InstrumentScope scope (19);
+    return InstrumentNext ().ColorMask (red, green, blue, alpha);
+}
+
+static void APIENTRY Instrument_DepthMask (GLboolean flag)
+{
+    InstrumentScope scope (20);
+    return InstrumentNext ().DepthMask (flag);
+}
+
+static void APIENTRY Instrument_Disable (GLenum cap)
+{
+    InstrumentScope scope (21);
+    return InstrumentNext ().Disable (cap);
+}
+
+static void APIENTRY Instrument_Enable (GLenum cap)
+{
+    InstrumentScope scope (22);
+    return InstrumentNext ().Enable (cap);
+}
+
+static void APIENTRY Instrument_Finish (void)
+{
+    InstrumentScope scope (23);
+    return InstrumentNext ().Finish ();
+}
+
+static void APIENTRY Instrument_Flush (void)
+{
+    InstrumentScope scope (24);
+    return InstrumentNext ().Flush ();
+}
+
+static void APIENTRY Instrument_BlendFunc (GLenum sfactor, GLenum dfactor)
+{
+    InstrumentScope scope (25);
+    return InstrumentNext ().BlendFunc (sfactor, dfactor);
+}
+
+static void APIENTRY Instrument_LogicOp (GLenum opcode)
+{
+    InstrumentScope scope (26);
+    return InstrumentNext ().LogicOp (opcode);
+}
+
+static void APIENTRY Instrument_StencilFunc (GLenum func, GLint ref, GLuint mask)
+{
+    InstrumentScope scope (27);
+    return InstrumentNext ().StencilFunc (func, ref, mask);
+}
+
+static void APIENTRY Instrument_StencilOp (GLenum fail, GLenum zfail, GLenum zpass)
+{
+    InstrumentScope scope (28);
+    return InstrumentNext ().StencilOp (fail, zfail, zpass);
+}
+
+static void APIENTRY Instrument_DepthFunc (GLenum func)
+{
+    InstrumentScope scope (29);
+    return InstrumentNext ().DepthFunc (func);
+}
+
+static void APIENTRY Instrument_PixelStoref (GLenum pname, GLfloat param)
+{
+    InstrumentScope scope (30);
+    return InstrumentNext ().PixelStoref (pname, param);
+}
+
+static void APIENTRY Instrument_PixelStorei (GLenum pname, GLint param)
+{
+    InstrumentScope scope (31);
+    return InstrumentNext ().PixelStorei (pname, param);
+}
+
+static void APIENTRY Instrument_ReadBuffer (GLenum src)
+{
+    InstrumentScope scope (32);
+    return InstrumentNext ().ReadBuffer (src);
+}
+
+static void APIENTRY Instrument_ReadPixels (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels)
+{
+    InstrumentScope scope (33);
+    return InstrumentNext ().ReadPixels (x, y, width, height, format, type, pixels);
+}
+
+static void APIENTRY Instrument_GetBooleanv (GLenum pname, GLboolean *data)
+{
+    InstrumentScope scope (34);
+    return InstrumentNext ().GetBooleanv (pname, data);
+}
+
+static void APIENTRY Instrument_GetDoublev (GLenum pname, GLdouble *data)
+{
+    InstrumentScope scope (35);
+    return InstrumentNext ().GetDoublev (pname, data);
+}
+
+static GLenum APIENTRY Instrument_GetError (void)
+{
+    InstrumentScope scope (36);
+    return InstrumentNext ().GetError ();
+}
+
+static void APIENTRY Instrument_GetFloatv (GLenum pname, GLfloat *data)
+{
+    InstrumentScope scope (37);
+    return InstrumentNext ().GetFloatv (pname, data);
+}
+
+static void APIENTRY Instrument_GetIntegerv (GLenum pname, GLint *data)
+{
+    InstrumentScope scope (38);
+    return InstrumentNext ().GetIntegerv (pname, data);
+}
+
+static const GLubyte * APIENTRY Instrument_GetString (GLenum name)
+{
+    InstrumentScope scope (39);
+    return InstrumentNext ().GetString (name);
+}
+
+static void APIENTRY Instrument_GetTexImage (GLenum target, GLint level, GLenum format, GLenum type, void *pixels)
+{
+    InstrumentScope scope (40);
+    return InstrumentNext ().GetTexImage (target, level, format, type, pixels);
+}
+
+static void APIENTRY Instrument_GetTexParameterfv (GLenum target, GLenum pname, GLfloat *params)
+{
+    InstrumentScope scope (41);
+    return InstrumentNext ().GetTexParameterfv (target, pname, params);
+}
+
+static void APIENTRY Instrument_GetTexParameteriv (GLenum target, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (42);
+    return InstrumentNext ().GetTexParameteriv (target, pname, params);
+}
+
+static void APIENTRY Instrument_GetTexLevelParameterfv (GLenum target, GLint level, GLenum pname, GLfloat *params)
+{
+    InstrumentScope scope (43);
+    return InstrumentNext ().GetTexLevelParameterfv (target, level, pname, params);
+}
+
+static void APIENTRY Instrument_GetTexLevelParameteriv (GLenum target, GLint level, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (44);
+    return InstrumentNext ().GetTexLevelParameteriv (target, level, pname, params);
+}
+
+static GLboolean APIENTRY Instrument_IsEnabled (GLenum cap)
+{
+    InstrumentScope scope (45);
+    return InstrumentNext ().IsEnabled (cap);
+}
+
+static void APIENTRY Instrument_DepthRange (GLdouble near, GLdouble far)
+{
+    InstrumentScope scope (46);
+    return InstrumentNext ().DepthRange (near, far);
+}
+
+static void APIENTRY Instrument_Viewport (GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    InstrumentScope scope (47);
+    return InstrumentNext ().Viewport (x, y, width, height);
+}
+
+static void APIENTRY Instrument_DrawArrays (GLenum mode, GLint first, GLsizei count)
+{
+    InstrumentScope scope (48);
+    return InstrumentNext ().DrawArrays (mode, first, count);
+}
+
+static void APIENTRY Instrument_DrawElements (GLenum mode, GLsizei count, GLenum type, const void *indices)
+{
+    InstrumentScope scope (49);
+    return InstrumentNext ().DrawElements (mode, count, type, indices);
+}
+
+static void APIENTRY Instrument_GetPointerv (GLenum pname, void **params)
+{
+    InstrumentScope scope (50);
+    return InstrumentNext ().GetPointerv (pname, params);
+}
+
+static void APIENTRY Instrument_PolygonOffset (GLfloat factor, GLfloat units)
+{
+    InstrumentScope scope (51);
+    return InstrumentNext ().PolygonOffset (factor, units);
+}
+
+static void APIENTRY Instrument_CopyTexImage1D (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+{
+    InstrumentScope scope (52);
+    return InstrumentNext ().CopyTexImage1D (target, level, internalformat, x, y, width, border);
+}
+
+static void APIENTRY Instrument_CopyTexImage2D (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+{
+    InstrumentScope scope (53);
+    return InstrumentNext ().CopyTexImage2D (target, level, internalformat, x, y, width, height, border);
+}
+
+static void APIENTRY Instrument_CopyTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+    InstrumentScope scope (54);
+    return InstrumentNext ().CopyTexSubImage1D (target, level, xoffset, x, y, width);
+}
+
+static void APIENTRY Instrument_CopyTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    InstrumentScope scope (55);
+    return InstrumentNext ().CopyTexSubImage2D (target, level, xoffset, yoffset, x, y, width, height);
+}
+
+static void APIENTRY Instrument_TexSubImage1D (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels)
+{
+    InstrumentScope scope (56);
+    return InstrumentNext ().TexSubImage1D (target, level, xoffset, width, format, type, pixels);
+}
+
+static void APIENTRY Instrument_TexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+    InstrumentScope scope (57);
+    return InstrumentNext ().TexSubImage2D (target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+static void APIENTRY Instrument_BindTexture (GLenum target, GLuint texture)
+{
+    InstrumentScope scope (58);
+    return InstrumentNext ().BindTexture (target, texture);
+}
+
+static void APIENTRY Instrument_DeleteTextures (GLsizei n, const GLuint *textures)
+{
+    InstrumentScope scope (59);
+    return InstrumentNext ().DeleteTextures (n, textures);
+}
+
+static void APIENTRY Instrument_GenTextures (GLsizei n, GLuint *textures)
+{
+    InstrumentScope scope (60);
+    return InstrumentNext ().GenTextures (n, textures);
+}
+
+static GLboolean APIENTRY Instrument_IsTexture (GLuint texture)
+{
+    InstrumentScope scope (61);
+    return InstrumentNext ().IsTexture (texture);
+}
+
+static void APIENTRY Instrument_DrawRangeElements (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices)
+{
+    InstrumentScope scope (62);
+    return InstrumentNext ().DrawRangeElements (mode, start, end, count, type, indices);
+}
+
+static void APIENTRY Instrument_TexImage3D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    InstrumentScope scope (63);
+    return InstrumentNext ().TexImage3D (target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+
+static void APIENTRY Instrument_TexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels)
+{
+    InstrumentScope scope (64);
+    return InstrumentNext ().TexSubImage3D (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
+static void APIENTRY Instrument_CopyTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    InstrumentScope scope (65);
+    return InstrumentNext ().CopyTexSubImage3D (target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+static void APIENTRY Instrument_ActiveTexture (GLenum texture)
+{
+    InstrumentScope scope (66);
+    return InstrumentNext ().ActiveTexture (texture);
+}
+
+static void APIENTRY Instrument_SampleCoverage (GLfloat value, GLboolean invert)
+{
+    InstrumentScope scope (67);
+    return InstrumentNext ().SampleCoverage (value, invert);
+}
+
+static void APIENTRY Instrument_CompressedTexImage3D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data)
+{
+    InstrumentScope scope (68);
+    return InstrumentNext ().CompressedTexImage3D (target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+
+static void APIENTRY Instrument_CompressedTexImage2D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data)
+{
+    InstrumentScope scope (69);
+    return InstrumentNext ().CompressedTexImage2D (target, level, internalformat, width, height, border, imageSize, data);
+}
+
+static void APIENTRY Instrument_CompressedTexImage1D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data)
+{
+    InstrumentScope scope (70);
+    return InstrumentNext ().CompressedTexImage1D (target, level, internalformat, width, border, imageSize, data);
+}
+
+static void APIENTRY Instrument_CompressedTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+{
+    InstrumentScope scope (71);
+    return InstrumentNext ().CompressedTexSubImage3D (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+
+static void APIENTRY Instrument_CompressedTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+{
+    InstrumentScope scope (72);
+    return InstrumentNext ().CompressedTexSubImage2D (target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+
+static void APIENTRY Instrument_CompressedTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
+{
+    InstrumentScope scope (73);
+    return InstrumentNext ().CompressedTexSubImage1D (target, level, xoffset, width, format, imageSize, data);
+}
+
+static void APIENTRY Instrument_GetCompressedTexImage (GLenum target, GLint level, void *img)
+{
+    InstrumentScope scope (74);
+    return InstrumentNext ().GetCompressedTexImage (target, level, img);
+}
+
+static void APIENTRY Instrument_BlendFuncSeparate (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+    InstrumentScope scope (75);
+    return InstrumentNext ().BlendFuncSeparate (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+
+static void APIENTRY Instrument_MultiDrawArrays (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount)
+{
+    InstrumentScope scope (76);
+    return InstrumentNext ().MultiDrawArrays (mode, first, count, drawcount);
+}
+
+static void APIENTRY Instrument_MultiDrawElements (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount)
+{
+    InstrumentScope scope (77);
+    return InstrumentNext ().MultiDrawElements (mode, count, type, indices, drawcount);
+}
+
+static void APIENTRY Instrument_PointParameterf (GLenum pname, GLfloat param)
+{
+    InstrumentScope scope (78);
+    return InstrumentNext ().PointParameterf (pname, param);
+}
+
+static void APIENTRY Instrument_PointParameterfv (GLenum pname, const GLfloat *params)
+{
+    InstrumentScope scope (79);
+    return InstrumentNext ().PointParameterfv (pname, params);
+}
+
+static void APIENTRY Instrument_PointParameteri (GLenum pname, GLint param)
+{
+    InstrumentScope scope (80);
+    return InstrumentNext ().PointParameteri (pname, param);
+}
+
+static void APIENTRY Instrument_PointParameteriv (GLenum pname, const GLint *params)
+{
+    InstrumentScope scope (81);
+    return InstrumentNext ().PointParameteriv (pname, params);
+}
+
+static void APIENTRY Instrument_BlendColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    InstrumentScope scope (82);
+    return InstrumentNext ().BlendColor (red, green, blue, alpha);
+}
+
+static void APIENTRY Instrument_BlendEquation (GLenum mode)
+{
+    InstrumentScope scope (83);
+    return InstrumentNext ().BlendEquation (mode);
+}
+
+static void APIENTRY Instrument_GenQueries (GLsizei n, GLuint *ids)
+{
+    InstrumentScope scope (84);
+    return InstrumentNext ().GenQueries (n, ids);
+}
+
+static void APIENTRY Instrument_DeleteQueries (GLsizei n, const GLuint *ids)
+{
+    InstrumentScope scope (85);
+    return InstrumentNext ().DeleteQueries (n, ids);
+}
+
+static GLboolean APIENTRY Instrument_IsQuery (GLuint id)
+{
+    InstrumentScope scope (86);
+    return InstrumentNext ().IsQuery (id);
+}
+
+static void APIENTRY Instrument_BeginQuery (GLenum target, GLuint id)
+{
+    InstrumentScope scope (87);
+    return InstrumentNext ().BeginQuery (target, id);
+}
+
+static void APIENTRY Instrument_EndQuery (GLenum target)
+{
+    InstrumentScope scope (88);
+    return InstrumentNext ().EndQuery (target);
+}
+
+static void APIENTRY Instrument_GetQueryiv (GLenum target, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (89);
+    return InstrumentNext ().GetQueryiv (target, pname, params);
+}
+
+static void APIENTRY Instrument_GetQueryObjectiv (GLuint id, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (90);
+    return InstrumentNext ().GetQueryObjectiv (id, pname, params);
+}
+
+static void APIENTRY Instrument_GetQueryObjectuiv (GLuint id, GLenum pname, GLuint *params)
+{
+    InstrumentScope scope (91);
+    return InstrumentNext ().GetQueryObjectuiv (id, pname, params);
+}
+
+static void APIENTRY Instrument_BindBuffer (GLenum target, GLuint buffer)
+{
+    InstrumentScope scope (92);
+    return InstrumentNext ().BindBuffer (target, buffer);
+}
+
+static void APIENTRY Instrument_DeleteBuffers (GLsizei n, const GLuint *buffers)
+{
+    InstrumentScope scope (93);
+    return InstrumentNext ().DeleteBuffers (n, buffers);
+}
+
+static void APIENTRY Instrument_GenBuffers (GLsizei n, GLuint *buffers)
+{
+    InstrumentScope scope (94);
+    return InstrumentNext ().GenBuffers (n, buffers);
+}
+
+static GLboolean APIENTRY Instrument_IsBuffer (GLuint buffer)
+{
+    InstrumentScope scope (95);
+    return InstrumentNext ().IsBuffer (buffer);
+}
+
+static void APIENTRY Instrument_BufferData (GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+{
+    InstrumentScope scope (96);
+    return InstrumentNext ().BufferData (target, size, data, usage);
+}
+
+static void APIENTRY Instrument_BufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    InstrumentScope scope (97);
+    return InstrumentNext ().BufferSubData (target, offset, size, data);
+}
+
+static void APIENTRY Instrument_GetBufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, void *data)
+{
+    InstrumentScope scope (98);
+    return InstrumentNext ().GetBufferSubData (target, offset, size, data);
+}
+
+static void * APIENTRY Instrument_MapBuffer (GLenum target, GLenum access)
+{
+    InstrumentScope scope (99);
+    return InstrumentNext ().MapBuffer (target, access);
+}
+
+static GLboolean APIENTRY Instrument_UnmapBuffer (GLenum target)
+{
+    InstrumentScope scope (100);
+    return InstrumentNext ().UnmapBuffer (target);
+}
+
+static void APIENTRY Instrument_GetBufferParameteriv (GLenum target, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (101);
+    return InstrumentNext ().GetBufferParameteriv (target, pname, params);
+}
+
+static void APIENTRY Instrument_GetBufferPointerv (GLenum target, GLenum pname, void **params)
+{
+    InstrumentScope scope (102);
+    return InstrumentNext ().GetBufferPointerv (target, pname, params);
+}
+
+static void APIENTRY Instrument_BlendEquationSeparate (GLenum modeRGB, GLenum modeAlpha)
+{
+    InstrumentScope scope (103);
+    return InstrumentNext ().BlendEquationSeparate (modeRGB, modeAlpha);
+}
+
+static void APIENTRY Instrument_DrawBuffers (GLsizei n, const GLenum *bufs)
+{
+    InstrumentScope scope (104);
+    return InstrumentNext ().DrawBuffers (n, bufs);
+}
+
+static void APIENTRY Instrument_StencilOpSeparate (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
+{
+    InstrumentScope scope (105);
+    return InstrumentNext ().StencilOpSeparate (face, sfail, dpfail, dppass);
+}
+
+static void APIENTRY Instrument_StencilFuncSeparate (GLenum face, GLenum func, GLint ref, GLuint mask)
+{
+    InstrumentScope scope (106);
+    return InstrumentNext ().StencilFuncSeparate (face, func, ref, mask);
+}
+
+static void APIENTRY Instrument_StencilMaskSeparate (GLenum face, GLuint mask)
+{
+    InstrumentScope scope (107);
+    return InstrumentNext ().StencilMaskSeparate (face, mask);
+}
+
+static void APIENTRY Instrument_AttachShader (GLuint program, GLuint shader)
+{
+    InstrumentScope scope (108);
+    return InstrumentNext ().AttachShader (program, shader);
+}
+
+static void APIENTRY Instrument_BindAttribLocation (GLuint program, GLuint index, const GLchar *name)
+{
+    InstrumentScope scope (109);
+    return InstrumentNext ().BindAttribLocation (program, index, name);
+}
+
+static void APIENTRY Instrument_CompileShader (GLuint shader)
+{
+    InstrumentScope scope (110);
+    return InstrumentNext ().CompileShader (shader);
+}
+
+static GLuint APIENTRY Instrument_CreateProgram (void)
+{
+    InstrumentScope scope (111);
+    return InstrumentNext ().CreateProgram ();
+}
+
+static GLuint APIENTRY Instrument_CreateShader (GLenum type)
+{
+    InstrumentScope scope (112);
+    return InstrumentNext ().CreateShader (type);
+}
+
+static void APIENTRY Instrument_DeleteProgram (GLuint program)
+{
+    InstrumentScope scope (113);
+    return InstrumentNext ().DeleteProgram (program);
+}
+
+static void APIENTRY Instrument_DeleteShader (GLuint shader)
+{
+    InstrumentScope scope (114);
+    return InstrumentNext ().DeleteShader (shader);
+}
+
+static void APIENTRY Instrument_DetachShader (GLuint program, GLuint shader)
+{
+    InstrumentScope scope (115);
+    return InstrumentNext ().DetachShader (program, shader);
+}
+
+static void APIENTRY Instrument_DisableVertexAttribArray (GLuint index)
+{
+    InstrumentScope scope (116);
+    return InstrumentNext ().DisableVertexAttribArray (index);
+}
+
+static void APIENTRY Instrument_EnableVertexAttribArray (GLuint index)
+{
+    InstrumentScope scope (117);
+    return InstrumentNext ().EnableVertexAttribArray (index);
+}
+
+static void APIENTRY Instrument_GetActiveAttrib (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+    InstrumentScope scope (118);
+    return InstrumentNext ().GetActiveAttrib (program, index, bufSize, length, size, type, name);
+}
+
+static void APIENTRY Instrument_GetActiveUniform (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+    InstrumentScope scope (119);
+    return InstrumentNext ().GetActiveUniform (program, index, bufSize, length, size, type, name);
+}
+
+static void APIENTRY Instrument_GetAttachedShaders (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders)
+{
+    InstrumentScope scope (120);
+    return InstrumentNext ().GetAttachedShaders (program, maxCount, count, shaders);
+}
+
+static GLint APIENTRY Instrument_GetAttribLocation (GLuint program, const GLchar *name)
+{
+    InstrumentScope scope (121);
+    return InstrumentNext ().GetAttribLocation (program, name);
+}
+
+static void APIENTRY Instrument_GetProgramiv (GLuint program, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (122);
+    return InstrumentNext ().GetProgramiv (program, pname, params);
+}
+
+static void APIENTRY Instrument_GetProgramInfoLog (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    InstrumentScope scope (123);
+    return InstrumentNext ().GetProgramInfoLog (program, bufSize, length, infoLog);
+}
+
+static void APIENTRY Instrument_GetShaderiv (GLuint shader, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (124);
+    return InstrumentNext ().GetShaderiv (shader, pname, params);
+}
+
+static void APIENTRY Instrument_GetShaderInfoLog (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    InstrumentScope scope (125);
+    return InstrumentNext ().GetShaderInfoLog (shader, bufSize, length, infoLog);
+}
+
+static void APIENTRY Instrument_GetShaderSource (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source)
+{
+    InstrumentScope scope (126);
+    return InstrumentNext ().GetShaderSource (shader, bufSize, length, source);
+}
+
+static GLint APIENTRY Instrument_GetUniformLocation (GLuint program, const GLchar *name)
+{
+    InstrumentScope scope (127);
+    return InstrumentNext ().GetUniformLocation (program, name);
+}
+
+static void APIENTRY Instrument_GetUniformfv (GLuint program, GLint location, GLfloat *params)
+{
+    InstrumentScope scope (128);
+    return InstrumentNext ().GetUniformfv (program, location, params);
+}
+
+static void APIENTRY Instrument_GetUniformiv (GLuint program, GLint location, GLint *params)
+{
+    InstrumentScope scope (129);
+    return InstrumentNext ().GetUniformiv (program, location, params);
+}
+
+static void APIENTRY Instrument_GetVertexAttribdv (GLuint index, GLenum pname, GLdouble *params)
+{
+    InstrumentScope scope (130);
+    return InstrumentNext ().GetVertexAttribdv (index, pname, params);
+}
+
+static void APIENTRY Instrument_GetVertexAttribfv (GLuint index, GLenum pname, GLfloat *params)
+{
+    InstrumentScope scope (131);
+    return InstrumentNext ().GetVertexAttribfv (index, pname, params);
+}
+
+static void APIENTRY Instrument_GetVertexAttribiv (GLuint index, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (132);
+    return InstrumentNext ().GetVertexAttribiv (index, pname, params);
+}
+
+static void APIENTRY Instrument_GetVertexAttribPointerv (GLuint index, GLenum pname, void **pointer)
+{
+    InstrumentScope scope (133);
+    return InstrumentNext ().GetVertexAttribPointerv (index, pname, pointer);
+}
+
+static GLboolean APIENTRY Instrument_IsProgram (GLuint program)
+{
+    InstrumentScope scope (134);
+    return InstrumentNext ().IsProgram (program);
+}
+
+static GLboolean APIENTRY Instrument_IsShader (GLuint shader)
+{
+    InstrumentScope scope (135);
+    return InstrumentNext ().IsShader (shader);
+}
+
+static void APIENTRY Instrument_LinkProgram (GLuint program)
+{
+    InstrumentScope scope (136);
+    return InstrumentNext ().LinkProgram (program);
+}
+
+static void APIENTRY Instrument_ShaderSource (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length)
+{
+    InstrumentScope scope (137);
+    return InstrumentNext ().ShaderSource (shader, count, string, length);
+}
+
+static void APIENTRY Instrument_UseProgram (GLuint program)
+{
+    InstrumentScope scope (138);
+    return InstrumentNext ().UseProgram (program);
+}
+
+static void APIENTRY Instrument_Uniform1f (GLint location, GLfloat v0)
+{
+    InstrumentScope scope (139);
+    return InstrumentNext ().Uniform1f (location, v0);
+}
+
+static void APIENTRY Instrument_Uniform2f (GLint location, GLfloat v0, GLfloat v1)
+{
+    InstrumentScope scope (140);
+    return InstrumentNext ().Uniform2f (location, v0, v1);
+}
+
+static void APIENTRY Instrument_Uniform3f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    InstrumentScope scope (141);
+    return InstrumentNext ().Uniform3f (location, v0, v1, v2);
+}
+
+static void APIENTRY Instrument_Uniform4f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+    InstrumentScope scope (142);
+    return InstrumentNext ().Uniform4f (location, v0, v1, v2, v3);
+}
+
+static void APIENTRY Instrument_Uniform1i (GLint location, GLint v0)
+{
+    InstrumentScope scope (143);
+    return InstrumentNext ().Uniform1i (location, v0);
+}
+
+static void APIENTRY Instrument_Uniform2i (GLint location, GLint v0, GLint v1)
+{
+    InstrumentScope scope (144);
+    return InstrumentNext ().Uniform2i (location, v0, v1);
+}
+
+static void APIENTRY Instrument_Uniform3i (GLint location, GLint v0, GLint v1, GLint v2)
+{
+    InstrumentScope scope (145);
+    return InstrumentNext ().Uniform3i (location, v0, v1, v2);
+}
+
+static void APIENTRY Instrument_Uniform4i (GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    InstrumentScope scope (146);
+    return InstrumentNext ().Uniform4i (location, v0, v1, v2, v3);
+}
+
+static void APIENTRY Instrument_Uniform1fv (GLint location, GLsizei count, const GLfloat *value)
+{
+    InstrumentScope scope (147);
+    return InstrumentNext ().Uniform1fv (location, count, value);
+}
+
+static void APIENTRY Instrument_Uniform2fv (GLint location, GLsizei count, const GLfloat *value)
+{
+    InstrumentScope scope (148);
+    return InstrumentNext ().Uniform2fv (location, count, value);
+}
+
+static void APIENTRY Instrument_Uniform3fv (GLint location, GLsizei count, const GLfloat *value)
+{
+    InstrumentScope scope (149);
+    return InstrumentNext ().Uniform3fv (location, count, value);
+}
+
+static void APIENTRY Instrument_Uniform4fv (GLint location, GLsizei count, const GLfloat *value)
+{
+    InstrumentScope scope (150);
+    return InstrumentNext ().Uniform4fv (location, count, value);
+}
+
+static void APIENTRY Instrument_Uniform1iv (GLint location, GLsizei count, const GLint *value)
+{
+    InstrumentScope scope (151);
+    return InstrumentNext ().Uniform1iv (location, count, value);
+}
+
+static void APIENTRY Instrument_Uniform2iv (GLint location, GLsizei count, const GLint *value)
+{
+    InstrumentScope scope (152);
+    return InstrumentNext ().Uniform2iv (location, count, value);
+}
+
+static void APIENTRY Instrument_Uniform3iv (GLint location, GLsizei count, const GLint *value)
+{
+    InstrumentScope scope (153);
+    return InstrumentNext ().Uniform3iv (location, count, value);
+}
+
+static void APIENTRY Instrument_Uniform4iv (GLint location, GLsizei count, const GLint *value)
+{
+    InstrumentScope scope (154);
+    return InstrumentNext ().Uniform4iv (location, count, value);
+}
+
+static void APIENTRY Instrument_UniformMatrix2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    InstrumentScope scope (155);
+    return InstrumentNext ().UniformMatrix2fv (location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_UniformMatrix3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    InstrumentScope scope (156);
+    return InstrumentNext ().UniformMatrix3fv (location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_UniformMatrix4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    InstrumentScope scope (157);
+    return InstrumentNext ().UniformMatrix4fv (location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_ValidateProgram (GLuint program)
+{
+    InstrumentScope scope (158);
+    return InstrumentNext ().ValidateProgram (program);
+}
+
+static void APIENTRY Instrument_VertexAttrib1d (GLuint index, GLdouble x)
+{
+    InstrumentScope scope (159);
+    return InstrumentNext ().VertexAttrib1d (index, x);
+}
+
+static void APIENTRY Instrument_VertexAttrib1dv (GLuint index, const GLdouble *v)
+{
+    InstrumentScope scope (160);
+    return InstrumentNext ().VertexAttrib1dv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttrib1f (GLuint index, GLfloat x)
+{
+    InstrumentScope scope (161);
+    return InstrumentNext ().VertexAttrib1f (index, x);
+}
+
+static void APIENTRY Instrument_VertexAttrib1fv (GLuint index, const GLfloat *v)
+{
+    InstrumentScope scope (162);
+    return InstrumentNext ().VertexAttrib1fv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttrib1s (GLuint index, GLshort x)
+{
+    InstrumentScope scope (163);
+    return InstrumentNext ().VertexAttrib1s (index, x);
+}
+
+static void APIENTRY Instrument_VertexAttrib1sv (GLuint index, const GLshort *v)
+{
+    InstrumentScope scope (164);
+    return InstrumentNext ().VertexAttrib1sv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttrib2d (GLuint index, GLdouble x, GLdouble y)
+{
+    InstrumentScope scope (165);
+    return InstrumentNext ().VertexAttrib2d (index, x, y);
+}
+
+static void APIENTRY Instrument_VertexAttrib2dv (GLuint index, const GLdouble *v)
+{
+    InstrumentScope scope (166);
+    return InstrumentNext ().VertexAttrib2dv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttrib2f (GLuint index, GLfloat x, GLfloat y)
+{
+    InstrumentScope scope (167);
+    return InstrumentNext ().VertexAttrib2f (index, x, y);
+}
+
+static void APIENTRY Instrument_VertexAttrib2fv (GLuint index, const GLfloat *v)
+{
+    InstrumentScope scope (168);
+    return InstrumentNext ().VertexAttrib2fv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttrib2s (GLuint index, GLshort x, GLshort y)
+{
+    InstrumentScope scope (169);
+    return InstrumentNext ().VertexAttrib2s (index, x, y);
+}
+
+static void APIENTRY Instrument_VertexAttrib2sv (GLuint index, const GLshort *v)
+{
+    InstrumentScope scope (170);
+    return InstrumentNext ().VertexAttrib2sv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttrib3d (GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+    InstrumentScope scope (171);
+    return InstrumentNext ().VertexAttrib3d (index, x, y, z);
+}
+
+static void APIENTRY Instrument_VertexAttrib3dv (GLuint index, const GLdouble *v)
+{
+    InstrumentScope scope (172);
+    return InstrumentNext ().VertexAttrib3dv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttrib3f (GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+    InstrumentScope scope (173);
+    return InstrumentNext ().VertexAttrib3f (index, x, y, z);
+}
+
+static void APIENTRY Instrument_VertexAttrib3fv (GLuint index, const GLfloat *v)
+{
+    InstrumentScope scope (174);
+    return InstrumentNext ().VertexAttrib3fv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttrib3s (GLuint index, GLshort x, GLshort y, GLshort z)
+{
+    InstrumentScope scope (175);
+    return InstrumentNext ().VertexAttrib3s (index, x, y, z);
+}
+
+static void APIENTRY Instrument_VertexAttrib3sv (GLuint index, const GLshort *v)
+{
+    InstrumentScope scope (176);
+    return InstrumentNext ().VertexAttrib3sv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttrib4Nbv (GLuint index, const GLbyte *v)
+{
+    InstrumentScope scope (177);
+    return InstrumentNext ().VertexAttrib4Nbv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttrib4Niv (GLuint index, const GLint *v)
+{
+    InstrumentScope scope (178);
+    return InstrumentNext ().VertexAttrib4Niv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttrib4Nsv (GLuint index, const GLshort *v)
+{
+    InstrumentScope scope (179);
+    return InstrumentNext ().VertexAttrib4Nsv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttrib4Nub (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+{
+    InstrumentScope scope (180);
+    return InstrumentNext ().VertexAttrib4Nub (index, x, y, z, w);
+}
+
+static void APIENTRY Instrument_VertexAttrib4Nubv (GLuint index, const GLubyte *v)
+{
+    InstrumentScope scope (181);
+    return InstrumentNext ().VertexAttrib4Nubv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttrib4Nuiv (GLuint index, const GLuint *v)
+{
+    InstrumentScope scope (182);
+    return InstrumentNext ().VertexAttrib4Nuiv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttrib4Nusv (GLuint index, const GLushort *v)
+{
+    InstrumentScope scope (183);
+    return InstrumentNext ().VertexAttrib4Nusv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttrib4bv (GLuint index, const GLbyte *v)
+{
+    InstrumentScope scope (184);
+    return InstrumentNext ().VertexAttrib4bv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttrib4d (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    InstrumentScope scope (185);
+    return InstrumentNext ().VertexAttrib4d (index, x, y, z, w);
+}
+
+static void APIENTRY Instrument_VertexAttrib4dv (GLuint index, const GLdouble *v)
+{
+    InstrumentScope scope (186);
+    return InstrumentNext ().VertexAttrib4dv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttrib4f (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    InstrumentScope scope (187);
+    return InstrumentNext ().VertexAttrib4f (index, x, y, z, w);
+}
+
+static void APIENTRY Instrument_VertexAttrib4fv (GLuint index, const GLfloat *v)
+{
+    InstrumentScope scope (188);
+    return InstrumentNext ().VertexAttrib4fv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttrib4iv (GLuint index, const GLint *v)
+{
+    InstrumentScope scope (189);
+    return InstrumentNext ().VertexAttrib4iv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttrib4s (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+    InstrumentScope scope (190);
+    return InstrumentNext ().VertexAttrib4s (index, x, y, z, w);
+}
+
+static void APIENTRY Instrument_VertexAttrib4sv (GLuint index, const GLshort *v)
+{
+    InstrumentScope scope (191);
+    return InstrumentNext ().VertexAttrib4sv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttrib4ubv (GLuint index, const GLubyte *v)
+{
+    InstrumentScope scope (192);
+    return InstrumentNext ().VertexAttrib4ubv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttrib4uiv (GLuint index, const GLuint *v)
+{
+    InstrumentScope scope (193);
+    return InstrumentNext ().VertexAttrib4uiv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttrib4usv (GLuint index, const GLushort *v)
+{
+    InstrumentScope scope (194);
+    return InstrumentNext ().VertexAttrib4usv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttribPointer (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer)
+{
+    InstrumentScope scope (195);
+    return InstrumentNext ().VertexAttribPointer (index, size, type, normalized, stride, pointer);
+}
+
+static void APIENTRY Instrument_UniformMatrix2x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    InstrumentScope scope (196);
+    return InstrumentNext ().UniformMatrix2x3fv (location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_UniformMatrix3x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    InstrumentScope scope (197);
+    return InstrumentNext ().UniformMatrix3x2fv (location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_UniformMatrix2x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    InstrumentScope scope (198);
+    return InstrumentNext ().UniformMatrix2x4fv (location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_UniformMatrix4x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    InstrumentScope scope (199);
+    return InstrumentNext ().UniformMatrix4x2fv (location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_UniformMatrix3x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    InstrumentScope scope (200);
+    return InstrumentNext ().UniformMatrix3x4fv (location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_UniformMatrix4x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    InstrumentScope scope (201);
+    return InstrumentNext ().UniformMatrix4x3fv (location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_ColorMaski (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
+{
+    InstrumentScope scope (202);
+    return InstrumentNext ().ColorMaski (index, r, g, b, a);
+}
+
+static void APIENTRY Instrument_GetBooleani_v (GLenum target, GLuint index, GLboolean *data)
+{
+    InstrumentScope scope (203);
+    return InstrumentNext ().GetBooleani_v (target, index, data);
+}
+
+static void APIENTRY Instrument_GetIntegeri_v (GLenum target, GLuint index, GLint *data)
+{
+    InstrumentScope scope (204);
+    return InstrumentNext ().GetIntegeri_v (target, index, data);
+}
+
+static void APIENTRY Instrument_Enablei (GLenum target, GLuint index)
+{
+    InstrumentScope scope (205);
+    return InstrumentNext ().Enablei (target, index);
+}
+
+static void APIENTRY Instrument_Disablei (GLenum target, GLuint index)
+{
+    InstrumentScope scope (206);
+    return InstrumentNext ().Disablei (target, index);
+}
+
+static GLboolean APIENTRY Instrument_IsEnabledi (GLenum target, GLuint index)
+{
+    InstrumentScope scope (207);
+    return InstrumentNext ().IsEnabledi (target, index);
+}
+
+static void APIENTRY Instrument_BeginTransformFeedback (GLenum primitiveMode)
+{
+    InstrumentScope scope (208);
+    return InstrumentNext ().BeginTransformFeedback (primitiveMode);
+}
+
+static void APIENTRY Instrument_EndTransformFeedback (void)
+{
+    InstrumentScope scope (209);
+    return InstrumentNext ().EndTransformFeedback ();
+}
+
+static void APIENTRY Instrument_BindBufferRange (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    InstrumentScope scope (210);
+    return InstrumentNext ().BindBufferRange (target, index, buffer, offset, size);
+}
+
+static void APIENTRY Instrument_BindBufferBase (GLenum target, GLuint index, GLuint buffer)
+{
+    InstrumentScope scope (211);
+    return InstrumentNext ().BindBufferBase (target, index, buffer);
+}
+
+static void APIENTRY Instrument_TransformFeedbackVaryings (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode)
+{
+    InstrumentScope scope (212);
+    return InstrumentNext ().TransformFeedbackVaryings (program, count, varyings, bufferMode);
+}
+
+static void APIENTRY Instrument_GetTransformFeedbackVarying (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name)
+{
+    InstrumentScope scope (213);
+    return InstrumentNext ().GetTransformFeedbackVarying (program, index, bufSize, length, size, type, name);
+}
+
+static void APIENTRY Instrument_ClampColor (GLenum target, GLenum clamp)
+{
+    InstrumentScope scope (214);
+    return InstrumentNext ().ClampColor (target, clamp);
+}
+
+static void APIENTRY Instrument_BeginConditionalRender (GLuint id, GLenum mode)
+{
+    InstrumentScope scope (215);
+    return InstrumentNext ().BeginConditionalRender (id, mode);
+}
+
+static void APIENTRY Instrument_EndConditionalRender (void)
+{
+    InstrumentScope scope (216);
+    return InstrumentNext ().EndConditionalRender ();
+}
+
+static void APIENTRY Instrument_VertexAttribIPointer (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+    InstrumentScope scope (217);
+    return InstrumentNext ().VertexAttribIPointer (index, size, type, stride, pointer);
+}
+
+static void APIENTRY Instrument_GetVertexAttribIiv (GLuint index, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (218);
+    return InstrumentNext ().GetVertexAttribIiv (index, pname, params);
+}
+
+static void APIENTRY Instrument_GetVertexAttribIuiv (GLuint index, GLenum pname, GLuint *params)
+{
+    InstrumentScope scope (219);
+    return InstrumentNext ().GetVertexAttribIuiv (index, pname, params);
+}
+
+static void APIENTRY Instrument_VertexAttribI1i (GLuint index, GLint x)
+{
+    InstrumentScope scope (220);
+    return InstrumentNext ().VertexAttribI1i (index, x);
+}
+
+static void APIENTRY Instrument_VertexAttribI2i (GLuint index, GLint x, GLint y)
+{
+    InstrumentScope scope (221);
+    return InstrumentNext ().VertexAttribI2i (index, x, y);
+}
+
+static void APIENTRY Instrument_VertexAttribI3i (GLuint index, GLint x, GLint y, GLint z)
+{
+    InstrumentScope scope (222);
+    return InstrumentNext ().VertexAttribI3i (index, x, y, z);
+}
+
+static void APIENTRY Instrument_VertexAttribI4i (GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+    InstrumentScope scope (223);
+    return InstrumentNext ().VertexAttribI4i (index, x, y, z, w);
+}
+
+static void APIENTRY Instrument_VertexAttribI1ui (GLuint index, GLuint x)
+{
+    InstrumentScope scope (224);
+    return InstrumentNext ().VertexAttribI1ui (index, x);
+}
+
+static void APIENTRY Instrument_VertexAttribI2ui (GLuint index, GLuint x, GLuint y)
+{
+    InstrumentScope scope (225);
+    return InstrumentNext ().VertexAttribI2ui (index, x, y);
+}
+
+static void APIENTRY Instrument_VertexAttribI3ui (GLuint index, GLuint x, GLuint y, GLuint z)
+{
+    InstrumentScope scope (226);
+    return InstrumentNext ().VertexAttribI3ui (index, x, y, z);
+}
+
+static void APIENTRY Instrument_VertexAttribI4ui (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+{
+    InstrumentScope scope (227);
+    return InstrumentNext ().VertexAttribI4ui (index, x, y, z, w);
+}
+
+static void APIENTRY Instrument_VertexAttribI1iv (GLuint index, const GLint *v)
+{
+    InstrumentScope scope (228);
+    return InstrumentNext ().VertexAttribI1iv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttribI2iv (GLuint index, const GLint *v)
+{
+    InstrumentScope scope (229);
+    return InstrumentNext ().VertexAttribI2iv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttribI3iv (GLuint index, const GLint *v)
+{
+    InstrumentScope scope (230);
+    return InstrumentNext ().VertexAttribI3iv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttribI4iv (GLuint index, const GLint *v)
+{
+    InstrumentScope scope (231);
+    return InstrumentNext ().VertexAttribI4iv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttribI1uiv (GLuint index, const GLuint *v)
+{
+    InstrumentScope scope (232);
+    return InstrumentNext ().VertexAttribI1uiv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttribI2uiv (GLuint index, const GLuint *v)
+{
+    InstrumentScope scope (233);
+    return InstrumentNext ().VertexAttribI2uiv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttribI3uiv (GLuint index, const GLuint *v)
+{
+    InstrumentScope scope (234);
+    return InstrumentNext ().VertexAttribI3uiv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttribI4uiv (GLuint index, const GLuint *v)
+{
+    InstrumentScope scope (235);
+    return InstrumentNext ().VertexAttribI4uiv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttribI4bv (GLuint index, const GLbyte *v)
+{
+    InstrumentScope scope (236);
+    return InstrumentNext ().VertexAttribI4bv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttribI4sv (GLuint index, const GLshort *v)
+{
+    InstrumentScope scope (237);
+    return InstrumentNext ().VertexAttribI4sv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttribI4ubv (GLuint index, const GLubyte *v)
+{
+    InstrumentScope scope (238);
+    return InstrumentNext ().VertexAttribI4ubv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttribI4usv (GLuint index, const GLushort *v)
+{
+    InstrumentScope scope (239);
+    return InstrumentNext ().VertexAttribI4usv (index, v);
+}
+
+static void APIENTRY Instrument_GetUniformuiv (GLuint program, GLint location, GLuint *params)
+{
+    InstrumentScope scope (240);
+    return InstrumentNext ().GetUniformuiv (program, location, params);
+}
+
+static void APIENTRY Instrument_BindFragDataLocation (GLuint program, GLuint color, const GLchar *name)
+{
+    InstrumentScope scope (241);
+    return InstrumentNext ().BindFragDataLocation (program, color, name);
+}
+
+static GLint APIENTRY Instrument_GetFragDataLocation (GLuint program, const GLchar *name)
+{
+    InstrumentScope scope (242);
+    return InstrumentNext ().GetFragDataLocation (program, name);
+}
+
+static void APIENTRY Instrument_Uniform1ui (GLint location, GLuint v0)
+{
+    InstrumentScope scope (243);
+    return InstrumentNext ().Uniform1ui (location, v0);
+}
+
+static void APIENTRY Instrument_Uniform2ui (GLint location, GLuint v0, GLuint v1)
+{
+    InstrumentScope scope (244);
+    return InstrumentNext ().Uniform2ui (location, v0, v1);
+}
+
+static void APIENTRY Instrument_Uniform3ui (GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+    InstrumentScope scope (245);
+    return InstrumentNext ().Uniform3ui (location, v0, v1, v2);
+}
+
+static void APIENTRY Instrument_Uniform4ui (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+    InstrumentScope scope (246);
+    return InstrumentNext ().Uniform4ui (location, v0, v1, v2, v3);
+}
+
+static void APIENTRY Instrument_Uniform1uiv (GLint location, GLsizei count, const GLuint *value)
+{
+    InstrumentScope scope (247);
+    return InstrumentNext ().Uniform1uiv (location, count, value);
+}
+
+static void APIENTRY Instrument_Uniform2uiv (GLint location, GLsizei count, const GLuint *value)
+{
+    InstrumentScope scope (248);
+    return InstrumentNext ().Uniform2uiv (location, count, value);
+}
+
+static void APIENTRY Instrument_Uniform3uiv (GLint location, GLsizei count, const GLuint *value)
+{
+    InstrumentScope scope (249);
+    return InstrumentNext ().Uniform3uiv (location, count, value);
+}
+
+static void APIENTRY Instrument_Uniform4uiv (GLint location, GLsizei count, const GLuint *value)
+{
+    InstrumentScope scope (250);
+    return InstrumentNext ().Uniform4uiv (location, count, value);
+}
+
+static void APIENTRY Instrument_TexParameterIiv (GLenum target, GLenum pname, const GLint *params)
+{
+    InstrumentScope scope (251);
+    return InstrumentNext ().TexParameterIiv (target, pname, params);
+}
+
+static void APIENTRY Instrument_TexParameterIuiv (GLenum target, GLenum pname, const GLuint *params)
+{
+    InstrumentScope scope (252);
+    return InstrumentNext ().TexParameterIuiv (target, pname, params);
+}
+
+static void APIENTRY Instrument_GetTexParameterIiv (GLenum target, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (253);
+    return InstrumentNext ().GetTexParameterIiv (target, pname, params);
+}
+
+static void APIENTRY Instrument_GetTexParameterIuiv (GLenum target, GLenum pname, GLuint *params)
+{
+    InstrumentScope scope (254);
+    return InstrumentNext ().GetTexParameterIuiv (target, pname, params);
+}
+
+static void APIENTRY Instrument_ClearBufferiv (GLenum buffer, GLint drawbuffer, const GLint *value)
+{
+    InstrumentScope scope (255);
+    return InstrumentNext ().ClearBufferiv (buffer, drawbuffer, value);
+}
+
+static void APIENTRY Instrument_ClearBufferuiv (GLenum buffer, GLint drawbuffer, const GLuint *value)
+{
+    InstrumentScope scope (256);
+    return InstrumentNext ().ClearBufferuiv (buffer, drawbuffer, value);
+}
+
+static void APIENTRY Instrument_ClearBufferfv (GLenum buffer, GLint drawbuffer, const GLfloat *value)
+{
+    InstrumentScope scope (257);
+    return InstrumentNext ().ClearBufferfv (buffer, drawbuffer, value);
+}
+
+static void APIENTRY Instrument_ClearBufferfi (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
+{
+    InstrumentScope scope (258);
+    return InstrumentNext ().ClearBufferfi (buffer, drawbuffer, depth, stencil);
+}
+
+static const GLubyte * APIENTRY Instrument_GetStringi (GLenum name, GLuint index)
+{
+    InstrumentScope scope (259);
+    return InstrumentNext ().GetStringi (name, index);
+}
+
+static GLboolean APIENTRY Instrument_IsRenderbuffer (GLuint renderbuffer)
+{
+    InstrumentScope scope (260);
+    return InstrumentNext ().IsRenderbuffer (renderbuffer);
+}
+
+static void APIENTRY Instrument_BindRenderbuffer (GLenum target, GLuint renderbuffer)
+{
+    InstrumentScope scope (261);
+    return InstrumentNext ().BindRenderbuffer (target, renderbuffer);
+}
+
+static void APIENTRY Instrument_DeleteRenderbuffers (GLsizei n, const GLuint *renderbuffers)
+{
+    InstrumentScope scope (262);
+    return InstrumentNext ().DeleteRenderbuffers (n, renderbuffers);
+}
+
+static void APIENTRY Instrument_GenRenderbuffers (GLsizei n, GLuint *renderbuffers)
+{
+    InstrumentScope scope (263);
+    return InstrumentNext ().GenRenderbuffers (n, renderbuffers);
+}
+
+static void APIENTRY Instrument_RenderbufferStorage (GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    InstrumentScope scope (264);
+    return InstrumentNext ().RenderbufferStorage (target, internalformat, width, height);
+}
+
+static void APIENTRY Instrument_GetRenderbufferParameteriv (GLenum target, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (265);
+    return InstrumentNext ().GetRenderbufferParameteriv (target, pname, params);
+}
+
+static GLboolean APIENTRY Instrument_IsFramebuffer (GLuint framebuffer)
+{
+    InstrumentScope scope (266);
+    return InstrumentNext ().IsFramebuffer (framebuffer);
+}
+
+static void APIENTRY Instrument_BindFramebuffer (GLenum target, GLuint framebuffer)
+{
+    InstrumentScope scope (267);
+    return InstrumentNext ().BindFramebuffer (target, framebuffer);
+}
+
+static void APIENTRY Instrument_DeleteFramebuffers (GLsizei n, const GLuint *framebuffers)
+{
+    InstrumentScope scope (268);
+    return InstrumentNext ().DeleteFramebuffers (n, framebuffers);
+}
+
+static void APIENTRY Instrument_GenFramebuffers (GLsizei n, GLuint *framebuffers)
+{
+    InstrumentScope scope (269);
+    return InstrumentNext ().GenFramebuffers (n, framebuffers);
+}
+
+static GLenum APIENTRY Instrument_CheckFramebufferStatus (GLenum target)
+{
+    InstrumentScope scope (270);
+    return InstrumentNext ().CheckFramebufferStatus (target);
+}
+
+static void APIENTRY Instrument_FramebufferTexture1D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    InstrumentScope scope (271);
+    return InstrumentNext ().FramebufferTexture1D (target, attachment, textarget, texture, level);
+}
+
+static void APIENTRY Instrument_FramebufferTexture2D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    InstrumentScope scope (272);
+    return InstrumentNext ().FramebufferTexture2D (target, attachment, textarget, texture, level);
+}
+
+static void APIENTRY Instrument_FramebufferTexture3D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
+{
+    InstrumentScope scope (273);
+    return InstrumentNext ().FramebufferTexture3D (target, attachment, textarget, texture, level, zoffset);
+}
+
+static void APIENTRY Instrument_FramebufferRenderbuffer (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+    InstrumentScope scope (274);
+    return InstrumentNext ().FramebufferRenderbuffer (target, attachment, renderbuffertarget, renderbuffer);
+}
+
+static void APIENTRY Instrument_GetFramebufferAttachmentParameteriv (GLenum target, GLenum attachment, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (275);
+    return InstrumentNext ().GetFramebufferAttachmentParameteriv (target, attachment, pname, params);
+}
+
+static void APIENTRY Instrument_GenerateMipmap (GLenum target)
+{
+    InstrumentScope scope (276);
+    return InstrumentNext ().GenerateMipmap (target);
+}
+
+static void APIENTRY Instrument_BlitFramebuffer (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+    InstrumentScope scope (277);
+    return InstrumentNext ().BlitFramebuffer (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+static void APIENTRY Instrument_RenderbufferStorageMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    InstrumentScope scope (278);
+    return InstrumentNext ().RenderbufferStorageMultisample (target, samples, internalformat, width, height);
+}
+
+static void APIENTRY Instrument_FramebufferTextureLayer (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+    InstrumentScope scope (279);
+    return InstrumentNext ().FramebufferTextureLayer (target, attachment, texture, level, layer);
+}
+
+static void * APIENTRY Instrument_MapBufferRange (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    InstrumentScope scope (280);
+    return InstrumentNext ().MapBufferRange (target, offset, length, access);
+}
+
+static void APIENTRY Instrument_FlushMappedBufferRange (GLenum target, GLintptr offset, GLsizeiptr length)
+{
+    InstrumentScope scope (281);
+    return InstrumentNext ().FlushMappedBufferRange (target, offset, length);
+}
+
+static void APIENTRY Instrument_BindVertexArray (GLuint array)
+{
+    InstrumentScope scope (282);
+    return InstrumentNext ().BindVertexArray (array);
+}
+
+static void APIENTRY Instrument_DeleteVertexArrays (GLsizei n, const GLuint *arrays)
+{
+    InstrumentScope scope (283);
+    return InstrumentNext ().DeleteVertexArrays (n, arrays);
+}
+
+static void APIENTRY Instrument_GenVertexArrays (GLsizei n, GLuint *arrays)
+{
+    InstrumentScope scope (284);
+    return InstrumentNext ().GenVertexArrays (n, arrays);
+}
+
+static GLboolean APIENTRY Instrument_IsVertexArray (GLuint array)
+{
+    InstrumentScope scope (285);
+    return InstrumentNext ().IsVertexArray (array);
+}
+
+static void APIENTRY Instrument_DrawArraysInstanced (GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+{
+    InstrumentScope scope (286);
+    return InstrumentNext ().DrawArraysInstanced (mode, first, count, instancecount);
+}
+
+static void APIENTRY Instrument_DrawElementsInstanced (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount)
+{
+    InstrumentScope scope (287);
+    return InstrumentNext ().DrawElementsInstanced (mode, count, type, indices, instancecount);
+}
+
+static void APIENTRY Instrument_TexBuffer (GLenum target, GLenum internalformat, GLuint buffer)
+{
+    InstrumentScope scope (288);
+    return InstrumentNext ().TexBuffer (target, internalformat, buffer);
+}
+
+static void APIENTRY Instrument_PrimitiveRestartIndex (GLuint index)
+{
+    InstrumentScope scope (289);
+    return InstrumentNext ().PrimitiveRestartIndex (index);
+}
+
+static void APIENTRY Instrument_CopyBufferSubData (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+    InstrumentScope scope (290);
+    return InstrumentNext ().CopyBufferSubData (readTarget, writeTarget, readOffset, writeOffset, size);
+}
+
+static void APIENTRY Instrument_GetUniformIndices (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices)
+{
+    InstrumentScope scope (291);
+    return InstrumentNext ().GetUniformIndices (program, uniformCount, uniformNames, uniformIndices);
+}
+
+static void APIENTRY Instrument_GetActiveUniformsiv (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (292);
+    return InstrumentNext ().GetActiveUniformsiv (program, uniformCount, uniformIndices, pname, params);
+}
+
+static void APIENTRY Instrument_GetActiveUniformName (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName)
+{
+    InstrumentScope scope (293);
+    return InstrumentNext ().GetActiveUniformName (program, uniformIndex, bufSize, length, uniformName);
+}
+
+static GLuint APIENTRY Instrument_GetUniformBlockIndex (GLuint program, const GLchar *uniformBlockName)
+{
+    InstrumentScope scope (294);
+    return InstrumentNext ().GetUniformBlockIndex (program, uniformBlockName);
+}
+
+static void APIENTRY Instrument_GetActiveUniformBlockiv (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (295);
+    return InstrumentNext ().GetActiveUniformBlockiv (program, uniformBlockIndex, pname, params);
+}
+
+static void APIENTRY Instrument_GetActiveUniformBlockName (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName)
+{
+    InstrumentScope scope (296);
+    return InstrumentNext ().GetActiveUniformBlockName (program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+
+static void APIENTRY Instrument_UniformBlockBinding (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding)
+{
+    InstrumentScope scope (297);
+    return InstrumentNext ().UniformBlockBinding (program, uniformBlockIndex, uniformBlockBinding);
+}
+
+static void APIENTRY Instrument_DrawElementsBaseVertex (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+{
+    InstrumentScope scope (298);
+    return InstrumentNext ().DrawElementsBaseVertex (mode, count, type, indices, basevertex);
+}
+
+static void APIENTRY Instrument_DrawRangeElementsBaseVertex (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+{
+    InstrumentScope scope (299);
+    return InstrumentNext ().DrawRangeElementsBaseVertex (mode, start, end, count, type, indices, basevertex);
+}
+
+static void APIENTRY Instrument_DrawElementsInstancedBaseVertex (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex)
+{
+    InstrumentScope scope (300);
+    return InstrumentNext ().DrawElementsInstancedBaseVertex (mode, count, type, indices, instancecount, basevertex);
+}
+
+static void APIENTRY Instrument_MultiDrawElementsBaseVertex (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex)
+{
+    InstrumentScope scope (301);
+    return InstrumentNext ().MultiDrawElementsBaseVertex (mode, count, type, indices, drawcount, basevertex);
+}
+
+static void APIENTRY Instrument_ProvokingVertex (GLenum mode)
+{
+    InstrumentScope scope (302);
+    return InstrumentNext ().ProvokingVertex (mode);
+}
+
+static GLsync APIENTRY Instrument_FenceSync (GLenum condition, GLbitfield flags)
+{
+    InstrumentScope scope (303);
+    return InstrumentNext ().FenceSync (condition, flags);
+}
+
+static GLboolean APIENTRY Instrument_IsSync (GLsync sync)
+{
+    InstrumentScope scope (304);
+    return InstrumentNext ().IsSync (sync);
+}
+
+static void APIENTRY Instrument_DeleteSync (GLsync sync)
+{
+    InstrumentScope scope (305);
+    return InstrumentNext ().DeleteSync (sync);
+}
+
+static GLenum APIENTRY Instrument_ClientWaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    InstrumentScope scope (306);
+    return InstrumentNext ().ClientWaitSync (sync, flags, timeout);
+}
+
+static void APIENTRY Instrument_WaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    InstrumentScope scope (307);
+    return InstrumentNext ().WaitSync (sync, flags, timeout);
+}
+
+static void APIENTRY Instrument_GetInteger64v (GLenum pname, GLint64 *data)
+{
+    InstrumentScope scope (308);
+    return InstrumentNext ().GetInteger64v (pname, data);
+}
+
+static void APIENTRY Instrument_GetSynciv (GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values)
+{
+    InstrumentScope scope (309);
+    return InstrumentNext ().GetSynciv (sync, pname, bufSize, length, values);
+}
+
+static void APIENTRY Instrument_GetInteger64i_v (GLenum target, GLuint index, GLint64 *data)
+{
+    InstrumentScope scope (310);
+    return InstrumentNext ().GetInteger64i_v (target, index, data);
+}
+
+static void APIENTRY Instrument_GetBufferParameteri64v (GLenum target, GLenum pname, GLint64 *params)
+{
+    InstrumentScope scope (311);
+    return InstrumentNext ().GetBufferParameteri64v (target, pname, params);
+}
+
+static void APIENTRY Instrument_FramebufferTexture (GLenum target, GLenum attachment, GLuint texture, GLint level)
+{
+    InstrumentScope scope (312);
+    return InstrumentNext ().FramebufferTexture (target, attachment, texture, level);
+}
+
+static void APIENTRY Instrument_TexImage2DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+    InstrumentScope scope (313);
+    return InstrumentNext ().TexImage2DMultisample (target, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static void APIENTRY Instrument_TexImage3DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+    InstrumentScope scope (314);
+    return InstrumentNext ().TexImage3DMultisample (target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+static void APIENTRY Instrument_GetMultisamplefv (GLenum pname, GLuint index, GLfloat *val)
+{
+    InstrumentScope scope (315);
+    return InstrumentNext ().GetMultisamplefv (pname, index, val);
+}
+
+static void APIENTRY Instrument_SampleMaski (GLuint maskNumber, GLbitfield mask)
+{
+    InstrumentScope scope (316);
+    return InstrumentNext ().SampleMaski (maskNumber, mask);
+}
+
+static void APIENTRY Instrument_BindFragDataLocationIndexed (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name)
+{
+    InstrumentScope scope (317);
+    return InstrumentNext ().BindFragDataLocationIndexed (program, colorNumber, index, name);
+}
+
+static GLint APIENTRY Instrument_GetFragDataIndex (GLuint program, const GLchar *name)
+{
+    InstrumentScope scope (318);
+    return InstrumentNext ().GetFragDataIndex (program, name);
+}
+
+static void APIENTRY Instrument_GenSamplers (GLsizei count, GLuint *samplers)
+{
+    InstrumentScope scope (319);
+    return InstrumentNext ().GenSamplers (count, samplers);
+}
+
+static void APIENTRY Instrument_DeleteSamplers (GLsizei count, const GLuint *samplers)
+{
+    InstrumentScope scope (320);
+    return InstrumentNext ().DeleteSamplers (count, samplers);
+}
+
+static GLboolean APIENTRY Instrument_IsSampler (GLuint sampler)
+{
+    InstrumentScope scope (321);
+    return InstrumentNext ().IsSampler (sampler);
+}
+
+static void APIENTRY Instrument_BindSampler (GLuint unit, GLuint sampler)
+{
+    InstrumentScope scope (322);
+    return InstrumentNext ().BindSampler (unit, sampler);
+}
+
+static void APIENTRY Instrument_SamplerParameteri (GLuint sampler, GLenum pname, GLint param)
+{
+    InstrumentScope scope (323);
+    return InstrumentNext ().SamplerParameteri (sampler, pname, param);
+}
+
+static void APIENTRY Instrument_SamplerParameteriv (GLuint sampler, GLenum pname, const GLint *param)
+{
+    InstrumentScope scope (324);
+    return InstrumentNext ().SamplerParameteriv (sampler, pname, param);
+}
+
+static void APIENTRY Instrument_SamplerParameterf (GLuint sampler, GLenum pname, GLfloat param)
+{
+    InstrumentScope scope (325);
+    return InstrumentNext ().SamplerParameterf (sampler, pname, param);
+}
+
+static void APIENTRY Instrument_SamplerParameterfv (GLuint sampler, GLenum pname, const GLfloat *param)
+{
+    InstrumentScope scope (326);
+    return InstrumentNext ().SamplerParameterfv (sampler, pname, param);
+}
+
+static void APIENTRY Instrument_SamplerParameterIiv (GLuint sampler, GLenum pname, const GLint *param)
+{
+    InstrumentScope scope (327);
+    return InstrumentNext ().SamplerParameterIiv (sampler, pname, param);
+}
+
+static void APIENTRY Instrument_SamplerParameterIuiv (GLuint sampler, GLenum pname, const GLuint *param)
+{
+    InstrumentScope scope (328);
+    return InstrumentNext ().SamplerParameterIuiv (sampler, pname, param);
+}
+
+static void APIENTRY Instrument_GetSamplerParameteriv (GLuint sampler, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (329);
+    return InstrumentNext ().GetSamplerParameteriv (sampler, pname, params);
+}
+
+static void APIENTRY Instrument_GetSamplerParameterIiv (GLuint sampler, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (330);
+    return InstrumentNext ().GetSamplerParameterIiv (sampler, pname, params);
+}
+
+static void APIENTRY Instrument_GetSamplerParameterfv (GLuint sampler, GLenum pname, GLfloat *params)
+{
+    InstrumentScope scope (331);
+    return InstrumentNext ().GetSamplerParameterfv (sampler, pname, params);
+}
+
+static void APIENTRY Instrument_GetSamplerParameterIuiv (GLuint sampler, GLenum pname, GLuint *params)
+{
+    InstrumentScope scope (332);
+    return InstrumentNext ().GetSamplerParameterIuiv (sampler, pname, params);
+}
+
+static void APIENTRY Instrument_QueryCounter (GLuint id, GLenum target)
+{
+    InstrumentScope scope (333);
+    return InstrumentNext ().QueryCounter (id, target);
+}
+
+static void APIENTRY Instrument_GetQueryObjecti64v (GLuint id, GLenum pname, GLint64 *params)
+{
+    InstrumentScope scope (334);
+    return InstrumentNext ().GetQueryObjecti64v (id, pname, params);
+}
+
+static void APIENTRY Instrument_GetQueryObjectui64v (GLuint id, GLenum pname, GLuint64 *params)
+{
+    InstrumentScope scope (335);
+    return InstrumentNext ().GetQueryObjectui64v (id, pname, params);
+}
+
+static void APIENTRY Instrument_VertexAttribDivisor (GLuint index, GLuint divisor)
+{
+    InstrumentScope scope (336);
+    return InstrumentNext ().VertexAttribDivisor (index, divisor);
+}
+
+static void APIENTRY Instrument_VertexAttribP1ui (GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    InstrumentScope scope (337);
+    return InstrumentNext ().VertexAttribP1ui (index, type, normalized, value);
+}
+
+static void APIENTRY Instrument_VertexAttribP1uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    InstrumentScope scope (338);
+    return InstrumentNext ().VertexAttribP1uiv (index, type, normalized, value);
+}
+
+static void APIENTRY Instrument_VertexAttribP2ui (GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    InstrumentScope scope (339);
+    return InstrumentNext ().VertexAttribP2ui (index, type, normalized, value);
+}
+
+static void APIENTRY Instrument_VertexAttribP2uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    InstrumentScope scope (340);
+    return InstrumentNext ().VertexAttribP2uiv (index, type, normalized, value);
+}
+
+static void APIENTRY Instrument_VertexAttribP3ui (GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    InstrumentScope scope (341);
+    return InstrumentNext ().VertexAttribP3ui (index, type, normalized, value);
+}
+
+static void APIENTRY Instrument_VertexAttribP3uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    InstrumentScope scope (342);
+    return InstrumentNext ().VertexAttribP3uiv (index, type, normalized, value);
+}
+
+static void APIENTRY Instrument_VertexAttribP4ui (GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    InstrumentScope scope (343);
+    return InstrumentNext ().VertexAttribP4ui (index, type, normalized, value);
+}
+
+static void APIENTRY Instrument_VertexAttribP4uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    InstrumentScope scope (344);
+    return InstrumentNext ().VertexAttribP4uiv (index, type, normalized, value);
+}
+
+static void APIENTRY Instrument_MinSampleShading (GLfloat value)
+{
+    InstrumentScope scope (345);
+    return InstrumentNext ().MinSampleShading (value);
+}
+
+static void APIENTRY Instrument_BlendEquationi (GLuint buf, GLenum mode)
+{
+    InstrumentScope scope (346);
+    return InstrumentNext ().BlendEquationi (buf, mode);
+}
+
+static void APIENTRY Instrument_BlendEquationSeparatei (GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+    InstrumentScope scope (347);
+    return InstrumentNext ().BlendEquationSeparatei (buf, modeRGB, modeAlpha);
+}
+
+static void APIENTRY Instrument_BlendFunci (GLuint buf, GLenum src, GLenum dst)
+{
+    InstrumentScope scope (348);
+    return InstrumentNext ().BlendFunci (buf, src, dst);
+}
+
+static void APIENTRY Instrument_BlendFuncSeparatei (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+    InstrumentScope scope (349);
+    return InstrumentNext ().BlendFuncSeparatei (buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+
+static void APIENTRY Instrument_DrawArraysIndirect (GLenum mode, const void *indirect)
+{
+    InstrumentScope scope (350);
+    return InstrumentNext ().DrawArraysIndirect (mode, indirect);
+}
+
+static void APIENTRY Instrument_DrawElementsIndirect (GLenum mode, GLenum type, const void *indirect)
+{
+    InstrumentScope scope (351);
+    return InstrumentNext ().DrawElementsIndirect (mode, type, indirect);
+}
+
+static void APIENTRY Instrument_Uniform1d (GLint location, GLdouble x)
+{
+    InstrumentScope scope (352);
+    return InstrumentNext ().Uniform1d (location, x);
+}
+
+static void APIENTRY Instrument_Uniform2d (GLint location, GLdouble x, GLdouble y)
+{
+    InstrumentScope scope (353);
+    return InstrumentNext ().Uniform2d (location, x, y);
+}
+
+static void APIENTRY Instrument_Uniform3d (GLint location, GLdouble x, GLdouble y, GLdouble z)
+{
+    InstrumentScope scope (354);
+    return InstrumentNext ().Uniform3d (location, x, y, z);
+}
+
+static void APIENTRY Instrument_Uniform4d (GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    InstrumentScope scope (355);
+    return InstrumentNext ().Uniform4d (location, x, y, z, w);
+}
+
+static void APIENTRY Instrument_Uniform1dv (GLint location, GLsizei count, const GLdouble *value)
+{
+    InstrumentScope scope (356);
+    return InstrumentNext ().Uniform1dv (location, count, value);
+}
+
+static void APIENTRY Instrument_Uniform2dv (GLint location, GLsizei count, const GLdouble *value)
+{
+    InstrumentScope scope (357);
+    return InstrumentNext ().Uniform2dv (location, count, value);
+}
+
+static void APIENTRY Instrument_Uniform3dv (GLint location, GLsizei count, const GLdouble *value)
+{
+    InstrumentScope scope (358);
+    return InstrumentNext ().Uniform3dv (location, count, value);
+}
+
+static void APIENTRY Instrument_Uniform4dv (GLint location, GLsizei count, const GLdouble *value)
+{
+    InstrumentScope scope (359);
+    return InstrumentNext ().Uniform4dv (location, count, value);
+}
+
+static void APIENTRY Instrument_UniformMatrix2dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    InstrumentScope scope (360);
+    return InstrumentNext ().UniformMatrix2dv (location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_UniformMatrix3dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    InstrumentScope scope (361);
+    return InstrumentNext ().UniformMatrix3dv (location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_UniformMatrix4dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    InstrumentScope scope (362);
+    return InstrumentNext ().UniformMatrix4dv (location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_UniformMatrix2x3dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    InstrumentScope scope (363);
+    return InstrumentNext ().UniformMatrix2x3dv (location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_UniformMatrix2x4dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    InstrumentScope scope (364);
+    return InstrumentNext ().UniformMatrix2x4dv (location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_UniformMatrix3x2dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    InstrumentScope scope (365);
+    return InstrumentNext ().UniformMatrix3x2dv (location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_UniformMatrix3x4dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    InstrumentScope scope (366);
+    return InstrumentNext ().UniformMatrix3x4dv (location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_UniformMatrix4x2dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    InstrumentScope scope (367);
+    return InstrumentNext ().UniformMatrix4x2dv (location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_UniformMatrix4x3dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    InstrumentScope scope (368);
+    return InstrumentNext ().UniformMatrix4x3dv (location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_GetUniformdv (GLuint program, GLint location, GLdouble *params)
+{
+    InstrumentScope scope (369);
+    return InstrumentNext ().GetUniformdv (program, location, params);
+}
+
+static GLint APIENTRY Instrument_GetSubroutineUniformLocation (GLuint program, GLenum shadertype, const GLchar *name)
+{
+    InstrumentScope scope (370);
+    return InstrumentNext ().GetSubroutineUniformLocation (program, shadertype, name);
+}
+
+static GLuint APIENTRY Instrument_GetSubroutineIndex (GLuint program, GLenum shadertype, const GLchar *name)
+{
+    InstrumentScope scope (371);
+    return InstrumentNext ().GetSubroutineIndex (program, shadertype, name);
+}
+
+static void APIENTRY Instrument_GetActiveSubroutineUniformiv (GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values)
+{
+    InstrumentScope scope (372);
+    return InstrumentNext ().GetActiveSubroutineUniformiv (program, shadertype, index, pname, values);
+}
+
+static void APIENTRY Instrument_GetActiveSubroutineUniformName (GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name)
+{
+    InstrumentScope scope (373);
+    return InstrumentNext ().GetActiveSubroutineUniformName (program, shadertype, index, bufsize, length, name);
+}
+
+static void APIENTRY Instrument_GetActiveSubroutineName (GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name)
+{
+    InstrumentScope scope (374);
+    return InstrumentNext ().GetActiveSubroutineName (program, shadertype, index, bufsize, length, name);
+}
+
+static void APIENTRY Instrument_UniformSubroutinesuiv (GLenum shadertype, GLsizei count, const GLuint *indices)
+{
+    InstrumentScope scope (375);
+    return InstrumentNext ().UniformSubroutinesuiv (shadertype, count, indices);
+}
+
+static void APIENTRY Instrument_GetUniformSubroutineuiv (GLenum shadertype, GLint location, GLuint *params)
+{
+    InstrumentScope scope (376);
+    return InstrumentNext ().GetUniformSubroutineuiv (shadertype, location, params);
+}
+
+static void APIENTRY Instrument_GetProgramStageiv (GLuint program, GLenum shadertype, GLenum pname, GLint *values)
+{
+    InstrumentScope scope (377);
+    return InstrumentNext ().GetProgramStageiv (program, shadertype, pname, values);
+}
+
+static void APIENTRY Instrument_PatchParameteri (GLenum pname, GLint value)
+{
+    InstrumentScope scope (378);
+    return InstrumentNext ().PatchParameteri (pname, value);
+}
+
+static void APIENTRY Instrument_PatchParameterfv (GLenum pname, const GLfloat *values)
+{
+    InstrumentScope scope (379);
+    return InstrumentNext ().PatchParameterfv (pname, values);
+}
+
+static void APIENTRY Instrument_BindTransformFeedback (GLenum target, GLuint id)
+{
+    InstrumentScope scope (380);
+    return InstrumentNext ().BindTransformFeedback (target, id);
+}
+
+static void APIENTRY Instrument_DeleteTransformFeedbacks (GLsizei n, const GLuint *ids)
+{
+    InstrumentScope scope (381);
+    return InstrumentNext ().DeleteTransformFeedbacks (n, ids);
+}
+
+static void APIENTRY Instrument_GenTransformFeedbacks (GLsizei n, GLuint *ids)
+{
+    InstrumentScope scope (382);
+    return InstrumentNext ().GenTransformFeedbacks (n, ids);
+}
+
+static GLboolean APIENTRY Instrument_IsTransformFeedback (GLuint id)
+{
+    InstrumentScope scope (383);
+    return InstrumentNext ().IsTransformFeedback (id);
+}
+
+static void APIENTRY Instrument_PauseTransformFeedback (void)
+{
+    InstrumentScope scope (384);
+    return InstrumentNext ().PauseTransformFeedback ();
+}
+
+static void APIENTRY Instrument_ResumeTransformFeedback (void)
+{
+    InstrumentScope scope (385);
+    return InstrumentNext ().ResumeTransformFeedback ();
+}
+
+static void APIENTRY Instrument_DrawTransformFeedback (GLenum mode, GLuint id)
+{
+    InstrumentScope scope (386);
+    return InstrumentNext ().DrawTransformFeedback (mode, id);
+}
+
+static void APIENTRY Instrument_DrawTransformFeedbackStream (GLenum mode, GLuint id, GLuint stream)
+{
+    InstrumentScope scope (387);
+    return InstrumentNext ().DrawTransformFeedbackStream (mode, id, stream);
+}
+
+static void APIENTRY Instrument_BeginQueryIndexed (GLenum target, GLuint index, GLuint id)
+{
+    InstrumentScope scope (388);
+    return InstrumentNext ().BeginQueryIndexed (target, index, id);
+}
+
+static void APIENTRY Instrument_EndQueryIndexed (GLenum target, GLuint index)
+{
+    InstrumentScope scope (389);
+    return InstrumentNext ().EndQueryIndexed (target, index);
+}
+
+static void APIENTRY Instrument_GetQueryIndexediv (GLenum target, GLuint index, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (390);
+    return InstrumentNext ().GetQueryIndexediv (target, index, pname, params);
+}
+
+static void APIENTRY Instrument_ReleaseShaderCompiler (void)
+{
+    InstrumentScope scope (391);
+    return InstrumentNext ().ReleaseShaderCompiler ();
+}
+
+static void APIENTRY Instrument_ShaderBinary (GLsizei count, const GLuint *shaders, GLenum binaryformat, const void *binary, GLsizei length)
+{
+    InstrumentScope scope (392);
+    return InstrumentNext ().ShaderBinary (count, shaders, binaryformat, binary, length);
+}
+
+static void APIENTRY Instrument_GetShaderPrecisionFormat (GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision)
+{
+    InstrumentScope scope (393);
+    return InstrumentNext ().GetShaderPrecisionFormat (shadertype, precisiontype, range, precision);
+}
+
+static void APIENTRY Instrument_DepthRangef (GLfloat n, GLfloat f)
+{
+    InstrumentScope scope (394);
+    return InstrumentNext ().DepthRangef (n, f);
+}
+
+static void APIENTRY Instrument_ClearDepthf (GLfloat d)
+{
+    InstrumentScope scope (395);
+    return InstrumentNext ().ClearDepthf (d);
+}
+
+static void APIENTRY Instrument_GetProgramBinary (GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary)
+{
+    InstrumentScope scope (396);
+    return InstrumentNext ().GetProgramBinary (program, bufSize, length, binaryFormat, binary);
+}
+
+static void APIENTRY Instrument_ProgramBinary (GLuint program, GLenum binaryFormat, const void *binary, GLsizei length)
+{
+    InstrumentScope scope (397);
+    return InstrumentNext ().ProgramBinary (program, binaryFormat, binary, length);
+}
+
+static void APIENTRY Instrument_ProgramParameteri (GLuint program, GLenum pname, GLint value)
+{
+    InstrumentScope scope (398);
+    return InstrumentNext ().ProgramParameteri (program, pname, value);
+}
+
+static void APIENTRY Instrument_UseProgramStages (GLuint pipeline, GLbitfield stages, GLuint program)
+{
+    InstrumentScope scope (399);
+    return InstrumentNext ().UseProgramStages (pipeline, stages, program);
+}
+
+static void APIENTRY Instrument_ActiveShaderProgram (GLuint pipeline, GLuint program)
+{
+    InstrumentScope scope (400);
+    return InstrumentNext ().ActiveShaderProgram (pipeline, program);
+}
+
+static GLuint APIENTRY Instrument_CreateShaderProgramv (GLenum type, GLsizei count, const GLchar *const*strings)
+{
+    InstrumentScope scope (401);
+    return InstrumentNext ().CreateShaderProgramv (type, count, strings);
+}
+
+static void APIENTRY Instrument_BindProgramPipeline (GLuint pipeline)
+{
+    InstrumentScope scope (402);
+    return InstrumentNext ().BindProgramPipeline (pipeline);
+}
+
+static void APIENTRY Instrument_DeleteProgramPipelines (GLsizei n, const GLuint *pipelines)
+{
+    InstrumentScope scope (403);
+    return InstrumentNext ().DeleteProgramPipelines (n, pipelines);
+}
+
+static void APIENTRY Instrument_GenProgramPipelines (GLsizei n, GLuint *pipelines)
+{
+    InstrumentScope scope (404);
+    return InstrumentNext ().GenProgramPipelines (n, pipelines);
+}
+
+static GLboolean APIENTRY Instrument_IsProgramPipeline (GLuint pipeline)
+{
+    InstrumentScope scope (405);
+    return InstrumentNext ().IsProgramPipeline (pipeline);
+}
+
+static void APIENTRY Instrument_GetProgramPipelineiv (GLuint pipeline, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (406);
+    return InstrumentNext ().GetProgramPipelineiv (pipeline, pname, params);
+}
+
+static void APIENTRY Instrument_ProgramUniform1i (GLuint program, GLint location, GLint v0)
+{
+    InstrumentScope scope (407);
+    return InstrumentNext ().ProgramUniform1i (program, location, v0);
+}
+
+static void APIENTRY Instrument_ProgramUniform1iv (GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+    InstrumentScope scope (408);
+    return InstrumentNext ().ProgramUniform1iv (program, location, count, value);
+}
+
+static void APIENTRY Instrument_ProgramUniform1f (GLuint program, GLint location, GLfloat v0)
+{
+    InstrumentScope scope (409);
+    return InstrumentNext ().ProgramUniform1f (program, location, v0);
+}
+
+static void APIENTRY Instrument_ProgramUniform1fv (GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+    InstrumentScope scope (410);
+    return InstrumentNext ().ProgramUniform1fv (program, location, count, value);
+}
+
+static void APIENTRY Instrument_ProgramUniform1d (GLuint program, GLint location, GLdouble v0)
+{
+    InstrumentScope scope (411);
+    return InstrumentNext ().ProgramUniform1d (program, location, v0);
+}
+
+static void APIENTRY Instrument_ProgramUniform1dv (GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+    InstrumentScope scope (412);
+    return InstrumentNext ().ProgramUniform1dv (program, location, count, value);
+}
+
+static void APIENTRY Instrument_ProgramUniform1ui (GLuint program, GLint location, GLuint v0)
+{
+    InstrumentScope scope (413);
+    return InstrumentNext ().ProgramUniform1ui (program, location, v0);
+}
+
+static void APIENTRY Instrument_ProgramUniform1uiv (GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+    InstrumentScope scope (414);
+    return InstrumentNext ().ProgramUniform1uiv (program, location, count, value);
+}
+
+static void APIENTRY Instrument_ProgramUniform2i (GLuint program, GLint location, GLint v0, GLint v1)
+{
+    InstrumentScope scope (415);
+    return InstrumentNext ().ProgramUniform2i (program, location, v0, v1);
+}
+
+static void APIENTRY Instrument_ProgramUniform2iv (GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+    InstrumentScope scope (416);
+    return InstrumentNext ().ProgramUniform2iv (program, location, count, value);
+}
+
+static void APIENTRY Instrument_ProgramUniform2f (GLuint program, GLint location, GLfloat v0, GLfloat v1)
+{
+    InstrumentScope scope (417);
+    return InstrumentNext ().ProgramUniform2f (program, location, v0, v1);
+}
+
+static void APIENTRY Instrument_ProgramUniform2fv (GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+    InstrumentScope scope (418);
+    return InstrumentNext ().ProgramUniform2fv (program, location, count, value);
+}
+
+static void APIENTRY Instrument_ProgramUniform2d (GLuint program, GLint location, GLdouble v0, GLdouble v1)
+{
+    InstrumentScope scope (419);
+    return InstrumentNext ().ProgramUniform2d (program, location, v0, v1);
+}
+
+static void APIENTRY Instrument_ProgramUniform2dv (GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+    InstrumentScope scope (420);
+    return InstrumentNext ().ProgramUniform2dv (program, location, count, value);
+}
+
+static void APIENTRY Instrument_ProgramUniform2ui (GLuint program, GLint location, GLuint v0, GLuint v1)
+{
+    InstrumentScope scope (421);
+    return InstrumentNext ().ProgramUniform2ui (program, location, v0, v1);
+}
+
+static void APIENTRY Instrument_ProgramUniform2uiv (GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+    InstrumentScope scope (422);
+    return InstrumentNext ().ProgramUniform2uiv (program, location, count, value);
+}
+
+static void APIENTRY Instrument_ProgramUniform3i (GLuint program, GLint location, GLint v0, GLint v1, GLint v2)
+{
+    InstrumentScope scope (423);
+    return InstrumentNext ().ProgramUniform3i (program, location, v0, v1, v2);
+}
+
+static void APIENTRY Instrument_ProgramUniform3iv (GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+    InstrumentScope scope (424);
+    return InstrumentNext ().ProgramUniform3iv (program, location, count, value);
+}
+
+static void APIENTRY Instrument_ProgramUniform3f (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    InstrumentScope scope (425);
+    return InstrumentNext ().ProgramUniform3f (program, location, v0, v1, v2);
+}
+
+static void APIENTRY Instrument_ProgramUniform3fv (GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+    InstrumentScope scope (426);
+    return InstrumentNext ().ProgramUniform3fv (program, location, count, value);
+}
+
+static void APIENTRY Instrument_ProgramUniform3d (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2)
+{
+    InstrumentScope scope (427);
+    return InstrumentNext ().ProgramUniform3d (program, location, v0, v1, v2);
+}
+
+static void APIENTRY Instrument_ProgramUniform3dv (GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+    InstrumentScope scope (428);
+    return InstrumentNext ().ProgramUniform3dv (program, location, count, value);
+}
+
+static void APIENTRY Instrument_ProgramUniform3ui (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+    InstrumentScope scope (429);
+    return InstrumentNext ().ProgramUniform3ui (program, location, v0, v1, v2);
+}
+
+static void APIENTRY Instrument_ProgramUniform3uiv (GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+    InstrumentScope scope (430);
+    return InstrumentNext ().ProgramUniform3uiv (program, location, count, value);
+}
+
+static void APIENTRY Instrument_ProgramUniform4i (GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    InstrumentScope scope (431);
+    return InstrumentNext ().ProgramUniform4i (program, location, v0, v1, v2, v3);
+}
+
+static void APIENTRY Instrument_ProgramUniform4iv (GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+    InstrumentScope scope (432);
+    return InstrumentNext ().ProgramUniform4iv (program, location, count, value);
+}
+
+static void APIENTRY Instrument_ProgramUniform4f (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+    InstrumentScope scope (433);
+    return InstrumentNext ().ProgramUniform4f (program, location, v0, v1, v2, v3);
+}
+
+static void APIENTRY Instrument_ProgramUniform4fv (GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+    InstrumentScope scope (434);
+    return InstrumentNext ().ProgramUniform4fv (program, location, count, value);
+}
+
+static void APIENTRY Instrument_ProgramUniform4d (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3)
+{
+    InstrumentScope scope (435);
+    return InstrumentNext ().ProgramUniform4d (program, location, v0, v1, v2, v3);
+}
+
+static void APIENTRY Instrument_ProgramUniform4dv (GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+    InstrumentScope scope (436);
+    return InstrumentNext ().ProgramUniform4dv (program, location, count, value);
+}
+
+static void APIENTRY Instrument_ProgramUniform4ui (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+    InstrumentScope scope (437);
+    return InstrumentNext ().ProgramUniform4ui (program, location, v0, v1, v2, v3);
+}
+
+static void APIENTRY Instrument_ProgramUniform4uiv (GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+    InstrumentScope scope (438);
+    return InstrumentNext ().ProgramUniform4uiv (program, location, count, value);
+}
+
+static void APIENTRY Instrument_ProgramUniformMatrix2fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    InstrumentScope scope (439);
+    return InstrumentNext ().ProgramUniformMatrix2fv (program, location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_ProgramUniformMatrix3fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    InstrumentScope scope (440);
+    return InstrumentNext ().ProgramUniformMatrix3fv (program, location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_ProgramUniformMatrix4fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    InstrumentScope scope (441);
+    return InstrumentNext ().ProgramUniformMatrix4fv (program, location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_ProgramUniformMatrix2dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    InstrumentScope scope (442);
+    return InstrumentNext ().ProgramUniformMatrix2dv (program, location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_ProgramUniformMatrix3dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    InstrumentScope scope (443);
+    return InstrumentNext ().ProgramUniformMatrix3dv (program, location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_ProgramUniformMatrix4dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    InstrumentScope scope (444);
+    return InstrumentNext ().ProgramUniformMatrix4dv (program, location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_ProgramUniformMatrix2x3fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    InstrumentScope scope (445);
+    return InstrumentNext ().ProgramUniformMatrix2x3fv (program, location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_ProgramUniformMatrix3x2fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    InstrumentScope scope (446);
+    return InstrumentNext ().ProgramUniformMatrix3x2fv (program, location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_ProgramUniformMatrix2x4fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    InstrumentScope scope (447);
+    return InstrumentNext ().ProgramUniformMatrix2x4fv (program, location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_ProgramUniformMatrix4x2fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    InstrumentScope scope (448);
+    return InstrumentNext ().ProgramUniformMatrix4x2fv (program, location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_ProgramUniformMatrix3x4fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    InstrumentScope scope (449);
+    return InstrumentNext ().ProgramUniformMatrix3x4fv (program, location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_ProgramUniformMatrix4x3fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    InstrumentScope scope (450);
+    return InstrumentNext ().ProgramUniformMatrix4x3fv (program, location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_ProgramUniformMatrix2x3dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    InstrumentScope scope (451);
+    return InstrumentNext ().ProgramUniformMatrix2x3dv (program, location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_ProgramUniformMatrix3x2dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    InstrumentScope scope (452);
+    return InstrumentNext ().ProgramUniformMatrix3x2dv (program, location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_ProgramUniformMatrix2x4dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    InstrumentScope scope (453);
+    return InstrumentNext ().ProgramUniformMatrix2x4dv (program, location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_ProgramUniformMatrix4x2dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    InstrumentScope scope (454);
+    return InstrumentNext ().ProgramUniformMatrix4x2dv (program, location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_ProgramUniformMatrix3x4dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    InstrumentScope scope (455);
+    return InstrumentNext ().ProgramUniformMatrix3x4dv (program, location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_ProgramUniformMatrix4x3dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    InstrumentScope scope (456);
+    return InstrumentNext ().ProgramUniformMatrix4x3dv (program, location, count, transpose, value);
+}
+
+static void APIENTRY Instrument_ValidateProgramPipeline (GLuint pipeline)
+{
+    InstrumentScope scope (457);
+    return InstrumentNext ().ValidateProgramPipeline (pipeline);
+}
+
+static void APIENTRY Instrument_GetProgramPipelineInfoLog (GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    InstrumentScope scope (458);
+    return InstrumentNext ().GetProgramPipelineInfoLog (pipeline, bufSize, length, infoLog);
+}
+
+static void APIENTRY Instrument_VertexAttribL1d (GLuint index, GLdouble x)
+{
+    InstrumentScope scope (459);
+    return InstrumentNext ().VertexAttribL1d (index, x);
+}
+
+static void APIENTRY Instrument_VertexAttribL2d (GLuint index, GLdouble x, GLdouble y)
+{
+    InstrumentScope scope (460);
+    return InstrumentNext ().VertexAttribL2d (index, x, y);
+}
+
+static void APIENTRY Instrument_VertexAttribL3d (GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+    InstrumentScope scope (461);
+    return InstrumentNext ().VertexAttribL3d (index, x, y, z);
+}
+
+static void APIENTRY Instrument_VertexAttribL4d (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    InstrumentScope scope (462);
+    return InstrumentNext ().VertexAttribL4d (index, x, y, z, w);
+}
+
+static void APIENTRY Instrument_VertexAttribL1dv (GLuint index, const GLdouble *v)
+{
+    InstrumentScope scope (463);
+    return InstrumentNext ().VertexAttribL1dv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttribL2dv (GLuint index, const GLdouble *v)
+{
+    InstrumentScope scope (464);
+    return InstrumentNext ().VertexAttribL2dv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttribL3dv (GLuint index, const GLdouble *v)
+{
+    InstrumentScope scope (465);
+    return InstrumentNext ().VertexAttribL3dv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttribL4dv (GLuint index, const GLdouble *v)
+{
+    InstrumentScope scope (466);
+    return InstrumentNext ().VertexAttribL4dv (index, v);
+}
+
+static void APIENTRY Instrument_VertexAttribLPointer (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+    InstrumentScope scope (467);
+    return InstrumentNext ().VertexAttribLPointer (index, size, type, stride, pointer);
+}
+
+static void APIENTRY Instrument_GetVertexAttribLdv (GLuint index, GLenum pname, GLdouble *params)
+{
+    InstrumentScope scope (468);
+    return InstrumentNext ().GetVertexAttribLdv (index, pname, params);
+}
+
+static void APIENTRY Instrument_ViewportArrayv (GLuint first, GLsizei count, const GLfloat *v)
+{
+    InstrumentScope scope (469);
+    return InstrumentNext ().ViewportArrayv (first, count, v);
+}
+
+static void APIENTRY Instrument_ViewportIndexedf (GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h)
+{
+    InstrumentScope scope (470);
+    return InstrumentNext ().ViewportIndexedf (index, x, y, w, h);
+}
+
+static void APIENTRY Instrument_ViewportIndexedfv (GLuint index, const GLfloat *v)
+{
+    InstrumentScope scope (471);
+    return InstrumentNext ().ViewportIndexedfv (index, v);
+}
+
+static void APIENTRY Instrument_ScissorArrayv (GLuint first, GLsizei count, const GLint *v)
+{
+    InstrumentScope scope (472);
+    return InstrumentNext ().ScissorArrayv (first, count, v);
+}
+
+static void APIENTRY Instrument_ScissorIndexed (GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height)
+{
+    InstrumentScope scope (473);
+    return InstrumentNext ().ScissorIndexed (index, left, bottom, width, height);
+}
+
+static void APIENTRY Instrument_ScissorIndexedv (GLuint index, const GLint *v)
+{
+    InstrumentScope scope (474);
+    return InstrumentNext ().ScissorIndexedv (index, v);
+}
+
+static void APIENTRY Instrument_DepthRangeArrayv (GLuint first, GLsizei count, const GLdouble *v)
+{
+    InstrumentScope scope (475);
+    return InstrumentNext ().DepthRangeArrayv (first, count, v);
+}
+
+static void APIENTRY Instrument_DepthRangeIndexed (GLuint index, GLdouble n, GLdouble f)
+{
+    InstrumentScope scope (476);
+    return InstrumentNext ().DepthRangeIndexed (index, n, f);
+}
+
+static void APIENTRY Instrument_GetFloati_v (GLenum target, GLuint index, GLfloat *data)
+{
+    InstrumentScope scope (477);
+    return InstrumentNext ().GetFloati_v (target, index, data);
+}
+
+static void APIENTRY Instrument_GetDoublei_v (GLenum target, GLuint index, GLdouble *data)
+{
+    InstrumentScope scope (478);
+    return InstrumentNext ().GetDoublei_v (target, index, data);
+}
+
+static void APIENTRY Instrument_DrawArraysInstancedBaseInstance (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance)
+{
+    InstrumentScope scope (479);
+    return InstrumentNext ().DrawArraysInstancedBaseInstance (mode, first, count, instancecount, baseinstance);
+}
+
+static void APIENTRY Instrument_DrawElementsInstancedBaseInstance (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance)
+{
+    InstrumentScope scope (480);
+    return InstrumentNext ().DrawElementsInstancedBaseInstance (mode, count, type, indices, instancecount, baseinstance);
+}
+
+static void APIENTRY Instrument_DrawElementsInstancedBaseVertexBaseInstance (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance)
+{
+    InstrumentScope scope (481);
+    return InstrumentNext ().DrawElementsInstancedBaseVertexBaseInstance (mode, count, type, indices, instancecount, basevertex, baseinstance);
+}
+
+static void APIENTRY Instrument_GetInternalformativ (GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint *params)
+{
+    InstrumentScope scope (482);
+    return InstrumentNext ().GetInternalformativ (target, internalformat, pname, bufSize, params);
+}
+
+static void APIENTRY Instrument_GetActiveAtomicCounterBufferiv (GLuint program, GLuint bufferIndex, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (483);
+    return InstrumentNext ().GetActiveAtomicCounterBufferiv (program, bufferIndex, pname, params);
+}
+
+static void APIENTRY Instrument_BindImageTexture (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format)
+{
+    InstrumentScope scope (484);
+    return InstrumentNext ().BindImageTexture (unit, texture, level, layered, layer, access, format);
+}
+
+static void APIENTRY Instrument_MemoryBarrier (GLbitfield barriers)
+{
+    InstrumentScope scope (485);
+    return InstrumentNext ().MemoryBarrier (barriers);
+}
+
+static void APIENTRY Instrument_TexStorage1D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width)
+{
+    InstrumentScope scope (486);
+    return InstrumentNext ().TexStorage1D (target, levels, internalformat, width);
+}
+
+static void APIENTRY Instrument_TexStorage2D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    InstrumentScope scope (487);
+    return InstrumentNext ().TexStorage2D (target, levels, internalformat, width, height);
+}
+
+static void APIENTRY Instrument_TexStorage3D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+    InstrumentScope scope (488);
+    return InstrumentNext ().TexStorage3D (target, levels, internalformat, width, height, depth);
+}
+
+static void APIENTRY Instrument_DrawTransformFeedbackInstanced (GLenum mode, GLuint id, GLsizei instancecount)
+{
+    InstrumentScope scope (489);
+    return InstrumentNext ().DrawTransformFeedbackInstanced (mode, id, instancecount);
+}
+
+static void APIENTRY Instrument_DrawTransformFeedbackStreamInstanced (GLenum mode, GLuint id, GLuint stream, GLsizei instancecount)
+{
+    InstrumentScope scope (490);
+    return InstrumentNext ().DrawTransformFeedbackStreamInstanced (mode, id, stream, instancecount);
+}
+
+static void APIENTRY Instrument_ClearBufferData (GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data)
+{
+    InstrumentScope scope (491);
+    return InstrumentNext ().ClearBufferData (target, internalformat, format, type, data);
+}
+
+static void APIENTRY Instrument_ClearBufferSubData (GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data)
+{
+    InstrumentScope scope (492);
+    return InstrumentNext ().ClearBufferSubData (target, internalformat, offset, size, format, type, data);
+}
+
+static void APIENTRY Instrument_DispatchCompute (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z)
+{
+    InstrumentScope scope (493);
+    return InstrumentNext ().DispatchCompute (num_groups_x, num_groups_y, num_groups_z);
+}
+
+static void APIENTRY Instrument_DispatchComputeIndirect (GLintptr indirect)
+{
+    InstrumentScope scope (494);
+    return InstrumentNext ().DispatchComputeIndirect (indirect);
+}
+
+static void APIENTRY Instrument_CopyImageSubData (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth)
+{
+    InstrumentScope scope (495);
+    return InstrumentNext ().CopyImageSubData (srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+}
+
+static void APIENTRY Instrument_FramebufferParameteri (GLenum target, GLenum pname, GLint param)
+{
+    InstrumentScope scope (496);
+    return InstrumentNext ().FramebufferParameteri (target, pname, param);
+}
+
+static void APIENTRY Instrument_GetFramebufferParameteriv (GLenum target, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (497);
+    return InstrumentNext ().GetFramebufferParameteriv (target, pname, params);
+}
+
+static void APIENTRY Instrument_GetInternalformati64v (GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint64 *params)
+{
+    InstrumentScope scope (498);
+    return InstrumentNext ().GetInternalformati64v (target, internalformat, pname, bufSize, params);
+}
+
+static void APIENTRY Instrument_InvalidateTexSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth)
+{
+    InstrumentScope scope (499);
+    return InstrumentNext ().InvalidateTexSubImage (texture, level, xoffset, yoffset, zoffset, width, height, depth);
+}
+
+static void APIENTRY Instrument_InvalidateTexImage (GLuint texture, GLint level)
+{
+    InstrumentScope scope (500);
+    return InstrumentNext ().InvalidateTexImage (texture, level);
+}
+
+static void APIENTRY Instrument_InvalidateBufferSubData (GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+    InstrumentScope scope (501);
+    return InstrumentNext ().InvalidateBufferSubData (buffer, offset, length);
+}
+
+static void APIENTRY Instrument_InvalidateBufferData (GLuint buffer)
+{
+    InstrumentScope scope (502);
+    return InstrumentNext ().InvalidateBufferData (buffer);
+}
+
+static void APIENTRY Instrument_InvalidateFramebuffer (GLenum target, GLsizei numAttachments, const GLenum *attachments)
+{
+    InstrumentScope scope (503);
+    return InstrumentNext ().InvalidateFramebuffer (target, numAttachments, attachments);
+}
+
+static void APIENTRY Instrument_InvalidateSubFramebuffer (GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    InstrumentScope scope (504);
+    return InstrumentNext ().InvalidateSubFramebuffer (target, numAttachments, attachments, x, y, width, height);
+}
+
+static void APIENTRY Instrument_MultiDrawArraysIndirect (GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride)
+{
+    InstrumentScope scope (505);
+    return InstrumentNext ().MultiDrawArraysIndirect (mode, indirect, drawcount, stride);
+}
+
+static void APIENTRY Instrument_MultiDrawElementsIndirect (GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride)
+{
+    InstrumentScope scope (506);
+    return InstrumentNext ().MultiDrawElementsIndirect (mode, type, indirect, drawcount, stride);
+}
+
+static void APIENTRY Instrument_GetProgramInterfaceiv (GLuint program, GLenum programInterface, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (507);
+    return InstrumentNext ().GetProgramInterfaceiv (program, programInterface, pname, params);
+}
+
+static GLuint APIENTRY Instrument_GetProgramResourceIndex (GLuint program, GLenum programInterface, const GLchar *name)
+{
+    InstrumentScope scope (508);
+    return InstrumentNext ().GetProgramResourceIndex (program, programInterface, name);
+}
+
+static void APIENTRY Instrument_GetProgramResourceName (GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name)
+{
+    InstrumentScope scope (509);
+    return InstrumentNext ().GetProgramResourceName (program, programInterface, index, bufSize, length, name);
+}
+
+static void APIENTRY Instrument_GetProgramResourceiv (GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei bufSize, GLsizei *length, GLint *params)
+{
+    InstrumentScope scope (510);
+    return InstrumentNext ().GetProgramResourceiv (program, programInterface, index, propCount, props, bufSize, length, params);
+}
+
+static GLint APIENTRY Instrument_GetProgramResourceLocation (GLuint program, GLenum programInterface, const GLchar *name)
+{
+    InstrumentScope scope (511);
+    return InstrumentNext ().GetProgramResourceLocation (program, programInterface, name);
+}
+
+static GLint APIENTRY Instrument_GetProgramResourceLocationIndex (GLuint program, GLenum programInterface, const GLchar *name)
+{
+    InstrumentScope scope (512);
+    return InstrumentNext ().GetProgramResourceLocationIndex (program, programInterface, name);
+}
+
+static void APIENTRY Instrument_ShaderStorageBlockBinding (GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding)
+{
+    InstrumentScope scope (513);
+    return InstrumentNext ().ShaderStorageBlockBinding (program, storageBlockIndex, storageBlockBinding);
+}
+
+static void APIENTRY Instrument_TexBufferRange (GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    InstrumentScope scope (514);
+    return InstrumentNext ().TexBufferRange (target, internalformat, buffer, offset, size);
+}
+
+static void APIENTRY Instrument_TexStorage2DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+    InstrumentScope scope (515);
+    return InstrumentNext ().TexStorage2DMultisample (target, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static void APIENTRY Instrument_TexStorage3DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+    InstrumentScope scope (516);
+    return InstrumentNext ().TexStorage3DMultisample (target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+static void APIENTRY Instrument_TextureView (GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers)
+{
+    InstrumentScope scope (517);
+    return InstrumentNext ().TextureView (texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+}
+
+static void APIENTRY Instrument_BindVertexBuffer (GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+    InstrumentScope scope (518);
+    return InstrumentNext ().BindVertexBuffer (bindingindex, buffer, offset, stride);
+}
+
+static void APIENTRY Instrument_VertexAttribFormat (GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
+{
+    InstrumentScope scope (519);
+    return InstrumentNext ().VertexAttribFormat (attribindex, size, type, normalized, relativeoffset);
+}
+
+static void APIENTRY Instrument_VertexAttribIFormat (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    InstrumentScope scope (520);
+    return InstrumentNext ().VertexAttribIFormat (attribindex, size, type, relativeoffset);
+}
+
+static void APIENTRY Instrument_VertexAttribLFormat (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    InstrumentScope scope (521);
+    return InstrumentNext ().VertexAttribLFormat (attribindex, size, type, relativeoffset);
+}
+
+static void APIENTRY Instrument_VertexAttribBinding (GLuint attribindex, GLuint bindingindex)
+{
+    InstrumentScope scope (522);
+    return InstrumentNext ().VertexAttribBinding (attribindex, bindingindex);
+}
+
+static void APIENTRY Instrument_VertexBindingDivisor (GLuint bindingindex, GLuint divisor)
+{
+    InstrumentScope scope (523);
+    return InstrumentNext ().VertexBindingDivisor (bindingindex, divisor);
+}
+
+static void APIENTRY Instrument_DebugMessageControl (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled)
+{
+    InstrumentScope scope (524);
+    return InstrumentNext ().DebugMessageControl (source, type, severity, count, ids, enabled);
+}
+
+static void APIENTRY Instrument_DebugMessageInsert (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf)
+{
+    InstrumentScope scope (525);
+    return InstrumentNext ().DebugMessageInsert (source, type, id, severity, length, buf);
+}
+
+static void APIENTRY Instrument_DebugMessageCallback (GLDEBUGPROC callback, const void *userParam)
+{
+    InstrumentScope scope (526);
+    return InstrumentNext ().DebugMessageCallback (callback, userParam);
+}
+
+static GLuint APIENTRY Instrument_GetDebugMessageLog (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog)
+{
+    InstrumentScope scope (527);
+    return InstrumentNext ().GetDebugMessageLog (count, bufSize, sources, types, ids, severities, lengths, messageLog);
+}
+
+static void APIENTRY Instrument_PushDebugGroup (GLenum source, GLuint id, GLsizei length, const GLchar *message)
+{
+    InstrumentScope scope (528);
+    return InstrumentNext ().PushDebugGroup (source, id, length, message);
+}
+
+static void APIENTRY Instrument_PopDebugGroup (void)
+{
+    InstrumentScope scope (529);
+    return InstrumentNext ().PopDebugGroup ();
+}
+
+static void APIENTRY Instrument_ObjectLabel (GLenum identifier, GLuint name, GLsizei length, const GLchar *label)
+{
+    InstrumentScope scope (530);
+    return InstrumentNext ().ObjectLabel (identifier, name, length, label);
+}
+
+static void APIENTRY Instrument_GetObjectLabel (GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label)
+{
+    InstrumentScope scope (531);
+    return InstrumentNext ().GetObjectLabel (identifier, name, bufSize, length, label);
+}
+
+static void APIENTRY Instrument_ObjectPtrLabel (const void *ptr, GLsizei length, const GLchar *label)
+{
+    InstrumentScope scope (532);
+    return InstrumentNext ().ObjectPtrLabel (ptr, length, label);
+}
+
+static void APIENTRY Instrument_GetObjectPtrLabel (const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label)
+{
+    InstrumentScope scope (533);
+    return InstrumentNext ().GetObjectPtrLabel (ptr, bufSize, length, label);
+}
+
+static void APIENTRY Instrument_BufferStorage (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags)
+{
+    InstrumentScope scope (534);
+    return InstrumentNext ().BufferStorage (target, size, data, flags);
+}
+
+static void APIENTRY Instrument_ClearTexImage (GLuint texture, GLint level, GLenum format, GLenum type, const void *data)
+{
+    InstrumentScope scope (535);
+    return InstrumentNext ().ClearTexImage (texture, level, format, type, data);
+}
+
+static void APIENTRY Instrument_ClearTexSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data)
+{
+    InstrumentScope scope (536);
+    return InstrumentNext ().ClearTexSubImage (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+}
+
+static void APIENTRY Instrument_BindBuffersBase (GLenum target, GLuint first, GLsizei count, const GLuint *buffers)
+{
+    InstrumentScope scope (537);
+    return InstrumentNext ().BindBuffersBase (target, first, count, buffers);
+}
+
+static void APIENTRY Instrument_BindBuffersRange (GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes)
+{
+    InstrumentScope scope (538);
+    return InstrumentNext ().BindBuffersRange (target, first, count, buffers, offsets, sizes);
+}
+
+static void APIENTRY Instrument_BindTextures (GLuint first, GLsizei count, const GLuint *textures)
+{
+    InstrumentScope scope (539);
+    return InstrumentNext ().BindTextures (first, count, textures);
+}
+
+static void APIENTRY Instrument_BindSamplers (GLuint first, GLsizei count, const GLuint *samplers)
+{
+    InstrumentScope scope (540);
+    return InstrumentNext ().BindSamplers (first, count, samplers);
+}
+
+static void APIENTRY Instrument_BindImageTextures (GLuint first, GLsizei count, const GLuint *textures)
+{
+    InstrumentScope scope (541);
+    return InstrumentNext ().BindImageTextures (first, count, textures);
+}
+
+static void APIENTRY Instrument_BindVertexBuffers (GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides)
+{
+    InstrumentScope scope (542);
+    return InstrumentNext ().BindVertexBuffers (first, count, buffers, offsets, strides);
+}
+
+static void APIENTRY Instrument_ClipControl (GLenum origin, GLenum depth)
+{
+    InstrumentScope scope (543);
+    return InstrumentNext ().ClipControl (origin, depth);
+}
+
+static void APIENTRY Instrument_CreateTransformFeedbacks (GLsizei n, GLuint *ids)
+{
+    InstrumentScope scope (544);
+    return InstrumentNext ().CreateTransformFeedbacks (n, ids);
+}
+
+static void APIENTRY Instrument_TransformFeedbackBufferBase (GLuint xfb, GLuint index, GLuint buffer)
+{
+    InstrumentScope scope (545);
+    return InstrumentNext ().TransformFeedbackBufferBase (xfb, index, buffer);
+}
+
+static void APIENTRY Instrument_TransformFeedbackBufferRange (GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    InstrumentScope scope (546);
+    return InstrumentNext ().TransformFeedbackBufferRange (xfb, index, buffer, offset, size);
+}
+
+static void APIENTRY Instrument_GetTransformFeedbackiv (GLuint xfb, GLenum pname, GLint *param)
+{
+    InstrumentScope scope (547);
+    return InstrumentNext ().GetTransformFeedbackiv (xfb, pname, param);
+}
+
+static void APIENTRY Instrument_GetTransformFeedbacki_v (GLuint xfb, GLenum pname, GLuint index, GLint *param)
+{
+    InstrumentScope scope (548);
+    return InstrumentNext ().GetTransformFeedbacki_v (xfb, pname, index, param);
+}
+
+static void APIENTRY Instrument_GetTransformFeedbacki64_v (GLuint xfb, GLenum pname, GLuint index, GLint64 *param)
+{
+    InstrumentScope scope (549);
+    return InstrumentNext ().GetTransformFeedbacki64_v (xfb, pname, index, param);
+}
+
+static void APIENTRY Instrument_CreateBuffers (GLsizei n, GLuint *buffers)
+{
+    InstrumentScope scope (550);
+    return InstrumentNext ().CreateBuffers (n, buffers);
+}
+
+static void APIENTRY Instrument_NamedBufferStorage (GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags)
+{
+    InstrumentScope scope (551);
+    return InstrumentNext ().NamedBufferStorage (buffer, size, data, flags);
+}
+
+static void APIENTRY Instrument_NamedBufferData (GLuint buffer, GLsizeiptr size, const void *data, GLenum usage)
+{
+    InstrumentScope scope (552);
+    return InstrumentNext ().NamedBufferData (buffer, size, data, usage);
+}
+
+static void APIENTRY Instrument_NamedBufferSubData (GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    InstrumentScope scope (553);
+    return InstrumentNext ().NamedBufferSubData (buffer, offset, size, data);
+}
+
+static void APIENTRY Instrument_CopyNamedBufferSubData (GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+    InstrumentScope scope (554);
+    return InstrumentNext ().CopyNamedBufferSubData (readBuffer, writeBuffer, readOffset, writeOffset, size);
+}
+
+static void APIENTRY Instrument_ClearNamedBufferData (GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data)
+{
+    InstrumentScope scope (555);
+    return InstrumentNext ().ClearNamedBufferData (buffer, internalformat, format, type, data);
+}
+
+static void APIENTRY Instrument_ClearNamedBufferSubData (GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data)
+{
+    InstrumentScope scope (556);
+    return InstrumentNext ().ClearNamedBufferSubData (buffer, internalformat, offset, size, format, type, data);
+}
+
+static void * APIENTRY Instrument_MapNamedBuffer (GLuint buffer, GLenum access)
+{
+    InstrumentScope scope (557);
+    return InstrumentNext ().MapNamedBuffer (buffer, access);
+}
+
+static void * APIENTRY Instrument_MapNamedBufferRange (GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    InstrumentScope scope (558);
+    return InstrumentNext ().MapNamedBufferRange (buffer, offset, length, access);
+}
+
+static GLboolean APIENTRY Instrument_UnmapNamedBuffer (GLuint buffer)
+{
+    InstrumentScope scope (559);
+    return InstrumentNext ().UnmapNamedBuffer (buffer);
+}
+
+static void APIENTRY Instrument_FlushMappedNamedBufferRange (GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+    InstrumentScope scope (560);
+    return InstrumentNext ().FlushMappedNamedBufferRange (buffer, offset, length);
+}
+
+static void APIENTRY Instrument_GetNamedBufferParameteriv (GLuint buffer, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (561);
+    return InstrumentNext ().GetNamedBufferParameteriv (buffer, pname, params);
+}
+
+static void APIENTRY Instrument_GetNamedBufferParameteri64v (GLuint buffer, GLenum pname, GLint64 *params)
+{
+    InstrumentScope scope (562);
+    return InstrumentNext ().GetNamedBufferParameteri64v (buffer, pname, params);
+}
+
+static void APIENTRY Instrument_GetNamedBufferPointerv (GLuint buffer, GLenum pname, void **params)
+{
+    InstrumentScope scope (563);
+    return InstrumentNext ().GetNamedBufferPointerv (buffer, pname, params);
+}
+
+static void APIENTRY Instrument_GetNamedBufferSubData (GLuint buffer, GLintptr offset, GLsizeiptr size, void *data)
+{
+    InstrumentScope scope (564);
+    return InstrumentNext ().GetNamedBufferSubData (buffer, offset, size, data);
+}
+
+static void APIENTRY Instrument_CreateFramebuffers (GLsizei n, GLuint *framebuffers)
+{
+    InstrumentScope scope (565);
+    return InstrumentNext ().CreateFramebuffers (n, framebuffers);
+}
+
+static void APIENTRY Instrument_NamedFramebufferRenderbuffer (GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+    InstrumentScope scope (566);
+    return InstrumentNext ().NamedFramebufferRenderbuffer (framebuffer, attachment, renderbuffertarget, renderbuffer);
+}
+
+static void APIENTRY Instrument_NamedFramebufferParameteri (GLuint framebuffer, GLenum pname, GLint param)
+{
+    InstrumentScope scope (567);
+    return InstrumentNext ().NamedFramebufferParameteri (framebuffer, pname, param);
+}
+
+static void APIENTRY Instrument_NamedFramebufferTexture (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level)
+{
+    InstrumentScope scope (568);
+    return InstrumentNext ().NamedFramebufferTexture (framebuffer, attachment, texture, level);
+}
+
+static void APIENTRY Instrument_NamedFramebufferTextureLayer (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+    InstrumentScope scope (569);
+    return InstrumentNext ().NamedFramebufferTextureLayer (framebuffer, attachment, texture, level, layer);
+}
+
+static void APIENTRY Instrument_NamedFramebufferDrawBuffer (GLuint framebuffer, GLenum buf)
+{
+    InstrumentScope scope (570);
+    return InstrumentNext ().NamedFramebufferDrawBuffer (framebuffer, buf);
+}
+
+static void APIENTRY Instrument_NamedFramebufferDrawBuffers (GLuint framebuffer, GLsizei n, const GLenum *bufs)
+{
+    InstrumentScope scope (571);
+    return InstrumentNext ().NamedFramebufferDrawBuffers (framebuffer, n, bufs);
+}
+
+static void APIENTRY Instrument_NamedFramebufferReadBuffer (GLuint framebuffer, GLenum src)
+{
+    InstrumentScope scope (572);
+    return InstrumentNext ().NamedFramebufferReadBuffer (framebuffer, src);
+}
+
+static void APIENTRY Instrument_InvalidateNamedFramebufferData (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments)
+{
+    InstrumentScope scope (573);
+    return InstrumentNext ().InvalidateNamedFramebufferData (framebuffer, numAttachments, attachments);
+}
+
+static void APIENTRY Instrument_InvalidateNamedFramebufferSubData (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    InstrumentScope scope (574);
+    return InstrumentNext ().InvalidateNamedFramebufferSubData (framebuffer, numAttachments, attachments, x, y, width, height);
+}
+
+static void APIENTRY Instrument_ClearNamedFramebufferiv (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value)
+{
+    InstrumentScope scope (575);
+    return InstrumentNext ().ClearNamedFramebufferiv (framebuffer, buffer, drawbuffer, value);
+}
+
+static void APIENTRY Instrument_ClearNamedFramebufferuiv (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value)
+{
+    InstrumentScope scope (576);
+    return InstrumentNext ().ClearNamedFramebufferuiv (framebuffer, buffer, drawbuffer, value);
+}
+
+static void APIENTRY Instrument_ClearNamedFramebufferfv (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value)
+{
+    InstrumentScope scope (577);
+    return InstrumentNext ().ClearNamedFramebufferfv (framebuffer, buffer, drawbuffer, value);
+}
+
+static void APIENTRY Instrument_ClearNamedFramebufferfi (GLuint framebuffer, GLenum buffer, const GLfloat depth, GLint stencil)
+{
+    InstrumentScope scope (578);
+    return InstrumentNext ().ClearNamedFramebufferfi (framebuffer, buffer, depth, stencil);
+}
+
+static void APIENTRY Instrument_BlitNamedFramebuffer (GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+    InstrumentScope scope (579);
+    return InstrumentNext ().BlitNamedFramebuffer (readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+static GLenum APIENTRY Instrument_CheckNamedFramebufferStatus (GLuint framebuffer, GLenum target)
+{
+    InstrumentScope scope (580);
+    return InstrumentNext ().CheckNamedFramebufferStatus (framebuffer, target);
+}
+
+static void APIENTRY Instrument_GetNamedFramebufferParameteriv (GLuint framebuffer, GLenum pname, GLint *param)
+{
+    InstrumentScope scope (581);
+    return InstrumentNext ().GetNamedFramebufferParameteriv (framebuffer, pname, param);
+}
+
+static void APIENTRY Instrument_GetNamedFramebufferAttachmentParameteriv (GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (582);
+    return InstrumentNext ().GetNamedFramebufferAttachmentParameteriv (framebuffer, attachment, pname, params);
+}
+
+static void APIENTRY Instrument_CreateRenderbuffers (GLsizei n, GLuint *renderbuffers)
+{
+    InstrumentScope scope (583);
+    return InstrumentNext ().CreateRenderbuffers (n, renderbuffers);
+}
+
+static void APIENTRY Instrument_NamedRenderbufferStorage (GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    InstrumentScope scope (584);
+    return InstrumentNext ().NamedRenderbufferStorage (renderbuffer, internalformat, width, height);
+}
+
+static void APIENTRY Instrument_NamedRenderbufferStorageMultisample (GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    InstrumentScope scope (585);
+    return InstrumentNext ().NamedRenderbufferStorageMultisample (renderbuffer, samples, internalformat, width, height);
+}
+
+static void APIENTRY Instrument_GetNamedRenderbufferParameteriv (GLuint renderbuffer, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (586);
+    return InstrumentNext ().GetNamedRenderbufferParameteriv (renderbuffer, pname, params);
+}
+
+static void APIENTRY Instrument_CreateTextures (GLenum target, GLsizei n, GLuint *textures)
+{
+    InstrumentScope scope (587);
+    return InstrumentNext ().CreateTextures (target, n, textures);
+}
+
+static void APIENTRY Instrument_TextureBuffer (GLuint texture, GLenum internalformat, GLuint buffer)
+{
+    InstrumentScope scope (588);
+    return InstrumentNext ().TextureBuffer (texture, internalformat, buffer);
+}
+
+static void APIENTRY Instrument_TextureBufferRange (GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    InstrumentScope scope (589);
+    return InstrumentNext ().TextureBufferRange (texture, internalformat, buffer, offset, size);
+}
+
+static void APIENTRY Instrument_TextureStorage1D (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width)
+{
+    InstrumentScope scope (590);
+    return InstrumentNext ().TextureStorage1D (texture, levels, internalformat, width);
+}
+
+static void APIENTRY Instrument_TextureStorage2D (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    InstrumentScope scope (591);
+    return InstrumentNext ().TextureStorage2D (texture, levels, internalformat, width, height);
+}
+
+static void APIENTRY Instrument_TextureStorage3D (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+    InstrumentScope scope (592);
+    return InstrumentNext ().TextureStorage3D (texture, levels, internalformat, width, height, depth);
+}
+
+static void APIENTRY Instrument_TextureStorage2DMultisample (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+    InstrumentScope scope (593);
+    return InstrumentNext ().TextureStorage2DMultisample (texture, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static void APIENTRY Instrument_TextureStorage3DMultisample (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+    InstrumentScope scope (594);
+    return InstrumentNext ().TextureStorage3DMultisample (texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+static void APIENTRY Instrument_TextureSubImage1D (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels)
+{
+    InstrumentScope scope (595);
+    return InstrumentNext ().TextureSubImage1D (texture, level, xoffset, width, format, type, pixels);
+}
+
+static void APIENTRY Instrument_TextureSubImage2D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+    InstrumentScope scope (596);
+    return InstrumentNext ().TextureSubImage2D (texture, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+static void APIENTRY Instrument_TextureSubImage3D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels)
+{
+    InstrumentScope scope (597);
+    return InstrumentNext ().TextureSubImage3D (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
+static void APIENTRY Instrument_CompressedTextureSubImage1D (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
+{
+    InstrumentScope scope (598);
+    return InstrumentNext ().CompressedTextureSubImage1D (texture, level, xoffset, width, format, imageSize, data);
+}
+
+static void APIENTRY Instrument_CompressedTextureSubImage2D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+{
+    InstrumentScope scope (599);
+    return InstrumentNext ().CompressedTextureSubImage2D (texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+
+static void APIENTRY Instrument_CompressedTextureSubImage3D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+{
+    InstrumentScope scope (600);
+    return InstrumentNext ().CompressedTextureSubImage3D (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+
+static void APIENTRY Instrument_CopyTextureSubImage1D (GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+    InstrumentScope scope (601);
+    return InstrumentNext ().CopyTextureSubImage1D (texture, level, xoffset, x, y, width);
+}
+
+static void APIENTRY Instrument_CopyTextureSubImage2D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    InstrumentScope scope (602);
+    return InstrumentNext ().CopyTextureSubImage2D (texture, level, xoffset, yoffset, x, y, width, height);
+}
+
+static void APIENTRY Instrument_CopyTextureSubImage3D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    InstrumentScope scope (603);
+    return InstrumentNext ().CopyTextureSubImage3D (texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+static void APIENTRY Instrument_TextureParameterf (GLuint texture, GLenum pname, GLfloat param)
+{
+    InstrumentScope scope (604);
+    return InstrumentNext ().TextureParameterf (texture, pname, param);
+}
+
+static void APIENTRY Instrument_TextureParameterfv (GLuint texture, GLenum pname, const GLfloat *param)
+{
+    InstrumentScope scope (605);
+    return InstrumentNext ().TextureParameterfv (texture, pname, param);
+}
+
+static void APIENTRY Instrument_TextureParameteri (GLuint texture, GLenum pname, GLint param)
+{
+    InstrumentScope scope (606);
+    return InstrumentNext ().TextureParameteri (texture, pname, param);
+}
+
+static void APIENTRY Instrument_TextureParameterIiv (GLuint texture, GLenum pname, const GLint *params)
+{
+    InstrumentScope scope (607);
+    return InstrumentNext ().TextureParameterIiv (texture, pname, params);
+}
+
+static void APIENTRY Instrument_TextureParameterIuiv (GLuint texture, GLenum pname, const GLuint *params)
+{
+    InstrumentScope scope (608);
+    return InstrumentNext ().TextureParameterIuiv (texture, pname, params);
+}
+
+static void APIENTRY Instrument_TextureParameteriv (GLuint texture, GLenum pname, const GLint *param)
+{
+    InstrumentScope scope (609);
+    return InstrumentNext ().TextureParameteriv (texture, pname, param);
+}
+
+static void APIENTRY Instrument_GenerateTextureMipmap (GLuint texture)
+{
+    InstrumentScope scope (610);
+    return InstrumentNext ().GenerateTextureMipmap (texture);
+}
+
+static void APIENTRY Instrument_BindTextureUnit (GLuint unit, GLuint texture)
+{
+    InstrumentScope scope (611);
+    return InstrumentNext ().BindTextureUnit (unit, texture);
+}
+
+static void APIENTRY Instrument_GetTextureImage (GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+    InstrumentScope scope (612);
+    return InstrumentNext ().GetTextureImage (texture, level, format, type, bufSize, pixels);
+}
+
+static void APIENTRY Instrument_GetCompressedTextureImage (GLuint texture, GLint level, GLsizei bufSize, void *pixels)
+{
+    InstrumentScope scope (613);
+    return InstrumentNext ().GetCompressedTextureImage (texture, level, bufSize, pixels);
+}
+
+static void APIENTRY Instrument_GetTextureLevelParameterfv (GLuint texture, GLint level, GLenum pname, GLfloat *params)
+{
+    InstrumentScope scope (614);
+    return InstrumentNext ().GetTextureLevelParameterfv (texture, level, pname, params);
+}
+
+static void APIENTRY Instrument_GetTextureLevelParameteriv (GLuint texture, GLint level, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (615);
+    return InstrumentNext ().GetTextureLevelParameteriv (texture, level, pname, params);
+}
+
+static void APIENTRY Instrument_GetTextureParameterfv (GLuint texture, GLenum pname, GLfloat *params)
+{
+    InstrumentScope scope (616);
+    return InstrumentNext ().GetTextureParameterfv (texture, pname, params);
+}
+
+static void APIENTRY Instrument_GetTextureParameterIiv (GLuint texture, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (617);
+    return InstrumentNext ().GetTextureParameterIiv (texture, pname, params);
+}
+
+static void APIENTRY Instrument_GetTextureParameterIuiv (GLuint texture, GLenum pname, GLuint *params)
+{
+    InstrumentScope scope (618);
+    return InstrumentNext ().GetTextureParameterIuiv (texture, pname, params);
+}
+
+static void APIENTRY Instrument_GetTextureParameteriv (GLuint texture, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (619);
+    return InstrumentNext ().GetTextureParameteriv (texture, pname, params);
+}
+
+static void APIENTRY Instrument_CreateVertexArrays (GLsizei n, GLuint *arrays)
+{
+    InstrumentScope scope (620);
+    return InstrumentNext ().CreateVertexArrays (n, arrays);
+}
+
+static void APIENTRY Instrument_DisableVertexArrayAttrib (GLuint vaobj, GLuint index)
+{
+    InstrumentScope scope (621);
+    return InstrumentNext ().DisableVertexArrayAttrib (vaobj, index);
+}
+
+static void APIENTRY Instrument_EnableVertexArrayAttrib (GLuint vaobj, GLuint index)
+{
+    InstrumentScope scope (622);
+    return InstrumentNext ().EnableVertexArrayAttrib (vaobj, index);
+}
+
+static void APIENTRY Instrument_VertexArrayElementBuffer (GLuint vaobj, GLuint buffer)
+{
+    InstrumentScope scope (623);
+    return InstrumentNext ().VertexArrayElementBuffer (vaobj, buffer);
+}
+
+static void APIENTRY Instrument_VertexArrayVertexBuffer (GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+    InstrumentScope scope (624);
+    return InstrumentNext ().VertexArrayVertexBuffer (vaobj, bindingindex, buffer, offset, stride);
+}
+
+static void APIENTRY Instrument_VertexArrayVertexBuffers (GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides)
+{
+    InstrumentScope scope (625);
+    return InstrumentNext ().VertexArrayVertexBuffers (vaobj, first, count, buffers, offsets, strides);
+}
+
+static void APIENTRY Instrument_VertexArrayAttribBinding (GLuint vaobj, GLuint attribindex, GLuint bindingindex)
+{
+    InstrumentScope scope (626);
+    return InstrumentNext ().VertexArrayAttribBinding (vaobj, attribindex, bindingindex);
+}
+
+static void APIENTRY Instrument_VertexArrayAttribFormat (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
+{
+    InstrumentScope scope (627);
+    return InstrumentNext ().VertexArrayAttribFormat (vaobj, attribindex, size, type, normalized, relativeoffset);
+}
+
+static void APIENTRY Instrument_VertexArrayAttribIFormat (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    InstrumentScope scope (628);
+    return InstrumentNext ().VertexArrayAttribIFormat (vaobj, attribindex, size, type, relativeoffset);
+}
+
+static void APIENTRY Instrument_VertexArrayAttribLFormat (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    InstrumentScope scope (629);
+    return InstrumentNext ().VertexArrayAttribLFormat (vaobj, attribindex, size, type, relativeoffset);
+}
+
+static void APIENTRY Instrument_VertexArrayBindingDivisor (GLuint vaobj, GLuint bindingindex, GLuint divisor)
+{
+    InstrumentScope scope (630);
+    return InstrumentNext ().VertexArrayBindingDivisor (vaobj, bindingindex, divisor);
+}
+
+static void APIENTRY Instrument_GetVertexArrayiv (GLuint vaobj, GLenum pname, GLint *param)
+{
+    InstrumentScope scope (631);
+    return InstrumentNext ().GetVertexArrayiv (vaobj, pname, param);
+}
+
+static void APIENTRY Instrument_GetVertexArrayIndexediv (GLuint vaobj, GLuint index, GLenum pname, GLint *param)
+{
+    InstrumentScope scope (632);
+    return InstrumentNext ().GetVertexArrayIndexediv (vaobj, index, pname, param);
+}
+
+static void APIENTRY Instrument_GetVertexArrayIndexed64iv (GLuint vaobj, GLuint index, GLenum pname, GLint64 *param)
+{
+    InstrumentScope scope (633);
+    return InstrumentNext ().GetVertexArrayIndexed64iv (vaobj, index, pname, param);
+}
+
+static void APIENTRY Instrument_CreateSamplers (GLsizei n, GLuint *samplers)
+{
+    InstrumentScope scope (634);
+    return InstrumentNext ().CreateSamplers (n, samplers);
+}
+
+static void APIENTRY Instrument_CreateProgramPipelines (GLsizei n, GLuint *pipelines)
+{
+    InstrumentScope scope (635);
+    return InstrumentNext ().CreateProgramPipelines (n, pipelines);
+}
+
+static void APIENTRY Instrument_CreateQueries (GLenum target, GLsizei n, GLuint *ids)
+{
+    InstrumentScope scope (636);
+    return InstrumentNext ().CreateQueries (target, n, ids);
+}
+
+static void APIENTRY Instrument_GetQueryBufferObjecti64v (GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    InstrumentScope scope (637);
+    return InstrumentNext ().GetQueryBufferObjecti64v (id, buffer, pname, offset);
+}
+
+static void APIENTRY Instrument_GetQueryBufferObjectiv (GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    InstrumentScope scope (638);
+    return InstrumentNext ().GetQueryBufferObjectiv (id, buffer, pname, offset);
+}
+
+static void APIENTRY Instrument_GetQueryBufferObjectui64v (GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    InstrumentScope scope (639);
+    return InstrumentNext ().GetQueryBufferObjectui64v (id, buffer, pname, offset);
+}
+
+static void APIENTRY Instrument_GetQueryBufferObjectuiv (GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    InstrumentScope scope (640);
+    return InstrumentNext ().GetQueryBufferObjectuiv (id, buffer, pname, offset);
+}
+
+static void APIENTRY Instrument_MemoryBarrierByRegion (GLbitfield barriers)
+{
+    InstrumentScope scope (641);
+    return InstrumentNext ().MemoryBarrierByRegion (barriers);
+}
+
+static void APIENTRY Instrument_GetTextureSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+    InstrumentScope scope (642);
+    return InstrumentNext ().GetTextureSubImage (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+}
+
+static void APIENTRY Instrument_GetCompressedTextureSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels)
+{
+    InstrumentScope scope (643);
+    return InstrumentNext ().GetCompressedTextureSubImage (texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+}
+
+static GLenum APIENTRY Instrument_GetGraphicsResetStatus (void)
+{
+    InstrumentScope scope (644);
+    return InstrumentNext ().GetGraphicsResetStatus ();
+}
+
+static void APIENTRY Instrument_GetnCompressedTexImage (GLenum target, GLint lod, GLsizei bufSize, void *pixels)
+{
+    InstrumentScope scope (645);
+    return InstrumentNext ().GetnCompressedTexImage (target, lod, bufSize, pixels);
+}
+
+static void APIENTRY Instrument_GetnTexImage (GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+    InstrumentScope scope (646);
+    return InstrumentNext ().GetnTexImage (target, level, format, type, bufSize, pixels);
+}
+
+static void APIENTRY Instrument_GetnUniformdv (GLuint program, GLint location, GLsizei bufSize, GLdouble *params)
+{
+    InstrumentScope scope (647);
+    return InstrumentNext ().GetnUniformdv (program, location, bufSize, params);
+}
+
+static void APIENTRY Instrument_GetnUniformfv (GLuint program, GLint location, GLsizei bufSize, GLfloat *params)
+{
+    InstrumentScope scope (648);
+    return InstrumentNext ().GetnUniformfv (program, location, bufSize, params);
+}
+
+static void APIENTRY Instrument_GetnUniformiv (GLuint program, GLint location, GLsizei bufSize, GLint *params)
+{
+    InstrumentScope scope (649);
+    return InstrumentNext ().GetnUniformiv (program, location, bufSize, params);
+}
+
+static void APIENTRY Instrument_GetnUniformuiv (GLuint program, GLint location, GLsizei bufSize, GLuint *params)
+{
+    InstrumentScope scope (650);
+    return InstrumentNext ().GetnUniformuiv (program, location, bufSize, params);
+}
+
+static void APIENTRY Instrument_ReadnPixels (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data)
+{
+    InstrumentScope scope (651);
+    return InstrumentNext ().ReadnPixels (x, y, width, height, format, type, bufSize, data);
+}
+
+static void APIENTRY Instrument_TextureBarrier (void)
+{
+    InstrumentScope scope (652);
+    return InstrumentNext ().TextureBarrier ();
+}
+
+static GLuint64 APIENTRY Instrument_GetTextureHandleARB (GLuint texture)
+{
+    InstrumentScope scope (653);
+    return InstrumentNext ().GetTextureHandleARB (texture);
+}
+
+static GLuint64 APIENTRY Instrument_GetTextureSamplerHandleARB (GLuint texture, GLuint sampler)
+{
+    InstrumentScope scope (654);
+    return InstrumentNext ().GetTextureSamplerHandleARB (texture, sampler);
+}
+
+static void APIENTRY Instrument_MakeTextureHandleResidentARB (GLuint64 handle)
+{
+    InstrumentScope scope (655);
+    return InstrumentNext ().MakeTextureHandleResidentARB (handle);
+}
+
+static void APIENTRY Instrument_MakeTextureHandleNonResidentARB (GLuint64 handle)
+{
+    InstrumentScope scope (656);
+    return InstrumentNext ().MakeTextureHandleNonResidentARB (handle);
+}
+
+static GLuint64 APIENTRY Instrument_GetImageHandleARB (GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format)
+{
+    InstrumentScope scope (657);
+    return InstrumentNext ().GetImageHandleARB (texture, level, layered, layer, format);
+}
+
+static void APIENTRY Instrument_MakeImageHandleResidentARB (GLuint64 handle, GLenum access)
+{
+    InstrumentScope scope (658);
+    return InstrumentNext ().MakeImageHandleResidentARB (handle, access);
+}
+
+static void APIENTRY Instrument_MakeImageHandleNonResidentARB (GLuint64 handle)
+{
+    InstrumentScope scope (659);
+    return InstrumentNext ().MakeImageHandleNonResidentARB (handle);
+}
+
+static void APIENTRY Instrument_UniformHandleui64ARB (GLint location, GLuint64 value)
+{
+    InstrumentScope scope (660);
+    return InstrumentNext ().UniformHandleui64ARB (location, value);
+}
+
+static void APIENTRY Instrument_UniformHandleui64vARB (GLint location, GLsizei count, const GLuint64 *value)
+{
+    InstrumentScope scope (661);
+    return InstrumentNext ().UniformHandleui64vARB (location, count, value);
+}
+
+static void APIENTRY Instrument_ProgramUniformHandleui64ARB (GLuint program, GLint location, GLuint64 value)
+{
+    InstrumentScope scope (662);
+    return InstrumentNext ().ProgramUniformHandleui64ARB (program, location, value);
+}
+
+static void APIENTRY Instrument_ProgramUniformHandleui64vARB (GLuint program, GLint location, GLsizei count, const GLuint64 *values)
+{
+    InstrumentScope scope (663);
+    return InstrumentNext ().ProgramUniformHandleui64vARB (program, location, count, values);
+}
+
+static GLboolean APIENTRY Instrument_IsTextureHandleResidentARB (GLuint64 handle)
+{
+    InstrumentScope scope (664);
+    return InstrumentNext ().IsTextureHandleResidentARB (handle);
+}
+
+static GLboolean APIENTRY Instrument_IsImageHandleResidentARB (GLuint64 handle)
+{
+    InstrumentScope scope (665);
+    return InstrumentNext ().IsImageHandleResidentARB (handle);
+}
+
+static void APIENTRY Instrument_VertexAttribL1ui64ARB (GLuint index, GLuint64EXT x)
+{
+    InstrumentScope scope (666);
+    return InstrumentNext ().VertexAttribL1ui64ARB (index, x);
+}
+
+static void APIENTRY Instrument_VertexAttribL1ui64vARB (GLuint index, const GLuint64EXT *v)
+{
+    InstrumentScope scope (667);
+    return InstrumentNext ().VertexAttribL1ui64vARB (index, v);
+}
+
+static void APIENTRY Instrument_GetVertexAttribLui64vARB (GLuint index, GLenum pname, GLuint64EXT *params)
+{
+    InstrumentScope scope (668);
+    return InstrumentNext ().GetVertexAttribLui64vARB (index, pname, params);
+}
+
+static GLsync APIENTRY Instrument_CreateSyncFromCLeventARB (struct _cl_context *context, struct _cl_event *event, GLbitfield flags)
+{
+    InstrumentScope scope (669);
+    return InstrumentNext ().CreateSyncFromCLeventARB (context, event, flags);
+}
+
+static void APIENTRY Instrument_DispatchComputeGroupSizeARB (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z, GLuint group_size_x, GLuint group_size_y, GLuint group_size_z)
+{
+    InstrumentScope scope (670);
+    return InstrumentNext ().DispatchComputeGroupSizeARB (num_groups_x, num_groups_y, num_groups_z, group_size_x, group_size_y, group_size_z);
+}
+
+static void APIENTRY Instrument_DebugMessageControlARB (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled)
+{
+    InstrumentScope scope (671);
+    return InstrumentNext ().DebugMessageControlARB (source, type, severity, count, ids, enabled);
+}
+
+static void APIENTRY Instrument_DebugMessageInsertARB (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf)
+{
+    InstrumentScope scope (672);
+    return InstrumentNext ().DebugMessageInsertARB (source, type, id, severity, length, buf);
+}
+
+static void APIENTRY Instrument_DebugMessageCallbackARB (GLDEBUGPROCARB callback, const void *userParam)
+{
+    InstrumentScope scope (673);
+    return InstrumentNext ().DebugMessageCallbackARB (callback, userParam);
+}
+
+static GLuint APIENTRY Instrument_GetDebugMessageLogARB (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog)
+{
+    InstrumentScope scope (674);
+    return InstrumentNext ().GetDebugMessageLogARB (count, bufSize, sources, types, ids, severities, lengths, messageLog);
+}
+
+static void APIENTRY Instrument_BlendEquationiARB (GLuint buf, GLenum mode)
+{
+    InstrumentScope scope (675);
+    return InstrumentNext ().BlendEquationiARB (buf, mode);
+}
+
+static void APIENTRY Instrument_BlendEquationSeparateiARB (GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+    InstrumentScope scope (676);
+    return InstrumentNext ().BlendEquationSeparateiARB (buf, modeRGB, modeAlpha);
+}
+
+static void APIENTRY Instrument_BlendFunciARB (GLuint buf, GLenum src, GLenum dst)
+{
+    InstrumentScope scope (677);
+    return InstrumentNext ().BlendFunciARB (buf, src, dst);
+}
+
+static void APIENTRY Instrument_BlendFuncSeparateiARB (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+    InstrumentScope scope (678);
+    return InstrumentNext ().BlendFuncSeparateiARB (buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+
+static void APIENTRY Instrument_MultiDrawArraysIndirectCountARB (GLenum mode, GLintptr indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+    InstrumentScope scope (679);
+    return InstrumentNext ().MultiDrawArraysIndirectCountARB (mode, indirect, drawcount, maxdrawcount, stride);
+}
+
+static void APIENTRY Instrument_MultiDrawElementsIndirectCountARB (GLenum mode, GLenum type, GLintptr indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+    InstrumentScope scope (680);
+    return InstrumentNext ().MultiDrawElementsIndirectCountARB (mode, type, indirect, drawcount, maxdrawcount, stride);
+}
+
+static GLenum APIENTRY Instrument_GetGraphicsResetStatusARB (void)
+{
+    InstrumentScope scope (681);
+    return InstrumentNext ().GetGraphicsResetStatusARB ();
+}
+
+static void APIENTRY Instrument_GetnTexImageARB (GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *img)
+{
+    InstrumentScope scope (682);
+    return InstrumentNext ().GetnTexImageARB (target, level, format, type, bufSize, img);
+}
+
+static void APIENTRY Instrument_ReadnPixelsARB (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data)
+{
+    InstrumentScope scope (683);
+    return InstrumentNext ().ReadnPixelsARB (x, y, width, height, format, type, bufSize, data);
+}
+
+static void APIENTRY Instrument_GetnCompressedTexImageARB (GLenum target, GLint lod, GLsizei bufSize, void *img)
+{
+    InstrumentScope scope (684);
+    return InstrumentNext ().GetnCompressedTexImageARB (target, lod, bufSize, img);
+}
+
+static void APIENTRY Instrument_GetnUniformfvARB (GLuint program, GLint location, GLsizei bufSize, GLfloat *params)
+{
+    InstrumentScope scope (685);
+    return InstrumentNext ().GetnUniformfvARB (program, location, bufSize, params);
+}
+
+static void APIENTRY Instrument_GetnUniformivARB (GLuint program, GLint location, GLsizei bufSize, GLint *params)
+{
+    InstrumentScope scope (686);
+    return InstrumentNext ().GetnUniformivARB (program, location, bufSize, params);
+}
+
+static void APIENTRY Instrument_GetnUniformuivARB (GLuint program, GLint location, GLsizei bufSize, GLuint *params)
+{
+    InstrumentScope scope (687);
+    return InstrumentNext ().GetnUniformuivARB (program, location, bufSize, params);
+}
+
+static void APIENTRY Instrument_GetnUniformdvARB (GLuint program, GLint location, GLsizei bufSize, GLdouble *params)
+{
+    InstrumentScope scope (688);
+    return InstrumentNext ().GetnUniformdvARB (program, location, bufSize, params);
+}
+
+static void APIENTRY Instrument_MinSampleShadingARB (GLfloat value)
+{
+    InstrumentScope scope (689);
+    return InstrumentNext ().MinSampleShadingARB (value);
+}
+
+static void APIENTRY Instrument_NamedStringARB (GLenum type, GLint namelen, const GLchar *name, GLint stringlen, const GLchar *string)
+{
+    InstrumentScope scope (690);
+    return InstrumentNext ().NamedStringARB (type, namelen, name, stringlen, string);
+}
+
+static void APIENTRY Instrument_DeleteNamedStringARB (GLint namelen, const GLchar *name)
+{
+    InstrumentScope scope (691);
+    return InstrumentNext ().DeleteNamedStringARB (namelen, name);
+}
+
+static void APIENTRY Instrument_CompileShaderIncludeARB (GLuint shader, GLsizei count, const GLchar *const*path, const GLint *length)
+{
+    InstrumentScope scope (692);
+    return InstrumentNext ().CompileShaderIncludeARB (shader, count, path, length);
+}
+
+static GLboolean APIENTRY Instrument_IsNamedStringARB (GLint namelen, const GLchar *name)
+{
+    InstrumentScope scope (693);
+    return InstrumentNext ().IsNamedStringARB (namelen, name);
+}
+
+static void APIENTRY Instrument_GetNamedStringARB (GLint namelen, const GLchar *name, GLsizei bufSize, GLint *stringlen, GLchar *string)
+{
+    InstrumentScope scope (694);
+    return InstrumentNext ().GetNamedStringARB (namelen, name, bufSize, stringlen, string);
+}
+
+static void APIENTRY Instrument_GetNamedStringivARB (GLint namelen, const GLchar *name, GLenum pname, GLint *params)
+{
+    InstrumentScope scope (695);
+    return InstrumentNext ().GetNamedStringivARB (namelen, name, pname, params);
+}
+
+static void APIENTRY Instrument_BufferPageCommitmentARB (GLenum target, GLintptr offset, GLsizeiptr size, GLboolean commit)
+{
+    InstrumentScope scope (696);
+    return InstrumentNext ().BufferPageCommitmentARB (target, offset, size, commit);
+}
+
+static void APIENTRY Instrument_NamedBufferPageCommitmentEXT (GLuint buffer, GLintptr offset, GLsizeiptr size, GLboolean commit)
+{
+    InstrumentScope scope (697);
+    return InstrumentNext ().NamedBufferPageCommitmentEXT (buffer, offset, size, commit);
+}
+
+static void APIENTRY Instrument_NamedBufferPageCommitmentARB (GLuint buffer, GLintptr offset, GLsizeiptr size, GLboolean commit)
+{
+    InstrumentScope scope (698);
+    return InstrumentNext ().NamedBufferPageCommitmentARB (buffer, offset, size, commit);
+}
+
+static void APIENTRY Instrument_TexPageCommitmentARB (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean commit)
+{
+    InstrumentScope scope (699);
+    return InstrumentNext ().TexPageCommitmentARB (target, level, xoffset, yoffset, zoffset, width, height, depth, commit);
+}
+
+static void APIENTRY Instrument_GetMultisamplefvNV (GLenum a0, GLuint a1, GLfloat *a2)
+{
+    InstrumentScope scope (700);
+    return InstrumentNext ().GetMultisamplefvNV (a0, a1, a2);
+}
+
+static void APIENTRY Instrument_SampleMaskIndexedNV (GLuint a0, GLbitfield a1)
+{
+    InstrumentScope scope (701);
+    return InstrumentNext ().SampleMaskIndexedNV (a0, a1);
+}
+
+static void APIENTRY Instrument_TexRenderbufferNV (GLenum a0, GLuint a1)
+{
+    InstrumentScope scope (702);
+    return InstrumentNext ().TexRenderbufferNV (a0, a1);
+}
+
+static void APIENTRY Instrument_MakeBufferResidentNV (GLenum target, GLenum access)
+{
+    InstrumentScope scope (703);
+    return InstrumentNext ().MakeBufferResidentNV (target, access);
+}
+
+static void APIENTRY Instrument_MakeBufferNonResidentNV (GLenum target)
+{
+    InstrumentScope scope (704);
+    return InstrumentNext ().MakeBufferNonResidentNV (target);
+}
+
+static GLboolean APIENTRY Instrument_IsBufferResidentNV (GLenum target)
+{
+    InstrumentScope scope (705);
+    return InstrumentNext ().IsBufferResidentNV (target);
+}
+
+static void APIENTRY Instrument_MakeNamedBufferResidentNV (GLuint buffer, GLenum access)
+{
+    InstrumentScope scope (706);
+    return InstrumentNext ().MakeNamedBufferResidentNV (buffer, access);
+}
+
+static void APIENTRY Instrument_MakeNamedBufferNonResidentNV (GLuint buffer)
+{
+    InstrumentScope scope (707);
+    return InstrumentNext ().MakeNamedBufferNonResidentNV (buffer);
+}
+
+static GLboolean APIENTRY Instrument_IsNamedBufferResidentNV (GLuint buffer)
+{
+    InstrumentScope scope (708);
+    return InstrumentNext ().IsNamedBufferResidentNV (buffer);
+}
+
+static void APIENTRY Instrument_GetBufferParameterui64vNV (GLenum target, GLenum pname, GLuint64EXT *params)
+{
+    InstrumentScope scope (709);
+    return InstrumentNext ().GetBufferParameterui64vNV (target, pname, params);
+}
+
+static void APIENTRY Instrument_GetNamedBufferParameterui64vNV (GLuint buffer, GLenum pname, GLuint64EXT *params)
+{
+    InstrumentScope scope (710);
+    return InstrumentNext ().GetNamedBufferParameterui64vNV (buffer, pname, params);
+}
+
+static void APIENTRY Instrument_GetIntegerui64vNV (GLenum value, GLuint64EXT *result)
+{
+    InstrumentScope scope (711);
+    return InstrumentNext ().GetIntegerui64vNV (value, result);
+}
+
+static void APIENTRY Instrument_Uniformui64NV (GLint location, GLuint64EXT value)
+{
+    InstrumentScope scope (712);
+    return InstrumentNext ().Uniformui64NV (location, value);
+}
+
+static void APIENTRY Instrument_Uniformui64vNV (GLint location, GLsizei count, const GLuint64EXT *value)
+{
+    InstrumentScope scope (713);
+    return InstrumentNext ().Uniformui64vNV (location, count, value);
+}
+
+static void APIENTRY Instrument_ProgramUniformui64NV (GLuint program, GLint location, GLuint64EXT value)
+{
+    InstrumentScope scope (714);
+    return InstrumentNext ().ProgramUniformui64NV (program, location, value);
+}
+
+static void APIENTRY Instrument_ProgramUniformui64vNV (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value)
+{
+    InstrumentScope scope (715);
+    return InstrumentNext ().ProgramUniformui64vNV (program, location, count, value);
+}
+
+static void APIENTRY Instrument_BufferAddressRangeNV (GLenum pname, GLuint index, GLuint64EXT address, GLsizeiptr length)
+{
+    InstrumentScope scope (716);
+    return InstrumentNext ().BufferAddressRangeNV (pname, index, address, length);
+}
+
+static void APIENTRY Instrument_VertexFormatNV (GLint size, GLenum type, GLsizei stride)
+{
+    InstrumentScope scope (717);
+    return InstrumentNext ().VertexFormatNV (size, type, stride);
+}
+
+static void APIENTRY Instrument_NormalFormatNV (GLenum type, GLsizei stride)
+{
+    InstrumentScope scope (718);
+    return InstrumentNext ().NormalFormatNV (type, stride);
+}
+
+static void APIENTRY Instrument_ColorFormatNV (GLint size, GLenum type, GLsizei stride)
+{
+    InstrumentScope scope (719);
+    return InstrumentNext ().ColorFormatNV (size, type, stride);
+}
+
+static void APIENTRY Instrument_IndexFormatNV (GLenum type, GLsizei stride)
+{
+    InstrumentScope scope (720);
+    return InstrumentNext ().IndexFormatNV (type, stride);
+}
+
+static void APIENTRY Instrument_TexCoordFormatNV (GLint size, GLenum type, GLsizei stride)
+{
+    InstrumentScope scope (721);
+    return InstrumentNext ().TexCoordFormatNV (size, type, stride);
+}
+
+static void APIENTRY Instrument_EdgeFlagFormatNV (GLsizei stride)
+{
+    InstrumentScope scope (722);
+    return InstrumentNext ().EdgeFlagFormatNV (stride);
+}
+
+static void APIENTRY Instrument_SecondaryColorFormatNV (GLint size, GLenum type, GLsizei stride)
+{
+    InstrumentScope scope (723);
+    return InstrumentNext ().SecondaryColorFormatNV (size, type, stride);
+}
+
+static void APIENTRY Instrument_FogCoordFormatNV (GLenum type, GLsizei stride)
+{
+    InstrumentScope scope (724);
+    return InstrumentNext ().FogCoordFormatNV (type, stride);
+}
+
+static void APIENTRY Instrument_VertexAttribFormatNV (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride)
+{
+    InstrumentScope scope (725);
+    return InstrumentNext ().VertexAttribFormatNV (index, size, type, normalized, stride);
+}
+
+static void APIENTRY Instrument_VertexAttribIFormatNV (GLuint index, GLint size, GLenum type, GLsizei stride)
+{
+    InstrumentScope scope (726);
+    return InstrumentNext ().VertexAttribIFormatNV (index, size, type, stride);
+}
+
+static void APIENTRY Instrument_GetIntegerui64i_vNV (GLenum value, GLuint index, GLuint64EXT *result)
+{
+    InstrumentScope scope (727);
+    return InstrumentNext ().GetIntegerui64i_vNV (value, index, result);
+}
+
+static void APIENTRY Instrument_EnableClientState (GLenum cap)
+{
+    InstrumentScope scope (728);
+    return InstrumentNext ().EnableClientState (cap);
+}
+
+static void APIENTRY Instrument_DisableClientState (GLenum cap)
+{
+    InstrumentScope scope (729);
+    return InstrumentNext ().DisableClientState (cap);
+}
+
+void GetInstrumentThunks (DispatchTable *table)
+{
+    table->CullFace = Instrument_CullFace;
+    table->FrontFace = Instrument_FrontFace;
+    table->Hint = Instrument_Hint;
+    table->LineWidth = Instrument_LineWidth;
+    table->PointSize = Instrument_PointSize;
+    table->PolygonMode = Instrument_PolygonMode;
+    table->Scissor = Instrument_Scissor;
+    table->TexParameterf = Instrument_TexParameterf;
+    table->TexParameterfv = Instrument_TexParameterfv;
+    table->TexParameteri = Instrument_TexParameteri;
+    table->TexParameteriv = Instrument_TexParameteriv;
+    table->TexImage1D = Instrument_TexImage1D;
+    table->TexImage2D = Instrument_TexImage2D;
+    table->DrawBuffer = Instrument_DrawBuffer;
+    table->Clear = Instrument_Clear;
+    table->ClearColor = Instrument_ClearColor;
+    table->ClearStencil = Instrument_ClearStencil;
+    table->ClearDepth = Instrument_ClearDepth;
+    table->StencilMask = Instrument_StencilMask;
+    table->ColorMask = Instrument_ColorMask;
+    table->DepthMask = Instrument_DepthMask;
+    table->Disable = Instrument_Disable;
+    table->Enable = Instrument_Enable;
+    table->Finish = Instrument_Finish;
+    table->Flush = Instrument_Flush;
+    table->BlendFunc = Instrument_BlendFunc;
+    table->LogicOp = Instrument_LogicOp;
+    table->StencilFunc = Instrument_StencilFunc;
+    table->StencilOp = Instrument_StencilOp;
+    table->DepthFunc = Instrument_DepthFunc;
+    table->PixelStoref = Instrument_PixelStoref;
+    table->PixelStorei = Instrument_PixelStorei;
+    table->ReadBuffer = Instrument_ReadBuffer;
+    table->ReadPixels = Instrument_ReadPixels;
+    table->GetBooleanv = Instrument_GetBooleanv;
+    table->GetDoublev = Instrument_GetDoublev;
+    table->GetError = Instrument_GetError;
+    table->GetFloatv = Instrument_GetFloatv;
+    table->GetIntegerv = Instrument_GetIntegerv;
+    table->GetString = Instrument_GetString;
+    table->GetTexImage = Instrument_GetTexImage;
+    table->GetTexParameterfv = Instrument_GetTexParameterfv;
+    table->GetTexParameteriv = Instrument_GetTexParameteriv;
+    table->GetTexLevelParameterfv = Instrument_GetTexLevelParameterfv;
+    table->GetTexLevelParameteriv = Instrument_GetTexLevelParameteriv;
+    table->IsEnabled = Instrument_IsEnabled;
+    table->DepthRange = Instrument_DepthRange;
+    table->Viewport = Instrument_Viewport;
+    table->DrawArrays = Instrument_DrawArrays;
+    table->DrawElements = Instrument_DrawElements;
+    table->GetPointerv = Instrument_GetPointerv;
+    table->PolygonOffset = Instrument_PolygonOffset;
+    table->CopyTexImage1D = Instrument_CopyTexImage1D;
+    table->CopyTexImage2D = Instrument_CopyTexImage2D;
+    table->CopyTexSubImage1D = Instrument_CopyTexSubImage1D;
+    table->CopyTexSubImage2D = Instrument_CopyTexSubImage2D;
+    table->TexSubImage1D = Instrument_TexSubImage1D;
+    table->TexSubImage2D = Instrument_TexSubImage2D;
+    table->BindTexture = Instrument_BindTexture;
+    table->DeleteTextures = Instrument_DeleteTextures;
+    table->GenTextures = Instrument_GenTextures;
+    table->IsTexture = Instrument_IsTexture;
+    table->DrawRangeElements = Instrument_DrawRangeElements;
+    table->TexImage3D = Instrument_TexImage3D;
+    table->TexSubImage3D = Instrument_TexSubImage3D;
+    table->CopyTexSubImage3D = Instrument_CopyTexSubImage3D;
+    table->ActiveTexture = Instrument_ActiveTexture;
+    table->SampleCoverage = Instrument_SampleCoverage;
+    table->CompressedTexImage3D = Instrument_CompressedTexImage3D;
+    table->CompressedTexImage2D = Instrument_CompressedTexImage2D;
+    table->CompressedTexImage1D = Instrument_CompressedTexImage1D;
+    table->CompressedTexSubImage3D = Instrument_CompressedTexSubImage3D;
+    table->CompressedTexSubImage2D = Instrument_CompressedTexSubImage2D;
+    table->CompressedTexSubImage1D = Instrument_CompressedTexSubImage1D;
+    table->GetCompressedTexImage = Instrument_GetCompressedTexImage;
+    table->BlendFuncSeparate = Instrument_BlendFuncSeparate;
+    table->MultiDrawArrays = Instrument_MultiDrawArrays;
+    table->MultiDrawElements = Instrument_MultiDrawElements;
+    table->PointParameterf = Instrument_PointParameterf;
+    table->PointParameterfv = Instrument_PointParameterfv;
+    table->PointParameteri = Instrument_PointParameteri;
+    table->PointParameteriv = Instrument_PointParameteriv;
+    table->BlendColor = Instrument_BlendColor;
+    table->BlendEquation = Instrument_BlendEquation;
+    table->GenQueries = Instrument_GenQueries;
+    table->DeleteQueries = Instrument_DeleteQueries;
+    table->IsQuery = Instrument_IsQuery;
+    table->BeginQuery = Instrument_BeginQuery;
+    table->EndQuery = Instrument_EndQuery;
+    table->GetQueryiv = Instrument_GetQueryiv;
+    table->GetQueryObjectiv = Instrument_GetQueryObjectiv;
+    table->GetQueryObjectuiv = Instrument_GetQueryObjectuiv;
+    table->BindBuffer = Instrument_BindBuffer;
+    table->DeleteBuffers = Instrument_DeleteBuffers;
+    table->GenBuffers = Instrument_GenBuffers;
+    table->IsBuffer = Instrument_IsBuffer;
+    table->BufferData = Instrument_BufferData;
+    table->BufferSubData = Instrument_BufferSubData;
+    table->GetBufferSubData = Instrument_GetBufferSubData;
+    table->MapBuffer = Instrument_MapBuffer;
+    table->UnmapBuffer = Instrument_UnmapBuffer;
+    table->GetBufferParameteriv = Instrument_GetBufferParameteriv;
+    table->GetBufferPointerv = Instrument_GetBufferPointerv;
+    table->BlendEquationSeparate = Instrument_BlendEquationSeparate;
+    table->DrawBuffers = Instrument_DrawBuffers;
+    table->StencilOpSeparate = Instrument_StencilOpSeparate;
+    table->StencilFuncSeparate = Instrument_StencilFuncSeparate;
+    table->StencilMaskSeparate = Instrument_StencilMaskSeparate;
+    table->AttachShader = Instrument_AttachShader;
+    table->BindAttribLocation = Instrument_BindAttribLocation;
+    table->CompileShader = Instrument_CompileShader;
+    table->CreateProgram = Instrument_CreateProgram;
+    table->CreateShader = Instrument_CreateShader;
+    table->DeleteProgram = Instrument_DeleteProgram;
+    table->DeleteShader = Instrument_DeleteShader;
+    table->DetachShader = Instrument_DetachShader;
+    table->DisableVertexAttribArray = Instrument_DisableVertexAttribArray;
+    table->EnableVertexAttribArray = Instrument_EnableVertexAttribArray;
+    table->GetActiveAttrib = Instrument_GetActiveAttrib;
+    table->GetActiveUniform = Instrument_GetActiveUniform;
+    table->GetAttachedShaders = Instrument_GetAttachedShaders;
+    table->GetAttribLocation = Instrument_GetAttribLocation;
+    table->GetProgramiv = Instrument_GetProgramiv;
+    table->GetProgramInfoLog = Instrument_GetProgramInfoLog;
+    table->GetShaderiv = Instrument_GetShaderiv;
+    table->GetShaderInfoLog = Instrument_GetShaderInfoLog;
+    table->GetShaderSource = Instrument_GetShaderSource;
+    table->GetUniformLocation = Instrument_GetUniformLocation;
+    table->GetUniformfv = Instrument_GetUniformfv;
+    table->GetUniformiv = Instrument_GetUniformiv;
+    table->GetVertexAttribdv = Instrument_GetVertexAttribdv;
+    table->GetVertexAttribfv = Instrument_GetVertexAttribfv;
+    table->GetVertexAttribiv = Instrument_GetVertexAttribiv;
+    table->GetVertexAttribPointerv = Instrument_GetVertexAttribPointerv;
+    table->IsProgram = Instrument_IsProgram;
+    table->IsShader = Instrument_IsShader;
+    table->LinkProgram = Instrument_LinkProgram;
+    table->ShaderSource = Instrument_ShaderSource;
+    table->UseProgram = Instrument_UseProgram;
+    table->Uniform1f = Instrument_Uniform1f;
+    table->Uniform2f = Instrument_Uniform2f;
+    table->Uniform3f = Instrument_Uniform3f;
+    table->Uniform4f = Instrument_Uniform4f;
+    table->Uniform1i = Instrument_Uniform1i;
+    table->Uniform2i = Instrument_Uniform2i;
+    table->Uniform3i = Instrument_Uniform3i;
+    table->Uniform4i = Instrument_Uniform4i;
+    table->Uniform1fv = Instrument_Uniform1fv;
+    table->Uniform2fv = Instrument_Uniform2fv;
+    table->Uniform3fv = Instrument_Uniform3fv;
+    table->Uniform4fv = Instrument_Uniform4fv;
+    table->Uniform1iv = Instrument_Uniform1iv;
+    table->Uniform2iv = Instrument_Uniform2iv;
+    table->Uniform3iv = Instrument_Uniform3iv;
+    table->Uniform4iv = Instrument_Uniform4iv;
+    table->UniformMatrix2fv = Instrument_UniformMatrix2fv;
+    table->UniformMatrix3fv = Instrument_UniformMatrix3fv;
+    table->UniformMatrix4fv = Instrument_UniformMatrix4fv;
+    table->ValidateProgram = Instrument_ValidateProgram;
+    table->VertexAttrib1d = Instrument_VertexAttrib1d;
+    table->VertexAttrib1dv = Instrument_VertexAttrib1dv;
+    table->VertexAttrib1f = Instrument_VertexAttrib1f;
+    table->VertexAttrib1fv = Instrument_VertexAttrib1fv;
+    table->VertexAttrib1s = Instrument_VertexAttrib1s;
+    table->VertexAttrib1sv = Instrument_VertexAttrib1sv;
+    table->VertexAttrib2d = Instrument_VertexAttrib2d;
+    table->VertexAttrib2dv = Instrument_VertexAttrib2dv;
+    table->VertexAttrib2f = Instrument_VertexAttrib2f;
+    table->VertexAttrib2fv = Instrument_VertexAttrib2fv;
+    table->VertexAttrib2s = Instrument_VertexAttrib2s;
+    table->VertexAttrib2sv = Instrument_VertexAttrib2sv;
+    table->VertexAttrib3d = Instrument_VertexAttrib3d;
+    table->VertexAttrib3dv = Instrument_VertexAttrib3dv;
+    table->VertexAttrib3f = Instrument_VertexAttrib3f;
+    table->VertexAttrib3fv = Instrument_VertexAttrib3fv;
+    table->VertexAttrib3s = Instrument_VertexAttrib3s;
+    table->VertexAttrib3sv = Instrument_VertexAttrib3sv;
+    table->VertexAttrib4Nbv = Instrument_VertexAttrib4Nbv;
+    table->VertexAttrib4Niv = Instrument_VertexAttrib4Niv;
+    table->VertexAttrib4Nsv = Instrument_VertexAttrib4Nsv;
+    table->VertexAttrib4Nub = Instrument_VertexAttrib4Nub;
+    table->VertexAttrib4Nubv = Instrument_VertexAttrib4Nubv;
+    table->VertexAttrib4Nuiv = Instrument_VertexAttrib4Nuiv;
+    table->VertexAttrib4Nusv = Instrument_VertexAttrib4Nusv;
+    table->VertexAttrib4bv = Instrument_VertexAttrib4bv;
+    table->VertexAttrib4d = Instrument_VertexAttrib4d;
+    table->VertexAttrib4dv = Instrument_VertexAttrib4dv;
+    table->VertexAttrib4f = Instrument_VertexAttrib4f;
+    table->VertexAttrib4fv = Instrument_VertexAttrib4fv;
+    table->VertexAttrib4iv = Instrument_VertexAttrib4iv;
+    table->VertexAttrib4s = Instrument_VertexAttrib4s;
+    table->VertexAttrib4sv = Instrument_VertexAttrib4sv;
+    table->VertexAttrib4ubv = Instrument_VertexAttrib4ubv;
+    table->VertexAttrib4uiv = Instrument_VertexAttrib4uiv;
+    table->VertexAttrib4usv = Instrument_VertexAttrib4usv;
+    table->VertexAttribPointer = Instrument_VertexAttribPointer;
+    table->UniformMatrix2x3fv = Instrument_UniformMatrix2x3fv;
+    table->UniformMatrix3x2fv = Instrument_UniformMatrix3x2fv;
+    table->UniformMatrix2x4fv = Instrument_UniformMatrix2x4fv;
+    table->UniformMatrix4x2fv = Instrument_UniformMatrix4x2fv;
+    table->UniformMatrix3x4fv = Instrument_UniformMatrix3x4fv;
+    table->UniformMatrix4x3fv = Instrument_UniformMatrix4x3fv;
+    table->ColorMaski = Instrument_ColorMaski;
+    table->GetBooleani_v = Instrument_GetBooleani_v;
+    table->GetIntegeri_v = Instrument_GetIntegeri_v;
+    table->Enablei = Instrument_Enablei;
+    table->Disablei = Instrument_Disablei;
+    table->IsEnabledi = Instrument_IsEnabledi;
+    table->BeginTransformFeedback = Instrument_BeginTransformFeedback;
+    table->EndTransformFeedback = Instrument_EndTransformFeedback;
+    table->BindBufferRange = Instrument_BindBufferRange;
+    table->BindBufferBase = Instrument_BindBufferBase;
+    table->TransformFeedbackVaryings = Instrument_TransformFeedbackVaryings;
+    table->GetTransformFeedbackVarying = Instrument_GetTransformFeedbackVarying;
+    table->ClampColor = Instrument_ClampColor;
+    table->BeginConditionalRender = Instrument_BeginConditionalRender;
+    table->EndConditionalRender = Instrument_EndConditionalRender;
+    table->VertexAttribIPointer = Instrument_VertexAttribIPointer;
+    table->GetVertexAttribIiv = Instrument_GetVertexAttribIiv;
+    table->GetVertexAttribIuiv = Instrument_GetVertexAttribIuiv;
+    table->VertexAttribI1i = Instrument_VertexAttribI1i;
+    table->VertexAttribI2i = Instrument_VertexAttribI2i;
+    table->VertexAttribI3i = Instrument_VertexAttribI3i;
+    table->VertexAttribI4i = Instrument_VertexAttribI4i;
+    table->VertexAttribI1ui = Instrument_VertexAttribI1ui;
+    table->VertexAttribI2ui = Instrument_VertexAttribI2ui;
+    table->VertexAttribI3ui = Instrument_VertexAttribI3ui;
+    table->VertexAttribI4ui = Instrument_VertexAttribI4ui;
+    table->VertexAttribI1iv = Instrument_VertexAttribI1iv;
+    table->VertexAttribI2iv = Instrument_VertexAttribI2iv;
+    table->VertexAttribI3iv = Instrument_VertexAttribI3iv;
+    table->VertexAttribI4iv = Instrument_VertexAttribI4iv;
+    table->VertexAttribI1uiv = Instrument_VertexAttribI1uiv;
+    table->VertexAttribI2uiv = Instrument_VertexAttribI2uiv;
+    table->VertexAttribI3uiv = Instrument_VertexAttribI3uiv;
+    table->VertexAttribI4uiv = Instrument_VertexAttribI4uiv;
+    table->VertexAttribI4bv = Instrument_VertexAttribI4bv;
+    table->VertexAttribI4sv = Instrument_VertexAttribI4sv;
+    table->VertexAttribI4ubv = Instrument_VertexAttribI4ubv;
+    table->VertexAttribI4usv = Instrument_VertexAttribI4usv;
+    table->GetUniformuiv = Instrument_GetUniformuiv;
+    table->BindFragDataLocation = Instrument_BindFragDataLocation;
+    table->GetFragDataLocation = Instrument_GetFragDataLocation;
+    table->Uniform1ui = Instrument_Uniform1ui;
+    table->Uniform2ui = Instrument_Uniform2ui;
+    table->Uniform3ui = Instrument_Uniform3ui;
+    table->Uniform4ui = Instrument_Uniform4ui;
+    table->Uniform1uiv = Instrument_Uniform1uiv;
+    table->Uniform2uiv = Instrument_Uniform2uiv;
+    table->Uniform3uiv = Instrument_Uniform3uiv;
+    table->Uniform4uiv = Instrument_Uniform4uiv;
+    table->TexParameterIiv = Instrument_TexParameterIiv;
+    table->TexParameterIuiv = Instrument_TexParameterIuiv;
+    table->GetTexParameterIiv = Instrument_GetTexParameterIiv;
+    table->GetTexParameterIuiv = Instrument_GetTexParameterIuiv;
+    table->ClearBufferiv = Instrument_ClearBufferiv;
+    table->ClearBufferuiv = Instrument_ClearBufferuiv;
+    table->ClearBufferfv = Instrument_ClearBufferfv;
+    table->ClearBufferfi = Instrument_ClearBufferfi;
+    table->GetStringi = Instrument_GetStringi;
+    table->IsRenderbuffer = Instrument_IsRenderbuffer;
+    table->BindRenderbuffer = Instrument_BindRenderbuffer;
+    table->DeleteRenderbuffers = Instrument_DeleteRenderbuffers;
+    table->GenRenderbuffers = Instrument_GenRenderbuffers;
+    table->RenderbufferStorage = Instrument_RenderbufferStorage;
+    table->GetRenderbufferParameteriv = Instrument_GetRenderbufferParameteriv;
+    table->IsFramebuffer = Instrument_IsFramebuffer;
+    table->BindFramebuffer = Instrument_BindFramebuffer;
+    table->DeleteFramebuffers = Instrument_DeleteFramebuffers;
+    table->GenFramebuffers = Instrument_GenFramebuffers;
+    table->CheckFramebufferStatus = Instrument_CheckFramebufferStatus;
+    table->FramebufferTexture1D = Instrument_FramebufferTexture1D;
+    table->FramebufferTexture2D = Instrument_FramebufferTexture2D;
+    table->FramebufferTexture3D = Instrument_FramebufferTexture3D;
+    table->FramebufferRenderbuffer = Instrument_FramebufferRenderbuffer;
+    table->GetFramebufferAttachmentParameteriv = Instrument_GetFramebufferAttachmentParameteriv;
+    table->GenerateMipmap = Instrument_GenerateMipmap;
+    table->BlitFramebuffer = Instrument_BlitFramebuffer;
+    table->RenderbufferStorageMultisample = Instrument_RenderbufferStorageMultisample;
+    table->FramebufferTextureLayer = Instrument_FramebufferTextureLayer;
+    table->MapBufferRange = Instrument_MapBufferRange;
+    table->FlushMappedBufferRange = Instrument_FlushMappedBufferRange;
+    table->BindVertexArray = Instrument_BindVertexArray;
+    table->DeleteVertexArrays = Instrument_DeleteVertexArrays;
+    table->GenVertexArrays = Instrument_GenVertexArrays;
+    table->IsVertexArray = Instrument_IsVertexArray;
+    table->DrawArraysInstanced = Instrument_DrawArraysInstanced;
+    table->DrawElementsInstanced = Instrument_DrawElementsInstanced;
+    table->TexBuffer = Instrument_TexBuffer;
+    table->PrimitiveRestartIndex = Instrument_PrimitiveRestartIndex;
+    table->CopyBufferSubData = Instrument_CopyBufferSubData;
+    table->GetUniformIndices = Instrument_GetUniformIndices;
+    table->GetActiveUniformsiv = Instrument_GetActiveUniformsiv;
+    table->GetActiveUniformName = Instrument_GetActiveUniformName;
+    table->GetUniformBlockIndex = Instrument_GetUniformBlockIndex;
+    table->GetActiveUniformBlockiv = Instrument_GetActiveUniformBlockiv;
+    table->GetActiveUniformBlockName = Instrument_GetActiveUniformBlockName;
+    table->UniformBlockBinding = Instrument_UniformBlockBinding;
+    table->DrawElementsBaseVertex = Instrument_DrawElementsBaseVertex;
+    table->DrawRangeElementsBaseVertex = Instrument_DrawRangeElementsBaseVertex;
+    table->DrawElementsInstancedBaseVertex = Instrument_DrawElementsInstancedBaseVertex;
+    table->MultiDrawElementsBaseVertex = Instrument_MultiDrawElementsBaseVertex;
+    table->ProvokingVertex = Instrument_ProvokingVertex;
+    table->FenceSync = Instrument_FenceSync;
+    table->IsSync = Instrument_IsSync;
+    table->DeleteSync = Instrument_DeleteSync;
+    table->ClientWaitSync = Instrument_ClientWaitSync;
+    table->WaitSync = Instrument_WaitSync;
+    table->GetInteger64v = Instrument_GetInteger64v;
+    table->GetSynciv = Instrument_GetSynciv;
+    table->GetInteger64i_v = Instrument_GetInteger64i_v;
+    table->GetBufferParameteri64v = Instrument_GetBufferParameteri64v;
+    table->FramebufferTexture = Instrument_FramebufferTexture;
+    table->TexImage2DMultisample = Instrument_TexImage2DMultisample;
+    table->TexImage3DMultisample = Instrument_TexImage3DMultisample;
+    table->GetMultisamplefv = Instrument_GetMultisamplefv;
+    table->SampleMaski = Instrument_SampleMaski;
+    table->BindFragDataLocationIndexed = Instrument_BindFragDataLocationIndexed;
+    table->GetFragDataIndex = Instrument_GetFragDataIndex;
+    table->GenSamplers = Instrument_GenSamplers;
+    table->DeleteSamplers = Instrument_DeleteSamplers;
+    table->IsSampler = Instrument_IsSampler;
+    table->BindSampler = Instrument_BindSampler;
+    table->SamplerParameteri = Instrument_SamplerParameteri;
+    table->SamplerParameteriv = Instrument_SamplerParameteriv;
+    table->SamplerParameterf = Instrument_SamplerParameterf;
+    table->SamplerParameterfv = Instrument_SamplerParameterfv;
+    table->SamplerParameterIiv = Instrument_SamplerParameterIiv;
+    table->SamplerParameterIuiv = Instrument_SamplerParameterIuiv;
+    table->GetSamplerParameteriv = Instrument_GetSamplerParameteriv;
+    table->GetSamplerParameterIiv = Instrument_GetSamplerParameterIiv;
+    table->GetSamplerParameterfv = Instrument_GetSamplerParameterfv;
+    table->GetSamplerParameterIuiv = Instrument_GetSamplerParameterIuiv;
+    table->QueryCounter = Instrument_QueryCounter;
+    table->GetQueryObjecti64v = Instrument_GetQueryObjecti64v;
+    table->GetQueryObjectui64v = Instrument_GetQueryObjectui64v;
+    table->VertexAttribDivisor = Instrument_VertexAttribDivisor;
+    table->VertexAttribP1ui = Instrument_VertexAttribP1ui;
+    table->VertexAttribP1uiv = Instrument_VertexAttribP1uiv;
+    table->VertexAttribP2ui = Instrument_VertexAttribP2ui;
+    table->VertexAttribP2uiv = Instrument_VertexAttribP2uiv;
+    table->VertexAttribP3ui = Instrument_VertexAttribP3ui;
+    table->VertexAttribP3uiv = Instrument_VertexAttribP3uiv;
+    table->VertexAttribP4ui = Instrument_VertexAttribP4ui;
+    table->VertexAttribP4uiv = Instrument_VertexAttribP4uiv;
+    table->MinSampleShading = Instrument_MinSampleShading;
+    table->BlendEquationi = Instrument_BlendEquationi;
+    table->BlendEquationSeparatei = Instrument_BlendEquationSeparatei;
+    table->BlendFunci = Instrument_BlendFunci;
+    table->BlendFuncSeparatei = Instrument_BlendFuncSeparatei;
+    table->DrawArraysIndirect = Instrument_DrawArraysIndirect;
+    table->DrawElementsIndirect = Instrument_DrawElementsIndirect;
+    table->Uniform1d = Instrument_Uniform1d;
+    table->Uniform2d = Instrument_Uniform2d;
+    table->Uniform3d = Instrument_Uniform3d;
+    table->Uniform4d = Instrument_Uniform4d;
+    table->Uniform1dv = Instrument_Uniform1dv;
+    table->Uniform2dv = Instrument_Uniform2dv;
+    table->Uniform3dv = Instrument_Uniform3dv;
+    table->Uniform4dv = Instrument_Uniform4dv;
+    table->UniformMatrix2dv = Instrument_UniformMatrix2dv;
+    table->UniformMatrix3dv = Instrument_UniformMatrix3dv;
+    table->UniformMatrix4dv = Instrument_UniformMatrix4dv;
+    table->UniformMatrix2x3dv = Instrument_UniformMatrix2x3dv;
+    table->UniformMatrix2x4dv = Instrument_UniformMatrix2x4dv;
+    table->UniformMatrix3x2dv = Instrument_UniformMatrix3x2dv;
+    table->UniformMatrix3x4dv = Instrument_UniformMatrix3x4dv;
+    table->UniformMatrix4x2dv = Instrument_UniformMatrix4x2dv;
+    table->UniformMatrix4x3dv = Instrument_UniformMatrix4x3dv;
+    table->GetUniformdv = Instrument_GetUniformdv;
+    table->GetSubroutineUniformLocation = Instrument_GetSubroutineUniformLocation;
+    table->GetSubroutineIndex = Instrument_GetSubroutineIndex;
+    table->GetActiveSubroutineUniformiv = Instrument_GetActiveSubroutineUniformiv;
+    table->GetActiveSubroutineUniformName = Instrument_GetActiveSubroutineUniformName;
+    table->GetActiveSubroutineName = Instrument_GetActiveSubroutineName;
+    table->UniformSubroutinesuiv = Instrument_UniformSubroutinesuiv;
+    table->GetUniformSubroutineuiv = Instrument_GetUniformSubroutineuiv;
+    table->GetProgramStageiv = Instrument_GetProgramStageiv;
+    table->PatchParameteri = Instrument_PatchParameteri;
+    table->PatchParameterfv = Instrument_PatchParameterfv;
+    table->BindTransformFeedback = Instrument_BindTransformFeedback;
+    table->DeleteTransformFeedbacks = Instrument_DeleteTransformFeedbacks;
+    table->GenTransformFeedbacks = Instrument_GenTransformFeedbacks;
+    table->IsTransformFeedback = Instrument_IsTransformFeedback;
+    table->PauseTransformFeedback = Instrument_PauseTransformFeedback;
+    table->ResumeTransformFeedback = Instrument_ResumeTransformFeedback;
+    table->DrawTransformFeedback = Instrument_DrawTransformFeedback;
+    table->DrawTransformFeedbackStream = Instrument_DrawTransformFeedbackStream;
+    table->BeginQueryIndexed = Instrument_BeginQueryIndexed;
+    table->EndQueryIndexed = Instrument_EndQueryIndexed;
+    table->GetQueryIndexediv = Instrument_GetQueryIndexediv;
+    table->ReleaseShaderCompiler = Instrument_ReleaseShaderCompiler;
+    table->ShaderBinary = Instrument_ShaderBinary;
+    table->GetShaderPrecisionFormat = Instrument_GetShaderPrecisionFormat;
+    table->DepthRangef = Instrument_DepthRangef;
+    table->ClearDepthf = Instrument_ClearDepthf;
+    table->GetProgramBinary = Instrument_GetProgramBinary;
+    table->ProgramBinary = Instrument_ProgramBinary;
+    table->ProgramParameteri = Instrument_ProgramParameteri;
+    table->UseProgramStages = Instrument_UseProgramStages;
+    table->ActiveShaderProgram = Instrument_ActiveShaderProgram;
+    table->CreateShaderProgramv = Instrument_CreateShaderProgramv;
+    table->BindProgramPipeline = Instrument_BindProgramPipeline;
+    table->DeleteProgramPipelines = Instrument_DeleteProgramPipelines;
+    table->GenProgramPipelines = Instrument_GenProgramPipelines;
+    table->IsProgramPipeline = Instrument_IsProgramPipeline;
+    table->GetProgramPipelineiv = Instrument_GetProgramPipelineiv;
+    table->ProgramUniform1i = Instrument_ProgramUniform1i;
+    table->ProgramUniform1iv = Instrument_ProgramUniform1iv;
+    table->ProgramUniform1f = Instrument_ProgramUniform1f;
+    table->ProgramUniform1fv = Instrument_ProgramUniform1fv;
+    table->ProgramUniform1d = Instrument_ProgramUniform1d;
+    table->ProgramUniform1dv = Instrument_ProgramUniform1dv;
+    table->ProgramUniform1ui = Instrument_ProgramUniform1ui;
+    table->ProgramUniform1uiv = Instrument_ProgramUniform1uiv;
+    table->ProgramUniform2i = Instrument_ProgramUniform2i;
+    table->ProgramUniform2iv = Instrument_ProgramUniform2iv;
+    table->ProgramUniform2f = Instrument_ProgramUniform2f;
+    table->ProgramUniform2fv = Instrument_ProgramUniform2fv;
+    table->ProgramUniform2d = Instrument_ProgramUniform2d;
+    table->ProgramUniform2dv = Instrument_ProgramUniform2dv;
+    table->ProgramUniform2ui = Instrument_ProgramUniform2ui;
+    table->ProgramUniform2uiv = Instrument_ProgramUniform2uiv;
+    table->ProgramUniform3i = Instrument_ProgramUniform3i;
+    table->ProgramUniform3iv = Instrument_ProgramUniform3iv;
+    table->ProgramUniform3f = Instrument_ProgramUniform3f;
+    table->ProgramUniform3fv = Instrument_ProgramUniform3fv;
+    table->ProgramUniform3d = Instrument_ProgramUniform3d;
+    table->ProgramUniform3dv = Instrument_ProgramUniform3dv;
+    table->ProgramUniform3ui = Instrument_ProgramUniform3ui;
+    table->ProgramUniform3uiv = Instrument_ProgramUniform3uiv;
+    table->ProgramUniform4i = Instrument_ProgramUniform4i;
+    table->ProgramUniform4iv = Instrument_ProgramUniform4iv;
+    table->ProgramUniform4f = Instrument_ProgramUniform4f;
+    table->ProgramUniform4fv = Instrument_ProgramUniform4fv;
+    table->ProgramUniform4d = Instrument_ProgramUniform4d;
+    table->ProgramUniform4dv = Instrument_ProgramUniform4dv;
+    table->ProgramUniform4ui = Instrument_ProgramUniform4ui;
+    table->ProgramUniform4uiv = Instrument_ProgramUniform4uiv;
+    table->ProgramUniformMatrix2fv = Instrument_ProgramUniformMatrix2fv;
+    table->ProgramUniformMatrix3fv = Instrument_ProgramUniformMatrix3fv;
+    table->ProgramUniformMatrix4fv = Instrument_ProgramUniformMatrix4fv;
+    table->ProgramUniformMatrix2dv = Instrument_ProgramUniformMatrix2dv;
+    table->ProgramUniformMatrix3dv = Instrument_ProgramUniformMatrix3dv;
+    table->ProgramUniformMatrix4dv = Instrument_ProgramUniformMatrix4dv;
+    table->ProgramUniformMatrix2x3fv = Instrument_ProgramUniformMatrix2x3fv;
+    table->ProgramUniformMatrix3x2fv = Instrument_ProgramUniformMatrix3x2fv;
+    table->ProgramUniformMatrix2x4fv = Instrument_ProgramUniformMatrix2x4fv;
+    table->ProgramUniformMatrix4x2fv = Instrument_ProgramUniformMatrix4x2fv;
+    table->ProgramUniformMatrix3x4fv = Instrument_ProgramUniformMatrix3x4fv;
+    table->ProgramUniformMatrix4x3fv = Instrument_ProgramUniformMatrix4x3fv;
+    table->ProgramUniformMatrix2x3dv = Instrument_ProgramUniformMatrix2x3dv;
+    table->ProgramUniformMatrix3x2dv = Instrument_ProgramUniformMatrix3x2dv;
+    table->ProgramUniformMatrix2x4dv = Instrument_ProgramUniformMatrix2x4dv;
+    table->ProgramUniformMatrix4x2dv = Instrument_ProgramUniformMatrix4x2dv;
+    table->ProgramUniformMatrix3x4dv = Instrument_ProgramUniformMatrix3x4dv;
+    table->ProgramUniformMatrix4x3dv = Instrument_ProgramUniformMatrix4x3dv;
+    table->ValidateProgramPipeline = Instrument_ValidateProgramPipeline;
+    table->GetProgramPipelineInfoLog = Instrument_GetProgramPipelineInfoLog;
+    table->VertexAttribL1d = Instrument_VertexAttribL1d;
+    table->VertexAttribL2d = Instrument_VertexAttribL2d;
+    table->VertexAttribL3d = Instrument_VertexAttribL3d;
+    table->VertexAttribL4d = Instrument_VertexAttribL4d;
+    table->VertexAttribL1dv = Instrument_VertexAttribL1dv;
+    table->VertexAttribL2dv = Instrument_VertexAttribL2dv;
+    table->VertexAttribL3dv = Instrument_VertexAttribL3dv;
+    table->VertexAttribL4dv = Instrument_VertexAttribL4dv;
+    table->VertexAttribLPointer = Instrument_VertexAttribLPointer;
+    table->GetVertexAttribLdv = Instrument_GetVertexAttribLdv;
+    table->ViewportArrayv = Instrument_ViewportArrayv;
+    table->ViewportIndexedf = Instrument_ViewportIndexedf;
+    table->ViewportIndexedfv = Instrument_ViewportIndexedfv;
+    table->ScissorArrayv = Instrument_ScissorArrayv;
+    table->ScissorIndexed = Instrument_ScissorIndexed;
+    table->ScissorIndexedv = Instrument_ScissorIndexedv;
+    table->DepthRangeArrayv = Instrument_DepthRangeArrayv;
+    table->DepthRangeIndexed = Instrument_DepthRangeIndexed;
+    table->GetFloati_v = Instrument_GetFloati_v;
+    table->GetDoublei_v = Instrument_GetDoublei_v;
+    table->DrawArraysInstancedBaseInstance = Instrument_DrawArraysInstancedBaseInstance;
+    table->DrawElementsInstancedBaseInstance = Instrument_DrawElementsInstancedBaseInstance;
+    table->DrawElementsInstancedBaseVertexBaseInstance = Instrument_DrawElementsInstancedBaseVertexBaseInstance;
+    table->GetInternalformativ = Instrument_GetInternalformativ;
+    table->GetActiveAtomicCounterBufferiv = Instrument_GetActiveAtomicCounterBufferiv;
+    table->BindImageTexture = Instrument_BindImageTexture;
+    table->MemoryBarrier = Instrument_MemoryBarrier;
+    table->TexStorage1D = Instrument_TexStorage1D;
+    table->TexStorage2D = Instrument_TexStorage2D;
+    table->TexStorage3D = Instrument_TexStorage3D;
+    table->DrawTransformFeedbackInstanced = Instrument_DrawTransformFeedbackInstanced;
+    table->DrawTransformFeedbackStreamInstanced = Instrument_DrawTransformFeedbackStreamInstanced;
+    table->ClearBufferData = Instrument_ClearBufferData;
+    table->ClearBufferSubData = Instrument_ClearBufferSubData;
+    table->DispatchCompute = Instrument_DispatchCompute;
+    table->DispatchComputeIndirect = Instrument_DispatchComputeIndirect;
+    table->CopyImageSubData = Instrument_CopyImageSubData;
+    table->FramebufferParameteri = Instrument_FramebufferParameteri;
+    table->GetFramebufferParameteriv = Instrument_GetFramebufferParameteriv;
+    table->GetInternalformati64v = Instrument_GetInternalformati64v;
+    table->InvalidateTexSubImage = Instrument_InvalidateTexSubImage;
+    table->InvalidateTexImage = Instrument_InvalidateTexImage;
+    table->InvalidateBufferSubData = Instrument_InvalidateBufferSubData;
+    table->InvalidateBufferData = Instrument_InvalidateBufferData;
+    table->InvalidateFramebuffer = Instrument_InvalidateFramebuffer;
+    table->InvalidateSubFramebuffer = Instrument_InvalidateSubFramebuffer;
+    table->MultiDrawArraysIndirect = Instrument_MultiDrawArraysIndirect;
+    table->MultiDrawElementsIndirect = Instrument_MultiDrawElementsIndirect;
+    table->GetProgramInterfaceiv = Instrument_GetProgramInterfaceiv;
+    table->GetProgramResourceIndex = Instrument_GetProgramResourceIndex;
+    table->GetProgramResourceName = Instrument_GetProgramResourceName;
+    table->GetProgramResourceiv = Instrument_GetProgramResourceiv;
+    table->GetProgramResourceLocation = Instrument_GetProgramResourceLocation;
+    table->GetProgramResourceLocationIndex = Instrument_GetProgramResourceLocationIndex;
+    table->ShaderStorageBlockBinding = Instrument_ShaderStorageBlockBinding;
+    table->TexBufferRange = Instrument_TexBufferRange;
+    table->TexStorage2DMultisample = Instrument_TexStorage2DMultisample;
+    table->TexStorage3DMultisample = Instrument_TexStorage3DMultisample;
+    table->TextureView = Instrument_TextureView;
+    table->BindVertexBuffer = Instrument_BindVertexBuffer;
+    table->VertexAttribFormat = Instrument_VertexAttribFormat;
+    table->VertexAttribIFormat = Instrument_VertexAttribIFormat;
+    table->VertexAttribLFormat = Instrument_VertexAttribLFormat;
+    table->VertexAttribBinding = Instrument_VertexAttribBinding;
+    table->VertexBindingDivisor = Instrument_VertexBindingDivisor;
+    table->DebugMessageControl = Instrument_DebugMessageControl;
+    table->DebugMessageInsert = Instrument_DebugMessageInsert;
+    table->DebugMessageCallback = Instrument_DebugMessageCallback;
+    table->GetDebugMessageLog = Instrument_GetDebugMessageLog;
+    table->PushDebugGroup = Instrument_PushDebugGroup;
+    table->PopDebugGroup = Instrument_PopDebugGroup;
+    table->ObjectLabel = Instrument_ObjectLabel;
+    table->GetObjectLabel = Instrument_GetObjectLabel;
+    table->ObjectPtrLabel = Instrument_ObjectPtrLabel;
+    table->GetObjectPtrLabel = Instrument_GetObjectPtrLabel;
+    table->BufferStorage = Instrument_BufferStorage;
+    table->ClearTexImage = Instrument_ClearTexImage;
+    table->ClearTexSubImage = Instrument_ClearTexSubImage;
+    table->BindBuffersBase = Instrument_BindBuffersBase;
+    table->BindBuffersRange = Instrument_BindBuffersRange;
+    table->BindTextures = Instrument_BindTextures;
+    table->BindSamplers = Instrument_BindSamplers;
+    table->BindImageTextures = Instrument_BindImageTextures;
+    table->BindVertexBuffers = Instrument_BindVertexBuffers;
+    table->ClipControl = Instrument_ClipControl;
+    table->CreateTransformFeedbacks = Instrument_CreateTransformFeedbacks;
+    table->TransformFeedbackBufferBase = Instrument_TransformFeedbackBufferBase;
+    table->TransformFeedbackBufferRange = Instrument_TransformFeedbackBufferRange;
+    table->GetTransformFeedbackiv = Instrument_GetTransformFeedbackiv;
+    table->GetTransformFeedbacki_v = Instrument_GetTransformFeedbacki_v;
+    table->GetTransformFeedbacki64_v = Instrument_GetTransformFeedbacki64_v;
+    table->CreateBuffers = Instrument_CreateBuffers;
+    table->NamedBufferStorage = Instrument_NamedBufferStorage;
+    table->NamedBufferData = Instrument_NamedBufferData;
+    table->NamedBufferSubData = Instrument_NamedBufferSubData;
+    table->CopyNamedBufferSubData = Instrument_CopyNamedBufferSubData;
+    table->ClearNamedBufferData = Instrument_ClearNamedBufferData;
+    table->ClearNamedBufferSubData = Instrument_ClearNamedBufferSubData;
+    table->MapNamedBuffer = Instrument_MapNamedBuffer;
+    table->MapNamedBufferRange = Instrument_MapNamedBufferRange;
+    table->UnmapNamedBuffer = Instrument_UnmapNamedBuffer;
+    table->FlushMappedNamedBufferRange = Instrument_FlushMappedNamedBufferRange;
+    table->GetNamedBufferParameteriv = Instrument_GetNamedBufferParameteriv;
+    table->GetNamedBufferParameteri64v = Instrument_GetNamedBufferParameteri64v;
+    table->GetNamedBufferPointerv = Instrument_GetNamedBufferPointerv;
+    table->GetNamedBufferSubData = Instrument_GetNamedBufferSubData;
+    table->CreateFramebuffers = Instrument_CreateFramebuffers;
+    table->NamedFramebufferRenderbuffer = Instrument_NamedFramebufferRenderbuffer;
+    table->NamedFramebufferParameteri = Instrument_NamedFramebufferParameteri;
+    table->NamedFramebufferTexture = Instrument_NamedFramebufferTexture;
+    table->NamedFramebufferTextureLayer = Instrument_NamedFramebufferTextureLayer;
+    table->NamedFramebufferDrawBuffer = Instrument_NamedFramebufferDrawBuffer;
+    table->NamedFramebufferDrawBuffers = Instrument_NamedFramebufferDrawBuffers;
+    table->NamedFramebufferReadBuffer = Instrument_NamedFramebufferReadBuffer;
+    table->InvalidateNamedFramebufferData = Instrument_InvalidateNamedFramebufferData;
+    table->InvalidateNamedFramebufferSubData = Instrument_InvalidateNamedFramebufferSubData;
+    table->ClearNamedFramebufferiv = Instrument_ClearNamedFramebufferiv;
+    table->ClearNamedFramebufferuiv = Instrument_ClearNamedFramebufferuiv;
+    table->ClearNamedFramebufferfv = Instrument_ClearNamedFramebufferfv;
+    table->ClearNamedFramebufferfi = Instrument_ClearNamedFramebufferfi;
+    table->BlitNamedFramebuffer = Instrument_BlitNamedFramebuffer;
+    table->CheckNamedFramebufferStatus = Instrument_CheckNamedFramebufferStatus;
+    table->GetNamedFramebufferParameteriv = Instrument_GetNamedFramebufferParameteriv;
+    table->GetNamedFramebufferAttachmentParameteriv = Instrument_GetNamedFramebufferAttachmentParameteriv;
+    table->CreateRenderbuffers = Instrument_CreateRenderbuffers;
+    table->NamedRenderbufferStorage = Instrument_NamedRenderbufferStorage;
+    table->NamedRenderbufferStorageMultisample = Instrument_NamedRenderbufferStorageMultisample;
+    table->GetNamedRenderbufferParameteriv = Instrument_GetNamedRenderbufferParameteriv;
+    table->CreateTextures = Instrument_CreateTextures;
+    table->TextureBuffer = Instrument_TextureBuffer;
+    table->TextureBufferRange = Instrument_TextureBufferRange;
+    table->TextureStorage1D = Instrument_TextureStorage1D;
+    table->TextureStorage2D = Instrument_TextureStorage2D;
+    table->TextureStorage3D = Instrument_TextureStorage3D;
+    table->TextureStorage2DMultisample = Instrument_TextureStorage2DMultisample;
+    table->TextureStorage3DMultisample = Instrument_TextureStorage3DMultisample;
+    table->TextureSubImage1D = Instrument_TextureSubImage1D;
+    table->TextureSubImage2D = Instrument_TextureSubImage2D;
+    table->TextureSubImage3D = Instrument_TextureSubImage3D;
+    table->CompressedTextureSubImage1D = Instrument_CompressedTextureSubImage1D;
+    table->CompressedTextureSubImage2D = Instrument_CompressedTextureSubImage2D;
+    table->CompressedTextureSubImage3D = Instrument_CompressedTextureSubImage3D;
+    table->CopyTextureSubImage1D = Instrument_CopyTextureSubImage1D;
+    table->CopyTextureSubImage2D = Instrument_CopyTextureSubImage2D;
+    table->CopyTextureSubImage3D = Instrument_CopyTextureSubImage3D;
+    table->TextureParameterf = Instrument_TextureParameterf;
+    table->TextureParameterfv = Instrument_TextureParameterfv;
+    table->TextureParameteri = Instrument_TextureParameteri;
+    table->TextureParameterIiv = Instrument_TextureParameterIiv;
+    table->TextureParameterIuiv = Instrument_TextureParameterIuiv;
+    table->TextureParameteriv = Instrument_TextureParameteriv;
+    table->GenerateTextureMipmap = Instrument_GenerateTextureMipmap;
+    table->BindTextureUnit = Instrument_BindTextureUnit;
+    table->GetTextureImage = Instrument_GetTextureImage;
+    table->GetCompressedTextureImage = Instrument_GetCompressedTextureImage;
+    table->GetTextureLevelParameterfv = Instrument_GetTextureLevelParameterfv;
+    table->GetTextureLevelParameteriv = Instrument_GetTextureLevelParameteriv;
+    table->GetTextureParameterfv = Instrument_GetTextureParameterfv;
+    table->GetTextureParameterIiv = Instrument_GetTextureParameterIiv;
+    table->GetTextureParameterIuiv = Instrument_GetTextureParameterIuiv;
+    table->GetTextureParameteriv = Instrument_GetTextureParameteriv;
+    table->CreateVertexArrays = Instrument_CreateVertexArrays;
+    table->DisableVertexArrayAttrib = Instrument_DisableVertexArrayAttrib;
+    table->EnableVertexArrayAttrib = Instrument_EnableVertexArrayAttrib;
+    table->VertexArrayElementBuffer = Instrument_VertexArrayElementBuffer;
+    table->VertexArrayVertexBuffer = Instrument_VertexArrayVertexBuffer;
+    table->VertexArrayVertexBuffers = Instrument_VertexArrayVertexBuffers;
+    table->VertexArrayAttribBinding = Instrument_VertexArrayAttribBinding;
+    table->VertexArrayAttribFormat = Instrument_VertexArrayAttribFormat;
+    table->VertexArrayAttribIFormat = Instrument_VertexArrayAttribIFormat;
+    table->VertexArrayAttribLFormat = Instrument_VertexArrayAttribLFormat;
+    table->VertexArrayBindingDivisor = Instrument_VertexArrayBindingDivisor;
+    table->GetVertexArrayiv = Instrument_GetVertexArrayiv;
+    table->GetVertexArrayIndexediv = Instrument_GetVertexArrayIndexediv;
+    table->GetVertexArrayIndexed64iv = Instrument_GetVertexArrayIndexed64iv;
+    table->CreateSamplers = Instrument_CreateSamplers;
+    table->CreateProgramPipelines = Instrument_CreateProgramPipelines;
+    table->CreateQueries = Instrument_CreateQueries;
+    table->GetQueryBufferObjecti64v = Instrument_GetQueryBufferObjecti64v;
+    table->GetQueryBufferObjectiv = Instrument_GetQueryBufferObjectiv;
+    table->GetQueryBufferObjectui64v = Instrument_GetQueryBufferObjectui64v;
+    table->GetQueryBufferObjectuiv = Instrument_GetQueryBufferObjectuiv;
+    table->MemoryBarrierByRegion = Instrument_MemoryBarrierByRegion;
+    table->GetTextureSubImage = Instrument_GetTextureSubImage;
+    table->GetCompressedTextureSubImage = Instrument_GetCompressedTextureSubImage;
+    table->GetGraphicsResetStatus = Instrument_GetGraphicsResetStatus;
+    table->GetnCompressedTexImage = Instrument_GetnCompressedTexImage;
+    table->GetnTexImage = Instrument_GetnTexImage;
+    table->GetnUniformdv = Instrument_GetnUniformdv;
+    table->GetnUniformfv = Instrument_GetnUniformfv;
+    table->GetnUniformiv = Instrument_GetnUniformiv;
+    table->GetnUniformuiv = Instrument_GetnUniformuiv;
+    table->ReadnPixels = Instrument_ReadnPixels;
+    table->TextureBarrier = Instrument_TextureBarrier;
+    table->GetTextureHandleARB = Instrument_GetTextureHandleARB;
+    table->GetTextureSamplerHandleARB = Instrument_GetTextureSamplerHandleARB;
+    table->MakeTextureHandleResidentARB = Instrument_MakeTextureHandleResidentARB;
+    table->MakeTextureHandleNonResidentARB = Instrument_MakeTextureHandleNonResidentARB;
+    table->GetImageHandleARB = Instrument_GetImageHandleARB;
+    table->MakeImageHandleResidentARB = Instrument_MakeImageHandleResidentARB;
+    table->MakeImageHandleNonResidentARB = Instrument_MakeImageHandleNonResidentARB;
+    table->UniformHandleui64ARB = Instrument_UniformHandleui64ARB;
+    table->UniformHandleui64vARB = Instrument_UniformHandleui64vARB;
+    table->ProgramUniformHandleui64ARB = Instrument_ProgramUniformHandleui64ARB;
+    table->ProgramUniformHandleui64vARB = Instrument_ProgramUniformHandleui64vARB;
+    table->IsTextureHandleResidentARB = Instrument_IsTextureHandleResidentARB;
+    table->IsImageHandleResidentARB = Instrument_IsImageHandleResidentARB;
+    table->VertexAttribL1ui64ARB = Instrument_VertexAttribL1ui64ARB;
+    table->VertexAttribL1ui64vARB = Instrument_VertexAttribL1ui64vARB;
+    table->GetVertexAttribLui64vARB = Instrument_GetVertexAttribLui64vARB;
+    table->CreateSyncFromCLeventARB = Instrument_CreateSyncFromCLeventARB;
+    table->DispatchComputeGroupSizeARB = Instrument_DispatchComputeGroupSizeARB;
+    table->DebugMessageControlARB = Instrument_DebugMessageControlARB;
+    table->DebugMessageInsertARB = Instrument_DebugMessageInsertARB;
+    table->DebugMessageCallbackARB = Instrument_DebugMessageCallbackARB;
+    table->GetDebugMessageLogARB = Instrument_GetDebugMessageLogARB;
+    table->BlendEquationiARB = Instrument_BlendEquationiARB;
+    table->BlendEquationSeparateiARB = Instrument_BlendEquationSeparateiARB;
+    table->BlendFunciARB = Instrument_BlendFunciARB;
+    table->BlendFuncSeparateiARB = Instrument_BlendFuncSeparateiARB;
+    table->MultiDrawArraysIndirectCountARB = Instrument_MultiDrawArraysIndirectCountARB;
+    table->MultiDrawElementsIndirectCountARB = Instrument_MultiDrawElementsIndirectCountARB;
+    table->GetGraphicsResetStatusARB = Instrument_GetGraphicsResetStatusARB;
+    table->GetnTexImageARB = Instrument_GetnTexImageARB;
+    table->ReadnPixelsARB = Instrument_ReadnPixelsARB;
+    table->GetnCompressedTexImageARB = Instrument_GetnCompressedTexImageARB;
+    table->GetnUniformfvARB = Instrument_GetnUniformfvARB;
+    table->GetnUniformivARB = Instrument_GetnUniformivARB;
+    table->GetnUniformuivARB = Instrument_GetnUniformuivARB;
+    table->GetnUniformdvARB = Instrument_GetnUniformdvARB;
+    table->MinSampleShadingARB = Instrument_MinSampleShadingARB;
+    table->NamedStringARB = Instrument_NamedStringARB;
+    table->DeleteNamedStringARB = Instrument_DeleteNamedStringARB;
+    table->CompileShaderIncludeARB = Instrument_CompileShaderIncludeARB;
+    table->IsNamedStringARB = Instrument_IsNamedStringARB;
+    table->GetNamedStringARB = Instrument_GetNamedStringARB;
+    table->GetNamedStringivARB = Instrument_GetNamedStringivARB;
+    table->BufferPageCommitmentARB = Instrument_BufferPageCommitmentARB;
+    table->NamedBufferPageCommitmentEXT = Instrument_NamedBufferPageCommitmentEXT;
+    table->NamedBufferPageCommitmentARB = Instrument_NamedBufferPageCommitmentARB;
+    table->TexPageCommitmentARB = Instrument_TexPageCommitmentARB;
+    table->GetMultisamplefvNV = Instrument_GetMultisamplefvNV;
+    table->SampleMaskIndexedNV = Instrument_SampleMaskIndexedNV;
+    table->TexRenderbufferNV = Instrument_TexRenderbufferNV;
+    table->MakeBufferResidentNV = Instrument_MakeBufferResidentNV;
+    table->MakeBufferNonResidentNV = Instrument_MakeBufferNonResidentNV;
+    table->IsBufferResidentNV = Instrument_IsBufferResidentNV;
+    table->MakeNamedBufferResidentNV = Instrument_MakeNamedBufferResidentNV;
+    table->MakeNamedBufferNonResidentNV = Instrument_MakeNamedBufferNonResidentNV;
+    table->IsNamedBufferResidentNV = Instrument_IsNamedBufferResidentNV;
+    table->GetBufferParameterui64vNV = Instrument_GetBufferParameterui64vNV;
+    table->GetNamedBufferParameterui64vNV = Instrument_GetNamedBufferParameterui64vNV;
+    table->GetIntegerui64vNV = Instrument_GetIntegerui64vNV;
+    table->Uniformui64NV = Instrument_Uniformui64NV;
+    table->Uniformui64vNV = Instrument_Uniformui64vNV;
+    table->ProgramUniformui64NV = Instrument_ProgramUniformui64NV;
+    table->ProgramUniformui64vNV = Instrument_ProgramUniformui64vNV;
+    table->BufferAddressRangeNV = Instrument_BufferAddressRangeNV;
+    table->VertexFormatNV = Instrument_VertexFormatNV;
+    table->NormalFormatNV = Instrument_NormalFormatNV;
+    table->ColorFormatNV = Instrument_ColorFormatNV;
+    table->IndexFormatNV = Instrument_IndexFormatNV;
+    table->TexCoordFormatNV = Instrument_TexCoordFormatNV;
+    table->EdgeFlagFormatNV = Instrument_EdgeFlagFormatNV;
+    table->SecondaryColorFormatNV = Instrument_SecondaryColorFormatNV;
+    table->FogCoordFormatNV = Instrument_FogCoordFormatNV;
+    table->VertexAttribFormatNV = Instrument_VertexAttribFormatNV;
+    table->VertexAttribIFormatNV = Instrument_VertexAttribIFormatNV;
+    table->GetIntegerui64i_vNV = Instrument_GetIntegerui64i_vNV;
+    table->EnableClientState = Instrument_EnableClientState;
+    table->DisableClientState = Instrument_DisableClientState;
+}
+
+} /* namespace internal */
+} /* namespace oglp */
+
+#endif /* defined OGLP_INSTRUMENT */
@@ -0,0 +1,4634 @@
+/*
+ * Copyright (c) 2014 Daniel Kirchner
+ *
+ * Copying and distribution of this file, with or without modification,
+ * are permitted in any medium without royalty provided the copyright
+ * notice and this notice are preserved.  This file is offered as-is,
+ * without any warranty. 
+ */
+/* This file was generated by glcorew_gen.py.
+ * Don't change it directly, change glcorew_gen.py instead.*/
+#ifdef OGLP_NULL_EXPORT
+#ifndef GL_GLEXT_PROTOTYPES
+#define GL_GLEXT_PROTOTYPES
+#endif
+#endif
+#include <oglp/nulldriver.h>
+
+/* With OGLP_NULL_EXPORT the stubs of core versions are exported under
+ * their OpenGL names, so that the null driver can be linked in place of
+ * the OpenGL library by code built with OGLP_DIRECT_LINK. */
+#ifdef OGLP_NULL_EXPORT
+#define OGLP_NULL_CORE extern "C"
+#define OGLP_NULL_CORE_NAME(name) gl##name
+#else
+#define OGLP_NULL_CORE static
+#define OGLP_NULL_CORE_NAME(name) Null_##name
+#endif
+
+namespace oglp {
+namespace internal {
+
+std::atomic<unsigned long> nullcounts[730];
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CullFace) (GLenum)
+{
+    NullCount (0);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (FrontFace) (GLenum)
+{
+    NullCount (1);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Hint) (GLenum, GLenum)
+{
+    NullCount (2);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (LineWidth) (GLfloat)
+{
+    NullCount (3);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (PointSize) (GLfloat)
+{
+    NullCount (4);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (PolygonMode) (GLenum, GLenum)
+{
+    NullCount (5);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Scissor) (GLint, GLint, GLsizei, GLsizei)
+{
+    NullCount (6);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TexParameterf) (GLenum, GLenum, GLfloat)
+{
+    NullCount (7);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TexParameterfv) (GLenum, GLenum, const GLfloat *)
+{
+    NullCount (8);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TexParameteri) (GLenum, GLenum, GLint)
+{
+    NullCount (9);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TexParameteriv) (GLenum, GLenum, const GLint *)
+{
+    NullCount (10);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TexImage1D) (GLenum, GLint, GLint, GLsizei, GLint, GLenum, GLenum, const void *)
+{
+    NullCount (11);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TexImage2D) (GLenum, GLint, GLint, GLsizei, GLsizei, GLint, GLenum, GLenum, const void *)
+{
+    NullCount (12);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DrawBuffer) (GLenum)
+{
+    NullCount (13);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Clear) (GLbitfield)
+{
+    NullCount (14);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ClearColor) (GLfloat, GLfloat, GLfloat, GLfloat)
+{
+    NullCount (15);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ClearStencil) (GLint)
+{
+    NullCount (16);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ClearDepth) (GLdouble)
+{
+    NullCount (17);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (StencilMask) (GLuint)
+{
+    NullCount (18);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ColorMask) (GLboolean, GLboolean, GLboolean, GLboolean)
+{
+    NullCount (19);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DepthMask) (GLboolean)
+{
+    NullCount (20);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Disable) (GLenum)
+{
+    NullCount (21);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Enable) (GLenum)
+{
+    NullCount (22);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Finish) (void)
+{
+    NullCount (23);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Flush) (void)
+{
+    NullCount (24);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BlendFunc) (GLenum, GLenum)
+{
+    NullCount (25);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (LogicOp) (GLenum)
+{
+    NullCount (26);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (StencilFunc) (GLenum, GLint, GLuint)
+{
+    NullCount (27);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (StencilOp) (GLenum, GLenum, GLenum)
+{
+    NullCount (28);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DepthFunc) (GLenum)
+{
+    NullCount (29);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (PixelStoref) (GLenum, GLfloat)
+{
+    NullCount (30);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (PixelStorei) (GLenum, GLint)
+{
+    NullCount (31);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ReadBuffer) (GLenum)
+{
+    NullCount (32);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ReadPixels) (GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, void *)
+{
+    NullCount (33);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetBooleanv) (GLenum pname, GLboolean *data)
+{
+    NullCount (34);
+    NullQuery (pname, data);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetDoublev) (GLenum pname, GLdouble *data)
+{
+    NullCount (35);
+    NullQuery (pname, data);
+}
+
+OGLP_NULL_CORE GLenum APIENTRY OGLP_NULL_CORE_NAME (GetError) (void)
+{
+    NullCount (36);
+    return 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetFloatv) (GLenum pname, GLfloat *data)
+{
+    NullCount (37);
+    NullQuery (pname, data);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetIntegerv) (GLenum pname, GLint *data)
+{
+    NullCount (38);
+    NullQuery (pname, data);
+}
+
+OGLP_NULL_CORE const GLubyte * APIENTRY OGLP_NULL_CORE_NAME (GetString) (GLenum name)
+{
+    NullCount (39);
+    return NullString (name);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetTexImage) (GLenum, GLint, GLenum, GLenum, void *)
+{
+    NullCount (40);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetTexParameterfv) (GLenum, GLenum pname, GLfloat *params)
+{
+    NullCount (41);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetTexParameteriv) (GLenum, GLenum pname, GLint *params)
+{
+    NullCount (42);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetTexLevelParameterfv) (GLenum, GLint, GLenum pname, GLfloat *params)
+{
+    NullCount (43);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetTexLevelParameteriv) (GLenum, GLint, GLenum pname, GLint *params)
+{
+    NullCount (44);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE GLboolean APIENTRY OGLP_NULL_CORE_NAME (IsEnabled) (GLenum)
+{
+    NullCount (45);
+    return 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DepthRange) (GLdouble, GLdouble)
+{
+    NullCount (46);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Viewport) (GLint, GLint, GLsizei, GLsizei)
+{
+    NullCount (47);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DrawArrays) (GLenum, GLint, GLsizei)
+{
+    NullCount (48);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DrawElements) (GLenum, GLsizei, GLenum, const void *)
+{
+    NullCount (49);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetPointerv) (GLenum, void **)
+{
+    NullCount (50);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (PolygonOffset) (GLfloat, GLfloat)
+{
+    NullCount (51);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CopyTexImage1D) (GLenum, GLint, GLenum, GLint, GLint, GLsizei, GLint)
+{
+    NullCount (52);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CopyTexImage2D) (GLenum, GLint, GLenum, GLint, GLint, GLsizei, GLsizei, GLint)
+{
+    NullCount (53);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CopyTexSubImage1D) (GLenum, GLint, GLint, GLint, GLint, GLsizei)
+{
+    NullCount (54);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CopyTexSubImage2D) (GLenum, GLint, GLint, GLint, GLint, GLint, GLsizei, GLsizei)
+{
+    NullCount (55);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TexSubImage1D) (GLenum, GLint, GLint, GLsizei, GLenum, GLenum, const void *)
+{
+    NullCount (56);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TexSubImage2D) (GLenum, GLint, GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, const void *)
+{
+    NullCount (57);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BindTexture) (GLenum, GLuint)
+{
+    NullCount (58);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DeleteTextures) (GLsizei, const GLuint *)
+{
+    NullCount (59);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GenTextures) (GLsizei n, GLuint *textures)
+{
+    NullCount (60);
+    NullNames (n, textures);
+}
+
+OGLP_NULL_CORE GLboolean APIENTRY OGLP_NULL_CORE_NAME (IsTexture) (GLuint)
+{
+    NullCount (61);
+    return 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DrawRangeElements) (GLenum, GLuint, GLuint, GLsizei, GLenum, const void *)
+{
+    NullCount (62);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TexImage3D) (GLenum, GLint, GLint, GLsizei, GLsizei, GLsizei, GLint, GLenum, GLenum, const void *)
+{
+    NullCount (63);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TexSubImage3D) (GLenum, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLenum, const void *)
+{
+    NullCount (64);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CopyTexSubImage3D) (GLenum, GLint, GLint, GLint, GLint, GLint, GLint, GLsizei, GLsizei)
+{
+    NullCount (65);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ActiveTexture) (GLenum)
+{
+    NullCount (66);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (SampleCoverage) (GLfloat, GLboolean)
+{
+    NullCount (67);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CompressedTexImage3D) (GLenum, GLint, GLenum, GLsizei, GLsizei, GLsizei, GLint, GLsizei, const void *)
+{
+    NullCount (68);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CompressedTexImage2D) (GLenum, GLint, GLenum, GLsizei, GLsizei, GLint, GLsizei, const void *)
+{
+    NullCount (69);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CompressedTexImage1D) (GLenum, GLint, GLenum, GLsizei, GLint, GLsizei, const void *)
+{
+    NullCount (70);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CompressedTexSubImage3D) (GLenum, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLsizei, const void *)
+{
+    NullCount (71);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CompressedTexSubImage2D) (GLenum, GLint, GLint, GLint, GLsizei, GLsizei, GLenum, GLsizei, const void *)
+{
+    NullCount (72);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CompressedTexSubImage1D) (GLenum, GLint, GLint, GLsizei, GLenum, GLsizei, const void *)
+{
+    NullCount (73);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetCompressedTexImage) (GLenum, GLint, void *)
+{
+    NullCount (74);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BlendFuncSeparate) (GLenum, GLenum, GLenum, GLenum)
+{
+    NullCount (75);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (MultiDrawArrays) (GLenum, const GLint *, const GLsizei *, GLsizei)
+{
+    NullCount (76);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (MultiDrawElements) (GLenum, const GLsizei *, GLenum, const void *const*, GLsizei)
+{
+    NullCount (77);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (PointParameterf) (GLenum, GLfloat)
+{
+    NullCount (78);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (PointParameterfv) (GLenum, const GLfloat *)
+{
+    NullCount (79);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (PointParameteri) (GLenum, GLint)
+{
+    NullCount (80);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (PointParameteriv) (GLenum, const GLint *)
+{
+    NullCount (81);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BlendColor) (GLfloat, GLfloat, GLfloat, GLfloat)
+{
+    NullCount (82);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BlendEquation) (GLenum)
+{
+    NullCount (83);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GenQueries) (GLsizei n, GLuint *ids)
+{
+    NullCount (84);
+    NullNames (n, ids);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DeleteQueries) (GLsizei, const GLuint *)
+{
+    NullCount (85);
+}
+
+OGLP_NULL_CORE GLboolean APIENTRY OGLP_NULL_CORE_NAME (IsQuery) (GLuint)
+{
+    NullCount (86);
+    return 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BeginQuery) (GLenum, GLuint)
+{
+    NullCount (87);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (EndQuery) (GLenum)
+{
+    NullCount (88);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetQueryiv) (GLenum, GLenum pname, GLint *params)
+{
+    NullCount (89);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetQueryObjectiv) (GLuint, GLenum pname, GLint *params)
+{
+    NullCount (90);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetQueryObjectuiv) (GLuint, GLenum pname, GLuint *params)
+{
+    NullCount (91);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BindBuffer) (GLenum, GLuint)
+{
+    NullCount (92);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DeleteBuffers) (GLsizei, const GLuint *)
+{
+    NullCount (93);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GenBuffers) (GLsizei n, GLuint *buffers)
+{
+    NullCount (94);
+    NullNames (n, buffers);
+}
+
+OGLP_NULL_CORE GLboolean APIENTRY OGLP_NULL_CORE_NAME (IsBuffer) (GLuint)
+{
+    NullCount (95);
+    return 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BufferData) (GLenum, GLsizeiptr, const void *, GLenum)
+{
+    NullCount (96);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BufferSubData) (GLenum, GLintptr, GLsizeiptr, const void *)
+{
+    NullCount (97);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetBufferSubData) (GLenum, GLintptr, GLsizeiptr, void *)
+{
+    NullCount (98);
+}
+
+OGLP_NULL_CORE void * APIENTRY OGLP_NULL_CORE_NAME (MapBuffer) (GLenum target, GLenum)
+{
+    NullCount (99);
+    return NullMapTarget (target, 0, 0);
+}
+
+OGLP_NULL_CORE GLboolean APIENTRY OGLP_NULL_CORE_NAME (UnmapBuffer) (GLenum)
+{
+    NullCount (100);
+    return GL_TRUE;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetBufferParameteriv) (GLenum, GLenum pname, GLint *params)
+{
+    NullCount (101);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetBufferPointerv) (GLenum, GLenum, void **)
+{
+    NullCount (102);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BlendEquationSeparate) (GLenum, GLenum)
+{
+    NullCount (103);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DrawBuffers) (GLsizei, const GLenum *)
+{
+    NullCount (104);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (StencilOpSeparate) (GLenum, GLenum, GLenum, GLenum)
+{
+    NullCount (105);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (StencilFuncSeparate) (GLenum, GLenum, GLint, GLuint)
+{
+    NullCount (106);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (StencilMaskSeparate) (GLenum, GLuint)
+{
+    NullCount (107);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (AttachShader) (GLuint, GLuint)
+{
+    NullCount (108);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BindAttribLocation) (GLuint, GLuint, const GLchar *)
+{
+    NullCount (109);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CompileShader) (GLuint)
+{
+    NullCount (110);
+}
+
+OGLP_NULL_CORE GLuint APIENTRY OGLP_NULL_CORE_NAME (CreateProgram) (void)
+{
+    NullCount (111);
+    return NullName ();
+}
+
+OGLP_NULL_CORE GLuint APIENTRY OGLP_NULL_CORE_NAME (CreateShader) (GLenum)
+{
+    NullCount (112);
+    return NullName ();
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DeleteProgram) (GLuint)
+{
+    NullCount (113);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DeleteShader) (GLuint)
+{
+    NullCount (114);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DetachShader) (GLuint, GLuint)
+{
+    NullCount (115);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DisableVertexAttribArray) (GLuint)
+{
+    NullCount (116);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (EnableVertexAttribArray) (GLuint)
+{
+    NullCount (117);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetActiveAttrib) (GLuint, GLuint, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+    NullCount (118);
+    if (length) *length = 0;
+    NullQuery (0, size);
+    NullQuery (0, type);
+    if (name && bufSize > 0) name[0] = 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetActiveUniform) (GLuint, GLuint, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+    NullCount (119);
+    if (length) *length = 0;
+    NullQuery (0, size);
+    NullQuery (0, type);
+    if (name && bufSize > 0) name[0] = 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetAttachedShaders) (GLuint, GLsizei, GLsizei *count, GLuint *shaders)
+{
+    NullCount (120);
+    if (count) *count = 0;
+    NullQuery (0, shaders);
+}
+
+OGLP_NULL_CORE GLint APIENTRY OGLP_NULL_CORE_NAME (GetAttribLocation) (GLuint, const GLchar *)
+{
+    NullCount (121);
+    return 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetProgramiv) (GLuint, GLenum pname, GLint *params)
+{
+    NullCount (122);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetProgramInfoLog) (GLuint, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    NullCount (123);
+    if (length) *length = 0;
+    if (infoLog && bufSize > 0) infoLog[0] = 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetShaderiv) (GLuint, GLenum pname, GLint *params)
+{
+    NullCount (124);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetShaderInfoLog) (GLuint, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    NullCount (125);
+    if (length) *length = 0;
+    if (infoLog && bufSize > 0) infoLog[0] = 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetShaderSource) (GLuint, GLsizei bufSize, GLsizei *length, GLchar *source)
+{
+    NullCount (126);
+    if (length) *length = 0;
+    if (source && bufSize > 0) source[0] = 0;
+}
+
+OGLP_NULL_CORE GLint APIENTRY OGLP_NULL_CORE_NAME (GetUniformLocation) (GLuint, const GLchar *)
+{
+    NullCount (127);
+    return 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetUniformfv) (GLuint, GLint, GLfloat *params)
+{
+    NullCount (128);
+    NullQuery (0, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetUniformiv) (GLuint, GLint, GLint *params)
+{
+    NullCount (129);
+    NullQuery (0, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetVertexAttribdv) (GLuint, GLenum pname, GLdouble *params)
+{
+    NullCount (130);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetVertexAttribfv) (GLuint, GLenum pname, GLfloat *params)
+{
+    NullCount (131);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetVertexAttribiv) (GLuint, GLenum pname, GLint *params)
+{
+    NullCount (132);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetVertexAttribPointerv) (GLuint, GLenum, void **)
+{
+    NullCount (133);
+}
+
+OGLP_NULL_CORE GLboolean APIENTRY OGLP_NULL_CORE_NAME (IsProgram) (GLuint)
+{
+    NullCount (134);
+    return 0;
+}
+
+OGLP_NULL_CORE GLboolean APIENTRY OGLP_NULL_CORE_NAME (IsShader) (GLuint)
+{
+    NullCount (135);
+    return 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (LinkProgram) (GLuint)
+{
+    NullCount (136);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ShaderSource) (GLuint, GLsizei, const GLchar *const*, const GLint *)
+{
+    NullCount (137);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (UseProgram) (GLuint)
+{
+    NullCount (138);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform1f) (GLint, GLfloat)
+{
+    NullCount (139);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform2f) (GLint, GLfloat, GLfloat)
+{
+    NullCount (140);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform3f) (GLint, GLfloat, GLfloat, GLfloat)
+{
+    NullCount (141);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform4f) (GLint, GLfloat, GLfloat, GLfloat, GLfloat)
+{
+    NullCount (142);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform1i) (GLint, GLint)
+{
+    NullCount (143);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform2i) (GLint, GLint, GLint)
+{
+    NullCount (144);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform3i) (GLint, GLint, GLint, GLint)
+{
+    NullCount (145);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform4i) (GLint, GLint, GLint, GLint, GLint)
+{
+    NullCount (146);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform1fv) (GLint, GLsizei, const GLfloat *)
+{
+    NullCount (147);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform2fv) (GLint, GLsizei, const GLfloat *)
+{
+    NullCount (148);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform3fv) (GLint, GLsizei, const GLfloat *)
+{
+    NullCount (149);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform4fv) (GLint, GLsizei, const GLfloat *)
+{
+    NullCount (150);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform1iv) (GLint, GLsizei, const GLint *)
+{
+    NullCount (151);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform2iv) (GLint, GLsizei, const GLint *)
+{
+    NullCount (152);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform3iv) (GLint, GLsizei, const GLint *)
+{
+    NullCount (153);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform4iv) (GLint, GLsizei, const GLint *)
+{
+    NullCount (154);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (UniformMatrix2fv) (GLint, GLsizei, GLboolean, const GLfloat *)
+{
+    NullCount (155);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (UniformMatrix3fv) (GLint, GLsizei, GLboolean, const GLfloat *)
+{
+    NullCount (156);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (UniformMatrix4fv) (GLint, GLsizei, GLboolean, const GLfloat *)
+{
+    NullCount (157);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ValidateProgram) (GLuint)
+{
+    NullCount (158);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib1d) (GLuint, GLdouble)
+{
+    NullCount (159);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib1dv) (GLuint, const GLdouble *)
+{
+    NullCount (160);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib1f) (GLuint, GLfloat)
+{
+    NullCount (161);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib1fv) (GLuint, const GLfloat *)
+{
+    NullCount (162);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib1s) (GLuint, GLshort)
+{
+    NullCount (163);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib1sv) (GLuint, const GLshort *)
+{
+    NullCount (164);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib2d) (GLuint, GLdouble, GLdouble)
+{
+    NullCount (165);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib2dv) (GLuint, const GLdouble *)
+{
+    NullCount (166);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib2f) (GLuint, GLfloat, GLfloat)
+{
+    NullCount (167);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib2fv) (GLuint, const GLfloat *)
+{
+    NullCount (168);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib2s) (GLuint, GLshort, GLshort)
+{
+    NullCount (169);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib2sv) (GLuint, const GLshort *)
+{
+    NullCount (170);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib3d) (GLuint, GLdouble, GLdouble, GLdouble)
+{
+    NullCount (171);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib3dv) (GLuint, const GLdouble *)
+{
+    NullCount (172);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib3f) (GLuint, GLfloat, GLfloat, GLfloat)
+{
+    NullCount (173);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib3fv) (GLuint, const GLfloat *)
+{
+    NullCount (174);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib3s) (GLuint, GLshort, GLshort, GLshort)
+{
+    NullCount (175);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib3sv) (GLuint, const GLshort *)
+{
+    NullCount (176);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib4Nbv) (GLuint, const GLbyte *)
+{
+    NullCount (177);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib4Niv) (GLuint, const GLint *)
+{
+    NullCount (178);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib4Nsv) (GLuint, const GLshort *)
+{
+    NullCount (179);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib4Nub) (GLuint, GLubyte, GLubyte, GLubyte, GLubyte)
+{
+    NullCount (180);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib4Nubv) (GLuint, const GLubyte *)
+{
+    NullCount (181);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib4Nuiv) (GLuint, const GLuint *)
+{
+    NullCount (182);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib4Nusv) (GLuint, const GLushort *)
+{
+    NullCount (183);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib4bv) (GLuint, const GLbyte *)
+{
+    NullCount (184);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib4d) (GLuint, GLdouble, GLdouble, GLdouble, GLdouble)
+{
+    NullCount (185);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib4dv) (GLuint, const GLdouble *)
+{
+    NullCount (186);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib4f) (GLuint, GLfloat, GLfloat, GLfloat, GLfloat)
+{
+    NullCount (187);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib4fv) (GLuint, const GLfloat *)
+{
+    NullCount (188);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib4iv) (GLuint, const GLint *)
+{
+    NullCount (189);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib4s) (GLuint, GLshort, GLshort, GLshort, GLshort)
+{
+    NullCount (190);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib4sv) (GLuint, const GLshort *)
+{
+    NullCount (191);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib4ubv) (GLuint, const GLubyte *)
+{
+    NullCount (192);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib4uiv) (GLuint, const GLuint *)
+{
+    NullCount (193);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttrib4usv) (GLuint, const GLushort *)
+{
+    NullCount (194);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribPointer) (GLuint, GLint, GLenum, GLboolean, GLsizei, const void *)
+{
+    NullCount (195);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (UniformMatrix2x3fv) (GLint, GLsizei, GLboolean, const GLfloat *)
+{
+    NullCount (196);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (UniformMatrix3x2fv) (GLint, GLsizei, GLboolean, const GLfloat *)
+{
+    NullCount (197);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (UniformMatrix2x4fv) (GLint, GLsizei, GLboolean, const GLfloat *)
+{
+    NullCount (198);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (UniformMatrix4x2fv) (GLint, GLsizei, GLboolean, const GLfloat *)
+{
+    NullCount (199);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (UniformMatrix3x4fv) (GLint, GLsizei, GLboolean, const GLfloat *)
+{
+    NullCount (200);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (UniformMatrix4x3fv) (GLint, GLsizei, GLboolean, const GLfloat *)
+{
+    NullCount (201);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ColorMaski) (GLuint, GLboolean, GLboolean, GLboolean, GLboolean)
+{
+    NullCount (202);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetBooleani_v) (GLenum target, GLuint, GLboolean *data)
+{
+    NullCount (203);
+    NullQuery (target, data);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetIntegeri_v) (GLenum target, GLuint, GLint *data)
+{
+    NullCount (204);
+    NullQuery (target, data);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Enablei) (GLenum, GLuint)
+{
+    NullCount (205);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Disablei) (GLenum, GLuint)
+{
+    NullCount (206);
+}
+
+OGLP_NULL_CORE GLboolean APIENTRY OGLP_NULL_CORE_NAME (IsEnabledi) (GLenum, GLuint)
+{
+    NullCount (207);
+    return 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BeginTransformFeedback) (GLenum)
+{
+    NullCount (208);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (EndTransformFeedback) (void)
+{
+    NullCount (209);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BindBufferRange) (GLenum, GLuint, GLuint, GLintptr, GLsizeiptr)
+{
+    NullCount (210);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BindBufferBase) (GLenum, GLuint, GLuint)
+{
+    NullCount (211);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TransformFeedbackVaryings) (GLuint, GLsizei, const GLchar *const*, GLenum)
+{
+    NullCount (212);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetTransformFeedbackVarying) (GLuint, GLuint, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name)
+{
+    NullCount (213);
+    if (length) *length = 0;
+    NullQuery (0, size);
+    NullQuery (0, type);
+    if (name && bufSize > 0) name[0] = 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ClampColor) (GLenum, GLenum)
+{
+    NullCount (214);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BeginConditionalRender) (GLuint, GLenum)
+{
+    NullCount (215);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (EndConditionalRender) (void)
+{
+    NullCount (216);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribIPointer) (GLuint, GLint, GLenum, GLsizei, const void *)
+{
+    NullCount (217);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetVertexAttribIiv) (GLuint, GLenum pname, GLint *params)
+{
+    NullCount (218);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetVertexAttribIuiv) (GLuint, GLenum pname, GLuint *params)
+{
+    NullCount (219);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribI1i) (GLuint, GLint)
+{
+    NullCount (220);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribI2i) (GLuint, GLint, GLint)
+{
+    NullCount (221);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribI3i) (GLuint, GLint, GLint, GLint)
+{
+    NullCount (222);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribI4i) (GLuint, GLint, GLint, GLint, GLint)
+{
+    NullCount (223);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribI1ui) (GLuint, GLuint)
+{
+    NullCount (224);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribI2ui) (GLuint, GLuint, GLuint)
+{
+    NullCount (225);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribI3ui) (GLuint, GLuint, GLuint, GLuint)
+{
+    NullCount (226);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribI4ui) (GLuint, GLuint, GLuint, GLuint, GLuint)
+{
+    NullCount (227);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribI1iv) (GLuint, const GLint *)
+{
+    NullCount (228);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribI2iv) (GLuint, const GLint *)
+{
+    NullCount (229);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribI3iv) (GLuint, const GLint *)
+{
+    NullCount (230);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribI4iv) (GLuint, const GLint *)
+{
+    NullCount (231);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribI1uiv) (GLuint, const GLuint *)
+{
+    NullCount (232);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribI2uiv) (GLuint, const GLuint *)
+{
+    NullCount (233);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribI3uiv) (GLuint, const GLuint *)
+{
+    NullCount (234);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribI4uiv) (GLuint, const GLuint *)
+{
+    NullCount (235);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribI4bv) (GLuint, const GLbyte *)
+{
+    NullCount (236);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribI4sv) (GLuint, const GLshort *)
+{
+    NullCount (237);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribI4ubv) (GLuint, const GLubyte *)
+{
+    NullCount (238);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribI4usv) (GLuint, const GLushort *)
+{
+    NullCount (239);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetUniformuiv) (GLuint, GLint, GLuint *params)
+{
+    NullCount (240);
+    NullQuery (0, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BindFragDataLocation) (GLuint, GLuint, const GLchar *)
+{
+    NullCount (241);
+}
+
+OGLP_NULL_CORE GLint APIENTRY OGLP_NULL_CORE_NAME (GetFragDataLocation) (GLuint, const GLchar *)
+{
+    NullCount (242);
+    return 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform1ui) (GLint, GLuint)
+{
+    NullCount (243);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform2ui) (GLint, GLuint, GLuint)
+{
+    NullCount (244);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform3ui) (GLint, GLuint, GLuint, GLuint)
+{
+    NullCount (245);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform4ui) (GLint, GLuint, GLuint, GLuint, GLuint)
+{
+    NullCount (246);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform1uiv) (GLint, GLsizei, const GLuint *)
+{
+    NullCount (247);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform2uiv) (GLint, GLsizei, const GLuint *)
+{
+    NullCount (248);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform3uiv) (GLint, GLsizei, const GLuint *)
+{
+    NullCount (249);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform4uiv) (GLint, GLsizei, const GLuint *)
+{
+    NullCount (250);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TexParameterIiv) (GLenum, GLenum, const GLint *)
+{
+    NullCount (251);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TexParameterIuiv) (GLenum, GLenum, const GLuint *)
+{
+    NullCount (252);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetTexParameterIiv) (GLenum, GLenum pname, GLint *params)
+{
+    NullCount (253);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetTexParameterIuiv) (GLenum, GLenum pname, GLuint *params)
+{
+    NullCount (254);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ClearBufferiv) (GLenum, GLint, const GLint *)
+{
+    NullCount (255);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ClearBufferuiv) (GLenum, GLint, const GLuint *)
+{
+    NullCount (256);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ClearBufferfv) (GLenum, GLint, const GLfloat *)
+{
+    NullCount (257);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ClearBufferfi) (GLenum, GLint, GLfloat, GLint)
+{
+    NullCount (258);
+}
+
+OGLP_NULL_CORE const GLubyte * APIENTRY OGLP_NULL_CORE_NAME (GetStringi) (GLenum name, GLuint index)
+{
+    NullCount (259);
+    return NullStringi (name, index);
+}
+
+OGLP_NULL_CORE GLboolean APIENTRY OGLP_NULL_CORE_NAME (IsRenderbuffer) (GLuint)
+{
+    NullCount (260);
+    return 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BindRenderbuffer) (GLenum, GLuint)
+{
+    NullCount (261);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DeleteRenderbuffers) (GLsizei, const GLuint *)
+{
+    NullCount (262);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GenRenderbuffers) (GLsizei n, GLuint *renderbuffers)
+{
+    NullCount (263);
+    NullNames (n, renderbuffers);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (RenderbufferStorage) (GLenum, GLenum, GLsizei, GLsizei)
+{
+    NullCount (264);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetRenderbufferParameteriv) (GLenum, GLenum pname, GLint *params)
+{
+    NullCount (265);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE GLboolean APIENTRY OGLP_NULL_CORE_NAME (IsFramebuffer) (GLuint)
+{
+    NullCount (266);
+    return 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BindFramebuffer) (GLenum, GLuint)
+{
+    NullCount (267);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DeleteFramebuffers) (GLsizei, const GLuint *)
+{
+    NullCount (268);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GenFramebuffers) (GLsizei n, GLuint *framebuffers)
+{
+    NullCount (269);
+    NullNames (n, framebuffers);
+}
+
+OGLP_NULL_CORE GLenum APIENTRY OGLP_NULL_CORE_NAME (CheckFramebufferStatus) (GLenum)
+{
+    NullCount (270);
+    return GL_FRAMEBUFFER_COMPLETE;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (FramebufferTexture1D) (GLenum, GLenum, GLenum, GLuint, GLint)
+{
+    NullCount (271);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (FramebufferTexture2D) (GLenum, GLenum, GLenum, GLuint, GLint)
+{
+    NullCount (272);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (FramebufferTexture3D) (GLenum, GLenum, GLenum, GLuint, GLint, GLint)
+{
+    NullCount (273);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (FramebufferRenderbuffer) (GLenum, GLenum, GLenum, GLuint)
+{
+    NullCount (274);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetFramebufferAttachmentParameteriv) (GLenum, GLenum, GLenum pname, GLint *params)
+{
+    NullCount (275);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GenerateMipmap) (GLenum)
+{
+    NullCount (276);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BlitFramebuffer) (GLint, GLint, GLint, GLint, GLint, GLint, GLint, GLint, GLbitfield, GLenum)
+{
+    NullCount (277);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (RenderbufferStorageMultisample) (GLenum, GLsizei, GLenum, GLsizei, GLsizei)
+{
+    NullCount (278);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (FramebufferTextureLayer) (GLenum, GLenum, GLuint, GLint, GLint)
+{
+    NullCount (279);
+}
+
+OGLP_NULL_CORE void * APIENTRY OGLP_NULL_CORE_NAME (MapBufferRange) (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield)
+{
+    NullCount (280);
+    return NullMapTarget (target, offset, length);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (FlushMappedBufferRange) (GLenum, GLintptr, GLsizeiptr)
+{
+    NullCount (281);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BindVertexArray) (GLuint)
+{
+    NullCount (282);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DeleteVertexArrays) (GLsizei, const GLuint *)
+{
+    NullCount (283);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GenVertexArrays) (GLsizei n, GLuint *arrays)
+{
+    NullCount (284);
+    NullNames (n, arrays);
+}
+
+OGLP_NULL_CORE GLboolean APIENTRY OGLP_NULL_CORE_NAME (IsVertexArray) (GLuint)
+{
+    NullCount (285);
+    return 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DrawArraysInstanced) (GLenum, GLint, GLsizei, GLsizei)
+{
+    NullCount (286);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DrawElementsInstanced) (GLenum, GLsizei, GLenum, const void *, GLsizei)
+{
+    NullCount (287);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TexBuffer) (GLenum, GLenum, GLuint)
+{
+    NullCount (288);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (PrimitiveRestartIndex) (GLuint)
+{
+    NullCount (289);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CopyBufferSubData) (GLenum, GLenum, GLintptr, GLintptr, GLsizeiptr)
+{
+    NullCount (290);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetUniformIndices) (GLuint, GLsizei, const GLchar *const*, GLuint *uniformIndices)
+{
+    NullCount (291);
+    NullQuery (0, uniformIndices);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetActiveUniformsiv) (GLuint, GLsizei, const GLuint *, GLenum pname, GLint *params)
+{
+    NullCount (292);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetActiveUniformName) (GLuint, GLuint, GLsizei bufSize, GLsizei *length, GLchar *uniformName)
+{
+    NullCount (293);
+    if (length) *length = 0;
+    if (uniformName && bufSize > 0) uniformName[0] = 0;
+}
+
+OGLP_NULL_CORE GLuint APIENTRY OGLP_NULL_CORE_NAME (GetUniformBlockIndex) (GLuint, const GLchar *)
+{
+    NullCount (294);
+    return 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetActiveUniformBlockiv) (GLuint, GLuint, GLenum pname, GLint *params)
+{
+    NullCount (295);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetActiveUniformBlockName) (GLuint, GLuint, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName)
+{
+    NullCount (296);
+    if (length) *length = 0;
+    if (uniformBlockName && bufSize > 0) uniformBlockName[0] = 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (UniformBlockBinding) (GLuint, GLuint, GLuint)
+{
+    NullCount (297);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DrawElementsBaseVertex) (GLenum, GLsizei, GLenum, const void *, GLint)
+{
+    NullCount (298);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DrawRangeElementsBaseVertex) (GLenum, GLuint, GLuint, GLsizei, GLenum, const void *, GLint)
+{
+    NullCount (299);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DrawElementsInstancedBaseVertex) (GLenum, GLsizei, GLenum, const void *, GLsizei, GLint)
+{
+    NullCount (300);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (MultiDrawElementsBaseVertex) (GLenum, const GLsizei *, GLenum, const void *const*, GLsizei, const GLint *)
+{
+    NullCount (301);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProvokingVertex) (GLenum)
+{
+    NullCount (302);
+}
+
+OGLP_NULL_CORE GLsync APIENTRY OGLP_NULL_CORE_NAME (FenceSync) (GLenum, GLbitfield)
+{
+    NullCount (303);
+    return NullSync ();
+}
+
+OGLP_NULL_CORE GLboolean APIENTRY OGLP_NULL_CORE_NAME (IsSync) (GLsync)
+{
+    NullCount (304);
+    return 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DeleteSync) (GLsync)
+{
+    NullCount (305);
+}
+
+OGLP_NULL_CORE GLenum APIENTRY OGLP_NULL_CORE_NAME (ClientWaitSync) (GLsync, GLbitfield, GLuint64)
+{
+    NullCount (306);
+    return GL_ALREADY_SIGNALED;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (WaitSync) (GLsync, GLbitfield, GLuint64)
+{
+    NullCount (307);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetInteger64v) (GLenum pname, GLint64 *data)
+{
+    NullCount (308);
+    NullQuery (pname, data);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetSynciv) (GLsync, GLenum pname, GLsizei, GLsizei *length, GLint *values)
+{
+    NullCount (309);
+    if (length) *length = 0;
+    NullQuery (pname, values);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetInteger64i_v) (GLenum target, GLuint, GLint64 *data)
+{
+    NullCount (310);
+    NullQuery (target, data);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetBufferParameteri64v) (GLenum, GLenum pname, GLint64 *params)
+{
+    NullCount (311);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (FramebufferTexture) (GLenum, GLenum, GLuint, GLint)
+{
+    NullCount (312);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TexImage2DMultisample) (GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLboolean)
+{
+    NullCount (313);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TexImage3DMultisample) (GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLsizei, GLboolean)
+{
+    NullCount (314);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetMultisamplefv) (GLenum pname, GLuint, GLfloat *val)
+{
+    NullCount (315);
+    NullQuery (pname, val);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (SampleMaski) (GLuint, GLbitfield)
+{
+    NullCount (316);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BindFragDataLocationIndexed) (GLuint, GLuint, GLuint, const GLchar *)
+{
+    NullCount (317);
+}
+
+OGLP_NULL_CORE GLint APIENTRY OGLP_NULL_CORE_NAME (GetFragDataIndex) (GLuint, const GLchar *)
+{
+    NullCount (318);
+    return 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GenSamplers) (GLsizei count, GLuint *samplers)
+{
+    NullCount (319);
+    NullNames (count, samplers);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DeleteSamplers) (GLsizei, const GLuint *)
+{
+    NullCount (320);
+}
+
+OGLP_NULL_CORE GLboolean APIENTRY OGLP_NULL_CORE_NAME (IsSampler) (GLuint)
+{
+    NullCount (321);
+    return 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BindSampler) (GLuint, GLuint)
+{
+    NullCount (322);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (SamplerParameteri) (GLuint, GLenum, GLint)
+{
+    NullCount (323);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (SamplerParameteriv) (GLuint, GLenum, const GLint *)
+{
+    NullCount (324);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (SamplerParameterf) (GLuint, GLenum, GLfloat)
+{
+    NullCount (325);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (SamplerParameterfv) (GLuint, GLenum, const GLfloat *)
+{
+    NullCount (326);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (SamplerParameterIiv) (GLuint, GLenum, const GLint *)
+{
+    NullCount (327);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (SamplerParameterIuiv) (GLuint, GLenum, const GLuint *)
+{
+    NullCount (328);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetSamplerParameteriv) (GLuint, GLenum pname, GLint *params)
+{
+    NullCount (329);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetSamplerParameterIiv) (GLuint, GLenum pname, GLint *params)
+{
+    NullCount (330);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetSamplerParameterfv) (GLuint, GLenum pname, GLfloat *params)
+{
+    NullCount (331);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetSamplerParameterIuiv) (GLuint, GLenum pname, GLuint *params)
+{
+    NullCount (332);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (QueryCounter) (GLuint, GLenum)
+{
+    NullCount (333);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetQueryObjecti64v) (GLuint, GLenum pname, GLint64 *params)
+{
+    NullCount (334);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetQueryObjectui64v) (GLuint, GLenum pname, GLuint64 *params)
+{
+    NullCount (335);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribDivisor) (GLuint, GLuint)
+{
+    NullCount (336);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribP1ui) (GLuint, GLenum, GLboolean, GLuint)
+{
+    NullCount (337);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribP1uiv) (GLuint, GLenum, GLboolean, const GLuint *)
+{
+    NullCount (338);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribP2ui) (GLuint, GLenum, GLboolean, GLuint)
+{
+    NullCount (339);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribP2uiv) (GLuint, GLenum, GLboolean, const GLuint *)
+{
+    NullCount (340);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribP3ui) (GLuint, GLenum, GLboolean, GLuint)
+{
+    NullCount (341);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribP3uiv) (GLuint, GLenum, GLboolean, const GLuint *)
+{
+    NullCount (342);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribP4ui) (GLuint, GLenum, GLboolean, GLuint)
+{
+    NullCount (343);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribP4uiv) (GLuint, GLenum, GLboolean, const GLuint *)
+{
+    NullCount (344);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (MinSampleShading) (GLfloat)
+{
+    NullCount (345);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BlendEquationi) (GLuint, GLenum)
+{
+    NullCount (346);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BlendEquationSeparatei) (GLuint, GLenum, GLenum)
+{
+    NullCount (347);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BlendFunci) (GLuint, GLenum, GLenum)
+{
+    NullCount (348);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BlendFuncSeparatei) (GLuint, GLenum, GLenum, GLenum, GLenum)
+{
+    NullCount (349);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DrawArraysIndirect) (GLenum, const void *)
+{
+    NullCount (350);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DrawElementsIndirect) (GLenum, GLenum, const void *)
+{
+    NullCount (351);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform1d) (GLint, GLdouble)
+{
+    NullCount (352);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform2d) (GLint, GLdouble, GLdouble)
+{
+    NullCount (353);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform3d) (GLint, GLdouble, GLdouble, GLdouble)
+{
+    NullCount (354);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform4d) (GLint, GLdouble, GLdouble, GLdouble, GLdouble)
+{
+    NullCount (355);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform1dv) (GLint, GLsizei, const GLdouble *)
+{
+    NullCount (356);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform2dv) (GLint, GLsizei, const GLdouble *)
+{
+    NullCount (357);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform3dv) (GLint, GLsizei, const GLdouble *)
+{
+    NullCount (358);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (Uniform4dv) (GLint, GLsizei, const GLdouble *)
+{
+    NullCount (359);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (UniformMatrix2dv) (GLint, GLsizei, GLboolean, const GLdouble *)
+{
+    NullCount (360);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (UniformMatrix3dv) (GLint, GLsizei, GLboolean, const GLdouble *)
+{
+    NullCount (361);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (UniformMatrix4dv) (GLint, GLsizei, GLboolean, const GLdouble *)
+{
+    NullCount (362);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (UniformMatrix2x3dv) (GLint, GLsizei, GLboolean, const GLdouble *)
+{
+    NullCount (363);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (UniformMatrix2x4dv) (GLint, GLsizei, GLboolean, const GLdouble *)
+{
+    NullCount (364);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (UniformMatrix3x2dv) (GLint, GLsizei, GLboolean, const GLdouble *)
+{
+    NullCount (365);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (UniformMatrix3x4dv) (GLint, GLsizei, GLboolean, const GLdouble *)
+{
+    NullCount (366);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (UniformMatrix4x2dv) (GLint, GLsizei, GLboolean, const GLdouble *)
+{
+    NullCount (367);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (UniformMatrix4x3dv) (GLint, GLsizei, GLboolean, const GLdouble *)
+{
+    NullCount (368);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetUniformdv) (GLuint, GLint, GLdouble *params)
+{
+    NullCount (369);
+    NullQuery (0, params);
+}
+
+OGLP_NULL_CORE GLint APIENTRY OGLP_NULL_CORE_NAME (GetSubroutineUniformLocation) (GLuint, GLenum, const GLchar *)
+{
+    NullCount (370);
+    return 0;
+}
+
+OGLP_NULL_CORE GLuint APIENTRY OGLP_NULL_CORE_NAME (GetSubroutineIndex) (GLuint, GLenum, const GLchar *)
+{
+    NullCount (371);
+    return 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetActiveSubroutineUniformiv) (GLuint, GLenum, GLuint, GLenum pname, GLint *values)
+{
+    NullCount (372);
+    NullQuery (pname, values);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetActiveSubroutineUniformName) (GLuint, GLenum, GLuint, GLsizei, GLsizei *length, GLchar *)
+{
+    NullCount (373);
+    if (length) *length = 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetActiveSubroutineName) (GLuint, GLenum, GLuint, GLsizei, GLsizei *length, GLchar *)
+{
+    NullCount (374);
+    if (length) *length = 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (UniformSubroutinesuiv) (GLenum, GLsizei, const GLuint *)
+{
+    NullCount (375);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetUniformSubroutineuiv) (GLenum, GLint, GLuint *params)
+{
+    NullCount (376);
+    NullQuery (0, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetProgramStageiv) (GLuint, GLenum, GLenum pname, GLint *values)
+{
+    NullCount (377);
+    NullQuery (pname, values);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (PatchParameteri) (GLenum, GLint)
+{
+    NullCount (378);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (PatchParameterfv) (GLenum, const GLfloat *)
+{
+    NullCount (379);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BindTransformFeedback) (GLenum, GLuint)
+{
+    NullCount (380);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DeleteTransformFeedbacks) (GLsizei, const GLuint *)
+{
+    NullCount (381);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GenTransformFeedbacks) (GLsizei n, GLuint *ids)
+{
+    NullCount (382);
+    NullNames (n, ids);
+}
+
+OGLP_NULL_CORE GLboolean APIENTRY OGLP_NULL_CORE_NAME (IsTransformFeedback) (GLuint)
+{
+    NullCount (383);
+    return 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (PauseTransformFeedback) (void)
+{
+    NullCount (384);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ResumeTransformFeedback) (void)
+{
+    NullCount (385);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DrawTransformFeedback) (GLenum, GLuint)
+{
+    NullCount (386);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DrawTransformFeedbackStream) (GLenum, GLuint, GLuint)
+{
+    NullCount (387);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BeginQueryIndexed) (GLenum, GLuint, GLuint)
+{
+    NullCount (388);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (EndQueryIndexed) (GLenum, GLuint)
+{
+    NullCount (389);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetQueryIndexediv) (GLenum, GLuint, GLenum pname, GLint *params)
+{
+    NullCount (390);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ReleaseShaderCompiler) (void)
+{
+    NullCount (391);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ShaderBinary) (GLsizei, const GLuint *, GLenum, const void *, GLsizei)
+{
+    NullCount (392);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetShaderPrecisionFormat) (GLenum, GLenum, GLint *range, GLint *precision)
+{
+    NullCount (393);
+    NullQuery (0, range);
+    NullQuery (0, precision);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DepthRangef) (GLfloat, GLfloat)
+{
+    NullCount (394);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ClearDepthf) (GLfloat)
+{
+    NullCount (395);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetProgramBinary) (GLuint, GLsizei, GLsizei *length, GLenum *binaryFormat, void *)
+{
+    NullCount (396);
+    if (length) *length = 0;
+    NullQuery (0, binaryFormat);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramBinary) (GLuint, GLenum, const void *, GLsizei)
+{
+    NullCount (397);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramParameteri) (GLuint, GLenum, GLint)
+{
+    NullCount (398);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (UseProgramStages) (GLuint, GLbitfield, GLuint)
+{
+    NullCount (399);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ActiveShaderProgram) (GLuint, GLuint)
+{
+    NullCount (400);
+}
+
+OGLP_NULL_CORE GLuint APIENTRY OGLP_NULL_CORE_NAME (CreateShaderProgramv) (GLenum, GLsizei, const GLchar *const*)
+{
+    NullCount (401);
+    return NullName ();
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BindProgramPipeline) (GLuint)
+{
+    NullCount (402);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DeleteProgramPipelines) (GLsizei, const GLuint *)
+{
+    NullCount (403);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GenProgramPipelines) (GLsizei n, GLuint *pipelines)
+{
+    NullCount (404);
+    NullNames (n, pipelines);
+}
+
+OGLP_NULL_CORE GLboolean APIENTRY OGLP_NULL_CORE_NAME (IsProgramPipeline) (GLuint)
+{
+    NullCount (405);
+    return 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetProgramPipelineiv) (GLuint, GLenum pname, GLint *params)
+{
+    NullCount (406);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform1i) (GLuint, GLint, GLint)
+{
+    NullCount (407);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform1iv) (GLuint, GLint, GLsizei, const GLint *)
+{
+    NullCount (408);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform1f) (GLuint, GLint, GLfloat)
+{
+    NullCount (409);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform1fv) (GLuint, GLint, GLsizei, const GLfloat *)
+{
+    NullCount (410);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform1d) (GLuint, GLint, GLdouble)
+{
+    NullCount (411);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform1dv) (GLuint, GLint, GLsizei, const GLdouble *)
+{
+    NullCount (412);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform1ui) (GLuint, GLint, GLuint)
+{
+    NullCount (413);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform1uiv) (GLuint, GLint, GLsizei, const GLuint *)
+{
+    NullCount (414);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform2i) (GLuint, GLint, GLint, GLint)
+{
+    NullCount (415);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform2iv) (GLuint, GLint, GLsizei, const GLint *)
+{
+    NullCount (416);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform2f) (GLuint, GLint, GLfloat, GLfloat)
+{
+    NullCount (417);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform2fv) (GLuint, GLint, GLsizei, const GLfloat *)
+{
+    NullCount (418);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform2d) (GLuint, GLint, GLdouble, GLdouble)
+{
+    NullCount (419);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform2dv) (GLuint, GLint, GLsizei, const GLdouble *)
+{
+    NullCount (420);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform2ui) (GLuint, GLint, GLuint, GLuint)
+{
+    NullCount (421);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform2uiv) (GLuint, GLint, GLsizei, const GLuint *)
+{
+    NullCount (422);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform3i) (GLuint, GLint, GLint, GLint, GLint)
+{
+    NullCount (423);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform3iv) (GLuint, GLint, GLsizei, const GLint *)
+{
+    NullCount (424);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform3f) (GLuint, GLint, GLfloat, GLfloat, GLfloat)
+{
+    NullCount (425);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform3fv) (GLuint, GLint, GLsizei, const GLfloat *)
+{
+    NullCount (426);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform3d) (GLuint, GLint, GLdouble, GLdouble, GLdouble)
+{
+    NullCount (427);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform3dv) (GLuint, GLint, GLsizei, const GLdouble *)
+{
+    NullCount (428);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform3ui) (GLuint, GLint, GLuint, GLuint, GLuint)
+{
+    NullCount (429);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform3uiv) (GLuint, GLint, GLsizei, const GLuint *)
+{
+    NullCount (430);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform4i) (GLuint, GLint, GLint, GLint, GLint, GLint)
+{
+    NullCount (431);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform4iv) (GLuint, GLint, GLsizei, const GLint *)
+{
+    NullCount (432);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform4f) (GLuint, GLint, GLfloat, GLfloat, GLfloat, GLfloat)
+{
+    NullCount (433);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform4fv) (GLuint, GLint, GLsizei, const GLfloat *)
+{
+    NullCount (434);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform4d) (GLuint, GLint, GLdouble, GLdouble, GLdouble, GLdouble)
+{
+    NullCount (435);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform4dv) (GLuint, GLint, GLsizei, const GLdouble *)
+{
+    NullCount (436);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform4ui) (GLuint, GLint, GLuint, GLuint, GLuint, GLuint)
+{
+    NullCount (437);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniform4uiv) (GLuint, GLint, GLsizei, const GLuint *)
+{
+    NullCount (438);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniformMatrix2fv) (GLuint, GLint, GLsizei, GLboolean, const GLfloat *)
+{
+    NullCount (439);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniformMatrix3fv) (GLuint, GLint, GLsizei, GLboolean, const GLfloat *)
+{
+    NullCount (440);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniformMatrix4fv) (GLuint, GLint, GLsizei, GLboolean, const GLfloat *)
+{
+    NullCount (441);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniformMatrix2dv) (GLuint, GLint, GLsizei, GLboolean, const GLdouble *)
+{
+    NullCount (442);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniformMatrix3dv) (GLuint, GLint, GLsizei, GLboolean, const GLdouble *)
+{
+    NullCount (443);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniformMatrix4dv) (GLuint, GLint, GLsizei, GLboolean, const GLdouble *)
+{
+    NullCount (444);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniformMatrix2x3fv) (GLuint, GLint, GLsizei, GLboolean, const GLfloat *)
+{
+    NullCount (445);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniformMatrix3x2fv) (GLuint, GLint, GLsizei, GLboolean, const GLfloat *)
+{
+    NullCount (446);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniformMatrix2x4fv) (GLuint, GLint, GLsizei, GLboolean, const GLfloat *)
+{
+    NullCount (447);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniformMatrix4x2fv) (GLuint, GLint, GLsizei, GLboolean, const GLfloat *)
+{
+    NullCount (448);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniformMatrix3x4fv) (GLuint, GLint, GLsizei, GLboolean, const GLfloat *)
+{
+    NullCount (449);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniformMatrix4x3fv) (GLuint, GLint, GLsizei, GLboolean, const GLfloat *)
+{
+    NullCount (450);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniformMatrix2x3dv) (GLuint, GLint, GLsizei, GLboolean, const GLdouble *)
+{
+    NullCount (451);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniformMatrix3x2dv) (GLuint, GLint, GLsizei, GLboolean, const GLdouble *)
+{
+    NullCount (452);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniformMatrix2x4dv) (GLuint, GLint, GLsizei, GLboolean, const GLdouble *)
+{
+    NullCount (453);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniformMatrix4x2dv) (GLuint, GLint, GLsizei, GLboolean, const GLdouble *)
+{
+    NullCount (454);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniformMatrix3x4dv) (GLuint, GLint, GLsizei, GLboolean, const GLdouble *)
+{
+    NullCount (455);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ProgramUniformMatrix4x3dv) (GLuint, GLint, GLsizei, GLboolean, const GLdouble *)
+{
+    NullCount (456);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ValidateProgramPipeline) (GLuint)
+{
+    NullCount (457);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetProgramPipelineInfoLog) (GLuint, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    NullCount (458);
+    if (length) *length = 0;
+    if (infoLog && bufSize > 0) infoLog[0] = 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribL1d) (GLuint, GLdouble)
+{
+    NullCount (459);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribL2d) (GLuint, GLdouble, GLdouble)
+{
+    NullCount (460);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribL3d) (GLuint, GLdouble, GLdouble, GLdouble)
+{
+    NullCount (461);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribL4d) (GLuint, GLdouble, GLdouble, GLdouble, GLdouble)
+{
+    NullCount (462);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribL1dv) (GLuint, const GLdouble *)
+{
+    NullCount (463);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribL2dv) (GLuint, const GLdouble *)
+{
+    NullCount (464);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribL3dv) (GLuint, const GLdouble *)
+{
+    NullCount (465);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribL4dv) (GLuint, const GLdouble *)
+{
+    NullCount (466);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribLPointer) (GLuint, GLint, GLenum, GLsizei, const void *)
+{
+    NullCount (467);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetVertexAttribLdv) (GLuint, GLenum pname, GLdouble *params)
+{
+    NullCount (468);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ViewportArrayv) (GLuint, GLsizei, const GLfloat *)
+{
+    NullCount (469);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ViewportIndexedf) (GLuint, GLfloat, GLfloat, GLfloat, GLfloat)
+{
+    NullCount (470);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ViewportIndexedfv) (GLuint, const GLfloat *)
+{
+    NullCount (471);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ScissorArrayv) (GLuint, GLsizei, const GLint *)
+{
+    NullCount (472);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ScissorIndexed) (GLuint, GLint, GLint, GLsizei, GLsizei)
+{
+    NullCount (473);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ScissorIndexedv) (GLuint, const GLint *)
+{
+    NullCount (474);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DepthRangeArrayv) (GLuint, GLsizei, const GLdouble *)
+{
+    NullCount (475);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DepthRangeIndexed) (GLuint, GLdouble, GLdouble)
+{
+    NullCount (476);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetFloati_v) (GLenum target, GLuint, GLfloat *data)
+{
+    NullCount (477);
+    NullQuery (target, data);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetDoublei_v) (GLenum target, GLuint, GLdouble *data)
+{
+    NullCount (478);
+    NullQuery (target, data);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DrawArraysInstancedBaseInstance) (GLenum, GLint, GLsizei, GLsizei, GLuint)
+{
+    NullCount (479);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DrawElementsInstancedBaseInstance) (GLenum, GLsizei, GLenum, const void *, GLsizei, GLuint)
+{
+    NullCount (480);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DrawElementsInstancedBaseVertexBaseInstance) (GLenum, GLsizei, GLenum, const void *, GLsizei, GLint, GLuint)
+{
+    NullCount (481);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetInternalformativ) (GLenum, GLenum, GLenum pname, GLsizei, GLint *params)
+{
+    NullCount (482);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetActiveAtomicCounterBufferiv) (GLuint, GLuint, GLenum pname, GLint *params)
+{
+    NullCount (483);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BindImageTexture) (GLuint, GLuint, GLint, GLboolean, GLint, GLenum, GLenum)
+{
+    NullCount (484);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (MemoryBarrier) (GLbitfield)
+{
+    NullCount (485);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TexStorage1D) (GLenum, GLsizei, GLenum, GLsizei)
+{
+    NullCount (486);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TexStorage2D) (GLenum, GLsizei, GLenum, GLsizei, GLsizei)
+{
+    NullCount (487);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TexStorage3D) (GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLsizei)
+{
+    NullCount (488);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DrawTransformFeedbackInstanced) (GLenum, GLuint, GLsizei)
+{
+    NullCount (489);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DrawTransformFeedbackStreamInstanced) (GLenum, GLuint, GLuint, GLsizei)
+{
+    NullCount (490);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ClearBufferData) (GLenum, GLenum, GLenum, GLenum, const void *)
+{
+    NullCount (491);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ClearBufferSubData) (GLenum, GLenum, GLintptr, GLsizeiptr, GLenum, GLenum, const void *)
+{
+    NullCount (492);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DispatchCompute) (GLuint, GLuint, GLuint)
+{
+    NullCount (493);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DispatchComputeIndirect) (GLintptr)
+{
+    NullCount (494);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CopyImageSubData) (GLuint, GLenum, GLint, GLint, GLint, GLint, GLuint, GLenum, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei)
+{
+    NullCount (495);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (FramebufferParameteri) (GLenum, GLenum, GLint)
+{
+    NullCount (496);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetFramebufferParameteriv) (GLenum, GLenum pname, GLint *params)
+{
+    NullCount (497);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetInternalformati64v) (GLenum, GLenum, GLenum pname, GLsizei, GLint64 *params)
+{
+    NullCount (498);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (InvalidateTexSubImage) (GLuint, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei)
+{
+    NullCount (499);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (InvalidateTexImage) (GLuint, GLint)
+{
+    NullCount (500);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (InvalidateBufferSubData) (GLuint, GLintptr, GLsizeiptr)
+{
+    NullCount (501);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (InvalidateBufferData) (GLuint)
+{
+    NullCount (502);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (InvalidateFramebuffer) (GLenum, GLsizei, const GLenum *)
+{
+    NullCount (503);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (InvalidateSubFramebuffer) (GLenum, GLsizei, const GLenum *, GLint, GLint, GLsizei, GLsizei)
+{
+    NullCount (504);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (MultiDrawArraysIndirect) (GLenum, const void *, GLsizei, GLsizei)
+{
+    NullCount (505);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (MultiDrawElementsIndirect) (GLenum, GLenum, const void *, GLsizei, GLsizei)
+{
+    NullCount (506);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetProgramInterfaceiv) (GLuint, GLenum, GLenum pname, GLint *params)
+{
+    NullCount (507);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE GLuint APIENTRY OGLP_NULL_CORE_NAME (GetProgramResourceIndex) (GLuint, GLenum, const GLchar *)
+{
+    NullCount (508);
+    return 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetProgramResourceName) (GLuint, GLenum, GLuint, GLsizei bufSize, GLsizei *length, GLchar *name)
+{
+    NullCount (509);
+    if (length) *length = 0;
+    if (name && bufSize > 0) name[0] = 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetProgramResourceiv) (GLuint, GLenum, GLuint, GLsizei, const GLenum *, GLsizei, GLsizei *length, GLint *params)
+{
+    NullCount (510);
+    if (length) *length = 0;
+    NullQuery (0, params);
+}
+
+OGLP_NULL_CORE GLint APIENTRY OGLP_NULL_CORE_NAME (GetProgramResourceLocation) (GLuint, GLenum, const GLchar *)
+{
+    NullCount (511);
+    return 0;
+}
+
+OGLP_NULL_CORE GLint APIENTRY OGLP_NULL_CORE_NAME (GetProgramResourceLocationIndex) (GLuint, GLenum, const GLchar *)
+{
+    NullCount (512);
+    return 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ShaderStorageBlockBinding) (GLuint, GLuint, GLuint)
+{
+    NullCount (513);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TexBufferRange) (GLenum, GLenum, GLuint, GLintptr, GLsizeiptr)
+{
+    NullCount (514);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TexStorage2DMultisample) (GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLboolean)
+{
+    NullCount (515);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TexStorage3DMultisample) (GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLsizei, GLboolean)
+{
+    NullCount (516);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TextureView) (GLuint, GLenum, GLuint, GLenum, GLuint, GLuint, GLuint, GLuint)
+{
+    NullCount (517);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BindVertexBuffer) (GLuint, GLuint, GLintptr, GLsizei)
+{
+    NullCount (518);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribFormat) (GLuint, GLint, GLenum, GLboolean, GLuint)
+{
+    NullCount (519);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribIFormat) (GLuint, GLint, GLenum, GLuint)
+{
+    NullCount (520);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribLFormat) (GLuint, GLint, GLenum, GLuint)
+{
+    NullCount (521);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexAttribBinding) (GLuint, GLuint)
+{
+    NullCount (522);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexBindingDivisor) (GLuint, GLuint)
+{
+    NullCount (523);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DebugMessageControl) (GLenum, GLenum, GLenum, GLsizei, const GLuint *, GLboolean)
+{
+    NullCount (524);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DebugMessageInsert) (GLenum, GLenum, GLuint, GLenum, GLsizei, const GLchar *)
+{
+    NullCount (525);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DebugMessageCallback) (GLDEBUGPROC, const void *)
+{
+    NullCount (526);
+}
+
+OGLP_NULL_CORE GLuint APIENTRY OGLP_NULL_CORE_NAME (GetDebugMessageLog) (GLuint, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog)
+{
+    NullCount (527);
+    NullQuery (0, sources);
+    NullQuery (0, types);
+    NullQuery (0, ids);
+    NullQuery (0, severities);
+    NullQuery (0, lengths);
+    if (messageLog && bufSize > 0) messageLog[0] = 0;
+    return 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (PushDebugGroup) (GLenum, GLuint, GLsizei, const GLchar *)
+{
+    NullCount (528);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (PopDebugGroup) (void)
+{
+    NullCount (529);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ObjectLabel) (GLenum, GLuint, GLsizei, const GLchar *)
+{
+    NullCount (530);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetObjectLabel) (GLenum, GLuint, GLsizei bufSize, GLsizei *length, GLchar *label)
+{
+    NullCount (531);
+    if (length) *length = 0;
+    if (label && bufSize > 0) label[0] = 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ObjectPtrLabel) (const void *, GLsizei, const GLchar *)
+{
+    NullCount (532);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetObjectPtrLabel) (const void *, GLsizei bufSize, GLsizei *length, GLchar *label)
+{
+    NullCount (533);
+    if (length) *length = 0;
+    if (label && bufSize > 0) label[0] = 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BufferStorage) (GLenum, GLsizeiptr, const void *, GLbitfield)
+{
+    NullCount (534);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ClearTexImage) (GLuint, GLint, GLenum, GLenum, const void *)
+{
+    NullCount (535);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ClearTexSubImage) (GLuint, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLenum, const void *)
+{
+    NullCount (536);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BindBuffersBase) (GLenum, GLuint, GLsizei, const GLuint *)
+{
+    NullCount (537);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BindBuffersRange) (GLenum, GLuint, GLsizei, const GLuint *, const GLintptr *, const GLsizeiptr *)
+{
+    NullCount (538);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BindTextures) (GLuint, GLsizei, const GLuint *)
+{
+    NullCount (539);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BindSamplers) (GLuint, GLsizei, const GLuint *)
+{
+    NullCount (540);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BindImageTextures) (GLuint, GLsizei, const GLuint *)
+{
+    NullCount (541);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BindVertexBuffers) (GLuint, GLsizei, const GLuint *, const GLintptr *, const GLsizei *)
+{
+    NullCount (542);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ClipControl) (GLenum, GLenum)
+{
+    NullCount (543);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CreateTransformFeedbacks) (GLsizei n, GLuint *ids)
+{
+    NullCount (544);
+    NullNames (n, ids);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TransformFeedbackBufferBase) (GLuint, GLuint, GLuint)
+{
+    NullCount (545);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TransformFeedbackBufferRange) (GLuint, GLuint, GLuint, GLintptr, GLsizeiptr)
+{
+    NullCount (546);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetTransformFeedbackiv) (GLuint, GLenum pname, GLint *param)
+{
+    NullCount (547);
+    NullQuery (pname, param);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetTransformFeedbacki_v) (GLuint, GLenum pname, GLuint, GLint *param)
+{
+    NullCount (548);
+    NullQuery (pname, param);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetTransformFeedbacki64_v) (GLuint, GLenum pname, GLuint, GLint64 *param)
+{
+    NullCount (549);
+    NullQuery (pname, param);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CreateBuffers) (GLsizei n, GLuint *buffers)
+{
+    NullCount (550);
+    NullNames (n, buffers);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (NamedBufferStorage) (GLuint, GLsizeiptr, const void *, GLbitfield)
+{
+    NullCount (551);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (NamedBufferData) (GLuint, GLsizeiptr, const void *, GLenum)
+{
+    NullCount (552);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (NamedBufferSubData) (GLuint, GLintptr, GLsizeiptr, const void *)
+{
+    NullCount (553);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CopyNamedBufferSubData) (GLuint, GLuint, GLintptr, GLintptr, GLsizeiptr)
+{
+    NullCount (554);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ClearNamedBufferData) (GLuint, GLenum, GLenum, GLenum, const void *)
+{
+    NullCount (555);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ClearNamedBufferSubData) (GLuint, GLenum, GLintptr, GLsizeiptr, GLenum, GLenum, const void *)
+{
+    NullCount (556);
+}
+
+OGLP_NULL_CORE void * APIENTRY OGLP_NULL_CORE_NAME (MapNamedBuffer) (GLuint buffer, GLenum)
+{
+    NullCount (557);
+    return NullMapBuffer (buffer, 0, 0);
+}
+
+OGLP_NULL_CORE void * APIENTRY OGLP_NULL_CORE_NAME (MapNamedBufferRange) (GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield)
+{
+    NullCount (558);
+    return NullMapBuffer (buffer, offset, length);
+}
+
+OGLP_NULL_CORE GLboolean APIENTRY OGLP_NULL_CORE_NAME (UnmapNamedBuffer) (GLuint)
+{
+    NullCount (559);
+    return GL_TRUE;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (FlushMappedNamedBufferRange) (GLuint, GLintptr, GLsizeiptr)
+{
+    NullCount (560);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetNamedBufferParameteriv) (GLuint, GLenum pname, GLint *params)
+{
+    NullCount (561);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetNamedBufferParameteri64v) (GLuint, GLenum pname, GLint64 *params)
+{
+    NullCount (562);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetNamedBufferPointerv) (GLuint, GLenum, void **)
+{
+    NullCount (563);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetNamedBufferSubData) (GLuint, GLintptr, GLsizeiptr, void *)
+{
+    NullCount (564);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CreateFramebuffers) (GLsizei n, GLuint *framebuffers)
+{
+    NullCount (565);
+    NullNames (n, framebuffers);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (NamedFramebufferRenderbuffer) (GLuint, GLenum, GLenum, GLuint)
+{
+    NullCount (566);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (NamedFramebufferParameteri) (GLuint, GLenum, GLint)
+{
+    NullCount (567);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (NamedFramebufferTexture) (GLuint, GLenum, GLuint, GLint)
+{
+    NullCount (568);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (NamedFramebufferTextureLayer) (GLuint, GLenum, GLuint, GLint, GLint)
+{
+    NullCount (569);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (NamedFramebufferDrawBuffer) (GLuint, GLenum)
+{
+    NullCount (570);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (NamedFramebufferDrawBuffers) (GLuint, GLsizei, const GLenum *)
+{
+    NullCount (571);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (NamedFramebufferReadBuffer) (GLuint, GLenum)
+{
+    NullCount (572);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (InvalidateNamedFramebufferData) (GLuint, GLsizei, const GLenum *)
+{
+    NullCount (573);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (InvalidateNamedFramebufferSubData) (GLuint, GLsizei, const GLenum *, GLint, GLint, GLsizei, GLsizei)
+{
+    NullCount (574);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ClearNamedFramebufferiv) (GLuint, GLenum, GLint, const GLint *)
+{
+    NullCount (575);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ClearNamedFramebufferuiv) (GLuint, GLenum, GLint, const GLuint *)
+{
+    NullCount (576);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ClearNamedFramebufferfv) (GLuint, GLenum, GLint, const GLfloat *)
+{
+    NullCount (577);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ClearNamedFramebufferfi) (GLuint, GLenum, const GLfloat, GLint)
+{
+    NullCount (578);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BlitNamedFramebuffer) (GLuint, GLuint, GLint, GLint, GLint, GLint, GLint, GLint, GLint, GLint, GLbitfield, GLenum)
+{
+    NullCount (579);
+}
+
+OGLP_NULL_CORE GLenum APIENTRY OGLP_NULL_CORE_NAME (CheckNamedFramebufferStatus) (GLuint, GLenum)
+{
+    NullCount (580);
+    return GL_FRAMEBUFFER_COMPLETE;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetNamedFramebufferParameteriv) (GLuint, GLenum pname, GLint *param)
+{
+    NullCount (581);
+    NullQuery (pname, param);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetNamedFramebufferAttachmentParameteriv) (GLuint, GLenum, GLenum pname, GLint *params)
+{
+    NullCount (582);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CreateRenderbuffers) (GLsizei n, GLuint *renderbuffers)
+{
+    NullCount (583);
+    NullNames (n, renderbuffers);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (NamedRenderbufferStorage) (GLuint, GLenum, GLsizei, GLsizei)
+{
+    NullCount (584);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (NamedRenderbufferStorageMultisample) (GLuint, GLsizei, GLenum, GLsizei, GLsizei)
+{
+    NullCount (585);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetNamedRenderbufferParameteriv) (GLuint, GLenum pname, GLint *params)
+{
+    NullCount (586);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CreateTextures) (GLenum, GLsizei n, GLuint *textures)
+{
+    NullCount (587);
+    NullNames (n, textures);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TextureBuffer) (GLuint, GLenum, GLuint)
+{
+    NullCount (588);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TextureBufferRange) (GLuint, GLenum, GLuint, GLintptr, GLsizeiptr)
+{
+    NullCount (589);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TextureStorage1D) (GLuint, GLsizei, GLenum, GLsizei)
+{
+    NullCount (590);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TextureStorage2D) (GLuint, GLsizei, GLenum, GLsizei, GLsizei)
+{
+    NullCount (591);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TextureStorage3D) (GLuint, GLsizei, GLenum, GLsizei, GLsizei, GLsizei)
+{
+    NullCount (592);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TextureStorage2DMultisample) (GLuint, GLsizei, GLenum, GLsizei, GLsizei, GLboolean)
+{
+    NullCount (593);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TextureStorage3DMultisample) (GLuint, GLsizei, GLenum, GLsizei, GLsizei, GLsizei, GLboolean)
+{
+    NullCount (594);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TextureSubImage1D) (GLuint, GLint, GLint, GLsizei, GLenum, GLenum, const void *)
+{
+    NullCount (595);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TextureSubImage2D) (GLuint, GLint, GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, const void *)
+{
+    NullCount (596);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TextureSubImage3D) (GLuint, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLenum, const void *)
+{
+    NullCount (597);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CompressedTextureSubImage1D) (GLuint, GLint, GLint, GLsizei, GLenum, GLsizei, const void *)
+{
+    NullCount (598);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CompressedTextureSubImage2D) (GLuint, GLint, GLint, GLint, GLsizei, GLsizei, GLenum, GLsizei, const void *)
+{
+    NullCount (599);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CompressedTextureSubImage3D) (GLuint, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLsizei, const void *)
+{
+    NullCount (600);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CopyTextureSubImage1D) (GLuint, GLint, GLint, GLint, GLint, GLsizei)
+{
+    NullCount (601);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CopyTextureSubImage2D) (GLuint, GLint, GLint, GLint, GLint, GLint, GLsizei, GLsizei)
+{
+    NullCount (602);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CopyTextureSubImage3D) (GLuint, GLint, GLint, GLint, GLint, GLint, GLint, GLsizei, GLsizei)
+{
+    NullCount (603);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TextureParameterf) (GLuint, GLenum, GLfloat)
+{
+    NullCount (604);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TextureParameterfv) (GLuint, GLenum, const GLfloat *)
+{
+    NullCount (605);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TextureParameteri) (GLuint, GLenum, GLint)
+{
+    NullCount (606);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TextureParameterIiv) (GLuint, GLenum, const GLint *)
+{
+    NullCount (607);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TextureParameterIuiv) (GLuint, GLenum, const GLuint *)
+{
+    NullCount (608);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TextureParameteriv) (GLuint, GLenum, const GLint *)
+{
+    NullCount (609);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GenerateTextureMipmap) (GLuint)
+{
+    NullCount (610);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (BindTextureUnit) (GLuint, GLuint)
+{
+    NullCount (611);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetTextureImage) (GLuint, GLint, GLenum, GLenum, GLsizei, void *)
+{
+    NullCount (612);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetCompressedTextureImage) (GLuint, GLint, GLsizei, void *)
+{
+    NullCount (613);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetTextureLevelParameterfv) (GLuint, GLint, GLenum pname, GLfloat *params)
+{
+    NullCount (614);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetTextureLevelParameteriv) (GLuint, GLint, GLenum pname, GLint *params)
+{
+    NullCount (615);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetTextureParameterfv) (GLuint, GLenum pname, GLfloat *params)
+{
+    NullCount (616);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetTextureParameterIiv) (GLuint, GLenum pname, GLint *params)
+{
+    NullCount (617);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetTextureParameterIuiv) (GLuint, GLenum pname, GLuint *params)
+{
+    NullCount (618);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetTextureParameteriv) (GLuint, GLenum pname, GLint *params)
+{
+    NullCount (619);
+    NullQuery (pname, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CreateVertexArrays) (GLsizei n, GLuint *arrays)
+{
+    NullCount (620);
+    NullNames (n, arrays);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (DisableVertexArrayAttrib) (GLuint, GLuint)
+{
+    NullCount (621);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (EnableVertexArrayAttrib) (GLuint, GLuint)
+{
+    NullCount (622);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexArrayElementBuffer) (GLuint, GLuint)
+{
+    NullCount (623);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexArrayVertexBuffer) (GLuint, GLuint, GLuint, GLintptr, GLsizei)
+{
+    NullCount (624);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexArrayVertexBuffers) (GLuint, GLuint, GLsizei, const GLuint *, const GLintptr *, const GLsizei *)
+{
+    NullCount (625);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexArrayAttribBinding) (GLuint, GLuint, GLuint)
+{
+    NullCount (626);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexArrayAttribFormat) (GLuint, GLuint, GLint, GLenum, GLboolean, GLuint)
+{
+    NullCount (627);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexArrayAttribIFormat) (GLuint, GLuint, GLint, GLenum, GLuint)
+{
+    NullCount (628);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexArrayAttribLFormat) (GLuint, GLuint, GLint, GLenum, GLuint)
+{
+    NullCount (629);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (VertexArrayBindingDivisor) (GLuint, GLuint, GLuint)
+{
+    NullCount (630);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetVertexArrayiv) (GLuint, GLenum pname, GLint *param)
+{
+    NullCount (631);
+    NullQuery (pname, param);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetVertexArrayIndexediv) (GLuint, GLuint, GLenum pname, GLint *param)
+{
+    NullCount (632);
+    NullQuery (pname, param);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetVertexArrayIndexed64iv) (GLuint, GLuint, GLenum pname, GLint64 *param)
+{
+    NullCount (633);
+    NullQuery (pname, param);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CreateSamplers) (GLsizei n, GLuint *samplers)
+{
+    NullCount (634);
+    NullNames (n, samplers);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CreateProgramPipelines) (GLsizei n, GLuint *pipelines)
+{
+    NullCount (635);
+    NullNames (n, pipelines);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (CreateQueries) (GLenum, GLsizei n, GLuint *ids)
+{
+    NullCount (636);
+    NullNames (n, ids);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetQueryBufferObjecti64v) (GLuint, GLuint, GLenum, GLintptr)
+{
+    NullCount (637);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetQueryBufferObjectiv) (GLuint, GLuint, GLenum, GLintptr)
+{
+    NullCount (638);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetQueryBufferObjectui64v) (GLuint, GLuint, GLenum, GLintptr)
+{
+    NullCount (639);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetQueryBufferObjectuiv) (GLuint, GLuint, GLenum, GLintptr)
+{
+    NullCount (640);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (MemoryBarrierByRegion) (GLbitfield)
+{
+    NullCount (641);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetTextureSubImage) (GLuint, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLenum, GLsizei, void *)
+{
+    NullCount (642);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetCompressedTextureSubImage) (GLuint, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLsizei, void *)
+{
+    NullCount (643);
+}
+
+OGLP_NULL_CORE GLenum APIENTRY OGLP_NULL_CORE_NAME (GetGraphicsResetStatus) (void)
+{
+    NullCount (644);
+    return 0;
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetnCompressedTexImage) (GLenum, GLint, GLsizei, void *)
+{
+    NullCount (645);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetnTexImage) (GLenum, GLint, GLenum, GLenum, GLsizei, void *)
+{
+    NullCount (646);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetnUniformdv) (GLuint, GLint, GLsizei, GLdouble *params)
+{
+    NullCount (647);
+    NullQuery (0, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetnUniformfv) (GLuint, GLint, GLsizei, GLfloat *params)
+{
+    NullCount (648);
+    NullQuery (0, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetnUniformiv) (GLuint, GLint, GLsizei, GLint *params)
+{
+    NullCount (649);
+    NullQuery (0, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (GetnUniformuiv) (GLuint, GLint, GLsizei, GLuint *params)
+{
+    NullCount (650);
+    NullQuery (0, params);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (ReadnPixels) (GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, GLsizei, void *)
+{
+    NullCount (651);
+}
+
+OGLP_NULL_CORE void APIENTRY OGLP_NULL_CORE_NAME (TextureBarrier) (void)
+{
+    NullCount (652);
+}
+
+static GLuint64 APIENTRY Null_GetTextureHandleARB (GLuint)
+{
+    NullCount (653);
+    return 0;
+}
+
+static GLuint64 APIENTRY Null_GetTextureSamplerHandleARB (GLuint, GLuint)
+{
+    NullCount (654);
+    return 0;
+}
+
+static void APIENTRY Null_MakeTextureHandleResidentARB (GLuint64)
+{
+    NullCount (655);
+}
+
+static void APIENTRY Null_MakeTextureHandleNonResidentARB (GLuint64)
+{
+    NullCount (656);
+}
+
+static GLuint64 APIENTRY Null_GetImageHandleARB (GLuint, GLint, GLboolean, GLint, GLenum)
+{
+    NullCount (657);
+    return 0;
+}
+
+static void APIENTRY Null_MakeImageHandleResidentARB (GLuint64, GLenum)
+{
+    NullCount (658);
+}
+
+static void APIENTRY Null_MakeImageHandleNonResidentARB (GLuint64)
+{
+    NullCount (659);
+}
+
+static void APIENTRY Null_UniformHandleui64ARB (GLint, GLuint64)
+{
+    NullCount (660);
+}
+
+static void APIENTRY Null_UniformHandleui64vARB (GLint, GLsizei, const GLuint64 *)
+{
+    NullCount (661);
+}
+
+static void APIENTRY Null_ProgramUniformHandleui64ARB (GLuint, GLint, GLuint64)
+{
+    NullCount (662);
+}
+
+static void APIENTRY Null_ProgramUniformHandleui64vARB (GLuint, GLint, GLsizei, const GLuint64 *)
+{
+    NullCount (663);
+}
+
+static GLboolean APIENTRY Null_IsTextureHandleResidentARB (GLuint64)
+{
+    NullCount (664);
+    return 0;
+}
+
+static GLboolean APIENTRY Null_IsImageHandleResidentARB (GLuint64)
+{
+    NullCount (665);
+    return 0;
+}
+
+static void APIENTRY Null_VertexAttribL1ui64ARB (GLuint, GLuint64EXT)
+{
+    NullCount (666);
+}
+
+static void APIENTRY Null_VertexAttribL1ui64vARB (GLuint, const GLuint64EXT *)
+{
+    NullCount (667);
+}
+
+static void APIENTRY Null_GetVertexAttribLui64vARB (GLuint, GLenum pname, GLuint64EXT *params)
+{
+    NullCount (668);
+    NullQuery (pname, params);
+}
+
+static GLsync APIENTRY Null_CreateSyncFromCLeventARB (struct _cl_context *, struct _cl_event *, GLbitfield)
+{
+    NullCount (669);
+    return 0;
+}
+
+static void APIENTRY Null_DispatchComputeGroupSizeARB (GLuint, GLuint, GLuint, GLuint, GLuint, GLuint)
+{
+    NullCount (670);
+}
+
+static void APIENTRY Null_DebugMessageControlARB (GLenum, GLenum, GLenum, GLsizei, const GLuint *, GLboolean)
+{
+    NullCount (671);
+}
+
+static void APIENTRY Null_DebugMessageInsertARB (GLenum, GLenum, GLuint, GLenum, GLsizei, const GLchar *)
+{
+    NullCount (672);
+}
+
+static void APIENTRY Null_DebugMessageCallbackARB (GLDEBUGPROCARB, const void *)
+{
+    NullCount (673);
+}
+
+static GLuint APIENTRY Null_GetDebugMessageLogARB (GLuint, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog)
+{
+    NullCount (674);
+    NullQuery (0, sources);
+    NullQuery (0, types);
+    NullQuery (0, ids);
+    NullQuery (0, severities);
+    NullQuery (0, lengths);
+    if (messageLog && bufSize > 0) messageLog[0] = 0;
+    return 0;
+}
+
+static void APIENTRY Null_BlendEquationiARB (GLuint, GLenum)
+{
+    NullCount (675);
+}
+
+static void APIENTRY Null_BlendEquationSeparateiARB (GLuint, GLenum, GLenum)
+{
+    NullCount (676);
+}
+
+static void APIENTRY Null_BlendFunciARB (GLuint, GLenum, GLenum)
+{
+    NullCount (677);
+}
+
+static void APIENTRY Null_BlendFuncSeparateiARB (GLuint, GLenum, GLenum, GLenum, GLenum)
+{
+    NullCount (678);
+}
+
+static void APIENTRY Null_MultiDrawArraysIndirectCountARB (GLenum, GLintptr, GLintptr, GLsizei, GLsizei)
+{
+    NullCount (679);
+}
+
+static void APIENTRY Null_MultiDrawElementsIndirectCountARB (GLenum, GLenum, GLintptr, GLintptr, GLsizei, GLsizei)
+{
+    NullCount (680);
+}
+
+static GLenum APIENTRY Null_GetGraphicsResetStatusARB (void)
+{
+    NullCount (681);
+    return 0;
+}
+
+static void APIENTRY Null_GetnTexImageARB (GLenum, GLint, GLenum, GLenum, GLsizei, void *)
+{
+    NullCount (682);
+}
+
+static void APIENTRY Null_ReadnPixelsARB (GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, GLsizei, void *)
+{
+    NullCount (683);
+}
+
+static void APIENTRY Null_GetnCompressedTexImageARB (GLenum, GLint, GLsizei, void *)
+{
+    NullCount (684);
+}
+
+static void APIENTRY Null_GetnUniformfvARB (GLuint, GLint, GLsizei, GLfloat *params)
+{
+    NullCount (685);
+    NullQuery (0, params);
+}
+
+static void APIENTRY Null_GetnUniformivARB (GLuint, GLint, GLsizei, GLint *params)
+{
+    NullCount (686);
+    NullQuery (0, params);
+}
+
+static void APIENTRY Null_GetnUniformuivARB (GLuint, GLint, GLsizei, GLuint *params)
+{
+    NullCount (687);
+    NullQuery (0, params);
+}
+
+static void APIENTRY Null_GetnUniformdvARB (GLuint, GLint, GLsizei, GLdouble *params)
+{
+    NullCount (688);
+    NullQuery (0, params);
+}
+
+static void APIENTRY Null_MinSampleShadingARB (GLfloat)
+{
+    NullCount (689);
+}
+
+static void APIENTRY Null_NamedStringARB (GLenum, GLint, const GLchar *, GLint, const GLchar *)
+{
+    NullCount (690);
+}
+
+static void APIENTRY Null_DeleteNamedStringARB (GLint, const GLchar *)
+{
+    NullCount (691);
+}
+
+static void APIENTRY Null_CompileShaderIncludeARB (GLuint, GLsizei, const GLchar *const*, const GLint *)
+{
+    NullCount (692);
+}
+
+static GLboolean APIENTRY Null_IsNamedStringARB (GLint, const GLchar *)
+{
+    NullCount (693);
+    return 0;
+}
+
+static void APIENTRY Null_GetNamedStringARB (GLint, const GLchar *, GLsizei bufSize, GLint *stringlen, GLchar *string)
+{
+    NullCount (694);
+    NullQuery (0, stringlen);
+    if (string && bufSize > 0) string[0] = 0;
+}
+
+static void APIENTRY Null_GetNamedStringivARB (GLint, const GLchar *, GLenum pname, GLint *params)
+{
+    NullCount (695);
+    NullQuery (pname, params);
+}
+
+static void APIENTRY Null_BufferPageCommitmentARB (GLenum, GLintptr, GLsizeiptr, GLboolean)
+{
+    NullCount (696);
+}
+
+static void APIENTRY Null_NamedBufferPageCommitmentEXT (GLuint, GLintptr, GLsizeiptr, GLboolean)
+{
+    NullCount (697);
+}
+
+static void APIENTRY Null_NamedBufferPageCommitmentARB (GLuint, GLintptr, GLsizeiptr, GLboolean)
+{
+    NullCount (698);
+}
+
+static void APIENTRY Null_TexPageCommitmentARB (GLenum, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLboolean)
+{
+    NullCount (699);
+}
+
+static void APIENTRY Null_GetMultisamplefvNV (GLenum, GLuint, GLfloat *a2)
+{
+    NullCount (700);
+    NullQuery (0, a2);
+}
+
+static void APIENTRY Null_SampleMaskIndexedNV (GLuint, GLbitfield)
+{
+    NullCount (701);
+}
+
+static void APIENTRY Null_TexRenderbufferNV (GLenum, GLuint)
+{
+    NullCount (702);
+}
+
+static void APIENTRY Null_MakeBufferResidentNV (GLenum, GLenum)
+{
+    NullCount (703);
+}
+
+static void APIENTRY Null_MakeBufferNonResidentNV (GLenum)
+{
+    NullCount (704);
+}
+
+static GLboolean APIENTRY Null_IsBufferResidentNV (GLenum)
+{
+    NullCount (705);
+    return 0;
+}
+
+static void APIENTRY Null_MakeNamedBufferResidentNV (GLuint, GLenum)
+{
+    NullCount (706);
+}
+
+static void APIENTRY Null_MakeNamedBufferNonResidentNV (GLuint)
+{
+    NullCount (707);
+}
+
+static GLboolean APIENTRY Null_IsNamedBufferResidentNV (GLuint)
+{
+    NullCount (708);
+    return 0;
+}
+
+static void APIENTRY Null_GetBufferParameterui64vNV (GLenum, GLenum pname, GLuint64EXT *params)
+{
+    NullCount (709);
+    NullQuery (pname, params);
+}
+
+static void APIENTRY Null_GetNamedBufferParameterui64vNV (GLuint, GLenum pname, GLuint64EXT *params)
+{
+    NullCount (710);
+    NullQuery (pname, params);
+}
+
+static void APIENTRY Null_GetIntegerui64vNV (GLenum, GLuint64EXT *result)
+{
+    NullCount (711);
+    NullQuery (0, result);
+}
+
+static void APIENTRY Null_Uniformui64NV (GLint, GLuint64EXT)
+{
+    NullCount (712);
+}
+
+static void APIENTRY Null_Uniformui64vNV (GLint, GLsizei, const GLuint64EXT *)
+{
+    NullCount (713);
+}
+
+static void APIENTRY Null_ProgramUniformui64NV (GLuint, GLint, GLuint64EXT)
+{
+    NullCount (714);
+}
+
+static void APIENTRY Null_ProgramUniformui64vNV (GLuint, GLint, GLsizei, const GLuint64EXT *)
+{
+    NullCount (715);
+}
+
+static void APIENTRY Null_BufferAddressRangeNV (GLenum, GLuint, GLuint64EXT, GLsizeiptr)
+{
+    NullCount (716);
+}
+
+static void APIENTRY Null_VertexFormatNV (GLint, GLenum, GLsizei)
+{
+    NullCount (717);
+}
+
+static void APIENTRY Null_NormalFormatNV (GLenum, GLsizei)
+{
+    NullCount (718);
+}
+
+static void APIENTRY Null_ColorFormatNV (GLint, GLenum, GLsizei)
+{
+    NullCount (719);
+}
+
+static void APIENTRY Null_IndexFormatNV (GLenum, GLsizei)
+{
+    NullCount (720);
+}
+
+static void APIENTRY Null_TexCoordFormatNV (GLint, GLenum, GLsizei)
+{
+    NullCount (721);
+}
+
+static void APIENTRY Null_EdgeFlagFormatNV (GLsizei)
+{
+    NullCount (722);
+}
+
+static void APIENTRY Null_SecondaryColorFormatNV (GLint, GLenum, GLsizei)
+{
+    NullCount (723);
+}
+
+static void APIENTRY Null_FogCoordFormatNV (GLenum, GLsizei)
+{
+    NullCount (724);
+}
+
+static void APIENTRY Null_VertexAttribFormatNV (GLuint, GLint, GLenum, GLboolean, GLsizei)
+{
+    NullCount (725);
+}
+
+static void APIENTRY Null_VertexAttribIFormatNV (GLuint, GLint, GLenum, GLsizei)
+{
+    NullCount (726);
+}
+
+static void APIENTRY Null_GetIntegerui64i_vNV (GLenum, GLuint, GLuint64EXT *result)
+{
+    NullCount (727);
+    NullQuery (0, result);
+}
+
+static void APIENTRY Null_EnableClientState (GLenum)
+{
+    NullCount (728);
+}
+
+static void APIENTRY Null_DisableClientState (GLenum)
+{
+    NullCount (729);
+}
+
+const unsigned int NumNullProcs = 730;
+
+const NullProc NullProcs[NumNullProcs] = {
+    { "glActiveShaderProgram", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ActiveShaderProgram)), 400 },
+    { "glActiveTexture", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ActiveTexture)), 66 },
+    { "glAttachShader", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (AttachShader)), 108 },
+    { "glBeginConditionalRender", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BeginConditionalRender)), 215 },
+    { "glBeginQuery", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BeginQuery)), 87 },
+    { "glBeginQueryIndexed", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BeginQueryIndexed)), 388 },
+    { "glBeginTransformFeedback", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BeginTransformFeedback)), 208 },
+    { "glBindAttribLocation", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BindAttribLocation)), 109 },
+    { "glBindBuffer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BindBuffer)), 92 },
+    { "glBindBufferBase", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BindBufferBase)), 211 },
+    { "glBindBufferRange", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BindBufferRange)), 210 },
+    { "glBindBuffersBase", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BindBuffersBase)), 537 },
+    { "glBindBuffersRange", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BindBuffersRange)), 538 },
+    { "glBindFragDataLocation", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BindFragDataLocation)), 241 },
+    { "glBindFragDataLocationIndexed", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BindFragDataLocationIndexed)), 317 },
+    { "glBindFramebuffer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BindFramebuffer)), 267 },
+    { "glBindImageTexture", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BindImageTexture)), 484 },
+    { "glBindImageTextures", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BindImageTextures)), 541 },
+    { "glBindProgramPipeline", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BindProgramPipeline)), 402 },
+    { "glBindRenderbuffer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BindRenderbuffer)), 261 },
+    { "glBindSampler", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BindSampler)), 322 },
+    { "glBindSamplers", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BindSamplers)), 540 },
+    { "glBindTexture", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BindTexture)), 58 },
+    { "glBindTextureUnit", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BindTextureUnit)), 611 },
+    { "glBindTextures", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BindTextures)), 539 },
+    { "glBindTransformFeedback", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BindTransformFeedback)), 380 },
+    { "glBindVertexArray", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BindVertexArray)), 282 },
+    { "glBindVertexBuffer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BindVertexBuffer)), 518 },
+    { "glBindVertexBuffers", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BindVertexBuffers)), 542 },
+    { "glBlendColor", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BlendColor)), 82 },
+    { "glBlendEquation", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BlendEquation)), 83 },
+    { "glBlendEquationSeparate", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BlendEquationSeparate)), 103 },
+    { "glBlendEquationSeparatei", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BlendEquationSeparatei)), 347 },
+    { "glBlendEquationSeparateiARB", reinterpret_cast<void *> (Null_BlendEquationSeparateiARB), 676 },
+    { "glBlendEquationi", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BlendEquationi)), 346 },
+    { "glBlendEquationiARB", reinterpret_cast<void *> (Null_BlendEquationiARB), 675 },
+    { "glBlendFunc", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BlendFunc)), 25 },
+    { "glBlendFuncSeparate", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BlendFuncSeparate)), 75 },
+    { "glBlendFuncSeparatei", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BlendFuncSeparatei)), 349 },
+    { "glBlendFuncSeparateiARB", reinterpret_cast<void *> (Null_BlendFuncSeparateiARB), 678 },
+    { "glBlendFunci", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BlendFunci)), 348 },
+    { "glBlendFunciARB", reinterpret_cast<void *> (Null_BlendFunciARB), 677 },
+    { "glBlitFramebuffer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BlitFramebuffer)), 277 },
+    { "glBlitNamedFramebuffer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BlitNamedFramebuffer)), 579 },
+    { "glBufferAddressRangeNV", reinterpret_cast<void *> (Null_BufferAddressRangeNV), 716 },
+    { "glBufferData", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BufferData)), 96 },
+    { "glBufferPageCommitmentARB", reinterpret_cast<void *> (Null_BufferPageCommitmentARB), 696 },
+    { "glBufferStorage", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BufferStorage)), 534 },
+    { "glBufferSubData", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (BufferSubData)), 97 },
+    { "glCheckFramebufferStatus", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CheckFramebufferStatus)), 270 },
+    { "glCheckNamedFramebufferStatus", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CheckNamedFramebufferStatus)), 580 },
+    { "glClampColor", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ClampColor)), 214 },
+    { "glClear", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Clear)), 14 },
+    { "glClearBufferData", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ClearBufferData)), 491 },
+    { "glClearBufferSubData", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ClearBufferSubData)), 492 },
+    { "glClearBufferfi", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ClearBufferfi)), 258 },
+    { "glClearBufferfv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ClearBufferfv)), 257 },
+    { "glClearBufferiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ClearBufferiv)), 255 },
+    { "glClearBufferuiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ClearBufferuiv)), 256 },
+    { "glClearColor", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ClearColor)), 15 },
+    { "glClearDepth", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ClearDepth)), 17 },
+    { "glClearDepthf", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ClearDepthf)), 395 },
+    { "glClearNamedBufferData", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ClearNamedBufferData)), 555 },
+    { "glClearNamedBufferSubData", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ClearNamedBufferSubData)), 556 },
+    { "glClearNamedFramebufferfi", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ClearNamedFramebufferfi)), 578 },
+    { "glClearNamedFramebufferfv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ClearNamedFramebufferfv)), 577 },
+    { "glClearNamedFramebufferiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ClearNamedFramebufferiv)), 575 },
+    { "glClearNamedFramebufferuiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ClearNamedFramebufferuiv)), 576 },
+    { "glClearStencil", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ClearStencil)), 16 },
+    { "glClearTexImage", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ClearTexImage)), 535 },
+    { "glClearTexSubImage", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ClearTexSubImage)), 536 },
+    { "glClientWaitSync", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ClientWaitSync)), 306 },
+    { "glClipControl", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ClipControl)), 543 },
+    { "glColorFormatNV", reinterpret_cast<void *> (Null_ColorFormatNV), 719 },
+    { "glColorMask", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ColorMask)), 19 },
+    { "glColorMaski", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ColorMaski)), 202 },
+    { "glCompileShader", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CompileShader)), 110 },
+    { "glCompileShaderIncludeARB", reinterpret_cast<void *> (Null_CompileShaderIncludeARB), 692 },
+    { "glCompressedTexImage1D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CompressedTexImage1D)), 70 },
+    { "glCompressedTexImage2D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CompressedTexImage2D)), 69 },
+    { "glCompressedTexImage3D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CompressedTexImage3D)), 68 },
+    { "glCompressedTexSubImage1D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CompressedTexSubImage1D)), 73 },
+    { "glCompressedTexSubImage2D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CompressedTexSubImage2D)), 72 },
+    { "glCompressedTexSubImage3D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CompressedTexSubImage3D)), 71 },
+    { "glCompressedTextureSubImage1D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CompressedTextureSubImage1D)), 598 },
+    { "glCompressedTextureSubImage2D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CompressedTextureSubImage2D)), 599 },
+    { "glCompressedTextureSubImage3D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CompressedTextureSubImage3D)), 600 },
+    { "glCopyBufferSubData", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CopyBufferSubData)), 290 },
+    { "glCopyImageSubData", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CopyImageSubData)), 495 },
+    { "glCopyNamedBufferSubData", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CopyNamedBufferSubData)), 554 },
+    { "glCopyTexImage1D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CopyTexImage1D)), 52 },
+    { "glCopyTexImage2D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CopyTexImage2D)), 53 },
+    { "glCopyTexSubImage1D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CopyTexSubImage1D)), 54 },
+    { "glCopyTexSubImage2D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CopyTexSubImage2D)), 55 },
+    { "glCopyTexSubImage3D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CopyTexSubImage3D)), 65 },
+    { "glCopyTextureSubImage1D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CopyTextureSubImage1D)), 601 },
+    { "glCopyTextureSubImage2D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CopyTextureSubImage2D)), 602 },
+    { "glCopyTextureSubImage3D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CopyTextureSubImage3D)), 603 },
+    { "glCreateBuffers", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CreateBuffers)), 550 },
+    { "glCreateFramebuffers", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CreateFramebuffers)), 565 },
+    { "glCreateProgram", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CreateProgram)), 111 },
+    { "glCreateProgramPipelines", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CreateProgramPipelines)), 635 },
+    { "glCreateQueries", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CreateQueries)), 636 },
+    { "glCreateRenderbuffers", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CreateRenderbuffers)), 583 },
+    { "glCreateSamplers", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CreateSamplers)), 634 },
+    { "glCreateShader", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CreateShader)), 112 },
+    { "glCreateShaderProgramv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CreateShaderProgramv)), 401 },
+    { "glCreateSyncFromCLeventARB", reinterpret_cast<void *> (Null_CreateSyncFromCLeventARB), 669 },
+    { "glCreateTextures", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CreateTextures)), 587 },
+    { "glCreateTransformFeedbacks", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CreateTransformFeedbacks)), 544 },
+    { "glCreateVertexArrays", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CreateVertexArrays)), 620 },
+    { "glCullFace", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (CullFace)), 0 },
+    { "glDebugMessageCallback", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DebugMessageCallback)), 526 },
+    { "glDebugMessageCallbackARB", reinterpret_cast<void *> (Null_DebugMessageCallbackARB), 673 },
+    { "glDebugMessageControl", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DebugMessageControl)), 524 },
+    { "glDebugMessageControlARB", reinterpret_cast<void *> (Null_DebugMessageControlARB), 671 },
+    { "glDebugMessageInsert", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DebugMessageInsert)), 525 },
+    { "glDebugMessageInsertARB", reinterpret_cast<void *> (Null_DebugMessageInsertARB), 672 },
+    { "glDeleteBuffers", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DeleteBuffers)), 93 },
+    { "glDeleteFramebuffers", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DeleteFramebuffers)), 268 },
+    { "glDeleteNamedStringARB", reinterpret_cast<void *> (Null_DeleteNamedStringARB), 691 },
+    { "glDeleteProgram", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DeleteProgram)), 113 },
+    { "glDeleteProgramPipelines", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DeleteProgramPipelines)), 403 },
+    { "glDeleteQueries", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DeleteQueries)), 85 },
+    { "glDeleteRenderbuffers", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DeleteRenderbuffers)), 262 },
+    { "glDeleteSamplers", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DeleteSamplers)), 320 },
+    { "glDeleteShader", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DeleteShader)), 114 },
+    { "glDeleteSync", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DeleteSync)), 305 },
+    { "glDeleteTextures", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DeleteTextures)), 59 },
+    { "glDeleteTransformFeedbacks", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DeleteTransformFeedbacks)), 381 },
+    { "glDeleteVertexArrays", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DeleteVertexArrays)), 283 },
+    { "glDepthFunc", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DepthFunc)), 29 },
+    { "glDepthMask", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DepthMask)), 20 },
+    { "glDepthRange", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DepthRange)), 46 },
+    { "glDepthRangeArrayv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DepthRangeArrayv)), 475 },
+    { "glDepthRangeIndexed", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DepthRangeIndexed)), 476 },
+    { "glDepthRangef", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DepthRangef)), 394 },
+    { "glDetachShader", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DetachShader)), 115 },
+    { "glDisable", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Disable)), 21 },
+    { "glDisableClientState", reinterpret_cast<void *> (Null_DisableClientState), 729 },
+    { "glDisableVertexArrayAttrib", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DisableVertexArrayAttrib)), 621 },
+    { "glDisableVertexAttribArray", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DisableVertexAttribArray)), 116 },
+    { "glDisablei", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Disablei)), 206 },
+    { "glDispatchCompute", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DispatchCompute)), 493 },
+    { "glDispatchComputeGroupSizeARB", reinterpret_cast<void *> (Null_DispatchComputeGroupSizeARB), 670 },
+    { "glDispatchComputeIndirect", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DispatchComputeIndirect)), 494 },
+    { "glDrawArrays", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DrawArrays)), 48 },
+    { "glDrawArraysIndirect", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DrawArraysIndirect)), 350 },
+    { "glDrawArraysInstanced", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DrawArraysInstanced)), 286 },
+    { "glDrawArraysInstancedBaseInstance", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DrawArraysInstancedBaseInstance)), 479 },
+    { "glDrawBuffer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DrawBuffer)), 13 },
+    { "glDrawBuffers", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DrawBuffers)), 104 },
+    { "glDrawElements", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DrawElements)), 49 },
+    { "glDrawElementsBaseVertex", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DrawElementsBaseVertex)), 298 },
+    { "glDrawElementsIndirect", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DrawElementsIndirect)), 351 },
+    { "glDrawElementsInstanced", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DrawElementsInstanced)), 287 },
+    { "glDrawElementsInstancedBaseInstance", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DrawElementsInstancedBaseInstance)), 480 },
+    { "glDrawElementsInstancedBaseVertex", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DrawElementsInstancedBaseVertex)), 300 },
+    { "glDrawElementsInstancedBaseVertexBaseInstance", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DrawElementsInstancedBaseVertexBaseInstance)), 481 },
+    { "glDrawRangeElements", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DrawRangeElements)), 62 },
+    { "glDrawRangeElementsBaseVertex", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DrawRangeElementsBaseVertex)), 299 },
+    { "glDrawTransformFeedback", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DrawTransformFeedback)), 386 },
+    { "glDrawTransformFeedbackInstanced", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DrawTransformFeedbackInstanced)), 489 },
+    { "glDrawTransformFeedbackStream", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DrawTransformFeedbackStream)), 387 },
+    { "glDrawTransformFeedbackStreamInstanced", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (DrawTransformFeedbackStreamInstanced)), 490 },
+    { "glEdgeFlagFormatNV", reinterpret_cast<void *> (Null_EdgeFlagFormatNV), 722 },
+    { "glEnable", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Enable)), 22 },
+    { "glEnableClientState", reinterpret_cast<void *> (Null_EnableClientState), 728 },
+    { "glEnableVertexArrayAttrib", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (EnableVertexArrayAttrib)), 622 },
+    { "glEnableVertexAttribArray", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (EnableVertexAttribArray)), 117 },
+    { "glEnablei", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Enablei)), 205 },
+    { "glEndConditionalRender", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (EndConditionalRender)), 216 },
+    { "glEndQuery", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (EndQuery)), 88 },
+    { "glEndQueryIndexed", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (EndQueryIndexed)), 389 },
+    { "glEndTransformFeedback", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (EndTransformFeedback)), 209 },
+    { "glFenceSync", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (FenceSync)), 303 },
+    { "glFinish", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Finish)), 23 },
+    { "glFlush", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Flush)), 24 },
+    { "glFlushMappedBufferRange", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (FlushMappedBufferRange)), 281 },
+    { "glFlushMappedNamedBufferRange", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (FlushMappedNamedBufferRange)), 560 },
+    { "glFogCoordFormatNV", reinterpret_cast<void *> (Null_FogCoordFormatNV), 724 },
+    { "glFramebufferParameteri", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (FramebufferParameteri)), 496 },
+    { "glFramebufferRenderbuffer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (FramebufferRenderbuffer)), 274 },
+    { "glFramebufferTexture", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (FramebufferTexture)), 312 },
+    { "glFramebufferTexture1D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (FramebufferTexture1D)), 271 },
+    { "glFramebufferTexture2D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (FramebufferTexture2D)), 272 },
+    { "glFramebufferTexture3D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (FramebufferTexture3D)), 273 },
+    { "glFramebufferTextureLayer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (FramebufferTextureLayer)), 279 },
+    { "glFrontFace", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (FrontFace)), 1 },
+    { "glGenBuffers", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GenBuffers)), 94 },
+    { "glGenFramebuffers", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GenFramebuffers)), 269 },
+    { "glGenProgramPipelines", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GenProgramPipelines)), 404 },
+    { "glGenQueries", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GenQueries)), 84 },
+    { "glGenRenderbuffers", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GenRenderbuffers)), 263 },
+    { "glGenSamplers", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GenSamplers)), 319 },
+    { "glGenTextures", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GenTextures)), 60 },
+    { "glGenTransformFeedbacks", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GenTransformFeedbacks)), 382 },
+    { "glGenVertexArrays", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GenVertexArrays)), 284 },
+    { "glGenerateMipmap", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GenerateMipmap)), 276 },
+    { "glGenerateTextureMipmap", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GenerateTextureMipmap)), 610 },
+    { "glGetActiveAtomicCounterBufferiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetActiveAtomicCounterBufferiv)), 483 },
+    { "glGetActiveAttrib", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetActiveAttrib)), 118 },
+    { "glGetActiveSubroutineName", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetActiveSubroutineName)), 374 },
+    { "glGetActiveSubroutineUniformName", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetActiveSubroutineUniformName)), 373 },
+    { "glGetActiveSubroutineUniformiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetActiveSubroutineUniformiv)), 372 },
+    { "glGetActiveUniform", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetActiveUniform)), 119 },
+    { "glGetActiveUniformBlockName", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetActiveUniformBlockName)), 296 },
+    { "glGetActiveUniformBlockiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetActiveUniformBlockiv)), 295 },
+    { "glGetActiveUniformName", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetActiveUniformName)), 293 },
+    { "glGetActiveUniformsiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetActiveUniformsiv)), 292 },
+    { "glGetAttachedShaders", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetAttachedShaders)), 120 },
+    { "glGetAttribLocation", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetAttribLocation)), 121 },
+    { "glGetBooleani_v", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetBooleani_v)), 203 },
+    { "glGetBooleanv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetBooleanv)), 34 },
+    { "glGetBufferParameteri64v", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetBufferParameteri64v)), 311 },
+    { "glGetBufferParameteriv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetBufferParameteriv)), 101 },
+    { "glGetBufferParameterui64vNV", reinterpret_cast<void *> (Null_GetBufferParameterui64vNV), 709 },
+    { "glGetBufferPointerv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetBufferPointerv)), 102 },
+    { "glGetBufferSubData", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetBufferSubData)), 98 },
+    { "glGetCompressedTexImage", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetCompressedTexImage)), 74 },
+    { "glGetCompressedTextureImage", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetCompressedTextureImage)), 613 },
+    { "glGetCompressedTextureSubImage", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetCompressedTextureSubImage)), 643 },
+    { "glGetDebugMessageLog", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetDebugMessageLog)), 527 },
+    { "glGetDebugMessageLogARB", reinterpret_cast<void *> (Null_GetDebugMessageLogARB), 674 },
+    { "glGetDoublei_v", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetDoublei_v)), 478 },
+    { "glGetDoublev", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetDoublev)), 35 },
+    { "glGetError", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetError)), 36 },
+    { "glGetFloati_v", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetFloati_v)), 477 },
+    { "glGetFloatv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetFloatv)), 37 },
+    { "glGetFragDataIndex", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetFragDataIndex)), 318 },
+    { "glGetFragDataLocation", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetFragDataLocation)), 242 },
+    { "glGetFramebufferAttachmentParameteriv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetFramebufferAttachmentParameteriv)), 275 },
+    { "glGetFramebufferParameteriv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetFramebufferParameteriv)), 497 },
+    { "glGetGraphicsResetStatus", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetGraphicsResetStatus)), 644 },
+    { "glGetGraphicsResetStatusARB", reinterpret_cast<void *> (Null_GetGraphicsResetStatusARB), 681 },
+    { "glGetImageHandleARB", reinterpret_cast<void *> (Null_GetImageHandleARB), 657 },
+    { "glGetInteger64i_v", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetInteger64i_v)), 310 },
+    { "glGetInteger64v", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetInteger64v)), 308 },
+    { "glGetIntegeri_v", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetIntegeri_v)), 204 },
+    { "glGetIntegerui64i_vNV", reinterpret_cast<void *> (Null_GetIntegerui64i_vNV), 727 },
+    { "glGetIntegerui64vNV", reinterpret_cast<void *> (Null_GetIntegerui64vNV), 711 },
+    { "glGetIntegerv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetIntegerv)), 38 },
+    { "glGetInternalformati64v", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetInternalformati64v)), 498 },
+    { "glGetInternalformativ", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetInternalformativ)), 482 },
+    { "glGetMultisamplefv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetMultisamplefv)), 315 },
+    { "glGetMultisamplefvNV", reinterpret_cast<void *> (Null_GetMultisamplefvNV), 700 },
+    { "glGetNamedBufferParameteri64v", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetNamedBufferParameteri64v)), 562 },
+    { "glGetNamedBufferParameteriv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetNamedBufferParameteriv)), 561 },
+    { "glGetNamedBufferParameterui64vNV", reinterpret_cast<void *> (Null_GetNamedBufferParameterui64vNV), 710 },
+    { "glGetNamedBufferPointerv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetNamedBufferPointerv)), 563 },
+    { "glGetNamedBufferSubData", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetNamedBufferSubData)), 564 },
+    { "glGetNamedFramebufferAttachmentParameteriv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetNamedFramebufferAttachmentParameteriv)), 582 },
+    { "glGetNamedFramebufferParameteriv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetNamedFramebufferParameteriv)), 581 },
+    { "glGetNamedRenderbufferParameteriv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetNamedRenderbufferParameteriv)), 586 },
+    { "glGetNamedStringARB", reinterpret_cast<void *> (Null_GetNamedStringARB), 694 },
+    { "glGetNamedStringivARB", reinterpret_cast<void *> (Null_GetNamedStringivARB), 695 },
+    { "glGetObjectLabel", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetObjectLabel)), 531 },
+    { "glGetObjectPtrLabel", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetObjectPtrLabel)), 533 },
+    { "glGetPointerv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetPointerv)), 50 },
+    { "glGetProgramBinary", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetProgramBinary)), 396 },
+    { "glGetProgramInfoLog", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetProgramInfoLog)), 123 },
+    { "glGetProgramInterfaceiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetProgramInterfaceiv)), 507 },
+    { "glGetProgramPipelineInfoLog", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetProgramPipelineInfoLog)), 458 },
+    { "glGetProgramPipelineiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetProgramPipelineiv)), 406 },
+    { "glGetProgramResourceIndex", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetProgramResourceIndex)), 508 },
+    { "glGetProgramResourceLocation", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetProgramResourceLocation)), 511 },
+    { "glGetProgramResourceLocationIndex", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetProgramResourceLocationIndex)), 512 },
+    { "glGetProgramResourceName", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetProgramResourceName)), 509 },
+    { "glGetProgramResourceiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetProgramResourceiv)), 510 },
+    { "glGetProgramStageiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetProgramStageiv)), 377 },
+    { "glGetProgramiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetProgramiv)), 122 },
+    { "glGetQueryBufferObjecti64v", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetQueryBufferObjecti64v)), 637 },
+    { "glGetQueryBufferObjectiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetQueryBufferObjectiv)), 638 },
+    { "glGetQueryBufferObjectui64v", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetQueryBufferObjectui64v)), 639 },
+    { "glGetQueryBufferObjectuiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetQueryBufferObjectuiv)), 640 },
+    { "glGetQueryIndexediv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetQueryIndexediv)), 390 },
+    { "glGetQueryObjecti64v", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetQueryObjecti64v)), 334 },
+    { "glGetQueryObjectiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetQueryObjectiv)), 90 },
+    { "glGetQueryObjectui64v", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetQueryObjectui64v)), 335 },
+    { "glGetQueryObjectuiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetQueryObjectuiv)), 91 },
+    { "glGetQueryiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetQueryiv)), 89 },
+    { "glGetRenderbufferParameteriv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetRenderbufferParameteriv)), 265 },
+    { "glGetSamplerParameterIiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetSamplerParameterIiv)), 330 },
+    { "glGetSamplerParameterIuiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetSamplerParameterIuiv)), 332 },
+    { "glGetSamplerParameterfv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetSamplerParameterfv)), 331 },
+    { "glGetSamplerParameteriv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetSamplerParameteriv)), 329 },
+    { "glGetShaderInfoLog", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetShaderInfoLog)), 125 },
+    { "glGetShaderPrecisionFormat", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetShaderPrecisionFormat)), 393 },
+    { "glGetShaderSource", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetShaderSource)), 126 },
+    { "glGetShaderiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetShaderiv)), 124 },
+    { "glGetString", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetString)), 39 },
+    { "glGetStringi", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetStringi)), 259 },
+    { "glGetSubroutineIndex", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetSubroutineIndex)), 371 },
+    { "glGetSubroutineUniformLocation", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetSubroutineUniformLocation)), 370 },
+    { "glGetSynciv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetSynciv)), 309 },
+    { "glGetTexImage", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetTexImage)), 40 },
+    { "glGetTexLevelParameterfv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetTexLevelParameterfv)), 43 },
+    { "glGetTexLevelParameteriv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetTexLevelParameteriv)), 44 },
+    { "glGetTexParameterIiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetTexParameterIiv)), 253 },
+    { "glGetTexParameterIuiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetTexParameterIuiv)), 254 },
+    { "glGetTexParameterfv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetTexParameterfv)), 41 },
+    { "glGetTexParameteriv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetTexParameteriv)), 42 },
+    { "glGetTextureHandleARB", reinterpret_cast<void *> (Null_GetTextureHandleARB), 653 },
+    { "glGetTextureImage", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetTextureImage)), 612 },
+    { "glGetTextureLevelParameterfv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetTextureLevelParameterfv)), 614 },
+    { "glGetTextureLevelParameteriv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetTextureLevelParameteriv)), 615 },
+    { "glGetTextureParameterIiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetTextureParameterIiv)), 617 },
+    { "glGetTextureParameterIuiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetTextureParameterIuiv)), 618 },
+    { "glGetTextureParameterfv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetTextureParameterfv)), 616 },
+    { "glGetTextureParameteriv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetTextureParameteriv)), 619 },
+    { "glGetTextureSamplerHandleARB", reinterpret_cast<void *> (Null_GetTextureSamplerHandleARB), 654 },
+    { "glGetTextureSubImage", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetTextureSubImage)), 642 },
+    { "glGetTransformFeedbackVarying", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetTransformFeedbackVarying)), 213 },
+    { "glGetTransformFeedbacki64_v", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetTransformFeedbacki64_v)), 549 },
+    { "glGetTransformFeedbacki_v", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetTransformFeedbacki_v)), 548 },
+    { "glGetTransformFeedbackiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetTransformFeedbackiv)), 547 },
+    { "glGetUniformBlockIndex", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetUniformBlockIndex)), 294 },
+    { "glGetUniformIndices", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetUniformIndices)), 291 },
+    { "glGetUniformLocation", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetUniformLocation)), 127 },
+    { "glGetUniformSubroutineuiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetUniformSubroutineuiv)), 376 },
+    { "glGetUniformdv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetUniformdv)), 369 },
+    { "glGetUniformfv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetUniformfv)), 128 },
+    { "glGetUniformiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetUniformiv)), 129 },
+    { "glGetUniformuiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetUniformuiv)), 240 },
+    { "glGetVertexArrayIndexed64iv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetVertexArrayIndexed64iv)), 633 },
+    { "glGetVertexArrayIndexediv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetVertexArrayIndexediv)), 632 },
+    { "glGetVertexArrayiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetVertexArrayiv)), 631 },
+    { "glGetVertexAttribIiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetVertexAttribIiv)), 218 },
+    { "glGetVertexAttribIuiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetVertexAttribIuiv)), 219 },
+    { "glGetVertexAttribLdv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetVertexAttribLdv)), 468 },
+    { "glGetVertexAttribLui64vARB", reinterpret_cast<void *> (Null_GetVertexAttribLui64vARB), 668 },
+    { "glGetVertexAttribPointerv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetVertexAttribPointerv)), 133 },
+    { "glGetVertexAttribdv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetVertexAttribdv)), 130 },
+    { "glGetVertexAttribfv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetVertexAttribfv)), 131 },
+    { "glGetVertexAttribiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetVertexAttribiv)), 132 },
+    { "glGetnCompressedTexImage", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetnCompressedTexImage)), 645 },
+    { "glGetnCompressedTexImageARB", reinterpret_cast<void *> (Null_GetnCompressedTexImageARB), 684 },
+    { "glGetnTexImage", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetnTexImage)), 646 },
+    { "glGetnTexImageARB", reinterpret_cast<void *> (Null_GetnTexImageARB), 682 },
+    { "glGetnUniformdv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetnUniformdv)), 647 },
+    { "glGetnUniformdvARB", reinterpret_cast<void *> (Null_GetnUniformdvARB), 688 },
+    { "glGetnUniformfv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetnUniformfv)), 648 },
+    { "glGetnUniformfvARB", reinterpret_cast<void *> (Null_GetnUniformfvARB), 685 },
+    { "glGetnUniformiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetnUniformiv)), 649 },
+    { "glGetnUniformivARB", reinterpret_cast<void *> (Null_GetnUniformivARB), 686 },
+    { "glGetnUniformuiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (GetnUniformuiv)), 650 },
+    { "glGetnUniformuivARB", reinterpret_cast<void *> (Null_GetnUniformuivARB), 687 },
+    { "glHint", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Hint)), 2 },
+    { "glIndexFormatNV", reinterpret_cast<void *> (Null_IndexFormatNV), 720 },
+    { "glInvalidateBufferData", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (InvalidateBufferData)), 502 },
+    { "glInvalidateBufferSubData", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (InvalidateBufferSubData)), 501 },
+    { "glInvalidateFramebuffer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (InvalidateFramebuffer)), 503 },
+    { "glInvalidateNamedFramebufferData", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (InvalidateNamedFramebufferData)), 573 },
+    { "glInvalidateNamedFramebufferSubData", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (InvalidateNamedFramebufferSubData)), 574 },
+    { "glInvalidateSubFramebuffer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (InvalidateSubFramebuffer)), 504 },
+    { "glInvalidateTexImage", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (InvalidateTexImage)), 500 },
+    { "glInvalidateTexSubImage", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (InvalidateTexSubImage)), 499 },
+    { "glIsBuffer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (IsBuffer)), 95 },
+    { "glIsBufferResidentNV", reinterpret_cast<void *> (Null_IsBufferResidentNV), 705 },
+    { "glIsEnabled", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (IsEnabled)), 45 },
+    { "glIsEnabledi", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (IsEnabledi)), 207 },
+    { "glIsFramebuffer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (IsFramebuffer)), 266 },
+    { "glIsImageHandleResidentARB", reinterpret_cast<void *> (Null_IsImageHandleResidentARB), 665 },
+    { "glIsNamedBufferResidentNV", reinterpret_cast<void *> (Null_IsNamedBufferResidentNV), 708 },
+    { "glIsNamedStringARB", reinterpret_cast<void *> (Null_IsNamedStringARB), 693 },
+    { "glIsProgram", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (IsProgram)), 134 },
+    { "glIsProgramPipeline", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (IsProgramPipeline)), 405 },
+    { "glIsQuery", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (IsQuery)), 86 },
+    { "glIsRenderbuffer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (IsRenderbuffer)), 260 },
+    { "glIsSampler", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (IsSampler)), 321 },
+    { "glIsShader", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (IsShader)), 135 },
+    { "glIsSync", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (IsSync)), 304 },
+    { "glIsTexture", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (IsTexture)), 61 },
+    { "glIsTextureHandleResidentARB", reinterpret_cast<void *> (Null_IsTextureHandleResidentARB), 664 },
+    { "glIsTransformFeedback", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (IsTransformFeedback)), 383 },
+    { "glIsVertexArray", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (IsVertexArray)), 285 },
+    { "glLineWidth", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (LineWidth)), 3 },
+    { "glLinkProgram", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (LinkProgram)), 136 },
+    { "glLogicOp", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (LogicOp)), 26 },
+    { "glMakeBufferNonResidentNV", reinterpret_cast<void *> (Null_MakeBufferNonResidentNV), 704 },
+    { "glMakeBufferResidentNV", reinterpret_cast<void *> (Null_MakeBufferResidentNV), 703 },
+    { "glMakeImageHandleNonResidentARB", reinterpret_cast<void *> (Null_MakeImageHandleNonResidentARB), 659 },
+    { "glMakeImageHandleResidentARB", reinterpret_cast<void *> (Null_MakeImageHandleResidentARB), 658 },
+    { "glMakeNamedBufferNonResidentNV", reinterpret_cast<void *> (Null_MakeNamedBufferNonResidentNV), 707 },
+    { "glMakeNamedBufferResidentNV", reinterpret_cast<void *> (Null_MakeNamedBufferResidentNV), 706 },
+    { "glMakeTextureHandleNonResidentARB", reinterpret_cast<void *> (Null_MakeTextureHandleNonResidentARB), 656 },
+    { "glMakeTextureHandleResidentARB", reinterpret_cast<void *> (Null_MakeTextureHandleResidentARB), 655 },
+    { "glMapBuffer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (MapBuffer)), 99 },
+    { "glMapBufferRange", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (MapBufferRange)), 280 },
+    { "glMapNamedBuffer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (MapNamedBuffer)), 557 },
+    { "glMapNamedBufferRange", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (MapNamedBufferRange)), 558 },
+    { "glMemoryBarrier", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (MemoryBarrier)), 485 },
+    { "glMemoryBarrierByRegion", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (MemoryBarrierByRegion)), 641 },
+    { "glMinSampleShading", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (MinSampleShading)), 345 },
+    { "glMinSampleShadingARB", reinterpret_cast<void *> (Null_MinSampleShadingARB), 689 },
+    { "glMultiDrawArrays", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (MultiDrawArrays)), 76 },
+    { "glMultiDrawArraysIndirect", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (MultiDrawArraysIndirect)), 505 },
+    { "glMultiDrawArraysIndirectCountARB", reinterpret_cast<void *> (Null_MultiDrawArraysIndirectCountARB), 679 },
+    { "glMultiDrawElements", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (MultiDrawElements)), 77 },
+    { "glMultiDrawElementsBaseVertex", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (MultiDrawElementsBaseVertex)), 301 },
+    { "glMultiDrawElementsIndirect", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (MultiDrawElementsIndirect)), 506 },
+    { "glMultiDrawElementsIndirectCountARB", reinterpret_cast<void *> (Null_MultiDrawElementsIndirectCountARB), 680 },
+    { "glNamedBufferData", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (NamedBufferData)), 552 },
+    { "glNamedBufferPageCommitmentARB", reinterpret_cast<void *> (Null_NamedBufferPageCommitmentARB), 698 },
+    { "glNamedBufferPageCommitmentEXT", reinterpret_cast<void *> (Null_NamedBufferPageCommitmentEXT), 697 },
+    { "glNamedBufferStorage", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (NamedBufferStorage)), 551 },
+    { "glNamedBufferSubData", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (NamedBufferSubData)), 553 },
+    { "glNamedFramebufferDrawBuffer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (NamedFramebufferDrawBuffer)), 570 },
+    { "glNamedFramebufferDrawBuffers", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (NamedFramebufferDrawBuffers)), 571 },
+    { "glNamedFramebufferParameteri", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (NamedFramebufferParameteri)), 567 },
+    { "glNamedFramebufferReadBuffer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (NamedFramebufferReadBuffer)), 572 },
+    { "glNamedFramebufferRenderbuffer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (NamedFramebufferRenderbuffer)), 566 },
+    { "glNamedFramebufferTexture", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (NamedFramebufferTexture)), 568 },
+    { "glNamedFramebufferTextureLayer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (NamedFramebufferTextureLayer)), 569 },
+    { "glNamedRenderbufferStorage", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (NamedRenderbufferStorage)), 584 },
+    { "glNamedRenderbufferStorageMultisample", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (NamedRenderbufferStorageMultisample)), 585 },
+    { "glNamedStringARB", reinterpret_cast<void *> (Null_NamedStringARB), 690 },
+    { "glNormalFormatNV", reinterpret_cast<void *> (Null_NormalFormatNV), 718 },
+    { "glObjectLabel", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ObjectLabel)), 530 },
+    { "glObjectPtrLabel", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ObjectPtrLabel)), 532 },
+    { "glPatchParameterfv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (PatchParameterfv)), 379 },
+    { "glPatchParameteri", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (PatchParameteri)), 378 },
+    { "glPauseTransformFeedback", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (PauseTransformFeedback)), 384 },
+    { "glPixelStoref", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (PixelStoref)), 30 },
+    { "glPixelStorei", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (PixelStorei)), 31 },
+    { "glPointParameterf", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (PointParameterf)), 78 },
+    { "glPointParameterfv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (PointParameterfv)), 79 },
+    { "glPointParameteri", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (PointParameteri)), 80 },
+    { "glPointParameteriv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (PointParameteriv)), 81 },
+    { "glPointSize", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (PointSize)), 4 },
+    { "glPolygonMode", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (PolygonMode)), 5 },
+    { "glPolygonOffset", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (PolygonOffset)), 51 },
+    { "glPopDebugGroup", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (PopDebugGroup)), 529 },
+    { "glPrimitiveRestartIndex", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (PrimitiveRestartIndex)), 289 },
+    { "glProgramBinary", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramBinary)), 397 },
+    { "glProgramParameteri", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramParameteri)), 398 },
+    { "glProgramUniform1d", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform1d)), 411 },
+    { "glProgramUniform1dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform1dv)), 412 },
+    { "glProgramUniform1f", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform1f)), 409 },
+    { "glProgramUniform1fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform1fv)), 410 },
+    { "glProgramUniform1i", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform1i)), 407 },
+    { "glProgramUniform1iv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform1iv)), 408 },
+    { "glProgramUniform1ui", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform1ui)), 413 },
+    { "glProgramUniform1uiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform1uiv)), 414 },
+    { "glProgramUniform2d", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform2d)), 419 },
+    { "glProgramUniform2dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform2dv)), 420 },
+    { "glProgramUniform2f", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform2f)), 417 },
+    { "glProgramUniform2fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform2fv)), 418 },
+    { "glProgramUniform2i", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform2i)), 415 },
+    { "glProgramUniform2iv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform2iv)), 416 },
+    { "glProgramUniform2ui", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform2ui)), 421 },
+    { "glProgramUniform2uiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform2uiv)), 422 },
+    { "glProgramUniform3d", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform3d)), 427 },
+    { "glProgramUniform3dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform3dv)), 428 },
+    { "glProgramUniform3f", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform3f)), 425 },
+    { "glProgramUniform3fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform3fv)), 426 },
+    { "glProgramUniform3i", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform3i)), 423 },
+    { "glProgramUniform3iv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform3iv)), 424 },
+    { "glProgramUniform3ui", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform3ui)), 429 },
+    { "glProgramUniform3uiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform3uiv)), 430 },
+    { "glProgramUniform4d", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform4d)), 435 },
+    { "glProgramUniform4dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform4dv)), 436 },
+    { "glProgramUniform4f", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform4f)), 433 },
+    { "glProgramUniform4fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform4fv)), 434 },
+    { "glProgramUniform4i", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform4i)), 431 },
+    { "glProgramUniform4iv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform4iv)), 432 },
+    { "glProgramUniform4ui", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform4ui)), 437 },
+    { "glProgramUniform4uiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniform4uiv)), 438 },
+    { "glProgramUniformHandleui64ARB", reinterpret_cast<void *> (Null_ProgramUniformHandleui64ARB), 662 },
+    { "glProgramUniformHandleui64vARB", reinterpret_cast<void *> (Null_ProgramUniformHandleui64vARB), 663 },
+    { "glProgramUniformMatrix2dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniformMatrix2dv)), 442 },
+    { "glProgramUniformMatrix2fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniformMatrix2fv)), 439 },
+    { "glProgramUniformMatrix2x3dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniformMatrix2x3dv)), 451 },
+    { "glProgramUniformMatrix2x3fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniformMatrix2x3fv)), 445 },
+    { "glProgramUniformMatrix2x4dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniformMatrix2x4dv)), 453 },
+    { "glProgramUniformMatrix2x4fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniformMatrix2x4fv)), 447 },
+    { "glProgramUniformMatrix3dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniformMatrix3dv)), 443 },
+    { "glProgramUniformMatrix3fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniformMatrix3fv)), 440 },
+    { "glProgramUniformMatrix3x2dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniformMatrix3x2dv)), 452 },
+    { "glProgramUniformMatrix3x2fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniformMatrix3x2fv)), 446 },
+    { "glProgramUniformMatrix3x4dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniformMatrix3x4dv)), 455 },
+    { "glProgramUniformMatrix3x4fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniformMatrix3x4fv)), 449 },
+    { "glProgramUniformMatrix4dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniformMatrix4dv)), 444 },
+    { "glProgramUniformMatrix4fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniformMatrix4fv)), 441 },
+    { "glProgramUniformMatrix4x2dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniformMatrix4x2dv)), 454 },
+    { "glProgramUniformMatrix4x2fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniformMatrix4x2fv)), 448 },
+    { "glProgramUniformMatrix4x3dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniformMatrix4x3dv)), 456 },
+    { "glProgramUniformMatrix4x3fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProgramUniformMatrix4x3fv)), 450 },
+    { "glProgramUniformui64NV", reinterpret_cast<void *> (Null_ProgramUniformui64NV), 714 },
+    { "glProgramUniformui64vNV", reinterpret_cast<void *> (Null_ProgramUniformui64vNV), 715 },
+    { "glProvokingVertex", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ProvokingVertex)), 302 },
+    { "glPushDebugGroup", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (PushDebugGroup)), 528 },
+    { "glQueryCounter", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (QueryCounter)), 333 },
+    { "glReadBuffer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ReadBuffer)), 32 },
+    { "glReadPixels", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ReadPixels)), 33 },
+    { "glReadnPixels", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ReadnPixels)), 651 },
+    { "glReadnPixelsARB", reinterpret_cast<void *> (Null_ReadnPixelsARB), 683 },
+    { "glReleaseShaderCompiler", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ReleaseShaderCompiler)), 391 },
+    { "glRenderbufferStorage", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (RenderbufferStorage)), 264 },
+    { "glRenderbufferStorageMultisample", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (RenderbufferStorageMultisample)), 278 },
+    { "glResumeTransformFeedback", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ResumeTransformFeedback)), 385 },
+    { "glSampleCoverage", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (SampleCoverage)), 67 },
+    { "glSampleMaskIndexedNV", reinterpret_cast<void *> (Null_SampleMaskIndexedNV), 701 },
+    { "glSampleMaski", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (SampleMaski)), 316 },
+    { "glSamplerParameterIiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (SamplerParameterIiv)), 327 },
+    { "glSamplerParameterIuiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (SamplerParameterIuiv)), 328 },
+    { "glSamplerParameterf", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (SamplerParameterf)), 325 },
+    { "glSamplerParameterfv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (SamplerParameterfv)), 326 },
+    { "glSamplerParameteri", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (SamplerParameteri)), 323 },
+    { "glSamplerParameteriv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (SamplerParameteriv)), 324 },
+    { "glScissor", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Scissor)), 6 },
+    { "glScissorArrayv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ScissorArrayv)), 472 },
+    { "glScissorIndexed", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ScissorIndexed)), 473 },
+    { "glScissorIndexedv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ScissorIndexedv)), 474 },
+    { "glSecondaryColorFormatNV", reinterpret_cast<void *> (Null_SecondaryColorFormatNV), 723 },
+    { "glShaderBinary", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ShaderBinary)), 392 },
+    { "glShaderSource", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ShaderSource)), 137 },
+    { "glShaderStorageBlockBinding", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ShaderStorageBlockBinding)), 513 },
+    { "glStencilFunc", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (StencilFunc)), 27 },
+    { "glStencilFuncSeparate", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (StencilFuncSeparate)), 106 },
+    { "glStencilMask", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (StencilMask)), 18 },
+    { "glStencilMaskSeparate", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (StencilMaskSeparate)), 107 },
+    { "glStencilOp", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (StencilOp)), 28 },
+    { "glStencilOpSeparate", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (StencilOpSeparate)), 105 },
+    { "glTexBuffer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TexBuffer)), 288 },
+    { "glTexBufferRange", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TexBufferRange)), 514 },
+    { "glTexCoordFormatNV", reinterpret_cast<void *> (Null_TexCoordFormatNV), 721 },
+    { "glTexImage1D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TexImage1D)), 11 },
+    { "glTexImage2D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TexImage2D)), 12 },
+    { "glTexImage2DMultisample", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TexImage2DMultisample)), 313 },
+    { "glTexImage3D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TexImage3D)), 63 },
+    { "glTexImage3DMultisample", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TexImage3DMultisample)), 314 },
+    { "glTexPageCommitmentARB", reinterpret_cast<void *> (Null_TexPageCommitmentARB), 699 },
+    { "glTexParameterIiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TexParameterIiv)), 251 },
+    { "glTexParameterIuiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TexParameterIuiv)), 252 },
+    { "glTexParameterf", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TexParameterf)), 7 },
+    { "glTexParameterfv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TexParameterfv)), 8 },
+    { "glTexParameteri", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TexParameteri)), 9 },
+    { "glTexParameteriv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TexParameteriv)), 10 },
+    { "glTexRenderbufferNV", reinterpret_cast<void *> (Null_TexRenderbufferNV), 702 },
+    { "glTexStorage1D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TexStorage1D)), 486 },
+    { "glTexStorage2D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TexStorage2D)), 487 },
+    { "glTexStorage2DMultisample", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TexStorage2DMultisample)), 515 },
+    { "glTexStorage3D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TexStorage3D)), 488 },
+    { "glTexStorage3DMultisample", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TexStorage3DMultisample)), 516 },
+    { "glTexSubImage1D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TexSubImage1D)), 56 },
+    { "glTexSubImage2D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TexSubImage2D)), 57 },
+    { "glTexSubImage3D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TexSubImage3D)), 64 },
+    { "glTextureBarrier", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TextureBarrier)), 652 },
+    { "glTextureBuffer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TextureBuffer)), 588 },
+    { "glTextureBufferRange", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TextureBufferRange)), 589 },
+    { "glTextureParameterIiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TextureParameterIiv)), 607 },
+    { "glTextureParameterIuiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TextureParameterIuiv)), 608 },
+    { "glTextureParameterf", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TextureParameterf)), 604 },
+    { "glTextureParameterfv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TextureParameterfv)), 605 },
+    { "glTextureParameteri", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TextureParameteri)), 606 },
+    { "glTextureParameteriv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TextureParameteriv)), 609 },
+    { "glTextureStorage1D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TextureStorage1D)), 590 },
+    { "glTextureStorage2D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TextureStorage2D)), 591 },
+    { "glTextureStorage2DMultisample", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TextureStorage2DMultisample)), 593 },
+    { "glTextureStorage3D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TextureStorage3D)), 592 },
+    { "glTextureStorage3DMultisample", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TextureStorage3DMultisample)), 594 },
+    { "glTextureSubImage1D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TextureSubImage1D)), 595 },
+    { "glTextureSubImage2D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TextureSubImage2D)), 596 },
+    { "glTextureSubImage3D", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TextureSubImage3D)), 597 },
+    { "glTextureView", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TextureView)), 517 },
+    { "glTransformFeedbackBufferBase", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TransformFeedbackBufferBase)), 545 },
+    { "glTransformFeedbackBufferRange", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TransformFeedbackBufferRange)), 546 },
+    { "glTransformFeedbackVaryings", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (TransformFeedbackVaryings)), 212 },
+    { "glUniform1d", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform1d)), 352 },
+    { "glUniform1dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform1dv)), 356 },
+    { "glUniform1f", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform1f)), 139 },
+    { "glUniform1fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform1fv)), 147 },
+    { "glUniform1i", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform1i)), 143 },
+    { "glUniform1iv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform1iv)), 151 },
+    { "glUniform1ui", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform1ui)), 243 },
+    { "glUniform1uiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform1uiv)), 247 },
+    { "glUniform2d", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform2d)), 353 },
+    { "glUniform2dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform2dv)), 357 },
+    { "glUniform2f", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform2f)), 140 },
+    { "glUniform2fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform2fv)), 148 },
+    { "glUniform2i", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform2i)), 144 },
+    { "glUniform2iv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform2iv)), 152 },
+    { "glUniform2ui", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform2ui)), 244 },
+    { "glUniform2uiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform2uiv)), 248 },
+    { "glUniform3d", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform3d)), 354 },
+    { "glUniform3dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform3dv)), 358 },
+    { "glUniform3f", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform3f)), 141 },
+    { "glUniform3fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform3fv)), 149 },
+    { "glUniform3i", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform3i)), 145 },
+    { "glUniform3iv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform3iv)), 153 },
+    { "glUniform3ui", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform3ui)), 245 },
+    { "glUniform3uiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform3uiv)), 249 },
+    { "glUniform4d", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform4d)), 355 },
+    { "glUniform4dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform4dv)), 359 },
+    { "glUniform4f", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform4f)), 142 },
+    { "glUniform4fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform4fv)), 150 },
+    { "glUniform4i", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform4i)), 146 },
+    { "glUniform4iv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform4iv)), 154 },
+    { "glUniform4ui", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform4ui)), 246 },
+    { "glUniform4uiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Uniform4uiv)), 250 },
+    { "glUniformBlockBinding", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (UniformBlockBinding)), 297 },
+    { "glUniformHandleui64ARB", reinterpret_cast<void *> (Null_UniformHandleui64ARB), 660 },
+    { "glUniformHandleui64vARB", reinterpret_cast<void *> (Null_UniformHandleui64vARB), 661 },
+    { "glUniformMatrix2dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (UniformMatrix2dv)), 360 },
+    { "glUniformMatrix2fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (UniformMatrix2fv)), 155 },
+    { "glUniformMatrix2x3dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (UniformMatrix2x3dv)), 363 },
+    { "glUniformMatrix2x3fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (UniformMatrix2x3fv)), 196 },
+    { "glUniformMatrix2x4dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (UniformMatrix2x4dv)), 364 },
+    { "glUniformMatrix2x4fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (UniformMatrix2x4fv)), 198 },
+    { "glUniformMatrix3dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (UniformMatrix3dv)), 361 },
+    { "glUniformMatrix3fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (UniformMatrix3fv)), 156 },
+    { "glUniformMatrix3x2dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (UniformMatrix3x2dv)), 365 },
+    { "glUniformMatrix3x2fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (UniformMatrix3x2fv)), 197 },
+    { "glUniformMatrix3x4dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (UniformMatrix3x4dv)), 366 },
+    { "glUniformMatrix3x4fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (UniformMatrix3x4fv)), 200 },
+    { "glUniformMatrix4dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (UniformMatrix4dv)), 362 },
+    { "glUniformMatrix4fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (UniformMatrix4fv)), 157 },
+    { "glUniformMatrix4x2dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (UniformMatrix4x2dv)), 367 },
+    { "glUniformMatrix4x2fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (UniformMatrix4x2fv)), 199 },
+    { "glUniformMatrix4x3dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (UniformMatrix4x3dv)), 368 },
+    { "glUniformMatrix4x3fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (UniformMatrix4x3fv)), 201 },
+    { "glUniformSubroutinesuiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (UniformSubroutinesuiv)), 375 },
+    { "glUniformui64NV", reinterpret_cast<void *> (Null_Uniformui64NV), 712 },
+    { "glUniformui64vNV", reinterpret_cast<void *> (Null_Uniformui64vNV), 713 },
+    { "glUnmapBuffer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (UnmapBuffer)), 100 },
+    { "glUnmapNamedBuffer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (UnmapNamedBuffer)), 559 },
+    { "glUseProgram", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (UseProgram)), 138 },
+    { "glUseProgramStages", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (UseProgramStages)), 399 },
+    { "glValidateProgram", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ValidateProgram)), 158 },
+    { "glValidateProgramPipeline", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ValidateProgramPipeline)), 457 },
+    { "glVertexArrayAttribBinding", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexArrayAttribBinding)), 626 },
+    { "glVertexArrayAttribFormat", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexArrayAttribFormat)), 627 },
+    { "glVertexArrayAttribIFormat", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexArrayAttribIFormat)), 628 },
+    { "glVertexArrayAttribLFormat", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexArrayAttribLFormat)), 629 },
+    { "glVertexArrayBindingDivisor", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexArrayBindingDivisor)), 630 },
+    { "glVertexArrayElementBuffer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexArrayElementBuffer)), 623 },
+    { "glVertexArrayVertexBuffer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexArrayVertexBuffer)), 624 },
+    { "glVertexArrayVertexBuffers", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexArrayVertexBuffers)), 625 },
+    { "glVertexAttrib1d", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib1d)), 159 },
+    { "glVertexAttrib1dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib1dv)), 160 },
+    { "glVertexAttrib1f", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib1f)), 161 },
+    { "glVertexAttrib1fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib1fv)), 162 },
+    { "glVertexAttrib1s", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib1s)), 163 },
+    { "glVertexAttrib1sv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib1sv)), 164 },
+    { "glVertexAttrib2d", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib2d)), 165 },
+    { "glVertexAttrib2dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib2dv)), 166 },
+    { "glVertexAttrib2f", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib2f)), 167 },
+    { "glVertexAttrib2fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib2fv)), 168 },
+    { "glVertexAttrib2s", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib2s)), 169 },
+    { "glVertexAttrib2sv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib2sv)), 170 },
+    { "glVertexAttrib3d", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib3d)), 171 },
+    { "glVertexAttrib3dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib3dv)), 172 },
+    { "glVertexAttrib3f", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib3f)), 173 },
+    { "glVertexAttrib3fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib3fv)), 174 },
+    { "glVertexAttrib3s", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib3s)), 175 },
+    { "glVertexAttrib3sv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib3sv)), 176 },
+    { "glVertexAttrib4Nbv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib4Nbv)), 177 },
+    { "glVertexAttrib4Niv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib4Niv)), 178 },
+    { "glVertexAttrib4Nsv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib4Nsv)), 179 },
+    { "glVertexAttrib4Nub", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib4Nub)), 180 },
+    { "glVertexAttrib4Nubv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib4Nubv)), 181 },
+    { "glVertexAttrib4Nuiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib4Nuiv)), 182 },
+    { "glVertexAttrib4Nusv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib4Nusv)), 183 },
+    { "glVertexAttrib4bv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib4bv)), 184 },
+    { "glVertexAttrib4d", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib4d)), 185 },
+    { "glVertexAttrib4dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib4dv)), 186 },
+    { "glVertexAttrib4f", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib4f)), 187 },
+    { "glVertexAttrib4fv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib4fv)), 188 },
+    { "glVertexAttrib4iv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib4iv)), 189 },
+    { "glVertexAttrib4s", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib4s)), 190 },
+    { "glVertexAttrib4sv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib4sv)), 191 },
+    { "glVertexAttrib4ubv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib4ubv)), 192 },
+    { "glVertexAttrib4uiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib4uiv)), 193 },
+    { "glVertexAttrib4usv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttrib4usv)), 194 },
+    { "glVertexAttribBinding", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribBinding)), 522 },
+    { "glVertexAttribDivisor", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribDivisor)), 336 },
+    { "glVertexAttribFormat", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribFormat)), 519 },
+    { "glVertexAttribFormatNV", reinterpret_cast<void *> (Null_VertexAttribFormatNV), 725 },
+    { "glVertexAttribI1i", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribI1i)), 220 },
+    { "glVertexAttribI1iv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribI1iv)), 228 },
+    { "glVertexAttribI1ui", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribI1ui)), 224 },
+    { "glVertexAttribI1uiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribI1uiv)), 232 },
+    { "glVertexAttribI2i", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribI2i)), 221 },
+    { "glVertexAttribI2iv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribI2iv)), 229 },
+    { "glVertexAttribI2ui", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribI2ui)), 225 },
+    { "glVertexAttribI2uiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribI2uiv)), 233 },
+    { "glVertexAttribI3i", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribI3i)), 222 },
+    { "glVertexAttribI3iv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribI3iv)), 230 },
+    { "glVertexAttribI3ui", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribI3ui)), 226 },
+    { "glVertexAttribI3uiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribI3uiv)), 234 },
+    { "glVertexAttribI4bv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribI4bv)), 236 },
+    { "glVertexAttribI4i", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribI4i)), 223 },
+    { "glVertexAttribI4iv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribI4iv)), 231 },
+    { "glVertexAttribI4sv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribI4sv)), 237 },
+    { "glVertexAttribI4ubv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribI4ubv)), 238 },
+    { "glVertexAttribI4ui", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribI4ui)), 227 },
+    { "glVertexAttribI4uiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribI4uiv)), 235 },
+    { "glVertexAttribI4usv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribI4usv)), 239 },
+    { "glVertexAttribIFormat", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribIFormat)), 520 },
+    { "glVertexAttribIFormatNV", reinterpret_cast<void *> (Null_VertexAttribIFormatNV), 726 },
+    { "glVertexAttribIPointer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribIPointer)), 217 },
+    { "glVertexAttribL1d", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribL1d)), 459 },
+    { "glVertexAttribL1dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribL1dv)), 463 },
+    { "glVertexAttribL1ui64ARB", reinterpret_cast<void *> (Null_VertexAttribL1ui64ARB), 666 },
+    { "glVertexAttribL1ui64vARB", reinterpret_cast<void *> (Null_VertexAttribL1ui64vARB), 667 },
+    { "glVertexAttribL2d", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribL2d)), 460 },
+    { "glVertexAttribL2dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribL2dv)), 464 },
+    { "glVertexAttribL3d", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribL3d)), 461 },
+    { "glVertexAttribL3dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribL3dv)), 465 },
+    { "glVertexAttribL4d", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribL4d)), 462 },
+    { "glVertexAttribL4dv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribL4dv)), 466 },
+    { "glVertexAttribLFormat", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribLFormat)), 521 },
+    { "glVertexAttribLPointer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribLPointer)), 467 },
+    { "glVertexAttribP1ui", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribP1ui)), 337 },
+    { "glVertexAttribP1uiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribP1uiv)), 338 },
+    { "glVertexAttribP2ui", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribP2ui)), 339 },
+    { "glVertexAttribP2uiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribP2uiv)), 340 },
+    { "glVertexAttribP3ui", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribP3ui)), 341 },
+    { "glVertexAttribP3uiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribP3uiv)), 342 },
+    { "glVertexAttribP4ui", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribP4ui)), 343 },
+    { "glVertexAttribP4uiv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribP4uiv)), 344 },
+    { "glVertexAttribPointer", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexAttribPointer)), 195 },
+    { "glVertexBindingDivisor", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (VertexBindingDivisor)), 523 },
+    { "glVertexFormatNV", reinterpret_cast<void *> (Null_VertexFormatNV), 717 },
+    { "glViewport", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (Viewport)), 47 },
+    { "glViewportArrayv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ViewportArrayv)), 469 },
+    { "glViewportIndexedf", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ViewportIndexedf)), 470 },
+    { "glViewportIndexedfv", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (ViewportIndexedfv)), 471 },
+    { "glWaitSync", reinterpret_cast<void *> (OGLP_NULL_CORE_NAME (WaitSync)), 307 },
+};
+
+} /* namespace internal */
+} /* namespace oglp */
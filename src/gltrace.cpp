@@ -0,0 +1,9508 @@
+/*
+ * Copyright (c) 2014 Daniel Kirchner
+ *
+ * Copying and distribution of this file, with or without modification,
+ * are permitted in any medium without royalty provided the copyright
+ * notice and this notice are preserved.  This file is offered as-is,
+ * without any warranty. 
+ */
+/* This file was generated by glcorew_gen.py.
+ * Don't change it directly, change glcorew_gen.py instead.*/
+#include <oglp/trace.h>
+
+#ifdef OGLP_TRACE
+
+namespace oglp {
+namespace internal {
+
+const unsigned int NumTraceProcs = 730;
+
+const char *const TraceProcNames[NumTraceProcs] = {
+    "glCullFace",
+    "glFrontFace",
+    "glHint",
+    "glLineWidth",
+    "glPointSize",
+    "glPolygonMode",
+    "glScissor",
+    "glTexParameterf",
+    "glTexParameterfv",
+    "glTexParameteri",
+    "glTexParameteriv",
+    "glTexImage1D",
+    "glTexImage2D",
+    "glDrawBuffer",
+    "glClear",
+    "glClearColor",
+    "glClearStencil",
+    "glClearDepth",
+    "glStencilMask",
+    "glColorMask",
+    "glDepthMask",
+    "glDisable",
+    "glEnable",
+    "glFinish",
+    "glFlush",
+    "glBlendFunc",
+    "glLogicOp",
+    "glStencilFunc",
+    "glStencilOp",
+    "glDepthFunc",
+    "glPixelStoref",
+    "glPixelStorei",
+    "glReadBuffer",
+    "glReadPixels",
+    "glGetBooleanv",
+    "glGetDoublev",
+    "glGetError",
+    "glGetFloatv",
+    "glGetIntegerv",
+    "glGetString",
+    "glGetTexImage",
+    "glGetTexParameterfv",
+    "glGetTexParameteriv",
+    "glGetTexLevelParameterfv",
+    "glGetTexLevelParameteriv",
+    "glIsEnabled",
+    "glDepthRange",
+    "glViewport",
+    "glDrawArrays",
+    "glDrawElements",
+    "glGetPointerv",
+    "glPolygonOffset",
+    "glCopyTexImage1D",
+    "glCopyTexImage2D",
+    "glCopyTexSubImage1D",
+    "glCopyTexSubImage2D",
+    "glTexSubImage1D",
+    "glTexSubImage2D",
+    "glBindTexture",
+    "glDeleteTextures",
+    "glGenTextures",
+    "glIsTexture",
+    "glDrawRangeElements",
+    "glTexImage3D",
+    "glTexSubImage3D",
+    "glCopyTexSubImage3D",
+    "glActiveTexture",
+    "glSampleCoverage",
+    "glCompressedTexImage3D",
+    "glCompressedTexImage2D",
+    "glCompressedTexImage1D",
+    "glCompressedTexSubImage3D",
+    "glCompressedTexSubImage2D",
+    "glCompressedTexSubImage1D",
+    "glGetCompressedTexImage",
+    "glBlendFuncSeparate",
+    "glMultiDrawArrays",
+    "glMultiDrawElements",
+    "glPointParameterf",
+    "glPointParameterfv",
+    "glPointParameteri",
+    "glPointParameteriv",
+    "glBlendColor",
+    "glBlendEquation",
+    "glGenQueries",
+    "glDeleteQueries",
+    "glIsQuery",
+    "glBeginQuery",
+    "glEndQuery",
+    "glGetQueryiv",
+    "glGetQueryObjectiv",
+    "glGetQueryObjectuiv",
+    "glBindBuffer",
+    "glDeleteBuffers",
+    "glGenBuffers",
+    "glIsBuffer",
+    "glBufferData",
+    "glBufferSubData",
+    "glGetBufferSubData",
+    "glMapBuffer",
+    "glUnmapBuffer",
+    "glGetBufferParameteriv",
+    "glGetBufferPointerv",
+    "glBlendEquationSeparate",
+    "glDrawBuffers",
+    "glStencilOpSeparate",
+    "glStencilFuncSeparate",
+    "glStencilMaskSeparate",
+    "glAttachShader",
+    "glBindAttribLocation",
+    "glCompileShader",
+    "glCreateProgram",
+    "glCreateShader",
+    "glDeleteProgram",
+    "glDeleteShader",
+    "glDetachShader",
+    "glDisableVertexAttribArray",
+    "glEnableVertexAttribArray",
+    "glGetActiveAttrib",
+    "glGetActiveUniform",
+    "glGetAttachedShaders",
+    "glGetAttribLocation",
+    "glGetProgramiv",
+    "glGetProgramInfoLog",
+    "glGetShaderiv",
+    "glGetShaderInfoLog",
+    "glGetShaderSource",
+    "glGetUniformLocation",
+    "glGetUniformfv",
+    "glGetUniformiv",
+    "glGetVertexAttribdv",
+    "glGetVertexAttribfv",
+    "glGetVertexAttribiv",
+    "glGetVertexAttribPointerv",
+    "glIsProgram",
+    "glIsShader",
+    "glLinkProgram",
+    "glShaderSource",
+    "glUseProgram",
+    "glUniform1f",
+    "glUniform2f",
+    "glUniform3f",
+    "glUniform4f",
+    "glUniform1i",
+    "glUniform2i",
+    "glUniform3i",
+    "glUniform4i",
+    "glUniform1fv",
+    "glUniform2fv",
+    "glUniform3fv",
+    "glUniform4fv",
+    "glUniform1iv",
+    "glUniform2iv",
+    "glUniform3iv",
+    "glUniform4iv",
+    "glUniformMatrix2fv",
+    "glUniformMatrix3fv",
+    "glUniformMatrix4fv",
+    "glValidateProgram",
+    "glVertexAttrib1d",
+    "glVertexAttrib1dv",
+    "glVertexAttrib1f",
+    "glVertexAttrib1fv",
+    "glVertexAttrib1s",
+    "glVertexAttrib1sv",
+    "glVertexAttrib2d",
+    "glVertexAttrib2dv",
+    "glVertexAttrib2f",
+    "glVertexAttrib2fv",
+    "glVertexAttrib2s",
+    "glVertexAttrib2sv",
+    "glVertexAttrib3d",
+    "glVertexAttrib3dv",
+    "glVertexAttrib3f",
+    "glVertexAttrib3fv",
+    "glVertexAttrib3s",
+    "glVertexAttrib3sv",
+    "glVertexAttrib4Nbv",
+    "glVertexAttrib4Niv",
+    "glVertexAttrib4Nsv",
+    "glVertexAttrib4Nub",
+    "glVertexAttrib4Nubv",
+    "glVertexAttrib4Nuiv",
+    "glVertexAttrib4Nusv",
+    "glVertexAttrib4bv",
+    "glVertexAttrib4d",
+    "glVertexAttrib4dv",
+    "glVertexAttrib4f",
+    "glVertexAttrib4fv",
+    "glVertexAttrib4iv",
+    "glVertexAttrib4s",
+    "glVertexAttrib4sv",
+    "glVertexAttrib4ubv",
+    "glVertexAttrib4uiv",
+    "glVertexAttrib4usv",
+    "glVertexAttribPointer",
+    "glUniformMatrix2x3fv",
+    "glUniformMatrix3x2fv",
+    "glUniformMatrix2x4fv",
+    "glUniformMatrix4x2fv",
+    "glUniformMatrix3x4fv",
+    "glUniformMatrix4x3fv",
+    "glColorMaski",
+    "glGetBooleani_v",
+    "glGetIntegeri_v",
+    "glEnablei",
+    "glDisablei",
+    "glIsEnabledi",
+    "glBeginTransformFeedback",
+    "glEndTransformFeedback",
+    "glBindBufferRange",
+    "glBindBufferBase",
+    "glTransformFeedbackVaryings",
+    "glGetTransformFeedbackVarying",
+    "glClampColor",
+    "glBeginConditionalRender",
+    "glEndConditionalRender",
+    "glVertexAttribIPointer",
+    "glGetVertexAttribIiv",
+    "glGetVertexAttribIuiv",
+    "glVertexAttribI1i",
+    "glVertexAttribI2i",
+    "glVertexAttribI3i",
+    "glVertexAttribI4i",
+    "glVertexAttribI1ui",
+    "glVertexAttribI2ui",
+    "glVertexAttribI3ui",
+    "glVertexAttribI4ui",
+    "glVertexAttribI1iv",
+    "glVertexAttribI2iv",
+    "glVertexAttribI3iv",
+    "glVertexAttribI4iv",
+    "glVertexAttribI1uiv",
+    "glVertexAttribI2uiv",
+    "glVertexAttribI3uiv",
+    "glVertexAttribI4uiv",
+    "glVertexAttribI4bv",
+    "glVertexAttribI4sv",
+    "glVertexAttribI4ubv",
+    "glVertexAttribI4usv",
+    "glGetUniformuiv",
+    "glBindFragDataLocation",
+    "glGetFragDataLocation",
+    "glUniform1ui",
+    "glUniform2ui",
+    "glUniform3ui",
+    "glUniform4ui",
+    "glUniform1uiv",
+    "glUniform2uiv",
+    "glUniform3uiv",
+    "glUniform4uiv",
+    "glTexParameterIiv",
+    "glTexParameterIuiv",
+    "glGetTexParameterIiv",
+    "glGetTexParameterIuiv",
+    "glClearBufferiv",
+    "glClearBufferuiv",
+    "glClearBufferfv",
+    "glClearBufferfi",
+    "glGetStringi",
+    "glIsRenderbuffer",
+    "glBindRenderbuffer",
+    "glDeleteRenderbuffers",
+    "glGenRenderbuffers",
+    "glRenderbufferStorage",
+    "glGetRenderbufferParameteriv",
+    "glIsFramebuffer",
+    "glBindFramebuffer",
+    "glDeleteFramebuffers",
+    "glGenFramebuffers",
+    "glCheckFramebufferStatus",
+    "glFramebufferTexture1D",
+    "glFramebufferTexture2D",
+    "glFramebufferTexture3D",
+    "glFramebufferRenderbuffer",
+    "glGetFramebufferAttachmentParameteriv",
+    "glGenerateMipmap",
+    "glBlitFramebuffer",
+    "glRenderbufferStorageMultisample",
+    "glFramebufferTextureLayer",
+    "glMapBufferRange",
+    "glFlushMappedBufferRange",
+    "glBindVertexArray",
+    "glDeleteVertexArrays",
+    "glGenVertexArrays",
+    "glIsVertexArray",
+    "glDrawArraysInstanced",
+    "glDrawElementsInstanced",
+    "glTexBuffer",
+    "glPrimitiveRestartIndex",
+    "glCopyBufferSubData",
+    "glGetUniformIndices",
+    "glGetActiveUniformsiv",
+    "glGetActiveUniformName",
+    "glGetUniformBlockIndex",
+    "glGetActiveUniformBlockiv",
+    "glGetActiveUniformBlockName",
+    "glUniformBlockBinding",
+    "glDrawElementsBaseVertex",
+    "glDrawRangeElementsBaseVertex",
+    "glDrawElementsInstancedBaseVertex",
+    "glMultiDrawElementsBaseVertex",
+    "glProvokingVertex",
+    "glFenceSync",
+    "glIsSync",
+    "glDeleteSync",
+    "glClientWaitSync",
+    "glWaitSync",
+    "glGetInteger64v",
+    "glGetSynciv",
+    "glGetInteger64i_v",
+    "glGetBufferParameteri64v",
+    "glFramebufferTexture",
+    "glTexImage2DMultisample",
+    "glTexImage3DMultisample",
+    "glGetMultisamplefv",
+    "glSampleMaski",
+    "glBindFragDataLocationIndexed",
+    "glGetFragDataIndex",
+    "glGenSamplers",
+    "glDeleteSamplers",
+    "glIsSampler",
+    "glBindSampler",
+    "glSamplerParameteri",
+    "glSamplerParameteriv",
+    "glSamplerParameterf",
+    "glSamplerParameterfv",
+    "glSamplerParameterIiv",
+    "glSamplerParameterIuiv",
+    "glGetSamplerParameteriv",
+    "glGetSamplerParameterIiv",
+    "glGetSamplerParameterfv",
+    "glGetSamplerParameterIuiv",
+    "glQueryCounter",
+    "glGetQueryObjecti64v",
+    "glGetQueryObjectui64v",
+    "glVertexAttribDivisor",
+    "glVertexAttribP1ui",
+    "glVertexAttribP1uiv",
+    "glVertexAttribP2ui",
+    "glVertexAttribP2uiv",
+    "glVertexAttribP3ui",
+    "glVertexAttribP3uiv",
+    "glVertexAttribP4ui",
+    "glVertexAttribP4uiv",
+    "glMinSampleShading",
+    "glBlendEquationi",
+    "glBlendEquationSeparatei",
+    "glBlendFunci",
+    "glBlendFuncSeparatei",
+    "glDrawArraysIndirect",
+    "glDrawElementsIndirect",
+    "glUniform1d",
+    "glUniform2d",
+    "glUniform3d",
+    "glUniform4d",
+    "glUniform1dv",
+    "glUniform2dv",
+    "glUniform3dv",
+    "glUniform4dv",
+    "glUniformMatrix2dv",
+    "glUniformMatrix3dv",
+    "glUniformMatrix4dv",
+    "glUniformMatrix2x3dv",
+    "glUniformMatrix2x4dv",
+    "glUniformMatrix3x2dv",
+    "glUniformMatrix3x4dv",
+    "glUniformMatrix4x2dv",
+    "glUniformMatrix4x3dv",
+    "glGetUniformdv",
+    "glGetSubroutineUniformLocation",
+    "glGetSubroutineIndex",
+    "glGetActiveSubroutineUniformiv",
+    "glGetActiveSubroutineUniformName",
+    "glGetActiveSubroutineName",
+    "glUniformSubroutinesuiv",
+    "glGetUniformSubroutineuiv",
+    "glGetProgramStageiv",
+    "glPatchParameteri",
+    "glPatchParameterfv",
+    "glBindTransformFeedback",
+    "glDeleteTransformFeedbacks",
+    "glGenTransformFeedbacks",
+    "glIsTransformFeedback",
+    "glPauseTransformFeedback",
+    "glResumeTransformFeedback",
+    "glDrawTransformFeedback",
+    "glDrawTransformFeedbackStream",
+    "glBeginQueryIndexed",
+    "glEndQueryIndexed",
+    "glGetQueryIndexediv",
+    "glReleaseShaderCompiler",
+    "glShaderBinary",
+    "glGetShaderPrecisionFormat",
+    "glDepthRangef",
+    "glClearDepthf",
+    "glGetProgramBinary",
+    "glProgramBinary",
+    "glProgramParameteri",
+    "glUseProgramStages",
+    "glActiveShaderProgram",
+    "glCreateShaderProgramv",
+    "glBindProgramPipeline",
+    "glDeleteProgramPipelines",
+    "glGenProgramPipelines",
+    "glIsProgramPipeline",
+    "glGetProgramPipelineiv",
+    "glProgramUniform1i",
+    "glProgramUniform1iv",
+    "glProgramUniform1f",
+    "glProgramUniform1fv",
+    "glProgramUniform1d",
+    "glProgramUniform1dv",
+    "glProgramUniform1ui",
+    "glProgramUniform1uiv",
+    "glProgramUniform2i",
+    "glProgramUniform2iv",
+    "glProgramUniform2f",
+    "glProgramUniform2fv",
+    "glProgramUniform2d",
+    "glProgramUniform2dv",
+    "glProgramUniform2ui",
+    "glProgramUniform2uiv",
+    "glProgramUniform3i",
+    "glProgramUniform3iv",
+    "glProgramUniform3f",
+    "glProgramUniform3fv",
+    "glProgramUniform3d",
+    "glProgramUniform3dv",
+    "glProgramUniform3ui",
+    "glProgramUniform3uiv",
+    "glProgramUniform4i",
+    "glProgramUniform4iv",
+    "glProgramUniform4f",
+    "glProgramUniform4fv",
+    "glProgramUniform4d",
+    "glProgramUniform4dv",
+    "glProgramUniform4ui",
+    "glProgramUniform4uiv",
+    "glProgramUniformMatrix2fv",
+    "glProgramUniformMatrix3fv",
+    "glProgramUniformMatrix4fv",
+    "glProgramUniformMatrix2dv",
+    "glProgramUniformMatrix3dv",
+    "glProgramUniformMatrix4dv",
+    "glProgramUniformMatrix2x3fv",
+    "glProgramUniformMatrix3x2fv",
+    "glProgramUniformMatrix2x4fv",
+    "glProgramUniformMatrix4x2fv",
+    "glProgramUniformMatrix3x4fv",
+    "glProgramUniformMatrix4x3fv",
+    "glProgramUniformMatrix2x3dv",
+    "glProgramUniformMatrix3x2dv",
+    "glProgramUniformMatrix2x4dv",
+    "glProgramUniformMatrix4x2dv",
+    "glProgramUniformMatrix3x4dv",
+    "glProgramUniformMatrix4x3dv",
+    "glValidateProgramPipeline",
+    "glGetProgramPipelineInfoLog",
+    "glVertexAttribL1d",
+    "glVertexAttribL2d",
+    "glVertexAttribL3d",
+    "glVertexAttribL4d",
+    "glVertexAttribL1dv",
+    "glVertexAttribL2dv",
+    "glVertexAttribL3dv",
+    "glVertexAttribL4dv",
+    "glVertexAttribLPointer",
+    "glGetVertexAttribLdv",
+    "glViewportArrayv",
+    "glViewportIndexedf",
+    "glViewportIndexedfv",
+    "glScissorArrayv",
+    "glScissorIndexed",
+    "glScissorIndexedv",
+    "glDepthRangeArrayv",
+    "glDepthRangeIndexed",
+    "glGetFloati_v",
+    "glGetDoublei_v",
+    "glDrawArraysInstancedBaseInstance",
+    "glDrawElementsInstancedBaseInstance",
+    "glDrawElementsInstancedBaseVertexBaseInstance",
+    "glGetInternalformativ",
+    "glGetActiveAtomicCounterBufferiv",
+    "glBindImageTexture",
+    "glMemoryBarrier",
+    "glTexStorage1D",
+    "glTexStorage2D",
+    "glTexStorage3D",
+    "glDrawTransformFeedbackInstanced",
+    "glDrawTransformFeedbackStreamInstanced",
+    "glClearBufferData",
+    "glClearBufferSubData",
+    "glDispatchCompute",
+    "glDispatchComputeIndirect",
+    "glCopyImageSubData",
+    "glFramebufferParameteri",
+    "glGetFramebufferParameteriv",
+    "glGetInternalformati64v",
+    "glInvalidateTexSubImage",
+    "glInvalidateTexImage",
+    "glInvalidateBufferSubData",
+    "glInvalidateBufferData",
+    "glInvalidateFramebuffer",
+    "glInvalidateSubFramebuffer",
+    "glMultiDrawArraysIndirect",
+    "glMultiDrawElementsIndirect",
+    "glGetProgramInterfaceiv",
+    "glGetProgramResourceIndex",
+    "glGetProgramResourceName",
+    "glGetProgramResourceiv",
+    "glGetProgramResourceLocation",
+    "glGetProgramResourceLocationIndex",
+    "glShaderStorageBlockBinding",
+    "glTexBufferRange",
+    "glTexStorage2DMultisample",
+    "glTexStorage3DMultisample",
+    "glTextureView",
+    "glBindVertexBuffer",
+    "glVertexAttribFormat",
+    "glVertexAttribIFormat",
+    "glVertexAttribLFormat",
+    "glVertexAttribBinding",
+    "glVertexBindingDivisor",
+    "glDebugMessageControl",
+    "glDebugMessageInsert",
+    "glDebugMessageCallback",
+    "glGetDebugMessageLog",
+    "glPushDebugGroup",
+    "glPopDebugGroup",
+    "glObjectLabel",
+    "glGetObjectLabel",
+    "glObjectPtrLabel",
+    "glGetObjectPtrLabel",
+    "glBufferStorage",
+    "glClearTexImage",
+    "glClearTexSubImage",
+    "glBindBuffersBase",
+    "glBindBuffersRange",
+    "glBindTextures",
+    "glBindSamplers",
+    "glBindImageTextures",
+    "glBindVertexBuffers",
+    "glClipControl",
+    "glCreateTransformFeedbacks",
+    "glTransformFeedbackBufferBase",
+    "glTransformFeedbackBufferRange",
+    "glGetTransformFeedbackiv",
+    "glGetTransformFeedbacki_v",
+    "glGetTransformFeedbacki64_v",
+    "glCreateBuffers",
+    "glNamedBufferStorage",
+    "glNamedBufferData",
+    "glNamedBufferSubData",
+    "glCopyNamedBufferSubData",
+    "glClearNamedBufferData",
+    "glClearNamedBufferSubData",
+    "glMapNamedBuffer",
+    "glMapNamedBufferRange",
+    "glUnmapNamedBuffer",
+    "glFlushMappedNamedBufferRange",
+    "glGetNamedBufferParameteriv",
+    "glGetNamedBufferParameteri64v",
+    "glGetNamedBufferPointerv",
+    "glGetNamedBufferSubData",
+    "glCreateFramebuffers",
+    "glNamedFramebufferRenderbuffer",
+    "glNamedFramebufferParameteri",
+    "glNamedFramebufferTexture",
+    "glNamedFramebufferTextureLayer",
+    "glNamedFramebufferDrawBuffer",
+    "glNamedFramebufferDrawBuffers",
+    "glNamedFramebufferReadBuffer",
+    "glInvalidateNamedFramebufferData",
+    "glInvalidateNamedFramebufferSubData",
+    "glClearNamedFramebufferiv",
+    "glClearNamedFramebufferuiv",
+    "glClearNamedFramebufferfv",
+    "glClearNamedFramebufferfi",
+    "glBlitNamedFramebuffer",
+    "glCheckNamedFramebufferStatus",
+    "glGetNamedFramebufferParameteriv",
+    "glGetNamedFramebufferAttachmentParameteriv",
+    "glCreateRenderbuffers",
+    "glNamedRenderbufferStorage",
+    "glNamedRenderbufferStorageMultisample",
+    "glGetNamedRenderbufferParameteriv",
+    "glCreateTextures",
+    "glTextureBuffer",
+    "glTextureBufferRange",
+    "glTextureStorage1D",
+    "glTextureStorage2D",
+    "glTextureStorage3D",
+    "glTextureStorage2DMultisample",
+    "glTextureStorage3DMultisample",
+    "glTextureSubImage1D",
+    "glTextureSubImage2D",
+    "glTextureSubImage3D",
+    "glCompressedTextureSubImage1D",
+    "glCompressedTextureSubImage2D",
+    "glCompressedTextureSubImage3D",
+    "glCopyTextureSubImage1D",
+    "glCopyTextureSubImage2D",
+    "glCopyTextureSubImage3D",
+    "glTextureParameterf",
+    "glTextureParameterfv",
+    "glTextureParameteri",
+    "glTextureParameterIiv",
+    "glTextureParameterIuiv",
+    "glTextureParameteriv",
+    "glGenerateTextureMipmap",
+    "glBindTextureUnit",
+    "glGetTextureImage",
+    "glGetCompressedTextureImage",
+    "glGetTextureLevelParameterfv",
+    "glGetTextureLevelParameteriv",
+    "glGetTextureParameterfv",
+    "glGetTextureParameterIiv",
+    "glGetTextureParameterIuiv",
+    "glGetTextureParameteriv",
+    "glCreateVertexArrays",
+    "glDisableVertexArrayAttrib",
+    "glEnableVertexArrayAttrib",
+    "glVertexArrayElementBuffer",
+    "glVertexArrayVertexBuffer",
+    "glVertexArrayVertexBuffers",
+    "glVertexArrayAttribBinding",
+    "glVertexArrayAttribFormat",
+    "glVertexArrayAttribIFormat",
+    "glVertexArrayAttribLFormat",
+    "glVertexArrayBindingDivisor",
+    "glGetVertexArrayiv",
+    "glGetVertexArrayIndexediv",
+    "glGetVertexArrayIndexed64iv",
+    "glCreateSamplers",
+    "glCreateProgramPipelines",
+    "glCreateQueries",
+    "glGetQueryBufferObjecti64v",
+    "glGetQueryBufferObjectiv",
+    "glGetQueryBufferObjectui64v",
+    "glGetQueryBufferObjectuiv",
+    "glMemoryBarrierByRegion",
+    "glGetTextureSubImage",
+    "glGetCompressedTextureSubImage",
+    "glGetGraphicsResetStatus",
+    "glGetnCompressedTexImage",
+    "glGetnTexImage",
+    "glGetnUniformdv",
+    "glGetnUniformfv",
+    "glGetnUniformiv",
+    "glGetnUniformuiv",
+    "glReadnPixels",
+    "glTextureBarrier",
+    "glGetTextureHandleARB",
+    "glGetTextureSamplerHandleARB",
+    "glMakeTextureHandleResidentARB",
+    "glMakeTextureHandleNonResidentARB",
+    "glGetImageHandleARB",
+    "glMakeImageHandleResidentARB",
+    "glMakeImageHandleNonResidentARB",
+    "glUniformHandleui64ARB",
+    "glUniformHandleui64vARB",
+    "glProgramUniformHandleui64ARB",
+    "glProgramUniformHandleui64vARB",
+    "glIsTextureHandleResidentARB",
+    "glIsImageHandleResidentARB",
+    "glVertexAttribL1ui64ARB",
+    "glVertexAttribL1ui64vARB",
+    "glGetVertexAttribLui64vARB",
+    "glCreateSyncFromCLeventARB",
+    "glDispatchComputeGroupSizeARB",
+    "glDebugMessageControlARB",
+    "glDebugMessageInsertARB",
+    "glDebugMessageCallbackARB",
+    "glGetDebugMessageLogARB",
+    "glBlendEquationiARB",
+    "glBlendEquationSeparateiARB",
+    "glBlendFunciARB",
+    "glBlendFuncSeparateiARB",
+    "glMultiDrawArraysIndirectCountARB",
+    "glMultiDrawElementsIndirectCountARB",
+    "glGetGraphicsResetStatusARB",
+    "glGetnTexImageARB",
+    "glReadnPixelsARB",
+    "glGetnCompressedTexImageARB",
+    "glGetnUniformfvARB",
+    "glGetnUniformivARB",
+    "glGetnUniformuivARB",
+    "glGetnUniformdvARB",
+    "glMinSampleShadingARB",
+    "glNamedStringARB",
+    "glDeleteNamedStringARB",
+    "glCompileShaderIncludeARB",
+    "glIsNamedStringARB",
+    "glGetNamedStringARB",
+    "glGetNamedStringivARB",
+    "glBufferPageCommitmentARB",
+    "glNamedBufferPageCommitmentEXT",
+    "glNamedBufferPageCommitmentARB",
+    "glTexPageCommitmentARB",
+    "glGetMultisamplefvNV",
+    "glSampleMaskIndexedNV",
+    "glTexRenderbufferNV",
+    "glMakeBufferResidentNV",
+    "glMakeBufferNonResidentNV",
+    "glIsBufferResidentNV",
+    "glMakeNamedBufferResidentNV",
+    "glMakeNamedBufferNonResidentNV",
+    "glIsNamedBufferResidentNV",
+    "glGetBufferParameterui64vNV",
+    "glGetNamedBufferParameterui64vNV",
+    "glGetIntegerui64vNV",
+    "glUniformui64NV",
+    "glUniformui64vNV",
+    "glProgramUniformui64NV",
+    "glProgramUniformui64vNV",
+    "glBufferAddressRangeNV",
+    "glVertexFormatNV",
+    "glNormalFormatNV",
+    "glColorFormatNV",
+    "glIndexFormatNV",
+    "glTexCoordFormatNV",
+    "glEdgeFlagFormatNV",
+    "glSecondaryColorFormatNV",
+    "glFogCoordFormatNV",
+    "glVertexAttribFormatNV",
+    "glVertexAttribIFormatNV",
+    "glGetIntegerui64i_vNV",
+    "glEnableClientState",
+    "glDisableClientState",
+};
+
+static void APIENTRY Trace_CullFace (GLenum mode)
+{
+    TraceRecord record (0, 1);
+    record.Arg (mode);
+    TraceNext ().CullFace (mode);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_FrontFace (GLenum mode)
+{
+    TraceRecord record (1, 1);
+    record.Arg (mode);
+    TraceNext ().FrontFace (mode);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Hint (GLenum target, GLenum mode)
+{
+    TraceRecord record (2, 2);
+    record.Arg (target);
+    record.Arg (mode);
+    TraceNext ().Hint (target, mode);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_LineWidth (GLfloat width)
+{
+    TraceRecord record (3, 1);
+    record.Arg (width);
+    TraceNext ().LineWidth (width);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_PointSize (GLfloat size)
+{
+    TraceRecord record (4, 1);
+    record.Arg (size);
+    TraceNext ().PointSize (size);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_PolygonMode (GLenum face, GLenum mode)
+{
+    TraceRecord record (5, 2);
+    record.Arg (face);
+    record.Arg (mode);
+    TraceNext ().PolygonMode (face, mode);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Scissor (GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    TraceRecord record (6, 4);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (width);
+    record.Arg (height);
+    TraceNext ().Scissor (x, y, width, height);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TexParameterf (GLenum target, GLenum pname, GLfloat param)
+{
+    TraceRecord record (7, 3);
+    record.Arg (target);
+    record.Arg (pname);
+    record.Arg (param);
+    TraceNext ().TexParameterf (target, pname, param);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TexParameterfv (GLenum target, GLenum pname, const GLfloat *params)
+{
+    TraceRecord record (8, 3);
+    record.Arg (target);
+    record.Arg (pname);
+    record.Arg (params);
+    record.Blob (2, params, TraceParameterCount (pname) * sizeof (GLfloat));
+    TraceNext ().TexParameterfv (target, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TexParameteri (GLenum target, GLenum pname, GLint param)
+{
+    TraceRecord record (9, 3);
+    record.Arg (target);
+    record.Arg (pname);
+    record.Arg (param);
+    TraceNext ().TexParameteri (target, pname, param);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TexParameteriv (GLenum target, GLenum pname, const GLint *params)
+{
+    TraceRecord record (10, 3);
+    record.Arg (target);
+    record.Arg (pname);
+    record.Arg (params);
+    record.Blob (2, params, TraceParameterCount (pname) * sizeof (GLint));
+    TraceNext ().TexParameteriv (target, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TexImage1D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    TraceRecord record (11, 8);
+    record.Arg (target);
+    record.Arg (level);
+    record.Arg (internalformat);
+    record.Arg (width);
+    record.Arg (border);
+    record.Arg (format);
+    record.Arg (type);
+    record.Arg (pixels);
+    record.Image (7, pixels, format, type, width, 1, 1);
+    TraceNext ().TexImage1D (target, level, internalformat, width, border, format, type, pixels);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TexImage2D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    TraceRecord record (12, 9);
+    record.Arg (target);
+    record.Arg (level);
+    record.Arg (internalformat);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (border);
+    record.Arg (format);
+    record.Arg (type);
+    record.Arg (pixels);
+    record.Image (8, pixels, format, type, width, height, 1);
+    TraceNext ().TexImage2D (target, level, internalformat, width, height, border, format, type, pixels);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DrawBuffer (GLenum buf)
+{
+    TraceRecord record (13, 1);
+    record.Arg (buf);
+    TraceNext ().DrawBuffer (buf);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Clear (GLbitfield mask)
+{
+    TraceRecord record (14, 1);
+    record.Arg (mask);
+    TraceNext ().Clear (mask);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ClearColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    TraceRecord record (15, 4);
+    record.Arg (red);
+    record.Arg (green);
+    record.Arg (blue);
+    record.Arg (alpha);
+    TraceNext ().ClearColor (red, green, blue, alpha);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ClearStencil (GLint s)
+{
+    TraceRecord record (16, 1);
+    record.Arg (s);
+    TraceNext ().ClearStencil (s);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ClearDepth (GLdouble depth)
+{
+    TraceRecord record (17, 1);
+    record.Arg (depth);
+    TraceNext ().ClearDepth (depth);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_StencilMask (GLuint mask)
+{
+    TraceRecord record (18, 1);
+    record.Arg (mask);
+    TraceNext ().StencilMask (mask);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ColorMask (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+    TraceRecord record (19, 4);
+    record.Arg (red);
+    record.Arg (green);
+    record.Arg (blue);
+    record.Arg (alpha);
+    TraceNext ().ColorMask (red, green, blue, alpha);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DepthMask (GLboolean flag)
+{
+    TraceRecord record (20, 1);
+    record.Arg (flag);
+    TraceNext ().DepthMask (flag);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Disable (GLenum cap)
+{
+    TraceRecord record (21, 1);
+    record.Arg (cap);
+    TraceNext ().Disable (cap);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Enable (GLenum cap)
+{
+    TraceRecord record (22, 1);
+    record.Arg (cap);
+    TraceNext ().Enable (cap);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Finish (void)
+{
+    TraceRecord record (23, 0);
+    TraceNext ().Finish ();
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Flush (void)
+{
+    TraceRecord record (24, 0);
+    TraceNext ().Flush ();
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BlendFunc (GLenum sfactor, GLenum dfactor)
+{
+    TraceRecord record (25, 2);
+    record.Arg (sfactor);
+    record.Arg (dfactor);
+    TraceNext ().BlendFunc (sfactor, dfactor);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_LogicOp (GLenum opcode)
+{
+    TraceRecord record (26, 1);
+    record.Arg (opcode);
+    TraceNext ().LogicOp (opcode);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_StencilFunc (GLenum func, GLint ref, GLuint mask)
+{
+    TraceRecord record (27, 3);
+    record.Arg (func);
+    record.Arg (ref);
+    record.Arg (mask);
+    TraceNext ().StencilFunc (func, ref, mask);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_StencilOp (GLenum fail, GLenum zfail, GLenum zpass)
+{
+    TraceRecord record (28, 3);
+    record.Arg (fail);
+    record.Arg (zfail);
+    record.Arg (zpass);
+    TraceNext ().StencilOp (fail, zfail, zpass);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DepthFunc (GLenum func)
+{
+    TraceRecord record (29, 1);
+    record.Arg (func);
+    TraceNext ().DepthFunc (func);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_PixelStoref (GLenum pname, GLfloat param)
+{
+    TraceRecord record (30, 2);
+    record.Arg (pname);
+    record.Arg (param);
+    TraceNext ().PixelStoref (pname, param);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_PixelStorei (GLenum pname, GLint param)
+{
+    TraceRecord record (31, 2);
+    record.Arg (pname);
+    record.Arg (param);
+    TraceNext ().PixelStorei (pname, param);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ReadBuffer (GLenum src)
+{
+    TraceRecord record (32, 1);
+    record.Arg (src);
+    TraceNext ().ReadBuffer (src);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ReadPixels (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels)
+{
+    TraceRecord record (33, 7);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (format);
+    record.Arg (type);
+    record.Arg (pixels);
+    TraceNext ().ReadPixels (x, y, width, height, format, type, pixels);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetBooleanv (GLenum pname, GLboolean *data)
+{
+    TraceRecord record (34, 2);
+    record.Arg (pname);
+    record.Arg (data);
+    TraceNext ().GetBooleanv (pname, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetDoublev (GLenum pname, GLdouble *data)
+{
+    TraceRecord record (35, 2);
+    record.Arg (pname);
+    record.Arg (data);
+    TraceNext ().GetDoublev (pname, data);
+    record.Commit ();
+}
+
+static GLenum APIENTRY Trace_GetError (void)
+{
+    TraceRecord record (36, 0);
+    GLenum result = TraceNext ().GetError ();
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_GetFloatv (GLenum pname, GLfloat *data)
+{
+    TraceRecord record (37, 2);
+    record.Arg (pname);
+    record.Arg (data);
+    TraceNext ().GetFloatv (pname, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetIntegerv (GLenum pname, GLint *data)
+{
+    TraceRecord record (38, 2);
+    record.Arg (pname);
+    record.Arg (data);
+    TraceNext ().GetIntegerv (pname, data);
+    record.Commit ();
+}
+
+static const GLubyte * APIENTRY Trace_GetString (GLenum name)
+{
+    TraceRecord record (39, 1);
+    record.Arg (name);
+    const GLubyte * result = TraceNext ().GetString (name);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_GetTexImage (GLenum target, GLint level, GLenum format, GLenum type, void *pixels)
+{
+    TraceRecord record (40, 5);
+    record.Arg (target);
+    record.Arg (level);
+    record.Arg (format);
+    record.Arg (type);
+    record.Arg (pixels);
+    TraceNext ().GetTexImage (target, level, format, type, pixels);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetTexParameterfv (GLenum target, GLenum pname, GLfloat *params)
+{
+    TraceRecord record (41, 3);
+    record.Arg (target);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetTexParameterfv (target, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetTexParameteriv (GLenum target, GLenum pname, GLint *params)
+{
+    TraceRecord record (42, 3);
+    record.Arg (target);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetTexParameteriv (target, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetTexLevelParameterfv (GLenum target, GLint level, GLenum pname, GLfloat *params)
+{
+    TraceRecord record (43, 4);
+    record.Arg (target);
+    record.Arg (level);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetTexLevelParameterfv (target, level, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetTexLevelParameteriv (GLenum target, GLint level, GLenum pname, GLint *params)
+{
+    TraceRecord record (44, 4);
+    record.Arg (target);
+    record.Arg (level);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetTexLevelParameteriv (target, level, pname, params);
+    record.Commit ();
+}
+
+static GLboolean APIENTRY Trace_IsEnabled (GLenum cap)
+{
+    TraceRecord record (45, 1);
+    record.Arg (cap);
+    GLboolean result = TraceNext ().IsEnabled (cap);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_DepthRange (GLdouble near, GLdouble far)
+{
+    TraceRecord record (46, 2);
+    record.Arg (near);
+    record.Arg (far);
+    TraceNext ().DepthRange (near, far);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Viewport (GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    TraceRecord record (47, 4);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (width);
+    record.Arg (height);
+    TraceNext ().Viewport (x, y, width, height);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DrawArrays (GLenum mode, GLint first, GLsizei count)
+{
+    TraceRecord record (48, 3);
+    record.Arg (mode);
+    record.Arg (first);
+    record.Arg (count);
+    TraceNext ().DrawArrays (mode, first, count);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DrawElements (GLenum mode, GLsizei count, GLenum type, const void *indices)
+{
+    TraceRecord record (49, 4);
+    record.Arg (mode);
+    record.Arg (count);
+    record.Arg (type);
+    record.Arg (indices);
+    TraceNext ().DrawElements (mode, count, type, indices);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetPointerv (GLenum pname, void **params)
+{
+    TraceRecord record (50, 2);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetPointerv (pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_PolygonOffset (GLfloat factor, GLfloat units)
+{
+    TraceRecord record (51, 2);
+    record.Arg (factor);
+    record.Arg (units);
+    TraceNext ().PolygonOffset (factor, units);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CopyTexImage1D (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+{
+    TraceRecord record (52, 7);
+    record.Arg (target);
+    record.Arg (level);
+    record.Arg (internalformat);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (width);
+    record.Arg (border);
+    TraceNext ().CopyTexImage1D (target, level, internalformat, x, y, width, border);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CopyTexImage2D (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+{
+    TraceRecord record (53, 8);
+    record.Arg (target);
+    record.Arg (level);
+    record.Arg (internalformat);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (border);
+    TraceNext ().CopyTexImage2D (target, level, internalformat, x, y, width, height, border);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CopyTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+    TraceRecord record (54, 6);
+    record.Arg (target);
+    record.Arg (level);
+    record.Arg (xoffset);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (width);
+    TraceNext ().CopyTexSubImage1D (target, level, xoffset, x, y, width);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CopyTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    TraceRecord record (55, 8);
+    record.Arg (target);
+    record.Arg (level);
+    record.Arg (xoffset);
+    record.Arg (yoffset);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (width);
+    record.Arg (height);
+    TraceNext ().CopyTexSubImage2D (target, level, xoffset, yoffset, x, y, width, height);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TexSubImage1D (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels)
+{
+    TraceRecord record (56, 7);
+    record.Arg (target);
+    record.Arg (level);
+    record.Arg (xoffset);
+    record.Arg (width);
+    record.Arg (format);
+    record.Arg (type);
+    record.Arg (pixels);
+    record.Image (6, pixels, format, type, width, 1, 1);
+    TraceNext ().TexSubImage1D (target, level, xoffset, width, format, type, pixels);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+    TraceRecord record (57, 9);
+    record.Arg (target);
+    record.Arg (level);
+    record.Arg (xoffset);
+    record.Arg (yoffset);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (format);
+    record.Arg (type);
+    record.Arg (pixels);
+    record.Image (8, pixels, format, type, width, height, 1);
+    TraceNext ().TexSubImage2D (target, level, xoffset, yoffset, width, height, format, type, pixels);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BindTexture (GLenum target, GLuint texture)
+{
+    TraceRecord record (58, 2);
+    record.Arg (target);
+    record.Arg (texture);
+    TraceNext ().BindTexture (target, texture);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DeleteTextures (GLsizei n, const GLuint *textures)
+{
+    TraceRecord record (59, 2);
+    record.Arg (n);
+    record.Arg (textures);
+    record.Blob (1, textures, n * sizeof (GLuint));
+    TraceNext ().DeleteTextures (n, textures);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GenTextures (GLsizei n, GLuint *textures)
+{
+    TraceRecord record (60, 2);
+    record.Arg (n);
+    record.Arg (textures);
+    TraceNext ().GenTextures (n, textures);
+    record.Blob (1, textures, n * sizeof (GLuint), true);
+    record.Commit ();
+}
+
+static GLboolean APIENTRY Trace_IsTexture (GLuint texture)
+{
+    TraceRecord record (61, 1);
+    record.Arg (texture);
+    GLboolean result = TraceNext ().IsTexture (texture);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_DrawRangeElements (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices)
+{
+    TraceRecord record (62, 6);
+    record.Arg (mode);
+    record.Arg (start);
+    record.Arg (end);
+    record.Arg (count);
+    record.Arg (type);
+    record.Arg (indices);
+    TraceNext ().DrawRangeElements (mode, start, end, count, type, indices);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TexImage3D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    TraceRecord record (63, 10);
+    record.Arg (target);
+    record.Arg (level);
+    record.Arg (internalformat);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (depth);
+    record.Arg (border);
+    record.Arg (format);
+    record.Arg (type);
+    record.Arg (pixels);
+    record.Image (9, pixels, format, type, width, height, depth);
+    TraceNext ().TexImage3D (target, level, internalformat, width, height, depth, border, format, type, pixels);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels)
+{
+    TraceRecord record (64, 11);
+    record.Arg (target);
+    record.Arg (level);
+    record.Arg (xoffset);
+    record.Arg (yoffset);
+    record.Arg (zoffset);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (depth);
+    record.Arg (format);
+    record.Arg (type);
+    record.Arg (pixels);
+    record.Image (10, pixels, format, type, width, height, depth);
+    TraceNext ().TexSubImage3D (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CopyTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    TraceRecord record (65, 9);
+    record.Arg (target);
+    record.Arg (level);
+    record.Arg (xoffset);
+    record.Arg (yoffset);
+    record.Arg (zoffset);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (width);
+    record.Arg (height);
+    TraceNext ().CopyTexSubImage3D (target, level, xoffset, yoffset, zoffset, x, y, width, height);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ActiveTexture (GLenum texture)
+{
+    TraceRecord record (66, 1);
+    record.Arg (texture);
+    TraceNext ().ActiveTexture (texture);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_SampleCoverage (GLfloat value, GLboolean invert)
+{
+    TraceRecord record (67, 2);
+    record.Arg (value);
+    record.Arg (invert);
+    TraceNext ().SampleCoverage (value, invert);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CompressedTexImage3D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data)
+{
+    TraceRecord record (68, 9);
+    record.Arg (target);
+    record.Arg (level);
+    record.Arg (internalformat);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (depth);
+    record.Arg (border);
+    record.Arg (imageSize);
+    record.Arg (data);
+    record.Pixels (8, data, imageSize);
+    TraceNext ().CompressedTexImage3D (target, level, internalformat, width, height, depth, border, imageSize, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CompressedTexImage2D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data)
+{
+    TraceRecord record (69, 8);
+    record.Arg (target);
+    record.Arg (level);
+    record.Arg (internalformat);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (border);
+    record.Arg (imageSize);
+    record.Arg (data);
+    record.Pixels (7, data, imageSize);
+    TraceNext ().CompressedTexImage2D (target, level, internalformat, width, height, border, imageSize, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CompressedTexImage1D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data)
+{
+    TraceRecord record (70, 7);
+    record.Arg (target);
+    record.Arg (level);
+    record.Arg (internalformat);
+    record.Arg (width);
+    record.Arg (border);
+    record.Arg (imageSize);
+    record.Arg (data);
+    record.Pixels (6, data, imageSize);
+    TraceNext ().CompressedTexImage1D (target, level, internalformat, width, border, imageSize, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CompressedTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+{
+    TraceRecord record (71, 11);
+    record.Arg (target);
+    record.Arg (level);
+    record.Arg (xoffset);
+    record.Arg (yoffset);
+    record.Arg (zoffset);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (depth);
+    record.Arg (format);
+    record.Arg (imageSize);
+    record.Arg (data);
+    record.Pixels (10, data, imageSize);
+    TraceNext ().CompressedTexSubImage3D (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CompressedTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+{
+    TraceRecord record (72, 9);
+    record.Arg (target);
+    record.Arg (level);
+    record.Arg (xoffset);
+    record.Arg (yoffset);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (format);
+    record.Arg (imageSize);
+    record.Arg (data);
+    record.Pixels (8, data, imageSize);
+    TraceNext ().CompressedTexSubImage2D (target, level, xoffset, yoffset, width, height, format, imageSize, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CompressedTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
+{
+    TraceRecord record (73, 7);
+    record.Arg (target);
+    record.Arg (level);
+    record.Arg (xoffset);
+    record.Arg (width);
+    record.Arg (format);
+    record.Arg (imageSize);
+    record.Arg (data);
+    record.Pixels (6, data, imageSize);
+    TraceNext ().CompressedTexSubImage1D (target, level, xoffset, width, format, imageSize, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetCompressedTexImage (GLenum target, GLint level, void *img)
+{
+    TraceRecord record (74, 3);
+    record.Arg (target);
+    record.Arg (level);
+    record.Arg (img);
+    TraceNext ().GetCompressedTexImage (target, level, img);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BlendFuncSeparate (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+    TraceRecord record (75, 4);
+    record.Arg (sfactorRGB);
+    record.Arg (dfactorRGB);
+    record.Arg (sfactorAlpha);
+    record.Arg (dfactorAlpha);
+    TraceNext ().BlendFuncSeparate (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_MultiDrawArrays (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount)
+{
+    TraceRecord record (76, 4);
+    record.Arg (mode);
+    record.Arg (first);
+    record.Arg (count);
+    record.Arg (drawcount);
+    record.Blob (1, first, drawcount * sizeof (GLint));
+    record.Blob (2, count, drawcount * sizeof (GLsizei));
+    TraceNext ().MultiDrawArrays (mode, first, count, drawcount);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_MultiDrawElements (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount)
+{
+    TraceRecord record (77, 5);
+    record.Arg (mode);
+    record.Arg (count);
+    record.Arg (type);
+    record.Arg (indices);
+    record.Arg (drawcount);
+    record.Blob (1, count, drawcount * sizeof (GLsizei));
+    record.Blob (3, indices, drawcount * sizeof (const void *));
+    TraceNext ().MultiDrawElements (mode, count, type, indices, drawcount);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_PointParameterf (GLenum pname, GLfloat param)
+{
+    TraceRecord record (78, 2);
+    record.Arg (pname);
+    record.Arg (param);
+    TraceNext ().PointParameterf (pname, param);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_PointParameterfv (GLenum pname, const GLfloat *params)
+{
+    TraceRecord record (79, 2);
+    record.Arg (pname);
+    record.Arg (params);
+    record.Blob (1, params, TraceParameterCount (pname) * sizeof (GLfloat));
+    TraceNext ().PointParameterfv (pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_PointParameteri (GLenum pname, GLint param)
+{
+    TraceRecord record (80, 2);
+    record.Arg (pname);
+    record.Arg (param);
+    TraceNext ().PointParameteri (pname, param);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_PointParameteriv (GLenum pname, const GLint *params)
+{
+    TraceRecord record (81, 2);
+    record.Arg (pname);
+    record.Arg (params);
+    record.Blob (1, params, TraceParameterCount (pname) * sizeof (GLint));
+    TraceNext ().PointParameteriv (pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BlendColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    TraceRecord record (82, 4);
+    record.Arg (red);
+    record.Arg (green);
+    record.Arg (blue);
+    record.Arg (alpha);
+    TraceNext ().BlendColor (red, green, blue, alpha);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BlendEquation (GLenum mode)
+{
+    TraceRecord record (83, 1);
+    record.Arg (mode);
+    TraceNext ().BlendEquation (mode);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GenQueries (GLsizei n, GLuint *ids)
+{
+    TraceRecord record (84, 2);
+    record.Arg (n);
+    record.Arg (ids);
+    TraceNext ().GenQueries (n, ids);
+    record.Blob (1, ids, n * sizeof (GLuint), true);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DeleteQueries (GLsizei n, const GLuint *ids)
+{
+    TraceRecord record (85, 2);
+    record.Arg (n);
+    record.Arg (ids);
+    record.Blob (1, ids, n * sizeof (GLuint));
+    TraceNext ().DeleteQueries (n, ids);
+    record.Commit ();
+}
+
+static GLboolean APIENTRY Trace_IsQuery (GLuint id)
+{
+    TraceRecord record (86, 1);
+    record.Arg (id);
+    GLboolean result = TraceNext ().IsQuery (id);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_BeginQuery (GLenum target, GLuint id)
+{
+    TraceRecord record (87, 2);
+    record.Arg (target);
+    record.Arg (id);
+    TraceNext ().BeginQuery (target, id);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_EndQuery (GLenum target)
+{
+    TraceRecord record (88, 1);
+    record.Arg (target);
+    TraceNext ().EndQuery (target);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetQueryiv (GLenum target, GLenum pname, GLint *params)
+{
+    TraceRecord record (89, 3);
+    record.Arg (target);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetQueryiv (target, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetQueryObjectiv (GLuint id, GLenum pname, GLint *params)
+{
+    TraceRecord record (90, 3);
+    record.Arg (id);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetQueryObjectiv (id, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetQueryObjectuiv (GLuint id, GLenum pname, GLuint *params)
+{
+    TraceRecord record (91, 3);
+    record.Arg (id);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetQueryObjectuiv (id, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BindBuffer (GLenum target, GLuint buffer)
+{
+    TraceRecord record (92, 2);
+    record.Arg (target);
+    record.Arg (buffer);
+    TraceNext ().BindBuffer (target, buffer);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DeleteBuffers (GLsizei n, const GLuint *buffers)
+{
+    TraceRecord record (93, 2);
+    record.Arg (n);
+    record.Arg (buffers);
+    record.Blob (1, buffers, n * sizeof (GLuint));
+    TraceNext ().DeleteBuffers (n, buffers);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GenBuffers (GLsizei n, GLuint *buffers)
+{
+    TraceRecord record (94, 2);
+    record.Arg (n);
+    record.Arg (buffers);
+    TraceNext ().GenBuffers (n, buffers);
+    record.Blob (1, buffers, n * sizeof (GLuint), true);
+    record.Commit ();
+}
+
+static GLboolean APIENTRY Trace_IsBuffer (GLuint buffer)
+{
+    TraceRecord record (95, 1);
+    record.Arg (buffer);
+    GLboolean result = TraceNext ().IsBuffer (buffer);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_BufferData (GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+{
+    TraceRecord record (96, 4);
+    record.Arg (target);
+    record.Arg (size);
+    record.Arg (data);
+    record.Arg (usage);
+    record.Blob (2, data, size);
+    TraceNext ().BufferData (target, size, data, usage);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    TraceRecord record (97, 4);
+    record.Arg (target);
+    record.Arg (offset);
+    record.Arg (size);
+    record.Arg (data);
+    record.Blob (3, data, size);
+    TraceNext ().BufferSubData (target, offset, size, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetBufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, void *data)
+{
+    TraceRecord record (98, 4);
+    record.Arg (target);
+    record.Arg (offset);
+    record.Arg (size);
+    record.Arg (data);
+    TraceNext ().GetBufferSubData (target, offset, size, data);
+    record.Commit ();
+}
+
+static void * APIENTRY Trace_MapBuffer (GLenum target, GLenum access)
+{
+    TraceRecord record (99, 2);
+    record.Arg (target);
+    record.Arg (access);
+    void * result = TraceNext ().MapBuffer (target, access);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static GLboolean APIENTRY Trace_UnmapBuffer (GLenum target)
+{
+    TraceRecord record (100, 1);
+    record.Arg (target);
+    GLboolean result = TraceNext ().UnmapBuffer (target);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_GetBufferParameteriv (GLenum target, GLenum pname, GLint *params)
+{
+    TraceRecord record (101, 3);
+    record.Arg (target);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetBufferParameteriv (target, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetBufferPointerv (GLenum target, GLenum pname, void **params)
+{
+    TraceRecord record (102, 3);
+    record.Arg (target);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetBufferPointerv (target, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BlendEquationSeparate (GLenum modeRGB, GLenum modeAlpha)
+{
+    TraceRecord record (103, 2);
+    record.Arg (modeRGB);
+    record.Arg (modeAlpha);
+    TraceNext ().BlendEquationSeparate (modeRGB, modeAlpha);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DrawBuffers (GLsizei n, const GLenum *bufs)
+{
+    TraceRecord record (104, 2);
+    record.Arg (n);
+    record.Arg (bufs);
+    record.Blob (1, bufs, n * sizeof (GLenum));
+    TraceNext ().DrawBuffers (n, bufs);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_StencilOpSeparate (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
+{
+    TraceRecord record (105, 4);
+    record.Arg (face);
+    record.Arg (sfail);
+    record.Arg (dpfail);
+    record.Arg (dppass);
+    TraceNext ().StencilOpSeparate (face, sfail, dpfail, dppass);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_StencilFuncSeparate (GLenum face, GLenum func, GLint ref, GLuint mask)
+{
+    TraceRecord record (106, 4);
+    record.Arg (face);
+    record.Arg (func);
+    record.Arg (ref);
+    record.Arg (mask);
+    TraceNext ().StencilFuncSeparate (face, func, ref, mask);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_StencilMaskSeparate (GLenum face, GLuint mask)
+{
+    TraceRecord record (107, 2);
+    record.Arg (face);
+    record.Arg (mask);
+    TraceNext ().StencilMaskSeparate (face, mask);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_AttachShader (GLuint program, GLuint shader)
+{
+    TraceRecord record (108, 2);
+    record.Arg (program);
+    record.Arg (shader);
+    TraceNext ().AttachShader (program, shader);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BindAttribLocation (GLuint program, GLuint index, const GLchar *name)
+{
+    TraceRecord record (109, 3);
+    record.Arg (program);
+    record.Arg (index);
+    record.Arg (name);
+    record.String (2, name, -1);
+    TraceNext ().BindAttribLocation (program, index, name);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CompileShader (GLuint shader)
+{
+    TraceRecord record (110, 1);
+    record.Arg (shader);
+    TraceNext ().CompileShader (shader);
+    record.Commit ();
+}
+
+static GLuint APIENTRY Trace_CreateProgram (void)
+{
+    TraceRecord record (111, 0);
+    GLuint result = TraceNext ().CreateProgram ();
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static GLuint APIENTRY Trace_CreateShader (GLenum type)
+{
+    TraceRecord record (112, 1);
+    record.Arg (type);
+    GLuint result = TraceNext ().CreateShader (type);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_DeleteProgram (GLuint program)
+{
+    TraceRecord record (113, 1);
+    record.Arg (program);
+    TraceNext ().DeleteProgram (program);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DeleteShader (GLuint shader)
+{
+    TraceRecord record (114, 1);
+    record.Arg (shader);
+    TraceNext ().DeleteShader (shader);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DetachShader (GLuint program, GLuint shader)
+{
+    TraceRecord record (115, 2);
+    record.Arg (program);
+    record.Arg (shader);
+    TraceNext ().DetachShader (program, shader);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DisableVertexAttribArray (GLuint index)
+{
+    TraceRecord record (116, 1);
+    record.Arg (index);
+    TraceNext ().DisableVertexAttribArray (index);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_EnableVertexAttribArray (GLuint index)
+{
+    TraceRecord record (117, 1);
+    record.Arg (index);
+    TraceNext ().EnableVertexAttribArray (index);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetActiveAttrib (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+    TraceRecord record (118, 7);
+    record.Arg (program);
+    record.Arg (index);
+    record.Arg (bufSize);
+    record.Arg (length);
+    record.Arg (size);
+    record.Arg (type);
+    record.Arg (name);
+    TraceNext ().GetActiveAttrib (program, index, bufSize, length, size, type, name);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetActiveUniform (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+    TraceRecord record (119, 7);
+    record.Arg (program);
+    record.Arg (index);
+    record.Arg (bufSize);
+    record.Arg (length);
+    record.Arg (size);
+    record.Arg (type);
+    record.Arg (name);
+    TraceNext ().GetActiveUniform (program, index, bufSize, length, size, type, name);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetAttachedShaders (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders)
+{
+    TraceRecord record (120, 4);
+    record.Arg (program);
+    record.Arg (maxCount);
+    record.Arg (count);
+    record.Arg (shaders);
+    TraceNext ().GetAttachedShaders (program, maxCount, count, shaders);
+    record.Commit ();
+}
+
+static GLint APIENTRY Trace_GetAttribLocation (GLuint program, const GLchar *name)
+{
+    TraceRecord record (121, 2);
+    record.Arg (program);
+    record.Arg (name);
+    record.String (1, name, -1);
+    GLint result = TraceNext ().GetAttribLocation (program, name);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_GetProgramiv (GLuint program, GLenum pname, GLint *params)
+{
+    TraceRecord record (122, 3);
+    record.Arg (program);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetProgramiv (program, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetProgramInfoLog (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    TraceRecord record (123, 4);
+    record.Arg (program);
+    record.Arg (bufSize);
+    record.Arg (length);
+    record.Arg (infoLog);
+    TraceNext ().GetProgramInfoLog (program, bufSize, length, infoLog);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetShaderiv (GLuint shader, GLenum pname, GLint *params)
+{
+    TraceRecord record (124, 3);
+    record.Arg (shader);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetShaderiv (shader, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetShaderInfoLog (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    TraceRecord record (125, 4);
+    record.Arg (shader);
+    record.Arg (bufSize);
+    record.Arg (length);
+    record.Arg (infoLog);
+    TraceNext ().GetShaderInfoLog (shader, bufSize, length, infoLog);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetShaderSource (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source)
+{
+    TraceRecord record (126, 4);
+    record.Arg (shader);
+    record.Arg (bufSize);
+    record.Arg (length);
+    record.Arg (source);
+    TraceNext ().GetShaderSource (shader, bufSize, length, source);
+    record.Commit ();
+}
+
+static GLint APIENTRY Trace_GetUniformLocation (GLuint program, const GLchar *name)
+{
+    TraceRecord record (127, 2);
+    record.Arg (program);
+    record.Arg (name);
+    record.String (1, name, -1);
+    GLint result = TraceNext ().GetUniformLocation (program, name);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_GetUniformfv (GLuint program, GLint location, GLfloat *params)
+{
+    TraceRecord record (128, 3);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (params);
+    TraceNext ().GetUniformfv (program, location, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetUniformiv (GLuint program, GLint location, GLint *params)
+{
+    TraceRecord record (129, 3);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (params);
+    TraceNext ().GetUniformiv (program, location, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetVertexAttribdv (GLuint index, GLenum pname, GLdouble *params)
+{
+    TraceRecord record (130, 3);
+    record.Arg (index);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetVertexAttribdv (index, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetVertexAttribfv (GLuint index, GLenum pname, GLfloat *params)
+{
+    TraceRecord record (131, 3);
+    record.Arg (index);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetVertexAttribfv (index, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetVertexAttribiv (GLuint index, GLenum pname, GLint *params)
+{
+    TraceRecord record (132, 3);
+    record.Arg (index);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetVertexAttribiv (index, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetVertexAttribPointerv (GLuint index, GLenum pname, void **pointer)
+{
+    TraceRecord record (133, 3);
+    record.Arg (index);
+    record.Arg (pname);
+    record.Arg (pointer);
+    TraceNext ().GetVertexAttribPointerv (index, pname, pointer);
+    record.Commit ();
+}
+
+static GLboolean APIENTRY Trace_IsProgram (GLuint program)
+{
+    TraceRecord record (134, 1);
+    record.Arg (program);
+    GLboolean result = TraceNext ().IsProgram (program);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static GLboolean APIENTRY Trace_IsShader (GLuint shader)
+{
+    TraceRecord record (135, 1);
+    record.Arg (shader);
+    GLboolean result = TraceNext ().IsShader (shader);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_LinkProgram (GLuint program)
+{
+    TraceRecord record (136, 1);
+    record.Arg (program);
+    TraceNext ().LinkProgram (program);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ShaderSource (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length)
+{
+    TraceRecord record (137, 4);
+    record.Arg (shader);
+    record.Arg (count);
+    record.Arg (string);
+    record.Arg (length);
+    record.Strings (2, count, string, length);
+    TraceNext ().ShaderSource (shader, count, string, length);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_UseProgram (GLuint program)
+{
+    TraceRecord record (138, 1);
+    record.Arg (program);
+    TraceNext ().UseProgram (program);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform1f (GLint location, GLfloat v0)
+{
+    TraceRecord record (139, 2);
+    record.Arg (location);
+    record.Arg (v0);
+    TraceNext ().Uniform1f (location, v0);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform2f (GLint location, GLfloat v0, GLfloat v1)
+{
+    TraceRecord record (140, 3);
+    record.Arg (location);
+    record.Arg (v0);
+    record.Arg (v1);
+    TraceNext ().Uniform2f (location, v0, v1);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform3f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    TraceRecord record (141, 4);
+    record.Arg (location);
+    record.Arg (v0);
+    record.Arg (v1);
+    record.Arg (v2);
+    TraceNext ().Uniform3f (location, v0, v1, v2);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform4f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+    TraceRecord record (142, 5);
+    record.Arg (location);
+    record.Arg (v0);
+    record.Arg (v1);
+    record.Arg (v2);
+    record.Arg (v3);
+    TraceNext ().Uniform4f (location, v0, v1, v2, v3);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform1i (GLint location, GLint v0)
+{
+    TraceRecord record (143, 2);
+    record.Arg (location);
+    record.Arg (v0);
+    TraceNext ().Uniform1i (location, v0);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform2i (GLint location, GLint v0, GLint v1)
+{
+    TraceRecord record (144, 3);
+    record.Arg (location);
+    record.Arg (v0);
+    record.Arg (v1);
+    TraceNext ().Uniform2i (location, v0, v1);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform3i (GLint location, GLint v0, GLint v1, GLint v2)
+{
+    TraceRecord record (145, 4);
+    record.Arg (location);
+    record.Arg (v0);
+    record.Arg (v1);
+    record.Arg (v2);
+    TraceNext ().Uniform3i (location, v0, v1, v2);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform4i (GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    TraceRecord record (146, 5);
+    record.Arg (location);
+    record.Arg (v0);
+    record.Arg (v1);
+    record.Arg (v2);
+    record.Arg (v3);
+    TraceNext ().Uniform4i (location, v0, v1, v2, v3);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform1fv (GLint location, GLsizei count, const GLfloat *value)
+{
+    TraceRecord record (147, 3);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (2, value, count * 1 * sizeof (GLfloat));
+    TraceNext ().Uniform1fv (location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform2fv (GLint location, GLsizei count, const GLfloat *value)
+{
+    TraceRecord record (148, 3);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (2, value, count * 2 * sizeof (GLfloat));
+    TraceNext ().Uniform2fv (location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform3fv (GLint location, GLsizei count, const GLfloat *value)
+{
+    TraceRecord record (149, 3);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (2, value, count * 3 * sizeof (GLfloat));
+    TraceNext ().Uniform3fv (location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform4fv (GLint location, GLsizei count, const GLfloat *value)
+{
+    TraceRecord record (150, 3);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (2, value, count * 4 * sizeof (GLfloat));
+    TraceNext ().Uniform4fv (location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform1iv (GLint location, GLsizei count, const GLint *value)
+{
+    TraceRecord record (151, 3);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (2, value, count * 1 * sizeof (GLint));
+    TraceNext ().Uniform1iv (location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform2iv (GLint location, GLsizei count, const GLint *value)
+{
+    TraceRecord record (152, 3);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (2, value, count * 2 * sizeof (GLint));
+    TraceNext ().Uniform2iv (location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform3iv (GLint location, GLsizei count, const GLint *value)
+{
+    TraceRecord record (153, 3);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (2, value, count * 3 * sizeof (GLint));
+    TraceNext ().Uniform3iv (location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform4iv (GLint location, GLsizei count, const GLint *value)
+{
+    TraceRecord record (154, 3);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (2, value, count * 4 * sizeof (GLint));
+    TraceNext ().Uniform4iv (location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_UniformMatrix2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    TraceRecord record (155, 4);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (3, value, count * 4 * sizeof (GLfloat));
+    TraceNext ().UniformMatrix2fv (location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_UniformMatrix3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    TraceRecord record (156, 4);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (3, value, count * 9 * sizeof (GLfloat));
+    TraceNext ().UniformMatrix3fv (location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_UniformMatrix4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    TraceRecord record (157, 4);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (3, value, count * 16 * sizeof (GLfloat));
+    TraceNext ().UniformMatrix4fv (location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ValidateProgram (GLuint program)
+{
+    TraceRecord record (158, 1);
+    record.Arg (program);
+    TraceNext ().ValidateProgram (program);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib1d (GLuint index, GLdouble x)
+{
+    TraceRecord record (159, 2);
+    record.Arg (index);
+    record.Arg (x);
+    TraceNext ().VertexAttrib1d (index, x);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib1dv (GLuint index, const GLdouble *v)
+{
+    TraceRecord record (160, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 1 * sizeof (GLdouble));
+    TraceNext ().VertexAttrib1dv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib1f (GLuint index, GLfloat x)
+{
+    TraceRecord record (161, 2);
+    record.Arg (index);
+    record.Arg (x);
+    TraceNext ().VertexAttrib1f (index, x);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib1fv (GLuint index, const GLfloat *v)
+{
+    TraceRecord record (162, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 1 * sizeof (GLfloat));
+    TraceNext ().VertexAttrib1fv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib1s (GLuint index, GLshort x)
+{
+    TraceRecord record (163, 2);
+    record.Arg (index);
+    record.Arg (x);
+    TraceNext ().VertexAttrib1s (index, x);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib1sv (GLuint index, const GLshort *v)
+{
+    TraceRecord record (164, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 1 * sizeof (GLshort));
+    TraceNext ().VertexAttrib1sv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib2d (GLuint index, GLdouble x, GLdouble y)
+{
+    TraceRecord record (165, 3);
+    record.Arg (index);
+    record.Arg (x);
+    record.Arg (y);
+    TraceNext ().VertexAttrib2d (index, x, y);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib2dv (GLuint index, const GLdouble *v)
+{
+    TraceRecord record (166, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 2 * sizeof (GLdouble));
+    TraceNext ().VertexAttrib2dv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib2f (GLuint index, GLfloat x, GLfloat y)
+{
+    TraceRecord record (167, 3);
+    record.Arg (index);
+    record.Arg (x);
+    record.Arg (y);
+    TraceNext ().VertexAttrib2f (index, x, y);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib2fv (GLuint index, const GLfloat *v)
+{
+    TraceRecord record (168, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 2 * sizeof (GLfloat));
+    TraceNext ().VertexAttrib2fv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib2s (GLuint index, GLshort x, GLshort y)
+{
+    TraceRecord record (169, 3);
+    record.Arg (index);
+    record.Arg (x);
+    record.Arg (y);
+    TraceNext ().VertexAttrib2s (index, x, y);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib2sv (GLuint index, const GLshort *v)
+{
+    TraceRecord record (170, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 2 * sizeof (GLshort));
+    TraceNext ().VertexAttrib2sv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib3d (GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+    TraceRecord record (171, 4);
+    record.Arg (index);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (z);
+    TraceNext ().VertexAttrib3d (index, x, y, z);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib3dv (GLuint index, const GLdouble *v)
+{
+    TraceRecord record (172, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 3 * sizeof (GLdouble));
+    TraceNext ().VertexAttrib3dv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib3f (GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+    TraceRecord record (173, 4);
+    record.Arg (index);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (z);
+    TraceNext ().VertexAttrib3f (index, x, y, z);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib3fv (GLuint index, const GLfloat *v)
+{
+    TraceRecord record (174, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 3 * sizeof (GLfloat));
+    TraceNext ().VertexAttrib3fv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib3s (GLuint index, GLshort x, GLshort y, GLshort z)
+{
+    TraceRecord record (175, 4);
+    record.Arg (index);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (z);
+    TraceNext ().VertexAttrib3s (index, x, y, z);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib3sv (GLuint index, const GLshort *v)
+{
+    TraceRecord record (176, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 3 * sizeof (GLshort));
+    TraceNext ().VertexAttrib3sv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib4Nbv (GLuint index, const GLbyte *v)
+{
+    TraceRecord record (177, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 4 * sizeof (GLbyte));
+    TraceNext ().VertexAttrib4Nbv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib4Niv (GLuint index, const GLint *v)
+{
+    TraceRecord record (178, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 4 * sizeof (GLint));
+    TraceNext ().VertexAttrib4Niv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib4Nsv (GLuint index, const GLshort *v)
+{
+    TraceRecord record (179, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 4 * sizeof (GLshort));
+    TraceNext ().VertexAttrib4Nsv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib4Nub (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+{
+    TraceRecord record (180, 5);
+    record.Arg (index);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (z);
+    record.Arg (w);
+    TraceNext ().VertexAttrib4Nub (index, x, y, z, w);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib4Nubv (GLuint index, const GLubyte *v)
+{
+    TraceRecord record (181, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 4 * sizeof (GLubyte));
+    TraceNext ().VertexAttrib4Nubv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib4Nuiv (GLuint index, const GLuint *v)
+{
+    TraceRecord record (182, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 4 * sizeof (GLuint));
+    TraceNext ().VertexAttrib4Nuiv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib4Nusv (GLuint index, const GLushort *v)
+{
+    TraceRecord record (183, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 4 * sizeof (GLushort));
+    TraceNext ().VertexAttrib4Nusv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib4bv (GLuint index, const GLbyte *v)
+{
+    TraceRecord record (184, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 4 * sizeof (GLbyte));
+    TraceNext ().VertexAttrib4bv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib4d (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    TraceRecord record (185, 5);
+    record.Arg (index);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (z);
+    record.Arg (w);
+    TraceNext ().VertexAttrib4d (index, x, y, z, w);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib4dv (GLuint index, const GLdouble *v)
+{
+    TraceRecord record (186, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 4 * sizeof (GLdouble));
+    TraceNext ().VertexAttrib4dv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib4f (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    TraceRecord record (187, 5);
+    record.Arg (index);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (z);
+    record.Arg (w);
+    TraceNext ().VertexAttrib4f (index, x, y, z, w);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib4fv (GLuint index, const GLfloat *v)
+{
+    TraceRecord record (188, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 4 * sizeof (GLfloat));
+    TraceNext ().VertexAttrib4fv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib4iv (GLuint index, const GLint *v)
+{
+    TraceRecord record (189, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 4 * sizeof (GLint));
+    TraceNext ().VertexAttrib4iv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib4s (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+    TraceRecord record (190, 5);
+    record.Arg (index);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (z);
+    record.Arg (w);
+    TraceNext ().VertexAttrib4s (index, x, y, z, w);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib4sv (GLuint index, const GLshort *v)
+{
+    TraceRecord record (191, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 4 * sizeof (GLshort));
+    TraceNext ().VertexAttrib4sv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib4ubv (GLuint index, const GLubyte *v)
+{
+    TraceRecord record (192, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 4 * sizeof (GLubyte));
+    TraceNext ().VertexAttrib4ubv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib4uiv (GLuint index, const GLuint *v)
+{
+    TraceRecord record (193, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 4 * sizeof (GLuint));
+    TraceNext ().VertexAttrib4uiv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttrib4usv (GLuint index, const GLushort *v)
+{
+    TraceRecord record (194, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 4 * sizeof (GLushort));
+    TraceNext ().VertexAttrib4usv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribPointer (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer)
+{
+    TraceRecord record (195, 6);
+    record.Arg (index);
+    record.Arg (size);
+    record.Arg (type);
+    record.Arg (normalized);
+    record.Arg (stride);
+    record.Arg (pointer);
+    TraceNext ().VertexAttribPointer (index, size, type, normalized, stride, pointer);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_UniformMatrix2x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    TraceRecord record (196, 4);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (3, value, count * 6 * sizeof (GLfloat));
+    TraceNext ().UniformMatrix2x3fv (location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_UniformMatrix3x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    TraceRecord record (197, 4);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (3, value, count * 6 * sizeof (GLfloat));
+    TraceNext ().UniformMatrix3x2fv (location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_UniformMatrix2x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    TraceRecord record (198, 4);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (3, value, count * 8 * sizeof (GLfloat));
+    TraceNext ().UniformMatrix2x4fv (location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_UniformMatrix4x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    TraceRecord record (199, 4);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (3, value, count * 8 * sizeof (GLfloat));
+    TraceNext ().UniformMatrix4x2fv (location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_UniformMatrix3x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    TraceRecord record (200, 4);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (3, value, count * 12 * sizeof (GLfloat));
+    TraceNext ().UniformMatrix3x4fv (location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_UniformMatrix4x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    TraceRecord record (201, 4);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (3, value, count * 12 * sizeof (GLfloat));
+    TraceNext ().UniformMatrix4x3fv (location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ColorMaski (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
+{
+    TraceRecord record (202, 5);
+    record.Arg (index);
+    record.Arg (r);
+    record.Arg (g);
+    record.Arg (b);
+    record.Arg (a);
+    TraceNext ().ColorMaski (index, r, g, b, a);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetBooleani_v (GLenum target, GLuint index, GLboolean *data)
+{
+    TraceRecord record (203, 3);
+    record.Arg (target);
+    record.Arg (index);
+    record.Arg (data);
+    TraceNext ().GetBooleani_v (target, index, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetIntegeri_v (GLenum target, GLuint index, GLint *data)
+{
+    TraceRecord record (204, 3);
+    record.Arg (target);
+    record.Arg (index);
+    record.Arg (data);
+    TraceNext ().GetIntegeri_v (target, index, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Enablei (GLenum target, GLuint index)
+{
+    TraceRecord record (205, 2);
+    record.Arg (target);
+    record.Arg (index);
+    TraceNext ().Enablei (target, index);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Disablei (GLenum target, GLuint index)
+{
+    TraceRecord record (206, 2);
+    record.Arg (target);
+    record.Arg (index);
+    TraceNext ().Disablei (target, index);
+    record.Commit ();
+}
+
+static GLboolean APIENTRY Trace_IsEnabledi (GLenum target, GLuint index)
+{
+    TraceRecord record (207, 2);
+    record.Arg (target);
+    record.Arg (index);
+    GLboolean result = TraceNext ().IsEnabledi (target, index);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_BeginTransformFeedback (GLenum primitiveMode)
+{
+    TraceRecord record (208, 1);
+    record.Arg (primitiveMode);
+    TraceNext ().BeginTransformFeedback (primitiveMode);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_EndTransformFeedback (void)
+{
+    TraceRecord record (209, 0);
+    TraceNext ().EndTransformFeedback ();
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BindBufferRange (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    TraceRecord record (210, 5);
+    record.Arg (target);
+    record.Arg (index);
+    record.Arg (buffer);
+    record.Arg (offset);
+    record.Arg (size);
+    TraceNext ().BindBufferRange (target, index, buffer, offset, size);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BindBufferBase (GLenum target, GLuint index, GLuint buffer)
+{
+    TraceRecord record (211, 3);
+    record.Arg (target);
+    record.Arg (index);
+    record.Arg (buffer);
+    TraceNext ().BindBufferBase (target, index, buffer);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TransformFeedbackVaryings (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode)
+{
+    TraceRecord record (212, 4);
+    record.Arg (program);
+    record.Arg (count);
+    record.Arg (varyings);
+    record.Arg (bufferMode);
+    record.Strings (2, count, varyings, NULL);
+    TraceNext ().TransformFeedbackVaryings (program, count, varyings, bufferMode);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetTransformFeedbackVarying (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name)
+{
+    TraceRecord record (213, 7);
+    record.Arg (program);
+    record.Arg (index);
+    record.Arg (bufSize);
+    record.Arg (length);
+    record.Arg (size);
+    record.Arg (type);
+    record.Arg (name);
+    TraceNext ().GetTransformFeedbackVarying (program, index, bufSize, length, size, type, name);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ClampColor (GLenum target, GLenum clamp)
+{
+    TraceRecord record (214, 2);
+    record.Arg (target);
+    record.Arg (clamp);
+    TraceNext ().ClampColor (target, clamp);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BeginConditionalRender (GLuint id, GLenum mode)
+{
+    TraceRecord record (215, 2);
+    record.Arg (id);
+    record.Arg (mode);
+    TraceNext ().BeginConditionalRender (id, mode);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_EndConditionalRender (void)
+{
+    TraceRecord record (216, 0);
+    TraceNext ().EndConditionalRender ();
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribIPointer (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+    TraceRecord record (217, 5);
+    record.Arg (index);
+    record.Arg (size);
+    record.Arg (type);
+    record.Arg (stride);
+    record.Arg (pointer);
+    TraceNext ().VertexAttribIPointer (index, size, type, stride, pointer);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetVertexAttribIiv (GLuint index, GLenum pname, GLint *params)
+{
+    TraceRecord record (218, 3);
+    record.Arg (index);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetVertexAttribIiv (index, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetVertexAttribIuiv (GLuint index, GLenum pname, GLuint *params)
+{
+    TraceRecord record (219, 3);
+    record.Arg (index);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetVertexAttribIuiv (index, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribI1i (GLuint index, GLint x)
+{
+    TraceRecord record (220, 2);
+    record.Arg (index);
+    record.Arg (x);
+    TraceNext ().VertexAttribI1i (index, x);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribI2i (GLuint index, GLint x, GLint y)
+{
+    TraceRecord record (221, 3);
+    record.Arg (index);
+    record.Arg (x);
+    record.Arg (y);
+    TraceNext ().VertexAttribI2i (index, x, y);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribI3i (GLuint index, GLint x, GLint y, GLint z)
+{
+    TraceRecord record (222, 4);
+    record.Arg (index);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (z);
+    TraceNext ().VertexAttribI3i (index, x, y, z);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribI4i (GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+    TraceRecord record (223, 5);
+    record.Arg (index);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (z);
+    record.Arg (w);
+    TraceNext ().VertexAttribI4i (index, x, y, z, w);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribI1ui (GLuint index, GLuint x)
+{
+    TraceRecord record (224, 2);
+    record.Arg (index);
+    record.Arg (x);
+    TraceNext ().VertexAttribI1ui (index, x);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribI2ui (GLuint index, GLuint x, GLuint y)
+{
+    TraceRecord record (225, 3);
+    record.Arg (index);
+    record.Arg (x);
+    record.Arg (y);
+    TraceNext ().VertexAttribI2ui (index, x, y);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribI3ui (GLuint index, GLuint x, GLuint y, GLuint z)
+{
+    TraceRecord record (226, 4);
+    record.Arg (index);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (z);
+    TraceNext ().VertexAttribI3ui (index, x, y, z);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribI4ui (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+{
+    TraceRecord record (227, 5);
+    record.Arg (index);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (z);
+    record.Arg (w);
+    TraceNext ().VertexAttribI4ui (index, x, y, z, w);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribI1iv (GLuint index, const GLint *v)
+{
+    TraceRecord record (228, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 1 * sizeof (GLint));
+    TraceNext ().VertexAttribI1iv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribI2iv (GLuint index, const GLint *v)
+{
+    TraceRecord record (229, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 2 * sizeof (GLint));
+    TraceNext ().VertexAttribI2iv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribI3iv (GLuint index, const GLint *v)
+{
+    TraceRecord record (230, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 3 * sizeof (GLint));
+    TraceNext ().VertexAttribI3iv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribI4iv (GLuint index, const GLint *v)
+{
+    TraceRecord record (231, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 4 * sizeof (GLint));
+    TraceNext ().VertexAttribI4iv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribI1uiv (GLuint index, const GLuint *v)
+{
+    TraceRecord record (232, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 1 * sizeof (GLuint));
+    TraceNext ().VertexAttribI1uiv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribI2uiv (GLuint index, const GLuint *v)
+{
+    TraceRecord record (233, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 2 * sizeof (GLuint));
+    TraceNext ().VertexAttribI2uiv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribI3uiv (GLuint index, const GLuint *v)
+{
+    TraceRecord record (234, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 3 * sizeof (GLuint));
+    TraceNext ().VertexAttribI3uiv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribI4uiv (GLuint index, const GLuint *v)
+{
+    TraceRecord record (235, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 4 * sizeof (GLuint));
+    TraceNext ().VertexAttribI4uiv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribI4bv (GLuint index, const GLbyte *v)
+{
+    TraceRecord record (236, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 4 * sizeof (GLbyte));
+    TraceNext ().VertexAttribI4bv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribI4sv (GLuint index, const GLshort *v)
+{
+    TraceRecord record (237, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 4 * sizeof (GLshort));
+    TraceNext ().VertexAttribI4sv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribI4ubv (GLuint index, const GLubyte *v)
+{
+    TraceRecord record (238, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 4 * sizeof (GLubyte));
+    TraceNext ().VertexAttribI4ubv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribI4usv (GLuint index, const GLushort *v)
+{
+    TraceRecord record (239, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 4 * sizeof (GLushort));
+    TraceNext ().VertexAttribI4usv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetUniformuiv (GLuint program, GLint location, GLuint *params)
+{
+    TraceRecord record (240, 3);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (params);
+    TraceNext ().GetUniformuiv (program, location, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BindFragDataLocation (GLuint program, GLuint color, const GLchar *name)
+{
+    TraceRecord record (241, 3);
+    record.Arg (program);
+    record.Arg (color);
+    record.Arg (name);
+    record.String (2, name, -1);
+    TraceNext ().BindFragDataLocation (program, color, name);
+    record.Commit ();
+}
+
+static GLint APIENTRY Trace_GetFragDataLocation (GLuint program, const GLchar *name)
+{
+    TraceRecord record (242, 2);
+    record.Arg (program);
+    record.Arg (name);
+    record.String (1, name, -1);
+    GLint result = TraceNext ().GetFragDataLocation (program, name);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_Uniform1ui (GLint location, GLuint v0)
+{
+    TraceRecord record (243, 2);
+    record.Arg (location);
+    record.Arg (v0);
+    TraceNext ().Uniform1ui (location, v0);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform2ui (GLint location, GLuint v0, GLuint v1)
+{
+    TraceRecord record (244, 3);
+    record.Arg (location);
+    record.Arg (v0);
+    record.Arg (v1);
+    TraceNext ().Uniform2ui (location, v0, v1);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform3ui (GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+    TraceRecord record (245, 4);
+    record.Arg (location);
+    record.Arg (v0);
+    record.Arg (v1);
+    record.Arg (v2);
+    TraceNext ().Uniform3ui (location, v0, v1, v2);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform4ui (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+    TraceRecord record (246, 5);
+    record.Arg (location);
+    record.Arg (v0);
+    record.Arg (v1);
+    record.Arg (v2);
+    record.Arg (v3);
+    TraceNext ().Uniform4ui (location, v0, v1, v2, v3);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform1uiv (GLint location, GLsizei count, const GLuint *value)
+{
+    TraceRecord record (247, 3);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (2, value, count * 1 * sizeof (GLuint));
+    TraceNext ().Uniform1uiv (location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform2uiv (GLint location, GLsizei count, const GLuint *value)
+{
+    TraceRecord record (248, 3);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (2, value, count * 2 * sizeof (GLuint));
+    TraceNext ().Uniform2uiv (location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform3uiv (GLint location, GLsizei count, const GLuint *value)
+{
+    TraceRecord record (249, 3);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (2, value, count * 3 * sizeof (GLuint));
+    TraceNext ().Uniform3uiv (location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform4uiv (GLint location, GLsizei count, const GLuint *value)
+{
+    TraceRecord record (250, 3);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (2, value, count * 4 * sizeof (GLuint));
+    TraceNext ().Uniform4uiv (location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TexParameterIiv (GLenum target, GLenum pname, const GLint *params)
+{
+    TraceRecord record (251, 3);
+    record.Arg (target);
+    record.Arg (pname);
+    record.Arg (params);
+    record.Blob (2, params, TraceParameterCount (pname) * sizeof (GLint));
+    TraceNext ().TexParameterIiv (target, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TexParameterIuiv (GLenum target, GLenum pname, const GLuint *params)
+{
+    TraceRecord record (252, 3);
+    record.Arg (target);
+    record.Arg (pname);
+    record.Arg (params);
+    record.Blob (2, params, TraceParameterCount (pname) * sizeof (GLuint));
+    TraceNext ().TexParameterIuiv (target, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetTexParameterIiv (GLenum target, GLenum pname, GLint *params)
+{
+    TraceRecord record (253, 3);
+    record.Arg (target);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetTexParameterIiv (target, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetTexParameterIuiv (GLenum target, GLenum pname, GLuint *params)
+{
+    TraceRecord record (254, 3);
+    record.Arg (target);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetTexParameterIuiv (target, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ClearBufferiv (GLenum buffer, GLint drawbuffer, const GLint *value)
+{
+    TraceRecord record (255, 3);
+    record.Arg (buffer);
+    record.Arg (drawbuffer);
+    record.Arg (value);
+    record.Blob (2, value, (buffer == GL_COLOR ? 4 : 1) * sizeof (GLint));
+    TraceNext ().ClearBufferiv (buffer, drawbuffer, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ClearBufferuiv (GLenum buffer, GLint drawbuffer, const GLuint *value)
+{
+    TraceRecord record (256, 3);
+    record.Arg (buffer);
+    record.Arg (drawbuffer);
+    record.Arg (value);
+    record.Blob (2, value, (buffer == GL_COLOR ? 4 : 1) * sizeof (GLuint));
+    TraceNext ().ClearBufferuiv (buffer, drawbuffer, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ClearBufferfv (GLenum buffer, GLint drawbuffer, const GLfloat *value)
+{
+    TraceRecord record (257, 3);
+    record.Arg (buffer);
+    record.Arg (drawbuffer);
+    record.Arg (value);
+    record.Blob (2, value, (buffer == GL_COLOR ? 4 : 1) * sizeof (GLfloat));
+    TraceNext ().ClearBufferfv (buffer, drawbuffer, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ClearBufferfi (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
+{
+    TraceRecord record (258, 4);
+    record.Arg (buffer);
+    record.Arg (drawbuffer);
+    record.Arg (depth);
+    record.Arg (stencil);
+    TraceNext ().ClearBufferfi (buffer, drawbuffer, depth, stencil);
+    record.Commit ();
+}
+
+static const GLubyte * APIENTRY Trace_GetStringi (GLenum name, GLuint index)
+{
+    TraceRecord record (259, 2);
+    record.Arg (name);
+    record.Arg (index);
+    const GLubyte * result = TraceNext ().GetStringi (name, index);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static GLboolean APIENTRY Trace_IsRenderbuffer (GLuint renderbuffer)
+{
+    TraceRecord record (260, 1);
+    record.Arg (renderbuffer);
+    GLboolean result = TraceNext ().IsRenderbuffer (renderbuffer);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_BindRenderbuffer (GLenum target, GLuint renderbuffer)
+{
+    TraceRecord record (261, 2);
+    record.Arg (target);
+    record.Arg (renderbuffer);
+    TraceNext ().BindRenderbuffer (target, renderbuffer);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DeleteRenderbuffers (GLsizei n, const GLuint *renderbuffers)
+{
+    TraceRecord record (262, 2);
+    record.Arg (n);
+    record.Arg (renderbuffers);
+    record.Blob (1, renderbuffers, n * sizeof (GLuint));
+    TraceNext ().DeleteRenderbuffers (n, renderbuffers);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GenRenderbuffers (GLsizei n, GLuint *renderbuffers)
+{
+    TraceRecord record (263, 2);
+    record.Arg (n);
+    record.Arg (renderbuffers);
+    TraceNext ().GenRenderbuffers (n, renderbuffers);
+    record.Blob (1, renderbuffers, n * sizeof (GLuint), true);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_RenderbufferStorage (GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    TraceRecord record (264, 4);
+    record.Arg (target);
+    record.Arg (internalformat);
+    record.Arg (width);
+    record.Arg (height);
+    TraceNext ().RenderbufferStorage (target, internalformat, width, height);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetRenderbufferParameteriv (GLenum target, GLenum pname, GLint *params)
+{
+    TraceRecord record (265, 3);
+    record.Arg (target);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetRenderbufferParameteriv (target, pname, params);
+    record.Commit ();
+}
+
+static GLboolean APIENTRY Trace_IsFramebuffer (GLuint framebuffer)
+{
+    TraceRecord record (266, 1);
+    record.Arg (framebuffer);
+    GLboolean result = TraceNext ().IsFramebuffer (framebuffer);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_BindFramebuffer (GLenum target, GLuint framebuffer)
+{
+    TraceRecord record (267, 2);
+    record.Arg (target);
+    record.Arg (framebuffer);
+    TraceNext ().BindFramebuffer (target, framebuffer);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DeleteFramebuffers (GLsizei n, const GLuint *framebuffers)
+{
+    TraceRecord record (268, 2);
+    record.Arg (n);
+    record.Arg (framebuffers);
+    record.Blob (1, framebuffers, n * sizeof (GLuint));
+    TraceNext ().DeleteFramebuffers (n, framebuffers);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GenFramebuffers (GLsizei n, GLuint *framebuffers)
+{
+    TraceRecord record (269, 2);
+    record.Arg (n);
+    record.Arg (framebuffers);
+    TraceNext ().GenFramebuffers (n, framebuffers);
+    record.Blob (1, framebuffers, n * sizeof (GLuint), true);
+    record.Commit ();
+}
+
+static GLenum APIENTRY Trace_CheckFramebufferStatus (GLenum target)
+{
+    TraceRecord record (270, 1);
+    record.Arg (target);
+    GLenum result = TraceNext ().CheckFramebufferStatus (target);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_FramebufferTexture1D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    TraceRecord record (271, 5);
+    record.Arg (target);
+    record.Arg (attachment);
+    record.Arg (textarget);
+    record.Arg (texture);
+    record.Arg (level);
+    TraceNext ().FramebufferTexture1D (target, attachment, textarget, texture, level);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_FramebufferTexture2D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    TraceRecord record (272, 5);
+    record.Arg (target);
+    record.Arg (attachment);
+    record.Arg (textarget);
+    record.Arg (texture);
+    record.Arg (level);
+    TraceNext ().FramebufferTexture2D (target, attachment, textarget, texture, level);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_FramebufferTexture3D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
+{
+    TraceRecord record (273, 6);
+    record.Arg (target);
+    record.Arg (attachment);
+    record.Arg (textarget);
+    record.Arg (texture);
+    record.Arg (level);
+    record.Arg (zoffset);
+    TraceNext ().FramebufferTexture3D (target, attachment, textarget, texture, level, zoffset);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_FramebufferRenderbuffer (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+    TraceRecord record (274, 4);
+    record.Arg (target);
+    record.Arg (attachment);
+    record.Arg (renderbuffertarget);
+    record.Arg (renderbuffer);
+    TraceNext ().FramebufferRenderbuffer (target, attachment, renderbuffertarget, renderbuffer);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetFramebufferAttachmentParameteriv (GLenum target, GLenum attachment, GLenum pname, GLint *params)
+{
+    TraceRecord record (275, 4);
+    record.Arg (target);
+    record.Arg (attachment);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetFramebufferAttachmentParameteriv (target, attachment, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GenerateMipmap (GLenum target)
+{
+    TraceRecord record (276, 1);
+    record.Arg (target);
+    TraceNext ().GenerateMipmap (target);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BlitFramebuffer (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+    TraceRecord record (277, 10);
+    record.Arg (srcX0);
+    record.Arg (srcY0);
+    record.Arg (srcX1);
+    record.Arg (srcY1);
+    record.Arg (dstX0);
+    record.Arg (dstY0);
+    record.Arg (dstX1);
+    record.Arg (dstY1);
+    record.Arg (mask);
+    record.Arg (filter);
+    TraceNext ().BlitFramebuffer (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_RenderbufferStorageMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    TraceRecord record (278, 5);
+    record.Arg (target);
+    record.Arg (samples);
+    record.Arg (internalformat);
+    record.Arg (width);
+    record.Arg (height);
+    TraceNext ().RenderbufferStorageMultisample (target, samples, internalformat, width, height);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_FramebufferTextureLayer (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+    TraceRecord record (279, 5);
+    record.Arg (target);
+    record.Arg (attachment);
+    record.Arg (texture);
+    record.Arg (level);
+    record.Arg (layer);
+    TraceNext ().FramebufferTextureLayer (target, attachment, texture, level, layer);
+    record.Commit ();
+}
+
+static void * APIENTRY Trace_MapBufferRange (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    TraceRecord record (280, 4);
+    record.Arg (target);
+    record.Arg (offset);
+    record.Arg (length);
+    record.Arg (access);
+    void * result = TraceNext ().MapBufferRange (target, offset, length, access);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_FlushMappedBufferRange (GLenum target, GLintptr offset, GLsizeiptr length)
+{
+    TraceRecord record (281, 3);
+    record.Arg (target);
+    record.Arg (offset);
+    record.Arg (length);
+    TraceNext ().FlushMappedBufferRange (target, offset, length);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BindVertexArray (GLuint array)
+{
+    TraceRecord record (282, 1);
+    record.Arg (array);
+    TraceNext ().BindVertexArray (array);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DeleteVertexArrays (GLsizei n, const GLuint *arrays)
+{
+    TraceRecord record (283, 2);
+    record.Arg (n);
+    record.Arg (arrays);
+    record.Blob (1, arrays, n * sizeof (GLuint));
+    TraceNext ().DeleteVertexArrays (n, arrays);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GenVertexArrays (GLsizei n, GLuint *arrays)
+{
+    TraceRecord record (284, 2);
+    record.Arg (n);
+    record.Arg (arrays);
+    TraceNext ().GenVertexArrays (n, arrays);
+    record.Blob (1, arrays, n * sizeof (GLuint), true);
+    record.Commit ();
+}
+
+static GLboolean APIENTRY Trace_IsVertexArray (GLuint array)
+{
+    TraceRecord record (285, 1);
+    record.Arg (array);
+    GLboolean result = TraceNext ().IsVertexArray (array);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_DrawArraysInstanced (GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+{
+    TraceRecord record (286, 4);
+    record.Arg (mode);
+    record.Arg (first);
+    record.Arg (count);
+    record.Arg (instancecount);
+    TraceNext ().DrawArraysInstanced (mode, first, count, instancecount);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DrawElementsInstanced (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount)
+{
+    TraceRecord record (287, 5);
+    record.Arg (mode);
+    record.Arg (count);
+    record.Arg (type);
+    record.Arg (indices);
+    record.Arg (instancecount);
+    TraceNext ().DrawElementsInstanced (mode, count, type, indices, instancecount);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TexBuffer (GLenum target, GLenum internalformat, GLuint buffer)
+{
+    TraceRecord record (288, 3);
+    record.Arg (target);
+    record.Arg (internalformat);
+    record.Arg (buffer);
+    TraceNext ().TexBuffer (target, internalformat, buffer);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_PrimitiveRestartIndex (GLuint index)
+{
+    TraceRecord record (289, 1);
+    record.Arg (index);
+    TraceNext ().PrimitiveRestartIndex (index);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CopyBufferSubData (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+    TraceRecord record (290, 5);
+    record.Arg (readTarget);
+    record.Arg (writeTarget);
+    record.Arg (readOffset);
+    record.Arg (writeOffset);
+    record.Arg (size);
+    TraceNext ().CopyBufferSubData (readTarget, writeTarget, readOffset, writeOffset, size);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetUniformIndices (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices)
+{
+    TraceRecord record (291, 4);
+    record.Arg (program);
+    record.Arg (uniformCount);
+    record.Arg (uniformNames);
+    record.Arg (uniformIndices);
+    record.Strings (2, uniformCount, uniformNames, NULL);
+    TraceNext ().GetUniformIndices (program, uniformCount, uniformNames, uniformIndices);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetActiveUniformsiv (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params)
+{
+    TraceRecord record (292, 5);
+    record.Arg (program);
+    record.Arg (uniformCount);
+    record.Arg (uniformIndices);
+    record.Arg (pname);
+    record.Arg (params);
+    record.Blob (2, uniformIndices, uniformCount * sizeof (GLuint));
+    TraceNext ().GetActiveUniformsiv (program, uniformCount, uniformIndices, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetActiveUniformName (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName)
+{
+    TraceRecord record (293, 5);
+    record.Arg (program);
+    record.Arg (uniformIndex);
+    record.Arg (bufSize);
+    record.Arg (length);
+    record.Arg (uniformName);
+    TraceNext ().GetActiveUniformName (program, uniformIndex, bufSize, length, uniformName);
+    record.Commit ();
+}
+
+static GLuint APIENTRY Trace_GetUniformBlockIndex (GLuint program, const GLchar *uniformBlockName)
+{
+    TraceRecord record (294, 2);
+    record.Arg (program);
+    record.Arg (uniformBlockName);
+    record.String (1, uniformBlockName, -1);
+    GLuint result = TraceNext ().GetUniformBlockIndex (program, uniformBlockName);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_GetActiveUniformBlockiv (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params)
+{
+    TraceRecord record (295, 4);
+    record.Arg (program);
+    record.Arg (uniformBlockIndex);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetActiveUniformBlockiv (program, uniformBlockIndex, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetActiveUniformBlockName (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName)
+{
+    TraceRecord record (296, 5);
+    record.Arg (program);
+    record.Arg (uniformBlockIndex);
+    record.Arg (bufSize);
+    record.Arg (length);
+    record.Arg (uniformBlockName);
+    TraceNext ().GetActiveUniformBlockName (program, uniformBlockIndex, bufSize, length, uniformBlockName);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_UniformBlockBinding (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding)
+{
+    TraceRecord record (297, 3);
+    record.Arg (program);
+    record.Arg (uniformBlockIndex);
+    record.Arg (uniformBlockBinding);
+    TraceNext ().UniformBlockBinding (program, uniformBlockIndex, uniformBlockBinding);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DrawElementsBaseVertex (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+{
+    TraceRecord record (298, 5);
+    record.Arg (mode);
+    record.Arg (count);
+    record.Arg (type);
+    record.Arg (indices);
+    record.Arg (basevertex);
+    TraceNext ().DrawElementsBaseVertex (mode, count, type, indices, basevertex);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DrawRangeElementsBaseVertex (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+{
+    TraceRecord record (299, 7);
+    record.Arg (mode);
+    record.Arg (start);
+    record.Arg (end);
+    record.Arg (count);
+    record.Arg (type);
+    record.Arg (indices);
+    record.Arg (basevertex);
+    TraceNext ().DrawRangeElementsBaseVertex (mode, start, end, count, type, indices, basevertex);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DrawElementsInstancedBaseVertex (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex)
+{
+    TraceRecord record (300, 6);
+    record.Arg (mode);
+    record.Arg (count);
+    record.Arg (type);
+    record.Arg (indices);
+    record.Arg (instancecount);
+    record.Arg (basevertex);
+    TraceNext ().DrawElementsInstancedBaseVertex (mode, count, type, indices, instancecount, basevertex);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_MultiDrawElementsBaseVertex (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex)
+{
+    TraceRecord record (301, 6);
+    record.Arg (mode);
+    record.Arg (count);
+    record.Arg (type);
+    record.Arg (indices);
+    record.Arg (drawcount);
+    record.Arg (basevertex);
+    record.Blob (1, count, drawcount * sizeof (GLsizei));
+    record.Blob (3, indices, drawcount * sizeof (const void *));
+    record.Blob (5, basevertex, drawcount * sizeof (GLint));
+    TraceNext ().MultiDrawElementsBaseVertex (mode, count, type, indices, drawcount, basevertex);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProvokingVertex (GLenum mode)
+{
+    TraceRecord record (302, 1);
+    record.Arg (mode);
+    TraceNext ().ProvokingVertex (mode);
+    record.Commit ();
+}
+
+static GLsync APIENTRY Trace_FenceSync (GLenum condition, GLbitfield flags)
+{
+    TraceRecord record (303, 2);
+    record.Arg (condition);
+    record.Arg (flags);
+    GLsync result = TraceNext ().FenceSync (condition, flags);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static GLboolean APIENTRY Trace_IsSync (GLsync sync)
+{
+    TraceRecord record (304, 1);
+    record.Arg (sync);
+    GLboolean result = TraceNext ().IsSync (sync);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_DeleteSync (GLsync sync)
+{
+    TraceRecord record (305, 1);
+    record.Arg (sync);
+    TraceNext ().DeleteSync (sync);
+    record.Commit ();
+}
+
+static GLenum APIENTRY Trace_ClientWaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    TraceRecord record (306, 3);
+    record.Arg (sync);
+    record.Arg (flags);
+    record.Arg (timeout);
+    GLenum result = TraceNext ().ClientWaitSync (sync, flags, timeout);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_WaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    TraceRecord record (307, 3);
+    record.Arg (sync);
+    record.Arg (flags);
+    record.Arg (timeout);
+    TraceNext ().WaitSync (sync, flags, timeout);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetInteger64v (GLenum pname, GLint64 *data)
+{
+    TraceRecord record (308, 2);
+    record.Arg (pname);
+    record.Arg (data);
+    TraceNext ().GetInteger64v (pname, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetSynciv (GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values)
+{
+    TraceRecord record (309, 5);
+    record.Arg (sync);
+    record.Arg (pname);
+    record.Arg (bufSize);
+    record.Arg (length);
+    record.Arg (values);
+    TraceNext ().GetSynciv (sync, pname, bufSize, length, values);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetInteger64i_v (GLenum target, GLuint index, GLint64 *data)
+{
+    TraceRecord record (310, 3);
+    record.Arg (target);
+    record.Arg (index);
+    record.Arg (data);
+    TraceNext ().GetInteger64i_v (target, index, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetBufferParameteri64v (GLenum target, GLenum pname, GLint64 *params)
+{
+    TraceRecord record (311, 3);
+    record.Arg (target);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetBufferParameteri64v (target, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_FramebufferTexture (GLenum target, GLenum attachment, GLuint texture, GLint level)
+{
+    TraceRecord record (312, 4);
+    record.Arg (target);
+    record.Arg (attachment);
+    record.Arg (texture);
+    record.Arg (level);
+    TraceNext ().FramebufferTexture (target, attachment, texture, level);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TexImage2DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+    TraceRecord record (313, 6);
+    record.Arg (target);
+    record.Arg (samples);
+    record.Arg (internalformat);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (fixedsamplelocations);
+    TraceNext ().TexImage2DMultisample (target, samples, internalformat, width, height, fixedsamplelocations);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TexImage3DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+    TraceRecord record (314, 7);
+    record.Arg (target);
+    record.Arg (samples);
+    record.Arg (internalformat);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (depth);
+    record.Arg (fixedsamplelocations);
+    TraceNext ().TexImage3DMultisample (target, samples, internalformat, width, height, depth, fixedsamplelocations);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetMultisamplefv (GLenum pname, GLuint index, GLfloat *val)
+{
+    TraceRecord record (315, 3);
+    record.Arg (pname);
+    record.Arg (index);
+    record.Arg (val);
+    TraceNext ().GetMultisamplefv (pname, index, val);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_SampleMaski (GLuint maskNumber, GLbitfield mask)
+{
+    TraceRecord record (316, 2);
+    record.Arg (maskNumber);
+    record.Arg (mask);
+    TraceNext ().SampleMaski (maskNumber, mask);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BindFragDataLocationIndexed (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name)
+{
+    TraceRecord record (317, 4);
+    record.Arg (program);
+    record.Arg (colorNumber);
+    record.Arg (index);
+    record.Arg (name);
+    record.String (3, name, -1);
+    TraceNext ().BindFragDataLocationIndexed (program, colorNumber, index, name);
+    record.Commit ();
+}
+
+static GLint APIENTRY Trace_GetFragDataIndex (GLuint program, const GLchar *name)
+{
+    TraceRecord record (318, 2);
+    record.Arg (program);
+    record.Arg (name);
+    record.String (1, name, -1);
+    GLint result = TraceNext ().GetFragDataIndex (program, name);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_GenSamplers (GLsizei count, GLuint *samplers)
+{
+    TraceRecord record (319, 2);
+    record.Arg (count);
+    record.Arg (samplers);
+    TraceNext ().GenSamplers (count, samplers);
+    record.Blob (1, samplers, count * sizeof (GLuint), true);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DeleteSamplers (GLsizei count, const GLuint *samplers)
+{
+    TraceRecord record (320, 2);
+    record.Arg (count);
+    record.Arg (samplers);
+    record.Blob (1, samplers, count * sizeof (GLuint));
+    TraceNext ().DeleteSamplers (count, samplers);
+    record.Commit ();
+}
+
+static GLboolean APIENTRY Trace_IsSampler (GLuint sampler)
+{
+    TraceRecord record (321, 1);
+    record.Arg (sampler);
+    GLboolean result = TraceNext ().IsSampler (sampler);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_BindSampler (GLuint unit, GLuint sampler)
+{
+    TraceRecord record (322, 2);
+    record.Arg (unit);
+    record.Arg (sampler);
+    TraceNext ().BindSampler (unit, sampler);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_SamplerParameteri (GLuint sampler, GLenum pname, GLint param)
+{
+    TraceRecord record (323, 3);
+    record.Arg (sampler);
+    record.Arg (pname);
+    record.Arg (param);
+    TraceNext ().SamplerParameteri (sampler, pname, param);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_SamplerParameteriv (GLuint sampler, GLenum pname, const GLint *param)
+{
+    TraceRecord record (324, 3);
+    record.Arg (sampler);
+    record.Arg (pname);
+    record.Arg (param);
+    record.Blob (2, param, TraceParameterCount (pname) * sizeof (GLint));
+    TraceNext ().SamplerParameteriv (sampler, pname, param);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_SamplerParameterf (GLuint sampler, GLenum pname, GLfloat param)
+{
+    TraceRecord record (325, 3);
+    record.Arg (sampler);
+    record.Arg (pname);
+    record.Arg (param);
+    TraceNext ().SamplerParameterf (sampler, pname, param);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_SamplerParameterfv (GLuint sampler, GLenum pname, const GLfloat *param)
+{
+    TraceRecord record (326, 3);
+    record.Arg (sampler);
+    record.Arg (pname);
+    record.Arg (param);
+    record.Blob (2, param, TraceParameterCount (pname) * sizeof (GLfloat));
+    TraceNext ().SamplerParameterfv (sampler, pname, param);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_SamplerParameterIiv (GLuint sampler, GLenum pname, const GLint *param)
+{
+    TraceRecord record (327, 3);
+    record.Arg (sampler);
+    record.Arg (pname);
+    record.Arg (param);
+    record.Blob (2, param, TraceParameterCount (pname) * sizeof (GLint));
+    TraceNext ().SamplerParameterIiv (sampler, pname, param);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_SamplerParameterIuiv (GLuint sampler, GLenum pname, const GLuint *param)
+{
+    TraceRecord record (328, 3);
+    record.Arg (sampler);
+    record.Arg (pname);
+    record.Arg (param);
+    record.Blob (2, param, TraceParameterCount (pname) * sizeof (GLuint));
+    TraceNext ().SamplerParameterIuiv (sampler, pname, param);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetSamplerParameteriv (GLuint sampler, GLenum pname, GLint *params)
+{
+    TraceRecord record (329, 3);
+    record.Arg (sampler);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetSamplerParameteriv (sampler, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetSamplerParameterIiv (GLuint sampler, GLenum pname, GLint *params)
+{
+    TraceRecord record (330, 3);
+    record.Arg (sampler);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetSamplerParameterIiv (sampler, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetSamplerParameterfv (GLuint sampler, GLenum pname, GLfloat *params)
+{
+    TraceRecord record (331, 3);
+    record.Arg (sampler);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetSamplerParameterfv (sampler, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetSamplerParameterIuiv (GLuint sampler, GLenum pname, GLuint *params)
+{
+    TraceRecord record (332, 3);
+    record.Arg (sampler);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetSamplerParameterIuiv (sampler, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_QueryCounter (GLuint id, GLenum target)
+{
+    TraceRecord record (333, 2);
+    record.Arg (id);
+    record.Arg (target);
+    TraceNext ().QueryCounter (id, target);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetQueryObjecti64v (GLuint id, GLenum pname, GLint64 *params)
+{
+    TraceRecord record (334, 3);
+    record.Arg (id);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetQueryObjecti64v (id, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetQueryObjectui64v (GLuint id, GLenum pname, GLuint64 *params)
+{
+    TraceRecord record (335, 3);
+    record.Arg (id);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetQueryObjectui64v (id, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribDivisor (GLuint index, GLuint divisor)
+{
+    TraceRecord record (336, 2);
+    record.Arg (index);
+    record.Arg (divisor);
+    TraceNext ().VertexAttribDivisor (index, divisor);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribP1ui (GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    TraceRecord record (337, 4);
+    record.Arg (index);
+    record.Arg (type);
+    record.Arg (normalized);
+    record.Arg (value);
+    TraceNext ().VertexAttribP1ui (index, type, normalized, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribP1uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    TraceRecord record (338, 4);
+    record.Arg (index);
+    record.Arg (type);
+    record.Arg (normalized);
+    record.Arg (value);
+    record.Blob (3, value, sizeof (GLuint));
+    TraceNext ().VertexAttribP1uiv (index, type, normalized, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribP2ui (GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    TraceRecord record (339, 4);
+    record.Arg (index);
+    record.Arg (type);
+    record.Arg (normalized);
+    record.Arg (value);
+    TraceNext ().VertexAttribP2ui (index, type, normalized, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribP2uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    TraceRecord record (340, 4);
+    record.Arg (index);
+    record.Arg (type);
+    record.Arg (normalized);
+    record.Arg (value);
+    record.Blob (3, value, sizeof (GLuint));
+    TraceNext ().VertexAttribP2uiv (index, type, normalized, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribP3ui (GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    TraceRecord record (341, 4);
+    record.Arg (index);
+    record.Arg (type);
+    record.Arg (normalized);
+    record.Arg (value);
+    TraceNext ().VertexAttribP3ui (index, type, normalized, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribP3uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    TraceRecord record (342, 4);
+    record.Arg (index);
+    record.Arg (type);
+    record.Arg (normalized);
+    record.Arg (value);
+    record.Blob (3, value, sizeof (GLuint));
+    TraceNext ().VertexAttribP3uiv (index, type, normalized, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribP4ui (GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+    TraceRecord record (343, 4);
+    record.Arg (index);
+    record.Arg (type);
+    record.Arg (normalized);
+    record.Arg (value);
+    TraceNext ().VertexAttribP4ui (index, type, normalized, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribP4uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+{
+    TraceRecord record (344, 4);
+    record.Arg (index);
+    record.Arg (type);
+    record.Arg (normalized);
+    record.Arg (value);
+    record.Blob (3, value, sizeof (GLuint));
+    TraceNext ().VertexAttribP4uiv (index, type, normalized, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_MinSampleShading (GLfloat value)
+{
+    TraceRecord record (345, 1);
+    record.Arg (value);
+    TraceNext ().MinSampleShading (value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BlendEquationi (GLuint buf, GLenum mode)
+{
+    TraceRecord record (346, 2);
+    record.Arg (buf);
+    record.Arg (mode);
+    TraceNext ().BlendEquationi (buf, mode);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BlendEquationSeparatei (GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+    TraceRecord record (347, 3);
+    record.Arg (buf);
+    record.Arg (modeRGB);
+    record.Arg (modeAlpha);
+    TraceNext ().BlendEquationSeparatei (buf, modeRGB, modeAlpha);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BlendFunci (GLuint buf, GLenum src, GLenum dst)
+{
+    TraceRecord record (348, 3);
+    record.Arg (buf);
+    record.Arg (src);
+    record.Arg (dst);
+    TraceNext ().BlendFunci (buf, src, dst);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BlendFuncSeparatei (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+    TraceRecord record (349, 5);
+    record.Arg (buf);
+    record.Arg (srcRGB);
+    record.Arg (dstRGB);
+    record.Arg (srcAlpha);
+    record.Arg (dstAlpha);
+    TraceNext ().BlendFuncSeparatei (buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DrawArraysIndirect (GLenum mode, const void *indirect)
+{
+    TraceRecord record (350, 2);
+    record.Arg (mode);
+    record.Arg (indirect);
+    TraceNext ().DrawArraysIndirect (mode, indirect);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DrawElementsIndirect (GLenum mode, GLenum type, const void *indirect)
+{
+    TraceRecord record (351, 3);
+    record.Arg (mode);
+    record.Arg (type);
+    record.Arg (indirect);
+    TraceNext ().DrawElementsIndirect (mode, type, indirect);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform1d (GLint location, GLdouble x)
+{
+    TraceRecord record (352, 2);
+    record.Arg (location);
+    record.Arg (x);
+    TraceNext ().Uniform1d (location, x);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform2d (GLint location, GLdouble x, GLdouble y)
+{
+    TraceRecord record (353, 3);
+    record.Arg (location);
+    record.Arg (x);
+    record.Arg (y);
+    TraceNext ().Uniform2d (location, x, y);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform3d (GLint location, GLdouble x, GLdouble y, GLdouble z)
+{
+    TraceRecord record (354, 4);
+    record.Arg (location);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (z);
+    TraceNext ().Uniform3d (location, x, y, z);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform4d (GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    TraceRecord record (355, 5);
+    record.Arg (location);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (z);
+    record.Arg (w);
+    TraceNext ().Uniform4d (location, x, y, z, w);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform1dv (GLint location, GLsizei count, const GLdouble *value)
+{
+    TraceRecord record (356, 3);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (2, value, count * 1 * sizeof (GLdouble));
+    TraceNext ().Uniform1dv (location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform2dv (GLint location, GLsizei count, const GLdouble *value)
+{
+    TraceRecord record (357, 3);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (2, value, count * 2 * sizeof (GLdouble));
+    TraceNext ().Uniform2dv (location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform3dv (GLint location, GLsizei count, const GLdouble *value)
+{
+    TraceRecord record (358, 3);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (2, value, count * 3 * sizeof (GLdouble));
+    TraceNext ().Uniform3dv (location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniform4dv (GLint location, GLsizei count, const GLdouble *value)
+{
+    TraceRecord record (359, 3);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (2, value, count * 4 * sizeof (GLdouble));
+    TraceNext ().Uniform4dv (location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_UniformMatrix2dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    TraceRecord record (360, 4);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (3, value, count * 4 * sizeof (GLdouble));
+    TraceNext ().UniformMatrix2dv (location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_UniformMatrix3dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    TraceRecord record (361, 4);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (3, value, count * 9 * sizeof (GLdouble));
+    TraceNext ().UniformMatrix3dv (location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_UniformMatrix4dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    TraceRecord record (362, 4);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (3, value, count * 16 * sizeof (GLdouble));
+    TraceNext ().UniformMatrix4dv (location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_UniformMatrix2x3dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    TraceRecord record (363, 4);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (3, value, count * 6 * sizeof (GLdouble));
+    TraceNext ().UniformMatrix2x3dv (location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_UniformMatrix2x4dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    TraceRecord record (364, 4);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (3, value, count * 8 * sizeof (GLdouble));
+    TraceNext ().UniformMatrix2x4dv (location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_UniformMatrix3x2dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    TraceRecord record (365, 4);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (3, value, count * 6 * sizeof (GLdouble));
+    TraceNext ().UniformMatrix3x2dv (location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_UniformMatrix3x4dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    TraceRecord record (366, 4);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (3, value, count * 12 * sizeof (GLdouble));
+    TraceNext ().UniformMatrix3x4dv (location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_UniformMatrix4x2dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    TraceRecord record (367, 4);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (3, value, count * 8 * sizeof (GLdouble));
+    TraceNext ().UniformMatrix4x2dv (location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_UniformMatrix4x3dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    TraceRecord record (368, 4);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (3, value, count * 12 * sizeof (GLdouble));
+    TraceNext ().UniformMatrix4x3dv (location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetUniformdv (GLuint program, GLint location, GLdouble *params)
+{
+    TraceRecord record (369, 3);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (params);
+    TraceNext ().GetUniformdv (program, location, params);
+    record.Commit ();
+}
+
+static GLint APIENTRY Trace_GetSubroutineUniformLocation (GLuint program, GLenum shadertype, const GLchar *name)
+{
+    TraceRecord record (370, 3);
+    record.Arg (program);
+    record.Arg (shadertype);
+    record.Arg (name);
+    record.String (2, name, -1);
+    GLint result = TraceNext ().GetSubroutineUniformLocation (program, shadertype, name);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static GLuint APIENTRY Trace_GetSubroutineIndex (GLuint program, GLenum shadertype, const GLchar *name)
+{
+    TraceRecord record (371, 3);
+    record.Arg (program);
+    record.Arg (shadertype);
+    record.Arg (name);
+    record.String (2, name, -1);
+    GLuint result = TraceNext ().GetSubroutineIndex (program, shadertype, name);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_GetActiveSubroutineUniformiv (GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values)
+{
+    TraceRecord record (372, 5);
+    record.Arg (program);
+    record.Arg (shadertype);
+    record.Arg (index);
+    record.Arg (pname);
+    record.Arg (values);
+    TraceNext ().GetActiveSubroutineUniformiv (program, shadertype, index, pname, values);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetActiveSubroutineUniformName (GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name)
+{
+    TraceRecord record (373, 6);
+    record.Arg (program);
+    record.Arg (shadertype);
+    record.Arg (index);
+    record.Arg (bufsize);
+    record.Arg (length);
+    record.Arg (name);
+    TraceNext ().GetActiveSubroutineUniformName (program, shadertype, index, bufsize, length, name);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetActiveSubroutineName (GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name)
+{
+    TraceRecord record (374, 6);
+    record.Arg (program);
+    record.Arg (shadertype);
+    record.Arg (index);
+    record.Arg (bufsize);
+    record.Arg (length);
+    record.Arg (name);
+    TraceNext ().GetActiveSubroutineName (program, shadertype, index, bufsize, length, name);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_UniformSubroutinesuiv (GLenum shadertype, GLsizei count, const GLuint *indices)
+{
+    TraceRecord record (375, 3);
+    record.Arg (shadertype);
+    record.Arg (count);
+    record.Arg (indices);
+    record.Blob (2, indices, count * sizeof (GLuint));
+    TraceNext ().UniformSubroutinesuiv (shadertype, count, indices);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetUniformSubroutineuiv (GLenum shadertype, GLint location, GLuint *params)
+{
+    TraceRecord record (376, 3);
+    record.Arg (shadertype);
+    record.Arg (location);
+    record.Arg (params);
+    TraceNext ().GetUniformSubroutineuiv (shadertype, location, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetProgramStageiv (GLuint program, GLenum shadertype, GLenum pname, GLint *values)
+{
+    TraceRecord record (377, 4);
+    record.Arg (program);
+    record.Arg (shadertype);
+    record.Arg (pname);
+    record.Arg (values);
+    TraceNext ().GetProgramStageiv (program, shadertype, pname, values);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_PatchParameteri (GLenum pname, GLint value)
+{
+    TraceRecord record (378, 2);
+    record.Arg (pname);
+    record.Arg (value);
+    TraceNext ().PatchParameteri (pname, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_PatchParameterfv (GLenum pname, const GLfloat *values)
+{
+    TraceRecord record (379, 2);
+    record.Arg (pname);
+    record.Arg (values);
+    record.Blob (1, values, TraceParameterCount (pname) * sizeof (GLfloat));
+    TraceNext ().PatchParameterfv (pname, values);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BindTransformFeedback (GLenum target, GLuint id)
+{
+    TraceRecord record (380, 2);
+    record.Arg (target);
+    record.Arg (id);
+    TraceNext ().BindTransformFeedback (target, id);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DeleteTransformFeedbacks (GLsizei n, const GLuint *ids)
+{
+    TraceRecord record (381, 2);
+    record.Arg (n);
+    record.Arg (ids);
+    record.Blob (1, ids, n * sizeof (GLuint));
+    TraceNext ().DeleteTransformFeedbacks (n, ids);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GenTransformFeedbacks (GLsizei n, GLuint *ids)
+{
+    TraceRecord record (382, 2);
+    record.Arg (n);
+    record.Arg (ids);
+    TraceNext ().GenTransformFeedbacks (n, ids);
+    record.Blob (1, ids, n * sizeof (GLuint), true);
+    record.Commit ();
+}
+
+static GLboolean APIENTRY Trace_IsTransformFeedback (GLuint id)
+{
+    TraceRecord record (383, 1);
+    record.Arg (id);
+    GLboolean result = TraceNext ().IsTransformFeedback (id);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_PauseTransformFeedback (void)
+{
+    TraceRecord record (384, 0);
+    TraceNext ().PauseTransformFeedback ();
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ResumeTransformFeedback (void)
+{
+    TraceRecord record (385, 0);
+    TraceNext ().ResumeTransformFeedback ();
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DrawTransformFeedback (GLenum mode, GLuint id)
+{
+    TraceRecord record (386, 2);
+    record.Arg (mode);
+    record.Arg (id);
+    TraceNext ().DrawTransformFeedback (mode, id);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DrawTransformFeedbackStream (GLenum mode, GLuint id, GLuint stream)
+{
+    TraceRecord record (387, 3);
+    record.Arg (mode);
+    record.Arg (id);
+    record.Arg (stream);
+    TraceNext ().DrawTransformFeedbackStream (mode, id, stream);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BeginQueryIndexed (GLenum target, GLuint index, GLuint id)
+{
+    TraceRecord record (388, 3);
+    record.Arg (target);
+    record.Arg (index);
+    record.Arg (id);
+    TraceNext ().BeginQueryIndexed (target, index, id);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_EndQueryIndexed (GLenum target, GLuint index)
+{
+    TraceRecord record (389, 2);
+    record.Arg (target);
+    record.Arg (index);
+    TraceNext ().EndQueryIndexed (target, index);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetQueryIndexediv (GLenum target, GLuint index, GLenum pname, GLint *params)
+{
+    TraceRecord record (390, 4);
+    record.Arg (target);
+    record.Arg (index);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetQueryIndexediv (target, index, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ReleaseShaderCompiler (void)
+{
+    TraceRecord record (391, 0);
+    TraceNext ().ReleaseShaderCompiler ();
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ShaderBinary (GLsizei count, const GLuint *shaders, GLenum binaryformat, const void *binary, GLsizei length)
+{
+    TraceRecord record (392, 5);
+    record.Arg (count);
+    record.Arg (shaders);
+    record.Arg (binaryformat);
+    record.Arg (binary);
+    record.Arg (length);
+    record.Blob (1, shaders, count * sizeof (GLuint));
+    record.Blob (3, binary, length);
+    TraceNext ().ShaderBinary (count, shaders, binaryformat, binary, length);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetShaderPrecisionFormat (GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision)
+{
+    TraceRecord record (393, 4);
+    record.Arg (shadertype);
+    record.Arg (precisiontype);
+    record.Arg (range);
+    record.Arg (precision);
+    TraceNext ().GetShaderPrecisionFormat (shadertype, precisiontype, range, precision);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DepthRangef (GLfloat n, GLfloat f)
+{
+    TraceRecord record (394, 2);
+    record.Arg (n);
+    record.Arg (f);
+    TraceNext ().DepthRangef (n, f);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ClearDepthf (GLfloat d)
+{
+    TraceRecord record (395, 1);
+    record.Arg (d);
+    TraceNext ().ClearDepthf (d);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetProgramBinary (GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary)
+{
+    TraceRecord record (396, 5);
+    record.Arg (program);
+    record.Arg (bufSize);
+    record.Arg (length);
+    record.Arg (binaryFormat);
+    record.Arg (binary);
+    TraceNext ().GetProgramBinary (program, bufSize, length, binaryFormat, binary);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramBinary (GLuint program, GLenum binaryFormat, const void *binary, GLsizei length)
+{
+    TraceRecord record (397, 4);
+    record.Arg (program);
+    record.Arg (binaryFormat);
+    record.Arg (binary);
+    record.Arg (length);
+    record.Blob (2, binary, length);
+    TraceNext ().ProgramBinary (program, binaryFormat, binary, length);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramParameteri (GLuint program, GLenum pname, GLint value)
+{
+    TraceRecord record (398, 3);
+    record.Arg (program);
+    record.Arg (pname);
+    record.Arg (value);
+    TraceNext ().ProgramParameteri (program, pname, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_UseProgramStages (GLuint pipeline, GLbitfield stages, GLuint program)
+{
+    TraceRecord record (399, 3);
+    record.Arg (pipeline);
+    record.Arg (stages);
+    record.Arg (program);
+    TraceNext ().UseProgramStages (pipeline, stages, program);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ActiveShaderProgram (GLuint pipeline, GLuint program)
+{
+    TraceRecord record (400, 2);
+    record.Arg (pipeline);
+    record.Arg (program);
+    TraceNext ().ActiveShaderProgram (pipeline, program);
+    record.Commit ();
+}
+
+static GLuint APIENTRY Trace_CreateShaderProgramv (GLenum type, GLsizei count, const GLchar *const*strings)
+{
+    TraceRecord record (401, 3);
+    record.Arg (type);
+    record.Arg (count);
+    record.Arg (strings);
+    record.Strings (2, count, strings, NULL);
+    GLuint result = TraceNext ().CreateShaderProgramv (type, count, strings);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_BindProgramPipeline (GLuint pipeline)
+{
+    TraceRecord record (402, 1);
+    record.Arg (pipeline);
+    TraceNext ().BindProgramPipeline (pipeline);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DeleteProgramPipelines (GLsizei n, const GLuint *pipelines)
+{
+    TraceRecord record (403, 2);
+    record.Arg (n);
+    record.Arg (pipelines);
+    record.Blob (1, pipelines, n * sizeof (GLuint));
+    TraceNext ().DeleteProgramPipelines (n, pipelines);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GenProgramPipelines (GLsizei n, GLuint *pipelines)
+{
+    TraceRecord record (404, 2);
+    record.Arg (n);
+    record.Arg (pipelines);
+    TraceNext ().GenProgramPipelines (n, pipelines);
+    record.Blob (1, pipelines, n * sizeof (GLuint), true);
+    record.Commit ();
+}
+
+static GLboolean APIENTRY Trace_IsProgramPipeline (GLuint pipeline)
+{
+    TraceRecord record (405, 1);
+    record.Arg (pipeline);
+    GLboolean result = TraceNext ().IsProgramPipeline (pipeline);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_GetProgramPipelineiv (GLuint pipeline, GLenum pname, GLint *params)
+{
+    TraceRecord record (406, 3);
+    record.Arg (pipeline);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetProgramPipelineiv (pipeline, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform1i (GLuint program, GLint location, GLint v0)
+{
+    TraceRecord record (407, 3);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (v0);
+    TraceNext ().ProgramUniform1i (program, location, v0);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform1iv (GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+    TraceRecord record (408, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (3, value, count * 1 * sizeof (GLint));
+    TraceNext ().ProgramUniform1iv (program, location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform1f (GLuint program, GLint location, GLfloat v0)
+{
+    TraceRecord record (409, 3);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (v0);
+    TraceNext ().ProgramUniform1f (program, location, v0);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform1fv (GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+    TraceRecord record (410, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (3, value, count * 1 * sizeof (GLfloat));
+    TraceNext ().ProgramUniform1fv (program, location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform1d (GLuint program, GLint location, GLdouble v0)
+{
+    TraceRecord record (411, 3);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (v0);
+    TraceNext ().ProgramUniform1d (program, location, v0);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform1dv (GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+    TraceRecord record (412, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (3, value, count * 1 * sizeof (GLdouble));
+    TraceNext ().ProgramUniform1dv (program, location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform1ui (GLuint program, GLint location, GLuint v0)
+{
+    TraceRecord record (413, 3);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (v0);
+    TraceNext ().ProgramUniform1ui (program, location, v0);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform1uiv (GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+    TraceRecord record (414, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (3, value, count * 1 * sizeof (GLuint));
+    TraceNext ().ProgramUniform1uiv (program, location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform2i (GLuint program, GLint location, GLint v0, GLint v1)
+{
+    TraceRecord record (415, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (v0);
+    record.Arg (v1);
+    TraceNext ().ProgramUniform2i (program, location, v0, v1);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform2iv (GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+    TraceRecord record (416, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (3, value, count * 2 * sizeof (GLint));
+    TraceNext ().ProgramUniform2iv (program, location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform2f (GLuint program, GLint location, GLfloat v0, GLfloat v1)
+{
+    TraceRecord record (417, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (v0);
+    record.Arg (v1);
+    TraceNext ().ProgramUniform2f (program, location, v0, v1);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform2fv (GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+    TraceRecord record (418, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (3, value, count * 2 * sizeof (GLfloat));
+    TraceNext ().ProgramUniform2fv (program, location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform2d (GLuint program, GLint location, GLdouble v0, GLdouble v1)
+{
+    TraceRecord record (419, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (v0);
+    record.Arg (v1);
+    TraceNext ().ProgramUniform2d (program, location, v0, v1);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform2dv (GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+    TraceRecord record (420, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (3, value, count * 2 * sizeof (GLdouble));
+    TraceNext ().ProgramUniform2dv (program, location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform2ui (GLuint program, GLint location, GLuint v0, GLuint v1)
+{
+    TraceRecord record (421, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (v0);
+    record.Arg (v1);
+    TraceNext ().ProgramUniform2ui (program, location, v0, v1);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform2uiv (GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+    TraceRecord record (422, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (3, value, count * 2 * sizeof (GLuint));
+    TraceNext ().ProgramUniform2uiv (program, location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform3i (GLuint program, GLint location, GLint v0, GLint v1, GLint v2)
+{
+    TraceRecord record (423, 5);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (v0);
+    record.Arg (v1);
+    record.Arg (v2);
+    TraceNext ().ProgramUniform3i (program, location, v0, v1, v2);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform3iv (GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+    TraceRecord record (424, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (3, value, count * 3 * sizeof (GLint));
+    TraceNext ().ProgramUniform3iv (program, location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform3f (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    TraceRecord record (425, 5);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (v0);
+    record.Arg (v1);
+    record.Arg (v2);
+    TraceNext ().ProgramUniform3f (program, location, v0, v1, v2);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform3fv (GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+    TraceRecord record (426, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (3, value, count * 3 * sizeof (GLfloat));
+    TraceNext ().ProgramUniform3fv (program, location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform3d (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2)
+{
+    TraceRecord record (427, 5);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (v0);
+    record.Arg (v1);
+    record.Arg (v2);
+    TraceNext ().ProgramUniform3d (program, location, v0, v1, v2);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform3dv (GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+    TraceRecord record (428, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (3, value, count * 3 * sizeof (GLdouble));
+    TraceNext ().ProgramUniform3dv (program, location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform3ui (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+    TraceRecord record (429, 5);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (v0);
+    record.Arg (v1);
+    record.Arg (v2);
+    TraceNext ().ProgramUniform3ui (program, location, v0, v1, v2);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform3uiv (GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+    TraceRecord record (430, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (3, value, count * 3 * sizeof (GLuint));
+    TraceNext ().ProgramUniform3uiv (program, location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform4i (GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    TraceRecord record (431, 6);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (v0);
+    record.Arg (v1);
+    record.Arg (v2);
+    record.Arg (v3);
+    TraceNext ().ProgramUniform4i (program, location, v0, v1, v2, v3);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform4iv (GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+    TraceRecord record (432, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (3, value, count * 4 * sizeof (GLint));
+    TraceNext ().ProgramUniform4iv (program, location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform4f (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+    TraceRecord record (433, 6);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (v0);
+    record.Arg (v1);
+    record.Arg (v2);
+    record.Arg (v3);
+    TraceNext ().ProgramUniform4f (program, location, v0, v1, v2, v3);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform4fv (GLuint program, GLint location, GLsizei count, const GLfloat *value)
+{
+    TraceRecord record (434, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (3, value, count * 4 * sizeof (GLfloat));
+    TraceNext ().ProgramUniform4fv (program, location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform4d (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3)
+{
+    TraceRecord record (435, 6);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (v0);
+    record.Arg (v1);
+    record.Arg (v2);
+    record.Arg (v3);
+    TraceNext ().ProgramUniform4d (program, location, v0, v1, v2, v3);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform4dv (GLuint program, GLint location, GLsizei count, const GLdouble *value)
+{
+    TraceRecord record (436, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (3, value, count * 4 * sizeof (GLdouble));
+    TraceNext ().ProgramUniform4dv (program, location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform4ui (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+    TraceRecord record (437, 6);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (v0);
+    record.Arg (v1);
+    record.Arg (v2);
+    record.Arg (v3);
+    TraceNext ().ProgramUniform4ui (program, location, v0, v1, v2, v3);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniform4uiv (GLuint program, GLint location, GLsizei count, const GLuint *value)
+{
+    TraceRecord record (438, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (3, value, count * 4 * sizeof (GLuint));
+    TraceNext ().ProgramUniform4uiv (program, location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniformMatrix2fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    TraceRecord record (439, 5);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (4, value, count * 4 * sizeof (GLfloat));
+    TraceNext ().ProgramUniformMatrix2fv (program, location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniformMatrix3fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    TraceRecord record (440, 5);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (4, value, count * 9 * sizeof (GLfloat));
+    TraceNext ().ProgramUniformMatrix3fv (program, location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniformMatrix4fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    TraceRecord record (441, 5);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (4, value, count * 16 * sizeof (GLfloat));
+    TraceNext ().ProgramUniformMatrix4fv (program, location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniformMatrix2dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    TraceRecord record (442, 5);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (4, value, count * 4 * sizeof (GLdouble));
+    TraceNext ().ProgramUniformMatrix2dv (program, location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniformMatrix3dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    TraceRecord record (443, 5);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (4, value, count * 9 * sizeof (GLdouble));
+    TraceNext ().ProgramUniformMatrix3dv (program, location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniformMatrix4dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    TraceRecord record (444, 5);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (4, value, count * 16 * sizeof (GLdouble));
+    TraceNext ().ProgramUniformMatrix4dv (program, location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniformMatrix2x3fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    TraceRecord record (445, 5);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (4, value, count * 6 * sizeof (GLfloat));
+    TraceNext ().ProgramUniformMatrix2x3fv (program, location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniformMatrix3x2fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    TraceRecord record (446, 5);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (4, value, count * 6 * sizeof (GLfloat));
+    TraceNext ().ProgramUniformMatrix3x2fv (program, location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniformMatrix2x4fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    TraceRecord record (447, 5);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (4, value, count * 8 * sizeof (GLfloat));
+    TraceNext ().ProgramUniformMatrix2x4fv (program, location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniformMatrix4x2fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    TraceRecord record (448, 5);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (4, value, count * 8 * sizeof (GLfloat));
+    TraceNext ().ProgramUniformMatrix4x2fv (program, location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniformMatrix3x4fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    TraceRecord record (449, 5);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (4, value, count * 12 * sizeof (GLfloat));
+    TraceNext ().ProgramUniformMatrix3x4fv (program, location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniformMatrix4x3fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    TraceRecord record (450, 5);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (4, value, count * 12 * sizeof (GLfloat));
+    TraceNext ().ProgramUniformMatrix4x3fv (program, location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniformMatrix2x3dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    TraceRecord record (451, 5);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (4, value, count * 6 * sizeof (GLdouble));
+    TraceNext ().ProgramUniformMatrix2x3dv (program, location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniformMatrix3x2dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    TraceRecord record (452, 5);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (4, value, count * 6 * sizeof (GLdouble));
+    TraceNext ().ProgramUniformMatrix3x2dv (program, location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniformMatrix2x4dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    TraceRecord record (453, 5);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (4, value, count * 8 * sizeof (GLdouble));
+    TraceNext ().ProgramUniformMatrix2x4dv (program, location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniformMatrix4x2dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    TraceRecord record (454, 5);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (4, value, count * 8 * sizeof (GLdouble));
+    TraceNext ().ProgramUniformMatrix4x2dv (program, location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniformMatrix3x4dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    TraceRecord record (455, 5);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (4, value, count * 12 * sizeof (GLdouble));
+    TraceNext ().ProgramUniformMatrix3x4dv (program, location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniformMatrix4x3dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+{
+    TraceRecord record (456, 5);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (transpose);
+    record.Arg (value);
+    record.Blob (4, value, count * 12 * sizeof (GLdouble));
+    TraceNext ().ProgramUniformMatrix4x3dv (program, location, count, transpose, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ValidateProgramPipeline (GLuint pipeline)
+{
+    TraceRecord record (457, 1);
+    record.Arg (pipeline);
+    TraceNext ().ValidateProgramPipeline (pipeline);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetProgramPipelineInfoLog (GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    TraceRecord record (458, 4);
+    record.Arg (pipeline);
+    record.Arg (bufSize);
+    record.Arg (length);
+    record.Arg (infoLog);
+    TraceNext ().GetProgramPipelineInfoLog (pipeline, bufSize, length, infoLog);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribL1d (GLuint index, GLdouble x)
+{
+    TraceRecord record (459, 2);
+    record.Arg (index);
+    record.Arg (x);
+    TraceNext ().VertexAttribL1d (index, x);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribL2d (GLuint index, GLdouble x, GLdouble y)
+{
+    TraceRecord record (460, 3);
+    record.Arg (index);
+    record.Arg (x);
+    record.Arg (y);
+    TraceNext ().VertexAttribL2d (index, x, y);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribL3d (GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+    TraceRecord record (461, 4);
+    record.Arg (index);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (z);
+    TraceNext ().VertexAttribL3d (index, x, y, z);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribL4d (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    TraceRecord record (462, 5);
+    record.Arg (index);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (z);
+    record.Arg (w);
+    TraceNext ().VertexAttribL4d (index, x, y, z, w);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribL1dv (GLuint index, const GLdouble *v)
+{
+    TraceRecord record (463, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 1 * sizeof (GLdouble));
+    TraceNext ().VertexAttribL1dv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribL2dv (GLuint index, const GLdouble *v)
+{
+    TraceRecord record (464, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 2 * sizeof (GLdouble));
+    TraceNext ().VertexAttribL2dv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribL3dv (GLuint index, const GLdouble *v)
+{
+    TraceRecord record (465, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 3 * sizeof (GLdouble));
+    TraceNext ().VertexAttribL3dv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribL4dv (GLuint index, const GLdouble *v)
+{
+    TraceRecord record (466, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 4 * sizeof (GLdouble));
+    TraceNext ().VertexAttribL4dv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribLPointer (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+    TraceRecord record (467, 5);
+    record.Arg (index);
+    record.Arg (size);
+    record.Arg (type);
+    record.Arg (stride);
+    record.Arg (pointer);
+    TraceNext ().VertexAttribLPointer (index, size, type, stride, pointer);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetVertexAttribLdv (GLuint index, GLenum pname, GLdouble *params)
+{
+    TraceRecord record (468, 3);
+    record.Arg (index);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetVertexAttribLdv (index, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ViewportArrayv (GLuint first, GLsizei count, const GLfloat *v)
+{
+    TraceRecord record (469, 3);
+    record.Arg (first);
+    record.Arg (count);
+    record.Arg (v);
+    record.Blob (2, v, count * 4 * sizeof (GLfloat));
+    TraceNext ().ViewportArrayv (first, count, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ViewportIndexedf (GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h)
+{
+    TraceRecord record (470, 5);
+    record.Arg (index);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (w);
+    record.Arg (h);
+    TraceNext ().ViewportIndexedf (index, x, y, w, h);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ViewportIndexedfv (GLuint index, const GLfloat *v)
+{
+    TraceRecord record (471, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 4 * sizeof (GLfloat));
+    TraceNext ().ViewportIndexedfv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ScissorArrayv (GLuint first, GLsizei count, const GLint *v)
+{
+    TraceRecord record (472, 3);
+    record.Arg (first);
+    record.Arg (count);
+    record.Arg (v);
+    record.Blob (2, v, count * 4 * sizeof (GLint));
+    TraceNext ().ScissorArrayv (first, count, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ScissorIndexed (GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height)
+{
+    TraceRecord record (473, 5);
+    record.Arg (index);
+    record.Arg (left);
+    record.Arg (bottom);
+    record.Arg (width);
+    record.Arg (height);
+    TraceNext ().ScissorIndexed (index, left, bottom, width, height);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ScissorIndexedv (GLuint index, const GLint *v)
+{
+    TraceRecord record (474, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 4 * sizeof (GLint));
+    TraceNext ().ScissorIndexedv (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DepthRangeArrayv (GLuint first, GLsizei count, const GLdouble *v)
+{
+    TraceRecord record (475, 3);
+    record.Arg (first);
+    record.Arg (count);
+    record.Arg (v);
+    record.Blob (2, v, count * 2 * sizeof (GLdouble));
+    TraceNext ().DepthRangeArrayv (first, count, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DepthRangeIndexed (GLuint index, GLdouble n, GLdouble f)
+{
+    TraceRecord record (476, 3);
+    record.Arg (index);
+    record.Arg (n);
+    record.Arg (f);
+    TraceNext ().DepthRangeIndexed (index, n, f);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetFloati_v (GLenum target, GLuint index, GLfloat *data)
+{
+    TraceRecord record (477, 3);
+    record.Arg (target);
+    record.Arg (index);
+    record.Arg (data);
+    TraceNext ().GetFloati_v (target, index, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetDoublei_v (GLenum target, GLuint index, GLdouble *data)
+{
+    TraceRecord record (478, 3);
+    record.Arg (target);
+    record.Arg (index);
+    record.Arg (data);
+    TraceNext ().GetDoublei_v (target, index, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DrawArraysInstancedBaseInstance (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance)
+{
+    TraceRecord record (479, 5);
+    record.Arg (mode);
+    record.Arg (first);
+    record.Arg (count);
+    record.Arg (instancecount);
+    record.Arg (baseinstance);
+    TraceNext ().DrawArraysInstancedBaseInstance (mode, first, count, instancecount, baseinstance);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DrawElementsInstancedBaseInstance (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance)
+{
+    TraceRecord record (480, 6);
+    record.Arg (mode);
+    record.Arg (count);
+    record.Arg (type);
+    record.Arg (indices);
+    record.Arg (instancecount);
+    record.Arg (baseinstance);
+    TraceNext ().DrawElementsInstancedBaseInstance (mode, count, type, indices, instancecount, baseinstance);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DrawElementsInstancedBaseVertexBaseInstance (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance)
+{
+    TraceRecord record (481, 7);
+    record.Arg (mode);
+    record.Arg (count);
+    record.Arg (type);
+    record.Arg (indices);
+    record.Arg (instancecount);
+    record.Arg (basevertex);
+    record.Arg (baseinstance);
+    TraceNext ().DrawElementsInstancedBaseVertexBaseInstance (mode, count, type, indices, instancecount, basevertex, baseinstance);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetInternalformativ (GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint *params)
+{
+    TraceRecord record (482, 5);
+    record.Arg (target);
+    record.Arg (internalformat);
+    record.Arg (pname);
+    record.Arg (bufSize);
+    record.Arg (params);
+    TraceNext ().GetInternalformativ (target, internalformat, pname, bufSize, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetActiveAtomicCounterBufferiv (GLuint program, GLuint bufferIndex, GLenum pname, GLint *params)
+{
+    TraceRecord record (483, 4);
+    record.Arg (program);
+    record.Arg (bufferIndex);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetActiveAtomicCounterBufferiv (program, bufferIndex, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BindImageTexture (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format)
+{
+    TraceRecord record (484, 7);
+    record.Arg (unit);
+    record.Arg (texture);
+    record.Arg (level);
+    record.Arg (layered);
+    record.Arg (layer);
+    record.Arg (access);
+    record.Arg (format);
+    TraceNext ().BindImageTexture (unit, texture, level, layered, layer, access, format);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_MemoryBarrier (GLbitfield barriers)
+{
+    TraceRecord record (485, 1);
+    record.Arg (barriers);
+    TraceNext ().MemoryBarrier (barriers);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TexStorage1D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width)
+{
+    TraceRecord record (486, 4);
+    record.Arg (target);
+    record.Arg (levels);
+    record.Arg (internalformat);
+    record.Arg (width);
+    TraceNext ().TexStorage1D (target, levels, internalformat, width);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TexStorage2D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    TraceRecord record (487, 5);
+    record.Arg (target);
+    record.Arg (levels);
+    record.Arg (internalformat);
+    record.Arg (width);
+    record.Arg (height);
+    TraceNext ().TexStorage2D (target, levels, internalformat, width, height);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TexStorage3D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+    TraceRecord record (488, 6);
+    record.Arg (target);
+    record.Arg (levels);
+    record.Arg (internalformat);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (depth);
+    TraceNext ().TexStorage3D (target, levels, internalformat, width, height, depth);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DrawTransformFeedbackInstanced (GLenum mode, GLuint id, GLsizei instancecount)
+{
+    TraceRecord record (489, 3);
+    record.Arg (mode);
+    record.Arg (id);
+    record.Arg (instancecount);
+    TraceNext ().DrawTransformFeedbackInstanced (mode, id, instancecount);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DrawTransformFeedbackStreamInstanced (GLenum mode, GLuint id, GLuint stream, GLsizei instancecount)
+{
+    TraceRecord record (490, 4);
+    record.Arg (mode);
+    record.Arg (id);
+    record.Arg (stream);
+    record.Arg (instancecount);
+    TraceNext ().DrawTransformFeedbackStreamInstanced (mode, id, stream, instancecount);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ClearBufferData (GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data)
+{
+    TraceRecord record (491, 5);
+    record.Arg (target);
+    record.Arg (internalformat);
+    record.Arg (format);
+    record.Arg (type);
+    record.Arg (data);
+    record.Pixel (4, data, format, type);
+    TraceNext ().ClearBufferData (target, internalformat, format, type, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ClearBufferSubData (GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data)
+{
+    TraceRecord record (492, 7);
+    record.Arg (target);
+    record.Arg (internalformat);
+    record.Arg (offset);
+    record.Arg (size);
+    record.Arg (format);
+    record.Arg (type);
+    record.Arg (data);
+    record.Pixel (6, data, format, type);
+    TraceNext ().ClearBufferSubData (target, internalformat, offset, size, format, type, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DispatchCompute (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z)
+{
+    TraceRecord record (493, 3);
+    record.Arg (num_groups_x);
+    record.Arg (num_groups_y);
+    record.Arg (num_groups_z);
+    TraceNext ().DispatchCompute (num_groups_x, num_groups_y, num_groups_z);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DispatchComputeIndirect (GLintptr indirect)
+{
+    TraceRecord record (494, 1);
+    record.Arg (indirect);
+    TraceNext ().DispatchComputeIndirect (indirect);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CopyImageSubData (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth)
+{
+    TraceRecord record (495, 15);
+    record.Arg (srcName);
+    record.Arg (srcTarget);
+    record.Arg (srcLevel);
+    record.Arg (srcX);
+    record.Arg (srcY);
+    record.Arg (srcZ);
+    record.Arg (dstName);
+    record.Arg (dstTarget);
+    record.Arg (dstLevel);
+    record.Arg (dstX);
+    record.Arg (dstY);
+    record.Arg (dstZ);
+    record.Arg (srcWidth);
+    record.Arg (srcHeight);
+    record.Arg (srcDepth);
+    TraceNext ().CopyImageSubData (srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_FramebufferParameteri (GLenum target, GLenum pname, GLint param)
+{
+    TraceRecord record (496, 3);
+    record.Arg (target);
+    record.Arg (pname);
+    record.Arg (param);
+    TraceNext ().FramebufferParameteri (target, pname, param);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetFramebufferParameteriv (GLenum target, GLenum pname, GLint *params)
+{
+    TraceRecord record (497, 3);
+    record.Arg (target);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetFramebufferParameteriv (target, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetInternalformati64v (GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint64 *params)
+{
+    TraceRecord record (498, 5);
+    record.Arg (target);
+    record.Arg (internalformat);
+    record.Arg (pname);
+    record.Arg (bufSize);
+    record.Arg (params);
+    TraceNext ().GetInternalformati64v (target, internalformat, pname, bufSize, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_InvalidateTexSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth)
+{
+    TraceRecord record (499, 8);
+    record.Arg (texture);
+    record.Arg (level);
+    record.Arg (xoffset);
+    record.Arg (yoffset);
+    record.Arg (zoffset);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (depth);
+    TraceNext ().InvalidateTexSubImage (texture, level, xoffset, yoffset, zoffset, width, height, depth);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_InvalidateTexImage (GLuint texture, GLint level)
+{
+    TraceRecord record (500, 2);
+    record.Arg (texture);
+    record.Arg (level);
+    TraceNext ().InvalidateTexImage (texture, level);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_InvalidateBufferSubData (GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+    TraceRecord record (501, 3);
+    record.Arg (buffer);
+    record.Arg (offset);
+    record.Arg (length);
+    TraceNext ().InvalidateBufferSubData (buffer, offset, length);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_InvalidateBufferData (GLuint buffer)
+{
+    TraceRecord record (502, 1);
+    record.Arg (buffer);
+    TraceNext ().InvalidateBufferData (buffer);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_InvalidateFramebuffer (GLenum target, GLsizei numAttachments, const GLenum *attachments)
+{
+    TraceRecord record (503, 3);
+    record.Arg (target);
+    record.Arg (numAttachments);
+    record.Arg (attachments);
+    record.Blob (2, attachments, numAttachments * sizeof (GLenum));
+    TraceNext ().InvalidateFramebuffer (target, numAttachments, attachments);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_InvalidateSubFramebuffer (GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    TraceRecord record (504, 7);
+    record.Arg (target);
+    record.Arg (numAttachments);
+    record.Arg (attachments);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (width);
+    record.Arg (height);
+    record.Blob (2, attachments, numAttachments * sizeof (GLenum));
+    TraceNext ().InvalidateSubFramebuffer (target, numAttachments, attachments, x, y, width, height);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_MultiDrawArraysIndirect (GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride)
+{
+    TraceRecord record (505, 4);
+    record.Arg (mode);
+    record.Arg (indirect);
+    record.Arg (drawcount);
+    record.Arg (stride);
+    TraceNext ().MultiDrawArraysIndirect (mode, indirect, drawcount, stride);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_MultiDrawElementsIndirect (GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride)
+{
+    TraceRecord record (506, 5);
+    record.Arg (mode);
+    record.Arg (type);
+    record.Arg (indirect);
+    record.Arg (drawcount);
+    record.Arg (stride);
+    TraceNext ().MultiDrawElementsIndirect (mode, type, indirect, drawcount, stride);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetProgramInterfaceiv (GLuint program, GLenum programInterface, GLenum pname, GLint *params)
+{
+    TraceRecord record (507, 4);
+    record.Arg (program);
+    record.Arg (programInterface);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetProgramInterfaceiv (program, programInterface, pname, params);
+    record.Commit ();
+}
+
+static GLuint APIENTRY Trace_GetProgramResourceIndex (GLuint program, GLenum programInterface, const GLchar *name)
+{
+    TraceRecord record (508, 3);
+    record.Arg (program);
+    record.Arg (programInterface);
+    record.Arg (name);
+    record.String (2, name, -1);
+    GLuint result = TraceNext ().GetProgramResourceIndex (program, programInterface, name);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_GetProgramResourceName (GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name)
+{
+    TraceRecord record (509, 6);
+    record.Arg (program);
+    record.Arg (programInterface);
+    record.Arg (index);
+    record.Arg (bufSize);
+    record.Arg (length);
+    record.Arg (name);
+    TraceNext ().GetProgramResourceName (program, programInterface, index, bufSize, length, name);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetProgramResourceiv (GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei bufSize, GLsizei *length, GLint *params)
+{
+    TraceRecord record (510, 8);
+    record.Arg (program);
+    record.Arg (programInterface);
+    record.Arg (index);
+    record.Arg (propCount);
+    record.Arg (props);
+    record.Arg (bufSize);
+    record.Arg (length);
+    record.Arg (params);
+    record.Blob (4, props, propCount * sizeof (GLenum));
+    TraceNext ().GetProgramResourceiv (program, programInterface, index, propCount, props, bufSize, length, params);
+    record.Commit ();
+}
+
+static GLint APIENTRY Trace_GetProgramResourceLocation (GLuint program, GLenum programInterface, const GLchar *name)
+{
+    TraceRecord record (511, 3);
+    record.Arg (program);
+    record.Arg (programInterface);
+    record.Arg (name);
+    record.String (2, name, -1);
+    GLint result = TraceNext ().GetProgramResourceLocation (program, programInterface, name);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static GLint APIENTRY Trace_GetProgramResourceLocationIndex (GLuint program, GLenum programInterface, const GLchar *name)
+{
+    TraceRecord record (512, 3);
+    record.Arg (program);
+    record.Arg (programInterface);
+    record.Arg (name);
+    record.String (2, name, -1);
+    GLint result = TraceNext ().GetProgramResourceLocationIndex (program, programInterface, name);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_ShaderStorageBlockBinding (GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding)
+{
+    TraceRecord record (513, 3);
+    record.Arg (program);
+    record.Arg (storageBlockIndex);
+    record.Arg (storageBlockBinding);
+    TraceNext ().ShaderStorageBlockBinding (program, storageBlockIndex, storageBlockBinding);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TexBufferRange (GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    TraceRecord record (514, 5);
+    record.Arg (target);
+    record.Arg (internalformat);
+    record.Arg (buffer);
+    record.Arg (offset);
+    record.Arg (size);
+    TraceNext ().TexBufferRange (target, internalformat, buffer, offset, size);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TexStorage2DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+    TraceRecord record (515, 6);
+    record.Arg (target);
+    record.Arg (samples);
+    record.Arg (internalformat);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (fixedsamplelocations);
+    TraceNext ().TexStorage2DMultisample (target, samples, internalformat, width, height, fixedsamplelocations);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TexStorage3DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+    TraceRecord record (516, 7);
+    record.Arg (target);
+    record.Arg (samples);
+    record.Arg (internalformat);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (depth);
+    record.Arg (fixedsamplelocations);
+    TraceNext ().TexStorage3DMultisample (target, samples, internalformat, width, height, depth, fixedsamplelocations);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TextureView (GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers)
+{
+    TraceRecord record (517, 8);
+    record.Arg (texture);
+    record.Arg (target);
+    record.Arg (origtexture);
+    record.Arg (internalformat);
+    record.Arg (minlevel);
+    record.Arg (numlevels);
+    record.Arg (minlayer);
+    record.Arg (numlayers);
+    TraceNext ().TextureView (texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BindVertexBuffer (GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+    TraceRecord record (518, 4);
+    record.Arg (bindingindex);
+    record.Arg (buffer);
+    record.Arg (offset);
+    record.Arg (stride);
+    TraceNext ().BindVertexBuffer (bindingindex, buffer, offset, stride);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribFormat (GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
+{
+    TraceRecord record (519, 5);
+    record.Arg (attribindex);
+    record.Arg (size);
+    record.Arg (type);
+    record.Arg (normalized);
+    record.Arg (relativeoffset);
+    TraceNext ().VertexAttribFormat (attribindex, size, type, normalized, relativeoffset);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribIFormat (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    TraceRecord record (520, 4);
+    record.Arg (attribindex);
+    record.Arg (size);
+    record.Arg (type);
+    record.Arg (relativeoffset);
+    TraceNext ().VertexAttribIFormat (attribindex, size, type, relativeoffset);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribLFormat (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    TraceRecord record (521, 4);
+    record.Arg (attribindex);
+    record.Arg (size);
+    record.Arg (type);
+    record.Arg (relativeoffset);
+    TraceNext ().VertexAttribLFormat (attribindex, size, type, relativeoffset);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribBinding (GLuint attribindex, GLuint bindingindex)
+{
+    TraceRecord record (522, 2);
+    record.Arg (attribindex);
+    record.Arg (bindingindex);
+    TraceNext ().VertexAttribBinding (attribindex, bindingindex);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexBindingDivisor (GLuint bindingindex, GLuint divisor)
+{
+    TraceRecord record (523, 2);
+    record.Arg (bindingindex);
+    record.Arg (divisor);
+    TraceNext ().VertexBindingDivisor (bindingindex, divisor);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DebugMessageControl (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled)
+{
+    TraceRecord record (524, 6);
+    record.Arg (source);
+    record.Arg (type);
+    record.Arg (severity);
+    record.Arg (count);
+    record.Arg (ids);
+    record.Arg (enabled);
+    record.Blob (4, ids, count * sizeof (GLuint));
+    TraceNext ().DebugMessageControl (source, type, severity, count, ids, enabled);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DebugMessageInsert (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf)
+{
+    TraceRecord record (525, 6);
+    record.Arg (source);
+    record.Arg (type);
+    record.Arg (id);
+    record.Arg (severity);
+    record.Arg (length);
+    record.Arg (buf);
+    record.String (5, buf, length);
+    TraceNext ().DebugMessageInsert (source, type, id, severity, length, buf);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DebugMessageCallback (GLDEBUGPROC callback, const void *userParam)
+{
+    TraceRecord record (526, 2);
+    record.Arg (callback);
+    record.Arg (userParam);
+    TraceNext ().DebugMessageCallback (callback, userParam);
+    record.Commit ();
+}
+
+static GLuint APIENTRY Trace_GetDebugMessageLog (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog)
+{
+    TraceRecord record (527, 8);
+    record.Arg (count);
+    record.Arg (bufSize);
+    record.Arg (sources);
+    record.Arg (types);
+    record.Arg (ids);
+    record.Arg (severities);
+    record.Arg (lengths);
+    record.Arg (messageLog);
+    GLuint result = TraceNext ().GetDebugMessageLog (count, bufSize, sources, types, ids, severities, lengths, messageLog);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_PushDebugGroup (GLenum source, GLuint id, GLsizei length, const GLchar *message)
+{
+    TraceRecord record (528, 4);
+    record.Arg (source);
+    record.Arg (id);
+    record.Arg (length);
+    record.Arg (message);
+    record.String (3, message, length);
+    TraceNext ().PushDebugGroup (source, id, length, message);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_PopDebugGroup (void)
+{
+    TraceRecord record (529, 0);
+    TraceNext ().PopDebugGroup ();
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ObjectLabel (GLenum identifier, GLuint name, GLsizei length, const GLchar *label)
+{
+    TraceRecord record (530, 4);
+    record.Arg (identifier);
+    record.Arg (name);
+    record.Arg (length);
+    record.Arg (label);
+    record.String (3, label, length);
+    TraceNext ().ObjectLabel (identifier, name, length, label);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetObjectLabel (GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label)
+{
+    TraceRecord record (531, 5);
+    record.Arg (identifier);
+    record.Arg (name);
+    record.Arg (bufSize);
+    record.Arg (length);
+    record.Arg (label);
+    TraceNext ().GetObjectLabel (identifier, name, bufSize, length, label);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ObjectPtrLabel (const void *ptr, GLsizei length, const GLchar *label)
+{
+    TraceRecord record (532, 3);
+    record.Arg (ptr);
+    record.Arg (length);
+    record.Arg (label);
+    record.String (2, label, length);
+    TraceNext ().ObjectPtrLabel (ptr, length, label);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetObjectPtrLabel (const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label)
+{
+    TraceRecord record (533, 4);
+    record.Arg (ptr);
+    record.Arg (bufSize);
+    record.Arg (length);
+    record.Arg (label);
+    TraceNext ().GetObjectPtrLabel (ptr, bufSize, length, label);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BufferStorage (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags)
+{
+    TraceRecord record (534, 4);
+    record.Arg (target);
+    record.Arg (size);
+    record.Arg (data);
+    record.Arg (flags);
+    record.Blob (2, data, size);
+    TraceNext ().BufferStorage (target, size, data, flags);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ClearTexImage (GLuint texture, GLint level, GLenum format, GLenum type, const void *data)
+{
+    TraceRecord record (535, 5);
+    record.Arg (texture);
+    record.Arg (level);
+    record.Arg (format);
+    record.Arg (type);
+    record.Arg (data);
+    record.Pixel (4, data, format, type);
+    TraceNext ().ClearTexImage (texture, level, format, type, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ClearTexSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data)
+{
+    TraceRecord record (536, 11);
+    record.Arg (texture);
+    record.Arg (level);
+    record.Arg (xoffset);
+    record.Arg (yoffset);
+    record.Arg (zoffset);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (depth);
+    record.Arg (format);
+    record.Arg (type);
+    record.Arg (data);
+    record.Pixel (10, data, format, type);
+    TraceNext ().ClearTexSubImage (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BindBuffersBase (GLenum target, GLuint first, GLsizei count, const GLuint *buffers)
+{
+    TraceRecord record (537, 4);
+    record.Arg (target);
+    record.Arg (first);
+    record.Arg (count);
+    record.Arg (buffers);
+    record.Blob (3, buffers, count * sizeof (GLuint));
+    TraceNext ().BindBuffersBase (target, first, count, buffers);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BindBuffersRange (GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes)
+{
+    TraceRecord record (538, 6);
+    record.Arg (target);
+    record.Arg (first);
+    record.Arg (count);
+    record.Arg (buffers);
+    record.Arg (offsets);
+    record.Arg (sizes);
+    record.Blob (3, buffers, count * sizeof (GLuint));
+    record.Blob (4, offsets, count * sizeof (GLintptr));
+    record.Blob (5, sizes, count * sizeof (GLsizeiptr));
+    TraceNext ().BindBuffersRange (target, first, count, buffers, offsets, sizes);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BindTextures (GLuint first, GLsizei count, const GLuint *textures)
+{
+    TraceRecord record (539, 3);
+    record.Arg (first);
+    record.Arg (count);
+    record.Arg (textures);
+    record.Blob (2, textures, count * sizeof (GLuint));
+    TraceNext ().BindTextures (first, count, textures);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BindSamplers (GLuint first, GLsizei count, const GLuint *samplers)
+{
+    TraceRecord record (540, 3);
+    record.Arg (first);
+    record.Arg (count);
+    record.Arg (samplers);
+    record.Blob (2, samplers, count * sizeof (GLuint));
+    TraceNext ().BindSamplers (first, count, samplers);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BindImageTextures (GLuint first, GLsizei count, const GLuint *textures)
+{
+    TraceRecord record (541, 3);
+    record.Arg (first);
+    record.Arg (count);
+    record.Arg (textures);
+    record.Blob (2, textures, count * sizeof (GLuint));
+    TraceNext ().BindImageTextures (first, count, textures);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BindVertexBuffers (GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides)
+{
+    TraceRecord record (542, 5);
+    record.Arg (first);
+    record.Arg (count);
+    record.Arg (buffers);
+    record.Arg (offsets);
+    record.Arg (strides);
+    record.Blob (2, buffers, count * sizeof (GLuint));
+    record.Blob (3, offsets, count * sizeof (GLintptr));
+    record.Blob (4, strides, count * sizeof (GLsizei));
+    TraceNext ().BindVertexBuffers (first, count, buffers, offsets, strides);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ClipControl (GLenum origin, GLenum depth)
+{
+    TraceRecord record (543, 2);
+    record.Arg (origin);
+    record.Arg (depth);
+    TraceNext ().ClipControl (origin, depth);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CreateTransformFeedbacks (GLsizei n, GLuint *ids)
+{
+    TraceRecord record (544, 2);
+    record.Arg (n);
+    record.Arg (ids);
+    TraceNext ().CreateTransformFeedbacks (n, ids);
+    record.Blob (1, ids, n * sizeof (GLuint), true);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TransformFeedbackBufferBase (GLuint xfb, GLuint index, GLuint buffer)
+{
+    TraceRecord record (545, 3);
+    record.Arg (xfb);
+    record.Arg (index);
+    record.Arg (buffer);
+    TraceNext ().TransformFeedbackBufferBase (xfb, index, buffer);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TransformFeedbackBufferRange (GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    TraceRecord record (546, 5);
+    record.Arg (xfb);
+    record.Arg (index);
+    record.Arg (buffer);
+    record.Arg (offset);
+    record.Arg (size);
+    TraceNext ().TransformFeedbackBufferRange (xfb, index, buffer, offset, size);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetTransformFeedbackiv (GLuint xfb, GLenum pname, GLint *param)
+{
+    TraceRecord record (547, 3);
+    record.Arg (xfb);
+    record.Arg (pname);
+    record.Arg (param);
+    TraceNext ().GetTransformFeedbackiv (xfb, pname, param);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetTransformFeedbacki_v (GLuint xfb, GLenum pname, GLuint index, GLint *param)
+{
+    TraceRecord record (548, 4);
+    record.Arg (xfb);
+    record.Arg (pname);
+    record.Arg (index);
+    record.Arg (param);
+    TraceNext ().GetTransformFeedbacki_v (xfb, pname, index, param);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetTransformFeedbacki64_v (GLuint xfb, GLenum pname, GLuint index, GLint64 *param)
+{
+    TraceRecord record (549, 4);
+    record.Arg (xfb);
+    record.Arg (pname);
+    record.Arg (index);
+    record.Arg (param);
+    TraceNext ().GetTransformFeedbacki64_v (xfb, pname, index, param);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CreateBuffers (GLsizei n, GLuint *buffers)
+{
+    TraceRecord record (550, 2);
+    record.Arg (n);
+    record.Arg (buffers);
+    TraceNext ().CreateBuffers (n, buffers);
+    record.Blob (1, buffers, n * sizeof (GLuint), true);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_NamedBufferStorage (GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags)
+{
+    TraceRecord record (551, 4);
+    record.Arg (buffer);
+    record.Arg (size);
+    record.Arg (data);
+    record.Arg (flags);
+    record.Blob (2, data, size);
+    TraceNext ().NamedBufferStorage (buffer, size, data, flags);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_NamedBufferData (GLuint buffer, GLsizeiptr size, const void *data, GLenum usage)
+{
+    TraceRecord record (552, 4);
+    record.Arg (buffer);
+    record.Arg (size);
+    record.Arg (data);
+    record.Arg (usage);
+    record.Blob (2, data, size);
+    TraceNext ().NamedBufferData (buffer, size, data, usage);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_NamedBufferSubData (GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    TraceRecord record (553, 4);
+    record.Arg (buffer);
+    record.Arg (offset);
+    record.Arg (size);
+    record.Arg (data);
+    record.Blob (3, data, size);
+    TraceNext ().NamedBufferSubData (buffer, offset, size, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CopyNamedBufferSubData (GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+    TraceRecord record (554, 5);
+    record.Arg (readBuffer);
+    record.Arg (writeBuffer);
+    record.Arg (readOffset);
+    record.Arg (writeOffset);
+    record.Arg (size);
+    TraceNext ().CopyNamedBufferSubData (readBuffer, writeBuffer, readOffset, writeOffset, size);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ClearNamedBufferData (GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data)
+{
+    TraceRecord record (555, 5);
+    record.Arg (buffer);
+    record.Arg (internalformat);
+    record.Arg (format);
+    record.Arg (type);
+    record.Arg (data);
+    record.Pixel (4, data, format, type);
+    TraceNext ().ClearNamedBufferData (buffer, internalformat, format, type, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ClearNamedBufferSubData (GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data)
+{
+    TraceRecord record (556, 7);
+    record.Arg (buffer);
+    record.Arg (internalformat);
+    record.Arg (offset);
+    record.Arg (size);
+    record.Arg (format);
+    record.Arg (type);
+    record.Arg (data);
+    record.Pixel (6, data, format, type);
+    TraceNext ().ClearNamedBufferSubData (buffer, internalformat, offset, size, format, type, data);
+    record.Commit ();
+}
+
+static void * APIENTRY Trace_MapNamedBuffer (GLuint buffer, GLenum access)
+{
+    TraceRecord record (557, 2);
+    record.Arg (buffer);
+    record.Arg (access);
+    void * result = TraceNext ().MapNamedBuffer (buffer, access);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void * APIENTRY Trace_MapNamedBufferRange (GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    TraceRecord record (558, 4);
+    record.Arg (buffer);
+    record.Arg (offset);
+    record.Arg (length);
+    record.Arg (access);
+    void * result = TraceNext ().MapNamedBufferRange (buffer, offset, length, access);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static GLboolean APIENTRY Trace_UnmapNamedBuffer (GLuint buffer)
+{
+    TraceRecord record (559, 1);
+    record.Arg (buffer);
+    GLboolean result = TraceNext ().UnmapNamedBuffer (buffer);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_FlushMappedNamedBufferRange (GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+    TraceRecord record (560, 3);
+    record.Arg (buffer);
+    record.Arg (offset);
+    record.Arg (length);
+    TraceNext ().FlushMappedNamedBufferRange (buffer, offset, length);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetNamedBufferParameteriv (GLuint buffer, GLenum pname, GLint *params)
+{
+    TraceRecord record (561, 3);
+    record.Arg (buffer);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetNamedBufferParameteriv (buffer, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetNamedBufferParameteri64v (GLuint buffer, GLenum pname, GLint64 *params)
+{
+    TraceRecord record (562, 3);
+    record.Arg (buffer);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetNamedBufferParameteri64v (buffer, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetNamedBufferPointerv (GLuint buffer, GLenum pname, void **params)
+{
+    TraceRecord record (563, 3);
+    record.Arg (buffer);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetNamedBufferPointerv (buffer, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetNamedBufferSubData (GLuint buffer, GLintptr offset, GLsizeiptr size, void *data)
+{
+    TraceRecord record (564, 4);
+    record.Arg (buffer);
+    record.Arg (offset);
+    record.Arg (size);
+    record.Arg (data);
+    TraceNext ().GetNamedBufferSubData (buffer, offset, size, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CreateFramebuffers (GLsizei n, GLuint *framebuffers)
+{
+    TraceRecord record (565, 2);
+    record.Arg (n);
+    record.Arg (framebuffers);
+    TraceNext ().CreateFramebuffers (n, framebuffers);
+    record.Blob (1, framebuffers, n * sizeof (GLuint), true);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_NamedFramebufferRenderbuffer (GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+    TraceRecord record (566, 4);
+    record.Arg (framebuffer);
+    record.Arg (attachment);
+    record.Arg (renderbuffertarget);
+    record.Arg (renderbuffer);
+    TraceNext ().NamedFramebufferRenderbuffer (framebuffer, attachment, renderbuffertarget, renderbuffer);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_NamedFramebufferParameteri (GLuint framebuffer, GLenum pname, GLint param)
+{
+    TraceRecord record (567, 3);
+    record.Arg (framebuffer);
+    record.Arg (pname);
+    record.Arg (param);
+    TraceNext ().NamedFramebufferParameteri (framebuffer, pname, param);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_NamedFramebufferTexture (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level)
+{
+    TraceRecord record (568, 4);
+    record.Arg (framebuffer);
+    record.Arg (attachment);
+    record.Arg (texture);
+    record.Arg (level);
+    TraceNext ().NamedFramebufferTexture (framebuffer, attachment, texture, level);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_NamedFramebufferTextureLayer (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+    TraceRecord record (569, 5);
+    record.Arg (framebuffer);
+    record.Arg (attachment);
+    record.Arg (texture);
+    record.Arg (level);
+    record.Arg (layer);
+    TraceNext ().NamedFramebufferTextureLayer (framebuffer, attachment, texture, level, layer);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_NamedFramebufferDrawBuffer (GLuint framebuffer, GLenum buf)
+{
+    TraceRecord record (570, 2);
+    record.Arg (framebuffer);
+    record.Arg (buf);
+    TraceNext ().NamedFramebufferDrawBuffer (framebuffer, buf);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_NamedFramebufferDrawBuffers (GLuint framebuffer, GLsizei n, const GLenum *bufs)
+{
+    TraceRecord record (571, 3);
+    record.Arg (framebuffer);
+    record.Arg (n);
+    record.Arg (bufs);
+    record.Blob (2, bufs, n * sizeof (GLenum));
+    TraceNext ().NamedFramebufferDrawBuffers (framebuffer, n, bufs);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_NamedFramebufferReadBuffer (GLuint framebuffer, GLenum src)
+{
+    TraceRecord record (572, 2);
+    record.Arg (framebuffer);
+    record.Arg (src);
+    TraceNext ().NamedFramebufferReadBuffer (framebuffer, src);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_InvalidateNamedFramebufferData (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments)
+{
+    TraceRecord record (573, 3);
+    record.Arg (framebuffer);
+    record.Arg (numAttachments);
+    record.Arg (attachments);
+    record.Blob (2, attachments, numAttachments * sizeof (GLenum));
+    TraceNext ().InvalidateNamedFramebufferData (framebuffer, numAttachments, attachments);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_InvalidateNamedFramebufferSubData (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    TraceRecord record (574, 7);
+    record.Arg (framebuffer);
+    record.Arg (numAttachments);
+    record.Arg (attachments);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (width);
+    record.Arg (height);
+    record.Blob (2, attachments, numAttachments * sizeof (GLenum));
+    TraceNext ().InvalidateNamedFramebufferSubData (framebuffer, numAttachments, attachments, x, y, width, height);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ClearNamedFramebufferiv (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value)
+{
+    TraceRecord record (575, 4);
+    record.Arg (framebuffer);
+    record.Arg (buffer);
+    record.Arg (drawbuffer);
+    record.Arg (value);
+    record.Blob (3, value, (buffer == GL_COLOR ? 4 : 1) * sizeof (GLint));
+    TraceNext ().ClearNamedFramebufferiv (framebuffer, buffer, drawbuffer, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ClearNamedFramebufferuiv (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value)
+{
+    TraceRecord record (576, 4);
+    record.Arg (framebuffer);
+    record.Arg (buffer);
+    record.Arg (drawbuffer);
+    record.Arg (value);
+    record.Blob (3, value, (buffer == GL_COLOR ? 4 : 1) * sizeof (GLuint));
+    TraceNext ().ClearNamedFramebufferuiv (framebuffer, buffer, drawbuffer, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ClearNamedFramebufferfv (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value)
+{
+    TraceRecord record (577, 4);
+    record.Arg (framebuffer);
+    record.Arg (buffer);
+    record.Arg (drawbuffer);
+    record.Arg (value);
+    record.Blob (3, value, (buffer == GL_COLOR ? 4 : 1) * sizeof (GLfloat));
+    TraceNext ().ClearNamedFramebufferfv (framebuffer, buffer, drawbuffer, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ClearNamedFramebufferfi (GLuint framebuffer, GLenum buffer, const GLfloat depth, GLint stencil)
+{
+    TraceRecord record (578, 4);
+    record.Arg (framebuffer);
+    record.Arg (buffer);
+    record.Arg (depth);
+    record.Arg (stencil);
+    TraceNext ().ClearNamedFramebufferfi (framebuffer, buffer, depth, stencil);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BlitNamedFramebuffer (GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+    TraceRecord record (579, 12);
+    record.Arg (readFramebuffer);
+    record.Arg (drawFramebuffer);
+    record.Arg (srcX0);
+    record.Arg (srcY0);
+    record.Arg (srcX1);
+    record.Arg (srcY1);
+    record.Arg (dstX0);
+    record.Arg (dstY0);
+    record.Arg (dstX1);
+    record.Arg (dstY1);
+    record.Arg (mask);
+    record.Arg (filter);
+    TraceNext ().BlitNamedFramebuffer (readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+    record.Commit ();
+}
+
+static GLenum APIENTRY Trace_CheckNamedFramebufferStatus (GLuint framebuffer, GLenum target)
+{
+    TraceRecord record (580, 2);
+    record.Arg (framebuffer);
+    record.Arg (target);
+    GLenum result = TraceNext ().CheckNamedFramebufferStatus (framebuffer, target);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_GetNamedFramebufferParameteriv (GLuint framebuffer, GLenum pname, GLint *param)
+{
+    TraceRecord record (581, 3);
+    record.Arg (framebuffer);
+    record.Arg (pname);
+    record.Arg (param);
+    TraceNext ().GetNamedFramebufferParameteriv (framebuffer, pname, param);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetNamedFramebufferAttachmentParameteriv (GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params)
+{
+    TraceRecord record (582, 4);
+    record.Arg (framebuffer);
+    record.Arg (attachment);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetNamedFramebufferAttachmentParameteriv (framebuffer, attachment, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CreateRenderbuffers (GLsizei n, GLuint *renderbuffers)
+{
+    TraceRecord record (583, 2);
+    record.Arg (n);
+    record.Arg (renderbuffers);
+    TraceNext ().CreateRenderbuffers (n, renderbuffers);
+    record.Blob (1, renderbuffers, n * sizeof (GLuint), true);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_NamedRenderbufferStorage (GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    TraceRecord record (584, 4);
+    record.Arg (renderbuffer);
+    record.Arg (internalformat);
+    record.Arg (width);
+    record.Arg (height);
+    TraceNext ().NamedRenderbufferStorage (renderbuffer, internalformat, width, height);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_NamedRenderbufferStorageMultisample (GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    TraceRecord record (585, 5);
+    record.Arg (renderbuffer);
+    record.Arg (samples);
+    record.Arg (internalformat);
+    record.Arg (width);
+    record.Arg (height);
+    TraceNext ().NamedRenderbufferStorageMultisample (renderbuffer, samples, internalformat, width, height);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetNamedRenderbufferParameteriv (GLuint renderbuffer, GLenum pname, GLint *params)
+{
+    TraceRecord record (586, 3);
+    record.Arg (renderbuffer);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetNamedRenderbufferParameteriv (renderbuffer, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CreateTextures (GLenum target, GLsizei n, GLuint *textures)
+{
+    TraceRecord record (587, 3);
+    record.Arg (target);
+    record.Arg (n);
+    record.Arg (textures);
+    TraceNext ().CreateTextures (target, n, textures);
+    record.Blob (2, textures, n * sizeof (GLuint), true);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TextureBuffer (GLuint texture, GLenum internalformat, GLuint buffer)
+{
+    TraceRecord record (588, 3);
+    record.Arg (texture);
+    record.Arg (internalformat);
+    record.Arg (buffer);
+    TraceNext ().TextureBuffer (texture, internalformat, buffer);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TextureBufferRange (GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    TraceRecord record (589, 5);
+    record.Arg (texture);
+    record.Arg (internalformat);
+    record.Arg (buffer);
+    record.Arg (offset);
+    record.Arg (size);
+    TraceNext ().TextureBufferRange (texture, internalformat, buffer, offset, size);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TextureStorage1D (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width)
+{
+    TraceRecord record (590, 4);
+    record.Arg (texture);
+    record.Arg (levels);
+    record.Arg (internalformat);
+    record.Arg (width);
+    TraceNext ().TextureStorage1D (texture, levels, internalformat, width);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TextureStorage2D (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    TraceRecord record (591, 5);
+    record.Arg (texture);
+    record.Arg (levels);
+    record.Arg (internalformat);
+    record.Arg (width);
+    record.Arg (height);
+    TraceNext ().TextureStorage2D (texture, levels, internalformat, width, height);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TextureStorage3D (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+    TraceRecord record (592, 6);
+    record.Arg (texture);
+    record.Arg (levels);
+    record.Arg (internalformat);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (depth);
+    TraceNext ().TextureStorage3D (texture, levels, internalformat, width, height, depth);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TextureStorage2DMultisample (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+    TraceRecord record (593, 6);
+    record.Arg (texture);
+    record.Arg (samples);
+    record.Arg (internalformat);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (fixedsamplelocations);
+    TraceNext ().TextureStorage2DMultisample (texture, samples, internalformat, width, height, fixedsamplelocations);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TextureStorage3DMultisample (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+    TraceRecord record (594, 7);
+    record.Arg (texture);
+    record.Arg (samples);
+    record.Arg (internalformat);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (depth);
+    record.Arg (fixedsamplelocations);
+    TraceNext ().TextureStorage3DMultisample (texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TextureSubImage1D (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels)
+{
+    TraceRecord record (595, 7);
+    record.Arg (texture);
+    record.Arg (level);
+    record.Arg (xoffset);
+    record.Arg (width);
+    record.Arg (format);
+    record.Arg (type);
+    record.Arg (pixels);
+    record.Image (6, pixels, format, type, width, 1, 1);
+    TraceNext ().TextureSubImage1D (texture, level, xoffset, width, format, type, pixels);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TextureSubImage2D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+    TraceRecord record (596, 9);
+    record.Arg (texture);
+    record.Arg (level);
+    record.Arg (xoffset);
+    record.Arg (yoffset);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (format);
+    record.Arg (type);
+    record.Arg (pixels);
+    record.Image (8, pixels, format, type, width, height, 1);
+    TraceNext ().TextureSubImage2D (texture, level, xoffset, yoffset, width, height, format, type, pixels);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TextureSubImage3D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels)
+{
+    TraceRecord record (597, 11);
+    record.Arg (texture);
+    record.Arg (level);
+    record.Arg (xoffset);
+    record.Arg (yoffset);
+    record.Arg (zoffset);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (depth);
+    record.Arg (format);
+    record.Arg (type);
+    record.Arg (pixels);
+    record.Image (10, pixels, format, type, width, height, depth);
+    TraceNext ().TextureSubImage3D (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CompressedTextureSubImage1D (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
+{
+    TraceRecord record (598, 7);
+    record.Arg (texture);
+    record.Arg (level);
+    record.Arg (xoffset);
+    record.Arg (width);
+    record.Arg (format);
+    record.Arg (imageSize);
+    record.Arg (data);
+    record.Pixels (6, data, imageSize);
+    TraceNext ().CompressedTextureSubImage1D (texture, level, xoffset, width, format, imageSize, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CompressedTextureSubImage2D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+{
+    TraceRecord record (599, 9);
+    record.Arg (texture);
+    record.Arg (level);
+    record.Arg (xoffset);
+    record.Arg (yoffset);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (format);
+    record.Arg (imageSize);
+    record.Arg (data);
+    record.Pixels (8, data, imageSize);
+    TraceNext ().CompressedTextureSubImage2D (texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CompressedTextureSubImage3D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+{
+    TraceRecord record (600, 11);
+    record.Arg (texture);
+    record.Arg (level);
+    record.Arg (xoffset);
+    record.Arg (yoffset);
+    record.Arg (zoffset);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (depth);
+    record.Arg (format);
+    record.Arg (imageSize);
+    record.Arg (data);
+    record.Pixels (10, data, imageSize);
+    TraceNext ().CompressedTextureSubImage3D (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CopyTextureSubImage1D (GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+    TraceRecord record (601, 6);
+    record.Arg (texture);
+    record.Arg (level);
+    record.Arg (xoffset);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (width);
+    TraceNext ().CopyTextureSubImage1D (texture, level, xoffset, x, y, width);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CopyTextureSubImage2D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    TraceRecord record (602, 8);
+    record.Arg (texture);
+    record.Arg (level);
+    record.Arg (xoffset);
+    record.Arg (yoffset);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (width);
+    record.Arg (height);
+    TraceNext ().CopyTextureSubImage2D (texture, level, xoffset, yoffset, x, y, width, height);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CopyTextureSubImage3D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    TraceRecord record (603, 9);
+    record.Arg (texture);
+    record.Arg (level);
+    record.Arg (xoffset);
+    record.Arg (yoffset);
+    record.Arg (zoffset);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (width);
+    record.Arg (height);
+    TraceNext ().CopyTextureSubImage3D (texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TextureParameterf (GLuint texture, GLenum pname, GLfloat param)
+{
+    TraceRecord record (604, 3);
+    record.Arg (texture);
+    record.Arg (pname);
+    record.Arg (param);
+    TraceNext ().TextureParameterf (texture, pname, param);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TextureParameterfv (GLuint texture, GLenum pname, const GLfloat *param)
+{
+    TraceRecord record (605, 3);
+    record.Arg (texture);
+    record.Arg (pname);
+    record.Arg (param);
+    record.Blob (2, param, TraceParameterCount (pname) * sizeof (GLfloat));
+    TraceNext ().TextureParameterfv (texture, pname, param);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TextureParameteri (GLuint texture, GLenum pname, GLint param)
+{
+    TraceRecord record (606, 3);
+    record.Arg (texture);
+    record.Arg (pname);
+    record.Arg (param);
+    TraceNext ().TextureParameteri (texture, pname, param);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TextureParameterIiv (GLuint texture, GLenum pname, const GLint *params)
+{
+    TraceRecord record (607, 3);
+    record.Arg (texture);
+    record.Arg (pname);
+    record.Arg (params);
+    record.Blob (2, params, TraceParameterCount (pname) * sizeof (GLint));
+    TraceNext ().TextureParameterIiv (texture, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TextureParameterIuiv (GLuint texture, GLenum pname, const GLuint *params)
+{
+    TraceRecord record (608, 3);
+    record.Arg (texture);
+    record.Arg (pname);
+    record.Arg (params);
+    record.Blob (2, params, TraceParameterCount (pname) * sizeof (GLuint));
+    TraceNext ().TextureParameterIuiv (texture, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TextureParameteriv (GLuint texture, GLenum pname, const GLint *param)
+{
+    TraceRecord record (609, 3);
+    record.Arg (texture);
+    record.Arg (pname);
+    record.Arg (param);
+    record.Blob (2, param, TraceParameterCount (pname) * sizeof (GLint));
+    TraceNext ().TextureParameteriv (texture, pname, param);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GenerateTextureMipmap (GLuint texture)
+{
+    TraceRecord record (610, 1);
+    record.Arg (texture);
+    TraceNext ().GenerateTextureMipmap (texture);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BindTextureUnit (GLuint unit, GLuint texture)
+{
+    TraceRecord record (611, 2);
+    record.Arg (unit);
+    record.Arg (texture);
+    TraceNext ().BindTextureUnit (unit, texture);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetTextureImage (GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+    TraceRecord record (612, 6);
+    record.Arg (texture);
+    record.Arg (level);
+    record.Arg (format);
+    record.Arg (type);
+    record.Arg (bufSize);
+    record.Arg (pixels);
+    TraceNext ().GetTextureImage (texture, level, format, type, bufSize, pixels);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetCompressedTextureImage (GLuint texture, GLint level, GLsizei bufSize, void *pixels)
+{
+    TraceRecord record (613, 4);
+    record.Arg (texture);
+    record.Arg (level);
+    record.Arg (bufSize);
+    record.Arg (pixels);
+    TraceNext ().GetCompressedTextureImage (texture, level, bufSize, pixels);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetTextureLevelParameterfv (GLuint texture, GLint level, GLenum pname, GLfloat *params)
+{
+    TraceRecord record (614, 4);
+    record.Arg (texture);
+    record.Arg (level);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetTextureLevelParameterfv (texture, level, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetTextureLevelParameteriv (GLuint texture, GLint level, GLenum pname, GLint *params)
+{
+    TraceRecord record (615, 4);
+    record.Arg (texture);
+    record.Arg (level);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetTextureLevelParameteriv (texture, level, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetTextureParameterfv (GLuint texture, GLenum pname, GLfloat *params)
+{
+    TraceRecord record (616, 3);
+    record.Arg (texture);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetTextureParameterfv (texture, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetTextureParameterIiv (GLuint texture, GLenum pname, GLint *params)
+{
+    TraceRecord record (617, 3);
+    record.Arg (texture);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetTextureParameterIiv (texture, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetTextureParameterIuiv (GLuint texture, GLenum pname, GLuint *params)
+{
+    TraceRecord record (618, 3);
+    record.Arg (texture);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetTextureParameterIuiv (texture, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetTextureParameteriv (GLuint texture, GLenum pname, GLint *params)
+{
+    TraceRecord record (619, 3);
+    record.Arg (texture);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetTextureParameteriv (texture, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CreateVertexArrays (GLsizei n, GLuint *arrays)
+{
+    TraceRecord record (620, 2);
+    record.Arg (n);
+    record.Arg (arrays);
+    TraceNext ().CreateVertexArrays (n, arrays);
+    record.Blob (1, arrays, n * sizeof (GLuint), true);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DisableVertexArrayAttrib (GLuint vaobj, GLuint index)
+{
+    TraceRecord record (621, 2);
+    record.Arg (vaobj);
+    record.Arg (index);
+    TraceNext ().DisableVertexArrayAttrib (vaobj, index);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_EnableVertexArrayAttrib (GLuint vaobj, GLuint index)
+{
+    TraceRecord record (622, 2);
+    record.Arg (vaobj);
+    record.Arg (index);
+    TraceNext ().EnableVertexArrayAttrib (vaobj, index);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexArrayElementBuffer (GLuint vaobj, GLuint buffer)
+{
+    TraceRecord record (623, 2);
+    record.Arg (vaobj);
+    record.Arg (buffer);
+    TraceNext ().VertexArrayElementBuffer (vaobj, buffer);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexArrayVertexBuffer (GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+    TraceRecord record (624, 5);
+    record.Arg (vaobj);
+    record.Arg (bindingindex);
+    record.Arg (buffer);
+    record.Arg (offset);
+    record.Arg (stride);
+    TraceNext ().VertexArrayVertexBuffer (vaobj, bindingindex, buffer, offset, stride);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexArrayVertexBuffers (GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides)
+{
+    TraceRecord record (625, 6);
+    record.Arg (vaobj);
+    record.Arg (first);
+    record.Arg (count);
+    record.Arg (buffers);
+    record.Arg (offsets);
+    record.Arg (strides);
+    record.Blob (3, buffers, count * sizeof (GLuint));
+    record.Blob (4, offsets, count * sizeof (GLintptr));
+    record.Blob (5, strides, count * sizeof (GLsizei));
+    TraceNext ().VertexArrayVertexBuffers (vaobj, first, count, buffers, offsets, strides);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexArrayAttribBinding (GLuint vaobj, GLuint attribindex, GLuint bindingindex)
+{
+    TraceRecord record (626, 3);
+    record.Arg (vaobj);
+    record.Arg (attribindex);
+    record.Arg (bindingindex);
+    TraceNext ().VertexArrayAttribBinding (vaobj, attribindex, bindingindex);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexArrayAttribFormat (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
+{
+    TraceRecord record (627, 6);
+    record.Arg (vaobj);
+    record.Arg (attribindex);
+    record.Arg (size);
+    record.Arg (type);
+    record.Arg (normalized);
+    record.Arg (relativeoffset);
+    TraceNext ().VertexArrayAttribFormat (vaobj, attribindex, size, type, normalized, relativeoffset);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexArrayAttribIFormat (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    TraceRecord record (628, 5);
+    record.Arg (vaobj);
+    record.Arg (attribindex);
+    record.Arg (size);
+    record.Arg (type);
+    record.Arg (relativeoffset);
+    TraceNext ().VertexArrayAttribIFormat (vaobj, attribindex, size, type, relativeoffset);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexArrayAttribLFormat (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+    TraceRecord record (629, 5);
+    record.Arg (vaobj);
+    record.Arg (attribindex);
+    record.Arg (size);
+    record.Arg (type);
+    record.Arg (relativeoffset);
+    TraceNext ().VertexArrayAttribLFormat (vaobj, attribindex, size, type, relativeoffset);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexArrayBindingDivisor (GLuint vaobj, GLuint bindingindex, GLuint divisor)
+{
+    TraceRecord record (630, 3);
+    record.Arg (vaobj);
+    record.Arg (bindingindex);
+    record.Arg (divisor);
+    TraceNext ().VertexArrayBindingDivisor (vaobj, bindingindex, divisor);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetVertexArrayiv (GLuint vaobj, GLenum pname, GLint *param)
+{
+    TraceRecord record (631, 3);
+    record.Arg (vaobj);
+    record.Arg (pname);
+    record.Arg (param);
+    TraceNext ().GetVertexArrayiv (vaobj, pname, param);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetVertexArrayIndexediv (GLuint vaobj, GLuint index, GLenum pname, GLint *param)
+{
+    TraceRecord record (632, 4);
+    record.Arg (vaobj);
+    record.Arg (index);
+    record.Arg (pname);
+    record.Arg (param);
+    TraceNext ().GetVertexArrayIndexediv (vaobj, index, pname, param);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetVertexArrayIndexed64iv (GLuint vaobj, GLuint index, GLenum pname, GLint64 *param)
+{
+    TraceRecord record (633, 4);
+    record.Arg (vaobj);
+    record.Arg (index);
+    record.Arg (pname);
+    record.Arg (param);
+    TraceNext ().GetVertexArrayIndexed64iv (vaobj, index, pname, param);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CreateSamplers (GLsizei n, GLuint *samplers)
+{
+    TraceRecord record (634, 2);
+    record.Arg (n);
+    record.Arg (samplers);
+    TraceNext ().CreateSamplers (n, samplers);
+    record.Blob (1, samplers, n * sizeof (GLuint), true);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CreateProgramPipelines (GLsizei n, GLuint *pipelines)
+{
+    TraceRecord record (635, 2);
+    record.Arg (n);
+    record.Arg (pipelines);
+    TraceNext ().CreateProgramPipelines (n, pipelines);
+    record.Blob (1, pipelines, n * sizeof (GLuint), true);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CreateQueries (GLenum target, GLsizei n, GLuint *ids)
+{
+    TraceRecord record (636, 3);
+    record.Arg (target);
+    record.Arg (n);
+    record.Arg (ids);
+    TraceNext ().CreateQueries (target, n, ids);
+    record.Blob (2, ids, n * sizeof (GLuint), true);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetQueryBufferObjecti64v (GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    TraceRecord record (637, 4);
+    record.Arg (id);
+    record.Arg (buffer);
+    record.Arg (pname);
+    record.Arg (offset);
+    TraceNext ().GetQueryBufferObjecti64v (id, buffer, pname, offset);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetQueryBufferObjectiv (GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    TraceRecord record (638, 4);
+    record.Arg (id);
+    record.Arg (buffer);
+    record.Arg (pname);
+    record.Arg (offset);
+    TraceNext ().GetQueryBufferObjectiv (id, buffer, pname, offset);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetQueryBufferObjectui64v (GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    TraceRecord record (639, 4);
+    record.Arg (id);
+    record.Arg (buffer);
+    record.Arg (pname);
+    record.Arg (offset);
+    TraceNext ().GetQueryBufferObjectui64v (id, buffer, pname, offset);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetQueryBufferObjectuiv (GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+    TraceRecord record (640, 4);
+    record.Arg (id);
+    record.Arg (buffer);
+    record.Arg (pname);
+    record.Arg (offset);
+    TraceNext ().GetQueryBufferObjectuiv (id, buffer, pname, offset);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_MemoryBarrierByRegion (GLbitfield barriers)
+{
+    TraceRecord record (641, 1);
+    record.Arg (barriers);
+    TraceNext ().MemoryBarrierByRegion (barriers);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetTextureSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+    TraceRecord record (642, 12);
+    record.Arg (texture);
+    record.Arg (level);
+    record.Arg (xoffset);
+    record.Arg (yoffset);
+    record.Arg (zoffset);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (depth);
+    record.Arg (format);
+    record.Arg (type);
+    record.Arg (bufSize);
+    record.Arg (pixels);
+    TraceNext ().GetTextureSubImage (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetCompressedTextureSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels)
+{
+    TraceRecord record (643, 10);
+    record.Arg (texture);
+    record.Arg (level);
+    record.Arg (xoffset);
+    record.Arg (yoffset);
+    record.Arg (zoffset);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (depth);
+    record.Arg (bufSize);
+    record.Arg (pixels);
+    TraceNext ().GetCompressedTextureSubImage (texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+    record.Commit ();
+}
+
+static GLenum APIENTRY Trace_GetGraphicsResetStatus (void)
+{
+    TraceRecord record (644, 0);
+    GLenum result = TraceNext ().GetGraphicsResetStatus ();
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_GetnCompressedTexImage (GLenum target, GLint lod, GLsizei bufSize, void *pixels)
+{
+    TraceRecord record (645, 4);
+    record.Arg (target);
+    record.Arg (lod);
+    record.Arg (bufSize);
+    record.Arg (pixels);
+    TraceNext ().GetnCompressedTexImage (target, lod, bufSize, pixels);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetnTexImage (GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+    TraceRecord record (646, 6);
+    record.Arg (target);
+    record.Arg (level);
+    record.Arg (format);
+    record.Arg (type);
+    record.Arg (bufSize);
+    record.Arg (pixels);
+    TraceNext ().GetnTexImage (target, level, format, type, bufSize, pixels);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetnUniformdv (GLuint program, GLint location, GLsizei bufSize, GLdouble *params)
+{
+    TraceRecord record (647, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (bufSize);
+    record.Arg (params);
+    TraceNext ().GetnUniformdv (program, location, bufSize, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetnUniformfv (GLuint program, GLint location, GLsizei bufSize, GLfloat *params)
+{
+    TraceRecord record (648, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (bufSize);
+    record.Arg (params);
+    TraceNext ().GetnUniformfv (program, location, bufSize, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetnUniformiv (GLuint program, GLint location, GLsizei bufSize, GLint *params)
+{
+    TraceRecord record (649, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (bufSize);
+    record.Arg (params);
+    TraceNext ().GetnUniformiv (program, location, bufSize, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetnUniformuiv (GLuint program, GLint location, GLsizei bufSize, GLuint *params)
+{
+    TraceRecord record (650, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (bufSize);
+    record.Arg (params);
+    TraceNext ().GetnUniformuiv (program, location, bufSize, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ReadnPixels (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data)
+{
+    TraceRecord record (651, 8);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (format);
+    record.Arg (type);
+    record.Arg (bufSize);
+    record.Arg (data);
+    TraceNext ().ReadnPixels (x, y, width, height, format, type, bufSize, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TextureBarrier (void)
+{
+    TraceRecord record (652, 0);
+    TraceNext ().TextureBarrier ();
+    record.Commit ();
+}
+
+static GLuint64 APIENTRY Trace_GetTextureHandleARB (GLuint texture)
+{
+    TraceRecord record (653, 1);
+    record.Arg (texture);
+    GLuint64 result = TraceNext ().GetTextureHandleARB (texture);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static GLuint64 APIENTRY Trace_GetTextureSamplerHandleARB (GLuint texture, GLuint sampler)
+{
+    TraceRecord record (654, 2);
+    record.Arg (texture);
+    record.Arg (sampler);
+    GLuint64 result = TraceNext ().GetTextureSamplerHandleARB (texture, sampler);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_MakeTextureHandleResidentARB (GLuint64 handle)
+{
+    TraceRecord record (655, 1);
+    record.Arg (handle);
+    TraceNext ().MakeTextureHandleResidentARB (handle);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_MakeTextureHandleNonResidentARB (GLuint64 handle)
+{
+    TraceRecord record (656, 1);
+    record.Arg (handle);
+    TraceNext ().MakeTextureHandleNonResidentARB (handle);
+    record.Commit ();
+}
+
+static GLuint64 APIENTRY Trace_GetImageHandleARB (GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format)
+{
+    TraceRecord record (657, 5);
+    record.Arg (texture);
+    record.Arg (level);
+    record.Arg (layered);
+    record.Arg (layer);
+    record.Arg (format);
+    GLuint64 result = TraceNext ().GetImageHandleARB (texture, level, layered, layer, format);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_MakeImageHandleResidentARB (GLuint64 handle, GLenum access)
+{
+    TraceRecord record (658, 2);
+    record.Arg (handle);
+    record.Arg (access);
+    TraceNext ().MakeImageHandleResidentARB (handle, access);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_MakeImageHandleNonResidentARB (GLuint64 handle)
+{
+    TraceRecord record (659, 1);
+    record.Arg (handle);
+    TraceNext ().MakeImageHandleNonResidentARB (handle);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_UniformHandleui64ARB (GLint location, GLuint64 value)
+{
+    TraceRecord record (660, 2);
+    record.Arg (location);
+    record.Arg (value);
+    TraceNext ().UniformHandleui64ARB (location, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_UniformHandleui64vARB (GLint location, GLsizei count, const GLuint64 *value)
+{
+    TraceRecord record (661, 3);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (2, value, count * sizeof (GLuint64));
+    TraceNext ().UniformHandleui64vARB (location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniformHandleui64ARB (GLuint program, GLint location, GLuint64 value)
+{
+    TraceRecord record (662, 3);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (value);
+    TraceNext ().ProgramUniformHandleui64ARB (program, location, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniformHandleui64vARB (GLuint program, GLint location, GLsizei count, const GLuint64 *values)
+{
+    TraceRecord record (663, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (values);
+    record.Blob (3, values, count * sizeof (GLuint64));
+    TraceNext ().ProgramUniformHandleui64vARB (program, location, count, values);
+    record.Commit ();
+}
+
+static GLboolean APIENTRY Trace_IsTextureHandleResidentARB (GLuint64 handle)
+{
+    TraceRecord record (664, 1);
+    record.Arg (handle);
+    GLboolean result = TraceNext ().IsTextureHandleResidentARB (handle);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static GLboolean APIENTRY Trace_IsImageHandleResidentARB (GLuint64 handle)
+{
+    TraceRecord record (665, 1);
+    record.Arg (handle);
+    GLboolean result = TraceNext ().IsImageHandleResidentARB (handle);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_VertexAttribL1ui64ARB (GLuint index, GLuint64EXT x)
+{
+    TraceRecord record (666, 2);
+    record.Arg (index);
+    record.Arg (x);
+    TraceNext ().VertexAttribL1ui64ARB (index, x);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribL1ui64vARB (GLuint index, const GLuint64EXT *v)
+{
+    TraceRecord record (667, 2);
+    record.Arg (index);
+    record.Arg (v);
+    record.Blob (1, v, 1 * sizeof (GLuint64EXT));
+    TraceNext ().VertexAttribL1ui64vARB (index, v);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetVertexAttribLui64vARB (GLuint index, GLenum pname, GLuint64EXT *params)
+{
+    TraceRecord record (668, 3);
+    record.Arg (index);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetVertexAttribLui64vARB (index, pname, params);
+    record.Commit ();
+}
+
+static GLsync APIENTRY Trace_CreateSyncFromCLeventARB (struct _cl_context *context, struct _cl_event *event, GLbitfield flags)
+{
+    TraceRecord record (669, 3);
+    record.Arg (context);
+    record.Arg (event);
+    record.Arg (flags);
+    GLsync result = TraceNext ().CreateSyncFromCLeventARB (context, event, flags);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_DispatchComputeGroupSizeARB (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z, GLuint group_size_x, GLuint group_size_y, GLuint group_size_z)
+{
+    TraceRecord record (670, 6);
+    record.Arg (num_groups_x);
+    record.Arg (num_groups_y);
+    record.Arg (num_groups_z);
+    record.Arg (group_size_x);
+    record.Arg (group_size_y);
+    record.Arg (group_size_z);
+    TraceNext ().DispatchComputeGroupSizeARB (num_groups_x, num_groups_y, num_groups_z, group_size_x, group_size_y, group_size_z);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DebugMessageControlARB (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled)
+{
+    TraceRecord record (671, 6);
+    record.Arg (source);
+    record.Arg (type);
+    record.Arg (severity);
+    record.Arg (count);
+    record.Arg (ids);
+    record.Arg (enabled);
+    record.Blob (4, ids, count * sizeof (GLuint));
+    TraceNext ().DebugMessageControlARB (source, type, severity, count, ids, enabled);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DebugMessageInsertARB (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf)
+{
+    TraceRecord record (672, 6);
+    record.Arg (source);
+    record.Arg (type);
+    record.Arg (id);
+    record.Arg (severity);
+    record.Arg (length);
+    record.Arg (buf);
+    record.String (5, buf, length);
+    TraceNext ().DebugMessageInsertARB (source, type, id, severity, length, buf);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DebugMessageCallbackARB (GLDEBUGPROCARB callback, const void *userParam)
+{
+    TraceRecord record (673, 2);
+    record.Arg (callback);
+    record.Arg (userParam);
+    TraceNext ().DebugMessageCallbackARB (callback, userParam);
+    record.Commit ();
+}
+
+static GLuint APIENTRY Trace_GetDebugMessageLogARB (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog)
+{
+    TraceRecord record (674, 8);
+    record.Arg (count);
+    record.Arg (bufSize);
+    record.Arg (sources);
+    record.Arg (types);
+    record.Arg (ids);
+    record.Arg (severities);
+    record.Arg (lengths);
+    record.Arg (messageLog);
+    GLuint result = TraceNext ().GetDebugMessageLogARB (count, bufSize, sources, types, ids, severities, lengths, messageLog);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_BlendEquationiARB (GLuint buf, GLenum mode)
+{
+    TraceRecord record (675, 2);
+    record.Arg (buf);
+    record.Arg (mode);
+    TraceNext ().BlendEquationiARB (buf, mode);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BlendEquationSeparateiARB (GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+    TraceRecord record (676, 3);
+    record.Arg (buf);
+    record.Arg (modeRGB);
+    record.Arg (modeAlpha);
+    TraceNext ().BlendEquationSeparateiARB (buf, modeRGB, modeAlpha);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BlendFunciARB (GLuint buf, GLenum src, GLenum dst)
+{
+    TraceRecord record (677, 3);
+    record.Arg (buf);
+    record.Arg (src);
+    record.Arg (dst);
+    TraceNext ().BlendFunciARB (buf, src, dst);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BlendFuncSeparateiARB (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+    TraceRecord record (678, 5);
+    record.Arg (buf);
+    record.Arg (srcRGB);
+    record.Arg (dstRGB);
+    record.Arg (srcAlpha);
+    record.Arg (dstAlpha);
+    TraceNext ().BlendFuncSeparateiARB (buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_MultiDrawArraysIndirectCountARB (GLenum mode, GLintptr indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+    TraceRecord record (679, 5);
+    record.Arg (mode);
+    record.Arg (indirect);
+    record.Arg (drawcount);
+    record.Arg (maxdrawcount);
+    record.Arg (stride);
+    TraceNext ().MultiDrawArraysIndirectCountARB (mode, indirect, drawcount, maxdrawcount, stride);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_MultiDrawElementsIndirectCountARB (GLenum mode, GLenum type, GLintptr indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+    TraceRecord record (680, 6);
+    record.Arg (mode);
+    record.Arg (type);
+    record.Arg (indirect);
+    record.Arg (drawcount);
+    record.Arg (maxdrawcount);
+    record.Arg (stride);
+    TraceNext ().MultiDrawElementsIndirectCountARB (mode, type, indirect, drawcount, maxdrawcount, stride);
+    record.Commit ();
+}
+
+static GLenum APIENTRY Trace_GetGraphicsResetStatusARB (void)
+{
+    TraceRecord record (681, 0);
+    GLenum result = TraceNext ().GetGraphicsResetStatusARB ();
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_GetnTexImageARB (GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *img)
+{
+    TraceRecord record (682, 6);
+    record.Arg (target);
+    record.Arg (level);
+    record.Arg (format);
+    record.Arg (type);
+    record.Arg (bufSize);
+    record.Arg (img);
+    TraceNext ().GetnTexImageARB (target, level, format, type, bufSize, img);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ReadnPixelsARB (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data)
+{
+    TraceRecord record (683, 8);
+    record.Arg (x);
+    record.Arg (y);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (format);
+    record.Arg (type);
+    record.Arg (bufSize);
+    record.Arg (data);
+    TraceNext ().ReadnPixelsARB (x, y, width, height, format, type, bufSize, data);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetnCompressedTexImageARB (GLenum target, GLint lod, GLsizei bufSize, void *img)
+{
+    TraceRecord record (684, 4);
+    record.Arg (target);
+    record.Arg (lod);
+    record.Arg (bufSize);
+    record.Arg (img);
+    TraceNext ().GetnCompressedTexImageARB (target, lod, bufSize, img);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetnUniformfvARB (GLuint program, GLint location, GLsizei bufSize, GLfloat *params)
+{
+    TraceRecord record (685, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (bufSize);
+    record.Arg (params);
+    TraceNext ().GetnUniformfvARB (program, location, bufSize, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetnUniformivARB (GLuint program, GLint location, GLsizei bufSize, GLint *params)
+{
+    TraceRecord record (686, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (bufSize);
+    record.Arg (params);
+    TraceNext ().GetnUniformivARB (program, location, bufSize, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetnUniformuivARB (GLuint program, GLint location, GLsizei bufSize, GLuint *params)
+{
+    TraceRecord record (687, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (bufSize);
+    record.Arg (params);
+    TraceNext ().GetnUniformuivARB (program, location, bufSize, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetnUniformdvARB (GLuint program, GLint location, GLsizei bufSize, GLdouble *params)
+{
+    TraceRecord record (688, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (bufSize);
+    record.Arg (params);
+    TraceNext ().GetnUniformdvARB (program, location, bufSize, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_MinSampleShadingARB (GLfloat value)
+{
+    TraceRecord record (689, 1);
+    record.Arg (value);
+    TraceNext ().MinSampleShadingARB (value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_NamedStringARB (GLenum type, GLint namelen, const GLchar *name, GLint stringlen, const GLchar *string)
+{
+    TraceRecord record (690, 5);
+    record.Arg (type);
+    record.Arg (namelen);
+    record.Arg (name);
+    record.Arg (stringlen);
+    record.Arg (string);
+    record.String (2, name, -1);
+    record.String (4, string, -1);
+    TraceNext ().NamedStringARB (type, namelen, name, stringlen, string);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DeleteNamedStringARB (GLint namelen, const GLchar *name)
+{
+    TraceRecord record (691, 2);
+    record.Arg (namelen);
+    record.Arg (name);
+    record.String (1, name, -1);
+    TraceNext ().DeleteNamedStringARB (namelen, name);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_CompileShaderIncludeARB (GLuint shader, GLsizei count, const GLchar *const*path, const GLint *length)
+{
+    TraceRecord record (692, 4);
+    record.Arg (shader);
+    record.Arg (count);
+    record.Arg (path);
+    record.Arg (length);
+    record.Strings (2, count, path, length);
+    TraceNext ().CompileShaderIncludeARB (shader, count, path, length);
+    record.Commit ();
+}
+
+static GLboolean APIENTRY Trace_IsNamedStringARB (GLint namelen, const GLchar *name)
+{
+    TraceRecord record (693, 2);
+    record.Arg (namelen);
+    record.Arg (name);
+    record.String (1, name, -1);
+    GLboolean result = TraceNext ().IsNamedStringARB (namelen, name);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_GetNamedStringARB (GLint namelen, const GLchar *name, GLsizei bufSize, GLint *stringlen, GLchar *string)
+{
+    TraceRecord record (694, 5);
+    record.Arg (namelen);
+    record.Arg (name);
+    record.Arg (bufSize);
+    record.Arg (stringlen);
+    record.Arg (string);
+    record.String (1, name, -1);
+    TraceNext ().GetNamedStringARB (namelen, name, bufSize, stringlen, string);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetNamedStringivARB (GLint namelen, const GLchar *name, GLenum pname, GLint *params)
+{
+    TraceRecord record (695, 4);
+    record.Arg (namelen);
+    record.Arg (name);
+    record.Arg (pname);
+    record.Arg (params);
+    record.String (1, name, -1);
+    TraceNext ().GetNamedStringivARB (namelen, name, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BufferPageCommitmentARB (GLenum target, GLintptr offset, GLsizeiptr size, GLboolean commit)
+{
+    TraceRecord record (696, 4);
+    record.Arg (target);
+    record.Arg (offset);
+    record.Arg (size);
+    record.Arg (commit);
+    TraceNext ().BufferPageCommitmentARB (target, offset, size, commit);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_NamedBufferPageCommitmentEXT (GLuint buffer, GLintptr offset, GLsizeiptr size, GLboolean commit)
+{
+    TraceRecord record (697, 4);
+    record.Arg (buffer);
+    record.Arg (offset);
+    record.Arg (size);
+    record.Arg (commit);
+    TraceNext ().NamedBufferPageCommitmentEXT (buffer, offset, size, commit);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_NamedBufferPageCommitmentARB (GLuint buffer, GLintptr offset, GLsizeiptr size, GLboolean commit)
+{
+    TraceRecord record (698, 4);
+    record.Arg (buffer);
+    record.Arg (offset);
+    record.Arg (size);
+    record.Arg (commit);
+    TraceNext ().NamedBufferPageCommitmentARB (buffer, offset, size, commit);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TexPageCommitmentARB (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean commit)
+{
+    TraceRecord record (699, 9);
+    record.Arg (target);
+    record.Arg (level);
+    record.Arg (xoffset);
+    record.Arg (yoffset);
+    record.Arg (zoffset);
+    record.Arg (width);
+    record.Arg (height);
+    record.Arg (depth);
+    record.Arg (commit);
+    TraceNext ().TexPageCommitmentARB (target, level, xoffset, yoffset, zoffset, width, height, depth, commit);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetMultisamplefvNV (GLenum a0, GLuint a1, GLfloat *a2)
+{
+    TraceRecord record (700, 3);
+    record.Arg (a0);
+    record.Arg (a1);
+    record.Arg (a2);
+    TraceNext ().GetMultisamplefvNV (a0, a1, a2);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_SampleMaskIndexedNV (GLuint a0, GLbitfield a1)
+{
+    TraceRecord record (701, 2);
+    record.Arg (a0);
+    record.Arg (a1);
+    TraceNext ().SampleMaskIndexedNV (a0, a1);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TexRenderbufferNV (GLenum a0, GLuint a1)
+{
+    TraceRecord record (702, 2);
+    record.Arg (a0);
+    record.Arg (a1);
+    TraceNext ().TexRenderbufferNV (a0, a1);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_MakeBufferResidentNV (GLenum target, GLenum access)
+{
+    TraceRecord record (703, 2);
+    record.Arg (target);
+    record.Arg (access);
+    TraceNext ().MakeBufferResidentNV (target, access);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_MakeBufferNonResidentNV (GLenum target)
+{
+    TraceRecord record (704, 1);
+    record.Arg (target);
+    TraceNext ().MakeBufferNonResidentNV (target);
+    record.Commit ();
+}
+
+static GLboolean APIENTRY Trace_IsBufferResidentNV (GLenum target)
+{
+    TraceRecord record (705, 1);
+    record.Arg (target);
+    GLboolean result = TraceNext ().IsBufferResidentNV (target);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_MakeNamedBufferResidentNV (GLuint buffer, GLenum access)
+{
+    TraceRecord record (706, 2);
+    record.Arg (buffer);
+    record.Arg (access);
+    TraceNext ().MakeNamedBufferResidentNV (buffer, access);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_MakeNamedBufferNonResidentNV (GLuint buffer)
+{
+    TraceRecord record (707, 1);
+    record.Arg (buffer);
+    TraceNext ().MakeNamedBufferNonResidentNV (buffer);
+    record.Commit ();
+}
+
+static GLboolean APIENTRY Trace_IsNamedBufferResidentNV (GLuint buffer)
+{
+    TraceRecord record (708, 1);
+    record.Arg (buffer);
+    GLboolean result = TraceNext ().IsNamedBufferResidentNV (buffer);
+    record.Return (result);
+    record.Commit ();
+    return result;
+}
+
+static void APIENTRY Trace_GetBufferParameterui64vNV (GLenum target, GLenum pname, GLuint64EXT *params)
+{
+    TraceRecord record (709, 3);
+    record.Arg (target);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetBufferParameterui64vNV (target, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetNamedBufferParameterui64vNV (GLuint buffer, GLenum pname, GLuint64EXT *params)
+{
+    TraceRecord record (710, 3);
+    record.Arg (buffer);
+    record.Arg (pname);
+    record.Arg (params);
+    TraceNext ().GetNamedBufferParameterui64vNV (buffer, pname, params);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetIntegerui64vNV (GLenum value, GLuint64EXT *result)
+{
+    TraceRecord record (711, 2);
+    record.Arg (value);
+    record.Arg (result);
+    TraceNext ().GetIntegerui64vNV (value, result);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniformui64NV (GLint location, GLuint64EXT value)
+{
+    TraceRecord record (712, 2);
+    record.Arg (location);
+    record.Arg (value);
+    TraceNext ().Uniformui64NV (location, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_Uniformui64vNV (GLint location, GLsizei count, const GLuint64EXT *value)
+{
+    TraceRecord record (713, 3);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (2, value, count * sizeof (GLuint64EXT));
+    TraceNext ().Uniformui64vNV (location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniformui64NV (GLuint program, GLint location, GLuint64EXT value)
+{
+    TraceRecord record (714, 3);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (value);
+    TraceNext ().ProgramUniformui64NV (program, location, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ProgramUniformui64vNV (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value)
+{
+    TraceRecord record (715, 4);
+    record.Arg (program);
+    record.Arg (location);
+    record.Arg (count);
+    record.Arg (value);
+    record.Blob (3, value, count * sizeof (GLuint64EXT));
+    TraceNext ().ProgramUniformui64vNV (program, location, count, value);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_BufferAddressRangeNV (GLenum pname, GLuint index, GLuint64EXT address, GLsizeiptr length)
+{
+    TraceRecord record (716, 4);
+    record.Arg (pname);
+    record.Arg (index);
+    record.Arg (address);
+    record.Arg (length);
+    TraceNext ().BufferAddressRangeNV (pname, index, address, length);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexFormatNV (GLint size, GLenum type, GLsizei stride)
+{
+    TraceRecord record (717, 3);
+    record.Arg (size);
+    record.Arg (type);
+    record.Arg (stride);
+    TraceNext ().VertexFormatNV (size, type, stride);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_NormalFormatNV (GLenum type, GLsizei stride)
+{
+    TraceRecord record (718, 2);
+    record.Arg (type);
+    record.Arg (stride);
+    TraceNext ().NormalFormatNV (type, stride);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_ColorFormatNV (GLint size, GLenum type, GLsizei stride)
+{
+    TraceRecord record (719, 3);
+    record.Arg (size);
+    record.Arg (type);
+    record.Arg (stride);
+    TraceNext ().ColorFormatNV (size, type, stride);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_IndexFormatNV (GLenum type, GLsizei stride)
+{
+    TraceRecord record (720, 2);
+    record.Arg (type);
+    record.Arg (stride);
+    TraceNext ().IndexFormatNV (type, stride);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_TexCoordFormatNV (GLint size, GLenum type, GLsizei stride)
+{
+    TraceRecord record (721, 3);
+    record.Arg (size);
+    record.Arg (type);
+    record.Arg (stride);
+    TraceNext ().TexCoordFormatNV (size, type, stride);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_EdgeFlagFormatNV (GLsizei stride)
+{
+    TraceRecord record (722, 1);
+    record.Arg (stride);
+    TraceNext ().EdgeFlagFormatNV (stride);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_SecondaryColorFormatNV (GLint size, GLenum type, GLsizei stride)
+{
+    TraceRecord record (723, 3);
+    record.Arg (size);
+    record.Arg (type);
+    record.Arg (stride);
+    TraceNext ().SecondaryColorFormatNV (size, type, stride);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_FogCoordFormatNV (GLenum type, GLsizei stride)
+{
+    TraceRecord record (724, 2);
+    record.Arg (type);
+    record.Arg (stride);
+    TraceNext ().FogCoordFormatNV (type, stride);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribFormatNV (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride)
+{
+    TraceRecord record (725, 5);
+    record.Arg (index);
+    record.Arg (size);
+    record.Arg (type);
+    record.Arg (normalized);
+    record.Arg (stride);
+    TraceNext ().VertexAttribFormatNV (index, size, type, normalized, stride);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_VertexAttribIFormatNV (GLuint index, GLint size, GLenum type, GLsizei stride)
+{
+    TraceRecord record (726, 4);
+    record.Arg (index);
+    record.Arg (size);
+    record.Arg (type);
+    record.Arg (stride);
+    TraceNext ().VertexAttribIFormatNV (index, size, type, stride);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_GetIntegerui64i_vNV (GLenum value, GLuint index, GLuint64EXT *result)
+{
+    TraceRecord record (727, 3);
+    record.Arg (value);
+    record.Arg (index);
+    record.Arg (result);
+    TraceNext ().GetIntegerui64i_vNV (value, index, result);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_EnableClientState (GLenum cap)
+{
+    TraceRecord record (728, 1);
+    record.Arg (cap);
+    TraceNext ().EnableClientState (cap);
+    record.Commit ();
+}
+
+static void APIENTRY Trace_DisableClientState (GLenum cap)
+{
+    TraceRecord record (729, 1);
+    record.Arg (cap);
+    TraceNext ().DisableClientState (cap);
+    record.Commit ();
+}
+
+void GetTraceThunks (DispatchTable *table)
+{
+    table->CullFace = Trace_CullFace;
+    table->FrontFace = Trace_FrontFace;
+    table->Hint = Trace_Hint;
+    table->LineWidth = Trace_LineWidth;
+    table->PointSize = Trace_PointSize;
+    table->PolygonMode = Trace_PolygonMode;
+    table->Scissor = Trace_Scissor;
+    table->TexParameterf = Trace_TexParameterf;
+    table->TexParameterfv = Trace_TexParameterfv;
+    table->TexParameteri = Trace_TexParameteri;
+    table->TexParameteriv = Trace_TexParameteriv;
+    table->TexImage1D = Trace_TexImage1D;
+    table->TexImage2D = Trace_TexImage2D;
+    table->DrawBuffer = Trace_DrawBuffer;
+    table->Clear = Trace_Clear;
+    table->ClearColor = Trace_ClearColor;
+    table->ClearStencil = Trace_ClearStencil;
+    table->ClearDepth = Trace_ClearDepth;
+    table->StencilMask = Trace_StencilMask;
+    table->ColorMask = Trace_ColorMask;
+    table->DepthMask = Trace_DepthMask;
+    table->Disable = Trace_Disable;
+    table->Enable = Trace_Enable;
+    table->Finish = Trace_Finish;
+    table->Flush = Trace_Flush;
+    table->BlendFunc = Trace_BlendFunc;
+    table->LogicOp = Trace_LogicOp;
+    table->StencilFunc = Trace_StencilFunc;
+    table->StencilOp = Trace_StencilOp;
+    table->DepthFunc = Trace_DepthFunc;
+    table->PixelStoref = Trace_PixelStoref;
+    table->PixelStorei = Trace_PixelStorei;
+    table->ReadBuffer = Trace_ReadBuffer;
+    table->ReadPixels = Trace_ReadPixels;
+    table->GetBooleanv = Trace_GetBooleanv;
+    table->GetDoublev = Trace_GetDoublev;
+    table->GetError = Trace_GetError;
+    table->GetFloatv = Trace_GetFloatv;
+    table->GetIntegerv = Trace_GetIntegerv;
+    table->GetString = Trace_GetString;
+    table->GetTexImage = Trace_GetTexImage;
+    table->GetTexParameterfv = Trace_GetTexParameterfv;
+    table->GetTexParameteriv = Trace_GetTexParameteriv;
+    table->GetTexLevelParameterfv = Trace_GetTexLevelParameterfv;
+    table->GetTexLevelParameteriv = Trace_GetTexLevelParameteriv;
+    table->IsEnabled = Trace_IsEnabled;
+    table->DepthRange = Trace_DepthRange;
+    table->Viewport = Trace_Viewport;
+    table->DrawArrays = Trace_DrawArrays;
+    table->DrawElements = Trace_DrawElements;
+    table->GetPointerv = Trace_GetPointerv;
+    table->PolygonOffset = Trace_PolygonOffset;
+    table->CopyTexImage1D = Trace_CopyTexImage1D;
+    table->CopyTexImage2D = Trace_CopyTexImage2D;
+    table->CopyTexSubImage1D = Trace_CopyTexSubImage1D;
+    table->CopyTexSubImage2D = Trace_CopyTexSubImage2D;
+    table->TexSubImage1D = Trace_TexSubImage1D;
+    table->TexSubImage2D = Trace_TexSubImage2D;
+    table->BindTexture = Trace_BindTexture;
+    table->DeleteTextures = Trace_DeleteTextures;
+    table->GenTextures = Trace_GenTextures;
+    table->IsTexture = Trace_IsTexture;
+    table->DrawRangeElements = Trace_DrawRangeElements;
+    table->TexImage3D = Trace_TexImage3D;
+    table->TexSubImage3D = Trace_TexSubImage3D;
+    table->CopyTexSubImage3D = Trace_CopyTexSubImage3D;
+    table->ActiveTexture = Trace_ActiveTexture;
+    table->SampleCoverage = Trace_SampleCoverage;
+    table->CompressedTexImage3D = Trace_CompressedTexImage3D;
+    table->CompressedTexImage2D = Trace_CompressedTexImage2D;
+    table->CompressedTexImage1D = Trace_CompressedTexImage1D;
+    table->CompressedTexSubImage3D = Trace_CompressedTexSubImage3D;
+    table->CompressedTexSubImage2D = Trace_CompressedTexSubImage2D;
+    table->CompressedTexSubImage1D = Trace_CompressedTexSubImage1D;
+    table->GetCompressedTexImage = Trace_GetCompressedTexImage;
+    table->BlendFuncSeparate = Trace_BlendFuncSeparate;
+    table->MultiDrawArrays = Trace_MultiDrawArrays;
+    table->MultiDrawElements = Trace_MultiDrawElements;
+    table->PointParameterf = Trace_PointParameterf;
+    table->PointParameterfv = Trace_PointParameterfv;
+    table->PointParameteri = Trace_PointParameteri;
+    table->PointParameteriv = Trace_PointParameteriv;
+    table->BlendColor = Trace_BlendColor;
+    table->BlendEquation = Trace_BlendEquation;
+    table->GenQueries = Trace_GenQueries;
+    table->DeleteQueries = Trace_DeleteQueries;
+    table->IsQuery = Trace_IsQuery;
+    table->BeginQuery = Trace_BeginQuery;
+    table->EndQuery = Trace_EndQuery;
+    table->GetQueryiv = Trace_GetQueryiv;
+    table->GetQueryObjectiv = Trace_GetQueryObjectiv;
+    table->GetQueryObjectuiv = Trace_GetQueryObjectuiv;
+    table->BindBuffer = Trace_BindBuffer;
+    table->DeleteBuffers = Trace_DeleteBuffers;
+    table->GenBuffers = Trace_GenBuffers;
+    table->IsBuffer = Trace_IsBuffer;
+    table->BufferData = Trace_BufferData;
+    table->BufferSubData = Trace_BufferSubData;
+    table->GetBufferSubData = Trace_GetBufferSubData;
+    table->MapBuffer = Trace_MapBuffer;
+    table->UnmapBuffer = Trace_UnmapBuffer;
+    table->GetBufferParameteriv = Trace_GetBufferParameteriv;
+    table->GetBufferPointerv = Trace_GetBufferPointerv;
+    table->BlendEquationSeparate = Trace_BlendEquationSeparate;
+    table->DrawBuffers = Trace_DrawBuffers;
+    table->StencilOpSeparate = Trace_StencilOpSeparate;
+    table->StencilFuncSeparate = Trace_StencilFuncSeparate;
+    table->StencilMaskSeparate = Trace_StencilMaskSeparate;
+    table->AttachShader = Trace_AttachShader;
+    table->BindAttribLocation = Trace_BindAttribLocation;
+    table->CompileShader = Trace_CompileShader;
+    table->CreateProgram = Trace_CreateProgram;
+    table->CreateShader = Trace_CreateShader;
+    table->DeleteProgram = Trace_DeleteProgram;
+    table->DeleteShader = Trace_DeleteShader;
+    table->DetachShader = Trace_DetachShader;
+    table->DisableVertexAttribArray = Trace_DisableVertexAttribArray;
+    table->EnableVertexAttribArray = Trace_EnableVertexAttribArray;
+    table->GetActiveAttrib = Trace_GetActiveAttrib;
+    table->GetActiveUniform = Trace_GetActiveUniform;
+    table->GetAttachedShaders = Trace_GetAttachedShaders;
+    table->GetAttribLocation = Trace_GetAttribLocation;
+    table->GetProgramiv = Trace_GetProgramiv;
+    table->GetProgramInfoLog = Trace_GetProgramInfoLog;
+    table->GetShaderiv = Trace_GetShaderiv;
+    table->GetShaderInfoLog = Trace_GetShaderInfoLog;
+    table->GetShaderSource = Trace_GetShaderSource;
+    table->GetUniformLocation = Trace_GetUniformLocation;
+    table->GetUniformfv = Trace_GetUniformfv;
+    table->GetUniformiv = Trace_GetUniformiv;
+    table->GetVertexAttribdv = Trace_GetVertexAttribdv;
+    table->GetVertexAttribfv = Trace_GetVertexAttribfv;
+    table->GetVertexAttribiv = Trace_GetVertexAttribiv;
+    table->GetVertexAttribPointerv = Trace_GetVertexAttribPointerv;
+    table->IsProgram = Trace_IsProgram;
+    table->IsShader = Trace_IsShader;
+    table->LinkProgram = Trace_LinkProgram;
+    table->ShaderSource = Trace_ShaderSource;
+    table->UseProgram = Trace_UseProgram;
+    table->Uniform1f = Trace_Uniform1f;
+    table->Uniform2f = Trace_Uniform2f;
+    table->Uniform3f = Trace_Uniform3f;
+    table->Uniform4f = Trace_Uniform4f;
+    table->Uniform1i = Trace_Uniform1i;
+    table->Uniform2i = Trace_Uniform2i;
+    table->Uniform3i = Trace_Uniform3i;
+    table->Uniform4i = Trace_Uniform4i;
+    table->Uniform1fv = Trace_Uniform1fv;
+    table->Uniform2fv = Trace_Uniform2fv;
+    table->Uniform3fv = Trace_Uniform3fv;
+    table->Uniform4fv = Trace_Uniform4fv;
+    table->Uniform1iv = Trace_Uniform1iv;
+    table->Uniform2iv = Trace_Uniform2iv;
+    table->Uniform3iv = Trace_Uniform3iv;
+    table->Uniform4iv = Trace_Uniform4iv;
+    table->UniformMatrix2fv = Trace_UniformMatrix2fv;
+    table->UniformMatrix3fv = Trace_UniformMatrix3fv;
+    table->UniformMatrix4fv = Trace_UniformMatrix4fv;
+    table->ValidateProgram = Trace_ValidateProgram;
+    table->VertexAttrib1d = Trace_VertexAttrib1d;
+    table->VertexAttrib1dv = Trace_VertexAttrib1dv;
+    table->VertexAttrib1f = Trace_VertexAttrib1f;
+    table->VertexAttrib1fv = Trace_VertexAttrib1fv;
+    table->VertexAttrib1s = Trace_VertexAttrib1s;
+    table->VertexAttrib1sv = Trace_VertexAttrib1sv;
+    table->VertexAttrib2d = Trace_VertexAttrib2d;
+    table->VertexAttrib2dv = Trace_VertexAttrib2dv;
+    table->VertexAttrib2f = Trace_VertexAttrib2f;
+    table->VertexAttrib2fv = Trace_VertexAttrib2fv;
+    table->VertexAttrib2s = Trace_VertexAttrib2s;
+    table->VertexAttrib2sv = Trace_VertexAttrib2sv;
+    table->VertexAttrib3d = Trace_VertexAttrib3d;
+    table->VertexAttrib3dv = Trace_VertexAttrib3dv;
+    table->VertexAttrib3f = Trace_VertexAttrib3f;
+    table->VertexAttrib3fv = Trace_VertexAttrib3fv;
+    table->VertexAttrib3s = Trace_VertexAttrib3s;
+    table->VertexAttrib3sv = Trace_VertexAttrib3sv;
+    table->VertexAttrib4Nbv = Trace_VertexAttrib4Nbv;
+    table->VertexAttrib4Niv = Trace_VertexAttrib4Niv;
+    table->VertexAttrib4Nsv = Trace_VertexAttrib4Nsv;
+    table->VertexAttrib4Nub = Trace_VertexAttrib4Nub;
+    table->VertexAttrib4Nubv = Trace_VertexAttrib4Nubv;
+    table->VertexAttrib4Nuiv = Trace_VertexAttrib4Nuiv;
+    table->VertexAttrib4Nusv = Trace_VertexAttrib4Nusv;
+    table->VertexAttrib4bv = Trace_VertexAttrib4bv;
+    table->VertexAttrib4d = Trace_VertexAttrib4d;
+    table->VertexAttrib4dv = Trace_VertexAttrib4dv;
+    table->VertexAttrib4f = Trace_VertexAttrib4f;
+    table->VertexAttrib4fv = Trace_VertexAttrib4fv;
+    table->VertexAttrib4iv = Trace_VertexAttrib4iv;
+    table->VertexAttrib4s = Trace_VertexAttrib4s;
+    table->VertexAttrib4sv = Trace_VertexAttrib4sv;
+    table->VertexAttrib4ubv = Trace_VertexAttrib4ubv;
+    table->VertexAttrib4uiv = Trace_VertexAttrib4uiv;
+    table->VertexAttrib4usv = Trace_VertexAttrib4usv;
+    table->VertexAttribPointer = Trace_VertexAttribPointer;
+    table->UniformMatrix2x3fv = Trace_UniformMatrix2x3fv;
+    table->UniformMatrix3x2fv = Trace_UniformMatrix3x2fv;
+    table->UniformMatrix2x4fv = Trace_UniformMatrix2x4fv;
+    table->UniformMatrix4x2fv = Trace_UniformMatrix4x2fv;
+    table->UniformMatrix3x4fv = Trace_UniformMatrix3x4fv;
+    table->UniformMatrix4x3fv = Trace_UniformMatrix4x3fv;
+    table->ColorMaski = Trace_ColorMaski;
+    table->GetBooleani_v = Trace_GetBooleani_v;
+    table->GetIntegeri_v = Trace_GetIntegeri_v;
+    table->Enablei = Trace_Enablei;
+    table->Disablei = Trace_Disablei;
+    table->IsEnabledi = Trace_IsEnabledi;
+    table->BeginTransformFeedback = Trace_BeginTransformFeedback;
+    table->EndTransformFeedback = Trace_EndTransformFeedback;
+    table->BindBufferRange = Trace_BindBufferRange;
+    table->BindBufferBase = Trace_BindBufferBase;
+    table->TransformFeedbackVaryings = Trace_TransformFeedbackVaryings;
+    table->GetTransformFeedbackVarying = Trace_GetTransformFeedbackVarying;
+    table->ClampColor = Trace_ClampColor;
+    table->BeginConditionalRender = Trace_BeginConditionalRender;
+    table->EndConditionalRender = Trace_EndConditionalRender;
+    table->VertexAttribIPointer = Trace_VertexAttribIPointer;
+    table->GetVertexAttribIiv = Trace_GetVertexAttribIiv;
+    table->GetVertexAttribIuiv = Trace_GetVertexAttribIuiv;
+    table->VertexAttribI1i = Trace_VertexAttribI1i;
+    table->VertexAttribI2i = Trace_VertexAttribI2i;
+    table->VertexAttribI3i = Trace_VertexAttribI3i;
+    table->VertexAttribI4i = Trace_VertexAttribI4i;
+    table->VertexAttribI1ui = Trace_VertexAttribI1ui;
+    table->VertexAttribI2ui = Trace_VertexAttribI2ui;
+    table->VertexAttribI3ui = Trace_VertexAttribI3ui;
+    table->VertexAttribI4ui = Trace_VertexAttribI4ui;
+    table->VertexAttribI1iv = Trace_VertexAttribI1iv;
+    table->VertexAttribI2iv = Trace_VertexAttribI2iv;
+    table->VertexAttribI3iv = Trace_VertexAttribI3iv;
+    table->VertexAttribI4iv = Trace_VertexAttribI4iv;
+    table->VertexAttribI1uiv = Trace_VertexAttribI1uiv;
+    table->VertexAttribI2uiv = Trace_VertexAttribI2uiv;
+    table->VertexAttribI3uiv = Trace_VertexAttribI3uiv;
+    table->VertexAttribI4uiv = Trace_VertexAttribI4uiv;
+    table->VertexAttribI4bv = Trace_VertexAttribI4bv;
+    table->VertexAttribI4sv = Trace_VertexAttribI4sv;
+    table->VertexAttribI4ubv = Trace_VertexAttribI4ubv;
+    table->VertexAttribI4usv = Trace_VertexAttribI4usv;
+    table->GetUniformuiv = Trace_GetUniformuiv;
+    table->BindFragDataLocation = Trace_BindFragDataLocation;
+    table->GetFragDataLocation = Trace_GetFragDataLocation;
+    table->Uniform1ui = Trace_Uniform1ui;
+    table->Uniform2ui = Trace_Uniform2ui;
+    table->Uniform3ui = Trace_Uniform3ui;
+    table->Uniform4ui = Trace_Uniform4ui;
+    table->Uniform1uiv = Trace_Uniform1uiv;
+    table->Uniform2uiv = Trace_Uniform2uiv;
+    table->Uniform3uiv = Trace_Uniform3uiv;
+    table->Uniform4uiv = Trace_Uniform4uiv;
+    table->TexParameterIiv = Trace_TexParameterIiv;
+    table->TexParameterIuiv = Trace_TexParameterIuiv;
+    table->GetTexParameterIiv = Trace_GetTexParameterIiv;
+    table->GetTexParameterIuiv = Trace_GetTexParameterIuiv;
+    table->ClearBufferiv = Trace_ClearBufferiv;
+    table->ClearBufferuiv = Trace_ClearBufferuiv;
+    table->ClearBufferfv = Trace_ClearBufferfv;
+    table->ClearBufferfi = Trace_ClearBufferfi;
+    table->GetStringi = Trace_GetStringi;
+    table->IsRenderbuffer = Trace_IsRenderbuffer;
+    table->BindRenderbuffer = Trace_BindRenderbuffer;
+    table->DeleteRenderbuffers = Trace_DeleteRenderbuffers;
+    table->GenRenderbuffers = Trace_GenRenderbuffers;
+    table->RenderbufferStorage = Trace_RenderbufferStorage;
+    table->GetRenderbufferParameteriv = Trace_GetRenderbufferParameteriv;
+    table->IsFramebuffer = Trace_IsFramebuffer;
+    table->BindFramebuffer = Trace_BindFramebuffer;
+    table->DeleteFramebuffers = Trace_DeleteFramebuffers;
+    table->GenFramebuffers = Trace_GenFramebuffers;
+    table->CheckFramebufferStatus = Trace_CheckFramebufferStatus;
+    table->FramebufferTexture1D = Trace_FramebufferTexture1D;
+    table->FramebufferTexture2D = Trace_FramebufferTexture2D;
+    table->FramebufferTexture3D = Trace_FramebufferTexture3D;
+    table->FramebufferRenderbuffer = Trace_FramebufferRenderbuffer;
+    table->GetFramebufferAttachmentParameteriv = Trace_GetFramebufferAttachmentParameteriv;
+    table->GenerateMipmap = Trace_GenerateMipmap;
+    table->BlitFramebuffer = Trace_BlitFramebuffer;
+    table->RenderbufferStorageMultisample = Trace_RenderbufferStorageMultisample;
+    table->FramebufferTextureLayer = Trace_FramebufferTextureLayer;
+    table->MapBufferRange = Trace_MapBufferRange;
+    table->FlushMappedBufferRange = Trace_FlushMappedBufferRange;
+    table->BindVertexArray = Trace_BindVertexArray;
+    table->DeleteVertexArrays = Trace_DeleteVertexArrays;
+    table->GenVertexArrays = Trace_GenVertexArrays;
+    table->IsVertexArray = Trace_IsVertexArray;
+    table->DrawArraysInstanced = Trace_DrawArraysInstanced;
+    table->DrawElementsInstanced = Trace_DrawElementsInstanced;
+    table->TexBuffer = Trace_TexBuffer;
+    table->PrimitiveRestartIndex = Trace_PrimitiveRestartIndex;
+    table->CopyBufferSubData = Trace_CopyBufferSubData;
+    table->GetUniformIndices = Trace_GetUniformIndices;
+    table->GetActiveUniformsiv = Trace_GetActiveUniformsiv;
+    table->GetActiveUniformName = Trace_GetActiveUniformName;
+    table->GetUniformBlockIndex = Trace_GetUniformBlockIndex;
+    table->GetActiveUniformBlockiv = Trace_GetActiveUniformBlockiv;
+    table->GetActiveUniformBlockName = Trace_GetActiveUniformBlockName;
+    table->UniformBlockBinding = Trace_UniformBlockBinding;
+    table->DrawElementsBaseVertex = Trace_DrawElementsBaseVertex;
+    table->DrawRangeElementsBaseVertex = Trace_DrawRangeElementsBaseVertex;
+    table->DrawElementsInstancedBaseVertex = Trace_DrawElementsInstancedBaseVertex;
+    table->MultiDrawElementsBaseVertex = Trace_MultiDrawElementsBaseVertex;
+    table->ProvokingVertex = Trace_ProvokingVertex;
+    table->FenceSync = Trace_FenceSync;
+    table->IsSync = Trace_IsSync;
+    table->DeleteSync = Trace_DeleteSync;
+    table->ClientWaitSync = Trace_ClientWaitSync;
+    table->WaitSync = Trace_WaitSync;
+    table->GetInteger64v = Trace_GetInteger64v;
+    table->GetSynciv = Trace_GetSynciv;
+    table->GetInteger64i_v = Trace_GetInteger64i_v;
+    table->GetBufferParameteri64v = Trace_GetBufferParameteri64v;
+    table->FramebufferTexture = Trace_FramebufferTexture;
+    table->TexImage2DMultisample = Trace_TexImage2DMultisample;
+    table->TexImage3DMultisample = Trace_TexImage3DMultisample;
+    table->GetMultisamplefv = Trace_GetMultisamplefv;
+    table->SampleMaski = Trace_SampleMaski;
+    table->BindFragDataLocationIndexed = Trace_BindFragDataLocationIndexed;
+    table->GetFragDataIndex = Trace_GetFragDataIndex;
+    table->GenSamplers = Trace_GenSamplers;
+    table->DeleteSamplers = Trace_DeleteSamplers;
+    table->IsSampler = Trace_IsSampler;
+    table->BindSampler = Trace_BindSampler;
+    table->SamplerParameteri = Trace_SamplerParameteri;
+    table->SamplerParameteriv = Trace_SamplerParameteriv;
+    table->SamplerParameterf = Trace_SamplerParameterf;
+    table->SamplerParameterfv = Trace_SamplerParameterfv;
+    table->SamplerParameterIiv = Trace_SamplerParameterIiv;
+    table->SamplerParameterIuiv = Trace_SamplerParameterIuiv;
+    table->GetSamplerParameteriv = Trace_GetSamplerParameteriv;
+    table->GetSamplerParameterIiv = Trace_GetSamplerParameterIiv;
+    table->GetSamplerParameterfv = Trace_GetSamplerParameterfv;
+    table->GetSamplerParameterIuiv = Trace_GetSamplerParameterIuiv;
+    table->QueryCounter = Trace_QueryCounter;
+    table->GetQueryObjecti64v = Trace_GetQueryObjecti64v;
+    table->GetQueryObjectui64v = Trace_GetQueryObjectui64v;
+    table->VertexAttribDivisor = Trace_VertexAttribDivisor;
+    table->VertexAttribP1ui = Trace_VertexAttribP1ui;
+    table->VertexAttribP1uiv = Trace_VertexAttribP1uiv;
+    table->VertexAttribP2ui = Trace_VertexAttribP2ui;
+    table->VertexAttribP2uiv = Trace_VertexAttribP2uiv;
+    table->VertexAttribP3ui = Trace_VertexAttribP3ui;
+    table->VertexAttribP3uiv = Trace_VertexAttribP3uiv;
+    table->VertexAttribP4ui = Trace_VertexAttribP4ui;
+    table->VertexAttribP4uiv = Trace_VertexAttribP4uiv;
+    table->MinSampleShading = Trace_MinSampleShading;
+    table->BlendEquationi = Trace_BlendEquationi;
+    table->BlendEquationSeparatei = Trace_BlendEquationSeparatei;
+    table->BlendFunci = Trace_BlendFunci;
+    table->BlendFuncSeparatei = Trace_BlendFuncSeparatei;
+    table->DrawArraysIndirect = Trace_DrawArraysIndirect;
+    table->DrawElementsIndirect = Trace_DrawElementsIndirect;
+    table->Uniform1d = Trace_Uniform1d;
+    table->Uniform2d = Trace_Uniform2d;
+    table->Uniform3d = Trace_Uniform3d;
+    table->Uniform4d = Trace_Uniform4d;
+    table->Uniform1dv = Trace_Uniform1dv;
+    table->Uniform2dv = Trace_Uniform2dv;
+    table->Uniform3dv = Trace_Uniform3dv;
+    table->Uniform4dv = Trace_Uniform4dv;
+    table->UniformMatrix2dv = Trace_UniformMatrix2dv;
+    table->UniformMatrix3dv = Trace_UniformMatrix3dv;
+    table->UniformMatrix4dv = Trace_UniformMatrix4dv;
+    table->UniformMatrix2x3dv = Trace_UniformMatrix2x3dv;
+    table->UniformMatrix2x4dv = Trace_UniformMatrix2x4dv;
+    table->UniformMatrix3x2dv = Trace_UniformMatrix3x2dv;
+    table->UniformMatrix3x4dv = Trace_UniformMatrix3x4dv;
+    table->UniformMatrix4x2dv = Trace_UniformMatrix4x2dv;
+    table->UniformMatrix4x3dv = Trace_UniformMatrix4x3dv;
+    table->GetUniformdv = Trace_GetUniformdv;
+    table->GetSubroutineUniformLocation = Trace_GetSubroutineUniformLocation;
+    table->GetSubroutineIndex = Trace_GetSubroutineIndex;
+    table->GetActiveSubroutineUniformiv = Trace_GetActiveSubroutineUniformiv;
+    table->GetActiveSubroutineUniformName = Trace_GetActiveSubroutineUniformName;
+    table->GetActiveSubroutineName = Trace_GetActiveSubroutineName;
+    table->UniformSubroutinesuiv = Trace_UniformSubroutinesuiv;
+    table->GetUniformSubroutineuiv = Trace_GetUniformSubroutineuiv;
+    table->GetProgramStageiv = Trace_GetProgramStageiv;
+    table->PatchParameteri = Trace_PatchParameteri;
+    table->PatchParameterfv = Trace_PatchParameterfv;
+    table->BindTransformFeedback = Trace_BindTransformFeedback;
+    table->DeleteTransformFeedbacks = Trace_DeleteTransformFeedbacks;
+    table->GenTransformFeedbacks = Trace_GenTransformFeedbacks;
+    table->IsTransformFeedback = Trace_IsTransformFeedback;
+    table->PauseTransformFeedback = Trace_PauseTransformFeedback;
+    table->ResumeTransformFeedback = Trace_ResumeTransformFeedback;
+    table->DrawTransformFeedback = Trace_DrawTransformFeedback;
+    table->DrawTransformFeedbackStream = Trace_DrawTransformFeedbackStream;
+    table->BeginQueryIndexed = Trace_BeginQueryIndexed;
+    table->EndQueryIndexed = Trace_EndQueryIndexed;
+    table->GetQueryIndexediv = Trace_GetQueryIndexediv;
+    table->ReleaseShaderCompiler = Trace_ReleaseShaderCompiler;
+    table->ShaderBinary = Trace_ShaderBinary;
+    table->GetShaderPrecisionFormat = Trace_GetShaderPrecisionFormat;
+    table->DepthRangef = Trace_DepthRangef;
+    table->ClearDepthf = Trace_ClearDepthf;
+    table->GetProgramBinary = Trace_GetProgramBinary;
+    table->ProgramBinary = Trace_ProgramBinary;
+    table->ProgramParameteri = Trace_ProgramParameteri;
+    table->UseProgramStages = Trace_UseProgramStages;
+    table->ActiveShaderProgram = Trace_ActiveShaderProgram;
+    table->CreateShaderProgramv = Trace_CreateShaderProgramv;
+    table->BindProgramPipeline = Trace_BindProgramPipeline;
+    table->DeleteProgramPipelines = Trace_DeleteProgramPipelines;
+    table->GenProgramPipelines = Trace_GenProgramPipelines;
+    table->IsProgramPipeline = Trace_IsProgramPipeline;
+    table->GetProgramPipelineiv = Trace_GetProgramPipelineiv;
+    table->ProgramUniform1i = Trace_ProgramUniform1i;
+    table->ProgramUniform1iv = Trace_ProgramUniform1iv;
+    table->ProgramUniform1f = Trace_ProgramUniform1f;
+    table->ProgramUniform1fv = Trace_ProgramUniform1fv;
+    table->ProgramUniform1d = Trace_ProgramUniform1d;
+    table->ProgramUniform1dv = Trace_ProgramUniform1dv;
+    table->ProgramUniform1ui = Trace_ProgramUniform1ui;
+    table->ProgramUniform1uiv = Trace_ProgramUniform1uiv;
+    table->ProgramUniform2i = Trace_ProgramUniform2i;
+    table->ProgramUniform2iv = Trace_ProgramUniform2iv;
+    table->ProgramUniform2f = Trace_ProgramUniform2f;
+    table->ProgramUniform2fv = Trace_ProgramUniform2fv;
+    table->ProgramUniform2d = Trace_ProgramUniform2d;
+    table->ProgramUniform2dv = Trace_ProgramUniform2dv;
+    table->ProgramUniform2ui = Trace_ProgramUniform2ui;
+    table->ProgramUniform2uiv = Trace_ProgramUniform2uiv;
+    table->ProgramUniform3i = Trace_ProgramUniform3i;
+    table->ProgramUniform3iv = Trace_ProgramUniform3iv;
+    table->ProgramUniform3f = Trace_ProgramUniform3f;
+    table->ProgramUniform3fv = Trace_ProgramUniform3fv;
+    table->ProgramUniform3d = Trace_ProgramUniform3d;
+    table->ProgramUniform3dv = Trace_ProgramUniform3dv;
+    table->ProgramUniform3ui = Trace_ProgramUniform3ui;
+    table->ProgramUniform3uiv = Trace_ProgramUniform3uiv;
+    table->ProgramUniform4i = Trace_ProgramUniform4i;
+    table->ProgramUniform4iv = Trace_ProgramUniform4iv;
+    table->ProgramUniform4f = Trace_ProgramUniform4f;
+    table->ProgramUniform4fv = Trace_ProgramUniform4fv;
+    table->ProgramUniform4d = Trace_ProgramUniform4d;
+    table->ProgramUniform4dv = Trace_ProgramUniform4dv;
+    table->ProgramUniform4ui = Trace_ProgramUniform4ui;
+    table->ProgramUniform4uiv = Trace_ProgramUniform4uiv;
+    table->ProgramUniformMatrix2fv = Trace_ProgramUniformMatrix2fv;
+    table->ProgramUniformMatrix3fv = Trace_ProgramUniformMatrix3fv;
+    table->ProgramUniformMatrix4fv = Trace_ProgramUniformMatrix4fv;
+    table->ProgramUniformMatrix2dv = Trace_ProgramUniformMatrix2dv;
+    table->ProgramUniformMatrix3dv = Trace_ProgramUniformMatrix3dv;
+    table->ProgramUniformMatrix4dv = Trace_ProgramUniformMatrix4dv;
+    table->ProgramUniformMatrix2x3fv = Trace_ProgramUniformMatrix2x3fv;
+    table->ProgramUniformMatrix3x2fv = Trace_ProgramUniformMatrix3x2fv;
+    table->ProgramUniformMatrix2x4fv = Trace_ProgramUniformMatrix2x4fv;
+    table->ProgramUniformMatrix4x2fv = Trace_ProgramUniformMatrix4x2fv;
+    table->ProgramUniformMatrix3x4fv = Trace_ProgramUniformMatrix3x4fv;
+    table->ProgramUniformMatrix4x3fv = Trace_ProgramUniformMatrix4x3fv;
+    table->ProgramUniformMatrix2x3dv = Trace_ProgramUniformMatrix2x3dv;
+    table->ProgramUniformMatrix3x2dv = Trace_ProgramUniformMatrix3x2dv;
+    table->ProgramUniformMatrix2x4dv = Trace_ProgramUniformMatrix2x4dv;
+    table->ProgramUniformMatrix4x2dv = Trace_ProgramUniformMatrix4x2dv;
+    table->ProgramUniformMatrix3x4dv = Trace_ProgramUniformMatrix3x4dv;
+    table->ProgramUniformMatrix4x3dv = Trace_ProgramUniformMatrix4x3dv;
+    table->ValidateProgramPipeline = Trace_ValidateProgramPipeline;
+    table->GetProgramPipelineInfoLog = Trace_GetProgramPipelineInfoLog;
+    table->VertexAttribL1d = Trace_VertexAttribL1d;
+    table->VertexAttribL2d = Trace_VertexAttribL2d;
+    table->VertexAttribL3d = Trace_VertexAttribL3d;
+    table->VertexAttribL4d = Trace_VertexAttribL4d;
+    table->VertexAttribL1dv = Trace_VertexAttribL1dv;
+    table->VertexAttribL2dv = Trace_VertexAttribL2dv;
+    table->VertexAttribL3dv = Trace_VertexAttribL3dv;
+    table->VertexAttribL4dv = Trace_VertexAttribL4dv;
+    table->VertexAttribLPointer = Trace_VertexAttribLPointer;
+    table->GetVertexAttribLdv = Trace_GetVertexAttribLdv;
+    table->ViewportArrayv = Trace_ViewportArrayv;
+    table->ViewportIndexedf = Trace_ViewportIndexedf;
+    table->ViewportIndexedfv = Trace_ViewportIndexedfv;
+    table->ScissorArrayv = Trace_ScissorArrayv;
+    table->ScissorIndexed = Trace_ScissorIndexed;
+    table->ScissorIndexedv = Trace_ScissorIndexedv;
+    table->DepthRangeArrayv = Trace_DepthRangeArrayv;
+    table->DepthRangeIndexed = Trace_DepthRangeIndexed;
+    table->GetFloati_v = Trace_GetFloati_v;
+    table->GetDoublei_v = Trace_GetDoublei_v;
+    table->DrawArraysInstancedBaseInstance = Trace_DrawArraysInstancedBaseInstance;
+    table->DrawElementsInstancedBaseInstance = Trace_DrawElementsInstancedBaseInstance;
+    table->DrawElementsInstancedBaseVertexBaseInstance = Trace_DrawElementsInstancedBaseVertexBaseInstance;
+    table->GetInternalformativ = Trace_GetInternalformativ;
+    table->GetActiveAtomicCounterBufferiv = Trace_GetActiveAtomicCounterBufferiv;
+    table->BindImageTexture = Trace_BindImageTexture;
+    table->MemoryBarrier = Trace_MemoryBarrier;
+    table->TexStorage1D = Trace_TexStorage1D;
+    table->TexStorage2D = Trace_TexStorage2D;
+    table->TexStorage3D = Trace_TexStorage3D;
+    table->DrawTransformFeedbackInstanced = Trace_DrawTransformFeedbackInstanced;
+    table->DrawTransformFeedbackStreamInstanced = Trace_DrawTransformFeedbackStreamInstanced;
+    table->ClearBufferData = Trace_ClearBufferData;
+    table->ClearBufferSubData = Trace_ClearBufferSubData;
+    table->DispatchCompute = Trace_DispatchCompute;
+    table->DispatchComputeIndirect = Trace_DispatchComputeIndirect;
+    table->CopyImageSubData = Trace_CopyImageSubData;
+    table->FramebufferParameteri = Trace_FramebufferParameteri;
+    table->GetFramebufferParameteriv = Trace_GetFramebufferParameteriv;
+    table->GetInternalformati64v = Trace_GetInternalformati64v;
+    table->InvalidateTexSubImage = Trace_InvalidateTexSubImage;
+    table->InvalidateTexImage = Trace_InvalidateTexImage;
+    table->InvalidateBufferSubData = Trace_InvalidateBufferSubData;
+    table->InvalidateBufferData = Trace_InvalidateBufferData;
+    table->InvalidateFramebuffer = Trace_InvalidateFramebuffer;
+    table->InvalidateSubFramebuffer = Trace_InvalidateSubFramebuffer;
+    table->MultiDrawArraysIndirect = Trace_MultiDrawArraysIndirect;
+    table->MultiDrawElementsIndirect = Trace_MultiDrawElementsIndirect;
+    table->GetProgramInterfaceiv = Trace_GetProgramInterfaceiv;
+    table->GetProgramResourceIndex = Trace_GetProgramResourceIndex;
+    table->GetProgramResourceName = Trace_GetProgramResourceName;
+    table->GetProgramResourceiv = Trace_GetProgramResourceiv;
+    table->GetProgramResourceLocation = Trace_GetProgramResourceLocation;
+    table->GetProgramResourceLocationIndex = Trace_GetProgramResourceLocationIndex;
+    table->ShaderStorageBlockBinding = Trace_ShaderStorageBlockBinding;
+    table->TexBufferRange = Trace_TexBufferRange;
+    table->TexStorage2DMultisample = Trace_TexStorage2DMultisample;
+    table->TexStorage3DMultisample = Trace_TexStorage3DMultisample;
+    table->TextureView = Trace_TextureView;
+    table->BindVertexBuffer = Trace_BindVertexBuffer;
+    table->VertexAttribFormat = Trace_VertexAttribFormat;
+    table->VertexAttribIFormat = Trace_VertexAttribIFormat;
+    table->VertexAttribLFormat = Trace_VertexAttribLFormat;
+    table->VertexAttribBinding = Trace_VertexAttribBinding;
+    table->VertexBindingDivisor = Trace_VertexBindingDivisor;
+    table->DebugMessageControl = Trace_DebugMessageControl;
+    table->DebugMessageInsert = Trace_DebugMessageInsert;
+    table->DebugMessageCallback = Trace_DebugMessageCallback;
+    table->GetDebugMessageLog = Trace_GetDebugMessageLog;
+    table->PushDebugGroup = Trace_PushDebugGroup;
+    table->PopDebugGroup = Trace_PopDebugGroup;
+    table->ObjectLabel = Trace_ObjectLabel;
+    table->GetObjectLabel = Trace_GetObjectLabel;
+    table->ObjectPtrLabel = Trace_ObjectPtrLabel;
+    table->GetObjectPtrLabel = Trace_GetObjectPtrLabel;
+    table->BufferStorage = Trace_BufferStorage;
+    table->ClearTexImage = Trace_ClearTexImage;
+    table->ClearTexSubImage = Trace_ClearTexSubImage;
+    table->BindBuffersBase = Trace_BindBuffersBase;
+    table->BindBuffersRange = Trace_BindBuffersRange;
+    table->BindTextures = Trace_BindTextures;
+    table->BindSamplers = Trace_BindSamplers;
+    table->BindImageTextures = Trace_BindImageTextures;
+    table->BindVertexBuffers = Trace_BindVertexBuffers;
+    table->ClipControl = Trace_ClipControl;
+    table->CreateTransformFeedbacks = Trace_CreateTransformFeedbacks;
+    table->TransformFeedbackBufferBase = Trace_TransformFeedbackBufferBase;
+    table->TransformFeedbackBufferRange = Trace_TransformFeedbackBufferRange;
+    table->GetTransformFeedbackiv = Trace_GetTransformFeedbackiv;
+    table->GetTransformFeedbacki_v = Trace_GetTransformFeedbacki_v;
+    table->GetTransformFeedbacki64_v = Trace_GetTransformFeedbacki64_v;
+    table->CreateBuffers = Trace_CreateBuffers;
+    table->NamedBufferStorage = Trace_NamedBufferStorage;
+    table->NamedBufferData = Trace_NamedBufferData;
+    table->NamedBufferSubData = Trace_NamedBufferSubData;
+    table->CopyNamedBufferSubData = Trace_CopyNamedBufferSubData;
+    table->ClearNamedBufferData = Trace_ClearNamedBufferData;
+    table->ClearNamedBufferSubData = Trace_ClearNamedBufferSubData;
+    table->MapNamedBuffer = Trace_MapNamedBuffer;
+    table->MapNamedBufferRange = Trace_MapNamedBufferRange;
+    table->UnmapNamedBuffer = Trace_UnmapNamedBuffer;
+    table->FlushMappedNamedBufferRange = Trace_FlushMappedNamedBufferRange;
+    table->GetNamedBufferParameteriv = Trace_GetNamedBufferParameteriv;
+    table->GetNamedBufferParameteri64v = Trace_GetNamedBufferParameteri64v;
+    table->GetNamedBufferPointerv = Trace_GetNamedBufferPointerv;
+    table->GetNamedBufferSubData = Trace_GetNamedBufferSubData;
+    table->CreateFramebuffers = Trace_CreateFramebuffers;
+    table->NamedFramebufferRenderbuffer = Trace_NamedFramebufferRenderbuffer;
+    table->NamedFramebufferParameteri = Trace_NamedFramebufferParameteri;
+    table->NamedFramebufferTexture = Trace_NamedFramebufferTexture;
+    table->NamedFramebufferTextureLayer = Trace_NamedFramebufferTextureLayer;
+    table->NamedFramebufferDrawBuffer = Trace_NamedFramebufferDrawBuffer;
+    table->NamedFramebufferDrawBuffers = Trace_NamedFramebufferDrawBuffers;
+    table->NamedFramebufferReadBuffer = Trace_NamedFramebufferReadBuffer;
+    table->InvalidateNamedFramebufferData = Trace_InvalidateNamedFramebufferData;
+    table->InvalidateNamedFramebufferSubData = Trace_InvalidateNamedFramebufferSubData;
+    table->ClearNamedFramebufferiv = Trace_ClearNamedFramebufferiv;
+    table->ClearNamedFramebufferuiv = Trace_ClearNamedFramebufferuiv;
+    table->ClearNamedFramebufferfv = Trace_ClearNamedFramebufferfv;
+    table->ClearNamedFramebufferfi = Trace_ClearNamedFramebufferfi;
+    table->BlitNamedFramebuffer = Trace_BlitNamedFramebuffer;
+    table->CheckNamedFramebufferStatus = Trace_CheckNamedFramebufferStatus;
+    table->GetNamedFramebufferParameteriv = Trace_GetNamedFramebufferParameteriv;
+    table->GetNamedFramebufferAttachmentParameteriv = Trace_GetNamedFramebufferAttachmentParameteriv;
+    table->CreateRenderbuffers = Trace_CreateRenderbuffers;
+    table->NamedRenderbufferStorage = Trace_NamedRenderbufferStorage;
+    table->NamedRenderbufferStorageMultisample = Trace_NamedRenderbufferStorageMultisample;
+    table->GetNamedRenderbufferParameteriv = Trace_GetNamedRenderbufferParameteriv;
+    table->CreateTextures = Trace_CreateTextures;
+    table->TextureBuffer = Trace_TextureBuffer;
+    table->TextureBufferRange = Trace_TextureBufferRange;
+    table->TextureStorage1D = Trace_TextureStorage1D;
+    table->TextureStorage2D = Trace_TextureStorage2D;
+    table->TextureStorage3D = Trace_TextureStorage3D;
+    table->TextureStorage2DMultisample = Trace_TextureStorage2DMultisample;
+    table->TextureStorage3DMultisample = Trace_TextureStorage3DMultisample;
+    table->TextureSubImage1D = Trace_TextureSubImage1D;
+    table->TextureSubImage2D = Trace_TextureSubImage2D;
+    table->TextureSubImage3D = Trace_TextureSubImage3D;
+    table->CompressedTextureSubImage1D = Trace_CompressedTextureSubImage1D;
+    table->CompressedTextureSubImage2D = Trace_CompressedTextureSubImage2D;
+    table->CompressedTextureSubImage3D = Trace_CompressedTextureSubImage3D;
+    table->CopyTextureSubImage1D = Trace_CopyTextureSubImage1D;
+    table->CopyTextureSubImage2D = Trace_CopyTextureSubImage2D;
+    table->CopyTextureSubImage3D = Trace_CopyTextureSubImage3D;
+    table->TextureParameterf = Trace_TextureParameterf;
+    table->TextureParameterfv = Trace_TextureParameterfv;
+    table->TextureParameteri = Trace_TextureParameteri;
+    table->TextureParameterIiv = Trace_TextureParameterIiv;
+    table->TextureParameterIuiv = Trace_TextureParameterIuiv;
+    table->TextureParameteriv = Trace_TextureParameteriv;
+    table->GenerateTextureMipmap = Trace_GenerateTextureMipmap;
+    table->BindTextureUnit = Trace_BindTextureUnit;
+    table->GetTextureImage = Trace_GetTextureImage;
+    table->GetCompressedTextureImage = Trace_GetCompressedTextureImage;
+    table->GetTextureLevelParameterfv = Trace_GetTextureLevelParameterfv;
+    table->GetTextureLevelParameteriv = Trace_GetTextureLevelParameteriv;
+    table->GetTextureParameterfv = Trace_GetTextureParameterfv;
+    table->GetTextureParameterIiv = Trace_GetTextureParameterIiv;
+    table->GetTextureParameterIuiv = Trace_GetTextureParameterIuiv;
+    table->GetTextureParameteriv = Trace_GetTextureParameteriv;
+    table->CreateVertexArrays = Trace_CreateVertexArrays;
+    table->DisableVertexArrayAttrib = Trace_DisableVertexArrayAttrib;
+    table->EnableVertexArrayAttrib = Trace_EnableVertexArrayAttrib;
+    table->VertexArrayElementBuffer = Trace_VertexArrayElementBuffer;
+    table->VertexArrayVertexBuffer = Trace_VertexArrayVertexBuffer;
+    table->VertexArrayVertexBuffers = Trace_VertexArrayVertexBuffers;
+    table->VertexArrayAttribBinding = Trace_VertexArrayAttribBinding;
+    table->VertexArrayAttribFormat = Trace_VertexArrayAttribFormat;
+    table->VertexArrayAttribIFormat = Trace_VertexArrayAttribIFormat;
+    table->VertexArrayAttribLFormat = Trace_VertexArrayAttribLFormat;
+    table->VertexArrayBindingDivisor = Trace_VertexArrayBindingDivisor;
+    table->GetVertexArrayiv = Trace_GetVertexArrayiv;
+    table->GetVertexArrayIndexediv = Trace_GetVertexArrayIndexediv;
+    table->GetVertexArrayIndexed64iv = Trace_GetVertexArrayIndexed64iv;
+    table->CreateSamplers = Trace_CreateSamplers;
+    table->CreateProgramPipelines = Trace_CreateProgramPipelines;
+    table->CreateQueries = Trace_CreateQueries;
+    table->GetQueryBufferObjecti64v = Trace_GetQueryBufferObjecti64v;
+    table->GetQueryBufferObjectiv = Trace_GetQueryBufferObjectiv;
+    table->GetQueryBufferObjectui64v = Trace_GetQueryBufferObjectui64v;
+    table->GetQueryBufferObjectuiv = Trace_GetQueryBufferObjectuiv;
+    table->MemoryBarrierByRegion = Trace_MemoryBarrierByRegion;
+    table->GetTextureSubImage = Trace_GetTextureSubImage;
+    table->GetCompressedTextureSubImage = Trace_GetCompressedTextureSubImage;
+    table->GetGraphicsResetStatus = Trace_GetGraphicsResetStatus;
+    table->GetnCompressedTexImage = Trace_GetnCompressedTexImage;
+    table->GetnTexImage = Trace_GetnTexImage;
+    table->GetnUniformdv = Trace_GetnUniformdv;
+    table->GetnUniformfv = Trace_GetnUniformfv;
+    table->GetnUniformiv = Trace_GetnUniformiv;
+    table->GetnUniformuiv = Trace_GetnUniformuiv;
+    table->ReadnPixels = Trace_ReadnPixels;
+    table->TextureBarrier = Trace_TextureBarrier;
+    table->GetTextureHandleARB = Trace_GetTextureHandleARB;
+    table->GetTextureSamplerHandleARB = Trace_GetTextureSamplerHandleARB;
+    table->MakeTextureHandleResidentARB = Trace_MakeTextureHandleResidentARB;
+    table->MakeTextureHandleNonResidentARB = Trace_MakeTextureHandleNonResidentARB;
+    table->GetImageHandleARB = Trace_GetImageHandleARB;
+    table->MakeImageHandleResidentARB = Trace_MakeImageHandleResidentARB;
+    table->MakeImageHandleNonResidentARB = Trace_MakeImageHandleNonResidentARB;
+    table->UniformHandleui64ARB = Trace_UniformHandleui64ARB;
+    table->UniformHandleui64vARB = Trace_UniformHandleui64vARB;
+    table->ProgramUniformHandleui64ARB = Trace_ProgramUniformHandleui64ARB;
+    table->ProgramUniformHandleui64vARB = Trace_ProgramUniformHandleui64vARB;
+    table->IsTextureHandleResidentARB = Trace_IsTextureHandleResidentARB;
+    table->IsImageHandleResidentARB = Trace_IsImageHandleResidentARB;
+    table->VertexAttribL1ui64ARB = Trace_VertexAttribL1ui64ARB;
+    table->VertexAttribL1ui64vARB = Trace_VertexAttribL1ui64vARB;
+    table->GetVertexAttribLui64vARB = Trace_GetVertexAttribLui64vARB;
+    table->CreateSyncFromCLeventARB = Trace_CreateSyncFromCLeventARB;
+    table->DispatchComputeGroupSizeARB = Trace_DispatchComputeGroupSizeARB;
+    table->DebugMessageControlARB = Trace_DebugMessageControlARB;
+    table->DebugMessageInsertARB = Trace_DebugMessageInsertARB;
+    table->DebugMessageCallbackARB = Trace_DebugMessageCallbackARB;
+    table->GetDebugMessageLogARB = Trace_GetDebugMessageLogARB;
+    table->BlendEquationiARB = Trace_BlendEquationiARB;
+    table->BlendEquationSeparateiARB = Trace_BlendEquationSeparateiARB;
+    table->BlendFunciARB = Trace_BlendFunciARB;
+    table->BlendFuncSeparateiARB = Trace_BlendFuncSeparateiARB;
+    table->MultiDrawArraysIndirectCountARB = Trace_MultiDrawArraysIndirectCountARB;
+    table->MultiDrawElementsIndirectCountARB = Trace_MultiDrawElementsIndirectCountARB;
+    table->GetGraphicsResetStatusARB = Trace_GetGraphicsResetStatusARB;
+    table->GetnTexImageARB = Trace_GetnTexImageARB;
+    table->ReadnPixelsARB = Trace_ReadnPixelsARB;
+    table->GetnCompressedTexImageARB = Trace_GetnCompressedTexImageARB;
+    table->GetnUniformfvARB = Trace_GetnUniformfvARB;
+    table->GetnUniformivARB = Trace_GetnUniformivARB;
+    table->GetnUniformuivARB = Trace_GetnUniformuivARB;
+    table->GetnUniformdvARB = Trace_GetnUniformdvARB;
+    table->MinSampleShadingARB = Trace_MinSampleShadingARB;
+    table->NamedStringARB = Trace_NamedStringARB;
+    table->DeleteNamedStringARB = Trace_DeleteNamedStringARB;
+    table->CompileShaderIncludeARB = Trace_CompileShaderIncludeARB;
+    table->IsNamedStringARB = Trace_IsNamedStringARB;
+    table->GetNamedStringARB = Trace_GetNamedStringARB;
+    table->GetNamedStringivARB = Trace_GetNamedStringivARB;
+    table->BufferPageCommitmentARB = Trace_BufferPageCommitmentARB;
+    table->NamedBufferPageCommitmentEXT = Trace_NamedBufferPageCommitmentEXT;
+    table->NamedBufferPageCommitmentARB = Trace_NamedBufferPageCommitmentARB;
+    table->TexPageCommitmentARB = Trace_TexPageCommitmentARB;
+    table->GetMultisamplefvNV = Trace_GetMultisamplefvNV;
+    table->SampleMaskIndexedNV = Trace_SampleMaskIndexedNV;
+    table->TexRenderbufferNV = Trace_TexRenderbufferNV;
+    table->MakeBufferResidentNV = Trace_MakeBufferResidentNV;
+    table->MakeBufferNonResidentNV = Trace_MakeBufferNonResidentNV;
+    table->IsBufferResidentNV = Trace_IsBufferResidentNV;
+    table->MakeNamedBufferResidentNV = Trace_MakeNamedBufferResidentNV;
+    table->MakeNamedBufferNonResidentNV = Trace_MakeNamedBufferNonResidentNV;
+    table->IsNamedBufferResidentNV = Trace_IsNamedBufferResidentNV;
+    table->GetBufferParameterui64vNV = Trace_GetBufferParameterui64vNV;
+    table->GetNamedBufferParameterui64vNV = Trace_GetNamedBufferParameterui64vNV;
+    table->GetIntegerui64vNV = Trace_GetIntegerui64vNV;
+    table->Uniformui64NV = Trace_Uniformui64NV;
+    table->Uniformui64vNV = Trace_Uniformui64vNV;
+    table->ProgramUniformui64NV = Trace_ProgramUniformui64NV;
+    table->ProgramUniformui64vNV = Trace_ProgramUniformui64vNV;
+    table->BufferAddressRangeNV = Trace_BufferAddressRangeNV;
+    table->VertexFormatNV = Trace_VertexFormatNV;
+    table->NormalFormatNV = Trace_NormalFormatNV;
+    table->ColorFormatNV = Trace_ColorFormatNV;
+    table->IndexFormatNV = Trace_IndexFormatNV;
+    table->TexCoordFormatNV = Trace_TexCoordFormatNV;
+    table->EdgeFlagFormatNV = Trace_EdgeFlagFormatNV;
+    table->SecondaryColorFormatNV = Trace_SecondaryColorFormatNV;
+    table->FogCoordFormatNV = Trace_FogCoordFormatNV;
+    table->VertexAttribFormatNV = Trace_VertexAttribFormatNV;
+    table->VertexAttribIFormatNV = Trace_VertexAttribIFormatNV;
+    table->GetIntegerui64i_vNV = Trace_GetIntegerui64i_vNV;
+    table->EnableClientState = Trace_EnableClientState;
+    table->DisableClientState = Trace_DisableClientState;
+}
+
+} /* namespace internal */
+} /* namespace oglp */
+
+#endif /* defined OGLP_TRACE */
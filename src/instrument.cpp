@@ -0,0 +1,130 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file */
+#include <oglp/instrument.h>
+#include <algorithm>
+
+#ifdef OGLP_INSTRUMENT
+#include <mutex>
+#endif
+
+namespace oglp {
+
+#ifdef OGLP_INSTRUMENT
+namespace internal {
+
+static std::mutex instrumentmutex;
+/* counters of all living threads */
+static std::vector<InstrumentCounters *> instrumentthreads;
+/* merged counters of threads that exited */
+static uint64_t instrumentcalls[NumProcs];
+static uint64_t instrumenttime[NumProcs];
+
+#ifndef OGLP_DISPATCH_TABLE
+DispatchTable instrumentnext;
+#endif
+thread_local InstrumentCounters instrumentcounters;
+
+InstrumentCounters::InstrumentCounters (void)
+{
+    unsigned int i;
+    for (i = 0; i < NumProcs; i++) {
+        calls[i] = 0;
+        time[i] = 0;
+    }
+    std::lock_guard<std::mutex> lock (instrumentmutex);
+    instrumentthreads.push_back (this);
+}
+
+InstrumentCounters::~InstrumentCounters (void)
+{
+    unsigned int i;
+    std::lock_guard<std::mutex> lock (instrumentmutex);
+    for (i = 0; i < NumProcs; i++) {
+        instrumentcalls[i] += calls[i];
+        instrumenttime[i] += time[i];
+    }
+    instrumentthreads.erase (std::find (instrumentthreads.begin (),
+                                        instrumentthreads.end (), this));
+}
+
+void InstallInstrumentation (void)
+{
+    DispatchTable thunks;
+#ifdef OGLP_DISPATCH_TABLE
+    std::unique_ptr<DispatchTable> &next = currentdispatch->instrumentnext;
+    if (!next)
+        next.reset (new DispatchTable);
+    GetDispatch (next.get ());
+#else
+    GetDispatch (&instrumentnext);
+#endif
+    GetInstrumentThunks (&thunks);
+    thunks.getprocaddress = InstrumentNext ().getprocaddress;
+    SetDispatch (&thunks);
+}
+
+} /* namespace internal */
+#endif /* defined OGLP_INSTRUMENT */
+
+std::vector<CallStats> GetCallStats (void)
+{
+    std::vector<CallStats> stats;
+#ifdef OGLP_INSTRUMENT
+    std::lock_guard<std::mutex> lock (internal::instrumentmutex);
+    unsigned int i;
+    for (i = 0; i < NumProcs; i++) {
+        CallStats entry;
+        entry.calls = internal::instrumentcalls[i];
+        entry.time = internal::instrumenttime[i];
+        for (internal::InstrumentCounters *counters : internal::instrumentthreads) {
+            entry.calls += counters->calls[i].load (std::memory_order_relaxed);
+            entry.time += counters->time[i].load (std::memory_order_relaxed);
+        }
+        if (entry.calls) {
+            entry.name = internal::InstrumentProcNames[i];
+            stats.push_back (entry);
+        }
+    }
+    std::sort (stats.begin (), stats.end (),
+               [] (const CallStats &a, const CallStats &b) {
+        return a.time > b.time;
+    });
+#endif
+    return stats;
+}
+
+void ResetCallStats (void)
+{
+#ifdef OGLP_INSTRUMENT
+    std::lock_guard<std::mutex> lock (internal::instrumentmutex);
+    unsigned int i;
+    for (i = 0; i < NumProcs; i++) {
+        internal::instrumentcalls[i] = 0;
+        internal::instrumenttime[i] = 0;
+        for (internal::InstrumentCounters *counters : internal::instrumentthreads) {
+            counters->calls[i].store (0, std::memory_order_relaxed);
+            counters->time[i].store (0, std::memory_order_relaxed);
+        }
+    }
+#endif
+}
+
+} /* namespace oglp */
@@ -0,0 +1,194 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file */
+#include <oglp/meshpool.h>
+#include <algorithm>
+#include <iterator>
+
+namespace oglp {
+
+MeshPool::MeshPool (GLsizeiptr _capacity, GLsizeiptr _alignment,
+                    GLbitfield flags)
+    : capacity (_capacity), alignment (_alignment)
+{
+    buffer.Storage (capacity, NULL, flags);
+    freeranges[0] = capacity;
+}
+
+std::map<GLintptr, GLsizeiptr>::iterator MeshPool::FindFree (GLsizeiptr size,
+                                                             GLintptr limit)
+{
+    std::map<GLintptr, GLsizeiptr>::iterator it;
+    for (it = freeranges.begin (); it != freeranges.end (); it++) {
+        if (it->first + size > limit)
+            break;
+        if (it->second >= size)
+            return it;
+    }
+    return freeranges.end ();
+}
+
+void MeshPool::Take (std::map<GLintptr, GLsizeiptr>::iterator range,
+                     GLsizeiptr size)
+{
+    GLintptr offset = range->first + size;
+    GLsizeiptr rest = range->second - size;
+    freeranges.erase (range);
+    if (rest)
+        freeranges[offset] = rest;
+}
+
+void MeshPool::Release (GLintptr offset, GLsizeiptr size)
+{
+    std::map<GLintptr, GLsizeiptr>::iterator next, prev;
+    next = freeranges.lower_bound (offset);
+    if (next != freeranges.end () && offset + size == next->first) {
+        size += next->second;
+        next = freeranges.erase (next);
+    }
+    if (next != freeranges.begin ()) {
+        prev = std::prev (next);
+        if (prev->first + prev->second == offset) {
+            prev->second += size;
+            return;
+        }
+    }
+    freeranges.emplace_hint (next, offset, size);
+}
+
+void MeshPool::Retire (GLintptr offset, GLsizeiptr size)
+{
+    retiring.emplace_back (offset, size);
+}
+
+void MeshPool::Reclaim (void)
+{
+    while (!retired.empty () && retired.front ().fence.IsSignaled ()) {
+        for (const std::pair<GLintptr, GLsizeiptr> &range : retired.front ().ranges)
+            Release (range.first, range.second);
+        retired.pop_front ();
+    }
+}
+
+MeshPool::Handle MeshPool::Allocate (GLsizeiptr size)
+{
+    std::map<GLintptr, GLsizeiptr>::iterator range;
+    Handle handle;
+    /* entries of size zero are unused */
+    if (size <= 0)
+        return 0;
+    Reclaim ();
+    range = FindFree (Padded (size), capacity);
+    if (range == freeranges.end ())
+        return 0;
+    if (unused.empty ()) {
+        entries.emplace_back ();
+        handle = entries.size ();
+    } else {
+        handle = unused.back ();
+        unused.pop_back ();
+    }
+    entries[handle - 1].offset = range->first;
+    entries[handle - 1].size = size;
+    live[range->first] = handle;
+    Take (range, Padded (size));
+    return handle;
+}
+
+void MeshPool::Free (Handle handle)
+{
+    /* ignore the failure handle, unknown handles and double frees */
+    if (!handle || handle > entries.size () || !entries[handle - 1].size)
+        return;
+    Entry &entry = entries[handle - 1];
+    live.erase (entry.offset);
+    Retire (entry.offset, Padded (entry.size));
+    entry.size = 0;
+    unused.push_back (handle);
+}
+
+GLsizeiptr MeshPool::Compact (GLsizeiptr budget)
+{
+    std::vector<Handle> candidates;
+    std::map<GLintptr, Handle>::reverse_iterator it;
+    GLsizeiptr moved = 0;
+
+    Reclaim ();
+    /* plan the moves first, as moving modifies the live ranges */
+    for (it = live.rbegin (); it != live.rend (); it++)
+        candidates.push_back (it->second);
+
+    for (Handle handle : candidates) {
+        Entry &entry = entries[handle - 1];
+        GLsizeiptr size = Padded (entry.size);
+        GLintptr from = entry.offset;
+        std::map<GLintptr, GLsizeiptr>::iterator range;
+        if (moved + entry.size > budget)
+            continue;
+        /* only move downwards into ranges that do not overlap the
+         * allocation, which CopySubData does not allow */
+        range = FindFree (size, from);
+        if (range == freeranges.end ())
+            continue;
+        entry.offset = range->first;
+        Take (range, size);
+        Buffer::CopySubData (buffer, buffer, from, entry.offset, entry.size);
+        live.erase (from);
+        live[entry.offset] = handle;
+        Retire (from, size);
+        moved += entry.size;
+        if (relocate)
+            relocate (handle, from, entry.offset);
+    }
+    return moved;
+}
+
+void MeshPool::Update (void)
+{
+    if (!retiring.empty ()) {
+        retired.emplace_back ();
+        retired.back ().fence.Insert ();
+        retired.back ().ranges.swap (retiring);
+    }
+    Reclaim ();
+}
+
+MeshPool::Stats MeshPool::GetStats (void) const
+{
+    Stats stats;
+    stats.allocations = live.size ();
+    stats.free = 0;
+    stats.largestfree = 0;
+    stats.retired = 0;
+    for (const std::pair<const GLintptr, GLsizeiptr> &range : freeranges) {
+        stats.free += range.second;
+        stats.largestfree = std::max (stats.largestfree, range.second);
+    }
+    for (const std::pair<GLintptr, GLsizeiptr> &range : retiring)
+        stats.retired += range.second;
+    for (const Retired &r : retired) {
+        for (const std::pair<GLintptr, GLsizeiptr> &range : r.ranges)
+            stats.retired += range.second;
+    }
+    stats.used = capacity - stats.free - stats.retired;
+    return stats;
+}
+
+} /* namespace oglp */
@@ -0,0 +1,196 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file */
+#include <oglp/nulldriver.h>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+namespace oglp {
+
+namespace internal {
+
+/* Buffers mapped without a range get at least this much memory. */
+static const size_t NullMapSize = 1 << 20;
+
+std::atomic<bool> nullcounting (false);
+
+static std::atomic<GLuint> nullnames (1);
+static std::mutex nullmutex;
+static std::unordered_map<GLuint, std::vector<char>> nullbuffers;
+static std::unordered_map<GLenum, std::vector<char>> nulltargets;
+
+const GLubyte *NullString (GLenum name)
+{
+    const char *str;
+    switch (name) {
+        case GL_VERSION:
+            str = "4.5 (Core Profile) oglp null driver";
+            break;
+        case GL_SHADING_LANGUAGE_VERSION:
+            str = "4.50";
+            break;
+        case GL_VENDOR:
+            str = "oglp";
+            break;
+        case GL_RENDERER:
+            str = "oglp null driver";
+            break;
+        default:
+            str = NULL;
+            break;
+    }
+    return reinterpret_cast<const GLubyte *> (str);
+}
+
+const GLubyte *NullStringi (GLenum name, GLuint index)
+{
+    if (name != GL_EXTENSIONS || index >= NumExtensions)
+        return NULL;
+    return reinterpret_cast<const GLubyte *> (ExtensionNames[index]);
+}
+
+GLint64 NullQueryValue (GLenum pname)
+{
+    switch (pname) {
+        case GL_MAJOR_VERSION:
+            return 4;
+        case GL_MINOR_VERSION:
+            return 5;
+        case GL_NUM_EXTENSIONS:
+            return NumExtensions;
+        case GL_CONTEXT_PROFILE_MASK:
+            return GL_CONTEXT_CORE_PROFILE_BIT;
+        case GL_COMPILE_STATUS:
+        case GL_LINK_STATUS:
+        case GL_VALIDATE_STATUS:
+            return GL_TRUE;
+        case GL_SYNC_STATUS:
+            return GL_SIGNALED;
+        case GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT:
+        case GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT:
+        case GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT:
+        case GL_MIN_MAP_BUFFER_ALIGNMENT:
+            return 256;
+        case GL_SPARSE_BUFFER_PAGE_SIZE_ARB:
+            return 65536;
+        default:
+            return 0;
+    }
+}
+
+GLuint NullName (void)
+{
+    return nullnames++;
+}
+
+void NullNames (GLsizei n, GLuint *names)
+{
+    GLsizei i;
+    if (!names || n <= 0)
+        return;
+    GLuint first = nullnames.fetch_add (n);
+    for (i = 0; i < n; i++)
+        names[i] = first + i;
+}
+
+GLsync NullSync (void)
+{
+    return reinterpret_cast<GLsync> (static_cast<uintptr_t> (NullName ()));
+}
+
+/* Memory of a mapped buffer. The memory of a buffer is only reallocated
+ * if it is mapped with a larger range than before. */
+static void *NullMap (std::vector<char> &memory, GLintptr offset,
+                      GLsizeiptr length)
+{
+    size_t size = offset + (length > 0 ? length : NullMapSize);
+    if (memory.size () < size)
+        memory.resize (size);
+    return memory.data () + offset;
+}
+
+void *NullMapBuffer (GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+    std::lock_guard<std::mutex> lock (nullmutex);
+    return NullMap (nullbuffers[buffer], offset, length);
+}
+
+void *NullMapTarget (GLenum target, GLintptr offset, GLsizeiptr length)
+{
+    std::lock_guard<std::mutex> lock (nullmutex);
+    return NullMap (nulltargets[target], offset, length);
+}
+
+static const NullProc *FindNullProc (const char *name)
+{
+    unsigned int low = 0, high = NumNullProcs;
+    while (low < high) {
+        unsigned int mid = (low + high) / 2;
+        int cmp = strcmp (NullProcs[mid].name, name);
+        if (cmp == 0)
+            return &NullProcs[mid];
+        if (cmp < 0)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return NULL;
+}
+
+} /* namespace internal */
+
+void *NullDriverGetProcAddress (const char *name)
+{
+    const internal::NullProc *proc = internal::FindNullProc (name);
+    return proc ? proc->proc : NULL;
+}
+
+void SetNullDriverCounting (bool enable)
+{
+    internal::nullcounting = enable;
+}
+
+void ResetNullDriverCounters (void)
+{
+    unsigned int i;
+    for (i = 0; i < internal::NumNullProcs; i++)
+        internal::nullcounts[i] = 0;
+}
+
+unsigned long GetNullDriverCallCount (const std::string &name)
+{
+    const internal::NullProc *proc = internal::FindNullProc (name.c_str ());
+    return proc ? internal::nullcounts[proc->counter].load () : 0;
+}
+
+std::vector<std::pair<std::string, unsigned long>> GetNullDriverCallCounts (void)
+{
+    std::vector<std::pair<std::string, unsigned long>> counts;
+    unsigned int i;
+    for (i = 0; i < internal::NumNullProcs; i++) {
+        unsigned long count = internal::nullcounts[internal::NullProcs[i].counter];
+        if (count)
+            counts.push_back (std::make_pair (internal::NullProcs[i].name, count));
+    }
+    return counts;
+}
+
+} /* namespace oglp */
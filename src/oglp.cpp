@@ -19,6 +19,9 @@
 
 /** @file */
 #include <oglp/oglp.h>
+#include <algorithm>
+#include <cstring>
+#include <memory>
 
 namespace oglp {
 
@@ -40,6 +43,45 @@ const char *ErrorToString (GLenum error)
     }
 }
 
+#ifdef OGLP_THROW_EXCEPTIONS
+namespace internal {
+#ifdef OGLP_ERROR_POLICY
+std::atomic<ErrorPolicy> errorpolicy (ErrorPolicy::OGLP_ERROR_POLICY);
+#else
+std::atomic<ErrorPolicy> errorpolicy (ErrorPolicy::PerCall);
+#endif
+thread_local unsigned long errorcalls = 0;
+thread_local unsigned long errorchecked = 0;
+} /* namespace internal */
+#endif
+
+void CheckErrors (const char *where)
+{
+#ifdef OGLP_THROW_EXCEPTIONS
+    GLenum err = GetError ();
+    unsigned long first = internal::errorchecked + 1;
+    unsigned long last = internal::errorcalls;
+    internal::errorchecked = internal::errorcalls;
+    if (err != GL_NO_ERROR) {
+        std::stringstream context;
+        int i;
+        /* drain remaining error flags, so they are
+         * not reported again by the next check */
+        for (i = 0; i < 16 && GetError () != GL_NO_ERROR; i++);
+        context << "(detected";
+        if (where)
+            context << " in " << where;
+        if (first <= last)
+            context << " after wrapped calls " << first << " to " << last << ")";
+        else
+            context << " without any wrapped call since the last check)";
+        throw Exception (err, context.str ());
+    }
+#else
+    (void) where;
+#endif
+}
+
 #ifdef _WIN32
 namespace internal {
 /* This workaround falls back to loading symbols
@@ -59,65 +101,148 @@ inline void *_getprocaddress (const char *name)
 } /* namespace internal */
 #endif
 
-bool IsExtensionSupported (const std::string &name)
+namespace internal {
+/* Reported before Init. */
+static const Capabilities nocapabilities;
+#ifndef OGLP_DISPATCH_TABLE
+/* Capabilities determined by the last Init. */
+static std::shared_ptr<const Capabilities> capabilities;
+#endif
+
+/* Capabilities of the current dispatch table, null before Init. */
+static std::shared_ptr<const Capabilities> &CurrentCapabilities (void)
+{
+#ifdef OGLP_DISPATCH_TABLE
+    return currentdispatch->capabilities;
+#else
+    return capabilities;
+#endif
+}
+
+/* Look up the index of an extension in the sorted
+ * table of known extensions or return NumExtensions. */
+static unsigned int FindExtension (const char *name)
+{
+    const char *const *end = ExtensionNames + NumExtensions;
+    const char *const *it = std::lower_bound (ExtensionNames, end, name,
+                                              [] (const char *a, const char *b) {
+                                                  return strcmp (a, b) < 0;
+                                              });
+    if (it != end && !strcmp (*it, name))
+        return it - ExtensionNames;
+    return NumExtensions;
+}
+} /* namespace internal */
+
+Capabilities Capabilities::Query (void)
 {
+    Capabilities caps;
+    std::stringstream versionstream;
+    const GLubyte *str;
     int num, i;
+
+    str = GetString (GL_VERSION);
+    CheckError ();
+    if (str) caps.version = reinterpret_cast<const char *> (str);
+    str = GetString (GL_VENDOR);
+    CheckError ();
+    if (str) caps.vendor = reinterpret_cast<const char *> (str);
+    str = GetString (GL_RENDERER);
+    CheckError ();
+    if (str) caps.renderer = reinterpret_cast<const char *> (str);
+
+    versionstream << caps.version;
+    versionstream >> caps.major;
+    versionstream.ignore (1);
+    versionstream >> caps.minor;
+
     GetIntegerv (GL_NUM_EXTENSIONS, &num);
+    CheckError ();
     for (i = 0; i < num; i++) {
-        const GLubyte *ext = GetStringi (GL_EXTENSIONS, i);
-        if (!name.compare (reinterpret_cast<const char *> (ext)))
-            return true;
+        const char *ext = reinterpret_cast<const char *> (GetStringi (GL_EXTENSIONS, i));
+        unsigned int idx;
+        if (!ext) continue;
+        idx = internal::FindExtension (ext);
+        if (idx < NumExtensions)
+            caps.extensions.set (idx);
+        else
+            caps.others.push_back (ext);
     }
-    return false;
+    CheckError ();
+    std::sort (caps.others.begin (), caps.others.end ());
+    return caps;
+}
+
+bool Capabilities::IsExtensionSupported (const std::string &name) const
+{
+    unsigned int idx = internal::FindExtension (name.c_str ());
+    if (idx < NumExtensions)
+        return extensions.test (idx);
+    return std::binary_search (others.begin (), others.end (), name);
+}
+
+const Capabilities &GetCapabilities (void)
+{
+    const Capabilities *caps = internal::CurrentCapabilities ().get ();
+    return caps ? *caps : internal::nocapabilities;
+}
+
+bool IsExtensionSupported (const std::string &name)
+{
+    return GetCapabilities ().IsExtensionSupported (name);
 }
 
-bool Init (GetProcAddressCallback callback)
+bool Init (GetProcAddressCallback callback, bool lazy)
 {
-    std::vector <std::string> needed_extensions = {
-            "GL_ARB_separate_shader_objects",
-            "GL_ARB_sampler_objects",
-            "GL_ARB_direct_state_access"
+    static const Extension needed_extensions[] = {
+            Extension::ARB_separate_shader_objects,
+            Extension::ARB_sampler_objects,
+            Extension::ARB_direct_state_access
     };
-    std::stringstream version;
-    int major, minor;
+    std::shared_ptr<const Capabilities> caps;
 
 #ifdef _WIN32
 	internal::_opengl32dllhandle = LoadLibrary ("OPENGL32.DLL");
 	internal::_usergetprocaddress = callback;
-	InitPrototypes (internal::_getprocaddress);
-#else
-    InitPrototypes (callback);
+	callback = internal::_getprocaddress;
 #endif
-    if (!GetString || GetString == (PFNGLGETSTRINGPROC) oglp::Unsupported) {
+    if (!callback ("glGetString")) {
 #ifdef OGLP_THROW_EXCEPTIONS
 		throw std::runtime_error ("No entry point for glGetString found.");
 #else
         return false;
 #endif
     }
+    if (lazy)
+        InitPrototypesLazy (callback);
+    else
+        InitPrototypes (callback);
 
-    version << GetString (GL_VERSION);
-    CheckError ();
-    version >> major;
-    version.ignore (1);
-    version >> minor;
+    /* replace rather than overwrite, so that other
+     * dispatch tables keep their own capabilities */
+    caps = std::make_shared<const Capabilities> (Capabilities::Query ());
+    internal::CurrentCapabilities () = caps;
 
-    if (major < 3) {
+    if (caps->GetMajorVersion () < 3) {
 #ifdef OGLP_THROW_EXCEPTIONS
 		throw std::runtime_error ("OpenGL version 3.0 or higher is required.");
 #else
         return false;
 #endif
     }
-    for (std::string &extension : needed_extensions) {
-        if (!IsExtensionSupported (extension)) {
+    for (Extension extension : needed_extensions) {
+        if (!caps->IsExtensionSupported (extension)) {
 #ifdef OGLP_THROW_EXCEPTIONS
-			throw std::runtime_error (extension + " is required.");
+			throw std::runtime_error (std::string (ExtensionNames[static_cast<unsigned int> (extension)])
+                                      + " is required.");
 #else
             return false;
 #endif
         }
     }
+#ifdef OGLP_INSTRUMENT
+    internal::InstallInstrumentation ();
+#endif
     return true;
 }
 
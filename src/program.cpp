@@ -0,0 +1,156 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file */
+#include <oglp/program.h>
+#include <oglp/programreflection.h>
+#include <cstring>
+
+namespace oglp {
+
+void Program::BuildUniformTable (bool linked)
+{
+    GLint count = 0, maxlength = 0, values[2];
+    GLsizei length;
+    const GLenum props[] = { GL_LOCATION, GL_ARRAY_SIZE };
+    std::vector<GLchar> buf;
+    std::vector<std::pair<std::string, GLint>> uniforms;
+    std::string base;
+    GLint i, j;
+
+    uniformtable.clear ();
+    uniformnames.clear ();
+    if (!linked)
+        return;
+
+    GetProgramInterfaceiv (obj, GL_UNIFORM, GL_ACTIVE_RESOURCES, &count);
+    GetProgramInterfaceiv (obj, GL_UNIFORM, GL_MAX_NAME_LENGTH, &maxlength);
+    CheckError ();
+    buf.resize (maxlength + 1);
+    for (i = 0; i < count; i++) {
+        GetProgramResourceiv (obj, GL_UNIFORM, i, 2, props, 2, NULL, values);
+        /* members of uniform blocks have no location */
+        if (values[0] < 0)
+            continue;
+        length = 0;
+        GetProgramResourceName (obj, GL_UNIFORM, i, buf.size (), &length,
+                                &buf[0]);
+        CheckError ();
+        uniforms.emplace_back (std::string (&buf[0], length), values[0]);
+        /* arrays are reported as "name[0]", but can be looked up as "name"
+         * and each element as "name[i]" as well */
+        if (length > 3 && !strcmp (&buf[length - 3], "[0]")) {
+            base.assign (&buf[0], length - 3);
+            uniforms.emplace_back (base, values[0]);
+            for (j = 1; j < values[1]; j++) {
+                std::string element = base + "[" + std::to_string (j) + "]";
+                uniforms.emplace_back (element, GetProgramResourceLocation
+                                       (obj, GL_UNIFORM, element.c_str ()));
+                CheckError ();
+            }
+        }
+    }
+
+    FillUniformTable (uniforms);
+}
+
+void Program::BuildUniformTable (const ProgramReflection &reflection)
+{
+    std::vector<std::pair<std::string, GLint>> uniforms;
+    GLint j;
+
+    uniformtable.clear ();
+    uniformnames.clear ();
+    for (const ProgramReflection::Variable &uniform
+         : reflection.GetUniforms ()) {
+        std::string name (reflection.GetName (uniform), uniform.length);
+        if (uniform.location < 0)
+            continue;
+        uniforms.emplace_back (name, uniform.location);
+        if (uniform.length > 3 && !name.compare (uniform.length - 3, 3,
+                                                 "[0]")) {
+            std::string base (name, 0, uniform.length - 3);
+            uniforms.emplace_back (base, uniform.location);
+            for (j = 1; j < uniform.arraysize; j++)
+                uniforms.emplace_back (base + "[" + std::to_string (j) + "]",
+                                       reflection.GetLocation (uniform, j));
+        }
+    }
+    FillUniformTable (uniforms);
+}
+
+void Program::FillUniformTable (const std::vector<std::pair<std::string,
+                                GLint>> &uniforms)
+{
+    size_t size, mask, slot;
+
+    /* at most half full, so that probe sequences stay short */
+    for (size = 8; size < 2 * uniforms.size (); size <<= 1);
+    mask = size - 1;
+    uniformtable.resize (size, UniformEntry { 0, -1, 0, 0 });
+    for (const auto &uniform : uniforms) {
+        if (uniform.second < 0)
+            continue;
+        uint32_t hash = HashName (uniform.first.data (),
+                                  uniform.first.length ());
+        for (slot = hash & mask; uniformtable[slot].location != -1;
+             slot = (slot + 1) & mask);
+        uniformtable[slot] = UniformEntry { hash, uniform.second,
+                                            uint32_t (uniformnames.length ()),
+                                            uint32_t (uniform.first.length ()) };
+        uniformnames += uniform.first;
+    }
+}
+
+bool Program::Binary (GLenum binaryFormat, const void *binary,
+                      GLsizei length, const ProgramReflection &reflection)
+{
+    GLint status;
+    ProgramBinary (obj, binaryFormat, binary, length);
+    GLenum err = GetError ();
+    if (err == GL_INVALID_ENUM)
+        return false;
+    if (err != GL_NO_ERROR) {
+#ifdef OGLP_THROW_EXCEPTIONS
+        throw Exception (err);
+#endif
+    }
+    Get (GL_LINK_STATUS, &status);
+    uniformtable.clear ();
+    uniformnames.clear ();
+    if (status)
+        BuildUniformTable (reflection);
+    return status;
+}
+
+GLint Program::LookupUniform (const char *name, size_t length,
+                              uint32_t hash) const
+{
+    size_t mask = uniformtable.size () - 1, slot;
+    for (slot = hash & mask; uniformtable[slot].location != -1;
+         slot = (slot + 1) & mask) {
+        const UniformEntry &entry = uniformtable[slot];
+        if (entry.hash == hash && entry.length == length
+            && !memcmp (&uniformnames[entry.name], name, length))
+            return entry.location;
+    }
+    return -1;
+}
+
+} /* namespace oglp */
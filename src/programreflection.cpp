@@ -0,0 +1,425 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file */
+#include <oglp/programreflection.h>
+#include <algorithm>
+#include <cstring>
+
+namespace oglp {
+
+/* properties of variables in the order of the members of Variable */
+static const GLenum ReflectionVariableProperties[] = {
+    GL_TYPE, GL_ARRAY_SIZE, GL_LOCATION, GL_BLOCK_INDEX, GL_OFFSET,
+    GL_ARRAY_STRIDE, GL_MATRIX_STRIDE, GL_TOP_LEVEL_ARRAY_SIZE,
+    GL_TOP_LEVEL_ARRAY_STRIDE
+};
+
+/* subset of the variable properties valid for an interface */
+static unsigned int ReflectionPropertyMask (GLenum rsrcinterface)
+{
+    switch (rsrcinterface) {
+        case GL_UNIFORM:
+            return 0x7f;
+        case GL_BUFFER_VARIABLE:
+            return 0x1fb;
+        default:
+            return 0x07;
+    }
+}
+
+/* header of the serialized snapshot */
+struct ReflectionHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t counts[10];
+};
+
+static const uint32_t ReflectionMagic = 0x52474f4f; /* "OOGR" */
+static const uint32_t ReflectionVersion = 2;
+
+/* Append an array to the serialized snapshot. */
+template<typename T>
+static void ReflectionWrite (std::vector<GLubyte> &data,
+                             const T *array, size_t count)
+{
+    const GLubyte *bytes = reinterpret_cast<const GLubyte *> (array);
+    data.insert (data.end (), bytes, bytes + count * sizeof (T));
+}
+
+/* Read an array of the serialized snapshot. */
+template<typename T>
+static bool ReflectionRead (const GLubyte *&data, const GLubyte *end,
+                            std::vector<T> &array, size_t count)
+{
+    if (size_t (end - data) < count * sizeof (T))
+        return false;
+    array.resize (count);
+    if (count)
+        memcpy (&array[0], data, count * sizeof (T));
+    data += count * sizeof (T);
+    return true;
+}
+
+uint32_t ProgramReflection::Intern (const GLchar *name, GLsizei length)
+{
+    uint32_t offset = names.size ();
+    names.append (name, length);
+    names.push_back ('\0');
+    return offset;
+}
+
+void ProgramReflection::Clear (void)
+{
+    uniforms.clear ();
+    uniformblocks.clear ();
+    storageblocks.clear ();
+    buffervariables.clear ();
+    inputs.clear ();
+    outputs.clear ();
+    subroutineuniforms.clear ();
+    subroutines.clear ();
+    indices.clear ();
+    names.clear ();
+}
+
+bool ProgramReflection::Validate (void) const
+{
+    /* names have to be null terminated within the arena */
+    auto validname = [&] (uint32_t name, uint32_t length) {
+        return name < names.size () && length < names.size () - name
+               && names[name + length] == '\0';
+    };
+    /* index ranges have to lie within the pool and each index
+     * has to refer to an existing resource */
+    auto validrange = [&] (size_t first, size_t count, size_t limit) {
+        size_t i;
+        if (first > indices.size () || count > indices.size () - first)
+            return false;
+        for (i = first; i < first + count; i++) {
+            if (indices[i] >= limit)
+                return false;
+        }
+        return true;
+    };
+    for (const std::vector<Variable> *variables : { &uniforms,
+         &buffervariables, &inputs, &outputs }) {
+        for (const Variable &var : *variables) {
+            if (!validname (var.name, var.length))
+                return false;
+        }
+    }
+    /* locations of array elements may be -1 */
+    for (const Variable &var : uniforms) {
+        if (var.elements >= 0 && (var.arraysize < 1
+            || size_t (var.elements) > indices.size ()
+            || size_t (var.arraysize - 1) > indices.size () - var.elements))
+            return false;
+        if (var.elements < 0 && var.location >= 0 && var.arraysize > 1)
+            return false;
+    }
+    for (const Block &block : uniformblocks) {
+        if (!validname (block.name, block.length)
+            || !validrange (block.members, block.nummembers, uniforms.size ()))
+            return false;
+    }
+    for (const Block &block : storageblocks) {
+        if (!validname (block.name, block.length)
+            || !validrange (block.members, block.nummembers,
+                            buffervariables.size ()))
+            return false;
+    }
+    for (const std::vector<Subroutine> *list : { &subroutineuniforms,
+         &subroutines }) {
+        for (const Subroutine &subroutine : *list) {
+            if (!validname (subroutine.name, subroutine.length)
+                || !validrange (subroutine.compatible,
+                                subroutine.numcompatible,
+                                subroutines.size ()))
+                return false;
+        }
+    }
+    return true;
+}
+
+ProgramReflection::ProgramReflection (const Program &program)
+{
+    static const struct {
+        GLenum rsrcinterface;
+        std::vector<Variable> ProgramReflection::*variables;
+    } variableinterfaces[] = {
+        { GL_UNIFORM, &ProgramReflection::uniforms },
+        { GL_BUFFER_VARIABLE, &ProgramReflection::buffervariables },
+        { GL_PROGRAM_INPUT, &ProgramReflection::inputs },
+        { GL_PROGRAM_OUTPUT, &ProgramReflection::outputs }
+    };
+    static const struct {
+        GLenum rsrcinterface;
+        std::vector<Block> ProgramReflection::*blocks;
+    } blockinterfaces[] = {
+        { GL_UNIFORM_BLOCK, &ProgramReflection::uniformblocks },
+        { GL_SHADER_STORAGE_BLOCK, &ProgramReflection::storageblocks }
+    };
+    static const struct {
+        GLenum stage;
+        GLenum uniforminterface;
+        GLenum subroutineinterface;
+    } stages[] = {
+        { GL_VERTEX_SHADER, GL_VERTEX_SUBROUTINE_UNIFORM,
+          GL_VERTEX_SUBROUTINE },
+        { GL_TESS_CONTROL_SHADER, GL_TESS_CONTROL_SUBROUTINE_UNIFORM,
+          GL_TESS_CONTROL_SUBROUTINE },
+        { GL_TESS_EVALUATION_SHADER, GL_TESS_EVALUATION_SUBROUTINE_UNIFORM,
+          GL_TESS_EVALUATION_SUBROUTINE },
+        { GL_GEOMETRY_SHADER, GL_GEOMETRY_SUBROUTINE_UNIFORM,
+          GL_GEOMETRY_SUBROUTINE },
+        { GL_FRAGMENT_SHADER, GL_FRAGMENT_SUBROUTINE_UNIFORM,
+          GL_FRAGMENT_SUBROUTINE },
+        { GL_COMPUTE_SHADER, GL_COMPUTE_SUBROUTINE_UNIFORM,
+          GL_COMPUTE_SUBROUTINE }
+    };
+    GLuint obj = program.get ();
+    std::vector<GLchar> buf;
+    GLint count, length, i;
+
+    /* names of all interfaces are read into the same buffer */
+    auto readname = [&] (GLenum rsrcinterface, GLint index) {
+        length = 0;
+        GetProgramResourceName (obj, rsrcinterface, index, buf.size (),
+                                &length, &buf[0]);
+        CheckError ();
+        return Intern (&buf[0], length);
+    };
+    auto prepare = [&] (GLenum rsrcinterface) {
+        GLint maxlength = 0;
+        count = 0;
+        GetProgramInterfaceiv (obj, rsrcinterface, GL_ACTIVE_RESOURCES,
+                               &count);
+        GetProgramInterfaceiv (obj, rsrcinterface, GL_MAX_NAME_LENGTH,
+                               &maxlength);
+        CheckError ();
+        buf.resize (std::max (size_t (maxlength) + 1, buf.size ()));
+    };
+
+    for (const auto &iface : variableinterfaces) {
+        unsigned int mask = ReflectionPropertyMask (iface.rsrcinterface);
+        std::vector<Variable> &variables = this->*iface.variables;
+        GLenum props[9];
+        GLint values[9];
+        GLsizei numprops = 0, k;
+        unsigned int j;
+
+        for (j = 0; j < 9; j++) {
+            if (mask & (1u << j))
+                props[numprops++] = ReflectionVariableProperties[j];
+        }
+        prepare (iface.rsrcinterface);
+        variables.reserve (count);
+        for (i = 0; i < count; i++) {
+            GLint properties[9] = { 0, 1, -1, -1, -1, -1, -1, -1, -1 };
+            Variable var;
+            var.name = readname (iface.rsrcinterface, i);
+            var.length = length;
+            var.hash = HashName (&buf[0], length);
+            GetProgramResourceiv (obj, iface.rsrcinterface, i, numprops,
+                                  props, numprops, NULL, values);
+            CheckError ();
+            for (j = 0, k = 0; j < 9; j++) {
+                if (mask & (1u << j))
+                    properties[j] = values[k++];
+            }
+            var.type = properties[0];
+            var.arraysize = properties[1];
+            var.location = properties[2];
+            var.block = properties[3];
+            var.offset = properties[4];
+            var.arraystride = properties[5];
+            var.matrixstride = properties[6];
+            var.toplevelarraysize = properties[7];
+            var.toplevelarraystride = properties[8];
+            var.elements = -1;
+            /* the elements of uniform arrays need not have consecutive
+             * locations */
+            if (iface.rsrcinterface == GL_UNIFORM && var.location >= 0
+                && var.arraysize > 1 && length > 3) {
+                std::string base (&buf[0], length - 3);
+                var.elements = indices.size ();
+                for (j = 1; j < unsigned (var.arraysize); j++) {
+                    std::string element = base + "["
+                                          + std::to_string (j) + "]";
+                    indices.push_back (GetProgramResourceLocation
+                                       (obj, GL_UNIFORM, element.c_str ()));
+                    CheckError ();
+                }
+            }
+            variables.push_back (var);
+        }
+    }
+
+    for (const auto &iface : blockinterfaces) {
+        static const GLenum props[] = {
+            GL_BUFFER_BINDING, GL_BUFFER_DATA_SIZE, GL_NUM_ACTIVE_VARIABLES
+        };
+        static const GLenum activevariables = GL_ACTIVE_VARIABLES;
+        std::vector<Block> &blocks = this->*iface.blocks;
+        GLint values[3];
+
+        prepare (iface.rsrcinterface);
+        blocks.reserve (count);
+        for (i = 0; i < count; i++) {
+            Block block;
+            block.name = readname (iface.rsrcinterface, i);
+            block.length = length;
+            block.hash = HashName (&buf[0], length);
+            GetProgramResourceiv (obj, iface.rsrcinterface, i, 3, props, 3,
+                                  NULL, values);
+            CheckError ();
+            block.binding = values[0];
+            block.datasize = values[1];
+            block.members = indices.size ();
+            block.nummembers = values[2];
+            indices.resize (indices.size () + values[2]);
+            if (values[2]) {
+                GetProgramResourceiv (obj, iface.rsrcinterface, i, 1,
+                                      &activevariables, values[2], NULL,
+                                      reinterpret_cast<GLint *>
+                                      (&indices[block.members]));
+                CheckError ();
+            }
+            blocks.push_back (block);
+        }
+    }
+
+    for (const auto &stage : stages) {
+        static const GLenum props[] = {
+            GL_LOCATION, GL_ARRAY_SIZE, GL_NUM_COMPATIBLE_SUBROUTINES
+        };
+        static const GLenum compatiblesubroutines = GL_COMPATIBLE_SUBROUTINES;
+        /* subroutines are indexed per stage by GL */
+        GLuint base = subroutines.size ();
+        GLint values[3];
+        GLint j;
+
+        /* stages the program does not contain have no subroutines */
+        prepare (stage.uniforminterface);
+        for (i = 0; i < count; i++) {
+            Subroutine uniform;
+            uniform.name = readname (stage.uniforminterface, i);
+            uniform.length = length;
+            uniform.hash = HashName (&buf[0], length);
+            uniform.stage = stage.stage;
+            GetProgramResourceiv (obj, stage.uniforminterface, i, 3, props,
+                                  3, NULL, values);
+            CheckError ();
+            uniform.location = values[0];
+            uniform.arraysize = values[1];
+            uniform.compatible = indices.size ();
+            uniform.numcompatible = values[2];
+            indices.resize (indices.size () + values[2]);
+            if (values[2]) {
+                GetProgramResourceiv (obj, stage.uniforminterface, i, 1,
+                                      &compatiblesubroutines, values[2],
+                                      NULL, reinterpret_cast<GLint *>
+                                      (&indices[uniform.compatible]));
+                CheckError ();
+                for (j = 0; j < values[2]; j++)
+                    indices[uniform.compatible + j] += base;
+            }
+            subroutineuniforms.push_back (uniform);
+        }
+        prepare (stage.subroutineinterface);
+        for (i = 0; i < count; i++) {
+            Subroutine subroutine;
+            subroutine.name = readname (stage.subroutineinterface, i);
+            subroutine.length = length;
+            subroutine.hash = HashName (&buf[0], length);
+            subroutine.stage = stage.stage;
+            subroutine.location = i;
+            subroutine.arraysize = 1;
+            subroutine.compatible = 0;
+            subroutine.numcompatible = 0;
+            subroutines.push_back (subroutine);
+        }
+    }
+}
+
+void ProgramReflection::Serialize (std::vector<GLubyte> &data) const
+{
+    const ReflectionHeader header = {
+        ReflectionMagic, ReflectionVersion, {
+            uint32_t (uniforms.size ()), uint32_t (uniformblocks.size ()),
+            uint32_t (storageblocks.size ()),
+            uint32_t (buffervariables.size ()), uint32_t (inputs.size ()),
+            uint32_t (outputs.size ()), uint32_t (subroutineuniforms.size ()),
+            uint32_t (subroutines.size ()), uint32_t (indices.size ()),
+            uint32_t (names.size ())
+        }
+    };
+    ReflectionWrite (data, &header, 1);
+    ReflectionWrite (data, uniforms.data (), uniforms.size ());
+    ReflectionWrite (data, uniformblocks.data (), uniformblocks.size ());
+    ReflectionWrite (data, storageblocks.data (), storageblocks.size ());
+    ReflectionWrite (data, buffervariables.data (), buffervariables.size ());
+    ReflectionWrite (data, inputs.data (), inputs.size ());
+    ReflectionWrite (data, outputs.data (), outputs.size ());
+    ReflectionWrite (data, subroutineuniforms.data (),
+                     subroutineuniforms.size ());
+    ReflectionWrite (data, subroutines.data (), subroutines.size ());
+    ReflectionWrite (data, indices.data (), indices.size ());
+    ReflectionWrite (data, names.data (), names.size ());
+}
+
+bool ProgramReflection::Deserialize (const void *data, size_t size)
+{
+    const GLubyte *ptr = static_cast<const GLubyte *> (data);
+    const GLubyte *end = ptr + size;
+    ReflectionHeader header;
+    std::vector<char> arena;
+
+    Clear ();
+    if (size < sizeof (header))
+        return false;
+    memcpy (&header, ptr, sizeof (header));
+    ptr += sizeof (header);
+    if (header.magic != ReflectionMagic || header.version != ReflectionVersion)
+        return false;
+    if (!ReflectionRead (ptr, end, uniforms, header.counts[0])
+        || !ReflectionRead (ptr, end, uniformblocks, header.counts[1])
+        || !ReflectionRead (ptr, end, storageblocks, header.counts[2])
+        || !ReflectionRead (ptr, end, buffervariables, header.counts[3])
+        || !ReflectionRead (ptr, end, inputs, header.counts[4])
+        || !ReflectionRead (ptr, end, outputs, header.counts[5])
+        || !ReflectionRead (ptr, end, subroutineuniforms, header.counts[6])
+        || !ReflectionRead (ptr, end, subroutines, header.counts[7])
+        || !ReflectionRead (ptr, end, indices, header.counts[8])
+        || !ReflectionRead (ptr, end, arena, header.counts[9])
+        || ptr != end) {
+        Clear ();
+        return false;
+    }
+    names.assign (arena.begin (), arena.end ());
+    if (!Validate ()) {
+        Clear ();
+        return false;
+    }
+    return true;
+}
+
+} /* namespace oglp */
@@ -0,0 +1,151 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file */
+#include <oglp/sparsebuffer.h>
+#include <oglp/capabilities.h>
+#include <algorithm>
+#ifdef OGLP_THROW_EXCEPTIONS
+#include <stdexcept>
+#endif
+
+namespace oglp {
+
+SparseBuffer::SparseBuffer (GLsizeiptr size, GLbitfield _flags,
+                            GLsizeiptr emulatedpagesize)
+    : sparse (GetCapabilities ().IsExtensionSupported
+              (Extension::ARB_sparse_buffer)),
+      flags (_flags), pagesize (emulatedpagesize), committed (0)
+{
+    size_t i;
+    if (sparse) {
+        GLint value = 0;
+        GetIntegerv (GL_SPARSE_BUFFER_PAGE_SIZE_ARB, &value);
+        CheckError ();
+        /* emulate if the page size cannot be queried */
+        if (value > 0)
+            pagesize = value;
+        else
+            sparse = false;
+    }
+    if (pagesize <= 0 || size < 0) {
+#ifdef OGLP_THROW_EXCEPTIONS
+        throw std::runtime_error ("Invalid page size for a SparseBuffer.");
+#else
+        /* an empty range, on which every operation fails */
+        pagesize = 1;
+        numpages = 0;
+        return;
+#endif
+    }
+    numpages = (size + pagesize - 1) / pagesize;
+    bitmap.resize ((numpages + 63) >> 6, 0);
+    if (sparse) {
+        buffers.emplace_back ();
+        buffers[0].Storage (GetSize (), NULL,
+                            flags | GL_SPARSE_STORAGE_BIT_ARB);
+    } else {
+        buffers.reserve (numpages);
+        for (i = 0; i < numpages; i++)
+            buffers.emplace_back (nullptr);
+    }
+}
+
+void SparseBuffer::SetPages (size_t first, size_t last, bool commit)
+{
+    size_t i;
+    if (sparse) {
+        NamedBufferPageCommitmentARB (buffers[0].get (),
+                                      GLintptr (first) * pagesize,
+                                      GLsizeiptr (last - first) * pagesize,
+                                      commit ? GL_TRUE : GL_FALSE);
+        CheckError ();
+    }
+    for (i = first; i < last; i++) {
+        if (!sparse) {
+            if (commit) {
+                buffers[i] = Buffer ();
+                buffers[i].Storage (pagesize, NULL, flags);
+            } else {
+                buffers[i] = Buffer (nullptr);
+            }
+        }
+        bitmap[i >> 6] ^= uint64_t (1) << (i & 63);
+    }
+    if (commit)
+        committed += last - first;
+    else
+        committed -= last - first;
+}
+
+size_t SparseBuffer::Commit (GLintptr offset, GLsizeiptr size)
+{
+    size_t first, last, page, end, count = 0;
+    if (size <= 0 || offset < 0)
+        return 0;
+    end = std::min (size_t ((offset + size - 1) / pagesize + 1), numpages);
+    /* one call per run of uncommitted pages */
+    for (page = offset / pagesize; page < end; page = last) {
+        for (; page < end && IsPageCommitted (page); page++);
+        for (first = last = page; last < end && !IsPageCommitted (last);
+             last++);
+        if (first < last) {
+            SetPages (first, last, true);
+            count += last - first;
+        }
+    }
+    return count;
+}
+
+size_t SparseBuffer::Decommit (GLintptr offset, GLsizeiptr size)
+{
+    size_t first, last, page, end, count = 0;
+    if (size <= 0 || offset < 0)
+        return 0;
+    end = std::min (size_t ((offset + size - 1) / pagesize + 1), numpages);
+    /* one call per run of committed pages */
+    for (page = offset / pagesize; page < end; page = last) {
+        for (; page < end && !IsPageCommitted (page); page++);
+        for (first = last = page; last < end && IsPageCommitted (last);
+             last++);
+        if (first < last) {
+            SetPages (first, last, false);
+            count += last - first;
+        }
+    }
+    return count;
+}
+
+bool SparseBuffer::IsCommitted (GLintptr offset, GLsizeiptr size) const
+{
+    size_t page, end;
+    if (size <= 0)
+        return true;
+    /* ranges outside the virtual range are never committed */
+    if (offset < 0 || size > GetSize () - offset)
+        return false;
+    end = (offset + size - 1) / pagesize + 1;
+    for (page = offset / pagesize; page < end; page++) {
+        if (!IsPageCommitted (page))
+            return false;
+    }
+    return true;
+}
+
+} /* namespace oglp */
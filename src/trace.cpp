@@ -0,0 +1,439 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file */
+#include <oglp/trace.h>
+
+#ifdef OGLP_TRACE
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#endif
+
+namespace oglp {
+
+#ifdef OGLP_TRACE
+namespace internal {
+
+/* Staging buffers are appended to the file once they exceed this size. */
+static const size_t TraceFlushThreshold = 1 << 20;
+
+static std::mutex tracemutex;
+static FILE *tracefile = NULL;
+static std::chrono::steady_clock::time_point tracestart;
+static std::atomic<uint16_t> tracethreads (0);
+/* incremented by StartTrace */
+static std::atomic<uint32_t> tracegeneration (0);
+/* all staging buffers, locked before the busy flag of a buffer */
+static std::mutex traceregistrymutex;
+static std::vector<TraceStaging *> tracestagings;
+
+#ifndef OGLP_DISPATCH_TABLE
+DispatchTable tracenext;
+/* whether the thunks are installed, guarded by tracemutex */
+static bool traceinstalled = false;
+#endif
+thread_local TraceStaging tracestaging;
+
+TraceStaging::TraceStaging (void)
+    : busy (false), generation (tracegeneration.load ()),
+      thread (tracethreads++)
+{
+    buffer.reserve (TraceFlushThreshold + (TraceFlushThreshold >> 2));
+    std::lock_guard<std::mutex> lock (traceregistrymutex);
+    tracestagings.push_back (this);
+}
+
+TraceStaging::~TraceStaging (void)
+{
+    std::lock_guard<std::mutex> lock (traceregistrymutex);
+    tracestagings.erase (std::find (tracestagings.begin (),
+                                    tracestagings.end (), this));
+    Flush ();
+}
+
+void TraceStaging::Acquire (void)
+{
+    /* only held for a copy or a write, so yielding is enough */
+    while (busy.exchange (true, std::memory_order_acquire))
+        std::this_thread::yield ();
+}
+
+void TraceStaging::Release (void)
+{
+    busy.store (false, std::memory_order_release);
+}
+
+void TraceStaging::Append (uint32_t session, const char *data, size_t size)
+{
+    uint32_t current = tracegeneration.load ();
+    /* drop records of an earlier session */
+    if (generation != current) {
+        buffer.clear ();
+        generation = current;
+    }
+    if (session != current)
+        return;
+    buffer.insert (buffer.end (), data, data + size);
+    if (buffer.size () >= TraceFlushThreshold)
+        Write ();
+}
+
+void TraceStaging::Flush (void)
+{
+    Acquire ();
+    Write ();
+    Release ();
+}
+
+void TraceStaging::Write (void)
+{
+    std::lock_guard<std::mutex> lock (tracemutex);
+    if (tracefile && !buffer.empty () && generation == tracegeneration)
+        fwrite (buffer.data (), 1, buffer.size (), tracefile);
+    buffer.clear ();
+}
+
+uint32_t TraceGeneration (void)
+{
+    return tracegeneration.load ();
+}
+
+uint64_t TraceTime (void)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>
+            (std::chrono::steady_clock::now () - tracestart).count ();
+}
+
+void TraceRecord::AppendBlob (unsigned int index, uint16_t flags,
+                              const void *data, size_t size)
+{
+    static const char padding[8] = { 0 };
+    TraceBlobHeader header;
+    header.index = index;
+    header.flags = flags;
+    header.length = size;
+    Append (&header, sizeof (header));
+    Append (data, size);
+    Append (padding, (8 - (size & 7)) & 7);
+}
+
+void TraceRecord::String (unsigned int index, const GLchar *str,
+                          GLsizei length)
+{
+    if (!str)
+        return;
+    Blob (index, str, length < 0 ? strlen (str) : length);
+}
+
+void TraceRecord::Strings (unsigned int index, GLsizei count,
+                           const GLchar *const *strings,
+                           const GLint *lengths)
+{
+    std::vector<char> data;
+    GLsizei i;
+    if (!strings)
+        return;
+    for (i = 0; i < count; i++) {
+        uint32_t length = 0;
+        if (strings[i])
+            length = (lengths && lengths[i] >= 0) ? lengths[i] : strlen (strings[i]);
+        data.insert (data.end (), reinterpret_cast<const char *> (&length),
+                     reinterpret_cast<const char *> (&length) + sizeof (length));
+        data.insert (data.end (), strings[i], strings[i] + length);
+    }
+    AppendBlob (index, TraceBlobStrings, data.data (), data.size ());
+}
+
+void TraceRecord::Pixels (unsigned int index, const void *pixels,
+                          GLsizeiptr size)
+{
+    GLint unpackbuffer = 0;
+    /* with a bound pixel unpack buffer, pixels is an offset */
+    TraceNext ().GetIntegerv (GL_PIXEL_UNPACK_BUFFER_BINDING, &unpackbuffer);
+    if (!unpackbuffer)
+        Blob (index, pixels, size);
+}
+
+/* Size of a single pixel of the specified format and type. */
+static GLsizei TracePixelSize (GLenum format, GLenum type)
+{
+    GLsizei components;
+
+    switch (format) {
+        case GL_RG: case GL_RG_INTEGER: case GL_DEPTH_STENCIL:
+            components = 2;
+            break;
+        case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER:
+            components = 3;
+            break;
+        case GL_RGBA: case GL_BGRA: case GL_RGBA_INTEGER: case GL_BGRA_INTEGER:
+            components = 4;
+            break;
+        default:
+            components = 1;
+            break;
+    }
+    switch (type) {
+        case GL_UNSIGNED_BYTE: case GL_BYTE:
+            return components;
+        case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT:
+            return 2 * components;
+        case GL_UNSIGNED_BYTE_3_3_2: case GL_UNSIGNED_BYTE_2_3_3_REV:
+            return 1;
+        case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_5_6_5_REV:
+        case GL_UNSIGNED_SHORT_4_4_4_4: case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+        case GL_UNSIGNED_SHORT_5_5_5_1: case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+            return 2;
+        case GL_UNSIGNED_INT_8_8_8_8: case GL_UNSIGNED_INT_8_8_8_8_REV:
+        case GL_UNSIGNED_INT_10_10_10_2: case GL_UNSIGNED_INT_2_10_10_10_REV:
+        case GL_UNSIGNED_INT_24_8: case GL_UNSIGNED_INT_10F_11F_11F_REV:
+        case GL_UNSIGNED_INT_5_9_9_9_REV:
+            return 4;
+        case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+            return 8;
+        default:
+            return 4 * components;
+    }
+}
+
+GLsizei TraceParameterCount (GLenum pname)
+{
+    switch (pname) {
+        case GL_TEXTURE_BORDER_COLOR:
+        case GL_TEXTURE_SWIZZLE_RGBA:
+        case GL_PATCH_DEFAULT_OUTER_LEVEL:
+            return 4;
+        case GL_PATCH_DEFAULT_INNER_LEVEL:
+            return 2;
+        default:
+            return 1;
+    }
+}
+
+void TraceRecord::Pixel (unsigned int index, const void *data,
+                         GLenum format, GLenum type)
+{
+    Blob (index, data, TracePixelSize (format, type));
+}
+
+void TraceRecord::Image (unsigned int index, const void *pixels,
+                         GLenum format, GLenum type, GLsizei width,
+                         GLsizei height, GLsizei depth)
+{
+    GLint alignment = 4, rowlength = 0, imageheight = 0;
+    GLint skippixels = 0, skiprows = 0, skipimages = 0;
+    GLsizei pixelsize, rowsize;
+    size_t size;
+
+    if (!pixels || width <= 0 || height <= 0 || depth <= 0)
+        return;
+
+    pixelsize = TracePixelSize (format, type);
+
+    TraceNext ().GetIntegerv (GL_UNPACK_ALIGNMENT, &alignment);
+    TraceNext ().GetIntegerv (GL_UNPACK_ROW_LENGTH, &rowlength);
+    TraceNext ().GetIntegerv (GL_UNPACK_IMAGE_HEIGHT, &imageheight);
+    TraceNext ().GetIntegerv (GL_UNPACK_SKIP_PIXELS, &skippixels);
+    TraceNext ().GetIntegerv (GL_UNPACK_SKIP_ROWS, &skiprows);
+    TraceNext ().GetIntegerv (GL_UNPACK_SKIP_IMAGES, &skipimages);
+    if (!rowlength) rowlength = width;
+    if (!imageheight) imageheight = height;
+    if (alignment <= 0) alignment = 1;
+    rowsize = (rowlength * pixelsize + alignment - 1) / alignment * alignment;
+
+    /* the block spans from pixels to the last byte read by the GL */
+    size = (size_t (skipimages + depth - 1) * imageheight + skiprows + height - 1)
+           * rowsize + size_t (skippixels + width) * pixelsize;
+    Pixels (index, pixels, size);
+}
+
+void TraceRecord::Commit (void)
+{
+    uint32_t size = staging.record.size () - start;
+    memcpy (&staging.record[start + offsetof (TraceRecordHeader, size)],
+            &size, sizeof (size));
+    committed = true;
+    staging.Acquire ();
+    staging.Append (generation, &staging.record[start], size);
+    staging.Release ();
+    staging.record.resize (start);
+}
+
+/* Install the trace thunks in front of the current entry points,
+ * called with tracemutex held. */
+static void TraceInstall (void)
+{
+    DispatchTable thunks;
+#ifdef OGLP_DISPATCH_TABLE
+    std::unique_ptr<DispatchTable> &next = currentdispatch->tracenext;
+    if (next)
+        return;
+    next.reset (new DispatchTable);
+#else
+    if (traceinstalled)
+        return;
+    traceinstalled = true;
+#endif
+    GetDispatch (&TraceNext ());
+    GetTraceThunks (&thunks);
+    thunks.getprocaddress = TraceNext ().getprocaddress;
+    SetDispatch (&thunks);
+}
+
+/* Restore the entry points the trace thunks forward to. */
+static void TraceUninstall (void)
+{
+#ifdef OGLP_DISPATCH_TABLE
+    std::unique_ptr<DispatchTable> &next = currentdispatch->tracenext;
+    if (!next)
+        return;
+    SetDispatch (next.get ());
+    next.reset ();
+#else
+    if (!traceinstalled)
+        return;
+    SetDispatch (&tracenext);
+    traceinstalled = false;
+#endif
+}
+
+} /* namespace internal */
+#endif /* defined OGLP_TRACE */
+
+bool StartTrace (const std::string &filename)
+{
+#ifdef OGLP_TRACE
+    static const char padding[8] = { 0 };
+    static const char magic[8] = { 'O', 'G', 'L', 'P', 'T', 'R', 'C', '1' };
+    std::lock_guard<std::mutex> lock (internal::tracemutex);
+    uint32_t value;
+    size_t size;
+    unsigned int i;
+    FILE *file;
+
+    if (internal::tracefile)
+        return false;
+    file = fopen (filename.c_str (), "wb");
+    if (!file) {
+#ifdef OGLP_THROW_EXCEPTIONS
+        throw std::runtime_error ("Cannot open trace file " + filename + ".");
+#else
+        return false;
+#endif
+    }
+
+    fwrite (magic, 1, sizeof (magic), file);
+    value = TraceVersion;
+    fwrite (&value, sizeof (value), 1, file);
+    value = internal::NumTraceProcs;
+    fwrite (&value, sizeof (value), 1, file);
+    size = 0;
+    for (i = 0; i < internal::NumTraceProcs; i++) {
+        uint16_t length = strlen (internal::TraceProcNames[i]);
+        fwrite (&length, sizeof (length), 1, file);
+        fwrite (internal::TraceProcNames[i], 1, length, file);
+        size += sizeof (length) + length;
+    }
+    fwrite (padding, 1, (8 - (size & 7)) & 7, file);
+
+    internal::tracefile = file;
+    internal::tracestart = std::chrono::steady_clock::now ();
+    /* records staged by any thread before belong to an earlier session */
+    internal::tracegeneration++;
+    internal::TraceInstall ();
+    return true;
+#else
+    (void) filename;
+    return false;
+#endif
+}
+
+void StopTrace (void)
+{
+#ifdef OGLP_TRACE
+    if (!IsTracing ())
+        return;
+    {
+        std::lock_guard<std::mutex> lock (internal::tracemutex);
+        internal::TraceUninstall ();
+    }
+    {
+        std::lock_guard<std::mutex> lock (internal::traceregistrymutex);
+        for (internal::TraceStaging *staging : internal::tracestagings)
+            staging->Flush ();
+    }
+    std::lock_guard<std::mutex> lock (internal::tracemutex);
+    fclose (internal::tracefile);
+    internal::tracefile = NULL;
+#endif
+}
+
+bool AttachTrace (void)
+{
+#ifdef OGLP_TRACE
+    std::lock_guard<std::mutex> lock (internal::tracemutex);
+    if (!internal::tracefile)
+        return false;
+    internal::TraceInstall ();
+    return true;
+#else
+    return false;
+#endif
+}
+
+void DetachTrace (void)
+{
+#if defined OGLP_TRACE && defined OGLP_DISPATCH_TABLE
+    internal::TraceUninstall ();
+#endif
+}
+
+void TraceFrame (void)
+{
+#ifdef OGLP_TRACE
+    if (!IsTracing ())
+        return;
+    internal::TraceRecord record (TraceFrameMarker, 0);
+    record.Commit ();
+#endif
+}
+
+void FlushTrace (void)
+{
+#ifdef OGLP_TRACE
+    internal::tracestaging.Flush ();
+#endif
+}
+
+bool IsTracing (void)
+{
+#ifdef OGLP_TRACE
+    std::lock_guard<std::mutex> lock (internal::tracemutex);
+    return internal::tracefile != NULL;
+#else
+    return false;
+#endif
+}
+
+} /* namespace oglp */
@@ -0,0 +1,298 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file */
+#include <oglp/uniformstore.h>
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace oglp {
+
+/* index of the least significant set bit */
+static unsigned int UniformLowestBit (uint64_t x)
+{
+#ifdef __GNUC__
+    return __builtin_ctzll (x);
+#else
+    unsigned int n = 0;
+    while (!(x & 1)) {
+        x >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+/* Size of one element of a uniform type in bytes. Samplers, images and
+ * all other opaque types are set as a single int. */
+static GLsizei UniformTypeSize (GLenum type)
+{
+    switch (type) {
+        case GL_FLOAT_VEC2: case GL_INT_VEC2: case GL_UNSIGNED_INT_VEC2:
+        case GL_BOOL_VEC2: case GL_DOUBLE:
+            return 8;
+        case GL_FLOAT_VEC3: case GL_INT_VEC3: case GL_UNSIGNED_INT_VEC3:
+        case GL_BOOL_VEC3:
+            return 12;
+        case GL_FLOAT_VEC4: case GL_INT_VEC4: case GL_UNSIGNED_INT_VEC4:
+        case GL_BOOL_VEC4: case GL_FLOAT_MAT2: case GL_DOUBLE_VEC2:
+            return 16;
+        case GL_FLOAT_MAT2x3: case GL_FLOAT_MAT3x2: case GL_DOUBLE_VEC3:
+            return 24;
+        case GL_FLOAT_MAT2x4: case GL_FLOAT_MAT4x2: case GL_DOUBLE_VEC4:
+        case GL_DOUBLE_MAT2:
+            return 32;
+        case GL_FLOAT_MAT3:
+            return 36;
+        case GL_FLOAT_MAT3x4: case GL_FLOAT_MAT4x3: case GL_DOUBLE_MAT2x3:
+        case GL_DOUBLE_MAT3x2:
+            return 48;
+        case GL_FLOAT_MAT4: case GL_DOUBLE_MAT2x4: case GL_DOUBLE_MAT4x2:
+            return 64;
+        case GL_DOUBLE_MAT3:
+            return 72;
+        case GL_DOUBLE_MAT3x4: case GL_DOUBLE_MAT4x3:
+            return 96;
+        case GL_DOUBLE_MAT4:
+            return 128;
+        default:
+            return 4;
+    }
+}
+
+/* Read the current value of a uniform element. */
+static void UniformRead (GLuint program, GLint location, GLenum type,
+                         GLsizei size, void *value)
+{
+    switch (type) {
+        case GL_FLOAT: case GL_FLOAT_VEC2: case GL_FLOAT_VEC3: case GL_FLOAT_VEC4:
+        case GL_FLOAT_MAT2: case GL_FLOAT_MAT3: case GL_FLOAT_MAT4:
+        case GL_FLOAT_MAT2x3: case GL_FLOAT_MAT2x4: case GL_FLOAT_MAT3x2:
+        case GL_FLOAT_MAT3x4: case GL_FLOAT_MAT4x2: case GL_FLOAT_MAT4x3:
+            GetnUniformfv (program, location, size, static_cast<GLfloat *> (value));
+            break;
+        case GL_DOUBLE: case GL_DOUBLE_VEC2: case GL_DOUBLE_VEC3:
+        case GL_DOUBLE_VEC4: case GL_DOUBLE_MAT2: case GL_DOUBLE_MAT3:
+        case GL_DOUBLE_MAT4: case GL_DOUBLE_MAT2x3: case GL_DOUBLE_MAT2x4:
+        case GL_DOUBLE_MAT3x2: case GL_DOUBLE_MAT3x4: case GL_DOUBLE_MAT4x2:
+        case GL_DOUBLE_MAT4x3:
+            GetnUniformdv (program, location, size, static_cast<GLdouble *> (value));
+            break;
+        case GL_UNSIGNED_INT: case GL_UNSIGNED_INT_VEC2: case GL_UNSIGNED_INT_VEC3:
+        case GL_UNSIGNED_INT_VEC4:
+            GetnUniformuiv (program, location, size, static_cast<GLuint *> (value));
+            break;
+        default:
+            GetnUniformiv (program, location, size, static_cast<GLint *> (value));
+            break;
+    }
+    CheckError ();
+}
+
+/* Upload the values of a uniform. */
+static void UniformWrite (GLuint p, GLint l, GLenum type, GLsizei n,
+                          const void *value)
+{
+    const GLfloat *f = static_cast<const GLfloat *> (value);
+    const GLdouble *d = static_cast<const GLdouble *> (value);
+    const GLint *i = static_cast<const GLint *> (value);
+    const GLuint *u = static_cast<const GLuint *> (value);
+    switch (type) {
+        case GL_FLOAT: ProgramUniform1fv (p, l, n, f); break;
+        case GL_FLOAT_VEC2: ProgramUniform2fv (p, l, n, f); break;
+        case GL_FLOAT_VEC3: ProgramUniform3fv (p, l, n, f); break;
+        case GL_FLOAT_VEC4: ProgramUniform4fv (p, l, n, f); break;
+        case GL_DOUBLE: ProgramUniform1dv (p, l, n, d); break;
+        case GL_DOUBLE_VEC2: ProgramUniform2dv (p, l, n, d); break;
+        case GL_DOUBLE_VEC3: ProgramUniform3dv (p, l, n, d); break;
+        case GL_DOUBLE_VEC4: ProgramUniform4dv (p, l, n, d); break;
+        case GL_UNSIGNED_INT: ProgramUniform1uiv (p, l, n, u); break;
+        case GL_UNSIGNED_INT_VEC2: ProgramUniform2uiv (p, l, n, u); break;
+        case GL_UNSIGNED_INT_VEC3: ProgramUniform3uiv (p, l, n, u); break;
+        case GL_UNSIGNED_INT_VEC4: ProgramUniform4uiv (p, l, n, u); break;
+        case GL_INT_VEC2: case GL_BOOL_VEC2: ProgramUniform2iv (p, l, n, i); break;
+        case GL_INT_VEC3: case GL_BOOL_VEC3: ProgramUniform3iv (p, l, n, i); break;
+        case GL_INT_VEC4: case GL_BOOL_VEC4: ProgramUniform4iv (p, l, n, i); break;
+        case GL_FLOAT_MAT2:
+            ProgramUniformMatrix2fv (p, l, n, GL_FALSE, f); break;
+        case GL_FLOAT_MAT3:
+            ProgramUniformMatrix3fv (p, l, n, GL_FALSE, f); break;
+        case GL_FLOAT_MAT4:
+            ProgramUniformMatrix4fv (p, l, n, GL_FALSE, f); break;
+        case GL_FLOAT_MAT2x3:
+            ProgramUniformMatrix2x3fv (p, l, n, GL_FALSE, f); break;
+        case GL_FLOAT_MAT2x4:
+            ProgramUniformMatrix2x4fv (p, l, n, GL_FALSE, f); break;
+        case GL_FLOAT_MAT3x2:
+            ProgramUniformMatrix3x2fv (p, l, n, GL_FALSE, f); break;
+        case GL_FLOAT_MAT3x4:
+            ProgramUniformMatrix3x4fv (p, l, n, GL_FALSE, f); break;
+        case GL_FLOAT_MAT4x2:
+            ProgramUniformMatrix4x2fv (p, l, n, GL_FALSE, f); break;
+        case GL_FLOAT_MAT4x3:
+            ProgramUniformMatrix4x3fv (p, l, n, GL_FALSE, f); break;
+        case GL_DOUBLE_MAT2:
+            ProgramUniformMatrix2dv (p, l, n, GL_FALSE, d); break;
+        case GL_DOUBLE_MAT3:
+            ProgramUniformMatrix3dv (p, l, n, GL_FALSE, d); break;
+        case GL_DOUBLE_MAT4:
+            ProgramUniformMatrix4dv (p, l, n, GL_FALSE, d); break;
+        case GL_DOUBLE_MAT2x3:
+            ProgramUniformMatrix2x3dv (p, l, n, GL_FALSE, d); break;
+        case GL_DOUBLE_MAT2x4:
+            ProgramUniformMatrix2x4dv (p, l, n, GL_FALSE, d); break;
+        case GL_DOUBLE_MAT3x2:
+            ProgramUniformMatrix3x2dv (p, l, n, GL_FALSE, d); break;
+        case GL_DOUBLE_MAT3x4:
+            ProgramUniformMatrix3x4dv (p, l, n, GL_FALSE, d); break;
+        case GL_DOUBLE_MAT4x2:
+            ProgramUniformMatrix4x2dv (p, l, n, GL_FALSE, d); break;
+        case GL_DOUBLE_MAT4x3:
+            ProgramUniformMatrix4x3dv (p, l, n, GL_FALSE, d); break;
+        default:
+            ProgramUniform1iv (p, l, n, i); break;
+    }
+    CheckError ();
+}
+
+UniformStore::UniformStore (const Program &_program)
+    : program (&_program), numdirty (0)
+{
+    GLint count = 0, maxlength = 0, values[3], maxlocation = -1, i, j;
+    const GLenum props[] = { GL_LOCATION, GL_TYPE, GL_ARRAY_SIZE };
+    size_t size = 0;
+    GLuint obj = program->get ();
+    std::vector<GLchar> buf;
+    std::vector<GLint> elements;
+    GLsizei length;
+
+    GetProgramInterfaceiv (obj, GL_UNIFORM, GL_ACTIVE_RESOURCES, &count);
+    GetProgramInterfaceiv (obj, GL_UNIFORM, GL_MAX_NAME_LENGTH, &maxlength);
+    CheckError ();
+    buf.resize (maxlength + 1);
+    for (i = 0; i < count; i++) {
+        GetProgramResourceiv (obj, GL_UNIFORM, i, 3, props, 3, NULL, values);
+        CheckError ();
+        /* members of uniform blocks have no location */
+        if (values[0] < 0)
+            continue;
+        Slot slot;
+        slot.location = values[0];
+        slot.type = values[1];
+        slot.count = values[2];
+        slot.elementsize = UniformTypeSize (slot.type);
+        /* align every uniform for doubles */
+        slot.offset = (size + 7) & ~size_t (7);
+        size = slot.offset + size_t (slot.count) * slot.elementsize;
+        /* array elements need not have consecutive locations,
+         * so each element is looked up by name */
+        elements.push_back (slot.location);
+        if (slot.count > 1) {
+            length = 0;
+            GetProgramResourceName (obj, GL_UNIFORM, i, buf.size (), &length,
+                                    &buf[0]);
+            CheckError ();
+            std::string base (&buf[0], std::max (length - 3, 0));
+            for (j = 1; j < slot.count; j++) {
+                std::string element = base + "[" + std::to_string (j) + "]";
+                elements.push_back (GetProgramResourceLocation
+                                    (obj, GL_UNIFORM, element.c_str ()));
+                CheckError ();
+            }
+        }
+        for (j = 0; j < slot.count; j++)
+            maxlocation = std::max (maxlocation,
+                                    elements[elements.size () - 1 - j]);
+        slots.push_back (slot);
+    }
+
+    locations.resize (maxlocation + 1, Element { -1, 0 });
+    data.resize ((size + 7) / 8, 0);
+    dirty.resize ((slots.size () + 63) / 64, 0);
+    for (i = 0, count = 0; i < GLint (slots.size ()); i++) {
+        const Slot &slot = slots[i];
+        char *ptr = reinterpret_cast<char *> (&data[0]) + slot.offset;
+        for (j = 0; j < slot.count; j++) {
+            GLint location = elements[count++];
+            if (location < 0)
+                continue;
+            locations[location] = Element { i, j };
+            UniformRead (obj, location, slot.type, slot.elementsize,
+                         ptr + j * slot.elementsize);
+        }
+    }
+}
+
+bool UniformStore::SetData (GLint location, const void *value, size_t size)
+{
+    int index;
+    size_t offset;
+    if (location < 0 || size_t (location) >= locations.size ()
+        || (index = locations[location].slot) < 0)
+        return false;
+    const Slot &slot = slots[index];
+    offset = size_t (locations[location].element) * slot.elementsize;
+    if (offset + size > size_t (slot.count) * slot.elementsize)
+        return false;
+    char *ptr = reinterpret_cast<char *> (&data[0]) + slot.offset + offset;
+    if (!memcmp (ptr, value, size))
+        return false;
+    memcpy (ptr, value, size);
+    if (!(dirty[index >> 6] & (uint64_t (1) << (index & 63)))) {
+        dirty[index >> 6] |= uint64_t (1) << (index & 63);
+        numdirty++;
+    }
+    return true;
+}
+
+const void *UniformStore::Get (GLint location) const
+{
+    int index;
+    if (location < 0 || size_t (location) >= locations.size ()
+        || (index = locations[location].slot) < 0)
+        return NULL;
+    const Slot &slot = slots[index];
+    return reinterpret_cast<const char *> (&data[0]) + slot.offset
+           + size_t (locations[location].element) * slot.elementsize;
+}
+
+unsigned int UniformStore::Flush (void)
+{
+    unsigned int calls = 0;
+    size_t word;
+    unsigned int bit;
+    if (!numdirty)
+        return 0;
+    for (word = 0; word < dirty.size (); word++) {
+        while (dirty[word]) {
+            bit = UniformLowestBit (dirty[word]);
+            dirty[word] &= dirty[word] - 1;
+            const Slot &slot = slots[word * 64 + bit];
+            UniformWrite (program->get (), slot.location, slot.type,
+                          slot.count, reinterpret_cast<const char *>
+                          (&data[0]) + slot.offset);
+            calls++;
+        }
+    }
+    numdirty = 0;
+    return calls;
+}
+
+} /* namespace oglp */
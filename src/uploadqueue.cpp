@@ -0,0 +1,226 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file */
+#include <oglp/uploadqueue.h>
+#include <algorithm>
+#include <cstring>
+
+namespace oglp {
+
+/* Alignment of staged data, sufficient for any pixel type. */
+static const GLsizeiptr UploadAlignment = 16;
+
+UploadQueue::UploadQueue (GLsizeiptr stagingsize, unsigned int regions)
+    : staging (stagingsize, regions)
+{
+}
+
+UploadQueue::Upload &UploadQueue::Queue (GLsizeiptr length, const GLvoid *ptr)
+{
+    writes.emplace_back ();
+    Upload &upload = writes.back ();
+    upload.buffer = NULL;
+    upload.texture = NULL;
+    upload.data = data.size ();
+    upload.length = length;
+    data.insert (data.end (), static_cast<const char *> (ptr),
+                 static_cast<const char *> (ptr) + length);
+    return upload;
+}
+
+void UploadQueue::Write (Buffer &buffer, GLintptr offset, GLsizeiptr size,
+                         const GLvoid *ptr)
+{
+    Upload &upload = Queue (size, ptr);
+    upload.buffer = &buffer;
+    upload.offset[0] = offset;
+}
+
+void UploadQueue::WriteTexture1D (Texture &texture, GLint level,
+                                  GLint xoffset, GLsizei width, GLenum format,
+                                  GLenum type, GLsizeiptr size,
+                                  const GLvoid *ptr)
+{
+    WriteTexture3D (texture, level, xoffset, 0, 0, width, 1, 1, format,
+                    type, size, ptr);
+    writes.back ().dimensions = 1;
+}
+
+void UploadQueue::WriteTexture2D (Texture &texture, GLint level,
+                                  GLint xoffset, GLint yoffset, GLsizei width,
+                                  GLsizei height, GLenum format, GLenum type,
+                                  GLsizeiptr size, const GLvoid *ptr)
+{
+    WriteTexture3D (texture, level, xoffset, yoffset, 0, width, height, 1,
+                    format, type, size, ptr);
+    writes.back ().dimensions = 2;
+}
+
+void UploadQueue::WriteTexture3D (Texture &texture, GLint level,
+                                  GLint xoffset, GLint yoffset, GLint zoffset,
+                                  GLsizei width, GLsizei height, GLsizei depth,
+                                  GLenum format, GLenum type, GLsizeiptr size,
+                                  const GLvoid *ptr)
+{
+    Upload &upload = Queue (size, ptr);
+    upload.texture = &texture;
+    upload.dimensions = 3;
+    upload.level = level;
+    upload.offset[0] = xoffset;
+    upload.offset[1] = yoffset;
+    upload.offset[2] = zoffset;
+    upload.size[0] = width;
+    upload.size[1] = height;
+    upload.size[2] = depth;
+    upload.format = format;
+    upload.type = type;
+}
+
+StreamBuffer::Allocation UploadQueue::Stage (GLsizeiptr length)
+{
+    StreamBuffer::Allocation allocation;
+    if (length > staging.GetRegionSize ()) {
+        allocation.ptr = NULL;
+        return allocation;
+    }
+    allocation = staging.Allocate (length, UploadAlignment);
+    if (!allocation.ptr) {
+        /* the region is full, fence it after the copies issued so far */
+        staging.NextFrame ();
+        allocation = staging.Allocate (length, UploadAlignment);
+    }
+    return allocation;
+}
+
+unsigned int UploadQueue::Flush (void)
+{
+    unsigned int calls = 0, textures = 0, i, j, k;
+    GLintptr begin, end;
+    GLint unpackbuffer = 0;
+    StreamBuffer::Allocation allocation;
+
+    /* sort the buffer writes by destination */
+    order.clear ();
+    for (i = 0; i < writes.size (); i++) {
+        if (writes[i].buffer)
+            order.push_back (i);
+        else
+            textures++;
+    }
+    std::sort (order.begin (), order.end (), [this] (unsigned int a,
+                                                     unsigned int b) {
+        if (writes[a].buffer->get () != writes[b].buffer->get ())
+            return writes[a].buffer->get () < writes[b].buffer->get ();
+        if (writes[a].offset[0] != writes[b].offset[0])
+            return writes[a].offset[0] < writes[b].offset[0];
+        return a < b;
+    });
+
+    /* merge adjacent and overlapping writes into runs */
+    for (i = 0; i < order.size (); i = j) {
+        Buffer *buffer = writes[order[i]].buffer;
+        begin = writes[order[i]].offset[0];
+        end = begin + writes[order[i]].length;
+        for (j = i + 1; j < order.size (); j++) {
+            const Upload &upload = writes[order[j]];
+            if (upload.buffer->get () != buffer->get ()
+                || upload.offset[0] > end)
+                break;
+            end = std::max (end, upload.offset[0] + upload.length);
+        }
+        /* apply overlapping writes in queue order */
+        std::sort (order.begin () + i, order.begin () + j);
+
+        allocation = Stage (end - begin);
+        if (!allocation.ptr) {
+            /* too large for the staging buffer */
+            for (k = i; k < j; k++) {
+                const Upload &upload = writes[order[k]];
+                buffer->SubData (upload.offset[0], upload.length,
+                                 &data[upload.data]);
+                calls++;
+            }
+            continue;
+        }
+        for (k = i; k < j; k++) {
+            const Upload &upload = writes[order[k]];
+            memcpy (static_cast<char *> (allocation.ptr)
+                    + (upload.offset[0] - begin), &data[upload.data],
+                    upload.length);
+        }
+        Buffer::CopySubData (staging.GetBuffer (), *buffer,
+                             allocation.offset, begin, end - begin);
+        calls++;
+    }
+
+    /* texture writes cannot be merged */
+    if (textures) {
+        GetIntegerv (GL_PIXEL_UNPACK_BUFFER_BINDING, &unpackbuffer);
+        CheckError ();
+        staging.GetBuffer ().Bind (GL_PIXEL_UNPACK_BUFFER);
+    }
+    for (const Upload &upload : writes) {
+        const GLvoid *ptr;
+        if (!upload.texture)
+            continue;
+        allocation = Stage (upload.length);
+        if (allocation.ptr) {
+            memcpy (allocation.ptr, &data[upload.data], upload.length);
+            ptr = reinterpret_cast<const GLvoid *> (allocation.offset);
+        } else {
+            Buffer::Unbind (GL_PIXEL_UNPACK_BUFFER);
+            ptr = &data[upload.data];
+        }
+        switch (upload.dimensions) {
+            case 1:
+                upload.texture->SubImage1D (upload.level, upload.offset[0],
+                                            upload.size[0], upload.format,
+                                            upload.type, ptr);
+                break;
+            case 2:
+                upload.texture->SubImage2D (upload.level, upload.offset[0],
+                                            upload.offset[1], upload.size[0],
+                                            upload.size[1], upload.format,
+                                            upload.type, ptr);
+                break;
+            default:
+                upload.texture->SubImage3D (upload.level, upload.offset[0],
+                                            upload.offset[1], upload.offset[2],
+                                            upload.size[0], upload.size[1],
+                                            upload.size[2], upload.format,
+                                            upload.type, ptr);
+                break;
+        }
+        if (!allocation.ptr)
+            staging.GetBuffer ().Bind (GL_PIXEL_UNPACK_BUFFER);
+        calls++;
+    }
+    /* restore the unpack buffer of the caller */
+    if (textures) {
+        BindBuffer (GL_PIXEL_UNPACK_BUFFER, unpackbuffer);
+        CheckError ();
+    }
+
+    writes.clear ();
+    data.clear ();
+    return calls;
+}
+
+} /* namespace oglp */
@@ -0,0 +1,70 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "context.h"
+#include <cstddef>
+
+namespace oglp {
+namespace tools {
+
+void *GetProcAddress (const char *name)
+{
+    return reinterpret_cast<void *> (eglGetProcAddress (name));
+}
+
+bool CreateContext (EGLint width, EGLint height)
+{
+    static const EGLint configattribs[] = {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8,
+        EGL_DEPTH_SIZE, 24, EGL_STENCIL_SIZE, 8,
+        EGL_NONE
+    };
+    static const EGLint contextattribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 4,
+        EGL_CONTEXT_MINOR_VERSION, 5,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+    EGLint surfaceattribs[] = { EGL_WIDTH, width, EGL_HEIGHT, height, EGL_NONE };
+    EGLDisplay display;
+    EGLConfig config = NULL;
+    EGLSurface surface = EGL_NO_SURFACE;
+    EGLContext context;
+    EGLint numconfigs = 0;
+
+    display = eglGetDisplay (EGL_DEFAULT_DISPLAY);
+    if (display == EGL_NO_DISPLAY || !eglInitialize (display, NULL, NULL))
+        return false;
+    if (!eglBindAPI (EGL_OPENGL_API))
+        return false;
+    eglChooseConfig (display, configattribs, &config, 1, &numconfigs);
+    context = eglCreateContext (display, numconfigs ? config : NULL,
+                                EGL_NO_CONTEXT, contextattribs);
+    if (context == EGL_NO_CONTEXT)
+        return false;
+    /* without a pbuffer config, the context is made current surfaceless */
+    if (numconfigs)
+        surface = eglCreatePbufferSurface (display, config, surfaceattribs);
+    return eglMakeCurrent (display, surface, surface, context);
+}
+
+} /* namespace tools */
+} /* namespace oglp */
@@ -0,0 +1,49 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OGLP_TOOLS_CONTEXT_H
+#define OGLP_TOOLS_CONTEXT_H
+
+#include <EGL/egl.h>
+
+namespace oglp {
+namespace tools {
+
+/**
+ * Create an offscreen context.
+ * Creates an OpenGL 4.5 core context with EGL and makes it current,
+ * with a pbuffer surface if available and surfaceless otherwise.
+ * \param width Specifies the width of the pbuffer surface.
+ * \param height Specifies the height of the pbuffer surface.
+ * \return Whether the context was created.
+ */
+bool CreateContext (EGLint width, EGLint height);
+
+/**
+ * Resolve an entry point.
+ * Entry point resolver for oglp::Init using EGL.
+ * \param name Specifies the name of the entry point.
+ * \return The address of the entry point or NULL.
+ */
+void *GetProcAddress (const char *name);
+
+} /* namespace tools */
+} /* namespace oglp */
+
+#endif /* !defined OGLP_TOOLS_CONTEXT_H */
@@ -0,0 +1,4434 @@
+/*
+ * Copyright (c) 2014 Daniel Kirchner
+ *
+ * Copying and distribution of this file, with or without modification,
+ * are permitted in any medium without royalty provided the copyright
+ * notice and this notice are preserved.  This file is offered as-is,
+ * without any warranty. 
+ */
+/* This file was generated by glcorew_gen.py.
+ * Don't change it directly, change glcorew_gen.py instead.*/
+#include "replay.h"
+
+namespace oglp {
+namespace replay {
+
+static void Replay_CullFace (Call &call)
+{
+    CullFace (call.Value<GLenum> (0));
+}
+
+static void Replay_FrontFace (Call &call)
+{
+    FrontFace (call.Value<GLenum> (0));
+}
+
+static void Replay_Hint (Call &call)
+{
+    Hint (call.Value<GLenum> (0), call.Value<GLenum> (1));
+}
+
+static void Replay_LineWidth (Call &call)
+{
+    LineWidth (call.Value<GLfloat> (0));
+}
+
+static void Replay_PointSize (Call &call)
+{
+    PointSize (call.Value<GLfloat> (0));
+}
+
+static void Replay_PolygonMode (Call &call)
+{
+    PolygonMode (call.Value<GLenum> (0), call.Value<GLenum> (1));
+}
+
+static void Replay_Scissor (Call &call)
+{
+    Scissor (call.Value<GLint> (0), call.Value<GLint> (1), call.Value<GLsizei> (2), call.Value<GLsizei> (3));
+}
+
+static void Replay_TexParameterf (Call &call)
+{
+    TexParameterf (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Value<GLfloat> (2));
+}
+
+static void Replay_TexParameterfv (Call &call)
+{
+    TexParameterfv (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Pointer<const GLfloat *> (2));
+}
+
+static void Replay_TexParameteri (Call &call)
+{
+    TexParameteri (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Value<GLint> (2));
+}
+
+static void Replay_TexParameteriv (Call &call)
+{
+    TexParameteriv (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Pointer<const GLint *> (2));
+}
+
+static void Replay_TexImage1D (Call &call)
+{
+    TexImage1D (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLsizei> (3), call.Value<GLint> (4), call.Value<GLenum> (5), call.Value<GLenum> (6), call.Pointer<const void *> (7));
+}
+
+static void Replay_TexImage2D (Call &call)
+{
+    TexImage2D (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLsizei> (3), call.Value<GLsizei> (4), call.Value<GLint> (5), call.Value<GLenum> (6), call.Value<GLenum> (7), call.Pointer<const void *> (8));
+}
+
+static void Replay_DrawBuffer (Call &call)
+{
+    DrawBuffer (call.Value<GLenum> (0));
+}
+
+static void Replay_Clear (Call &call)
+{
+    Clear (call.Value<GLbitfield> (0));
+}
+
+static void Replay_ClearColor (Call &call)
+{
+    ClearColor (call.Value<GLfloat> (0), call.Value<GLfloat> (1), call.Value<GLfloat> (2), call.Value<GLfloat> (3));
+}
+
+static void Replay_ClearStencil (Call &call)
+{
+    ClearStencil (call.Value<GLint> (0));
+}
+
+static void Replay_ClearDepth (Call &call)
+{
+    ClearDepth (call.Value<GLdouble> (0));
+}
+
+static void Replay_StencilMask (Call &call)
+{
+    StencilMask (call.Value<GLuint> (0));
+}
+
+static void Replay_ColorMask (Call &call)
+{
+    ColorMask (call.Value<GLboolean> (0), call.Value<GLboolean> (1), call.Value<GLboolean> (2), call.Value<GLboolean> (3));
+}
+
+static void Replay_DepthMask (Call &call)
+{
+    DepthMask (call.Value<GLboolean> (0));
+}
+
+static void Replay_Disable (Call &call)
+{
+    Disable (call.Value<GLenum> (0));
+}
+
+static void Replay_Enable (Call &call)
+{
+    Enable (call.Value<GLenum> (0));
+}
+
+static void Replay_Finish (Call &call)
+{
+    (void) call;
+    Finish ();
+}
+
+static void Replay_Flush (Call &call)
+{
+    (void) call;
+    Flush ();
+}
+
+static void Replay_BlendFunc (Call &call)
+{
+    BlendFunc (call.Value<GLenum> (0), call.Value<GLenum> (1));
+}
+
+static void Replay_LogicOp (Call &call)
+{
+    LogicOp (call.Value<GLenum> (0));
+}
+
+static void Replay_StencilFunc (Call &call)
+{
+    StencilFunc (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLuint> (2));
+}
+
+static void Replay_StencilOp (Call &call)
+{
+    StencilOp (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Value<GLenum> (2));
+}
+
+static void Replay_DepthFunc (Call &call)
+{
+    DepthFunc (call.Value<GLenum> (0));
+}
+
+static void Replay_PixelStoref (Call &call)
+{
+    PixelStoref (call.Value<GLenum> (0), call.Value<GLfloat> (1));
+}
+
+static void Replay_PixelStorei (Call &call)
+{
+    PixelStorei (call.Value<GLenum> (0), call.Value<GLint> (1));
+}
+
+static void Replay_ReadBuffer (Call &call)
+{
+    ReadBuffer (call.Value<GLenum> (0));
+}
+
+static void Replay_ReadPixels (Call &call)
+{
+    ReadPixels (call.Value<GLint> (0), call.Value<GLint> (1), call.Value<GLsizei> (2), call.Value<GLsizei> (3), call.Value<GLenum> (4), call.Value<GLenum> (5), call.Output<void *> (6));
+}
+
+static void Replay_GetBooleanv (Call &call)
+{
+    GetBooleanv (call.Value<GLenum> (0), call.Output<GLboolean *> (1));
+}
+
+static void Replay_GetDoublev (Call &call)
+{
+    GetDoublev (call.Value<GLenum> (0), call.Output<GLdouble *> (1));
+}
+
+static void Replay_GetError (Call &call)
+{
+    (void) call;
+    GetError ();
+}
+
+static void Replay_GetFloatv (Call &call)
+{
+    GetFloatv (call.Value<GLenum> (0), call.Output<GLfloat *> (1));
+}
+
+static void Replay_GetIntegerv (Call &call)
+{
+    GetIntegerv (call.Value<GLenum> (0), call.Output<GLint *> (1));
+}
+
+static void Replay_GetString (Call &call)
+{
+    GetString (call.Value<GLenum> (0));
+}
+
+static void Replay_GetTexImage (Call &call)
+{
+    GetTexImage (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLenum> (2), call.Value<GLenum> (3), call.Output<void *> (4));
+}
+
+static void Replay_GetTexParameterfv (Call &call)
+{
+    GetTexParameterfv (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Output<GLfloat *> (2));
+}
+
+static void Replay_GetTexParameteriv (Call &call)
+{
+    GetTexParameteriv (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Output<GLint *> (2));
+}
+
+static void Replay_GetTexLevelParameterfv (Call &call)
+{
+    GetTexLevelParameterfv (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLenum> (2), call.Output<GLfloat *> (3));
+}
+
+static void Replay_GetTexLevelParameteriv (Call &call)
+{
+    GetTexLevelParameteriv (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLenum> (2), call.Output<GLint *> (3));
+}
+
+static void Replay_IsEnabled (Call &call)
+{
+    IsEnabled (call.Value<GLenum> (0));
+}
+
+static void Replay_DepthRange (Call &call)
+{
+    DepthRange (call.Value<GLdouble> (0), call.Value<GLdouble> (1));
+}
+
+static void Replay_Viewport (Call &call)
+{
+    Viewport (call.Value<GLint> (0), call.Value<GLint> (1), call.Value<GLsizei> (2), call.Value<GLsizei> (3));
+}
+
+static void Replay_DrawArrays (Call &call)
+{
+    DrawArrays (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLsizei> (2));
+}
+
+static void Replay_DrawElements (Call &call)
+{
+    DrawElements (call.Value<GLenum> (0), call.Value<GLsizei> (1), call.Value<GLenum> (2), call.Pointer<const void *> (3));
+}
+
+static void Replay_GetPointerv (Call &call)
+{
+    GetPointerv (call.Value<GLenum> (0), call.Output<void **> (1));
+}
+
+static void Replay_PolygonOffset (Call &call)
+{
+    PolygonOffset (call.Value<GLfloat> (0), call.Value<GLfloat> (1));
+}
+
+static void Replay_CopyTexImage1D (Call &call)
+{
+    CopyTexImage1D (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLenum> (2), call.Value<GLint> (3), call.Value<GLint> (4), call.Value<GLsizei> (5), call.Value<GLint> (6));
+}
+
+static void Replay_CopyTexImage2D (Call &call)
+{
+    CopyTexImage2D (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLenum> (2), call.Value<GLint> (3), call.Value<GLint> (4), call.Value<GLsizei> (5), call.Value<GLsizei> (6), call.Value<GLint> (7));
+}
+
+static void Replay_CopyTexSubImage1D (Call &call)
+{
+    CopyTexSubImage1D (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLint> (3), call.Value<GLint> (4), call.Value<GLsizei> (5));
+}
+
+static void Replay_CopyTexSubImage2D (Call &call)
+{
+    CopyTexSubImage2D (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLint> (3), call.Value<GLint> (4), call.Value<GLint> (5), call.Value<GLsizei> (6), call.Value<GLsizei> (7));
+}
+
+static void Replay_TexSubImage1D (Call &call)
+{
+    TexSubImage1D (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLsizei> (3), call.Value<GLenum> (4), call.Value<GLenum> (5), call.Pointer<const void *> (6));
+}
+
+static void Replay_TexSubImage2D (Call &call)
+{
+    TexSubImage2D (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLint> (3), call.Value<GLsizei> (4), call.Value<GLsizei> (5), call.Value<GLenum> (6), call.Value<GLenum> (7), call.Pointer<const void *> (8));
+}
+
+static void Replay_BindTexture (Call &call)
+{
+    BindTexture (call.Value<GLenum> (0), call.Object (1, ObjectTexture));
+}
+
+static void Replay_DeleteTextures (Call &call)
+{
+    DeleteTextures (call.Value<GLsizei> (0), call.Objects (1, ObjectTexture));
+}
+
+static void Replay_GenTextures (Call &call)
+{
+    GenTextures (call.Value<GLsizei> (0), call.Output<GLuint *> (1));
+    call.MapObjects (1, ObjectTexture);
+}
+
+static void Replay_IsTexture (Call &call)
+{
+    IsTexture (call.Object (0, ObjectTexture));
+}
+
+static void Replay_DrawRangeElements (Call &call)
+{
+    DrawRangeElements (call.Value<GLenum> (0), call.Value<GLuint> (1), call.Value<GLuint> (2), call.Value<GLsizei> (3), call.Value<GLenum> (4), call.Pointer<const void *> (5));
+}
+
+static void Replay_TexImage3D (Call &call)
+{
+    TexImage3D (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLsizei> (3), call.Value<GLsizei> (4), call.Value<GLsizei> (5), call.Value<GLint> (6), call.Value<GLenum> (7), call.Value<GLenum> (8), call.Pointer<const void *> (9));
+}
+
+static void Replay_TexSubImage3D (Call &call)
+{
+    TexSubImage3D (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLint> (3), call.Value<GLint> (4), call.Value<GLsizei> (5), call.Value<GLsizei> (6), call.Value<GLsizei> (7), call.Value<GLenum> (8), call.Value<GLenum> (9), call.Pointer<const void *> (10));
+}
+
+static void Replay_CopyTexSubImage3D (Call &call)
+{
+    CopyTexSubImage3D (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLint> (3), call.Value<GLint> (4), call.Value<GLint> (5), call.Value<GLint> (6), call.Value<GLsizei> (7), call.Value<GLsizei> (8));
+}
+
+static void Replay_ActiveTexture (Call &call)
+{
+    ActiveTexture (call.Value<GLenum> (0));
+}
+
+static void Replay_SampleCoverage (Call &call)
+{
+    SampleCoverage (call.Value<GLfloat> (0), call.Value<GLboolean> (1));
+}
+
+static void Replay_CompressedTexImage3D (Call &call)
+{
+    CompressedTexImage3D (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLenum> (2), call.Value<GLsizei> (3), call.Value<GLsizei> (4), call.Value<GLsizei> (5), call.Value<GLint> (6), call.Value<GLsizei> (7), call.Pointer<const void *> (8));
+}
+
+static void Replay_CompressedTexImage2D (Call &call)
+{
+    CompressedTexImage2D (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLenum> (2), call.Value<GLsizei> (3), call.Value<GLsizei> (4), call.Value<GLint> (5), call.Value<GLsizei> (6), call.Pointer<const void *> (7));
+}
+
+static void Replay_CompressedTexImage1D (Call &call)
+{
+    CompressedTexImage1D (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLenum> (2), call.Value<GLsizei> (3), call.Value<GLint> (4), call.Value<GLsizei> (5), call.Pointer<const void *> (6));
+}
+
+static void Replay_CompressedTexSubImage3D (Call &call)
+{
+    CompressedTexSubImage3D (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLint> (3), call.Value<GLint> (4), call.Value<GLsizei> (5), call.Value<GLsizei> (6), call.Value<GLsizei> (7), call.Value<GLenum> (8), call.Value<GLsizei> (9), call.Pointer<const void *> (10));
+}
+
+static void Replay_CompressedTexSubImage2D (Call &call)
+{
+    CompressedTexSubImage2D (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLint> (3), call.Value<GLsizei> (4), call.Value<GLsizei> (5), call.Value<GLenum> (6), call.Value<GLsizei> (7), call.Pointer<const void *> (8));
+}
+
+static void Replay_CompressedTexSubImage1D (Call &call)
+{
+    CompressedTexSubImage1D (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLsizei> (3), call.Value<GLenum> (4), call.Value<GLsizei> (5), call.Pointer<const void *> (6));
+}
+
+static void Replay_GetCompressedTexImage (Call &call)
+{
+    GetCompressedTexImage (call.Value<GLenum> (0), call.Value<GLint> (1), call.Output<void *> (2));
+}
+
+static void Replay_BlendFuncSeparate (Call &call)
+{
+    BlendFuncSeparate (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Value<GLenum> (2), call.Value<GLenum> (3));
+}
+
+static void Replay_MultiDrawArrays (Call &call)
+{
+    MultiDrawArrays (call.Value<GLenum> (0), call.Pointer<const GLint *> (1), call.Pointer<const GLsizei *> (2), call.Value<GLsizei> (3));
+}
+
+static void Replay_MultiDrawElements (Call &call)
+{
+    MultiDrawElements (call.Value<GLenum> (0), call.Pointer<const GLsizei *> (1), call.Value<GLenum> (2), call.Pointer<const void *const*> (3), call.Value<GLsizei> (4));
+}
+
+static void Replay_PointParameterf (Call &call)
+{
+    PointParameterf (call.Value<GLenum> (0), call.Value<GLfloat> (1));
+}
+
+static void Replay_PointParameterfv (Call &call)
+{
+    PointParameterfv (call.Value<GLenum> (0), call.Pointer<const GLfloat *> (1));
+}
+
+static void Replay_PointParameteri (Call &call)
+{
+    PointParameteri (call.Value<GLenum> (0), call.Value<GLint> (1));
+}
+
+static void Replay_PointParameteriv (Call &call)
+{
+    PointParameteriv (call.Value<GLenum> (0), call.Pointer<const GLint *> (1));
+}
+
+static void Replay_BlendColor (Call &call)
+{
+    BlendColor (call.Value<GLfloat> (0), call.Value<GLfloat> (1), call.Value<GLfloat> (2), call.Value<GLfloat> (3));
+}
+
+static void Replay_BlendEquation (Call &call)
+{
+    BlendEquation (call.Value<GLenum> (0));
+}
+
+static void Replay_GenQueries (Call &call)
+{
+    GenQueries (call.Value<GLsizei> (0), call.Output<GLuint *> (1));
+    call.MapObjects (1, ObjectQuery);
+}
+
+static void Replay_DeleteQueries (Call &call)
+{
+    DeleteQueries (call.Value<GLsizei> (0), call.Objects (1, ObjectQuery));
+}
+
+static void Replay_IsQuery (Call &call)
+{
+    IsQuery (call.Object (0, ObjectQuery));
+}
+
+static void Replay_BeginQuery (Call &call)
+{
+    BeginQuery (call.Value<GLenum> (0), call.Object (1, ObjectQuery));
+}
+
+static void Replay_EndQuery (Call &call)
+{
+    EndQuery (call.Value<GLenum> (0));
+}
+
+static void Replay_GetQueryiv (Call &call)
+{
+    GetQueryiv (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Output<GLint *> (2));
+}
+
+static void Replay_GetQueryObjectiv (Call &call)
+{
+    GetQueryObjectiv (call.Object (0, ObjectQuery), call.Value<GLenum> (1), call.Output<GLint *> (2));
+}
+
+static void Replay_GetQueryObjectuiv (Call &call)
+{
+    GetQueryObjectuiv (call.Object (0, ObjectQuery), call.Value<GLenum> (1), call.Output<GLuint *> (2));
+}
+
+static void Replay_BindBuffer (Call &call)
+{
+    BindBuffer (call.Value<GLenum> (0), call.Object (1, ObjectBuffer));
+}
+
+static void Replay_DeleteBuffers (Call &call)
+{
+    DeleteBuffers (call.Value<GLsizei> (0), call.Objects (1, ObjectBuffer));
+}
+
+static void Replay_GenBuffers (Call &call)
+{
+    GenBuffers (call.Value<GLsizei> (0), call.Output<GLuint *> (1));
+    call.MapObjects (1, ObjectBuffer);
+}
+
+static void Replay_IsBuffer (Call &call)
+{
+    IsBuffer (call.Object (0, ObjectBuffer));
+}
+
+static void Replay_BufferData (Call &call)
+{
+    BufferData (call.Value<GLenum> (0), call.Value<GLsizeiptr> (1), call.Pointer<const void *> (2), call.Value<GLenum> (3));
+}
+
+static void Replay_BufferSubData (Call &call)
+{
+    BufferSubData (call.Value<GLenum> (0), call.Value<GLintptr> (1), call.Value<GLsizeiptr> (2), call.Pointer<const void *> (3));
+}
+
+static void Replay_GetBufferSubData (Call &call)
+{
+    GetBufferSubData (call.Value<GLenum> (0), call.Value<GLintptr> (1), call.Value<GLsizeiptr> (2), call.Output<void *> (3));
+}
+
+static void Replay_MapBuffer (Call &call)
+{
+    MapBuffer (call.Value<GLenum> (0), call.Value<GLenum> (1));
+}
+
+static void Replay_UnmapBuffer (Call &call)
+{
+    UnmapBuffer (call.Value<GLenum> (0));
+}
+
+static void Replay_GetBufferParameteriv (Call &call)
+{
+    GetBufferParameteriv (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Output<GLint *> (2));
+}
+
+static void Replay_GetBufferPointerv (Call &call)
+{
+    GetBufferPointerv (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Output<void **> (2));
+}
+
+static void Replay_BlendEquationSeparate (Call &call)
+{
+    BlendEquationSeparate (call.Value<GLenum> (0), call.Value<GLenum> (1));
+}
+
+static void Replay_DrawBuffers (Call &call)
+{
+    DrawBuffers (call.Value<GLsizei> (0), call.Pointer<const GLenum *> (1));
+}
+
+static void Replay_StencilOpSeparate (Call &call)
+{
+    StencilOpSeparate (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Value<GLenum> (2), call.Value<GLenum> (3));
+}
+
+static void Replay_StencilFuncSeparate (Call &call)
+{
+    StencilFuncSeparate (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Value<GLint> (2), call.Value<GLuint> (3));
+}
+
+static void Replay_StencilMaskSeparate (Call &call)
+{
+    StencilMaskSeparate (call.Value<GLenum> (0), call.Value<GLuint> (1));
+}
+
+static void Replay_AttachShader (Call &call)
+{
+    AttachShader (call.Object (0, ObjectProgram), call.Object (1, ObjectShader));
+}
+
+static void Replay_BindAttribLocation (Call &call)
+{
+    BindAttribLocation (call.Object (0, ObjectProgram), call.Value<GLuint> (1), call.Pointer<const GLchar *> (2));
+}
+
+static void Replay_CompileShader (Call &call)
+{
+    CompileShader (call.Object (0, ObjectShader));
+}
+
+static void Replay_CreateProgram (Call &call)
+{
+    (void) call;
+    GLuint result = CreateProgram ();
+    call.MapObject (ObjectProgram, result);
+}
+
+static void Replay_CreateShader (Call &call)
+{
+    GLuint result = CreateShader (call.Value<GLenum> (0));
+    call.MapObject (ObjectShader, result);
+}
+
+static void Replay_DeleteProgram (Call &call)
+{
+    DeleteProgram (call.Object (0, ObjectProgram));
+}
+
+static void Replay_DeleteShader (Call &call)
+{
+    DeleteShader (call.Object (0, ObjectShader));
+}
+
+static void Replay_DetachShader (Call &call)
+{
+    DetachShader (call.Object (0, ObjectProgram), call.Object (1, ObjectShader));
+}
+
+static void Replay_DisableVertexAttribArray (Call &call)
+{
+    DisableVertexAttribArray (call.Value<GLuint> (0));
+}
+
+static void Replay_EnableVertexAttribArray (Call &call)
+{
+    EnableVertexAttribArray (call.Value<GLuint> (0));
+}
+
+static void Replay_GetActiveAttrib (Call &call)
+{
+    GetActiveAttrib (call.Object (0, ObjectProgram), call.Value<GLuint> (1), call.Value<GLsizei> (2), call.Output<GLsizei *> (3), call.Output<GLint *> (4), call.Output<GLenum *> (5), call.Output<GLchar *> (6));
+}
+
+static void Replay_GetActiveUniform (Call &call)
+{
+    GetActiveUniform (call.Object (0, ObjectProgram), call.Value<GLuint> (1), call.Value<GLsizei> (2), call.Output<GLsizei *> (3), call.Output<GLint *> (4), call.Output<GLenum *> (5), call.Output<GLchar *> (6));
+}
+
+static void Replay_GetAttachedShaders (Call &call)
+{
+    GetAttachedShaders (call.Object (0, ObjectProgram), call.Value<GLsizei> (1), call.Output<GLsizei *> (2), call.Output<GLuint *> (3));
+}
+
+static void Replay_GetAttribLocation (Call &call)
+{
+    GetAttribLocation (call.Object (0, ObjectProgram), call.Pointer<const GLchar *> (1));
+}
+
+static void Replay_GetProgramiv (Call &call)
+{
+    GetProgramiv (call.Object (0, ObjectProgram), call.Value<GLenum> (1), call.Output<GLint *> (2));
+}
+
+static void Replay_GetProgramInfoLog (Call &call)
+{
+    GetProgramInfoLog (call.Object (0, ObjectProgram), call.Value<GLsizei> (1), call.Output<GLsizei *> (2), call.Output<GLchar *> (3));
+}
+
+static void Replay_GetShaderiv (Call &call)
+{
+    GetShaderiv (call.Object (0, ObjectShader), call.Value<GLenum> (1), call.Output<GLint *> (2));
+}
+
+static void Replay_GetShaderInfoLog (Call &call)
+{
+    GetShaderInfoLog (call.Object (0, ObjectShader), call.Value<GLsizei> (1), call.Output<GLsizei *> (2), call.Output<GLchar *> (3));
+}
+
+static void Replay_GetShaderSource (Call &call)
+{
+    GetShaderSource (call.Object (0, ObjectShader), call.Value<GLsizei> (1), call.Output<GLsizei *> (2), call.Output<GLchar *> (3));
+}
+
+static void Replay_GetUniformLocation (Call &call)
+{
+    GLint result = GetUniformLocation (call.Object (0, ObjectProgram), call.Pointer<const GLchar *> (1));
+    call.MapLocation (0, result);
+}
+
+static void Replay_GetUniformfv (Call &call)
+{
+    GetUniformfv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Output<GLfloat *> (2));
+}
+
+static void Replay_GetUniformiv (Call &call)
+{
+    GetUniformiv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Output<GLint *> (2));
+}
+
+static void Replay_GetVertexAttribdv (Call &call)
+{
+    GetVertexAttribdv (call.Value<GLuint> (0), call.Value<GLenum> (1), call.Output<GLdouble *> (2));
+}
+
+static void Replay_GetVertexAttribfv (Call &call)
+{
+    GetVertexAttribfv (call.Value<GLuint> (0), call.Value<GLenum> (1), call.Output<GLfloat *> (2));
+}
+
+static void Replay_GetVertexAttribiv (Call &call)
+{
+    GetVertexAttribiv (call.Value<GLuint> (0), call.Value<GLenum> (1), call.Output<GLint *> (2));
+}
+
+static void Replay_GetVertexAttribPointerv (Call &call)
+{
+    GetVertexAttribPointerv (call.Value<GLuint> (0), call.Value<GLenum> (1), call.Output<void **> (2));
+}
+
+static void Replay_IsProgram (Call &call)
+{
+    IsProgram (call.Object (0, ObjectProgram));
+}
+
+static void Replay_IsShader (Call &call)
+{
+    IsShader (call.Object (0, ObjectShader));
+}
+
+static void Replay_LinkProgram (Call &call)
+{
+    LinkProgram (call.Object (0, ObjectProgram));
+}
+
+static void Replay_ShaderSource (Call &call)
+{
+    ShaderSource (call.Object (0, ObjectShader), call.Value<GLsizei> (1), call.Strings (2), call.StringLengths (2));
+}
+
+static void Replay_UseProgram (Call &call)
+{
+    UseProgram (call.Object (0, ObjectProgram));
+}
+
+static void Replay_Uniform1f (Call &call)
+{
+    Uniform1f (call.Value<GLint> (0), call.Value<GLfloat> (1));
+}
+
+static void Replay_Uniform2f (Call &call)
+{
+    Uniform2f (call.Value<GLint> (0), call.Value<GLfloat> (1), call.Value<GLfloat> (2));
+}
+
+static void Replay_Uniform3f (Call &call)
+{
+    Uniform3f (call.Value<GLint> (0), call.Value<GLfloat> (1), call.Value<GLfloat> (2), call.Value<GLfloat> (3));
+}
+
+static void Replay_Uniform4f (Call &call)
+{
+    Uniform4f (call.Value<GLint> (0), call.Value<GLfloat> (1), call.Value<GLfloat> (2), call.Value<GLfloat> (3), call.Value<GLfloat> (4));
+}
+
+static void Replay_Uniform1i (Call &call)
+{
+    Uniform1i (call.Value<GLint> (0), call.Value<GLint> (1));
+}
+
+static void Replay_Uniform2i (Call &call)
+{
+    Uniform2i (call.Value<GLint> (0), call.Value<GLint> (1), call.Value<GLint> (2));
+}
+
+static void Replay_Uniform3i (Call &call)
+{
+    Uniform3i (call.Value<GLint> (0), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLint> (3));
+}
+
+static void Replay_Uniform4i (Call &call)
+{
+    Uniform4i (call.Value<GLint> (0), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLint> (3), call.Value<GLint> (4));
+}
+
+static void Replay_Uniform1fv (Call &call)
+{
+    Uniform1fv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Pointer<const GLfloat *> (2));
+}
+
+static void Replay_Uniform2fv (Call &call)
+{
+    Uniform2fv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Pointer<const GLfloat *> (2));
+}
+
+static void Replay_Uniform3fv (Call &call)
+{
+    Uniform3fv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Pointer<const GLfloat *> (2));
+}
+
+static void Replay_Uniform4fv (Call &call)
+{
+    Uniform4fv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Pointer<const GLfloat *> (2));
+}
+
+static void Replay_Uniform1iv (Call &call)
+{
+    Uniform1iv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Pointer<const GLint *> (2));
+}
+
+static void Replay_Uniform2iv (Call &call)
+{
+    Uniform2iv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Pointer<const GLint *> (2));
+}
+
+static void Replay_Uniform3iv (Call &call)
+{
+    Uniform3iv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Pointer<const GLint *> (2));
+}
+
+static void Replay_Uniform4iv (Call &call)
+{
+    Uniform4iv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Pointer<const GLint *> (2));
+}
+
+static void Replay_UniformMatrix2fv (Call &call)
+{
+    UniformMatrix2fv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Value<GLboolean> (2), call.Pointer<const GLfloat *> (3));
+}
+
+static void Replay_UniformMatrix3fv (Call &call)
+{
+    UniformMatrix3fv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Value<GLboolean> (2), call.Pointer<const GLfloat *> (3));
+}
+
+static void Replay_UniformMatrix4fv (Call &call)
+{
+    UniformMatrix4fv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Value<GLboolean> (2), call.Pointer<const GLfloat *> (3));
+}
+
+static void Replay_ValidateProgram (Call &call)
+{
+    ValidateProgram (call.Object (0, ObjectProgram));
+}
+
+static void Replay_VertexAttrib1d (Call &call)
+{
+    VertexAttrib1d (call.Value<GLuint> (0), call.Value<GLdouble> (1));
+}
+
+static void Replay_VertexAttrib1dv (Call &call)
+{
+    VertexAttrib1dv (call.Value<GLuint> (0), call.Pointer<const GLdouble *> (1));
+}
+
+static void Replay_VertexAttrib1f (Call &call)
+{
+    VertexAttrib1f (call.Value<GLuint> (0), call.Value<GLfloat> (1));
+}
+
+static void Replay_VertexAttrib1fv (Call &call)
+{
+    VertexAttrib1fv (call.Value<GLuint> (0), call.Pointer<const GLfloat *> (1));
+}
+
+static void Replay_VertexAttrib1s (Call &call)
+{
+    VertexAttrib1s (call.Value<GLuint> (0), call.Value<GLshort> (1));
+}
+
+static void Replay_VertexAttrib1sv (Call &call)
+{
+    VertexAttrib1sv (call.Value<GLuint> (0), call.Pointer<const GLshort *> (1));
+}
+
+static void Replay_VertexAttrib2d (Call &call)
+{
+    VertexAttrib2d (call.Value<GLuint> (0), call.Value<GLdouble> (1), call.Value<GLdouble> (2));
+}
+
+static void Replay_VertexAttrib2dv (Call &call)
+{
+    VertexAttrib2dv (call.Value<GLuint> (0), call.Pointer<const GLdouble *> (1));
+}
+
+static void Replay_VertexAttrib2f (Call &call)
+{
+    VertexAttrib2f (call.Value<GLuint> (0), call.Value<GLfloat> (1), call.Value<GLfloat> (2));
+}
+
+static void Replay_VertexAttrib2fv (Call &call)
+{
+    VertexAttrib2fv (call.Value<GLuint> (0), call.Pointer<const GLfloat *> (1));
+}
+
+static void Replay_VertexAttrib2s (Call &call)
+{
+    VertexAttrib2s (call.Value<GLuint> (0), call.Value<GLshort> (1), call.Value<GLshort> (2));
+}
+
+static void Replay_VertexAttrib2sv (Call &call)
+{
+    VertexAttrib2sv (call.Value<GLuint> (0), call.Pointer<const GLshort *> (1));
+}
+
+static void Replay_VertexAttrib3d (Call &call)
+{
+    VertexAttrib3d (call.Value<GLuint> (0), call.Value<GLdouble> (1), call.Value<GLdouble> (2), call.Value<GLdouble> (3));
+}
+
+static void Replay_VertexAttrib3dv (Call &call)
+{
+    VertexAttrib3dv (call.Value<GLuint> (0), call.Pointer<const GLdouble *> (1));
+}
+
+static void Replay_VertexAttrib3f (Call &call)
+{
+    VertexAttrib3f (call.Value<GLuint> (0), call.Value<GLfloat> (1), call.Value<GLfloat> (2), call.Value<GLfloat> (3));
+}
+
+static void Replay_VertexAttrib3fv (Call &call)
+{
+    VertexAttrib3fv (call.Value<GLuint> (0), call.Pointer<const GLfloat *> (1));
+}
+
+static void Replay_VertexAttrib3s (Call &call)
+{
+    VertexAttrib3s (call.Value<GLuint> (0), call.Value<GLshort> (1), call.Value<GLshort> (2), call.Value<GLshort> (3));
+}
+
+static void Replay_VertexAttrib3sv (Call &call)
+{
+    VertexAttrib3sv (call.Value<GLuint> (0), call.Pointer<const GLshort *> (1));
+}
+
+static void Replay_VertexAttrib4Nbv (Call &call)
+{
+    VertexAttrib4Nbv (call.Value<GLuint> (0), call.Pointer<const GLbyte *> (1));
+}
+
+static void Replay_VertexAttrib4Niv (Call &call)
+{
+    VertexAttrib4Niv (call.Value<GLuint> (0), call.Pointer<const GLint *> (1));
+}
+
+static void Replay_VertexAttrib4Nsv (Call &call)
+{
+    VertexAttrib4Nsv (call.Value<GLuint> (0), call.Pointer<const GLshort *> (1));
+}
+
+static void Replay_VertexAttrib4Nub (Call &call)
+{
+    VertexAttrib4Nub (call.Value<GLuint> (0), call.Value<GLubyte> (1), call.Value<GLubyte> (2), call.Value<GLubyte> (3), call.Value<GLubyte> (4));
+}
+
+static void Replay_VertexAttrib4Nubv (Call &call)
+{
+    VertexAttrib4Nubv (call.Value<GLuint> (0), call.Pointer<const GLubyte *> (1));
+}
+
+static void Replay_VertexAttrib4Nuiv (Call &call)
+{
+    VertexAttrib4Nuiv (call.Value<GLuint> (0), call.Pointer<const GLuint *> (1));
+}
+
+static void Replay_VertexAttrib4Nusv (Call &call)
+{
+    VertexAttrib4Nusv (call.Value<GLuint> (0), call.Pointer<const GLushort *> (1));
+}
+
+static void Replay_VertexAttrib4bv (Call &call)
+{
+    VertexAttrib4bv (call.Value<GLuint> (0), call.Pointer<const GLbyte *> (1));
+}
+
+static void Replay_VertexAttrib4d (Call &call)
+{
+    VertexAttrib4d (call.Value<GLuint> (0), call.Value<GLdouble> (1), call.Value<GLdouble> (2), call.Value<GLdouble> (3), call.Value<GLdouble> (4));
+}
+
+static void Replay_VertexAttrib4dv (Call &call)
+{
+    VertexAttrib4dv (call.Value<GLuint> (0), call.Pointer<const GLdouble *> (1));
+}
+
+static void Replay_VertexAttrib4f (Call &call)
+{
+    VertexAttrib4f (call.Value<GLuint> (0), call.Value<GLfloat> (1), call.Value<GLfloat> (2), call.Value<GLfloat> (3), call.Value<GLfloat> (4));
+}
+
+static void Replay_VertexAttrib4fv (Call &call)
+{
+    VertexAttrib4fv (call.Value<GLuint> (0), call.Pointer<const GLfloat *> (1));
+}
+
+static void Replay_VertexAttrib4iv (Call &call)
+{
+    VertexAttrib4iv (call.Value<GLuint> (0), call.Pointer<const GLint *> (1));
+}
+
+static void Replay_VertexAttrib4s (Call &call)
+{
+    VertexAttrib4s (call.Value<GLuint> (0), call.Value<GLshort> (1), call.Value<GLshort> (2), call.Value<GLshort> (3), call.Value<GLshort> (4));
+}
+
+static void Replay_VertexAttrib4sv (Call &call)
+{
+    VertexAttrib4sv (call.Value<GLuint> (0), call.Pointer<const GLshort *> (1));
+}
+
+static void Replay_VertexAttrib4ubv (Call &call)
+{
+    VertexAttrib4ubv (call.Value<GLuint> (0), call.Pointer<const GLubyte *> (1));
+}
+
+static void Replay_VertexAttrib4uiv (Call &call)
+{
+    VertexAttrib4uiv (call.Value<GLuint> (0), call.Pointer<const GLuint *> (1));
+}
+
+static void Replay_VertexAttrib4usv (Call &call)
+{
+    VertexAttrib4usv (call.Value<GLuint> (0), call.Pointer<const GLushort *> (1));
+}
+
+static void Replay_VertexAttribPointer (Call &call)
+{
+    VertexAttribPointer (call.Value<GLuint> (0), call.Value<GLint> (1), call.Value<GLenum> (2), call.Value<GLboolean> (3), call.Value<GLsizei> (4), call.Pointer<const void *> (5));
+}
+
+static void Replay_UniformMatrix2x3fv (Call &call)
+{
+    UniformMatrix2x3fv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Value<GLboolean> (2), call.Pointer<const GLfloat *> (3));
+}
+
+static void Replay_UniformMatrix3x2fv (Call &call)
+{
+    UniformMatrix3x2fv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Value<GLboolean> (2), call.Pointer<const GLfloat *> (3));
+}
+
+static void Replay_UniformMatrix2x4fv (Call &call)
+{
+    UniformMatrix2x4fv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Value<GLboolean> (2), call.Pointer<const GLfloat *> (3));
+}
+
+static void Replay_UniformMatrix4x2fv (Call &call)
+{
+    UniformMatrix4x2fv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Value<GLboolean> (2), call.Pointer<const GLfloat *> (3));
+}
+
+static void Replay_UniformMatrix3x4fv (Call &call)
+{
+    UniformMatrix3x4fv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Value<GLboolean> (2), call.Pointer<const GLfloat *> (3));
+}
+
+static void Replay_UniformMatrix4x3fv (Call &call)
+{
+    UniformMatrix4x3fv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Value<GLboolean> (2), call.Pointer<const GLfloat *> (3));
+}
+
+static void Replay_ColorMaski (Call &call)
+{
+    ColorMaski (call.Value<GLuint> (0), call.Value<GLboolean> (1), call.Value<GLboolean> (2), call.Value<GLboolean> (3), call.Value<GLboolean> (4));
+}
+
+static void Replay_GetBooleani_v (Call &call)
+{
+    GetBooleani_v (call.Value<GLenum> (0), call.Value<GLuint> (1), call.Output<GLboolean *> (2));
+}
+
+static void Replay_GetIntegeri_v (Call &call)
+{
+    GetIntegeri_v (call.Value<GLenum> (0), call.Value<GLuint> (1), call.Output<GLint *> (2));
+}
+
+static void Replay_Enablei (Call &call)
+{
+    Enablei (call.Value<GLenum> (0), call.Value<GLuint> (1));
+}
+
+static void Replay_Disablei (Call &call)
+{
+    Disablei (call.Value<GLenum> (0), call.Value<GLuint> (1));
+}
+
+static void Replay_IsEnabledi (Call &call)
+{
+    IsEnabledi (call.Value<GLenum> (0), call.Value<GLuint> (1));
+}
+
+static void Replay_BeginTransformFeedback (Call &call)
+{
+    BeginTransformFeedback (call.Value<GLenum> (0));
+}
+
+static void Replay_EndTransformFeedback (Call &call)
+{
+    (void) call;
+    EndTransformFeedback ();
+}
+
+static void Replay_BindBufferRange (Call &call)
+{
+    BindBufferRange (call.Value<GLenum> (0), call.Value<GLuint> (1), call.Object (2, ObjectBuffer), call.Value<GLintptr> (3), call.Value<GLsizeiptr> (4));
+}
+
+static void Replay_BindBufferBase (Call &call)
+{
+    BindBufferBase (call.Value<GLenum> (0), call.Value<GLuint> (1), call.Object (2, ObjectBuffer));
+}
+
+static void Replay_TransformFeedbackVaryings (Call &call)
+{
+    TransformFeedbackVaryings (call.Object (0, ObjectProgram), call.Value<GLsizei> (1), call.Strings (2), call.Value<GLenum> (3));
+}
+
+static void Replay_GetTransformFeedbackVarying (Call &call)
+{
+    GetTransformFeedbackVarying (call.Object (0, ObjectProgram), call.Value<GLuint> (1), call.Value<GLsizei> (2), call.Output<GLsizei *> (3), call.Output<GLsizei *> (4), call.Output<GLenum *> (5), call.Output<GLchar *> (6));
+}
+
+static void Replay_ClampColor (Call &call)
+{
+    ClampColor (call.Value<GLenum> (0), call.Value<GLenum> (1));
+}
+
+static void Replay_BeginConditionalRender (Call &call)
+{
+    BeginConditionalRender (call.Value<GLuint> (0), call.Value<GLenum> (1));
+}
+
+static void Replay_EndConditionalRender (Call &call)
+{
+    (void) call;
+    EndConditionalRender ();
+}
+
+static void Replay_VertexAttribIPointer (Call &call)
+{
+    VertexAttribIPointer (call.Value<GLuint> (0), call.Value<GLint> (1), call.Value<GLenum> (2), call.Value<GLsizei> (3), call.Pointer<const void *> (4));
+}
+
+static void Replay_GetVertexAttribIiv (Call &call)
+{
+    GetVertexAttribIiv (call.Value<GLuint> (0), call.Value<GLenum> (1), call.Output<GLint *> (2));
+}
+
+static void Replay_GetVertexAttribIuiv (Call &call)
+{
+    GetVertexAttribIuiv (call.Value<GLuint> (0), call.Value<GLenum> (1), call.Output<GLuint *> (2));
+}
+
+static void Replay_VertexAttribI1i (Call &call)
+{
+    VertexAttribI1i (call.Value<GLuint> (0), call.Value<GLint> (1));
+}
+
+static void Replay_VertexAttribI2i (Call &call)
+{
+    VertexAttribI2i (call.Value<GLuint> (0), call.Value<GLint> (1), call.Value<GLint> (2));
+}
+
+static void Replay_VertexAttribI3i (Call &call)
+{
+    VertexAttribI3i (call.Value<GLuint> (0), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLint> (3));
+}
+
+static void Replay_VertexAttribI4i (Call &call)
+{
+    VertexAttribI4i (call.Value<GLuint> (0), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLint> (3), call.Value<GLint> (4));
+}
+
+static void Replay_VertexAttribI1ui (Call &call)
+{
+    VertexAttribI1ui (call.Value<GLuint> (0), call.Value<GLuint> (1));
+}
+
+static void Replay_VertexAttribI2ui (Call &call)
+{
+    VertexAttribI2ui (call.Value<GLuint> (0), call.Value<GLuint> (1), call.Value<GLuint> (2));
+}
+
+static void Replay_VertexAttribI3ui (Call &call)
+{
+    VertexAttribI3ui (call.Value<GLuint> (0), call.Value<GLuint> (1), call.Value<GLuint> (2), call.Value<GLuint> (3));
+}
+
+static void Replay_VertexAttribI4ui (Call &call)
+{
+    VertexAttribI4ui (call.Value<GLuint> (0), call.Value<GLuint> (1), call.Value<GLuint> (2), call.Value<GLuint> (3), call.Value<GLuint> (4));
+}
+
+static void Replay_VertexAttribI1iv (Call &call)
+{
+    VertexAttribI1iv (call.Value<GLuint> (0), call.Pointer<const GLint *> (1));
+}
+
+static void Replay_VertexAttribI2iv (Call &call)
+{
+    VertexAttribI2iv (call.Value<GLuint> (0), call.Pointer<const GLint *> (1));
+}
+
+static void Replay_VertexAttribI3iv (Call &call)
+{
+    VertexAttribI3iv (call.Value<GLuint> (0), call.Pointer<const GLint *> (1));
+}
+
+static void Replay_VertexAttribI4iv (Call &call)
+{
+    VertexAttribI4iv (call.Value<GLuint> (0), call.Pointer<const GLint *> (1));
+}
+
+static void Replay_VertexAttribI1uiv (Call &call)
+{
+    VertexAttribI1uiv (call.Value<GLuint> (0), call.Pointer<const GLuint *> (1));
+}
+
+static void Replay_VertexAttribI2uiv (Call &call)
+{
+    VertexAttribI2uiv (call.Value<GLuint> (0), call.Pointer<const GLuint *> (1));
+}
+
+static void Replay_VertexAttribI3uiv (Call &call)
+{
+    VertexAttribI3uiv (call.Value<GLuint> (0), call.Pointer<const GLuint *> (1));
+}
+
+static void Replay_VertexAttribI4uiv (Call &call)
+{
+    VertexAttribI4uiv (call.Value<GLuint> (0), call.Pointer<const GLuint *> (1));
+}
+
+static void Replay_VertexAttribI4bv (Call &call)
+{
+    VertexAttribI4bv (call.Value<GLuint> (0), call.Pointer<const GLbyte *> (1));
+}
+
+static void Replay_VertexAttribI4sv (Call &call)
+{
+    VertexAttribI4sv (call.Value<GLuint> (0), call.Pointer<const GLshort *> (1));
+}
+
+static void Replay_VertexAttribI4ubv (Call &call)
+{
+    VertexAttribI4ubv (call.Value<GLuint> (0), call.Pointer<const GLubyte *> (1));
+}
+
+static void Replay_VertexAttribI4usv (Call &call)
+{
+    VertexAttribI4usv (call.Value<GLuint> (0), call.Pointer<const GLushort *> (1));
+}
+
+static void Replay_GetUniformuiv (Call &call)
+{
+    GetUniformuiv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Output<GLuint *> (2));
+}
+
+static void Replay_BindFragDataLocation (Call &call)
+{
+    BindFragDataLocation (call.Object (0, ObjectProgram), call.Value<GLuint> (1), call.Pointer<const GLchar *> (2));
+}
+
+static void Replay_GetFragDataLocation (Call &call)
+{
+    GetFragDataLocation (call.Object (0, ObjectProgram), call.Pointer<const GLchar *> (1));
+}
+
+static void Replay_Uniform1ui (Call &call)
+{
+    Uniform1ui (call.Value<GLint> (0), call.Value<GLuint> (1));
+}
+
+static void Replay_Uniform2ui (Call &call)
+{
+    Uniform2ui (call.Value<GLint> (0), call.Value<GLuint> (1), call.Value<GLuint> (2));
+}
+
+static void Replay_Uniform3ui (Call &call)
+{
+    Uniform3ui (call.Value<GLint> (0), call.Value<GLuint> (1), call.Value<GLuint> (2), call.Value<GLuint> (3));
+}
+
+static void Replay_Uniform4ui (Call &call)
+{
+    Uniform4ui (call.Value<GLint> (0), call.Value<GLuint> (1), call.Value<GLuint> (2), call.Value<GLuint> (3), call.Value<GLuint> (4));
+}
+
+static void Replay_Uniform1uiv (Call &call)
+{
+    Uniform1uiv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Pointer<const GLuint *> (2));
+}
+
+static void Replay_Uniform2uiv (Call &call)
+{
+    Uniform2uiv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Pointer<const GLuint *> (2));
+}
+
+static void Replay_Uniform3uiv (Call &call)
+{
+    Uniform3uiv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Pointer<const GLuint *> (2));
+}
+
+static void Replay_Uniform4uiv (Call &call)
+{
+    Uniform4uiv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Pointer<const GLuint *> (2));
+}
+
+static void Replay_TexParameterIiv (Call &call)
+{
+    TexParameterIiv (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Pointer<const GLint *> (2));
+}
+
+static void Replay_TexParameterIuiv (Call &call)
+{
+    TexParameterIuiv (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Pointer<const GLuint *> (2));
+}
+
+static void Replay_GetTexParameterIiv (Call &call)
+{
+    GetTexParameterIiv (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Output<GLint *> (2));
+}
+
+static void Replay_GetTexParameterIuiv (Call &call)
+{
+    GetTexParameterIuiv (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Output<GLuint *> (2));
+}
+
+static void Replay_ClearBufferiv (Call &call)
+{
+    ClearBufferiv (call.Value<GLenum> (0), call.Value<GLint> (1), call.Pointer<const GLint *> (2));
+}
+
+static void Replay_ClearBufferuiv (Call &call)
+{
+    ClearBufferuiv (call.Value<GLenum> (0), call.Value<GLint> (1), call.Pointer<const GLuint *> (2));
+}
+
+static void Replay_ClearBufferfv (Call &call)
+{
+    ClearBufferfv (call.Value<GLenum> (0), call.Value<GLint> (1), call.Pointer<const GLfloat *> (2));
+}
+
+static void Replay_ClearBufferfi (Call &call)
+{
+    ClearBufferfi (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLfloat> (2), call.Value<GLint> (3));
+}
+
+static void Replay_GetStringi (Call &call)
+{
+    GetStringi (call.Value<GLenum> (0), call.Value<GLuint> (1));
+}
+
+static void Replay_IsRenderbuffer (Call &call)
+{
+    IsRenderbuffer (call.Object (0, ObjectRenderbuffer));
+}
+
+static void Replay_BindRenderbuffer (Call &call)
+{
+    BindRenderbuffer (call.Value<GLenum> (0), call.Object (1, ObjectRenderbuffer));
+}
+
+static void Replay_DeleteRenderbuffers (Call &call)
+{
+    DeleteRenderbuffers (call.Value<GLsizei> (0), call.Objects (1, ObjectRenderbuffer));
+}
+
+static void Replay_GenRenderbuffers (Call &call)
+{
+    GenRenderbuffers (call.Value<GLsizei> (0), call.Output<GLuint *> (1));
+    call.MapObjects (1, ObjectRenderbuffer);
+}
+
+static void Replay_RenderbufferStorage (Call &call)
+{
+    RenderbufferStorage (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Value<GLsizei> (2), call.Value<GLsizei> (3));
+}
+
+static void Replay_GetRenderbufferParameteriv (Call &call)
+{
+    GetRenderbufferParameteriv (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Output<GLint *> (2));
+}
+
+static void Replay_IsFramebuffer (Call &call)
+{
+    IsFramebuffer (call.Object (0, ObjectFramebuffer));
+}
+
+static void Replay_BindFramebuffer (Call &call)
+{
+    BindFramebuffer (call.Value<GLenum> (0), call.Object (1, ObjectFramebuffer));
+}
+
+static void Replay_DeleteFramebuffers (Call &call)
+{
+    DeleteFramebuffers (call.Value<GLsizei> (0), call.Objects (1, ObjectFramebuffer));
+}
+
+static void Replay_GenFramebuffers (Call &call)
+{
+    GenFramebuffers (call.Value<GLsizei> (0), call.Output<GLuint *> (1));
+    call.MapObjects (1, ObjectFramebuffer);
+}
+
+static void Replay_CheckFramebufferStatus (Call &call)
+{
+    CheckFramebufferStatus (call.Value<GLenum> (0));
+}
+
+static void Replay_FramebufferTexture1D (Call &call)
+{
+    FramebufferTexture1D (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Value<GLenum> (2), call.Object (3, ObjectTexture), call.Value<GLint> (4));
+}
+
+static void Replay_FramebufferTexture2D (Call &call)
+{
+    FramebufferTexture2D (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Value<GLenum> (2), call.Object (3, ObjectTexture), call.Value<GLint> (4));
+}
+
+static void Replay_FramebufferTexture3D (Call &call)
+{
+    FramebufferTexture3D (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Value<GLenum> (2), call.Object (3, ObjectTexture), call.Value<GLint> (4), call.Value<GLint> (5));
+}
+
+static void Replay_FramebufferRenderbuffer (Call &call)
+{
+    FramebufferRenderbuffer (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Value<GLenum> (2), call.Object (3, ObjectRenderbuffer));
+}
+
+static void Replay_GetFramebufferAttachmentParameteriv (Call &call)
+{
+    GetFramebufferAttachmentParameteriv (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Value<GLenum> (2), call.Output<GLint *> (3));
+}
+
+static void Replay_GenerateMipmap (Call &call)
+{
+    GenerateMipmap (call.Value<GLenum> (0));
+}
+
+static void Replay_BlitFramebuffer (Call &call)
+{
+    BlitFramebuffer (call.Value<GLint> (0), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLint> (3), call.Value<GLint> (4), call.Value<GLint> (5), call.Value<GLint> (6), call.Value<GLint> (7), call.Value<GLbitfield> (8), call.Value<GLenum> (9));
+}
+
+static void Replay_RenderbufferStorageMultisample (Call &call)
+{
+    RenderbufferStorageMultisample (call.Value<GLenum> (0), call.Value<GLsizei> (1), call.Value<GLenum> (2), call.Value<GLsizei> (3), call.Value<GLsizei> (4));
+}
+
+static void Replay_FramebufferTextureLayer (Call &call)
+{
+    FramebufferTextureLayer (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Object (2, ObjectTexture), call.Value<GLint> (3), call.Value<GLint> (4));
+}
+
+static void Replay_MapBufferRange (Call &call)
+{
+    MapBufferRange (call.Value<GLenum> (0), call.Value<GLintptr> (1), call.Value<GLsizeiptr> (2), call.Value<GLbitfield> (3));
+}
+
+static void Replay_FlushMappedBufferRange (Call &call)
+{
+    FlushMappedBufferRange (call.Value<GLenum> (0), call.Value<GLintptr> (1), call.Value<GLsizeiptr> (2));
+}
+
+static void Replay_BindVertexArray (Call &call)
+{
+    BindVertexArray (call.Object (0, ObjectVertexArray));
+}
+
+static void Replay_DeleteVertexArrays (Call &call)
+{
+    DeleteVertexArrays (call.Value<GLsizei> (0), call.Objects (1, ObjectVertexArray));
+}
+
+static void Replay_GenVertexArrays (Call &call)
+{
+    GenVertexArrays (call.Value<GLsizei> (0), call.Output<GLuint *> (1));
+    call.MapObjects (1, ObjectVertexArray);
+}
+
+static void Replay_IsVertexArray (Call &call)
+{
+    IsVertexArray (call.Object (0, ObjectVertexArray));
+}
+
+static void Replay_DrawArraysInstanced (Call &call)
+{
+    DrawArraysInstanced (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLsizei> (2), call.Value<GLsizei> (3));
+}
+
+static void Replay_DrawElementsInstanced (Call &call)
+{
+    DrawElementsInstanced (call.Value<GLenum> (0), call.Value<GLsizei> (1), call.Value<GLenum> (2), call.Pointer<const void *> (3), call.Value<GLsizei> (4));
+}
+
+static void Replay_TexBuffer (Call &call)
+{
+    TexBuffer (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Object (2, ObjectBuffer));
+}
+
+static void Replay_PrimitiveRestartIndex (Call &call)
+{
+    PrimitiveRestartIndex (call.Value<GLuint> (0));
+}
+
+static void Replay_CopyBufferSubData (Call &call)
+{
+    CopyBufferSubData (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Value<GLintptr> (2), call.Value<GLintptr> (3), call.Value<GLsizeiptr> (4));
+}
+
+static void Replay_GetUniformIndices (Call &call)
+{
+    GetUniformIndices (call.Object (0, ObjectProgram), call.Value<GLsizei> (1), call.Strings (2), call.Output<GLuint *> (3));
+}
+
+static void Replay_GetActiveUniformsiv (Call &call)
+{
+    GetActiveUniformsiv (call.Object (0, ObjectProgram), call.Value<GLsizei> (1), call.Pointer<const GLuint *> (2), call.Value<GLenum> (3), call.Output<GLint *> (4));
+}
+
+static void Replay_GetActiveUniformName (Call &call)
+{
+    GetActiveUniformName (call.Object (0, ObjectProgram), call.Value<GLuint> (1), call.Value<GLsizei> (2), call.Output<GLsizei *> (3), call.Output<GLchar *> (4));
+}
+
+static void Replay_GetUniformBlockIndex (Call &call)
+{
+    GetUniformBlockIndex (call.Object (0, ObjectProgram), call.Pointer<const GLchar *> (1));
+}
+
+static void Replay_GetActiveUniformBlockiv (Call &call)
+{
+    GetActiveUniformBlockiv (call.Object (0, ObjectProgram), call.Value<GLuint> (1), call.Value<GLenum> (2), call.Output<GLint *> (3));
+}
+
+static void Replay_GetActiveUniformBlockName (Call &call)
+{
+    GetActiveUniformBlockName (call.Object (0, ObjectProgram), call.Value<GLuint> (1), call.Value<GLsizei> (2), call.Output<GLsizei *> (3), call.Output<GLchar *> (4));
+}
+
+static void Replay_UniformBlockBinding (Call &call)
+{
+    UniformBlockBinding (call.Object (0, ObjectProgram), call.Value<GLuint> (1), call.Value<GLuint> (2));
+}
+
+static void Replay_DrawElementsBaseVertex (Call &call)
+{
+    DrawElementsBaseVertex (call.Value<GLenum> (0), call.Value<GLsizei> (1), call.Value<GLenum> (2), call.Pointer<const void *> (3), call.Value<GLint> (4));
+}
+
+static void Replay_DrawRangeElementsBaseVertex (Call &call)
+{
+    DrawRangeElementsBaseVertex (call.Value<GLenum> (0), call.Value<GLuint> (1), call.Value<GLuint> (2), call.Value<GLsizei> (3), call.Value<GLenum> (4), call.Pointer<const void *> (5), call.Value<GLint> (6));
+}
+
+static void Replay_DrawElementsInstancedBaseVertex (Call &call)
+{
+    DrawElementsInstancedBaseVertex (call.Value<GLenum> (0), call.Value<GLsizei> (1), call.Value<GLenum> (2), call.Pointer<const void *> (3), call.Value<GLsizei> (4), call.Value<GLint> (5));
+}
+
+static void Replay_MultiDrawElementsBaseVertex (Call &call)
+{
+    MultiDrawElementsBaseVertex (call.Value<GLenum> (0), call.Pointer<const GLsizei *> (1), call.Value<GLenum> (2), call.Pointer<const void *const*> (3), call.Value<GLsizei> (4), call.Pointer<const GLint *> (5));
+}
+
+static void Replay_ProvokingVertex (Call &call)
+{
+    ProvokingVertex (call.Value<GLenum> (0));
+}
+
+static void Replay_FenceSync (Call &call)
+{
+    GLsync result = FenceSync (call.Value<GLenum> (0), call.Value<GLbitfield> (1));
+    call.MapSync (result);
+}
+
+static void Replay_IsSync (Call &call)
+{
+    IsSync (call.Sync (0));
+}
+
+static void Replay_DeleteSync (Call &call)
+{
+    DeleteSync (call.Sync (0));
+}
+
+static void Replay_ClientWaitSync (Call &call)
+{
+    ClientWaitSync (call.Sync (0), call.Value<GLbitfield> (1), call.Value<GLuint64> (2));
+}
+
+static void Replay_WaitSync (Call &call)
+{
+    WaitSync (call.Sync (0), call.Value<GLbitfield> (1), call.Value<GLuint64> (2));
+}
+
+static void Replay_GetInteger64v (Call &call)
+{
+    GetInteger64v (call.Value<GLenum> (0), call.Output<GLint64 *> (1));
+}
+
+static void Replay_GetSynciv (Call &call)
+{
+    GetSynciv (call.Sync (0), call.Value<GLenum> (1), call.Value<GLsizei> (2), call.Output<GLsizei *> (3), call.Output<GLint *> (4));
+}
+
+static void Replay_GetInteger64i_v (Call &call)
+{
+    GetInteger64i_v (call.Value<GLenum> (0), call.Value<GLuint> (1), call.Output<GLint64 *> (2));
+}
+
+static void Replay_GetBufferParameteri64v (Call &call)
+{
+    GetBufferParameteri64v (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Output<GLint64 *> (2));
+}
+
+static void Replay_FramebufferTexture (Call &call)
+{
+    FramebufferTexture (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Object (2, ObjectTexture), call.Value<GLint> (3));
+}
+
+static void Replay_TexImage2DMultisample (Call &call)
+{
+    TexImage2DMultisample (call.Value<GLenum> (0), call.Value<GLsizei> (1), call.Value<GLenum> (2), call.Value<GLsizei> (3), call.Value<GLsizei> (4), call.Value<GLboolean> (5));
+}
+
+static void Replay_TexImage3DMultisample (Call &call)
+{
+    TexImage3DMultisample (call.Value<GLenum> (0), call.Value<GLsizei> (1), call.Value<GLenum> (2), call.Value<GLsizei> (3), call.Value<GLsizei> (4), call.Value<GLsizei> (5), call.Value<GLboolean> (6));
+}
+
+static void Replay_GetMultisamplefv (Call &call)
+{
+    GetMultisamplefv (call.Value<GLenum> (0), call.Value<GLuint> (1), call.Output<GLfloat *> (2));
+}
+
+static void Replay_SampleMaski (Call &call)
+{
+    SampleMaski (call.Value<GLuint> (0), call.Value<GLbitfield> (1));
+}
+
+static void Replay_BindFragDataLocationIndexed (Call &call)
+{
+    BindFragDataLocationIndexed (call.Object (0, ObjectProgram), call.Value<GLuint> (1), call.Value<GLuint> (2), call.Pointer<const GLchar *> (3));
+}
+
+static void Replay_GetFragDataIndex (Call &call)
+{
+    GetFragDataIndex (call.Object (0, ObjectProgram), call.Pointer<const GLchar *> (1));
+}
+
+static void Replay_GenSamplers (Call &call)
+{
+    GenSamplers (call.Value<GLsizei> (0), call.Output<GLuint *> (1));
+    call.MapObjects (1, ObjectSampler);
+}
+
+static void Replay_DeleteSamplers (Call &call)
+{
+    DeleteSamplers (call.Value<GLsizei> (0), call.Objects (1, ObjectSampler));
+}
+
+static void Replay_IsSampler (Call &call)
+{
+    IsSampler (call.Object (0, ObjectSampler));
+}
+
+static void Replay_BindSampler (Call &call)
+{
+    BindSampler (call.Value<GLuint> (0), call.Object (1, ObjectSampler));
+}
+
+static void Replay_SamplerParameteri (Call &call)
+{
+    SamplerParameteri (call.Object (0, ObjectSampler), call.Value<GLenum> (1), call.Value<GLint> (2));
+}
+
+static void Replay_SamplerParameteriv (Call &call)
+{
+    SamplerParameteriv (call.Object (0, ObjectSampler), call.Value<GLenum> (1), call.Pointer<const GLint *> (2));
+}
+
+static void Replay_SamplerParameterf (Call &call)
+{
+    SamplerParameterf (call.Object (0, ObjectSampler), call.Value<GLenum> (1), call.Value<GLfloat> (2));
+}
+
+static void Replay_SamplerParameterfv (Call &call)
+{
+    SamplerParameterfv (call.Object (0, ObjectSampler), call.Value<GLenum> (1), call.Pointer<const GLfloat *> (2));
+}
+
+static void Replay_SamplerParameterIiv (Call &call)
+{
+    SamplerParameterIiv (call.Object (0, ObjectSampler), call.Value<GLenum> (1), call.Pointer<const GLint *> (2));
+}
+
+static void Replay_SamplerParameterIuiv (Call &call)
+{
+    SamplerParameterIuiv (call.Object (0, ObjectSampler), call.Value<GLenum> (1), call.Pointer<const GLuint *> (2));
+}
+
+static void Replay_GetSamplerParameteriv (Call &call)
+{
+    GetSamplerParameteriv (call.Object (0, ObjectSampler), call.Value<GLenum> (1), call.Output<GLint *> (2));
+}
+
+static void Replay_GetSamplerParameterIiv (Call &call)
+{
+    GetSamplerParameterIiv (call.Object (0, ObjectSampler), call.Value<GLenum> (1), call.Output<GLint *> (2));
+}
+
+static void Replay_GetSamplerParameterfv (Call &call)
+{
+    GetSamplerParameterfv (call.Object (0, ObjectSampler), call.Value<GLenum> (1), call.Output<GLfloat *> (2));
+}
+
+static void Replay_GetSamplerParameterIuiv (Call &call)
+{
+    GetSamplerParameterIuiv (call.Object (0, ObjectSampler), call.Value<GLenum> (1), call.Output<GLuint *> (2));
+}
+
+static void Replay_QueryCounter (Call &call)
+{
+    QueryCounter (call.Object (0, ObjectQuery), call.Value<GLenum> (1));
+}
+
+static void Replay_GetQueryObjecti64v (Call &call)
+{
+    GetQueryObjecti64v (call.Object (0, ObjectQuery), call.Value<GLenum> (1), call.Output<GLint64 *> (2));
+}
+
+static void Replay_GetQueryObjectui64v (Call &call)
+{
+    GetQueryObjectui64v (call.Object (0, ObjectQuery), call.Value<GLenum> (1), call.Output<GLuint64 *> (2));
+}
+
+static void Replay_VertexAttribDivisor (Call &call)
+{
+    VertexAttribDivisor (call.Value<GLuint> (0), call.Value<GLuint> (1));
+}
+
+static void Replay_VertexAttribP1ui (Call &call)
+{
+    VertexAttribP1ui (call.Value<GLuint> (0), call.Value<GLenum> (1), call.Value<GLboolean> (2), call.Value<GLuint> (3));
+}
+
+static void Replay_VertexAttribP1uiv (Call &call)
+{
+    VertexAttribP1uiv (call.Value<GLuint> (0), call.Value<GLenum> (1), call.Value<GLboolean> (2), call.Pointer<const GLuint *> (3));
+}
+
+static void Replay_VertexAttribP2ui (Call &call)
+{
+    VertexAttribP2ui (call.Value<GLuint> (0), call.Value<GLenum> (1), call.Value<GLboolean> (2), call.Value<GLuint> (3));
+}
+
+static void Replay_VertexAttribP2uiv (Call &call)
+{
+    VertexAttribP2uiv (call.Value<GLuint> (0), call.Value<GLenum> (1), call.Value<GLboolean> (2), call.Pointer<const GLuint *> (3));
+}
+
+static void Replay_VertexAttribP3ui (Call &call)
+{
+    VertexAttribP3ui (call.Value<GLuint> (0), call.Value<GLenum> (1), call.Value<GLboolean> (2), call.Value<GLuint> (3));
+}
+
+static void Replay_VertexAttribP3uiv (Call &call)
+{
+    VertexAttribP3uiv (call.Value<GLuint> (0), call.Value<GLenum> (1), call.Value<GLboolean> (2), call.Pointer<const GLuint *> (3));
+}
+
+static void Replay_VertexAttribP4ui (Call &call)
+{
+    VertexAttribP4ui (call.Value<GLuint> (0), call.Value<GLenum> (1), call.Value<GLboolean> (2), call.Value<GLuint> (3));
+}
+
+static void Replay_VertexAttribP4uiv (Call &call)
+{
+    VertexAttribP4uiv (call.Value<GLuint> (0), call.Value<GLenum> (1), call.Value<GLboolean> (2), call.Pointer<const GLuint *> (3));
+}
+
+static void Replay_MinSampleShading (Call &call)
+{
+    MinSampleShading (call.Value<GLfloat> (0));
+}
+
+static void Replay_BlendEquationi (Call &call)
+{
+    BlendEquationi (call.Value<GLuint> (0), call.Value<GLenum> (1));
+}
+
+static void Replay_BlendEquationSeparatei (Call &call)
+{
+    BlendEquationSeparatei (call.Value<GLuint> (0), call.Value<GLenum> (1), call.Value<GLenum> (2));
+}
+
+static void Replay_BlendFunci (Call &call)
+{
+    BlendFunci (call.Value<GLuint> (0), call.Value<GLenum> (1), call.Value<GLenum> (2));
+}
+
+static void Replay_BlendFuncSeparatei (Call &call)
+{
+    BlendFuncSeparatei (call.Value<GLuint> (0), call.Value<GLenum> (1), call.Value<GLenum> (2), call.Value<GLenum> (3), call.Value<GLenum> (4));
+}
+
+static void Replay_DrawArraysIndirect (Call &call)
+{
+    DrawArraysIndirect (call.Value<GLenum> (0), call.Pointer<const void *> (1));
+}
+
+static void Replay_DrawElementsIndirect (Call &call)
+{
+    DrawElementsIndirect (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Pointer<const void *> (2));
+}
+
+static void Replay_Uniform1d (Call &call)
+{
+    Uniform1d (call.Value<GLint> (0), call.Value<GLdouble> (1));
+}
+
+static void Replay_Uniform2d (Call &call)
+{
+    Uniform2d (call.Value<GLint> (0), call.Value<GLdouble> (1), call.Value<GLdouble> (2));
+}
+
+static void Replay_Uniform3d (Call &call)
+{
+    Uniform3d (call.Value<GLint> (0), call.Value<GLdouble> (1), call.Value<GLdouble> (2), call.Value<GLdouble> (3));
+}
+
+static void Replay_Uniform4d (Call &call)
+{
+    Uniform4d (call.Value<GLint> (0), call.Value<GLdouble> (1), call.Value<GLdouble> (2), call.Value<GLdouble> (3), call.Value<GLdouble> (4));
+}
+
+static void Replay_Uniform1dv (Call &call)
+{
+    Uniform1dv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Pointer<const GLdouble *> (2));
+}
+
+static void Replay_Uniform2dv (Call &call)
+{
+    Uniform2dv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Pointer<const GLdouble *> (2));
+}
+
+static void Replay_Uniform3dv (Call &call)
+{
+    Uniform3dv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Pointer<const GLdouble *> (2));
+}
+
+static void Replay_Uniform4dv (Call &call)
+{
+    Uniform4dv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Pointer<const GLdouble *> (2));
+}
+
+static void Replay_UniformMatrix2dv (Call &call)
+{
+    UniformMatrix2dv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Value<GLboolean> (2), call.Pointer<const GLdouble *> (3));
+}
+
+static void Replay_UniformMatrix3dv (Call &call)
+{
+    UniformMatrix3dv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Value<GLboolean> (2), call.Pointer<const GLdouble *> (3));
+}
+
+static void Replay_UniformMatrix4dv (Call &call)
+{
+    UniformMatrix4dv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Value<GLboolean> (2), call.Pointer<const GLdouble *> (3));
+}
+
+static void Replay_UniformMatrix2x3dv (Call &call)
+{
+    UniformMatrix2x3dv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Value<GLboolean> (2), call.Pointer<const GLdouble *> (3));
+}
+
+static void Replay_UniformMatrix2x4dv (Call &call)
+{
+    UniformMatrix2x4dv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Value<GLboolean> (2), call.Pointer<const GLdouble *> (3));
+}
+
+static void Replay_UniformMatrix3x2dv (Call &call)
+{
+    UniformMatrix3x2dv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Value<GLboolean> (2), call.Pointer<const GLdouble *> (3));
+}
+
+static void Replay_UniformMatrix3x4dv (Call &call)
+{
+    UniformMatrix3x4dv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Value<GLboolean> (2), call.Pointer<const GLdouble *> (3));
+}
+
+static void Replay_UniformMatrix4x2dv (Call &call)
+{
+    UniformMatrix4x2dv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Value<GLboolean> (2), call.Pointer<const GLdouble *> (3));
+}
+
+static void Replay_UniformMatrix4x3dv (Call &call)
+{
+    UniformMatrix4x3dv (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Value<GLboolean> (2), call.Pointer<const GLdouble *> (3));
+}
+
+static void Replay_GetUniformdv (Call &call)
+{
+    GetUniformdv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Output<GLdouble *> (2));
+}
+
+static void Replay_GetSubroutineUniformLocation (Call &call)
+{
+    GetSubroutineUniformLocation (call.Object (0, ObjectProgram), call.Value<GLenum> (1), call.Pointer<const GLchar *> (2));
+}
+
+static void Replay_GetSubroutineIndex (Call &call)
+{
+    GetSubroutineIndex (call.Object (0, ObjectProgram), call.Value<GLenum> (1), call.Pointer<const GLchar *> (2));
+}
+
+static void Replay_GetActiveSubroutineUniformiv (Call &call)
+{
+    GetActiveSubroutineUniformiv (call.Object (0, ObjectProgram), call.Value<GLenum> (1), call.Value<GLuint> (2), call.Value<GLenum> (3), call.Output<GLint *> (4));
+}
+
+static void Replay_GetActiveSubroutineUniformName (Call &call)
+{
+    GetActiveSubroutineUniformName (call.Object (0, ObjectProgram), call.Value<GLenum> (1), call.Value<GLuint> (2), call.Value<GLsizei> (3), call.Output<GLsizei *> (4), call.Output<GLchar *> (5));
+}
+
+static void Replay_GetActiveSubroutineName (Call &call)
+{
+    GetActiveSubroutineName (call.Object (0, ObjectProgram), call.Value<GLenum> (1), call.Value<GLuint> (2), call.Value<GLsizei> (3), call.Output<GLsizei *> (4), call.Output<GLchar *> (5));
+}
+
+static void Replay_UniformSubroutinesuiv (Call &call)
+{
+    UniformSubroutinesuiv (call.Value<GLenum> (0), call.Value<GLsizei> (1), call.Pointer<const GLuint *> (2));
+}
+
+static void Replay_GetUniformSubroutineuiv (Call &call)
+{
+    GetUniformSubroutineuiv (call.Value<GLenum> (0), call.Value<GLint> (1), call.Output<GLuint *> (2));
+}
+
+static void Replay_GetProgramStageiv (Call &call)
+{
+    GetProgramStageiv (call.Object (0, ObjectProgram), call.Value<GLenum> (1), call.Value<GLenum> (2), call.Output<GLint *> (3));
+}
+
+static void Replay_PatchParameteri (Call &call)
+{
+    PatchParameteri (call.Value<GLenum> (0), call.Value<GLint> (1));
+}
+
+static void Replay_PatchParameterfv (Call &call)
+{
+    PatchParameterfv (call.Value<GLenum> (0), call.Pointer<const GLfloat *> (1));
+}
+
+static void Replay_BindTransformFeedback (Call &call)
+{
+    BindTransformFeedback (call.Value<GLenum> (0), call.Object (1, ObjectTransformFeedback));
+}
+
+static void Replay_DeleteTransformFeedbacks (Call &call)
+{
+    DeleteTransformFeedbacks (call.Value<GLsizei> (0), call.Objects (1, ObjectTransformFeedback));
+}
+
+static void Replay_GenTransformFeedbacks (Call &call)
+{
+    GenTransformFeedbacks (call.Value<GLsizei> (0), call.Output<GLuint *> (1));
+    call.MapObjects (1, ObjectTransformFeedback);
+}
+
+static void Replay_IsTransformFeedback (Call &call)
+{
+    IsTransformFeedback (call.Object (0, ObjectTransformFeedback));
+}
+
+static void Replay_PauseTransformFeedback (Call &call)
+{
+    (void) call;
+    PauseTransformFeedback ();
+}
+
+static void Replay_ResumeTransformFeedback (Call &call)
+{
+    (void) call;
+    ResumeTransformFeedback ();
+}
+
+static void Replay_DrawTransformFeedback (Call &call)
+{
+    DrawTransformFeedback (call.Value<GLenum> (0), call.Object (1, ObjectTransformFeedback));
+}
+
+static void Replay_DrawTransformFeedbackStream (Call &call)
+{
+    DrawTransformFeedbackStream (call.Value<GLenum> (0), call.Object (1, ObjectTransformFeedback), call.Value<GLuint> (2));
+}
+
+static void Replay_BeginQueryIndexed (Call &call)
+{
+    BeginQueryIndexed (call.Value<GLenum> (0), call.Value<GLuint> (1), call.Object (2, ObjectQuery));
+}
+
+static void Replay_EndQueryIndexed (Call &call)
+{
+    EndQueryIndexed (call.Value<GLenum> (0), call.Value<GLuint> (1));
+}
+
+static void Replay_GetQueryIndexediv (Call &call)
+{
+    GetQueryIndexediv (call.Value<GLenum> (0), call.Value<GLuint> (1), call.Value<GLenum> (2), call.Output<GLint *> (3));
+}
+
+static void Replay_ReleaseShaderCompiler (Call &call)
+{
+    (void) call;
+    ReleaseShaderCompiler ();
+}
+
+static void Replay_ShaderBinary (Call &call)
+{
+    ShaderBinary (call.Value<GLsizei> (0), call.Objects (1, ObjectShader), call.Value<GLenum> (2), call.Pointer<const void *> (3), call.Value<GLsizei> (4));
+}
+
+static void Replay_GetShaderPrecisionFormat (Call &call)
+{
+    GetShaderPrecisionFormat (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Output<GLint *> (2), call.Output<GLint *> (3));
+}
+
+static void Replay_DepthRangef (Call &call)
+{
+    DepthRangef (call.Value<GLfloat> (0), call.Value<GLfloat> (1));
+}
+
+static void Replay_ClearDepthf (Call &call)
+{
+    ClearDepthf (call.Value<GLfloat> (0));
+}
+
+static void Replay_GetProgramBinary (Call &call)
+{
+    GetProgramBinary (call.Object (0, ObjectProgram), call.Value<GLsizei> (1), call.Output<GLsizei *> (2), call.Output<GLenum *> (3), call.Output<void *> (4));
+}
+
+static void Replay_ProgramBinary (Call &call)
+{
+    ProgramBinary (call.Object (0, ObjectProgram), call.Value<GLenum> (1), call.Pointer<const void *> (2), call.Value<GLsizei> (3));
+}
+
+static void Replay_ProgramParameteri (Call &call)
+{
+    ProgramParameteri (call.Object (0, ObjectProgram), call.Value<GLenum> (1), call.Value<GLint> (2));
+}
+
+static void Replay_UseProgramStages (Call &call)
+{
+    UseProgramStages (call.Object (0, ObjectPipeline), call.Value<GLbitfield> (1), call.Object (2, ObjectProgram));
+}
+
+static void Replay_ActiveShaderProgram (Call &call)
+{
+    ActiveShaderProgram (call.Object (0, ObjectPipeline), call.Object (1, ObjectProgram));
+}
+
+static void Replay_CreateShaderProgramv (Call &call)
+{
+    GLuint result = CreateShaderProgramv (call.Value<GLenum> (0), call.Value<GLsizei> (1), call.Strings (2));
+    call.MapObject (ObjectProgram, result);
+}
+
+static void Replay_BindProgramPipeline (Call &call)
+{
+    BindProgramPipeline (call.Object (0, ObjectPipeline));
+}
+
+static void Replay_DeleteProgramPipelines (Call &call)
+{
+    DeleteProgramPipelines (call.Value<GLsizei> (0), call.Objects (1, ObjectPipeline));
+}
+
+static void Replay_GenProgramPipelines (Call &call)
+{
+    GenProgramPipelines (call.Value<GLsizei> (0), call.Output<GLuint *> (1));
+    call.MapObjects (1, ObjectPipeline);
+}
+
+static void Replay_IsProgramPipeline (Call &call)
+{
+    IsProgramPipeline (call.Object (0, ObjectPipeline));
+}
+
+static void Replay_GetProgramPipelineiv (Call &call)
+{
+    GetProgramPipelineiv (call.Object (0, ObjectPipeline), call.Value<GLenum> (1), call.Output<GLint *> (2));
+}
+
+static void Replay_ProgramUniform1i (Call &call)
+{
+    ProgramUniform1i (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLint> (2));
+}
+
+static void Replay_ProgramUniform1iv (Call &call)
+{
+    ProgramUniform1iv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Pointer<const GLint *> (3));
+}
+
+static void Replay_ProgramUniform1f (Call &call)
+{
+    ProgramUniform1f (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLfloat> (2));
+}
+
+static void Replay_ProgramUniform1fv (Call &call)
+{
+    ProgramUniform1fv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Pointer<const GLfloat *> (3));
+}
+
+static void Replay_ProgramUniform1d (Call &call)
+{
+    ProgramUniform1d (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLdouble> (2));
+}
+
+static void Replay_ProgramUniform1dv (Call &call)
+{
+    ProgramUniform1dv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Pointer<const GLdouble *> (3));
+}
+
+static void Replay_ProgramUniform1ui (Call &call)
+{
+    ProgramUniform1ui (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLuint> (2));
+}
+
+static void Replay_ProgramUniform1uiv (Call &call)
+{
+    ProgramUniform1uiv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Pointer<const GLuint *> (3));
+}
+
+static void Replay_ProgramUniform2i (Call &call)
+{
+    ProgramUniform2i (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLint> (2), call.Value<GLint> (3));
+}
+
+static void Replay_ProgramUniform2iv (Call &call)
+{
+    ProgramUniform2iv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Pointer<const GLint *> (3));
+}
+
+static void Replay_ProgramUniform2f (Call &call)
+{
+    ProgramUniform2f (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLfloat> (2), call.Value<GLfloat> (3));
+}
+
+static void Replay_ProgramUniform2fv (Call &call)
+{
+    ProgramUniform2fv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Pointer<const GLfloat *> (3));
+}
+
+static void Replay_ProgramUniform2d (Call &call)
+{
+    ProgramUniform2d (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLdouble> (2), call.Value<GLdouble> (3));
+}
+
+static void Replay_ProgramUniform2dv (Call &call)
+{
+    ProgramUniform2dv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Pointer<const GLdouble *> (3));
+}
+
+static void Replay_ProgramUniform2ui (Call &call)
+{
+    ProgramUniform2ui (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLuint> (2), call.Value<GLuint> (3));
+}
+
+static void Replay_ProgramUniform2uiv (Call &call)
+{
+    ProgramUniform2uiv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Pointer<const GLuint *> (3));
+}
+
+static void Replay_ProgramUniform3i (Call &call)
+{
+    ProgramUniform3i (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLint> (2), call.Value<GLint> (3), call.Value<GLint> (4));
+}
+
+static void Replay_ProgramUniform3iv (Call &call)
+{
+    ProgramUniform3iv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Pointer<const GLint *> (3));
+}
+
+static void Replay_ProgramUniform3f (Call &call)
+{
+    ProgramUniform3f (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLfloat> (2), call.Value<GLfloat> (3), call.Value<GLfloat> (4));
+}
+
+static void Replay_ProgramUniform3fv (Call &call)
+{
+    ProgramUniform3fv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Pointer<const GLfloat *> (3));
+}
+
+static void Replay_ProgramUniform3d (Call &call)
+{
+    ProgramUniform3d (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLdouble> (2), call.Value<GLdouble> (3), call.Value<GLdouble> (4));
+}
+
+static void Replay_ProgramUniform3dv (Call &call)
+{
+    ProgramUniform3dv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Pointer<const GLdouble *> (3));
+}
+
+static void Replay_ProgramUniform3ui (Call &call)
+{
+    ProgramUniform3ui (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLuint> (2), call.Value<GLuint> (3), call.Value<GLuint> (4));
+}
+
+static void Replay_ProgramUniform3uiv (Call &call)
+{
+    ProgramUniform3uiv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Pointer<const GLuint *> (3));
+}
+
+static void Replay_ProgramUniform4i (Call &call)
+{
+    ProgramUniform4i (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLint> (2), call.Value<GLint> (3), call.Value<GLint> (4), call.Value<GLint> (5));
+}
+
+static void Replay_ProgramUniform4iv (Call &call)
+{
+    ProgramUniform4iv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Pointer<const GLint *> (3));
+}
+
+static void Replay_ProgramUniform4f (Call &call)
+{
+    ProgramUniform4f (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLfloat> (2), call.Value<GLfloat> (3), call.Value<GLfloat> (4), call.Value<GLfloat> (5));
+}
+
+static void Replay_ProgramUniform4fv (Call &call)
+{
+    ProgramUniform4fv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Pointer<const GLfloat *> (3));
+}
+
+static void Replay_ProgramUniform4d (Call &call)
+{
+    ProgramUniform4d (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLdouble> (2), call.Value<GLdouble> (3), call.Value<GLdouble> (4), call.Value<GLdouble> (5));
+}
+
+static void Replay_ProgramUniform4dv (Call &call)
+{
+    ProgramUniform4dv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Pointer<const GLdouble *> (3));
+}
+
+static void Replay_ProgramUniform4ui (Call &call)
+{
+    ProgramUniform4ui (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLuint> (2), call.Value<GLuint> (3), call.Value<GLuint> (4), call.Value<GLuint> (5));
+}
+
+static void Replay_ProgramUniform4uiv (Call &call)
+{
+    ProgramUniform4uiv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Pointer<const GLuint *> (3));
+}
+
+static void Replay_ProgramUniformMatrix2fv (Call &call)
+{
+    ProgramUniformMatrix2fv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Value<GLboolean> (3), call.Pointer<const GLfloat *> (4));
+}
+
+static void Replay_ProgramUniformMatrix3fv (Call &call)
+{
+    ProgramUniformMatrix3fv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Value<GLboolean> (3), call.Pointer<const GLfloat *> (4));
+}
+
+static void Replay_ProgramUniformMatrix4fv (Call &call)
+{
+    ProgramUniformMatrix4fv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Value<GLboolean> (3), call.Pointer<const GLfloat *> (4));
+}
+
+static void Replay_ProgramUniformMatrix2dv (Call &call)
+{
+    ProgramUniformMatrix2dv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Value<GLboolean> (3), call.Pointer<const GLdouble *> (4));
+}
+
+static void Replay_ProgramUniformMatrix3dv (Call &call)
+{
+    ProgramUniformMatrix3dv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Value<GLboolean> (3), call.Pointer<const GLdouble *> (4));
+}
+
+static void Replay_ProgramUniformMatrix4dv (Call &call)
+{
+    ProgramUniformMatrix4dv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Value<GLboolean> (3), call.Pointer<const GLdouble *> (4));
+}
+
+static void Replay_ProgramUniformMatrix2x3fv (Call &call)
+{
+    ProgramUniformMatrix2x3fv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Value<GLboolean> (3), call.Pointer<const GLfloat *> (4));
+}
+
+static void Replay_ProgramUniformMatrix3x2fv (Call &call)
+{
+    ProgramUniformMatrix3x2fv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Value<GLboolean> (3), call.Pointer<const GLfloat *> (4));
+}
+
+static void Replay_ProgramUniformMatrix2x4fv (Call &call)
+{
+    ProgramUniformMatrix2x4fv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Value<GLboolean> (3), call.Pointer<const GLfloat *> (4));
+}
+
+static void Replay_ProgramUniformMatrix4x2fv (Call &call)
+{
+    ProgramUniformMatrix4x2fv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Value<GLboolean> (3), call.Pointer<const GLfloat *> (4));
+}
+
+static void Replay_ProgramUniformMatrix3x4fv (Call &call)
+{
+    ProgramUniformMatrix3x4fv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Value<GLboolean> (3), call.Pointer<const GLfloat *> (4));
+}
+
+static void Replay_ProgramUniformMatrix4x3fv (Call &call)
+{
+    ProgramUniformMatrix4x3fv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Value<GLboolean> (3), call.Pointer<const GLfloat *> (4));
+}
+
+static void Replay_ProgramUniformMatrix2x3dv (Call &call)
+{
+    ProgramUniformMatrix2x3dv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Value<GLboolean> (3), call.Pointer<const GLdouble *> (4));
+}
+
+static void Replay_ProgramUniformMatrix3x2dv (Call &call)
+{
+    ProgramUniformMatrix3x2dv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Value<GLboolean> (3), call.Pointer<const GLdouble *> (4));
+}
+
+static void Replay_ProgramUniformMatrix2x4dv (Call &call)
+{
+    ProgramUniformMatrix2x4dv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Value<GLboolean> (3), call.Pointer<const GLdouble *> (4));
+}
+
+static void Replay_ProgramUniformMatrix4x2dv (Call &call)
+{
+    ProgramUniformMatrix4x2dv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Value<GLboolean> (3), call.Pointer<const GLdouble *> (4));
+}
+
+static void Replay_ProgramUniformMatrix3x4dv (Call &call)
+{
+    ProgramUniformMatrix3x4dv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Value<GLboolean> (3), call.Pointer<const GLdouble *> (4));
+}
+
+static void Replay_ProgramUniformMatrix4x3dv (Call &call)
+{
+    ProgramUniformMatrix4x3dv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Value<GLboolean> (3), call.Pointer<const GLdouble *> (4));
+}
+
+static void Replay_ValidateProgramPipeline (Call &call)
+{
+    ValidateProgramPipeline (call.Object (0, ObjectPipeline));
+}
+
+static void Replay_GetProgramPipelineInfoLog (Call &call)
+{
+    GetProgramPipelineInfoLog (call.Object (0, ObjectPipeline), call.Value<GLsizei> (1), call.Output<GLsizei *> (2), call.Output<GLchar *> (3));
+}
+
+static void Replay_VertexAttribL1d (Call &call)
+{
+    VertexAttribL1d (call.Value<GLuint> (0), call.Value<GLdouble> (1));
+}
+
+static void Replay_VertexAttribL2d (Call &call)
+{
+    VertexAttribL2d (call.Value<GLuint> (0), call.Value<GLdouble> (1), call.Value<GLdouble> (2));
+}
+
+static void Replay_VertexAttribL3d (Call &call)
+{
+    VertexAttribL3d (call.Value<GLuint> (0), call.Value<GLdouble> (1), call.Value<GLdouble> (2), call.Value<GLdouble> (3));
+}
+
+static void Replay_VertexAttribL4d (Call &call)
+{
+    VertexAttribL4d (call.Value<GLuint> (0), call.Value<GLdouble> (1), call.Value<GLdouble> (2), call.Value<GLdouble> (3), call.Value<GLdouble> (4));
+}
+
+static void Replay_VertexAttribL1dv (Call &call)
+{
+    VertexAttribL1dv (call.Value<GLuint> (0), call.Pointer<const GLdouble *> (1));
+}
+
+static void Replay_VertexAttribL2dv (Call &call)
+{
+    VertexAttribL2dv (call.Value<GLuint> (0), call.Pointer<const GLdouble *> (1));
+}
+
+static void Replay_VertexAttribL3dv (Call &call)
+{
+    VertexAttribL3dv (call.Value<GLuint> (0), call.Pointer<const GLdouble *> (1));
+}
+
+static void Replay_VertexAttribL4dv (Call &call)
+{
+    VertexAttribL4dv (call.Value<GLuint> (0), call.Pointer<const GLdouble *> (1));
+}
+
+static void Replay_VertexAttribLPointer (Call &call)
+{
+    VertexAttribLPointer (call.Value<GLuint> (0), call.Value<GLint> (1), call.Value<GLenum> (2), call.Value<GLsizei> (3), call.Pointer<const void *> (4));
+}
+
+static void Replay_GetVertexAttribLdv (Call &call)
+{
+    GetVertexAttribLdv (call.Value<GLuint> (0), call.Value<GLenum> (1), call.Output<GLdouble *> (2));
+}
+
+static void Replay_ViewportArrayv (Call &call)
+{
+    ViewportArrayv (call.Value<GLuint> (0), call.Value<GLsizei> (1), call.Pointer<const GLfloat *> (2));
+}
+
+static void Replay_ViewportIndexedf (Call &call)
+{
+    ViewportIndexedf (call.Value<GLuint> (0), call.Value<GLfloat> (1), call.Value<GLfloat> (2), call.Value<GLfloat> (3), call.Value<GLfloat> (4));
+}
+
+static void Replay_ViewportIndexedfv (Call &call)
+{
+    ViewportIndexedfv (call.Value<GLuint> (0), call.Pointer<const GLfloat *> (1));
+}
+
+static void Replay_ScissorArrayv (Call &call)
+{
+    ScissorArrayv (call.Value<GLuint> (0), call.Value<GLsizei> (1), call.Pointer<const GLint *> (2));
+}
+
+static void Replay_ScissorIndexed (Call &call)
+{
+    ScissorIndexed (call.Value<GLuint> (0), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLsizei> (3), call.Value<GLsizei> (4));
+}
+
+static void Replay_ScissorIndexedv (Call &call)
+{
+    ScissorIndexedv (call.Value<GLuint> (0), call.Pointer<const GLint *> (1));
+}
+
+static void Replay_DepthRangeArrayv (Call &call)
+{
+    DepthRangeArrayv (call.Value<GLuint> (0), call.Value<GLsizei> (1), call.Pointer<const GLdouble *> (2));
+}
+
+static void Replay_DepthRangeIndexed (Call &call)
+{
+    DepthRangeIndexed (call.Value<GLuint> (0), call.Value<GLdouble> (1), call.Value<GLdouble> (2));
+}
+
+static void Replay_GetFloati_v (Call &call)
+{
+    GetFloati_v (call.Value<GLenum> (0), call.Value<GLuint> (1), call.Output<GLfloat *> (2));
+}
+
+static void Replay_GetDoublei_v (Call &call)
+{
+    GetDoublei_v (call.Value<GLenum> (0), call.Value<GLuint> (1), call.Output<GLdouble *> (2));
+}
+
+static void Replay_DrawArraysInstancedBaseInstance (Call &call)
+{
+    DrawArraysInstancedBaseInstance (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLsizei> (2), call.Value<GLsizei> (3), call.Value<GLuint> (4));
+}
+
+static void Replay_DrawElementsInstancedBaseInstance (Call &call)
+{
+    DrawElementsInstancedBaseInstance (call.Value<GLenum> (0), call.Value<GLsizei> (1), call.Value<GLenum> (2), call.Pointer<const void *> (3), call.Value<GLsizei> (4), call.Value<GLuint> (5));
+}
+
+static void Replay_DrawElementsInstancedBaseVertexBaseInstance (Call &call)
+{
+    DrawElementsInstancedBaseVertexBaseInstance (call.Value<GLenum> (0), call.Value<GLsizei> (1), call.Value<GLenum> (2), call.Pointer<const void *> (3), call.Value<GLsizei> (4), call.Value<GLint> (5), call.Value<GLuint> (6));
+}
+
+static void Replay_GetInternalformativ (Call &call)
+{
+    GetInternalformativ (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Value<GLenum> (2), call.Value<GLsizei> (3), call.Output<GLint *> (4));
+}
+
+static void Replay_GetActiveAtomicCounterBufferiv (Call &call)
+{
+    GetActiveAtomicCounterBufferiv (call.Object (0, ObjectProgram), call.Value<GLuint> (1), call.Value<GLenum> (2), call.Output<GLint *> (3));
+}
+
+static void Replay_BindImageTexture (Call &call)
+{
+    BindImageTexture (call.Value<GLuint> (0), call.Object (1, ObjectTexture), call.Value<GLint> (2), call.Value<GLboolean> (3), call.Value<GLint> (4), call.Value<GLenum> (5), call.Value<GLenum> (6));
+}
+
+static void Replay_MemoryBarrier (Call &call)
+{
+    MemoryBarrier (call.Value<GLbitfield> (0));
+}
+
+static void Replay_TexStorage1D (Call &call)
+{
+    TexStorage1D (call.Value<GLenum> (0), call.Value<GLsizei> (1), call.Value<GLenum> (2), call.Value<GLsizei> (3));
+}
+
+static void Replay_TexStorage2D (Call &call)
+{
+    TexStorage2D (call.Value<GLenum> (0), call.Value<GLsizei> (1), call.Value<GLenum> (2), call.Value<GLsizei> (3), call.Value<GLsizei> (4));
+}
+
+static void Replay_TexStorage3D (Call &call)
+{
+    TexStorage3D (call.Value<GLenum> (0), call.Value<GLsizei> (1), call.Value<GLenum> (2), call.Value<GLsizei> (3), call.Value<GLsizei> (4), call.Value<GLsizei> (5));
+}
+
+static void Replay_DrawTransformFeedbackInstanced (Call &call)
+{
+    DrawTransformFeedbackInstanced (call.Value<GLenum> (0), call.Object (1, ObjectTransformFeedback), call.Value<GLsizei> (2));
+}
+
+static void Replay_DrawTransformFeedbackStreamInstanced (Call &call)
+{
+    DrawTransformFeedbackStreamInstanced (call.Value<GLenum> (0), call.Object (1, ObjectTransformFeedback), call.Value<GLuint> (2), call.Value<GLsizei> (3));
+}
+
+static void Replay_ClearBufferData (Call &call)
+{
+    ClearBufferData (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Value<GLenum> (2), call.Value<GLenum> (3), call.Pointer<const void *> (4));
+}
+
+static void Replay_ClearBufferSubData (Call &call)
+{
+    ClearBufferSubData (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Value<GLintptr> (2), call.Value<GLsizeiptr> (3), call.Value<GLenum> (4), call.Value<GLenum> (5), call.Pointer<const void *> (6));
+}
+
+static void Replay_DispatchCompute (Call &call)
+{
+    DispatchCompute (call.Value<GLuint> (0), call.Value<GLuint> (1), call.Value<GLuint> (2));
+}
+
+static void Replay_DispatchComputeIndirect (Call &call)
+{
+    DispatchComputeIndirect (call.Value<GLintptr> (0));
+}
+
+static void Replay_CopyImageSubData (Call &call)
+{
+    CopyImageSubData (call.Value<GLuint> (0), call.Value<GLenum> (1), call.Value<GLint> (2), call.Value<GLint> (3), call.Value<GLint> (4), call.Value<GLint> (5), call.Value<GLuint> (6), call.Value<GLenum> (7), call.Value<GLint> (8), call.Value<GLint> (9), call.Value<GLint> (10), call.Value<GLint> (11), call.Value<GLsizei> (12), call.Value<GLsizei> (13), call.Value<GLsizei> (14));
+}
+
+static void Replay_FramebufferParameteri (Call &call)
+{
+    FramebufferParameteri (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Value<GLint> (2));
+}
+
+static void Replay_GetFramebufferParameteriv (Call &call)
+{
+    GetFramebufferParameteriv (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Output<GLint *> (2));
+}
+
+static void Replay_GetInternalformati64v (Call &call)
+{
+    GetInternalformati64v (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Value<GLenum> (2), call.Value<GLsizei> (3), call.Output<GLint64 *> (4));
+}
+
+static void Replay_InvalidateTexSubImage (Call &call)
+{
+    InvalidateTexSubImage (call.Object (0, ObjectTexture), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLint> (3), call.Value<GLint> (4), call.Value<GLsizei> (5), call.Value<GLsizei> (6), call.Value<GLsizei> (7));
+}
+
+static void Replay_InvalidateTexImage (Call &call)
+{
+    InvalidateTexImage (call.Object (0, ObjectTexture), call.Value<GLint> (1));
+}
+
+static void Replay_InvalidateBufferSubData (Call &call)
+{
+    InvalidateBufferSubData (call.Object (0, ObjectBuffer), call.Value<GLintptr> (1), call.Value<GLsizeiptr> (2));
+}
+
+static void Replay_InvalidateBufferData (Call &call)
+{
+    InvalidateBufferData (call.Object (0, ObjectBuffer));
+}
+
+static void Replay_InvalidateFramebuffer (Call &call)
+{
+    InvalidateFramebuffer (call.Value<GLenum> (0), call.Value<GLsizei> (1), call.Pointer<const GLenum *> (2));
+}
+
+static void Replay_InvalidateSubFramebuffer (Call &call)
+{
+    InvalidateSubFramebuffer (call.Value<GLenum> (0), call.Value<GLsizei> (1), call.Pointer<const GLenum *> (2), call.Value<GLint> (3), call.Value<GLint> (4), call.Value<GLsizei> (5), call.Value<GLsizei> (6));
+}
+
+static void Replay_MultiDrawArraysIndirect (Call &call)
+{
+    MultiDrawArraysIndirect (call.Value<GLenum> (0), call.Pointer<const void *> (1), call.Value<GLsizei> (2), call.Value<GLsizei> (3));
+}
+
+static void Replay_MultiDrawElementsIndirect (Call &call)
+{
+    MultiDrawElementsIndirect (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Pointer<const void *> (2), call.Value<GLsizei> (3), call.Value<GLsizei> (4));
+}
+
+static void Replay_GetProgramInterfaceiv (Call &call)
+{
+    GetProgramInterfaceiv (call.Object (0, ObjectProgram), call.Value<GLenum> (1), call.Value<GLenum> (2), call.Output<GLint *> (3));
+}
+
+static void Replay_GetProgramResourceIndex (Call &call)
+{
+    GetProgramResourceIndex (call.Object (0, ObjectProgram), call.Value<GLenum> (1), call.Pointer<const GLchar *> (2));
+}
+
+static void Replay_GetProgramResourceName (Call &call)
+{
+    GetProgramResourceName (call.Object (0, ObjectProgram), call.Value<GLenum> (1), call.Value<GLuint> (2), call.Value<GLsizei> (3), call.Output<GLsizei *> (4), call.Output<GLchar *> (5));
+}
+
+static void Replay_GetProgramResourceiv (Call &call)
+{
+    GetProgramResourceiv (call.Object (0, ObjectProgram), call.Value<GLenum> (1), call.Value<GLuint> (2), call.Value<GLsizei> (3), call.Pointer<const GLenum *> (4), call.Value<GLsizei> (5), call.Output<GLsizei *> (6), call.Output<GLint *> (7));
+}
+
+static void Replay_GetProgramResourceLocation (Call &call)
+{
+    GLint result = GetProgramResourceLocation (call.Object (0, ObjectProgram), call.Value<GLenum> (1), call.Pointer<const GLchar *> (2));
+    call.MapLocation (0, result);
+}
+
+static void Replay_GetProgramResourceLocationIndex (Call &call)
+{
+    GetProgramResourceLocationIndex (call.Object (0, ObjectProgram), call.Value<GLenum> (1), call.Pointer<const GLchar *> (2));
+}
+
+static void Replay_ShaderStorageBlockBinding (Call &call)
+{
+    ShaderStorageBlockBinding (call.Object (0, ObjectProgram), call.Value<GLuint> (1), call.Value<GLuint> (2));
+}
+
+static void Replay_TexBufferRange (Call &call)
+{
+    TexBufferRange (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Object (2, ObjectBuffer), call.Value<GLintptr> (3), call.Value<GLsizeiptr> (4));
+}
+
+static void Replay_TexStorage2DMultisample (Call &call)
+{
+    TexStorage2DMultisample (call.Value<GLenum> (0), call.Value<GLsizei> (1), call.Value<GLenum> (2), call.Value<GLsizei> (3), call.Value<GLsizei> (4), call.Value<GLboolean> (5));
+}
+
+static void Replay_TexStorage3DMultisample (Call &call)
+{
+    TexStorage3DMultisample (call.Value<GLenum> (0), call.Value<GLsizei> (1), call.Value<GLenum> (2), call.Value<GLsizei> (3), call.Value<GLsizei> (4), call.Value<GLsizei> (5), call.Value<GLboolean> (6));
+}
+
+static void Replay_TextureView (Call &call)
+{
+    TextureView (call.Object (0, ObjectTexture), call.Value<GLenum> (1), call.Value<GLuint> (2), call.Value<GLenum> (3), call.Value<GLuint> (4), call.Value<GLuint> (5), call.Value<GLuint> (6), call.Value<GLuint> (7));
+}
+
+static void Replay_BindVertexBuffer (Call &call)
+{
+    BindVertexBuffer (call.Value<GLuint> (0), call.Object (1, ObjectBuffer), call.Value<GLintptr> (2), call.Value<GLsizei> (3));
+}
+
+static void Replay_VertexAttribFormat (Call &call)
+{
+    VertexAttribFormat (call.Value<GLuint> (0), call.Value<GLint> (1), call.Value<GLenum> (2), call.Value<GLboolean> (3), call.Value<GLuint> (4));
+}
+
+static void Replay_VertexAttribIFormat (Call &call)
+{
+    VertexAttribIFormat (call.Value<GLuint> (0), call.Value<GLint> (1), call.Value<GLenum> (2), call.Value<GLuint> (3));
+}
+
+static void Replay_VertexAttribLFormat (Call &call)
+{
+    VertexAttribLFormat (call.Value<GLuint> (0), call.Value<GLint> (1), call.Value<GLenum> (2), call.Value<GLuint> (3));
+}
+
+static void Replay_VertexAttribBinding (Call &call)
+{
+    VertexAttribBinding (call.Value<GLuint> (0), call.Value<GLuint> (1));
+}
+
+static void Replay_VertexBindingDivisor (Call &call)
+{
+    VertexBindingDivisor (call.Value<GLuint> (0), call.Value<GLuint> (1));
+}
+
+static void Replay_DebugMessageControl (Call &call)
+{
+    DebugMessageControl (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Value<GLenum> (2), call.Value<GLsizei> (3), call.Pointer<const GLuint *> (4), call.Value<GLboolean> (5));
+}
+
+static void Replay_DebugMessageInsert (Call &call)
+{
+    DebugMessageInsert (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Value<GLuint> (2), call.Value<GLenum> (3), call.Value<GLsizei> (4), call.Pointer<const GLchar *> (5));
+}
+
+static void Replay_DebugMessageCallback (Call &call)
+{
+    DebugMessageCallback (NULL, call.Pointer<const void *> (1));
+}
+
+static void Replay_GetDebugMessageLog (Call &call)
+{
+    GetDebugMessageLog (call.Value<GLuint> (0), call.Value<GLsizei> (1), call.Output<GLenum *> (2), call.Output<GLenum *> (3), call.Output<GLuint *> (4), call.Output<GLenum *> (5), call.Output<GLsizei *> (6), call.Output<GLchar *> (7));
+}
+
+static void Replay_PushDebugGroup (Call &call)
+{
+    PushDebugGroup (call.Value<GLenum> (0), call.Value<GLuint> (1), call.Value<GLsizei> (2), call.Pointer<const GLchar *> (3));
+}
+
+static void Replay_PopDebugGroup (Call &call)
+{
+    (void) call;
+    PopDebugGroup ();
+}
+
+static void Replay_ObjectLabel (Call &call)
+{
+    ObjectLabel (call.Value<GLenum> (0), call.Value<GLuint> (1), call.Value<GLsizei> (2), call.Pointer<const GLchar *> (3));
+}
+
+static void Replay_GetObjectLabel (Call &call)
+{
+    GetObjectLabel (call.Value<GLenum> (0), call.Value<GLuint> (1), call.Value<GLsizei> (2), call.Output<GLsizei *> (3), call.Output<GLchar *> (4));
+}
+
+static void Replay_ObjectPtrLabel (Call &call)
+{
+    ObjectPtrLabel (call.Pointer<const void *> (0), call.Value<GLsizei> (1), call.Pointer<const GLchar *> (2));
+}
+
+static void Replay_GetObjectPtrLabel (Call &call)
+{
+    GetObjectPtrLabel (call.Pointer<const void *> (0), call.Value<GLsizei> (1), call.Output<GLsizei *> (2), call.Output<GLchar *> (3));
+}
+
+static void Replay_BufferStorage (Call &call)
+{
+    BufferStorage (call.Value<GLenum> (0), call.Value<GLsizeiptr> (1), call.Pointer<const void *> (2), call.Value<GLbitfield> (3));
+}
+
+static void Replay_ClearTexImage (Call &call)
+{
+    ClearTexImage (call.Object (0, ObjectTexture), call.Value<GLint> (1), call.Value<GLenum> (2), call.Value<GLenum> (3), call.Pointer<const void *> (4));
+}
+
+static void Replay_ClearTexSubImage (Call &call)
+{
+    ClearTexSubImage (call.Object (0, ObjectTexture), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLint> (3), call.Value<GLint> (4), call.Value<GLsizei> (5), call.Value<GLsizei> (6), call.Value<GLsizei> (7), call.Value<GLenum> (8), call.Value<GLenum> (9), call.Pointer<const void *> (10));
+}
+
+static void Replay_BindBuffersBase (Call &call)
+{
+    BindBuffersBase (call.Value<GLenum> (0), call.Value<GLuint> (1), call.Value<GLsizei> (2), call.Objects (3, ObjectBuffer));
+}
+
+static void Replay_BindBuffersRange (Call &call)
+{
+    BindBuffersRange (call.Value<GLenum> (0), call.Value<GLuint> (1), call.Value<GLsizei> (2), call.Objects (3, ObjectBuffer), call.Pointer<const GLintptr *> (4), call.Pointer<const GLsizeiptr *> (5));
+}
+
+static void Replay_BindTextures (Call &call)
+{
+    BindTextures (call.Value<GLuint> (0), call.Value<GLsizei> (1), call.Objects (2, ObjectTexture));
+}
+
+static void Replay_BindSamplers (Call &call)
+{
+    BindSamplers (call.Value<GLuint> (0), call.Value<GLsizei> (1), call.Objects (2, ObjectSampler));
+}
+
+static void Replay_BindImageTextures (Call &call)
+{
+    BindImageTextures (call.Value<GLuint> (0), call.Value<GLsizei> (1), call.Objects (2, ObjectTexture));
+}
+
+static void Replay_BindVertexBuffers (Call &call)
+{
+    BindVertexBuffers (call.Value<GLuint> (0), call.Value<GLsizei> (1), call.Objects (2, ObjectBuffer), call.Pointer<const GLintptr *> (3), call.Pointer<const GLsizei *> (4));
+}
+
+static void Replay_ClipControl (Call &call)
+{
+    ClipControl (call.Value<GLenum> (0), call.Value<GLenum> (1));
+}
+
+static void Replay_CreateTransformFeedbacks (Call &call)
+{
+    CreateTransformFeedbacks (call.Value<GLsizei> (0), call.Output<GLuint *> (1));
+    call.MapObjects (1, ObjectTransformFeedback);
+}
+
+static void Replay_TransformFeedbackBufferBase (Call &call)
+{
+    TransformFeedbackBufferBase (call.Object (0, ObjectTransformFeedback), call.Value<GLuint> (1), call.Object (2, ObjectBuffer));
+}
+
+static void Replay_TransformFeedbackBufferRange (Call &call)
+{
+    TransformFeedbackBufferRange (call.Object (0, ObjectTransformFeedback), call.Value<GLuint> (1), call.Object (2, ObjectBuffer), call.Value<GLintptr> (3), call.Value<GLsizeiptr> (4));
+}
+
+static void Replay_GetTransformFeedbackiv (Call &call)
+{
+    GetTransformFeedbackiv (call.Object (0, ObjectTransformFeedback), call.Value<GLenum> (1), call.Output<GLint *> (2));
+}
+
+static void Replay_GetTransformFeedbacki_v (Call &call)
+{
+    GetTransformFeedbacki_v (call.Object (0, ObjectTransformFeedback), call.Value<GLenum> (1), call.Value<GLuint> (2), call.Output<GLint *> (3));
+}
+
+static void Replay_GetTransformFeedbacki64_v (Call &call)
+{
+    GetTransformFeedbacki64_v (call.Object (0, ObjectTransformFeedback), call.Value<GLenum> (1), call.Value<GLuint> (2), call.Output<GLint64 *> (3));
+}
+
+static void Replay_CreateBuffers (Call &call)
+{
+    CreateBuffers (call.Value<GLsizei> (0), call.Output<GLuint *> (1));
+    call.MapObjects (1, ObjectBuffer);
+}
+
+static void Replay_NamedBufferStorage (Call &call)
+{
+    NamedBufferStorage (call.Object (0, ObjectBuffer), call.Value<GLsizeiptr> (1), call.Pointer<const void *> (2), call.Value<GLbitfield> (3));
+}
+
+static void Replay_NamedBufferData (Call &call)
+{
+    NamedBufferData (call.Object (0, ObjectBuffer), call.Value<GLsizeiptr> (1), call.Pointer<const void *> (2), call.Value<GLenum> (3));
+}
+
+static void Replay_NamedBufferSubData (Call &call)
+{
+    NamedBufferSubData (call.Object (0, ObjectBuffer), call.Value<GLintptr> (1), call.Value<GLsizeiptr> (2), call.Pointer<const void *> (3));
+}
+
+static void Replay_CopyNamedBufferSubData (Call &call)
+{
+    CopyNamedBufferSubData (call.Object (0, ObjectBuffer), call.Object (1, ObjectBuffer), call.Value<GLintptr> (2), call.Value<GLintptr> (3), call.Value<GLsizeiptr> (4));
+}
+
+static void Replay_ClearNamedBufferData (Call &call)
+{
+    ClearNamedBufferData (call.Object (0, ObjectBuffer), call.Value<GLenum> (1), call.Value<GLenum> (2), call.Value<GLenum> (3), call.Pointer<const void *> (4));
+}
+
+static void Replay_ClearNamedBufferSubData (Call &call)
+{
+    ClearNamedBufferSubData (call.Object (0, ObjectBuffer), call.Value<GLenum> (1), call.Value<GLintptr> (2), call.Value<GLsizeiptr> (3), call.Value<GLenum> (4), call.Value<GLenum> (5), call.Pointer<const void *> (6));
+}
+
+static void Replay_MapNamedBuffer (Call &call)
+{
+    MapNamedBuffer (call.Object (0, ObjectBuffer), call.Value<GLenum> (1));
+}
+
+static void Replay_MapNamedBufferRange (Call &call)
+{
+    MapNamedBufferRange (call.Object (0, ObjectBuffer), call.Value<GLintptr> (1), call.Value<GLsizeiptr> (2), call.Value<GLbitfield> (3));
+}
+
+static void Replay_UnmapNamedBuffer (Call &call)
+{
+    UnmapNamedBuffer (call.Object (0, ObjectBuffer));
+}
+
+static void Replay_FlushMappedNamedBufferRange (Call &call)
+{
+    FlushMappedNamedBufferRange (call.Object (0, ObjectBuffer), call.Value<GLintptr> (1), call.Value<GLsizeiptr> (2));
+}
+
+static void Replay_GetNamedBufferParameteriv (Call &call)
+{
+    GetNamedBufferParameteriv (call.Object (0, ObjectBuffer), call.Value<GLenum> (1), call.Output<GLint *> (2));
+}
+
+static void Replay_GetNamedBufferParameteri64v (Call &call)
+{
+    GetNamedBufferParameteri64v (call.Object (0, ObjectBuffer), call.Value<GLenum> (1), call.Output<GLint64 *> (2));
+}
+
+static void Replay_GetNamedBufferPointerv (Call &call)
+{
+    GetNamedBufferPointerv (call.Object (0, ObjectBuffer), call.Value<GLenum> (1), call.Output<void **> (2));
+}
+
+static void Replay_GetNamedBufferSubData (Call &call)
+{
+    GetNamedBufferSubData (call.Object (0, ObjectBuffer), call.Value<GLintptr> (1), call.Value<GLsizeiptr> (2), call.Output<void *> (3));
+}
+
+static void Replay_CreateFramebuffers (Call &call)
+{
+    CreateFramebuffers (call.Value<GLsizei> (0), call.Output<GLuint *> (1));
+    call.MapObjects (1, ObjectFramebuffer);
+}
+
+static void Replay_NamedFramebufferRenderbuffer (Call &call)
+{
+    NamedFramebufferRenderbuffer (call.Object (0, ObjectFramebuffer), call.Value<GLenum> (1), call.Value<GLenum> (2), call.Object (3, ObjectRenderbuffer));
+}
+
+static void Replay_NamedFramebufferParameteri (Call &call)
+{
+    NamedFramebufferParameteri (call.Object (0, ObjectFramebuffer), call.Value<GLenum> (1), call.Value<GLint> (2));
+}
+
+static void Replay_NamedFramebufferTexture (Call &call)
+{
+    NamedFramebufferTexture (call.Object (0, ObjectFramebuffer), call.Value<GLenum> (1), call.Object (2, ObjectTexture), call.Value<GLint> (3));
+}
+
+static void Replay_NamedFramebufferTextureLayer (Call &call)
+{
+    NamedFramebufferTextureLayer (call.Object (0, ObjectFramebuffer), call.Value<GLenum> (1), call.Object (2, ObjectTexture), call.Value<GLint> (3), call.Value<GLint> (4));
+}
+
+static void Replay_NamedFramebufferDrawBuffer (Call &call)
+{
+    NamedFramebufferDrawBuffer (call.Object (0, ObjectFramebuffer), call.Value<GLenum> (1));
+}
+
+static void Replay_NamedFramebufferDrawBuffers (Call &call)
+{
+    NamedFramebufferDrawBuffers (call.Object (0, ObjectFramebuffer), call.Value<GLsizei> (1), call.Pointer<const GLenum *> (2));
+}
+
+static void Replay_NamedFramebufferReadBuffer (Call &call)
+{
+    NamedFramebufferReadBuffer (call.Object (0, ObjectFramebuffer), call.Value<GLenum> (1));
+}
+
+static void Replay_InvalidateNamedFramebufferData (Call &call)
+{
+    InvalidateNamedFramebufferData (call.Object (0, ObjectFramebuffer), call.Value<GLsizei> (1), call.Pointer<const GLenum *> (2));
+}
+
+static void Replay_InvalidateNamedFramebufferSubData (Call &call)
+{
+    InvalidateNamedFramebufferSubData (call.Object (0, ObjectFramebuffer), call.Value<GLsizei> (1), call.Pointer<const GLenum *> (2), call.Value<GLint> (3), call.Value<GLint> (4), call.Value<GLsizei> (5), call.Value<GLsizei> (6));
+}
+
+static void Replay_ClearNamedFramebufferiv (Call &call)
+{
+    ClearNamedFramebufferiv (call.Object (0, ObjectFramebuffer), call.Value<GLenum> (1), call.Value<GLint> (2), call.Pointer<const GLint *> (3));
+}
+
+static void Replay_ClearNamedFramebufferuiv (Call &call)
+{
+    ClearNamedFramebufferuiv (call.Object (0, ObjectFramebuffer), call.Value<GLenum> (1), call.Value<GLint> (2), call.Pointer<const GLuint *> (3));
+}
+
+static void Replay_ClearNamedFramebufferfv (Call &call)
+{
+    ClearNamedFramebufferfv (call.Object (0, ObjectFramebuffer), call.Value<GLenum> (1), call.Value<GLint> (2), call.Pointer<const GLfloat *> (3));
+}
+
+static void Replay_ClearNamedFramebufferfi (Call &call)
+{
+    ClearNamedFramebufferfi (call.Object (0, ObjectFramebuffer), call.Value<GLenum> (1), call.Value<GLfloat> (2), call.Value<GLint> (3));
+}
+
+static void Replay_BlitNamedFramebuffer (Call &call)
+{
+    BlitNamedFramebuffer (call.Object (0, ObjectFramebuffer), call.Object (1, ObjectFramebuffer), call.Value<GLint> (2), call.Value<GLint> (3), call.Value<GLint> (4), call.Value<GLint> (5), call.Value<GLint> (6), call.Value<GLint> (7), call.Value<GLint> (8), call.Value<GLint> (9), call.Value<GLbitfield> (10), call.Value<GLenum> (11));
+}
+
+static void Replay_CheckNamedFramebufferStatus (Call &call)
+{
+    CheckNamedFramebufferStatus (call.Object (0, ObjectFramebuffer), call.Value<GLenum> (1));
+}
+
+static void Replay_GetNamedFramebufferParameteriv (Call &call)
+{
+    GetNamedFramebufferParameteriv (call.Object (0, ObjectFramebuffer), call.Value<GLenum> (1), call.Output<GLint *> (2));
+}
+
+static void Replay_GetNamedFramebufferAttachmentParameteriv (Call &call)
+{
+    GetNamedFramebufferAttachmentParameteriv (call.Object (0, ObjectFramebuffer), call.Value<GLenum> (1), call.Value<GLenum> (2), call.Output<GLint *> (3));
+}
+
+static void Replay_CreateRenderbuffers (Call &call)
+{
+    CreateRenderbuffers (call.Value<GLsizei> (0), call.Output<GLuint *> (1));
+    call.MapObjects (1, ObjectRenderbuffer);
+}
+
+static void Replay_NamedRenderbufferStorage (Call &call)
+{
+    NamedRenderbufferStorage (call.Object (0, ObjectRenderbuffer), call.Value<GLenum> (1), call.Value<GLsizei> (2), call.Value<GLsizei> (3));
+}
+
+static void Replay_NamedRenderbufferStorageMultisample (Call &call)
+{
+    NamedRenderbufferStorageMultisample (call.Object (0, ObjectRenderbuffer), call.Value<GLsizei> (1), call.Value<GLenum> (2), call.Value<GLsizei> (3), call.Value<GLsizei> (4));
+}
+
+static void Replay_GetNamedRenderbufferParameteriv (Call &call)
+{
+    GetNamedRenderbufferParameteriv (call.Object (0, ObjectRenderbuffer), call.Value<GLenum> (1), call.Output<GLint *> (2));
+}
+
+static void Replay_CreateTextures (Call &call)
+{
+    CreateTextures (call.Value<GLenum> (0), call.Value<GLsizei> (1), call.Output<GLuint *> (2));
+    call.MapObjects (2, ObjectTexture);
+}
+
+static void Replay_TextureBuffer (Call &call)
+{
+    TextureBuffer (call.Object (0, ObjectTexture), call.Value<GLenum> (1), call.Object (2, ObjectBuffer));
+}
+
+static void Replay_TextureBufferRange (Call &call)
+{
+    TextureBufferRange (call.Object (0, ObjectTexture), call.Value<GLenum> (1), call.Object (2, ObjectBuffer), call.Value<GLintptr> (3), call.Value<GLsizeiptr> (4));
+}
+
+static void Replay_TextureStorage1D (Call &call)
+{
+    TextureStorage1D (call.Object (0, ObjectTexture), call.Value<GLsizei> (1), call.Value<GLenum> (2), call.Value<GLsizei> (3));
+}
+
+static void Replay_TextureStorage2D (Call &call)
+{
+    TextureStorage2D (call.Object (0, ObjectTexture), call.Value<GLsizei> (1), call.Value<GLenum> (2), call.Value<GLsizei> (3), call.Value<GLsizei> (4));
+}
+
+static void Replay_TextureStorage3D (Call &call)
+{
+    TextureStorage3D (call.Object (0, ObjectTexture), call.Value<GLsizei> (1), call.Value<GLenum> (2), call.Value<GLsizei> (3), call.Value<GLsizei> (4), call.Value<GLsizei> (5));
+}
+
+static void Replay_TextureStorage2DMultisample (Call &call)
+{
+    TextureStorage2DMultisample (call.Object (0, ObjectTexture), call.Value<GLsizei> (1), call.Value<GLenum> (2), call.Value<GLsizei> (3), call.Value<GLsizei> (4), call.Value<GLboolean> (5));
+}
+
+static void Replay_TextureStorage3DMultisample (Call &call)
+{
+    TextureStorage3DMultisample (call.Object (0, ObjectTexture), call.Value<GLsizei> (1), call.Value<GLenum> (2), call.Value<GLsizei> (3), call.Value<GLsizei> (4), call.Value<GLsizei> (5), call.Value<GLboolean> (6));
+}
+
+static void Replay_TextureSubImage1D (Call &call)
+{
+    TextureSubImage1D (call.Object (0, ObjectTexture), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLsizei> (3), call.Value<GLenum> (4), call.Value<GLenum> (5), call.Pointer<const void *> (6));
+}
+
+static void Replay_TextureSubImage2D (Call &call)
+{
+    TextureSubImage2D (call.Object (0, ObjectTexture), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLint> (3), call.Value<GLsizei> (4), call.Value<GLsizei> (5), call.Value<GLenum> (6), call.Value<GLenum> (7), call.Pointer<const void *> (8));
+}
+
+static void Replay_TextureSubImage3D (Call &call)
+{
+    TextureSubImage3D (call.Object (0, ObjectTexture), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLint> (3), call.Value<GLint> (4), call.Value<GLsizei> (5), call.Value<GLsizei> (6), call.Value<GLsizei> (7), call.Value<GLenum> (8), call.Value<GLenum> (9), call.Pointer<const void *> (10));
+}
+
+static void Replay_CompressedTextureSubImage1D (Call &call)
+{
+    CompressedTextureSubImage1D (call.Object (0, ObjectTexture), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLsizei> (3), call.Value<GLenum> (4), call.Value<GLsizei> (5), call.Pointer<const void *> (6));
+}
+
+static void Replay_CompressedTextureSubImage2D (Call &call)
+{
+    CompressedTextureSubImage2D (call.Object (0, ObjectTexture), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLint> (3), call.Value<GLsizei> (4), call.Value<GLsizei> (5), call.Value<GLenum> (6), call.Value<GLsizei> (7), call.Pointer<const void *> (8));
+}
+
+static void Replay_CompressedTextureSubImage3D (Call &call)
+{
+    CompressedTextureSubImage3D (call.Object (0, ObjectTexture), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLint> (3), call.Value<GLint> (4), call.Value<GLsizei> (5), call.Value<GLsizei> (6), call.Value<GLsizei> (7), call.Value<GLenum> (8), call.Value<GLsizei> (9), call.Pointer<const void *> (10));
+}
+
+static void Replay_CopyTextureSubImage1D (Call &call)
+{
+    CopyTextureSubImage1D (call.Object (0, ObjectTexture), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLint> (3), call.Value<GLint> (4), call.Value<GLsizei> (5));
+}
+
+static void Replay_CopyTextureSubImage2D (Call &call)
+{
+    CopyTextureSubImage2D (call.Object (0, ObjectTexture), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLint> (3), call.Value<GLint> (4), call.Value<GLint> (5), call.Value<GLsizei> (6), call.Value<GLsizei> (7));
+}
+
+static void Replay_CopyTextureSubImage3D (Call &call)
+{
+    CopyTextureSubImage3D (call.Object (0, ObjectTexture), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLint> (3), call.Value<GLint> (4), call.Value<GLint> (5), call.Value<GLint> (6), call.Value<GLsizei> (7), call.Value<GLsizei> (8));
+}
+
+static void Replay_TextureParameterf (Call &call)
+{
+    TextureParameterf (call.Object (0, ObjectTexture), call.Value<GLenum> (1), call.Value<GLfloat> (2));
+}
+
+static void Replay_TextureParameterfv (Call &call)
+{
+    TextureParameterfv (call.Object (0, ObjectTexture), call.Value<GLenum> (1), call.Pointer<const GLfloat *> (2));
+}
+
+static void Replay_TextureParameteri (Call &call)
+{
+    TextureParameteri (call.Object (0, ObjectTexture), call.Value<GLenum> (1), call.Value<GLint> (2));
+}
+
+static void Replay_TextureParameterIiv (Call &call)
+{
+    TextureParameterIiv (call.Object (0, ObjectTexture), call.Value<GLenum> (1), call.Pointer<const GLint *> (2));
+}
+
+static void Replay_TextureParameterIuiv (Call &call)
+{
+    TextureParameterIuiv (call.Object (0, ObjectTexture), call.Value<GLenum> (1), call.Pointer<const GLuint *> (2));
+}
+
+static void Replay_TextureParameteriv (Call &call)
+{
+    TextureParameteriv (call.Object (0, ObjectTexture), call.Value<GLenum> (1), call.Pointer<const GLint *> (2));
+}
+
+static void Replay_GenerateTextureMipmap (Call &call)
+{
+    GenerateTextureMipmap (call.Object (0, ObjectTexture));
+}
+
+static void Replay_BindTextureUnit (Call &call)
+{
+    BindTextureUnit (call.Value<GLuint> (0), call.Object (1, ObjectTexture));
+}
+
+static void Replay_GetTextureImage (Call &call)
+{
+    GetTextureImage (call.Object (0, ObjectTexture), call.Value<GLint> (1), call.Value<GLenum> (2), call.Value<GLenum> (3), call.Value<GLsizei> (4), call.Output<void *> (5));
+}
+
+static void Replay_GetCompressedTextureImage (Call &call)
+{
+    GetCompressedTextureImage (call.Object (0, ObjectTexture), call.Value<GLint> (1), call.Value<GLsizei> (2), call.Output<void *> (3));
+}
+
+static void Replay_GetTextureLevelParameterfv (Call &call)
+{
+    GetTextureLevelParameterfv (call.Object (0, ObjectTexture), call.Value<GLint> (1), call.Value<GLenum> (2), call.Output<GLfloat *> (3));
+}
+
+static void Replay_GetTextureLevelParameteriv (Call &call)
+{
+    GetTextureLevelParameteriv (call.Object (0, ObjectTexture), call.Value<GLint> (1), call.Value<GLenum> (2), call.Output<GLint *> (3));
+}
+
+static void Replay_GetTextureParameterfv (Call &call)
+{
+    GetTextureParameterfv (call.Object (0, ObjectTexture), call.Value<GLenum> (1), call.Output<GLfloat *> (2));
+}
+
+static void Replay_GetTextureParameterIiv (Call &call)
+{
+    GetTextureParameterIiv (call.Object (0, ObjectTexture), call.Value<GLenum> (1), call.Output<GLint *> (2));
+}
+
+static void Replay_GetTextureParameterIuiv (Call &call)
+{
+    GetTextureParameterIuiv (call.Object (0, ObjectTexture), call.Value<GLenum> (1), call.Output<GLuint *> (2));
+}
+
+static void Replay_GetTextureParameteriv (Call &call)
+{
+    GetTextureParameteriv (call.Object (0, ObjectTexture), call.Value<GLenum> (1), call.Output<GLint *> (2));
+}
+
+static void Replay_CreateVertexArrays (Call &call)
+{
+    CreateVertexArrays (call.Value<GLsizei> (0), call.Output<GLuint *> (1));
+    call.MapObjects (1, ObjectVertexArray);
+}
+
+static void Replay_DisableVertexArrayAttrib (Call &call)
+{
+    DisableVertexArrayAttrib (call.Object (0, ObjectVertexArray), call.Value<GLuint> (1));
+}
+
+static void Replay_EnableVertexArrayAttrib (Call &call)
+{
+    EnableVertexArrayAttrib (call.Object (0, ObjectVertexArray), call.Value<GLuint> (1));
+}
+
+static void Replay_VertexArrayElementBuffer (Call &call)
+{
+    VertexArrayElementBuffer (call.Object (0, ObjectVertexArray), call.Object (1, ObjectBuffer));
+}
+
+static void Replay_VertexArrayVertexBuffer (Call &call)
+{
+    VertexArrayVertexBuffer (call.Object (0, ObjectVertexArray), call.Value<GLuint> (1), call.Object (2, ObjectBuffer), call.Value<GLintptr> (3), call.Value<GLsizei> (4));
+}
+
+static void Replay_VertexArrayVertexBuffers (Call &call)
+{
+    VertexArrayVertexBuffers (call.Object (0, ObjectVertexArray), call.Value<GLuint> (1), call.Value<GLsizei> (2), call.Objects (3, ObjectBuffer), call.Pointer<const GLintptr *> (4), call.Pointer<const GLsizei *> (5));
+}
+
+static void Replay_VertexArrayAttribBinding (Call &call)
+{
+    VertexArrayAttribBinding (call.Object (0, ObjectVertexArray), call.Value<GLuint> (1), call.Value<GLuint> (2));
+}
+
+static void Replay_VertexArrayAttribFormat (Call &call)
+{
+    VertexArrayAttribFormat (call.Object (0, ObjectVertexArray), call.Value<GLuint> (1), call.Value<GLint> (2), call.Value<GLenum> (3), call.Value<GLboolean> (4), call.Value<GLuint> (5));
+}
+
+static void Replay_VertexArrayAttribIFormat (Call &call)
+{
+    VertexArrayAttribIFormat (call.Object (0, ObjectVertexArray), call.Value<GLuint> (1), call.Value<GLint> (2), call.Value<GLenum> (3), call.Value<GLuint> (4));
+}
+
+static void Replay_VertexArrayAttribLFormat (Call &call)
+{
+    VertexArrayAttribLFormat (call.Object (0, ObjectVertexArray), call.Value<GLuint> (1), call.Value<GLint> (2), call.Value<GLenum> (3), call.Value<GLuint> (4));
+}
+
+static void Replay_VertexArrayBindingDivisor (Call &call)
+{
+    VertexArrayBindingDivisor (call.Object (0, ObjectVertexArray), call.Value<GLuint> (1), call.Value<GLuint> (2));
+}
+
+static void Replay_GetVertexArrayiv (Call &call)
+{
+    GetVertexArrayiv (call.Object (0, ObjectVertexArray), call.Value<GLenum> (1), call.Output<GLint *> (2));
+}
+
+static void Replay_GetVertexArrayIndexediv (Call &call)
+{
+    GetVertexArrayIndexediv (call.Object (0, ObjectVertexArray), call.Value<GLuint> (1), call.Value<GLenum> (2), call.Output<GLint *> (3));
+}
+
+static void Replay_GetVertexArrayIndexed64iv (Call &call)
+{
+    GetVertexArrayIndexed64iv (call.Object (0, ObjectVertexArray), call.Value<GLuint> (1), call.Value<GLenum> (2), call.Output<GLint64 *> (3));
+}
+
+static void Replay_CreateSamplers (Call &call)
+{
+    CreateSamplers (call.Value<GLsizei> (0), call.Output<GLuint *> (1));
+    call.MapObjects (1, ObjectSampler);
+}
+
+static void Replay_CreateProgramPipelines (Call &call)
+{
+    CreateProgramPipelines (call.Value<GLsizei> (0), call.Output<GLuint *> (1));
+    call.MapObjects (1, ObjectPipeline);
+}
+
+static void Replay_CreateQueries (Call &call)
+{
+    CreateQueries (call.Value<GLenum> (0), call.Value<GLsizei> (1), call.Output<GLuint *> (2));
+    call.MapObjects (2, ObjectQuery);
+}
+
+static void Replay_GetQueryBufferObjecti64v (Call &call)
+{
+    GetQueryBufferObjecti64v (call.Object (0, ObjectQuery), call.Object (1, ObjectBuffer), call.Value<GLenum> (2), call.Value<GLintptr> (3));
+}
+
+static void Replay_GetQueryBufferObjectiv (Call &call)
+{
+    GetQueryBufferObjectiv (call.Object (0, ObjectQuery), call.Object (1, ObjectBuffer), call.Value<GLenum> (2), call.Value<GLintptr> (3));
+}
+
+static void Replay_GetQueryBufferObjectui64v (Call &call)
+{
+    GetQueryBufferObjectui64v (call.Object (0, ObjectQuery), call.Object (1, ObjectBuffer), call.Value<GLenum> (2), call.Value<GLintptr> (3));
+}
+
+static void Replay_GetQueryBufferObjectuiv (Call &call)
+{
+    GetQueryBufferObjectuiv (call.Object (0, ObjectQuery), call.Object (1, ObjectBuffer), call.Value<GLenum> (2), call.Value<GLintptr> (3));
+}
+
+static void Replay_MemoryBarrierByRegion (Call &call)
+{
+    MemoryBarrierByRegion (call.Value<GLbitfield> (0));
+}
+
+static void Replay_GetTextureSubImage (Call &call)
+{
+    GetTextureSubImage (call.Object (0, ObjectTexture), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLint> (3), call.Value<GLint> (4), call.Value<GLsizei> (5), call.Value<GLsizei> (6), call.Value<GLsizei> (7), call.Value<GLenum> (8), call.Value<GLenum> (9), call.Value<GLsizei> (10), call.Output<void *> (11));
+}
+
+static void Replay_GetCompressedTextureSubImage (Call &call)
+{
+    GetCompressedTextureSubImage (call.Object (0, ObjectTexture), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLint> (3), call.Value<GLint> (4), call.Value<GLsizei> (5), call.Value<GLsizei> (6), call.Value<GLsizei> (7), call.Value<GLsizei> (8), call.Output<void *> (9));
+}
+
+static void Replay_GetGraphicsResetStatus (Call &call)
+{
+    (void) call;
+    GetGraphicsResetStatus ();
+}
+
+static void Replay_GetnCompressedTexImage (Call &call)
+{
+    GetnCompressedTexImage (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLsizei> (2), call.Output<void *> (3));
+}
+
+static void Replay_GetnTexImage (Call &call)
+{
+    GetnTexImage (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLenum> (2), call.Value<GLenum> (3), call.Value<GLsizei> (4), call.Output<void *> (5));
+}
+
+static void Replay_GetnUniformdv (Call &call)
+{
+    GetnUniformdv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Output<GLdouble *> (3));
+}
+
+static void Replay_GetnUniformfv (Call &call)
+{
+    GetnUniformfv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Output<GLfloat *> (3));
+}
+
+static void Replay_GetnUniformiv (Call &call)
+{
+    GetnUniformiv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Output<GLint *> (3));
+}
+
+static void Replay_GetnUniformuiv (Call &call)
+{
+    GetnUniformuiv (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Output<GLuint *> (3));
+}
+
+static void Replay_ReadnPixels (Call &call)
+{
+    ReadnPixels (call.Value<GLint> (0), call.Value<GLint> (1), call.Value<GLsizei> (2), call.Value<GLsizei> (3), call.Value<GLenum> (4), call.Value<GLenum> (5), call.Value<GLsizei> (6), call.Output<void *> (7));
+}
+
+static void Replay_TextureBarrier (Call &call)
+{
+    (void) call;
+    TextureBarrier ();
+}
+
+static void Replay_GetTextureHandleARB (Call &call)
+{
+    GetTextureHandleARB (call.Object (0, ObjectTexture));
+}
+
+static void Replay_GetTextureSamplerHandleARB (Call &call)
+{
+    GetTextureSamplerHandleARB (call.Object (0, ObjectTexture), call.Object (1, ObjectSampler));
+}
+
+static void Replay_MakeTextureHandleResidentARB (Call &call)
+{
+    MakeTextureHandleResidentARB (call.Value<GLuint64> (0));
+}
+
+static void Replay_MakeTextureHandleNonResidentARB (Call &call)
+{
+    MakeTextureHandleNonResidentARB (call.Value<GLuint64> (0));
+}
+
+static void Replay_GetImageHandleARB (Call &call)
+{
+    GetImageHandleARB (call.Object (0, ObjectTexture), call.Value<GLint> (1), call.Value<GLboolean> (2), call.Value<GLint> (3), call.Value<GLenum> (4));
+}
+
+static void Replay_MakeImageHandleResidentARB (Call &call)
+{
+    MakeImageHandleResidentARB (call.Value<GLuint64> (0), call.Value<GLenum> (1));
+}
+
+static void Replay_MakeImageHandleNonResidentARB (Call &call)
+{
+    MakeImageHandleNonResidentARB (call.Value<GLuint64> (0));
+}
+
+static void Replay_UniformHandleui64ARB (Call &call)
+{
+    UniformHandleui64ARB (call.Value<GLint> (0), call.Value<GLuint64> (1));
+}
+
+static void Replay_UniformHandleui64vARB (Call &call)
+{
+    UniformHandleui64vARB (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Pointer<const GLuint64 *> (2));
+}
+
+static void Replay_ProgramUniformHandleui64ARB (Call &call)
+{
+    ProgramUniformHandleui64ARB (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLuint64> (2));
+}
+
+static void Replay_ProgramUniformHandleui64vARB (Call &call)
+{
+    ProgramUniformHandleui64vARB (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Pointer<const GLuint64 *> (3));
+}
+
+static void Replay_IsTextureHandleResidentARB (Call &call)
+{
+    IsTextureHandleResidentARB (call.Value<GLuint64> (0));
+}
+
+static void Replay_IsImageHandleResidentARB (Call &call)
+{
+    IsImageHandleResidentARB (call.Value<GLuint64> (0));
+}
+
+static void Replay_VertexAttribL1ui64ARB (Call &call)
+{
+    VertexAttribL1ui64ARB (call.Value<GLuint> (0), call.Value<GLuint64EXT> (1));
+}
+
+static void Replay_VertexAttribL1ui64vARB (Call &call)
+{
+    VertexAttribL1ui64vARB (call.Value<GLuint> (0), call.Pointer<const GLuint64EXT *> (1));
+}
+
+static void Replay_GetVertexAttribLui64vARB (Call &call)
+{
+    GetVertexAttribLui64vARB (call.Value<GLuint> (0), call.Value<GLenum> (1), call.Output<GLuint64EXT *> (2));
+}
+
+static void Replay_DispatchComputeGroupSizeARB (Call &call)
+{
+    DispatchComputeGroupSizeARB (call.Value<GLuint> (0), call.Value<GLuint> (1), call.Value<GLuint> (2), call.Value<GLuint> (3), call.Value<GLuint> (4), call.Value<GLuint> (5));
+}
+
+static void Replay_DebugMessageControlARB (Call &call)
+{
+    DebugMessageControlARB (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Value<GLenum> (2), call.Value<GLsizei> (3), call.Pointer<const GLuint *> (4), call.Value<GLboolean> (5));
+}
+
+static void Replay_DebugMessageInsertARB (Call &call)
+{
+    DebugMessageInsertARB (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Value<GLuint> (2), call.Value<GLenum> (3), call.Value<GLsizei> (4), call.Pointer<const GLchar *> (5));
+}
+
+static void Replay_DebugMessageCallbackARB (Call &call)
+{
+    DebugMessageCallbackARB (NULL, call.Pointer<const void *> (1));
+}
+
+static void Replay_GetDebugMessageLogARB (Call &call)
+{
+    GetDebugMessageLogARB (call.Value<GLuint> (0), call.Value<GLsizei> (1), call.Output<GLenum *> (2), call.Output<GLenum *> (3), call.Output<GLuint *> (4), call.Output<GLenum *> (5), call.Output<GLsizei *> (6), call.Output<GLchar *> (7));
+}
+
+static void Replay_BlendEquationiARB (Call &call)
+{
+    BlendEquationiARB (call.Value<GLuint> (0), call.Value<GLenum> (1));
+}
+
+static void Replay_BlendEquationSeparateiARB (Call &call)
+{
+    BlendEquationSeparateiARB (call.Value<GLuint> (0), call.Value<GLenum> (1), call.Value<GLenum> (2));
+}
+
+static void Replay_BlendFunciARB (Call &call)
+{
+    BlendFunciARB (call.Value<GLuint> (0), call.Value<GLenum> (1), call.Value<GLenum> (2));
+}
+
+static void Replay_BlendFuncSeparateiARB (Call &call)
+{
+    BlendFuncSeparateiARB (call.Value<GLuint> (0), call.Value<GLenum> (1), call.Value<GLenum> (2), call.Value<GLenum> (3), call.Value<GLenum> (4));
+}
+
+static void Replay_MultiDrawArraysIndirectCountARB (Call &call)
+{
+    MultiDrawArraysIndirectCountARB (call.Value<GLenum> (0), call.Value<GLintptr> (1), call.Value<GLintptr> (2), call.Value<GLsizei> (3), call.Value<GLsizei> (4));
+}
+
+static void Replay_MultiDrawElementsIndirectCountARB (Call &call)
+{
+    MultiDrawElementsIndirectCountARB (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Value<GLintptr> (2), call.Value<GLintptr> (3), call.Value<GLsizei> (4), call.Value<GLsizei> (5));
+}
+
+static void Replay_GetGraphicsResetStatusARB (Call &call)
+{
+    (void) call;
+    GetGraphicsResetStatusARB ();
+}
+
+static void Replay_GetnTexImageARB (Call &call)
+{
+    GetnTexImageARB (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLenum> (2), call.Value<GLenum> (3), call.Value<GLsizei> (4), call.Output<void *> (5));
+}
+
+static void Replay_ReadnPixelsARB (Call &call)
+{
+    ReadnPixelsARB (call.Value<GLint> (0), call.Value<GLint> (1), call.Value<GLsizei> (2), call.Value<GLsizei> (3), call.Value<GLenum> (4), call.Value<GLenum> (5), call.Value<GLsizei> (6), call.Output<void *> (7));
+}
+
+static void Replay_GetnCompressedTexImageARB (Call &call)
+{
+    GetnCompressedTexImageARB (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLsizei> (2), call.Output<void *> (3));
+}
+
+static void Replay_GetnUniformfvARB (Call &call)
+{
+    GetnUniformfvARB (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Output<GLfloat *> (3));
+}
+
+static void Replay_GetnUniformivARB (Call &call)
+{
+    GetnUniformivARB (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Output<GLint *> (3));
+}
+
+static void Replay_GetnUniformuivARB (Call &call)
+{
+    GetnUniformuivARB (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Output<GLuint *> (3));
+}
+
+static void Replay_GetnUniformdvARB (Call &call)
+{
+    GetnUniformdvARB (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Output<GLdouble *> (3));
+}
+
+static void Replay_MinSampleShadingARB (Call &call)
+{
+    MinSampleShadingARB (call.Value<GLfloat> (0));
+}
+
+static void Replay_NamedStringARB (Call &call)
+{
+    NamedStringARB (call.Value<GLenum> (0), call.Value<GLint> (1), call.Pointer<const GLchar *> (2), call.Value<GLint> (3), call.Pointer<const GLchar *> (4));
+}
+
+static void Replay_DeleteNamedStringARB (Call &call)
+{
+    DeleteNamedStringARB (call.Value<GLint> (0), call.Pointer<const GLchar *> (1));
+}
+
+static void Replay_CompileShaderIncludeARB (Call &call)
+{
+    CompileShaderIncludeARB (call.Object (0, ObjectShader), call.Value<GLsizei> (1), call.Strings (2), call.StringLengths (2));
+}
+
+static void Replay_IsNamedStringARB (Call &call)
+{
+    IsNamedStringARB (call.Value<GLint> (0), call.Pointer<const GLchar *> (1));
+}
+
+static void Replay_GetNamedStringARB (Call &call)
+{
+    GetNamedStringARB (call.Value<GLint> (0), call.Pointer<const GLchar *> (1), call.Value<GLsizei> (2), call.Output<GLint *> (3), call.Output<GLchar *> (4));
+}
+
+static void Replay_GetNamedStringivARB (Call &call)
+{
+    GetNamedStringivARB (call.Value<GLint> (0), call.Pointer<const GLchar *> (1), call.Value<GLenum> (2), call.Output<GLint *> (3));
+}
+
+static void Replay_BufferPageCommitmentARB (Call &call)
+{
+    BufferPageCommitmentARB (call.Value<GLenum> (0), call.Value<GLintptr> (1), call.Value<GLsizeiptr> (2), call.Value<GLboolean> (3));
+}
+
+static void Replay_NamedBufferPageCommitmentEXT (Call &call)
+{
+    NamedBufferPageCommitmentEXT (call.Object (0, ObjectBuffer), call.Value<GLintptr> (1), call.Value<GLsizeiptr> (2), call.Value<GLboolean> (3));
+}
+
+static void Replay_NamedBufferPageCommitmentARB (Call &call)
+{
+    NamedBufferPageCommitmentARB (call.Object (0, ObjectBuffer), call.Value<GLintptr> (1), call.Value<GLsizeiptr> (2), call.Value<GLboolean> (3));
+}
+
+static void Replay_TexPageCommitmentARB (Call &call)
+{
+    TexPageCommitmentARB (call.Value<GLenum> (0), call.Value<GLint> (1), call.Value<GLint> (2), call.Value<GLint> (3), call.Value<GLint> (4), call.Value<GLsizei> (5), call.Value<GLsizei> (6), call.Value<GLsizei> (7), call.Value<GLboolean> (8));
+}
+
+static void Replay_GetMultisamplefvNV (Call &call)
+{
+    GetMultisamplefvNV (call.Value<GLenum> (0), call.Value<GLuint> (1), call.Output<GLfloat *> (2));
+}
+
+static void Replay_SampleMaskIndexedNV (Call &call)
+{
+    SampleMaskIndexedNV (call.Value<GLuint> (0), call.Value<GLbitfield> (1));
+}
+
+static void Replay_TexRenderbufferNV (Call &call)
+{
+    TexRenderbufferNV (call.Value<GLenum> (0), call.Value<GLuint> (1));
+}
+
+static void Replay_MakeBufferResidentNV (Call &call)
+{
+    MakeBufferResidentNV (call.Value<GLenum> (0), call.Value<GLenum> (1));
+}
+
+static void Replay_MakeBufferNonResidentNV (Call &call)
+{
+    MakeBufferNonResidentNV (call.Value<GLenum> (0));
+}
+
+static void Replay_IsBufferResidentNV (Call &call)
+{
+    IsBufferResidentNV (call.Value<GLenum> (0));
+}
+
+static void Replay_MakeNamedBufferResidentNV (Call &call)
+{
+    MakeNamedBufferResidentNV (call.Object (0, ObjectBuffer), call.Value<GLenum> (1));
+}
+
+static void Replay_MakeNamedBufferNonResidentNV (Call &call)
+{
+    MakeNamedBufferNonResidentNV (call.Object (0, ObjectBuffer));
+}
+
+static void Replay_IsNamedBufferResidentNV (Call &call)
+{
+    IsNamedBufferResidentNV (call.Object (0, ObjectBuffer));
+}
+
+static void Replay_GetBufferParameterui64vNV (Call &call)
+{
+    GetBufferParameterui64vNV (call.Value<GLenum> (0), call.Value<GLenum> (1), call.Output<GLuint64EXT *> (2));
+}
+
+static void Replay_GetNamedBufferParameterui64vNV (Call &call)
+{
+    GetNamedBufferParameterui64vNV (call.Object (0, ObjectBuffer), call.Value<GLenum> (1), call.Output<GLuint64EXT *> (2));
+}
+
+static void Replay_GetIntegerui64vNV (Call &call)
+{
+    GetIntegerui64vNV (call.Value<GLenum> (0), call.Output<GLuint64EXT *> (1));
+}
+
+static void Replay_Uniformui64NV (Call &call)
+{
+    Uniformui64NV (call.Value<GLint> (0), call.Value<GLuint64EXT> (1));
+}
+
+static void Replay_Uniformui64vNV (Call &call)
+{
+    Uniformui64vNV (call.Value<GLint> (0), call.Value<GLsizei> (1), call.Pointer<const GLuint64EXT *> (2));
+}
+
+static void Replay_ProgramUniformui64NV (Call &call)
+{
+    ProgramUniformui64NV (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLuint64EXT> (2));
+}
+
+static void Replay_ProgramUniformui64vNV (Call &call)
+{
+    ProgramUniformui64vNV (call.Object (0, ObjectProgram), call.Location (0, 1), call.Value<GLsizei> (2), call.Pointer<const GLuint64EXT *> (3));
+}
+
+static void Replay_BufferAddressRangeNV (Call &call)
+{
+    BufferAddressRangeNV (call.Value<GLenum> (0), call.Value<GLuint> (1), call.Value<GLuint64EXT> (2), call.Value<GLsizeiptr> (3));
+}
+
+static void Replay_VertexFormatNV (Call &call)
+{
+    VertexFormatNV (call.Value<GLint> (0), call.Value<GLenum> (1), call.Value<GLsizei> (2));
+}
+
+static void Replay_NormalFormatNV (Call &call)
+{
+    NormalFormatNV (call.Value<GLenum> (0), call.Value<GLsizei> (1));
+}
+
+static void Replay_ColorFormatNV (Call &call)
+{
+    ColorFormatNV (call.Value<GLint> (0), call.Value<GLenum> (1), call.Value<GLsizei> (2));
+}
+
+static void Replay_IndexFormatNV (Call &call)
+{
+    IndexFormatNV (call.Value<GLenum> (0), call.Value<GLsizei> (1));
+}
+
+static void Replay_TexCoordFormatNV (Call &call)
+{
+    TexCoordFormatNV (call.Value<GLint> (0), call.Value<GLenum> (1), call.Value<GLsizei> (2));
+}
+
+static void Replay_EdgeFlagFormatNV (Call &call)
+{
+    EdgeFlagFormatNV (call.Value<GLsizei> (0));
+}
+
+static void Replay_SecondaryColorFormatNV (Call &call)
+{
+    SecondaryColorFormatNV (call.Value<GLint> (0), call.Value<GLenum> (1), call.Value<GLsizei> (2));
+}
+
+static void Replay_FogCoordFormatNV (Call &call)
+{
+    FogCoordFormatNV (call.Value<GLenum> (0), call.Value<GLsizei> (1));
+}
+
+static void Replay_VertexAttribFormatNV (Call &call)
+{
+    VertexAttribFormatNV (call.Value<GLuint> (0), call.Value<GLint> (1), call.Value<GLenum> (2), call.Value<GLboolean> (3), call.Value<GLsizei> (4));
+}
+
+static void Replay_VertexAttribIFormatNV (Call &call)
+{
+    VertexAttribIFormatNV (call.Value<GLuint> (0), call.Value<GLint> (1), call.Value<GLenum> (2), call.Value<GLsizei> (3));
+}
+
+static void Replay_GetIntegerui64i_vNV (Call &call)
+{
+    GetIntegerui64i_vNV (call.Value<GLenum> (0), call.Value<GLuint> (1), call.Output<GLuint64EXT *> (2));
+}
+
+static void Replay_EnableClientState (Call &call)
+{
+    EnableClientState (call.Value<GLenum> (0));
+}
+
+static void Replay_DisableClientState (Call &call)
+{
+    DisableClientState (call.Value<GLenum> (0));
+}
+
+const unsigned int NumReplayProcs = 730;
+
+const ReplayProc ReplayProcs[NumReplayProcs] = {
+    { "glCullFace", 1, Replay_CullFace },
+    { "glFrontFace", 1, Replay_FrontFace },
+    { "glHint", 2, Replay_Hint },
+    { "glLineWidth", 1, Replay_LineWidth },
+    { "glPointSize", 1, Replay_PointSize },
+    { "glPolygonMode", 2, Replay_PolygonMode },
+    { "glScissor", 4, Replay_Scissor },
+    { "glTexParameterf", 3, Replay_TexParameterf },
+    { "glTexParameterfv", 3, Replay_TexParameterfv },
+    { "glTexParameteri", 3, Replay_TexParameteri },
+    { "glTexParameteriv", 3, Replay_TexParameteriv },
+    { "glTexImage1D", 8, Replay_TexImage1D },
+    { "glTexImage2D", 9, Replay_TexImage2D },
+    { "glDrawBuffer", 1, Replay_DrawBuffer },
+    { "glClear", 1, Replay_Clear },
+    { "glClearColor", 4, Replay_ClearColor },
+    { "glClearStencil", 1, Replay_ClearStencil },
+    { "glClearDepth", 1, Replay_ClearDepth },
+    { "glStencilMask", 1, Replay_StencilMask },
+    { "glColorMask", 4, Replay_ColorMask },
+    { "glDepthMask", 1, Replay_DepthMask },
+    { "glDisable", 1, Replay_Disable },
+    { "glEnable", 1, Replay_Enable },
+    { "glFinish", 0, Replay_Finish },
+    { "glFlush", 0, Replay_Flush },
+    { "glBlendFunc", 2, Replay_BlendFunc },
+    { "glLogicOp", 1, Replay_LogicOp },
+    { "glStencilFunc", 3, Replay_StencilFunc },
+    { "glStencilOp", 3, Replay_StencilOp },
+    { "glDepthFunc", 1, Replay_DepthFunc },
+    { "glPixelStoref", 2, Replay_PixelStoref },
+    { "glPixelStorei", 2, Replay_PixelStorei },
+    { "glReadBuffer", 1, Replay_ReadBuffer },
+    { "glReadPixels", 7, Replay_ReadPixels },
+    { "glGetBooleanv", 2, Replay_GetBooleanv },
+    { "glGetDoublev", 2, Replay_GetDoublev },
+    { "glGetError", 0, Replay_GetError },
+    { "glGetFloatv", 2, Replay_GetFloatv },
+    { "glGetIntegerv", 2, Replay_GetIntegerv },
+    { "glGetString", 1, Replay_GetString },
+    { "glGetTexImage", 5, Replay_GetTexImage },
+    { "glGetTexParameterfv", 3, Replay_GetTexParameterfv },
+    { "glGetTexParameteriv", 3, Replay_GetTexParameteriv },
+    { "glGetTexLevelParameterfv", 4, Replay_GetTexLevelParameterfv },
+    { "glGetTexLevelParameteriv", 4, Replay_GetTexLevelParameteriv },
+    { "glIsEnabled", 1, Replay_IsEnabled },
+    { "glDepthRange", 2, Replay_DepthRange },
+    { "glViewport", 4, Replay_Viewport },
+    { "glDrawArrays", 3, Replay_DrawArrays },
+    { "glDrawElements", 4, Replay_DrawElements },
+    { "glGetPointerv", 2, Replay_GetPointerv },
+    { "glPolygonOffset", 2, Replay_PolygonOffset },
+    { "glCopyTexImage1D", 7, Replay_CopyTexImage1D },
+    { "glCopyTexImage2D", 8, Replay_CopyTexImage2D },
+    { "glCopyTexSubImage1D", 6, Replay_CopyTexSubImage1D },
+    { "glCopyTexSubImage2D", 8, Replay_CopyTexSubImage2D },
+    { "glTexSubImage1D", 7, Replay_TexSubImage1D },
+    { "glTexSubImage2D", 9, Replay_TexSubImage2D },
+    { "glBindTexture", 2, Replay_BindTexture },
+    { "glDeleteTextures", 2, Replay_DeleteTextures },
+    { "glGenTextures", 2, Replay_GenTextures },
+    { "glIsTexture", 1, Replay_IsTexture },
+    { "glDrawRangeElements", 6, Replay_DrawRangeElements },
+    { "glTexImage3D", 10, Replay_TexImage3D },
+    { "glTexSubImage3D", 11, Replay_TexSubImage3D },
+    { "glCopyTexSubImage3D", 9, Replay_CopyTexSubImage3D },
+    { "glActiveTexture", 1, Replay_ActiveTexture },
+    { "glSampleCoverage", 2, Replay_SampleCoverage },
+    { "glCompressedTexImage3D", 9, Replay_CompressedTexImage3D },
+    { "glCompressedTexImage2D", 8, Replay_CompressedTexImage2D },
+    { "glCompressedTexImage1D", 7, Replay_CompressedTexImage1D },
+    { "glCompressedTexSubImage3D", 11, Replay_CompressedTexSubImage3D },
+    { "glCompressedTexSubImage2D", 9, Replay_CompressedTexSubImage2D },
+    { "glCompressedTexSubImage1D", 7, Replay_CompressedTexSubImage1D },
+    { "glGetCompressedTexImage", 3, Replay_GetCompressedTexImage },
+    { "glBlendFuncSeparate", 4, Replay_BlendFuncSeparate },
+    { "glMultiDrawArrays", 4, Replay_MultiDrawArrays },
+    { "glMultiDrawElements", 5, Replay_MultiDrawElements },
+    { "glPointParameterf", 2, Replay_PointParameterf },
+    { "glPointParameterfv", 2, Replay_PointParameterfv },
+    { "glPointParameteri", 2, Replay_PointParameteri },
+    { "glPointParameteriv", 2, Replay_PointParameteriv },
+    { "glBlendColor", 4, Replay_BlendColor },
+    { "glBlendEquation", 1, Replay_BlendEquation },
+    { "glGenQueries", 2, Replay_GenQueries },
+    { "glDeleteQueries", 2, Replay_DeleteQueries },
+    { "glIsQuery", 1, Replay_IsQuery },
+    { "glBeginQuery", 2, Replay_BeginQuery },
+    { "glEndQuery", 1, Replay_EndQuery },
+    { "glGetQueryiv", 3, Replay_GetQueryiv },
+    { "glGetQueryObjectiv", 3, Replay_GetQueryObjectiv },
+    { "glGetQueryObjectuiv", 3, Replay_GetQueryObjectuiv },
+    { "glBindBuffer", 2, Replay_BindBuffer },
+    { "glDeleteBuffers", 2, Replay_DeleteBuffers },
+    { "glGenBuffers", 2, Replay_GenBuffers },
+    { "glIsBuffer", 1, Replay_IsBuffer },
+    { "glBufferData", 4, Replay_BufferData },
+    { "glBufferSubData", 4, Replay_BufferSubData },
+    { "glGetBufferSubData", 4, Replay_GetBufferSubData },
+    { "glMapBuffer", 2, Replay_MapBuffer },
+    { "glUnmapBuffer", 1, Replay_UnmapBuffer },
+    { "glGetBufferParameteriv", 3, Replay_GetBufferParameteriv },
+    { "glGetBufferPointerv", 3, Replay_GetBufferPointerv },
+    { "glBlendEquationSeparate", 2, Replay_BlendEquationSeparate },
+    { "glDrawBuffers", 2, Replay_DrawBuffers },
+    { "glStencilOpSeparate", 4, Replay_StencilOpSeparate },
+    { "glStencilFuncSeparate", 4, Replay_StencilFuncSeparate },
+    { "glStencilMaskSeparate", 2, Replay_StencilMaskSeparate },
+    { "glAttachShader", 2, Replay_AttachShader },
+    { "glBindAttribLocation", 3, Replay_BindAttribLocation },
+    { "glCompileShader", 1, Replay_CompileShader },
+    { "glCreateProgram", 0, Replay_CreateProgram },
+    { "glCreateShader", 1, Replay_CreateShader },
+    { "glDeleteProgram", 1, Replay_DeleteProgram },
+    { "glDeleteShader", 1, Replay_DeleteShader },
+    { "glDetachShader", 2, Replay_DetachShader },
+    { "glDisableVertexAttribArray", 1, Replay_DisableVertexAttribArray },
+    { "glEnableVertexAttribArray", 1, Replay_EnableVertexAttribArray },
+    { "glGetActiveAttrib", 7, Replay_GetActiveAttrib },
+    { "glGetActiveUniform", 7, Replay_GetActiveUniform },
+    { "glGetAttachedShaders", 4, Replay_GetAttachedShaders },
+    { "glGetAttribLocation", 2, Replay_GetAttribLocation },
+    { "glGetProgramiv", 3, Replay_GetProgramiv },
+    { "glGetProgramInfoLog", 4, Replay_GetProgramInfoLog },
+    { "glGetShaderiv", 3, Replay_GetShaderiv },
+    { "glGetShaderInfoLog", 4, Replay_GetShaderInfoLog },
+    { "glGetShaderSource", 4, Replay_GetShaderSource },
+    { "glGetUniformLocation", 2, Replay_GetUniformLocation },
+    { "glGetUniformfv", 3, Replay_GetUniformfv },
+    { "glGetUniformiv", 3, Replay_GetUniformiv },
+    { "glGetVertexAttribdv", 3, Replay_GetVertexAttribdv },
+    { "glGetVertexAttribfv", 3, Replay_GetVertexAttribfv },
+    { "glGetVertexAttribiv", 3, Replay_GetVertexAttribiv },
+    { "glGetVertexAttribPointerv", 3, Replay_GetVertexAttribPointerv },
+    { "glIsProgram", 1, Replay_IsProgram },
+    { "glIsShader", 1, Replay_IsShader },
+    { "glLinkProgram", 1, Replay_LinkProgram },
+    { "glShaderSource", 4, Replay_ShaderSource },
+    { "glUseProgram", 1, Replay_UseProgram },
+    { "glUniform1f", 2, Replay_Uniform1f },
+    { "glUniform2f", 3, Replay_Uniform2f },
+    { "glUniform3f", 4, Replay_Uniform3f },
+    { "glUniform4f", 5, Replay_Uniform4f },
+    { "glUniform1i", 2, Replay_Uniform1i },
+    { "glUniform2i", 3, Replay_Uniform2i },
+    { "glUniform3i", 4, Replay_Uniform3i },
+    { "glUniform4i", 5, Replay_Uniform4i },
+    { "glUniform1fv", 3, Replay_Uniform1fv },
+    { "glUniform2fv", 3, Replay_Uniform2fv },
+    { "glUniform3fv", 3, Replay_Uniform3fv },
+    { "glUniform4fv", 3, Replay_Uniform4fv },
+    { "glUniform1iv", 3, Replay_Uniform1iv },
+    { "glUniform2iv", 3, Replay_Uniform2iv },
+    { "glUniform3iv", 3, Replay_Uniform3iv },
+    { "glUniform4iv", 3, Replay_Uniform4iv },
+    { "glUniformMatrix2fv", 4, Replay_UniformMatrix2fv },
+    { "glUniformMatrix3fv", 4, Replay_UniformMatrix3fv },
+    { "glUniformMatrix4fv", 4, Replay_UniformMatrix4fv },
+    { "glValidateProgram", 1, Replay_ValidateProgram },
+    { "glVertexAttrib1d", 2, Replay_VertexAttrib1d },
+    { "glVertexAttrib1dv", 2, Replay_VertexAttrib1dv },
+    { "glVertexAttrib1f", 2, Replay_VertexAttrib1f },
+    { "glVertexAttrib1fv", 2, Replay_VertexAttrib1fv },
+    { "glVertexAttrib1s", 2, Replay_VertexAttrib1s },
+    { "glVertexAttrib1sv", 2, Replay_VertexAttrib1sv },
+    { "glVertexAttrib2d", 3, Replay_VertexAttrib2d },
+    { "glVertexAttrib2dv", 2, Replay_VertexAttrib2dv },
+    { "glVertexAttrib2f", 3, Replay_VertexAttrib2f },
+    { "glVertexAttrib2fv", 2, Replay_VertexAttrib2fv },
+    { "glVertexAttrib2s", 3, Replay_VertexAttrib2s },
+    { "glVertexAttrib2sv", 2, Replay_VertexAttrib2sv },
+    { "glVertexAttrib3d", 4, Replay_VertexAttrib3d },
+    { "glVertexAttrib3dv", 2, Replay_VertexAttrib3dv },
+    { "glVertexAttrib3f", 4, Replay_VertexAttrib3f },
+    { "glVertexAttrib3fv", 2, Replay_VertexAttrib3fv },
+    { "glVertexAttrib3s", 4, Replay_VertexAttrib3s },
+    { "glVertexAttrib3sv", 2, Replay_VertexAttrib3sv },
+    { "glVertexAttrib4Nbv", 2, Replay_VertexAttrib4Nbv },
+    { "glVertexAttrib4Niv", 2, Replay_VertexAttrib4Niv },
+    { "glVertexAttrib4Nsv", 2, Replay_VertexAttrib4Nsv },
+    { "glVertexAttrib4Nub", 5, Replay_VertexAttrib4Nub },
+    { "glVertexAttrib4Nubv", 2, Replay_VertexAttrib4Nubv },
+    { "glVertexAttrib4Nuiv", 2, Replay_VertexAttrib4Nuiv },
+    { "glVertexAttrib4Nusv", 2, Replay_VertexAttrib4Nusv },
+    { "glVertexAttrib4bv", 2, Replay_VertexAttrib4bv },
+    { "glVertexAttrib4d", 5, Replay_VertexAttrib4d },
+    { "glVertexAttrib4dv", 2, Replay_VertexAttrib4dv },
+    { "glVertexAttrib4f", 5, Replay_VertexAttrib4f },
+    { "glVertexAttrib4fv", 2, Replay_VertexAttrib4fv },
+    { "glVertexAttrib4iv", 2, Replay_VertexAttrib4iv },
+    { "glVertexAttrib4s", 5, Replay_VertexAttrib4s },
+    { "glVertexAttrib4sv", 2, Replay_VertexAttrib4sv },
+    { "glVertexAttrib4ubv", 2, Replay_VertexAttrib4ubv },
+    { "glVertexAttrib4uiv", 2, Replay_VertexAttrib4uiv },
+    { "glVertexAttrib4usv", 2, Replay_VertexAttrib4usv },
+    { "glVertexAttribPointer", 6, Replay_VertexAttribPointer },
+    { "glUniformMatrix2x3fv", 4, Replay_UniformMatrix2x3fv },
+    { "glUniformMatrix3x2fv", 4, Replay_UniformMatrix3x2fv },
+    { "glUniformMatrix2x4fv", 4, Replay_UniformMatrix2x4fv },
+    { "glUniformMatrix4x2fv", 4, Replay_UniformMatrix4x2fv },
+    { "glUniformMatrix3x4fv", 4, Replay_UniformMatrix3x4fv },
+    { "glUniformMatrix4x3fv", 4, Replay_UniformMatrix4x3fv },
+    { "glColorMaski", 5, Replay_ColorMaski },
+    { "glGetBooleani_v", 3, Replay_GetBooleani_v },
+    { "glGetIntegeri_v", 3, Replay_GetIntegeri_v },
+    { "glEnablei", 2, Replay_Enablei },
+    { "glDisablei", 2, Replay_Disablei },
+    { "glIsEnabledi", 2, Replay_IsEnabledi },
+    { "glBeginTransformFeedback", 1, Replay_BeginTransformFeedback },
+    { "glEndTransformFeedback", 0, Replay_EndTransformFeedback },
+    { "glBindBufferRange", 5, Replay_BindBufferRange },
+    { "glBindBufferBase", 3, Replay_BindBufferBase },
+    { "glTransformFeedbackVaryings", 4, Replay_TransformFeedbackVaryings },
+    { "glGetTransformFeedbackVarying", 7, Replay_GetTransformFeedbackVarying },
+    { "glClampColor", 2, Replay_ClampColor },
+    { "glBeginConditionalRender", 2, Replay_BeginConditionalRender },
+    { "glEndConditionalRender", 0, Replay_EndConditionalRender },
+    { "glVertexAttribIPointer", 5, Replay_VertexAttribIPointer },
+    { "glGetVertexAttribIiv", 3, Replay_GetVertexAttribIiv },
+    { "glGetVertexAttribIuiv", 3, Replay_GetVertexAttribIuiv },
+    { "glVertexAttribI1i", 2, Replay_VertexAttribI1i },
+    { "glVertexAttribI2i", 3, Replay_VertexAttribI2i },
+    { "glVertexAttribI3i", 4, Replay_VertexAttribI3i },
+    { "glVertexAttribI4i", 5, Replay_VertexAttribI4i },
+    { "glVertexAttribI1ui", 2, Replay_VertexAttribI1ui },
+    { "glVertexAttribI2ui", 3, Replay_VertexAttribI2ui },
+    { "glVertexAttribI3ui", 4, Replay_VertexAttribI3ui },
+    { "glVertexAttribI4ui", 5, Replay_VertexAttribI4ui },
+    { "glVertexAttribI1iv", 2, Replay_VertexAttribI1iv },
+    { "glVertexAttribI2iv", 2, Replay_VertexAttribI2iv },
+    { "glVertexAttribI3iv", 2, Replay_VertexAttribI3iv },
+    { "glVertexAttribI4iv", 2, Replay_VertexAttribI4iv },
+    { "glVertexAttribI1uiv", 2, Replay_VertexAttribI1uiv },
+    { "glVertexAttribI2uiv", 2, Replay_VertexAttribI2uiv },
+    { "glVertexAttribI3uiv", 2, Replay_VertexAttribI3uiv },
+    { "glVertexAttribI4uiv", 2, Replay_VertexAttribI4uiv },
+    { "glVertexAttribI4bv", 2, Replay_VertexAttribI4bv },
+    { "glVertexAttribI4sv", 2, Replay_VertexAttribI4sv },
+    { "glVertexAttribI4ubv", 2, Replay_VertexAttribI4ubv },
+    { "glVertexAttribI4usv", 2, Replay_VertexAttribI4usv },
+    { "glGetUniformuiv", 3, Replay_GetUniformuiv },
+    { "glBindFragDataLocation", 3, Replay_BindFragDataLocation },
+    { "glGetFragDataLocation", 2, Replay_GetFragDataLocation },
+    { "glUniform1ui", 2, Replay_Uniform1ui },
+    { "glUniform2ui", 3, Replay_Uniform2ui },
+    { "glUniform3ui", 4, Replay_Uniform3ui },
+    { "glUniform4ui", 5, Replay_Uniform4ui },
+    { "glUniform1uiv", 3, Replay_Uniform1uiv },
+    { "glUniform2uiv", 3, Replay_Uniform2uiv },
+    { "glUniform3uiv", 3, Replay_Uniform3uiv },
+    { "glUniform4uiv", 3, Replay_Uniform4uiv },
+    { "glTexParameterIiv", 3, Replay_TexParameterIiv },
+    { "glTexParameterIuiv", 3, Replay_TexParameterIuiv },
+    { "glGetTexParameterIiv", 3, Replay_GetTexParameterIiv },
+    { "glGetTexParameterIuiv", 3, Replay_GetTexParameterIuiv },
+    { "glClearBufferiv", 3, Replay_ClearBufferiv },
+    { "glClearBufferuiv", 3, Replay_ClearBufferuiv },
+    { "glClearBufferfv", 3, Replay_ClearBufferfv },
+    { "glClearBufferfi", 4, Replay_ClearBufferfi },
+    { "glGetStringi", 2, Replay_GetStringi },
+    { "glIsRenderbuffer", 1, Replay_IsRenderbuffer },
+    { "glBindRenderbuffer", 2, Replay_BindRenderbuffer },
+    { "glDeleteRenderbuffers", 2, Replay_DeleteRenderbuffers },
+    { "glGenRenderbuffers", 2, Replay_GenRenderbuffers },
+    { "glRenderbufferStorage", 4, Replay_RenderbufferStorage },
+    { "glGetRenderbufferParameteriv", 3, Replay_GetRenderbufferParameteriv },
+    { "glIsFramebuffer", 1, Replay_IsFramebuffer },
+    { "glBindFramebuffer", 2, Replay_BindFramebuffer },
+    { "glDeleteFramebuffers", 2, Replay_DeleteFramebuffers },
+    { "glGenFramebuffers", 2, Replay_GenFramebuffers },
+    { "glCheckFramebufferStatus", 1, Replay_CheckFramebufferStatus },
+    { "glFramebufferTexture1D", 5, Replay_FramebufferTexture1D },
+    { "glFramebufferTexture2D", 5, Replay_FramebufferTexture2D },
+    { "glFramebufferTexture3D", 6, Replay_FramebufferTexture3D },
+    { "glFramebufferRenderbuffer", 4, Replay_FramebufferRenderbuffer },
+    { "glGetFramebufferAttachmentParameteriv", 4, Replay_GetFramebufferAttachmentParameteriv },
+    { "glGenerateMipmap", 1, Replay_GenerateMipmap },
+    { "glBlitFramebuffer", 10, Replay_BlitFramebuffer },
+    { "glRenderbufferStorageMultisample", 5, Replay_RenderbufferStorageMultisample },
+    { "glFramebufferTextureLayer", 5, Replay_FramebufferTextureLayer },
+    { "glMapBufferRange", 4, Replay_MapBufferRange },
+    { "glFlushMappedBufferRange", 3, Replay_FlushMappedBufferRange },
+    { "glBindVertexArray", 1, Replay_BindVertexArray },
+    { "glDeleteVertexArrays", 2, Replay_DeleteVertexArrays },
+    { "glGenVertexArrays", 2, Replay_GenVertexArrays },
+    { "glIsVertexArray", 1, Replay_IsVertexArray },
+    { "glDrawArraysInstanced", 4, Replay_DrawArraysInstanced },
+    { "glDrawElementsInstanced", 5, Replay_DrawElementsInstanced },
+    { "glTexBuffer", 3, Replay_TexBuffer },
+    { "glPrimitiveRestartIndex", 1, Replay_PrimitiveRestartIndex },
+    { "glCopyBufferSubData", 5, Replay_CopyBufferSubData },
+    { "glGetUniformIndices", 4, Replay_GetUniformIndices },
+    { "glGetActiveUniformsiv", 5, Replay_GetActiveUniformsiv },
+    { "glGetActiveUniformName", 5, Replay_GetActiveUniformName },
+    { "glGetUniformBlockIndex", 2, Replay_GetUniformBlockIndex },
+    { "glGetActiveUniformBlockiv", 4, Replay_GetActiveUniformBlockiv },
+    { "glGetActiveUniformBlockName", 5, Replay_GetActiveUniformBlockName },
+    { "glUniformBlockBinding", 3, Replay_UniformBlockBinding },
+    { "glDrawElementsBaseVertex", 5, Replay_DrawElementsBaseVertex },
+    { "glDrawRangeElementsBaseVertex", 7, Replay_DrawRangeElementsBaseVertex },
+    { "glDrawElementsInstancedBaseVertex", 6, Replay_DrawElementsInstancedBaseVertex },
+    { "glMultiDrawElementsBaseVertex", 6, Replay_MultiDrawElementsBaseVertex },
+    { "glProvokingVertex", 1, Replay_ProvokingVertex },
+    { "glFenceSync", 2, Replay_FenceSync },
+    { "glIsSync", 1, Replay_IsSync },
+    { "glDeleteSync", 1, Replay_DeleteSync },
+    { "glClientWaitSync", 3, Replay_ClientWaitSync },
+    { "glWaitSync", 3, Replay_WaitSync },
+    { "glGetInteger64v", 2, Replay_GetInteger64v },
+    { "glGetSynciv", 5, Replay_GetSynciv },
+    { "glGetInteger64i_v", 3, Replay_GetInteger64i_v },
+    { "glGetBufferParameteri64v", 3, Replay_GetBufferParameteri64v },
+    { "glFramebufferTexture", 4, Replay_FramebufferTexture },
+    { "glTexImage2DMultisample", 6, Replay_TexImage2DMultisample },
+    { "glTexImage3DMultisample", 7, Replay_TexImage3DMultisample },
+    { "glGetMultisamplefv", 3, Replay_GetMultisamplefv },
+    { "glSampleMaski", 2, Replay_SampleMaski },
+    { "glBindFragDataLocationIndexed", 4, Replay_BindFragDataLocationIndexed },
+    { "glGetFragDataIndex", 2, Replay_GetFragDataIndex },
+    { "glGenSamplers", 2, Replay_GenSamplers },
+    { "glDeleteSamplers", 2, Replay_DeleteSamplers },
+    { "glIsSampler", 1, Replay_IsSampler },
+    { "glBindSampler", 2, Replay_BindSampler },
+    { "glSamplerParameteri", 3, Replay_SamplerParameteri },
+    { "glSamplerParameteriv", 3, Replay_SamplerParameteriv },
+    { "glSamplerParameterf", 3, Replay_SamplerParameterf },
+    { "glSamplerParameterfv", 3, Replay_SamplerParameterfv },
+    { "glSamplerParameterIiv", 3, Replay_SamplerParameterIiv },
+    { "glSamplerParameterIuiv", 3, Replay_SamplerParameterIuiv },
+    { "glGetSamplerParameteriv", 3, Replay_GetSamplerParameteriv },
+    { "glGetSamplerParameterIiv", 3, Replay_GetSamplerParameterIiv },
+    { "glGetSamplerParameterfv", 3, Replay_GetSamplerParameterfv },
+    { "glGetSamplerParameterIuiv", 3, Replay_GetSamplerParameterIuiv },
+    { "glQueryCounter", 2, Replay_QueryCounter },
+    { "glGetQueryObjecti64v", 3, Replay_GetQueryObjecti64v },
+    { "glGetQueryObjectui64v", 3, Replay_GetQueryObjectui64v },
+    { "glVertexAttribDivisor", 2, Replay_VertexAttribDivisor },
+    { "glVertexAttribP1ui", 4, Replay_VertexAttribP1ui },
+    { "glVertexAttribP1uiv", 4, Replay_VertexAttribP1uiv },
+    { "glVertexAttribP2ui", 4, Replay_VertexAttribP2ui },
+    { "glVertexAttribP2uiv", 4, Replay_VertexAttribP2uiv },
+    { "glVertexAttribP3ui", 4, Replay_VertexAttribP3ui },
+    { "glVertexAttribP3uiv", 4, Replay_VertexAttribP3uiv },
+    { "glVertexAttribP4ui", 4, Replay_VertexAttribP4ui },
+    { "glVertexAttribP4uiv", 4, Replay_VertexAttribP4uiv },
+    { "glMinSampleShading", 1, Replay_MinSampleShading },
+    { "glBlendEquationi", 2, Replay_BlendEquationi },
+    { "glBlendEquationSeparatei", 3, Replay_BlendEquationSeparatei },
+    { "glBlendFunci", 3, Replay_BlendFunci },
+    { "glBlendFuncSeparatei", 5, Replay_BlendFuncSeparatei },
+    { "glDrawArraysIndirect", 2, Replay_DrawArraysIndirect },
+    { "glDrawElementsIndirect", 3, Replay_DrawElementsIndirect },
+    { "glUniform1d", 2, Replay_Uniform1d },
+    { "glUniform2d", 3, Replay_Uniform2d },
+    { "glUniform3d", 4, Replay_Uniform3d },
+    { "glUniform4d", 5, Replay_Uniform4d },
+    { "glUniform1dv", 3, Replay_Uniform1dv },
+    { "glUniform2dv", 3, Replay_Uniform2dv },
+    { "glUniform3dv", 3, Replay_Uniform3dv },
+    { "glUniform4dv", 3, Replay_Uniform4dv },
+    { "glUniformMatrix2dv", 4, Replay_UniformMatrix2dv },
+    { "glUniformMatrix3dv", 4, Replay_UniformMatrix3dv },
+    { "glUniformMatrix4dv", 4, Replay_UniformMatrix4dv },
+    { "glUniformMatrix2x3dv", 4, Replay_UniformMatrix2x3dv },
+    { "glUniformMatrix2x4dv", 4, Replay_UniformMatrix2x4dv },
+    { "glUniformMatrix3x2dv", 4, Replay_UniformMatrix3x2dv },
+    { "glUniformMatrix3x4dv", 4, Replay_UniformMatrix3x4dv },
+    { "glUniformMatrix4x2dv", 4, Replay_UniformMatrix4x2dv },
+    { "glUniformMatrix4x3dv", 4, Replay_UniformMatrix4x3dv },
+    { "glGetUniformdv", 3, Replay_GetUniformdv },
+    { "glGetSubroutineUniformLocation", 3, Replay_GetSubroutineUniformLocation },
+    { "glGetSubroutineIndex", 3, Replay_GetSubroutineIndex },
+    { "glGetActiveSubroutineUniformiv", 5, Replay_GetActiveSubroutineUniformiv },
+    { "glGetActiveSubroutineUniformName", 6, Replay_GetActiveSubroutineUniformName },
+    { "glGetActiveSubroutineName", 6, Replay_GetActiveSubroutineName },
+    { "glUniformSubroutinesuiv", 3, Replay_UniformSubroutinesuiv },
+    { "glGetUniformSubroutineuiv", 3, Replay_GetUniformSubroutineuiv },
+    { "glGetProgramStageiv", 4, Replay_GetProgramStageiv },
+    { "glPatchParameteri", 2, Replay_PatchParameteri },
+    { "glPatchParameterfv", 2, Replay_PatchParameterfv },
+    { "glBindTransformFeedback", 2, Replay_BindTransformFeedback },
+    { "glDeleteTransformFeedbacks", 2, Replay_DeleteTransformFeedbacks },
+    { "glGenTransformFeedbacks", 2, Replay_GenTransformFeedbacks },
+    { "glIsTransformFeedback", 1, Replay_IsTransformFeedback },
+    { "glPauseTransformFeedback", 0, Replay_PauseTransformFeedback },
+    { "glResumeTransformFeedback", 0, Replay_ResumeTransformFeedback },
+    { "glDrawTransformFeedback", 2, Replay_DrawTransformFeedback },
+    { "glDrawTransformFeedbackStream", 3, Replay_DrawTransformFeedbackStream },
+    { "glBeginQueryIndexed", 3, Replay_BeginQueryIndexed },
+    { "glEndQueryIndexed", 2, Replay_EndQueryIndexed },
+    { "glGetQueryIndexediv", 4, Replay_GetQueryIndexediv },
+    { "glReleaseShaderCompiler", 0, Replay_ReleaseShaderCompiler },
+    { "glShaderBinary", 5, Replay_ShaderBinary },
+    { "glGetShaderPrecisionFormat", 4, Replay_GetShaderPrecisionFormat },
+    { "glDepthRangef", 2, Replay_DepthRangef },
+    { "glClearDepthf", 1, Replay_ClearDepthf },
+    { "glGetProgramBinary", 5, Replay_GetProgramBinary },
+    { "glProgramBinary", 4, Replay_ProgramBinary },
+    { "glProgramParameteri", 3, Replay_ProgramParameteri },
+    { "glUseProgramStages", 3, Replay_UseProgramStages },
+    { "glActiveShaderProgram", 2, Replay_ActiveShaderProgram },
+    { "glCreateShaderProgramv", 3, Replay_CreateShaderProgramv },
+    { "glBindProgramPipeline", 1, Replay_BindProgramPipeline },
+    { "glDeleteProgramPipelines", 2, Replay_DeleteProgramPipelines },
+    { "glGenProgramPipelines", 2, Replay_GenProgramPipelines },
+    { "glIsProgramPipeline", 1, Replay_IsProgramPipeline },
+    { "glGetProgramPipelineiv", 3, Replay_GetProgramPipelineiv },
+    { "glProgramUniform1i", 3, Replay_ProgramUniform1i },
+    { "glProgramUniform1iv", 4, Replay_ProgramUniform1iv },
+    { "glProgramUniform1f", 3, Replay_ProgramUniform1f },
+    { "glProgramUniform1fv", 4, Replay_ProgramUniform1fv },
+    { "glProgramUniform1d", 3, Replay_ProgramUniform1d },
+    { "glProgramUniform1dv", 4, Replay_ProgramUniform1dv },
+    { "glProgramUniform1ui", 3, Replay_ProgramUniform1ui },
+    { "glProgramUniform1uiv", 4, Replay_ProgramUniform1uiv },
+    { "glProgramUniform2i", 4, Replay_ProgramUniform2i },
+    { "glProgramUniform2iv", 4, Replay_ProgramUniform2iv },
+    { "glProgramUniform2f", 4, Replay_ProgramUniform2f },
+    { "glProgramUniform2fv", 4, Replay_ProgramUniform2fv },
+    { "glProgramUniform2d", 4, Replay_ProgramUniform2d },
+    { "glProgramUniform2dv", 4, Replay_ProgramUniform2dv },
+    { "glProgramUniform2ui", 4, Replay_ProgramUniform2ui },
+    { "glProgramUniform2uiv", 4, Replay_ProgramUniform2uiv },
+    { "glProgramUniform3i", 5, Replay_ProgramUniform3i },
+    { "glProgramUniform3iv", 4, Replay_ProgramUniform3iv },
+    { "glProgramUniform3f", 5, Replay_ProgramUniform3f },
+    { "glProgramUniform3fv", 4, Replay_ProgramUniform3fv },
+    { "glProgramUniform3d", 5, Replay_ProgramUniform3d },
+    { "glProgramUniform3dv", 4, Replay_ProgramUniform3dv },
+    { "glProgramUniform3ui", 5, Replay_ProgramUniform3ui },
+    { "glProgramUniform3uiv", 4, Replay_ProgramUniform3uiv },
+    { "glProgramUniform4i", 6, Replay_ProgramUniform4i },
+    { "glProgramUniform4iv", 4, Replay_ProgramUniform4iv },
+    { "glProgramUniform4f", 6, Replay_ProgramUniform4f },
+    { "glProgramUniform4fv", 4, Replay_ProgramUniform4fv },
+    { "glProgramUniform4d", 6, Replay_ProgramUniform4d },
+    { "glProgramUniform4dv", 4, Replay_ProgramUniform4dv },
+    { "glProgramUniform4ui", 6, Replay_ProgramUniform4ui },
+    { "glProgramUniform4uiv", 4, Replay_ProgramUniform4uiv },
+    { "glProgramUniformMatrix2fv", 5, Replay_ProgramUniformMatrix2fv },
+    { "glProgramUniformMatrix3fv", 5, Replay_ProgramUniformMatrix3fv },
+    { "glProgramUniformMatrix4fv", 5, Replay_ProgramUniformMatrix4fv },
+    { "glProgramUniformMatrix2dv", 5, Replay_ProgramUniformMatrix2dv },
+    { "glProgramUniformMatrix3dv", 5, Replay_ProgramUniformMatrix3dv },
+    { "glProgramUniformMatrix4dv", 5, Replay_ProgramUniformMatrix4dv },
+    { "glProgramUniformMatrix2x3fv", 5, Replay_ProgramUniformMatrix2x3fv },
+    { "glProgramUniformMatrix3x2fv", 5, Replay_ProgramUniformMatrix3x2fv },
+    { "glProgramUniformMatrix2x4fv", 5, Replay_ProgramUniformMatrix2x4fv },
+    { "glProgramUniformMatrix4x2fv", 5, Replay_ProgramUniformMatrix4x2fv },
+    { "glProgramUniformMatrix3x4fv", 5, Replay_ProgramUniformMatrix3x4fv },
+    { "glProgramUniformMatrix4x3fv", 5, Replay_ProgramUniformMatrix4x3fv },
+    { "glProgramUniformMatrix2x3dv", 5, Replay_ProgramUniformMatrix2x3dv },
+    { "glProgramUniformMatrix3x2dv", 5, Replay_ProgramUniformMatrix3x2dv },
+    { "glProgramUniformMatrix2x4dv", 5, Replay_ProgramUniformMatrix2x4dv },
+    { "glProgramUniformMatrix4x2dv", 5, Replay_ProgramUniformMatrix4x2dv },
+    { "glProgramUniformMatrix3x4dv", 5, Replay_ProgramUniformMatrix3x4dv },
+    { "glProgramUniformMatrix4x3dv", 5, Replay_ProgramUniformMatrix4x3dv },
+    { "glValidateProgramPipeline", 1, Replay_ValidateProgramPipeline },
+    { "glGetProgramPipelineInfoLog", 4, Replay_GetProgramPipelineInfoLog },
+    { "glVertexAttribL1d", 2, Replay_VertexAttribL1d },
+    { "glVertexAttribL2d", 3, Replay_VertexAttribL2d },
+    { "glVertexAttribL3d", 4, Replay_VertexAttribL3d },
+    { "glVertexAttribL4d", 5, Replay_VertexAttribL4d },
+    { "glVertexAttribL1dv", 2, Replay_VertexAttribL1dv },
+    { "glVertexAttribL2dv", 2, Replay_VertexAttribL2dv },
+    { "glVertexAttribL3dv", 2, Replay_VertexAttribL3dv },
+    { "glVertexAttribL4dv", 2, Replay_VertexAttribL4dv },
+    { "glVertexAttribLPointer", 5, Replay_VertexAttribLPointer },
+    { "glGetVertexAttribLdv", 3, Replay_GetVertexAttribLdv },
+    { "glViewportArrayv", 3, Replay_ViewportArrayv },
+    { "glViewportIndexedf", 5, Replay_ViewportIndexedf },
+    { "glViewportIndexedfv", 2, Replay_ViewportIndexedfv },
+    { "glScissorArrayv", 3, Replay_ScissorArrayv },
+    { "glScissorIndexed", 5, Replay_ScissorIndexed },
+    { "glScissorIndexedv", 2, Replay_ScissorIndexedv },
+    { "glDepthRangeArrayv", 3, Replay_DepthRangeArrayv },
+    { "glDepthRangeIndexed", 3, Replay_DepthRangeIndexed },
+    { "glGetFloati_v", 3, Replay_GetFloati_v },
+    { "glGetDoublei_v", 3, Replay_GetDoublei_v },
+    { "glDrawArraysInstancedBaseInstance", 5, Replay_DrawArraysInstancedBaseInstance },
+    { "glDrawElementsInstancedBaseInstance", 6, Replay_DrawElementsInstancedBaseInstance },
+    { "glDrawElementsInstancedBaseVertexBaseInstance", 7, Replay_DrawElementsInstancedBaseVertexBaseInstance },
+    { "glGetInternalformativ", 5, Replay_GetInternalformativ },
+    { "glGetActiveAtomicCounterBufferiv", 4, Replay_GetActiveAtomicCounterBufferiv },
+    { "glBindImageTexture", 7, Replay_BindImageTexture },
+    { "glMemoryBarrier", 1, Replay_MemoryBarrier },
+    { "glTexStorage1D", 4, Replay_TexStorage1D },
+    { "glTexStorage2D", 5, Replay_TexStorage2D },
+    { "glTexStorage3D", 6, Replay_TexStorage3D },
+    { "glDrawTransformFeedbackInstanced", 3, Replay_DrawTransformFeedbackInstanced },
+    { "glDrawTransformFeedbackStreamInstanced", 4, Replay_DrawTransformFeedbackStreamInstanced },
+    { "glClearBufferData", 5, Replay_ClearBufferData },
+    { "glClearBufferSubData", 7, Replay_ClearBufferSubData },
+    { "glDispatchCompute", 3, Replay_DispatchCompute },
+    { "glDispatchComputeIndirect", 1, Replay_DispatchComputeIndirect },
+    { "glCopyImageSubData", 15, Replay_CopyImageSubData },
+    { "glFramebufferParameteri", 3, Replay_FramebufferParameteri },
+    { "glGetFramebufferParameteriv", 3, Replay_GetFramebufferParameteriv },
+    { "glGetInternalformati64v", 5, Replay_GetInternalformati64v },
+    { "glInvalidateTexSubImage", 8, Replay_InvalidateTexSubImage },
+    { "glInvalidateTexImage", 2, Replay_InvalidateTexImage },
+    { "glInvalidateBufferSubData", 3, Replay_InvalidateBufferSubData },
+    { "glInvalidateBufferData", 1, Replay_InvalidateBufferData },
+    { "glInvalidateFramebuffer", 3, Replay_InvalidateFramebuffer },
+    { "glInvalidateSubFramebuffer", 7, Replay_InvalidateSubFramebuffer },
+    { "glMultiDrawArraysIndirect", 4, Replay_MultiDrawArraysIndirect },
+    { "glMultiDrawElementsIndirect", 5, Replay_MultiDrawElementsIndirect },
+    { "glGetProgramInterfaceiv", 4, Replay_GetProgramInterfaceiv },
+    { "glGetProgramResourceIndex", 3, Replay_GetProgramResourceIndex },
+    { "glGetProgramResourceName", 6, Replay_GetProgramResourceName },
+    { "glGetProgramResourceiv", 8, Replay_GetProgramResourceiv },
+    { "glGetProgramResourceLocation", 3, Replay_GetProgramResourceLocation },
+    { "glGetProgramResourceLocationIndex", 3, Replay_GetProgramResourceLocationIndex },
+    { "glShaderStorageBlockBinding", 3, Replay_ShaderStorageBlockBinding },
+    { "glTexBufferRange", 5, Replay_TexBufferRange },
+    { "glTexStorage2DMultisample", 6, Replay_TexStorage2DMultisample },
+    { "glTexStorage3DMultisample", 7, Replay_TexStorage3DMultisample },
+    { "glTextureView", 8, Replay_TextureView },
+    { "glBindVertexBuffer", 4, Replay_BindVertexBuffer },
+    { "glVertexAttribFormat", 5, Replay_VertexAttribFormat },
+    { "glVertexAttribIFormat", 4, Replay_VertexAttribIFormat },
+    { "glVertexAttribLFormat", 4, Replay_VertexAttribLFormat },
+    { "glVertexAttribBinding", 2, Replay_VertexAttribBinding },
+    { "glVertexBindingDivisor", 2, Replay_VertexBindingDivisor },
+    { "glDebugMessageControl", 6, Replay_DebugMessageControl },
+    { "glDebugMessageInsert", 6, Replay_DebugMessageInsert },
+    { "glDebugMessageCallback", 2, Replay_DebugMessageCallback },
+    { "glGetDebugMessageLog", 8, Replay_GetDebugMessageLog },
+    { "glPushDebugGroup", 4, Replay_PushDebugGroup },
+    { "glPopDebugGroup", 0, Replay_PopDebugGroup },
+    { "glObjectLabel", 4, Replay_ObjectLabel },
+    { "glGetObjectLabel", 5, Replay_GetObjectLabel },
+    { "glObjectPtrLabel", 3, Replay_ObjectPtrLabel },
+    { "glGetObjectPtrLabel", 4, Replay_GetObjectPtrLabel },
+    { "glBufferStorage", 4, Replay_BufferStorage },
+    { "glClearTexImage", 5, Replay_ClearTexImage },
+    { "glClearTexSubImage", 11, Replay_ClearTexSubImage },
+    { "glBindBuffersBase", 4, Replay_BindBuffersBase },
+    { "glBindBuffersRange", 6, Replay_BindBuffersRange },
+    { "glBindTextures", 3, Replay_BindTextures },
+    { "glBindSamplers", 3, Replay_BindSamplers },
+    { "glBindImageTextures", 3, Replay_BindImageTextures },
+    { "glBindVertexBuffers", 5, Replay_BindVertexBuffers },
+    { "glClipControl", 2, Replay_ClipControl },
+    { "glCreateTransformFeedbacks", 2, Replay_CreateTransformFeedbacks },
+    { "glTransformFeedbackBufferBase", 3, Replay_TransformFeedbackBufferBase },
+    { "glTransformFeedbackBufferRange", 5, Replay_TransformFeedbackBufferRange },
+    { "glGetTransformFeedbackiv", 3, Replay_GetTransformFeedbackiv },
+    { "glGetTransformFeedbacki_v", 4, Replay_GetTransformFeedbacki_v },
+    { "glGetTransformFeedbacki64_v", 4, Replay_GetTransformFeedbacki64_v },
+    { "glCreateBuffers", 2, Replay_CreateBuffers },
+    { "glNamedBufferStorage", 4, Replay_NamedBufferStorage },
+    { "glNamedBufferData", 4, Replay_NamedBufferData },
+    { "glNamedBufferSubData", 4, Replay_NamedBufferSubData },
+    { "glCopyNamedBufferSubData", 5, Replay_CopyNamedBufferSubData },
+    { "glClearNamedBufferData", 5, Replay_ClearNamedBufferData },
+    { "glClearNamedBufferSubData", 7, Replay_ClearNamedBufferSubData },
+    { "glMapNamedBuffer", 2, Replay_MapNamedBuffer },
+    { "glMapNamedBufferRange", 4, Replay_MapNamedBufferRange },
+    { "glUnmapNamedBuffer", 1, Replay_UnmapNamedBuffer },
+    { "glFlushMappedNamedBufferRange", 3, Replay_FlushMappedNamedBufferRange },
+    { "glGetNamedBufferParameteriv", 3, Replay_GetNamedBufferParameteriv },
+    { "glGetNamedBufferParameteri64v", 3, Replay_GetNamedBufferParameteri64v },
+    { "glGetNamedBufferPointerv", 3, Replay_GetNamedBufferPointerv },
+    { "glGetNamedBufferSubData", 4, Replay_GetNamedBufferSubData },
+    { "glCreateFramebuffers", 2, Replay_CreateFramebuffers },
+    { "glNamedFramebufferRenderbuffer", 4, Replay_NamedFramebufferRenderbuffer },
+    { "glNamedFramebufferParameteri", 3, Replay_NamedFramebufferParameteri },
+    { "glNamedFramebufferTexture", 4, Replay_NamedFramebufferTexture },
+    { "glNamedFramebufferTextureLayer", 5, Replay_NamedFramebufferTextureLayer },
+    { "glNamedFramebufferDrawBuffer", 2, Replay_NamedFramebufferDrawBuffer },
+    { "glNamedFramebufferDrawBuffers", 3, Replay_NamedFramebufferDrawBuffers },
+    { "glNamedFramebufferReadBuffer", 2, Replay_NamedFramebufferReadBuffer },
+    { "glInvalidateNamedFramebufferData", 3, Replay_InvalidateNamedFramebufferData },
+    { "glInvalidateNamedFramebufferSubData", 7, Replay_InvalidateNamedFramebufferSubData },
+    { "glClearNamedFramebufferiv", 4, Replay_ClearNamedFramebufferiv },
+    { "glClearNamedFramebufferuiv", 4, Replay_ClearNamedFramebufferuiv },
+    { "glClearNamedFramebufferfv", 4, Replay_ClearNamedFramebufferfv },
+    { "glClearNamedFramebufferfi", 4, Replay_ClearNamedFramebufferfi },
+    { "glBlitNamedFramebuffer", 12, Replay_BlitNamedFramebuffer },
+    { "glCheckNamedFramebufferStatus", 2, Replay_CheckNamedFramebufferStatus },
+    { "glGetNamedFramebufferParameteriv", 3, Replay_GetNamedFramebufferParameteriv },
+    { "glGetNamedFramebufferAttachmentParameteriv", 4, Replay_GetNamedFramebufferAttachmentParameteriv },
+    { "glCreateRenderbuffers", 2, Replay_CreateRenderbuffers },
+    { "glNamedRenderbufferStorage", 4, Replay_NamedRenderbufferStorage },
+    { "glNamedRenderbufferStorageMultisample", 5, Replay_NamedRenderbufferStorageMultisample },
+    { "glGetNamedRenderbufferParameteriv", 3, Replay_GetNamedRenderbufferParameteriv },
+    { "glCreateTextures", 3, Replay_CreateTextures },
+    { "glTextureBuffer", 3, Replay_TextureBuffer },
+    { "glTextureBufferRange", 5, Replay_TextureBufferRange },
+    { "glTextureStorage1D", 4, Replay_TextureStorage1D },
+    { "glTextureStorage2D", 5, Replay_TextureStorage2D },
+    { "glTextureStorage3D", 6, Replay_TextureStorage3D },
+    { "glTextureStorage2DMultisample", 6, Replay_TextureStorage2DMultisample },
+    { "glTextureStorage3DMultisample", 7, Replay_TextureStorage3DMultisample },
+    { "glTextureSubImage1D", 7, Replay_TextureSubImage1D },
+    { "glTextureSubImage2D", 9, Replay_TextureSubImage2D },
+    { "glTextureSubImage3D", 11, Replay_TextureSubImage3D },
+    { "glCompressedTextureSubImage1D", 7, Replay_CompressedTextureSubImage1D },
+    { "glCompressedTextureSubImage2D", 9, Replay_CompressedTextureSubImage2D },
+    { "glCompressedTextureSubImage3D", 11, Replay_CompressedTextureSubImage3D },
+    { "glCopyTextureSubImage1D", 6, Replay_CopyTextureSubImage1D },
+    { "glCopyTextureSubImage2D", 8, Replay_CopyTextureSubImage2D },
+    { "glCopyTextureSubImage3D", 9, Replay_CopyTextureSubImage3D },
+    { "glTextureParameterf", 3, Replay_TextureParameterf },
+    { "glTextureParameterfv", 3, Replay_TextureParameterfv },
+    { "glTextureParameteri", 3, Replay_TextureParameteri },
+    { "glTextureParameterIiv", 3, Replay_TextureParameterIiv },
+    { "glTextureParameterIuiv", 3, Replay_TextureParameterIuiv },
+    { "glTextureParameteriv", 3, Replay_TextureParameteriv },
+    { "glGenerateTextureMipmap", 1, Replay_GenerateTextureMipmap },
+    { "glBindTextureUnit", 2, Replay_BindTextureUnit },
+    { "glGetTextureImage", 6, Replay_GetTextureImage },
+    { "glGetCompressedTextureImage", 4, Replay_GetCompressedTextureImage },
+    { "glGetTextureLevelParameterfv", 4, Replay_GetTextureLevelParameterfv },
+    { "glGetTextureLevelParameteriv", 4, Replay_GetTextureLevelParameteriv },
+    { "glGetTextureParameterfv", 3, Replay_GetTextureParameterfv },
+    { "glGetTextureParameterIiv", 3, Replay_GetTextureParameterIiv },
+    { "glGetTextureParameterIuiv", 3, Replay_GetTextureParameterIuiv },
+    { "glGetTextureParameteriv", 3, Replay_GetTextureParameteriv },
+    { "glCreateVertexArrays", 2, Replay_CreateVertexArrays },
+    { "glDisableVertexArrayAttrib", 2, Replay_DisableVertexArrayAttrib },
+    { "glEnableVertexArrayAttrib", 2, Replay_EnableVertexArrayAttrib },
+    { "glVertexArrayElementBuffer", 2, Replay_VertexArrayElementBuffer },
+    { "glVertexArrayVertexBuffer", 5, Replay_VertexArrayVertexBuffer },
+    { "glVertexArrayVertexBuffers", 6, Replay_VertexArrayVertexBuffers },
+    { "glVertexArrayAttribBinding", 3, Replay_VertexArrayAttribBinding },
+    { "glVertexArrayAttribFormat", 6, Replay_VertexArrayAttribFormat },
+    { "glVertexArrayAttribIFormat", 5, Replay_VertexArrayAttribIFormat },
+    { "glVertexArrayAttribLFormat", 5, Replay_VertexArrayAttribLFormat },
+    { "glVertexArrayBindingDivisor", 3, Replay_VertexArrayBindingDivisor },
+    { "glGetVertexArrayiv", 3, Replay_GetVertexArrayiv },
+    { "glGetVertexArrayIndexediv", 4, Replay_GetVertexArrayIndexediv },
+    { "glGetVertexArrayIndexed64iv", 4, Replay_GetVertexArrayIndexed64iv },
+    { "glCreateSamplers", 2, Replay_CreateSamplers },
+    { "glCreateProgramPipelines", 2, Replay_CreateProgramPipelines },
+    { "glCreateQueries", 3, Replay_CreateQueries },
+    { "glGetQueryBufferObjecti64v", 4, Replay_GetQueryBufferObjecti64v },
+    { "glGetQueryBufferObjectiv", 4, Replay_GetQueryBufferObjectiv },
+    { "glGetQueryBufferObjectui64v", 4, Replay_GetQueryBufferObjectui64v },
+    { "glGetQueryBufferObjectuiv", 4, Replay_GetQueryBufferObjectuiv },
+    { "glMemoryBarrierByRegion", 1, Replay_MemoryBarrierByRegion },
+    { "glGetTextureSubImage", 12, Replay_GetTextureSubImage },
+    { "glGetCompressedTextureSubImage", 10, Replay_GetCompressedTextureSubImage },
+    { "glGetGraphicsResetStatus", 0, Replay_GetGraphicsResetStatus },
+    { "glGetnCompressedTexImage", 4, Replay_GetnCompressedTexImage },
+    { "glGetnTexImage", 6, Replay_GetnTexImage },
+    { "glGetnUniformdv", 4, Replay_GetnUniformdv },
+    { "glGetnUniformfv", 4, Replay_GetnUniformfv },
+    { "glGetnUniformiv", 4, Replay_GetnUniformiv },
+    { "glGetnUniformuiv", 4, Replay_GetnUniformuiv },
+    { "glReadnPixels", 8, Replay_ReadnPixels },
+    { "glTextureBarrier", 0, Replay_TextureBarrier },
+    { "glGetTextureHandleARB", 1, Replay_GetTextureHandleARB },
+    { "glGetTextureSamplerHandleARB", 2, Replay_GetTextureSamplerHandleARB },
+    { "glMakeTextureHandleResidentARB", 1, Replay_MakeTextureHandleResidentARB },
+    { "glMakeTextureHandleNonResidentARB", 1, Replay_MakeTextureHandleNonResidentARB },
+    { "glGetImageHandleARB", 5, Replay_GetImageHandleARB },
+    { "glMakeImageHandleResidentARB", 2, Replay_MakeImageHandleResidentARB },
+    { "glMakeImageHandleNonResidentARB", 1, Replay_MakeImageHandleNonResidentARB },
+    { "glUniformHandleui64ARB", 2, Replay_UniformHandleui64ARB },
+    { "glUniformHandleui64vARB", 3, Replay_UniformHandleui64vARB },
+    { "glProgramUniformHandleui64ARB", 3, Replay_ProgramUniformHandleui64ARB },
+    { "glProgramUniformHandleui64vARB", 4, Replay_ProgramUniformHandleui64vARB },
+    { "glIsTextureHandleResidentARB", 1, Replay_IsTextureHandleResidentARB },
+    { "glIsImageHandleResidentARB", 1, Replay_IsImageHandleResidentARB },
+    { "glVertexAttribL1ui64ARB", 2, Replay_VertexAttribL1ui64ARB },
+    { "glVertexAttribL1ui64vARB", 2, Replay_VertexAttribL1ui64vARB },
+    { "glGetVertexAttribLui64vARB", 3, Replay_GetVertexAttribLui64vARB },
+    { "glCreateSyncFromCLeventARB", 3, NULL },
+    { "glDispatchComputeGroupSizeARB", 6, Replay_DispatchComputeGroupSizeARB },
+    { "glDebugMessageControlARB", 6, Replay_DebugMessageControlARB },
+    { "glDebugMessageInsertARB", 6, Replay_DebugMessageInsertARB },
+    { "glDebugMessageCallbackARB", 2, Replay_DebugMessageCallbackARB },
+    { "glGetDebugMessageLogARB", 8, Replay_GetDebugMessageLogARB },
+    { "glBlendEquationiARB", 2, Replay_BlendEquationiARB },
+    { "glBlendEquationSeparateiARB", 3, Replay_BlendEquationSeparateiARB },
+    { "glBlendFunciARB", 3, Replay_BlendFunciARB },
+    { "glBlendFuncSeparateiARB", 5, Replay_BlendFuncSeparateiARB },
+    { "glMultiDrawArraysIndirectCountARB", 5, Replay_MultiDrawArraysIndirectCountARB },
+    { "glMultiDrawElementsIndirectCountARB", 6, Replay_MultiDrawElementsIndirectCountARB },
+    { "glGetGraphicsResetStatusARB", 0, Replay_GetGraphicsResetStatusARB },
+    { "glGetnTexImageARB", 6, Replay_GetnTexImageARB },
+    { "glReadnPixelsARB", 8, Replay_ReadnPixelsARB },
+    { "glGetnCompressedTexImageARB", 4, Replay_GetnCompressedTexImageARB },
+    { "glGetnUniformfvARB", 4, Replay_GetnUniformfvARB },
+    { "glGetnUniformivARB", 4, Replay_GetnUniformivARB },
+    { "glGetnUniformuivARB", 4, Replay_GetnUniformuivARB },
+    { "glGetnUniformdvARB", 4, Replay_GetnUniformdvARB },
+    { "glMinSampleShadingARB", 1, Replay_MinSampleShadingARB },
+    { "glNamedStringARB", 5, Replay_NamedStringARB },
+    { "glDeleteNamedStringARB", 2, Replay_DeleteNamedStringARB },
+    { "glCompileShaderIncludeARB", 4, Replay_CompileShaderIncludeARB },
+    { "glIsNamedStringARB", 2, Replay_IsNamedStringARB },
+    { "glGetNamedStringARB", 5, Replay_GetNamedStringARB },
+    { "glGetNamedStringivARB", 4, Replay_GetNamedStringivARB },
+    { "glBufferPageCommitmentARB", 4, Replay_BufferPageCommitmentARB },
+    { "glNamedBufferPageCommitmentEXT", 4, Replay_NamedBufferPageCommitmentEXT },
+    { "glNamedBufferPageCommitmentARB", 4, Replay_NamedBufferPageCommitmentARB },
+    { "glTexPageCommitmentARB", 9, Replay_TexPageCommitmentARB },
+    { "glGetMultisamplefvNV", 3, Replay_GetMultisamplefvNV },
+    { "glSampleMaskIndexedNV", 2, Replay_SampleMaskIndexedNV },
+    { "glTexRenderbufferNV", 2, Replay_TexRenderbufferNV },
+    { "glMakeBufferResidentNV", 2, Replay_MakeBufferResidentNV },
+    { "glMakeBufferNonResidentNV", 1, Replay_MakeBufferNonResidentNV },
+    { "glIsBufferResidentNV", 1, Replay_IsBufferResidentNV },
+    { "glMakeNamedBufferResidentNV", 2, Replay_MakeNamedBufferResidentNV },
+    { "glMakeNamedBufferNonResidentNV", 1, Replay_MakeNamedBufferNonResidentNV },
+    { "glIsNamedBufferResidentNV", 1, Replay_IsNamedBufferResidentNV },
+    { "glGetBufferParameterui64vNV", 3, Replay_GetBufferParameterui64vNV },
+    { "glGetNamedBufferParameterui64vNV", 3, Replay_GetNamedBufferParameterui64vNV },
+    { "glGetIntegerui64vNV", 2, Replay_GetIntegerui64vNV },
+    { "glUniformui64NV", 2, Replay_Uniformui64NV },
+    { "glUniformui64vNV", 3, Replay_Uniformui64vNV },
+    { "glProgramUniformui64NV", 3, Replay_ProgramUniformui64NV },
+    { "glProgramUniformui64vNV", 4, Replay_ProgramUniformui64vNV },
+    { "glBufferAddressRangeNV", 4, Replay_BufferAddressRangeNV },
+    { "glVertexFormatNV", 3, Replay_VertexFormatNV },
+    { "glNormalFormatNV", 2, Replay_NormalFormatNV },
+    { "glColorFormatNV", 3, Replay_ColorFormatNV },
+    { "glIndexFormatNV", 2, Replay_IndexFormatNV },
+    { "glTexCoordFormatNV", 3, Replay_TexCoordFormatNV },
+    { "glEdgeFlagFormatNV", 1, Replay_EdgeFlagFormatNV },
+    { "glSecondaryColorFormatNV", 3, Replay_SecondaryColorFormatNV },
+    { "glFogCoordFormatNV", 2, Replay_FogCoordFormatNV },
+    { "glVertexAttribFormatNV", 5, Replay_VertexAttribFormatNV },
+    { "glVertexAttribIFormatNV", 4, Replay_VertexAttribIFormatNV },
+    { "glGetIntegerui64i_vNV", 3, Replay_GetIntegerui64i_vNV },
+    { "glEnableClientState", 1, Replay_EnableClientState },
+    { "glDisableClientState", 1, Replay_DisableClientState },
+};
+
+} /* namespace replay */
+} /* namespace oglp */
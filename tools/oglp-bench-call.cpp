@@ -0,0 +1,96 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * oglp-bench-call: measures the overhead of calling OpenGL entry points
+ * through the oglp wrappers against the null driver.
+ *
+ * usage: oglp-bench-call [iterations]
+ *
+ * The benchmark is built twice, as oglp-bench-call with the entry points
+ * called through function pointers and as oglp-bench-call-direct with
+ * OGLP_DIRECT_LINK, which links the null driver in place of the OpenGL
+ * library. Both builds reach the same stubs, which do almost nothing, so
+ * the difference between them is the cost of loading the function
+ * pointer compared to calling the exported symbol.
+ */
+#include <oglp/oglp.h>
+#include <oglp/nulldriver.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#ifdef OGLP_DIRECT_LINK
+static const char *const BenchVariant = "direct link";
+#else
+static const char *const BenchVariant = "function pointers";
+#endif
+
+/* Time a function and return the mean per call in nanoseconds. */
+template<typename F>
+static double BenchCall (unsigned long iterations, F f)
+{
+    std::chrono::steady_clock::time_point start;
+    unsigned long i;
+
+    start = std::chrono::steady_clock::now ();
+    for (i = 0; i < iterations; i++)
+        f (i);
+    return std::chrono::duration<double, std::nano>
+            (std::chrono::steady_clock::now () - start).count () / iterations;
+}
+
+int main (int argc, char *argv[])
+{
+    unsigned long iterations = 10000000;
+
+    if (argc > 1)
+        iterations = strtoul (argv[1], NULL, 0);
+    if (!iterations) {
+        fprintf (stderr, "usage: %s [iterations]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (!oglp::Init (oglp::NullDriverGetProcAddress)) {
+        fprintf (stderr, "Cannot initialize oglp with the null driver.\n");
+        return EXIT_FAILURE;
+    }
+
+    printf ("%s:\n", BenchVariant);
+    printf ("Uniform1f:              %8.2f ns\n",
+            BenchCall (iterations, [] (unsigned long i) {
+        oglp::Uniform1f (0, GLfloat (i));
+    }));
+    printf ("BindBufferBase:         %8.2f ns\n",
+            BenchCall (iterations, [] (unsigned long i) {
+        oglp::BindBufferBase (GL_UNIFORM_BUFFER, i & 7, 1);
+    }));
+    printf ("ProgramUniform4f:       %8.2f ns\n",
+            BenchCall (iterations, [] (unsigned long i) {
+        oglp::ProgramUniform4f (1, 0, GLfloat (i), 0.0f, 0.0f, 1.0f);
+    }));
+    printf ("DrawArrays:             %8.2f ns\n",
+            BenchCall (iterations, [] (unsigned long i) {
+        oglp::DrawArrays (GL_TRIANGLES, 0, GLsizei (i & 1023));
+    }));
+    printf ("GetError:               %8.2f ns\n",
+            BenchCall (iterations, [] (unsigned long) {
+        oglp::GetError ();
+    }));
+    return EXIT_SUCCESS;
+}
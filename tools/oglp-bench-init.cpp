@@ -0,0 +1,85 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * oglp-bench-init: measures the cost of Init with eager and with lazy
+ * entry point resolution against the null driver.
+ *
+ * usage: oglp-bench-init [iterations]
+ *
+ * Both variants query the same capabilities, so the difference is the
+ * cost of resolving every entry point up front. The lazy variant is
+ * also measured including the first call of a few entry points, which
+ * resolves them.
+ */
+#include <oglp/oglp.h>
+#include <oglp/nulldriver.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+/* Time a number of Init calls and return the mean in microseconds. */
+static double BenchInit (unsigned long iterations, bool lazy, bool call)
+{
+    std::chrono::steady_clock::time_point start;
+    unsigned long i;
+
+    start = std::chrono::steady_clock::now ();
+    for (i = 0; i < iterations; i++) {
+        if (!oglp::Init (oglp::NullDriverGetProcAddress, lazy)) {
+            fprintf (stderr, "Cannot initialize oglp with the null driver.\n");
+            exit (EXIT_FAILURE);
+        }
+        if (call) {
+            oglp::Viewport (0, 0, 1, 1);
+            oglp::ClearColor (0.0f, 0.0f, 0.0f, 1.0f);
+            oglp::Clear (GL_COLOR_BUFFER_BIT);
+            oglp::UseProgram (0);
+            oglp::BindVertexArray (0);
+            oglp::DrawArrays (GL_TRIANGLES, 0, 3);
+        }
+    }
+    return std::chrono::duration<double, std::micro>
+            (std::chrono::steady_clock::now () - start).count () / iterations;
+}
+
+int main (int argc, char *argv[])
+{
+    unsigned long iterations = 1000;
+
+    if (argc > 1)
+        iterations = strtoul (argv[1], NULL, 0);
+    if (!iterations) {
+        fprintf (stderr, "usage: %s [iterations]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    /* warm up the caches and the null driver */
+    BenchInit (1, false, false);
+
+    printf ("eager init:             %10.2f us\n",
+            BenchInit (iterations, false, false));
+    printf ("lazy init:              %10.2f us\n",
+            BenchInit (iterations, true, false));
+    printf ("eager init + 6 calls:   %10.2f us\n",
+            BenchInit (iterations, false, true));
+    printf ("lazy init + 6 calls:    %10.2f us\n",
+            BenchInit (iterations, true, true));
+    return EXIT_SUCCESS;
+}
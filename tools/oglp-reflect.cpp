@@ -0,0 +1,457 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * oglp-reflect: links GLSL sources into a program in an offscreen EGL
+ * context and generates a C++ header from its reflection.
+ *
+ * usage: oglp-reflect [-n namespace] [-o output] source...
+ *
+ * The shader stage of a source is determined by its extension, i.e.
+ * .vert, .tesc, .tese, .geom, .frag or .comp. For every uniform block
+ * and shader storage block the header contains a struct whose members
+ * are padded to the offsets reported by the implementation, with the
+ * binding point as a static member and static_asserts that check the
+ * offsets and the size. Vertex inputs are emitted as location constants
+ * in a nested namespace attrib. Members of nested structures are
+ * flattened with their names sanitized, and unsized or struct arrays of
+ * shader storage blocks are described by offset and stride constants
+ * instead of members.
+ */
+#include "context.h"
+#include <oglp/oglp.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/* C++ representation of a GLSL type */
+struct TypeInfo
+{
+    GLenum type;
+    const char *scalar;
+    const char *vector;
+    unsigned int component;
+    unsigned int columns;
+    unsigned int rows;
+};
+
+static const TypeInfo Types[] = {
+    { GL_FLOAT, "GLfloat", NULL, 4, 1, 1 },
+    { GL_FLOAT_VEC2, "GLfloat", "glm::vec2", 4, 1, 2 },
+    { GL_FLOAT_VEC3, "GLfloat", "glm::vec3", 4, 1, 3 },
+    { GL_FLOAT_VEC4, "GLfloat", "glm::vec4", 4, 1, 4 },
+    { GL_INT, "GLint", NULL, 4, 1, 1 },
+    { GL_INT_VEC2, "GLint", "glm::ivec2", 4, 1, 2 },
+    { GL_INT_VEC3, "GLint", "glm::ivec3", 4, 1, 3 },
+    { GL_INT_VEC4, "GLint", "glm::ivec4", 4, 1, 4 },
+    { GL_UNSIGNED_INT, "GLuint", NULL, 4, 1, 1 },
+    { GL_UNSIGNED_INT_VEC2, "GLuint", "glm::uvec2", 4, 1, 2 },
+    { GL_UNSIGNED_INT_VEC3, "GLuint", "glm::uvec3", 4, 1, 3 },
+    { GL_UNSIGNED_INT_VEC4, "GLuint", "glm::uvec4", 4, 1, 4 },
+    { GL_BOOL, "GLuint", NULL, 4, 1, 1 },
+    { GL_BOOL_VEC2, "GLuint", "glm::uvec2", 4, 1, 2 },
+    { GL_BOOL_VEC3, "GLuint", "glm::uvec3", 4, 1, 3 },
+    { GL_BOOL_VEC4, "GLuint", "glm::uvec4", 4, 1, 4 },
+    { GL_DOUBLE, "GLdouble", NULL, 8, 1, 1 },
+    { GL_DOUBLE_VEC2, "GLdouble", "glm::dvec2", 8, 1, 2 },
+    { GL_DOUBLE_VEC3, "GLdouble", "glm::dvec3", 8, 1, 3 },
+    { GL_DOUBLE_VEC4, "GLdouble", "glm::dvec4", 8, 1, 4 },
+    { GL_FLOAT_MAT2, "GLfloat", "glm::mat2", 4, 2, 2 },
+    { GL_FLOAT_MAT3, "GLfloat", "glm::mat3", 4, 3, 3 },
+    { GL_FLOAT_MAT4, "GLfloat", "glm::mat4", 4, 4, 4 },
+    { GL_FLOAT_MAT2x3, "GLfloat", "glm::mat2x3", 4, 2, 3 },
+    { GL_FLOAT_MAT2x4, "GLfloat", "glm::mat2x4", 4, 2, 4 },
+    { GL_FLOAT_MAT3x2, "GLfloat", "glm::mat3x2", 4, 3, 2 },
+    { GL_FLOAT_MAT3x4, "GLfloat", "glm::mat3x4", 4, 3, 4 },
+    { GL_FLOAT_MAT4x2, "GLfloat", "glm::mat4x2", 4, 4, 2 },
+    { GL_FLOAT_MAT4x3, "GLfloat", "glm::mat4x3", 4, 4, 3 },
+    { GL_DOUBLE_MAT2, "GLdouble", "glm::dmat2", 8, 2, 2 },
+    { GL_DOUBLE_MAT3, "GLdouble", "glm::dmat3", 8, 3, 3 },
+    { GL_DOUBLE_MAT4, "GLdouble", "glm::dmat4", 8, 4, 4 },
+    { GL_DOUBLE_MAT2x3, "GLdouble", "glm::dmat2x3", 8, 2, 3 },
+    { GL_DOUBLE_MAT2x4, "GLdouble", "glm::dmat2x4", 8, 2, 4 },
+    { GL_DOUBLE_MAT3x2, "GLdouble", "glm::dmat3x2", 8, 3, 2 },
+    { GL_DOUBLE_MAT3x4, "GLdouble", "glm::dmat3x4", 8, 3, 4 },
+    { GL_DOUBLE_MAT4x2, "GLdouble", "glm::dmat4x2", 8, 4, 2 },
+    { GL_DOUBLE_MAT4x3, "GLdouble", "glm::dmat4x3", 8, 4, 3 }
+};
+
+/* a member of a block as reported by reflection */
+struct Variable
+{
+    std::string name;
+    const TypeInfo *type;
+    GLint offset;
+    GLint count;
+    GLint arraystride;
+    GLint matrixstride;
+    GLint toplevelcount;
+    GLint toplevelstride;
+    bool unsized;
+};
+
+static const TypeInfo *FindType (GLenum type)
+{
+    for (const TypeInfo &info : Types) {
+        if (info.type == type)
+            return &info;
+    }
+    return NULL;
+}
+
+/* GetName includes the terminating null character */
+static std::string ResourceName (const oglp::ProgramResource &resource)
+{
+    return std::string (resource.GetName ().c_str ());
+}
+
+/* Turn a GLSL name into a C++ identifier, e.g. "lights[1].color"
+ * into "lights_1_color". */
+static std::string Identifier (const std::string &name)
+{
+    std::string id;
+    for (char c : name) {
+        if (isalnum (static_cast<unsigned char> (c)) || c == '_')
+            id += c;
+        else if (c != ']' && !id.empty () && id.back () != '_')
+            id += '_';
+    }
+    while (!id.empty () && id.back () == '_')
+        id.pop_back ();
+    if (id.empty () || isdigit (static_cast<unsigned char> (id[0])))
+        id = "_" + id;
+    return id;
+}
+
+/* Strip the "[0]" GL appends to the names of arrays. */
+static std::string StripArray (const std::string &name)
+{
+    if (name.size () > 3 && !name.compare (name.size () - 3, 3, "[0]"))
+        return name.substr (0, name.size () - 3);
+    return name;
+}
+
+static GLenum StageFromFilename (const std::string &filename)
+{
+    static const struct { const char *extension; GLenum stage; } stages[] = {
+        { ".vert", GL_VERTEX_SHADER }, { ".tesc", GL_TESS_CONTROL_SHADER },
+        { ".tese", GL_TESS_EVALUATION_SHADER }, { ".geom", GL_GEOMETRY_SHADER },
+        { ".frag", GL_FRAGMENT_SHADER }, { ".comp", GL_COMPUTE_SHADER }
+    };
+    size_t dot = filename.rfind ('.');
+    if (dot != std::string::npos) {
+        for (const auto &stage : stages) {
+            if (filename.substr (dot) == stage.extension)
+                return stage.stage;
+        }
+    }
+    return GL_NONE;
+}
+
+/* Declare a member, return its size in bytes. */
+static GLint Declare (std::ostream &out, const Variable &var,
+                      const std::string &id)
+{
+    const TypeInfo &t = *var.type;
+    GLint vectorsize = t.component * t.rows;
+    GLint elementsize = (t.columns == 1) ? vectorsize
+                        : t.columns * var.matrixstride;
+    bool packed = (t.columns == 1 || var.matrixstride == vectorsize);
+    std::string element;
+    std::string dims;
+
+    if (packed) {
+        element = t.vector ? t.vector : t.scalar;
+    } else {
+        element = t.scalar;
+        dims = "[" + std::to_string (t.columns) + "]["
+               + std::to_string (var.matrixstride / t.component) + "]";
+    }
+    if (!var.count) {
+        out << "    " << element << " " << id << dims << ";\n";
+        return elementsize;
+    }
+    if (var.arraystride == elementsize) {
+        out << "    " << element << " " << id << "[" << var.count << "]"
+            << dims << ";\n";
+    } else if (t.columns == 1) {
+        /* padded vector elements, only the first components are used */
+        out << "    " << t.scalar << " " << id << "[" << var.count << "]["
+            << var.arraystride / t.component << "];\n";
+    } else {
+        out << "    GLubyte " << id << "[" << var.count << "]["
+            << var.arraystride << "];\n";
+    }
+    return var.count * var.arraystride;
+}
+
+static void GenerateBlock (std::ostream &out, const oglp::Program &program,
+                           GLenum blockinterface, GLuint index,
+                           std::vector<std::string> &names)
+{
+    const GLenum varinterface = (blockinterface == GL_UNIFORM_BLOCK)
+                                ? GL_UNIFORM : GL_BUFFER_VARIABLE;
+    oglp::ProgramResource block = program.GetResource (blockinterface, index);
+    std::string name = ResourceName (block);
+    std::string id, prefix;
+    std::vector<GLint> indices;
+    std::vector<Variable> vars;
+    std::vector<std::string> asserts;
+    std::ostringstream constants;
+    GLint binding, datasize, numvars, cursor = 0, end, padding = 0;
+
+    /* arrays of blocks share the layout of their first block */
+    if (name.find ('[') != std::string::npos && StripArray (name) == name)
+        return;
+    id = Identifier (StripArray (name));
+    prefix = StripArray (name) + ".";
+    if (std::find (names.begin (), names.end (), id) != names.end ())
+        return;
+    names.push_back (id);
+
+    binding = block.GetProperty (GL_BUFFER_BINDING);
+    datasize = block.GetProperty (GL_BUFFER_DATA_SIZE);
+    numvars = block.GetProperty (GL_NUM_ACTIVE_VARIABLES);
+    indices.resize (numvars);
+    if (numvars) {
+        const GLenum prop = GL_ACTIVE_VARIABLES;
+        block.Get (1, &prop, numvars, NULL, &indices[0]);
+    }
+
+    for (GLint i : indices) {
+        oglp::ProgramResource resource = program.GetResource (varinterface, i);
+        GLenum props[] = { GL_TYPE, GL_OFFSET, GL_ARRAY_SIZE,
+                           GL_ARRAY_STRIDE, GL_MATRIX_STRIDE,
+                           GL_TOP_LEVEL_ARRAY_SIZE, GL_TOP_LEVEL_ARRAY_STRIDE };
+        GLint values[7] = { 0, 0, 0, 0, 0, 1, 0 };
+        Variable var;
+        resource.Get (varinterface == GL_BUFFER_VARIABLE ? 7 : 5, props, 7,
+                      NULL, values);
+        var.name = ResourceName (resource);
+        var.type = FindType (values[0]);
+        if (!var.type)
+            throw std::runtime_error ("Unsupported type of " + var.name + ".");
+        var.offset = values[1];
+        var.count = (values[2] == 1 && StripArray (var.name) == var.name)
+                    ? 0 : values[2];
+        var.arraystride = values[3];
+        var.matrixstride = values[4];
+        var.toplevelcount = values[5];
+        var.toplevelstride = values[6];
+        var.unsized = (varinterface == GL_BUFFER_VARIABLE
+                       && (values[2] == 0 || values[5] == 0));
+        vars.push_back (var);
+    }
+    std::sort (vars.begin (), vars.end (), [] (const Variable &a,
+                                              const Variable &b) {
+        return a.offset < b.offset;
+    });
+
+    out << "/* " << (blockinterface == GL_UNIFORM_BLOCK ? "uniform" : "buffer")
+        << " " << StripArray (name) << " */\n";
+    out << "struct " << id << "\n{\n";
+    out << "    static constexpr GLuint binding = " << binding << ";\n";
+    end = datasize;
+    for (const Variable &var : vars) {
+        std::string member = var.name;
+        /* members of blocks with an instance name are prefixed with
+         * the block name */
+        if (!member.compare (0, prefix.size (), prefix))
+            member = member.substr (prefix.size ());
+        member = Identifier (StripArray (member));
+        /* unsized arrays and arrays of structures in shader storage
+         * blocks are only described by their offset and stride */
+        if (var.unsized || (var.toplevelcount != 1
+                            && var.name.find ("].") != std::string::npos)) {
+            constants << "    static constexpr size_t " << member
+                      << "_offset = " << var.offset << ";\n";
+            constants << "    static constexpr size_t " << member
+                      << "_stride = " << (var.toplevelcount != 1
+                          ? var.toplevelstride : var.arraystride) << ";\n";
+            if (var.unsized)
+                end = std::min (end, var.offset);
+            continue;
+        }
+        if (var.offset < cursor)
+            continue;
+        if (var.offset > cursor)
+            out << "    GLubyte padding" << padding++ << "["
+                << var.offset - cursor << "];\n";
+        cursor = var.offset + Declare (out, var, member);
+        asserts.push_back ("static_assert (offsetof (" + id + ", " + member
+                           + ") == " + std::to_string (var.offset) + ", \""
+                           + id + "::" + member + "\");\n");
+    }
+    if (end > cursor)
+        out << "    GLubyte padding" << padding++ << "[" << end - cursor
+            << "];\n";
+    else
+        end = cursor;
+    out << constants.str ();
+    out << "};\n";
+    for (const std::string &line : asserts)
+        out << line;
+    /* a block with only unsized members has no fixed part */
+    if (end)
+        out << "static_assert (sizeof (" << id << ") == " << end << ", \""
+            << id << "\");\n";
+    out << "\n";
+}
+
+static void GenerateInputs (std::ostream &out, const oglp::Program &program)
+{
+    GLint i, count = program.GetInterface (GL_PROGRAM_INPUT,
+                                           GL_ACTIVE_RESOURCES);
+    std::ostringstream inputs;
+    for (i = 0; i < count; i++) {
+        oglp::ProgramResource resource = program.GetResource
+            (GL_PROGRAM_INPUT, i);
+        GLint location = resource.GetProperty (GL_LOCATION);
+        /* built-in inputs have no location */
+        if (location < 0)
+            continue;
+        inputs << "constexpr GLuint "
+               << Identifier (StripArray (ResourceName (resource)))
+               << " = " << location << ";\n";
+    }
+    if (!inputs.str ().empty ())
+        out << "/* vertex inputs */\nnamespace attrib {\n" << inputs.str ()
+            << "} /* namespace attrib */\n\n";
+}
+
+static void Usage (const char *name)
+{
+    fprintf (stderr, "usage: %s [-n namespace] [-o output] source...\n",
+             name);
+}
+
+static int Reflect (int argc, char *argv[])
+{
+    std::string ns = "shaders", output, guard;
+    std::vector<std::string> sources;
+    std::vector<oglp::Shader> shaders;
+    std::vector<std::string> names;
+    std::ostringstream out;
+    bool vertex = false;
+    GLint i, count;
+    int arg;
+
+    for (arg = 1; arg < argc; arg++) {
+        std::string option (argv[arg]);
+        if ((option == "-n" || option == "-o") && arg + 1 < argc) {
+            (option == "-n" ? ns : output) = argv[++arg];
+        } else if (option[0] != '-') {
+            sources.push_back (option);
+        } else {
+            Usage (argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (sources.empty ()) {
+        Usage (argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (!oglp::tools::CreateContext (16, 16)) {
+        fprintf (stderr, "Cannot create an OpenGL context.\n");
+        return EXIT_FAILURE;
+    }
+    if (!oglp::Init (oglp::tools::GetProcAddress)) {
+        fprintf (stderr, "Cannot initialize oglp.\n");
+        return EXIT_FAILURE;
+    }
+
+    /* the program needs the context, so it lives in a nested scope */
+    {
+        oglp::Program program;
+        for (const std::string &filename : sources) {
+            GLenum stage = StageFromFilename (filename);
+            std::ifstream file (filename);
+            std::stringstream source;
+            if (stage == GL_NONE) {
+                fprintf (stderr, "Unknown shader stage of %s.\n", filename.c_str ());
+                return EXIT_FAILURE;
+            }
+            if (!file) {
+                fprintf (stderr, "Cannot open %s.\n", filename.c_str ());
+                return EXIT_FAILURE;
+            }
+            source << file.rdbuf ();
+            shaders.emplace_back (stage);
+            shaders.back ().Source (source.str ());
+            if (!shaders.back ().Compile ()) {
+                fprintf (stderr, "%s:\n%s\n", filename.c_str (),
+                         shaders.back ().GetInfoLog ().c_str ());
+                return EXIT_FAILURE;
+            }
+            program.Attach (shaders.back ());
+            vertex |= (stage == GL_VERTEX_SHADER);
+        }
+        if (!program.Link ()) {
+            fprintf (stderr, "%s\n", program.GetInfoLog ().c_str ());
+            return EXIT_FAILURE;
+        }
+
+        guard = "OGLP_REFLECT_" + Identifier (ns) + "_H";
+        std::transform (guard.begin (), guard.end (), guard.begin (), toupper);
+        out << "/* Generated by oglp-reflect from";
+        for (const std::string &filename : sources)
+            out << " " << filename;
+        out << ", do not edit. */\n\n";
+        out << "#ifndef " << guard << "\n#define " << guard << "\n\n";
+        out << "#include <oglp/oglp.h>\n#include <cstddef>\n\n";
+        out << "namespace " << ns << " {\n\n";
+        for (GLenum blockinterface : { GL_UNIFORM_BLOCK, GL_SHADER_STORAGE_BLOCK }) {
+            count = program.GetInterface (blockinterface, GL_ACTIVE_RESOURCES);
+            for (i = 0; i < count; i++)
+                GenerateBlock (out, program, blockinterface, i, names);
+        }
+        if (vertex)
+            GenerateInputs (out, program);
+        out << "} /* namespace " << ns << " */\n\n";
+        out << "#endif /* !defined " << guard << " */\n";
+    }
+
+    if (output.empty ()) {
+        fputs (out.str ().c_str (), stdout);
+    } else {
+        std::ofstream file (output);
+        file << out.str ();
+        if (!file) {
+            fprintf (stderr, "Cannot write %s.\n", output.c_str ());
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
+int main (int argc, char *argv[])
+{
+    try {
+        return Reflect (argc, argv);
+    } catch (std::exception &e) {
+        fprintf (stderr, "%s\n", e.what ());
+        return EXIT_FAILURE;
+    }
+}
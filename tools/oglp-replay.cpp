@@ -0,0 +1,138 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * oglp-replay: replays a trace recorded with oglp::StartTrace in an
+ * offscreen EGL context and measures the time a range of frames takes.
+ *
+ * usage: oglp-replay [-f first[:last]] [-l loops] [-s width:height] trace
+ *
+ * All frames before the first frame of the range are replayed once to
+ * create the objects the range depends on. Afterwards the range is
+ * replayed the specified number of times and the time of each loop is
+ * reported, including a glFinish at the end of the loop.
+ */
+#include "context.h"
+#include "replay.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+
+static void Usage (const char *name)
+{
+    fprintf (stderr, "usage: %s [-f first[:last]] [-l loops] [-s width:height] trace\n",
+             name);
+}
+
+static int Replay (int argc, char *argv[])
+{
+    oglp::replay::Replayer replayer;
+    const char *filename = NULL;
+    size_t first = 0, last = 0;
+    bool range = false;
+    unsigned long loops = 1, i;
+    EGLint width = 1280, height = 720;
+    std::vector<double> times;
+    int arg;
+
+    for (arg = 1; arg < argc; arg++) {
+        std::string option (argv[arg]);
+        if ((option == "-f" || option == "-l" || option == "-s") && arg + 1 < argc) {
+            const char *value = argv[++arg];
+            char *sep;
+            if (option == "-f") {
+                first = strtoul (value, &sep, 10);
+                last = (*sep == ':') ? strtoul (sep + 1, NULL, 10) : first;
+                range = true;
+            } else if (option == "-l") {
+                loops = strtoul (value, NULL, 10);
+            } else {
+                width = strtol (value, &sep, 10);
+                height = (*sep == ':') ? strtol (sep + 1, NULL, 10) : width;
+            }
+        } else if (!filename && option[0] != '-') {
+            filename = argv[arg];
+        } else {
+            Usage (argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (!filename || !loops || width <= 0 || height <= 0) {
+        Usage (argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (!oglp::tools::CreateContext (width, height)) {
+        fprintf (stderr, "Cannot create an OpenGL context.\n");
+        return EXIT_FAILURE;
+    }
+    if (!oglp::Init (oglp::tools::GetProcAddress)) {
+        fprintf (stderr, "Cannot initialize oglp.\n");
+        return EXIT_FAILURE;
+    }
+    if (!replayer.Load (filename)) {
+        fprintf (stderr, "Cannot load trace %s.\n", filename);
+        return EXIT_FAILURE;
+    }
+    if (replayer.GetNumSkipped ())
+        fprintf (stderr, "Skipping %zu calls that cannot be replayed.\n",
+                 replayer.GetNumSkipped ());
+
+    if (!range) {
+        first = 0;
+        last = replayer.GetNumFrames () - 1;
+    }
+    if (first > last || last >= replayer.GetNumFrames ()) {
+        fprintf (stderr, "Invalid frame range, the trace contains %zu frames.\n",
+                 replayer.GetNumFrames ());
+        return EXIT_FAILURE;
+    }
+
+    replayer.ReplayFrames (0, first);
+    oglp::Finish ();
+
+    for (i = 0; i < loops; i++) {
+        std::chrono::steady_clock::time_point start;
+        start = std::chrono::steady_clock::now ();
+        replayer.ReplayFrames (first, last + 1);
+        oglp::Finish ();
+        times.push_back (std::chrono::duration<double, std::milli>
+                         (std::chrono::steady_clock::now () - start).count ());
+        printf ("loop %lu: %.3f ms (%.3f ms/frame)\n", i, times.back (),
+                times.back () / (last - first + 1));
+    }
+
+    std::sort (times.begin (), times.end ());
+    printf ("frames %zu-%zu, %lu loops: min %.3f ms, median %.3f ms, max %.3f ms\n",
+            first, last, loops, times.front (), times[times.size () / 2],
+            times.back ());
+    return EXIT_SUCCESS;
+}
+
+int main (int argc, char *argv[])
+{
+    try {
+        return Replay (argc, argv);
+    } catch (std::exception &e) {
+        fprintf (stderr, "%s\n", e.what ());
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,275 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "replay.h"
+#include <cstdio>
+
+namespace oglp {
+namespace replay {
+
+/* Size of the scratch memory replayed calls write their results to. */
+static const size_t ScratchSize = 64 << 20;
+
+Call::Call (Replayer &_replayer, const TraceRecordHeader *_header,
+            unsigned int nargs)
+    : replayer (_replayer), header (_header),
+      args (reinterpret_cast<const uint64_t *> (_header + 1)),
+      blobs (reinterpret_cast<const char *> (args + nargs)),
+      end (reinterpret_cast<const char *> (_header) + _header->size),
+      decoded (-1)
+{
+}
+
+const TraceBlobHeader *Call::FindBlob (unsigned int index) const
+{
+    const char *ptr = blobs;
+    while (ptr + sizeof (TraceBlobHeader) <= end) {
+        const TraceBlobHeader *blob = reinterpret_cast<const TraceBlobHeader *> (ptr);
+        /* a blob running past the record ends the search */
+        if (blob->length > size_t (end - ptr) - sizeof (TraceBlobHeader))
+            return NULL;
+        if (blob->index == index)
+            return blob;
+        ptr += sizeof (TraceBlobHeader) + ((blob->length + 7) & ~7);
+    }
+    return NULL;
+}
+
+const void *Call::Data (unsigned int index) const
+{
+    const TraceBlobHeader *blob = FindBlob (index);
+    if (blob)
+        return blob + 1;
+    return reinterpret_cast<const void *> (static_cast<uintptr_t> (args[index]));
+}
+
+void *Call::Scratch (unsigned int index) const
+{
+    (void) index;
+    return replayer.scratch.data ();
+}
+
+GLuint Call::Object (unsigned int index, ObjectType type) const
+{
+    GLuint name = static_cast<GLuint> (args[index]);
+    const std::unordered_map<GLuint, GLuint> &objects = replayer.objects[type];
+    std::unordered_map<GLuint, GLuint>::const_iterator it = objects.find (name);
+    return it != objects.end () ? it->second : name;
+}
+
+const GLuint *Call::Objects (unsigned int index, ObjectType type)
+{
+    const TraceBlobHeader *blob = FindBlob (index);
+    const GLuint *recorded;
+    size_t i, count;
+    if (!blob)
+        return Pointer<const GLuint *> (index);
+    recorded = reinterpret_cast<const GLuint *> (blob + 1);
+    count = blob->length / sizeof (GLuint);
+    replayer.names.resize (count);
+    for (i = 0; i < count; i++) {
+        const std::unordered_map<GLuint, GLuint> &objects = replayer.objects[type];
+        std::unordered_map<GLuint, GLuint>::const_iterator it = objects.find (recorded[i]);
+        replayer.names[i] = it != objects.end () ? it->second : recorded[i];
+    }
+    return replayer.names.data ();
+}
+
+GLsync Call::Sync (unsigned int index) const
+{
+    std::unordered_map<uint64_t, GLsync>::const_iterator it;
+    it = replayer.syncs.find (args[index]);
+    return it != replayer.syncs.end () ? it->second : NULL;
+}
+
+GLint Call::Location (unsigned int program, unsigned int index) const
+{
+    std::map<std::pair<GLuint, GLint>, GLint>::const_iterator it;
+    GLint location = static_cast<GLint> (args[index]);
+    it = replayer.locations.find (std::make_pair (static_cast<GLuint> (args[program]),
+                                                  location));
+    return it != replayer.locations.end () ? it->second : location;
+}
+
+void Call::DecodeStrings (unsigned int index)
+{
+    const TraceBlobHeader *blob;
+    const char *ptr, *blobend;
+
+    if (decoded == static_cast<int> (index))
+        return;
+    decoded = index;
+    replayer.strings.clear ();
+    replayer.lengths.clear ();
+    blob = FindBlob (index);
+    if (!blob)
+        return;
+    ptr = reinterpret_cast<const char *> (blob + 1);
+    blobend = ptr + blob->length;
+    while (ptr + sizeof (uint32_t) <= blobend) {
+        uint32_t length;
+        memcpy (&length, ptr, sizeof (length));
+        ptr += sizeof (length);
+        replayer.strings.push_back (ptr);
+        replayer.lengths.push_back (length);
+        ptr += length;
+    }
+}
+
+const GLchar *const *Call::Strings (unsigned int index)
+{
+    DecodeStrings (index);
+    return replayer.strings.data ();
+}
+
+const GLint *Call::StringLengths (unsigned int index)
+{
+    DecodeStrings (index);
+    return replayer.lengths.data ();
+}
+
+void Call::MapObjects (unsigned int index, ObjectType type)
+{
+    const TraceBlobHeader *blob = FindBlob (index);
+    const GLuint *recorded, *replayed;
+    size_t i;
+    if (!blob)
+        return;
+    recorded = reinterpret_cast<const GLuint *> (blob + 1);
+    replayed = reinterpret_cast<const GLuint *> (replayer.scratch.data ());
+    for (i = 0; i < blob->length / sizeof (GLuint); i++)
+        replayer.objects[type][recorded[i]] = replayed[i];
+}
+
+void Call::MapObject (ObjectType type, GLuint name)
+{
+    replayer.objects[type][static_cast<GLuint> (header->ret)] = name;
+}
+
+void Call::MapSync (GLsync sync)
+{
+    replayer.syncs[header->ret] = sync;
+}
+
+void Call::MapLocation (unsigned int program, GLint location)
+{
+    replayer.locations[std::make_pair (static_cast<GLuint> (args[program]),
+                                       static_cast<GLint> (header->ret))] = location;
+}
+
+Replayer::Replayer (void) : skipped (0), scratch (ScratchSize)
+{
+    frames.push_back (0);
+}
+
+bool Replayer::Load (const std::string &filename)
+{
+    static const char magic[8] = { 'O', 'G', 'L', 'P', 'T', 'R', 'C', '1' };
+    std::unordered_map<std::string, const ReplayProc *> bynames;
+    uint32_t version, nprocs, i;
+    size_t offset, size;
+    FILE *file;
+
+    file = fopen (filename.c_str (), "rb");
+    if (!file)
+        return false;
+    fseek (file, 0, SEEK_END);
+    size = ftell (file);
+    fseek (file, 0, SEEK_SET);
+    /* records are 8 byte aligned within the file */
+    data.resize (size + sizeof (uint64_t));
+    offset = (8 - (reinterpret_cast<uintptr_t> (data.data ()) & 7)) & 7;
+    if (fread (data.data () + offset, 1, size, file) != size) {
+        fclose (file);
+        return false;
+    }
+    fclose (file);
+
+    const char *ptr = data.data () + offset;
+    const char *end = ptr + size;
+    if (size < 16 || memcmp (ptr, magic, sizeof (magic)))
+        return false;
+    memcpy (&version, ptr + 8, sizeof (version));
+    memcpy (&nprocs, ptr + 12, sizeof (nprocs));
+    if (version != TraceVersion)
+        return false;
+
+    for (i = 0; i < NumReplayProcs; i++)
+        bynames[ReplayProcs[i].name] = &ReplayProcs[i];
+
+    ptr += 16;
+    offset = 0;
+    procs.resize (nprocs);
+    for (i = 0; i < nprocs; i++) {
+        std::unordered_map<std::string, const ReplayProc *>::const_iterator it;
+        uint16_t length;
+        if (ptr + offset + sizeof (length) > end)
+            return false;
+        memcpy (&length, ptr + offset, sizeof (length));
+        offset += sizeof (length);
+        if (ptr + offset + length > end)
+            return false;
+        it = bynames.find (std::string (ptr + offset, length));
+        procs[i] = it != bynames.end () ? it->second : NULL;
+        offset += length;
+    }
+    ptr += (offset + 7) & ~7;
+
+    records.clear ();
+    frames.assign (1, 0);
+    skipped = 0;
+    while (ptr + sizeof (TraceRecordHeader) <= end) {
+        const TraceRecordHeader *header = reinterpret_cast<const TraceRecordHeader *> (ptr);
+        if (header->size < sizeof (TraceRecordHeader) || ptr + header->size > end)
+            return false;
+        ptr += header->size;
+        if (header->id == TraceFrameMarker) {
+            frames.push_back (records.size ());
+            continue;
+        }
+        if (header->id >= nprocs || !procs[header->id] || !procs[header->id]->func) {
+            skipped++;
+            continue;
+        }
+        /* the record has to hold all argument slots */
+        if ((header->size - sizeof (TraceRecordHeader)) / sizeof (uint64_t)
+            < procs[header->id]->nargs)
+            return false;
+        records.push_back (header);
+    }
+    if (frames.back () != records.size () || frames.size () == 1)
+        frames.push_back (records.size ());
+    return true;
+}
+
+void Replayer::ReplayFrames (size_t first, size_t last)
+{
+    size_t i;
+    if (last > GetNumFrames ())
+        last = GetNumFrames ();
+    if (first >= last)
+        return;
+    for (i = frames[first]; i < frames[last]; i++) {
+        const ReplayProc *proc = procs[records[i]->id];
+        Call call (*this, records[i], proc->nargs);
+        proc->func (call);
+    }
+}
+
+} /* namespace replay */
+} /* namespace oglp */
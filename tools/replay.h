@@ -0,0 +1,283 @@
+/*
+ * Copyright 2015 Daniel Kirchner
+ *
+ * This file is part of midium.
+ *
+ * midium is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * midium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with midium.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OGLP_REPLAY_H
+#define OGLP_REPLAY_H
+
+#include <oglp/oglp.h>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace oglp {
+namespace replay {
+
+/** Object name spaces remapped during replay. */
+enum ObjectType
+{
+    ObjectBuffer,
+    ObjectTexture,
+    ObjectProgram,
+    ObjectShader,
+    ObjectVertexArray,
+    ObjectFramebuffer,
+    ObjectRenderbuffer,
+    ObjectSampler,
+    ObjectQuery,
+    ObjectTransformFeedback,
+    ObjectPipeline,
+    NumObjectTypes
+};
+
+class Replayer;
+
+/** Recorded call.
+ * Decodes the arguments of a single trace record for the generated
+ * replay functions. Object names, sync objects and uniform locations
+ * are translated from the recorded to the replayed values, pointers
+ * refer to the recorded client memory blocks.
+ */
+class Call
+{
+public:
+    /**
+       * Constructor.
+       * \param replayer Specifies the replayer owning the record.
+       * \param header Specifies the record.
+       * \param nargs Specifies the number of arguments of the entry point.
+       */
+    Call (Replayer &replayer, const TraceRecordHeader *header,
+          unsigned int nargs);
+
+    /**
+       * Get an argument.
+       * \param index Specifies the index of the argument.
+       * \return The recorded value.
+       */
+    template<typename T>
+    T Value (unsigned int index) const
+    {
+        return TraceDecode<T> (args[index]);
+    }
+
+    /**
+       * Get an object name argument.
+       * \param index Specifies the index of the argument.
+       * \param type Specifies the name space of the object.
+       * \return The name of the replayed object.
+       */
+    GLuint Object (unsigned int index, ObjectType type) const;
+
+    /**
+       * Get an array of object names.
+       * \param index Specifies the index of the argument.
+       * \param type Specifies the name space of the objects.
+       * \return The names of the replayed objects.
+       */
+    const GLuint *Objects (unsigned int index, ObjectType type);
+
+    /**
+       * Get a sync object argument.
+       * \param index Specifies the index of the argument.
+       * \return The replayed sync object.
+       */
+    GLsync Sync (unsigned int index) const;
+
+    /**
+       * Get a uniform location argument.
+       * \param program Specifies the index of the program argument.
+       * \param index Specifies the index of the location argument.
+       * \return The location in the replayed program.
+       */
+    GLint Location (unsigned int program, unsigned int index) const;
+
+    /**
+       * Get a pointer argument.
+       * Returns the recorded client memory block of the argument. If no
+       * block was recorded, the argument is an offset into a buffer
+       * object and returned as recorded.
+       * \param index Specifies the index of the argument.
+       * \return The pointer to pass to the entry point.
+       */
+    template<typename T>
+    T Pointer (unsigned int index) const
+    {
+        return reinterpret_cast<T> (Data (index));
+    }
+
+    /**
+       * Get an output pointer argument.
+       * \param index Specifies the index of the argument.
+       * \return Scratch memory the entry point may write to.
+       */
+    template<typename T>
+    T Output (unsigned int index) const
+    {
+        return reinterpret_cast<T> (Scratch (index));
+    }
+
+    /**
+       * Get a list of strings.
+       * \param index Specifies the index of the argument.
+       * \return The recorded strings.
+       */
+    const GLchar *const *Strings (unsigned int index);
+
+    /**
+       * Get the lengths of a list of strings.
+       * \param index Specifies the index of the string list argument.
+       * \return The lengths of the recorded strings.
+       */
+    const GLint *StringLengths (unsigned int index);
+
+    /**
+       * Map generated object names.
+       * Associates the names recorded for an output argument with the
+       * names the replayed call wrote into its scratch memory.
+       * \param index Specifies the index of the argument.
+       * \param type Specifies the name space of the objects.
+       */
+    void MapObjects (unsigned int index, ObjectType type);
+
+    /**
+       * Map a returned object name.
+       * \param type Specifies the name space of the object.
+       * \param name Specifies the name returned by the replayed call.
+       */
+    void MapObject (ObjectType type, GLuint name);
+
+    /**
+       * Map a returned sync object.
+       * \param sync Specifies the sync object returned by the replayed call.
+       */
+    void MapSync (GLsync sync);
+
+    /**
+       * Map a returned uniform location.
+       * \param program Specifies the index of the program argument.
+       * \param location Specifies the location returned by the replayed call.
+       */
+    void MapLocation (unsigned int program, GLint location);
+
+private:
+    const TraceBlobHeader *FindBlob (unsigned int index) const;
+    const void *Data (unsigned int index) const;
+    void *Scratch (unsigned int index) const;
+    void DecodeStrings (unsigned int index);
+
+    Replayer &replayer;
+    const TraceRecordHeader *header;
+    const uint64_t *args;
+    const char *blobs;
+    const char *end;
+    int decoded;
+};
+
+/** Generated function replaying calls of a single entry point. */
+typedef void (*ReplayFunc) (Call &call);
+
+/** Replay information of an entry point. */
+struct ReplayProc
+{
+    /** Name of the entry point. */
+    const char *name;
+    /** Number of arguments. */
+    unsigned int nargs;
+    /** Replay function, or NULL if the entry point cannot be replayed. */
+    ReplayFunc func;
+};
+
+extern const unsigned int NumReplayProcs;
+extern const ReplayProc ReplayProcs[];
+
+/** Trace replayer.
+ * Loads a trace file recorded with StartTrace and replays its calls
+ * through the oglp entry points of the current context. Records are
+ * replayed in file order, so traces recorded from several threads
+ * are only replayed correctly if the threads were synchronized at
+ * the points they flushed their staging buffers. Memory written
+ * through mapped buffer pointers is not part of the trace.
+ */
+class Replayer
+{
+public:
+    /**
+       * Default constructor.
+       */
+    Replayer (void);
+
+    /**
+       * Load a trace.
+       * Reads the trace file and splits it into frames.
+       * \param filename Specifies the trace file.
+       * \return Whether the trace was loaded successfully.
+       */
+    bool Load (const std::string &filename);
+
+    /**
+       * Get the number of frames.
+       * \return The number of frames in the trace. A trace without
+       *         frame markers consists of a single frame.
+       */
+    size_t GetNumFrames (void) const
+    {
+        return frames.size () - 1;
+    }
+
+    /**
+       * Get the number of records that cannot be replayed.
+       * \return The number of records of unknown entry points.
+       */
+    size_t GetNumSkipped (void) const
+    {
+        return skipped;
+    }
+
+    /**
+       * Replay frames.
+       * \param first Specifies the first frame to replay.
+       * \param last Specifies the frame after the last frame to replay.
+       */
+    void ReplayFrames (size_t first, size_t last);
+
+private:
+    friend class Call;
+
+    std::vector<char> data;
+    std::vector<const ReplayProc *> procs;
+    std::vector<const TraceRecordHeader *> records;
+    std::vector<size_t> frames;
+    size_t skipped;
+
+    std::unordered_map<GLuint, GLuint> objects[NumObjectTypes];
+    std::unordered_map<uint64_t, GLsync> syncs;
+    std::map<std::pair<GLuint, GLint>, GLint> locations;
+
+    std::vector<char> scratch;
+    std::vector<GLuint> names;
+    std::vector<const GLchar *> strings;
+    std::vector<GLint> lengths;
+};
+
+} /* namespace replay */
+} /* namespace oglp */
+
+#endif /* !defined OGLP_REPLAY_H */